@@ -8,9 +8,12 @@ set(BASE_UNIX_AND_DARWIN_SRC
     src/unix/dir.cpp
     src/unix/dlunix.cpp
     src/unix/epolldispatcher.cpp
+    src/unix/iouringdispatcher.cpp
     src/unix/evtloopunix.cpp
     src/unix/fdiounix.cpp
     src/unix/snglinst.cpp
+    src/unix/mappedfile.cpp
+    src/unix/shmipc.cpp
     src/unix/stackwalk.cpp
     src/unix/timerunx.cpp
     src/unix/threadpsx.cpp
@@ -69,6 +72,7 @@ set(BASE_WIN32_SRC
     src/msw/registry.cpp
     src/msw/secretstore.cpp
     src/msw/snglinst.cpp
+    src/msw/mappedfile.cpp
     src/msw/stackwalk.cpp
     src/msw/stdpaths.cpp
     src/msw/thread.cpp
@@ -410,6 +414,7 @@ set(BASE_CMN_SRC
     src/common/any.cpp
     src/common/appbase.cpp
     src/common/arcall.cpp
+    src/common/arcextract.cpp
     src/common/arcfind.cpp
     src/common/archive.cpp
     src/common/arrstr.cpp
@@ -426,6 +431,7 @@ set(BASE_CMN_SRC
     src/common/dynload.cpp
     src/common/encconv.cpp
     src/common/evtloopcmn.cpp
+    src/common/evtprofiler.cpp
     src/common/extended.c
     src/common/ffile.cpp
     src/common/file.cpp
@@ -492,8 +498,12 @@ set(BASE_CMN_SRC
     src/common/fswatchercmn.cpp
     src/generic/fswatcherg.cpp
     src/common/lzmastream.cpp
+    src/common/lz4stream.cpp
+    src/common/zstdstream.cpp
+    src/common/mappedfilecmn.cpp
     src/common/uilocale.cpp
     src/common/fs_data.cpp
+    src/common/threadpool.cpp
 )
 
 set(BASE_AND_GUI_CMN_SRC
@@ -510,6 +520,7 @@ set(BASE_CMN_HDR
     wx/app.h
     wx/apptrait.h
     wx/archive.h
+    wx/arcextract.h
     wx/arrimpl.cpp
     wx/arrstr.h
     wx/atomic.h
@@ -546,6 +557,7 @@ set(BASE_CMN_HDR
     wx/eventfilter.h
     wx/evtloop.h
     wx/evtloopsrc.h
+    wx/evtprofiler.h
     wx/except.h
     wx/features.h
     wx/flags.h
@@ -669,9 +681,14 @@ set(BASE_CMN_HDR
     wx/fswatcher.h
     wx/generic/fswatcher.h
     wx/lzmastream.h
+    wx/lz4stream.h
+    wx/zstdstream.h
+    wx/mappedfile.h
+    wx/shmipc.h
     wx/localedefs.h
     wx/uilocale.h
     wx/fs_data.h
+    wx/threadpool.h
 )
 
 set(NET_UNIX_SRC
@@ -694,6 +711,7 @@ set(NET_CMN_SRC
     src/common/fs_inet.cpp
     src/common/ftp.cpp
     src/common/http.cpp
+    src/common/httpcache.cpp
     src/common/protocol.cpp
     src/common/sckaddr.cpp
     src/common/sckfile.cpp
@@ -707,6 +725,7 @@ set(NET_CMN_SRC
 
 set(NET_CMN_HDR
     wx/fs_inet.h
+    wx/httpcache.h
     wx/protocol/file.h
     wx/protocol/ftp.h
     wx/protocol/http.h
@@ -816,11 +835,13 @@ set(GUI_CMN_SRC
     src/common/nbkbase.cpp
     src/common/overlaycmn.cpp
     src/common/ownerdrwcmn.cpp
+    src/common/paintprofiler.cpp
     src/common/paper.cpp
     src/common/panelcmn.cpp
     src/common/persist.cpp
     src/common/pickerbase.cpp
     src/common/popupcmn.cpp
+    src/common/premultiply.cpp
     src/common/preferencescmn.cpp
     src/common/prntbase.cpp
     src/common/quantize.cpp
@@ -828,6 +849,7 @@ set(GUI_CMN_SRC
     src/common/radiocmn.cpp
     src/common/rearrangectrl.cpp
     src/common/rendcmn.cpp
+    src/common/resourcestats.cpp
     src/common/rgncmn.cpp
     src/common/scrolbarcmn.cpp
     src/common/settcmn.cpp
@@ -893,6 +915,7 @@ set(GUI_CMN_SRC
     src/generic/treebkg.cpp
     src/generic/vlbox.cpp
     src/generic/vscroll.cpp
+    src/generic/windowless.cpp
     src/xrc/xmlreshandler.cpp
     src/common/bmpcboxcmn.cpp
     src/generic/grideditors.cpp
@@ -1018,6 +1041,7 @@ set(GUI_CMN_HDR
     wx/nativewin.h
     wx/numdlg.h
     wx/overlay.h
+    wx/paintprofiler.h
     wx/palette.h
     wx/panel.h
     wx/pen.h
@@ -1029,6 +1053,7 @@ set(GUI_CMN_HDR
     wx/range.h
     wx/rearrangectrl.h
     wx/renderer.h
+    wx/resourcestats.h
     wx/richmsgdlg.h
     wx/scrolbar.h
     wx/scrolwin.h
@@ -1053,6 +1078,7 @@ set(GUI_CMN_HDR
     wx/valtext.h
     wx/valnum.h
     wx/window.h
+    wx/windowless.h
     wx/windowid.h
     wx/windowptr.h
     wx/withimages.h
@@ -1318,6 +1344,7 @@ set(GTK_LOWLEVEL_SRC
     src/gtk/renderer.cpp
     src/gtk/settings.cpp
     src/gtk/textmeasure.cpp
+    src/gtk/layoutcache.cpp
     src/gtk/timer.cpp
     src/gtk/tooltip.cpp
     src/gtk/toplevel.cpp
@@ -348,6 +348,22 @@ if(wxUSE_LIBLZMA)
     endif()
 endif()
 
+if(wxUSE_LIBZSTD)
+    find_package(ZSTD)
+    if(NOT ZSTD_FOUND)
+        message(WARNING "libzstd not found, Zstandard compression won't be available")
+        wx_option_force_value(wxUSE_LIBZSTD OFF)
+    endif()
+endif()
+
+if(wxUSE_LIBLZ4)
+    find_package(LZ4)
+    if(NOT LZ4_FOUND)
+        message(WARNING "liblz4 not found, LZ4 compression won't be available")
+        wx_option_force_value(wxUSE_LIBLZ4 OFF)
+    endif()
+endif()
+
 if (wxUSE_WEBREQUEST)
     if(wxUSE_WEBREQUEST_CURL)
         find_package(CURL)
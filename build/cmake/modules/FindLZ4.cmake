@@ -0,0 +1,26 @@
+# Find the LZ4 headers and libraries.
+#
+#  This module defines the following variables:
+#     LZ4_FOUND        - true if liblz4 is found.
+#     LZ4_INCLUDE_DIRS - list of liblz4 include directories.
+#     LZ4_LIBRARIES    - list of liblz4 libraries.
+
+find_package(PkgConfig QUIET)
+pkg_check_modules(PC_LZ4 QUIET liblz4)
+
+find_path(LZ4_INCLUDE_DIRS
+    NAMES lz4frame.h
+    HINTS ${PC_LZ4_INCLUDEDIR}
+          ${PC_LZ4_INCLUDE_DIRS}
+)
+
+find_library(LZ4_LIBRARIES
+    NAMES lz4
+    HINTS ${PC_LZ4_LIBDIR}
+          ${PC_LZ4_LIBRARY_DIRS}
+)
+
+include(FindPackageHandleStandardArgs)
+FIND_PACKAGE_HANDLE_STANDARD_ARGS(LZ4 REQUIRED_VARS LZ4_LIBRARIES LZ4_INCLUDE_DIRS VERSION_VAR PC_LZ4_VERSION)
+
+mark_as_advanced(LZ4_LIBRARIES LZ4_INCLUDE_DIRS)
@@ -576,6 +576,9 @@ else()
         set(wxUSE_SELECT_DISPATCHER ON)
     endif()
     check_include_file(sys/epoll.h wxUSE_EPOLL_DISPATCHER)
+    # Check for the symbol which is only available since Linux 5.11, as we
+    # need the corresponding feature.
+    check_symbol_exists(IORING_FEAT_EXT_ARG linux/io_uring.h wxUSE_IOURING_DISPATCHER)
 endif()
 check_include_file(sys/select.h HAVE_SYS_SELECT_H)
 
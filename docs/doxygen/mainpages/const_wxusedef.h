@@ -143,9 +143,11 @@ library:
 @itemdef{wxUSE_IPV6, Use experimental wxIPV6address and related classes.}
 @itemdef{wxUSE_JOYSTICK, Use wxJoystick class.}
 @itemdef{wxUSE_LIBJPEG, Enables JPEG format support (requires libjpeg).}
+@itemdef{wxUSE_LIBLZ4, Enables LZ4 compression support (requires liblz4).}
 @itemdef{wxUSE_LIBLZMA, Enables LZMA compression support (see @ref page_build_liblzma).}
 @itemdef{wxUSE_LIBPNG, Enables PNG format support (requires libpng). Also requires wxUSE_ZLIB.}
 @itemdef{wxUSE_LIBTIFF, Enables TIFF format support (requires libtiff).}
+@itemdef{wxUSE_LIBZSTD, Enables Zstandard compression support (requires libzstd).}
 @itemdef{wxUSE_LISTBOOK, Use wxListbook class.}
 @itemdef{wxUSE_LISTBOX, Use wxListBox class.}
 @itemdef{wxUSE_LISTCTRL, Use wxListCtrl class.}
@@ -267,6 +269,7 @@ library:
 @beginDefList
 @itemdef{wxUSE_EPOLL_DISPATCHER, Use wxEpollDispatcher class. See also wxUSE_SELECT_DISPATCHER.}
 @itemdef{wxUSE_GSTREAMER, Use GStreamer library in wxMediaCtrl.}
+@itemdef{wxUSE_IOURING_DISPATCHER, Use wxIOUringDispatcher class if io_uring is available at run-time. See also wxUSE_EPOLL_DISPATCHER.}
 @itemdef{wxUSE_LIBMSPACK, Use libmspack library.}
 @itemdef{wxUSE_LIBSDL, Use SDL for wxSound implementation.}
 @itemdef{wxUSE_PLUGINS, See also wxUSE_LIBSDL.}
@@ -38,6 +38,13 @@ computer only. If you want to use IPC between different workstations you should
 define @c wxUSE_DDE_FOR_IPC as 0 before including this header -- this will
 force using TCP/IP implementation even under Windows.
 
+Under Unix systems, a third implementation, using shared memory, is available
+in wxSharedMemoryServer, wxSharedMemoryClient and wxSharedMemoryConnection
+classes. It only works between processes running on the same computer but is
+much faster than the socket-based one, especially when exchanging big amounts
+of data. It is never selected by @c @<wx/ipc.h@> and these classes need to be
+used explicitly.
+
 The following description refers to wxWidgets, but remember that the equivalent
 wxTCP* and wxDDE* classes can be used in much the same way.
 
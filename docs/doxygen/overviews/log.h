@@ -150,6 +150,17 @@ the log level of the parent component but that all other database code
 subcomponents inherit its setting by default and so won't generate any log
 messages at all.
 
+Finally, the messages at some levels can be removed from the program entirely
+by predefining @c wxLOG_COMPILED_LEVEL before including any wxWidgets headers.
+For example, if it is defined as @c wxLOG_Info, all wxLogDebug() and
+wxLogTrace() statements are removed by the compiler and their arguments are
+never evaluated. This is useful for the code using a lot of debug logging
+statements in performance-sensitive places. Note that the log statements which
+are not removed at compile-time but are disabled at run-time are cheap too, as
+checking whether they're enabled only involves comparing the level with the
+current maximal log level and, for wxLogTrace(), checking whether any trace
+masks are enabled at all.
+
 
 
 @section overview_log_targets Log Targets
@@ -264,6 +264,11 @@ switches and options:
     containing class definitions for the windows defined by the XRC file (see
     special subsection).
 @li -u (\--uncompressed): Do not compress XML files (C++ only).
+@li -b (\--binary): Store the resources in the compiled binary format which is
+    much faster to load than XML. If the output file has @c .xrb extension,
+    a single binary file, which can be loaded directly using
+    wxXmlResource::Load(), is created instead of an archive. This is only
+    possible for a single XRC file not referencing any other files.
 @li -g (\--gettext): Output underscore-wrapped strings that poEdit or gettext
     can scan. Outputs to stdout, or a file if -o is used.
 @li -n (\--function) @<name@>: Specify C++ function name (use with -c).
@@ -278,6 +283,7 @@ For example:
 $ wxrc resource.xrc
 $ wxrc resource.xrc -o resource.xrs
 $ wxrc resource.xrc -v -c -o resource.cpp
+$ wxrc resource.xrc -b -o resource.xrb
 @endcode
 
 @note XRS file is essentially a renamed ZIP archive which means that you can
@@ -0,0 +1,152 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        wx/arcextract.h
+// Purpose:     wxArchiveExtractor extracting archive files using threads
+// Author:      wxWidgets team
+// Created:     2026-10-14
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef _WX_ARCEXTRACT_H_
+#define _WX_ARCEXTRACT_H_
+
+#include "wx/defs.h"
+
+#if wxUSE_STREAMS && wxUSE_ARCHIVE_STREAMS && wxUSE_FFILE
+
+#include "wx/archive.h"
+#include "wx/event.h"
+
+#include <atomic>
+
+class WXDLLIMPEXP_FWD_BASE wxArchiveExtractorEvent;
+
+wxDECLARE_EXPORTED_EVENT( WXDLLIMPEXP_BASE, wxEVT_ARCHIVE_EXTRACT, wxArchiveExtractorEvent );
+
+// ----------------------------------------------------------------------------
+// wxArchiveExtractor: extracts all entries of an archive file to a directory
+// ----------------------------------------------------------------------------
+
+class WXDLLIMPEXP_BASE wxArchiveExtractor : public wxEvtHandler
+{
+public:
+    // If the factory is not specified, the one corresponding to the archive
+    // file extension is used.
+    explicit wxArchiveExtractor(const wxString& archive,
+                                const wxArchiveClassFactory* factory = nullptr);
+
+    // Set the number of threads to use for extracting the files, 0 (default)
+    // means to use as many threads as there are CPUs and 1 to not use any
+    // threads at all.
+    void SetThreadCount(int count);
+    int GetThreadCount() const { return m_threadCount; }
+
+    // Extract all archive entries to the given directory, which is created if
+    // it doesn't exist yet. Blocks until all the entries are extracted, while
+    // sending wxEVT_ARCHIVE_EXTRACT events to this object after extracting
+    // each of them.
+    //
+    // Returns false if any error occurred or if Cancel() was called.
+    bool Extract(const wxString& destDir);
+
+    // Can be called from wxEVT_ARCHIVE_EXTRACT handler to stop extracting the
+    // remaining entries.
+    void Cancel() { m_cancelled = true; }
+    bool IsCancelled() const { return m_cancelled; }
+
+private:
+    struct Item;
+
+    // Create a new stream for reading the archive or return nullptr.
+    wxArchiveInputStream* OpenArchive(wxInputStream* stream) const;
+
+    // Create all the entries described by the items with the indices taken
+    // from next, until there are no more of them, calling report() after
+    // processing each of them.
+    template <typename F>
+    void ExtractFiles(const Item* items,
+                      size_t count,
+                      std::atomic<size_t>& next,
+                      F report);
+
+    // Extract a single file and set its attributes.
+    static bool ExtractFile(wxArchiveInputStream& arc,
+                            const Item& item,
+                            char* buf,
+                            size_t bufSize);
+
+    // Send wxEVT_ARCHIVE_EXTRACT event for the given item.
+    void SendProgressEvent(const Item& item, bool ok);
+
+
+    const wxString m_archive;
+    const wxArchiveClassFactory* m_factory;
+
+    int m_threadCount = 0;
+
+    std::atomic<bool> m_cancelled{false};
+
+    // Progress information updated by Extract().
+    size_t m_countDone = 0,
+           m_countTotal = 0;
+    wxFileOffset m_sizeDone = 0,
+                 m_sizeTotal = 0;
+
+    wxDECLARE_NO_COPY_CLASS(wxArchiveExtractor);
+};
+
+// ----------------------------------------------------------------------------
+// wxArchiveExtractorEvent: sent after extracting each archive entry
+// ----------------------------------------------------------------------------
+
+class WXDLLIMPEXP_BASE wxArchiveExtractorEvent : public wxEvent
+{
+public:
+    wxArchiveExtractorEvent(wxEventType type = wxEVT_NULL, int id = wxID_ANY)
+        : wxEvent(id, type)
+    {
+    }
+
+    // The name of the entry which was just extracted and the path of the
+    // file or directory created for it.
+    const wxString& GetEntryName() const { return m_entryName; }
+    const wxString& GetPath() const { return m_path; }
+
+    // Return false if extracting this entry failed.
+    bool IsOk() const { return m_ok; }
+
+    // The number of entries processed so far and their total number.
+    size_t GetExtractedCount() const { return m_countDone; }
+    size_t GetTotalCount() const { return m_countTotal; }
+
+    // The size of the data extracted so far and the total size of all files.
+    wxFileOffset GetExtractedSize() const { return m_sizeDone; }
+    wxFileOffset GetTotalSize() const { return m_sizeTotal; }
+
+    virtual wxEvent *Clone() const override { return new wxArchiveExtractorEvent(*this); }
+
+private:
+    wxString m_entryName,
+             m_path;
+    bool m_ok = true;
+    size_t m_countDone = 0,
+           m_countTotal = 0;
+    wxFileOffset m_sizeDone = 0,
+                 m_sizeTotal = 0;
+
+    friend class wxArchiveExtractor;
+
+    wxDECLARE_DYNAMIC_CLASS_NO_ASSIGN_DEF_COPY(wxArchiveExtractorEvent);
+};
+
+typedef void (wxEvtHandler::*wxArchiveExtractorEventFunction)(wxArchiveExtractorEvent&);
+
+#define wxArchiveExtractorEventHandler(func) \
+    wxEVENT_HANDLER_CAST(wxArchiveExtractorEventFunction, func)
+
+#define EVT_ARCHIVE_EXTRACT(id, func) \
+   wx__DECLARE_EVT1(wxEVT_ARCHIVE_EXTRACT, id, wxArchiveExtractorEventHandler(func))
+
+#endif // wxUSE_STREAMS && wxUSE_ARCHIVE_STREAMS && wxUSE_FFILE
+
+#endif // _WX_ARCEXTRACT_H_
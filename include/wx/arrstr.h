@@ -126,10 +126,7 @@ public:
     wxSortedArrayString(const wxArrayString& src)
         : wxSortedArrayStringBase(wxStringSortAscending)
     {
-        reserve(src.size());
-
-        for ( size_t n = 0; n < src.size(); n++ )
-            Add(src[n]);
+        AddSorted(src);
     }
     explicit wxSortedArrayString(wxArrayString::CompareFunction compareFunction)
         : wxSortedArrayStringBase(compareFunction)
@@ -137,6 +134,15 @@ public:
 
     int Index(const wxString& str, bool bCase = true, bool bFromEnd = false) const;
 
+    // Add all strings in the given range, this is much more efficient than
+    // adding them one by one when there are many of them.
+    void AddSorted(const wxString* first, const wxString* last);
+    void AddSorted(const wxArrayString& strings)
+    {
+        if ( !strings.empty() )
+            AddSorted(strings.data(), strings.data() + strings.size());
+    }
+
 private:
     void Insert()
     {
@@ -402,6 +408,9 @@ public:
 protected:
   void Copy(const wxArrayString& src);  // copies the contents of another array
 
+  // add all strings in the given range to the sorted array
+  void DoAddSorted(const wxString* first, const wxString* last);
+
   CompareFunction m_compareFunction = nullptr; // set only from wxSortedArrayString
 
 private:
@@ -429,11 +438,18 @@ public:
   wxSortedArrayString() : wxArrayString(true)
     { }
   wxSortedArrayString(const wxArrayString& array) : wxArrayString(true)
-    { Copy(array); }
+    { AddSorted(array); }
 
   explicit wxSortedArrayString(CompareFunction compareFunction)
       : wxArrayString(true)
     { m_compareFunction = compareFunction; }
+
+  // add all strings in the given range, this is much more efficient than
+  // adding them one by one when there are many of them
+  void AddSorted(const wxString* first, const wxString* last)
+    { DoAddSorted(first, last); }
+  void AddSorted(const wxArrayString& strings)
+    { DoAddSorted(strings.begin(), strings.end()); }
 };
 
 #endif // !wxUSE_STD_CONTAINERS
@@ -25,6 +25,8 @@
 #include "wx/aui/framemanager.h"
 #include "wx/compositebookctrl.h"
 
+#include <vector>
+
 
 class wxAuiNotebook;
 
@@ -176,6 +178,10 @@ public:
     // Make the tab visible if it wasn't already
     void MakeTabVisible(int tabPage, wxWindow* win);
 
+    // Forget the cached tab sizes, must be called if anything affecting them
+    // other than the tab caption, bitmap or state changes.
+    void InvalidateTabSizes();
+
 protected:
 
     virtual void Render(wxDC* dc, wxWindow* wnd);
@@ -192,6 +198,31 @@ protected:
 
 private:
     int GetCloseButtonState(const wxAuiNotebookPage& page) const;
+
+    // Return the size of the tab with the given index, as computed by
+    // wxAuiTabArt::GetTabSize(), reusing the cached value if possible.
+    wxSize GetTabSize(wxDC& dc, wxWindow* wnd, size_t idx, int* x_extent);
+
+    // Cached tab size and the tab attributes used to compute it.
+    struct TabSizeInfo
+    {
+        wxString caption;
+        wxBitmapBundle bitmap;
+        bool active;
+        int closeButtonState;
+
+        wxSize size;
+        int extent;
+    };
+
+    std::vector<TabSizeInfo> m_tabSizes;
+
+    // Scale factor of the window for which m_tabSizes were computed.
+    double m_tabSizesScale;
+
+    // Off-screen bitmap reused by Render() if native double buffering is not
+    // available.
+    wxBitmap m_renderBitmap;
 };
 
 
@@ -26,6 +26,8 @@
 #include "wx/bmpbndl.h"
 #include "wx/overlay.h"
 
+#include <vector>
+
 enum wxAuiManagerDock
 {
     wxAUI_DOCK_NONE = 0,
@@ -622,6 +624,13 @@ private:
     // m_actionPart. If m_actionPart is null, returns wxNOT_FOUND.
     int GetActionPartIndex() const;
 
+    // Fill the provided vector with all the values affecting the result of
+    // LayoutAll(): if they don't change, the layout doesn't need to be redone.
+    void GetLayoutKey(std::vector<wxUIntPtr>& key) const;
+
+    // The layout key at the end of the last Update() call.
+    std::vector<wxUIntPtr> m_layoutKey;
+
 #ifndef SWIG
     wxDECLARE_EVENT_TABLE();
     wxDECLARE_CLASS(wxAuiManager);
@@ -16,6 +16,9 @@
 #include "wx/string.h"
 #include "wx/buffer.h"
 
+class WXDLLIMPEXP_FWD_BASE wxInputStream;
+class WXDLLIMPEXP_FWD_BASE wxOutputStream;
+
 // ----------------------------------------------------------------------------
 // encoding functions
 // ----------------------------------------------------------------------------
@@ -50,6 +53,17 @@ inline wxString wxBase64Encode(const wxMemoryBuffer& buf)
     return wxBase64Encode(buf.GetData(), buf.GetDataLen());
 }
 
+#if wxUSE_STREAMS
+
+// encode all data read from the input stream until its end and write it to the
+// output stream without loading all of it in memory
+//
+// returns the number of characters written or wxCONV_FAILED if writing failed
+WXDLLIMPEXP_BASE size_t
+wxBase64Encode(wxOutputStream& dst, wxInputStream& src);
+
+#endif // wxUSE_STREAMS
+
 // ----------------------------------------------------------------------------
 // decoding functions
 // ----------------------------------------------------------------------------
@@ -118,6 +132,20 @@ wxBase64Decode(const wxString& src,
     return wxBase64Decode(src.ToAscii(), wxNO_LEN, mode, posErr);
 }
 
+#if wxUSE_STREAMS
+
+// decode all data read from the input stream until its end and write it to the
+// output stream
+//
+// returns the number of bytes written or wxCONV_FAILED if the input is invalid
+// or writing failed, notice that some data may have been already written to
+// the output stream in this case
+WXDLLIMPEXP_BASE size_t
+wxBase64Decode(wxOutputStream& dst, wxInputStream& src,
+               wxBase64DecodeMode mode = wxBase64DecodeMode_Strict);
+
+#endif // wxUSE_STREAMS
+
 #endif // wxUSE_BASE64
 
 #endif // _WX_BASE64_H_
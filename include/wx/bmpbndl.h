@@ -14,8 +14,11 @@
 #include "wx/object.h"
 #include "wx/vector.h"
 
+#include <functional>
+
 class wxBitmapBundleImpl;
 class WXDLLIMPEXP_FWD_CORE wxIconBundle;
+class WXDLLIMPEXP_FWD_CORE wxImage;
 class WXDLLIMPEXP_FWD_CORE wxImageList;
 class WXDLLIMPEXP_FWD_BASE wxVariant;
 class WXDLLIMPEXP_FWD_CORE wxWindow;
@@ -98,6 +101,11 @@ public:
     // On MacOS, name must be a file with an extension "svg" placed in the
     // "Resources" subdirectory of the application bundle.
     wxNODISCARD static wxBitmapBundle FromSVGResource(const wxString& name, const wxSize& sizeDef);
+
+    // Set or get the maximal total size, in bytes, of the bitmaps rasterized
+    // from SVG images cached by all bundles.
+    static void SetSVGCacheMaxSize(size_t maxSize);
+    static size_t GetSVGCacheMaxSize();
 #endif // wxHAS_SVG
 
     // Create from the resources: all existing versions of the bitmap of the
@@ -147,6 +155,12 @@ public:
     wxNODISCARD wxBitmap GetBitmapFor(const wxWindow* window) const;
     wxNODISCARD wxIcon GetIconFor(const wxWindow* window) const;
 
+    // Create the bitmaps of the preferred size at the given scale for all the
+    // given bundles in the background, so that getting them later, e.g. after
+    // the window using them moves to a display with this scale, is fast.
+    static void PrepareBitmaps(const wxVector<wxBitmapBundle>& bundles,
+                               double scale);
+
     // Access implementation
     wxNODISCARD wxBitmapBundleImpl* GetImpl() const { return m_impl.get(); }
 
@@ -282,6 +296,22 @@ public:
     // Note that this function is non-const because it may generate the bitmap
     // on demand and cache it.
     virtual wxBitmap GetBitmap(const wxSize& size) = 0;
+
+    // Functions used by wxBitmapBundle::PrepareBitmaps().
+    //
+    // CreateImageMaker() is called in the main thread and returns the function
+    // to call in a worker thread to create the image of the given size, or an
+    // empty function if there is nothing to do, e.g. because the bitmap of
+    // this size is already available. This function may only use the data
+    // remaining valid while this object is alive and must not use wxBitmap.
+    //
+    // AddPreparedImage() is called in the main thread with the image created
+    // by this function and should store the bitmap created from it to return
+    // it from GetBitmap() later.
+    //
+    // Default implementation doesn't prepare anything.
+    virtual std::function<wxImage ()> CreateImageMaker(const wxSize& size);
+    virtual void AddPreparedImage(const wxImage& image);
 };
 
 #endif // _WX_BMPBNDL_H_
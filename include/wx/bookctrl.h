@@ -22,6 +22,8 @@
 #include "wx/vector.h"
 #include "wx/withimages.h"
 
+#include <functional>
+
 class WXDLLIMPEXP_FWD_CORE wxImageList;
 class WXDLLIMPEXP_FWD_CORE wxBookCtrlEvent;
 
@@ -190,6 +192,39 @@ public:
                             bool bSelect = false,
                             int imageId = NO_IMAGE) = 0;
 
+    // function creating the page window as child of the given parent, see
+    // AddPageLazy()
+    using PageFactory = std::function<wxWindow* (wxWindow* parent)>;
+
+    // add a page whose window is only created by the given function when the
+    // page is shown for the first time
+    bool AddPageLazy(const PageFactory& factory,
+                     const wxString& text,
+                     bool bSelect = false,
+                     int imageId = NO_IMAGE)
+    {
+        return InsertPageLazy(GetPageCount(), factory, text, bSelect, imageId);
+    }
+
+    // the same as AddPageLazy(), but adds the page at the specified position
+    bool InsertPageLazy(size_t n,
+                        const PageFactory& factory,
+                        const wxString& text,
+                        bool bSelect = false,
+                        int imageId = NO_IMAGE);
+
+    // return true if the page is not lazy or if its window was already created
+    bool IsPageCreated(size_t n) const;
+
+    // create the window of the given lazy page if not done yet and return it
+    // (for the non-lazy pages, this just returns the page itself)
+    wxWindow* CreatePageIfNeeded(size_t n);
+
+    // destroy the windows of all the lazy pages except the current one, they
+    // will be created again when they're shown the next time; returns the
+    // number of destroyed page windows
+    size_t DestroyInactiveLazyPages();
+
     // set the currently selected page, return the index of the previously
     // selected one (or wxNOT_FOUND on error)
     //
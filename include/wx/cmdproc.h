@@ -14,7 +14,11 @@
 #include "wx/object.h"
 #include "wx/list.h"
 
+#include <unordered_map>
+
 class WXDLLIMPEXP_FWD_CORE wxMenu;
+class WXDLLIMPEXP_FWD_BASE wxInputStream;
+class WXDLLIMPEXP_FWD_BASE wxOutputStream;
 
 // ----------------------------------------------------------------------------
 // wxCommand: a single command capable of performing itself
@@ -35,6 +39,20 @@ public:
     virtual bool CanUndo() const { return m_canUndo; }
     virtual wxString GetName() const { return m_commandName; }
 
+    // Override this to return the approximate number of bytes used by the
+    // command for storing its undo/redo data.
+    virtual size_t GetMemoryUsage() const { return 0; }
+
+    // Override this to merge the given command, which had been already done,
+    // into this one and return true if it was merged.
+    virtual bool MergeWith(const wxCommand& WXUNUSED(command)) { return false; }
+
+    // Override these functions to allow wxCommandProcessor to save the undo
+    // data to disk and free the memory used by it and then load it back.
+    virtual bool CanSpill() const { return false; }
+    virtual bool SpillToStream(wxOutputStream& WXUNUSED(stream)) { return false; }
+    virtual bool RestoreFromStream(wxInputStream& WXUNUSED(stream)) { return false; }
+
 protected:
     bool     m_canUndo;
     wxString m_commandName;
@@ -94,6 +112,19 @@ public:
     int GetMaxCommands() const { return m_maxNoCommands; }
     virtual void ClearCommands();
 
+    // Limit the total memory used by the stored commands (0 means no limit).
+    void SetMaxMemoryUsage(size_t maxMemory);
+    size_t GetMaxMemoryUsage() const { return m_maxMemory; }
+
+    // Get the total memory used by the stored commands.
+    size_t GetMemoryUsage() const { return m_memoryUsage; }
+
+    // Save the old commands to disk instead of deleting them when the memory
+    // limit is exceeded, if the commands support this. If the directory is
+    // empty, the default temporary directory is used.
+    void EnableSpilling(bool enable = true, const wxString& dir = wxString());
+    bool IsSpillingEnabled() const { return m_spillingEnabled; }
+
     // Has the current project been changed?
     virtual bool IsDirty() const;
 
@@ -118,6 +149,18 @@ protected:
     virtual bool DoCommand(wxCommand& cmd);
     virtual bool UndoCommand(wxCommand& cmd);
 
+    // Delete the command at the given node, removing it from the list.
+    void DeleteCommand(wxList::compatibility_iterator node);
+
+    // Delete or spill the oldest commands to satisfy the limits.
+    void EnforceLimits();
+
+    // Save the command data to disk, return true if it was done.
+    bool SpillCommand(wxCommand& cmd);
+
+    // Load the command back into memory if it was spilled to disk.
+    bool EnsureCommandLoaded(wxCommand& cmd);
+
     int           m_maxNoCommands;
     wxList        m_commands;
     wxList::compatibility_iterator m_currentCommand,
@@ -130,6 +173,15 @@ protected:
     wxString      m_undoAccelerator;
     wxString      m_redoAccelerator;
 
+    size_t        m_maxMemory = 0;
+    size_t        m_memoryUsage = 0;
+
+    bool          m_spillingEnabled = false;
+    wxString      m_spillDir;
+
+    // Names of the files containing the data of the spilled commands.
+    std::unordered_map<wxCommand*, wxString> m_spilledCommands;
+
 private:
     wxDECLARE_DYNAMIC_CLASS(wxCommandProcessor);
     wxDECLARE_NO_COPY_CLASS(wxCommandProcessor);
@@ -21,6 +21,7 @@
 #include "wx/bitmap.h"
 #include "wx/arrstr.h"
 
+#include <functional>
 #include <memory>
 #include <vector>
 
@@ -331,11 +332,36 @@ public:
         {
         }
 
+    // function returning the HTML, see SetHTMLProvider()
+    using HTMLProvider = std::function<wxString ()>;
+
+    // use the given function to create the HTML only when it's requested for
+    // the first time, e.g. when it's pasted from the clipboard
+    void SetHTMLProvider(const HTMLProvider& provider)
+    {
+        m_html.clear();
+        m_htmlProvider = provider;
+    }
+
     // virtual functions which you may override if you want to provide text on
     // demand only - otherwise, the trivial default versions will be used
-    virtual size_t GetLength() const { return m_html.Len() + 1; }
-    virtual wxString GetHTML() const { return m_html; }
-    virtual void SetHTML(const wxString& html) { m_html = html; }
+    virtual size_t GetLength() const { return GetHTML().Len() + 1; }
+    virtual wxString GetHTML() const
+    {
+        if ( m_htmlProvider )
+        {
+            HTMLProvider provider;
+            provider.swap(m_htmlProvider);
+            m_html = provider();
+        }
+
+        return m_html;
+    }
+    virtual void SetHTML(const wxString& html)
+    {
+        m_htmlProvider = nullptr;
+        m_html = html;
+    }
 
     virtual size_t GetDataSize() const override;
     virtual bool GetDataHere(void *buf) const override;
@@ -356,7 +382,8 @@ public:
     }
 
 private:
-    wxString m_html;
+    mutable wxString m_html;
+    mutable HTMLProvider m_htmlProvider;
 };
 
 class WXDLLIMPEXP_CORE wxTextDataObject : public wxDataObjectSimple
@@ -370,10 +397,37 @@ public:
         {
         }
 
+    // function returning the text, see SetTextProvider()
+    using TextProvider = std::function<wxString ()>;
+
+    // use the given function to create the text only when it's requested for
+    // the first time, e.g. when it's pasted from the clipboard
+    void SetTextProvider(const TextProvider& provider)
+    {
+        m_text.clear();
+        m_textProvider = provider;
+    }
+
     // virtual functions which you may override if you want to provide text on
     // demand only - otherwise, the trivial default versions will be used
-    virtual wxString GetText() const { return m_text; }
-    virtual void SetText(const wxString& text) { m_text = text; }
+    virtual wxString GetText() const
+    {
+        if ( m_textProvider )
+        {
+            // reset the provider before calling it, so that it's only ever
+            // called once, even if it calls GetText() itself
+            TextProvider provider;
+            provider.swap(m_textProvider);
+            m_text = provider();
+        }
+
+        return m_text;
+    }
+    virtual void SetText(const wxString& text)
+    {
+        m_textProvider = nullptr;
+        m_text = text;
+    }
 
     // implement base class pure virtuals
     // ----------------------------------
@@ -423,7 +477,9 @@ private:
     void QtSetDataSingleFormat(const class QMimeData &mimeData, const wxDataFormat &format) override;
 #endif
 
-    wxString m_text;
+    // the text is computed lazily by GetText() if we have the provider
+    mutable wxString m_text;
+    mutable TextProvider m_textProvider;
 
     wxDECLARE_NO_COPY_CLASS(wxTextDataObject);
 };
@@ -505,10 +561,21 @@ public:
     // operator delete[] on m_data
     virtual void Free();
 
+    // function returning the data, see SetDataProvider()
+    using DataProvider = std::function<wxMemoryBuffer ()>;
+
+    // use the given function to create the data only when it's requested for
+    // the first time, e.g. when it's pasted from the clipboard
+    void SetDataProvider(const DataProvider& provider)
+    {
+        Free();
+        m_dataProvider = provider;
+    }
+
     // get data: you may override these functions if you wish to provide data
     // only when it's requested
-    virtual size_t GetSize() const { return m_size; }
-    virtual void *GetData() const { return m_data; }
+    virtual size_t GetSize() const { ProvideData(); return m_size; }
+    virtual void *GetData() const { ProvideData(); return m_data; }
 
     // implement base class pure virtuals
     // ----------------------------------
@@ -530,9 +597,20 @@ public:
     }
 
 private:
+    // call the data provider, if any
+    void ProvideData() const
+    {
+        if ( m_dataProvider )
+            DoProvideData();
+    }
+
+    void DoProvideData() const;
+
     size_t m_size;
     void  *m_data;
 
+    mutable DataProvider m_dataProvider;
+
     wxDECLARE_NO_COPY_CLASS(wxCustomDataObject);
 };
 
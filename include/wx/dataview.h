@@ -185,6 +185,33 @@ private:
 };
 
 
+// ---------------------------------------------------------
+// wxDataViewSortKey: key used for sorting items in the background
+// ---------------------------------------------------------
+
+class WXDLLIMPEXP_CORE wxDataViewSortKey
+{
+public:
+    wxDataViewSortKey() : m_number(0.0), m_isNumber(false) { }
+    explicit wxDataViewSortKey(const wxString& str)
+        : m_string(str), m_number(0.0), m_isNumber(false) { }
+    explicit wxDataViewSortKey(double number)
+        : m_number(number), m_isNumber(true) { }
+
+    bool IsNumber() const { return m_isNumber; }
+    const wxString& GetString() const { return m_string; }
+    double GetNumber() const { return m_number; }
+
+    // Return negative, zero or positive value if this key is less than, equal
+    // to or greater than the other one, numbers are less than all strings.
+    int Compare(const wxDataViewSortKey& other) const;
+
+private:
+    wxString m_string;
+    double   m_number;
+    bool     m_isNumber;
+};
+
 // ---------------------------------------------------------
 // wxDataViewModel
 // ---------------------------------------------------------
@@ -272,6 +299,13 @@ public:
                          unsigned int column, bool ascending ) const;
     virtual bool HasDefaultCompare() const { return false; }
 
+    // get the keys for sorting the given items by the given column at once,
+    // this is used for sorting in the background and must be consistent with
+    // Compare(); return false if not supported for this column
+    virtual bool GetSortKeys(const wxDataViewItemArray& items,
+                             unsigned int column,
+                             wxVector<wxDataViewSortKey>& keys) const;
+
     // internal
     virtual bool IsListModel() const { return false; }
     virtual bool IsVirtualListModel() const { return false; }
@@ -337,6 +371,17 @@ public:
         return true;
     }
 
+    // retrieve the values of the given column for all the rows in the given
+    // range at once, this can be overridden for efficiency by the models
+    // storing their data by column; return false if not supported
+    virtual bool GetValuesForRange(unsigned int WXUNUSED(col),
+                                   unsigned int WXUNUSED(firstRow),
+                                   unsigned int WXUNUSED(count),
+                                   wxVector<wxVariant>& WXUNUSED(values)) const
+    {
+        return false;
+    }
+
 
     // helper methods provided by list models only
     virtual unsigned GetRow( const wxDataViewItem &item ) const = 0;
@@ -459,6 +504,12 @@ public:
 
     unsigned int GetCount() const override { return m_size; }
 
+    // default implementation calls GetValueByRow() for all rows
+    virtual bool GetValuesForRange(unsigned int col,
+                                   unsigned int firstRow,
+                                   unsigned int count,
+                                   wxVector<wxVariant>& values) const override;
+
     // internal
     virtual bool IsVirtualListModel() const override { return true; }
 
@@ -760,6 +811,11 @@ public:
 
     virtual bool SetRowHeight( int WXUNUSED(rowHeight) ) { return false; }
 
+    // Sort the items in a background thread, only supported by the generic
+    // version for list models currently, which returns true to indicate it.
+    virtual bool EnableBackgroundSorting(bool WXUNUSED(enable) = true)
+        { return false; }
+
     virtual void EditItem(const wxDataViewItem& item, const wxDataViewColumn *column) = 0;
 
     // Use EditItem() instead
@@ -1555,6 +1555,84 @@ private:
         m_days;
 };
 
+// ----------------------------------------------------------------------------
+// wxDateTimeFormatter: pre-compiled format for formatting and parsing dates
+//
+// This class is useful when many dates need to be formatted or parsed using
+// the same format, as it parses the format string only once and formats the
+// numeric fields directly instead of using strftime().
+// ----------------------------------------------------------------------------
+
+class WXDLLIMPEXP_BASE wxDateTimeFormatter
+{
+public:
+    wxDateTimeFormatter() = default;
+    explicit wxDateTimeFormatter(const wxString& format) { SetFormat(format); }
+
+    // Change the format used, accepts the same format strings as
+    // wxDateTime::Format() and ParseFormat().
+    void SetFormat(const wxString& format);
+    const wxString& GetFormat() const { return m_format; }
+
+    // Return the date formatted as wxDateTime::Format() would do it.
+    wxString Format(const wxDateTime& dt,
+                    const wxDateTime::TimeZone& tz = wxDateTime::Local) const;
+
+    // Same as Format() but appends the result to the given string, which
+    // allows to reuse its buffer when formatting many dates.
+    void FormatTo(wxString& out,
+                  const wxDateTime& dt,
+                  const wxDateTime::TimeZone& tz = wxDateTime::Local) const;
+
+    // Parse the date in the same way as wxDateTime::ParseFormat() does.
+    bool Parse(const wxString& date,
+               wxDateTime* dt,
+               wxString::const_iterator* end,
+               const wxDateTime& dateDef = wxDefaultDateTime) const;
+
+    // Parse the date which must consist of the formatted date only.
+    bool Parse(const wxString& date,
+               wxDateTime* dt,
+               const wxDateTime& dateDef = wxDefaultDateTime) const
+    {
+        wxString::const_iterator end;
+        return Parse(date, dt, &end, dateDef) && end == date.end();
+    }
+
+private:
+    // An element of the compiled format: either a literal string or a format
+    // specifier.
+    struct Token
+    {
+        // The literal text or the full format specification, e.g. "%04Y".
+        wxString text;
+
+        // The format specifier character or 0 for literals.
+        wxChar spec = 0;
+
+        // The maximal width of the field when parsing.
+        unsigned width = 0;
+
+        // True if the specifier has a width or padding, only used by Format().
+        bool hasModifiers = false;
+    };
+
+    using Tokens = std::vector<Token>;
+
+    // Compile the format into the tokens used by Format() or Parse(), return
+    // false if the format can't be parsed without using ParseFormat().
+    static bool Compile(const wxString& format, Tokens& tokens, bool forParsing);
+
+    wxString m_format;
+
+    Tokens m_formatTokens,
+           m_parseTokens;
+
+    // True if the format contains specifiers not supported by Parse() fast
+    // path, so that it has to fall back to wxDateTime::ParseFormat().
+    bool m_parseFallback = false;
+};
+
 // ----------------------------------------------------------------------------
 // wxDateTimeArray: array of dates.
 // ----------------------------------------------------------------------------
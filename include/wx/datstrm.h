@@ -15,6 +15,8 @@
 #include "wx/longlong.h"
 #include "wx/convauto.h"
 
+#include <vector>
+
 #if wxUSE_STREAMS
 
 // Common wxDataInputStream and wxDataOutputStream parameters.
@@ -105,6 +107,16 @@ public:
     void ReadDouble(double *buffer, size_t size);
     void ReadFloat(float *buffer, size_t size);
 
+    // Read the given number of values of any type supported by the functions
+    // above into the vector, replacing its existing contents.
+    template <typename T>
+    void ReadVector(std::vector<T>& v, size_t size)
+    {
+        v.resize(size);
+        if ( size )
+            DoReadArray(v.data(), size);
+    }
+
     wxDataInputStream& operator>>(wxString& s);
     wxDataInputStream& operator>>(wxInt8& c);
     wxDataInputStream& operator>>(wxInt16& i);
@@ -126,6 +138,24 @@ public:
 protected:
     wxInputStream *m_input;
 
+private:
+    // Overloads used by ReadVector().
+    void DoReadArray(wxUint8 *buffer, size_t size) { Read8(buffer, size); }
+    void DoReadArray(wxInt8 *buffer, size_t size)
+        { Read8(reinterpret_cast<wxUint8 *>(buffer), size); }
+    void DoReadArray(wxUint16 *buffer, size_t size) { Read16(buffer, size); }
+    void DoReadArray(wxInt16 *buffer, size_t size)
+        { Read16(reinterpret_cast<wxUint16 *>(buffer), size); }
+    void DoReadArray(wxUint32 *buffer, size_t size) { Read32(buffer, size); }
+    void DoReadArray(wxInt32 *buffer, size_t size)
+        { Read32(reinterpret_cast<wxUint32 *>(buffer), size); }
+#if wxHAS_INT64
+    void DoReadArray(wxUint64 *buffer, size_t size) { Read64(buffer, size); }
+    void DoReadArray(wxInt64 *buffer, size_t size) { Read64(buffer, size); }
+#endif
+    void DoReadArray(double *buffer, size_t size) { ReadDouble(buffer, size); }
+    void DoReadArray(float *buffer, size_t size) { ReadFloat(buffer, size); }
+
     wxDECLARE_NO_COPY_CLASS(wxDataInputStream);
 };
 
@@ -169,6 +199,15 @@ public:
     void WriteDouble(const double *buffer, size_t size);
     void WriteFloat(const float *buffer, size_t size);
 
+    // Write all elements of the vector, which can be of any type supported by
+    // the functions above. Note that the vector size is not written.
+    template <typename T>
+    void WriteVector(const std::vector<T>& v)
+    {
+        if ( !v.empty() )
+            DoWriteArray(v.data(), v.size());
+    }
+
     wxDataOutputStream& operator<<(const wxString& string);
     wxDataOutputStream& operator<<(wxInt8 c);
     wxDataOutputStream& operator<<(wxInt16 i);
@@ -190,6 +229,24 @@ public:
 protected:
     wxOutputStream *m_output;
 
+private:
+    // Overloads used by WriteVector().
+    void DoWriteArray(const wxUint8 *buffer, size_t size) { Write8(buffer, size); }
+    void DoWriteArray(const wxInt8 *buffer, size_t size)
+        { Write8(reinterpret_cast<const wxUint8 *>(buffer), size); }
+    void DoWriteArray(const wxUint16 *buffer, size_t size) { Write16(buffer, size); }
+    void DoWriteArray(const wxInt16 *buffer, size_t size)
+        { Write16(reinterpret_cast<const wxUint16 *>(buffer), size); }
+    void DoWriteArray(const wxUint32 *buffer, size_t size) { Write32(buffer, size); }
+    void DoWriteArray(const wxInt32 *buffer, size_t size)
+        { Write32(reinterpret_cast<const wxUint32 *>(buffer), size); }
+#if wxHAS_INT64
+    void DoWriteArray(const wxUint64 *buffer, size_t size) { Write64(buffer, size); }
+    void DoWriteArray(const wxInt64 *buffer, size_t size) { Write64(buffer, size); }
+#endif
+    void DoWriteArray(const double *buffer, size_t size) { WriteDouble(buffer, size); }
+    void DoWriteArray(const float *buffer, size_t size) { WriteFloat(buffer, size); }
+
     wxDECLARE_NO_COPY_CLASS(wxDataOutputStream);
 };
 
@@ -28,6 +28,7 @@
 #include "wx/image.h"
 #include "wx/region.h"
 #include "wx/affinematrix2d.h"
+#include "wx/paintprofiler.h"
 
 #define wxUSE_NEW_DC 1
 
@@ -282,6 +283,9 @@ public:
         m_minX = m_maxX = m_minY = m_maxY = 0;
     }
 
+    // Return true if anything was drawn since the last ResetBoundingBox().
+    bool HasBoundingBox() const { return m_isBBoxValid; }
+
     // Get bounding box in logical units.
     wxCoord MinX() const { return m_isBBoxValid ? DeviceToLogical(m_minX, m_minY).x : 0; }
     wxCoord MaxX() const { return m_isBBoxValid ? DeviceToLogical(m_maxX, m_maxY).x : 0; }
@@ -358,6 +362,10 @@ public:
                                         wxCoord *height,
                                         wxCoord *heightLine = nullptr,
                                         const wxFont *font = nullptr) const;
+    virtual void GetTextExtents(const wxArrayString& strings,
+                                wxArrayInt& widths,
+                                wxArrayInt *heights = nullptr,
+                                const wxFont *font = nullptr) const;
     virtual bool DoGetPartialTextExtents(const wxString& text, wxArrayInt& widths) const;
 
     // clearing
@@ -905,13 +913,19 @@ public:
         return wxSize(w, h);
     }
 
+    void GetTextExtents(const wxArrayString& strings,
+                        wxArrayInt& widths,
+                        wxArrayInt *heights = nullptr,
+                        const wxFont *font = nullptr) const
+        { m_pimpl->GetTextExtents(strings, widths, heights, font); }
+
     bool GetPartialTextExtents(const wxString& text, wxArrayInt& widths) const
         { return m_pimpl->DoGetPartialTextExtents(text, widths); }
 
     // clearing
 
     void Clear()
-        { m_pimpl->Clear(); }
+        { CountPrimitive(); m_pimpl->Clear(); }
 
     // clipping
 
@@ -1048,17 +1062,17 @@ public:
 
     bool FloodFill(wxCoord x, wxCoord y, const wxColour& col,
                    wxFloodFillStyle style = wxFLOOD_SURFACE)
-        { return m_pimpl->DoFloodFill(x, y, col, style); }
+        { CountPrimitive(); return m_pimpl->DoFloodFill(x, y, col, style); }
     bool FloodFill(const wxPoint& pt, const wxColour& col,
                    wxFloodFillStyle style = wxFLOOD_SURFACE)
-        { return m_pimpl->DoFloodFill(pt.x, pt.y, col, style); }
+        { CountPrimitive(); return m_pimpl->DoFloodFill(pt.x, pt.y, col, style); }
 
     // fill the area specified by rect with a radial gradient, starting from
     // initialColour in the centre of the cercle and fading to destColour.
     void GradientFillConcentric(const wxRect& rect,
                                 const wxColour& initialColour,
                                 const wxColour& destColour)
-        { m_pimpl->DoGradientFillConcentric( rect, initialColour, destColour,
+        { CountPrimitive(); m_pimpl->DoGradientFillConcentric( rect, initialColour, destColour,
                                              wxPoint(rect.GetWidth() / 2,
                                                      rect.GetHeight() / 2)); }
 
@@ -1066,14 +1080,14 @@ public:
                                 const wxColour& initialColour,
                                 const wxColour& destColour,
                                 const wxPoint& circleCenter)
-        { m_pimpl->DoGradientFillConcentric(rect, initialColour, destColour, circleCenter); }
+        { CountPrimitive(); m_pimpl->DoGradientFillConcentric(rect, initialColour, destColour, circleCenter); }
 
     // fill the area specified by rect with a linear gradient
     void GradientFillLinear(const wxRect& rect,
                             const wxColour& initialColour,
                             const wxColour& destColour,
                             wxDirection nDirection = wxEAST)
-        { m_pimpl->DoGradientFillLinear(rect, initialColour, destColour, nDirection); }
+        { CountPrimitive(); m_pimpl->DoGradientFillLinear(rect, initialColour, destColour, nDirection); }
 
     bool GetPixel(wxCoord x, wxCoord y, wxColour *col) const
         { return m_pimpl->DoGetPixel(x, y, col); }
@@ -1081,108 +1095,108 @@ public:
         { return m_pimpl->DoGetPixel(pt.x, pt.y, col); }
 
     void DrawLine(wxCoord x1, wxCoord y1, wxCoord x2, wxCoord y2)
-        { m_pimpl->DoDrawLine(x1, y1, x2, y2); }
+        { CountPrimitive(); m_pimpl->DoDrawLine(x1, y1, x2, y2); }
     void DrawLine(const wxPoint& pt1, const wxPoint& pt2)
-        { m_pimpl->DoDrawLine(pt1.x, pt1.y, pt2.x, pt2.y); }
+        { CountPrimitive(); m_pimpl->DoDrawLine(pt1.x, pt1.y, pt2.x, pt2.y); }
 
     void CrossHair(wxCoord x, wxCoord y)
-        { m_pimpl->DoCrossHair(x, y); }
+        { CountPrimitive(); m_pimpl->DoCrossHair(x, y); }
     void CrossHair(const wxPoint& pt)
-        { m_pimpl->DoCrossHair(pt.x, pt.y); }
+        { CountPrimitive(); m_pimpl->DoCrossHair(pt.x, pt.y); }
 
     void DrawArc(wxCoord x1, wxCoord y1, wxCoord x2, wxCoord y2,
                  wxCoord xc, wxCoord yc)
-        { m_pimpl->DoDrawArc(x1, y1, x2, y2, xc, yc); }
+        { CountPrimitive(); m_pimpl->DoDrawArc(x1, y1, x2, y2, xc, yc); }
     void DrawArc(const wxPoint& pt1, const wxPoint& pt2, const wxPoint& centre)
-        { m_pimpl->DoDrawArc(pt1.x, pt1.y, pt2.x, pt2.y, centre.x, centre.y); }
+        { CountPrimitive(); m_pimpl->DoDrawArc(pt1.x, pt1.y, pt2.x, pt2.y, centre.x, centre.y); }
 
     void DrawCheckMark(wxCoord x, wxCoord y,
                        wxCoord width, wxCoord height)
-        { m_pimpl->DoDrawCheckMark(x, y, width, height); }
+        { CountPrimitive(); m_pimpl->DoDrawCheckMark(x, y, width, height); }
     void DrawCheckMark(const wxRect& rect)
-        { m_pimpl->DoDrawCheckMark(rect.x, rect.y, rect.width, rect.height); }
+        { CountPrimitive(); m_pimpl->DoDrawCheckMark(rect.x, rect.y, rect.width, rect.height); }
 
     void DrawEllipticArc(wxCoord x, wxCoord y, wxCoord w, wxCoord h,
                          double sa, double ea)
-        { m_pimpl->DoDrawEllipticArc(x, y, w, h, sa, ea); }
+        { CountPrimitive(); m_pimpl->DoDrawEllipticArc(x, y, w, h, sa, ea); }
     void DrawEllipticArc(const wxPoint& pt, const wxSize& sz,
                          double sa, double ea)
-        { m_pimpl->DoDrawEllipticArc(pt.x, pt.y, sz.x, sz.y, sa, ea); }
+        { CountPrimitive(); m_pimpl->DoDrawEllipticArc(pt.x, pt.y, sz.x, sz.y, sa, ea); }
 
     void DrawPoint(wxCoord x, wxCoord y)
-        { m_pimpl->DoDrawPoint(x, y); }
+        { CountPrimitive(); m_pimpl->DoDrawPoint(x, y); }
     void DrawPoint(const wxPoint& pt)
-        { m_pimpl->DoDrawPoint(pt.x, pt.y); }
+        { CountPrimitive(); m_pimpl->DoDrawPoint(pt.x, pt.y); }
 
     void DrawLines(int n, const wxPoint points[],
                    wxCoord xoffset = 0, wxCoord yoffset = 0)
-        { m_pimpl->DoDrawLines(n, points, xoffset, yoffset); }
+        { CountPrimitive(); m_pimpl->DoDrawLines(n, points, xoffset, yoffset); }
     void DrawLines(const wxPointList *list,
                    wxCoord xoffset = 0, wxCoord yoffset = 0)
-        { m_pimpl->DrawLines( list, xoffset, yoffset ); }
+        { CountPrimitive(); m_pimpl->DrawLines( list, xoffset, yoffset ); }
 
     void DrawPolygon(int n, const wxPoint points[],
                      wxCoord xoffset = 0, wxCoord yoffset = 0,
                      wxPolygonFillMode fillStyle = wxODDEVEN_RULE)
-        { m_pimpl->DoDrawPolygon(n, points, xoffset, yoffset, fillStyle); }
+        { CountPrimitive(); m_pimpl->DoDrawPolygon(n, points, xoffset, yoffset, fillStyle); }
     void DrawPolygon(const wxPointList *list,
                      wxCoord xoffset = 0, wxCoord yoffset = 0,
                      wxPolygonFillMode fillStyle = wxODDEVEN_RULE)
-        { m_pimpl->DrawPolygon( list, xoffset, yoffset, fillStyle ); }
+        { CountPrimitive(); m_pimpl->DrawPolygon( list, xoffset, yoffset, fillStyle ); }
     void DrawPolyPolygon(int n, const int count[], const wxPoint points[],
                          wxCoord xoffset = 0, wxCoord yoffset = 0,
                          wxPolygonFillMode fillStyle = wxODDEVEN_RULE)
-        { m_pimpl->DoDrawPolyPolygon(n, count, points, xoffset, yoffset, fillStyle); }
+        { CountPrimitive(); m_pimpl->DoDrawPolyPolygon(n, count, points, xoffset, yoffset, fillStyle); }
 
     void DrawRectangle(wxCoord x, wxCoord y, wxCoord width, wxCoord height)
-        { m_pimpl->DoDrawRectangle(x, y, width, height); }
+        { CountPrimitive(); m_pimpl->DoDrawRectangle(x, y, width, height); }
     void DrawRectangle(const wxPoint& pt, const wxSize& sz)
-        { m_pimpl->DoDrawRectangle(pt.x, pt.y, sz.x, sz.y); }
+        { CountPrimitive(); m_pimpl->DoDrawRectangle(pt.x, pt.y, sz.x, sz.y); }
     void DrawRectangle(const wxRect& rect)
-        { m_pimpl->DoDrawRectangle(rect.x, rect.y, rect.width, rect.height); }
+        { CountPrimitive(); m_pimpl->DoDrawRectangle(rect.x, rect.y, rect.width, rect.height); }
 
     void DrawRoundedRectangle(wxCoord x, wxCoord y, wxCoord width, wxCoord height,
                               double radius)
-        { m_pimpl->DoDrawRoundedRectangle(x, y, width, height, radius); }
+        { CountPrimitive(); m_pimpl->DoDrawRoundedRectangle(x, y, width, height, radius); }
     void DrawRoundedRectangle(const wxPoint& pt, const wxSize& sz,
                              double radius)
-        { m_pimpl->DoDrawRoundedRectangle(pt.x, pt.y, sz.x, sz.y, radius); }
+        { CountPrimitive(); m_pimpl->DoDrawRoundedRectangle(pt.x, pt.y, sz.x, sz.y, radius); }
     void DrawRoundedRectangle(const wxRect& r, double radius)
-        { m_pimpl->DoDrawRoundedRectangle(r.x, r.y, r.width, r.height, radius); }
+        { CountPrimitive(); m_pimpl->DoDrawRoundedRectangle(r.x, r.y, r.width, r.height, radius); }
 
     void DrawCircle(wxCoord x, wxCoord y, wxCoord radius)
-        { m_pimpl->DoDrawEllipse(x - radius, y - radius, 2*radius, 2*radius); }
+        { CountPrimitive(); m_pimpl->DoDrawEllipse(x - radius, y - radius, 2*radius, 2*radius); }
     void DrawCircle(const wxPoint& pt, wxCoord radius)
-        { m_pimpl->DoDrawEllipse(pt.x - radius, pt.y - radius, 2*radius, 2*radius); }
+        { CountPrimitive(); m_pimpl->DoDrawEllipse(pt.x - radius, pt.y - radius, 2*radius, 2*radius); }
 
     void DrawEllipse(wxCoord x, wxCoord y, wxCoord width, wxCoord height)
-        { m_pimpl->DoDrawEllipse(x, y, width, height); }
+        { CountPrimitive(); m_pimpl->DoDrawEllipse(x, y, width, height); }
     void DrawEllipse(const wxPoint& pt, const wxSize& sz)
-        { m_pimpl->DoDrawEllipse(pt.x, pt.y, sz.x, sz.y); }
+        { CountPrimitive(); m_pimpl->DoDrawEllipse(pt.x, pt.y, sz.x, sz.y); }
     void DrawEllipse(const wxRect& rect)
-        { m_pimpl->DoDrawEllipse(rect.x, rect.y, rect.width, rect.height); }
+        { CountPrimitive(); m_pimpl->DoDrawEllipse(rect.x, rect.y, rect.width, rect.height); }
 
     void DrawIcon(const wxIcon& icon, wxCoord x, wxCoord y)
-        { m_pimpl->DoDrawIcon(icon, x, y); }
+        { CountPrimitive(); m_pimpl->DoDrawIcon(icon, x, y); }
     void DrawIcon(const wxIcon& icon, const wxPoint& pt)
-        { m_pimpl->DoDrawIcon(icon, pt.x, pt.y); }
+        { CountPrimitive(); m_pimpl->DoDrawIcon(icon, pt.x, pt.y); }
 
     void DrawBitmap(const wxBitmap &bmp, wxCoord x, wxCoord y,
                     bool useMask = false)
-        { m_pimpl->DoDrawBitmap(bmp, x, y, useMask); }
+        { CountPrimitive(); m_pimpl->DoDrawBitmap(bmp, x, y, useMask); }
     void DrawBitmap(const wxBitmap &bmp, const wxPoint& pt,
                     bool useMask = false)
-        { m_pimpl->DoDrawBitmap(bmp, pt.x, pt.y, useMask); }
+        { CountPrimitive(); m_pimpl->DoDrawBitmap(bmp, pt.x, pt.y, useMask); }
 
     void DrawText(const wxString& text, wxCoord x, wxCoord y)
-        { m_pimpl->DoDrawText(text, x, y); }
+        { CountPrimitive(); m_pimpl->DoDrawText(text, x, y); }
     void DrawText(const wxString& text, const wxPoint& pt)
-        { m_pimpl->DoDrawText(text, pt.x, pt.y); }
+        { CountPrimitive(); m_pimpl->DoDrawText(text, pt.x, pt.y); }
 
     void DrawRotatedText(const wxString& text, wxCoord x, wxCoord y, double angle)
-        { m_pimpl->DoDrawRotatedText(text, x, y, angle); }
+        { CountPrimitive(); m_pimpl->DoDrawRotatedText(text, x, y, angle); }
     void DrawRotatedText(const wxString& text, const wxPoint& pt, double angle)
-        { m_pimpl->DoDrawRotatedText(text, pt.x, pt.y, angle); }
+        { CountPrimitive(); m_pimpl->DoDrawRotatedText(text, pt.x, pt.y, angle); }
 
     // this version puts both optional bitmap and the text into the given
     // rectangle and aligns is as specified by alignment parameter; it also
@@ -1205,6 +1219,7 @@ public:
               wxRasterOperationMode rop = wxCOPY, bool useMask = false,
               wxCoord xsrcMask = wxDefaultCoord, wxCoord ysrcMask = wxDefaultCoord)
     {
+        CountPrimitive();
         return m_pimpl->DoBlit(xdest, ydest, width, height,
                       source, xsrc, ysrc, rop, useMask, xsrcMask, ysrcMask);
     }
@@ -1213,6 +1228,7 @@ public:
               wxRasterOperationMode rop = wxCOPY, bool useMask = false,
               const wxPoint& srcPtMask = wxDefaultPosition)
     {
+        CountPrimitive();
         return m_pimpl->DoBlit(destPt.x, destPt.y, sz.x, sz.y,
                       source, srcPt.x, srcPt.y, rop, useMask, srcPtMask.x, srcPtMask.y);
     }
@@ -1225,6 +1241,7 @@ public:
                      wxRasterOperationMode rop = wxCOPY, bool useMask = false,
                      wxCoord srcMaskX = wxDefaultCoord, wxCoord srcMaskY = wxDefaultCoord)
     {
+        CountPrimitive();
         return m_pimpl->DoStretchBlit(dstX, dstY, dstWidth, dstHeight,
                       source, srcX, srcY, srcWidth, srcHeight, rop, useMask, srcMaskX, srcMaskY);
     }
@@ -1233,6 +1250,7 @@ public:
                      wxRasterOperationMode rop = wxCOPY, bool useMask = false,
                      const wxPoint& srcMaskPt = wxDefaultPosition)
     {
+        CountPrimitive();
         return m_pimpl->DoStretchBlit(dstPt.x, dstPt.y, dstSize.x, dstSize.y,
                       source, srcPt.x, srcPt.y, srcSize.x, srcSize.y, rop, useMask, srcMaskPt.x, srcMaskPt.y);
     }
@@ -1246,11 +1264,11 @@ public:
     void DrawSpline(wxCoord x1, wxCoord y1,
                     wxCoord x2, wxCoord y2,
                     wxCoord x3, wxCoord y3)
-        { m_pimpl->DrawSpline(x1,y1,x2,y2,x3,y3); }
+        { CountPrimitive(); m_pimpl->DrawSpline(x1,y1,x2,y2,x3,y3); }
     void DrawSpline(int n, const wxPoint points[])
-        { m_pimpl->DrawSpline(n,points); }
+        { CountPrimitive(); m_pimpl->DrawSpline(n,points); }
     void DrawSpline(const wxPointList *points)
-        { m_pimpl->DrawSpline(points); }
+        { CountPrimitive(); m_pimpl->DrawSpline(points); }
 #endif // wxUSE_SPLINES
 
 
@@ -1322,6 +1340,9 @@ protected:
         { return m_pimpl->SetWindow(w); }
 
 private:
+    // Called by all drawing functions to let wxPaintProfiler count them.
+    static void CountPrimitive() { wxPaintProfiler::OnPrimitive(); }
+
     wxDECLARE_ABSTRACT_CLASS(wxDC);
     wxDECLARE_NO_COPY_CLASS(wxDC);
 };
@@ -102,6 +102,11 @@ public:
     void SetStyle(int style) { m_style = style; }
     int GetStyle() const { return m_style & ~wxBUFFER_USES_SHARED_BUFFER; }
 
+    // Set and get the maximal total size, in bytes, of the shared buffers,
+    // used when no buffer is explicitly specified, which are kept for reuse.
+    static void SetSharedBuffersMaxMemory(size_t maxMemory);
+    static size_t GetSharedBuffersMaxMemory();
+
 private:
     // common part of Init()s
     void InitCommon(wxDC *dc, int style)
@@ -17,6 +17,8 @@
 #include "wx/dc.h"
 
 #include <memory>
+#include <string>
+#include <unordered_map>
 
 #define wxSVGVersion wxT("v0101")
 
@@ -30,7 +32,7 @@ enum wxSVGShapeRenderingMode
     wxSVG_SHAPE_RENDERING_OPTIMISE_SPEED = wxSVG_SHAPE_RENDERING_OPTIMIZE_SPEED
 };
 
-class WXDLLIMPEXP_FWD_BASE wxFileOutputStream;
+class WXDLLIMPEXP_FWD_BASE wxOutputStream;
 
 class WXDLLIMPEXP_FWD_CORE wxSVGFileDC;
 
@@ -89,6 +91,10 @@ public:
                     int width = 320, int height = 240, double dpi = 72.0,
                     const wxString& title = wxString());
 
+    wxSVGFileDCImpl(wxSVGFileDC* owner, wxOutputStream& stream,
+                    int width = 320, int height = 240, double dpi = 72.0,
+                    const wxString& title = wxString());
+
     virtual ~wxSVGFileDCImpl();
 
     bool IsOk() const override { return m_OK; }
@@ -252,11 +258,21 @@ private:
 
     virtual wxSize ToDIP(const wxSize& sz) const override;
 
-    void Init(const wxString& filename, int width, int height,
-              double dpi, const wxString& title);
+    void Init(const wxString& filename, wxOutputStream* stream,
+              int width, int height, double dpi, const wxString& title);
 
     void write(const wxString& s);
 
+    // Append UTF-8 text to the output buffer, flushing it if it's full.
+    void WriteRaw(const char* s, size_t len);
+    void WriteRaw(const std::string& s) { WriteRaw(s.data(), s.length()); }
+
+    // Append the coordinates separated by a space to the output buffer.
+    void WritePoint(wxCoord x, wxCoord y);
+
+    // Write out the buffered output to the stream.
+    void FlushBuffer();
+
 private:
     // If m_graphics_changed is true, close the current <g> element and start a
     // new one for the last pen/brush change.
@@ -266,12 +282,17 @@ private:
     // their current values in wxDC.
     void DoStartNewGraphics();
 
+    // Terminate the path element used for the segments drawn by DrawLine(),
+    // if any. This must be done before writing anything else.
+    void CloseLinePath();
+
     wxString            m_filename;
     bool                m_OK;
     bool                m_graphics_changed;  // set by Set{Brush,Pen}()
     int                 m_width, m_height;
     double              m_dpi;
-    std::unique_ptr<wxFileOutputStream> m_outfile;
+    wxOutputStream*     m_outfile;           // either m_ownedStream or not owned
+    std::unique_ptr<wxOutputStream> m_ownedStream;
     std::unique_ptr<wxSVGBitmapHandler> m_bmp_handler; // class to handle bitmaps
     wxSVGShapeRenderingMode m_renderingMode;
 
@@ -286,6 +307,19 @@ private:
     // Unique ID for every gradient.
     size_t m_gradientUniqueId;
 
+    // The output is accumulated here before being written to the stream.
+    std::string m_buffer;
+
+    // The consecutive DrawLine() calls with the same graphics attributes are
+    // combined into a single path element and this string contains the end
+    // of this element if it is currently open, or is empty otherwise.
+    std::string m_linePathEnd;
+    size_t m_linePathSegments;
+
+    // The CSS classes already defined for the graphics group styles, the
+    // values are the class numbers.
+    std::unordered_map<wxString, size_t> m_styleClasses;
+
     wxDECLARE_ABSTRACT_CLASS(wxSVGFileDCImpl);
     wxDECLARE_NO_COPY_CLASS(wxSVGFileDCImpl);
 };
@@ -303,6 +337,17 @@ public:
     {
     }
 
+    // Write the SVG to the given stream, which must remain valid during the
+    // lifetime of this object.
+    wxSVGFileDC(wxOutputStream& stream,
+                int width = 320,
+                int height = 240,
+                double dpi = 72.0,
+                const wxString& title = wxString())
+        : wxDC(new wxSVGFileDCImpl(this, stream, width, height, dpi, title))
+    {
+    }
+
     // wxSVGFileDC-specific methods:
 
     // Use a custom bitmap handler: takes ownership of the handler.
@@ -14,7 +14,10 @@
 #include "wx/string.h"
 #include "wx/filefn.h"      // for wxS_DIR_DEFAULT
 
+#include <functional>
+
 class WXDLLIMPEXP_FWD_BASE wxArrayString;
+class WXDLLIMPEXP_FWD_BASE wxFileStat;
 
 // ----------------------------------------------------------------------------
 // constants
@@ -132,6 +135,14 @@ public:
     // get next file in the enumeration started with GetFirst()
     bool GetNext(wxString *filename) const;
 
+    // same as GetFirst() and GetNext() but also return the information about
+    // the found object, which may be more efficient than getting it later
+    bool GetFirst(wxString *filename,
+                  wxFileStat *stat,
+                  const wxString& filespec = wxEmptyString,
+                  int flags = wxDIR_DEFAULT) const;
+    bool GetNext(wxString *filename, wxFileStat *stat) const;
+
     // return true if this directory has any files in it
     bool HasFiles(const wxString& spec = wxEmptyString) const;
 
@@ -152,6 +163,18 @@ public:
                               const wxString& filespec = wxEmptyString,
                               int flags = wxDIR_DEFAULT);
 
+    // find all files under the given directory, like GetAllFiles(), but
+    // using multiple threads and passing them to the provided function, in
+    // the calling thread, in batches of roughly the given size; the function
+    // can return false to stop the traversal
+    //
+    // return the number of files passed to the function
+    static size_t TraverseParallel(const wxString& dirname,
+                                   const std::function<bool (const wxArrayString& files)>& onFiles,
+                                   const wxString& filespec = wxEmptyString,
+                                   int flags = wxDIR_DEFAULT,
+                                   size_t batchSize = 1024);
+
     // check if there any files matching the given filespec under the given
     // directory (i.e. searches recursively), return the file path if found or
     // empty string otherwise
@@ -24,6 +24,7 @@
 #endif
 
 #include <list>
+#include <memory>
 
 class WXDLLIMPEXP_FWD_CORE wxWindow;
 class WXDLLIMPEXP_FWD_CORE wxDocument;
@@ -35,6 +36,7 @@ class WXDLLIMPEXP_FWD_CORE wxCommandProcessor;
 class WXDLLIMPEXP_FWD_BASE wxConfigBase;
 
 class wxDocChildFrameAnyBase;
+class wxDocumentAsyncIO;
 
 #if wxUSE_STD_IOSTREAM
   #include "wx/iosfwrap.h"
@@ -46,9 +48,14 @@ class wxDocChildFrameAnyBase;
 enum
 {
     wxDOC_NEW    = 1,
-    wxDOC_SILENT = 2
+    wxDOC_SILENT = 2,
+    wxDOC_ASYNC  = 4
 };
 
+// Events sent to wxDocument during asynchronous I/O.
+wxDECLARE_EXPORTED_EVENT( WXDLLIMPEXP_CORE, wxEVT_DOCUMENT_IO_PROGRESS, wxThreadEvent );
+wxDECLARE_EXPORTED_EVENT( WXDLLIMPEXP_CORE, wxEVT_DOCUMENT_IO_COMPLETED, wxThreadEvent );
+
 // Document template flags
 enum
 {
@@ -111,6 +118,25 @@ public:
     virtual bool OnNewDocument();
     virtual bool OnCloseDocument();
 
+    // Call DoOpenDocument() or DoSaveDocument() in a worker thread and send
+    // wxEVT_DOCUMENT_IO_COMPLETED to this document when it is done.
+    bool OpenDocumentAsync(const wxString& filename);
+    bool SaveDocumentAsync(const wxString& filename);
+
+    bool IsDocumentIOInProgress() const { return m_asyncIO != nullptr; }
+
+    // Request cancelling the asynchronous operation in progress, if any.
+    void CancelDocumentIO();
+
+    // Block until the worker thread finishes the operation in progress.
+    void WaitForDocumentIO();
+
+    // These functions may be called from DoOpenDocument() and
+    // DoSaveDocument() to report the progress (in percents) of an
+    // asynchronous operation and check if it should be cancelled.
+    void ReportDocumentIOProgress(int percent);
+    bool IsDocumentIOCancelled() const;
+
     // Prompts for saving if about to close a modified document. Returns true
     // if ok to close the document (may have saved in the meantime, or set
     // modified to false)
@@ -216,9 +242,19 @@ protected:
     wxString DoGetUserReadableName() const;
 
 private:
+    // Update the document state after successfully opening or saving it.
+    void FinishOpening(const wxString& file);
+    void FinishSaving(const wxString& file);
+
+    // Common part of OpenDocumentAsync() and SaveDocumentAsync().
+    bool StartDocumentIO(const wxString& file, bool save);
+
     // list of all documents whose m_documentParent is this one
     std::list<wxDocument*> m_childDocuments;
 
+    // Non-null only while an asynchronous operation is in progress.
+    std::shared_ptr<wxDocumentAsyncIO> m_asyncIO;
+
     wxDECLARE_ABSTRACT_CLASS(wxDocument);
     wxDECLARE_NO_COPY_CLASS(wxDocument);
 };
@@ -556,6 +592,11 @@ protected:
     wxPageSetupDialogData m_pageSetupDialogData;
 #endif // wxUSE_PRINTING_ARCHITECTURE
 
+private:
+    // Handler of wxEVT_DOCUMENT_IO_COMPLETED for the documents opened with
+    // wxDOC_ASYNC flag.
+    void OnAsyncOpenCompleted(wxThreadEvent& event);
+
     wxDECLARE_EVENT_TABLE();
     wxDECLARE_DYNAMIC_CLASS(wxDocManager);
     wxDECLARE_NO_COPY_CLASS(wxDocManager);
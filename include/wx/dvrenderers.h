@@ -179,6 +179,14 @@ public:
                         const wxDataViewItem& item,
                         unsigned column);
 
+    // Same as above but use the given value of this cell, which must have been
+    // already retrieved from the model, e.g. using GetValuesForRange(), instead
+    // of calling wxDataViewModel::GetValue().
+    bool PrepareForItem(const wxDataViewModel *model,
+                        const wxDataViewItem& item,
+                        unsigned column,
+                        const wxVariant& value);
+
     // renderer properties:
     virtual void SetMode( wxDataViewCellMode mode ) = 0;
     virtual wxDataViewCellMode GetMode() const = 0;
@@ -256,6 +264,16 @@ protected:
                               const wxDataViewItem& item,
                               unsigned column) const;
 
+    // Make the value null if its type doesn't match our GetVariantType().
+    void CheckValueType(wxVariant& value, unsigned column) const;
+
+    // Common part of both PrepareForItem() overloads: the value is retrieved
+    // from the model if the provided pointer is null.
+    bool DoPrepareForItem(const wxDataViewModel *model,
+                          const wxDataViewItem& item,
+                          unsigned column,
+                          const wxVariant* valueFromModel);
+
     // Validates the given value (if it is non-null) and sends (in any case)
     // ITEM_EDITING_DONE event and, finally, updates the model with the value
     // (f it is valid, of course) if the event wasn't vetoed.
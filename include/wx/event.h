@@ -32,6 +32,8 @@
 #include "wx/meta/convertible.h"
 #include "wx/meta/removeref.h"
 
+#include <atomic>
+
 // This is now always defined, but keep it for backwards compatibility.
 #define wxHAS_CALL_AFTER
 
@@ -958,6 +960,16 @@ enum wxEventCategory
  *
  */
 
+// Statistics about event objects allocations, see wxEvent::GetAllocStats().
+struct wxEventAllocStats
+{
+    // Total number of event objects allocated on the heap so far.
+    wxUint64 allocated = 0;
+
+    // Number of the above that reused memory of previously deleted events.
+    wxUint64 reused = 0;
+};
+
 class WXDLLIMPEXP_BASE wxEvent : public wxObject
 {
 public:
@@ -1075,6 +1087,23 @@ public:
         m_handlerToProcessOnlyIn = nullptr;
     }
 
+    // Events are often allocated and deleted in quick succession, e.g. when
+    // they're queued, so the memory of the small deleted events can be kept
+    // in a per-thread cache and reused for the new ones if this is enabled.
+    static void UseAllocCache(bool use = true);
+
+    // Return the statistics about the event objects allocated so far.
+    static wxEventAllocStats GetAllocStats();
+
+    // Allocation functions used for all events, implementing the cache above.
+    static void* operator new(size_t size);
+    static void operator delete(void* p, size_t size);
+
+    // As defining operator new hides all the other overloads, also define
+    // placement new to allow constructing events in an existing buffer.
+    static void* operator new(size_t WXUNUSED(size), void* p) { return p; }
+    static void operator delete(void* WXUNUSED(p), void* WXUNUSED(place)) { }
+
 protected:
     wxObject*         m_eventObject;
     wxEventType       m_eventType;
@@ -1123,6 +1152,22 @@ private:
     // and this one needs to access our m_handlerToProcessOnlyIn
     friend class WXDLLIMPEXP_FWD_BASE wxEventProcessInHandlerOnly;
 
+    // and this one uses m_nextPending for linking the pending events
+    friend class WXDLLIMPEXP_FWD_BASE wxEvtHandler;
+
+    // The next event in the list of pending events of wxEvtHandler that this
+    // event was queued for, if any.
+    wxEvent*          m_nextPending;
+
+    // The key passed to wxEvtHandler::QueueEventCoalesced(), only valid if
+    // m_isCoalesced is true.
+    wxUIntPtr         m_coalesceKey;
+    bool              m_isCoalesced;
+
+    // The time when this event was queued as returned by
+    // wxEventProfiler::GetTime() if it was running at the time or -1.
+    wxLongLong_t      m_queueTime;
+
 
     wxDECLARE_ABSTRACT_CLASS(wxEvent);
 };
@@ -1308,7 +1353,12 @@ enum wxIdleMode
 
         // Send idle events to windows that have
         // the wxWS_EX_PROCESS_IDLE flag specified
-    wxIDLE_PROCESS_SPECIFIED
+    wxIDLE_PROCESS_SPECIFIED,
+
+        // Send idle events to windows that have
+        // the wxWS_EX_PROCESS_IDLE flag specified or
+        // a wxEVT_IDLE handler
+    wxIDLE_PROCESS_REGISTERED
 };
 
 class WXDLLIMPEXP_BASE wxIdleEvent : public wxEvent
@@ -2916,7 +2966,36 @@ enum wxUpdateUIMode
 
         // Send UI update events to windows that have
         // the wxWS_EX_PROCESS_UI_UPDATES flag specified
-    wxUPDATE_UI_PROCESS_SPECIFIED
+    wxUPDATE_UI_PROCESS_SPECIFIED,
+
+        // Send UI update events to windows that have
+        // the wxWS_EX_PROCESS_UI_UPDATES flag specified or
+        // a wxEVT_UPDATE_UI handler, or whose parent has
+        // either of them
+    wxUPDATE_UI_PROCESS_REGISTERED
+};
+
+// A piece of application state which wxEVT_UPDATE_UI handlers can declare
+// that they depend on using wxUpdateUIEvent::DependsOn(): if all handlers for
+// the given UI element do it, the events for it are not sent again until
+// MarkChanged() is called for one of these objects.
+class WXDLLIMPEXP_CORE wxUpdateUIDependency
+{
+public:
+    wxUpdateUIDependency();
+    ~wxUpdateUIDependency();
+
+    // Must be called whenever the state represented by this object changes.
+    void MarkChanged();
+
+    // Implementation only.
+    class State;
+    State* WXGetState() const { return m_state; }
+
+private:
+    State* const m_state;
+
+    wxDECLARE_NO_COPY_CLASS(wxUpdateUIDependency);
 };
 
 class WXDLLIMPEXP_CORE wxUpdateUIEvent : public wxCommandEvent
@@ -2944,7 +3023,8 @@ public:
           m_setText(event.m_setText),
           m_setChecked(event.m_setChecked),
           m_isCheckable(event.m_isCheckable),
-          m_text(event.m_text)
+          m_text(event.m_text),
+          m_dependencies(event.m_dependencies)
     { }
 
     bool GetChecked() const { return m_checked; }
@@ -2965,6 +3045,11 @@ public:
     bool IsCheckable() const { return m_isCheckable; }
     void DisallowCheck() { m_isCheckable = false; }
 
+    // Declare that the result of the handler depends only on the given state,
+    // see wxUpdateUIDependency.
+    void DependsOn(const wxUpdateUIDependency& dep)
+        { m_dependencies.push_back(&dep); }
+
     // Sets the interval between updates in milliseconds.
     // Set to -1 to disable updates, or to 0 to update as frequently as possible.
     static void SetUpdateInterval(long updateInterval) { sm_updateInterval = updateInterval; }
@@ -2987,6 +3072,16 @@ public:
     // Returns the UI update mode
     static wxUpdateUIMode GetMode() { return sm_updateMode; }
 
+    // Implementation only: used by the code sending the events for the given
+    // UI element (window, tool, menu item, ...) to check whether it needs to
+    // do it at all, i.e. if there were any changes to the dependencies
+    // remembered by the last call to RememberDependencies() for the same
+    // element, which must be called after processing the event. Finally,
+    // ForgetElement() must be called when the element is destroyed.
+    static bool IsUpToDate(const void* element);
+    void RememberDependencies(const void* element) const;
+    static void ForgetElement(const void* element);
+
     virtual wxEvent *Clone() const override { return new wxUpdateUIEvent(*this); }
 
 protected:
@@ -2999,6 +3094,7 @@ protected:
     bool          m_setChecked;
     bool          m_isCheckable;
     wxString      m_text;
+    wxVector<const wxUpdateUIDependency*> m_dependencies;
 #if wxUSE_LONGLONG
     static wxLongLong       sm_lastUpdate;
 #endif
@@ -3675,6 +3771,11 @@ public:
     // buffer as other wxString objects in this thread.
     virtual void QueueEvent(wxEvent *event);
 
+    // Same as QueueEvent() but if an event previously queued by this function
+    // with the same key hasn't been processed yet, it is replaced with the new
+    // one instead of queuing both of them.
+    void QueueEventCoalesced(wxEvent *event, wxUIntPtr key);
+
     // Add an event to be processed later: notice that this function is not
     // safe to call from threads other than main, use QueueEvent()
     virtual void AddPendingEvent(const wxEvent& event)
@@ -3754,6 +3855,14 @@ public:
         QueueEvent(new wxAsyncMethodCallEventFunctor<T>(this, fn));
     }
 
+    // Same as CallAfter() but uses QueueEventCoalesced() with the given key,
+    // so that only the last functor scheduled with this key is called.
+    template <typename T>
+    void CallAfterCoalesced(wxUIntPtr key, const T& fn)
+    {
+        QueueEventCoalesced(new wxAsyncMethodCallEventFunctor<T>(this, fn), key);
+    }
+
 
     // Connecting and disconnecting
     // ----------------------------
@@ -4006,10 +4115,35 @@ protected:
     typedef wxVector<wxDynamicEventTableEntry*> DynamicEvents;
     DynamicEvents* m_dynamicEvents;
 
-    wxList*             m_pendingEvents;
+    // Index of m_dynamicEvents by event type, only created when there are
+    // many dynamic event handlers to avoid checking all of them for every
+    // event, see DoBind().
+    struct DynamicEventsIndex;
+    DynamicEventsIndex* m_dynamicEventsIndex;
+
+    // Helpers of SearchDynamicEventTable(): search for the handler of the
+    // event among the given entries and remove the entry from the index.
+    bool SearchDynamicEntries(DynamicEvents& entries, wxEvent& event);
+    void RemoveFromDynamicEventsIndex(wxDynamicEventTableEntry* entry);
+
+    // Events queued by QueueEvent() but not moved to the pending events list
+    // below yet: this is a lock-free stack, i.e. the events are in LIFO order,
+    // linked using wxEvent::m_nextPending, to which any thread can add events
+    // without blocking.
+    std::atomic<wxEvent*> m_queuedEvents;
+
+    // True if this handler is in the list of handlers with pending events of
+    // wxTheApp or is about to be added to it, this allows to avoid locking the
+    // list when queuing events for a handler which is already in it.
+    std::atomic<bool>   m_hasPendingEvents;
+
+    // The pending events in FIFO order, linked using wxEvent::m_nextPending,
+    // only accessed by the thread processing them.
+    wxEvent*            m_pendingEventsFirst;
+    wxEvent*            m_pendingEventsLast;
 
 #if wxUSE_THREADS
-    // critical section protecting m_pendingEvents
+    // critical section protecting the pending events list
     wxCriticalSection m_pendingEventsLock;
 #endif // wxUSE_THREADS
 
@@ -4048,6 +4182,14 @@ private:
     // try to process events in all handlers chained to this one
     bool DoTryChain(wxEvent& event);
 
+    // move the events from m_queuedEvents to the end of the pending events
+    // list, must be called with m_pendingEventsLock locked
+    void MoveQueuedEventsToPending();
+
+    // remove this handler from the list of handlers with pending events once
+    // it doesn't have any more of them, must be called with the lock held too
+    void RemoveFromPendingEventHandlers();
+
     // Head of the event filter linked list.
     static wxEventFilter* ms_filterList;
 
@@ -0,0 +1,132 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        wx/evtprofiler.h
+// Purpose:     wxEventProfiler: measure the time spent dispatching events
+// Author:      wxWidgets team
+// Created:     2026-10-15
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef _WX_EVTPROFILER_H_
+#define _WX_EVTPROFILER_H_
+
+#include "wx/event.h"
+
+#include <atomic>
+#include <vector>
+
+// ----------------------------------------------------------------------------
+// wxEventProfiler: collects event dispatch timings in the main thread
+// ----------------------------------------------------------------------------
+
+// All the times used by this class are in microseconds and the start times
+// are counted from the first call to Start(). Only the events dispatched in
+// the main thread are profiled and all the functions of this class must be
+// called from the main thread too.
+class WXDLLIMPEXP_BASE wxEventProfiler
+{
+public:
+    // Timings of either all events of the given type, when handlerClass is
+    // empty, or of all the calls to the handlers of the given class for them.
+    struct Stats
+    {
+        wxEventType eventType = wxEVT_NULL;
+        wxString eventClass;
+        wxString handlerClass;
+
+        unsigned long count = 0;
+        wxLongLong_t totalTime = 0;
+        wxLongLong_t maxTime = 0;
+
+        wxLongLong_t GetAverageTime() const
+            { return count ? totalTime / count : 0; }
+    };
+
+    // Information about a single event handler taking longer than the stall
+    // threshold.
+    struct Stall
+    {
+        wxEventType eventType = wxEVT_NULL;
+        wxString eventClass;
+        wxString handlerClass;
+
+        wxLongLong_t startTime = 0;
+        wxLongLong_t duration = 0;
+
+        // Stack trace of the handler call, empty if wxUSE_STACKWALKER is 0.
+        wxString backtrace;
+    };
+
+    // Start or stop collecting the data. Starting the profiler discards any
+    // previously collected data.
+    static void Start();
+    static void Stop();
+
+    static bool IsRunning() { return ms_running.load(std::memory_order_relaxed); }
+
+    // Discard all the collected data without stopping the profiler.
+    static void Reset();
+
+    // Handlers taking longer than this are recorded as stalls. The default
+    // threshold is 100ms, 0 disables stall detection.
+    static void SetStallThreshold(long ms);
+    static long GetStallThreshold();
+
+    // Set the maximal number of entries recorded for the trace returned by
+    // GetChromeTrace(), 0 disables recording it. The statistics are collected
+    // even when this limit is reached. The default is 1000000.
+    static void SetMaxTraceEvents(size_t count);
+
+    // Total dispatch time for each event type, including all the handlers
+    // called for it and any nested events processed by them.
+    static std::vector<Stats> GetDispatchStats();
+
+    // Time spent in the handlers for each event type and handler class.
+    static std::vector<Stats> GetHandlerStats();
+
+    // Time spent by the events in the queue before being dispatched.
+    static std::vector<Stats> GetQueueWaitStats();
+
+    // Time spent in idle processing, i.e. wxApp::ProcessIdle().
+    static Stats GetIdleStats();
+
+    static std::vector<Stall> GetStalls();
+
+    // Return the collected trace in the Chrome trace event format, which can
+    // be loaded in chrome://tracing or https://ui.perfetto.dev.
+    static wxString GetChromeTrace();
+
+    // Save the result of GetChromeTrace() to the given file.
+    static bool SaveChromeTrace(const wxString& filename);
+
+
+    // Implementation only from now on.
+
+    // Return the current time if the profiler is running and we're called
+    // from the main thread or -1 otherwise.
+    static wxLongLong_t StartTiming()
+        { return IsRunning() ? DoStartTiming() : -1; }
+
+    // Return the current time, whether the profiler is running or not.
+    static wxLongLong_t GetTime();
+
+    // These functions must be called with the value returned by StartTiming()
+    // if it was not -1.
+    static void OnDispatchEnd(const wxEvent& event, wxLongLong_t start);
+    static void OnHandlerEnd(const wxEvent& event,
+                             const wxChar* handlerClass,
+                             wxLongLong_t start);
+    static void OnIdleEnd(wxLongLong_t start);
+
+    // Called when dispatching a queued event with the time it was queued at.
+    static void OnQueueWaitEnd(const wxEvent& event, wxLongLong_t queued);
+
+private:
+    static wxLongLong_t DoStartTiming();
+
+    static std::atomic<bool> ms_running;
+
+    wxEventProfiler() = delete;
+};
+
+#endif // _WX_EVTPROFILER_H_
@@ -20,6 +20,8 @@
 #include "wx/confbase.h"
 #include "wx/filename.h"
 
+#include <memory>
+
 // ----------------------------------------------------------------------------
 // wxFileConfig
 // ----------------------------------------------------------------------------
@@ -91,6 +93,7 @@
 class WXDLLIMPEXP_FWD_BASE wxFileConfigGroup;
 class WXDLLIMPEXP_FWD_BASE wxFileConfigEntry;
 class WXDLLIMPEXP_FWD_BASE wxFileConfigLineList;
+class wxFileConfigWriter;
 
 #if wxUSE_STREAMS
 class WXDLLIMPEXP_FWD_BASE wxInputStream;
@@ -202,6 +205,18 @@ public:
   void EnableAutoSave() { m_autosave = true; }
   void DisableAutoSave() { m_autosave = false; }
 
+#if wxUSE_THREADS
+  // in write-behind mode Flush() only takes a snapshot of the file contents
+  // and the file is written by a background thread, with the subsequent
+  // flushes coalesced if the previous write is still pending
+  void EnableWriteBehind(bool enable = true);
+  bool IsWriteBehindEnabled() const { return m_writer != nullptr; }
+
+  // wait until all the pending writes are done, returns false if any of
+  // them failed since the last call to this function
+  bool Sync();
+#endif // wxUSE_THREADS
+
 public:
   // functions to work with this list
   wxFileConfigLineList *LineListAppend(const wxString& str);
@@ -272,6 +287,11 @@ private:
   bool m_isDirty;                       // if true, we have unsaved changes
   bool m_autosave;                      // if true, save changes on destruction
 
+#if wxUSE_THREADS
+  // non-null only in write-behind mode, shared with the background task
+  std::shared_ptr<wxFileConfigWriter> m_writer;
+#endif // wxUSE_THREADS
+
   wxDECLARE_NO_COPY_CLASS(wxFileConfig);
   wxDECLARE_ABSTRACT_CLASS(wxFileConfig);
 };
@@ -672,5 +672,67 @@ private:
     bool            m_dontFollowLinks;
 };
 
+// ----------------------------------------------------------------------------
+// wxFileStat: information about a file system object retrieved all at once
+// ----------------------------------------------------------------------------
+
+class WXDLLIMPEXP_BASE wxFileStat
+{
+public:
+    // default ctor creates an object not corresponding to any file, IsOk()
+    // returns false for it
+    wxFileStat() { Init(); }
+
+    // get the information about the given path, following it if it's a
+    // symbolic link unless wxFILE_EXISTS_NO_FOLLOW is specified in flags
+    explicit wxFileStat(const wxString& path, int flags = 0)
+    {
+        Init();
+        (void)Update(path, flags);
+    }
+
+    // get the information about the given path again, returns IsOk()
+    bool Update(const wxString& path, int flags = 0);
+
+    // return true if the information was retrieved successfully, i.e. if the
+    // path exists (all the other functions can only be called if it does)
+    bool IsOk() const { return m_ok; }
+
+    // the type of the object: notice that IsSymLink() returns true if the
+    // path itself is a symbolic link, even if it was followed and the other
+    // functions return the information about its target
+    bool IsFile() const;
+    bool IsDir() const;
+    bool IsSymLink() const { return m_isSymLink; }
+
+    // get the combination of wxPosixPermissions elements for this object
+    int GetPermissions() const;
+
+#if wxUSE_LONGLONG
+    wxULongLong GetSize() const;
+#endif // wxUSE_LONGLONG
+
+#if wxUSE_DATETIME
+    wxDateTime GetAccessTime() const;
+    wxDateTime GetModificationTime() const;
+    wxDateTime GetCreationTime() const;
+#endif // wxUSE_DATETIME
+
+    // implementation only: set from the result of stat(), possibly with
+    // an indication that the path is a symbolic link
+    void SetFromStat(const wxStructStat& st, bool isSymLink = false);
+
+private:
+    void Init();
+
+    bool m_ok;
+    bool m_isSymLink;
+    int m_mode;
+    wxFileOffset m_size;
+    time_t m_accessTime,
+           m_modificationTime,
+           m_creationTime;
+};
+
 #endif // _WX_FILENAME_H_
 
@@ -14,6 +14,7 @@
 #if wxUSE_FILESYSTEM
 
 #include "wx/stream.h"
+#include "wx/arrstr.h"
 #include "wx/datetime.h"
 #include "wx/filename.h"
 
@@ -124,6 +125,11 @@ public:
     virtual wxString FindFirst(const wxString& spec, int flags = 0);
     virtual wxString FindNext();
 
+    // Returns the protocols which this handler can open. If this is empty, as
+    // by default, CanOpen() is called for the locations with any protocol,
+    // otherwise only for those with one of the returned protocols.
+    virtual wxArrayString GetSupportedProtocols() const { return wxArrayString(); }
+
     // Returns MIME type of the file - w/o need to open it
     // (default behaviour is that it returns type based on extension)
     static wxString GetMimeTypeFromExt(const wxString& location);
@@ -134,6 +140,10 @@ protected:
     // {it returns "tar" for "file:subdir/archive.tar.gz#tar:/README.txt"}
     static wxString GetProtocol(const wxString& location);
 
+    // returns true if the location uses the given protocol, this is the same
+    // as comparing GetProtocol() result with it but more efficient
+    static bool HasProtocol(const wxString& location, const wxString& protocol);
+
     // returns left part of address:
     // {it returns "file:subdir/archive.tar.gz" for "file:subdir/archive.tar.gz#tar:/README.txt"}
     static wxString GetLeftLocation(const wxString& location);
@@ -147,6 +157,11 @@ protected:
     // {it returns "/README.txt" for "file:subdir/archive.tar.gz#tar:/README.txt"}
     static wxString GetRightLocation(const wxString& location);
 
+    // same as GetRightLocation() but returns the position of the right part
+    // in the location instead of copying it, returns false if it's empty
+    static bool GetRightLocationRange(const wxString& location,
+                                      size_t* start, size_t* end);
+
     wxDECLARE_ABSTRACT_CLASS(wxFileSystemHandler);
 };
 
@@ -224,6 +239,15 @@ public:
 protected:
     wxFileSystemHandler *MakeLocal(wxFileSystemHandler *h);
 
+    // try to open the given absolute location using the registered handlers
+    wxFSFile* DoOpenFile(const wxString& location);
+
+    // try to start searching using the first handler which can open the spec
+    wxString DoFindFirst(const wxString& spec, int flags);
+
+    // rebuild the table of handlers by protocol after changing m_Handlers
+    static void UpdateHandlersByProtocol();
+
     wxString m_Path;
             // the path (location) we are currently in
             // this is path, not file!
@@ -270,6 +294,7 @@ special characters :
 class WXDLLIMPEXP_BASE wxLocalFSHandler : public wxFileSystemHandler
 {
 public:
+    virtual wxArrayString GetSupportedProtocols() const override;
     virtual bool CanOpen(const wxString& location) override;
     virtual wxFSFile* OpenFile(wxFileSystem& fs, const wxString& location) override;
     virtual wxString FindFirst(const wxString& spec, int flags = 0) override;
@@ -19,6 +19,8 @@
 #include "wx/fontenc.h"
 #include "wx/arrstr.h"
 
+#include <functional>
+
 // ----------------------------------------------------------------------------
 // wxFontEnumerator enumerates all available fonts on the system or only the
 // fonts with given attributes
@@ -67,6 +69,15 @@ public:
     GetFacenames(wxFontEncoding encoding = wxFONTENCODING_SYSTEM, // all
                  bool fixedWidthOnly = false);
 
+    // asynchronous version of GetFacenames(): the callback is called with the
+    // array of facenames later, in the main thread
+    using FacenamesCallback = std::function<void (const wxArrayString&)>;
+
+    static void
+    GetFacenamesAsync(const FacenamesCallback& callback,
+                      wxFontEncoding encoding = wxFONTENCODING_SYSTEM, // all
+                      bool fixedWidthOnly = false);
+
     // convenience function that returns array of all available encodings.
     static wxArrayString GetEncodings(const wxString& facename = wxEmptyString);
 
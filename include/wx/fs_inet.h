@@ -15,6 +15,8 @@
 
 #include "wx/filesys.h"
 
+class wxHTTPCache;
+
 // ----------------------------------------------------------------------------
 // wxInternetFSHandler
 // ----------------------------------------------------------------------------
@@ -22,8 +24,14 @@
 class WXDLLIMPEXP_NET wxInternetFSHandler : public wxFileSystemHandler
 {
     public:
+        virtual wxArrayString GetSupportedProtocols() const override;
         virtual bool CanOpen(const wxString& location) override;
         virtual wxFSFile* OpenFile(wxFileSystem& fs, const wxString& location) override;
+
+        // Use the given cache, which is not owned by this class, for all HTTP
+        // requests or don't cache the responses if it is null (default).
+        static void SetCache(wxHTTPCache* cache);
+        static wxHTTPCache* GetCache();
 };
 
 #endif
@@ -49,6 +49,7 @@ public:
     // Remove file from memory FS and free occupied memory
     static void RemoveFile(const wxString& filename);
 
+    virtual wxArrayString GetSupportedProtocols() const override;
     virtual bool CanOpen(const wxString& location) override;
     virtual wxFSFile* OpenFile(wxFileSystem& fs, const wxString& location) override;
     virtual wxString FindFirst(const wxString& spec, int flags = 0) override;
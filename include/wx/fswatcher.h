@@ -20,7 +20,9 @@
 #include "wx/filename.h"
 #include "wx/dir.h"
 
+#include <memory>
 #include <unordered_map>
+#include <vector>
 
 #define wxTRACE_FSWATCHER "fswatcher"
 
@@ -218,6 +220,63 @@ typedef void (wxEvtHandler::*wxFileSystemWatcherEventFunction)
 #define EVT_FSWATCHER(winid, func) \
     wx__DECLARE_EVT1(wxEVT_FSWATCHER, winid, wxFileSystemWatcherEventHandler(func))
 
+/**
+ * Event containing several file system changes, sent instead of the
+ * individual wxFileSystemWatcherEvents if batching is enabled.
+ */
+class WXDLLIMPEXP_FWD_BASE wxFileSystemWatcherBatchEvent;
+wxDECLARE_EXPORTED_EVENT(WXDLLIMPEXP_BASE, wxEVT_FSWATCHER_BATCH,
+                         wxFileSystemWatcherBatchEvent);
+
+class WXDLLIMPEXP_BASE wxFileSystemWatcherBatchEvent : public wxEvent
+{
+public:
+    using Events = std::vector<wxFileSystemWatcherEvent>;
+
+    explicit wxFileSystemWatcherBatchEvent(int watchid = wxID_ANY) :
+        wxEvent(watchid, wxEVT_FSWATCHER_BATCH)
+    {
+    }
+
+    /**
+     * Returns all the changes in this batch, in the order they happened.
+     */
+    const Events& GetEvents() const
+    {
+        return m_events;
+    }
+
+    /**
+     * Takes ownership of the given changes, leaving the vector empty.
+     */
+    void SetEvents(Events& events)
+    {
+        m_events.swap(events);
+        events.clear();
+    }
+
+    virtual wxEvent* Clone() const override;
+
+    virtual wxEventCategory GetEventCategory() const override
+    {
+        return wxEVT_CATEGORY_UNKNOWN;
+    }
+
+private:
+    Events m_events;
+
+    wxDECLARE_DYNAMIC_CLASS_NO_ASSIGN_DEF_COPY(wxFileSystemWatcherBatchEvent);
+};
+
+typedef void (wxEvtHandler::*wxFileSystemWatcherBatchEventFunction)
+                                                (wxFileSystemWatcherBatchEvent&);
+
+#define wxFileSystemWatcherBatchEventHandler(func) \
+    wxEVENT_HANDLER_CAST(wxFileSystemWatcherBatchEventFunction, func)
+
+#define EVT_FSWATCHER_BATCH(winid, func) \
+    wx__DECLARE_EVT1(wxEVT_FSWATCHER_BATCH, winid, wxFileSystemWatcherBatchEventHandler(func))
+
 // ----------------------------------------------------------------------------
 // wxFileSystemWatcherBase: interface for wxFileSystemWatcher
 // ----------------------------------------------------------------------------
@@ -287,6 +346,12 @@ using wxFSWatchInfoMap = std::unordered_map<wxString, wxFSWatchInfo>;
  */
 class wxFSWatcherImpl;
 
+// Used by AddTree() when adding the watches asynchronously.
+struct wxFSWTreeScan;
+
+// Used for delivering the events in batches.
+class wxFSWEventBatcher;
+
 /**
  * Main entry point for clients interested in file system events.
  * Defines interface that can be used to receive that kind of events.
@@ -332,6 +397,36 @@ public:
      */
     virtual bool RemoveAll();
 
+    /**
+     * If enabled, AddTree() only watches the tree root directly and returns,
+     * while the subdirectories are found by a worker thread and watched
+     * later, from the event loop.
+     */
+    void EnableAsyncTreeAdd(bool enable = true)
+    {
+        m_asyncTreeAdd = enable;
+    }
+
+    /**
+     * Returns true if the subdirectories of any tree passed to AddTree()
+     * haven't been all added yet.
+     */
+    bool HasPendingTreeAdd() const
+    {
+        return !m_treeScans.empty();
+    }
+
+    /**
+     * If the delay is positive, the changes are collected and sent in a
+     * single wxFileSystemWatcherBatchEvent once no new changes happen for
+     * this number of milliseconds, instead of sending a separate
+     * wxFileSystemWatcherEvent for each of them. Passing 0 disables batching
+     * and sends any currently pending changes immediately.
+     */
+    void SetBatchDelay(int delayMs);
+
+    int GetBatchDelay() const;
+
     /**
      * Returns the number of watched paths
      */
@@ -360,6 +455,11 @@ public:
     }
 
 
+    // This is a semi-private function used by wxWidgets itself only.
+    //
+    // Sends the event to the owner or adds it to the current batch.
+    void DeliverEvent(wxFileSystemWatcherEvent& event);
+
     // This is a semi-private function used by wxWidgets itself only.
     //
     // Delegates the real work of adding the path to wxFSWatcherImpl::Add() and
@@ -379,6 +479,19 @@ protected:
     wxFSWatcherImpl* m_service;     // file system events service
     wxEvtHandler* m_owner;             // handler for file system events
 
+private:
+    // Cancel the asynchronous scans of the trees under the given path, or of
+    // all trees if it is empty, and return true if there were any.
+    bool CancelTreeScans(const wxString& path = wxString());
+
+    bool m_asyncTreeAdd;
+
+    // Only non-null if batching is enabled.
+    std::unique_ptr<wxFSWEventBatcher> m_batcher;
+
+    // Trees being currently scanned by the worker threads.
+    std::vector<std::shared_ptr<wxFSWTreeScan>> m_treeScans;
+
     friend class wxFSWatcherImpl;
 };
 
@@ -15,6 +15,8 @@
 
 #include "wx/sizer.h"
 
+#include <vector>
+
 
 //---------------------------------------------------------------------------
 // Classes to represent a position in the grid and a size of an item in the
@@ -236,7 +238,8 @@ public:
 
     // Get/Set the size used for cells in the grid with no item.
     wxSize GetEmptyCellSize() const          { return m_emptyCellSize; }
-    void SetEmptyCellSize(const wxSize& sz)  { m_emptyCellSize = sz; }
+    void SetEmptyCellSize(const wxSize& sz)
+        { m_emptyCellSize = sz; InvalidateMinSize(); }
 
     // Get the size of the specified cell, including hgap and vgap.  Only
     // valid after a Layout.
@@ -332,6 +335,10 @@ protected:
 
 
 private:
+    // Minimal sizes of all our items, in the same order as m_children, as
+    // computed by the last call to CalcMin() (the sizes of the hidden items
+    // are not used and are left as wxDefaultSize).
+    std::vector<wxSize> m_itemMinSizes;
 
     wxDECLARE_CLASS(wxGridBagSizer);
     wxDECLARE_NO_COPY_CLASS(wxGridBagSizer);
@@ -944,6 +944,8 @@ inline void wxSize::DecBy(const wxPoint& pt) { DecBy(pt.x, pt.y); }
 
 typedef wxInt8 wxDash;
 
+class wxGDIObjListHash;
+
 class WXDLLIMPEXP_CORE wxGDIObjListBase {
 public:
     wxGDIObjListBase();
@@ -951,6 +953,12 @@ public:
 
 protected:
     wxList list;
+
+    // Index of the objects in the list by their attributes, allowing to find
+    // them without iterating over all of them.
+    wxGDIObjListHash* m_hash;
+
+    wxDECLARE_NO_COPY_CLASS(wxGDIObjListBase);
 };
 
 class wxStringToColourHashMap;
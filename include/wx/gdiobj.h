@@ -11,6 +11,7 @@
 #define _WX_GDIOBJ_H_BASE_
 
 #include "wx/object.h"
+#include "wx/resourcestats.h"
 
 // ----------------------------------------------------------------------------
 // wxGDIRefData is the base class for wxXXXData structures which contain the
@@ -40,6 +41,28 @@ private:
 class WXDLLIMPEXP_CORE wxGDIObject : public wxObject
 {
 public:
+    // ctors and dtor only exist to allow keeping track of the live objects
+    wxGDIObject()
+    {
+        if ( wxResourceStats::IsEnabled() )
+            wxResourceStats::OnGDIObjectCreated(this);
+    }
+
+    wxGDIObject(const wxGDIObject& other)
+        : wxObject(other)
+    {
+        if ( wxResourceStats::IsEnabled() )
+            wxResourceStats::OnGDIObjectCreated(this);
+    }
+
+    wxGDIObject& operator=(const wxGDIObject& other) = default;
+
+    virtual ~wxGDIObject()
+    {
+        if ( wxResourceStats::IsEnabled() )
+            wxResourceStats::OnGDIObjectDestroyed(this);
+    }
+
     // checks if the object can be used
     virtual bool IsOk() const
     {
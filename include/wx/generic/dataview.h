@@ -262,6 +262,8 @@ public:
 
     virtual bool SetRowHeight( int rowHeight ) override;
 
+    virtual bool EnableBackgroundSorting(bool enable = true) override;
+
     virtual void Collapse( const wxDataViewItem & item ) override;
     virtual bool IsExpanded( const wxDataViewItem & item ) const override;
 
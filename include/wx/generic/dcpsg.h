@@ -20,6 +20,21 @@
 #include "wx/cmndata.h"
 #include "wx/strvararg.h"
 
+#include <string>
+
+// Possible ways of storing the bitmaps in the generated PostScript.
+enum wxPostScriptBitmapEncoding
+{
+    // Uncompressed hexadecimal data, supported by all PostScript printers.
+    wxPS_BITMAP_HEX,
+
+    // Lossless compression, requires PostScript Level 3.
+    wxPS_BITMAP_FLATE,
+
+    // Lossy JPEG compression, requires PostScript Level 2.
+    wxPS_BITMAP_DCT
+};
+
 //-----------------------------------------------------------------------------
 // wxPostScriptDC
 //-----------------------------------------------------------------------------
@@ -33,6 +48,11 @@ public:
     // Recommended constructor
     wxPostScriptDC(const wxPrintData& printData);
 
+    // wxPostScriptDC-specific methods:
+
+    void SetBitmapEncoding(wxPostScriptBitmapEncoding encoding);
+    wxPostScriptBitmapEncoding GetBitmapEncoding() const;
+
 private:
     wxDECLARE_DYNAMIC_CLASS(wxPostScriptDC);
 };
@@ -92,6 +112,12 @@ public:
     virtual int GetDepth() const override { return 24; }
 
     void PsPrint( const wxString& psdata );
+    void PsPrint( const char* psdata );
+
+    void SetBitmapEncoding(wxPostScriptBitmapEncoding encoding)
+        { m_bitmapEncoding = encoding; }
+    wxPostScriptBitmapEncoding GetBitmapEncoding() const
+        { return m_bitmapEncoding; }
 
     // Overridden for wxPrinterDC Impl
 
@@ -149,6 +175,22 @@ protected:
     // Set PostScript color
     void SetPSColour(const wxColour& col);
 
+    // Append the data to the output buffer, writing it out if it's full.
+    void PsWrite(const char* data, size_t len);
+    // Write out the buffered output.
+    void PsFlush();
+    // Output the number, followed by a space, without using wxString.
+    void PsPrintNumber(double value);
+    void PsPrintPoint(double x, double y)
+        { PsPrintNumber(x); PsPrintNumber(y); }
+    // Output the moveto and lineto commands for the given points.
+    void PsPrintPath(int n, const wxPoint points[],
+                     wxCoord xoffset, wxCoord yoffset);
+    // Output the bitmap data compressed using Flate or DCT filter, return
+    // false if this is not possible.
+    bool DoDrawCompressedBitmap(const wxImage& image,
+                                double xx, double yy, double ww, double hh);
+
     FILE*             m_pstream;    // PostScript output stream
     unsigned char     m_currentRed;
     unsigned char     m_currentGreen;
@@ -161,6 +203,9 @@ protected:
     double            m_pageHeight;
     wxArrayString     m_definedPSFonts;
     bool              m_isFontChanged;
+    double            m_currentLineWidth; // negative if unknown
+    wxPostScriptBitmapEncoding m_bitmapEncoding;
+    std::string       m_psBuffer;
 
 private:
     wxDECLARE_DYNAMIC_CLASS(wxPostScriptDCImpl);
@@ -20,12 +20,15 @@
 #include "wx/dirdlg.h"
 #include "wx/choice.h"
 
+#include <memory>
+
 //-----------------------------------------------------------------------------
 // classes
 //-----------------------------------------------------------------------------
 
 class WXDLLIMPEXP_FWD_CORE wxTextCtrl;
 class WXDLLIMPEXP_FWD_BASE wxHashTable;
+class wxAsyncDirLister;
 
 extern WXDLLIMPEXP_DATA_CORE(const char) wxDirDialogDefaultFolderStr[];
 
@@ -69,6 +72,9 @@ public:
     bool m_isHidden;
     bool m_isExpanded;
     bool m_isDir;
+
+    // Non-null only while this item is being populated in background.
+    std::shared_ptr<wxAsyncDirLister> m_lister;
 };
 
 //-----------------------------------------------------------------------------
@@ -138,6 +144,12 @@ public:
     virtual void SelectPath(const wxString& path, bool select = true);
     virtual void SelectPaths(const wxArrayString& paths);
 
+    // Read the directory contents in background when the user expands an
+    // item instead of blocking until the entire directory is read.
+    void EnableBackgroundExpansion(bool enable = true)
+        { m_backgroundExpansion = enable; }
+    bool IsBackgroundExpansionEnabled() const { return m_backgroundExpansion; }
+
     virtual void ShowHidden( bool show );
     virtual bool GetShowHidden() { return m_showHidden; }
 
@@ -193,10 +205,14 @@ protected:
     bool ExtractWildcard(const wxString& filterStr, int n, wxString& filter, wxString& description);
 
 private:
-    void PopulateNode(wxTreeItemId node);
+    void PopulateNode(wxTreeItemId node, bool background = false);
+    void AppendEntry(wxTreeItemId parentId, const wxString& dirName,
+                     const wxString& name, bool isDir);
+    void CancelBackgroundExpansion(wxTreeItemId itemId);
     wxDirItemData* GetItemData(wxTreeItemId itemId);
 
     bool            m_showHidden;
+    bool            m_backgroundExpansion;
     wxTreeItemId    m_rootId;
     wxString        m_defaultPath; // Starting path
     long            m_styleEx; // Extended style
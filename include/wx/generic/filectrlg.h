@@ -17,10 +17,13 @@
 #include "wx/filectrl.h"
 #include "wx/filename.h"
 
+#include <memory>
+
 class WXDLLIMPEXP_FWD_CORE wxCheckBox;
 class WXDLLIMPEXP_FWD_CORE wxChoice;
 class WXDLLIMPEXP_FWD_CORE wxStaticText;
 class WXDLLIMPEXP_FWD_CORE wxTextCtrl;
+class wxAsyncDirLister;
 
 extern WXDLLIMPEXP_DATA_CORE(const char) wxFileSelectorDefaultWildcardStr[];
 
@@ -46,6 +49,10 @@ public:
     // Create a filedata from this information
     wxFileData( const wxString &filePath, const wxString &fileName,
                 fileType type, int image_id );
+    // Create a filedata using the already retrieved information about the
+    // file, e.g. returned by wxDir::GetNext(), if possible
+    wxFileData( const wxString &filePath, const wxString &fileName,
+                fileType type, int image_id, const wxFileStat& stat );
 
     // make a full copy of the other wxFileData
     void Copy( const wxFileData &other );
@@ -117,6 +124,9 @@ protected:
 
 private:
     void Init();
+
+    // Fill in the data from the given information.
+    void SetFromStat(const wxFileStat& stat);
 };
 
 //-----------------------------------------------------------------------------
@@ -155,6 +165,12 @@ public:
     wxString GetWild() const { return m_wild; }
     wxString GetDir() const { return m_dirName; }
 
+    // Read the directory contents in background in UpdateFiles(), adding the
+    // items to the control as they are found, instead of blocking until the
+    // entire directory is read.
+    void EnableBackgroundUpdate(bool enable = true);
+    bool IsBackgroundUpdateEnabled() const { return m_backgroundUpdate; }
+
     void OnListDeleteItem( wxListEvent &event );
     void OnListDeleteAllItems( wxListEvent &event );
     void OnListEndLabelEdit( wxListEvent &event );
@@ -177,6 +193,24 @@ protected:
     wxFileData::fileListFieldType m_sort_field;
 
 private:
+    void Init();
+
+    // Select the item with the given name or the first one if it's empty,
+    // possibly only once the current update finishes.
+    void SelectAfterUpdate(const wxString& name);
+    void DoSelectAfterUpdate();
+
+    bool m_backgroundUpdate;
+
+#if wxUSE_THREADS
+    // Non-null only while the directory is being read in background.
+    std::unique_ptr<wxAsyncDirLister> m_lister;
+#endif
+
+    // Item to select once m_lister finishes, see SelectAfterUpdate().
+    wxString m_selectAfterUpdate;
+    bool m_hasSelectAfterUpdate;
+
     wxDECLARE_DYNAMIC_CLASS(wxFileListCtrl);
     wxDECLARE_EVENT_TABLE();
 };
@@ -255,6 +289,10 @@ public:
 
     wxFileListCtrl *GetFileList() { return m_list; }
 
+    // Read directories in background, see wxFileListCtrl::UpdateFiles().
+    void EnableBackgroundUpdate(bool enable = true)
+        { m_list->EnableBackgroundUpdate(enable); }
+
     void ChangeToReportMode() { m_list->ChangeToReportMode(); }
     void ChangeToListMode() { m_list->ChangeToListMode(); }
 
@@ -20,6 +20,7 @@
 #include <iterator>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 // ----------------------------------------------------------------------------
 // constants
@@ -86,11 +87,22 @@ enum wxGridRenderStyle
                           wxGRID_DRAW_BOX_RECT
 };
 
+// Flags used with wxGrid::CopySelection() to select the clipboard formats.
+enum wxGridCopyFlags
+{
+    wxGRID_COPY_TEXT = 0x001,
+    wxGRID_COPY_HTML = 0x002,
+    wxGRID_COPY_DEFERRED = 0x004,
+    wxGRID_COPY_DEFAULT = wxGRID_COPY_TEXT |
+                          wxGRID_COPY_HTML
+};
+
 // ----------------------------------------------------------------------------
 // forward declarations
 // ----------------------------------------------------------------------------
 
 class WXDLLIMPEXP_FWD_CORE wxGrid;
+class WXDLLIMPEXP_FWD_CORE wxGridBlockCoords;
 class WXDLLIMPEXP_FWD_CORE wxGridCellAttr;
 class WXDLLIMPEXP_FWD_CORE wxGridCellAttrProviderData;
 class WXDLLIMPEXP_FWD_CORE wxGridColLabelWindow;
@@ -950,6 +962,11 @@ public:
     virtual void SetRowAttr(wxGridCellAttr *attr, int row);
     virtual void SetColAttr(wxGridCellAttr *attr, int col);
 
+    // set the attribute for all cells of the given block, this is much more
+    // efficient than setting it for each of them individually
+    virtual void SetAttrRange(wxGridCellAttr *attr,
+                              const wxGridBlockCoords& block);
+
     // these functions must be called whenever some rows/cols are deleted
     // because the internal data must be updated then
     void UpdateAttrRows( size_t pos, int numRows );
@@ -1344,6 +1361,12 @@ public:
     virtual void SetRowAttr(wxGridCellAttr *attr, int row);
     virtual void SetColAttr(wxGridCellAttr *attr, int col);
 
+    // Support for tables retrieving their data asynchronously: PrepareRows()
+    // is called with the range of rows about to be drawn and, if the data for
+    // any row is not available, a placeholder is shown for its cells.
+    virtual void PrepareRows(int WXUNUSED(topRow), int WXUNUSED(bottomRow)) { }
+    virtual bool IsRowAvailable(int WXUNUSED(row)) { return true; }
+
 private:
     wxGrid * m_view;
     wxGridCellAttrProvider *m_attrProvider;
@@ -1352,6 +1375,61 @@ private:
     wxDECLARE_NO_COPY_CLASS(wxGridTableBase);
 };
 
+// ----------------------------------------------------------------------------
+// wxGridPagedTableBase: base class for tables fetching their data in pages
+// ----------------------------------------------------------------------------
+
+class WXDLLIMPEXP_CORE wxGridPagedTableBase : public wxGridTableBase
+{
+public:
+    explicit wxGridPagedTableBase(int pageSize = 100);
+
+    // Number of rows fetched at once, changing it forgets all fetched rows.
+    void SetPageSize(int pageSize);
+    int GetPageSize() const { return m_pageSize; }
+
+    // Number of rows above and below the visible ones to fetch in advance.
+    void SetPrefetchRows(int rows);
+    int GetPrefetchRows() const { return m_prefetchRows; }
+
+    // Must be called by the derived class, in the main thread, when the data
+    // for the rows requested by FetchRows() becomes available.
+    void NotifyRowsFetched(int firstRow, int numRows);
+
+    // Forget the data of the given rows, or all of them, so that they are
+    // fetched again when they need to be shown.
+    void InvalidateRows(int firstRow, int numRows);
+    void InvalidateAllRows();
+
+    virtual void PrepareRows(int topRow, int bottomRow) override;
+    virtual bool IsRowAvailable(int row) override;
+
+protected:
+    // Must be overridden to start fetching the data for the given rows. This
+    // function must not block and NotifyRowsFetched() has to be called later,
+    // once the data is available.
+    virtual void FetchRows(int firstRow, int numRows) = 0;
+
+private:
+    enum PageState : unsigned char
+    {
+        Page_Missing,
+        Page_Requested,
+        Page_Available
+    };
+
+    // Refresh the given rows in the associated grid, if any.
+    void RefreshRows(int firstRow, int numRows);
+
+    std::vector<PageState> m_pages;
+
+    int m_pageSize;
+    int m_prefetchRows;
+
+    wxDECLARE_ABSTRACT_CLASS(wxGridPagedTableBase);
+    wxDECLARE_NO_COPY_CLASS(wxGridPagedTableBase);
+};
+
 
 // ----------------------------------------------------------------------------
 // wxGridTableMessage
@@ -1508,6 +1586,143 @@ struct WXDLLIMPEXP_CORE wxGridSizesInfo
     wxUnsignedToIntHashMap m_customSizes;
 };
 
+// ----------------------------------------------------------------------------
+// wxGridLineEnds: ends of all rows or columns of the grid
+// ----------------------------------------------------------------------------
+
+// This class is used internally by wxGrid to store the positions of its rows
+// or columns: it keeps their sizes in display order in a Fenwick (binary
+// indexed) tree, which allows both finding the end of any line or the line
+// containing the given coordinate and changing the size of a single line in
+// O(log N) time, instead of O(N) needed when storing the ends directly.
+class WXDLLIMPEXP_CORE wxGridLineEnds
+{
+public:
+    wxGridLineEnds() = default;
+
+    // Return true if the object hasn't been initialized.
+    bool empty() const { return m_tree.empty(); }
+
+    // Reset to the uninitialized state.
+    void clear();
+
+    // Initialize from the sizes of all lines, indexed by the line index, and
+    // the array of lines at each position, which may be empty if the lines
+    // are not reordered. Negative sizes are used for the hidden lines and
+    // are handled as 0. This takes O(N) time.
+    void Init(const wxArrayInt& sizes, const wxArrayInt& lineAt);
+
+    // Return the end of the line with the given index, i.e. the total size of
+    // all lines shown before it and of the line itself.
+    int GetEnd(int line) const;
+
+    // Change the (non-negative) size of the line with the given index by the
+    // given amount.
+    void Add(int line, int diff);
+
+    // Return the position of the first line ending after the given
+    // coordinate or the number of lines if there is no such line.
+    int FindPos(int coord) const;
+
+private:
+    int GetPosOf(int line) const
+    {
+        return m_posOf.empty() ? line : m_posOf[line];
+    }
+
+    // Fenwick tree indexed by 1-based line positions.
+    std::vector<int> m_tree;
+
+    // Position of each line, only used if the lines are reordered.
+    std::vector<int> m_posOf;
+};
+
+// ----------------------------------------------------------------------------
+// wxGridRenderCache: cache of the layout computed by the cell renderers
+// ----------------------------------------------------------------------------
+
+// This cache can be enabled using wxGrid::EnableRenderCache() and is then
+// used by the standard renderers to avoid measuring the same text over and
+// over again. The cached values are remembered together with the hash of the
+// cell value and the font used, and are only returned if they still match,
+// so the cache doesn't need to be invalidated when the cell values change.
+class WXDLLIMPEXP_CORE wxGridRenderCache
+{
+public:
+    // The cache is cleared when it contains more than the given number of
+    // cells.
+    explicit wxGridRenderCache(size_t maxCells = 100000);
+
+    // Lines resulting from wrapping the value in the given width.
+    bool GetLines(int row, int col,
+                  const wxString& value, const wxFont& font, int width,
+                  wxArrayString& lines) const;
+    void SetLines(int row, int col,
+                  const wxString& value, const wxFont& font, int width,
+                  const wxArrayString& lines);
+
+    // Best size of the cell, as returned by wxGridCellRenderer::GetBestSize().
+    bool GetBestSize(int row, int col,
+                     const wxString& value, const wxFont& font,
+                     wxSize& size) const;
+    void SetBestSize(int row, int col,
+                     const wxString& value, const wxFont& font,
+                     const wxSize& size);
+
+    // Best width for the given height and best height for the given width,
+    // as returned by wxGridCellRenderer::GetBest{Width,Height}().
+    bool GetBestWidth(int row, int col,
+                      const wxString& value, const wxFont& font, int height,
+                      int& width) const;
+    void SetBestWidth(int row, int col,
+                      const wxString& value, const wxFont& font, int height,
+                      int width);
+    bool GetBestHeight(int row, int col,
+                       const wxString& value, const wxFont& font, int width,
+                       int& height) const;
+    void SetBestHeight(int row, int col,
+                       const wxString& value, const wxFont& font, int width,
+                       int height);
+
+    // Forget the cached data for the given cell or all of them.
+    void InvalidateCell(int row, int col);
+    void Clear();
+
+    size_t GetCount() const { return m_entries.size(); }
+
+private:
+    struct Entry
+    {
+        unsigned long valueHash = 0;
+        wxFont font;
+
+        int linesWidth = -1;
+        wxArrayString lines;
+
+        wxSize bestSize = wxDefaultSize;
+
+        int bestWidthHeight = -1;
+        int bestWidth = 0;
+
+        int bestHeightWidth = -1;
+        int bestHeight = 0;
+    };
+
+    // Return the entry for the given cell if it exists and matches the value
+    // and font or null.
+    const Entry* Find(int row, int col,
+                      const wxString& value, const wxFont& font) const;
+
+    // Return the entry for the given cell, resetting it if it doesn't match.
+    Entry& Get(int row, int col, const wxString& value, const wxFont& font);
+
+    std::unordered_map<wxLongLong_t, Entry> m_entries;
+
+    const size_t m_maxCells;
+
+    wxDECLARE_NO_COPY_CLASS(wxGridRenderCache);
+};
+
 // ----------------------------------------------------------------------------
 // wxGrid
 // ----------------------------------------------------------------------------
@@ -1668,6 +1883,11 @@ public:
     // and may be overridden by the user
     virtual void DrawCellHighlight( wxDC& dc, const wxGridCellAttr *attr );
 
+    // this function is called to draw the cells of the rows for which the
+    // table data is not available yet and may be overridden by the user
+    virtual void DrawCellPlaceholder( wxDC& dc, const wxGridCellAttr& attr,
+                                      const wxRect& rect, int row, int col );
+
     virtual void DrawRowLabels( wxDC& dc, const wxArrayInt& rows );
     virtual void DrawRowLabel( wxDC& dc, int row );
 
@@ -1725,6 +1945,13 @@ public:
     // _coords_ and its corresponding row and column labels for highlighting.
     void RefreshBlock(const wxGridCellCoords& coords);
 
+    // Refresh the given cells, e.g. after changing their values in the table
+    // directly. The refresh is deferred until the next event loop iteration,
+    // so calling this function many times in a row is cheap and only the
+    // cells themselves (and the cells their contents overflow into), rather
+    // than the entire rows, are repainted.
+    void RefreshCells(const std::vector<wxGridCellCoords>& cells);
+
     // Refresh the entire grid if _rect_ is null. If not null, then:
     // - the intersection of the cells area with the rectangle _rect_ will be refreshed.
     // - the projection of the rectangle _rect_ on the row label window will be refreshed.
@@ -2061,6 +2288,18 @@ public:
     // happens, call this function to force it
     void RefreshAttr(int row, int col);
 
+    // enable or disable caching the results of the text measurements done
+    // by the renderers, this is useful for the grids with a lot of text
+    void EnableRenderCache(bool enable = true);
+    bool IsRenderCacheEnabled() const { return m_renderCache != nullptr; }
+
+    // return the render cache if it's enabled or null, this is mostly useful
+    // for the custom renderers
+    wxGridRenderCache* GetRenderCache() const { return m_renderCache; }
+
+    // invalidate the entire render cache, if enabled
+    void ClearRenderCache();
+
     // returns the attribute we may modify in place: a new one if this cell
     // doesn't have any yet or the existing one if it does
     //
@@ -2223,6 +2462,14 @@ public:
     // and also set the grid size to just fit its contents
     void     AutoSize();
 
+    // by default all rows are measured when auto sizing a column, but for the
+    // grids with many rows it may be preferable to get an approximate result
+    // quickly by measuring only the given number of rows: the visible ones,
+    // the first and last ones and some others chosen randomly, 0 means to
+    // always measure all rows
+    void     SetAutoSizeSampleRows(int numRows);
+    int      GetAutoSizeSampleRows() const { return m_autoSizeSampleRows; }
+
     // Note for both AutoSizeRowLabelSize and AutoSizeColLabelSize:
     // If col equals to wxGRID_AUTOSIZE value then function autosizes labels column
     // instead of data column. Note that this operation may be slow for large
@@ -2346,7 +2593,7 @@ public:
 
     void ClearSelection();
 
-    bool CopySelection();
+    bool CopySelection(int flags = wxGRID_COPY_DEFAULT);
 
     bool IsInSelection( int row, int col ) const;
 
@@ -2566,7 +2813,7 @@ protected:
     int        m_defaultRowHeight;
     int        m_minAcceptableRowHeight;
     wxArrayInt m_rowHeights;
-    wxArrayInt m_rowBottoms;
+    wxGridLineEnds m_rowBottoms;
 
     // init the m_colWidths/Rights arrays
     void InitColWidths();
@@ -2574,7 +2821,7 @@ protected:
     int        m_defaultColWidth;
     int        m_minAcceptableColWidth;
     wxArrayInt m_colWidths;
-    wxArrayInt m_colRights;
+    wxGridLineEnds m_colRights;
 
     int m_sortCol;
     bool m_sortIsAscending;
@@ -2630,9 +2877,16 @@ protected:
     wxColour   m_gridFrozenBorderColour;
     int        m_gridFrozenBorderPenWidth;
 
+    // really refresh the cells accumulated by RefreshCells()
+    void DoRefreshCells();
+
     // common part of AutoSizeColumn/Row()
     void AutoSizeColOrRow(int n, bool setAsMin, wxGridDirection direction);
 
+    // return the sorted rows to measure in AutoSizeColumn() if only some of
+    // them should be used or an empty vector to use all of them
+    std::vector<int> GetAutoSizeRowsSample() const;
+
     // Calculate the minimum acceptable size for labels area
     wxCoord CalcColOrRowLabelAreaMinSize(wxGridDirection direction);
 
@@ -2690,6 +2944,15 @@ protected:
 
     wxGridTypeRegistry*    m_typeRegistry;
 
+    // the render cache if enabled or null
+    wxGridRenderCache*     m_renderCache;
+
+    // the number of rows measured by AutoSizeColumn() or 0 for all of them
+    int                    m_autoSizeSampleRows;
+
+    // the cells passed to RefreshCells() and not refreshed yet
+    std::vector<wxGridCellCoords> m_cellsToRefresh;
+
     enum CursorMode
     {
         WXGRID_CURSOR_SELECT_CELL,
@@ -13,6 +13,10 @@
 #include "wx/gdicmn.h"
 #include "wx/vector.h"
 
+#include <memory>
+
+class WXDLLIMPEXP_FWD_CORE wxMemoryDC;
+
 class WXDLLIMPEXP_CORE wxGenericImageList : public wxImageListBase
 {
 public:
@@ -43,6 +47,11 @@ public:
               int flags = wxIMAGELIST_DRAW_NORMAL,
               bool solidBackground = false) override;
 
+    // Draw the images from a single bitmap containing all of them instead of
+    // using a separate bitmap for each of them.
+    void EnableAtlas(bool enable = true);
+    bool IsAtlasEnabled() const { return m_atlasEnabled; }
+
 #if WXWIN_COMPATIBILITY_3_0
     wxDEPRECATED_MSG("Don't use this overload: it's not portable and does nothing")
     bool Create() { return true; }
@@ -56,8 +65,28 @@ private:
 
     wxBitmap GetImageListBitmap(const wxBitmap& bitmap) const;
 
+    // Return the number of images in each row of the atlas.
+    int GetAtlasColumns() const;
+
+    // Create the atlas if necessary, return false if it can't be used.
+    bool UpdateAtlas();
+
+    // Must be called whenever m_images changes.
+    void InvalidateAtlas();
+
     wxVector<wxBitmap> m_images;
 
+    // The atlas contains copies of all images in m_images, when it's used, and
+    // is selected into m_atlasDC, which is null if the atlas needs to be
+    // (re)created.
+    std::unique_ptr<wxMemoryDC> m_atlasDC;
+    wxBitmap m_atlas;
+    bool m_atlasEnabled = false;
+
+    // Set if the images can't be combined in an atlas, e.g. because they have
+    // different scale factors.
+    bool m_atlasUnusable = false;
+
     wxDECLARE_DYNAMIC_CLASS_NO_COPY(wxGenericImageList);
 };
 
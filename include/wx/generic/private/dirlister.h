@@ -0,0 +1,272 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        wx/generic/private/dirlister.h
+// Purpose:     wxAsyncDirLister: enumerate directory contents in background
+// Author:      wxWidgets team
+// Created:     2026-10-15
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef _WX_GENERIC_PRIVATE_DIRLISTER_H_
+#define _WX_GENERIC_PRIVATE_DIRLISTER_H_
+
+#include "wx/defs.h"
+
+#if wxUSE_THREADS
+
+#include "wx/arrstr.h"
+#include "wx/dir.h"
+#include "wx/event.h"
+#include "wx/filename.h"
+#include "wx/log.h"
+#include "wx/thread.h"
+#include "wx/threadpool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <vector>
+
+// ----------------------------------------------------------------------------
+// wxAsyncDirLister: reads a directory in a wxThreadPool worker and passes the
+// entries found to the GUI thread in batches.
+// ----------------------------------------------------------------------------
+
+// Both callbacks are called in the main thread via CallAfter() on the handler
+// passed to the ctor and are never called after Cancel() returns, so the
+// handler must only outlive the lister object itself (which cancels it when
+// it's destroyed).
+class wxAsyncDirLister
+{
+public:
+    struct Entry
+    {
+        wxString name;
+        bool isDir;
+
+        // Only filled in if Params::wantStat is true.
+        wxFileStat stat;
+    };
+
+    typedef std::vector<Entry> Entries;
+
+    struct Params
+    {
+        wxString dirname;
+
+        // wxDIR_XXX flags to use for enumerating directories and files, if
+        // the corresponding flags are 0, entries of this kind are not listed.
+        int dirFlags = 0;
+        int fileFlags = 0;
+
+        // Patterns to match files against, each one is used in turn (so that
+        // a file matching several of them is returned several times, as is
+        // the case when calling wxDir::GetFirst() for each of them). All files
+        // are returned if this is empty.
+        wxArrayString fileSpecs;
+
+        // If true, all entries are read first and then returned sorted in
+        // natural order, with all the directories before all the files.
+        bool sort = false;
+
+        // If true, Entry::stat is filled in too.
+        bool wantStat = false;
+
+        // Maximal number of entries to pass to the callback at once.
+        size_t batchSize = 256;
+    };
+
+    typedef std::function<void (const Entries&)> BatchFunc;
+    typedef std::function<void ()> DoneFunc;
+
+    wxAsyncDirLister(wxEvtHandler* handler,
+                     const Params& params,
+                     const BatchFunc& onBatch,
+                     const DoneFunc& onDone)
+        : m_state(std::make_shared<State>())
+    {
+        std::shared_ptr<State> state = m_state;
+        wxThreadPool::Get().Submit([state, handler, params, onBatch, onDone]()
+        {
+            Run(*state, state, handler, params, onBatch, onDone);
+        });
+    }
+
+    ~wxAsyncDirLister() { Cancel(); }
+
+    // Stop reading the directory and ensure that no more callbacks are called.
+    //
+    // Must be called from the main thread.
+    void Cancel()
+    {
+        wxCriticalSectionLocker lock(m_state->cs);
+        m_state->cancelled = true;
+        m_state->finished = true;
+    }
+
+    // Return true until the "done" callback is called or Cancel() is.
+    bool IsRunning() const { return !m_state->finished; }
+
+private:
+    struct State
+    {
+        // Set from the main thread, read from the worker one.
+        std::atomic<bool> cancelled{false};
+
+        // Only used in the main thread.
+        bool finished = false;
+
+        // Protects posting the callbacks against concurrent cancellation.
+        wxCriticalSection cs;
+    };
+
+    static void Run(State& state,
+                    const std::shared_ptr<State>& stateptr,
+                    wxEvtHandler* handler,
+                    const Params& params,
+                    const BatchFunc& onBatch,
+                    const DoneFunc& onDone)
+    {
+        // Pass the given entries to the main thread, return false if we were
+        // cancelled.
+        const auto post = [&](Entries& entries) -> bool
+        {
+            wxCriticalSectionLocker lock(state.cs);
+            if ( state.cancelled )
+                return false;
+
+            if ( !entries.empty() )
+            {
+                auto batch = std::make_shared<Entries>(std::move(entries));
+                entries.clear();
+
+                handler->CallAfter([stateptr, onBatch, batch]()
+                {
+                    if ( !stateptr->cancelled )
+                        onBatch(*batch);
+                });
+            }
+
+            return true;
+        };
+
+        Entries dirs,
+                files;
+
+        // Read all entries of the given kind, posting them as soon as we have
+        // enough of them unless we need to sort them first.
+        const auto read = [&](Entries& entries,
+                              const wxString& spec,
+                              int flags,
+                              bool isDir) -> bool
+        {
+            wxLogNull noLog;
+            wxDir dir(params.dirname);
+            if ( !dir.IsOpened() )
+                return true;
+
+            Entry entry;
+            entry.isDir = isDir;
+
+            wxFileStat* const stat = params.wantStat ? &entry.stat : nullptr;
+            for ( bool cont = stat ? dir.GetFirst(&entry.name, stat, spec, flags)
+                                   : dir.GetFirst(&entry.name, spec, flags);
+                  cont;
+                  cont = stat ? dir.GetNext(&entry.name, stat)
+                              : dir.GetNext(&entry.name) )
+            {
+                if ( state.cancelled )
+                    return false;
+
+                if ( entry.name == wxS(".") || entry.name == wxS("..") )
+                    continue;
+
+                entries.push_back(entry);
+
+                if ( !params.sort && entries.size() >= params.batchSize )
+                {
+                    if ( !post(entries) )
+                        return false;
+                }
+            }
+
+            return true;
+        };
+
+        if ( params.dirFlags )
+        {
+            if ( !read(dirs, wxString(), params.dirFlags, true) )
+                return;
+        }
+
+        if ( params.fileFlags )
+        {
+            if ( params.fileSpecs.empty() )
+            {
+                if ( !read(files, wxString(), params.fileFlags, false) )
+                    return;
+            }
+            else
+            {
+                for ( const auto& spec : params.fileSpecs )
+                {
+                    if ( !read(files, spec, params.fileFlags, false) )
+                        return;
+                }
+            }
+        }
+
+        if ( params.sort )
+        {
+            const auto cmp = [](const Entry& e1, const Entry& e2)
+            {
+                return wxCmpNatural(e1.name, e2.name) < 0;
+            };
+
+            std::sort(dirs.begin(), dirs.end(), cmp);
+            std::sort(files.begin(), files.end(), cmp);
+
+            // Post the sorted entries in batches, directories first.
+            for ( Entries* all : { &dirs, &files } )
+            {
+                for ( size_t n = 0; n < all->size(); n += params.batchSize )
+                {
+                    const size_t end = std::min(n + params.batchSize,
+                                                all->size());
+                    Entries batch(std::make_move_iterator(all->begin() + n),
+                                  std::make_move_iterator(all->begin() + end));
+                    if ( !post(batch) )
+                        return;
+                }
+            }
+        }
+        else
+        {
+            // Post the last, incomplete, batches.
+            if ( !post(dirs) || !post(files) )
+                return;
+        }
+
+        wxCriticalSectionLocker lock(state.cs);
+        if ( state.cancelled )
+            return;
+
+        handler->CallAfter([stateptr, onDone]()
+        {
+            if ( stateptr->cancelled )
+                return;
+
+            stateptr->finished = true;
+            onDone();
+        });
+    }
+
+    std::shared_ptr<State> m_state;
+
+    wxDECLARE_NO_COPY_CLASS(wxAsyncDirLister);
+};
+
+#endif // wxUSE_THREADS
+
+#endif // _WX_GENERIC_PRIVATE_DIRLISTER_H_
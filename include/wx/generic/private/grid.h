@@ -28,18 +28,20 @@
 #include <iterator>
 #include <set>
 #include <map>
+#include <vector>
 
 // ----------------------------------------------------------------------------
 // array classes
 // ----------------------------------------------------------------------------
 
-WX_DEFINE_ARRAY_WITH_DECL_PTR(wxGridCellAttr *, wxArrayAttrs,
-                                 class WXDLLIMPEXP_ADV);
-
 WX_DECLARE_HASH_MAP_WITH_DECL(wxLongLong_t, wxGridCellAttr*,
                               wxIntegerHash, wxIntegerEqual,
                               wxGridCoordsToAttrMap, class WXDLLIMPEXP_CORE);
 
+WX_DECLARE_HASH_MAP_WITH_DECL(int, wxGridCellAttr*,
+                              wxIntegerHash, wxIntegerEqual,
+                              wxGridRowOrColToAttrMap, class WXDLLIMPEXP_CORE);
+
 // ----------------------------------------------------------------------------
 // enumerations
 // ----------------------------------------------------------------------------
@@ -477,16 +479,54 @@ public:
     void UpdateAttrRowsOrCols( size_t pos, int numRowsOrCols );
 
 private:
-    wxArrayInt m_rowsOrCols;
-    wxArrayAttrs m_attrs;
+    // Map from the row or column index to its attribute, which is always
+    // non-null and owned by us.
+    wxGridRowOrColToAttrMap m_attrs;
 };
 
-// NB: this is just a wrapper around 3 objects: one which stores cell
-//     attributes, and 2 others for row/col ones
+// this class stores attributes set for rectangular blocks of cells
+class WXDLLIMPEXP_ADV wxGridBlockAttrData
+{
+public:
+    wxGridBlockAttrData() = default;
+    ~wxGridBlockAttrData();
+
+    void SetAttr(wxGridCellAttr *attr, const wxGridBlockCoords& block);
+    wxGridCellAttr *GetAttr(int row, int col) const;
+    void UpdateAttrRows( size_t pos, int numRows );
+    void UpdateAttrCols( size_t pos, int numCols );
+
+private:
+    struct BlockAttr
+    {
+        wxGridBlockCoords block;
+        wxGridCellAttr* attr;
+    };
+
+    // The blocks never overlap, setting the attribute for a new block removes
+    // the part of any existing blocks intersecting it. The attributes are
+    // always non-null and we own a reference to each of them.
+    std::vector<BlockAttr> m_blocks;
+
+    wxDECLARE_NO_COPY_CLASS(wxGridBlockAttrData);
+};
+
+// NB: this is just a wrapper around 4 objects: two which store cell
+//     attributes, individually or for the blocks of cells, and 2 others for
+//     row/col ones
 class WXDLLIMPEXP_ADV wxGridCellAttrProviderData
 {
 public:
+    // Return the attribute set for the cell itself or, if none, for the block
+    // containing it.
+    wxGridCellAttr *GetCellAttr(int row, int col) const
+    {
+        wxGridCellAttr* const attr = m_cellAttrs.GetAttr(row, col);
+        return attr ? attr : m_blockAttrs.GetAttr(row, col);
+    }
+
     wxGridCellAttrData m_cellAttrs;
+    wxGridBlockAttrData m_blockAttrs;
     wxGridRowOrColAttrData m_rowAttrs,
                            m_colAttrs;
 };
@@ -587,8 +627,8 @@ public:
     // Get the height/width of the given row/column
     virtual int GetLineSize(const wxGrid *grid, int line) const = 0;
 
-    // Get wxGrid::m_rowBottoms/m_colRights array
-    virtual const wxArrayInt& GetLineEnds(const wxGrid *grid) const = 0;
+    // Get wxGrid::m_rowBottoms/m_colRights
+    virtual const wxGridLineEnds& GetLineEnds(const wxGrid *grid) const = 0;
 
     // Get default height row height or column width
     virtual int GetDefaultLineSize(const wxGrid *grid) const = 0;
@@ -747,7 +787,7 @@ public:
         { return grid->GetRowBottom(line); }
     virtual int GetLineSize(const wxGrid *grid, int line) const override
         { return grid->GetRowHeight(line); }
-    virtual const wxArrayInt& GetLineEnds(const wxGrid *grid) const override
+    virtual const wxGridLineEnds& GetLineEnds(const wxGrid *grid) const override
         { return grid->m_rowBottoms; }
     virtual int GetDefaultLineSize(const wxGrid *grid) const override
         { return grid->GetDefaultRowSize(); }
@@ -903,7 +943,7 @@ public:
         { return grid->GetColRight(line); }
     virtual int GetLineSize(const wxGrid *grid, int line) const override
         { return grid->GetColWidth(line); }
-    virtual const wxArrayInt& GetLineEnds(const wxGrid *grid) const override
+    virtual const wxGridLineEnds& GetLineEnds(const wxGrid *grid) const override
         { return grid->m_colRights; }
     virtual int GetDefaultLineSize(const wxGrid *grid) const override
         { return grid->GetDefaultColSize(); }
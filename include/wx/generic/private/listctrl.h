@@ -51,16 +51,16 @@ using ColWidthArray = std::vector<wxColWidthInfo>;
 class wxListItemData
 {
 public:
-    wxListItemData(wxListMainWindow *owner);
+    explicit wxListItemData(wxListMainWindow *owner);
     wxListItemData(const wxListItemData&) = delete;
-    wxListItemData(wxListItemData&&);
+    wxListItemData(wxListItemData&&) = default;
     wxListItemData& operator=(const wxListItemData&) = delete;
-    wxListItemData& operator=(wxListItemData&&);
-    ~wxListItemData();
+    wxListItemData& operator=(wxListItemData&&) = default;
+    ~wxListItemData() = default;
 
     void SetItem( const wxListItem &info );
-    void SetImage( int image ) { m_image = image; }
-    void SetData( wxUIntPtr data ) { m_data = data; }
+    void SetImage( int image );
+    void SetData( wxUIntPtr data );
     void SetPosition( int x, int y );
     void SetSize( int width, int height );
 
@@ -86,33 +86,59 @@ public:
     int GetWidth() const;
     int GetHeight() const;
 
-    int GetImage() const { return m_image; }
+    int GetImage() const { return m_extra ? m_extra->m_image : -1; }
     bool HasImage() const { return GetImage() != -1; }
 
     void GetItem( wxListItem &info ) const;
 
-    void SetAttr(wxItemAttr *attr) { m_attr = attr; }
-    wxItemAttr *GetAttr() const { return m_attr; }
+    // the attributes set by this function are not owned by the item, this is
+    // used by the virtual controls for the attributes returned by the program
+    void SetAttr(wxItemAttr *attr);
+    wxItemAttr *GetAttr() const { return m_extra ? m_extra->m_attr : nullptr; }
 
-public:
-    // the item image or -1
-    int m_image = -1;
+private:
+    // The fields which are not used by most items, e.g. the subitems in report
+    // mode typically only have the text, and are allocated only when needed to
+    // save memory in the controls with many items.
+    struct Extra
+    {
+        Extra() = default;
+        ~Extra()
+        {
+            if ( m_ownsAttr )
+                delete m_attr;
+        }
 
-    // user data associated with the item
-    wxUIntPtr m_data = 0;
+        // the item image or -1
+        int m_image = -1;
 
-    // the item coordinates are not used in report mode; instead this pointer is
-    // null and the owner window is used to retrieve the item position and size
-    wxRect *m_rect = nullptr;
+        // user data associated with the item
+        wxUIntPtr m_data = 0;
 
-    // the list ctrl we are in
-    wxListMainWindow *m_owner;
+        // custom attributes or nullptr
+        wxItemAttr *m_attr = nullptr;
 
-    // custom attributes or nullptr
-    wxItemAttr *m_attr = nullptr;
+        // true if m_attr was allocated by us and must be deleted
+        bool m_ownsAttr = false;
+
+        // the item coordinates are not used in report mode: instead this flag
+        // is false and the owner window is used to retrieve the item position
+        // and size
+        bool m_hasRect = false;
+        wxRect m_rect;
+
+        wxDECLARE_NO_COPY_CLASS(Extra);
+    };
+
+    // Allocate m_extra if necessary.
+    Extra& GetExtra();
+
+    // Return true if the item position is stored in it.
+    bool HasRect() const { return m_extra && m_extra->m_hasRect; }
 
-protected:
     wxString m_text;
+
+    std::unique_ptr<Extra> m_extra;
 };
 
 //-----------------------------------------------------------------------------
@@ -699,6 +725,7 @@ public:
     void InsertItem( wxListItem &item );
     long InsertColumn( long col, const wxListItem &item );
     int GetItemWidthWithImage(wxListItem * item);
+    int GetItemImageWidth(const wxListItem& item) const;
     void SortItems( wxListCtrlCompare fn, wxIntPtr data );
 
     size_t GetItemCount() const;
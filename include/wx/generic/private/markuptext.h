@@ -13,9 +13,12 @@
 #include "wx/defs.h"
 #include "wx/gdicmn.h"
 
+#include <memory>
+
 class WXDLLIMPEXP_FWD_CORE wxDC;
 
 class wxMarkupParserOutput;
+class wxMarkupParsedText;
 
 // ----------------------------------------------------------------------------
 // wxMarkupText: allows to measure and draw the text containing markup.
@@ -27,7 +30,16 @@ public:
     virtual ~wxMarkupTextBase() = default;
 
     // Update the markup string.
-    void SetMarkup(const wxString& markup) { m_markup = markup; }
+    void SetMarkup(const wxString& markup)
+    {
+        if ( markup != m_markup )
+        {
+            m_markup = markup;
+
+            m_parsed.reset();
+            m_parsedForMeasuring.reset();
+        }
+    }
 
     // Return the width and height required by the given string and optionally
     // the height of the visible part above the baseline (i.e. ascent minus
@@ -48,7 +60,18 @@ protected:
     // any mnenomics.
     virtual wxString GetMarkupForMeasuring() const = 0;
 
+    // Return the result of parsing m_markup or GetMarkupForMeasuring(). The
+    // parsing results are cached, both in this object and globally, so that
+    // the same markup is only parsed once even if it is used by different
+    // objects, e.g. by the same wxDataViewCtrl column in different rows.
+    const wxMarkupParsedText& GetParsedMarkup() const;
+    const wxMarkupParsedText& GetParsedMarkupForMeasuring() const;
+
     wxString m_markup;
+
+private:
+    mutable std::shared_ptr<const wxMarkupParsedText> m_parsed,
+                                                      m_parsedForMeasuring;
 };
 
 
@@ -83,7 +106,7 @@ public:
     // Update the markup string.
     //
     // The same rules for mnemonics as in the ctor apply to this string.
-    void SetMarkup(const wxString& markup) { m_markup = markup; }
+    void SetMarkup(const wxString& markup) { wxMarkupTextBase::SetMarkup(markup); }
 
     // Render the markup string into the given DC in the specified rectangle.
     //
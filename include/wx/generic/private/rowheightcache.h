@@ -10,7 +10,6 @@
 #ifndef _WX_PRIVATE_ROWHEIGHTCACHE_H_
 #define _WX_PRIVATE_ROWHEIGHTCACHE_H_
 
-#include <unordered_map>
 #include <vector>
 
 // struct describing a range of rows which contains rows <from> .. <to-1>
@@ -84,51 +83,44 @@ private:
     * the y-coordinate where a row starts (GetLineStart)
     * and vice versa (GetLineAt)
 
-    The layout of the cache is a hashmap where the keys are all existing row
-    heights in pixels. The values are RowRange objects that represent all rows
-    having the specified height.
+    The heights of the rows are stored in a vector, with -1 used for the rows
+    whose height is unknown, and, additionally, in a Fenwick (also known as
+    binary indexed) tree, in which the rows of unknown height are counted as
+    having 0 height. This allows to compute the sum of the heights of all the
+    rows before the given one and to find the row containing the given
+    coordinate in logarithmic time.
 
-    An example:
-    @code
-    {
-    22: RowRange([0..10], [15..17], [20..2000]),
-    42: RowRange([11..12], [18..18]),
-    62: RowRange([13..14], [19..19])
-    }
-    @endcode
+    The results of GetLineStart() and GetLineAt() are only valid if the
+    heights of all the preceding rows are known, so the cache also keeps the
+    number of rows at its beginning which don't contain any gaps.
 
     Examples
     ========
 
     GetLineStart
     ------------
-    To retrieve the y-coordinate of item 1000 it is necessary to look into
-    each key of the hashmap *m_heightToRowRange*. Get the row count of
-    indices lower than 1000 (RowRange::CountTo) and multiplies it which the
-    according height.
-
-    RowRange([0..10], [15..17], [20..2000]).CountTo(1000)
-    --> 0..10 are 11 items, 15..17 are 3 items and 20..1000 are 980 items (1000-20)
-    = 11 + 3 + 980 = 994 items
-
-    GetLineStart(1000) --> (22 * 994) + (42 * 3) + (62 * 3) = 22180
-
-    GetLineHeight
-    -------------
-    To retrieve the line height look into each key and check if row is
-    contained in RowRange (RowRange::Has)
+    If all rows up to 1000 are known, the start of this row is just the sum
+    of heights of the rows 0..999, which the tree computes by adding at most
+    log2(1000) ~ 10 partial sums.
 
     GetLineAt
     ---------
-    To retrieve the row that starts at a specific y-coordinate.
-    Look into each key and count all rows.
-    Use bisect algorithm in combination with GetLineStart() to
-    find the appropriate item
+    To retrieve the row that starts at a specific y-coordinate, descend the
+    tree from its root, looking for the last row whose start is not greater
+    than y, which also takes a logarithmic number of steps.
+
+    Remove
+    ------
+    Invalidating the given row and all rows after it simply truncates the
+    vectors: as each node of the tree only depends on the rows before it, the
+    remaining part of the tree stays valid, so this is done in constant time.
 */
 class WXDLLIMPEXP_CORE HeightCache
 {
 public:
+    HeightCache() = default;
     ~HeightCache();
+
     bool GetLineStart(unsigned int row, int& start);
     bool GetLineHeight(unsigned int row, int& height);
     bool GetLineAt(int y, unsigned int& row);
@@ -142,12 +134,39 @@ public:
     */
     void Remove(unsigned int row);
 
+    /**
+        Returns the number of rows from the beginning which are all cached.
+
+        GetLineStart() and GetLineInfo() only succeed for the rows less than
+        the returned value.
+    */
+    unsigned int GetValidCount() const { return m_validCount; }
+
     void Clear();
 
 private:
-    using HeightToRowRangesMap = std::unordered_map<int, RowRanges>;
+    // Append a row with the given height, which may be 0 for unknown rows.
+    void Append(int height);
+
+    // Add the given value to the height of the row in the tree.
+    void AddToTree(unsigned int row, int diff);
+
+    // Return the sum of the heights of all rows before the given one.
+    int GetSumBefore(unsigned int row) const;
+
+    // The heights of all rows until the last one which was cached, with -1
+    // for the rows which are not cached.
+    std::vector<int> m_heights;
+
+    // The Fenwick tree built on m_heights, its element i contains the
+    // sum of heights of rows in [i + 1 - lowbit(i + 1), i] range, where
+    // lowbit() is the value of the lowest bit set.
+    std::vector<int> m_tree;
+
+    // The number of rows at the beginning of m_heights without any gaps.
+    unsigned int m_validCount = 0;
 
-    HeightToRowRangesMap m_heightToRowRange;
+    wxDECLARE_NO_COPY_CLASS(HeightCache);
 };
 
 
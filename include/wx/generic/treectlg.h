@@ -316,6 +316,17 @@ protected:
                                        wxTreeItemData *data = nullptr) override;
     virtual wxTreeItemId DoTreeHitTest(const wxPoint& point, int& flags) const override;
 
+    // override these functions to let the control create the children of the
+    // items when they are expanded and delete them when they are collapsed,
+    // instead of adding all of them in advance
+    virtual int OnGetItemChildrenCount(const wxTreeItemId& item) const;
+    virtual wxString OnGetItemText(const wxTreeItemId& parent, size_t index) const;
+    virtual int OnGetItemImage(const wxTreeItemId& parent, size_t index) const;
+    virtual wxTreeItemData *OnGetItemData(const wxTreeItemId& parent, size_t index) const;
+
+    // create the virtual children of the item, if any
+    void CreateVirtualChildren(wxGenericTreeItem *item);
+
     // called by wxTextTreeCtrl when it marks itself for deletion
     void ResetTextControl();
 
@@ -327,11 +338,20 @@ protected:
     void CalculateLineHeight();
     int  GetLineHeight(wxGenericTreeItem *item) const;
     void PaintLevel( wxGenericTreeItem *item, wxDC& dc, int level, int &y );
+    void PaintChildren( wxGenericTreeItem *item, wxDC& dc, int level, int &y );
     void PaintItem( wxGenericTreeItem *item, wxDC& dc);
 
     void CalculateLevel( wxGenericTreeItem *item, wxDC &dc, int level, int &y );
     void CalculatePositions();
 
+    // recalculate the positions after expanding or collapsing the given item,
+    // this only lays out its subtree and shifts all the items below it
+    void CalculateSubtreePositions( wxGenericTreeItem *item );
+
+    // return the bottom of the area occupied by the item and all its visible
+    // children, the positions must be up to date when calling this
+    int GetSubtreeBottom( wxGenericTreeItem *item ) const;
+
     void RefreshSubtree( wxGenericTreeItem *item );
     void RefreshLine( wxGenericTreeItem *item );
 
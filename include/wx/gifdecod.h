@@ -52,7 +52,8 @@ public:
     wxGIFDecoder();
     ~wxGIFDecoder();
 
-    // get data of current frame
+    // get data of current frame, note that the frames are only decoded when
+    // they're used for the first time
     unsigned char* GetData(unsigned int frame) const;
     unsigned char* GetPalette(unsigned int frame) const;
     unsigned int GetNcolours(unsigned int frame) const;
@@ -91,20 +92,15 @@ protected:
         // modifies current stream position (see wxAnimationDecoder::CanRead)
 
 private:
-    int getcode(wxInputStream& stream, int bits, int abfin);
-    wxGIFErrorCode dgif(wxInputStream& stream,
-                        GIFImage *img, int interl, int bits);
+    // decode the frame data into the provided buffer, big enough for it
+    static wxGIFErrorCode DecodeFrame(const GIFImage& img, unsigned char *p);
 
 
     // array of all frames
     wxArrayPtrVoid m_frames;
 
-    // decoder state vars
-    int           m_restbits;       // remaining valid bits
-    unsigned int  m_restbyte;       // remaining bytes in this block
-    unsigned int  m_lastbyte;       // last byte read
-    unsigned char m_buffer[256];    // buffer for reading
-    unsigned char *m_bufp;          // pointer to next byte in buffer
+    // global palette, shared by all the frames without their own one
+    unsigned char m_globalPalette[768];
 
     wxDECLARE_NO_COPY_CLASS(wxGIFDecoder);
 };
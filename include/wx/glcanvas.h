@@ -18,6 +18,9 @@
 #include "wx/palette.h"
 #include "wx/window.h"
 
+#include <vector>
+
+class WXDLLIMPEXP_FWD_CORE wxImage;
 class WXDLLIMPEXP_FWD_GL wxGLCanvas;
 class WXDLLIMPEXP_FWD_GL wxGLContext;
 
@@ -226,6 +229,27 @@ public:
     // flush the back buffer (if we have it)
     virtual bool SwapBuffers() = 0;
 
+    // flush the back buffer, indicating that only the given part of it was
+    // changed since the last swap: this allows the compositor to update only
+    // this region, if supported, otherwise this is the same as SwapBuffers()
+    virtual bool SwapBuffersWithDamage(const wxRegion& WXUNUSED(damage))
+        { return SwapBuffers(); }
+
+    // set the minimum number of vertical retraces between buffer swaps: 0
+    // disables vsync, 1 enables it and -1 enables adaptive vsync, return
+    // false if the given interval is not supported
+    virtual bool SetSwapInterval(int WXUNUSED(interval)) { return false; }
+
+    // return the age of the current back buffer, i.e. the number of frames
+    // since its contents were rendered, 0 if its contents are undefined or -1
+    // if this information is not available
+    virtual int GetBufferAge() { return -1; }
+
+    // indicate that only the given region of the back buffer is going to be
+    // modified before the next swap, return false if it's not supported
+    virtual bool SetDamageRegion(const wxRegion& WXUNUSED(region))
+        { return false; }
+
 
     // accessors
     // ---------
@@ -245,6 +269,10 @@ public:
     // colour not found
     bool SetColour(const wxString& colour);
 
+    // return the address of the given OpenGL extension function or nullptr
+    // if it's not available, a context must be current when calling it
+    static void* GetGLProcAddress(const char *name);
+
     // return true if the extension with given name is supported
     //
     // notice that while this function is implemented for all of GLX, WGL and
@@ -268,6 +296,12 @@ protected:
     // by glXQueryExtensionsString() or glGetString(GL_EXTENSIONS)
     static bool IsExtensionInList(const char *list, const char *extension);
 
+    // Convert the region in window coordinates to the array of rectangles in
+    // pixels with the origin at the bottom left corner, as used by OpenGL:
+    // each rectangle is represented by 4 consecutive elements (x, y, width,
+    // height).
+    std::vector<int> GetGLRectsFromRegion(const wxRegion& region) const;
+
     // For the case of "int* attribList" at ctor is != 0
     wxGLContextAttrs m_GLCTXAttrs;
 
@@ -359,6 +393,35 @@ public:
     static void glEnd();
 };
 
+// ----------------------------------------------------------------------------
+// wxGLImageUploader: uploads wxImage data to OpenGL textures
+// ----------------------------------------------------------------------------
+
+struct wxGLImageUploaderImpl;
+
+class WXDLLIMPEXP_GL wxGLImageUploader
+{
+public:
+    // The context in which the uploader is going to be used must be current
+    // when creating and destroying it.
+    wxGLImageUploader();
+    ~wxGLImageUploader();
+
+    // Upload the image to the texture currently bound to GL_TEXTURE_2D target
+    // as its level 0, using GL_RGB or GL_RGBA format depending on whether the
+    // image has alpha.
+    bool Upload(const wxImage& image);
+
+    // Return true if pixel buffer objects are used for uploading the data,
+    // which allows the copy to the texture to happen asynchronously.
+    bool IsUsingPBO() const;
+
+private:
+    wxGLImageUploaderImpl* const m_impl;
+
+    wxDECLARE_NO_COPY_CLASS(wxGLImageUploader);
+};
+
 #endif // wxUSE_GLCANVAS
 
 #endif // _WX_GLCANVAS_H_BASE_
@@ -78,6 +78,13 @@ enum wxGradientType
     wxGRADIENT_RADIAL
 };
 
+// shapes drawn by wxGraphicsContext::DrawMarkers()
+enum wxMarkerShape
+{
+    wxMARKER_SQUARE,
+    wxMARKER_CIRCLE
+};
+
 
 class WXDLLIMPEXP_FWD_CORE wxDC;
 class WXDLLIMPEXP_FWD_CORE wxWindowDC;
@@ -548,6 +555,9 @@ public:
     virtual bool Contains( wxDouble x, wxDouble y, wxPolygonFillMode fillStyle = wxODDEVEN_RULE)const;
     bool Contains( const wxPoint2DDouble& c, wxPolygonFillMode fillStyle = wxODDEVEN_RULE)const;
 
+    // converts the path to the native form cached for drawing it repeatedly
+    virtual void Compile();
+
     const wxGraphicsPathData* GetPathData() const
     { return (const wxGraphicsPathData*) GetRefData(); }
     wxGraphicsPathData* GetPathData()
@@ -887,6 +897,29 @@ public:
     // draws a rounded rectangle
     virtual void DrawRoundedRectangle( wxDouble x, wxDouble y, wxDouble w, wxDouble h, wxDouble radius);
 
+    //
+    // batch drawing methods: these functions draw many items at once, which
+    // is much faster than drawing them one by one, but, unlike the latter,
+    // may draw the overlapping items as their union
+    //
+
+    // draws the rectangles
+    virtual void DrawRectangles( size_t n, const wxRect2DDouble *rects);
+
+    // draws the ellipses inscribed in the given rectangles
+    virtual void DrawEllipses( size_t n, const wxRect2DDouble *rects);
+
+    // draws markers of the given size centered at the given points, filling
+    // them with the corresponding colours, if specified, or the current brush
+    virtual void DrawMarkers( size_t n, const wxPoint2DDouble *centres,
+                              wxDouble size,
+                              wxMarkerShape shape = wxMARKER_SQUARE,
+                              const wxColour *colours = nullptr);
+
+    // strokes n disconnected line segments, each one defined by two
+    // consecutive points in the given array of 2*n points
+    virtual void StrokeLineSegments( size_t n, const wxPoint2DDouble *points);
+
      // wrappers using wxPoint2DDouble TODO
 
     // helper to determine if a 0.5 offset should be applied for the drawing operation
@@ -0,0 +1,136 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        wx/gtk/private/layoutcache.h
+// Purpose:     wxPangoLayoutCache class declaration
+// Author:      wxWidgets team
+// Created:     2026-10-14
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef _WX_GTK_PRIVATE_LAYOUTCACHE_H_
+#define _WX_GTK_PRIVATE_LAYOUTCACHE_H_
+
+#include <pango/pango.h>
+
+#include <list>
+#include <string>
+#include <unordered_map>
+
+typedef struct _cairo cairo_t;
+
+class WXDLLIMPEXP_FWD_CORE wxFont;
+
+// ----------------------------------------------------------------------------
+// wxPangoLayoutCache: cache of the layouts of the recently used strings
+// ----------------------------------------------------------------------------
+
+// Creating a Pango layout and laying out the text is expensive, so this class
+// keeps the layouts of the recently measured or drawn strings, keyed by their
+// text, font and the Pango context they use, and reuses them when the same
+// string is used again. The least recently used layouts are removed from the
+// cache when it becomes full.
+//
+// The layouts returned by this class belong to it and remain valid only until
+// the next call to any of its methods.
+//
+// This class is not thread-safe and can only be used from the main thread,
+// which is ensured by Get() returning null when called from the other ones.
+class WXDLLIMPEXP_CORE wxPangoLayoutCache
+{
+public:
+    // Return the global cache object or null if it can't be used, in which
+    // case the caller should create the layout on its own.
+    static wxPangoLayoutCache* Get();
+
+    // Return the layout of the given UTF-8 text using the given Pango
+    // context, as done by wxTextMeasure for the windows.
+    PangoLayout* GetForContext(PangoContext* context,
+                               const wxFont& font,
+                               const char* text, size_t len);
+
+    // Return the layout of the given UTF-8 text created for drawing on the
+    // given Cairo context, using the font attributes (i.e. underline and
+    // strikethrough) too, as done by wxCairoContext. Note that the layouts
+    // returned by this function are shared by all Cairo contexts, and are
+    // updated to use the given one when they are returned.
+    PangoLayout* GetForCairo(cairo_t* cr,
+                             const wxFont& font,
+                             const char* text, size_t len);
+
+
+    // Change the maximal number of layouts in the cache, setting it to 0
+    // disables the cache.
+    void SetMaxCount(size_t maxCount);
+    size_t GetMaxCount() const { return m_maxCount; }
+
+    size_t GetCount() const { return m_entries.size(); }
+
+    // Remove all layouts from the cache.
+    void Clear();
+
+
+    // Statistics of the cache usage, allowing to check its effectiveness.
+    size_t GetHits() const { return m_hits; }
+    size_t GetMisses() const { return m_misses; }
+    void ResetStats() { m_hits = m_misses = 0; }
+
+
+    wxPangoLayoutCache() = default;
+    ~wxPangoLayoutCache() { Clear(); }
+
+private:
+    // Key of the cached layout. Note that the font description is not owned
+    // by the key, but by the corresponding Entry.
+    struct Key
+    {
+        // Null for the layouts used with Cairo.
+        PangoContext* context;
+        const PangoFontDescription* desc;
+        bool underlined;
+        bool strikethrough;
+        std::string text;
+
+        bool operator==(const Key& other) const;
+    };
+
+    struct KeyHash
+    {
+        size_t operator()(const Key& key) const;
+    };
+
+    struct Entry
+    {
+        Key key;
+        PangoLayout* layout;
+    };
+
+    using EntryList = std::list<Entry>;
+
+    // Return the existing layout corresponding to this key, if any, making
+    // it the most recently used one.
+    PangoLayout* Find(const Key& key);
+
+    // Add the new layout to the cache, possibly removing the least recently
+    // used one from it, taking ownership of the layout reference.
+    void Add(const Key& key, PangoLayout* layout);
+
+    // Remove the least recently used entry.
+    void RemoveLast();
+
+
+    // Entries in the most recently used first order.
+    EntryList m_entries;
+    std::unordered_map<Key, EntryList::iterator, KeyHash> m_index;
+
+    size_t m_maxCount = 256;
+
+    // The last layout created when the cache is disabled.
+    PangoLayout* m_uncached = nullptr;
+
+    size_t m_hits = 0;
+    size_t m_misses = 0;
+
+    wxDECLARE_NO_COPY_CLASS(wxPangoLayoutCache);
+};
+
+#endif // _WX_GTK_PRIVATE_LAYOUTCACHE_H_
@@ -15,6 +15,7 @@
 // ----------------------------------------------------------------------------
 
 class WXDLLIMPEXP_FWD_CORE wxWindowDCImpl;
+class WXDLLIMPEXP_FWD_CORE wxPangoLayoutCache;
 
 class wxTextMeasure : public wxTextMeasureBase
 {
@@ -48,6 +49,9 @@ protected:
                                          wxArrayInt& widths,
                                          double scaleX) override;
 
+    // Return the layout of the given text, either m_layout or a cached one.
+    PangoLayout* GetLayout(const wxString& text);
+
     // This class is only used for DC text measuring with GTK+ 2 as GTK+ 3 uses
     // Cairo and not Pango for this. However it's still used even with GTK+ 3
     // for window text measuring, so the context and the layout are still
@@ -58,6 +62,9 @@ protected:
     PangoContext *m_context;
     PangoLayout *m_layout;
 
+    // Used instead of m_layout for measuring the window text if possible.
+    wxPangoLayoutCache *m_layoutCache;
+
     wxDECLARE_NO_COPY_CLASS(wxTextMeasure);
 };
 
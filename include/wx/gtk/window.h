@@ -362,6 +362,9 @@ public:
     bool                 m_mouseButtonDown:1;
     bool                 m_showOnIdle:1;        // postpone showing the window until idle
     bool m_needCursorReset:1;
+    bool m_styleUpdateDeferred:1;   // don't apply style changes immediately
+    bool m_styleUpdatePending:1;    // style must be applied when undeferred
+    bool m_styleUpdateForced:1;     // and it must be done even if it's default
 
     wxRegion             m_nativeUpdateRegion;  // not transformed for RTL
 
@@ -394,6 +397,9 @@ protected:
     virtual void DoFreeze() override;
     virtual void DoThaw() override;
 
+    virtual void DoRequestFrame() override;
+    virtual void DoCancelFrameRequest() override;
+
     void GTKConnectFreezeWidget(GtkWidget* widget);
     void GTKFreezeWidget(GtkWidget *w);
     void GTKThawWidget(GtkWidget *w);
@@ -483,6 +489,8 @@ private:
     cairo_t* m_paintContext;
     // style provider for "background-image"
     GtkStyleProvider* m_styleProvider;
+    // tick callback used for the frame requests or 0
+    guint m_frameTickId;
 
 public:
     cairo_t* GTKPaintContext() const
@@ -491,6 +499,9 @@ public:
     }
     void GTKSizeRevalidate();
     void GTKSendSizeEventIfNeeded();
+
+    // Called from the frame clock tick callback.
+    void GTKHandleFrameTick(gint64 frameTime);
 #endif
 
     wxDECLARE_DYNAMIC_CLASS(wxWindowGTK);
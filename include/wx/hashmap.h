@@ -124,11 +124,16 @@ public: \
     struct Node:public _wxHashTable_NodeBase \
     { \
     public: \
-        Node( const value_type& value ) \
-            : m_value( value ) {} \
+        Node( const value_type& value, size_t hash ) \
+            : m_value( value ), m_hash( hash ) {} \
         Node* next() { return static_cast<Node*>(m_next); } \
  \
         value_type m_value; \
+ \
+        /* the hash of the key is stored to avoid recomputing it when */ \
+        /* iterating over or resizing the table and to compare the keys */ \
+        /* only if their hashes are equal */ \
+        size_t m_hash; \
     }; \
  \
 protected: \
@@ -283,20 +288,21 @@ public: \
 protected: \
     static size_type GetBucketForNode( Self* ht, Node* node ) \
     { \
-        return ht->m_hasher( ht->m_getKey( node->m_value ) ) \
-            % ht->m_tableBuckets; \
+        return node->m_hash % ht->m_tableBuckets; \
     } \
     static Node* CopyNode( Node* node ) { return new Node( *node ); } \
  \
     Node* GetOrCreateNode( const value_type& value, bool& created ) \
     { \
         const const_key_type& key = m_getKey( value ); \
-        size_t bucket = m_hasher( key ) % m_tableBuckets; \
+        const size_t hash = m_hasher( key ); \
+        size_t bucket = hash % m_tableBuckets; \
         Node* node = static_cast<Node*>(m_table[bucket]); \
  \
         while( node ) \
         { \
-            if( m_equals( m_getKey( node->m_value ), key ) ) \
+            if( node->m_hash == hash && \
+                    m_equals( m_getKey( node->m_value ), key ) ) \
             { \
                 created = false; \
                 return node; \
@@ -304,11 +310,11 @@ protected: \
             node = node->next(); \
         } \
         created = true; \
-        return CreateNode( value, bucket); \
+        return CreateNode( value, hash, bucket ); \
     }\
-    Node * CreateNode( const value_type& value, size_t bucket ) \
+    Node * CreateNode( const value_type& value, size_t hash, size_t bucket ) \
     {\
-        Node* node = new Node( value ); \
+        Node* node = new Node( value, hash ); \
         node->m_next = m_table[bucket]; \
         m_table[bucket] = node; \
  \
@@ -321,18 +327,21 @@ protected: \
     } \
     void CreateNode( const value_type& value ) \
     {\
-        CreateNode(value, m_hasher( m_getKey(value) ) % m_tableBuckets ); \
+        const size_t hash = m_hasher( m_getKey(value) ); \
+        CreateNode( value, hash, hash % m_tableBuckets ); \
     }\
  \
     /* returns nullptr if not found */ \
     _wxHashTable_NodeBase** GetNodePtr(const const_key_type& key) const \
     { \
-        size_t bucket = m_hasher( key ) % m_tableBuckets; \
+        const size_t hash = m_hasher( key ); \
+        size_t bucket = hash % m_tableBuckets; \
         _wxHashTable_NodeBase** node = &m_table[bucket]; \
  \
         while( *node ) \
         { \
-            if (m_equals(m_getKey(static_cast<Node*>(*node)->m_value), key)) \
+            const Node* const n = static_cast<Node*>(*node); \
+            if ( n->m_hash == hash && m_equals(m_getKey(n->m_value), key) ) \
                 return node; \
             node = &(*node)->m_next; \
         } \
@@ -344,12 +353,14 @@ protected: \
     /* expressing it in terms of GetNodePtr is 5-8% slower :-( */ \
     Node* GetNode( const const_key_type& key ) const \
     { \
-        size_t bucket = m_hasher( key ) % m_tableBuckets; \
+        const size_t hash = m_hasher( key ); \
+        size_t bucket = hash % m_tableBuckets; \
         Node* node = static_cast<Node*>(m_table[bucket]); \
  \
         while( node ) \
         { \
-            if( m_equals( m_getKey( node->m_value ), key ) ) \
+            if( node->m_hash == hash && \
+                    m_equals( m_getKey( node->m_value ), key ) ) \
                 return node; \
             node = node->next(); \
         } \
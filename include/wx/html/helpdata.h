@@ -21,6 +21,8 @@
 #include "wx/dynarray.h"
 #include "wx/font.h"
 
+#include <unordered_map>
+
 class WXDLLIMPEXP_FWD_HTML wxHtmlHelpData;
 
 //--------------------------------------------------------------------------------
@@ -116,6 +118,13 @@ public:
     // Returns true if the stream contains keyword, fALSE otherwise
     virtual bool Scan(const wxFSFile& file);
 
+    // Same as Scan() but for the text previously returned by GetText().
+    bool ScanText(const wxString& text) const;
+
+    // Returns the text of the HTML file without tags and with all sequences
+    // of whitespace collapsed into a single space.
+    static wxString GetText(const wxFSFile& file);
+
 private:
     wxString m_Keyword;
     bool m_CaseSensitive;
@@ -214,6 +223,13 @@ protected:
     // Writes binary book
     bool SaveCachedBook(wxHtmlBookRecord *book, wxOutputStream *f);
 
+    // Returns the text of the page with the given full path, as returned by
+    // wxHtmlSearchEngine::GetText(), reading it only once.
+    bool GetPageText(const wxString& fullpath, wxString& text);
+
+    // text of the pages already read by GetPageText(), indexed by full path
+    std::unordered_map<wxString, wxString> m_pagesText;
+
     wxDECLARE_NO_COPY_CLASS(wxHtmlHelpData);
 };
 
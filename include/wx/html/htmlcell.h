@@ -24,6 +24,7 @@ class WXDLLIMPEXP_FWD_HTML wxHtmlWindowInterface;
 class WXDLLIMPEXP_FWD_HTML wxHtmlLinkInfo;
 class WXDLLIMPEXP_FWD_HTML wxHtmlCell;
 class WXDLLIMPEXP_FWD_HTML wxHtmlContainerCell;
+class wxHtmlContainerDrawIndex;
 
 
 // wxHtmlSelection is data holder with information about text selection.
@@ -423,6 +424,8 @@ class WXDLLIMPEXP_HTML wxHtmlWordCell : public wxHtmlCell
 {
 public:
     wxHtmlWordCell(const wxString& word, const wxDC& dc);
+    wxHtmlWordCell(const wxString& word,
+                   wxCoord width, wxCoord height, wxCoord descent);
     void Draw(wxDC& dc, int x, int y, int view_y1, int view_y2,
               wxHtmlRenderingInfo& info) override;
     virtual wxCursor GetMouseCursor(wxHtmlWindowInterface *window) const override;
@@ -562,12 +565,21 @@ public:
 
     virtual wxString Dump(int indent = 0) const override;
 
+    // Must be called when the positions or the contents of the children of
+    // this container change, invalidates the index used by Draw() for this
+    // container and all its parents. For internal use only.
+    void InvalidateDrawIndex();
+
 protected:
     void UpdateRenderingStatePre(wxHtmlRenderingInfo& info,
                                  wxHtmlCell *cell) const;
     void UpdateRenderingStatePost(wxHtmlRenderingInfo& info,
                                   wxHtmlCell *cell) const;
 
+    // Returns the index of the children positions and their effects on the
+    // rendering state, creating it if necessary.
+    const wxHtmlContainerDrawIndex& GetDrawIndex();
+
 protected:
     int m_IndentLeft, m_IndentRight, m_IndentTop, m_IndentBottom;
             // indentation of subcells. There is always m_Indent pixels
@@ -590,9 +602,13 @@ protected:
             // borders color of this container
     int m_LastLayout;
             // if != -1 then call to Layout may be no-op
-            // if previous call to Layout has same argument
+            // if previous call to Layout resulted in the same width
     int m_MaxTotalWidth;
             // Maximum possible length if ignoring line wrap
+    wxHtmlContainerDrawIndex *m_drawIndex;
+            // used by Draw() to skip the invisible children, may be null
+
+    friend class wxHtmlContainerDrawIndex;
 
 
     wxDECLARE_ABSTRACT_CLASS(wxHtmlContainerCell);
@@ -617,6 +633,9 @@ public:
 
     virtual wxString GetDescription() const override;
 
+    // returns combination of wxHTML_CLR_XXX flags
+    unsigned GetFlags() const { return m_Flags; }
+
 protected:
     wxColour m_Colour;
     unsigned m_Flags;
@@ -267,6 +267,10 @@ public:
     // Append to current page
     bool AppendToPage(const wxString& source);
 
+    // Append a self-contained HTML fragment to the current page without
+    // parsing and laying out the existing page contents again
+    bool AppendFragmentToPage(const wxString& fragment);
+
     // Load HTML page from given location. Location can be either
     // a) /usr/wxGTK2/docs/html/wx.htm
     // b) http://www.somewhere.uk/document.htm
@@ -467,6 +471,13 @@ public:
     // implementation of SetPage()
     bool DoSetPage(const wxString& source);
 
+    // pass HTML source through the registered processors
+    wxString ProcessSource(const wxString& source) const;
+
+    // return the source of the current page, including the fragments
+    // appended to it
+    wxString GetPageSource() const;
+
 protected:
     // This is pointer to the first cell in parsed data.  (Note: the first cell
     // is usually top one = all other cells are sub-cells of this one)
@@ -481,6 +492,9 @@ protected:
     wxString m_OpenedAnchor;
     // contains title of actually opened page or empty string if no <TITLE> tag
     wxString m_OpenedPageTitle;
+    // source of the fragments appended to the page by AppendFragmentToPage(),
+    // the parser source only contains the page itself
+    wxString m_appendedSource;
     // class for opening files (file system)
     wxFileSystem* m_FS;
 
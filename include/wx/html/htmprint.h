@@ -193,11 +193,20 @@ private:
             // substitute @PAGENUM@ and @PAGESCNT@ by real values
     void CountPages();
             // fills m_PageBreaks, which indirectly gives the number of pages
+    void InvalidatePageBreaks() { m_PageBreaksSize = wxDefaultSize; }
+            // forces the document layout and page breaks to be recomputed
 
 
 private:
     wxVector<int> m_PageBreaks;
 
+    // The parameters the document was laid out and paginated with by the last
+    // call to OnPreparePrinting(), allowing to reuse the existing page breaks
+    // if it is called again with the same page setup. The size is set to
+    // wxDefaultSize if the page breaks must be recomputed.
+    wxSize m_PageBreaksSize;
+    double m_PageBreaksPixelScale, m_PageBreaksFontScale;
+
     wxString m_Document, m_BasePath;
     bool m_BasePathIsDir;
     wxString m_Headers[2], m_Footers[2];
@@ -18,6 +18,8 @@
 #include "wx/html/htmlcell.h"
 #include "wx/encconv.h"
 
+#include <unordered_map>
+
 class WXDLLIMPEXP_FWD_HTML wxHtmlWindow;
 class WXDLLIMPEXP_FWD_HTML wxHtmlWindowInterface;
 class WXDLLIMPEXP_FWD_HTML wxHtmlWinParser;
@@ -161,8 +163,8 @@ protected:
 private:
     void FlushWordBuf(wxChar *temp, int& len);
     void AddWord(wxHtmlWordCell *word);
-    void AddWord(const wxString& word)
-        { AddWord(new wxHtmlWordCell(word, *(GetDC()))); }
+    void AddWord(const wxString& word);
+    void ClearWordExtents() { m_wordExtents.clear(); }
     void AddPreBlock(const wxString& text);
 
     bool m_tmpLastWasSpace;
@@ -213,6 +215,18 @@ private:
     wxString m_FontFaceFixed, m_FontFaceNormal;
             // html font sizes and faces of fixed and proportional fonts
 
+    const wxFont* m_currentFont;
+            // font selected into m_DC by the last CreateCurrentFont() call
+
+    struct WordExtent
+    {
+        wxCoord width, height, descent;
+    };
+    typedef std::unordered_map<wxString, WordExtent> WordExtentsMap;
+    std::unordered_map<const wxFont*, WordExtentsMap> m_wordExtents;
+            // extents of the words already measured using the fonts from
+            // m_FontsTable, as the same words are usually repeated many times
+
     // current whitespace handling mode
     WhitespaceMode m_whitespaceMode;
 
@@ -274,7 +288,9 @@ class WXDLLIMPEXP_HTML wxHtmlTagsModule : public wxModule
     wxDECLARE_DYNAMIC_CLASS(wxHtmlTagsModule);
 
 public:
-    wxHtmlTagsModule() : wxModule() {}
+    // All tags modules are lazy and only initialized when the first
+    // wxHtmlWinParser is created.
+    wxHtmlTagsModule() : wxModule() { SetLazy(); }
 
     virtual bool OnInit() override;
     virtual void OnExit() override;
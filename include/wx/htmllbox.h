@@ -83,6 +83,15 @@ public:
     const wxFileSystem& GetFileSystem() const { return m_filesystem; }
 #endif // wxUSE_FILESYSTEM
 
+    // set or get the max number of items whose parsed representation is
+    // cached, the default is 50
+    void SetCacheSize(size_t numItems);
+    size_t GetCacheSize() const;
+
+    // parse the items in the given range (inclusive) in advance, during idle
+    // time, e.g. to make scrolling to them faster later
+    void PrecacheItems(size_t from, size_t to);
+
     virtual void OnInternalIdle() override;
 
 protected:
@@ -129,8 +138,8 @@ protected:
     // common part of all ctors
     void Init();
 
-    // ensure that the given item is cached
-    void CacheItem(size_t n) const;
+    // ensure that the given item is cached and return its cell
+    wxHtmlCell* CacheItem(size_t n) const;
 
 private:
     // wxHtmlWindowInterface methods:
@@ -154,6 +163,12 @@ private:
     // Create the cell for the given item, caller is responsible for freeing it.
     wxHtmlCell* CreateCellForItem(size_t n) const;
 
+    // return the width for which the cells are laid out
+    int GetCellWidth() const;
+
+    // parse some of the items remaining to be parsed by PrecacheItems()
+    void DoPrecacheSomeItems();
+
     // return physical coordinates of root wxHtmlCell of n-th item
     wxPoint GetRootCellCoords(size_t n) const;
 
@@ -172,6 +187,11 @@ private:
     // this class caches the pre-parsed HTML to speed up display
     wxHtmlListBoxCache *m_cache;
 
+    // the range of items remaining to be parsed by PrecacheItems(), the end
+    // is exclusive
+    size_t m_precacheNext,
+           m_precacheEnd;
+
     // HTML parser we use
     wxHtmlWinParser *m_htmlParser;
 
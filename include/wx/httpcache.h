@@ -0,0 +1,95 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        wx/httpcache.h
+// Purpose:     wxHTTPCache class for caching HTTP responses
+// Author:      wxWidgets team
+// Created:     2026-10-14
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef _WX_HTTPCACHE_H_
+#define _WX_HTTPCACHE_H_
+
+#include "wx/defs.h"
+
+#if wxUSE_FILE
+
+#include "wx/buffer.h"
+#include "wx/string.h"
+
+#include <functional>
+#include <memory>
+
+class wxHTTPCacheImpl;
+
+// Cached response data returned by wxHTTPCache::Find().
+struct wxHTTPCacheEntry
+{
+    wxMemoryBuffer data;
+    wxString contentType;
+
+    // Validators to use for the conditional request, may be empty.
+    wxString eTag;
+    wxString lastModified;
+};
+
+// Private cache of successful responses to GET requests, keyed by their URL,
+// storing them in memory and, optionally, on disk.
+class WXDLLIMPEXP_NET wxHTTPCache
+{
+public:
+    enum Status
+    {
+        Status_Miss,    // not in the cache at all
+        Status_Fresh,   // can be used without contacting the server
+        Status_Stale    // must be revalidated before using it
+    };
+
+    // Function returning the value of the given response header or empty
+    // string if it's not present.
+    using HeaderGetter = std::function<wxString (const wxString& name)>;
+
+    // If the directory is empty, the responses are only cached in memory.
+    explicit wxHTTPCache(const wxString& dir = wxString(),
+                         size_t maxSize = 64*1024*1024);
+    ~wxHTTPCache();
+
+    const wxString& GetDirectory() const;
+
+    // Maximal total size of the cached data.
+    void SetMaxSize(size_t maxSize);
+    size_t GetMaxSize() const;
+
+    // Maximal size of the data kept in memory, only used with a directory.
+    void SetMaxMemorySize(size_t maxSize);
+    size_t GetMaxMemorySize() const;
+
+    size_t GetSize() const;
+    size_t GetCount() const;
+
+    // Find the response for the given URL in the cache.
+    Status Find(const wxString& url, wxHTTPCacheEntry* entry = nullptr);
+
+    // Store the successful (2xx) response if it can be cached.
+    bool Store(const wxString& url,
+               const HeaderGetter& getHeader,
+               const void* data, size_t size);
+
+    // Update the entry after receiving 304 response to the conditional
+    // request and return its data.
+    bool Revalidate(const wxString& url,
+                    const HeaderGetter& getHeader,
+                    wxHTTPCacheEntry* entry = nullptr);
+
+    void Remove(const wxString& url);
+    void Clear();
+
+private:
+    std::unique_ptr<wxHTTPCacheImpl> m_impl;
+
+    wxDECLARE_NO_COPY_CLASS(wxHTTPCache);
+};
+
+#endif // wxUSE_FILE
+
+#endif // _WX_HTTPCACHE_H_
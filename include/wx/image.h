@@ -20,6 +20,9 @@
 #include "wx/arrstr.h"
 #include "wx/variant.h"
 
+#include <functional>
+#include <vector>
+
 #if wxUSE_STREAMS
 #  include "wx/stream.h"
 #endif
@@ -99,6 +102,12 @@ class WXDLLIMPEXP_FWD_CORE wxImageHandler;
 class WXDLLIMPEXP_FWD_CORE wxImage;
 class WXDLLIMPEXP_FWD_CORE wxPalette;
 
+// Function called by the image handlers supporting incremental decoding after
+// decoding the rows [y, y + height) of the image being loaded, see
+// wxImage::SetLoadProgressFunction(). Loading is cancelled if it returns false.
+using wxImageLoadProgressFunction =
+    std::function<bool (const wxImage& image, int y, int height)>;
+
 //-----------------------------------------------------------------------------
 // wxImageHandler
 //-----------------------------------------------------------------------------
@@ -120,6 +129,13 @@ public:
                            bool WXUNUSED(verbose)=true )
         { return false; }
 
+    // Load the image calling the progress function after decoding each band
+    // of its rows. The default implementation simply calls LoadFile() and
+    // then calls the function once for the whole image.
+    virtual bool LoadFileIncrementally( wxImage *image, wxInputStream& stream,
+                                        const wxImageLoadProgressFunction& progress,
+                                        bool verbose=true, int index=-1 );
+
     int GetImageCount( wxInputStream& stream );
         // save the stream position, call DoGetImageCount() and restore the position
 
@@ -246,6 +262,63 @@ public:
     }
 };
 
+//-----------------------------------------------------------------------------
+// wxImageColourTransform: sequence of colour operations applied in one pass
+//-----------------------------------------------------------------------------
+
+class WXDLLIMPEXP_CORE wxImageColourTransform
+{
+public:
+    wxImageColourTransform() = default;
+
+    // All these functions append the corresponding operation, with the same
+    // meaning as that of the wxImage method with the same name, to the
+    // transformation and return the object itself to allow chaining them.
+    wxImageColourTransform& ConvertToGreyscale(double weight_r = 0.299,
+                                               double weight_g = 0.587,
+                                               double weight_b = 0.114);
+    wxImageColourTransform& ConvertToDisabled(unsigned char brightness = 255);
+    wxImageColourTransform& ChangeLightness(int alpha);
+    wxImageColourTransform& RotateHue(double angle);
+    wxImageColourTransform& ChangeSaturation(double factor);
+    wxImageColourTransform& ChangeBrightness(double factor);
+    wxImageColourTransform& Replace(unsigned char r1, unsigned char g1, unsigned char b1,
+                                    unsigned char r2, unsigned char g2, unsigned char b2);
+
+    bool IsEmpty() const { return m_ops.empty(); }
+
+private:
+    enum OpType
+    {
+        Op_Greyscale,
+        Op_Disabled,
+        Op_Lightness,
+        Op_Hue,
+        Op_Saturation,
+        Op_Brightness,
+        Op_Replace
+    };
+
+    struct Op
+    {
+        OpType type;
+
+        // Weights for Op_Greyscale, lightness for Op_Lightness or the angle
+        // or factor for the HSV operations in the first element.
+        double values[3];
+
+        // Brightness for Op_Disabled or the old and new colours for
+        // Op_Replace.
+        unsigned char colours[6];
+    };
+
+    wxImageColourTransform& AddOp(const Op& op);
+
+    std::vector<Op> m_ops;
+
+    friend class wxImageColourTransformer;
+};
+
 //-----------------------------------------------------------------------------
 // wxImage
 //-----------------------------------------------------------------------------
@@ -400,6 +473,10 @@ public:
     // Convert the image based on the given lightness.
     wxImage ChangeLightness(int alpha) const;
 
+    // Apply all the operations of the transformation to every pixel of the
+    // image, leaving the pixels of the mask colour unchanged.
+    void ApplyColourTransform(const wxImageColourTransform& transform);
+
     // these routines are slow but safe
     void SetRGB( int x, int y, unsigned char r, unsigned char g, unsigned char b );
     void SetRGB( const wxRect& rect, unsigned char r, unsigned char g, unsigned char b );
@@ -452,9 +529,19 @@ public:
     static void SetDefaultLoadFlags(int flags);
     static int GetDefaultLoadFlags();
 
+    // Number of threads used by the functions processing all image pixels,
+    // such as Scale() or Blur(), 0 means using as many threads as CPUs.
+    static void SetDefaultThreadCount(int count);
+    static int GetDefaultThreadCount();
+
     void SetLoadFlags(int flags);
     int GetLoadFlags() const;
 
+    // Set the function to call periodically while loading the image by the
+    // next call to LoadFile(), allowing to show the partially loaded image or
+    // to cancel loading it.
+    void SetLoadProgressFunction(const wxImageLoadProgressFunction& progress);
+
     static bool CanRead( const wxString& name );
     static int GetImageCount( const wxString& name, wxBitmapType type = wxBITMAP_TYPE_ANY );
     virtual bool LoadFile( const wxString& name, wxBitmapType type = wxBITMAP_TYPE_ANY, int index = -1 );
@@ -504,6 +591,13 @@ public:
     void InitAlpha();
     void ClearAlpha();
 
+    // Conversions from and to 32 bit ARGB pixels with premultiplied alpha in
+    // native byte order, as used by native bitmaps on many platforms. The
+    // stride is in bytes and 0 means that the rows are contiguous.
+    bool CreateFromPremultipliedARGB(int width, int height,
+                                     const wxUint32* data, int stride = 0);
+    void CopyToPremultipliedARGB(wxUint32* data, int stride = 0) const;
+
     // return true if this pixel is masked or has alpha less than specified
     // threshold
     bool IsTransparent(int x, int y,
@@ -568,8 +662,13 @@ public:
     // corresponds to +100 percent.
     void ChangeHSV(double angleH, double factorS, double factorV);
 
-    static wxList& GetHandlers() { return sm_handlers; }
+    static wxList& GetHandlers() { CreatePendingHandlers(); return sm_handlers; }
     static void AddHandler( wxImageHandler *handler );
+
+    // Register a function creating the handler for the given type: unlike
+    // with AddHandler(), the handler is only created when it's needed.
+    typedef wxImageHandler *(*HandlerFactory)();
+    static void AddHandlerFactory( wxBitmapType imageType, HandlerFactory factory );
     static void InsertHandler( wxImageHandler *handler );
     static bool RemoveHandler( const wxString& name );
     static wxImageHandler *FindHandler( const wxString& name );
@@ -592,6 +691,10 @@ public:
 protected:
     static wxList   sm_handlers;
 
+    // create the handlers of the given type, or all of them if the type is
+    // wxBITMAP_TYPE_ANY, registered with AddHandlerFactory()
+    static void CreatePendingHandlers(wxBitmapType imageType = wxBITMAP_TYPE_ANY);
+
     // return the index of the point with the given coordinates or -1 if the
     // image is invalid of the coordinates are out of range
     //
@@ -609,6 +712,11 @@ private:
     template <typename F>
     void ApplyToAllPixels(const F& func);
 
+    // Implementation of ApplyColourTransform() which can also be used to
+    // transform the pixels of the mask colour.
+    void DoApplyColourTransform(const wxImageColourTransform& transform,
+                                bool skipMask);
+
     // Possible values for MakeEmptyClone() flags.
     enum
     {
@@ -640,6 +748,37 @@ private:
     wxDECLARE_DYNAMIC_CLASS(wxImage);
 };
 
+// ----------------------------------------------------------------------------
+// wxImageResampler: scales many images of the same size to the same new size
+// ----------------------------------------------------------------------------
+
+class wxImageResamplerImpl;
+
+class WXDLLIMPEXP_CORE wxImageResampler
+{
+public:
+    wxImageResampler(const wxSize& srcSize,
+                     const wxSize& dstSize,
+                     wxImageResizeQuality quality = wxIMAGE_QUALITY_NORMAL);
+    ~wxImageResampler();
+
+    const wxSize& GetSourceSize() const { return m_srcSize; }
+    const wxSize& GetDestSize() const { return m_dstSize; }
+    wxImageResizeQuality GetQuality() const { return m_quality; }
+
+    // return the image of GetSourceSize() size scaled to GetDestSize()
+    wxImage Scale(const wxImage& image) const;
+
+private:
+    const wxSize m_srcSize,
+                 m_dstSize;
+    const wxImageResizeQuality m_quality;
+
+    wxImageResamplerImpl* m_impl;
+
+    wxDECLARE_NO_COPY_CLASS(wxImageResampler);
+};
+
 
 extern void WXDLLIMPEXP_CORE wxInitAllImageHandlers();
 
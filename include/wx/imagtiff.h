@@ -18,6 +18,7 @@
 #if wxUSE_LIBTIFF
 
 #include "wx/image.h"
+#include "wx/vector.h"
 #include "wx/versioninfo.h"
 
 // defines for wxImage::SetOption
@@ -42,6 +43,9 @@ public:
 
 #if wxUSE_STREAMS
     virtual bool LoadFile( wxImage *image, wxInputStream& stream, bool verbose=true, int index=-1 ) override;
+    virtual bool LoadFileIncrementally( wxImage *image, wxInputStream& stream,
+                                        const wxImageLoadProgressFunction& progress,
+                                        bool verbose=true, int index=-1 ) override;
     virtual bool SaveFile( wxImage *image, wxOutputStream& stream, bool verbose=true ) override;
 
 protected:
@@ -53,6 +57,50 @@ private:
     wxDECLARE_DYNAMIC_CLASS(wxTIFFHandler);
 };
 
+#if wxUSE_STREAMS
+
+struct tiff;
+
+//-----------------------------------------------------------------------------
+// wxTIFFReader: random access to the pages of a multi-page TIFF
+//-----------------------------------------------------------------------------
+
+class WXDLLIMPEXP_CORE wxTIFFReader
+{
+public:
+    // The stream must be seekable and remain valid while this object exists.
+    explicit wxTIFFReader(wxInputStream& stream);
+    ~wxTIFFReader();
+
+    bool IsOk() const { return m_tif != nullptr; }
+
+    int GetPageCount() const { return static_cast<int>(m_offsets.size()); }
+
+    wxSize GetPageSize(int page);
+
+    bool LoadPage(int page, wxImage* image);
+    bool LoadPageRegion(int page, const wxRect& rect, wxImage* image);
+
+private:
+    // Make the given page current, return false if it couldn't be done.
+    bool SelectPage(int page);
+
+    bool DoLoadPage(int page, wxImage* image, const wxRect* rect);
+
+
+    struct tiff* m_tif;
+
+    // Offsets of the directories of all pages in the file.
+    wxVector<wxUint64> m_offsets;
+
+    // The currently selected page or -1.
+    int m_current;
+
+    wxDECLARE_NO_COPY_CLASS(wxTIFFReader);
+};
+
+#endif // wxUSE_STREAMS
+
 #endif // wxUSE_LIBTIFF
 
 #endif // _WX_IMAGTIFF_H_
@@ -496,6 +496,13 @@ protected:
     // return the attribute for the given item and column (may return nullptr if none)
     virtual wxItemAttr* OnGetItemColumnAttr(long item, long column) const;
 
+    // find the first item, starting from the given one and wrapping around if
+    // necessary, with the text starting with the given prefix (ignoring case)
+    // and return true after setting item to it or -1 if there is none, or
+    // just return false to use the default, linear, search
+    virtual bool OnFindItemByPrefix(long start, const wxString& prefix,
+                                    long& item) const;
+
 private:
     wxWithImages m_imagesNormal,
                  m_imagesSmall,
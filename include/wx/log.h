@@ -57,6 +57,7 @@ class WXDLLIMPEXP_FWD_BASE wxObject;
     #include "wx/thread.h"
 #endif // wxUSE_THREADS
 
+#include <atomic>
 #include <unordered_map>
 
 // wxUSE_LOG_DEBUG enables the debug log messages
@@ -110,6 +111,15 @@ enum wxLogLevelValues
     wxLOG_Max = 10000
 };
 
+// wxLOG_COMPILED_LEVEL can be predefined to a constant expression to remove
+// all logging statements at levels greater than it, and the evaluation of their
+// arguments, from the generated code, e.g. defining it as wxLOG_Info removes
+// all wxLogDebug() and wxLogTrace() calls even if wxUSE_LOG_DEBUG and
+// wxUSE_LOG_TRACE are on (notice that fatal errors can't be disabled)
+#ifndef wxLOG_COMPILED_LEVEL
+    #define wxLOG_COMPILED_LEVEL wxLOG_Max
+#endif
+
 // symbolic trace masks - wxLogTrace("foo", "some trace message...") will be
 // discarded unless the string "foo" has been added to the list of allowed
 // ones with AddTraceMask()
@@ -422,6 +432,14 @@ public:
         return IsEnabled() && level <= GetComponentLevel(component);
     }
 
+    // cheap check for whether logging at this level can be enabled for any
+    // component: this is used by the logging macros before calling
+    // IsLevelEnabled() to avoid creating the component string and locking
+    static bool IsLevelEnabledForAnyComponent(wxLogLevel level)
+    {
+        return level <= ms_logLevel || level <= ms_maxComponentLevel;
+    }
+
 
     // enable/disable messages at wxLOG_Verbose level (only relevant if the
     // current log level is greater or equal to it)
@@ -498,6 +516,12 @@ public:
     // is this trace mask in the list?
     static bool IsAllowedTraceMask(const wxString& mask);
 
+    // are there any trace masks at all? this is MT-safe and cheap
+    static bool HasTraceMasks()
+    {
+        return ms_hasTraceMasks.load(std::memory_order_relaxed);
+    }
+
 
     // log formatting
     // -----------------
@@ -602,6 +626,12 @@ protected:
     // this one as the default implementation of it simply asserts
     virtual void DoLogText(const wxString& msg);
 
+    // override this to return true if DoLogRecord() can be called from any
+    // thread concurrently: in this case, the messages logged from the other
+    // threads are passed to this object immediately instead of being buffered
+    // until the next call to Flush() in the main thread
+    virtual bool IsThreadSafe() const { return false; }
+
     // log a message indicating the number of times the previous message was
     // repeated if previous repetition counter is strictly positive, does
     // nothing otherwise; return the old value of repetition counter
@@ -629,9 +659,13 @@ private:
     // called from OnLog() if it's called from the main thread or if we have a
     // (presumably MT-safe) thread-specific logger and by FlushThreadMessages()
     // when it plays back the buffered messages logged from the other threads
+    //
+    // repetition counting uses global state, so it must be disabled when this
+    // is called for a thread-safe logger from the other threads
     void CallDoLogNow(wxLogLevel level,
                       const wxString& msg,
-                      const wxLogRecordInfo& info);
+                      const wxLogRecordInfo& info,
+                      bool countRepetitions = true);
 
 
     // variables
@@ -654,6 +688,12 @@ private:
 
     static wxLogLevel  ms_logLevel;     // limit logging to levels <= ms_logLevel
 
+    // max of all levels set with SetComponentLevel(), protected by LevelsCS
+    static wxLogLevel  ms_maxComponentLevel;
+
+    // true if TraceMasks() is non-empty, updated under TraceMaskCS
+    static std::atomic<bool> ms_hasTraceMasks;
+
     static size_t      ms_suspendCount; // if positive, logs are not flushed
 
     // format string for strftime(), if empty, time stamping log messages is
@@ -877,6 +917,50 @@ private:
     wxDECLARE_NO_COPY_CLASS(wxLogInterposerTemp);
 };
 
+#if wxUSE_THREADS
+
+// ----------------------------------------------------------------------------
+// asynchronous log target: queues the messages in a fixed size buffer without
+// blocking and passes them to the real log target from a separate thread
+// ----------------------------------------------------------------------------
+
+class wxLogAsyncImpl;
+
+class WXDLLIMPEXP_BASE wxLogAsync : public wxLog
+{
+public:
+    // takes ownership of the target, which must be usable from a non-main
+    // thread, the capacity is rounded up to the next power of 2
+    explicit wxLogAsync(wxLog *target, size_t capacity = 4096);
+    virtual ~wxLogAsync();
+
+    // limit the number of messages less important than warnings logged per
+    // second, the extra ones are discarded; 0 means no limit (default)
+    void SetRateLimit(unsigned maxPerSecond);
+    unsigned GetRateLimit() const;
+
+    // return the total number of messages discarded either because the buffer
+    // was full or due to the rate limit
+    size_t GetDroppedCount() const;
+
+    // wait until all the already queued messages are logged and flush target
+    virtual void Flush() override;
+
+protected:
+    virtual void DoLogRecord(wxLogLevel level,
+                             const wxString& msg,
+                             const wxLogRecordInfo& info) override;
+
+    virtual bool IsThreadSafe() const override { return true; }
+
+private:
+    wxLogAsyncImpl *m_impl;
+
+    wxDECLARE_NO_COPY_CLASS(wxLogAsync);
+};
+
+#endif // wxUSE_THREADS
+
 #if wxUSE_GUI
     // include GUI log targets:
     #include "wx/generic/logg.h"
@@ -941,7 +1025,8 @@ public:
     {
         // remember that fatal errors can't be disabled
         if ( m_level == wxLOG_FatalError ||
-                wxLog::IsLevelEnabled(m_level, wxASCII_STR(m_info.component)) )
+                (m_level <= wxLOG_COMPILED_LEVEL &&
+                 wxLog::IsLevelEnabled(m_level, wxASCII_STR(m_info.component))) )
             DoCallOnLog(wxString::FormatV(format, argptr));
     }
 
@@ -1031,7 +1116,8 @@ public:
     template <typename... Targs>
     void LogAtLevel(wxLogLevel level, const wxString& format, Targs... args)
     {
-        if ( !wxLog::IsLevelEnabled(level, wxASCII_STR(m_info.component)) )
+        if ( level > wxLOG_COMPILED_LEVEL ||
+                !wxLog::IsLevelEnabled(level, wxASCII_STR(m_info.component)) )
             return;
 
         DoCallOnLog(level, wxString::Format(format, args...));
@@ -1146,9 +1232,13 @@ WXDLLIMPEXP_BASE wxString wxSysErrorMsgStr(unsigned long nErrCode = 0);
 #define wxDO_LOGV(level, format, argptr) \
     wxMAKE_LOGGER(level).LogV(format, argptr)
 
-// Macro evaluating to true if logging at the given level is enabled.
-#define wxLOG_IS_ENABLED(level) \
-    wxLog::IsLevelEnabled(wxLOG_##level, wxASCII_STR(wxLOG_COMPONENT))
+// Macro evaluating to true if logging at the given level is enabled: the first
+// check is done at compile-time and the second one only compares the level
+// with the maximal enabled one, so that disabled log statements are cheap.
+#define wxLOG_IS_ENABLED(level)                                               \
+    (wxLOG_##level <= wxLOG_COMPILED_LEVEL &&                                 \
+     wxLog::IsLevelEnabledForAnyComponent(wxLOG_##level) &&                   \
+     wxLog::IsLevelEnabled(wxLOG_##level, wxASCII_STR(wxLOG_COMPONENT)))
 
 // Macro used to define most of the actual wxLogXXX() macros: just calls
 // wxLogger::Log(), if logging at the specified level is enabled.
@@ -1317,8 +1407,13 @@ inline void wxLogNop() { }
 #endif // wxUSE_LOG_DEBUG/!wxUSE_LOG_DEBUG
 
 #if wxUSE_LOG_TRACE
-    #define wxLogTrace wxDO_LOG_IF_ENABLED_WITH_FUNC(Trace, LogTrace)
-    #define wxVLogTrace wxDO_LOG_IF_ENABLED_WITH_FUNC(Trace, LogVTrace)
+    // don't evaluate the mask nor the other arguments if no masks are enabled
+    #define wxLOG_TRACE_IF_ENABLED(func)                                      \
+        wxDO_IF(wxLOG_IS_ENABLED(Trace) && wxLog::HasTraceMasks())            \
+        wxDO_LOG_WITH_FUNC(Trace, func)
+
+    #define wxLogTrace wxLOG_TRACE_IF_ENABLED(LogTrace)
+    #define wxVLogTrace wxLOG_TRACE_IF_ENABLED(LogVTrace)
 #else  // !wxUSE_LOG_TRACE
     #define wxVLogTrace(mask, fmt, valist) wxLogNop()
     #define wxLogTrace(mask, fmt, ...) wxLogNop()
@@ -0,0 +1,148 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        wx/lz4stream.h
+// Purpose:     Filters streams using LZ4 compression
+// Author:      wxWidgets team
+// Created:     2026-10-14
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef _WX_LZ4STREAM_H_
+#define _WX_LZ4STREAM_H_
+
+#include "wx/defs.h"
+
+#if wxUSE_LIBLZ4 && wxUSE_STREAMS
+
+#include "wx/stream.h"
+#include "wx/versioninfo.h"
+
+namespace wxPrivate
+{
+
+// Private wrapper for LZ4 frame compression or decompression context and
+// buffers.
+struct wxLZ4Stream;
+
+// Common part of input and output LZ4 streams: this is just an
+// implementation detail and is not part of the public API.
+class WXDLLIMPEXP_BASE wxLZ4Data
+{
+protected:
+    wxLZ4Data();
+    ~wxLZ4Data();
+
+    wxLZ4Stream* m_stream;
+    wxFileOffset m_pos;
+
+    wxDECLARE_NO_COPY_CLASS(wxLZ4Data);
+};
+
+} // namespace wxPrivate
+
+// ----------------------------------------------------------------------------
+// Filter for decompressing data compressed using LZ4
+// ----------------------------------------------------------------------------
+
+class WXDLLIMPEXP_BASE wxLZ4InputStream : public wxFilterInputStream,
+                                          private wxPrivate::wxLZ4Data
+{
+public:
+    explicit wxLZ4InputStream(wxInputStream& stream)
+        : wxFilterInputStream(stream)
+    {
+        Init();
+    }
+
+    explicit wxLZ4InputStream(wxInputStream* stream)
+        : wxFilterInputStream(stream)
+    {
+        Init();
+    }
+
+    char Peek() override { return wxInputStream::Peek(); }
+    wxFileOffset GetLength() const override { return wxInputStream::GetLength(); }
+
+protected:
+    size_t OnSysRead(void *buffer, size_t size) override;
+    wxFileOffset OnSysTell() const override { return m_pos; }
+
+private:
+    void Init();
+};
+
+// ----------------------------------------------------------------------------
+// Filter for compressing data using LZ4 algorithm
+// ----------------------------------------------------------------------------
+
+class WXDLLIMPEXP_BASE wxLZ4OutputStream : public wxFilterOutputStream,
+                                           private wxPrivate::wxLZ4Data
+{
+public:
+    explicit wxLZ4OutputStream(wxOutputStream& stream, int level = -1)
+        : wxFilterOutputStream(stream)
+    {
+        Init(level);
+    }
+
+    explicit wxLZ4OutputStream(wxOutputStream* stream, int level = -1)
+        : wxFilterOutputStream(stream)
+    {
+        Init(level);
+    }
+
+    virtual ~wxLZ4OutputStream() { Close(); }
+
+    void Sync() override { DoFlush(false); }
+    bool Close() override;
+    wxFileOffset GetLength() const override { return m_pos; }
+
+protected:
+    size_t OnSysWrite(const void *buffer, size_t size) override;
+    wxFileOffset OnSysTell() const override { return m_pos; }
+
+private:
+    void Init(int level);
+
+    // Write the contents of the internal buffer to the output stream.
+    bool UpdateOutput();
+
+    // Compress the given data, which must not be bigger than the chunk size
+    // used for the internal buffer allocation.
+    bool CompressChunk(const void *buffer, size_t size);
+
+    // End the frame (if argument is true) or flush all the data compressed
+    // so far, return true on success or false on error.
+    bool DoFlush(bool finish);
+};
+
+// ----------------------------------------------------------------------------
+// Support for creating LZ4 streams from extension/MIME type
+// ----------------------------------------------------------------------------
+
+class WXDLLIMPEXP_BASE wxLZ4ClassFactory: public wxFilterClassFactory
+{
+public:
+    wxLZ4ClassFactory();
+
+    wxFilterInputStream *NewStream(wxInputStream& stream) const override
+        { return new wxLZ4InputStream(stream); }
+    wxFilterOutputStream *NewStream(wxOutputStream& stream) const override
+        { return new wxLZ4OutputStream(stream, -1); }
+    wxFilterInputStream *NewStream(wxInputStream *stream) const override
+        { return new wxLZ4InputStream(stream); }
+    wxFilterOutputStream *NewStream(wxOutputStream *stream) const override
+        { return new wxLZ4OutputStream(stream, -1); }
+
+    const wxChar * const *GetProtocols(wxStreamProtocolType type
+                                       = wxSTREAM_PROTOCOL) const override;
+
+private:
+    wxDECLARE_DYNAMIC_CLASS(wxLZ4ClassFactory);
+};
+
+WXDLLIMPEXP_BASE wxVersionInfo wxGetLibLZ4VersionInfo();
+
+#endif // wxUSE_LIBLZ4 && wxUSE_STREAMS
+
+#endif // _WX_LZ4STREAM_H_
@@ -0,0 +1,103 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        wx/mappedfile.h
+// Purpose:     wxMappedFile and wxMappedInputStream classes
+// Author:      wxWidgets team
+// Created:     2026-10-14
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef _WX_MAPPEDFILE_H_
+#define _WX_MAPPEDFILE_H_
+
+#include "wx/defs.h"
+
+#if wxUSE_FILE
+
+#include "wx/string.h"
+
+#if wxUSE_STREAMS
+    #include "wx/stream.h"
+#endif // wxUSE_STREAMS
+
+// ----------------------------------------------------------------------------
+// wxMappedFile: read-only file mapped into memory
+// ----------------------------------------------------------------------------
+
+class WXDLLIMPEXP_BASE wxMappedFile
+{
+public:
+    // Default ctor doesn't map any file, call Open() later.
+    wxMappedFile() = default;
+
+    // Map the given file, use IsOpened() to check for success.
+    explicit wxMappedFile(const wxString& filename) { Open(filename); }
+
+    ~wxMappedFile() { Close(); }
+
+    // Map the entire contents of the given file into memory, closing the
+    // previously mapped one, if any.
+    bool Open(const wxString& filename);
+
+    // Unmap the file, does nothing if it is not opened.
+    void Close();
+
+    bool IsOpened() const { return m_opened; }
+
+    // Return the pointer to the file contents and its length. Note that the
+    // data is null if the file is empty, even if it was opened successfully.
+    const char* GetData() const { return m_data; }
+    size_t GetLength() const { return m_length; }
+
+private:
+    // Implemented in platform-specific files, these functions only deal with
+    // mapping the memory and are called by Open() and Close() respectively.
+    bool DoOpen(const wxString& filename);
+    void DoClose();
+
+    const char* m_data = nullptr;
+    size_t m_length = 0;
+    bool m_opened = false;
+
+    wxDECLARE_NO_COPY_CLASS(wxMappedFile);
+};
+
+#if wxUSE_STREAMS
+
+// ----------------------------------------------------------------------------
+// wxMappedInputStream: input stream reading from a memory mapped file
+// ----------------------------------------------------------------------------
+
+class WXDLLIMPEXP_BASE wxMappedInputStream : public wxInputStream
+{
+public:
+    explicit wxMappedInputStream(const wxString& filename);
+
+    virtual bool IsOk() const override;
+    virtual wxFileOffset GetLength() const override;
+    virtual bool IsSeekable() const override { return true; }
+
+    // Give access to the underlying file to allow accessing its contents
+    // directly, without copying them, e.g. at the current TellI() position.
+    const wxMappedFile& GetFile() const { return m_file; }
+
+protected:
+    virtual size_t OnSysRead(void *buffer, size_t size) override;
+    virtual wxFileOffset OnSysSeek(wxFileOffset pos, wxSeekMode mode) override;
+    virtual wxFileOffset OnSysTell() const override;
+
+    virtual size_t DoPeekBuffer(const void **data) override;
+    virtual void DoConsumeBuffer(size_t size) override;
+
+private:
+    wxMappedFile m_file;
+    size_t m_pos = 0;
+
+    wxDECLARE_NO_COPY_CLASS(wxMappedInputStream);
+};
+
+#endif // wxUSE_STREAMS
+
+#endif // wxUSE_FILE
+
+#endif // _WX_MAPPEDFILE_H_
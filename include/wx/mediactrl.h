@@ -36,6 +36,10 @@
 #include "wx/control.h"
 #include "wx/uri.h"
 
+#include <functional>
+
+class WXDLLIMPEXP_FWD_CORE wxImage;
+
 #define wxMC_NO_AUTORESIZE         0x0001
 
 // ============================================================================
@@ -74,6 +78,96 @@ enum wxMediaCtrlPlayerControls
 #define wxMEDIABACKEND_REALPLAYER   wxT("wxRealPlayerMediaBackend")
 #define wxMEDIABACKEND_WMP10        wxT("wxWMP10MediaBackend")
 
+// ----------------------------------------------------------------------------
+//
+// wxMediaFrame
+//
+// A decoded video frame passed to the callback set with
+// wxMediaCtrl::SetFrameCallback(). It doesn't own the frame data, which is
+// only valid during the callback execution.
+//
+// ----------------------------------------------------------------------------
+
+class WXDLLIMPEXP_MEDIA wxMediaFrame
+{
+public:
+    enum { MAX_PLANES = 4 };
+
+    // Only used by the backends.
+    wxMediaFrame(int width, int height,
+                 const wxString& format,
+                 wxLongLong timestamp)
+        : m_width(width), m_height(height),
+          m_format(format),
+          m_timestamp(timestamp),
+          m_planeCount(0)
+    {
+    }
+
+    void AddPlane(const unsigned char* data, int stride)
+    {
+        wxCHECK_RET( m_planeCount < MAX_PLANES, "too many planes" );
+
+        m_planes[m_planeCount] = data;
+        m_strides[m_planeCount] = stride;
+        m_planeCount++;
+    }
+
+    int GetWidth() const { return m_width; }
+    int GetHeight() const { return m_height; }
+
+    // Native pixel format name, e.g. "RGB", "I420" or "NV12".
+    const wxString& GetFormat() const { return m_format; }
+
+    // Presentation timestamp in milliseconds or -1 if unknown.
+    wxLongLong GetTimestamp() const { return m_timestamp; }
+
+    int GetPlaneCount() const { return m_planeCount; }
+    const unsigned char* GetPlaneData(int plane) const
+    {
+        wxCHECK_MSG( plane >= 0 && plane < m_planeCount, nullptr,
+                     "invalid plane index" );
+        return m_planes[plane];
+    }
+    int GetPlaneStride(int plane) const
+    {
+        wxCHECK_MSG( plane >= 0 && plane < m_planeCount, 0,
+                     "invalid plane index" );
+        return m_strides[plane];
+    }
+
+    // Return the frame as wxImage, sharing the frame data without copying it
+    // when possible, i.e. for tightly packed "RGB" frames, and converting it
+    // otherwise. An invalid image is returned for unsupported formats.
+    wxImage ToImage() const;
+
+private:
+    const int m_width,
+              m_height;
+    const wxString m_format;
+    const wxLongLong m_timestamp;
+
+    const unsigned char* m_planes[MAX_PLANES];
+    int m_strides[MAX_PLANES];
+    int m_planeCount;
+
+    wxDECLARE_NO_COPY_CLASS(wxMediaFrame);
+};
+
+// Called from a worker thread for each decoded video frame.
+using wxMediaFrameCallback = std::function<void (const wxMediaFrame&)>;
+
+// Video frame statistics since the media was loaded.
+struct wxMediaFrameStats
+{
+    // Frames which reached the video sink.
+    unsigned long framesReceived = 0;
+
+    // Frames rendered and dropped by the sink, e.g. because they were late.
+    unsigned long framesRendered = 0;
+    unsigned long framesDropped = 0;
+};
+
 // ----------------------------------------------------------------------------
 //
 // wxMediaEvent
@@ -206,6 +300,9 @@ public:
     bool    ShowPlayerControls(
         wxMediaCtrlPlayerControls flags = wxMEDIACTRLPLAYERCONTROLS_DEFAULT);
 
+    bool SetFrameCallback(const wxMediaFrameCallback& callback); // GStreamer only
+    bool GetFrameStats(wxMediaFrameStats* stats);                // GStreamer only
+
     //helpers for the wxPython people
     bool LoadURI(const wxString& fileName)
     {   return Load(wxURI(fileName));       }
@@ -312,6 +409,11 @@ public:
 
     virtual void MacVisibilityChanged()
     {                                   }
+
+    virtual bool SetFrameCallback(const wxMediaFrameCallback& WXUNUSED(callback))
+    {   return false;                   }
+    virtual bool GetFrameStats(wxMediaFrameStats* WXUNUSED(stats))
+    {   return false;                   }
     virtual void RESERVED9() {}
 
     wxDECLARE_DYNAMIC_CLASS(wxMediaBackend);
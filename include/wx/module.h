@@ -21,6 +21,9 @@ typedef wxVector<wxModule*> wxModuleList;
 // declaring a class derived from wxModule will automatically create an
 // instance of this class on program startup, call its OnInit() method and call
 // OnExit() on program termination (but only if OnInit() succeeded)
+//
+// lazy modules, i.e. those calling SetLazy() from their ctor, are not
+// initialized on startup but only when InitializeLazyModules() is called
 class WXDLLIMPEXP_BASE wxModule : public wxObject
 {
 public:
@@ -50,6 +53,14 @@ public:
     static void CleanUpModules();
     static bool AreInitialized() { return ms_areInitialized; }
 
+    // initialize all not yet initialized lazy modules of the given class or
+    // derived from it, this should be called by the subsystem using them
+    // before it needs them, return false if any of them failed to initialize
+    static bool InitializeLazyModules(wxClassInfo *classInfo);
+
+    // return true if this module is only initialized on demand
+    bool IsLazy() const { return m_lazy; }
+
     // used by wxObjectLoader when unloading shared libs's
 
     static void UnregisterModule(wxModule *module);
@@ -57,6 +68,9 @@ public:
 protected:
     static wxModuleList ms_modules;
 
+    // lazy modules not initialized yet, only used after InitializeModules()
+    static wxModuleList ms_lazyModules;
+
     static bool ms_areInitialized;
 
     // the function to call from constructor of a deriving class add module
@@ -76,6 +90,11 @@ protected:
         m_namedDependencies.push_back(wxASCII_STR(className));
     }
 
+    // call this from the constructor of a deriving class to avoid
+    // initializing the module on startup, InitializeLazyModules() must be
+    // called to initialize it before using it then
+    void SetLazy() { m_lazy = true; }
+
 
 private:
     // initialize module and Append it to initializedModules list recursively
@@ -83,6 +102,9 @@ private:
     static bool
     DoInitializeModule(wxModule *module, wxModuleList &initializedModules);
 
+    // find the module with the given class info among all registered ones
+    static wxModule *FindModule(wxClassInfo *classInfo);
+
     // cleanup the modules in the specified list (which may not contain all
     // modules if we're called during initialization because not all modules
     // could be initialized) and also empty ms_modules itself
@@ -101,6 +123,9 @@ private:
     // added to m_dependencies
     wxVector<wxString> m_namedDependencies;
 
+    // true if SetLazy() was called
+    bool m_lazy = false;
+
     // used internally while initializing/cleaning up modules
     enum
     {
@@ -50,6 +50,9 @@ protected:
     wxFileOffset OnSysSeek(wxFileOffset pos, wxSeekMode mode) override;
     wxFileOffset OnSysTell() const override;
 
+    size_t DoPeekBuffer(const void **data) override;
+    void DoConsumeBuffer(size_t size) override;
+
 private:
     // common part of ctors taking wxInputStream
     void InitFromStream(wxInputStream& stream, wxFileOffset lenFile);
@@ -85,4 +85,67 @@ private:
     static void RemoveThousandsSeparators(wxString& s);
 };
 
+// Object version of wxNumberFormatter remembering the locale separators when
+// it is created (or UpdateFromLocale() is called), which makes it much faster
+// to use for formatting or parsing many numbers in a row.
+class WXDLLIMPEXP_BASE wxCachedNumberFormatter
+{
+public:
+    // Create the formatter using the separators of the current locale.
+    wxCachedNumberFormatter() { UpdateFromLocale(); }
+
+    // Update the cached separators, must be called if the locale changes.
+    void UpdateFromLocale();
+
+    // Get the cached separators, see wxNumberFormatter functions with the same
+    // names.
+    wxChar GetDecimalSeparator() const { return m_decimalSep; }
+    bool GetThousandsSeparatorIfUsed(wxChar *sep) const
+    {
+        if ( !m_thousandsSep )
+            return false;
+
+        if ( sep )
+            *sep = m_thousandsSep;
+
+        return true;
+    }
+
+    // These functions behave exactly like wxNumberFormatter ones.
+    wxString ToString(long val,
+                      int style = wxNumberFormatter::Style_WithThousandsSep) const;
+#ifdef wxHAS_LONG_LONG_T_DIFFERENT_FROM_LONG
+    wxString ToString(wxLongLong_t val,
+                      int style = wxNumberFormatter::Style_WithThousandsSep) const;
+#endif // wxHAS_LONG_LONG_T_DIFFERENT_FROM_LONG
+    wxString ToString(wxULongLong_t val,
+                      int style = wxNumberFormatter::Style_WithThousandsSep) const;
+    wxString ToString(double val,
+                      int precision,
+                      int style = wxNumberFormatter::Style_WithThousandsSep) const;
+
+    bool FromString(const wxString& s, long *val) const;
+#ifdef wxHAS_LONG_LONG_T_DIFFERENT_FROM_LONG
+    bool FromString(const wxString& s, wxLongLong_t *val) const;
+#endif // wxHAS_LONG_LONG_T_DIFFERENT_FROM_LONG
+    bool FromString(const wxString& s, wxULongLong_t *val) const;
+    bool FromString(const wxString& s, double *val) const;
+
+private:
+    // Format the integer with the given absolute value.
+    wxString DoFormatInt(wxULongLong_t absval, bool negative, int style) const;
+
+    // Parse the string as an integer with the given maximal absolute values
+    // of the positive and negative numbers, the latter can be 0 to disallow
+    // negative numbers completely.
+    bool DoParseInt(const wxString& s,
+                    wxULongLong_t maxPos, wxULongLong_t maxNeg,
+                    wxULongLong_t* absval, bool* negative) const;
+
+    wxChar m_decimalSep;
+
+    // This is 0 if the thousands separator is not used.
+    wxChar m_thousandsSep;
+};
+
 #endif // _WX_NUMFORMATTER_H_
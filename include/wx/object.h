@@ -23,6 +23,8 @@
     #include "wx/string.h"
 #endif
 
+#include <atomic>
+
 #define wxDECLARE_CLASS_INFO_ITERATORS()                                     \
 class WXDLLIMPEXP_BASE const_iterator                                    \
     {                                                                        \
@@ -192,21 +194,42 @@ inline T *wxCheckCast(const void *ptr)
 class WXDLLIMPEXP_BASE wxRefCounter
 {
 public:
-    wxRefCounter() { m_count = 1; }
+    wxRefCounter() : m_count(1) { }
+
+    int GetRefCount() const
+    {
+        return m_count.load(m_mtSafe ? std::memory_order_acquire
+                                     : std::memory_order_relaxed);
+    }
 
-    int GetRefCount() const { return m_count; }
+    void IncRef()
+    {
+        if ( m_mtSafe )
+            m_count.fetch_add(1, std::memory_order_relaxed);
+        else // Non-atomic increment is cheaper and sufficient here.
+            m_count.store(m_count.load(std::memory_order_relaxed) + 1,
+                          std::memory_order_relaxed);
+    }
 
-    void IncRef() { m_count++; }
     void DecRef();
 
+    // By default the reference count is not thread-safe, call this to allow
+    // sharing this data between the objects used by different threads.
+    //
+    // This must be done before the data is shared with any other thread.
+    void SetMTSafe() { m_mtSafe = true; }
+    bool IsMTSafe() const { return m_mtSafe; }
+
 protected:
     // this object should never be destroyed directly but only as a
     // result of a DecRef() call:
     virtual ~wxRefCounter() = default;
 
 private:
-    // our refcount:
-    int m_count;
+    // our refcount: it's only modified atomically if m_mtSafe is true
+    std::atomic<int> m_count;
+
+    bool m_mtSafe = false;
 
     // It doesn't make sense to copy the reference counted objects, a new ref
     // counter should be created for a new object instead and compilation
@@ -403,6 +426,16 @@ public:
     // Make sure this object has only one reference
     void UnShare() { AllocExclusive(); }
 
+    // Make the reference count of the data of this object, and of all its
+    // copies created by copy-on-write, thread-safe. Must be called before
+    // sharing this object with another thread and does nothing if there is
+    // no data.
+    void SetRefDataMTSafe()
+    {
+        if ( m_refData )
+            m_refData->SetMTSafe();
+    }
+
     // check if this object references the same data as the other one
     bool IsSameAs(const wxObject& o) const { return m_refData == o.m_refData; }
 
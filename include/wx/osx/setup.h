@@ -553,6 +553,20 @@
 // Recommended setting: 1 if you need LZMA compression.
 #define wxUSE_LIBLZMA       0
 
+// Use libzstd (Zstandard) and liblz4 libraries for providing
+// wxZstdInputStream/wxZstdOutputStream and wxLZ4InputStream/wxLZ4OutputStream
+// classes respectively.
+//
+// As with wxUSE_LIBLZMA above, the headers and libraries of the corresponding
+// library must be available when enabling these options without using
+// configure or CMake.
+//
+// Default is 0 under MSW, auto-detected by configure.
+//
+// Recommended setting: 1 if you need Zstandard or LZ4 compression.
+#define wxUSE_LIBZSTD       0
+#define wxUSE_LIBLZ4        0
+
 // If enabled, the code written by Apple will be used to write, in a portable
 // way, float on the disk. See extended.c for the license which is different
 // from wxWidgets one.
@@ -1559,6 +1573,9 @@
 // use wxEpollDispatcher class (Linux only)
 #define wxUSE_EPOLL_DISPATCHER 0
 
+// use wxIOUringDispatcher class (Linux only)
+#define wxUSE_IOURING_DISPATCHER 0
+
 /*
  Use GStreamer for Unix.
 
@@ -1601,6 +1618,7 @@
 // make sure we have the proper dispatcher for the console event loop
 #define wxUSE_SELECT_DISPATCHER 1
 #define wxUSE_EPOLL_DISPATCHER 0
+#define wxUSE_IOURING_DISPATCHER 0
 
 // set to 1 if you have older code that still needs icon refs
 #define wxOSX_USE_ICONREF 0
@@ -18,6 +18,9 @@
 // use wxEpollDispatcher class (Linux only)
 #define wxUSE_EPOLL_DISPATCHER 0
 
+// use wxIOUringDispatcher class (Linux only)
+#define wxUSE_IOURING_DISPATCHER 0
+
 /*
  Use GStreamer for Unix.
 
@@ -60,6 +63,7 @@
 // make sure we have the proper dispatcher for the console event loop
 #define wxUSE_SELECT_DISPATCHER 1
 #define wxUSE_EPOLL_DISPATCHER 0
+#define wxUSE_IOURING_DISPATCHER 0
 
 // set to 1 if you have older code that still needs icon refs
 #define wxOSX_USE_ICONREF 0
@@ -0,0 +1,113 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        wx/paintprofiler.h
+// Purpose:     wxPaintProfiler: measure the time spent painting each window
+// Author:      wxWidgets team
+// Created:     2026-10-15
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef _WX_PAINTPROFILER_H_
+#define _WX_PAINTPROFILER_H_
+
+#include "wx/defs.h"
+#include "wx/string.h"
+
+#include <atomic>
+#include <vector>
+
+class WXDLLIMPEXP_FWD_BASE wxEvent;
+class WXDLLIMPEXP_FWD_CORE wxWindow;
+class WXDLLIMPEXP_FWD_CORE wxWindowBase;
+
+// ----------------------------------------------------------------------------
+// wxPaintProfiler: collects paint statistics for each window
+// ----------------------------------------------------------------------------
+
+// All the times used by this class are in microseconds. As with
+// wxEventProfiler, all the functions of this class must be called from the
+// main thread.
+class WXDLLIMPEXP_CORE wxPaintProfiler
+{
+public:
+    struct WindowStats
+    {
+        // The window itself or nullptr if it had been already destroyed.
+        wxWindow* window = nullptr;
+
+        // The class and the name of the window.
+        wxString className;
+        wxString name;
+
+        unsigned long paintCount = 0;
+        wxLongLong_t totalTime = 0;
+        wxLongLong_t maxTime = 0;
+        wxLongLong_t lastTime = 0;
+
+        // Total area of the update regions and of the window client area at
+        // the time of painting, in pixels, and the number of times the entire
+        // window was repainted.
+        wxLongLong_t updateArea = 0;
+        wxLongLong_t windowArea = 0;
+        unsigned long fullPaintCount = 0;
+
+        // Number of drawing operations performed using wxDC during painting.
+        unsigned long primitiveCount = 0;
+
+        wxLongLong_t GetAverageTime() const
+            { return paintCount ? totalTime / paintCount : 0; }
+
+        // Return the fraction of the window repainted on average.
+        double GetUpdateRatio() const
+            { return windowArea ? double(updateArea) / windowArea : 0.; }
+    };
+
+    // Start or stop collecting the data. Starting the profiler discards any
+    // previously collected data.
+    static void Start();
+    static void Stop();
+
+    static bool IsRunning() { return ms_running.load(std::memory_order_relaxed); }
+
+    // Discard all the collected data without stopping the profiler.
+    static void Reset();
+
+    // Return the statistics for all windows painted so far, sorted in the
+    // order of decreasing total paint time.
+    static std::vector<WindowStats> GetWindowStats();
+
+    // Get the statistics for the given window, return false if it wasn't
+    // painted since the profiler was started.
+    static bool GetWindowStats(const wxWindow* win, WindowStats* stats);
+
+    // Show the overlay with the last paint time and the number of primitives
+    // drawn on top of each window and the outline of its update region. The
+    // profiler must be running for this to work.
+    static void ShowOverlay(bool show = true);
+    static bool IsShowingOverlay();
+
+
+    // Implementation only from now on.
+
+    // Called by all wxDC drawing functions.
+    static void OnPrimitive()
+    {
+        if ( IsRunning() )
+            ms_primitiveCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Called by wxWindow::HandleWindowEvent() to process the paint events
+    // when the profiler is running.
+    static bool ProcessPaintEvent(const wxWindowBase* win, wxEvent& event);
+
+    // Called when the window is destroyed.
+    static void OnWindowDestroyed(const wxWindowBase* win);
+
+private:
+    static std::atomic<bool> ms_running;
+    static std::atomic<unsigned long> ms_primitiveCount;
+
+    wxPaintProfiler() = delete;
+};
+
+#endif // _WX_PAINTPROFILER_H_
@@ -93,9 +93,20 @@ public:
     // these methods do nothing if DisableSaving/Restoring() was called
     //
     // Restore() returns true if the object state was really restored
+    //
+    // Save() only writes the values which differ from the ones known to be
+    // stored in the config, i.e. read from it or written to it before
     void Save(void *obj);
     bool Restore(void *obj);
 
+    // read all the settings of the object from the config at once, so that
+    // RestoreValue() doesn't need to access it any more: this is done by
+    // Restore() automatically, but can be used directly when restoring the
+    // values of a registered object in some other way
+    //
+    // returns false if the settings of the object can't be read at once
+    bool LoadValues(void *obj);
+
     // combines both Save() and Unregister() calls
     void SaveAndUnregister(void *obj)
     {
@@ -161,10 +172,41 @@ protected:
 private:
     using wxPersistentObjectPtr = std::unique_ptr<wxPersistentObject>;
 
+    // values of the settings of a registered object, as stored in the config,
+    // indexed by their full keys
+    struct KnownValues
+    {
+        // the group with all the settings of the object, with the trailing
+        // separator, if it had been loaded by LoadValues()
+        wxString group;
+        bool loaded = false;
+
+        std::unordered_map<wxString, wxString> values;
+    };
+
+    // return the known values of the given object or nullptr if it's not
+    // registered
+    KnownValues *GetKnownValues(const wxPersistentObject& who);
+
+    // implementation of SaveValue() and RestoreValue() for all types
+    template <typename T>
+    bool DoSaveValue(const wxPersistentObject& who,
+                     const wxString& name,
+                     T value);
+
+    template <typename T>
+    bool DoRestoreValue(const wxPersistentObject& who,
+                        const wxString& name,
+                        T *value);
+
     // map with the registered objects as keys and associated
     // wxPersistentObjects as values
     std::unordered_map<void*, wxPersistentObjectPtr> m_persistentObjects;
 
+    // values of the settings of the registered objects which are known to be
+    // stored in the config, used to avoid writing the unchanged ones
+    std::unordered_map<const wxPersistentObject*, KnownValues> m_knownValues;
+
     // true if we should restore/save the settings (it doesn't make much sense
     // to use this class when both of them are false but setting one of them to
     // false may make sense in some situations)
@@ -12,6 +12,7 @@
 
 #include "wx/private/fdiohandler.h"
 
+#include <functional>
 #include <unordered_map>
 
 // those flags describes sets where descriptor should be added
@@ -20,7 +21,14 @@ enum wxFDIODispatcherEntryFlags
     wxFDIO_INPUT = 1,
     wxFDIO_OUTPUT = 2,
     wxFDIO_EXCEPTION = 4,
-    wxFDIO_ALL = wxFDIO_INPUT | wxFDIO_OUTPUT | wxFDIO_EXCEPTION
+    wxFDIO_ALL = wxFDIO_INPUT | wxFDIO_OUTPUT | wxFDIO_EXCEPTION,
+
+    // this flag can be combined with the others to request edge-triggered
+    // notifications, i.e. the handler is only called again after new data
+    // arrives, so it must read everything available, e.g. using DrainFD(),
+    // until EAGAIN is returned; dispatchers not supporting it ignore it and
+    // remain level-triggered, which is still correct for such handlers
+    wxFDIO_EDGE_TRIGGERED = 8
 };
 
 // base class for wxSelectDispatcher and wxEpollDispatcher
@@ -41,6 +49,16 @@ public:
     // implementation
     static void DispatchPending();
 
+    // read all the data currently available from the given non-blocking
+    // descriptor, passing it to the provided function, until read() fails
+    // with EAGAIN; this is mostly useful for the handlers registered with
+    // wxFDIO_EDGE_TRIGGERED
+    //
+    // return true if all data was read or false if the end of file was
+    // reached (errno is 0 then) or an error occurred (errno is set)
+    static bool
+    DrainFD(int fd, const std::function<void (const char *, size_t)>& consume);
+
     // register handler for the given descriptor with the dispatcher, return
     // true on success or false on error
     virtual bool RegisterFD(int fd, wxFDIOHandler *handler, int flags) = 0;
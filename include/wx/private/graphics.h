@@ -160,6 +160,12 @@ public :
     virtual void GetBox(wxDouble *x, wxDouble *y, wxDouble *w, wxDouble *h) const=0;
 
     virtual bool Contains( wxDouble x, wxDouble y, wxPolygonFillMode fillStyle = wxODDEVEN_RULE) const=0;
+
+    // prepares the path for being drawn repeatedly, the backends keeping the
+    // path in the form directly usable for drawing don't need to do anything
+    //
+    // the prepared data must be discarded when the path is modified
+    virtual void Compile() { }
 };
 
 #endif
@@ -0,0 +1,50 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        wx/private/hashnocase.h
+// Purpose:     Case-insensitive hash map of strings
+// Author:      wxWidgets team
+// Created:     2026-10-14
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef _WX_PRIVATE_HASHNOCASE_H_
+#define _WX_PRIVATE_HASHNOCASE_H_
+
+#include "wx/string.h"
+#include "wx/wxcrt.h"
+
+#include <unordered_map>
+
+// Hash and equality functors allowing to look up the strings ignoring their
+// case without creating lower case copies of them, i.e. without allocating
+// any memory. They are consistent with wxString::IsSameAs(s, false).
+struct wxStringNoCaseHash
+{
+    size_t operator()(const wxString& s) const
+    {
+        // This is FNV-1a hash of the lower case characters.
+        size_t hash = 2166136261u;
+        for ( wxString::const_iterator i = s.begin(); i != s.end(); ++i )
+        {
+            hash ^= static_cast<size_t>(wxTolower(*i).GetValue());
+            hash *= 16777619u;
+        }
+
+        return hash;
+    }
+};
+
+struct wxStringNoCaseEqual
+{
+    bool operator()(const wxString& a, const wxString& b) const
+    {
+        return a.IsSameAs(b, false);
+    }
+};
+
+// Map using case-insensitive strings as keys.
+template <typename T>
+using wxStringNoCaseHashMap =
+    std::unordered_map<wxString, T, wxStringNoCaseHash, wxStringNoCaseEqual>;
+
+#endif // _WX_PRIVATE_HASHNOCASE_H_
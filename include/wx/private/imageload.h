@@ -0,0 +1,81 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        wx/private/imageload.h
+// Purpose:     Helper for reporting the progress of loading images
+// Author:      wxWidgets team
+// Created:     2026-10-14
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef _WX_PRIVATE_IMAGELOAD_H_
+#define _WX_PRIVATE_IMAGELOAD_H_
+
+#include "wx/image.h"
+
+// ----------------------------------------------------------------------------
+// wxImageLoadProgressReporter: calls wxImageLoadProgressFunction for bands
+// ----------------------------------------------------------------------------
+
+// This class is used by the image handlers implementing LoadFileIncrementally()
+// to call the progress function for bands of at least the given number of
+// rows, to avoid calling it too often.
+//
+// Note that it doesn't have any non-trivial members and so can be safely used
+// in the functions using setjmp() and longjmp() for error handling.
+class wxImageLoadProgressReporter
+{
+public:
+    // The function may be empty, in which case nothing is done.
+    wxImageLoadProgressReporter(const wxImageLoadProgressFunction& progress,
+                                const wxImage& image,
+                                int bandHeight = 16)
+        : m_progress(progress),
+          m_image(image),
+          m_bandHeight(bandHeight)
+    {
+    }
+
+    // Must be called when all the rows before the given one have been
+    // decoded. Returns false if loading was cancelled.
+    bool RowsDone(int y)
+    {
+        if ( !m_progress || m_cancelled )
+            return !m_cancelled;
+
+        if ( y - m_done < m_bandHeight && y < m_image.GetHeight() )
+            return true;
+
+        if ( y > m_done )
+        {
+            if ( !m_progress(m_image, m_done, y - m_done) )
+            {
+                m_cancelled = true;
+                return false;
+            }
+
+            m_done = y;
+        }
+
+        return true;
+    }
+
+    // Report all the remaining rows of the image as decoded.
+    bool AllDone() { return RowsDone(m_image.GetHeight()); }
+
+    // Return true if the progress function returned false.
+    bool IsCancelled() const { return m_cancelled; }
+
+private:
+    const wxImageLoadProgressFunction& m_progress;
+    const wxImage& m_image;
+    const int m_bandHeight;
+
+    // All rows before this one have been already reported.
+    int m_done = 0;
+
+    bool m_cancelled = false;
+
+    wxDECLARE_NO_COPY_CLASS(wxImageLoadProgressReporter);
+};
+
+#endif // _WX_PRIVATE_IMAGELOAD_H_
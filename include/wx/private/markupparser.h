@@ -12,6 +12,8 @@
 
 #include "wx/string.h"
 
+#include <vector>
+
 // ----------------------------------------------------------------------------
 // wxMarkupSpanAttributes: information about attributes for a markup span.
 // ----------------------------------------------------------------------------
@@ -173,4 +175,60 @@ private:
     wxDECLARE_NO_COPY_CLASS(wxMarkupParser);
 };
 
+// ----------------------------------------------------------------------------
+// wxMarkupParsedText: result of parsing markup which can be used many times.
+// ----------------------------------------------------------------------------
+
+// This class stores the sequence of text runs and tags found by the parser in
+// a compact form allowing to pass them to any wxMarkupParserOutput without
+// parsing the markup string again, which is useful when the same markup needs
+// to be processed many times, e.g. for measuring and then drawing it.
+class WXDLLIMPEXP_CORE wxMarkupParsedText
+{
+public:
+    wxMarkupParsedText() = default;
+
+    // Parse the given markup string, replacing the previously stored one.
+    //
+    // Return false if parsing failed, but notice that in this case the part
+    // of the markup preceding the error is still stored and passed to the
+    // output, just as wxMarkupParser::Parse() does it.
+    bool Parse(const wxString& text);
+
+    // Return the result of the last call to Parse().
+    bool IsOk() const { return m_ok; }
+
+    // Call wxMarkupParserOutput methods for all the stored elements, in the
+    // same way as wxMarkupParser::Parse() would have done it.
+    void Output(wxMarkupParserOutput& output) const;
+
+private:
+    // The output object used for recording the parsing results.
+    class Recorder;
+
+    struct Element
+    {
+        enum Kind
+        {
+            Kind_Text,
+            Kind_Tag,
+            Kind_SpanStart,
+            Kind_SpanEnd
+        } kind;
+
+        // Output method to call for Kind_Tag elements.
+        void (wxMarkupParserOutput::*tagFunc)();
+
+        // Index in m_texts for Kind_Text or in m_spans for the span elements.
+        size_t index;
+    };
+
+    std::vector<Element> m_elements;
+    std::vector<wxString> m_texts;
+    std::vector<wxMarkupSpanAttributes> m_spans;
+    bool m_ok = false;
+
+    wxDECLARE_NO_COPY_CLASS(wxMarkupParsedText);
+};
+
 #endif // _WX_PRIVATE_MARKUPPARSER_H_
@@ -0,0 +1,39 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        wx/private/parallel.h
+// Purpose:     Helper for processing ranges of items in parallel
+// Author:      wxWidgets team
+// Created:     2026-10-14
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef _WX_PRIVATE_PARALLEL_H_
+#define _WX_PRIVATE_PARALLEL_H_
+
+#include "wx/defs.h"
+
+#include <functional>
+
+// Call the given function for consecutive, non-overlapping, sub-ranges (bands)
+// of [0, count) range covering all of it, using up to numThreads threads,
+// including the calling one, and return when all bands have been processed.
+//
+// The function is called with the start (inclusive) and the end (exclusive)
+// of the band as arguments. It must be safe to call it from multiple threads
+// simultaneously for different bands.
+//
+// The bands are processed by the worker threads of the global wxThreadPool,
+// which are created on demand and reused, so calling this function is
+// relatively cheap, but it still makes sense only for long running functions.
+// Notice that this means that no more than wxThreadPool::GetMaxThreads()
+// threads, in addition to the calling one, are used.
+//
+// If numThreads is 1 or less, or if the library was compiled without thread
+// support, the function is just called for the entire range in the current
+// thread.
+WXDLLIMPEXP_BASE void
+wxParallelFor(int count,
+              int numThreads,
+              const std::function<void (int start, int end)>& func);
+
+#endif // _WX_PRIVATE_PARALLEL_H_
@@ -0,0 +1,28 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        wx/private/premultiply.h
+// Purpose:     Conversions of pixels to and from premultiplied alpha
+// Author:      wxWidgets team
+// Created:     2026-10-14
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef _WX_PRIVATE_PREMULTIPLY_H_
+#define _WX_PRIVATE_PREMULTIPLY_H_
+
+#include "wx/defs.h"
+
+// The functions below work with 32 bit ARGB pixels in native byte order, i.e.
+// with the format used by Cairo image surfaces among others, and convert them
+// from or to RGBA bytes with alpha which is not premultiplied, as used by
+// GdkPixbuf.
+
+// Premultiply the colour components by alpha for the given number of pixels.
+WXDLLIMPEXP_CORE void wxPremultiplyPixels(wxUint32* p, int count);
+
+// Undo the premultiplication, storing the result as RGBA bytes in the given
+// buffer, which must be big enough to contain 4*count bytes.
+WXDLLIMPEXP_CORE void
+wxUnpremultiplyPixels(const wxUint32* src, unsigned char* dst, int count);
+
+#endif // _WX_PRIVATE_PREMULTIPLY_H_
@@ -0,0 +1,30 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        wx/private/processoutput.h
+// Purpose:     wxProcessOutputReader interface
+// Author:      wxWidgets team
+// Created:     2026-10-15
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef _WX_PRIVATE_PROCESSOUTPUT_H_
+#define _WX_PRIVATE_PROCESSOUTPUT_H_
+
+// This interface is implemented by the platform-specific code reading the
+// output of a child process launched with wxProcess::EnableOutputEvents() and
+// is used by wxProcess to implement its SuspendOutput() and ResumeOutput().
+class wxProcessOutputReader
+{
+public:
+    // Stop reading the output until Resume() is called.
+    virtual void Suspend() = 0;
+
+    // Resume reading the output.
+    virtual void Resume() = 0;
+
+protected:
+    // The objects of this class are never deleted polymorphically.
+    ~wxProcessOutputReader() = default;
+};
+
+#endif // _WX_PRIVATE_PROCESSOUTPUT_H_
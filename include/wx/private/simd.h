@@ -0,0 +1,37 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        wx/private/simd.h
+// Purpose:     Detection of the SIMD instruction sets usable by wx code
+// Author:      wxWidgets team
+// Created:     2026-10-14
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef _WX_PRIVATE_SIMD_H_
+#define _WX_PRIVATE_SIMD_H_
+
+// Only the instruction sets which are guaranteed to be available on all CPUs
+// supported by the target architecture are used, i.e. SSE2 for x86-64 (and
+// x86 when compiling with SSE2 enabled) and NEON (Advanced SIMD) for ARM64, so
+// no run-time checks are needed: if wxHAS_SSE2 or wxHAS_NEON is defined, the
+// corresponding intrinsics can always be used.
+//
+// Predefine wxNO_SIMD to disable the use of SIMD intrinsics in wx code and
+// always use the portable scalar code instead.
+
+#ifndef wxNO_SIMD
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || \
+        (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define wxHAS_SSE2
+
+    #include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    #define wxHAS_NEON
+
+    #include <arm_neon.h>
+#endif
+
+#endif // !wxNO_SIMD
+
+#endif // _WX_PRIVATE_SIMD_H_
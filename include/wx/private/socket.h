@@ -256,6 +256,16 @@ public:
     int Read(void *buffer, int size);
     int Write(const void *buffer, int size);
 
+    // write the data from at most MAX_WRITEV_BUFFERS buffers at once, only
+    // works for stream sockets
+    enum { MAX_WRITEV_BUFFERS = 64 };
+    int WriteV(const wxSocketBuffer *buffers, int count);
+
+    // send the data from the given file descriptor without copying it into
+    // the user space, only works for stream sockets and only under Linux
+    // currently, otherwise returns -1 and sets m_error to wxSOCKET_INVOP
+    int SendFile(int fd, wxFileOffset offset, int size);
+
     // basically a wrapper for select(): returns the condition of the socket,
     // blocking for not longer than timeout if it is specified (otherwise just
     // poll without blocking at all)
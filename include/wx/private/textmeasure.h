@@ -52,6 +52,22 @@ public:
         return GetLargestStringExtent(strings.size(), &strings[0]);
     }
 
+    // Fill the arrays with the extents of all the given, possibly multiline,
+    // strings. This is more efficient than calling GetMultiLineTextExtent()
+    // for each of them as the measuring is set up only once.
+    void GetTextExtents(size_t n,
+                        const wxString* strings,
+                        wxArrayInt& widths,
+                        wxArrayInt* heights = nullptr);
+    void GetTextExtents(const wxArrayString& strings,
+                        wxArrayInt& widths,
+                        wxArrayInt* heights = nullptr)
+    {
+        GetTextExtents(strings.size(),
+                       strings.empty() ? nullptr : &strings[0],
+                       widths, heights);
+    }
+
     // Fill the array with the widths for each "0..N" substrings for N from 1
     // to text.length().
     //
@@ -128,6 +144,13 @@ protected:
                            wxCoord *descent = nullptr,
                            wxCoord *externalLeading = nullptr);
 
+    // The implementation of GetMultiLineTextExtent() which must be called
+    // when the measuring has been already started by MeasuringGuard.
+    void DoGetMultiLineTextExtent(const wxString& text,
+                                  wxCoord *width,
+                                  wxCoord *height,
+                                  wxCoord *heightOneLine = nullptr);
+
     // Get line height: used when the line is empty because CallGetTextExtent()
     // would just return (0, 0) in this case.
     int GetEmptyLineHeight();
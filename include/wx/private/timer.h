@@ -55,6 +55,9 @@ public:
     int GetId() const { return m_idTimer; }
     int GetInterval() const { return m_milli; }
     bool IsOneShot() const { return m_oneShot; }
+    int GetTolerance() const { return m_tolerance; }
+
+    void SetTolerance(int milliseconds) { m_tolerance = milliseconds; }
 
 protected:
     wxTimer *m_timer;
@@ -64,6 +67,7 @@ protected:
     int     m_idTimer;      // id passed to wxTimerEvent
     int     m_milli;        // the timer interval
     bool    m_oneShot;      // true if one shot
+    int     m_tolerance;    // allowed expiration delay, in ms
 
 
     wxDECLARE_NO_COPY_CLASS(wxTimerImpl);
@@ -70,6 +70,22 @@ public:
 
     wxWebRequest::Storage GetStorage() const { return m_storage; }
 
+    void SetDataCallback(const wxWebRequest::DataCallback& callback)
+    {
+        m_dataCallback = callback;
+        m_storage = wxWebRequest::Storage_None;
+    }
+
+    bool HasDataCallback() const { return m_dataCallback != nullptr; }
+
+    // Pass the data to the callback, which must be set, and return its result.
+    bool CallDataCallback(const void* data, size_t size) const
+        { return m_dataCallback(data, size); }
+
+    // Resume receiving the data after the data callback returned false, only
+    // supported by some backends.
+    virtual bool Resume() { return false; }
+
     // Precondition for this method checked by caller: current state is idle.
     virtual void Start() = 0;
 
@@ -103,6 +119,19 @@ public:
 
     void SetState(wxWebRequest::State state, const wxString& failMsg = wxString());
 
+    // Set the URL used as the key for the session cache, if any.
+    void SetURL(const wxString& url) { m_url = url; }
+
+    // Complete the request using the cached response and return true or
+    // prepare it for using the cache after getting the response and return
+    // false if it still needs to be started normally.
+    bool StartUsingCache();
+
+    // Return the cached response if it's used instead of the response
+    // received by the backend, which is returned otherwise.
+    wxWebResponseImplPtr GetEffectiveResponse() const
+        { return m_cachedResponse ? m_cachedResponse : GetResponse(); }
+
     void ReportDataReceived(size_t sizeReceived);
 
     wxEvtHandler* GetHandler() const { return m_handler; }
@@ -113,6 +142,7 @@ protected:
     wxWebRequestHeaderMap m_headers;
     wxFileOffset m_dataSize;
     std::unique_ptr<wxInputStream> m_dataStream;
+    wxWebRequest::DataCallback m_dataCallback;
     bool m_peerVerifyDisabled;
 
     wxWebRequestImpl(wxWebSession& session,
@@ -137,6 +167,10 @@ private:
     // SetState() when leaving it.
     void ProcessStateEvent(wxWebRequest::State state, const wxString& failMsg);
 
+    // Store the completed response in the cache or use the cached one if the
+    // server indicated that it's still valid.
+    void UpdateCache();
+
 
     wxWebSession& m_session;
     wxEvtHandler* const m_handler;
@@ -145,6 +179,16 @@ private:
     wxFileOffset m_bytesReceived;
     wxCharBuffer m_dataText;
 
+    wxString m_url;
+
+    // Only non-null when using the cached response.
+    wxWebResponseImplPtr m_cachedResponse;
+
+    // True if this request uses the session cache and if it was made
+    // conditional to revalidate the cached response.
+    bool m_usingCache = false;
+    bool m_revalidating = false;
+
     // Initially false, set to true after the first call to Cancel().
     bool m_cancelled;
 
@@ -182,6 +226,9 @@ public:
 
     virtual wxString GetDataFile() const;
 
+    virtual wxWebResponseTimings GetTimings() const
+        { return wxWebResponseTimings(); }
+
 protected:
     wxWebRequestImpl& m_request;
     size_t m_readSize;
@@ -256,6 +303,19 @@ public:
 
     virtual bool EnablePersistentStorage(bool WXUNUSED(enable)) { return false; }
 
+    virtual bool EnableMultiplexing(bool WXUNUSED(enable)) { return false; }
+
+    virtual bool SetMaxConnections(int WXUNUSED(maxTotal),
+                                   int WXUNUSED(maxPerHost)) { return false; }
+
+    virtual bool EnableKeepAlive(bool WXUNUSED(enable)) { return false; }
+
+    virtual bool SetDNSCacheTimeout(int WXUNUSED(seconds)) { return false; }
+
+    void SetCache(wxHTTPCache* cache) { m_cache = cache; }
+
+    wxHTTPCache* GetCache() const { return m_cache; }
+
 protected:
     wxWebSessionImpl();
 
@@ -265,6 +325,7 @@ private:
 
     wxWebRequestHeaderMap m_headers;
     wxString m_tempDir;
+    wxHTTPCache* m_cache = nullptr;
 
     wxDECLARE_NO_COPY_CLASS(wxWebSessionImpl);
 };
@@ -64,6 +64,8 @@ public:
 
     wxFileOffset GetBytesExpectedToSend() const override;
 
+    bool Resume() override;
+
     CURL* GetHandle() const { return m_handle; }
 
     wxWebRequestHandle GetNativeHandle() const override
@@ -112,6 +114,8 @@ public:
 
     wxString GetStatusText() const override { return m_statusText; }
 
+    wxWebResponseTimings GetTimings() const override;
+
 
     // Methods called from libcurl callbacks
     size_t CURLOnWrite(void *buffer, size_t size);
@@ -149,6 +153,17 @@ public:
         return (wxWebSessionHandle)m_handle;
     }
 
+    bool EnableMultiplexing(bool enable) override;
+
+    bool SetMaxConnections(int maxTotal, int maxPerHost) override;
+
+    bool EnableKeepAlive(bool enable) override;
+
+    bool SetDNSCacheTimeout(int seconds) override;
+
+    // Apply the options set for this session to a new request handle.
+    void ApplyOptions(CURL* handle) const;
+
     bool StartRequest(wxWebRequestCURL& request);
 
     void CancelRequest(wxWebRequestCURL* request);
@@ -172,6 +187,9 @@ private:
     void StopActiveTransfer(CURL*);
     void RemoveActiveSocket(CURL*);
 
+    // Apply the options set for this session to the multi handle.
+    void ApplyMultiOptions();
+
     using TransferSet = std::unordered_map<CURL*, wxWebRequestCURL*>;
     using CurlSocketMap = std::unordered_map<CURL*, curl_socket_t>;
 
@@ -182,6 +200,15 @@ private:
     wxTimer m_timeoutTimer;
     CURLM* m_handle;
 
+    // Connection options, with negative values meaning that the defaults are
+    // used, except for the DNS cache timeout for which -1 means "forever".
+    int m_multiplexing = -1;
+    long m_maxTotalConnections = -1;
+    long m_maxHostConnections = -1;
+    int m_keepAlive = -1;
+    bool m_hasDNSCacheTimeout = false;
+    long m_dnsCacheTimeout = 0;
+
     static int ms_activeSessions;
     static unsigned int ms_runtimeVersion;
 
@@ -22,6 +22,8 @@
 #include "wx/frame.h"
 #include "wx/dc.h"
 
+#include <map>
+
 class WXDLLIMPEXP_FWD_CORE wxDC;
 class WXDLLIMPEXP_FWD_CORE wxButton;
 class WXDLLIMPEXP_FWD_CORE wxChoice;
@@ -661,12 +663,20 @@ protected:
 
     void InvalidatePreviewBitmap();
 
+    // renders, at idle time, one of the pages adjacent to the current one
+    // into m_pageBitmaps, so that it can be shown without delay
+    void RenderAdjacentPage();
+
 protected:
     wxPrintDialogData m_printDialogData;
     wxPreviewCanvas*  m_previewCanvas;
     wxFrame*          m_previewFrame;
     wxBitmap*         m_previewBitmap;
     bool              m_previewFailed;
+
+    // bitmaps of the pages other than the current one rendered at the
+    // current zoom level, indexed by the page number
+    std::map<int, wxBitmap> m_pageBitmaps;
     wxPrintout*       m_previewPrintout;
     wxPrintout*       m_printPrintout;
     int               m_currentPage;
@@ -686,6 +696,9 @@ protected:
 private:
     void Init(wxPrintout *printout, wxPrintout *printoutForPrinting);
 
+    // shows the current page number in the preview frame status bar
+    void UpdateStatusText(int pageNum);
+
     wxDECLARE_NO_COPY_CLASS(wxPrintPreviewBase);
     wxDECLARE_CLASS(wxPrintPreviewBase);
 };
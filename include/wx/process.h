@@ -18,6 +18,9 @@
 #endif
 
 #include "wx/utils.h"       // for wxSignal
+#include "wx/buffer.h"      // for wxMemoryBuffer
+
+class wxProcessOutputReader;
 
 // the wxProcess creation flags
 enum
@@ -67,12 +70,34 @@ public:
     // may be overridden to be notified about process termination
     virtual void OnTerminate(int pid, int status);
 
+    // may be overridden to handle the process output when using output
+    // events, the default implementation sends wxEVT_PROCESS_OUTPUT
+    virtual void OnOutput(const wxMemoryBuffer& data, bool isError);
+
     // call this before passing the object to wxExecute() to redirect the
     // launched process stdin/stdout, then use GetInputStream() and
     // GetOutputStream() to get access to them
     void Redirect() { m_redirect = true; }
     bool IsRedirected() const { return m_redirect; }
 
+    // call this before passing the object to wxExecute(wxEXEC_ASYNC) to get
+    // the child stdout and stderr contents in wxEVT_PROCESS_OUTPUT events
+    // instead of having to read them from GetInputStream() and
+    // GetErrorStream(), implies Redirect()
+    void EnableOutputEvents(size_t chunkSize = 64*1024)
+    {
+        m_redirect = true;
+        m_outputChunkSize = chunkSize;
+    }
+    bool IsOutputEventsEnabled() const { return m_outputChunkSize != 0; }
+    size_t GetOutputChunkSize() const { return m_outputChunkSize; }
+
+    // temporarily stop reading the child output when using output events,
+    // the child will block when the pipe buffer becomes full until
+    // ResumeOutput() is called
+    void SuspendOutput();
+    void ResumeOutput();
+
     // detach from the parent - should be called by the parent if it's deleted
     // before the process it started terminates
     void Detach();
@@ -124,6 +149,10 @@ public:
     // needs to be public since it needs to be used from wxExecute() global func
     void SetPid(long pid) { m_pid = pid; }
 
+    // used by wxExecute() to associate the object reading the process output
+    // with it when using output events, may be null
+    void SetOutputReader(wxProcessOutputReader* reader);
+
 protected:
     void Init(wxEvtHandler *parent, int id, int flags);
 
@@ -143,6 +172,16 @@ protected:
 
     bool m_redirect;
 
+    // non-zero if output events are used
+    size_t m_outputChunkSize;
+
+    // the object reading the child output if output events are used, may be
+    // null if the process is not running (any longer)
+    wxProcessOutputReader* m_outputReader;
+
+    // true if SuspendOutput() was called
+    bool m_outputSuspended;
+
     wxDECLARE_DYNAMIC_CLASS(wxProcess);
     wxDECLARE_NO_COPY_CLASS(wxProcess);
 };
@@ -152,8 +191,10 @@ protected:
 // ----------------------------------------------------------------------------
 
 class WXDLLIMPEXP_FWD_BASE wxProcessEvent;
+class WXDLLIMPEXP_FWD_BASE wxProcessOutputEvent;
 
 wxDECLARE_EXPORTED_EVENT( WXDLLIMPEXP_BASE, wxEVT_END_PROCESS, wxProcessEvent );
+wxDECLARE_EXPORTED_EVENT( WXDLLIMPEXP_BASE, wxEVT_PROCESS_OUTPUT, wxProcessOutputEvent );
 
 class WXDLLIMPEXP_BASE wxProcessEvent : public wxEvent
 {
@@ -190,4 +231,50 @@ typedef void (wxEvtHandler::*wxProcessEventFunction)(wxProcessEvent&);
 #define EVT_END_PROCESS(id, func) \
    wx__DECLARE_EVT1(wxEVT_END_PROCESS, id, wxProcessEventHandler(func))
 
+// This event is sent when the output of a process using output events, see
+// wxProcess::EnableOutputEvents(), becomes available.
+class WXDLLIMPEXP_BASE wxProcessOutputEvent : public wxEvent
+{
+public:
+    wxProcessOutputEvent(int nId = 0,
+                         int pid = 0,
+                         const wxMemoryBuffer& data = wxMemoryBuffer(),
+                         bool isError = false)
+        : wxEvent(nId, wxEVT_PROCESS_OUTPUT),
+          m_data(data)
+    {
+        m_pid = pid;
+        m_isError = isError;
+    }
+
+    // accessors
+        // PID of process which produced the output
+    int GetPid() const { return m_pid; }
+
+        // the output data, this buffer is not copied when the event is
+        // copied, so it can be retained without copying the data
+    const wxMemoryBuffer& GetData() const { return m_data; }
+
+        // true if this output comes from stderr and not stdout
+    bool IsError() const { return m_isError; }
+
+    // implement the base class pure virtual
+    virtual wxEvent *Clone() const override { return new wxProcessOutputEvent(*this); }
+
+private:
+    int m_pid;
+    wxMemoryBuffer m_data;
+    bool m_isError;
+
+    wxDECLARE_DYNAMIC_CLASS_NO_ASSIGN_DEF_COPY(wxProcessOutputEvent);
+};
+
+typedef void (wxEvtHandler::*wxProcessOutputEventFunction)(wxProcessOutputEvent&);
+
+#define wxProcessOutputEventHandler(func) \
+    wxEVENT_HANDLER_CAST(wxProcessOutputEventFunction, func)
+
+#define EVT_PROCESS_OUTPUT(id, func) \
+   wx__DECLARE_EVT1(wxEVT_PROCESS_OUTPUT, id, wxProcessOutputEventHandler(func))
+
 #endif // _WX_PROCESSH__
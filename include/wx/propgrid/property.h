@@ -1588,6 +1588,10 @@ public:
     // Returns true if property has even one visible child.
     bool HasVisibleChildren() const;
 
+    // Returns true if this is a category whose children haven't been created
+    // yet, see wxPropertyCategory::SetLazyChildren().
+    bool HasLazyChildren() const;
+
     // Use this member function to add independent (i.e. regular) children to
     // a property.
     // Returns inserted childProperty.
@@ -2386,6 +2390,14 @@ public:
 #endif // WXWIN_COMPATIBILITY_3_2
     virtual wxString GetValueAsString(wxPGPropValFormatFlags flags = wxPGPropValFormatFlags::Null) const override;
 
+    // Sets the function creating the children of this category when they are
+    // needed for the first time, i.e. when the category is expanded or a
+    // property is searched for by name. The category is collapsed until then.
+    void SetLazyChildren(const wxPGLazyChildrenFunction& func);
+
+    // Creates the children set up by SetLazyChildren() if not done yet.
+    void CreateLazyChildren();
+
 protected:
     void SetTextColIndex( unsigned int colInd )
         { m_capFgColIndex = (wxByte) colInd; }
@@ -2399,6 +2411,11 @@ protected:
 
 private:
     void Init();
+
+    // Function creating the children, empty if they were already created.
+    wxPGLazyChildrenFunction m_lazyChildren;
+
+    friend class wxPGProperty;
 };
 
 // -----------------------------------------------------------------------
@@ -845,6 +845,18 @@ public:
     // Redraws given property.
     virtual void RefreshProperty( wxPGProperty* p ) override;
 
+    // Starts a batch of changes, e.g. many SetPropertyValue() calls, during
+    // which the changed properties are not redrawn one by one. Must be matched
+    // by a call to EndUpdate(), which redraws all of them at once. The calls
+    // may be nested.
+    void BeginUpdate();
+
+    // Ends the batch of changes started by BeginUpdate().
+    void EndUpdate();
+
+    // Returns true if inside BeginUpdate()/EndUpdate() pair.
+    bool IsUpdating() const { return m_updateLevel > 0; }
+
     // Registers a new editor class.
     // Returns pointer to the editor class instance that should be used.
     static wxPGEditor* RegisterEditorClass( wxPGEditor* editor,
@@ -1572,6 +1584,15 @@ protected:
 
     bool                m_inOnValidationFailure;
 
+    // True if the editor must be refreshed by EndUpdate()
+    bool                m_updateEditor;
+
+    // Nesting level of BeginUpdate() calls
+    int                 m_updateLevel;
+
+    // Area, in logical coordinates, to be redrawn by EndUpdate()
+    wxRect              m_updateRect;
+
     wxPGVFBFlags        m_permanentValidationFailureBehavior;  // Set by app
 
     // DoEditorValidate() recursion guard
@@ -1775,6 +1796,10 @@ protected:
                     unsigned int bottomItemY,
                     const wxRect* itemsRect = nullptr );
 
+    // Refreshes and immediately redraws the given rectangle in logical
+    // (i.e. unscrolled) coordinates.
+    void DoRefreshLogicalRect( wxRect r );
+
     // Translate wxKeyEvent to wxPGKeyboardAction::XXX
     std::pair<wxPGKeyboardAction, wxPGKeyboardAction> KeyEventToActions(const wxKeyEvent& event) const;
 #if WXWIN_COMPATIBILITY_3_2
@@ -20,6 +20,7 @@ class WXDLLIMPEXP_FWD_CORE wxPoint;
 class WXDLLIMPEXP_FWD_CORE wxSize;
 class WXDLLIMPEXP_FWD_CORE wxFont;
 
+#include <functional>
 #include <limits>
 #include <unordered_map>
 
@@ -107,6 +108,11 @@ typedef int (*wxPGSortCallback)(wxPropertyGrid* propGrid,
                                 wxPGProperty* p1,
                                 wxPGProperty* p2);
 
+// This function is used for creating the children of a category only when
+// they are needed, see wxPropertyCategory::SetLazyChildren(). It should add
+// the children to the given category using wxPGProperty::AppendChild().
+typedef std::function<void(wxPGProperty* category)> wxPGLazyChildrenFunction;
+
 
 #if WXWIN_COMPATIBILITY_3_0
 typedef wxString wxPGCachedString;
@@ -465,6 +465,7 @@ class WXDLLIMPEXP_PROPGRID wxPropertyGridPageState
     friend class wxPropertyGridPage;
     friend class wxPropertyGridManager;
     friend class wxPGProperty;
+    friend class wxPropertyCategory;
     friend class wxFlagsProperty;
     friend class wxPropertyGridIteratorBase;
     friend class wxPropertyGridXmlHandler;
@@ -712,6 +713,10 @@ protected:
     // Returns property by its name.
     wxPGProperty* BaseGetPropertyByName(const wxString& name) const;
 
+    // Creates the children of all lazily populated categories, returns true
+    // if any were created.
+    bool DoCreateLazyChildren();
+
     // Returns minimal width for given column so that all images and texts
     // will fit entirely.
     // Used by SetSplitterLeft() and DoFitColumns().
@@ -813,6 +818,9 @@ protected:
     // Used to (temporarily) disable splitter centering.
     bool                        m_dontCenterSplitter;
 
+    // True if there may be categories with not yet created children.
+    bool                        m_hasLazyChildren;
+
 private:
     void InitNonCatMode();
 };
@@ -17,8 +17,11 @@
 #include "wx/protocol/protocol.h"
 #include "wx/buffer.h"
 
+#include <deque>
 #include <unordered_map>
 
+class wxHTTPStream;
+
 class WXDLLIMPEXP_NET wxHTTP : public wxProtocol
 {
 public:
@@ -44,6 +47,17 @@ public:
     bool SetPostBuffer(const wxString& contentType, const wxMemoryBuffer& data);
     void SetProxyMode(bool on);
 
+    // Use persistent HTTP/1.1 connections which are reused for the
+    // subsequent requests, if the server allows it.
+    void SetKeepAlive(bool keepAlive = true) { m_keepAlive = keepAlive; }
+    bool GetKeepAlive() const { return m_keepAlive; }
+
+    // Pipelining support: send the request without waiting for the response
+    // and read the responses later, in the same order.
+    bool SendRequest(const wxString& path);
+    wxInputStream *ReadResponse();
+    size_t GetPendingRequestsCount() const { return m_pendingMethods.size(); }
+
     /* Cookies */
     wxString GetCookie(const wxString& cookie) const;
     bool HasCookies() const { return m_cookies.size() > 0; }
@@ -60,15 +74,28 @@ protected:
     typedef wxCookiesMap::iterator wxCookieIterator;
     typedef wxCookiesMap::const_iterator wxCookieConstIterator;
 
-    bool BuildRequest(const wxString& path, const wxString& method);
-    void SendHeaders();
+    // open a new connection to the server, closing the existing one, if any
+    bool OpenConnection();
+
+    // write the request line, headers and the post data, if any
+    bool WriteRequest(const wxString& path, const wxString& method);
+
+    // read the status line and the headers of the next response, return
+    // false with m_lastError set to wxPROTO_NOFILE for error responses
+    bool ReadResponseHeaders();
     bool ParseHeaders();
 
+    // create the stream for reading the body of the response just read
+    wxHTTPStream *CreateStream(const wxString& method);
+
     wxString GenerateAuthString(const wxString& user, const wxString& pass) const;
 
     // find the header in m_headers
     wxHeaderIterator FindHeader(const wxString& header);
     wxHeaderConstIterator FindHeader(const wxString& header) const;
+
+    // find the header in m_requestHeaders
+    wxHeaderConstIterator FindRequestHeader(const wxString& header) const;
     wxCookieIterator FindCookie(const wxString& cookie);
     wxCookieConstIterator FindCookie(const wxString& cookie) const;
 
@@ -81,7 +108,12 @@ protected:
     wxString m_method;
     wxCookiesMap m_cookies;
 
+    // headers of the last response
     wxHeadersMap m_headers;
+
+    // headers set by SetHeader() and sent with all requests
+    wxHeadersMap m_requestHeaders;
+
     bool m_read,
          m_proxy_mode;
     wxSockAddress *m_addr;
@@ -89,6 +121,19 @@ protected:
     wxString       m_contentType;
     int m_http_response;
 
+    bool m_keepAlive = false;
+
+    // true if the current connection can be used for more requests
+    bool m_canReuse = false;
+
+    // methods of the requests sent but whose responses were not read yet
+    std::deque<wxString> m_pendingMethods;
+
+    // stream for the body of the last response, if it still exists
+    wxHTTPStream *m_stream = nullptr;
+
+    friend class wxHTTPStream;
+
     wxDECLARE_DYNAMIC_CLASS(wxHTTP);
     DECLARE_PROTOCOL(wxHTTP)
     wxDECLARE_NO_COPY_CLASS(wxHTTP);
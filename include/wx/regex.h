@@ -18,6 +18,10 @@
 #include "wx/string.h"
 #include "wx/versioninfo.h"
 
+#include <functional>
+
+class WXDLLIMPEXP_FWD_BASE wxOutputStream;
+
 // ----------------------------------------------------------------------------
 // constants
 // ----------------------------------------------------------------------------
@@ -45,6 +49,10 @@ enum
     // after/before it regardless of the setting of wxRE_NOT[BE]OL
     wxRE_NEWLINE  = 16,
 
+    // use JIT compilation, if available, to make matching faster at the price
+    // of making compilation slower
+    wxRE_JIT      = 256,
+
     // default flags
     wxRE_DEFAULT  = wxRE_EXTENDED
 };
@@ -99,8 +107,7 @@ public:
     //
     // may only be called after successful call to Compile()
     bool Matches(const wxString& text, int flags = 0) const;
-    bool Matches(const wxChar *text, int flags, size_t len) const
-        { return Matches(wxString(text, len), flags); }
+    bool Matches(const wxChar *text, int flags, size_t len) const;
 
     // get the start index and the length of the match of the expression
     // (index 0) or a bracketed subexpression (index != 0)
@@ -144,6 +151,37 @@ public:
     int ReplaceAll(wxString *text, const wxString& replacement) const
         { return Replace(text, replacement, 0); }
 
+    // function called by ForEachMatch() with the start and the length of
+    // each match, it can call GetMatch() to retrieve the subexpressions and
+    // return false to stop iterating
+    using MatchFunction = std::function<bool (size_t start, size_t len)>;
+
+    // call the function for all (or at most maxMatches) non-overlapping
+    // matches in the text without creating any strings, the offsets are in
+    // the same units as used by GetMatch(); returns the number of matches
+    size_t ForEachMatch(const wxString& text,
+                        const MatchFunction& func,
+                        int flags = 0,
+                        size_t maxMatches = 0) const;
+    size_t ForEachMatch(const wxChar *text, size_t len,
+                        const MatchFunction& func,
+                        int flags = 0,
+                        size_t maxMatches = 0) const;
+
+#if wxUSE_STREAMS
+    // replace matches in the text, as Replace() does, but write the result
+    // in UTF-8 to the given stream instead of building a new string; returns
+    // the number of replacements or -1 on error, including stream errors
+    int ReplaceToStream(const wxChar *text, size_t len,
+                        const wxString& replacement,
+                        wxOutputStream& out,
+                        size_t maxMatches = 0) const;
+    int ReplaceToStream(const wxString& text,
+                        const wxString& replacement,
+                        wxOutputStream& out,
+                        size_t maxMatches = 0) const;
+#endif // wxUSE_STREAMS
+
     static wxString QuoteMeta(const wxString& str);
 
     // return the extended RE corresponding to the given basic RE
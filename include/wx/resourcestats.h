@@ -0,0 +1,82 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        wx/resourcestats.h
+// Purpose:     wxResourceStats: count live GDI objects and windows
+// Author:      wxWidgets team
+// Created:     2026-10-15
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef _WX_RESOURCESTATS_H_
+#define _WX_RESOURCESTATS_H_
+
+#include "wx/defs.h"
+#include "wx/string.h"
+
+#include <atomic>
+#include <vector>
+
+class WXDLLIMPEXP_FWD_CORE wxGDIObject;
+class WXDLLIMPEXP_FWD_CORE wxWindowBase;
+
+// ----------------------------------------------------------------------------
+// wxResourceStats: accounting of the live GDI objects and windows
+// ----------------------------------------------------------------------------
+
+// The objects are only tracked while tracking is enabled, so it should be
+// enabled as early as possible, e.g. in wxApp::OnInit(), to get the full
+// picture. The statistics may be retrieved from any thread.
+class WXDLLIMPEXP_CORE wxResourceStats
+{
+public:
+    struct Stats
+    {
+        // The name of the class of the objects, e.g. "wxBitmap".
+        wxString className;
+
+        // Number of the live objects of this class.
+        size_t objects = 0;
+
+        // Number of the native resources used by these objects: for the GDI
+        // objects, this is the number of distinct valid objects, as copies
+        // share the same resource, and for the windows it is the number of
+        // windows with a native handle.
+        size_t resources = 0;
+
+        // Estimated memory used by the resources, in bytes, only computed for
+        // the bitmaps and regions.
+        size_t bytes = 0;
+    };
+
+    // Start or stop tracking the objects. Stopping discards the information
+    // about all the currently tracked objects.
+    static void Enable(bool enable = true);
+    static bool IsEnabled() { return ms_enabled.load(std::memory_order_relaxed); }
+
+    // Return the statistics for the live GDI objects or windows of each class,
+    // sorted in the order of decreasing estimated memory use and then the
+    // number of objects.
+    static std::vector<Stats> GetGDIStats();
+    static std::vector<Stats> GetWindowStats();
+
+    // Get the statistics for the objects of the given class, only considering
+    // the objects of exactly this class, return false if there are none.
+    static bool GetStats(const wxString& className, Stats* stats);
+
+
+    // Implementation only from now on.
+
+    // Called from wxGDIObject and wxWindowBase ctors and dtors when tracking
+    // is enabled.
+    static void OnGDIObjectCreated(const wxGDIObject* obj);
+    static void OnGDIObjectDestroyed(const wxGDIObject* obj);
+    static void OnWindowCreated(const wxWindowBase* win);
+    static void OnWindowDestroyed(const wxWindowBase* win);
+
+private:
+    static std::atomic<bool> ms_enabled;
+
+    wxResourceStats() = delete;
+};
+
+#endif // _WX_RESOURCESTATS_H_
@@ -16,6 +16,8 @@
 #include "wx/ribbon/art.h"
 #include "wx/ribbon/control.h"
 
+#include <unordered_map>
+
 class wxRibbonGalleryItem;
 
 WX_DEFINE_USER_EXPORTED_ARRAY_PTR(wxRibbonGalleryItem*, wxArrayRibbonGalleryItem, class WXDLLIMPEXP_RIBBON);
@@ -48,6 +50,11 @@ public:
     wxRibbonGalleryItem* Append(const wxBitmap& bitmap, int id, void* clientData);
     wxRibbonGalleryItem* Append(const wxBitmap& bitmap, int id, wxClientData* clientData);
 
+    void SetVirtualItemCount(unsigned int count, const wxSize& bitmapSize);
+    bool IsVirtual() const { return m_virtual; }
+    void RefreshItemBitmaps();
+    int GetItemIndex(const wxRibbonGalleryItem* item) const;
+
     void SetItemClientObject(wxRibbonGalleryItem* item, wxClientData* data);
     wxClientData* GetItemClientObject(const wxRibbonGalleryItem* item) const;
     void SetItemClientData(wxRibbonGalleryItem* item, void* data);
@@ -88,6 +95,24 @@ protected:
     void OnSize(wxSizeEvent& evt);
     int GetScrollLineSize() const;
 
+    // Return the bitmap for the given item in virtual mode, this function
+    // must be overridden if SetVirtualItemCount() is used.
+    virtual wxBitmap OnGetItemBitmap(unsigned int n) const;
+
+    // Return the rectangle of the item with the given index, not taking the
+    // scroll position into account.
+    wxRect GetItemRect(unsigned int n) const;
+
+    // Return the index of the item at the given position, which must already
+    // take the scroll position into account, or -1 if there is none.
+    int HitTestItem(const wxPoint& pos) const;
+
+    // Get the range [first, last) of the items currently visible on screen.
+    void GetVisibleItems(unsigned int* first, unsigned int* last) const;
+
+    // Get the bitmap of the item, using the cache in virtual mode.
+    wxBitmap GetItemBitmap(unsigned int n);
+
     virtual wxSize DoGetBestSize() const override;
     virtual wxSize DoGetNextSmallerSize(wxOrientation direction,
                                         wxSize relative_to) const override;
@@ -106,6 +131,8 @@ protected:
     wxRect m_scroll_down_button_rect;
     wxRect m_extension_button_rect;
     const wxRect* m_mouse_active_rect = nullptr;
+    wxRect m_active_item_rect;
+    int m_items_per_line = 0;
     int m_item_separation_x;
     int m_item_separation_y;
     int m_scroll_amount;
@@ -114,6 +141,10 @@ protected:
     wxRibbonGalleryButtonState m_down_button_state;
     wxRibbonGalleryButtonState m_extension_button_state;
     bool m_hovered;
+    bool m_virtual = false;
+
+    // Bitmaps of the recently shown items in virtual mode.
+    std::unordered_map<unsigned int, wxBitmap> m_bitmap_cache;
 
 #ifndef SWIG
     wxDECLARE_CLASS(wxRibbonGallery);
@@ -66,6 +66,9 @@
 #include "wx/variant.h"
 #include "wx/position.h"
 
+#include <memory>
+#include <vector>
+
 #if wxUSE_DATAOBJ
 #include "wx/dataobj.h"
 #endif
@@ -2403,7 +2406,8 @@ public:
     wxRichTextDrawingContext(wxRichTextBuffer* buffer);
 
     void Init()
-    { m_buffer = nullptr; m_enableVirtualAttributes = true; m_enableImages = true; m_layingOut = false; m_enableDelayedImageLoading = false; }
+    { m_buffer = nullptr; m_enableVirtualAttributes = true; m_enableImages = true; m_layingOut = false; m_enableDelayedImageLoading = false;
+      m_incrementalLayout = false; m_incrementalLayoutBottom = -1; m_incrementalLayoutMaxMillis = 0; }
 
     /**
         Does this object have virtual attributes?
@@ -2497,6 +2501,42 @@ public:
 
     bool GetDelayedImageLoading() const { return m_enableDelayedImageLoading; }
 
+    /**
+        Enables or disables incremental layout.
+
+        When incremental layout is enabled, laying out the top-level container
+        stops once a paragraph starting below @a bottom has been laid out (if
+        @a bottom is not -1) or once @a maxMillis milliseconds have elapsed
+        (if @a maxMillis is not 0). Positioning the remaining paragraphs is
+        deferred until the next layout, see
+        wxRichTextParagraphLayoutBox::HasDeferredLayout().
+
+        @since 3.3.0
+    */
+
+    void EnableIncrementalLayout(bool b, int bottom = -1, int maxMillis = 0)
+    { m_incrementalLayout = b; m_incrementalLayoutBottom = bottom; m_incrementalLayoutMaxMillis = maxMillis; }
+
+    /**
+        Returns @true if incremental layout is enabled.
+    */
+
+    bool GetIncrementalLayout() const { return m_incrementalLayout; }
+
+    /**
+        Returns the bottom of the area which must be laid out during incremental
+        layout, or -1 if there is no such limit.
+    */
+
+    int GetIncrementalLayoutBottom() const { return m_incrementalLayoutBottom; }
+
+    /**
+        Returns the maximal duration of incremental layout in milliseconds, or 0
+        if there is no such limit.
+    */
+
+    int GetIncrementalLayoutMaxMillis() const { return m_incrementalLayoutMaxMillis; }
+
     /**
         Returns the buffer pointer.
     */
@@ -2508,6 +2548,92 @@ public:
     bool                m_enableImages;
     bool                m_enableDelayedImageLoading;
     bool                m_layingOut;
+    bool                m_incrementalLayout;
+    int                 m_incrementalLayoutBottom;
+    int                 m_incrementalLayoutMaxMillis;
+};
+
+struct wxRichTextSharedAttrData;
+
+/**
+    @class wxRichTextSharedAttr
+
+    Holds the attributes of a rich text object, sharing them with all the
+    other objects having the same attributes.
+
+    Documents typically contain many objects but only a few distinct styles,
+    so the attributes are kept in a global table and each object only refers
+    to an entry in it. The attributes are copied on write: getting a
+    non-const reference to them with GetWritable() makes them unique to this
+    object until Share() is called.
+
+    @library{wxrichtext}
+    @category{richtext}
+
+    @see wxRichTextObject::GetAttributes()
+*/
+
+class WXDLLIMPEXP_RICHTEXT wxRichTextSharedAttr
+{
+public:
+    /**
+        Default constructor, uses the default, empty, attributes.
+    */
+    wxRichTextSharedAttr();
+
+    /**
+        Constructor sharing the attributes equal to the given ones.
+    */
+    wxRichTextSharedAttr(const wxRichTextAttr& attr);
+
+    /**
+        Copy constructor.
+    */
+    wxRichTextSharedAttr(const wxRichTextSharedAttr& other);
+
+    /**
+        Assignment operators.
+    */
+    wxRichTextSharedAttr& operator=(const wxRichTextSharedAttr& other);
+    wxRichTextSharedAttr& operator=(const wxRichTextAttr& attr);
+
+    ~wxRichTextSharedAttr();
+
+    /**
+        Returns the attributes, which may be shared with other objects.
+    */
+    const wxRichTextAttr& Get() const;
+
+    /**
+        Returns the attributes which can be modified, copying them first if
+        they're currently shared.
+
+        The returned reference remains valid until this object is changed or
+        Share() is called.
+    */
+    wxRichTextAttr& GetWritable();
+
+    /**
+        Shares the attributes made unique to this object by GetWritable() with
+        the other objects using the same attributes again.
+    */
+    void Share();
+
+    /**
+        Returns @true if the attributes are shared, i.e.\ not modifiable.
+    */
+    bool IsShared() const;
+
+    /**
+        Returns the number of distinct attributes currently shared by all
+        objects.
+    */
+    static size_t GetSharedCount();
+
+private:
+    void Release();
+
+    wxRichTextSharedAttrData* m_data;
 };
 
 /**
@@ -2925,12 +3051,33 @@ public:
     /**
         Returns the object's attributes.
     */
-    const wxRichTextAttr& GetAttributes() const { return m_attributes; }
+    const wxRichTextAttr& GetAttributes() const { return m_attributes.Get(); }
 
     /**
         Returns the object's attributes.
+
+        The attributes are copied when calling this function if they are
+        shared with other objects, so prefer using GetSharedAttributes() if
+        they don't need to be modified. The returned reference remains valid
+        until the next change to the buffer.
     */
-    wxRichTextAttr& GetAttributes() { return m_attributes; }
+    wxRichTextAttr& GetAttributes() { return m_attributes.GetWritable(); }
+
+    /**
+        Returns the object's attributes without copying them, even when
+        called for a non-const object.
+    */
+    const wxRichTextAttr& GetSharedAttributes() const { return m_attributes.Get(); }
+
+    /**
+        Shares the attributes of this object, and its children for composite
+        objects, with the other objects using the same attributes again after
+        modifying them.
+
+        This is done automatically after executing the commands and loading
+        files.
+    */
+    virtual void ShareAttributes() { m_attributes.Share(); }
 
     /**
         Returns the object's properties.
@@ -3089,7 +3236,7 @@ protected:
     wxRichTextRange         m_ownRange;
 
     // Attributes
-    wxRichTextAttr          m_attributes;
+    wxRichTextSharedAttr    m_attributes;
 
     // Properties
     wxRichTextProperties    m_properties;
@@ -3135,6 +3282,8 @@ public:
 
     virtual void Invalidate(const wxRichTextRange& invalidRange = wxRICHTEXT_ALL) override;
 
+    virtual void ShareAttributes() override;
+
 // Accessors
 
     /**
@@ -3759,7 +3908,7 @@ public:
         applied (for example, setting the default style to bold will cause
         subsequently inserted text to be bold).
     */
-    virtual const wxRichTextAttr& GetBasicStyle() const { return m_attributes; }
+    virtual const wxRichTextAttr& GetBasicStyle() const { return m_attributes.Get(); }
 
     /**
         Invalidates the buffer. With no argument, invalidates whole buffer.
@@ -3793,6 +3942,20 @@ public:
     */
     bool IsDirty() const { return m_invalidRange != wxRICHTEXT_NONE; }
 
+    /**
+        Returns @true if positioning some paragraphs was deferred by an
+        incremental layout and will be done by the next call to Layout().
+
+        @see wxRichTextDrawingContext::EnableIncrementalLayout()
+    */
+    bool HasDeferredLayout() const { return m_deferredLayoutStart != -1; }
+
+    /**
+        Returns the start of the first paragraph whose position may be out of
+        date because its layout was deferred, or -1 if there is none.
+    */
+    long GetDeferredLayoutStart() const { return m_deferredLayoutStart; }
+
     /**
         Returns the wxRichTextFloatCollector of this object.
     */
@@ -3815,6 +3978,11 @@ protected:
     // The invalidated range that will need full layout
     wxRichTextRange m_invalidRange;
 
+    // The start of the paragraphs whose layout was deferred by incremental
+    // layout and whether they need to be laid out again or only moved.
+    long            m_deferredLayoutStart;
+    bool            m_deferredRelayout;
+
     // Is the last paragraph partial or complete?
     bool            m_partialParagraph;
 
@@ -4710,7 +4878,7 @@ public:
 
     virtual bool DeleteRange(const wxRichTextRange& range) override;
 
-    virtual bool IsEmpty() const override { return m_text.empty(); }
+    virtual bool IsEmpty() const override { return m_length == 0; }
 
     virtual bool CanMerge(wxRichTextObject* object, wxRichTextDrawingContext& context) const override;
 
@@ -4748,13 +4916,24 @@ public:
 
     /**
         Returns the text.
+
+        The text is stored as a sequence of pieces of immutable strings which
+        may be shared with other objects, so that splitting, merging and
+        copying the objects doesn't copy the text itself. This function joins
+        the pieces together if necessary, prefer using GetTextLength() or
+        GetTextForRange() if the whole text is not needed.
+    */
+    const wxString& GetText() const;
+
+    /**
+        Returns the length of the text.
     */
-    const wxString& GetText() const { return m_text; }
+    size_t GetTextLength() const { return m_length; }
 
     /**
         Sets the text.
     */
-    void SetText(const wxString& text) { m_text = text; }
+    void SetText(const wxString& text);
 
 // Operations
 
@@ -4768,7 +4947,28 @@ private:
     bool DrawTabbedString(wxDC& dc, const wxRichTextAttr& attr, const wxRect& rect, wxString& str, wxCoord& x, wxCoord& y, bool selected);
 
 protected:
-    wxString    m_text;
+    // Part of the text of this object stored in a possibly shared buffer.
+    struct Piece
+    {
+        Piece(const std::shared_ptr<const wxString>& buffer_, size_t start_, size_t length_)
+            : buffer(buffer_), start(start_), length(length_) { }
+
+        std::shared_ptr<const wxString> buffer;
+        size_t start;
+        size_t length;
+    };
+
+    // Returns the given part of the text without joining all the pieces.
+    wxString DoGetText(size_t start, size_t length) const;
+
+    // Moves the text after the given index to the provided vector.
+    void DoSplitPieces(size_t index, std::vector<Piece>& tail);
+
+    // Appends the given pieces to the text.
+    void DoAppendPieces(const std::vector<Piece>& pieces);
+
+    mutable std::vector<Piece> m_pieces;
+    size_t      m_length;
 };
 
 /**
@@ -6386,6 +6586,9 @@ public:
     void SetFreeze(bool freeze) { m_freeze = freeze; }
 
 protected:
+    // Shares the attributes of the objects in the containers changed by the
+    // actions again after executing them.
+    void ShareAttributes();
 
     wxList  m_actions;
     bool    m_freeze;
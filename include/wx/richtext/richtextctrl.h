@@ -23,6 +23,8 @@
 #include "wx/dnd.h"
 #endif
 
+#include <memory>
+
 #if !defined(__WXGTK__) && !defined(__WXMAC__)
 #define wxRICHTEXT_BUFFERED_PAINTING 1
 #else
@@ -30,6 +32,7 @@
 #endif
 
 class WXDLLIMPEXP_FWD_RICHTEXT wxRichTextStyleDefinition;
+class wxRichTextAsyncLoad;
 
 /*
  * Styles and flags
@@ -78,6 +81,8 @@ class WXDLLIMPEXP_FWD_RICHTEXT wxRichTextStyleDefinition;
 #define wxRICHTEXT_DEFAULT_DELAYED_LAYOUT_THRESHOLD 20000
 // Milliseconds before layout occurs after resize
 #define wxRICHTEXT_DEFAULT_LAYOUT_INTERVAL 50
+// Milliseconds of deferred layout done at once in idle time
+#define wxRICHTEXT_DEFAULT_LAYOUT_TIME_SLICE 20
 // Milliseconds before delayed image processing occurs
 #define wxRICHTEXT_DEFAULT_DELAYED_IMAGE_PROCESSING_INTERVAL 200
 
@@ -386,7 +391,7 @@ public:
 
     /**
         Forces any pending layout due to delayed, partial layout when the control
-        was resized.
+        was resized or edited.
     */
     void ForceDelayedLayout();
 
@@ -583,6 +588,37 @@ public:
         This function looks for a suitable wxRichTextFileHandler object.
     */
     virtual bool DoLoadFile(const wxString& file, int fileType) override;
+
+    /**
+        Loads content into the control's buffer in the background.
+
+        The file is parsed into a separate buffer, in a worker thread if
+        possible, and the current content of the control is replaced with it
+        once it's fully loaded, after which @c wxEVT_RICHTEXT_FILE_LOADED is
+        generated. The control remains usable while the file is being loaded
+        but any changes done to its content in the meanwhile are lost.
+
+        Only the handlers which can be created dynamically, such as
+        wxRichTextXMLHandler, are used in the worker thread, the file is
+        loaded synchronously, but the event is still generated later, when
+        using the other ones.
+
+        Calling LoadFile(), LoadFileAsync() or destroying the control cancels
+        any file which is still being loaded.
+
+        Returns @false if there is no handler able to load this file.
+
+        @since 3.3.0
+    */
+    bool LoadFileAsync(const wxString& file, int type = wxRICHTEXT_TYPE_ANY);
+
+    /**
+        Returns @true if a file started loading by LoadFileAsync() hasn't been
+        loaded yet.
+
+        @since 3.3.0
+    */
+    bool IsLoadingFile() const { return m_asyncLoad != nullptr; }
 #endif // wxUSE_FFILE && wxUSE_STREAMS
 
 #ifdef DOXYGEN
@@ -1417,6 +1453,19 @@ public:
     */
     virtual bool LayoutContent(bool onlyVisibleRect = false);
 
+    /**
+        Lays out the buffer after it has been edited.
+
+        For buffers bigger than GetDelayedLayoutThreshold(), only the modified
+        paragraphs and the visible part of the buffer are laid out immediately,
+        while positioning the rest of the paragraphs is deferred and done in
+        idle time, which keeps editing large documents fast.
+        For smaller buffers this is the same as LayoutContent().
+
+        @since 3.3.0
+    */
+    bool LayoutContentIncrementally();
+
     /**
         Implements layout. An application may override this to perform operations before or after layout.
     */
@@ -2303,6 +2352,27 @@ protected:
 #endif
 #endif // !__WXUNIVERSAL__
 
+    // The ways of laying out the buffer used by DoLayoutContent().
+    enum LayoutContentMode
+    {
+        LayoutContent_Full,         // Lay out everything.
+        LayoutContent_VisibleRect,  // Only the visible part, when resizing.
+        LayoutContent_Visible,      // Up to the bottom of the visible part.
+        LayoutContent_TimeSlice     // For wxRICHTEXT_DEFAULT_LAYOUT_TIME_SLICE.
+    };
+
+    // Lays out the buffer in the given way.
+    void DoLayoutContent(LayoutContentMode mode);
+
+#if wxUSE_FFILE && wxUSE_STREAMS
+    // Replaces the buffer content with the file loaded by LoadFileAsync().
+    void OnAsyncLoadDone(std::shared_ptr<wxRichTextAsyncLoad> load);
+
+    // Cancels the file being loaded by LoadFileAsync(), if any, and waits
+    // until the worker thread stops using it.
+    void CancelAsyncLoad();
+#endif // wxUSE_FFILE && wxUSE_STREAMS
+
 // Overrides
 protected:
 
@@ -2386,6 +2456,9 @@ protected:
     /// Threshold for doing delayed layout
     long                    m_delayedLayoutThreshold;
 
+    /// The file being loaded by LoadFileAsync(), if any
+    std::shared_ptr<wxRichTextAsyncLoad> m_asyncLoad;
+
     /// Cursors
     wxCursor                m_textCursor;
     wxCursor                m_urlCursor;
@@ -2514,6 +2587,12 @@ protected:
         Process a @c wxEVT_RICHTEXT_BUFFER_RESET event, generated when the
         buffer has been reset by deleting all content.
         You can use this to set a default style for the first new paragraph.
+    @event{EVT_RICHTEXT_FILE_LOADED(id, func)}
+        Process a @c wxEVT_RICHTEXT_FILE_LOADED event, generated when loading
+        the file started by wxRichTextCtrl::LoadFileAsync() has finished.
+        Valid event functions: GetString, returning the file name, and GetInt,
+        returning non-zero if the file was loaded successfully.
+        This event is available since wxWidgets 3.3.0.
     @event{EVT_RICHTEXT_SELECTION_CHANGED(id, func)}
         Process a @c wxEVT_RICHTEXT_SELECTION_CHANGED event, generated when the
         selection range has changed.
@@ -2683,6 +2762,7 @@ wxDECLARE_EXPORTED_EVENT( WXDLLIMPEXP_RICHTEXT, wxEVT_RICHTEXT_PROPERTIES_CHANGE
 wxDECLARE_EXPORTED_EVENT( WXDLLIMPEXP_RICHTEXT, wxEVT_RICHTEXT_SELECTION_CHANGED, wxRichTextEvent );
 wxDECLARE_EXPORTED_EVENT( WXDLLIMPEXP_RICHTEXT, wxEVT_RICHTEXT_BUFFER_RESET, wxRichTextEvent );
 wxDECLARE_EXPORTED_EVENT( WXDLLIMPEXP_RICHTEXT, wxEVT_RICHTEXT_FOCUS_OBJECT_CHANGED, wxRichTextEvent );
+wxDECLARE_EXPORTED_EVENT( WXDLLIMPEXP_RICHTEXT, wxEVT_RICHTEXT_FILE_LOADED, wxRichTextEvent );
 
 typedef void (wxEvtHandler::*wxRichTextEventFunction)(wxRichTextEvent&);
 
@@ -2710,6 +2790,7 @@ typedef void (wxEvtHandler::*wxRichTextEventFunction)(wxRichTextEvent&);
 #define EVT_RICHTEXT_SELECTION_CHANGED(id, fn) wxDECLARE_EVENT_TABLE_ENTRY( wxEVT_RICHTEXT_SELECTION_CHANGED, id, -1, wxRichTextEventHandler( fn ), nullptr ),
 #define EVT_RICHTEXT_BUFFER_RESET(id, fn) wxDECLARE_EVENT_TABLE_ENTRY( wxEVT_RICHTEXT_BUFFER_RESET, id, -1, wxRichTextEventHandler( fn ), nullptr ),
 #define EVT_RICHTEXT_FOCUS_OBJECT_CHANGED(id, fn) wxDECLARE_EVENT_TABLE_ENTRY( wxEVT_RICHTEXT_FOCUS_OBJECT_CHANGED, id, -1, wxRichTextEventHandler( fn ), nullptr ),
+#define EVT_RICHTEXT_FILE_LOADED(id, fn) wxDECLARE_EVENT_TABLE_ENTRY( wxEVT_RICHTEXT_FILE_LOADED, id, -1, wxRichTextEventHandler( fn ), nullptr ),
 
 // old wxEVT_COMMAND_* constants
 #define wxEVT_COMMAND_RICHTEXT_LEFT_CLICK             wxEVT_RICHTEXT_LEFT_CLICK
@@ -110,11 +110,11 @@ public:
     virtual ~wxRichTextPrintout();
 
     /// The buffer to print
-    void SetRichTextBuffer(wxRichTextBuffer* buffer) { m_richTextBuffer = buffer; }
+    void SetRichTextBuffer(wxRichTextBuffer* buffer) { m_richTextBuffer = buffer; InvalidatePageBreaks(); }
     wxRichTextBuffer* GetRichTextBuffer() const { return m_richTextBuffer; }
 
     /// Set/get header/footer data
-    void SetHeaderFooterData(const wxRichTextHeaderFooterData& data) { m_headerFooterData = data; }
+    void SetHeaderFooterData(const wxRichTextHeaderFooterData& data) { m_headerFooterData = data; InvalidatePageBreaks(); }
     const wxRichTextHeaderFooterData& GetHeaderFooterData() const { return m_headerFooterData; }
 
     /// Sets margins in 10ths of millimetre. Defaults to 1 inch for margins.
@@ -138,6 +138,9 @@ private:
     /// Substitute keywords
     static bool SubstituteKeywords(wxString& str, const wxString& title, int pageNum, int pageCount);
 
+    /// Forces the page breaks to be recomputed by the next OnPreparePrinting()
+    void InvalidatePageBreaks() { m_pageBreaksRect = wxRect(); }
+
 private:
 
     wxRichTextBuffer*           m_richTextBuffer;
@@ -145,6 +148,11 @@ private:
     wxArrayInt                  m_pageBreaksStart;
     wxArrayInt                  m_pageBreaksEnd;
     wxArrayInt                  m_pageYOffsets;
+
+    /// The text rectangle and the buffer scale used for computing the page
+    /// breaks, allowing to reuse them if the page setup doesn't change
+    wxRect                      m_pageBreaksRect;
+    double                      m_pageBreaksScale;
     int                         m_marginLeft, m_marginTop, m_marginRight, m_marginBottom;
 
     wxRichTextHeaderFooterData  m_headerFooterData;
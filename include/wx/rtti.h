@@ -21,10 +21,10 @@
 class WXDLLIMPEXP_FWD_BASE wxObject;
 class WXDLLIMPEXP_FWD_BASE wxString;
 class WXDLLIMPEXP_FWD_BASE wxClassInfo;
-class WXDLLIMPEXP_FWD_BASE wxHashTable;
 class WXDLLIMPEXP_FWD_BASE wxObject;
 class WXDLLIMPEXP_FWD_BASE wxPluginLibrary;
-class WXDLLIMPEXP_FWD_BASE wxHashTable_Node;
+
+#include <atomic>
 
 // ----------------------------------------------------------------------------
 // wxClassInfo
@@ -47,6 +47,9 @@ public:
         , m_objectConstructor(ctor)
         , m_baseInfo1(baseInfo1)
         , m_baseInfo2(baseInfo2)
+        , m_classId(-1)
+        , m_lastDescendantId(-1)
+        , m_hasSecondaryBases(false)
         , m_next(sm_first)
         {
             sm_first = this;
@@ -74,10 +77,69 @@ public:
     const wxClassInfo         *GetNext() const { return m_next; }
     static wxClassInfo        *FindClass(const wxString& className);
 
+    bool IsKindOf(const wxClassInfo *info) const
+    {
+        if ( info == this )
+            return true;
+
+        if ( !info )
+            return false;
+
+        // Use the precomputed class IDs if we have them: they are assigned
+        // in depth-first order of the primary base classes hierarchy, so
+        // the IDs of all classes deriving from the given one are in the
+        // range [info->m_classId, info->m_lastDescendantId].
+        const int classId = m_classId.load(std::memory_order_acquire);
+        if ( classId != -1 )
+        {
+            const int infoId = info->m_classId.load(std::memory_order_acquire);
+            if ( infoId != -1 )
+            {
+                if ( infoId <= classId && classId <= info->m_lastDescendantId )
+                    return true;
+
+                // If neither this class nor any of its bases use multiple
+                // inheritance, the check above is definitive.
+                if ( !m_hasSecondaryBases )
+                    return false;
+            }
+        }
+
+        return DoIsKindOf(info);
+    }
+
+    // iterator interface: iterates over all classes in alphabetical order
+    class WXDLLIMPEXP_BASE const_iterator
+    {
+    public:
+        typedef const wxClassInfo* value_type;
+        typedef const value_type& const_reference;
+        typedef const_iterator itor;
+        typedef value_type* ptr_type;
+        typedef const_reference reference_type;
+        typedef ptr_type pointer_type;
+
+        explicit const_iterator(size_t index = static_cast<size_t>(-1))
+            : m_index(index) { }
+
+        value_type operator*() const;
+        itor& operator++();
+        const itor operator++(int);
+        bool operator!=(const itor& it) const { return it.m_index != m_index; }
+        bool operator==(const itor& it) const { return it.m_index == m_index; }
+
+    private:
+        size_t m_index;
+    };
+
+    static const_iterator begin_classinfo();
+    static const_iterator end_classinfo();
+
+private:
         // Climb upwards through inheritance hierarchy.
         // Dual inheritance is catered for.
 
-    bool IsKindOf(const wxClassInfo *info) const
+    bool DoIsKindOf(const wxClassInfo *info) const
     {
         if ( info == this )
             return true;
@@ -97,9 +159,6 @@ public:
         return false;
     }
 
-    wxDECLARE_CLASS_INFO_ITERATORS();
-
-private:
     const wxChar            *m_className;
     int                      m_objectSize;
     wxObjectConstructorFn    m_objectConstructor;
@@ -109,17 +168,34 @@ private:
     const wxClassInfo       *m_baseInfo1;
     const wxClassInfo       *m_baseInfo2;
 
+        // Precomputed data used by IsKindOf(), only set once by
+        // BuildClassTable() and not modified afterwards: m_classId remains -1
+        // for the classes registered after the table was built for the first
+        // time, and for which IsKindOf() has to walk the base classes.
+
+    std::atomic<int>         m_classId;
+    int                      m_lastDescendantId;
+    bool                     m_hasSecondaryBases;
+
         // class info object live in a linked list:
         // pointers to its head and the next element in it
 
     static wxClassInfo      *sm_first;
     wxClassInfo             *m_next;
 
-    static wxHashTable      *sm_classTable;
+        // Set when a class is registered or unregistered and the table of
+        // all classes sorted by name needs to be rebuilt.
+
+    static std::atomic<bool> sm_classTableDirty;
+
+    // (re)build the sorted table of all classes if necessary and, when it's
+    // done for the first time, assign the class IDs used by IsKindOf()
+    static void BuildClassTable();
 
 protected:
-    // registers the class
-    void Register();
+    // registers the class: this only marks the class table as needing to be
+    // rebuilt, which is done on demand, to make static initialization cheap
+    void Register() { sm_classTableDirty = true; }
     void Unregister();
 
     wxDECLARE_NO_COPY_CLASS(wxClassInfo);
@@ -12,6 +12,8 @@
 
 #include "wx/dynarray.h"
 
+#include <vector>
+
 // ----------------------------------------------------------------------------
 // wxSelectedIndices is just a sorted array of indices
 // ----------------------------------------------------------------------------
@@ -28,23 +30,23 @@ WX_DEFINE_SORTED_EXPORTED_ARRAY_CMP_INT(unsigned, wxUIntCmp, wxSelectedIndices);
 // controls, i.e. it is well suited for storing even when the control contains
 // a huge (practically infinite) number of items.
 //
-// Of course, internally it still has to store the selected items somehow (as
-// an array currently) but the advantage is that it can handle the selection
-// of all items (common operation) efficiently and that it could be made even
-// smarter in the future (e.g. store the selections as an array of ranges +
-// individual items) without changing its API.
+// Internally it stores the ranges of consecutive items whose state differs
+// from the default one, which can be either selected or not, so that both
+// selecting all items and selecting or deselecting big ranges of them is
+// handled efficiently. Checking whether an item is selected takes logarithmic
+// time in the number of such ranges.
 // ----------------------------------------------------------------------------
 
 class WXDLLIMPEXP_CORE wxSelectionStore
 {
 public:
-    wxSelectionStore() : m_itemsSel(wxUIntCmp) { Init(); }
+    wxSelectionStore() { Init(); }
 
     // set the total number of items we handle
     void SetItemCount(unsigned count);
 
     // special case of SetItemCount(0)
-    void Clear() { m_itemsSel.Clear(); m_count = 0; m_defaultState = false; }
+    void Clear() { m_ranges.clear(); Init(); }
 
     // must be called when new items are inserted/added
     void OnItemsInserted(unsigned item, unsigned numItems);
@@ -77,20 +79,14 @@ public:
     // return true if no items are currently selected
     bool IsEmpty() const
     {
-        return m_defaultState ? m_itemsSel.size() == m_count
-                              : m_itemsSel.empty();
+        return m_defaultState ? m_numNonDefault == m_count
+                              : m_numNonDefault == 0;
     }
 
     // return the total number of selected items
     unsigned GetSelectedCount() const
     {
-        // we can we never have more than UINT_MAX selected items, knowing that
-        // we store the total number of items in an unsigned m_count, so the
-        // cast is safe.
-        return static_cast<unsigned>(
-                m_defaultState ? m_count - m_itemsSel.GetCount()
-                               : m_itemsSel.GetCount()
-                );
+        return m_defaultState ? m_count - m_numNonDefault : m_numNonDefault;
     }
 
     // type of a "cookie" used to preserve the iteration state, this is an
@@ -106,20 +102,62 @@ public:
     // get the next selected item, return NO_SELECTION if no more
     unsigned GetNextSelectedItem(IterationState& cookie) const;
 
+    // get the first selected item greater or equal to the given one, return
+    // NO_SELECTION if none
+    unsigned FindSelectedItem(unsigned item) const;
+
+    // get the first range of consecutive selected items in index order, with
+    // both ends inclusive, return false if there are no selected items
+    bool GetFirstSelectedRange(IterationState& cookie,
+                               unsigned& from, unsigned& to) const;
+
+    // get the next range of selected items, return false if no more
+    bool GetNextSelectedRange(IterationState& cookie,
+                              unsigned& from, unsigned& to) const;
+
 private:
+    // range of items, both ends inclusive
+    struct Range
+    {
+        unsigned from, to;
+    };
+
+    typedef std::vector<Range> Ranges;
+
     // (re)init
-    void Init() { m_count = 0; m_defaultState = false; }
+    void Init() { m_count = 0; m_numNonDefault = 0; m_defaultState = false; }
+
+    // return the index of the first range ending at or after the given item
+    size_t FindRange(unsigned item) const;
+
+    // change the state of the given items from default to non-default one or
+    // vice versa and return the number of items whose state changed
+    //
+    // if itemsChanged is non-null, the indices of these items are added to it
+    // until its size reaches MANY_ITEMS
+    unsigned SetNonDefault(unsigned itemFrom, unsigned itemTo,
+                           wxArrayInt *itemsChanged = nullptr);
+    unsigned SetDefault(unsigned itemFrom, unsigned itemTo,
+                        wxArrayInt *itemsChanged = nullptr);
+
+    // invert the default state of all items while preserving their selection
+    // state
+    void InvertDefaultState();
 
     // the total number of items we handle
     unsigned m_count;
 
+    // the total number of items in m_ranges
+    unsigned m_numNonDefault;
+
     // the default state: normally, false (i.e. off) but maybe set to true if
     // there are more selected items than non selected ones - this allows to
     // handle selection of all items efficiently
     bool m_defaultState;
 
-    // the array of items whose selection state is different from default
-    wxSelectedIndices m_itemsSel;
+    // the sorted ranges of items whose selection state is different from
+    // default, they never overlap nor are adjacent to each other
+    Ranges m_ranges;
 
     wxDECLARE_NO_COPY_CLASS(wxSelectionStore);
 };
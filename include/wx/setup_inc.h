@@ -542,6 +542,20 @@
 // Recommended setting: 1 if you need LZMA compression.
 #define wxUSE_LIBLZMA       0
 
+// Use libzstd (Zstandard) and liblz4 libraries for providing
+// wxZstdInputStream/wxZstdOutputStream and wxLZ4InputStream/wxLZ4OutputStream
+// classes respectively.
+//
+// As with wxUSE_LIBLZMA above, the headers and libraries of the corresponding
+// library must be available when enabling these options without using
+// configure or CMake.
+//
+// Default is 0 under MSW, auto-detected by configure.
+//
+// Recommended setting: 1 if you need Zstandard or LZ4 compression.
+#define wxUSE_LIBZSTD       0
+#define wxUSE_LIBLZ4        0
+
 // If enabled, the code written by Apple will be used to write, in a portable
 // way, float on the disk. See extended.c for the license which is different
 // from wxWidgets one.
@@ -0,0 +1,132 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        wx/shmipc.h
+// Purpose:     wxIPC implementation using shared memory
+// Author:      wxWidgets team
+// Created:     2026-10-15
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef _WX_SHMIPC_H_
+#define _WX_SHMIPC_H_
+
+#include "wx/defs.h"
+
+// This implementation uses POSIX shared memory and process-shared pthread
+// synchronization objects and so is only available under Unix.
+#if wxUSE_IPC && wxUSE_THREADS && defined(__UNIX__)
+
+#define wxHAS_SHARED_MEMORY_IPC
+
+#include "wx/ipcbase.h"
+
+class WXDLLIMPEXP_FWD_BASE wxSharedMemoryServer;
+class WXDLLIMPEXP_FWD_BASE wxSharedMemoryClient;
+
+class wxSharedMemoryIPCImpl;
+class wxSharedMemoryServerImpl;
+
+// ----------------------------------------------------------------------------
+// wxSharedMemoryConnection: connection exchanging data via shared memory
+// ----------------------------------------------------------------------------
+
+class WXDLLIMPEXP_BASE wxSharedMemoryConnection : public wxConnectionBase
+{
+public:
+    wxSharedMemoryConnection() = default;
+    wxSharedMemoryConnection(void *buffer, size_t size)
+        : wxConnectionBase(buffer, size)
+    {
+    }
+
+    virtual ~wxSharedMemoryConnection();
+
+    // implement base class pure virtual methods
+    virtual const void *Request(const wxString& item,
+                                size_t *size = nullptr,
+                                wxIPCFormat format = wxIPC_TEXT) override;
+    virtual bool StartAdvise(const wxString& item) override;
+    virtual bool StopAdvise(const wxString& item) override;
+    virtual bool Disconnect() override;
+
+protected:
+    virtual bool DoExecute(const void *data, size_t size, wxIPCFormat format) override;
+    virtual bool DoPoke(const wxString& item, const void *data, size_t size,
+                        wxIPCFormat format) override;
+    virtual bool DoAdvise(const wxString& item, const void *data, size_t size,
+                          wxIPCFormat format) override;
+
+private:
+    // only initialized once the connection is established, i.e. in
+    // MakeConnection() for the client objects and after OnAcceptConnection()
+    // in the server ones
+    wxSharedMemoryIPCImpl *m_impl = nullptr;
+
+    friend class wxSharedMemoryIPCImpl;
+
+    wxDECLARE_NO_COPY_CLASS(wxSharedMemoryConnection);
+    wxDECLARE_DYNAMIC_CLASS(wxSharedMemoryConnection);
+};
+
+// ----------------------------------------------------------------------------
+// wxSharedMemoryServer
+// ----------------------------------------------------------------------------
+
+class WXDLLIMPEXP_BASE wxSharedMemoryServer : public wxServerBase
+{
+public:
+    wxSharedMemoryServer() = default;
+    virtual ~wxSharedMemoryServer();
+
+    // The server name is an arbitrary string identifying it on this machine.
+    //
+    // Returns false on error (e.g. another server with the same name is
+    // already running).
+    virtual bool Create(const wxString& serverName) override;
+
+    virtual wxConnectionBase *OnAcceptConnection(const wxString& topic) override;
+
+private:
+    wxSharedMemoryServerImpl *m_impl = nullptr;
+
+    wxDECLARE_NO_COPY_CLASS(wxSharedMemoryServer);
+    wxDECLARE_DYNAMIC_CLASS(wxSharedMemoryServer);
+};
+
+// ----------------------------------------------------------------------------
+// wxSharedMemoryClient
+// ----------------------------------------------------------------------------
+
+class WXDLLIMPEXP_BASE wxSharedMemoryClient : public wxClientBase
+{
+public:
+    wxSharedMemoryClient() = default;
+
+    // Only local connections are possible, so the host must be either empty
+    // or "localhost".
+    virtual bool ValidHost(const wxString& host) override;
+
+    // Call this to make a connection. Returns nullptr if cannot.
+    virtual wxConnectionBase *MakeConnection(const wxString& host,
+                                             const wxString& server,
+                                             const wxString& topic) override;
+
+    // Callbacks to CLIENT - override at will
+    virtual wxConnectionBase *OnMakeConnection() override;
+
+    // Set the size of the buffer used for the data sent in each direction by
+    // the connections created after this call. Messages bigger than the
+    // buffer can still be sent, but are transferred in several parts then.
+    void SetBufferSize(size_t size) { m_bufferSize = size; }
+    size_t GetBufferSize() const { return m_bufferSize; }
+
+private:
+    size_t m_bufferSize = 1024*1024;
+
+    wxDECLARE_NO_COPY_CLASS(wxSharedMemoryClient);
+    wxDECLARE_DYNAMIC_CLASS(wxSharedMemoryClient);
+};
+
+#endif // wxUSE_IPC && wxUSE_THREADS && __UNIX__
+
+#endif // _WX_SHMIPC_H_
@@ -352,12 +352,7 @@ public:
         { return IsWindow() ? m_window->GetMaxSize() : wxDefaultSize; }
     wxSize GetMaxSizeWithBorder() const;
 
-    void SetMinSize(const wxSize& size)
-    {
-        if ( IsWindow() )
-            m_window->SetMinSize(size);
-        m_minSize = size;
-    }
+    void SetMinSize(const wxSize& size);
     void SetMinSize( int x, int y )
         { SetMinSize(wxSize(x, y)); }
     void SetInitSize( int x, int y )
@@ -385,16 +380,13 @@ public:
     bool IsSizer() const { return m_kind == Item_Sizer; }
     bool IsSpacer() const { return m_kind == Item_Spacer; }
 
-    void SetProportion( int proportion )
-        { m_proportion = proportion; }
+    void SetProportion( int proportion );
     int GetProportion() const
         { return m_proportion; }
-    void SetFlag( int flag )
-        { m_flag = flag; }
+    void SetFlag( int flag );
     int GetFlag() const
         { return m_flag; }
-    void SetBorder( int border )
-        { m_border = border; }
+    void SetBorder( int border );
     int GetBorder() const
         { return m_border; }
 
@@ -457,6 +449,9 @@ protected:
     // free current contents
     void Free();
 
+    // invalidate the cached minimal size of the sizer containing this item
+    void InvalidateContainingSizer();
+
     // common parts of Set/AssignXXX()
     void DoSetWindow(wxWindow *window);
     void DoSetSizer(wxSizer *sizer);
@@ -514,7 +509,13 @@ WX_DECLARE_EXPORTED_LIST( wxSizerItem, wxSizerItemList );
 class WXDLLIMPEXP_CORE wxSizer: public wxObject, public wxClientDataContainer
 {
 public:
-    wxSizer() { m_containingWindow = nullptr; }
+    wxSizer()
+        : m_containingWindow(nullptr),
+          m_containingSizer(nullptr),
+          m_minSizeCacheGeneration(0),
+          m_layoutGeneration(0)
+    {
+    }
     virtual ~wxSizer();
 
     // methods for adding elements to the sizer: there are Add/Insert/Prepend
@@ -610,6 +611,23 @@ public:
     void SetContainingWindow(wxWindow *window);
     wxWindow *GetContainingWindow() const { return m_containingWindow; }
 
+    // get the sizer this one is an item of, if any
+    wxSizer *GetContainingSizer() const { return m_containingSizer; }
+
+    // Enable or disable caching of the minimal sizes of all sizers: when it's
+    // enabled, the minimal size is only recalculated if something inside the
+    // sizer changed and nested sizers are not laid out again if neither their
+    // size nor their contents changed.
+    static void EnableMinSizeCache(bool enable = true);
+    static bool IsMinSizeCacheEnabled() { return ms_minSizeCacheEnabled; }
+
+    // Invalidate the cached minimal size of this sizer and of all the sizers
+    // containing it, this is done automatically when the items change.
+    void InvalidateMinSize();
+
+    // Invalidate the cached minimal sizes of all sizers.
+    static void InvalidateAllMinSizes();
+
     virtual bool Remove( wxSizer *sizer );
     virtual bool Remove( int index );
 
@@ -700,16 +718,7 @@ public:
     const wxSizerItemList& GetChildren() const
         { return m_children; }
 
-    void SetDimension(const wxPoint& pos, const wxSize& size)
-    {
-        m_position = pos;
-        m_size = size;
-        Layout();
-
-        // This call is required for wxWrapSizer to be able to calculate its
-        // minimal size correctly.
-        InformFirstDirection(wxHORIZONTAL, size.x, size.y);
-    }
+    void SetDimension(const wxPoint& pos, const wxSize& size);
     void SetDimension(int x, int y, int width, int height)
         { SetDimension(wxPoint(x, y), wxSize(width, height)); }
 
@@ -756,6 +765,9 @@ protected:
     // the window this sizer is used in, can be null
     wxWindow *m_containingWindow;
 
+    // the sizer this sizer is an item of, can be null
+    wxSizer *m_containingSizer;
+
     wxSize GetMaxClientSize( wxWindow *window ) const;
     wxSize GetMinClientSize( wxWindow *window );
     wxSize VirtualFitSize( wxWindow *window );
@@ -773,6 +785,24 @@ private:
     // Get the child item with the given index and assert if there is none.
     wxSizerItemList::compatibility_iterator GetChildNode(size_t index) const;
 
+    // Return the result of CalcMin(), reusing the cached value if possible.
+    wxSize CalcMinCached();
+
+    // Remember the result of CalcMin() for CalcMinCached().
+    void CacheMinSize(const wxSize& size);
+
+    // The cached result of CalcMin() and the generation it is valid for, it
+    // is invalid if it differs from ms_minSizeCacheGeneration.
+    wxSize m_minSizeCache;
+    unsigned m_minSizeCacheGeneration;
+
+    // The generation in which this sizer was laid out, used to avoid doing it
+    // again if nothing changed since then.
+    unsigned m_layoutGeneration;
+
+    static bool ms_minSizeCacheEnabled;
+    static unsigned ms_minSizeCacheGeneration;
+
     wxDECLARE_CLASS(wxSizer);
 };
 
@@ -799,16 +829,18 @@ public:
     {
         wxASSERT_MSG( cols >= 0, "Number of columns must be non-negative");
         m_cols = cols;
+        InvalidateMinSize();
     }
 
     void SetRows( int rows )
     {
         wxASSERT_MSG( rows >= 0, "Number of rows must be non-negative");
         m_rows = rows;
+        InvalidateMinSize();
     }
 
-    void SetVGap( int gap )     { m_vgap = gap; }
-    void SetHGap( int gap )     { m_hgap = gap; }
+    void SetVGap( int gap )     { m_vgap = gap; InvalidateMinSize(); }
+    void SetHGap( int gap )     { m_hgap = gap; InvalidateMinSize(); }
     int GetCols() const         { return m_cols; }
     int GetRows() const         { return m_rows; }
     int GetVGap() const         { return m_vgap; }
@@ -910,12 +942,14 @@ public:
     // grow in one direction but not the other
 
     // the direction may be wxVERTICAL, wxHORIZONTAL or wxBOTH (default)
-    void SetFlexibleDirection(int direction) { m_flexDirection = direction; }
+    void SetFlexibleDirection(int direction)
+        { m_flexDirection = direction; InvalidateMinSize(); }
     int GetFlexibleDirection() const { return m_flexDirection; }
 
     // note that the grow mode only applies to the direction which is not
     // flexible
-    void SetNonFlexibleGrowMode(wxFlexSizerGrowMode mode) { m_growMode = mode; }
+    void SetNonFlexibleGrowMode(wxFlexSizerGrowMode mode)
+        { m_growMode = mode; InvalidateMinSize(); }
     wxFlexSizerGrowMode GetNonFlexibleGrowMode() const { return m_growMode; }
 
     // Read-only access to the row heights and col widths arrays
@@ -975,7 +1009,7 @@ public:
 
     bool IsVertical() const { return m_orient == wxVERTICAL; }
 
-    void SetOrientation(int orient) { m_orient = orient; }
+    void SetOrientation(int orient) { m_orient = orient; InvalidateMinSize(); }
 
     // implementation of our resizing logic
     virtual wxSize CalcMin() override;
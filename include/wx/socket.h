@@ -21,8 +21,12 @@
 #include "wx/event.h"
 #include "wx/sckaddr.h"
 #include "wx/list.h"
+#include "wx/filefn.h"
+#include "wx/buffer.h"
 
 class wxSocketImpl;
+class wxSocketAsyncState;
+class WXDLLIMPEXP_FWD_BASE wxFile;
 
 // ------------------------------------------------------------------------
 // Types and constants
@@ -104,10 +108,19 @@ enum wxSocketType
     wxSOCKET_DATAGRAM
 };
 
+// buffer description used by wxSocketBase::WriteV()
+struct wxSocketBuffer
+{
+    const void *data;
+    wxUint32 size;
+};
+
 
 // event
 class WXDLLIMPEXP_FWD_NET wxSocketEvent;
 wxDECLARE_EXPORTED_EVENT(WXDLLIMPEXP_NET, wxEVT_SOCKET, wxSocketEvent);
+wxDECLARE_EXPORTED_EVENT(WXDLLIMPEXP_NET, wxEVT_SOCKET_READ_DONE, wxSocketEvent);
+wxDECLARE_EXPORTED_EVENT(WXDLLIMPEXP_NET, wxEVT_SOCKET_WRITE_DONE, wxSocketEvent);
 
 // --------------------------------------------------------------------------
 // wxSocketBase
@@ -156,6 +169,19 @@ public:
     wxSocketBase& Unread(const void *buffer, wxUint32 nbytes);
     wxSocketBase& Write(const void *buffer, wxUint32 nbytes);
     wxSocketBase& WriteMsg(const void *buffer, wxUint32 nbytes);
+    wxSocketBase& WriteV(const wxSocketBuffer *buffers, size_t count);
+#if wxUSE_FILE
+    wxSocketBase& SendFile(wxFile& file,
+                           wxFileOffset offset = 0,
+                           wxFileOffset size = wxInvalidOffset);
+#endif // wxUSE_FILE
+
+    // asynchronous IO: these functions return immediately and the completion
+    // of the operation is notified by wxEVT_SOCKET_{READ,WRITE}_DONE events
+    bool ReadAsync(wxUint32 nbytes, bool waitAll = true);
+    bool WriteAsync(const void *buffer, wxUint32 nbytes);
+    bool IsReadingAsync() const;
+    bool IsWritingAsync() const;
 
     // all Wait() functions wait until their condition is satisfied or the
     // timeout expires; if seconds == -1 (default) then m_timeout value is used
@@ -184,6 +210,8 @@ public:
 
     bool GetOption(int level, int optname, void *optval, int *optlen);
     bool SetOption(int level, int optname, const void *optval, int optlen);
+    bool SetNoDelay(bool noDelay = true);
+    bool SetCork(bool cork = true);
     wxUint32 GetLastIOSize() const { return m_lcount; }
     wxUint32 GetLastIOReadSize() const { return m_lcount_read; }
     wxUint32 GetLastIOWriteSize() const { return m_lcount_write; }
@@ -242,6 +270,10 @@ private:
     // low level IO
     wxUint32 DoRead(void* buffer, wxUint32 nbytes);
     wxUint32 DoWrite(const void *buffer, wxUint32 nbytes);
+    wxUint32 DoWriteV(const wxSocketBuffer *buffers, size_t count);
+#if wxUSE_FILE
+    wxFileOffset DoSendFile(wxFile& file, wxFileOffset offset, wxFileOffset size);
+#endif // wxUSE_FILE
 
     // wait until the given flags are set for this socket or the given timeout
     // (or m_timeout) expires
@@ -270,6 +302,15 @@ private:
     // store the given error as the LastError()
     void SetError(wxSocketError error);
 
+    // continue the asynchronous operations in progress
+    void DoReadAsync();
+    void DoWriteAsync();
+
+    // complete the asynchronous operations in progress by sending the
+    // corresponding events, with the given error if it's not wxSOCKET_NOERROR
+    void CompleteReadAsync(wxSocketError error);
+    void CompleteWritesAsync(wxSocketError error);
+
 private:
     // socket
     wxSocketImpl *m_impl;             // port-specific implementation
@@ -305,6 +346,9 @@ private:
     wxSocketEventFlags  m_eventmask;  // which events to notify?
     wxSocketEventFlags  m_eventsgot;  // collects events received in OnRequest()
 
+    // asynchronous IO state, only allocated when it is used
+    wxSocketAsyncState *m_async;
+
 
     friend class wxSocketReadGuard;
     friend class wxSocketWriteGuard;
@@ -429,11 +473,21 @@ public:
     {
     }
 
+    wxSocketEvent(wxEventType type, int id)
+        : wxEvent(id, type)
+    {
+    }
+
     wxSocketNotify GetSocketEvent() const { return m_event; }
     wxSocketBase *GetSocket() const
         { return (wxSocketBase *) GetEventObject(); }
     void *GetClientData() const { return m_clientData; }
 
+    // these accessors are only used for wxEVT_SOCKET_{READ,WRITE}_DONE events
+    const wxMemoryBuffer& GetData() const { return m_data; }
+    wxUint32 GetCount() const { return m_count; }
+    wxSocketError GetError() const { return m_error; }
+
     virtual wxEvent *Clone() const override { return new wxSocketEvent(*this); }
     virtual wxEventCategory GetEventCategory() const override { return wxEVT_CATEGORY_SOCKET; }
 
@@ -441,6 +495,10 @@ public:
     wxSocketNotify  m_event;
     void           *m_clientData;
 
+    wxMemoryBuffer  m_data;
+    wxUint32        m_count = 0;
+    wxSocketError   m_error = wxSOCKET_NOERROR;
+
     wxDECLARE_DYNAMIC_CLASS_NO_ASSIGN_DEF_COPY(wxSocketEvent);
 };
 
@@ -452,6 +510,10 @@ typedef void (wxEvtHandler::*wxSocketEventFunction)(wxSocketEvent&);
 
 #define EVT_SOCKET(id, func) \
     wx__DECLARE_EVT1(wxEVT_SOCKET, id, wxSocketEventHandler(func))
+#define EVT_SOCKET_READ_DONE(id, func) \
+    wx__DECLARE_EVT1(wxEVT_SOCKET_READ_DONE, id, wxSocketEventHandler(func))
+#define EVT_SOCKET_WRITE_DONE(id, func) \
+    wx__DECLARE_EVT1(wxEVT_SOCKET_WRITE_DONE, id, wxSocketEventHandler(func))
 
 #endif // wxUSE_SOCKETS
 
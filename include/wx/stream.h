@@ -136,6 +136,22 @@ public:
     wxInputStream& Read(wxOutputStream& streamOut);
 
 
+    // direct buffer access
+    // --------------------
+
+    // return the number of bytes available in the internal buffer of this
+    // stream, filling it first if necessary, and set data to point to them
+    //
+    // this allows to read the data without copying it, but is only supported
+    // by the buffered streams, for all the others this function returns 0 and
+    // Read() must be used instead
+    size_t PeekBuffer(const void **data);
+
+    // mark the given number of bytes returned by PeekBuffer() as consumed,
+    // this invalidates the pointer returned by it
+    void ConsumeBuffer(size_t size);
+
+
     // status functions
     // ----------------
 
@@ -199,6 +215,11 @@ protected:
     // read
     virtual size_t OnSysRead(void *buffer, size_t size) = 0;
 
+    // implementation of PeekBuffer() and ConsumeBuffer() for the streams with
+    // an internal buffer: they don't need to deal with the write back buffer
+    virtual size_t DoPeekBuffer(const void **data);
+    virtual void DoConsumeBuffer(size_t size);
+
     // write-back buffer support
     // -------------------------
 
@@ -582,6 +603,9 @@ protected:
     virtual wxFileOffset OnSysSeek(wxFileOffset seek, wxSeekMode mode) override;
     virtual wxFileOffset OnSysTell() const override;
 
+    virtual size_t DoPeekBuffer(const void **data) override;
+    virtual void DoConsumeBuffer(size_t size) override;
+
     wxStreamBuffer *m_i_streambuf;
 
     wxDECLARE_NO_COPY_CLASS(wxBufferedInputStream);
@@ -659,6 +683,9 @@ protected:
     virtual wxFileOffset OnSysSeek(wxFileOffset pos, wxSeekMode mode) override;
     virtual wxFileOffset OnSysTell() const override;
 
+    virtual size_t DoPeekBuffer(const void **data) override;
+    virtual void DoConsumeBuffer(size_t size) override;
+
     // Ensure that our own last error is the same as that of the real stream.
     //
     // This method is const because the error must be updated even from const
@@ -646,6 +646,21 @@ private:
       if ( pos == cache->pos )
           return cache->impl;
 
+      // if we'd have to iterate over a significant part of the string anyhow,
+      // find its length first, as counting the characters is much faster than
+      // iterating over them and allows to detect pure ASCII strings, for which
+      // the positions in the string and in m_impl are the same, and so avoid
+      // iterating over them completely, now and for all the subsequent calls
+      const size_t implLen = m_impl.length();
+      if ( cache->len == npos && pos > cache->pos &&
+                pos - cache->pos >= implLen / 4 )
+      {
+          cache->len = wxStringOperations::CountChars(m_impl.data(), implLen);
+      }
+
+      if ( cache->len == implLen )
+          return pos;
+
       // this seems to happen only rarely so just reset the cache in this case
       // instead of complicating code even further by seeking backwards in this
       // case
@@ -1423,7 +1438,8 @@ public:
           // it's probably not worth trying to be clever and using cache->pos
           // here as it's probably 0 anyhow -- you usually call length() before
           // starting to index the string
-          cache->len = end() - begin();
+          cache->len = wxStringOperations::CountChars(m_impl.data(),
+                                                      m_impl.length());
       }
       else
       {
@@ -1434,7 +1450,7 @@ public:
 
       return cache->len;
 #else // !wxUSE_STRING_POS_CACHE
-      return end() - begin();
+      return wxStringOperations::CountChars(m_impl.data(), m_impl.length());
 #endif // wxUSE_STRING_POS_CACHE/!wxUSE_STRING_POS_CACHE
   }
 #else // wxUSE_UNICODE_WCHAR
@@ -2436,6 +2452,28 @@ public:
     // as vprintf(), returns the number of characters written or < 0 on error
   int PrintfV(const wxString& format, va_list argptr);
 
+    // as Printf(), but appends to the existing string contents, returns the
+    // number of characters appended or < 0 on error
+  template <typename... Targs>
+  int AppendFormat(const wxFormatString& format, Targs... args)
+  {
+    format.Validate({wxFormatStringSpecifier<Targs>::value...});
+
+#if wxUSE_UNICODE_UTF8
+    #if !wxUSE_UTF8_LOCALE_ONLY
+      if ( wxLocaleIsUtf8 )
+    #endif
+        return DoAppendFormatUtf8(format, wxArgNormalizerUtf8<Targs>{args, nullptr, 0}.get()...);
+#endif // wxUSE_UNICODE_UTF8
+
+#if !wxUSE_UTF8_LOCALE_ONLY
+      return DoAppendFormatWchar(format, wxArgNormalizerWchar<Targs>{args, nullptr, 0}.get()...);
+#endif // !wxUSE_UTF8_LOCALE_ONLY
+  }
+
+    // the same as above, but takes a va_list
+  int AppendFormatV(const wxString& format, va_list argptr);
+
     // returns the string containing the result of Printf() to it
   template <typename... Targs>
   static wxString Format(const wxFormatString& format, Targs... args)
@@ -3643,11 +3681,16 @@ public:
 private:
   #if !wxUSE_UTF8_LOCALE_ONLY
   int DoPrintfWchar(const wxChar *format, ...);
+  int DoAppendFormatWchar(const wxChar *format, ...);
   #endif
   #if wxUSE_UNICODE_UTF8
   int DoPrintfUtf8(const char *format, ...);
+  int DoAppendFormatUtf8(const char *format, ...);
   #endif
 
+  // common part of PrintfV() and AppendFormatV()
+  int DoFormatV(const wxString& format, va_list argptr, bool append);
+
 private:
   wxStringImpl m_impl;
 
@@ -164,6 +164,21 @@ struct WXDLLIMPEXP_BASE wxStringOperationsUtf8
         return dist;
     }
 
+    // returns the number of characters in a valid UTF-8 string of the given
+    // length in bytes: this is much faster than using IncIter() repeatedly as
+    // it just needs to count all the bytes which are not continuation ones
+    static size_t CountChars(const char *c, size_t len)
+    {
+        size_t count = 0;
+        for ( size_t n = 0; n < len; n++ )
+        {
+            if ( (c[n] & 0xC0) != 0x80 )
+                count++;
+        }
+
+        return count;
+    }
+
     static bool IsSingleCodeUnitCharacter(const wxUniChar& ch)
         { return ch.IsAscii(); }
 
@@ -23,6 +23,8 @@
 #include "wx/dynarray.h"        // wxArrayInt
 #include "wx/gdicmn.h"          // wxPoint
 
+#include <memory>
+
 #if wxUSE_STD_IOSTREAM
     #include "wx/ioswrap.h"
     #define wxHAS_TEXT_WINDOW_STREAM 1
@@ -750,8 +752,8 @@ public:
     // creation
     // --------
 
-    wxTextCtrlBase() = default;
-    virtual ~wxTextCtrlBase() = default;
+    wxTextCtrlBase();
+    virtual ~wxTextCtrlBase();
 
 
     // more readable flag testing methods
@@ -773,6 +775,21 @@ public:
     virtual bool EmulateKeyPress(const wxKeyEvent& event);
 
 
+    // buffered appending: the text is accumulated and appended to the control
+    // at most once per display frame, which is much faster than calling
+    // AppendText() for each of many small chunks of text, e.g. log messages
+    void AppendTextBuffered(const wxString& text);
+
+    // append the text accumulated by AppendTextBuffered() immediately
+    void FlushBufferedText();
+
+    // limit the number of lines kept in a multiline control when appending
+    // text using AppendTextBuffered(), the oldest lines are removed when this
+    // number is exceeded; 0 means no limit
+    void SetMaxLines(int maxLines);
+    int GetMaxLines() const;
+
+
     // do the window-specific processing after processing the update event
     virtual void DoUpdateWindowUI(wxUpdateUIEvent& event) override;
 
@@ -855,6 +872,14 @@ protected:
     // implement the wxTextEntry pure virtual method
     virtual wxWindow *GetEditableWindow() override { return this; }
 
+private:
+    // remove the lines exceeding the limit set by SetMaxLines()
+    void TrimToMaxLines();
+
+    // the data used by AppendTextBuffered(), only allocated if it's used
+    class AppendBuffer;
+    std::unique_ptr<AppendBuffer> m_appendBuffer;
+
     wxDECLARE_NO_COPY_CLASS(wxTextCtrlBase);
     wxDECLARE_ABSTRACT_CLASS(wxTextCtrlBase);
 };
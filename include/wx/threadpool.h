@@ -0,0 +1,99 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        wx/threadpool.h
+// Purpose:     wxThreadPool: executing tasks using a pool of worker threads
+// Author:      wxWidgets team
+// Created:     2026-10-14
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef _WX_THREADPOOL_H_
+#define _WX_THREADPOOL_H_
+
+#include "wx/defs.h"
+
+#if wxUSE_THREADS
+
+#include "wx/event.h"
+
+#include <functional>
+#include <future>
+#include <memory>
+
+class wxThreadPoolImpl;
+
+// ----------------------------------------------------------------------------
+// wxThreadPool: executes the submitted tasks in its worker threads
+// ----------------------------------------------------------------------------
+
+class WXDLLIMPEXP_BASE wxThreadPool
+{
+public:
+    // Create the pool using at most the given number of threads, 0 means to
+    // use as many threads as there are CPUs in the system.
+    explicit wxThreadPool(int maxThreads = 0);
+
+    // Waits until all the tasks submitted to the pool are done.
+    ~wxThreadPool();
+
+    // Return the global pool shared by the entire program.
+    static wxThreadPool& Get();
+
+    // Return the maximal number of threads used by this pool.
+    int GetMaxThreads() const;
+
+    // Return the number of threads created so far.
+    int GetThreadCount() const;
+
+    // Return true if called from one of this pool threads.
+    bool IsWorkerThread() const;
+
+    // Execute the given function in one of the pool threads and return the
+    // future which can be used to wait for its result.
+    template <typename F>
+    auto Submit(F func) -> std::future<decltype(func())>
+    {
+        using R = decltype(func());
+
+        const auto task = std::make_shared<std::packaged_task<R ()>>(std::move(func));
+        std::future<R> future = task->get_future();
+
+        DoSubmit([task]() { (*task)(); });
+
+        return future;
+    }
+
+    // Execute the given function in one of the pool threads and, when it's
+    // done, call onDone(std::future<R>&) in the thread dispatching the events
+    // of the given handler, normally the main thread.
+    //
+    // The handler must remain alive until onDone is called.
+    template <typename F, typename G>
+    void SubmitAndCallAfter(wxEvtHandler* handler, F func, G onDone)
+    {
+        wxCHECK_RET( handler, wxS("event handler must be specified") );
+
+        using R = decltype(func());
+
+        const auto task = std::make_shared<std::packaged_task<R ()>>(std::move(func));
+        const auto future = std::make_shared<std::future<R>>(task->get_future());
+
+        DoSubmit([handler, task, future, onDone]()
+            {
+                (*task)();
+
+                handler->CallAfter([future, onDone]() { onDone(*future); });
+            });
+    }
+
+private:
+    void DoSubmit(std::function<void ()> task);
+
+    wxThreadPoolImpl* const m_impl;
+
+    wxDECLARE_NO_COPY_CLASS(wxThreadPool);
+};
+
+#endif // wxUSE_THREADS
+
+#endif // _WX_THREADPOOL_H_
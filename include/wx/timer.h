@@ -110,6 +110,14 @@ public:
     // return true if the timer is one shot
     bool IsOneShot() const;
 
+    // set the maximal delay, in milliseconds, by which the timer expiration
+    // may be postponed to allow the system to coalesce it with other timers,
+    // this only takes effect the next time the timer is started
+    void SetTolerance(int milliseconds);
+
+    // get the tolerance set by SetTolerance(), 0 by default
+    int GetTolerance() const;
+
 protected:
     // common part of all ctors
     void Init();
@@ -28,6 +28,7 @@
 // compile.
 #include "wx/wxcrt.h"
 
+#include <atomic>
 #include <memory>
 #include <unordered_map>
 
@@ -67,6 +68,15 @@ using wxTranslationsHashMap = std::unordered_map<wxString, wxString>;
 #define wxGETTEXT_IN_CONTEXT_PLURAL(c, sing, plur, n) \
     wxGetTranslation((sing), (plur), n, wxString(), c)
 
+// this one is equivalent to _() but caches the result of the translation
+// lookup at the point of use, so that it's done only once unless the
+// translations change, it can only be used with the literal strings (use
+// --keyword="wxGETTEXT_CACHED" with xgettext)
+#define wxGETTEXT_CACHED(s) \
+    ([]() -> const wxString& \
+     { static wxTranslationCache s_wxTransCache; \
+       return s_wxTransCache.Get(s); }())
+
 // another one which just marks the strings for extraction, but doesn't
 // perform the translation (use -kwxTRANSLATE with xgettext!)
 #define wxTRANSLATE(str) str
@@ -94,10 +104,23 @@ using wxPluralFormsCalculatorPtr = std::unique_ptr<wxPluralFormsCalculator>;
 class WXDLLIMPEXP_BASE wxMsgCatalog
 {
 public:
+    // Flags for SetDefaultLoadFlags().
+    enum
+    {
+        // Map the MO file into memory and look up the messages in its hash
+        // table only when they're requested, instead of loading all of them
+        // immediately. Only used by CreateFromFile().
+        Load_Lazy = 1
+    };
+
     // Ctor is protected, because CreateFromXXX functions must be used,
     // but destruction should be unrestricted
     ~wxMsgCatalog();
 
+    // set or get the flags used by all catalogs loaded from now on
+    static void SetDefaultLoadFlags(int flags) { ms_defaultLoadFlags = flags; }
+    static int GetDefaultLoadFlags() { return ms_defaultLoadFlags; }
+
     // load the catalog from disk or from data; caller is responsible for
     // deleting them if not null
     static wxMsgCatalog *CreateFromFile(const wxString& filename,
@@ -120,10 +143,23 @@ private:
     wxMsgCatalog *m_pNext;
     friend class wxTranslations;
 
-    wxTranslationsHashMap   m_messages; // all messages in the catalog
+    // all messages in the catalog or, when it's loaded lazily, only the ones
+    // which were already looked up
+    mutable wxTranslationsHashMap m_messages;
     wxString                m_domain;   // name of the domain
 
     wxPluralFormsCalculatorPtr m_pluralFormsCalculator;
+
+    // the data used for loading the messages lazily, null if not used
+    struct LazyData;
+    std::unique_ptr<LazyData> m_lazy;
+
+    // find the message in the lazily loaded catalog and add it to m_messages
+    const wxString* DoLazyLookup(const wxString& key,
+                                 const wxString& msgid,
+                                 int index) const;
+
+    static int ms_defaultLoadFlags;
 };
 
 // ----------------------------------------------------------------------------
@@ -192,7 +228,17 @@ public:
     // string, it needs to have a copy of it somewhere
     static const wxString& GetUntranslatedString(const wxString& str);
 
+    // returns a number which changes whenever anything affecting the results
+    // of wxGetTranslation() changes, used by wxTranslationCache
+    static unsigned GetGeneration()
+        { return ms_generation.load(std::memory_order_acquire); }
+
 private:
+    // must be called whenever the translations change
+    static void IncrementGeneration();
+
+    static std::atomic<unsigned> ms_generation;
+
     enum class Translations
     {
       NotNeeded = -1,
@@ -343,6 +389,59 @@ inline const wxString& wxGetTranslation(const char *str1,
 
 #endif // wxNO_IMPLICIT_WXSTRING_ENCODING
 
+// cache for the result of wxGetTranslation() used by wxGETTEXT_CACHED(): it
+// can be used from multiple threads without locking
+class wxTranslationCache
+{
+public:
+    wxTranslationCache() = default;
+
+    template <typename T>
+    const wxString& Get(const T& str)
+    {
+        const unsigned generation = wxTranslations::GetGeneration();
+
+        // This is a sequence lock: if the generation is the same before and
+        // after reading the string pointer, the pointer corresponds to it.
+        const unsigned cached = m_generation.load(std::memory_order_acquire);
+        if ( cached == generation )
+        {
+            const wxString* const
+                transStr = m_transStr.load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if ( m_generation.load(std::memory_order_relaxed) == generation )
+                return *transStr;
+        }
+
+        const wxString& transStr = wxGetTranslation(str);
+
+        // Only update the cache if no other thread is doing it right now,
+        // there is no need to wait for it as we already have the result.
+        unsigned expected = cached;
+        if ( expected != Busy &&
+                m_generation.compare_exchange_strong(expected, Busy,
+                                                     std::memory_order_acquire,
+                                                     std::memory_order_relaxed) )
+        {
+            std::atomic_thread_fence(std::memory_order_release);
+            m_transStr.store(&transStr, std::memory_order_relaxed);
+            m_generation.store(generation, std::memory_order_release);
+        }
+
+        return transStr;
+    }
+
+private:
+    // Generation values are never 0, which is used for the empty cache, nor
+    // this one, used while the cache is being updated.
+    static constexpr unsigned Busy = static_cast<unsigned>(-1);
+
+    std::atomic<unsigned> m_generation{0};
+    std::atomic<const wxString*> m_transStr{nullptr};
+
+    wxDECLARE_NO_COPY_CLASS(wxTranslationCache);
+};
+
 #else // !wxUSE_INTL
 
 // the macros should still be defined - otherwise compilation would fail
@@ -358,6 +457,7 @@ inline const wxString& wxGetTranslation(const char *str1,
     #define wxPLURAL(sing, plur, n)  ((n) == 1 ? (sing) : (plur))
     #define wxGETTEXT_IN_CONTEXT(c, s)                     (s)
     #define wxGETTEXT_IN_CONTEXT_PLURAL(c, sing, plur, n)  wxPLURAL(sing, plur, n)
+    #define wxGETTEXT_CACHED(s)                            (s)
 #endif
 
 #define wxTRANSLATE(str) str
@@ -233,6 +233,11 @@ public:
     void DeleteItem(wxTreeListItem item);
     void DeleteAllItems();
 
+    // Adding (or deleting) many items at once is much faster if it is done
+    // between the calls to these functions, which can be nested.
+    void BeginBulkInsert();
+    void EndBulkInsert();
+
 
     // Tree navigation
     // ---------------
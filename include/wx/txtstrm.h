@@ -12,6 +12,9 @@
 
 #include "wx/stream.h"
 #include "wx/convauto.h"
+#include "wx/textbuf.h"
+
+#include <string>
 
 #if wxUSE_STREAMS
 
@@ -114,6 +117,98 @@ protected:
     wxDECLARE_NO_COPY_CLASS(wxTextInputStream);
 };
 
+// wxTextLineReader reads the stream line by line, without ever loading all of
+// it in memory. Unlike wxTextInputStream::ReadLine(), it reads and decodes the
+// input in blocks, which is much faster, and allows to access the line
+// contents directly in its internal buffer, without copying them.
+class WXDLLIMPEXP_BASE wxTextLineReader
+{
+public:
+    enum { DEFAULT_BLOCK_SIZE = 65536 };
+
+    wxTextLineReader(wxInputStream& s,
+                     const wxMBConv& conv = wxConvAuto(),
+                     size_t blockSize = DEFAULT_BLOCK_SIZE);
+    ~wxTextLineReader();
+
+    const wxInputStream& GetInputStream() const { return m_input; }
+
+    // Advance to the next line, return false if there are no more lines or an
+    // error occurred (use IsOk() to distinguish between these cases).
+    bool NextLine();
+
+    // Convenient wrapper for NextLine() copying the line into the provided
+    // string, which allows reusing the memory already allocated by it.
+    bool ReadLine(wxString& line, wxTextFileType* type = nullptr);
+
+    // Accessors for the current line, i.e. the one found by the last call to
+    // NextLine(). The line data is not NUL-terminated and doesn't include the
+    // line terminator and remains valid only until the next call to NextLine().
+    const wchar_t* GetLineData() const { return m_text.data() + m_lineStart; }
+    size_t GetLineLength() const { return m_lineLen; }
+    wxString GetLine() const { return wxString(GetLineData(), m_lineLen); }
+#ifdef wxHAS_STD_STRING_VIEW
+    std::wstring_view GetLineView() const
+        { return std::wstring_view(GetLineData(), m_lineLen); }
+#endif // wxHAS_STD_STRING_VIEW
+
+    // Return the terminator of the current line: this is wxTextFileType_None
+    // only for the last line of the stream if it doesn't end with a newline.
+    wxTextFileType GetLineType() const { return m_lineType; }
+
+    // Return the 1-based number of the current line or 0 before the first
+    // call to NextLine().
+    size_t GetLineNumber() const { return m_lineNumber; }
+
+    // Return false if reading from the stream or decoding its contents failed.
+    bool IsOk() const { return !m_error; }
+
+private:
+    // Read more data from the stream and decode as much of it as possible,
+    // return false if there is no more data.
+    bool ReadMore();
+
+    // Return the length of the longest prefix of m_raw ending with a line
+    // terminator, which can be decoded independently of the rest of it, or 0
+    // if there is none. Only the bytes after searchFrom are examined.
+    size_t FindDecodableLength(size_t searchFrom);
+
+    // Decode the first len bytes of m_raw appending the result to m_text.
+    bool Decode(size_t len);
+
+
+    wxInputStream& m_input;
+    wxMBConv* const m_conv;
+    const size_t m_blockSize;
+
+    // The bytes read from the stream but not decoded yet.
+    std::string m_raw;
+
+    // The size of the code unit of the input encoding, determined on demand,
+    // and the length of the BOM at the start of the stream, if any.
+    size_t m_unitLen = 0,
+           m_bomLen = 0;
+
+    // The decoded text, starting at the beginning of the current line.
+    std::wstring m_text;
+
+    // The current line in m_text, which always starts at 0 for the first line
+    // but not necessarily for the subsequent ones.
+    size_t m_lineStart = 0,
+           m_lineLen = 0;
+
+    // The start of the next line in m_text.
+    size_t m_nextLine = 0;
+
+    wxTextFileType m_lineType = wxTextFileType_None;
+    size_t m_lineNumber = 0;
+
+    bool m_eof = false,
+         m_error = false;
+
+    wxDECLARE_NO_COPY_CLASS(wxTextLineReader);
+};
+
 enum wxEOL
 {
   wxEOL_NATIVE,
@@ -79,6 +79,10 @@ public:
     // --------------------------------
 
     virtual bool SwapBuffers() override;
+    virtual bool SetSwapInterval(int interval) override;
+    virtual int GetBufferAge() override;
+    virtual bool SwapBuffersWithDamage(const wxRegion& damage) override;
+    virtual bool SetDamageRegion(const wxRegion& region) override;
 
 
     // X11-specific methods
@@ -131,6 +135,9 @@ public:
     wl_egl_window *m_wlEGLWindow = nullptr;
 
 private:
+    // Common part of SwapBuffers() and SwapBuffersWithDamage(), damage may be
+    // null if the entire surface is damaged.
+    bool DoSwapBuffers(const wxRegion* damage);
 
     EGLConfig m_config = nullptr;
     EGLDisplay m_display = nullptr;
@@ -142,6 +149,8 @@ private:
     wl_subsurface *m_wlSubsurface = nullptr;
 
     bool m_readyToDraw = false;
+    // Swap interval to use, we use 0 by default, see SwapBuffers().
+    int m_swapInterval = 0;
     bool m_swapIntervalSet = false;
 
     // the global/default versions of the above
@@ -59,6 +59,8 @@ public:
     // --------------------------------
 
     virtual bool SwapBuffers() override;
+    virtual bool SetSwapInterval(int interval) override;
+    virtual int GetBufferAge() override;
 
 
     // X11-specific methods
@@ -100,6 +102,8 @@ private:
     GLXFBConfig *m_fbc;
     void* m_vi;
 
+    // Swap interval to use, we use 0 by default, see SwapBuffers().
+    int m_swapInterval = 0;
     bool m_swapIntervalSet = false;
 };
 
@@ -16,6 +16,8 @@
 
 #include "wx/private/fdiodispatcher.h"
 
+#include <vector>
+
 struct epoll_event;
 
 class WXDLLIMPEXP_BASE wxEpollDispatcher : public wxFDIODispatcher
@@ -36,6 +38,12 @@ public:
     virtual bool HasPending() const override;
     virtual int Dispatch(int timeout = TIMEOUT_INFINITE) override;
 
+    // set the maximal number of events retrieved by a single call to
+    // epoll_wait() in Dispatch(), using a bigger value reduces the number of
+    // system calls when many descriptors are active at once
+    void SetMaxEvents(int maxEvents);
+    int GetMaxEvents() const { return m_maxEvents; }
+
 private:
     // ctor is private, use Create()
     wxEpollDispatcher(int epollDescriptor);
@@ -46,6 +54,12 @@ private:
 
 
     int m_epollDescriptor;
+
+    int m_maxEvents = 16;
+
+    // buffer for the events returned by epoll_wait(), reused by Dispatch()
+    // unless it's already used by an outer call of it
+    std::vector<epoll_event> m_events;
 };
 
 #endif // wxUSE_EPOLL_DISPATCHER
@@ -21,6 +21,7 @@
 #include <unordered_map>
 
 class wxEventLoopBase;
+class wxExecuteOutputReader;
 
 // Information associated with a running child process.
 class wxExecuteData
@@ -39,6 +40,8 @@ public:
 #if wxUSE_STREAMS
         m_fdOut =
         m_fdErr = wxPipe::INVALID_FD;
+
+        m_outputReader = nullptr;
 #endif // wxUSE_STREAMS
     }
 
@@ -82,6 +85,10 @@ public:
     // the corresponding FDs, -1 if not redirected
     int m_fdOut,
         m_fdErr;
+
+    // the object reading the child output if wxProcess output events are
+    // used (only in asynchronous case), owned by this object
+    wxExecuteOutputReader* m_outputReader;
 #endif // wxUSE_STREAMS
 
 
@@ -11,6 +11,11 @@
 #define _WX_UNIX_PRIVATE_EXECUTEIOHANDLER_H_
 
 #include "wx/private/streamtempinput.h"
+#include "wx/private/processoutput.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
 
 // This class handles IO events on the pipe FD connected to the child process
 // stdout/stderr and is used by wxExecute().
@@ -133,4 +138,175 @@ private:
     wxDECLARE_NO_COPY_CLASS(wxExecuteEventLoopSourceHandler);
 };
 
+// This class is used instead of the handlers above for the processes using
+// wxProcess::EnableOutputEvents(): it reads the child stdout and stderr in
+// chunks of the size specified by wxProcess as soon as data becomes available
+// in them and passes it to wxProcess::OnOutput().
+//
+// The data is processed synchronously, so we don't read anything more
+// from the pipe until the previous chunk is handled and, if the handler calls
+// wxProcess::SuspendOutput(), until it resumes it, which ensures that the
+// child process blocks instead of us accumulating its output in memory.
+class wxExecuteOutputReader final : public wxProcessOutputReader
+{
+public:
+    // Takes ownership of the descriptors which will be closed by dtor.
+    wxExecuteOutputReader(wxProcess& process, int fdOut, int fdErr)
+        : m_process(process),
+          m_chunkSize(process.GetOutputChunkSize()),
+          m_out(*this, fdOut, false),
+          m_err(*this, fdErr, true)
+    {
+        m_process.SetOutputReader(this);
+    }
+
+    ~wxExecuteOutputReader()
+    {
+        m_process.SetOutputReader(nullptr);
+    }
+
+    // Return false if we couldn't monitor the descriptors, this happens if no
+    // event loop is available.
+    bool IsOk() const { return m_out.IsOk() && m_err.IsOk(); }
+
+    // Read all the remaining data, ignoring any suspension, this is used when
+    // the child process has terminated.
+    void ReadAll()
+    {
+        m_out.ReadAll();
+        m_err.ReadAll();
+    }
+
+    virtual void Suspend() override
+    {
+        m_out.StopMonitoring();
+        m_err.StopMonitoring();
+    }
+
+    virtual void Resume() override
+    {
+        m_out.StartMonitoring();
+        m_err.StartMonitoring();
+    }
+
+private:
+    class Channel : public wxEventLoopSourceHandler
+    {
+    public:
+        Channel(wxExecuteOutputReader& reader, int fd, bool isError)
+            : m_reader(reader),
+              m_fd(fd),
+              m_isError(isError)
+        {
+            m_source = nullptr;
+
+#ifdef F_SETPIPE_SZ
+            // Let the child write more data before blocking if we're going
+            // to read it in big chunks anyhow. Notice that this is just an
+            // optimization, so we don't care if it fails.
+            if ( m_reader.m_chunkSize > 64*1024 )
+                fcntl(m_fd, F_SETPIPE_SZ, static_cast<int>(m_reader.m_chunkSize));
+#endif // F_SETPIPE_SZ
+
+            StartMonitoring();
+        }
+
+        ~Channel()
+        {
+            Close();
+        }
+
+        bool IsOk() const { return m_fd == -1 || m_source; }
+
+        void StartMonitoring()
+        {
+            if ( m_fd != -1 && !m_source )
+            {
+                m_source = wxEventLoop::AddSourceForFD(m_fd, this,
+                                                       wxEVENT_SOURCE_INPUT);
+            }
+        }
+
+        void StopMonitoring()
+        {
+            delete m_source;
+            m_source = nullptr;
+        }
+
+        void ReadAll()
+        {
+            while ( ReadChunk() )
+                ;
+        }
+
+        virtual void OnReadWaiting() override
+        {
+            ReadChunk();
+        }
+
+        virtual void OnWriteWaiting() override { }
+        virtual void OnExceptionWaiting() override { }
+
+    private:
+        // Read and send a single chunk of output, return false on EOF.
+        bool ReadChunk()
+        {
+            if ( m_fd == -1 )
+                return false;
+
+            // Read directly into the buffer which will be sent to the user
+            // code, without any intermediate copies.
+            const size_t size = m_reader.m_chunkSize;
+            wxMemoryBuffer buf(size);
+
+            ssize_t rc;
+            do
+            {
+                rc = read(m_fd, buf.GetWriteBuf(size), size);
+            } while ( rc == -1 && errno == EINTR );
+
+            if ( rc <= 0 )
+            {
+                if ( rc == -1 && errno == EAGAIN )
+                    return true;
+
+                Close();
+                return false;
+            }
+
+            buf.UngetWriteBuf(rc);
+
+            m_reader.m_process.OnOutput(buf, m_isError);
+
+            return true;
+        }
+
+        void Close()
+        {
+            StopMonitoring();
+
+            if ( m_fd != -1 )
+            {
+                close(m_fd);
+                m_fd = -1;
+            }
+        }
+
+        wxExecuteOutputReader& m_reader;
+        int m_fd;
+        const bool m_isError;
+        wxEventLoopSource* m_source;
+
+        wxDECLARE_NO_COPY_CLASS(Channel);
+    };
+
+    wxProcess& m_process;
+    const size_t m_chunkSize;
+
+    Channel m_out,
+            m_err;
+
+    wxDECLARE_NO_COPY_CLASS(wxExecuteOutputReader);
+};
+
 #endif // _WX_UNIX_PRIVATE_EXECUTEIOHANDLER_H_
@@ -0,0 +1,244 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        wx/unix/private/gstframetap.h
+// Purpose:     Access to the video frames decoded by GStreamer
+// Author:      wxWidgets team
+// Created:     2026-10-15
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef _WX_UNIX_PRIVATE_GSTFRAMETAP_H_
+#define _WX_UNIX_PRIVATE_GSTFRAMETAP_H_
+
+#include "wx/mediactrl.h"
+#include "wx/thread.h"
+
+#include <gst/gst.h>
+#include <gst/video/video.h>
+
+#include <atomic>
+
+// ----------------------------------------------------------------------------
+// wxGStreamerFrameTap: passes the frames reaching the video sink to the user
+// ----------------------------------------------------------------------------
+
+// This class is used by both GStreamer backends. It installs a probe on the
+// sink pad of the video sink, which is called in the streaming thread for
+// each buffer, and maps the buffer memory (including DMA-buf memory, which is
+// mapped using mmap() by GStreamer) to give access to the frame data without
+// copying it.
+class wxGStreamerFrameTap
+{
+public:
+    wxGStreamerFrameTap() = default;
+
+    ~wxGStreamerFrameTap()
+    {
+        Detach();
+    }
+
+    // Start watching the frames reaching the given sink, which can be a bin.
+    // May be called from any thread.
+    void Attach(GstElement* videosink)
+    {
+        wxMutexLocker lock(m_mutex);
+
+        DoDetach();
+
+        m_sink = GST_ELEMENT(gst_object_ref(videosink));
+        m_pad = gst_element_get_static_pad(videosink, "sink");
+        if ( m_pad )
+        {
+            m_probe = gst_pad_add_probe(m_pad, GST_PAD_PROBE_TYPE_BUFFER,
+                                        &wxGStreamerFrameTap::OnProbe,
+                                        this, nullptr);
+        }
+    }
+
+    void Detach()
+    {
+        wxMutexLocker lock(m_mutex);
+
+        DoDetach();
+    }
+
+    // Must not be called from the callback itself.
+    void SetCallback(const wxMediaFrameCallback& callback)
+    {
+        wxMutexLocker lock(m_mutex);
+
+        m_callback = callback;
+    }
+
+    // Reset the statistics, called when new media is loaded. Note that the
+    // sink statistics are reset by the sink itself when it starts.
+    void ResetStats()
+    {
+        m_framesReceived = 0;
+    }
+
+    bool GetStats(wxMediaFrameStats* stats)
+    {
+        stats->framesReceived = m_framesReceived;
+
+        wxMutexLocker lock(m_mutex);
+
+        if ( !m_sink )
+            return false;
+
+        guint64 rendered, dropped;
+        if ( GetSinkStats(&rendered, &dropped) )
+        {
+            stats->framesRendered = rendered;
+            stats->framesDropped = dropped;
+        }
+
+        return true;
+    }
+
+private:
+    static GstPadProbeReturn
+    OnProbe(GstPad* pad, GstPadProbeInfo* info, gpointer data)
+    {
+        static_cast<wxGStreamerFrameTap*>(data)->
+            OnBuffer(pad, GST_PAD_PROBE_INFO_BUFFER(info));
+
+        return GST_PAD_PROBE_OK;
+    }
+
+    void OnBuffer(GstPad* pad, GstBuffer* buffer)
+    {
+        m_framesReceived++;
+
+        wxMutexLocker lock(m_mutex);
+
+        if ( !m_callback || !buffer )
+            return;
+
+        GstCaps* const caps = gst_pad_get_current_caps(pad);
+        if ( !caps )
+            return;
+
+        GstVideoInfo info;
+        const bool ok = gst_video_info_from_caps(&info, caps);
+        gst_caps_unref(caps);
+
+        GstVideoFrame vframe;
+        if ( !ok || !gst_video_frame_map(&vframe, &info, buffer, GST_MAP_READ) )
+            return;
+
+        const GstClockTime pts = GST_BUFFER_PTS(buffer);
+
+        wxMediaFrame frame
+                     (
+                        GST_VIDEO_FRAME_WIDTH(&vframe),
+                        GST_VIDEO_FRAME_HEIGHT(&vframe),
+                        gst_video_format_to_string(GST_VIDEO_FRAME_FORMAT(&vframe)),
+                        GST_CLOCK_TIME_IS_VALID(pts)
+                            ? wxLongLong(static_cast<wxLongLong_t>(pts / GST_MSECOND))
+                            : wxLongLong(-1)
+                     );
+
+        const unsigned planes = GST_VIDEO_FRAME_N_PLANES(&vframe);
+        for ( unsigned n = 0; n < planes; n++ )
+        {
+            frame.AddPlane(
+                static_cast<const unsigned char*>(GST_VIDEO_FRAME_PLANE_DATA(&vframe, n)),
+                GST_VIDEO_FRAME_PLANE_STRIDE(&vframe, n));
+        }
+
+        m_callback(frame);
+
+        gst_video_frame_unmap(&vframe);
+    }
+
+    // Get the statistics from the actual sink element, which supports the
+    // "stats" property since GStreamer 1.18. Must be called with the mutex
+    // locked.
+    bool GetSinkStats(guint64* rendered, guint64* dropped) const
+    {
+        *rendered =
+        *dropped = 0;
+
+        if ( !m_sink )
+            return false;
+
+        GstElement* const sink = FindStatsSink(m_sink);
+        if ( !sink )
+            return false;
+
+        GstStructure* stats = nullptr;
+        g_object_get(sink, "stats", &stats, nullptr);
+        gst_object_unref(sink);
+
+        if ( !stats )
+            return false;
+
+        gst_structure_get_uint64(stats, "rendered", rendered);
+        gst_structure_get_uint64(stats, "dropped", dropped);
+        gst_structure_free(stats);
+
+        return true;
+    }
+
+    // Return the element with the "stats" property, which is either the given
+    // element itself or one of its children if it's a bin, such as
+    // "autovideosink". The returned element must be unreferenced.
+    static GstElement* FindStatsSink(GstElement* element)
+    {
+        if ( g_object_class_find_property(G_OBJECT_GET_CLASS(element), "stats") )
+            return GST_ELEMENT(gst_object_ref(element));
+
+        if ( !GST_IS_BIN(element) )
+            return nullptr;
+
+        GstElement* found = nullptr;
+
+        GstIterator* const it = gst_bin_iterate_sinks(GST_BIN(element));
+        GValue item = G_VALUE_INIT;
+        while ( !found && gst_iterator_next(it, &item) == GST_ITERATOR_OK )
+        {
+            found = FindStatsSink(GST_ELEMENT(g_value_get_object(&item)));
+            g_value_reset(&item);
+        }
+        g_value_unset(&item);
+        gst_iterator_free(it);
+
+        return found;
+    }
+
+    void DoDetach()
+    {
+        if ( m_pad )
+        {
+            if ( m_probe )
+                gst_pad_remove_probe(m_pad, m_probe);
+
+            gst_object_unref(m_pad);
+            m_pad = nullptr;
+        }
+
+        m_probe = 0;
+
+        if ( m_sink )
+        {
+            gst_object_unref(m_sink);
+            m_sink = nullptr;
+        }
+    }
+
+    // Protects all the fields below, except for the atomic counter.
+    wxMutex m_mutex;
+
+    wxMediaFrameCallback m_callback;
+
+    GstElement* m_sink = nullptr;
+    GstPad* m_pad = nullptr;
+    gulong m_probe = 0;
+
+    std::atomic<unsigned long> m_framesReceived{0};
+
+    wxDECLARE_NO_COPY_CLASS(wxGStreamerFrameTap);
+};
+
+#endif // _WX_UNIX_PRIVATE_GSTFRAMETAP_H_
@@ -0,0 +1,119 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        wx/unix/private/iouringdispatcher.h
+// Purpose:     wxIOUringDispatcher class
+// Author:      wxWidgets team
+// Created:     2026-10-14
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef _WX_PRIVATE_IOURINGDISPATCHER_H_
+#define _WX_PRIVATE_IOURINGDISPATCHER_H_
+
+#include "wx/defs.h"
+
+#if wxUSE_IOURING_DISPATCHER
+
+#include "wx/private/fdiodispatcher.h"
+
+#include <unordered_map>
+
+struct io_uring_sqe;
+struct io_uring_cqe;
+
+// This dispatcher uses one-shot IORING_OP_POLL_ADD requests, which are rearmed
+// after dispatching each event, to provide the same level-triggered semantics
+// as wxEpollDispatcher. The advantage is that registering, modifying and
+// rearming the descriptors doesn't require any system calls of its own, as
+// all the requests are submitted by the same io_uring_enter() call which
+// waits for the events. When supported by the kernel, modifying the
+// descriptor updates the existing poll request instead of replacing it.
+class WXDLLIMPEXP_BASE wxIOUringDispatcher : public wxFDIODispatcher
+{
+public:
+    // create a new instance of this class, can return nullptr if io_uring
+    // is not supported on this system or disabled by the administrator
+    //
+    // the caller should delete the returned pointer
+    static wxIOUringDispatcher *Create();
+
+    virtual ~wxIOUringDispatcher();
+
+    // implement base class pure virtual methods
+    virtual bool RegisterFD(int fd, wxFDIOHandler* handler, int flags = wxFDIO_ALL) override;
+    virtual bool ModifyFD(int fd, wxFDIOHandler* handler, int flags = wxFDIO_ALL) override;
+    virtual bool UnregisterFD(int fd) override;
+    virtual bool HasPending() const override;
+    virtual int Dispatch(int timeout = TIMEOUT_INFINITE) override;
+
+private:
+    // memory shared with the kernel, defined in the implementation file
+    struct Ring;
+
+    // registered descriptor information
+    struct Entry
+    {
+        wxFDIOHandler *handler;
+
+        // POLLxxx mask corresponding to wxFDIO_XXX flags
+        unsigned events;
+
+        // changed whenever the poll request for this entry is modified to
+        // distinguish its completions from those of the previous requests
+        unsigned generation;
+    };
+
+    // ctor is private, use Create()
+    wxIOUringDispatcher(int ringDescriptor, Ring *ring, bool canUpdate);
+
+    // return the generation to use for a new or modified entry
+    unsigned NextGeneration();
+
+    // queue a poll request for the given entry
+    void QueuePoll(int fd, const Entry& entry);
+
+    // queue a request to update the existing poll request with the given
+    // generation to use the events and generation of the given entry
+    void QueuePollUpdate(int fd, unsigned oldGeneration, const Entry& entry);
+
+    // queue a request to remove the poll request for the given entry
+    void QueuePollRemove(int fd, const Entry& entry);
+
+    // return a free submission queue entry, submitting the already queued
+    // ones first if there are none left
+    io_uring_sqe *GetSQE();
+
+    // submit all queued requests and wait for at least minComplete events
+    // for at most timeout ms, unless it is TIMEOUT_INFINITE; returns false
+    // only on error, but not if the timeout expired or the call was
+    // interrupted by a signal
+    bool Enter(unsigned minComplete, int timeout) const;
+
+    // return the entry corresponding to the given completion user data or
+    // nullptr if the request was for an unregistered or modified descriptor
+    const Entry *FindEntry(wxUint64 userData) const;
+
+    // return true if the completion queue contains any completions resulting
+    // in calling the handlers, discarding the ignored ones at its head
+    bool HasEventCompletions() const;
+
+    // process all the available completions, return the number of events
+    int ProcessCompletions();
+
+
+    const int m_ringDescriptor;
+    Ring * const m_ring;
+
+    // true if the kernel supports updating the existing poll requests
+    const bool m_canUpdate;
+
+    std::unordered_map<int, Entry> m_entries;
+
+    unsigned m_lastGeneration = 0;
+
+    wxDECLARE_NO_COPY_CLASS(wxIOUringDispatcher);
+};
+
+#endif // wxUSE_IOURING_DISPATCHER
+
+#endif // _WX_PRIVATE_IOURINGDISPATCHER_H_
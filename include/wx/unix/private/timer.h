@@ -14,7 +14,7 @@
 
 #include "wx/private/timer.h"
 
-#include <list>
+#include <vector>
 
 // the type used for milliseconds is large enough for microseconds too but
 // introduce a synonym for it to avoid confusion
@@ -47,6 +47,11 @@ public:
 
 private:
     bool m_isRunning;
+
+    // index of this timer in wxTimerScheduler heap, only valid if running
+    size_t m_heapIndex = 0;
+
+    friend class wxTimerScheduler;
 };
 
 // ----------------------------------------------------------------------------
@@ -55,10 +60,25 @@ private:
 
 struct wxTimerSchedule
 {
-    wxTimerSchedule(wxUnixTimerImpl *timer, wxUsecClock_t expiration)
+    wxTimerSchedule(wxUnixTimerImpl *timer,
+                    wxUsecClock_t expiration,
+                    unsigned long order)
         : m_timer(timer),
-          m_expiration(expiration)
+          m_expiration(expiration),
+          m_order(order)
+    {
+    }
+
+    // return true if this timer must be notified before the other one
+    bool IsBefore(const wxTimerSchedule& other) const
     {
+        if ( m_expiration != other.m_expiration )
+            return m_expiration < other.m_expiration;
+
+        // timers expiring at the same time are notified in the order in
+        // which they were added (the comparison is written in this way to
+        // handle wrap around of the counter correctly)
+        return static_cast<long>(m_order - other.m_order) < 0;
     }
 
     // the timer itself (we don't own this pointer)
@@ -66,10 +86,13 @@ struct wxTimerSchedule
 
     // the time of its next expiration, in usec
     wxUsecClock_t m_expiration;
+
+    // sequential number used to order the timers with the same expiration
+    unsigned long m_order;
 };
 
-// the linked list of all active timers, we keep it sorted by expiration time
-using wxTimerList = std::list<wxTimerSchedule>;
+// the binary heap of all active timers, ordered by expiration time
+using wxTimerHeap = std::vector<wxTimerSchedule>;
 
 // ----------------------------------------------------------------------------
 // wxTimerScheduler: class responsible for updating all timers
@@ -97,10 +120,12 @@ public:
         }
     }
 
-    // adds timer which should expire at the given absolute time to the list
+    // adds timer which should expire at the given absolute time, this is
+    // O(log(N)) in the number of active timers
     void AddTimer(wxUnixTimerImpl *timer, wxUsecClock_t expiration);
 
-    // remove timer from the list, called automatically from timer dtor
+    // remove timer, called automatically from timer dtor, this is O(log(N))
+    // too as each timer stores its position in the heap
     void RemoveTimer(wxUnixTimerImpl *timer);
 
 
@@ -113,22 +138,44 @@ public:
     // it returns false if there are no timers
     bool GetNext(wxUsecClock_t *remaining) const;
 
-    // trigger the timer event for all timers which have expired, return true
-    // if any did
+    // trigger the timer event for all timers which have expired or will
+    // expire in less than COALESCE_USEC, return true if any did
     bool NotifyExpired();
 
+    // timers expiring in less than this number of microseconds are notified
+    // together with the ones which have already expired: this avoids waking
+    // up separately for each of several timers expiring at almost the same
+    // time and also for a timer expiring in less than a millisecond, which
+    // is the resolution of the event loop timeout
+    static const long COALESCE_USEC = 1000;
+
 private:
     // ctor and dtor are private, this is a singleton class only created by
     // Get() and destroyed by Shutdown()
     wxTimerScheduler() = default;
     ~wxTimerScheduler() = default;
 
-    // add the given timer schedule to the list in the right place
+    // add the given timer schedule to the heap
     void DoAddTimer(const wxTimerSchedule& s);
 
+    // remove the element at the given position from the heap
+    void DoRemoveAt(size_t n);
+
+    // store the given schedule at the given position and update its index
+    void PlaceAt(size_t n, const wxTimerSchedule& s);
+
+    // restore the heap invariant by moving the element at the given position
+    // up or down the heap
+    void SiftUp(size_t n);
+    void SiftDown(size_t n);
+
+
+    // the binary min-heap of all currently active timers: the first element
+    // is always the one expiring first
+    wxTimerHeap m_timers;
 
-    // the list of all currently active timers sorted by expiration
-    wxTimerList m_timers;
+    // the counter used for wxTimerSchedule::m_order
+    unsigned long m_nextOrder = 0;
 
     static wxTimerScheduler *ms_instance;
 };
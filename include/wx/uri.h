@@ -45,6 +45,101 @@ enum wxURIFlags
 };
 
 
+// Position of a URI component in the string it was parsed from.
+struct wxURIRange
+{
+    size_t pos = 0;
+    size_t len = 0;
+};
+
+// Parser finding the URI components without copying or escaping them, which
+// makes it much faster than wxURI when only some of the components are
+// needed. The string passed to Parse() is not copied and must remain valid for
+// as long as the positions of the components in it are used.
+class WXDLLIMPEXP_BASE wxURIView
+{
+public:
+    wxURIView() = default;
+    explicit wxURIView(const char* uri) { Parse(uri); }
+
+    // parse the NUL-terminated URI in UTF-8, return true if it was entirely
+    // parsed, possibly after escaping the characters not allowed in it
+    bool Parse(const char* uri);
+
+    bool Has(wxURIFieldType field) const { return (m_fields & field) != 0; }
+
+    bool HasScheme() const      { return Has(wxURI_SCHEME);   }
+    bool HasUserInfo() const    { return Has(wxURI_USERINFO); }
+    bool HasServer() const      { return Has(wxURI_SERVER);   }
+    bool HasPort() const        { return Has(wxURI_PORT);     }
+    bool HasPath() const        { return Has(wxURI_PATH);     }
+    bool HasQuery() const       { return Has(wxURI_QUERY);    }
+    bool HasFragment() const    { return Has(wxURI_FRAGMENT); }
+
+    // the string passed to Parse()
+    const char* GetSource() const { return m_source; }
+
+    // the position of the component in the source string, it is empty if the
+    // component is not present
+    const wxURIRange& GetRange(wxURIFieldType field) const
+        { return m_ranges[GetIndex(field)]; }
+
+    const char* GetStart(wxURIFieldType field) const
+        { return m_source + GetRange(field).pos; }
+    size_t GetLength(wxURIFieldType field) const
+        { return GetRange(field).len; }
+
+    wxURIHostType GetHostType() const { return m_hostType; }
+
+    // return true if the component contains characters which are not allowed
+    // in it and are percent-encoded by wxURI, i.e. if its value in wxURI is
+    // different from the source string
+    bool NeedsEscaping(wxURIFieldType field) const
+        { return (m_escape & field) != 0; }
+
+private:
+    static size_t GetIndex(wxURIFieldType field)
+    {
+        size_t n = 0;
+        for ( int f = field; f > 1; f >>= 1 )
+            n++;
+        return n;
+    }
+
+    void SetRange(wxURIFieldType field, const char* start, const char* end);
+    void ResetField(wxURIFieldType field);
+
+    const char* ParseScheme    (const char* uri);
+    const char* ParseAuthority (const char* uri);
+    const char* ParseUserInfo  (const char* uri);
+    const char* ParseServer    (const char* uri);
+    const char* ParsePort      (const char* uri);
+    const char* ParsePath      (const char* uri);
+    const char* ParseQuery     (const char* uri);
+    const char* ParseFragment  (const char* uri);
+
+    // parse the component containing the characters of the given classes,
+    // or escaped ones, until a NUL or a character of the given terminator
+    // classes, see the implementation file for the classes definitions
+    const char* ParseComponent(wxURIFieldType field, const char* uri,
+                               int allowed, int terminators);
+
+    static bool ParseH16(const char*& uri);
+    static bool ParseIPv4address(const char*& uri);
+    static bool ParseIPv6address(const char*& uri);
+    static bool ParseIPvFuture(const char*& uri);
+
+    const char* m_source = nullptr;
+
+    wxURIRange m_ranges[7];
+
+    wxURIHostType m_hostType = wxURI_REGNAME;
+
+    // combinations of wxURIFieldType values
+    int m_fields = 0;
+    int m_escape = 0;
+};
+
 // Generic class for parsing URIs.
 //
 // See RFC 3986
@@ -104,6 +199,12 @@ public:
     // escape sequences
     static wxString Unescape(const wxString& escapedURI);
 
+    // decode len bytes of the escaped URI in UTF-8 into the provided buffer,
+    // which must be at least len bytes long and may be the same as the input
+    // one, and return the length of the decoded string, which is not
+    // NUL-terminated
+    static size_t Unescape(const char* escapedURI, size_t len, char* out);
+
 
     void Resolve(const wxURI& base, int flags = wxURI_STRICT);
     bool IsReference() const;
@@ -122,30 +223,6 @@ protected:
 
     bool Parse(const char* uri);
 
-    const char* ParseAuthority (const char* uri);
-    const char* ParseScheme    (const char* uri);
-    const char* ParseUserInfo  (const char* uri);
-    const char* ParseServer    (const char* uri);
-    const char* ParsePort      (const char* uri);
-    const char* ParsePath      (const char* uri);
-    const char* ParseQuery     (const char* uri);
-    const char* ParseFragment  (const char* uri);
-
-
-    static bool ParseH16(const char*& uri);
-    static bool ParseIPv4address(const char*& uri);
-    static bool ParseIPv6address(const char*& uri);
-    static bool ParseIPvFuture(const char*& uri);
-
-    // append next character pointer to by p to the string in an escaped form
-    // and advance p past it
-    //
-    // if the next character is '%' and it's followed by 2 hex digits, they are
-    // not escaped (again) by this function, this allows to keep (backwards-
-    // compatible) ambiguity about the input format to wxURI::Create(): it can
-    // be either already escaped or not
-    void AppendNextEscaped(wxString& s, const char *& p);
-
     // convert hexadecimal digit to its value; return -1 if c isn't valid
     static int CharToHex(char c);
 
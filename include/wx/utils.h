@@ -415,6 +415,21 @@ WXDLLIMPEXP_BASE long wxExecute(const wxString& command,
                                 int flags = 0,
                                 const wxExecuteEnv *env = nullptr);
 
+// Statistics about the processes launched by wxExecute().
+struct wxExecuteStats
+{
+    // Total number of successfully launched child processes.
+    wxUint64 launched = 0;
+
+    // Number of those launched using posix_spawn() rather than fork().
+    wxUint64 spawned = 0;
+
+    // Total time, in microseconds, spent launching all of them.
+    wxUint64 launchTimeUs = 0;
+};
+
+WXDLLIMPEXP_BASE wxExecuteStats wxGetExecuteStats();
+
 #if defined(__WINDOWS__) && wxUSE_IPC
 // ask a DDE server to execute the DDE request with given parameters
 WXDLLIMPEXP_BASE bool wxExecuteDDE(const wxString& ddeServer,
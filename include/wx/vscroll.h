@@ -15,6 +15,8 @@
 #include "wx/position.h"
 #include "wx/scrolwin.h"
 
+#include <vector>
+
 class WXDLLIMPEXP_FWD_CORE wxVarScrollHelperEvtHandler;
 
 
@@ -159,6 +161,11 @@ protected:
     // redraw all units in the specified range (inclusive)
     virtual void RefreshUnits(size_t from, size_t to);
 
+    // must be called when the sizes of the units in the specified range
+    // (inclusive) change: this forgets their cached sizes and redraws them
+    // and all the units after them, as their positions change too
+    void RefreshUnitsSizes(size_t from, size_t to);
+
     // scroll to the specified unit: it will become the first visible unit in
     // the window
     //
@@ -209,6 +216,9 @@ protected:
 
     // get the total size of the units between unitMin (inclusive) and
     // unitMax (exclusive)
+    //
+    // the sizes of the units starting from the first one are cached, so this
+    // is fast for the units whose sizes had been already computed
     wxCoord GetUnitsSize(size_t unitMin, size_t unitMax) const;
 
     // get the offset of the first visible unit
@@ -258,9 +268,21 @@ protected:
     void IncOrient(wxCoord& x, wxCoord& y, wxCoord inc);
 
 private:
+    // forget the cached positions of all units after the given one
+    void InvalidateUnitsSizes(size_t unit)
+    {
+        if ( unit < m_unitsPos.size() )
+            m_unitsPos.resize(unit + 1);
+    }
+
     // the total number of (logical) units
     size_t m_unitMax;
 
+    // the positions of the units, i.e. the total size of all the units before
+    // them, computed so far: m_unitsPos[n] is the position of the unit n and
+    // m_unitsPos[0] is always 0 if the array is not empty
+    mutable std::vector<wxCoord> m_unitsPos;
+
     // the total (estimated) size
     wxCoord m_sizeTotal;
 
@@ -319,6 +341,9 @@ public:
     virtual void RefreshRows(size_t from, size_t to)
         { RefreshUnits(from, to); }
 
+    void RefreshRowsHeights(size_t from, size_t to)
+        { RefreshUnitsSizes(from, to); }
+
     // accessors
 
     size_t GetRowCount() const                  { return GetUnitCount(); }
@@ -394,6 +419,9 @@ public:
     virtual void RefreshColumns(size_t from, size_t to)
         { RefreshUnits(from, to); }
 
+    void RefreshColumnsWidths(size_t from, size_t to)
+        { RefreshUnitsSizes(from, to); }
+
     // accessors
 
     size_t GetColumnCount() const
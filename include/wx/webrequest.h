@@ -41,6 +41,10 @@ private:
 #include "wx/stream.h"
 #include "wx/versioninfo.h"
 
+#include <functional>
+#include <vector>
+
+class wxHTTPCache;
 class wxWebResponse;
 class wxWebSession;
 class wxWebSessionFactory;
@@ -86,6 +90,17 @@ private:
     wxWebAuthChallengeImplPtr m_impl;
 };
 
+// Timings of the different phases of the request, all values are in
+// microseconds since the start of the request or -1 if not available.
+struct wxWebResponseTimings
+{
+    wxLongLong_t nameLookup = -1;
+    wxLongLong_t connect = -1;
+    wxLongLong_t tlsHandshake = -1;
+    wxLongLong_t firstByte = -1;
+    wxLongLong_t total = -1;
+};
+
 class WXDLLIMPEXP_NET wxWebResponse
 {
 public:
@@ -118,6 +133,8 @@ public:
 
     wxString GetDataFile() const;
 
+    wxWebResponseTimings GetTimings() const;
+
 protected:
     // Ctor is used by wxWebRequest and implementation classes to create public
     // objects from the existing implementation pointers.
@@ -168,6 +185,14 @@ public:
 
     Storage GetStorage() const;
 
+    // Function called with the response data as soon as it is received,
+    // returning false pauses receiving it until Resume() is called.
+    using DataCallback = std::function<bool (const void* data, size_t size)>;
+
+    void SetDataCallback(const DataCallback& callback);
+
+    bool Resume();
+
     void Start();
 
     void Cancel();
@@ -248,6 +273,16 @@ public:
 
     bool EnablePersistentStorage(bool enable = true);
 
+    // Connection management options, must be set before creating requests.
+    bool EnableMultiplexing(bool enable = true);
+    bool SetMaxConnections(int maxTotal, int maxPerHost = 0);
+    bool EnableKeepAlive(bool enable = true);
+    bool SetDNSCacheTimeout(int seconds);
+
+    // The cache is not owned by the session and must outlive it.
+    void SetCache(wxHTTPCache* cache);
+    wxHTTPCache* GetCache() const;
+
     wxWebSessionHandle GetNativeHandle() const;
 
 private:
@@ -307,6 +342,64 @@ private:
 wxDECLARE_EXPORTED_EVENT(WXDLLIMPEXP_NET, wxEVT_WEBREQUEST_STATE, wxWebRequestEvent);
 wxDECLARE_EXPORTED_EVENT(WXDLLIMPEXP_NET, wxEVT_WEBREQUEST_DATA, wxWebRequestEvent);
 
+class wxEventLoopBase;
+
+// Runs many requests using the same session with limited parallelism, the
+// events of all requests are sent to this object itself.
+class WXDLLIMPEXP_NET wxWebRequestBatch : public wxEvtHandler
+{
+public:
+    explicit wxWebRequestBatch(const wxWebSession& session = wxWebSession::GetDefault());
+    ~wxWebRequestBatch();
+
+    void SetMaxActive(int count);
+    int GetMaxActive() const { return m_maxActive; }
+
+    // The ID of the returned request is its index in the batch.
+    wxWebRequest Add(const wxString& url);
+
+    size_t GetCount() const { return m_requests.size(); }
+    wxWebRequest GetRequest(size_t n) const;
+
+    size_t GetFinishedCount() const { return m_finished; }
+    bool IsFinished() const { return m_finished == m_requests.size(); }
+
+    void Start();
+    bool Wait();
+    void Cancel();
+
+    virtual bool ProcessEvent(wxEvent& event) override;
+
+private:
+    // start the next requests if we have fewer than the maximum active ones
+    void StartNext();
+
+    // mark the request with the given index as finished
+    void MarkFinished(size_t n);
+
+    wxWebSession m_session;
+
+    std::vector<wxWebRequest> m_requests;
+
+    // true for the requests which were already finished
+    std::vector<bool> m_isFinished;
+
+    int m_maxActive;
+    int m_active = 0;
+
+    // index of the next request to start
+    size_t m_next = 0;
+    size_t m_finished = 0;
+
+    bool m_started = false;
+    bool m_cancelled = false;
+
+    // non-null only while Wait() is running
+    wxEventLoopBase* m_loop = nullptr;
+
+    wxDECLARE_NO_COPY_CLASS(wxWebRequestBatch);
+};
+
 #endif // wxUSE_WEBREQUEST
 
 #endif // _WX_WEBREQUEST_H
@@ -111,6 +111,26 @@ class WXDLLIMPEXP_WEBVIEW wxWebViewHandlerResponseData
 public:
     virtual ~wxWebViewHandlerResponseData() = default;
     virtual wxInputStream* GetStream() = 0;
+    virtual wxFileOffset GetContentLength();
+};
+
+class WXDLLIMPEXP_WEBVIEW wxWebViewHandlerResponseDataStream : public wxWebViewHandlerResponseData
+{
+public:
+    // Takes ownership of the stream.
+    explicit wxWebViewHandlerResponseDataStream(wxInputStream* stream,
+                                                wxFileOffset length = wxInvalidOffset)
+        : m_stream(stream), m_length(length) { }
+    virtual ~wxWebViewHandlerResponseDataStream() { delete m_stream; }
+
+    virtual wxInputStream* GetStream() override { return m_stream; }
+    virtual wxFileOffset GetContentLength() override;
+
+private:
+    wxInputStream* const m_stream;
+    const wxFileOffset m_length;
+
+    wxDECLARE_NO_COPY_CLASS(wxWebViewHandlerResponseDataStream);
 };
 
 class WXDLLIMPEXP_WEBVIEW wxWebViewHandlerResponse
@@ -122,6 +142,7 @@ public:
     virtual void SetHeader(const wxString& name, const wxString& value) = 0;
     virtual void Finish(wxSharedPtr<wxWebViewHandlerResponseData> data) = 0;
     virtual void Finish(const wxString& text, const wxMBConv& conv = wxConvUTF8);
+    virtual void Finish(wxInputStream* stream, wxFileOffset length = wxInvalidOffset);
     virtual void FinishWithError() = 0;
 };
 
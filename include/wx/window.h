@@ -39,6 +39,8 @@
 
 #if wxUSE_ACCESSIBILITY
 #include "wx/access.h"
+
+#include <functional>
 #endif
 
 // when building wxUniv/Foo we don't want the code for native menu use to be
@@ -1133,6 +1135,21 @@ public:
         // clear the window background
     virtual void ClearBackground();
 
+        // call the given function once, just before the next frame of this
+        // window is drawn: this allows updating animations and live data at
+        // most once per display frame; the function argument is the frame
+        // time in microseconds (only the differences between the values
+        // passed to the successive calls are meaningful)
+    using FrameCallback = std::function<void (wxLongLong frameTime)>;
+    void RequestFrame(const FrameCallback& callback);
+
+        // return true if RequestFrame() was called and the callbacks were not
+        // called yet
+    bool HasPendingFrameCallbacks() const { return !m_frameCallbacks.empty(); }
+
+        // implementation only: call all pending frame callbacks
+    void WXProcessFrameCallbacks(wxLongLong frameTime);
+
         // freeze the window: don't redraw it until it is thawed
     void Freeze();
 
@@ -1528,6 +1545,19 @@ public:
         // lay out the window and its children
     virtual bool Layout();
 
+        // schedule Layout() to be called later, at idle time, coalescing
+        // several calls to this function into a single layout
+    void ScheduleLayout();
+    bool IsLayoutScheduled() const { return m_layoutScheduled; }
+
+        // perform all the scheduled layouts right now (this is done
+        // automatically at idle time)
+    static void ProcessScheduledLayouts();
+
+        // implementation only: cancel the scheduled layout as it has been
+        // done by other means
+    void WXCancelScheduledLayout();
+
         // sizers
     void SetSizer(wxSizer *sizer, bool deleteOld = true );
     void SetSizerAndFit( wxSizer *sizer, bool deleteOld = true );
@@ -1580,6 +1610,16 @@ public:
     // Returns true if more idle time is requested.
     virtual bool SendIdleEvents(wxIdleEvent& event);
 
+    // Return true if this window should get idle events when using
+    // wxIDLE_PROCESS_REGISTERED mode, i.e. if it has wxWS_EX_PROCESS_IDLE
+    // style or a wxEVT_IDLE handler in its event table or bound to it.
+    bool WXIsRegisteredForIdle() const;
+
+    // Same for wxEVT_UPDATE_UI and wxUPDATE_UI_PROCESS_REGISTERED mode, but
+    // also returns true if any parent of this window is registered, as UI
+    // update events propagate upwards and can be handled there.
+    bool WXIsRegisteredForUpdateUI() const;
+
     // Send wxContextMenuEvent and return true if it was processed.
     //
     // Note that the event may end up being sent to a different window, if this
@@ -1704,6 +1744,14 @@ protected:
     virtual bool TryBefore(wxEvent& event) override;
     virtual bool TryAfter(wxEvent& event) override;
 
+    // Register the window for idle or UI update events when a handler for
+    // them is bound to it.
+    virtual bool OnDynamicBind(wxDynamicEventTableEntry& entry) override;
+
+    // Set m_hasIdleHandler and m_hasUpdateUIHandler if the static event table
+    // has entries for these events, if not done yet.
+    void CheckEventTableHandlers() const;
+
     enum WindowOrder
     {
         OrderBefore,     // insert before the given window
@@ -1806,6 +1854,12 @@ protected:
     // Layout() window automatically when its size changes?
     bool                 m_autoLayout:1;
 
+    // was ScheduleLayout() called but Layout() not done yet?
+    bool                 m_layoutScheduled:1;
+
+    // the functions passed to RequestFrame() and not called yet
+    std::vector<FrameCallback> m_frameCallbacks;
+
     // window state
     bool                 m_isShown:1;
     bool                 m_isEnabled:1;
@@ -1824,6 +1878,14 @@ protected:
     // flag disabling accepting focus from keyboard
     bool                 m_disableFocusFromKbd:1;
 
+    // does this window have a wxEVT_IDLE or wxEVT_UPDATE_UI handler? These
+    // flags are set when a handler is bound and also after checking the
+    // static event table, which is done lazily, when they're needed, as the
+    // most derived class event table is unavailable during construction
+    mutable bool         m_hasIdleHandler:1;
+    mutable bool         m_hasUpdateUIHandler:1;
+    mutable bool         m_checkedEventTable:1;
+
     // window attributes
     long                 m_windowStyle,
                          m_exStyle;
@@ -1973,6 +2035,16 @@ protected:
     virtual void DoFreeze() { }
     virtual void DoThaw() { }
 
+    // called by RequestFrame() when the first callback is added, must arrange
+    // for WXProcessFrameCallbacks() to be called before the next frame: the
+    // default implementation uses a timer firing at the typical display
+    // refresh rate, the ports override it to synchronize with the display
+    virtual void DoRequestFrame();
+
+    // called to cancel the request done by DoRequestFrame() when the window
+    // is destroyed
+    virtual void DoCancelFrameRequest();
+
 
     // Must be called when mouse capture is lost to send
     // wxMouseCaptureLostEvent to windows on capture stack.
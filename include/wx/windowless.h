@@ -0,0 +1,282 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        wx/windowless.h
+// Purpose:     Lightweight controls drawn by their parent window
+// Author:      wxWidgets team
+// Created:     2026-10-15
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef _WX_WINDOWLESS_H_
+#define _WX_WINDOWLESS_H_
+
+#include "wx/panel.h"
+#include "wx/bmpbndl.h"
+
+#include <vector>
+
+class WXDLLIMPEXP_FWD_CORE wxSizer;
+class WXDLLIMPEXP_FWD_CORE wxSizerItem;
+class WXDLLIMPEXP_FWD_CORE wxSizerFlags;
+class WXDLLIMPEXP_FWD_CORE wxWindowlessPanel;
+
+class wxWindowlessSizer;
+
+// ----------------------------------------------------------------------------
+// wxWindowlessControl: base class for controls without their own window
+// ----------------------------------------------------------------------------
+
+class WXDLLIMPEXP_CORE wxWindowlessControl : public wxEvtHandler
+{
+public:
+    // The control is owned by its parent, which will delete it when it's
+    // destroyed itself, but it can also be deleted directly at any moment.
+    wxWindowlessControl(wxWindowlessPanel* parent,
+                        wxWindowID id = wxID_ANY,
+                        const wxPoint& pos = wxDefaultPosition,
+                        const wxSize& size = wxDefaultSize);
+    virtual ~wxWindowlessControl();
+
+    wxWindowlessPanel* GetParent() const { return m_parent; }
+    wxWindowID GetId() const { return m_id; }
+
+
+    // Position and size, in the parent client coordinates.
+    void SetSize(const wxRect& rect);
+    void SetSize(const wxSize& size) { SetSize(wxRect(GetPosition(), size)); }
+    void Move(const wxPoint& pos) { SetSize(wxRect(pos, GetSize())); }
+
+    const wxRect& GetRect() const { return m_rect; }
+    wxPoint GetPosition() const { return m_rect.GetPosition(); }
+    wxSize GetSize() const { return m_rect.GetSize(); }
+
+    // Minimal size, by default the same as the best size, but any components
+    // of the size specified when creating the control override it.
+    void SetMinSize(const wxSize& size);
+    wxSize GetMinSize() const { return m_minSize; }
+    wxSize GetEffectiveMinSize() const;
+
+    wxSize GetBestSize() const;
+    void InvalidateBestSize();
+
+
+    // Visibility and enabled state, as for the windows.
+    bool Show(bool show = true);
+    bool Hide() { return Show(false); }
+    bool IsShown() const { return m_isShown; }
+
+    bool Enable(bool enable = true);
+    bool Disable() { return Enable(false); }
+    bool IsThisEnabled() const { return m_isEnabled; }
+    bool IsEnabled() const;
+
+
+    // Attributes, inherited from the parent if not set.
+    void SetFont(const wxFont& font);
+    wxFont GetFont() const;
+
+    void SetForegroundColour(const wxColour& colour);
+    wxColour GetForegroundColour() const;
+
+
+    // Focus handling: only the controls returning true from AcceptsFocus()
+    // can get focus, which happens when they're clicked or SetFocus() is
+    // called. Such controls get wxEVT_SET_FOCUS and wxEVT_KILL_FOCUS events
+    // and all keyboard events while they have focus.
+    virtual bool AcceptsFocus() const { return false; }
+    void SetFocus();
+    bool HasFocus() const;
+
+
+    // Refresh the area of the parent window covered by this control.
+    void Refresh();
+
+    // Add this control to the given sizer, allowing to use the usual layout
+    // mechanism to position it. Returns the new sizer item.
+    wxSizerItem* AddToSizer(wxSizer* sizer, const wxSizerFlags& flags);
+
+    // Called by the parent to draw the control.
+    void Draw(wxDC& dc);
+
+protected:
+    // Must be overridden to return the size the control needs, the derived
+    // class constructor should call SetSize(GetEffectiveMinSize()) to give
+    // the control its initial size.
+    virtual wxSize DoGetBestSize() const = 0;
+
+    // Must be overridden to draw the control in the given rectangle: the DC
+    // already uses the control font and foreground colour.
+    virtual void DoDraw(wxDC& dc, const wxRect& rect) = 0;
+
+    // Invalidate the best size and update the layout after the contents of
+    // the control changed.
+    void UpdateAfterChange();
+
+    // Propagate the events to the parent window.
+    virtual bool TryAfter(wxEvent& event) override;
+
+private:
+    wxWindowlessPanel* m_parent;
+    wxWindowlessSizer* m_sizer = nullptr;
+
+    wxWindowID m_id;
+    wxRect m_rect;
+    wxSize m_minSize;
+    mutable wxSize m_bestSizeCache;
+
+    wxFont m_font;
+    wxColour m_fgColour;
+
+    bool m_isShown = true;
+    bool m_isEnabled = true;
+
+    // True if m_id was allocated by us and must be released.
+    bool m_ownsId;
+
+    friend class wxWindowlessPanel;
+    friend class wxWindowlessSizer;
+
+    wxDECLARE_NO_COPY_CLASS(wxWindowlessControl);
+};
+
+// ----------------------------------------------------------------------------
+// wxWindowlessStaticText: windowless equivalent of wxGenericStaticText
+// ----------------------------------------------------------------------------
+
+class WXDLLIMPEXP_CORE wxWindowlessStaticText : public wxWindowlessControl
+{
+public:
+    // Only wxALIGN_LEFT, wxALIGN_CENTRE_HORIZONTAL and wxALIGN_RIGHT styles
+    // are supported, as for wxStaticText.
+    wxWindowlessStaticText(wxWindowlessPanel* parent,
+                           wxWindowID id,
+                           const wxString& label,
+                           const wxPoint& pos = wxDefaultPosition,
+                           const wxSize& size = wxDefaultSize,
+                           long style = 0);
+
+    void SetLabel(const wxString& label);
+    const wxString& GetLabel() const { return m_label; }
+
+protected:
+    virtual wxSize DoGetBestSize() const override;
+    virtual void DoDraw(wxDC& dc, const wxRect& rect) override;
+
+private:
+    void UpdateLabel();
+
+    wxString m_label;
+
+    // The label without the mnemonics and the index of the mnemonic in it.
+    wxString m_labelOnly;
+    int m_mnemonic = wxNOT_FOUND;
+
+    const long m_style;
+};
+
+// ----------------------------------------------------------------------------
+// wxWindowlessStaticBitmap: windowless equivalent of wxGenericStaticBitmap
+// ----------------------------------------------------------------------------
+
+class WXDLLIMPEXP_CORE wxWindowlessStaticBitmap : public wxWindowlessControl
+{
+public:
+    wxWindowlessStaticBitmap(wxWindowlessPanel* parent,
+                             wxWindowID id,
+                             const wxBitmapBundle& bitmap,
+                             const wxPoint& pos = wxDefaultPosition,
+                             const wxSize& size = wxDefaultSize);
+
+    void SetBitmap(const wxBitmapBundle& bitmap);
+    const wxBitmapBundle& GetBitmap() const { return m_bitmap; }
+
+protected:
+    virtual wxSize DoGetBestSize() const override;
+    virtual void DoDraw(wxDC& dc, const wxRect& rect) override;
+
+private:
+    wxBitmapBundle m_bitmap;
+};
+
+// ----------------------------------------------------------------------------
+// wxWindowlessPanel: window containing windowless controls
+// ----------------------------------------------------------------------------
+
+class WXDLLIMPEXP_CORE wxWindowlessPanel : public wxPanel
+{
+public:
+    wxWindowlessPanel() = default;
+
+    wxWindowlessPanel(wxWindow *parent,
+                      wxWindowID winid = wxID_ANY,
+                      const wxPoint& pos = wxDefaultPosition,
+                      const wxSize& size = wxDefaultSize,
+                      long style = wxTAB_TRAVERSAL | wxNO_BORDER,
+                      const wxString& name = wxASCII_STR(wxPanelNameStr))
+    {
+        Create(parent, winid, pos, size, style, name);
+    }
+
+    bool Create(wxWindow *parent,
+                wxWindowID winid = wxID_ANY,
+                const wxPoint& pos = wxDefaultPosition,
+                const wxSize& size = wxDefaultSize,
+                long style = wxTAB_TRAVERSAL | wxNO_BORDER,
+                const wxString& name = wxASCII_STR(wxPanelNameStr));
+
+    virtual ~wxWindowlessPanel();
+
+    // Access the windowless controls, in the order of their creation.
+    size_t GetControlsCount() const { return m_controls.size(); }
+    wxWindowlessControl* GetControl(size_t n) const { return m_controls.at(n); }
+
+    // Delete all windowless controls.
+    void DestroyControls();
+
+    // Return the topmost shown control at the given point or null.
+    wxWindowlessControl* HitTestControl(const wxPoint& pt) const;
+
+    // Return the control which has focus when this window has it.
+    wxWindowlessControl* GetFocusedControl() const { return m_focused; }
+
+    virtual bool AcceptsFocus() const override;
+
+protected:
+    virtual bool TryBefore(wxEvent& event) override;
+
+private:
+    void DoDestroyControls();
+    void AddControl(wxWindowlessControl* control);
+    void RemoveControl(wxWindowlessControl* control);
+    void SetFocusedControl(wxWindowlessControl* control);
+
+    // Send a copy of the given mouse or keyboard event to the control,
+    // returns true if it was processed.
+    bool SendMouseEvent(wxWindowlessControl* control,
+                        const wxMouseEvent& event,
+                        wxEventType type = wxEVT_NULL);
+    bool SendKeyEvent(wxWindowlessControl* control, const wxKeyEvent& event);
+    void SendFocusEvent(wxWindowlessControl* control, wxEventType type);
+
+    void OnPaint(wxPaintEvent& event);
+    // Forward the mouse event to the control under mouse, return true if it
+    // processed it.
+    bool ProcessMouseEvent(const wxMouseEvent& event);
+
+    void OnFocus(wxFocusEvent& event);
+
+    std::vector<wxWindowlessControl*> m_controls;
+
+    wxWindowlessControl* m_hovered = nullptr;
+    wxWindowlessControl* m_focused = nullptr;
+
+    // The control which got the mouse button press and which gets all mouse
+    // events until the button is released.
+    wxWindowlessControl* m_mouseCapture = nullptr;
+
+    friend class wxWindowlessControl;
+
+    wxDECLARE_DYNAMIC_CLASS_NO_COPY(wxWindowlessPanel);
+};
+
+#endif // _WX_WINDOWLESS_H_
@@ -12,6 +12,8 @@
 
 #include "wx/sizer.h"
 
+#include <vector>
+
 // flags for wxWrapSizer
 enum
 {
@@ -62,6 +64,10 @@ protected:
     void CalcMinFittingSize(const wxSize& szBoundary);
     void CalcMaxSingleItemSize();
 
+    // return the minimal sizes of all shown items, computing them only once
+    // during each CalcMin() call
+    const std::vector<wxSize>& GetShownItemsMinSizes();
+
     // temporarily change the proportion of the last item of the N-th row to
     // extend to the end of line if the appropriate flag is set
     void AdjustLastRowItemProp(size_t n, wxSizerItem *itemLast);
@@ -95,6 +101,10 @@ protected:
     // our CalcMin()
     wxSize m_calculatedMinSize;
 
+    // the minimal sizes of the shown items, valid only if the flag is set
+    std::vector<wxSize> m_itemMinSizes;
+    bool m_itemMinSizesValid;
+
     wxBoxSizer m_rows;       // Sizer containing multiple rows of our items
 
     wxDECLARE_DYNAMIC_CLASS_NO_COPY(wxWrapSizer);
@@ -38,6 +38,7 @@ class WXDLLIMPEXP_FWD_XML wxXmlDocument;
 class WXDLLIMPEXP_FWD_XML wxXmlIOHandler;
 class WXDLLIMPEXP_FWD_BASE wxInputStream;
 class WXDLLIMPEXP_FWD_BASE wxOutputStream;
+class wxXmlArena;
 
 // Represents XML node type.
 enum wxXmlNodeType
@@ -80,6 +81,13 @@ public:
     void SetValue(const wxString& value) { m_value = value; }
     void SetNext(wxXmlAttribute *next) { m_next = next; }
 
+    // Allocation functions allowing wxXmlDocument::Load() to allocate the
+    // attributes from an arena when wxXMLDOC_USE_ARENA is used.
+    static void* operator new(size_t size);
+    static void* operator new(size_t size, wxXmlArena& arena);
+    static void operator delete(void* p);
+    static void operator delete(void* p, wxXmlArena& arena);
+
 private:
     wxString m_name;
     wxString m_value;
@@ -168,6 +176,13 @@ public:
     bool GetNoConversion() const { return m_noConversion; }
     void SetNoConversion(bool noconversion) { m_noConversion = noconversion; }
 
+    // Allocation functions allowing wxXmlDocument::Load() to allocate the
+    // nodes from an arena when wxXMLDOC_USE_ARENA is used.
+    static void* operator new(size_t size);
+    static void* operator new(size_t size, wxXmlArena& arena);
+    static void operator delete(void* p);
+    static void operator delete(void* p, wxXmlArena& arena);
+
 private:
     wxXmlNodeType m_type;
     wxString m_name;
@@ -220,7 +235,10 @@ private:
 enum wxXmlDocumentLoadFlag
 {
     wxXMLDOC_NONE = 0,
-    wxXMLDOC_KEEP_WHITESPACE_NODES = 1
+    wxXMLDOC_KEEP_WHITESPACE_NODES = 1,
+
+    // Allocate the nodes from big memory blocks instead of individually.
+    wxXMLDOC_USE_ARENA = 2
 };
 
 // Create an instance of this and pass it to wxXmlDocument::Load()
@@ -233,6 +251,131 @@ struct wxXmlParseError
     wxFileOffset offset = 0;
 };
 
+// Derive from this class and pass it to wxXmlDocument::Load() to process the
+// elements as soon as they are parsed instead of after loading the document.
+class WXDLLIMPEXP_XML wxXmlParseHandler
+{
+public:
+    wxXmlParseHandler() = default;
+    virtual ~wxXmlParseHandler() = default;
+
+    // Called after parsing the closing tag of the given element. Return true
+    // if the node is not needed any longer and should be removed from the
+    // document and deleted.
+    virtual bool OnElementParsed(wxXmlNode* node) = 0;
+
+    wxDECLARE_NO_COPY_CLASS(wxXmlParseHandler);
+};
+
+// Kinds of items returned by wxXmlReader::Next().
+enum wxXmlReaderEvent
+{
+    wxXML_READER_END_DOCUMENT,      // the entire document has been read
+    wxXML_READER_ERROR,             // parsing failed, see GetError()
+    wxXML_READER_START_ELEMENT,     // element start tag with its attributes
+    wxXML_READER_END_ELEMENT,       // element end tag
+    wxXML_READER_TEXT,              // text contents of an element
+    wxXML_READER_CDATA,             // contents of a CDATA section
+    wxXML_READER_COMMENT,           // comment
+    wxXML_READER_PI,                // processing instruction
+    wxXML_READER_DOCTYPE            // document type declaration
+};
+
+// Non-owning view of an UTF-8 string returned by wxXmlReader, it's only valid
+// until the next call to wxXmlReader::Next().
+class wxXmlStringView
+{
+public:
+    wxXmlStringView() = default;
+    wxXmlStringView(const char* data, size_t length)
+        : m_data(data), m_length(length)
+    {
+    }
+
+    const char* data() const { return m_data; }
+    size_t length() const { return m_length; }
+    size_t size() const { return m_length; }
+    bool empty() const { return m_length == 0; }
+
+    // Creates a string with a copy of the data.
+    wxString ToString() const
+    {
+        return wxString::FromUTF8Unchecked(m_data, m_length);
+    }
+
+    bool IsSameAs(const char* s) const
+    {
+        return strlen(s) == m_length && memcmp(s, m_data, m_length) == 0;
+    }
+
+    bool operator==(const char* s) const { return IsSameAs(s); }
+    bool operator!=(const char* s) const { return !IsSameAs(s); }
+
+#ifdef wxHAS_STD_STRING_VIEW
+    operator std::string_view() const { return std::string_view(m_data, m_length); }
+#endif // wxHAS_STD_STRING_VIEW
+
+private:
+    const char* m_data = "";
+    size_t m_length = 0;
+};
+
+struct wxXmlReaderData;
+
+// Pull parser returning the items of an XML document one by one, without
+// building the document tree, so that it can be used to process arbitrarily
+// big documents using a constant amount of memory.
+class WXDLLIMPEXP_XML wxXmlReader
+{
+public:
+    // Only wxXMLDOC_KEEP_WHITESPACE_NODES flag is currently supported: if it
+    // is not specified, text consisting of white space only is not returned.
+    explicit wxXmlReader(wxInputStream& stream, int flags = wxXMLDOC_NONE);
+    ~wxXmlReader();
+
+    // Advances to the next item and returns its kind. Once the end of the
+    // document is reached or an error occurs, keeps returning the same value.
+    wxXmlReaderEvent Next();
+
+    // Returns the kind of the current item.
+    wxXmlReaderEvent GetEvent() const;
+
+    // Returns the element name or the processing instruction target.
+    wxXmlStringView GetName() const;
+
+    // Returns the text, CDATA section or comment contents or the processing
+    // instruction data.
+    wxXmlStringView GetValue() const;
+
+    // Accessors for the attributes of wxXML_READER_START_ELEMENT.
+    size_t GetAttributeCount() const;
+    wxXmlStringView GetAttributeName(size_t n) const;
+    wxXmlStringView GetAttributeValue(size_t n) const;
+    bool GetAttribute(const char* name, wxXmlStringView* value) const;
+
+    // Returns the document type for wxXML_READER_DOCTYPE.
+    wxXmlDoctype GetDoctype() const;
+
+    // Returns the line number of the current item.
+    int GetLineNumber() const;
+
+    // Returns the number of elements containing the current item, i.e. 0 for
+    // both the start and the end of the root element.
+    int GetDepth() const;
+
+    // Returns the values from the XML declaration, if it was already read.
+    const wxString& GetVersion() const;
+    const wxString& GetFileEncoding() const;
+
+    // Returns information about the error after wxXML_READER_ERROR.
+    const wxXmlParseError& GetError() const;
+
+private:
+    std::unique_ptr<wxXmlReaderData> m_data;
+
+    wxDECLARE_NO_COPY_CLASS(wxXmlReader);
+};
+
 // This class holds XML data/document as parsed by XML parser.
 
 class WXDLLIMPEXP_XML wxXmlDocument : public wxObject
@@ -251,10 +394,27 @@ public:
     bool Load(const wxString& filename, int flags = wxXMLDOC_NONE, wxXmlParseError* err = nullptr);
     bool Load(wxInputStream& stream, int flags = wxXMLDOC_NONE, wxXmlParseError* err = nullptr);
 
+    // Same as above, but calls the handler for each element once it's parsed.
+    bool Load(wxInputStream& stream, wxXmlParseHandler& handler,
+              int flags = wxXMLDOC_NONE, wxXmlParseError* err = nullptr);
+
     // Saves document as .xml file.
     virtual bool Save(const wxString& filename, int indentstep = 2) const;
     virtual bool Save(wxOutputStream& stream, int indentstep = 2) const;
 
+    // Saves document in the compact binary format which can be loaded much
+    // faster than XML, e.g. for the compiled XRC resources.
+    bool SaveBinary(wxOutputStream& stream) const;
+
+    // Loads document saved by SaveBinary() from memory or a stream.
+    bool LoadBinary(const void* data, size_t length, int flags = wxXMLDOC_NONE);
+    bool LoadBinary(wxInputStream& stream, int flags = wxXMLDOC_NONE);
+
+    // Returns true if the data starts with the binary format signature. The
+    // stream overload doesn't consume any data from the stream.
+    static bool IsBinary(const void* data, size_t length);
+    static bool IsBinary(wxInputStream& stream);
+
     bool IsOk() const { return GetRoot() != nullptr; }
 
     // Returns root node of the document.
@@ -326,6 +486,8 @@ private:
     wxString m_eol = wxS("\n");
 
     void DoCopy(const wxXmlDocument& doc);
+    bool DoLoad(wxInputStream& stream, wxXmlParseHandler* handler,
+                int flags, wxXmlParseError* err);
 
     wxDECLARE_CLASS(wxXmlDocument);
 };
@@ -28,6 +28,9 @@
 
 #include "wx/xrc/xmlreshandler.h"
 
+#include <utility>
+#include <vector>
+
 class WXDLLIMPEXP_FWD_BASE wxFileName;
 
 class WXDLLIMPEXP_FWD_CORE wxIconBundle;
@@ -681,6 +684,12 @@ public:
     void ReportError(const wxString& message) override;
     // reports input error when parsing parameter with given name
     void ReportParamError(const wxString& param, const wxString& message) override;
+
+private:
+    // Element children of m_paramIndexNode sorted by name, used by
+    // GetParamNode() to avoid looking through all children every time.
+    std::vector<std::pair<const wxString*, wxXmlNode*>> m_paramIndex;
+    const wxXmlNode* m_paramIndexNode = nullptr;
 };
 
 
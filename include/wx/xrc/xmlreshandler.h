@@ -220,6 +220,17 @@ public:
     // Add styles common to all wxWindow-derived classes.
     void AddWindowStyles();
 
+    // Add the class (e.g. "wxButton") to the list of classes of the object
+    // nodes which may be handled by this handler. If any classes are added,
+    // CanHandle() is only called for the object nodes of these classes, so
+    // all of them must be added, including the ones only handled in some
+    // context, such as "notebookpage".
+    void AddHandledClass(const wxString& classname);
+
+    // Returns the classes added with AddHandledClass(), if this array is
+    // empty, CanHandle() is called for the nodes of all classes.
+    const wxArrayString& GetHandledClasses() const { return m_handledClasses; }
+
 protected:
     // Everything else is simply forwarded to wxXmlResourceHandlerImpl.
     void ReportError(wxXmlNode *context, const wxString& message)
@@ -466,6 +477,7 @@ protected:
 
     wxArrayString m_styleNames;
     wxArrayInt m_styleValues;
+    wxArrayString m_handledClasses;
 
     friend class wxXmlResourceHandlerImpl;
 
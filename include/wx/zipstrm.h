@@ -17,6 +17,7 @@
 #include "wx/filename.h"
 
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
 // some methods from wxZipInputStream and wxZipOutputStream stream do not get
@@ -325,6 +326,12 @@ public:
     void SetFormat(wxZipArchiveFormat format)   { m_format = format; }
     wxZipArchiveFormat GetFormat() const        { return m_format; }
 
+#if wxUSE_THREADS
+    // number of threads used for compressing the entries created later
+    int  GetThreadCount() const                 { return m_threadCount; }
+    void SetThreadCount(int count)              { m_threadCount = count; }
+#endif // wxUSE_THREADS
+
 protected:
     virtual size_t WXZIPFIX OnSysWrite(const void *buffer, size_t size) override;
     virtual wxFileOffset OnSysTell() const override      { return m_entrySize; }
@@ -370,6 +377,7 @@ private:
     wxString m_Comment;
     bool m_endrecWritten;
     wxZipArchiveFormat m_format;
+    int m_threadCount;
 
     wxDECLARE_NO_COPY_CLASS(wxZipOutputStream);
 };
@@ -393,6 +401,12 @@ public:
 
     wxZipEntry *GetNextEntry();
 
+    // random access to the entries of a seekable stream by name, the index of
+    // all entries is built from the central directory on first use
+    const wxZipEntry *FindEntry(const wxString& name,
+                                wxPathFormat format = wxPATH_NATIVE);
+    bool OpenEntry(const wxString& name, wxPathFormat format = wxPATH_NATIVE);
+
     wxString WXZIPFIX GetComment();
     int WXZIPFIX GetTotalEntries();
 
@@ -420,6 +434,8 @@ private:
     wxUint32 ReadSignature();
     bool FindEndRecord();
     bool LoadEndRecord();
+    bool LoadIndex();
+    bool AdjustOffset(wxZipEntry& entry) const;
 
     bool AtHeader() const       { return m_headerSize == 0; }
     bool AfterHeader() const    { return m_headerSize > 0 && !m_decomp; }
@@ -446,6 +462,10 @@ private:
     wxUint32 m_signature;
     size_t m_TotalEntries;
     wxString m_Comment;
+    wxFileOffset m_centralOffset;
+    wxFileOffset m_centralSize;
+    std::unordered_map<wxString, std::unique_ptr<wxZipEntry>> m_index;
+    bool m_indexLoaded;
 
     friend bool wxZipOutputStream::CopyEntry(
                     wxZipEntry *entry, wxZipInputStream& inputStream);
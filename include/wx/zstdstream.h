@@ -0,0 +1,149 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        wx/zstdstream.h
+// Purpose:     Filters streams using Zstandard compression
+// Author:      wxWidgets team
+// Created:     2026-10-14
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef _WX_ZSTDSTREAM_H_
+#define _WX_ZSTDSTREAM_H_
+
+#include "wx/defs.h"
+
+#if wxUSE_LIBZSTD && wxUSE_STREAMS
+
+#include "wx/stream.h"
+#include "wx/versioninfo.h"
+
+namespace wxPrivate
+{
+
+// Private wrapper for zstd compression or decompression context and buffers.
+struct wxZstdStream;
+
+// Common part of input and output Zstandard streams: this is just an
+// implementation detail and is not part of the public API.
+class WXDLLIMPEXP_BASE wxZstdData
+{
+protected:
+    wxZstdData();
+    ~wxZstdData();
+
+    wxZstdStream* m_stream;
+    wxFileOffset m_pos;
+
+    wxDECLARE_NO_COPY_CLASS(wxZstdData);
+};
+
+} // namespace wxPrivate
+
+// ----------------------------------------------------------------------------
+// Filter for decompressing data compressed using Zstandard
+// ----------------------------------------------------------------------------
+
+class WXDLLIMPEXP_BASE wxZstdInputStream : public wxFilterInputStream,
+                                           private wxPrivate::wxZstdData
+{
+public:
+    explicit wxZstdInputStream(wxInputStream& stream)
+        : wxFilterInputStream(stream)
+    {
+        Init();
+    }
+
+    explicit wxZstdInputStream(wxInputStream* stream)
+        : wxFilterInputStream(stream)
+    {
+        Init();
+    }
+
+    char Peek() override { return wxInputStream::Peek(); }
+    wxFileOffset GetLength() const override { return wxInputStream::GetLength(); }
+
+protected:
+    size_t OnSysRead(void *buffer, size_t size) override;
+    wxFileOffset OnSysTell() const override { return m_pos; }
+
+private:
+    void Init();
+};
+
+// ----------------------------------------------------------------------------
+// Filter for compressing data using Zstandard algorithm
+// ----------------------------------------------------------------------------
+
+class WXDLLIMPEXP_BASE wxZstdOutputStream : public wxFilterOutputStream,
+                                            private wxPrivate::wxZstdData
+{
+public:
+    explicit wxZstdOutputStream(wxOutputStream& stream, int level = -1)
+        : wxFilterOutputStream(stream)
+    {
+        Init(level);
+    }
+
+    explicit wxZstdOutputStream(wxOutputStream* stream, int level = -1)
+        : wxFilterOutputStream(stream)
+    {
+        Init(level);
+    }
+
+    virtual ~wxZstdOutputStream() { Close(); }
+
+#if wxUSE_THREADS
+    // Use the given number of threads for compression (0 means to use as
+    // many threads as there are CPUs), must be called before writing.
+    bool SetThreadCount(int count);
+#endif // wxUSE_THREADS
+
+    void Sync() override { DoFlush(false); }
+    bool Close() override;
+    wxFileOffset GetLength() const override { return m_pos; }
+
+protected:
+    size_t OnSysWrite(const void *buffer, size_t size) override;
+    wxFileOffset OnSysTell() const override { return m_pos; }
+
+private:
+    void Init(int level);
+
+    // Write the contents of the internal buffer to the output stream.
+    bool UpdateOutput();
+
+    // End the frame (if argument is true) or flush all the data compressed
+    // so far, return true on success or false on error.
+    bool DoFlush(bool finish);
+};
+
+// ----------------------------------------------------------------------------
+// Support for creating Zstandard streams from extension/MIME type
+// ----------------------------------------------------------------------------
+
+class WXDLLIMPEXP_BASE wxZstdClassFactory: public wxFilterClassFactory
+{
+public:
+    wxZstdClassFactory();
+
+    wxFilterInputStream *NewStream(wxInputStream& stream) const override
+        { return new wxZstdInputStream(stream); }
+    wxFilterOutputStream *NewStream(wxOutputStream& stream) const override
+        { return new wxZstdOutputStream(stream, -1); }
+    wxFilterInputStream *NewStream(wxInputStream *stream) const override
+        { return new wxZstdInputStream(stream); }
+    wxFilterOutputStream *NewStream(wxOutputStream *stream) const override
+        { return new wxZstdOutputStream(stream, -1); }
+
+    const wxChar * const *GetProtocols(wxStreamProtocolType type
+                                       = wxSTREAM_PROTOCOL) const override;
+
+private:
+    wxDECLARE_DYNAMIC_CLASS(wxZstdClassFactory);
+};
+
+WXDLLIMPEXP_BASE wxVersionInfo wxGetLibZstdVersionInfo();
+
+#endif // wxUSE_LIBZSTD && wxUSE_STREAMS
+
+#endif // _WX_ZSTDSTREAM_H_
@@ -78,6 +78,13 @@ class WXDLLIMPEXP_BASE wxZlibOutputStream: public wxFilterOutputStream {
   bool SetDictionary(const char *data, size_t datalen);
   bool SetDictionary(const wxMemoryBuffer &buf);
 
+#if wxUSE_THREADS
+  // Compress independent blocks of data using up to the given number of
+  // threads (0 means to use all available ones and 1 to not use any extra
+  // threads), must be called before writing anything to the stream.
+  bool SetThreadCount(int count);
+#endif // wxUSE_THREADS
+
  protected:
   size_t OnSysWrite(const void *buffer, size_t size) override;
   wxFileOffset OnSysTell() const override { return m_pos; }
@@ -93,6 +100,13 @@ class WXDLLIMPEXP_BASE wxZlibOutputStream: public wxFilterOutputStream {
   struct z_stream_s *m_deflate;
   wxFileOffset m_pos;
 
+ private:
+  int m_level;
+  int m_flags;
+
+  // Non-null only if multiple threads are used for compression.
+  class wxZlibParallelDeflate *m_parallel;
+
   wxDECLARE_NO_COPY_CLASS(wxZlibOutputStream);
 };
 
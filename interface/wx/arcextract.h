@@ -0,0 +1,190 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        wx/arcextract.h
+// Purpose:     interface of wxArchiveExtractor and wxArchiveExtractorEvent
+// Author:      wxWidgets team
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+    @class wxArchiveExtractor
+
+    Extracts all entries of an archive file to a directory, possibly using
+    several threads.
+
+    This class can be used with any archive format supporting opening its
+    entries directly, i.e. using wxArchiveInputStream::OpenEntry(), such as
+    ZIP or TAR. It first reads the list of all archive entries and then
+    extracts the files in parallel, with each thread using its own stream for
+    reading the archive, which is why the archive must be a file and not an
+    arbitrary stream.
+
+    Extract() blocks until all the entries are extracted, but sends
+    ::wxEVT_ARCHIVE_EXTRACT events after extracting each of them, which can
+    be used to show the progress of the operation, e.g.
+    @code
+    wxArchiveExtractor extractor("archive.zip");
+    extractor.Bind(wxEVT_ARCHIVE_EXTRACT, [&](wxArchiveExtractorEvent& event)
+        {
+            if ( !progressDlg.Update(event.GetExtractedCount(),
+                                     event.GetEntryName()) )
+                extractor.Cancel();
+        });
+
+    if ( !extractor.Extract(destDir) )
+        wxLogError("Failed to extract the archive.");
+    @endcode
+
+    Notice that these events are always sent from the thread calling
+    Extract(), even when the files are extracted by the other threads.
+
+    The entries with absolute names or names containing ".." components are
+    considered unsafe, as they could result in creating files outside of the
+    destination directory, and are not extracted. The modification time and
+    the permissions of the files and directories are set from the archive,
+    however special permission bits, such as set-user-ID one, are ignored.
+
+    This class is only available if @c wxUSE_ARCHIVE_STREAMS and @c wxUSE_FFILE
+    are 1.
+
+    @beginEventEmissionTable{wxArchiveExtractorEvent}
+    @event{EVT_ARCHIVE_EXTRACT(id, func)}
+        Process a @c wxEVT_ARCHIVE_EXTRACT event, sent after extracting each
+        archive entry.
+    @endEventTable
+
+    @library{wxbase}
+    @category{archive,streams}
+
+    @see wxArchiveInputStream, wxThreadPool
+
+    @since 3.3.0
+*/
+class wxArchiveExtractor : public wxEvtHandler
+{
+public:
+    /**
+        Creates the object for extracting the given archive file.
+
+        @param archive
+            The path of the archive file.
+        @param factory
+            The factory to use for reading the archive. If it is not
+            specified, the factory corresponding to the extension of the
+            archive file name is used, see wxArchiveClassFactory::Find().
+    */
+    explicit wxArchiveExtractor(const wxString& archive,
+                                const wxArchiveClassFactory* factory = nullptr);
+
+    /**
+        Sets the number of threads to use for extracting the files.
+
+        By default, or if @a count is 0, as many threads as there are CPUs in
+        the system are used. If @a count is 1, the files are extracted by the
+        thread calling Extract() without using any other threads.
+
+        Notice that the threads of the global wxThreadPool are used, so the
+        effective number of threads is limited by its size. Also, no
+        additional threads are used if Extract() is called from one of the
+        pool threads.
+    */
+    void SetThreadCount(int count);
+
+    /**
+        Returns the number of threads set by SetThreadCount().
+    */
+    int GetThreadCount() const;
+
+    /**
+        Extracts all archive entries to the given directory.
+
+        The destination directory and all the intermediate directories are
+        created if necessary. The existing files are overwritten.
+
+        @return @true if all entries were extracted successfully or @false if
+            the archive couldn't be read, any of its entries couldn't be
+            extracted or Cancel() was called. Note that in the case of error
+            the other entries are still extracted.
+    */
+    bool Extract(const wxString& destDir);
+
+    /**
+        Stops extracting the remaining entries.
+
+        This function is typically called from wxEVT_ARCHIVE_EXTRACT handler.
+        No more events are sent after calling it and Extract() returns @false
+        as soon as the entries currently being extracted by the other threads
+        are done.
+    */
+    void Cancel();
+
+    /**
+        Returns @true if Cancel() was called during the last call to Extract().
+    */
+    bool IsCancelled() const;
+};
+
+
+/**
+    @class wxArchiveExtractorEvent
+
+    This event is sent by wxArchiveExtractor after extracting each archive
+    entry.
+
+    @beginEventTable{wxArchiveExtractorEvent}
+    @event{EVT_ARCHIVE_EXTRACT(id, func)}
+        Process a @c wxEVT_ARCHIVE_EXTRACT event.
+    @endEventTable
+
+    @library{wxbase}
+    @category{events,archive}
+
+    @see wxArchiveExtractor, @ref overview_events
+
+    @since 3.3.0
+*/
+class wxArchiveExtractorEvent : public wxEvent
+{
+public:
+    /**
+        Default constructor, only used by wxWidgets itself.
+    */
+    wxArchiveExtractorEvent(wxEventType type = wxEVT_NULL, int id = wxID_ANY);
+
+    /**
+        Returns the name of the entry which was just extracted.
+    */
+    const wxString& GetEntryName() const;
+
+    /**
+        Returns the full path of the file or directory created for the entry.
+    */
+    const wxString& GetPath() const;
+
+    /**
+        Returns @false if extracting this entry failed.
+    */
+    bool IsOk() const;
+
+    /**
+        Returns the number of entries processed so far, including this one.
+    */
+    size_t GetExtractedCount() const;
+
+    /**
+        Returns the total number of entries to extract.
+    */
+    size_t GetTotalCount() const;
+
+    /**
+        Returns the total size of the files extracted so far.
+    */
+    wxFileOffset GetExtractedSize() const;
+
+    /**
+        Returns the total size of all the files to extract.
+    */
+    wxFileOffset GetTotalSize() const;
+};
+
+
+wxEventType wxEVT_ARCHIVE_EXTRACT;
@@ -303,6 +303,11 @@ public:
 
         array.Sort(CompareStringLen);
         @endcode
+
+        Note that sorting using wxCmpNaturalGeneric(), or wxCmpNatural() when
+        it uses the generic implementation, is optimized to split each string
+        into fragments only once, so it's much faster to pass these functions
+        directly to this method rather than wrapping them in another function.
     */
     void Sort(CompareFunction compareFunction);
 
@@ -390,6 +395,20 @@ public:
     */
     size_t Add(const wxString& str, size_t copies = 1);
 
+    ///@{
+    /**
+        Adds all strings from the given range or array to this one.
+
+        The result is the same as calling Add() for each of the strings, but
+        this function is much more efficient when adding many strings at once
+        as it sorts the new strings only once and then merges them with the
+        existing ones instead of inserting them one by one.
+
+        @since 3.3.0
+    */
+    void AddSorted(const wxString* first, const wxString* last);
+    void AddSorted(const wxArrayString& strings);
+    ///@}
 
     /**
         @copydoc wxArrayString::Index()
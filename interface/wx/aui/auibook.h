@@ -580,6 +580,20 @@ public:
     // Make the tab visible if it wasn't already
     void MakeTabVisible(int tabPage, wxWindow* win);
 
+    /**
+        Forget the cached tab sizes.
+
+        The sizes of the tabs returned by wxAuiTabArt::GetTabSize() are cached
+        and only recomputed when the tab caption, bitmap or state changes or
+        when the art provider, its fonts or the container flags or size are
+        changed using this class methods. If a custom art provider uses any
+        other information for computing the tab sizes, this function must be
+        called when it changes.
+
+        @since 3.3.0
+    */
+    void InvalidateTabSizes();
+
 protected:
 
     virtual void Render(wxDC* dc, wxWindow* wnd);
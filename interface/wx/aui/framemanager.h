@@ -515,6 +515,14 @@ public:
         wxAuiPaneInfo structures (retrieved with wxAuiManager::GetPane), but to
         realize the changes, Update() must be called. This construction allows
         pane flicker to be avoided by updating the whole layout at one time.
+
+        Since wxWidgets 3.3.0, the layout of the docked panes is only
+        recreated if anything affecting it, such as the position, size or
+        visibility of any pane or the size of the managed window, has changed
+        since the last call to this function, so calling it when only the
+        floating panes or pane captions were modified is relatively cheap.
+        The time taken by this function is logged using the "aui" trace mask,
+        see wxLogTrace().
     */
     void Update();
 
@@ -76,6 +76,26 @@ wxString wxBase64Encode(const void* src, size_t srcLen);
 */
 wxString wxBase64Encode(const wxMemoryBuffer& buf);
 
+/**
+    This function encodes all data read from the input stream using base64 and
+    writes the result to the output stream.
+
+    The data is processed in chunks, so this function can be used for
+    encoding data too big to be conveniently kept in memory.
+
+    @param dst
+        The output stream receiving the encoded data.
+    @param src
+        The input stream which is read until its end.
+    @return The number of characters written or wxCONV_FAILED if writing to
+        the output stream failed.
+
+    @header{wx/base64.h}
+
+    @since 3.3.0
+*/
+size_t wxBase64Encode(wxOutputStream& dst, wxInputStream& src);
+
 
 /**
     Returns the size of the buffer necessary to contain the data encoded in a
@@ -187,5 +207,33 @@ wxMemoryBuffer wxBase64Decode(const wxString& src,
                               wxBase64DecodeMode mode = wxBase64DecodeMode_Strict,
                               size_t *posErr = nullptr);
 
+/**
+    Decode all Base64-encoded data read from the input stream and write the
+    result to the output stream.
+
+    See the wxBase64Decode(void*,size_t,const char*,size_t,wxBase64DecodeMode,size_t*)
+    overload for more information about the @a mode parameter.
+
+    The data is processed in chunks, so this function can be used for
+    decoding data too big to be conveniently kept in memory. Notice that, as
+    a consequence, some of the data may have been already written to the
+    output stream even if this function fails.
+
+    @param dst
+        The output stream receiving the decoded data.
+    @param src
+        The input stream which is read until its end.
+    @param mode
+        Specifies how to handle the invalid characters in the input.
+    @return The number of bytes written or wxCONV_FAILED if the input is
+        invalid or writing to the output stream failed.
+
+    @header{wx/base64.h}
+
+    @since 3.3.0
+*/
+size_t wxBase64Decode(wxOutputStream& dst, wxInputStream& src,
+                      wxBase64DecodeMode mode = wxBase64DecodeMode_Strict);
+
 ///@}
 
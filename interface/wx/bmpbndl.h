@@ -323,6 +323,37 @@ public:
      */
     static wxBitmapBundle FromSVGResource(const wxString& name, const wxSize& sizeDef);
 
+    /**
+        Set the maximal total size of the bitmaps rasterized from SVG images
+        kept in memory.
+
+        All bundles created by FromSVG() and the related functions share the
+        same cache of the bitmaps rasterized from them, so that requesting the
+        bitmap of the same size from the bundles created from the same SVG
+        data doesn't rasterize it again, even if the bundles are different.
+        The SVG data itself is also parsed only once in this case.
+
+        When the total size of the cached bitmaps, computed as width times
+        height times 4 bytes, exceeds @a maxSize, the least recently used
+        bitmaps are removed from the cache. Setting the size to 0 disables
+        the cache.
+
+        The default maximal size is 16MiB.
+
+        @since 3.3.0
+     */
+    static void SetSVGCacheMaxSize(size_t maxSize);
+
+    /**
+        Get the maximal total size of the bitmaps rasterized from SVG images
+        kept in memory.
+
+        @see SetSVGCacheMaxSize()
+
+        @since 3.3.0
+     */
+    static size_t GetSVGCacheMaxSize();
+
     /**
         Clear the existing bundle contents.
 
@@ -439,6 +470,36 @@ public:
      */
     wxIcon GetIconFor(const wxWindow* window) const;
 
+    /**
+        Prepare the bitmaps for the given scale in the background.
+
+        This function creates the bitmaps of the preferred size at the given
+        @a scale, as returned by GetPreferredBitmapSizeAtScale(), for all the
+        given bundles in a worker thread. The subsequent calls to GetBitmap()
+        for this size then return the already prepared bitmaps, without
+        having to rasterize SVG images or rescale the existing bitmaps.
+
+        This is useful when a window is about to be shown on a display using
+        a different DPI scaling, e.g. in wxEVT_DPI_CHANGED handler, to avoid
+        delays when repainting it.
+
+        The function returns immediately and the bitmaps are added to the
+        bundles when the corresponding event, generated when they are ready,
+        is processed in the main thread. Calling GetBitmap() before this
+        happens just creates the bitmap synchronously, as usual.
+
+        Only the bundles created by FromSVG() and the related functions or
+        from bitmaps benefit from this, for the other ones it doesn't do
+        anything. If threads are not available, the bitmaps are created
+        synchronously.
+
+        This function can only be called from the main thread.
+
+        @since 3.3.0
+     */
+    static void PrepareBitmaps(const wxVector<wxBitmapBundle>& bundles,
+                               double scale);
+
     /**
         Check if the two bundles refer to the same object.
 
@@ -525,6 +586,35 @@ public:
      */
     virtual wxBitmap GetBitmap(const wxSize& size) = 0;
 
+    /**
+        Return the function creating the image of the given size.
+
+        This function is used by wxBitmapBundle::PrepareBitmaps() and is
+        called in the main thread. The returned function is called in a
+        worker thread and so may only use the data which remain valid while
+        this object is alive and are not modified by the other functions of
+        this class. Notably, it must not use any wxBitmap objects.
+
+        Override this function and AddPreparedImage() to support preparing
+        the bitmaps in the background. The default implementation returns an
+        empty function, meaning that there is nothing to prepare.
+
+        @since 3.3.0
+     */
+    virtual std::function<wxImage ()> CreateImageMaker(const wxSize& size);
+
+    /**
+        Add the bitmap created from the image prepared in the background.
+
+        This function is called in the main thread with the image returned by
+        the function created by CreateImageMaker(). It should create the
+        bitmap from it and return it from the subsequent GetBitmap() calls
+        for the size of this image.
+
+        @since 3.3.0
+     */
+    virtual void AddPreparedImage(const wxImage& image);
+
 protected:
     /**
         Helper for implementing GetPreferredBitmapSizeAtScale() in the derived
@@ -315,6 +315,108 @@ public:
                             bool select = false,
                             int imageId = NO_IMAGE) = 0;
 
+    /**
+        Type of the function used to create the page window on demand.
+
+        The function is passed the window which must be used as parent of the
+        page and must return the newly created page window.
+
+        @since 3.3.0
+     */
+    using PageFactory = std::function<wxWindow* (wxWindow* parent)>;
+
+    /**
+        Adds a new page which is only created when it is shown for the first
+        time.
+
+        This function is similar to AddPage() but instead of taking an already
+        existing window, it takes a function which will be called to create the
+        page window when the page becomes selected for the first time. This
+        allows to avoid creating the windows for all pages of a control with
+        many of them up front, which can significantly speed up showing e.g. a
+        dialog containing such a control.
+
+        Note that the window returned by GetPage() for such pages is not the
+        window created by @a factory, but a placeholder containing it (the
+        created window is its only child and is resized to fill it). This also
+        means that the best size of the control doesn't take into account the
+        best size of the pages which haven't been created yet, so it's
+        recommended to give it a sufficiently large size explicitly.
+
+        @param factory
+            Function called to create the page window, must not be empty.
+        @param text
+            Specifies the text for the new page.
+        @param select
+            Specifies whether the page should be selected.
+        @param imageId
+            Specifies the optional image index for the new page.
+
+        @return @true if successful, @false otherwise.
+
+        @see InsertPageLazy(), IsPageCreated(), DestroyInactiveLazyPages()
+
+        @since 3.3.0
+     */
+    bool AddPageLazy(const PageFactory& factory,
+                     const wxString& text,
+                     bool select = false,
+                     int imageId = NO_IMAGE);
+
+    /**
+        Inserts a new page created on demand at the specified position.
+
+        See AddPageLazy() for more details.
+
+        @since 3.3.0
+     */
+    bool InsertPageLazy(size_t index,
+                        const PageFactory& factory,
+                        const wxString& text,
+                        bool select = false,
+                        int imageId = NO_IMAGE);
+
+    /**
+        Returns @true if the window of the given page has been created.
+
+        This function always returns @true for the pages added using
+        AddPage() or InsertPage() and only returns @true for the pages added
+        using AddPageLazy() or InsertPageLazy() if they had been already shown
+        (and not destroyed by DestroyInactiveLazyPages() since then) or
+        CreatePageIfNeeded() had been called for them.
+
+        @since 3.3.0
+     */
+    bool IsPageCreated(size_t page) const;
+
+    /**
+        Creates the window of the given page if it hadn't been created yet.
+
+        For the pages added using AddPageLazy() or InsertPageLazy(), calls the
+        page factory if it hadn't been done yet and returns the created window
+        (which may be @NULL if the factory failed to create it). For all the
+        other pages, simply returns the same value as GetPage().
+
+        @since 3.3.0
+     */
+    wxWindow* CreatePageIfNeeded(size_t page);
+
+    /**
+        Destroys the windows of all the lazily created pages except for the
+        currently selected one.
+
+        The destroyed pages will be created again by calling their factory
+        when they are selected the next time, so this function can be used to
+        release the resources used by the pages which are not shown any more.
+        Note that any state of the destroyed windows is lost, so the
+        application must save it before calling this function if necessary.
+
+        @return The number of destroyed page windows.
+
+        @since 3.3.0
+     */
+    size_t DestroyInactiveLazyPages();
+
     /**
         Deletes the specified page, without deleting the associated window.
 
@@ -62,6 +62,76 @@ public:
     */
     virtual wxString GetName() const;
 
+    /**
+        Returns the approximate amount of memory used by this command.
+
+        Override this function to return the number of bytes used by the
+        command for storing its undo and redo data if you want to use
+        wxCommandProcessor::SetMaxMemoryUsage(). The value returned by this
+        function must only change when the command is modified by the command
+        processor, i.e. when MergeWith(), SpillToStream() or
+        RestoreFromStream() is called.
+
+        The default implementation returns 0.
+
+        @since 3.3.0
+    */
+    virtual size_t GetMemoryUsage() const;
+
+    /**
+        Merges the command that had just been executed into this one.
+
+        This function is called by wxCommandProcessor::Store() for the current
+        command when a new command is stored after it and can be overridden to
+        combine several consecutive commands, e.g. typing single characters,
+        into a single one, which then undoes all of them at once. If this
+        function returns @true, the new command is deleted instead of being
+        added to the history.
+
+        Notice that this function is not called if the document was saved
+        after executing this command.
+
+        The default implementation returns @false.
+
+        @since 3.3.0
+    */
+    virtual bool MergeWith(const wxCommand& command);
+
+    /**
+        Returns @true if this command supports saving its data to disk.
+
+        Override this function and both SpillToStream() and
+        RestoreFromStream() to allow wxCommandProcessor to save the data of
+        this command to disk when it is not needed any more, see
+        wxCommandProcessor::EnableSpilling().
+
+        The default implementation returns @false.
+
+        @since 3.3.0
+    */
+    virtual bool CanSpill() const;
+
+    /**
+        Saves the command data to the given stream and frees it.
+
+        After this function returns @true, GetMemoryUsage() should return a
+        smaller value than before. If it returns @false, the command must
+        remain usable.
+
+        @since 3.3.0
+    */
+    virtual bool SpillToStream(wxOutputStream& stream);
+
+    /**
+        Loads the command data previously saved by SpillToStream().
+
+        This function is called before calling Do() or Undo() for the command
+        whose data was saved to disk.
+
+        @since 3.3.0
+    */
+    virtual bool RestoreFromStream(wxInputStream& stream);
+
     /**
         Override this member function to un-execute a previous Do.
 
@@ -158,6 +228,64 @@ public:
     */
     int GetMaxCommands() const;
 
+    /**
+        Limits the total memory used by the stored commands.
+
+        If the total value returned by wxCommand::GetMemoryUsage() for all the
+        stored commands exceeds @a maxMemory, the oldest commands are saved to
+        disk, if EnableSpilling() had been called, or deleted otherwise. The
+        current command is never deleted, however, even if it alone exceeds
+        the limit.
+
+        @param maxMemory
+            The maximal memory usage in bytes or 0, which is the default, to
+            not limit it.
+
+        @since 3.3.0
+    */
+    void SetMaxMemoryUsage(size_t maxMemory);
+
+    /**
+        Returns the memory limit set by SetMaxMemoryUsage().
+
+        @since 3.3.0
+    */
+    size_t GetMaxMemoryUsage() const;
+
+    /**
+        Returns the total memory used by the stored commands.
+
+        @see wxCommand::GetMemoryUsage()
+
+        @since 3.3.0
+    */
+    size_t GetMemoryUsage() const;
+
+    /**
+        Enables saving the old commands to disk.
+
+        If enabled, the oldest commands supporting it (see
+        wxCommand::CanSpill()) are saved to temporary files instead of being
+        deleted when the limit set by SetMaxMemoryUsage() is exceeded. They
+        are transparently loaded back when they are undone or redone.
+
+        @param enable
+            Whether to enable or disable spilling the commands to disk.
+        @param dir
+            Directory to create the temporary files in, the default temporary
+            directory is used if it is empty.
+
+        @since 3.3.0
+    */
+    void EnableSpilling(bool enable = true, const wxString& dir = wxString());
+
+    /**
+        Returns @true if EnableSpilling() had been called.
+
+        @since 3.3.0
+    */
+    bool IsSpillingEnabled() const;
+
     /**
         Returns the string that will be appended to the Redo menu item.
     */
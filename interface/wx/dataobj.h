@@ -338,7 +338,8 @@ public:
     This class may be used as is, but if you don't want store the data inside
     the object but provide it on demand instead, you should override GetSize(),
     GetData() and SetData() (or may be only the first two or only the last one
-    if you only allow reading/writing the data).
+    if you only allow reading/writing the data). Alternatively, you may use
+    SetDataProvider() to only create the data when it is needed.
 
     @library{wxcore}
     @category{dnd}
@@ -398,6 +399,35 @@ public:
         ownership of the pointer.
     */
     void TakeData(size_t size, void* data);
+
+    /**
+        Type of the function used with SetDataProvider().
+    */
+    using DataProvider = std::function<wxMemoryBuffer ()>;
+
+    /**
+        Set the function creating the data on demand.
+
+        The provider function is called at most once, when the data is needed
+        for the first time. When using this object with wxClipboard under
+        wxGTK and wxMSW, this only happens if the data is actually pasted, so
+        this allows to avoid creating potentially large data which is never
+        used. Under wxOSX, the data is still created immediately when it is
+        put on the clipboard.
+
+        Any previously set data is freed by this function, and calling
+        SetData() or TakeData() later cancels the use of the provider.
+
+        Example of using it for copying a lot of data to the clipboard:
+        @code
+        auto* const data = new wxCustomDataObject(myFormat);
+        data->SetDataProvider([this]() { return SerializeAllCells(); });
+        wxTheClipboard->SetData(data);
+        @endcode
+
+        @since 3.3.0
+    */
+    void SetDataProvider(const DataProvider& provider);
 };
 
 
@@ -711,7 +741,8 @@ public:
     providing text on-demand in order to minimize memory consumption when
     offering data in several formats, such as plain text and RTF because by
     default the text is stored in a string in this class, but it might as well
-    be generated when requested, in which case GetText() should be overridden.
+    be generated when requested, in which case either SetTextProvider() can be
+    used or GetText() should be overridden.
 
     Note that if you already have the text inside a string, you will not
     achieve any efficiency gain by overriding these functions because copying
@@ -781,6 +812,28 @@ public:
         you may wish to override this function.
     */
     virtual void SetText(const wxString& strText);
+
+    /**
+        Type of the function used with SetTextProvider().
+    */
+    using TextProvider = std::function<wxString ()>;
+
+    /**
+        Set the function creating the text on demand.
+
+        The provider function is called at most once, by the default
+        implementation of GetText(), when the text is needed for the first
+        time. When using this object with wxClipboard under wxGTK and wxMSW,
+        this only happens if the text is actually pasted, so this allows to
+        avoid creating potentially large strings which are never used. Under
+        wxOSX, the text is still created immediately when it is put on the
+        clipboard.
+
+        Calling SetText() later cancels the use of the provider.
+
+        @since 3.3.0
+    */
+    void SetTextProvider(const TextProvider& provider);
 };
 
 
@@ -846,4 +899,21 @@ public:
         Sets the HTML string.
     */
     virtual void SetHTML(const wxString& html);
+
+    /**
+        Type of the function used with SetHTMLProvider().
+    */
+    using HTMLProvider = std::function<wxString ()>;
+
+    /**
+        Set the function creating the HTML string on demand.
+
+        This function works in the same way as
+        wxTextDataObject::SetTextProvider(), i.e. the provider is called at
+        most once, when the HTML is needed for the first time, and calling
+        SetHTML() later cancels its use.
+
+        @since 3.3.0
+    */
+    void SetHTMLProvider(const HTMLProvider& provider);
 };
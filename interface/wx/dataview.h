@@ -6,6 +6,67 @@
 /////////////////////////////////////////////////////////////////////////////
 
 
+/**
+    @class wxDataViewSortKey
+
+    Key used for sorting wxDataViewCtrl items in the background.
+
+    Objects of this class are returned by wxDataViewModel::GetSortKeys() and
+    contain either a string or a number. Strings are compared using
+    wxString::Cmp(), numbers are compared numerically and all numbers are
+    considered to be less than all strings.
+
+    @library{wxcore}
+    @category{dvc}
+
+    @since 3.3.0
+*/
+class wxDataViewSortKey
+{
+public:
+    /**
+        Default constructor creates a key containing an empty string.
+    */
+    wxDataViewSortKey();
+
+    /**
+        Creates a key containing the given string.
+    */
+    explicit wxDataViewSortKey(const wxString& str);
+
+    /**
+        Creates a key containing the given number.
+    */
+    explicit wxDataViewSortKey(double number);
+
+    /**
+        Returns @true if this key contains a number.
+    */
+    bool IsNumber() const;
+
+    /**
+        Returns the string contained in this key.
+
+        Returns an empty string if IsNumber() returns @true.
+    */
+    const wxString& GetString() const;
+
+    /**
+        Returns the number contained in this key.
+
+        Returns 0 if IsNumber() returns @false.
+    */
+    double GetNumber() const;
+
+    /**
+        Compares this key with another one.
+
+        Returns a negative, zero or positive value depending on whether this
+        key is less than, equal to or greater than the other one.
+    */
+    int Compare(const wxDataViewSortKey& other) const;
+};
+
 /**
     @class wxDataViewModel
 
@@ -295,6 +356,44 @@ public:
     */
     virtual bool HasDefaultCompare() const;
 
+    /**
+        Get the keys for sorting the given items by the given column.
+
+        This function is used by wxDataViewCtrl when sorting in the
+        background is enabled, see wxDataViewCtrl::EnableBackgroundSorting(),
+        to retrieve the data needed for sorting all the items at once in the
+        main thread. The items are then sorted by comparing the keys using
+        wxDataViewSortKey::Compare() in another thread, so that the model
+        doesn't need to be thread-safe.
+
+        The keys must define the same order as Compare(): the default
+        implementation of this function uses GetValue() and returns the keys
+        consistent with the default implementation of Compare() for all the
+        standard types, i.e. @c string, @c long, @c double, @c datetime,
+        @c bool and wxDataViewIconText, and returns @false if any other type
+        is used, meaning that background sorting can't be used. If Compare()
+        is overridden, this function must be overridden as well, either to
+        return the keys consistent with it or just @false.
+
+        Note that the items with equal keys are ordered by their IDs, as done
+        by the default Compare() implementation.
+
+        @param items
+            The items to return the keys for.
+        @param column
+            The model column to sort by.
+        @param keys
+            The vector to be filled with the keys for all the items, in the
+            same order.
+        @return @true if the keys were successfully retrieved or @false if
+            the items can't be sorted using the keys.
+
+        @since 3.3.0
+    */
+    virtual bool GetSortKeys(const wxDataViewItemArray& items,
+                             unsigned int column,
+                             wxVector<wxDataViewSortKey>& keys) const;
+
     /**
         Return true if there is a value in the given column of this item.
 
@@ -517,6 +616,40 @@ public:
     virtual void GetValueByRow(wxVariant& variant, unsigned int row,
                                unsigned int col) const = 0;
 
+    /**
+        Override this to allow getting the values of several rows at once.
+
+        This function can be overridden by the models storing their data by
+        column to retrieve all values needed by the control, e.g. all the
+        values of the visible rows of the given column when repainting it,
+        more efficiently than by calling GetValueByRow() for each of them.
+
+        Currently it is only used by the generic version of wxDataViewCtrl and
+        only for wxDataViewVirtualListModel, which provides the implementation
+        calling GetValueByRow() for all rows. The default implementation in
+        this class doesn't do anything and just returns @false.
+
+        @param col
+            The column whose values are requested.
+        @param firstRow
+            The first row of the range.
+        @param count
+            The number of rows in the range.
+        @param values
+            The vector to fill with exactly @a count values, the value for
+            @a firstRow first. Any existing contents of this vector must be
+            discarded.
+        @return
+            @true if the values were retrieved or @false if this function is
+            not supported, in which case GetValueByRow() is used instead.
+
+        @since 3.3.0
+    */
+    virtual bool GetValuesForRange(unsigned int col,
+                                   unsigned int firstRow,
+                                   unsigned int count,
+                                   wxVector<wxVariant>& values) const;
+
     /**
         Called in order to set a value in the model.
     */
@@ -676,6 +809,18 @@ public:
     */
     void RowsDeleted(const wxArrayInt& rows);
 
+    /**
+        Retrieves the values of the given column for all rows in the range.
+
+        This implementation simply calls GetValueByRow() for all rows, override
+        it if the values can be retrieved more efficiently.
+
+        @since 3.3.0
+    */
+    virtual bool GetValuesForRange(unsigned int col,
+                                   unsigned int firstRow,
+                                   unsigned int count,
+                                   wxVector<wxVariant>& values) const;
 };
 
 
@@ -1732,6 +1877,32 @@ public:
     */
     virtual bool SetRowHeight(int rowHeight);
 
+    /**
+        Enable or disable sorting the items in the background.
+
+        When this mode is enabled, sorting the items by a column, e.g. when
+        the user clicks on the column header, doesn't block the UI: instead,
+        the keys used for sorting are retrieved from the model using
+        wxDataViewModel::GetSortKeys() and the items are sorted in a worker
+        thread, with the control continuing to show them in the previous
+        order until the new order is ready and is applied to all of them at
+        once. If the model is changed while the sort is in progress, it is
+        abandoned and the items are sorted synchronously.
+
+        This is only used for list models, e.g. wxDataViewIndexListModel, and
+        only if wxDataViewModel::GetSortKeys() succeeds, otherwise the items
+        are sorted synchronously as usual.
+
+        Currently this is only implemented in the generic version and only if
+        @c wxUSE_THREADS is 1.
+
+        @return @true if the background sorting is supported or @false
+            otherwise.
+
+        @since 3.3.0
+    */
+    virtual bool EnableBackgroundSorting(bool enable = true);
+
     /**
         Toggle sorting by the given column.
 
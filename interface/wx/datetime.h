@@ -1674,6 +1674,127 @@ const wxDateTime wxDefaultDateTime;
 #define wxInvalidDateTime wxDefaultDateTime
 
 
+/**
+    @class wxDateTimeFormatter
+
+    Pre-compiled format for formatting and parsing many dates.
+
+    wxDateTime::Format() and wxDateTime::ParseFormat() interpret the format
+    string every time they're called and Format() may also call @c strftime()
+    to format the fields which don't depend on the locale. This class parses
+    the format only once, when it's set, and formats and parses the numeric
+    fields, e.g. @c "%Y-%m-%d %H:%M:%S.%l", directly, making it much more
+    efficient when the same format is used for many dates, e.g. when
+    exporting or importing a lot of data.
+
+    The results are always the same as those of wxDateTime functions: the
+    locale-dependent fields, such as the month or week day names, or fields
+    using explicit width or padding are formatted by wxDateTime::Format()
+    and, if the format contains any fields which can't be parsed directly,
+    Parse() just calls wxDateTime::ParseFormat().
+
+    Example:
+    @code
+        const wxDateTimeFormatter fmt("%Y-%m-%d %H:%M:%S");
+
+        wxString csv;
+        for ( const auto& record : records )
+        {
+            fmt.FormatTo(csv, record.timestamp);
+            csv += '\n';
+        }
+    @endcode
+
+    @library{wxbase}
+    @category{data}
+
+    @see wxDateTime::Format(), wxDateTime::ParseFormat()
+
+    @since 3.3.0
+*/
+class wxDateTimeFormatter
+{
+public:
+    /**
+        Default constructor.
+
+        SetFormat() must be called before using this object.
+    */
+    wxDateTimeFormatter();
+
+    /**
+        Constructor compiling the given format.
+
+        @see SetFormat()
+    */
+    explicit wxDateTimeFormatter(const wxString& format);
+
+    /**
+        Sets the format to use.
+
+        The format string is the same as for wxDateTime::Format() and
+        wxDateTime::ParseFormat().
+    */
+    void SetFormat(const wxString& format);
+
+    /// Returns the format set by SetFormat() or passed to the constructor.
+    const wxString& GetFormat() const;
+
+    /**
+        Returns the date formatted using this format.
+
+        The result is the same as of @c dt.Format(GetFormat(), tz).
+    */
+    wxString Format(const wxDateTime& dt,
+                    const wxDateTime::TimeZone& tz = wxDateTime::Local) const;
+
+    /**
+        Appends the date formatted using this format to the given string.
+
+        This is the same as Format() but avoids creating a new string for
+        every date.
+    */
+    void FormatTo(wxString& out,
+                  const wxDateTime& dt,
+                  const wxDateTime::TimeZone& tz = wxDateTime::Local) const;
+
+    /**
+        Parses the date using this format.
+
+        This function works in the same way as wxDateTime::ParseFormat(),
+        i.e. parses the beginning of @a date and stores the end of the parsed
+        part in @a end.
+
+        @param date
+            The string to parse.
+        @param dt
+            The object to fill with the parsed date, must be non-null. If
+            @a dateDef is invalid, its existing value is used for the
+            components not specified in the format, as with
+            wxDateTime::ParseFormat().
+        @param end
+            Receives the iterator pointing to the end of the parsed part of
+            the string, must be non-null.
+        @param dateDef
+            The date used for the components not specified in the format.
+        @return @true if the date was successfully parsed.
+    */
+    bool Parse(const wxString& date,
+               wxDateTime* dt,
+               wxString::const_iterator* end,
+               const wxDateTime& dateDef = wxDefaultDateTime) const;
+
+    /**
+        Parses the date using this format.
+
+        This overload returns @true only if the entire string was parsed.
+    */
+    bool Parse(const wxString& date,
+               wxDateTime* dt,
+               const wxDateTime& dateDef = wxDefaultDateTime) const;
+};
+
+
 /**
     @class wxDateTimeWorkDays
 
@@ -186,6 +186,24 @@ public:
     */
     void WriteDouble(const double* buffer, size_t size);
 
+    /**
+        Writes all elements of the vector to the stream.
+
+        The type @c T of the vector elements must be one of the types which
+        can be written by the other functions of this class, i.e. an 8, 16, 32
+        or 64 bit integer, a @c float or a @c double, and the elements are
+        written in the same way as by the corresponding function taking a
+        pointer to the buffer, e.g. Write32() for @c wxUint32.
+
+        Notice that the number of elements is not written to the stream, so
+        it must be stored separately if it's not known when reading the data
+        back using wxDataInputStream::ReadVector().
+
+        @since 3.3.0
+    */
+    template <typename T>
+    void WriteVector(const std::vector<T>& v);
+
     /**
         Writes @a string to the stream. Actually, this method writes the size
         of the string before writing @a string itself.
@@ -353,6 +371,23 @@ public:
     */
     void ReadDouble(double* buffer, size_t size);
 
+    /**
+        Reads the given number of values into the vector.
+
+        The vector is resized to contain exactly @a size elements, which are
+        read from the stream in the same way as they would be read by the
+        function corresponding to the type @c T, e.g. ReadFloat() for @c float.
+
+        This function, as well as the other functions reading arrays, reads
+        the data directly into the provided buffer, so it's much more
+        efficient than reading the values one by one, especially when reading
+        many values.
+
+        @since 3.3.0
+    */
+    template <typename T>
+    void ReadVector(std::vector<T>& v, size_t size);
+
     /**
         Reads a string from a stream. Actually, this function first reads a
         long integer specifying the length of the string (without the last null
@@ -1033,6 +1033,32 @@ public:
     */
     wxSize GetMultiLineTextExtent(const wxString& string) const;
 
+    /**
+        Gets the dimensions of all the given strings using the currently
+        selected font or the given one.
+
+        This function is equivalent to calling GetMultiLineTextExtent() for
+        each of the @a strings, and so works with multi-line strings too, but
+        is more efficient when measuring many strings, e.g. for determining
+        the best width of a column, as the font is set up only once for all of
+        them.
+
+        @param strings The strings to measure.
+        @param widths Filled with the widths of the strings on return.
+        @param heights If non-null, filled with the heights of the strings on
+            return.
+        @param font If specified and valid, this font is used instead of the
+            currently selected one.
+
+        @since 3.3.0
+
+        @see GetMultiLineTextExtent(), GetTextExtent()
+    */
+    void GetTextExtents(const wxArrayString& strings,
+                        wxArrayInt& widths,
+                        wxArrayInt* heights = nullptr,
+                        const wxFont* font = nullptr) const;
+
     /**
         Fills the @a widths array with the widths from the beginning of @a text
         to the corresponding character of @a text. The generic version simply
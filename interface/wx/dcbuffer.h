@@ -138,6 +138,34 @@ public:
        Get the style.
     */
     int GetStyle() const;
+
+    /**
+       Set the maximal total size of the shared buffers kept for reuse.
+
+       When no buffer is explicitly specified, wxBufferedDC uses one of the
+       buffers from a pool shared by all of its objects. The buffers are
+       preferably reused for the same window and their sizes are rounded up to
+       avoid reallocating them when the windows are resized, but the least
+       recently used buffers are freed when the total size of the buffers not
+       currently in use exceeds the limit set by this function.
+
+       Setting the limit to 0 frees the buffers as soon as they are not used
+       any more. The default limit is 64MiB.
+
+       @param maxMemory The maximal size of the buffers memory in bytes.
+
+       @since 3.3.0
+    */
+    static void SetSharedBuffersMaxMemory(size_t maxMemory);
+
+    /**
+       Get the maximal total size of the shared buffers kept for reuse.
+
+       @see SetSharedBuffersMaxMemory()
+
+       @since 3.3.0
+    */
+    static size_t GetSharedBuffersMaxMemory();
 };
 
 
@@ -5,6 +5,41 @@
 // Licence:     wxWindows licence
 /////////////////////////////////////////////////////////////////////////////
 
+/**
+    Possible ways of storing the bitmaps drawn on wxPostScriptDC.
+
+    @see wxPostScriptDC::SetBitmapEncoding()
+
+    @since 3.3.0
+*/
+enum wxPostScriptBitmapEncoding
+{
+    /**
+        Store the bitmaps as uncompressed hexadecimal data.
+
+        This is the default encoding, which is supported by all PostScript
+        printers and interpreters, but results in big output.
+     */
+    wxPS_BITMAP_HEX,
+
+    /**
+        Compress the bitmaps without any loss of quality.
+
+        This encoding requires PostScript Level 3 support and is only
+        available if wxUSE_ZLIB is enabled.
+     */
+    wxPS_BITMAP_FLATE,
+
+    /**
+        Compress the bitmaps using JPEG format.
+
+        This typically results in the smallest output, but the compression is
+        lossy and so is best suited for photos. It requires PostScript Level 2
+        support and is only available if wxUSE_LIBJPEG is enabled.
+     */
+    wxPS_BITMAP_DCT
+};
+
 /**
     @class wxPostScriptDC
 
@@ -32,5 +67,23 @@ public:
     */
     wxPostScriptDC(const wxPrintData& printData);
 
+    /**
+        Set the encoding used for the bitmaps drawn on this DC.
+
+        If a bitmap can't be stored using the selected encoding, e.g. because
+        support for it is not available, ::wxPS_BITMAP_HEX is used for it.
+
+        @since 3.3.0
+    */
+    void SetBitmapEncoding(wxPostScriptBitmapEncoding encoding);
+
+    /**
+        Return the encoding used for the bitmaps.
+
+        @see SetBitmapEncoding()
+
+        @since 3.3.0
+    */
+    wxPostScriptBitmapEncoding GetBitmapEncoding() const;
 };
 
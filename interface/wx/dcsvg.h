@@ -45,6 +45,12 @@ enum wxSVGShapeRenderingMode
     as the SVG file, however it is possible to change this behaviour by
     replacing the built in bitmap handler using wxSVGFileDC::SetBitmapHandler().
 
+    The output is buffered and written out incrementally, so that even big
+    documents can be produced efficiently. To keep its size small, the lines
+    drawn by consecutive calls to DrawLine() with the same pen are combined
+    into a single SVG path element and each distinct combination of the pen
+    and brush attributes is defined only once, as a CSS class.
+
     More substantial SVG libraries (for reading and writing) are available at
     <a href="http://wxart2d.sourceforge.net/" target="_blank">wxArt2D</a> and
     <a href="http://wxsvg.sourceforge.net/" target="_blank">wxSVG</a>.
@@ -64,6 +70,23 @@ public:
     wxSVGFileDC(const wxString& filename, int width = 320, int height = 240,
                 double dpi = 72, const wxString& title = wxString());
 
+    /**
+        Initializes a wxSVGFileDC writing the SVG document to the given
+        @a stream.
+
+        The @a stream must remain valid during the entire lifetime of this
+        object, as the output is written to it incrementally while drawing.
+        The document is complete only after this object is destroyed.
+
+        As there is no file name which could be used for the bitmap files
+        with this constructor, wxSVGBitmapEmbedHandler is used by default for
+        the objects created by it.
+
+        @since 3.3.0
+    */
+    wxSVGFileDC(wxOutputStream& stream, int width = 320, int height = 240,
+                double dpi = 72, const wxString& title = wxString());
+
     /**
         Draws a rectangle the size of the SVG using the wxDC::SetBackground() brush.
     */
@@ -141,7 +141,8 @@ enum wxDirFlags
     files as well as directories.
 
     wxDir also provides a flexible way to enumerate files recursively using
-    Traverse() or a simpler GetAllFiles() function.
+    Traverse() or a simpler GetAllFiles() function, as well as
+    TraverseParallel() for enumerating big directory trees efficiently.
 
     Example of use:
 
@@ -255,6 +256,29 @@ public:
                   const wxString& filespec = wxEmptyString,
                   int flags = wxDIR_DEFAULT) const;
 
+    /**
+        Start enumerating all files matching @a filespec and @a flags,
+        retrieving the information about the first one found.
+
+        This function is the same as the other GetFirst() overload, but also
+        fills the provided @a stat object, which may be @NULL, with the
+        information about the found file system object. Under Unix, this is
+        done more efficiently than by creating a wxFileStat object for the
+        full path of the file separately. Symbolic links are followed unless
+        ::wxDIR_NO_FOLLOW is specified.
+
+        If the information about the file couldn't be retrieved, e.g. because
+        it is a dangling symbolic link, wxFileStat::IsOk() returns @false.
+
+        @see GetNext(wxString*, wxFileStat*)
+
+        @since 3.3.0
+    */
+    bool GetFirst(wxString* filename,
+                  wxFileStat* stat,
+                  const wxString& filespec = wxEmptyString,
+                  int flags = wxDIR_DEFAULT) const;
+
     /**
         Returns the name of the directory itself.
 
@@ -287,6 +311,15 @@ public:
     */
     bool GetNext(wxString* filename) const;
 
+    /**
+        Continue enumerating files started by
+        GetFirst(wxString*, wxFileStat*, const wxString&, int) and retrieve
+        the information about the next file found.
+
+        @since 3.3.0
+    */
+    bool GetNext(wxString* filename, wxFileStat* stat) const;
+
     /**
         Returns the size (in bytes) of all files recursively found in @c dir or
         @c wxInvalidSize in case of error.
@@ -375,5 +408,65 @@ public:
     size_t Traverse(wxDirTraverser& sink,
                     const wxString& filespec = wxEmptyString,
                     int flags = wxDIR_DEFAULT) const;
+
+    /**
+        Finds all the files under the given directory using multiple threads.
+
+        This function finds the same files as GetAllFiles() but reads the
+        different directories in parallel, using the threads of the global
+        wxThreadPool, which can be significantly faster for big directory
+        trees. Instead of accumulating all the files in an array, it calls the
+        provided function with the batches of the full paths of the found
+        files, each containing approximately @a batchSize elements.
+
+        The function @a onFiles is always called in the thread calling this
+        function, so it doesn't need to be thread-safe, and may return @false
+        to stop the traversal.
+
+        The order of the files is unspecified, unlike with Traverse(), and
+        the directories which can't be opened are silently skipped. The
+        ::wxDIR_DOTDOT flag is ignored by this function.
+
+        If the library was compiled without thread support or if this
+        function is called from one of wxThreadPool threads, the directories
+        are read sequentially in the calling thread.
+
+        Example of use:
+        @code
+        wxDir::TraverseParallel(dirname,
+            [&index](const wxArrayString& files)
+            {
+                for ( const auto& file : files )
+                    index.Add(file);
+
+                return true;
+            });
+        @endcode
+
+        @param dirname
+            The directory to search.
+        @param onFiles
+            Function called with the found files, returning @true to continue
+            or @false to stop.
+        @param filespec
+            Only files matching this spec are reported, with empty spec
+            matching all non-hidden files (use ::wxDIR_HIDDEN to include them
+            too).
+        @param flags
+            Should include ::wxDIR_FILES and ::wxDIR_DIRS to recurse into the
+            subdirectories, as with GetAllFiles().
+        @param batchSize
+            The approximate number of files passed to @a onFiles at once.
+        @return
+            The total number of files passed to @a onFiles.
+
+        @since 3.3.0
+    */
+    static size_t
+    TraverseParallel(const wxString& dirname,
+                     const std::function<bool (const wxArrayString& files)>& onFiles,
+                     const wxString& filespec = wxEmptyString,
+                     int flags = wxDIR_DEFAULT,
+                     size_t batchSize = 1024);
 };
 
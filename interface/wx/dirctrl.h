@@ -232,6 +232,38 @@ public:
     */
     virtual void SetPath(const wxString& path);
 
+    /**
+        Enables or disables reading directories in background.
+
+        By default, when the user expands a directory item, its entire
+        contents is read and sorted before the function returns, which can
+        make the program unresponsive for a long time for directories with
+        many entries, especially on network drives. If this option is
+        enabled, the directory is read by a worker thread instead and its
+        entries are added to the tree in batches as they become available.
+        Collapsing the item before this is done cancels reading it.
+
+        Note that this only affects expanding the items interactively,
+        functions such as ExpandPath() or SelectPath() still read the
+        directories synchronously, as they need their contents immediately.
+
+        This function does nothing if @c wxUSE_THREADS is 0.
+
+        @see IsBackgroundExpansionEnabled()
+
+        @since 3.3.0
+    */
+    void EnableBackgroundExpansion(bool enable = true);
+
+    /**
+        Returns @true if background expansion is enabled.
+
+        @see EnableBackgroundExpansion()
+
+        @since 3.3.0
+    */
+    bool IsBackgroundExpansionEnabled() const;
+
     /**
         @param show
             If @true, hidden folders and files will be displayed by the
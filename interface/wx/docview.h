@@ -483,7 +483,11 @@ public:
             By default, none. May include @c wxDOC_NEW to indicate that the new
             document corresponds to a new file and not an existing one and
             @c wxDOC_SILENT to suppress any dialogs asking the user about the
-            file path and type.
+            file path and type. Since wxWidgets 3.3.0 it may also include
+            @c wxDOC_ASYNC to open the existing document using
+            wxDocument::OpenDocumentAsync() instead of
+            wxDocument::OnOpenDocument(): in this case the document is returned
+            before it is loaded and is closed later if loading it fails.
         @return a new document object or @NULL on failure.
     */
     virtual wxDocument* CreateDocument(const wxString& path, long flags = 0);
@@ -1226,6 +1230,18 @@ public:
     documents by creating a child document containing the information about the
     parameters of the image opened in the main document.
 
+    Since wxWidgets 3.3.0, documents can also be loaded and saved in a
+    background thread using OpenDocumentAsync() and SaveDocumentAsync(). The
+    following events, both of wxThreadEvent type, are sent to the document
+    when using them:
+    - @c wxEVT_DOCUMENT_IO_PROGRESS: sent when ReportDocumentIOProgress() is
+      called, wxThreadEvent::GetInt() returns the progress in percents.
+    - @c wxEVT_DOCUMENT_IO_COMPLETED: sent when the operation finishes,
+      wxThreadEvent::GetInt() returns non-zero if it succeeded,
+      wxThreadEvent::GetExtraLong() returns non-zero if the document was
+      saved and zero if it was loaded and wxThreadEvent::GetString() returns
+      the file name.
+
     @library{wxcore}
     @category{docview}
 
@@ -1546,6 +1562,105 @@ public:
     */
     virtual bool OnOpenDocument(const wxString& filename);
 
+    /**
+        Loads the document from the given file in a background thread.
+
+        This function calls DoOpenDocument() in a worker thread and returns
+        immediately. When loading finishes, the document is updated in the
+        same way as by OnOpenDocument(), i.e. its file name is set and all its
+        views are updated, and @c wxEVT_DOCUMENT_IO_COMPLETED event is sent to
+        it.
+
+        Notice that DoOpenDocument(), and LoadObject() called by its default
+        implementation, must not access any GUI objects when using this
+        function, as they are called from a thread other than the main one.
+        They may, and should, call ReportDocumentIOProgress() and
+        IsDocumentIOCancelled(), however.
+
+        Also notice that OnOpenDocument() is not called by this function, so
+        any custom logic in its override in the derived class is not executed.
+
+        @return @false if the operation couldn't be started, e.g. because
+            another one is already in progress.
+
+        @since 3.3.0
+    */
+    bool OpenDocumentAsync(const wxString& filename);
+
+    /**
+        Saves the document to the given file in a background thread.
+
+        This is similar to OpenDocumentAsync() but calls DoSaveDocument(),
+        and the document is marked as not modified and saved once it succeeds.
+
+        Notice that the document must not be modified while it's being saved.
+
+        @since 3.3.0
+    */
+    bool SaveDocumentAsync(const wxString& filename);
+
+    /**
+        Returns @true if an asynchronous operation is in progress.
+
+        This function returns @true until the @c wxEVT_DOCUMENT_IO_COMPLETED
+        event is sent.
+
+        @since 3.3.0
+    */
+    bool IsDocumentIOInProgress() const;
+
+    /**
+        Requests cancelling the asynchronous operation in progress.
+
+        The operation is only really cancelled if DoOpenDocument() or
+        DoSaveDocument() check IsDocumentIOCancelled() and return @false if it
+        returns @true, which is not done by the default implementations.
+
+        Close() calls this function automatically if the document is being
+        loaded.
+
+        @since 3.3.0
+    */
+    void CancelDocumentIO();
+
+    /**
+        Waits until the background thread finishes the operation in progress.
+
+        Note that @c wxEVT_DOCUMENT_IO_COMPLETED is still sent later, when the
+        events are processed, after this function returns.
+
+        Close() calls this function automatically, so it's not necessary to
+        call it before closing the document.
+
+        @since 3.3.0
+    */
+    void WaitForDocumentIO();
+
+    /**
+        Reports the progress of an asynchronous operation.
+
+        This function can be called from DoOpenDocument() or DoSaveDocument(),
+        i.e. from the worker thread, to send @c wxEVT_DOCUMENT_IO_PROGRESS to
+        the document. It does nothing when called during a synchronous
+        operation.
+
+        @param percent
+            Progress of the operation in percents.
+
+        @since 3.3.0
+    */
+    void ReportDocumentIOProgress(int percent);
+
+    /**
+        Returns @true if CancelDocumentIO() had been called.
+
+        This function can be called from DoOpenDocument() or DoSaveDocument()
+        to check if they should stop.
+
+        @since 3.3.0
+    */
+    bool IsDocumentIOCancelled() const;
+
     /**
         Constructs an output file stream for the given filename (which must not
         be empty), and calls SaveObject(). If SaveObject() returns @true, the
@@ -68,6 +68,27 @@ enum wxEventCategory
         wxEVT_CATEGORY_TIMER|wxEVT_CATEGORY_THREAD
 };
 
+/**
+    Statistics about the event objects allocations.
+
+    @see wxEvent::GetAllocStats()
+
+    @since 3.3.0
+*/
+struct wxEventAllocStats
+{
+    /// Total number of event objects allocated on the heap so far.
+    wxUint64 allocated = 0;
+
+    /**
+        Number of the allocated events that reused the memory of the
+        previously deleted events.
+
+        This is always 0 unless wxEvent::UseAllocCache() is used.
+    */
+    wxUint64 reused = 0;
+};
+
 /**
     @class wxEvent
 
@@ -252,6 +273,42 @@ public:
     */
     int StopPropagation();
 
+    /**
+        Enable or disable reusing the memory of the deleted event objects.
+
+        Events are often allocated and deleted in quick succession, notably
+        when they are queued using wxEvtHandler::QueueEvent() or when
+        wxEvtHandler::CallAfter() is used. If this option is enabled, the
+        memory of the small enough deleted events is kept in a per-thread
+        cache, containing blocks of a few different sizes, and reused for the
+        subsequently allocated events instead of returning it to the heap.
+
+        Note that this only affects the memory of the event objects
+        themselves and not of any data, e.g.\ strings, owned by them. Also
+        note that the memory allocator used by the C++ standard library may
+        already be efficient enough for this allocation pattern, so please
+        use GetAllocStats() and measure the effect of this option on your
+        application before enabling it.
+
+        This option is disabled by default.
+
+        @since 3.3.0
+    */
+    static void UseAllocCache(bool use = true);
+
+    /**
+        Return the statistics about the event objects allocations.
+
+        The returned counters are cumulative, i.e.\ they contain the total
+        number of events allocated since the program start. To compute the
+        number of allocations per second, this function can be called
+        periodically and the difference between the values returned by the
+        consecutive calls can be used.
+
+        @since 3.3.0
+    */
+    static wxEventAllocStats GetAllocStats();
+
 protected:
     /**
         Indicates how many levels the event can propagate.
@@ -458,6 +515,45 @@ public:
      */
     virtual void QueueEvent(wxEvent *event);
 
+    /**
+        Queue event for a later processing, replacing the previously queued
+        event with the same key, if any.
+
+        This method is similar to QueueEvent(), but if an event queued by a
+        previous call to this function with the same @a key hasn't been
+        processed yet, the new event replaces it, taking its place in the
+        queue, and the old event is deleted without being processed. Otherwise
+        the event is simply appended to the queue, as with QueueEvent().
+
+        This is useful for the worker threads sending frequent progress
+        updates to the main thread, when only the latest update matters, as
+        it ensures that at most one event with the given key is processed
+        during each event loop iteration, however many of them are queued:
+        @code
+            void MyWorkerThread::ReportProgress(int percent)
+            {
+                wxThreadEvent* evt = new wxThreadEvent(wxEVT_THREAD, ID_PROGRESS);
+                evt->SetInt(percent);
+
+                m_frame->QueueEventCoalesced(evt, ID_PROGRESS);
+            }
+        @endcode
+
+        The keys only need to be unique among the events queued using this
+        function, or CallAfterCoalesced(), for the same event handler.
+
+        Notice that the replaced event is deleted in the calling thread.
+
+        @param event
+            A heap-allocated event to be queued, this function takes ownership
+            of it. This parameter shouldn't be @NULL.
+        @param key
+            Arbitrary value identifying the events which replace each other.
+
+        @since 3.3.0
+     */
+    void QueueEventCoalesced(wxEvent *event, wxUIntPtr key);
+
     /**
         Post an event to be processed later.
 
@@ -560,6 +656,31 @@ public:
     template<typename T>
     void CallAfter(const T& functor);
 
+    /**
+         Asynchronously call the given functor, replacing the previously
+         scheduled call with the same key, if any.
+
+         This is the same as CallAfter() overload taking a functor, but uses
+         QueueEventCoalesced() instead of QueueEvent(), i.e. if another functor
+         scheduled with the same @a key hasn't been called yet, it is replaced
+         by this one and is never called.
+
+         Example:
+         @code
+         // In a worker thread: only the last status will be shown.
+         frame->CallAfterCoalesced(STATUS_KEY, [frame, status]() {
+             frame->SetStatusText(status);
+         });
+         @endcode
+
+         @param key Arbitrary value identifying the calls replacing each other.
+         @param functor The functor to call.
+
+         @since 3.3.0
+     */
+    template<typename T>
+    void CallAfterCoalesced(wxUIntPtr key, const T& functor);
+
     /**
         Processes an event, searching event tables and calling zero or more suitable
         event handler function(s).
@@ -2326,6 +2447,42 @@ public:
 
 
 
+/**
+    @class wxUpdateUIDependency
+
+    Represents a piece of application state on which wxEVT_UPDATE_UI handlers
+    depend.
+
+    Objects of this class don't store the state itself, they only track when
+    it changes, which must be indicated by calling MarkChanged(). See
+    wxUpdateUIEvent::DependsOn() for how to use them.
+
+    Destroying the object is considered to be a change of the state too.
+
+    @library{wxcore}
+    @category{events}
+
+    @since 3.3.0
+*/
+class wxUpdateUIDependency
+{
+public:
+    /// Default constructor.
+    wxUpdateUIDependency();
+
+    /// Destructor.
+    ~wxUpdateUIDependency();
+
+    /**
+        Must be called whenever the state represented by this object changes.
+
+        This results in wxEVT_UPDATE_UI being sent again, during the next
+        idle time processing, for all UI elements whose handlers depend on
+        this state.
+    */
+    void MarkChanged();
+};
+
 /**
     The possibles modes to pass to wxUpdateUIEvent::SetMode().
 */
@@ -2336,7 +2493,16 @@ enum wxUpdateUIMode
 
         /** Send UI update events to windows that have
             the wxWS_EX_PROCESS_UI_UPDATES flag specified. */
-    wxUPDATE_UI_PROCESS_SPECIFIED
+    wxUPDATE_UI_PROCESS_SPECIFIED,
+
+        /**
+            Send UI update events only to the windows which have
+            the wxWS_EX_PROCESS_UI_UPDATES flag specified or a @c
+            wxEVT_UPDATE_UI handler, or whose parent does.
+
+            @since 3.3.0
+         */
+    wxUPDATE_UI_PROCESS_REGISTERED
 };
 
 
@@ -2371,10 +2537,20 @@ enum wxUpdateUIMode
     @li Call wxUpdateUIEvent::SetMode with a value of wxUPDATE_UI_PROCESS_SPECIFIED,
         and set the extra style wxWS_EX_PROCESS_UI_UPDATES for every window that should
         receive update events. No other windows will receive update events.
+        Or use wxUPDATE_UI_PROCESS_REGISTERED mode to send update events
+        only to the windows having a @c wxEVT_UPDATE_UI handler, either in
+        their event table or bound using wxEvtHandler::Bind(), or such handler
+        in one of their parents, as the update events propagate upwards.
+        This mode is especially effective if the handlers are defined in the
+        windows themselves rather than in their common top level parent.
     @li Call wxUpdateUIEvent::SetUpdateInterval with a millisecond value to set the delay
         between updates. You may need to call wxWindow::UpdateWindowUI at critical points,
         for example when a dialog is about to be shown, in case the user sees a slight
         delay before windows are updated.
+    @li Use wxUpdateUIEvent::DependsOn() in your handlers to declare the
+        application state, represented by wxUpdateUIDependency objects, they
+        depend on. The events are then not sent again for the same UI element
+        until this state changes.
 
     Note that although events are sent in idle time, defining a wxIdleEvent handler
     for a window does not affect this because the events are sent from wxWindow::OnInternalIdle
@@ -2427,6 +2603,50 @@ public:
     */
     void Check(bool check);
 
+    /**
+        Declare that the result of this handler depends on the given state.
+
+        If all the handlers processing this event for a UI element (i.e. a
+        window, toolbar tool or menu item) call this function, the update
+        event won't be sent again for this element until
+        wxUpdateUIDependency::MarkChanged() is called for one of the
+        dependencies declared by them. This allows to avoid calling the
+        handlers which always return the same results during each idle time
+        processing, which can be significant for big menus and toolbars.
+
+        Note that the handler must call this function every time it's
+        executed and must declare all the state it uses, as the element is not
+        updated at all unless any of the declared dependencies changes.
+
+        Example:
+        @code
+        class MyFrame : public wxFrame
+        {
+        public:
+            ...
+
+            void SetModified(bool modified)
+            {
+                m_modified = modified;
+                m_modifiedDep.MarkChanged();
+            }
+
+        private:
+            void OnUpdateSave(wxUpdateUIEvent& event)
+            {
+                event.DependsOn(m_modifiedDep);
+                event.Enable(m_modified);
+            }
+
+            bool m_modified = false;
+            wxUpdateUIDependency m_modifiedDep;
+        };
+        @endcode
+
+        @since 3.3.0
+    */
+    void DependsOn(const wxUpdateUIDependency& dep);
+
     /**
         Enable or disable the UI element.
     */
@@ -4150,7 +4370,15 @@ enum wxIdleMode
     wxIDLE_PROCESS_ALL,
 
         /** Send idle events to windows that have the wxWS_EX_PROCESS_IDLE flag specified */
-    wxIDLE_PROCESS_SPECIFIED
+    wxIDLE_PROCESS_SPECIFIED,
+
+        /**
+            Send idle events only to windows that have the wxWS_EX_PROCESS_IDLE
+            flag specified or a @c wxEVT_IDLE handler.
+
+            @since 3.3.0
+         */
+    wxIDLE_PROCESS_REGISTERED
 };
 
 
@@ -4183,6 +4411,19 @@ enum wxIdleMode
     style for every window which should receive idle events, all the other ones
     will not receive them in this case.
 
+    Alternatively, wxIDLE_PROCESS_REGISTERED mode can be used to send idle
+    events only to the windows which have either this style or a handler for
+    @c wxEVT_IDLE, either in their event table or bound to them using
+    wxEvtHandler::Bind(). Note that handlers for this event in the event
+    handlers pushed on the window (see wxWindow::PushEventHandler()) are not
+    detected, so the windows using them always receive idle events in this
+    mode. Unlike with wxIDLE_PROCESS_SPECIFIED, this mode doesn't require any
+    changes to the existing code, but it still can't be the default as the
+    events sent to a window can also be handled by wxApp::FilterEvent() or
+    overridden wxEvtHandler::ProcessEvent() and similar functions, which is
+    not detected. Notice that, in any mode, the library still needs to perform
+    some internal processing for all windows during idle time.
+
     @beginEventTable{wxIdleEvent}
     @event{EVT_IDLE(func)}
         Process a @c wxEVT_IDLE event.
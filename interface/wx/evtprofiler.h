@@ -0,0 +1,267 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        wx/evtprofiler.h
+// Purpose:     interface of wxEventProfiler
+// Author:      wxWidgets team
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+    @class wxEventProfiler
+
+    Collects the timings of the events processed in the main thread.
+
+    This class can be used to find out where the time is spent in the main
+    thread of the application, e.g. to find the event handlers making the user
+    interface unresponsive. When it is running, which is not the case by
+    default, it records:
+        - The total time taken by processing each event, which includes the
+          time spent in all the handlers called for it, the event filters and
+          any nested events processed while handling it.
+        - The time taken by each event handler, aggregated by the event type
+          and the class of the object handling it.
+        - The time spent by the events queued using wxEvtHandler::QueueEvent()
+          or wxEvtHandler::QueueEventCoalesced() (including the events posted
+          by wxEvtHandler::CallAfter()) before they are processed.
+        - The time spent in idle processing, i.e. wxApp::ProcessIdle().
+        - The "stalls", i.e. the event handlers taking longer than the
+          threshold set by SetStallThreshold().
+
+    The collected statistics can be retrieved using GetDispatchStats(),
+    GetHandlerStats(), GetQueueWaitStats(), GetIdleStats() and GetStalls()
+    functions, while the full timeline of the events can be exported in the
+    Chrome trace event format and then examined in a trace viewer such as
+    @c chrome://tracing or https://ui.perfetto.dev/, e.g.
+    @code
+    bool MyApp::OnInit()
+    {
+        if ( wxGetEnv("MYAPP_PROFILE_EVENTS", nullptr) )
+            wxEventProfiler::Start();
+
+        ...
+    }
+
+    int MyApp::OnExit()
+    {
+        if ( wxEventProfiler::IsRunning() )
+            wxEventProfiler::SaveChromeTrace("myapp-events.json");
+
+        ...
+    }
+    @endcode
+
+    All the times used by this class are in microseconds and the start times
+    are counted from the first call to Start().
+
+    Only the events processed in the main thread are profiled and all the
+    functions of this class must be called from the main thread too. When the
+    profiler is not running, the overhead of event processing is limited to
+    checking whether it is running.
+
+    @library{wxbase}
+    @category{events}
+
+    @see wxEventFilter
+
+    @since 3.3.0
+*/
+class wxEventProfiler
+{
+public:
+    /**
+        Timings of all the events of the same type.
+
+        Depending on the function returning it, this object contains the
+        timings of either processing the events, or of waiting in the queue
+        for them, or of calling their handlers belonging to the same class.
+    */
+    struct Stats
+    {
+        /// The type of the events.
+        wxEventType eventType;
+
+        /// The name of the C++ class of the events, e.g. "wxPaintEvent".
+        wxString eventClass;
+
+        /**
+            The name of the class of the event handler.
+
+            This is only filled in by GetHandlerStats() and is the name of the
+            class of the object whose method is called for handlers bound to
+            a method or of the wxEvtHandler the handler is bound to otherwise.
+            Note that this relies on the class using wxRTTI macros, i.e. the
+            name of the closest base class using them is returned.
+         */
+        wxString handlerClass;
+
+        /// Number of the events with these timings.
+        unsigned long count;
+
+        /// Total time taken by all the events.
+        wxLongLong_t totalTime;
+
+        /// Maximal time taken by a single event.
+        wxLongLong_t maxTime;
+
+        /// Return the average time taken by a single event.
+        wxLongLong_t GetAverageTime() const;
+    };
+
+    /**
+        Information about a single event handler taking too long.
+
+        @see SetStallThreshold()
+    */
+    struct Stall
+    {
+        /// The type of the event being handled.
+        wxEventType eventType;
+
+        /// The name of the C++ class of the event.
+        wxString eventClass;
+
+        /// The class of the handler, see Stats::handlerClass.
+        wxString handlerClass;
+
+        /// The time when the handler was called.
+        wxLongLong_t startTime;
+
+        /// The time taken by the handler.
+        wxLongLong_t duration;
+
+        /**
+            The stack trace of the handler call.
+
+            Note that this is the stack trace of the point where the handler
+            was called from, as it can only be obtained after the handler
+            returns, and so shows the chain of events leading to it rather
+            than what the handler itself was doing.
+
+            This string is empty if @c wxUSE_STACKWALKER is 0.
+         */
+        wxString backtrace;
+    };
+
+    /**
+        Start profiling the events.
+
+        Any previously collected data is discarded.
+    */
+    static void Start();
+
+    /**
+        Stop profiling the events.
+
+        The data collected so far is kept and can still be retrieved.
+    */
+    static void Stop();
+
+    /**
+        Return @true if the profiler is currently running.
+    */
+    static bool IsRunning();
+
+    /**
+        Discard all the data collected so far.
+
+        This doesn't stop the profiler if it's running.
+    */
+    static void Reset();
+
+    /**
+        Set the time after which an event handler is considered to stall.
+
+        When an event handler takes longer than the given time, a Stall
+        object is added to the list returned by GetStalls() and the
+        corresponding instant event is added to the trace.
+
+        Notice that retrieving the backtrace of the handler call is relatively
+        slow, so the time taken by it is included in the timings of the
+        events whose processing resulted in calling the stalling handler.
+        When handlers call each other, only the innermost handler exceeding
+        the threshold is reported.
+
+        @param ms
+            Threshold in milliseconds, 100 by default. If it is 0, stalls
+            are not detected at all.
+    */
+    static void SetStallThreshold(long ms);
+
+    /**
+        Return the threshold set by SetStallThreshold().
+    */
+    static long GetStallThreshold();
+
+    /**
+        Set the maximal number of entries in the trace.
+
+        When this number is reached, no more entries are added to the trace
+        returned by GetChromeTrace(), but the statistics are still updated.
+
+        @param count
+            Maximal number of the entries, 1000000 by default. If it is 0,
+            no trace is recorded at all.
+    */
+    static void SetMaxTraceEvents(size_t count);
+
+    /**
+        Return the timings of processing the events of each type.
+
+        The time of processing an event is the total time taken by
+        wxEvtHandler::ProcessEvent() call for it, i.e. it includes the time
+        spent in all the handlers and any nested events.
+    */
+    static std::vector<Stats> GetDispatchStats();
+
+    /**
+        Return the timings of the event handlers for each event type and
+        handler class.
+    */
+    static std::vector<Stats> GetHandlerStats();
+
+    /**
+        Return the timings of waiting in the queue for the events of each
+        type.
+    */
+    static std::vector<Stats> GetQueueWaitStats();
+
+    /**
+        Return the timings of idle processing.
+
+        The returned object uses @c wxEVT_IDLE as event type, but the timings
+        are of the entire wxApp::ProcessIdle() calls, including sending idle
+        events to all windows and deleting the objects scheduled for
+        destruction.
+    */
+    static Stats GetIdleStats();
+
+    /**
+        Return all the stalls detected so far.
+
+        @see SetStallThreshold()
+    */
+    static std::vector<Stall> GetStalls();
+
+    /**
+        Return the trace of all the events in the Chrome trace event format.
+
+        The returned JSON string contains:
+            - Complete events for processing each event (category
+              "dispatch"), calling each event handler ("handler") and idle
+              processing ("idle") in the main thread.
+            - Asynchronous events for the time spent by the events in the
+              queue, shown in a separate "Event queue" track (category
+              "queue").
+            - Instant events for the stalls, with their backtrace as an
+              argument (category "stall").
+    */
+    static wxString GetChromeTrace();
+
+    /**
+        Save the result of GetChromeTrace() to the given file.
+
+        The file is written using UTF-8 encoding.
+
+        @return @true if the file was saved successfully.
+    */
+    static bool SaveChromeTrace(const wxString& filename);
+};
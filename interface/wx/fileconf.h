@@ -203,6 +203,58 @@ public:
     */
     void DisableAutoSave();
 
+    /**
+        Enables or disables the write-behind mode.
+
+        In this mode, Flush() doesn't write the file itself but only takes a
+        snapshot of its contents, which is written by a thread of the global
+        wxThreadPool. If Flush() is called again before the previous snapshot
+        is written, only the latest one is written, so calling Flush() after
+        every change is cheap. The file is still replaced atomically, i.e. it
+        contains either the old or the new contents at any moment.
+
+        Notice that Flush() always returns @true in this mode and the errors
+        are only reported by Sync(). Also note that the umask set by
+        SetUmask() affects the whole process while the file is being written,
+        which is done by another thread in this mode.
+
+        Disabling this mode waits for the pending writes to finish, as if
+        Sync() were called. The destructor and DeleteAll() also wait for them.
+
+        This function is only available if @c wxUSE_THREADS is 1.
+
+        @since 3.3.0
+    */
+    void EnableWriteBehind(bool enable = true);
+
+    /**
+        Returns @true if the write-behind mode is enabled.
+
+        @see EnableWriteBehind()
+
+        @since 3.3.0
+    */
+    bool IsWriteBehindEnabled() const;
+
+    /**
+        Waits until all the changes flushed in write-behind mode are written.
+
+        This function should be called at the moment when the changes need to
+        be on disk, e.g. when the application is about to exit, although this
+        is also done by the destructor automatically. If the most recent
+        snapshot hasn't started being written by the background thread yet, it
+        is written by the thread calling this function.
+
+        @return @false if writing the file failed since the last call to this
+            function, @true if it succeeded or if write-behind mode is not
+            enabled.
+
+        @see EnableWriteBehind()
+
+        @since 3.3.0
+    */
+    bool Sync();
+
     /**
         Allows setting the mode to be used for the config file creation. For example, to
         create a config file which is not readable by other users (useful if it stores
@@ -1510,3 +1510,132 @@ public:
     */
     wxFileName& operator=(const wxString& filename);
 };
+
+
+/**
+    @class wxFileStat
+
+    Information about a file system object retrieved all at once.
+
+    Unlike calling wxFileName functions such as wxFileName::FileExists(),
+    wxFileName::GetSize() and wxFileName::GetModificationTime() separately,
+    each of which needs to query the file system, creating an object of this
+    class retrieves all the information about the object with the given path
+    in a single operation, and the accessors of this class just return the
+    information stored in it.
+
+    Note that the information is not updated automatically if the file
+    changes, Update() must be called explicitly to do it.
+
+    Objects of this class can also be returned by
+    wxDir::GetFirst(wxString*, wxFileStat*, const wxString&, int) when
+    enumerating the directory contents.
+
+    Example:
+    @code
+        const wxFileStat st(path);
+        if ( st.IsOk() && st.IsFile() )
+            wxLogMessage("%s: %llu bytes", path, st.GetSize().GetValue());
+    @endcode
+
+    @since 3.3.0
+
+    @library{wxbase}
+    @category{file}
+*/
+class wxFileStat
+{
+public:
+    /**
+        Default constructor creates an object not corresponding to any file.
+
+        IsOk() returns @false for it.
+     */
+    wxFileStat();
+
+    /**
+        Constructor retrieving the information about the given path.
+
+        Use IsOk() to check if it was successful.
+
+        @param path
+            Path of the file or directory.
+        @param flags
+            If it includes ::wxFILE_EXISTS_NO_FOLLOW, the information about
+            the symbolic link itself and not its target is retrieved. Other
+            flags are ignored.
+     */
+    explicit wxFileStat(const wxString& path, int flags = 0);
+
+    /**
+        Retrieve the information about the given path.
+
+        See the constructor for the parameters description.
+
+        @return The same value as returned by IsOk() after calling it.
+     */
+    bool Update(const wxString& path, int flags = 0);
+
+    /**
+        Return @true if the information was successfully retrieved.
+
+        This is the case if the path exists and is accessible. Note that a
+        dangling symbolic link is considered not to exist unless
+        ::wxFILE_EXISTS_NO_FOLLOW is used.
+
+        All the other functions, except IsSymLink(), can only be called if
+        this function returns @true.
+     */
+    bool IsOk() const;
+
+    /**
+        Return @true if this is a regular file.
+     */
+    bool IsFile() const;
+
+    /**
+        Return @true if this is a directory.
+     */
+    bool IsDir() const;
+
+    /**
+        Return @true if the path is a symbolic link.
+
+        Notice that this function returns @true for the symbolic links even if
+        they were followed, i.e. if ::wxFILE_EXISTS_NO_FOLLOW was not used, and
+        all the other functions return the information about the link target.
+
+        This function always returns @false under the systems not supporting
+        symbolic links.
+     */
+    bool IsSymLink() const;
+
+    /**
+        Return the permissions as a combination of ::wxPosixPermissions
+        elements.
+     */
+    int GetPermissions() const;
+
+    /**
+        Return the size of the file.
+     */
+    wxULongLong GetSize() const;
+
+    /**
+        Return the last access time.
+     */
+    wxDateTime GetAccessTime() const;
+
+    /**
+        Return the last modification time.
+     */
+    wxDateTime GetModificationTime() const;
+
+    /**
+        Return the creation time.
+
+        Notice that under Unix this is actually the time of the last change
+        of the file status, just as for wxFileName::GetTimes().
+     */
+    wxDateTime GetCreationTime() const;
+};
@@ -404,6 +404,26 @@ public:
     */
     static wxString GetMimeTypeFromExt(const wxString& location);
 
+    /**
+        Returns the protocols supported by this handler.
+
+        If this function returns a non-empty array, wxFileSystem only calls
+        CanOpen() for the locations using one of the returned protocols and
+        skips this handler for all the other ones, which makes opening files
+        faster when many handlers are registered.
+
+        The default implementation returns an empty array, meaning that the
+        handler may be able to open locations with any protocol and that
+        CanOpen() must be always called to check for it.
+
+        Note that this function is called when the handler is added to or
+        removed from wxFileSystem and its return value must not change
+        afterwards.
+
+        @since 3.3.0
+    */
+    virtual wxArrayString GetSupportedProtocols() const;
+
     /**
         Opens the file and returns wxFSFile pointer or @NULL if failed.
         Must be overridden in derived handlers.
@@ -451,6 +471,16 @@ protected:
     */
     static wxString GetProtocol(const wxString& location);
 
+    /**
+        Returns @true if the location uses the given protocol.
+
+        This is equivalent to comparing the result of GetProtocol() with
+        @a protocol but doesn't allocate any memory.
+
+        @since 3.3.0
+    */
+    static bool HasProtocol(const wxString& location, const wxString& protocol);
+
     /**
         Returns the right location string extracted from @a location.
 
@@ -460,6 +490,19 @@ protected:
         @endcode
     */
     static wxString GetRightLocation(const wxString& location);
+
+    /**
+        Finds the right location in @a location.
+
+        This is similar to GetRightLocation() but returns the start and end
+        positions of the right location in the string instead of copying it.
+
+        @return @false if the right location is empty.
+
+        @since 3.3.0
+    */
+    static bool GetRightLocationRange(const wxString& location,
+                                      size_t* start, size_t* end);
 };
 
 
@@ -63,10 +63,45 @@ public:
     /**
         Return array of strings containing all facenames found by
         EnumerateFacenames().
+
+        Since wxWidgets 3.3.0, the result of this function is cached and
+        subsequent calls with the same parameters return the cached result
+        until InvalidateCache() is called.
     */
     static wxArrayString GetFacenames(wxFontEncoding encoding = wxFONTENCODING_SYSTEM,
                                       bool fixedWidthOnly = false);
 
+    /**
+        Type of the callback used with GetFacenamesAsync().
+    */
+    using FacenamesCallback = std::function<void (const wxArrayString&)>;
+
+    /**
+        Asynchronous version of GetFacenames().
+
+        This function returns immediately and calls the provided callback with
+        the array of facenames later, in the main thread. The callback is
+        always called asynchronously, even if the facenames are already
+        cached.
+
+        Under wxMSW and wxOSX the fonts are enumerated in a background thread,
+        so this function may be used to avoid blocking the UI when there are
+        many fonts in the system, e.g. it can be called when the application
+        starts to fill the cache used by GetFacenames(). Under the other
+        platforms the fonts are enumerated in the main thread, but only when
+        the application becomes idle.
+
+        Note that the callback is called even if the object which requested
+        the facenames doesn't exist any longer, so it must not capture any
+        objects which could be destroyed before this happens (or use
+        wxWeakRef to check for it).
+
+        @since 3.3.0
+    */
+    static void GetFacenamesAsync(const FacenamesCallback& callback,
+                                  wxFontEncoding encoding = wxFONTENCODING_SYSTEM,
+                                  bool fixedWidthOnly = false);
+
     /**
         Returns @true if the given string is valid face name, i.e. it's the face name
         of an installed font and it can safely be used with wxFont::SetFaceName.
@@ -15,5 +15,29 @@ class wxInternetFSHandler : public wxFileSystemHandler
 {
 public:
     wxInternetFSHandler();
+
+    /**
+        Sets the cache to use for all HTTP requests.
+
+        By default no cache is used and the files are always downloaded from
+        the server. If the cache is set, the fresh responses are returned
+        directly from it and the stale ones are revalidated using conditional
+        requests, see wxHTTPCache for more details.
+
+        @param cache
+            The cache to use or @NULL to stop using it. The cache is not
+            owned by this class and must remain alive until this function is
+            called with another value or the program terminates.
+
+        @since 3.3.0
+    */
+    static void SetCache(wxHTTPCache* cache);
+
+    /**
+        Returns the cache set by SetCache() or @NULL.
+
+        @since 3.3.0
+    */
+    static wxHTTPCache* GetCache();
 };
 
@@ -89,7 +89,8 @@ public:
         should be used with care on other platforms for directories with lots
         of children (e.g. the root directory) as it calls Add() for each
         subdirectory, potentially creating a lot of watches and taking a long
-        time to execute.
+        time to execute. EnableAsyncTreeAdd() can be used to avoid blocking
+        while the tree is being scanned.
 
         Note that on platforms that use symbolic links, you will probably want
         to have called wxFileName::DontFollowLink on @a path. This is especially
@@ -120,6 +121,69 @@ public:
      */
     virtual bool RemoveAll();
 
+    /**
+        Enables or disables adding the subdirectories asynchronously in
+        AddTree().
+
+        When this option is enabled, AddTree() only starts watching the root
+        of the tree itself before returning, while its subdirectories are
+        enumerated by a worker thread and watched later, when the events
+        generated by it are processed by the event loop. This avoids blocking
+        the program while scanning big directory trees on the platforms where
+        AddTree() needs to watch each subdirectory individually, i.e. all of
+        them except MSW (if no filter is used) and macOS.
+
+        Note that changes inside the subdirectories which are not watched yet
+        are not reported, use HasPendingTreeAdd() to check whether the tree
+        is fully watched. Calling RemoveTree() or RemoveAll() cancels any
+        pending additions of the subdirectories of the affected trees.
+
+        This option has no effect if @c wxUSE_THREADS is 0.
+
+        @since 3.3.0
+     */
+    void EnableAsyncTreeAdd(bool enable = true);
+
+    /**
+        Returns @true if some subdirectories of the trees added by AddTree()
+        are still not watched.
+
+        This can only be the case if EnableAsyncTreeAdd() had been called.
+
+        @since 3.3.0
+     */
+    bool HasPendingTreeAdd() const;
+
+    /**
+        Enables or disables sending the events in batches.
+
+        When many changes happen in quick succession, e.g. during a build,
+        sending an event for each of them is inefficient. If @a delayMs is
+        positive, the changes are collected instead and a single
+        wxFileSystemWatcherBatchEvent containing all of them is sent once no
+        new changes happened during this interval (or, if the changes keep
+        coming, once ten times this interval has passed since the first of
+        them). The identical changes, i.e. having the same type and paths,
+        are only included in the batch once. Note that no individual
+        wxFileSystemWatcherEvent are sent at all while batching is enabled.
+
+        Passing 0, which is the default, disables batching. Any changes
+        already collected are sent immediately in this case.
+
+        This is currently not supported under macOS when using FSEvents, nor
+        when @c wxUSE_TIMER is 0.
+
+        @since 3.3.0
+     */
+    void SetBatchDelay(int delayMs);
+
+    /**
+        Returns the delay set by SetBatchDelay() or 0 if batching is disabled.
+
+        @since 3.3.0
+     */
+    int GetBatchDelay() const;
+
     /**
         Returns the number of currently watched paths.
 
@@ -229,6 +293,49 @@ public:
 
 wxEventType wxEVT_FSWATCHER;
 
+/**
+    @class wxFileSystemWatcherBatchEvent
+
+    Event sent by wxFileSystemWatcher instead of several
+    wxFileSystemWatcherEvents if wxFileSystemWatcher::SetBatchDelay() was
+    used.
+
+    This event can be handled using @c EVT_FSWATCHER_BATCH event table macro
+    or by binding to @c wxEVT_FSWATCHER_BATCH.
+
+    @library{wxbase}
+    @category{events}
+
+    @see wxFileSystemWatcher
+    @see @ref overview_events
+
+    @since 3.3.0
+*/
+class wxFileSystemWatcherBatchEvent : public wxEvent
+{
+public:
+    /// The type of the container with the individual changes.
+    using Events = std::vector<wxFileSystemWatcherEvent>;
+
+    explicit wxFileSystemWatcherBatchEvent(int watchid = wxID_ANY);
+
+    /**
+        Returns all the changes in this batch, in the order they happened.
+
+        These events can include warnings and errors too.
+     */
+    const Events& GetEvents() const;
+
+    /**
+        Sets the changes in this batch.
+
+        The contents of @a events is moved into this object, leaving it empty.
+     */
+    void SetEvents(Events& events);
+};
+
+wxEventType wxEVT_FSWATCHER_BATCH;
+
 /**
     These are the possible types of file system change events.
 
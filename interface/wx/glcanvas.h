@@ -935,6 +935,23 @@ public:
     */
     static bool IsExtensionSupported(const char *extension);
 
+    /**
+        Returns the address of the given OpenGL function.
+
+        This function can be used to retrieve the functions not exported
+        directly by the OpenGL library on the current platform, e.g. all
+        functions added after OpenGL 1.1 under MSW.
+
+        Note that an OpenGL context must be current when calling it and that
+        the returned pointer may be only valid for this context under some
+        platforms.
+
+        @return The function address or @NULL if it's not available.
+
+        @since 3.3.0
+    */
+    static void* GetGLProcAddress(const char *name);
+
     /**
         Sets the current colour for this window (using @c glcolor3f()), using
         the wxWidgets colour database to find a named colour.
@@ -965,4 +982,155 @@ public:
         @return @false if an error occurred.
     */
     virtual bool SwapBuffers();
+
+    /**
+        Swaps the buffers, indicating that only the given region was changed.
+
+        This function may be used instead of SwapBuffers() when only a part of
+        the window was redrawn to allow the compositor to update only this part
+        of the screen. This is currently only implemented when using EGL and
+        the @c EGL_KHR_swap_buffers_with_damage or @c EGL_EXT_swap_buffers_with_damage
+        extension is available, otherwise it's the same as SwapBuffers().
+
+        @param damage
+            The changed region in window coordinates, i.e. the same ones as
+            used by wxPaintEvent and wxWindow::GetUpdateRegion(). Notice that
+            the entire back buffer must still be valid, i.e. either it must
+            be fully redrawn or GetBufferAge() must be used to determine which
+            parts of it need to be updated.
+
+        @return @false if an error occurred.
+
+        @since 3.3.0
+    */
+    virtual bool SwapBuffersWithDamage(const wxRegion& damage);
+
+    /**
+        Sets the swap interval, i.e. the minimal number of vertical retraces
+        between buffer swaps.
+
+        By default, the swap interval is 0 under Unix, as otherwise
+        SwapBuffers() may block for a long time when the window is occluded,
+        and the system default, which is usually 1, elsewhere.
+
+        The new swap interval is applied by the next call to SwapBuffers().
+
+        This is currently only implemented in wxGTK and wxX11.
+
+        @param interval
+            0 to disable synchronization with the vertical retrace, a positive
+            value to enable it or a negative one to enable adaptive
+            synchronization, which doesn't wait for the retrace if the frame
+            was late, if supported (this is only the case when using GLX and
+            @c GLX_EXT_swap_control_tear extension is available).
+
+        @return @false if the given interval is not supported, in which case
+            the swap interval is not changed.
+
+        @since 3.3.0
+    */
+    virtual bool SetSwapInterval(int interval);
+
+    /**
+        Returns the age of the current back buffer.
+
+        The age is the number of frames since the contents of the back buffer
+        were rendered, e.g. 1 if it contains the previous frame. This allows
+        to only redraw the part of the buffer that changed since then instead
+        of the full frame.
+
+        This function must be called when this canvas is current and before
+        drawing anything into the back buffer. It's only implemented when
+        using EGL with @c EGL_EXT_buffer_age or @c EGL_KHR_partial_update
+        extension or GLX with @c GLX_EXT_buffer_age one.
+
+        @return The back buffer age, 0 if its contents are undefined or -1 if
+            this information is not available.
+
+        @since 3.3.0
+    */
+    virtual int GetBufferAge();
+
+    /**
+        Indicates that only the given region of the back buffer will be
+        modified before the next buffer swap.
+
+        This allows some drivers, notably on mobile hardware, to avoid
+        reading the unchanged parts of the back buffer. The function must be
+        called after GetBufferAge() and before drawing anything.
+
+        This is currently only implemented when using EGL with the
+        @c EGL_KHR_partial_update extension.
+
+        @param region
+            The region in window coordinates.
+
+        @return @false if setting the damage region is not supported or
+            failed.
+
+        @since 3.3.0
+    */
+    virtual bool SetDamageRegion(const wxRegion& region);
+};
+
+/**
+    @class wxGLImageUploader
+
+    Helper for uploading wxImage data to OpenGL textures efficiently.
+
+    This class avoids any conversions of the image data when possible, i.e.
+    for the images without alpha, and uses pixel buffer objects (PBOs), if
+    supported, to allow the driver to copy the data to the texture
+    asynchronously.
+
+    Example of using it for updating a texture every frame:
+    @code
+    // Create the uploader once, after making the context current.
+    m_uploader.reset(new wxGLImageUploader());
+
+    ...
+
+    glBindTexture(GL_TEXTURE_2D, m_texture);
+    m_uploader->Upload(image);
+    @endcode
+
+    @library{wxgl}
+    @category{gl}
+
+    @since 3.3.0
+*/
+class wxGLImageUploader
+{
+public:
+    /**
+        Creates the uploader for the current OpenGL context.
+
+        The context must be current when the object is created and destroyed.
+    */
+    wxGLImageUploader();
+
+    /**
+        Destroys the uploader and the resources used by it.
+    */
+    ~wxGLImageUploader();
+
+    /**
+        Uploads the image to the texture currently bound to @c GL_TEXTURE_2D.
+
+        The image data is uploaded as the level 0 of the texture using
+        @c GL_RGB format or @c GL_RGBA if the image has alpha channel. In the
+        latter case the image data needs to be interleaved with alpha, which
+        is done directly in the pixel buffer if PBOs are used.
+
+        @return @false if the image is invalid or an OpenGL error occurred.
+    */
+    bool Upload(const wxImage& image);
+
+    /**
+        Returns @true if pixel buffer objects are used.
+
+        PBOs are not available with OpenGL ES, as used under iOS, and may also
+        be unavailable with some old OpenGL implementations.
+    */
+    bool IsUsingPBO() const;
 };
@@ -150,6 +150,30 @@ public:
     */
     virtual void CloseSubpath();
 
+    /**
+        Prepares the path for being drawn many times.
+
+        Some backends need to convert the path to their native representation
+        every time it is stroked or filled. This function performs this
+        conversion once and keeps its result, making subsequent drawing of
+        the path cheaper, which is worth doing for the paths that are drawn
+        often, e.g. on every repaint of a window. The compiled path can be
+        drawn using any transformation matrix of wxGraphicsContext.
+
+        Notice that the path must be created once and reused for this to be
+        useful, recreating it on every repaint discards any benefits.
+
+        Modifying the path after calling this function is allowed, but
+        discards the cached data, so this function would need to be called
+        again. All copies of the path share the cached data.
+
+        Currently this function only does anything for the Cairo and Direct2D
+        backends.
+
+        @since 3.3.0
+    */
+    virtual void Compile();
+
     /**
         @return @true if the point is within the path.
     */
@@ -333,6 +357,17 @@ enum wxGradientType {
     wxGRADIENT_RADIAL
 };
 
+/**
+   Shape of the markers drawn by wxGraphicsContext::DrawMarkers().
+
+   @since 3.3.0
+ */
+enum wxMarkerShape
+{
+    wxMARKER_SQUARE,    ///< Square with the side equal to the marker size.
+    wxMARKER_CIRCLE     ///< Circle with the diameter equal to the marker size.
+};
+
 
 /**
     Represents a bitmap.
@@ -805,6 +840,78 @@ public:
     virtual void DrawRoundedRectangle(wxDouble x, wxDouble y, wxDouble w,
                                       wxDouble h, wxDouble radius);
 
+    /**
+        Draws the given rectangles.
+
+        This is much faster than calling DrawRectangle() for each of them,
+        e.g. when drawing scatter plots or maps.
+
+        Notice that, depending on the backend, the overlapping items drawn by
+        this and the other batch drawing functions, i.e. DrawEllipses(),
+        DrawMarkers() and StrokeLineSegments(), may be drawn as their union,
+        i.e. the overlapping areas are not painted twice, which produces
+        different results from drawing the items individually when using
+        translucent colours.
+
+        @param n Number of rectangles in @a rects array.
+        @param rects Array of the rectangles to draw.
+
+        @since 3.3.0
+    */
+    virtual void DrawRectangles(size_t n, const wxRect2DDouble* rects);
+
+    /**
+        Draws the ellipses inscribed in the given rectangles.
+
+        See DrawRectangles() for the notes about drawing overlapping items.
+
+        @param n Number of rectangles in @a rects array.
+        @param rects Array of the bounding rectangles of the ellipses.
+
+        @since 3.3.0
+    */
+    virtual void DrawEllipses(size_t n, const wxRect2DDouble* rects);
+
+    /**
+        Draws markers of the same size centered at the given points.
+
+        If @a colours is specified, each marker is filled with the
+        corresponding colour instead of the current brush, which is still
+        used for stroking the outline of the markers, unless it is null. The
+        consecutive markers using the same colour are drawn together, so it
+        is advantageous to sort the points by their colour.
+
+        @param n Number of points in @a centres array.
+        @param centres Array of the centres of the markers.
+        @param size Width and height of the markers.
+        @param shape Shape of the markers.
+        @param colours Optional array of @a n colours to fill the markers with.
+
+        @since 3.3.0
+    */
+    virtual void DrawMarkers(size_t n, const wxPoint2DDouble* centres,
+                             wxDouble size,
+                             wxMarkerShape shape = wxMARKER_SQUARE,
+                             const wxColour* colours = nullptr);
+
+    /**
+        Strokes disconnected line segments using the current pen.
+
+        Each segment is defined by two consecutive points of the array, which
+        must contain @c 2*n points, i.e. the segments are from @c points[0]
+        to @c points[1], from @c points[2] to @c points[3] and so on.
+
+        Unlike the overload of StrokeLines() taking separate arrays of the
+        start and end points, this function doesn't need any copying of the
+        points.
+
+        @param n Number of segments.
+        @param points Array of @c 2*n points.
+
+        @since 3.3.0
+    */
+    virtual void StrokeLineSegments(size_t n, const wxPoint2DDouble* points);
+
     /**
         Draws text at the defined position.
     */
@@ -1782,6 +1782,30 @@ public:
     /// Set attribute for the specified column.
     virtual void SetColAttr(wxGridCellAttr *attr, int col);
 
+    /**
+        Set attribute for all cells of the specified block.
+
+        This function is equivalent to calling SetAttr() for all cells of the
+        block, but is much more efficient for big blocks, as it only stores
+        the block itself and not each of its cells.
+
+        If the block intersects any blocks for which attributes were
+        previously set, the attribute of this block replaces them in the
+        intersecting part, while the rest of these blocks keeps using their
+        attributes. Passing @NULL @a attr removes the attributes from all
+        cells of the block.
+
+        Note that the attributes set for the individual cells using SetAttr()
+        take precedence over the ones set by this function.
+
+        Rows or columns inserted inside the block extend it, while inserting
+        them before the block shifts it, as with the other attributes.
+
+        @since 3.3.0
+     */
+    virtual void SetAttrRange(wxGridCellAttr *attr,
+                              const wxGridBlockCoords& block);
+
     ///@}
 
     /**
@@ -2731,6 +2755,145 @@ public:
         @since 3.1.4
      */
     virtual bool CanMeasureColUsingSameAttr(int col) const;
+
+    /**
+        @name Asynchronous Data Retrieval
+
+        These functions allow implementing tables which don't have all their
+        data available immediately, e.g. because it needs to be retrieved from
+        a remote database, without blocking the UI.
+
+        See wxGridPagedTableBase for a ready to use implementation of them.
+     */
+    ///@{
+
+    /**
+        Called by wxGrid before drawing the cells of the given rows.
+
+        This function can be overridden to start retrieving the data of these
+        rows, and possibly some rows around them, if it is not available yet.
+        It must not block and should return immediately.
+
+        Default implementation does nothing.
+
+        @since 3.3.0
+     */
+    virtual void PrepareRows(int topRow, int bottomRow);
+
+    /**
+        Return true if the data for the given row is available.
+
+        If this function returns @false, wxGrid doesn't draw the cells of this
+        row normally but uses wxGrid::DrawCellPlaceholder() for them instead.
+        The table should refresh the row in the grid when its data becomes
+        available.
+
+        Default implementation always returns @true.
+
+        @since 3.3.0
+     */
+    virtual bool IsRowAvailable(int row);
+
+    ///@}
+};
+
+/**
+    @class wxGridPagedTableBase
+
+    Base class for grid tables retrieving their data asynchronously.
+
+    This class implements wxGridTableBase::PrepareRows() and
+    wxGridTableBase::IsRowAvailable() by dividing the table rows in pages of
+    the given size and requesting the data for all the pages containing the
+    rows about to be shown, as well as a configurable number of rows above and
+    below them, by calling FetchRows(). The derived class must implement this
+    function to start retrieving the data, e.g. in a background thread, and
+    call NotifyRowsFetched() from the main thread when it is done. Until then,
+    placeholders are shown instead of the cells of these rows, and the rows
+    are refreshed once their data becomes available.
+
+    The derived class still needs to implement GetNumberRows(),
+    GetNumberCols(), GetValue() and SetValue(), as usual. Note that GetValue()
+    may still be called for the rows which are not available, e.g. when
+    computing the best size of the column, and should return quickly in this
+    case, typically just returning an empty string.
+
+    The page states are not updated when the rows are inserted or deleted,
+    the derived class should call InvalidateAllRows() if this happens.
+
+    @library{wxcore}
+    @category{grid}
+
+    @since 3.3.0
+*/
+class wxGridPagedTableBase : public wxGridTableBase
+{
+public:
+    /**
+        Constructor specifying the number of rows fetched at once.
+     */
+    explicit wxGridPagedTableBase(int pageSize = 100);
+
+    /**
+        Set the number of rows fetched at once.
+
+        Changing the page size forgets all the previously fetched rows.
+     */
+    void SetPageSize(int pageSize);
+
+    /// Return the number of rows fetched at once.
+    int GetPageSize() const;
+
+    /**
+        Set the number of rows above and below the visible ones to fetch in
+        advance.
+
+        By default, this number is equal to the page size.
+     */
+    void SetPrefetchRows(int rows);
+
+    /// Return the number of rows fetched in advance.
+    int GetPrefetchRows() const;
+
+    /**
+        Must be called when the data of the rows requested by FetchRows()
+        becomes available.
+
+        This function must be called from the main thread, use
+        wxEvtHandler::CallAfter() to call it from the background thread.
+
+        Notice that only the pages fully covered by the given rows become
+        available, so normally this function should be called with the same
+        arguments as were passed to FetchRows().
+     */
+    void NotifyRowsFetched(int firstRow, int numRows);
+
+    /**
+        Forget the data of the given rows.
+
+        The rows will be requested again when they need to be shown. This
+        function can also be used to request the rows again if fetching them
+        failed, as they are not requested again otherwise.
+     */
+    void InvalidateRows(int firstRow, int numRows);
+
+    /**
+        Forget the data of all rows.
+     */
+    void InvalidateAllRows();
+
+protected:
+    /**
+        Must be overridden to start fetching the data for the given rows.
+
+        This function must not block, but should start retrieving the data
+        and call NotifyRowsFetched() once it is done. It may also call it
+        immediately if the data is available synchronously.
+
+        The rows are always requested in whole pages and all consecutive
+        pages needed at once are requested in a single call.
+     */
+    virtual void FetchRows(int firstRow, int numRows) = 0;
 };
 
 
@@ -2755,6 +2918,92 @@ enum wxGridTableRequest
 
 
 
+/**
+    @class wxGridRenderCache
+
+    Cache of the results of text measurements done by the cell renderers.
+
+    This cache is created by wxGrid::EnableRenderCache() and can be retrieved
+    using wxGrid::GetRenderCache(). It is used by the standard renderers, such
+    as wxGridCellStringRenderer and wxGridCellAutoWrapStringRenderer, to avoid
+    wrapping and measuring the same text again when the cells are redrawn or
+    auto-sized, and can also be used by the custom renderers.
+
+    All the cached values are stored together with the hash of the cell value
+    and the font used for measuring it and are only returned if both of them
+    still match, so the cache doesn't need to be explicitly invalidated when
+    the cell values change. It is cleared automatically when the rows or
+    columns are inserted or deleted and when it becomes too big.
+
+    All Get functions return @true and fill in their output parameter if the
+    cache contains the value for the given cell, and @false otherwise.
+
+    @library{wxcore}
+    @category{grid}
+
+    @since 3.3.0
+ */
+class wxGridRenderCache
+{
+public:
+    /**
+        Create the cache storing the data for at most the given number of
+        cells.
+
+        When this number is exceeded, the cache is cleared.
+     */
+    explicit wxGridRenderCache(size_t maxCells = 100000);
+
+    /// Get the lines resulting from wrapping the value in the given width.
+    bool GetLines(int row, int col,
+                  const wxString& value, const wxFont& font, int width,
+                  wxArrayString& lines) const;
+
+    /// Store the lines resulting from wrapping the value in the given width.
+    void SetLines(int row, int col,
+                  const wxString& value, const wxFont& font, int width,
+                  const wxArrayString& lines);
+
+    /// Get the best size of the cell.
+    bool GetBestSize(int row, int col,
+                     const wxString& value, const wxFont& font,
+                     wxSize& size) const;
+
+    /// Store the best size of the cell.
+    void SetBestSize(int row, int col,
+                     const wxString& value, const wxFont& font,
+                     const wxSize& size);
+
+    /// Get the best width of the cell for the given height.
+    bool GetBestWidth(int row, int col,
+                      const wxString& value, const wxFont& font, int height,
+                      int& width) const;
+
+    /// Store the best width of the cell for the given height.
+    void SetBestWidth(int row, int col,
+                      const wxString& value, const wxFont& font, int height,
+                      int width);
+
+    /// Get the best height of the cell for the given width.
+    bool GetBestHeight(int row, int col,
+                       const wxString& value, const wxFont& font, int width,
+                       int& height) const;
+
+    /// Store the best height of the cell for the given width.
+    void SetBestHeight(int row, int col,
+                       const wxString& value, const wxFont& font, int width,
+                       int height);
+
+    /// Forget all the data cached for the given cell.
+    void InvalidateCell(int row, int col);
+
+    /// Forget all the cached data.
+    void Clear();
+
+    /// Return the number of cells with the cached data.
+    size_t GetCount() const;
+};
+
 /**
     @class wxGridSizesInfo
 
@@ -2865,6 +3114,39 @@ enum wxGridRenderStyle
 };
 
 
+/**
+    Flags used with wxGrid::CopySelection() method.
+
+    @since 3.3.0
+ */
+enum wxGridCopyFlags
+{
+    /// Copy the cells as tab-separated text.
+    wxGRID_COPY_TEXT = 0x001,
+
+    /// Copy the cells as an HTML table.
+    wxGRID_COPY_HTML = 0x002,
+
+    /**
+        Only create the data in the selected formats when it is pasted.
+
+        This avoids serializing the cells if the data is never pasted, which
+        can be important when copying big selections. However, notice that
+        the data then corresponds to the grid contents at the moment of
+        pasting, and not copying, and that nothing is pasted if the grid
+        doesn't exist any more by then.
+
+        Only wxGTK and wxMSW support creating the data on demand, under the
+        other platforms this flag is ignored.
+    */
+    wxGRID_COPY_DEFERRED = 0x004,
+
+    /// Default flags used by wxGrid::CopySelection().
+    wxGRID_COPY_DEFAULT = wxGRID_COPY_TEXT |
+                          wxGRID_COPY_HTML
+};
+
+
 
 /**
     @class wxGrid
@@ -4087,6 +4369,44 @@ public:
     */
     void AutoSizeRows(bool setAsMin = true);
 
+    /**
+        Sets the number of rows measured when auto sizing a column.
+
+        By default, AutoSizeColumn() and AutoSizeColumns() measure the
+        contents of all grid rows, which may take a long time for grids with
+        hundreds of thousands of rows. Calling this function with a non-zero
+        value allows to get an approximate result much faster by measuring
+        only the given number of rows if the grid has more of them.
+
+        The rows used are the currently visible ones, a few rows at the
+        beginning and at the end of the grid and the rest of them is chosen
+        randomly, but deterministically, i.e. the same rows are always used
+        for the grid of the given size.
+
+        Note that the column may still be too narrow for the contents of some
+        of the rows which were not measured when using this function.
+
+        @param numRows
+            Number of rows to measure or 0, which is the default, to measure
+            all of them.
+
+        @see GetAutoSizeSampleRows()
+
+        @since 3.3.0
+    */
+    void SetAutoSizeSampleRows(int numRows);
+
+    /**
+        Returns the number of rows measured when auto sizing a column.
+
+        Returns 0 if all rows are measured, which is the default.
+
+        @see SetAutoSizeSampleRows()
+
+        @since 3.3.0
+    */
+    int GetAutoSizeSampleRows() const;
+
     /**
         Returns the cell fitting mode.
 
@@ -5069,9 +5389,14 @@ public:
         nothing was selected, the selected cells weren't contiguous,
         or a clipboard error occurred.
 
+        @param flags Combination of wxGridCopyFlags values selecting the
+            formats in which the cells are copied and whether the data is
+            created immediately or only when it's pasted. By default, the
+            cells are copied both as tab-separated text and as HTML table.
+
         @since 3.3.0
      */
-    bool CopySelection();
+    bool CopySelection(int flags = wxGRID_COPY_DEFAULT);
 
     /**
         Deselects a row of cells.
@@ -5944,6 +6269,49 @@ public:
      */
     void RefreshAttr(int row, int col);
 
+    /**
+        Enable or disable caching the results of the text measurements done
+        by the cell renderers.
+
+        The cache is disabled by default, enabling it can significantly speed
+        up drawing and auto-sizing the grids showing a lot of text, especially
+        when using wxGridCellAutoWrapStringRenderer, at the price of the extra
+        memory used by it.
+
+        @see wxGridRenderCache
+
+        @since 3.3.0
+     */
+    void EnableRenderCache(bool enable = true);
+
+    /**
+        Return true if the render cache is enabled.
+
+        @since 3.3.0
+     */
+    bool IsRenderCacheEnabled() const;
+
+    /**
+        Return the render cache or @NULL if it is not enabled.
+
+        This function can be used by the custom renderers to cache the results
+        of their computations.
+
+        @since 3.3.0
+     */
+    wxGridRenderCache* GetRenderCache() const;
+
+    /**
+        Forget all the data stored in the render cache, if enabled.
+
+        Normally it is unnecessary to call this function, as the cached data
+        is only used if the cell value and font haven't changed, but it may be
+        needed if a custom renderer caches data depending on something else.
+
+        @since 3.3.0
+     */
+    void ClearRenderCache();
+
     /**
         Redraw all the cells in the given block.
 
@@ -5966,6 +6334,28 @@ public:
     void RefreshBlock(int topRow, int leftCol,
                       int bottomRow, int rightCol);
 
+    /**
+        Redraw the given cells.
+
+        This function is useful when the values of many, possibly not
+        adjacent, cells are frequently updated directly in the table, e.g.
+        when showing data streamed from some external source. Unlike
+        SetCellValue(), which refreshes the entire row containing the cell,
+        it refreshes only the cells themselves and the empty cells to their
+        right into which their contents may overflow.
+
+        The refresh doesn't happen immediately but is deferred until the next
+        event loop iteration, so calling this function many times is cheap:
+        all the cells passed to it are refreshed together and each cell is
+        refreshed only once, even if it's specified more than once.
+
+        The cells which are not valid, e.g. because they were deleted before
+        the refresh happens, are ignored.
+
+        @since 3.3.0
+     */
+    void RefreshCells(const std::vector<wxGridCellCoords>& cells);
+
     /**
         Draws part or all of a wxGrid on a wxDC for printing or display.
 
@@ -6225,6 +6615,19 @@ public:
 
     virtual void DrawCellHighlight( wxDC& dc, const wxGridCellAttr *attr );
 
+    /**
+        Draw the cell for which the table data is not available yet.
+
+        This function is called instead of the cell renderer for the rows for
+        which wxGridTableBase::IsRowAvailable() returns @false. By default it
+        just draws the cell background and an ellipsis, but it can be
+        overridden to show the placeholder differently.
+
+        @since 3.3.0
+     */
+    virtual void DrawCellPlaceholder( wxDC& dc, const wxGridCellAttr& attr,
+                                      const wxRect& rect, int row, int col );
+
     virtual void DrawRowLabels( wxDC& dc, const wxArrayInt& rows );
     virtual void DrawRowLabel( wxDC& dc, int row );
 
@@ -241,6 +241,12 @@ public:
         the screen (and thus invisible). This is not nonsense - some tags (like
         wxHtmlColourCell or font setter) must be drawn even if they are invisible!
 
+        Notice that, to avoid iterating over all the cells of long documents,
+        wxHtmlContainerCell doesn't call this method for the invisible cells
+        other than wxHtmlColourCell, wxHtmlFontCell and wxHtmlWidgetCell since
+        wxWidgets 3.3.0 unless there is a selection, so the custom cells must
+        not rely on it being called.
+
         @param dc
             Device context to which the cell is to be drawn.
         @param x,y
@@ -777,7 +783,21 @@ public:
 class wxHtmlWordCell : public wxHtmlCell
 {
 public:
+    /**
+        Constructor measuring the word using the given DC.
+    */
     wxHtmlWordCell(const wxString& word, const wxDC& dc);
+
+    /**
+        Constructor using the already known extent of the word.
+
+        This is useful to avoid measuring the same word repeatedly if its
+        extent, as returned by wxDC::GetTextExtent(), is already known.
+
+        @since 3.3.0
+    */
+    wxHtmlWordCell(const wxString& word,
+                   wxCoord width, wxCoord height, wxCoord descent);
 };
 
 
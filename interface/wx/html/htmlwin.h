@@ -194,6 +194,33 @@ public:
     */
     bool AppendToPage(const wxString& source);
 
+    /**
+        Appends a self-contained HTML fragment to the current page.
+
+        Unlike AppendToPage(), this function doesn't parse and lay out the
+        entire page again, but only the given fragment, whose cells are added
+        at the end of the existing ones, and only redraws the new part of the
+        page. This makes it suitable for showing big documents progressively,
+        by calling it repeatedly with the successive parts of the document,
+        e.g. from a timer or an idle event handler or whenever more data
+        becomes available, as the already shown part remains visible and the
+        window can be scrolled while the rest of the document is added.
+
+        Notice that the fragment is parsed on its own, so it must not rely on
+        any tags opened, but not closed, in the previous parts of the page,
+        e.g. if the page ends with an unclosed @c \<b\> tag, the fragment
+        text is not shown in bold. Typically, it should consist of complete
+        paragraphs, table rows or other block elements.
+
+        @param fragment
+            HTML code fragment
+
+        @return @false if an error occurred, @true otherwise.
+
+        @since 3.3.0
+    */
+    bool AppendFragmentToPage(const wxString& fragment);
+
     /**
         Returns pointer to the top-level container.
 
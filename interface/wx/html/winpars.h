@@ -12,6 +12,9 @@
     tag handlers. It is used almost exclusively together with the set of
     @ref overview_html_handlers "TAGS_MODULE_* macros"
 
+    Since wxWidgets 3.3.0, these modules are lazy, see wxModule::SetLazy(),
+    and are only initialized when the first wxHtmlWinParser is created.
+
     @library{wxhtml}
     @category{html}
 
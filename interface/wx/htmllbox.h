@@ -77,6 +77,60 @@ public:
     const wxFileSystem& GetFileSystem() const;
     ///@}
 
+    /**
+        Sets the maximal number of items whose parsed representation is
+        cached.
+
+        The control keeps the result of parsing and laying out the HTML of the
+        recently shown items, so that they don't have to be parsed again when
+        they are shown again, e.g. when scrolling back and forth. When the
+        cache is full, the least recently used item is removed from it.
+
+        Increasing the cache size can make scrolling faster for items with
+        complex HTML at the price of using more memory. It shouldn't be less
+        than the number of the visible items, as otherwise every redraw of the
+        control requires parsing some of them.
+
+        The default cache size is 50.
+
+        @since 3.3.0
+    */
+    void SetCacheSize(size_t numItems);
+
+    /**
+        Returns the maximal number of items whose parsed representation is
+        cached.
+
+        @see SetCacheSize()
+
+        @since 3.3.0
+    */
+    size_t GetCacheSize() const;
+
+    /**
+        Parses the items in the given range in advance.
+
+        The items are parsed in small batches during idle time, so that calling
+        this function doesn't block the program, and the results are stored in
+        the cache, making showing these items later faster. This can be used to
+        prepare the items which are likely to be shown soon, e.g. the next page
+        of items when scrolling down.
+
+        Note that the items are parsed in the main thread, as OnGetItem() and
+        the HTML parser are not thread-safe, and that only as many items as
+        fit into the cache without removing the currently visible ones from it
+        are parsed.
+
+        @param from
+            The first item to parse.
+        @param to
+            The last item to parse (inclusive), must be greater or equal to
+            @a from.
+
+        @since 3.3.0
+    */
+    void PrecacheItems(size_t from, size_t to);
+
 protected:
 
     /**
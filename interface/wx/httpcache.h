@@ -0,0 +1,215 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        wx/httpcache.h
+// Purpose:     interface of wxHTTPCache
+// Author:      wxWidgets team
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+    Cached response returned by wxHTTPCache::Find().
+
+    @library{wxnet}
+    @category{net}
+
+    @since 3.3.0
+*/
+struct wxHTTPCacheEntry
+{
+    /// The response body.
+    wxMemoryBuffer data;
+
+    /// The value of "Content-Type" header of the response.
+    wxString contentType;
+
+    /**
+        The value of "ETag" header of the response, may be empty.
+
+        If non-empty, it should be sent in "If-None-Match" header of the
+        request revalidating the stale response.
+    */
+    wxString eTag;
+
+    /**
+        The value of "Last-Modified" header of the response, may be empty.
+
+        If non-empty, it should be sent in "If-Modified-Since" header of the
+        request revalidating the stale response.
+    */
+    wxString lastModified;
+};
+
+/**
+    @class wxHTTPCache
+
+    Cache of HTTP responses stored in memory and, optionally, on disk.
+
+    This class implements a private cache, as defined by RFC 9111, for the
+    responses to GET requests identified by their URL. It honours
+    "Cache-Control" header, including "no-store", "no-cache" and "max-age"
+    directives, as well as "Expires", "Age" and "Pragma: no-cache" headers,
+    and uses "ETag" and "Last-Modified" validators for revalidating the stale
+    responses. When the response doesn't specify its expiration time
+    explicitly, it's considered to be fresh for 10% of the time since its
+    last modification, but not longer than a day.
+
+    The total size of the cached responses is limited and the least recently
+    used ones are removed from the cache when the limit is exceeded. When
+    using a directory, the cached responses persist between the program runs
+    and only the most recently used of them are kept in memory.
+
+    This class is typically not used directly, but passed to
+    wxWebSession::SetCache() or wxInternetFSHandler::SetCache(), e.g.
+    @code
+    wxHTTPCache cache(wxStandardPaths::Get().GetUserDir(wxStandardPaths::Dir_Cache));
+    wxWebSession::GetDefault().SetCache(&cache);
+    wxInternetFSHandler::SetCache(&cache);
+    @endcode
+
+    but it can also be used with any other HTTP client by calling Find()
+    before making the request, Revalidate() after receiving 304 response to
+    the conditional request and Store() after receiving a successful one.
+
+    All functions of this class are thread-safe.
+
+    @library{wxnet}
+    @category{net}
+
+    @see wxWebSession, wxInternetFSHandler
+
+    @since 3.3.0
+*/
+class wxHTTPCache
+{
+public:
+    /// Result of Find().
+    enum Status
+    {
+        /// The response is not in the cache.
+        Status_Miss,
+
+        /// The cached response can be used without contacting the server.
+        Status_Fresh,
+
+        /// The cached response must be revalidated before using it.
+        Status_Stale
+    };
+
+    /**
+        Function returning the value of the given header of the response or
+        empty string if it doesn't have this header.
+    */
+    using HeaderGetter = std::function<wxString (const wxString& name)>;
+
+    /**
+        Creates the cache using the given directory.
+
+        @param dir
+            The directory in which the responses are stored, it is created if
+            it doesn't exist. If it is empty, the responses are only stored in
+            memory. Notice that the directory shouldn't be used by anything
+            else and must not be used by more than one cache object at once.
+        @param maxSize
+            The maximal total size of the cached data.
+    */
+    explicit wxHTTPCache(const wxString& dir = wxString(),
+                         size_t maxSize = 64*1024*1024);
+
+    /**
+        Returns the directory passed to the constructor.
+    */
+    const wxString& GetDirectory() const;
+
+    /**
+        Sets the maximal total size of the cached data.
+
+        The least recently used responses are removed from the cache if its
+        current size is greater than the new maximal size.
+    */
+    void SetMaxSize(size_t maxSize);
+
+    /**
+        Returns the maximal total size of the cached data.
+    */
+    size_t GetMaxSize() const;
+
+    /**
+        Sets the maximal size of the data kept in memory.
+
+        This is only used when the cache uses a directory and is 8MB by
+        default. The data of the responses not kept in memory is read from
+        disk when they are used.
+    */
+    void SetMaxMemorySize(size_t maxSize);
+
+    /**
+        Returns the maximal size of the data kept in memory.
+    */
+    size_t GetMaxMemorySize() const;
+
+    /**
+        Returns the total size of the cached data.
+    */
+    size_t GetSize() const;
+
+    /**
+        Returns the number of cached responses.
+    */
+    size_t GetCount() const;
+
+    /**
+        Finds the cached response for the given URL.
+
+        @param url
+            The URL of the request.
+        @param entry
+            If non-null, filled with the cached response if it is found.
+        @return
+            @c Status_Miss if the response is not in the cache,
+            @c Status_Fresh if it can be used directly or @c Status_Stale if
+            it must be revalidated first.
+    */
+    Status Find(const wxString& url, wxHTTPCacheEntry* entry = nullptr);
+
+    /**
+        Stores the successful response in the cache.
+
+        The response is not stored if its headers forbid it, if it is bigger
+        than the maximal cache size or if it is already stale and has no
+        validators. Any response previously stored for the same URL is
+        removed in any case.
+
+        @return @true if the response was stored.
+    */
+    bool Store(const wxString& url,
+               const HeaderGetter& getHeader,
+               const void* data, size_t size);
+
+    /**
+        Updates the cached response after receiving 304 status in reply to a
+        conditional request.
+
+        The expiration time and the validators of the cached response are
+        updated using the headers of the 304 response.
+
+        @param url
+            The URL of the request.
+        @param getHeader
+            Function returning the headers of the 304 response.
+        @param entry
+            If non-null, filled with the revalidated response.
+        @return @false if the response for this URL is not in the cache.
+    */
+    bool Revalidate(const wxString& url,
+                    const HeaderGetter& getHeader,
+                    wxHTTPCacheEntry* entry = nullptr);
+
+    /**
+        Removes the response for the given URL from the cache.
+    */
+    void Remove(const wxString& url);
+
+    /**
+        Removes all responses from the cache.
+    */
+    void Clear();
+};
@@ -119,6 +119,7 @@ enum wxImagePNGType
 #define wxIMAGE_OPTION_PNG_COMPRESSION_MEM_LEVEL        wxString("PngZM")
 #define wxIMAGE_OPTION_PNG_COMPRESSION_STRATEGY         wxString("PngZS")
 #define wxIMAGE_OPTION_PNG_COMPRESSION_BUFFER_SIZE      wxString("PngZB")
+#define wxIMAGE_OPTION_PNG_FAST                         wxString("PngFast")
 
 #define wxIMAGE_OPTION_TIFF_BITSPERSAMPLE               wxString("BitsPerSample")
 #define wxIMAGE_OPTION_TIFF_SAMPLESPERPIXEL             wxString("SamplesPerPixel")
@@ -142,6 +143,24 @@ enum
 };
 
 
+/**
+    Type of the function called while loading an image.
+
+    The function is called by the image handlers after decoding the rows from
+    @a y to @a y + @a height (exclusive) of the image being loaded, which can
+    be already used, e.g. to show the partially loaded image to the user. Note
+    that the image alpha channel may be only created after some rows had been
+    already reported, in which case all of them are considered to be opaque.
+
+    Loading the image is cancelled if the function returns @false.
+
+    @see wxImage::SetLoadProgressFunction()
+
+    @since 3.3.0
+ */
+using wxImageLoadProgressFunction =
+    std::function<bool (const wxImage& image, int y, int height)>;
+
 /**
     @class wxImageHandler
 
@@ -301,6 +320,30 @@ public:
     virtual bool SaveFile(wxImage* image, wxOutputStream& stream,
                           bool verbose = true);
 
+    /**
+        Loads an image from a stream reporting the progress of doing it.
+
+        This function is similar to LoadFile() but calls the provided function
+        after decoding each band of the image rows, allowing to display the
+        image before it is completely loaded or to cancel loading it.
+
+        The default implementation simply calls LoadFile() and then calls the
+        function once for the entire image. PNG, JPEG and TIFF handlers
+        override it to report the rows as soon as they are decoded, although
+        this is not done for interlaced PNG images, which can't be decoded
+        incrementally.
+
+        @return @true if the image was loaded, @false if an error occurred or
+            loading was cancelled by the progress function.
+
+        @see wxImage::SetLoadProgressFunction()
+
+        @since 3.3.0
+    */
+    virtual bool LoadFileIncrementally(wxImage* image, wxInputStream& stream,
+                                       const wxImageLoadProgressFunction& progress,
+                                       bool verbose = true, int index = -1);
+
     /**
         Sets the preferred file extension associated with this handler.
 
@@ -983,7 +1026,7 @@ public:
         for 32-bit programs. For 64-bit programs the limit is 2^48 and so not
         relevant in practice.
 
-        @see Rescale()
+        @see Rescale(), wxImageResampler
     */
     wxImage Scale(int width, int height,
                    wxImageResizeQuality quality = wxIMAGE_QUALITY_NORMAL) const;
@@ -1108,6 +1151,21 @@ public:
     */
     wxImage ChangeLightness(int alpha) const;
 
+    /**
+        Applies all colour operations of the given transformation to the image.
+
+        This is equivalent to calling the wxImage functions corresponding to
+        all the operations of the transformation in order, but is much faster,
+        as all pixels are processed in a single pass over the image and by
+        using multiple threads for big images, see SetDefaultThreadCount().
+
+        As with ConvertToGreyscale() and ConvertToDisabled(), the pixels of
+        the mask colour, if the image has a mask, are left unchanged.
+
+        @since 3.3.0
+    */
+    void ApplyColourTransform(const wxImageColourTransform& transform);
+
     ///@}
 
 
@@ -1353,6 +1411,13 @@ public:
             (in bytes) for saving a PNG file. Ideally this should be as big as
             the resulting PNG file. Use this option if your application produces
             images with small size variation.
+        @li @c wxIMAGE_OPTION_PNG_FAST: If set to 1, optimizes saving the PNG
+            file for speed rather than for the resulting file size, which can
+            be useful when saving many images, e.g. screenshots, quickly. This
+            uses the fastest compression level and restricts the filters used
+            to the cheapest ones, unless @c wxIMAGE_OPTION_PNG_COMPRESSION_LEVEL
+            or @c wxIMAGE_OPTION_PNG_FILTER are explicitly specified. This
+            option is available since wxWidgets 3.3.0.
 
         Options specific to wxTIFFHandler:
         @li @c wxIMAGE_OPTION_TIFF_BITSPERSAMPLE: Number of bits per
@@ -1703,6 +1768,50 @@ public:
     */
     void ClearAlpha();
 
+    /**
+        Creates the image from 32 bit pixels with premultiplied alpha.
+
+        The pixels are @c 0xAARRGGBB values in the native byte order, i.e. they
+        are stored as blue, green, red and alpha bytes in memory on little
+        endian machines. This is the format used by native bitmaps on many
+        platforms, e.g. by Cairo image surfaces, so this function can be used
+        to create the image from such bitmap data without any intermediate
+        conversions.
+
+        The image created by this function always has alpha channel.
+
+        @param width The width of the image.
+        @param height The height of the image.
+        @param data Pointer to the pixel data, must be non-null.
+        @param stride Offset between the rows of pixels in bytes, 0 means
+            that the rows follow each other without any gaps, i.e. is the
+            same as specifying @c 4*width.
+        @return @true if the image was created successfully.
+
+        @since 3.3.0
+
+        @see CopyToPremultipliedARGB()
+    */
+    bool CreateFromPremultipliedARGB(int width, int height,
+                                     const wxUint32* data, int stride = 0);
+
+    /**
+        Copies the image data to a buffer of 32 bit pixels with premultiplied
+        alpha.
+
+        This is the reverse of CreateFromPremultipliedARGB() and uses the same
+        pixel format. Pixels of the images without alpha channel are fully
+        opaque.
+
+        @param data Pointer to the buffer which must be big enough to contain
+            all image rows, must be non-null.
+        @param stride Offset between the rows of pixels in bytes, 0 means
+            that the rows follow each other without any gaps.
+
+        @since 3.3.0
+    */
+    void CopyToPremultipliedARGB(wxUint32* data, int stride = 0) const;
+
     /**
         Sets the image data without performing checks.
 
@@ -1740,6 +1849,34 @@ public:
      */
     static void SetDefaultLoadFlags(int flags);
 
+    /**
+        Sets the number of threads used for processing images.
+
+        By default, all image processing functions work in the calling thread
+        only, but calling this function with an argument greater than 1 allows
+        Scale(), Rescale(), the @c Resample family of functions and Blur(),
+        BlurHorizontal() and BlurVertical() to split the image into bands
+        which are processed in parallel by the worker threads of a pool shared
+        by the entire library. The value of 0 means to use as many threads as
+        there are CPUs in the system.
+
+        The results are exactly the same as when using a single thread, only
+        the time it takes to produce them changes. Note that small images are
+        always processed in the calling thread because the overhead of using
+        multiple threads would outweigh any gains for them.
+
+        This function affects all calls made after it, in all threads, and
+        does nothing if the library was built without thread support.
+
+        @param count The maximal number of threads to use, including the
+            calling thread, or 0 to use the number of CPUs.
+
+        @see GetDefaultThreadCount()
+
+        @since 3.3.0
+     */
+    static void SetDefaultThreadCount(int count);
+
     /**
         Sets the flags used for loading image files by this object.
 
@@ -1766,6 +1903,34 @@ public:
      */
     void SetLoadFlags(int flags);
 
+    /**
+        Sets the function to call while loading the image.
+
+        If this function is called before LoadFile(), the provided function is
+        called after decoding every band of the image rows, allowing to show
+        the image while it is being loaded, e.g. when loading big images. It
+        can also return @false to cancel loading the image, in which case
+        LoadFile() returns @false without logging any errors.
+
+        Note that, as the load flags, the progress function only applies to the
+        next call to LoadFile() and needs to be set again before loading
+        another image into the same object, e.g.
+        @code
+            wxImage image;
+            image.SetLoadProgressFunction([this](const wxImage& img, int y, int h)
+                {
+                    ShowRows(img, y, h);
+                    return !m_cancelled;
+                });
+            image.LoadFile("huge.png");
+        @endcode
+
+        @see wxImageHandler::LoadFileIncrementally()
+
+        @since 3.3.0
+     */
+    void SetLoadProgressFunction(const wxImageLoadProgressFunction& progress);
+
     /**
         Specifies whether there is a mask or not.
 
@@ -1894,6 +2059,37 @@ public:
     */
     static void AddHandler(wxImageHandler* handler);
 
+    /**
+        Pointer to a function creating an image handler.
+
+        @see AddHandlerFactory()
+
+        @since 3.3.0
+    */
+    typedef wxImageHandler *(*HandlerFactory)();
+
+    /**
+        Register a function creating the image handler for the given type.
+
+        This function is similar to AddHandler() but the handler is only
+        created, by calling the provided @a factory, when it's needed for the
+        first time, e.g. when loading an image of this type, which avoids the
+        overhead of creating handlers which are never used.
+
+        Note that handlers are created on first use from any thread, so the
+        handlers registered using this function must be safe to create from
+        any thread in which images may be loaded.
+
+        @param imageType
+            The type of the handler created by the factory.
+        @param factory
+            The function returning a new heap-allocated handler object, which
+            will be deleted by wxImage as if it were passed to AddHandler().
+
+        @since 3.3.0
+    */
+    static void AddHandlerFactory(wxBitmapType imageType, HandlerFactory factory);
+
     /**
         Deletes all image handlers.
         This function is called by wxWidgets on exit.
@@ -2022,6 +2218,15 @@ public:
      */
     static int GetDefaultLoadFlags();
 
+    /**
+        Returns the number of threads used for processing images.
+
+        See SetDefaultThreadCount() for more information.
+
+        @since 3.3.0
+     */
+    static int GetDefaultThreadCount();
+
     ///@{
     /**
         If the image file contains more than one image and the image handler is
@@ -2100,6 +2305,153 @@ public:
 };
 
 
+/**
+    @class wxImageResampler
+
+    Helper class for scaling many images of the same size to the same size.
+
+    Scaling the image with wxImage::Scale() requires computing the weights of
+    the source pixels contributing to each of the destination pixels, which
+    depend only on the source and destination sizes and on the resampling
+    method used, but not on the image contents. This class computes these
+    weights only once, when it is created, and then reuses them for all the
+    images scaled using it, which makes scaling many images, e.g. all frames
+    of an animation or all thumbnails in a list, faster.
+
+    The results of Scale() are exactly the same as those of wxImage::Scale()
+    called with the same arguments.
+
+    Example:
+    @code
+    wxImageResampler resampler(wxSize(640, 480), wxSize(64, 48),
+                               wxIMAGE_QUALITY_HIGH);
+    for ( const wxImage& frame : frames )
+        thumbnails.push_back(resampler.Scale(frame));
+    @endcode
+
+    Note that this class is not copyable.
+
+    @library{wxcore}
+    @category{gdi}
+
+    @see wxImage::Scale()
+
+    @since 3.3.0
+*/
+class wxImageResampler
+{
+public:
+    /**
+        Creates the resampler for scaling the images of the given size.
+
+        Both sizes must be strictly positive.
+
+        @param srcSize
+            The size of the images which will be passed to Scale().
+        @param dstSize
+            The size of the images returned by Scale().
+        @param quality
+            Determines what method to use for resampling the image, see
+            wxImageResizeQuality documentation.
+    */
+    wxImageResampler(const wxSize& srcSize,
+                     const wxSize& dstSize,
+                     wxImageResizeQuality quality = wxIMAGE_QUALITY_NORMAL);
+
+    /**
+        Returns the size of the images this resampler can scale.
+    */
+    const wxSize& GetSourceSize() const;
+
+    /**
+        Returns the size of the scaled images.
+    */
+    const wxSize& GetDestSize() const;
+
+    /**
+        Returns the quality specified in the constructor.
+    */
+    wxImageResizeQuality GetQuality() const;
+
+    /**
+        Returns the scaled version of the given image.
+
+        The image must be valid and its size must be equal to
+        GetSourceSize(), otherwise an invalid image is returned.
+    */
+    wxImage Scale(const wxImage& image) const;
+};
+
+
+/**
+    @class wxImageColourTransform
+
+    Sequence of colour operations which can be applied to wxImage in a single
+    pass.
+
+    This class is useful when several colour operations, e.g. converting the
+    image to greyscale and then changing its lightness, need to be applied to
+    the same image: using wxImage::ApplyColourTransform() with all of them is
+    much faster than calling the corresponding wxImage functions one after
+    another, as it avoids iterating over the image pixels several times.
+    Moreover, the consecutive operations changing each colour channel
+    independently, such as ConvertToDisabled() and ChangeLightness(), are
+    combined into a single lookup table and so don't need to be computed for
+    each pixel at all.
+
+    Example:
+    @code
+    const wxImageColourTransform transform =
+        wxImageColourTransform().ConvertToGreyscale().ChangeLightness(150);
+
+    for ( wxImage& image : icons )
+        image.ApplyColourTransform(transform);
+    @endcode
+
+    All functions adding operations to the transformation have the same
+    meaning as the wxImage functions with the same name and return a
+    reference to this object to allow chaining them.
+
+    @library{wxcore}
+    @category{gdi}
+
+    @since 3.3.0
+*/
+class wxImageColourTransform
+{
+public:
+    /// Creates an empty transformation, which doesn't change anything.
+    wxImageColourTransform();
+
+    /// Adds conversion to greyscale, see wxImage::ConvertToGreyscale().
+    wxImageColourTransform& ConvertToGreyscale(double weight_r = 0.299,
+                                               double weight_g = 0.587,
+                                               double weight_b = 0.114);
+
+    /// Adds conversion to disabled look, see wxImage::ConvertToDisabled().
+    wxImageColourTransform& ConvertToDisabled(unsigned char brightness = 255);
+
+    /// Adds lightness change, see wxImage::ChangeLightness().
+    wxImageColourTransform& ChangeLightness(int alpha);
+
+    /// Adds hue rotation, see wxImage::RotateHue().
+    wxImageColourTransform& RotateHue(double angle);
+
+    /// Adds saturation change, see wxImage::ChangeSaturation().
+    wxImageColourTransform& ChangeSaturation(double factor);
+
+    /// Adds brightness change, see wxImage::ChangeBrightness().
+    wxImageColourTransform& ChangeBrightness(double factor);
+
+    /// Adds replacing one colour with another, see wxImage::Replace().
+    wxImageColourTransform& Replace(unsigned char r1, unsigned char g1, unsigned char b1,
+                                    unsigned char r2, unsigned char g2, unsigned char b2);
+
+    /// Returns true if the transformation doesn't contain any operations.
+    bool IsEmpty() const;
+};
+
+
 class wxImageHistogram : public wxImageHistogramBase
 {
 public:
@@ -2139,12 +2491,13 @@ wxImage wxNullImage;
 /**
     Initializes all available image handlers.
 
-    This function calls wxImage::AddHandler() for all the available image
-    handlers (see @ref image_handlers for the full list). Calling it is the
-    simplest way to initialize wxImage but it creates and registers even the
-    handlers your program may not use. If you want to avoid the overhead of
-    doing this you need to call wxImage::AddHandler() manually just for the
-    handlers that you do want to use.
+    This function calls wxImage::AddHandlerFactory() for all the available
+    image handlers (see @ref image_handlers for the full list). Calling it is
+    the simplest way to initialize wxImage and, since wxWidgets 3.3.0, only
+    creates the handlers when they are used for the first time. However it
+    still links in the code of all handlers, so if you want to avoid this, you
+    need to call wxImage::AddHandler() manually just for the handlers that you
+    do want to use.
 
     @see wxImage, wxImageHandler
 
@@ -180,6 +180,39 @@ public:
                       int flags = wxIMAGELIST_DRAW_NORMAL,
                       bool solidBackground = false);
 
+    /**
+        Enable or disable drawing the images from a single atlas bitmap.
+
+        When the atlas is enabled, the image list combines all its images in
+        a single bitmap when Draw() is called and draws the images from it,
+        which is faster when drawing many images, e.g. in wxListCtrl or
+        wxTreeCtrl containing thousands of items. The atlas is recreated
+        when the images in the list change, so it is best to enable it for
+        image lists which are not modified often.
+
+        The atlas is only used for drawing images with
+        wxIMAGELIST_DRAW_TRANSPARENT flag and if all of them have the scale
+        factor of 1 and the same size as the image list itself. Otherwise the
+        images are drawn individually, as when the atlas is not enabled.
+
+        This function is only available in the generic implementation of
+        this class, which is not used under MSW.
+
+        @onlyfor{wxgtk,wxosx,wxqt}
+
+        @since 3.3.0
+    */
+    void EnableAtlas(bool enable = true);
+
+    /**
+        Return @true if EnableAtlas() was called.
+
+        @onlyfor{wxgtk,wxosx,wxqt}
+
+        @since 3.3.0
+    */
+    bool IsAtlasEnabled() const;
+
     /**
         Returns the bitmap corresponding to the given index.
     */
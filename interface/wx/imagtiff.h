@@ -46,3 +46,113 @@ protected:
     virtual bool DoCanRead(wxInputStream& stream);
 };
 
+
+/**
+    @class wxTIFFReader
+
+    Provides random access to the pages of a, possibly multi-page, TIFF file.
+
+    Unlike loading the individual pages using wxImage::LoadFile() with a
+    non-default image index, which needs to open the file and find the
+    requested page in it every time, this class keeps the file open and
+    remembers the positions of all its pages, so that they can be loaded in
+    any order efficiently.
+
+    It also allows loading just a part of a page using LoadPageRegion(),
+    which only decodes the strips or tiles of the image intersecting this
+    part when possible and so is much faster than loading the entire page,
+    especially for big tiled images.
+
+    Example of use:
+    @code
+    wxFileInputStream stream("scan.tif");
+    wxTIFFReader reader(stream);
+    if ( reader.IsOk() )
+    {
+        for ( int n = 0; n < reader.GetPageCount(); ++n )
+        {
+            wxImage image;
+            if ( reader.LoadPage(n, &image) )
+                ... use the image ...
+        }
+    }
+    @endcode
+
+    This class is only available if @c wxUSE_LIBTIFF is 1.
+
+    @library{wxcore}
+    @category{gdi}
+
+    @see wxTIFFHandler
+
+    @since 3.3.0
+*/
+class wxTIFFReader
+{
+public:
+    /**
+        Constructor opening the TIFF file contained in the given stream.
+
+        The stream must be seekable and must remain valid for the lifetime of
+        this object.
+
+        Use IsOk() to check if the stream could be opened successfully.
+    */
+    explicit wxTIFFReader(wxInputStream& stream);
+
+    /**
+        Destructor closes the file, but not the associated stream.
+    */
+    ~wxTIFFReader();
+
+    /**
+        Returns @true if the TIFF file was opened successfully.
+    */
+    bool IsOk() const;
+
+    /**
+        Returns the number of pages, i.e. images, in the file.
+    */
+    int GetPageCount() const;
+
+    /**
+        Returns the size of the given page without loading it.
+
+        Returns ::wxDefaultSize if the page couldn't be accessed.
+
+        @param page
+            Index of the page between 0 and GetPageCount() - 1.
+    */
+    wxSize GetPageSize(int page);
+
+    /**
+        Loads the given page into the provided image.
+
+        @param page
+            Index of the page between 0 and GetPageCount() - 1.
+        @param image
+            Non-null pointer to the image to load the page into.
+        @return
+            @true if the page was loaded successfully or @false if an error
+            occurred, which is logged in this case.
+    */
+    bool LoadPage(int page, wxImage* image);
+
+    /**
+        Loads the given part of the page into the provided image.
+
+        The resulting image has the size of the rectangle, which must lie
+        entirely inside the page.
+
+        @param page
+            Index of the page between 0 and GetPageCount() - 1.
+        @param rect
+            The region of the page to load.
+        @param image
+            Non-null pointer to the image to load the page region into.
+        @return
+            @true if the page region was loaded successfully or @false if an
+            error occurred, which is logged in this case.
+    */
+    bool LoadPageRegion(int page, const wxRect& rect, wxImage* image);
+};
@@ -1611,6 +1611,40 @@ protected:
         @since 3.1.2
     */
     virtual bool OnGetItemIsChecked(long item) const;
+
+    /**
+        This function may be overridden in the derived class for a control with
+        @c wxLC_VIRTUAL style to find the item to select when the user types
+        its first letters.
+
+        By default, the control searches for the item by calling OnGetItemText()
+        for all items one by one, which may take a noticeable time in controls
+        with a very large number of items. If the application can find the
+        item more efficiently, e.g. by using an index of the item texts sorted
+        alphabetically, it can override this function to do it.
+
+        @param start
+            The index of the first item to examine. If no matching item is
+            found after it, the search should continue from the first item in
+            the control up to this one.
+        @param prefix
+            The text typed by the user which must be compared with the start
+            of the first column of the items in a case-insensitive way.
+        @param item
+            Must be set to the index of the found item or -1 if there is no
+            item with the given prefix if the function returns @true.
+        @return
+            @true if the search was performed or @false to use the default
+            search implementation.
+
+        The base class version always returns @false.
+
+        @see OnGetItemText()
+
+        @since 3.3.0
+    */
+    virtual bool OnFindItemByPrefix(long start, const wxString& prefix,
+                                    long& item) const;
 };
 
 
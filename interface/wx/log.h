@@ -277,6 +277,18 @@ public:
     */
     static bool IsAllowedTraceMask(const wxString& mask);
 
+    /**
+        Returns @true if any trace masks are enabled.
+
+        This function is thread-safe and very cheap, it is used by wxLogTrace()
+        to avoid evaluating its arguments when tracing is not used at all.
+
+        @see AddTraceMask()
+
+        @since 3.3.0
+    */
+    static bool HasTraceMasks();
+
     /**
         Remove the @a mask from the list of allowed masks for
         wxLogTrace().
@@ -436,6 +448,19 @@ public:
      */
     static bool IsLevelEnabled(wxLogLevel level, wxString component);
 
+    /**
+        Returns false if logging at this level is disabled for all components.
+
+        This function only compares @a level with the global log level and the
+        levels set for all components using SetComponentLevel(), which makes
+        it cheaper than IsLevelEnabled(). The logging macros call it before
+        calling IsLevelEnabled() so that disabled logging statements have
+        minimal run-time overhead.
+
+        @since 3.3.0
+     */
+    static bool IsLevelEnabledForAnyComponent(wxLogLevel level);
+
     /**
         Sets the log level for the given component.
 
@@ -688,6 +713,24 @@ protected:
     */
     virtual void DoLogText(const wxString& msg);
 
+    /**
+        Override this function to indicate that this log target is thread-safe.
+
+        If this function returns @true, the messages logged from the threads
+        other than the main one are passed to DoLogRecord() of this log target
+        immediately, in the thread logging them, instead of being buffered
+        until the next call to FlushActive() in the main thread. Note that
+        repeated messages are never counted when this happens, even if
+        SetRepetitionCounting() was called.
+
+        Default implementation returns @false.
+
+        @see wxLogAsync
+
+        @since 3.3.0
+    */
+    virtual bool IsThreadSafe() const;
+
     ///@}
 };
 
@@ -822,6 +865,99 @@ public:
 };
 
 
+/**
+    @class wxLogAsync
+
+    Log target passing the messages to another log target asynchronously.
+
+    This class queues all messages logged to it in a fixed size buffer and
+    passes them to the real log target from a separate thread. Queuing the
+    messages doesn't use any locks, so this target is thread-safe and can be
+    used by the worker threads directly, without waiting for the main thread
+    to flush the messages, and it doesn't block them even when they log many
+    messages, e.g. with wxLogDebug() or wxLogTrace(). Notice that formatting
+    the message, i.e. adding the time stamp and the level to it, is done by
+    the real log target and so in the background thread too, but the format
+    string arguments of the logging functions are still formatted by the
+    thread calling them.
+
+    If the buffer is full, new messages are discarded. Optionally, the number
+    of messages less important than warnings logged per second may also be
+    limited using SetRateLimit(). The number of the discarded messages is
+    logged as a warning by the background thread.
+
+    Example of using this class:
+    @code
+    wxLog::SetActiveTarget(new wxLogAsync(new wxLogStderr));
+    @endcode
+
+    @note The real log target is used from the background thread only, so it
+        must not use any GUI functions, which excludes wxLogGui or
+        wxLogTextCtrl, for example.
+
+    @library{wxbase}
+    @category{logging,threading}
+
+    @since 3.3.0
+*/
+class wxLogAsync : public wxLog
+{
+public:
+    /**
+        Creates the target and starts the background thread.
+
+        @param target
+            The log target used for actually logging the messages, must be
+            non-null. This object takes ownership of it.
+        @param capacity
+            The maximal number of messages which may be queued, it is rounded
+            up to the next power of 2.
+    */
+    explicit wxLogAsync(wxLog *target, size_t capacity = 4096);
+
+    /**
+        Destructor logs all the queued messages and stops the background
+        thread before deleting the real log target.
+    */
+    virtual ~wxLogAsync();
+
+    /**
+        Limits the number of messages logged per second.
+
+        Messages at levels less important than wxLOG_Warning, i.e. all
+        informational, verbose, debug and trace messages, logged in excess of
+        the given number per second are discarded.
+
+        @param maxPerSecond
+            The maximal number of messages per second or 0, which is the
+            default, to not limit it.
+    */
+    void SetRateLimit(unsigned maxPerSecond);
+
+    /**
+        Returns the rate limit set by SetRateLimit().
+    */
+    unsigned GetRateLimit() const;
+
+    /**
+        Returns the total number of messages discarded so far.
+
+        This includes the messages discarded because the buffer was full and
+        because of the rate limit.
+    */
+    size_t GetDroppedCount() const;
+
+    /**
+        Waits until all the messages queued before are logged and flushes the
+        real log target.
+
+        This function returns immediately if nothing was logged since the last
+        call to it.
+    */
+    virtual void Flush();
+};
+
+
 /**
     @class wxLogStream
 
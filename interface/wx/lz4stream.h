@@ -0,0 +1,137 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        wx/lz4stream.h
+// Purpose:     LZ4 [de]compression classes documentation
+// Author:      wxWidgets team
+// Created:     2026-10-14
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+    @class wxLZ4InputStream
+
+    This filter stream decompresses data in LZ4 frame format.
+
+    LZ4 frame format is used by .lz4 files created by lz4 utility. LZ4
+    compression is less efficient than Gzip format used by wxZlibInputStream,
+    but both compression and decompression are much faster, which makes it
+    appropriate for the data which is read or written often.
+
+    Input consisting of several concatenated LZ4 frames is decompressed as a
+    single stream, as it is done by lz4 utility itself.
+
+    This class is only available if @c wxUSE_LIBLZ4 is set to 1, which
+    requires liblz4 library headers and libraries to be available. When using
+    configure, @c --with-liblz4 option must be used to enable it.
+
+    @library{wxbase}
+    @category{archive,streams}
+
+    @see wxInputStream, wxZlibInputStream, wxZstdInputStream,
+        wxLZ4OutputStream
+
+    @since 3.3.0
+*/
+class wxLZ4InputStream : public wxFilterInputStream
+{
+public:
+    /**
+        Create decompressing stream associated with the given underlying
+        stream.
+
+        This overload does not take ownership of the @a stream.
+    */
+    wxLZ4InputStream(wxInputStream& stream);
+
+    /**
+        Create decompressing stream associated with the given underlying
+        stream and takes ownership of it.
+
+        As with the base wxFilterInputStream class, passing @a stream by
+        pointer indicates that this object takes ownership of it and will
+        delete it when it is itself destroyed.
+     */
+    wxLZ4InputStream(wxInputStream* stream);
+};
+
+/**
+    @class wxLZ4OutputStream
+
+    This filter stream compresses data using LZ4 frame format.
+
+    Output generated by this class is compatible with lz4 utility and
+    includes the checksum of the uncompressed data.
+
+    Notice that, unlike wxZlibOutputStream and wxZstdOutputStream, this class
+    doesn't support using multiple threads for compression, as LZ4 is usually
+    fast enough for this not to be needed.
+
+    This class is only available if @c wxUSE_LIBLZ4 is set to 1, see
+    wxLZ4InputStream for more details.
+
+    @library{wxbase}
+    @category{archive,streams}
+
+    @see wxOutputStream, wxZlibOutputStream, wxZstdOutputStream,
+        wxLZ4InputStream
+
+    @since 3.3.0
+*/
+class wxLZ4OutputStream : public wxFilterOutputStream
+{
+public:
+    /**
+        Create compressing stream associated with the given underlying
+        stream.
+
+        This overload does not take ownership of the @a stream.
+
+        @param stream
+            The stream to write the compressed data to.
+        @param level
+            Compression level: the default value of -1 and 0 select the
+            default fast compression, while values from 3 to 12 select
+            slower high compression mode.
+    */
+    wxLZ4OutputStream(wxOutputStream& stream, int level = -1);
+
+    /**
+        Create compressing stream associated with the given underlying
+        stream and takes ownership of it.
+
+        As with the base wxFilterOutputStream class, passing @a stream by
+        pointer indicates that this object takes ownership of it and will
+        delete it when it is itself destroyed.
+     */
+    wxLZ4OutputStream(wxOutputStream* stream, int level = -1);
+};
+
+/**
+    Filter class factory for LZ4 streams.
+
+    This factory allows creating wxLZ4InputStream and wxLZ4OutputStream
+    objects for the files with ".lz4" extension or with "application/x-lz4"
+    MIME type using wxFilterClassFactory::Find().
+
+    @library{wxbase}
+    @category{archive,streams}
+
+    @since 3.3.0
+*/
+class wxLZ4ClassFactory : public wxFilterClassFactory
+{
+public:
+    wxLZ4ClassFactory();
+};
+
+/**
+    Return the version of liblz4 library used by LZ4 stream classes.
+
+    @see wxVersionInfo
+
+    @header{wx/lz4stream.h}
+    @library{wxbase}
+
+    @since 3.3.0
+*/
+wxVersionInfo wxGetLibLZ4VersionInfo();
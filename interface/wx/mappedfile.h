@@ -0,0 +1,136 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        wx/mappedfile.h
+// Purpose:     wxMappedFile and wxMappedInputStream classes documentation
+// Author:      wxWidgets team
+// Created:     2026-10-14
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+    @class wxMappedFile
+
+    Provides read-only access to the contents of a file mapped into memory.
+
+    Mapping the file avoids copying its contents into a separately allocated
+    buffer, as it happens when using wxFile::Read(), and only the parts of the
+    file actually accessed are loaded into memory by the operating system.
+    This makes this class useful for reading large files, especially if only
+    a small part of them is needed.
+
+    Example of use:
+    @code
+    wxMappedFile file("data.bin");
+    if ( !file.IsOpened() ) {
+        ... the error has been already logged ...
+        return false;
+    }
+
+    const char* const data = file.GetData();
+    for ( size_t n = 0; n < file.GetLength(); ++n ) {
+        ... use data[n] ...
+    }
+    @endcode
+
+    Note that the behaviour is undefined if the file is modified by another
+    process while it is mapped.
+
+    @library{wxbase}
+    @category{file}
+
+    @see wxFile, wxMappedInputStream
+
+    @since 3.3.0
+*/
+class wxMappedFile
+{
+public:
+    /**
+        Default constructor doesn't map any file.
+
+        Call Open() later to do it.
+     */
+    wxMappedFile();
+
+    /**
+        Constructor mapping the given file.
+
+        Use IsOpened() to check whether the file was mapped successfully.
+     */
+    explicit wxMappedFile(const wxString& filename);
+
+    /**
+        Destructor unmaps the file if it's mapped.
+     */
+    ~wxMappedFile();
+
+    /**
+        Map the entire contents of the given file into memory.
+
+        Any previously mapped file is unmapped first.
+
+        An error message is logged if the file couldn't be opened or mapped.
+
+        @return @true if the file was successfully mapped.
+     */
+    bool Open(const wxString& filename);
+
+    /**
+        Unmap the file.
+
+        Does nothing if no file is mapped. The pointer returned by GetData()
+        must not be used after calling this function.
+     */
+    void Close();
+
+    /**
+        Return @true if a file is currently mapped.
+     */
+    bool IsOpened() const;
+
+    /**
+        Return the pointer to the file contents.
+
+        The returned pointer is @NULL if the file is not opened or is empty,
+        notice that empty files can be opened successfully.
+     */
+    const char* GetData() const;
+
+    /**
+        Return the length of the mapped file, in bytes.
+     */
+    size_t GetLength() const;
+};
+
+/**
+    @class wxMappedInputStream
+
+    Input stream reading from a memory mapped file.
+
+    This stream is seekable and can be used exactly like wxFileInputStream,
+    but reads the data directly from the file mapped into memory using
+    wxMappedFile. The underlying file may also be accessed directly using
+    GetFile(), e.g. to avoid copying the data when it's not needed.
+
+    @library{wxbase}
+    @category{streams}
+
+    @see wxMappedFile, wxFileInputStream
+
+    @since 3.3.0
+*/
+class wxMappedInputStream : public wxInputStream
+{
+public:
+    /**
+        Constructor maps the given file.
+
+        Use IsOk() to check whether this succeeded.
+     */
+    explicit wxMappedInputStream(const wxString& filename);
+
+    /**
+        Return the underlying mapped file.
+     */
+    const wxMappedFile& GetFile() const;
+};
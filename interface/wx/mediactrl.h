@@ -42,6 +42,109 @@ enum wxMediaCtrlPlayerControls
                     wxMEDIACTRLPLAYERCONTROLS_VOLUME
 };
 
+/**
+    @class wxMediaFrame
+
+    A decoded video frame passed to the callback set with
+    wxMediaCtrl::SetFrameCallback().
+
+    Objects of this class don't own the frame data, which remains owned by
+    the media backend and is only valid during the callback execution. The
+    data is stored in the native format of the video decoder, which may use
+    several planes, e.g. the luma and chroma components of the YUV formats are
+    usually stored separately. It can be accessed directly using
+    GetPlaneData() or converted to wxImage using ToImage().
+
+    @library{wxmedia}
+    @category{media}
+
+    @since 3.3.0
+*/
+class wxMediaFrame
+{
+public:
+    /// Return the width of the frame in pixels.
+    int GetWidth() const;
+
+    /// Return the height of the frame in pixels.
+    int GetHeight() const;
+
+    /**
+        Return the name of the pixel format of the frame.
+
+        The format names are the ones used by the backend, e.g. for GStreamer
+        they are "RGB", "BGRx", "I420", "NV12" and so on.
+    */
+    const wxString& GetFormat() const;
+
+    /**
+        Return the presentation time of the frame in milliseconds.
+
+        Returns -1 if the time is unknown.
+    */
+    wxLongLong GetTimestamp() const;
+
+    /// Return the number of planes in the frame data.
+    int GetPlaneCount() const;
+
+    /**
+        Return the data of the given plane.
+
+        @param plane
+            The plane index, between 0 and GetPlaneCount() (exclusive).
+    */
+    const unsigned char* GetPlaneData(int plane) const;
+
+    /**
+        Return the distance in bytes between the rows of the given plane.
+
+        @param plane
+            The plane index, between 0 and GetPlaneCount() (exclusive).
+    */
+    int GetPlaneStride(int plane) const;
+
+    /**
+        Return the frame as wxImage.
+
+        If the frame uses tightly packed "RGB" format, the returned image
+        shares the frame data and so can't be used after the callback returns,
+        call wxImage::Copy() to keep it. Otherwise the frame data is converted
+        into a new image. The packed RGB formats with or without alpha, as well
+        as I420, YV12, NV12 and NV21 YUV formats, are supported.
+
+        @return
+            The image or an invalid image if the frame format is not
+            supported.
+    */
+    wxImage ToImage() const;
+};
+
+/**
+    Function called with the decoded video frames.
+
+    @see wxMediaCtrl::SetFrameCallback()
+
+    @since 3.3.0
+*/
+using wxMediaFrameCallback = std::function<void (const wxMediaFrame&)>;
+
+/**
+    Video frame statistics returned by wxMediaCtrl::GetFrameStats().
+
+    @since 3.3.0
+*/
+struct wxMediaFrameStats
+{
+    /// Number of frames which reached the video sink.
+    unsigned long framesReceived;
+
+    /// Number of frames shown.
+    unsigned long framesRendered;
+
+    /// Number of frames dropped, e.g. because they arrived too late.
+    unsigned long framesDropped;
+};
+
 /**
     @class wxMediaEvent
 
@@ -326,6 +429,25 @@ public:
     */
     wxSize GetBestSize() const;
 
+    /**
+        Retrieves the statistics about the video frames of the current media.
+
+        The statistics are reset when new media is loaded. Note that the
+        numbers of the rendered and dropped frames are only available when
+        using GStreamer 1.18 or later and remain 0 otherwise.
+
+        Currently only implemented by the GStreamer backend.
+
+        @param stats
+            Non-null pointer filled with the statistics if the function
+            returns @true.
+        @return
+            @true on success or @false if the statistics are not available.
+
+        @since 3.3.0
+    */
+    bool GetFrameStats(wxMediaFrameStats* stats);
+
     /**
         Obtains the playback rate, or speed of the media. @c 1.0 represents normal
         speed, while @c 2.0 represents twice the normal speed of the media, for
@@ -415,6 +537,41 @@ public:
     */
     bool SetPlaybackRate(double dRate);
 
+    /**
+        Sets the function called for each decoded video frame.
+
+        The callback is called with the frame just before it is shown and
+        gives access to its data without copying it. This can be used, for
+        example, to analyse the video or to save some of its frames, e.g.
+        @code
+        m_mediaCtrl->SetFrameCallback([this](const wxMediaFrame& frame)
+            {
+                if ( m_saveNextFrame.exchange(false) )
+                {
+                    // Copy the image as it may share the frame data.
+                    wxImage image = frame.ToImage().Copy();
+                    CallAfter([this, image]() { SaveFrame(image); });
+                }
+            });
+        @endcode
+
+        Please note that the callback is called from a worker thread and so
+        can't use any GUI functions directly. It also blocks the video
+        pipeline while it runs, so it must return quickly to avoid dropping
+        frames, see GetFrameStats().
+
+        Currently only implemented by the GStreamer backend.
+
+        @param callback
+            The function to call or an empty function to stop calling the
+            previously set one.
+        @return
+            @true on success or @false if not supported by the backend.
+
+        @since 3.3.0
+    */
+    bool SetFrameCallback(const wxMediaFrameCallback& callback);
+
     /**
         Sets the volume of the media from a 0.0 to 1.0 range to that referred
         by @c dVolume.  @c 1.0 represents full volume, while @c 0.5
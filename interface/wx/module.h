@@ -98,7 +98,54 @@ public:
     */
     virtual bool OnInit() = 0;
 
+    /**
+        Initializes all lazy modules of the given class or derived from it.
+
+        Lazy modules, i.e. modules calling SetLazy() from their constructor,
+        are not initialized on program startup but only when this function is
+        called for them, which should be done by the code using them before
+        it needs them for the first time. Any dependencies of these modules
+        are initialized before them, as usual.
+
+        Modules already initialized are skipped, so it is cheap to call this
+        function more than once. It can be called from any thread, but only
+        after the library initialization.
+
+        Use @c module trace mask, e.g. by setting @c WXTRACE environment
+        variable to @c module, to get the timing information for each module
+        initialization in the debug builds, which can be useful for finding
+        the modules that should be made lazy.
+
+        @return @false if initializing any of the modules failed.
+
+        @since 3.3.0
+    */
+    static bool InitializeLazyModules(wxClassInfo* classInfo);
+
+    /**
+        Returns @true if this module is lazy.
+
+        @see SetLazy()
+
+        @since 3.3.0
+    */
+    bool IsLazy() const;
+
 protected:
+    /**
+        Makes this module lazy.
+
+        This function can be called from the constructor of the derived class
+        to prevent the module from being initialized on program startup, see
+        InitializeLazyModules().
+
+        Note that lazy modules are still initialized on startup if any
+        non-lazy module depends on them.
+
+        @since 3.3.0
+    */
+    void SetLazy();
+
 
     /**
         Call this function from the constructor of the derived class.
@@ -15,7 +15,7 @@
     This class contains only static functions, so users must not create instances
     but directly call the member functions.
 
-    @see wxUILocale
+    @see wxUILocale, wxCachedNumberFormatter
 
     @since 2.9.2
 
@@ -150,3 +150,104 @@ public:
     static bool GetThousandsSeparatorIfUsed(wxChar *sep);
 
 };
+
+/**
+    @class wxCachedNumberFormatter
+
+    Object version of wxNumberFormatter remembering the separators used by
+    the current UI locale.
+
+    wxNumberFormatter functions query the locale separators on every call,
+    which is relatively expensive. This class queries them only once, when
+    the object is created or UpdateFromLocale() is called, and formats and
+    parses the numbers without any intermediate allocations. This makes it
+    preferable when many numbers need to be converted in a row, e.g. when
+    drawing the cells of a grid.
+
+    The results of all the functions of this class are the same as of the
+    wxNumberFormatter functions with the same names, as long as the locale
+    doesn't change. Note that the cached separators are not updated
+    automatically when it does, so UpdateFromLocale() must be called
+    explicitly in this case.
+
+    Example:
+    @code
+        const wxCachedNumberFormatter fmt;
+        for ( size_t n = 0; n < values.size(); ++n )
+            dc.DrawText(fmt.ToString(values[n], 2), x, y + n*h);
+    @endcode
+
+    @since 3.3.0
+
+    @library{wxbase}
+*/
+class wxCachedNumberFormatter
+{
+public:
+    /**
+        Default constructor uses the separators of the current UI locale.
+     */
+    wxCachedNumberFormatter();
+
+    /**
+        Update the cached separators from the current UI locale.
+
+        This function must be called after changing the locale if the
+        existing object is still used.
+     */
+    void UpdateFromLocale();
+
+    /**
+        Return the cached decimal separator.
+
+        @see wxNumberFormatter::GetDecimalSeparator()
+     */
+    wxChar GetDecimalSeparator() const;
+
+    /**
+        Return the cached thousands separator if it is used.
+
+        @see wxNumberFormatter::GetThousandsSeparatorIfUsed()
+     */
+    bool GetThousandsSeparatorIfUsed(wxChar *sep) const;
+
+    /**
+        Returns string representation of an integer number.
+
+        @see wxNumberFormatter::ToString()
+     */
+    ///@{
+    wxString ToString(long val,
+                      int style = wxNumberFormatter::Style_WithThousandsSep) const;
+    wxString ToString(long long val,
+                      int style = wxNumberFormatter::Style_WithThousandsSep) const;
+    wxString ToString(unsigned long long val,
+                      int style = wxNumberFormatter::Style_WithThousandsSep) const;
+    ///@}
+
+    /**
+        Returns string representation of a floating point number.
+
+        @see wxNumberFormatter::ToString()
+     */
+    wxString ToString(double val,
+                      int precision,
+                      int style = wxNumberFormatter::Style_WithThousandsSep) const;
+
+    /**
+        Parse a string representation of a number possibly including
+        thousands separators.
+
+        As with wxNumberFormatter::FromString(), the overload taking unsigned
+        long long value returns @false for the strings starting with the
+        minus sign.
+
+        @see wxNumberFormatter::FromString()
+     */
+    ///@{
+    bool FromString(const wxString& s, long *val) const;
+    bool FromString(const wxString& s, long long *val) const;
+    bool FromString(const wxString& s, unsigned long long *val) const;
+    bool FromString(const wxString& s, double *val) const;
+    ///@}
+};
@@ -198,6 +198,36 @@ public:
         Increments the reference count associated with this shared data.
     */
     void IncRef();
+
+    /**
+        Returns @true if the reference count is updated atomically.
+
+        @see SetMTSafe()
+
+        @since 3.3.0
+    */
+    bool IsMTSafe() const;
+
+    /**
+        Makes the reference count of this object thread-safe.
+
+        By default, the reference count is modified using non-atomic
+        operations, which is faster but means that the objects sharing this
+        data can't be used by different threads, even if they are only read
+        from, as copying or destroying them changes the reference count.
+        After calling this function, the reference count is updated
+        atomically, so that copies of the objects using this data can be
+        freely passed between threads, as long as each object is only used by
+        a single thread at any given moment.
+
+        Note that this function must be called before the data becomes shared
+        with any other thread and that there is no way to undo its effect.
+
+        @see wxObject::SetRefDataMTSafe()
+
+        @since 3.3.0
+    */
+    void SetMTSafe();
 };
 
 
@@ -335,6 +365,40 @@ public:
     */
     void UnShare();
 
+    /**
+        Makes the reference count of the data of this object thread-safe.
+
+        This allows to pass copies of this object, e.g. a wxImage, to other
+        threads without copying the data itself, which is only done if any of
+        the copies is modified, as usual. The copy of the data made in this
+        case also uses thread-safe reference counting.
+
+        Example of passing an image to a worker thread:
+        @code
+        wxImage image("photo.jpg");
+        image.SetRefDataMTSafe();
+
+        // The copy of the image captured by the lambda shares the data with
+        // the original one.
+        wxThreadPool::Get().Submit([image]() { ProcessImage(image); });
+        @endcode
+
+        Notice that this function must be called after the object data is
+        created, e.g. after loading the image in the example above, as
+        functions creating new data, such as wxImage::Create(), don't preserve
+        this setting, and before sharing this object with any other thread.
+        It does nothing if the object doesn't have any data.
+
+        Also note that only the reference counting is made thread-safe, the
+        object itself still can't be modified by one thread while it's being
+        used by another one, which is why each thread must use its own copy.
+
+        @see wxRefCounter::SetMTSafe()
+
+        @since 3.3.0
+    */
+    void SetRefDataMTSafe();
+
     /**
         The @e delete operator is defined for debugging versions of the library only,
         when the identifier @c \__WXDEBUG__ is defined.
@@ -0,0 +1,197 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        wx/paintprofiler.h
+// Purpose:     interface of wxPaintProfiler
+// Author:      wxWidgets team
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+    @class wxPaintProfiler
+
+    Collects painting statistics for all windows.
+
+    This class can be used to find the windows responsible for slow redraws.
+    When it is running, which is not the case by default, it records, for each
+    window receiving @c wxEVT_PAINT events:
+        - The number of paint events and the time taken by handling them.
+        - The area of the update region, i.e. the part of the window which
+          needed to be repainted, compared to the area of the entire window.
+          Windows which are often fully repainted when only a small part of
+          them needs to be updated are good candidates for optimization.
+        - The number of drawing operations, such as wxDC::DrawLine() or
+          wxDC::DrawText(), performed during painting.
+
+    The collected data can be retrieved at any moment using
+    GetWindowStats(), e.g.
+    @code
+    void MyFrame::OnShowPaintStats(wxCommandEvent&)
+    {
+        for ( const auto& s : wxPaintProfiler::GetWindowStats() )
+        {
+            wxLogMessage("%s \"%s\": %lu paints, average %lldus, "
+                         "%.0f%% of the window updated, %lu primitives",
+                         s.className, s.name, s.paintCount,
+                         s.GetAverageTime(), 100*s.GetUpdateRatio(),
+                         s.primitiveCount);
+        }
+    }
+    @endcode
+
+    Additionally, the time taken by the last repaint of each window can be
+    shown directly on top of it using ShowOverlay().
+
+    Please note that only the drawing operations performed using wxDC are
+    counted. This includes the drawing done using wxGCDC, but not the drawing
+    done directly using wxGraphicsContext. Also note that the operations are
+    counted in all threads, so drawing on wxMemoryDC in a worker thread while
+    a window is being repainted affects the count of the primitives for it.
+
+    The paint times are measured using the same clock as wxEventProfiler and,
+    like it, are expressed in microseconds. All the functions of this class
+    must be called from the main thread.
+
+    @library{wxcore}
+    @category{gdi}
+
+    @see wxEventProfiler
+
+    @since 3.3.0
+*/
+class wxPaintProfiler
+{
+public:
+    /**
+        Painting statistics of a single window.
+    */
+    struct WindowStats
+    {
+        /**
+            The window these statistics are for.
+
+            This pointer is @NULL if the window had been already destroyed.
+        */
+        wxWindow* window;
+
+        /// The name of the class of the window, e.g. "wxGrid".
+        wxString className;
+
+        /// The window name, see wxWindow::GetName().
+        wxString name;
+
+        /// Number of paint events processed by the window.
+        unsigned long paintCount;
+
+        /// Total time taken by processing all paint events.
+        wxLongLong_t totalTime;
+
+        /// Maximal time taken by processing a single paint event.
+        wxLongLong_t maxTime;
+
+        /// Time taken by processing the last paint event.
+        wxLongLong_t lastTime;
+
+        /**
+            Total area, in pixels, of the update regions of all paint
+            events.
+         */
+        wxLongLong_t updateArea;
+
+        /**
+            Total area, in pixels, of the window client area at the time of
+            each paint event.
+         */
+        wxLongLong_t windowArea;
+
+        /**
+            Number of paint events for which the update region covered the
+            entire window client area.
+         */
+        unsigned long fullPaintCount;
+
+        /// Total number of wxDC drawing operations performed by the window.
+        unsigned long primitiveCount;
+
+        /// Return the average time taken by processing a paint event.
+        wxLongLong_t GetAverageTime() const;
+
+        /**
+            Return the fraction of the window repainted on average.
+
+            This is the ratio of updateArea to windowArea and is between 0
+            and 1, with 1 meaning that the entire window was always repainted.
+         */
+        double GetUpdateRatio() const;
+    };
+
+    /**
+        Start collecting the painting statistics.
+
+        Any previously collected data is discarded.
+    */
+    static void Start();
+
+    /**
+        Stop collecting the painting statistics.
+
+        The data collected so far is kept and can still be retrieved.
+    */
+    static void Stop();
+
+    /**
+        Return @true if the profiler is currently running.
+    */
+    static bool IsRunning();
+
+    /**
+        Discard all the data collected so far.
+
+        This doesn't stop the profiler if it's running.
+    */
+    static void Reset();
+
+    /**
+        Return the statistics of all windows painted so far.
+
+        The statistics of the windows which had been already destroyed are
+        returned too, but their WindowStats::window field is @NULL.
+
+        The returned vector is sorted in the order of decreasing total time
+        taken by painting.
+    */
+    static std::vector<WindowStats> GetWindowStats();
+
+    /**
+        Get the statistics of the given window.
+
+        @param win
+            The window to get the statistics of.
+        @param stats
+            Non-null pointer filled with the statistics if the function
+            returns @true.
+        @return
+            @true if the window was painted since the profiler was started or
+            @false otherwise.
+    */
+    static bool GetWindowStats(const wxWindow* win, WindowStats* stats);
+
+    /**
+        Show or hide the overlay with the painting information.
+
+        When the overlay is shown, the outline of the update region of the
+        last repaint and the time taken by it and the number of the drawing
+        operations performed are drawn on top of each window after it is
+        repainted. The outline is green if painting took less than 4ms,
+        orange if it took less than 16ms and red otherwise.
+
+        The overlay is drawn using wxOverlay and so may be not shown for the
+        windows which don't support it.
+
+        Note that the overlay is only updated while the profiler is running.
+    */
+    static void ShowOverlay(bool show = true);
+
+    /**
+        Return @true if the overlay is currently shown.
+    */
+    static bool IsShowingOverlay();
+};
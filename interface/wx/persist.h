@@ -127,6 +127,14 @@ public:
 
         This method does nothing if DisableSaving() had been called.
 
+        Only the values which differ from the ones known to be stored in the
+        persistent storage are written to it. The values are known if they
+        were read from it by Restore() or RestoreValue(), or written to it by
+        this method or SaveValue() before, since the object was registered.
+        Notice that this means that the values changed directly in wxConfig,
+        without using this class, while the object is registered may not be
+        overwritten by this method.
+
         @param obj
             An object previously registered with Register().
 
@@ -145,10 +153,40 @@ public:
             @true if the object properties were restored or @false if nothing
             was found to restore or the saved settings were invalid.
 
+        This method calls LoadValues() before restoring the object
+        properties.
+
         @see RegisterAndRestore()
      */
     bool Restore(void *obj);
 
+    /**
+        Read all the saved properties of the object at once.
+
+        This function reads all the values stored in the group used for the
+        object settings in the persistent storage at once, so that the
+        subsequent calls to RestoreValue() for this object don't access the
+        storage any more. This is much more efficient than reading the values
+        one by one for the objects with many settings, such as
+        wxPersistentDataViewCtrl saving the state of all its columns.
+
+        It is called by Restore() automatically, so there is usually no need
+        to call it directly, unless the properties of the object are restored
+        in some other way. Calling it more than once for the same object does
+        nothing.
+
+        @param obj
+            An object previously registered with Register().
+        @return
+            @true if the values were read or @false if there is no persistent
+            storage or if the settings of this object are not stored in a
+            single group because GetKey() was overridden to use a different
+            layout.
+
+        @since 3.3.0
+     */
+    bool LoadValues(void *obj);
+
     /// Combines both Save() and Unregister() calls.
     void SaveAndUnregister(void *obj);
 
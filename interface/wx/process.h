@@ -34,6 +34,10 @@
     @event{EVT_END_PROCESS(id, func)}
         Process a @c wxEVT_END_PROCESS event, sent by wxProcess::OnTerminate upon
         the external process termination.
+    @event{EVT_PROCESS_OUTPUT(id, func)}
+        Process a @c wxEVT_PROCESS_OUTPUT event, sent by wxProcess::OnOutput
+        when output of the process using EnableOutputEvents() becomes
+        available. This event is new since wxWidgets 3.3.0.
     @endEventTable
 
     @library{wxbase}
@@ -221,6 +225,30 @@ public:
     */
     virtual void OnTerminate(int pid, int status);
 
+    /**
+        Called when output of the process using output events becomes
+        available.
+
+        Default implementation of this function generates
+        wxEVT_PROCESS_OUTPUT event, but it can be overridden to handle the
+        output directly.
+
+        Notice that all the output is passed to this function before
+        OnTerminate() is called.
+
+        @param data
+            The output data. The buffer is reference-counted, so it can be
+            retained without copying the data.
+        @param isError
+            @true if this data was written by the process to its standard
+            error and @false if it was written to its standard output.
+
+        @see EnableOutputEvents()
+
+        @since 3.3.0
+    */
+    virtual void OnOutput(const wxMemoryBuffer& data, bool isError);
+
     /**
         This static method replaces the standard @c popen() function: it launches
         the process specified by the @a cmd parameter and returns the wxProcess
@@ -257,6 +285,72 @@ public:
     */
     void Redirect();
 
+    /**
+        Turns on redirection with output delivered by events.
+
+        This function is similar to Redirect() but, when the process is
+        launched asynchronously, its standard output and error output are not
+        available via GetInputStream() and GetErrorStream() (which return
+        @NULL) but instead are read by wxWidgets as soon as any data appears
+        in them and passed to OnOutput(), which generates wxEVT_PROCESS_OUTPUT
+        events by default. This is much more efficient than polling
+        IsInputAvailable() for the processes producing a lot of output.
+
+        The output is read in chunks of at most the given size directly into
+        the buffer passed to OnOutput(), without any intermediate copies.
+
+        Notice that the output is processed synchronously, i.e. no more output
+        is read until OnOutput() returns, and SuspendOutput() can be used to
+        stop reading it for longer than that. In both cases, the child process
+        blocks when it writes more output than fits into the pipe buffer,
+        ensuring that its output doesn't accumulate in memory of this
+        process.
+
+        Output events are currently only implemented under Unix systems, the
+        standard output and error output streams are used as with Redirect()
+        under the other platforms and when wxEXEC_SYNC is used.
+
+        @param chunkSize The maximal size of the data passed to OnOutput().
+
+        @since 3.3.0
+    */
+    void EnableOutputEvents(size_t chunkSize = 64*1024);
+
+    /**
+        Returns @true if EnableOutputEvents() had been called.
+
+        @since 3.3.0
+    */
+    bool IsOutputEventsEnabled() const;
+
+    /**
+        Returns the chunk size specified in EnableOutputEvents() or 0.
+
+        @since 3.3.0
+    */
+    size_t GetOutputChunkSize() const;
+
+    /**
+        Stops reading the process output.
+
+        This function can only be called if EnableOutputEvents() is used. It
+        can be called to avoid receiving more output until ResumeOutput() is
+        called, e.g. because the previous output is still being processed.
+
+        Notice that the process will block when it fills its output pipe
+        buffer until the output is resumed.
+
+        @since 3.3.0
+    */
+    void SuspendOutput();
+
+    /**
+        Resumes reading the process output after SuspendOutput().
+
+        @since 3.3.0
+    */
+    void ResumeOutput();
+
     /**
         Sets the priority of the process, between 0 (lowest) and 100 (highest).
         It can only be set before the process is created.
@@ -316,3 +410,56 @@ public:
 
 wxEventType wxEVT_END_PROCESS;
 
+/**
+    @class wxProcessOutputEvent
+
+    This event is sent by wxProcess using output events when the output of
+    the child process becomes available.
+
+    @beginEventTable{wxProcessOutputEvent}
+    @event{EVT_PROCESS_OUTPUT(id, func)}
+        Process a @c wxEVT_PROCESS_OUTPUT event. @a id is the identifier of
+        the process object (the id passed to the wxProcess constructor) or a
+        window to receive the event.
+    @endEventTable
+
+    @library{wxbase}
+    @category{events}
+
+    @see wxProcess::EnableOutputEvents(), @ref overview_events
+
+    @since 3.3.0
+*/
+class wxProcessOutputEvent : public wxEvent
+{
+public:
+    /**
+        Constructor.
+    */
+    wxProcessOutputEvent(int id = 0,
+                         int pid = 0,
+                         const wxMemoryBuffer& data = wxMemoryBuffer(),
+                         bool isError = false);
+
+    /**
+        Returns the process id.
+    */
+    int GetPid() const;
+
+    /**
+        Returns the output data.
+
+        The returned buffer shares its data with the event, so it can be
+        copied without copying the data itself.
+    */
+    const wxMemoryBuffer& GetData() const;
+
+    /**
+        Returns @true if this output comes from the process standard error
+        and @false if it comes from its standard output.
+    */
+    bool IsError() const;
+};
+
+wxEventType wxEVT_PROCESS_OUTPUT;
+
@@ -1669,6 +1669,16 @@ public:
     */
     bool HasVisibleChildren() const;
 
+    /**
+        Returns @true if this is a category whose children will be created
+        only when they are needed.
+
+        @see wxPropertyCategory::SetLazyChildren()
+
+        @since 3.3.0
+    */
+    bool HasLazyChildren() const;
+
     /**
         Hides or reveals the property.
 
@@ -2946,4 +2956,42 @@ public:
 
     virtual wxString ValueToString(wxVariant& value, wxPGPropValFormatFlags flags) const;
     virtual wxString GetValueAsString(wxPGPropValFormatFlags flags = wxPGPropValFormatFlags::Null) const;
+
+    /**
+        Sets the function creating the children of this category.
+
+        This allows using categories with a huge number of children without
+        creating all of them up front: the function is called only once, when
+        the category is expanded for the first time or when a property which
+        is not found otherwise is looked up by name, e.g. using
+        wxPropertyGridInterface::GetPropertyByName(). It should create the
+        children by calling AppendChild() on the category passed to it.
+
+        The category is collapsed by this function, as its children don't
+        exist yet.
+
+        @code
+            wxPropertyCategory* cat = new wxPropertyCategory("Items");
+            cat->SetLazyChildren([](wxPGProperty* category)
+                {
+                    for ( int n = 0; n < 10000; n++ )
+                    {
+                        category->AppendChild(
+                            new wxIntProperty(wxString::Format("Item %d", n)));
+                    }
+                });
+            pg->Append(cat);
+        @endcode
+
+        @since 3.3.0
+    */
+    void SetLazyChildren(const wxPGLazyChildrenFunction& func);
+
+    /**
+        Creates the children using the function passed to SetLazyChildren()
+        if this hasn't been done yet.
+
+        @since 3.3.0
+    */
+    void CreateLazyChildren();
 };
@@ -450,6 +450,15 @@ typedef int (*wxPGSortCallback)(wxPropertyGrid* propGrid,
                                 wxPGProperty* p1,
                                 wxPGProperty* p2);
 
+/** This function is used for creating the children of a category only when
+    they are needed.
+
+    Call wxPropertyCategory::SetLazyChildren() to set it.
+
+    @since 3.3.0
+*/
+typedef std::function<void(wxPGProperty* category)> wxPGLazyChildrenFunction;
+
 // -----------------------------------------------------------------------
 
 /**
@@ -555,6 +564,37 @@ public:
     */
     static void AutoGetTranslation( bool enable );
 
+    /**
+        Starts a batch of changes during which the properties are not
+        redrawn individually.
+
+        This is useful when changing the values of many properties at once,
+        e.g. when calling SetPropertyValue() for hundreds of them: normally
+        each changed property is redrawn immediately, while inside a
+        BeginUpdate() and EndUpdate() pair only the area covered by the changed
+        properties is remembered and it is redrawn only once, by EndUpdate().
+        Updating the editor control of the selected property is deferred in
+        the same way.
+
+        Unlike Freeze(), this doesn't redraw the entire control at the end.
+
+        The calls to this function may be nested, and each of them must be
+        matched by a call to EndUpdate().
+
+        @since 3.3.0
+    */
+    void BeginUpdate();
+
+    /**
+        Ends the batch of changes started by BeginUpdate().
+
+        When the outermost batch ends, the rows of all properties changed
+        since BeginUpdate() call are redrawn.
+
+        @since 3.3.0
+    */
+    void EndUpdate();
+
     /**
         Creates label editor wxTextCtrl for given column, for property
         that is currently selected. When multiple selection is
@@ -887,6 +927,13 @@ public:
     */
     bool IsFrozen() const;
 
+    /**
+        Returns @true if BeginUpdate() was called but not EndUpdate() yet.
+
+        @since 3.3.0
+    */
+    bool IsUpdating() const;
+
     /**
         Makes given column editable by user.
 
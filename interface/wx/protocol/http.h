@@ -76,15 +76,84 @@ public:
         @return Returns the initialized stream. You must delete it yourself
                  once you don't use it anymore and this must be done before
                  the wxHTTP object itself is destroyed. The destructor
-                 closes the network connection. The next time you will
-                 try to get a file the network connection will have to
-                 be reestablished, but you don't have to take care of
-                 this since wxHTTP reestablishes it automatically.
+                 closes the network connection, unless SetKeepAlive() was
+                 called and the entire response was read, in which case the
+                 connection is reused for the next request. Otherwise the
+                 next time you will try to get a file the network connection
+                 will have to be reestablished, but you don't have to take
+                 care of this since wxHTTP reestablishes it automatically.
 
         @see wxInputStream
     */
     virtual wxInputStream* GetInputStream(const wxString& path);
 
+    /**
+        Enables or disables the use of persistent connections.
+
+        When enabled, HTTP/1.1 requests are sent and the connection is kept
+        open after reading the response, if the server allows it, and reused
+        by the subsequent calls to GetInputStream() and SendRequest(). If the
+        server closed the reused connection in the meanwhile, the request is
+        sent again using a new connection.
+
+        Persistent connections are disabled by default.
+
+        @since 3.3.0
+    */
+    void SetKeepAlive(bool keepAlive = true);
+
+    /**
+        Returns @true if persistent connections are enabled.
+
+        @see SetKeepAlive()
+
+        @since 3.3.0
+    */
+    bool GetKeepAlive() const;
+
+    /**
+        Sends a request for the given path without waiting for the response.
+
+        This function allows to pipeline several requests, i.e. send all of
+        them at once and then read the responses to them, in the same order,
+        using ReadResponse(). This requires persistent connections to be
+        enabled using SetKeepAlive() first, otherwise only a single request
+        can be sent before reading the response to it.
+
+        The request uses the current method, headers and post data, which can
+        be changed before sending the next request.
+
+        @return @true if the request was sent or @false on error, use
+            GetError() to get more information about it.
+
+        @since 3.3.0
+    */
+    bool SendRequest(const wxString& path);
+
+    /**
+        Reads the response to the oldest request sent by SendRequest().
+
+        Any unread data of the previously returned stream is skipped, so that
+        this stream shouldn't be used any longer after calling this function.
+
+        @return The stream for reading the body of the response, which must be
+            deleted by the caller, or @NULL on error, e.g. if the server
+            returned an error response. In the latter case, GetResponse()
+            returns the response code and the responses to the other pending
+            requests can still be read.
+
+        @since 3.3.0
+    */
+    wxInputStream* ReadResponse();
+
+    /**
+        Returns the number of requests sent by SendRequest() whose responses
+        haven't been read by ReadResponse() yet.
+
+        @since 3.3.0
+    */
+    size_t GetPendingRequestsCount() const;
+
     /**
         Returns the HTTP response code returned by the server.
 
@@ -114,6 +183,9 @@ public:
 
         The field name is specified by @a header and the content by @a h_data.
         This is a low level function and it assumes that you know what you are doing.
+
+        The headers set by this function are sent with all the subsequent
+        requests, until they are changed.
     */
     void SetHeader(const wxString& header, const wxString& h_data);
 
@@ -5,6 +5,45 @@
 // Licence:     wxWindows licence
 /////////////////////////////////////////////////////////////////////////////
 
+/**
+    Flags used by wxQuantize functions.
+
+    wxQUANTIZE_NO_DITHER and wxQUANTIZE_MULTITHREADED are only available
+    since wxWidgets 3.3.0.
+*/
+enum
+{
+    /// Reserve the first 20 palette entries for the Windows system colours.
+    wxQUANTIZE_INCLUDE_WINDOWS_COLOURS = 0x01,
+
+    /// Return the palette indices of the pixels in the provided pointer.
+    wxQUANTIZE_RETURN_8BIT_DATA = 0x02,
+
+    /// Fill the destination image with the quantized colours.
+    wxQUANTIZE_FILL_DESTINATION_IMAGE = 0x04,
+
+    /**
+        Map each pixel to the nearest palette colour without using
+        Floyd-Steinberg dithering.
+
+        This is several times faster than the default dithering, but results
+        in visible banding in the areas of gradual colour change. The pixels
+        are mapped using multiple threads if wxQUANTIZE_MULTITHREADED is
+        specified too.
+     */
+    wxQUANTIZE_NO_DITHER = 0x08,
+
+    /**
+        Use multiple threads for mapping the pixels to the palette colours.
+
+        The number of threads is determined by wxImage::SetDefaultThreadCount().
+        When dithering is used, the image is dithered in independent bands of
+        rows, which makes the result slightly different from the one obtained
+        without this flag, but it doesn't depend on the number of threads.
+     */
+    wxQUANTIZE_MULTITHREADED = 0x10
+};
+
 /**
     @class wxQuantize
 
@@ -31,10 +70,14 @@ public:
         (@a in_rows contains @a w * 3 bytes per row, @a out_rows @a w bytes per row).
         Fills @a out_rows with indexes into palette (which is also stored into @a palette
         variable).
+
+        The @a flags parameter can contain ::wxQUANTIZE_NO_DITHER and
+        ::wxQUANTIZE_MULTITHREADED, it is only available since wxWidgets 3.3.0.
     */
     static void DoQuantize(unsigned int w, unsigned int h,
                            unsigned char** in_rows, unsigned char** out_rows,
-                           unsigned char* palette, int desiredNoColours);
+                           unsigned char* palette, int desiredNoColours,
+                           int flags = 0);
 
     /**
         Reduce the colours in the source image and put the result into the destination image.
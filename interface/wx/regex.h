@@ -54,6 +54,18 @@ enum
     */
     wxRE_NEWLINE  = 16,
 
+    /**
+        Use just-in-time compilation of the regular expression to machine code.
+
+        This makes compiling the regular expression significantly slower, but
+        matching it faster, so it is worth using for the expressions which are
+        matched against many strings or long texts. If JIT compilation is not
+        supported by the PCRE library used, this flag is silently ignored.
+
+        @since 3.3.0
+    */
+    wxRE_JIT      = 256,
+
     /** Default flags.*/
     wxRE_DEFAULT  = wxRE_EXTENDED
 };
@@ -289,7 +301,9 @@ public:
         a wxStrlen() will be done internally if the regex library requires the
         length. When using Matches() in a loop the <b>Matches(text, flags, len)</b>
         form can be used instead, making it possible to avoid a wxStrlen() inside
-        the loop.
+        the loop. Since wxWidgets 3.3.0, this form also doesn't copy the text,
+        so it can be used to match a part of a bigger buffer without
+        allocating any memory, unless wxUSE_UNICODE_UTF8 is used.
 
         May only be called after successful call to Compile().
     */
@@ -338,6 +352,102 @@ public:
     */
     int ReplaceFirst(wxString* text, const wxString& replacement) const;
 
+    /**
+        Type of the function called by ForEachMatch() for every match.
+
+        The function is passed the start and the length of the match and may
+        call GetMatch() to retrieve the subexpressions matches. It must return
+        @true to continue iterating or @false to stop.
+
+        @since 3.3.0
+    */
+    using MatchFunction = std::function<bool (size_t start, size_t len)>;
+
+    /**
+        Calls the given function for all matches in the text.
+
+        This function finds all non-overlapping matches in the text, in the
+        same way as Replace() does, but without creating any new strings, so
+        it is much more efficient for processing big texts when only the
+        positions of the matches are needed.
+
+        Note that, unlike with calling Matches() in a loop on the remaining
+        part of the text, the offsets passed to @a func are always relative to
+        the start of the text and the assertions such as @c ^ or @c \b take
+        the text before the current position into account.
+
+        @param text
+            The text to search in.
+        @param func
+            The function called for each match, see MatchFunction.
+        @param flags
+            Combination of ::wxRE_NOTBOL and ::wxRE_NOTEOL, see Matches().
+        @param maxMatches
+            If non-zero, the maximal number of matches to find.
+        @return
+            The number of matches found.
+
+        @since 3.3.0
+    */
+    size_t ForEachMatch(const wxString& text,
+                        const MatchFunction& func,
+                        int flags = 0,
+                        size_t maxMatches = 0) const;
+
+    /**
+        Calls the given function for all matches in the buffer.
+
+        This overload takes the text and its length explicitly and, in the
+        default wide character build, avoids copying it.
+
+        @since 3.3.0
+    */
+    size_t ForEachMatch(const wxChar* text, size_t len,
+                        const MatchFunction& func,
+                        int flags = 0,
+                        size_t maxMatches = 0) const;
+
+    /**
+        Replaces the matches in the text and writes the result to a stream.
+
+        This function works like Replace() but, instead of modifying the text,
+        writes it, with all the replacements done, to the given stream in
+        UTF-8 encoding. This allows processing texts of arbitrary size without
+        allocating memory for the result.
+
+        @param text
+            The text in which to replace the matches.
+        @param len
+            The length of the text.
+        @param replacement
+            The replacement text, using the same syntax as with Replace().
+        @param out
+            The stream to write the result to.
+        @param maxMatches
+            If non-zero, the maximal number of replacements to make.
+        @return
+            The number of replacements made or -1 if an error occurred, e.g.
+            if writing to the stream failed.
+
+        @since 3.3.0
+    */
+    int ReplaceToStream(const wxChar* text, size_t len,
+                        const wxString& replacement,
+                        wxOutputStream& out,
+                        size_t maxMatches = 0) const;
+
+    /**
+        Replaces the matches in the text and writes the result to a stream.
+
+        This is the same as the overload above but takes a wxString.
+
+        @since 3.3.0
+    */
+    int ReplaceToStream(const wxString& text,
+                        const wxString& replacement,
+                        wxOutputStream& out,
+                        size_t maxMatches = 0) const;
+
     /**
         Escapes any of the characters having special meaning for wxRegEx.
 
@@ -0,0 +1,138 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        wx/resourcestats.h
+// Purpose:     interface of wxResourceStats
+// Author:      wxWidgets team
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+    @class wxResourceStats
+
+    Provides the counts of the live GDI objects and windows.
+
+    This class can be used to find resource leaks, e.g. bitmaps or fonts which
+    are never destroyed, and to estimate the memory used by caches of GDI
+    objects. When tracking is enabled, which is not the case by default, all
+    the objects deriving from wxGDIObject, such as wxBitmap, wxFont, wxPen,
+    wxBrush or wxRegion, and all the windows created are tracked and the
+    statistics about them can be retrieved, for each class, using
+    GetGDIStats() and GetWindowStats(), e.g.
+    @code
+    bool MyApp::OnInit()
+    {
+        wxResourceStats::Enable();
+
+        ...
+    }
+
+    void MyFrame::OnShowResources(wxCommandEvent&)
+    {
+        for ( const auto& s : wxResourceStats::GetGDIStats() )
+        {
+            wxLogMessage("%s: %zu objects, %zu resources, %zu bytes",
+                         s.className, s.objects, s.resources, s.bytes);
+        }
+    }
+    @endcode
+
+    Only the objects created after enabling tracking are taken into account,
+    so it should be enabled as early as possible. When tracking is enabled,
+    creating and destroying GDI objects and windows is slightly slower, as
+    they need to be registered in a global table, but when it's disabled, the
+    overhead is limited to checking whether it is enabled.
+
+    Note that the objects are grouped by their exact class, so e.g. wxIcon
+    objects are counted separately from wxBitmap ones, and that the
+    statistics may be retrieved from any thread.
+
+    @library{wxcore}
+    @category{gdi}
+
+    @see wxPaintProfiler
+
+    @since 3.3.0
+*/
+class wxResourceStats
+{
+public:
+    /**
+        Statistics of the objects of a single class.
+    */
+    struct Stats
+    {
+        /// The name of the class of the objects, e.g. "wxBitmap".
+        wxString className;
+
+        /// Number of the live objects of this class.
+        size_t objects;
+
+        /**
+            Number of the native resources used by the objects.
+
+            For GDI objects, this is the number of distinct valid objects,
+            i.e. the copies of the same object, which share the same native
+            resource, are only counted once and the invalid objects are not
+            counted at all. For windows, this is the number of windows having
+            a native handle, see wxWindow::GetHandle().
+         */
+        size_t resources;
+
+        /**
+            Estimated memory used by the native resources, in bytes.
+
+            This is computed from the size and depth for the bitmaps (and, on
+            the platforms where they don't derive from wxBitmap, icons and
+            cursors) and from the number of rectangles for the regions. For
+            all the other objects, including windows, this is always 0.
+         */
+        size_t bytes;
+    };
+
+    /**
+        Enable or disable tracking the objects.
+
+        Disabling tracking discards the information about all the currently
+        tracked objects, i.e. if it is enabled again later, only the objects
+        created after this are taken into account.
+
+        Tracking is disabled automatically when the library is shut down.
+    */
+    static void Enable(bool enable = true);
+
+    /**
+        Return @true if tracking is currently enabled.
+    */
+    static bool IsEnabled();
+
+    /**
+        Return the statistics for the GDI objects of each class.
+
+        The returned vector is sorted in the order of decreasing estimated
+        memory use and then the number of objects.
+    */
+    static std::vector<Stats> GetGDIStats();
+
+    /**
+        Return the statistics for the windows of each class.
+
+        The returned vector is sorted in the order of decreasing number of
+        windows.
+    */
+    static std::vector<Stats> GetWindowStats();
+
+    /**
+        Get the statistics for the GDI objects or windows of the given class.
+
+        @param className
+            The name of the class, e.g. "wxBitmap" or "wxButton". Only the
+            objects of exactly this class are considered, i.e. the objects of
+            the classes deriving from it are not.
+        @param stats
+            Non-null pointer filled with the statistics if the function
+            returns @true.
+        @return
+            @true if there are any live objects of this class or @false
+            otherwise.
+    */
+    static bool GetStats(const wxString& className, Stats* stats);
+};
@@ -153,6 +153,53 @@ public:
     */
     wxRibbonGalleryItem* Append(const wxBitmap& bitmap, int id, wxClientData* clientData);
 
+    /**
+        Switch the gallery to virtual mode with the given number of items.
+
+        In virtual mode, the gallery doesn't store the item bitmaps but
+        requests them from OnGetItemBitmap() when they are about to be shown,
+        keeping only the bitmaps of the items close to the visible ones in
+        memory. This allows using galleries with a very large number of items.
+
+        Any existing items are removed by this function and Append() can't be
+        used with a virtual gallery. The items are still available using
+        GetItem() and their IDs are equal to their indices.
+
+        @param count
+            The number of items in the gallery.
+        @param bitmapSize
+            The logical size of all item bitmaps.
+
+        @since 3.3.0
+    */
+    void SetVirtualItemCount(unsigned int count, const wxSize& bitmapSize);
+
+    /**
+        Return @true if the gallery is in virtual mode.
+
+        @see SetVirtualItemCount()
+
+        @since 3.3.0
+    */
+    bool IsVirtual() const;
+
+    /**
+        Discard the cached bitmaps of a virtual gallery.
+
+        Call this function if the bitmaps returned by OnGetItemBitmap() have
+        changed to make the gallery request them again.
+
+        @since 3.3.0
+    */
+    void RefreshItemBitmaps();
+
+    /**
+        Return the index of the given item or -1 if it's not found.
+
+        @since 3.3.0
+    */
+    int GetItemIndex(const wxRibbonGalleryItem* item) const;
+
     /**
         Set the client object associated with a gallery item.
     */
@@ -255,6 +302,18 @@ public:
         Scroll the gallery to ensure that the given item is visible.
     */
     void EnsureVisible(const wxRibbonGalleryItem* item);
+
+protected:
+    /**
+        Return the bitmap for the given item of a virtual gallery.
+
+        This function must be overridden in the derived class if
+        SetVirtualItemCount() is used. The returned bitmap must have the size
+        specified when calling it.
+
+        @since 3.3.0
+    */
+    virtual wxBitmap OnGetItemBitmap(unsigned int n) const;
 };
 
 /**
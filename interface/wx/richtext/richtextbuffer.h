@@ -2330,11 +2330,128 @@ public:
 
     bool GetDelayedImageLoading() const { return m_enableDelayedImageLoading; }
 
+    /**
+        Enables or disables incremental layout.
+
+        When incremental layout is enabled, laying out the top-level container
+        stops once a paragraph starting below @a bottom has been laid out (if
+        @a bottom is not -1) or once @a maxMillis milliseconds have elapsed
+        (if @a maxMillis is not 0). Positioning the remaining paragraphs is
+        deferred until the next layout, see
+        wxRichTextParagraphLayoutBox::HasDeferredLayout().
+
+        @since 3.3.0
+    */
+
+    void EnableIncrementalLayout(bool b, int bottom = -1, int maxMillis = 0)
+    { m_incrementalLayout = b; m_incrementalLayoutBottom = bottom; m_incrementalLayoutMaxMillis = maxMillis; }
+
+    /**
+        Returns @true if incremental layout is enabled.
+    */
+
+    bool GetIncrementalLayout() const { return m_incrementalLayout; }
+
+    /**
+        Returns the bottom of the area which must be laid out during incremental
+        layout, or -1 if there is no such limit.
+    */
+
+    int GetIncrementalLayoutBottom() const { return m_incrementalLayoutBottom; }
+
+    /**
+        Returns the maximal duration of incremental layout in milliseconds, or 0
+        if there is no such limit.
+    */
+
+    int GetIncrementalLayoutMaxMillis() const { return m_incrementalLayoutMaxMillis; }
+
     wxRichTextBuffer*   m_buffer;
     bool                m_enableVirtualAttributes;
     bool                m_enableImages;
     bool                m_enableDelayedImageLoading;
     bool                m_layingOut;
+    bool                m_incrementalLayout;
+    int                 m_incrementalLayoutBottom;
+    int                 m_incrementalLayoutMaxMillis;
+};
+
+/**
+    @class wxRichTextSharedAttr
+
+    Holds the attributes of a rich text object, sharing them with all the
+    other objects having the same attributes.
+
+    Documents typically contain many objects but only a few distinct styles,
+    so the attributes are kept in a global table and each object only refers
+    to an entry in it. The attributes are copied on write: getting a
+    non-const reference to them with GetWritable() makes them unique to this
+    object until Share() is called.
+
+    @library{wxrichtext}
+    @category{richtext}
+
+    @since 3.3.0
+
+    @see wxRichTextObject::GetAttributes()
+*/
+
+class wxRichTextSharedAttr
+{
+public:
+    /**
+        Default constructor, uses the default, empty, attributes.
+    */
+    wxRichTextSharedAttr();
+
+    /**
+        Constructor sharing the attributes equal to the given ones.
+    */
+    wxRichTextSharedAttr(const wxRichTextAttr& attr);
+
+    /**
+        Copy constructor.
+    */
+    wxRichTextSharedAttr(const wxRichTextSharedAttr& other);
+
+    /**
+        Assignment operators.
+    */
+    wxRichTextSharedAttr& operator=(const wxRichTextSharedAttr& other);
+    wxRichTextSharedAttr& operator=(const wxRichTextAttr& attr);
+
+    ~wxRichTextSharedAttr();
+
+    /**
+        Returns the attributes, which may be shared with other objects.
+    */
+    const wxRichTextAttr& Get() const;
+
+    /**
+        Returns the attributes which can be modified, copying them first if
+        they're currently shared.
+
+        The returned reference remains valid until this object is changed or
+        Share() is called.
+    */
+    wxRichTextAttr& GetWritable();
+
+    /**
+        Shares the attributes made unique to this object by GetWritable() with
+        the other objects using the same attributes again.
+    */
+    void Share();
+
+    /**
+        Returns @true if the attributes are shared, i.e.\ not modifiable.
+    */
+    bool IsShared() const;
+
+    /**
+        Returns the number of distinct attributes currently shared by all
+        objects.
+    */
+    static size_t GetSharedCount();
 };
 
 /**
@@ -2759,9 +2876,34 @@ public:
 
     /**
         Returns the object's attributes.
+
+        The attributes are copied when calling this function if they are
+        shared with other objects, so prefer using GetSharedAttributes() if
+        they don't need to be modified. The returned reference remains valid
+        until the next change to the buffer.
     */
     wxRichTextAttr& GetAttributes();
 
+    /**
+        Returns the object's attributes without copying them, even when
+        called for a non-const object.
+
+        @since 3.3.0
+    */
+    const wxRichTextAttr& GetSharedAttributes() const;
+
+    /**
+        Shares the attributes of this object, and its children for composite
+        objects, with the other objects using the same attributes again after
+        modifying them.
+
+        This is done automatically after executing the commands and loading
+        files.
+
+        @since 3.3.0
+    */
+    virtual void ShareAttributes();
+
     /**
         Returns the object's properties.
     */
@@ -2974,6 +3116,8 @@ public:
 
     virtual void Invalidate(const wxRichTextRange& invalidRange = wxRICHTEXT_ALL);
 
+    virtual void ShareAttributes();
+
 // Accessors
 
     /**
@@ -3630,6 +3774,20 @@ public:
     */
     bool IsDirty() const { return m_invalidRange != wxRICHTEXT_NONE; }
 
+    /**
+        Returns @true if positioning some paragraphs was deferred by an
+        incremental layout and will be done by the next call to Layout().
+
+        @see wxRichTextDrawingContext::EnableIncrementalLayout()
+    */
+    bool HasDeferredLayout() const { return m_deferredLayoutStart != -1; }
+
+    /**
+        Returns the start of the first paragraph whose position may be out of
+        date because its layout was deferred, or -1 if there is none.
+    */
+    long GetDeferredLayoutStart() const { return m_deferredLayoutStart; }
+
     /**
         Returns the wxRichTextFloatCollector of this object.
     */
@@ -3652,6 +3810,11 @@ protected:
     // The invalidated range that will need full layout
     wxRichTextRange m_invalidRange;
 
+    // The start of the paragraphs whose layout was deferred by incremental
+    // layout and whether they need to be laid out again or only moved.
+    long            m_deferredLayoutStart;
+    bool            m_deferredRelayout;
+
     // Is the last paragraph partial or complete?
     bool            m_partialParagraph;
 
@@ -4535,7 +4698,7 @@ public:
 
     virtual bool DeleteRange(const wxRichTextRange& range);
 
-    virtual bool IsEmpty() const { return m_text.empty(); }
+    virtual bool IsEmpty() const;
 
     virtual bool CanMerge(wxRichTextObject* object, wxRichTextDrawingContext& context) const;
 
@@ -4571,13 +4734,26 @@ public:
 
     /**
         Returns the text.
+
+        The text is stored as a sequence of pieces of immutable strings which
+        may be shared with other objects, so that splitting, merging and
+        copying the objects doesn't copy the text itself. This function joins
+        the pieces together if necessary, prefer using GetTextLength() or
+        GetTextForRange() if the whole text is not needed.
     */
-    const wxString& GetText() const { return m_text; }
+    const wxString& GetText() const;
+
+    /**
+        Returns the length of the text.
+
+        @since 3.3.0
+    */
+    size_t GetTextLength() const;
 
     /**
         Sets the text.
     */
-    void SetText(const wxString& text) { m_text = text; }
+    void SetText(const wxString& text);
 
 // Operations
 
@@ -4589,9 +4765,6 @@ public:
 
 private:
     bool DrawTabbedString(wxDC& dc, const wxRichTextAttr& attr, const wxRect& rect, wxString& str, wxCoord& x, wxCoord& y, bool selected);
-
-protected:
-    wxString    m_text;
 };
 
 /**
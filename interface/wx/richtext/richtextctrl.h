@@ -54,6 +54,8 @@
 #define wxRICHTEXT_DEFAULT_DELAYED_LAYOUT_THRESHOLD 20000
 // Milliseconds before layout occurs after resize
 #define wxRICHTEXT_DEFAULT_LAYOUT_INTERVAL 50
+// Milliseconds of deferred layout done at once in idle time
+#define wxRICHTEXT_DEFAULT_LAYOUT_TIME_SLICE 20
 // Milliseconds before delayed image processing occurs
 #define wxRICHTEXT_DEFAULT_DELAYED_IMAGE_PROCESSING_INTERVAL 200
 
@@ -351,8 +353,9 @@ public:
     */
     void SetFullLayoutSavedPosition(long p);
 
-    // Force any pending layout due to large buffer
     /**
+        Forces any pending layout due to delayed, partial layout when the control
+        was resized or edited.
     */
     void ForceDelayedLayout();
 
@@ -546,6 +549,37 @@ public:
     */
     virtual bool DoLoadFile(const wxString& file, int fileType);
 
+    /**
+        Loads content into the control's buffer in the background.
+
+        The file is parsed into a separate buffer, in a worker thread if
+        possible, and the current content of the control is replaced with it
+        once it's fully loaded, after which @c wxEVT_RICHTEXT_FILE_LOADED is
+        generated. The control remains usable while the file is being loaded
+        but any changes done to its content in the meanwhile are lost.
+
+        Only the handlers which can be created dynamically, such as
+        wxRichTextXMLHandler, are used in the worker thread, the file is
+        loaded synchronously, but the event is still generated later, when
+        using the other ones.
+
+        Calling LoadFile(), LoadFileAsync() or destroying the control cancels
+        any file which is still being loaded.
+
+        Returns @false if there is no handler able to load this file.
+
+        @since 3.3.0
+    */
+    bool LoadFileAsync(const wxString& file, int type = wxRICHTEXT_TYPE_ANY);
+
+    /**
+        Returns @true if a file started loading by LoadFileAsync() hasn't been
+        loaded yet.
+
+        @since 3.3.0
+    */
+    bool IsLoadingFile() const;
+
     /**
         Saves the buffer content using the given type.
 
@@ -1373,6 +1407,19 @@ public:
     */
     virtual bool LayoutContent(bool onlyVisibleRect = false);
 
+    /**
+        Lays out the buffer after it has been edited.
+
+        For buffers bigger than GetDelayedLayoutThreshold(), only the modified
+        paragraphs and the visible part of the buffer are laid out immediately,
+        while positioning the rest of the paragraphs is deferred and done in
+        idle time, which keeps editing large documents fast.
+        For smaller buffers this is the same as LayoutContent().
+
+        @since 3.3.0
+    */
+    bool LayoutContentIncrementally();
+
     /**
         Implements layout. An application may override this to perform operations before or after layout.
     */
@@ -2370,6 +2417,12 @@ protected:
         Process a @c wxEVT_RICHTEXT_BUFFER_RESET event, generated when the
         buffer has been reset by deleting all content.
         You can use this to set a default style for the first new paragraph.
+    @event{EVT_RICHTEXT_FILE_LOADED(id, func)}
+        Process a @c wxEVT_RICHTEXT_FILE_LOADED event, generated when loading
+        the file started by wxRichTextCtrl::LoadFileAsync() has finished.
+        Valid event functions: GetString, returning the file name, and GetInt,
+        returning non-zero if the file was loaded successfully.
+        This event is available since wxWidgets 3.3.0.
     @event{EVT_RICHTEXT_SELECTION_CHANGED(id, func)}
         Process a @c wxEVT_RICHTEXT_SELECTION_CHANGED event, generated when the
         selection range has changed.
@@ -2526,3 +2579,4 @@ wxEventType wxEVT_RICHTEXT_PROPERTIES_CHANGED;
 wxEventType wxEVT_RICHTEXT_SELECTION_CHANGED;
 wxEventType wxEVT_RICHTEXT_BUFFER_RESET;
 wxEventType wxEVT_RICHTEXT_FOCUS_OBJECT_CHANGED;
+wxEventType wxEVT_RICHTEXT_FILE_LOADED;
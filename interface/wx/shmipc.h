@@ -0,0 +1,191 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        wx/shmipc.h
+// Purpose:     interface of wxSharedMemoryServer and related classes
+// Author:      wxWidgets team
+// Created:     2026-10-15
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+    @class wxSharedMemoryConnection
+
+    A wxSharedMemoryConnection object represents the connection between a
+    client and a server using shared memory for transferring the data.
+
+    It provides the same API as wxTCPConnection and can be used in the same
+    way, please see its documentation for the description of the available
+    functions and callbacks.
+
+    The data is transferred using a ring buffer in memory shared by both
+    processes, with each side waiting for the other one using process-shared
+    synchronization objects (which are implemented using futexes under
+    Linux), so that exchanging the data doesn't involve copying it to and
+    from the kernel, as with the sockets. The messages received by the
+    connection are dispatched to it in the main thread, using the event loop,
+    like the socket events in wxTCPConnection case, so the application must
+    be running the event loop for the callbacks to be called.
+
+    Note that both the client and the server need to use these classes, they
+    are not compatible with the TCP-based ones.
+
+    This class is only available under Unix systems, use
+    @c wxHAS_SHARED_MEMORY_IPC to check for its availability.
+
+    @library{wxbase}
+    @category{net}
+
+    @see wxSharedMemoryClient, wxSharedMemoryServer, @ref overview_ipc
+
+    @since 3.3.0
+*/
+class wxSharedMemoryConnection : public wxConnectionBase
+{
+public:
+    /**
+        Constructs a connection object.
+
+        If no user-defined connection object is to be derived from
+        wxSharedMemoryConnection, then the constructor should not be called
+        directly, since the default connection object will be provided on
+        requesting (or accepting) a connection. However, if the user defines
+        their own derived connection object, the
+        wxSharedMemoryServer::OnAcceptConnection() and/or
+        wxSharedMemoryClient::OnMakeConnection() members should be
+        replaced by functions which construct the new connection object.
+
+        If the arguments of the wxSharedMemoryConnection constructor are
+        void, then a default buffer is associated with the connection.
+        Otherwise, the programmer must provide a buffer and size of the buffer
+        for the connection object to use in transactions.
+    */
+    wxSharedMemoryConnection();
+    wxSharedMemoryConnection(void* buffer, size_t size);
+};
+
+
+/**
+    @class wxSharedMemoryServer
+
+    A wxSharedMemoryServer object represents the server part of a
+    client-server conversation using shared memory.
+
+    @library{wxbase}
+    @category{net}
+
+    @see wxSharedMemoryClient, wxSharedMemoryConnection, @ref overview_ipc
+
+    @since 3.3.0
+*/
+class wxSharedMemoryServer : public wxServerBase
+{
+public:
+    /**
+        Constructs a server object.
+    */
+    wxSharedMemoryServer();
+
+    /**
+        Registers the server using the given name, which can be an arbitrary
+        string used by the clients to connect to this server.
+
+        Only a single server with the given name can be running on the
+        computer at any moment.
+
+        @return @false if the server couldn't be created, e.g. because
+                another one with the same name is already running.
+    */
+    virtual bool Create(const wxString& serverName);
+
+    /**
+        When a client calls wxSharedMemoryClient::MakeConnection(), the server
+        receives the message and this member is called.
+
+        The application should derive a member to intercept this message and
+        return a connection object (derived from wxSharedMemoryConnection) or
+        @NULL to refuse the connection.
+
+        The default implementation returns a wxSharedMemoryConnection object.
+    */
+    virtual wxConnectionBase* OnAcceptConnection(const wxString& topic);
+};
+
+
+/**
+    @class wxSharedMemoryClient
+
+    A wxSharedMemoryClient object represents the client part of a
+    client-server conversation using shared memory.
+
+    @library{wxbase}
+    @category{net}
+
+    @see wxSharedMemoryServer, wxSharedMemoryConnection, @ref overview_ipc
+
+    @since 3.3.0
+*/
+class wxSharedMemoryClient : public wxClientBase
+{
+public:
+    /**
+        Constructs a client object.
+    */
+    wxSharedMemoryClient();
+
+    /**
+        Tries to make a connection with the server specified by the server
+        name and the topic.
+
+        Notice that this function waits until the server accepts or rejects
+        the connection, which happens when the server process dispatches the
+        events, so the server can't be running in the same thread as the
+        client.
+
+        @param host
+            Must be either empty or "localhost", as only the servers running
+            on the same computer can be connected to.
+        @param server
+            The name of the server, as passed to wxSharedMemoryServer::Create().
+        @param topic
+            The topic passed to wxSharedMemoryServer::OnAcceptConnection().
+
+        @return The new connection or @NULL if the server couldn't be found,
+                refused the connection or didn't answer in time.
+    */
+    virtual wxConnectionBase* MakeConnection(const wxString& host,
+                                             const wxString& server,
+                                             const wxString& topic);
+
+    /**
+        Called by MakeConnection(), by default this simply returns a new
+        wxSharedMemoryConnection object.
+
+        Override this method to return a wxSharedMemoryConnection descendant
+        customised for the application.
+    */
+    virtual wxConnectionBase* OnMakeConnection();
+
+    /**
+        Returns @true if the host is either empty or "localhost".
+    */
+    virtual bool ValidHost(const wxString& host);
+
+    /**
+        Sets the size of the buffer used for the data sent in each direction
+        by the connections created after calling this function.
+
+        Messages bigger than the buffer can still be exchanged, but they are
+        transferred in several parts, which is less efficient, so the buffer
+        should be big enough for the typical message size used.
+
+        The default buffer size is 1MiB.
+    */
+    void SetBufferSize(size_t size);
+
+    /**
+        Returns the buffer size used for the new connections.
+
+        @see SetBufferSize()
+    */
+    size_t GetBufferSize() const;
+};
@@ -461,6 +461,72 @@ public:
     */
     void SetContainingWindow(wxWindow *window);
 
+    /**
+        Returns the sizer this sizer is an item of or @NULL if none.
+
+        @since 3.3.0
+    */
+    wxSizer* GetContainingSizer() const;
+
+    /**
+        Enables or disables caching of the minimal sizes of all sizers.
+
+        By default, the minimal size of a sizer is recomputed, by calling
+        CalcMin(), every time it is needed, which means that laying out a
+        window recomputes the minimal sizes of all the nested sizers, possibly
+        several times. When caching is enabled, the minimal size of a sizer is
+        only recomputed if something inside it has changed since the last
+        time, e.g. the best size of one of its windows changed, an item was
+        added or removed, shown or hidden, or its flags were modified, and the
+        nested sizers whose size, position and contents didn't change are not
+        laid out again at all. This makes relaying out a big dialog after a
+        small change, such as changing the label of a single control, much
+        faster, as only the sizers containing the changed item are updated.
+
+        Notice that when caching is enabled, any windows whose best size
+        changes must call wxWindow::InvalidateBestSize() for the change to be
+        taken into account, as all the standard controls do. Similarly, custom
+        sizers must call InvalidateMinSize() when any of their parameters
+        affecting the layout change.
+
+        Caching is disabled by default.
+
+        @since 3.3.0
+    */
+    static void EnableMinSizeCache(bool enable = true);
+
+    /**
+        Returns @true if caching of the minimal sizes is enabled.
+
+        @see EnableMinSizeCache()
+
+        @since 3.3.0
+    */
+    static bool IsMinSizeCacheEnabled();
+
+    /**
+        Invalidates the cached minimal size of this sizer and all the sizers
+        containing it.
+
+        This is done automatically by wxWidgets when the sizer items change and
+        only needs to be called by the custom sizer classes when their own
+        parameters change.
+
+        @see EnableMinSizeCache()
+
+        @since 3.3.0
+    */
+    void InvalidateMinSize();
+
+    /**
+        Invalidates the cached minimal sizes of all sizers.
+
+        @see EnableMinSizeCache()
+
+        @since 3.3.0
+    */
+    static void InvalidateAllMinSizes();
+
     /**
        Returns the number of items in the sizer.
 
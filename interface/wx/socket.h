@@ -480,6 +480,12 @@ public:
     @beginEventTable{wxSocketEvent}
     @event{EVT_SOCKET(id, func)}
         Process a socket event, supplying the member function.
+    @event{EVT_SOCKET_READ_DONE(id, func)}
+        Process a @c wxEVT_SOCKET_READ_DONE event, see
+        wxSocketBase::ReadAsync().
+    @event{EVT_SOCKET_WRITE_DONE(id, func)}
+        Process a @c wxEVT_SOCKET_WRITE_DONE event, see
+        wxSocketBase::WriteAsync().
     @endEventTable
 
     @library{wxnet}
@@ -495,6 +501,38 @@ public:
     */
     wxSocketEvent(int id = 0);
 
+    /**
+        Constructor for the events of the given type.
+
+        @since 3.3.0
+    */
+    wxSocketEvent(wxEventType type, int id);
+
+    /**
+        Returns the data read by wxSocketBase::ReadAsync().
+
+        This function is only useful for ::wxEVT_SOCKET_READ_DONE events.
+
+        @since 3.3.0
+    */
+    const wxMemoryBuffer& GetData() const;
+
+    /**
+        Returns the number of bytes read or written by the asynchronous
+        operation.
+
+        @since 3.3.0
+    */
+    wxUint32 GetCount() const;
+
+    /**
+        Returns the error which occurred during the asynchronous operation or
+        ::wxSOCKET_NOERROR if it completed successfully.
+
+        @since 3.3.0
+    */
+    wxSocketError GetError() const;
+
     /**
         Gets the client data of the socket which generated this event, as
         set with wxSocketBase::SetClientData().
@@ -706,6 +744,21 @@ enum
 };
 
 
+/**
+    Buffer description used by wxSocketBase::WriteV().
+
+    @since 3.3.0
+*/
+struct wxSocketBuffer
+{
+    /// Pointer to the data to send.
+    const void* data;
+
+    /// Size of the data in bytes.
+    wxUint32 size;
+};
+
+
 /**
     @class wxSocketBase
 
@@ -721,6 +774,14 @@ enum
     @event{EVT_SOCKET(id, func)}
         Process a @c wxEVT_SOCKET event.
         See @ref wxSocketEventFlags and @ref wxSocketFlags for more info.
+    @event{EVT_SOCKET_READ_DONE(id, func)}
+        Process a @c wxEVT_SOCKET_READ_DONE event, sent when the operation
+        started by ReadAsync() completes. This event is new since wxWidgets
+        3.3.0.
+    @event{EVT_SOCKET_WRITE_DONE(id, func)}
+        Process a @c wxEVT_SOCKET_WRITE_DONE event, sent when the operation
+        started by WriteAsync() completes. This event is new since wxWidgets
+        3.3.0.
     @endEventTable
 
     @library{wxnet}
@@ -1146,6 +1207,38 @@ public:
     */
     virtual bool SetLocal(const wxIPV4address& local);
 
+    /**
+        Enable or disable Nagle's algorithm for this TCP socket.
+
+        If @a noDelay is @true, @c TCP_NODELAY option is set and the small
+        chunks of data are sent immediately instead of being combined into
+        bigger packets, which reduces the latency when sending many small
+        messages.
+
+        @return @true if the option was changed successfully.
+
+        @since 3.3.0
+    */
+    bool SetNoDelay(bool noDelay = true);
+
+    /**
+        Prevent sending partial frames for this TCP socket.
+
+        If @a cork is @true, the data is only sent when a full packet can be
+        filled, until this function is called again with @false, which sends
+        any remaining data immediately. This is useful for sending a header
+        followed by the file contents using SendFile(), for example.
+
+        This uses @c TCP_CORK option under Linux and @c TCP_NOPUSH under BSD
+        systems, including macOS, and is not supported under the other ones.
+
+        @return @true if the option was changed successfully or @false if an
+            error occurred or this option is not supported.
+
+        @since 3.3.0
+    */
+    bool SetCork(bool cork = true);
+
     /**
         Set the default socket timeout in seconds.
 
@@ -1337,6 +1430,145 @@ public:
     */
     wxSocketBase& WriteMsg(const void* buffer, wxUint32 nbytes);
 
+    /**
+        Write the data from several buffers to the socket at once.
+
+        This function behaves exactly like Write() called for the concatenation
+        of all buffers, but avoids copying them into a single buffer or calling
+        Write() for each of them, e.g. when sending a message header and its
+        body separately. For stream sockets, the data is sent using a single
+        system call (writev() or WSASend()) for up to 64 buffers at once. For
+        datagram sockets, each buffer is sent as a separate datagram.
+
+        Use LastWriteCount() to verify the total number of bytes actually
+        written.
+
+        @param buffers
+            Array of @a count buffers with the data to be sent.
+        @param count
+            Number of buffers, may be 0.
+
+        @return Returns a reference to the current object.
+
+        @see Write(), SetCork()
+
+        @since 3.3.0
+    */
+    wxSocketBase& WriteV(const wxSocketBuffer* buffers, size_t count);
+
+    /**
+        Send the contents of the file to the socket.
+
+        This function sends the given part of the file, or all of it by
+        default, to a stream socket. Under Linux, this is done using
+        sendfile() system call, without reading the file into the user space
+        memory, while under the other systems, or if the file doesn't support
+        it, the file is read using a fixed size buffer and its contents is
+        written to the socket.
+
+        Like WriteMsg(), this function always behaves as if the
+        @b wxSOCKET_WAITALL flag were set.
+
+        Use LastWriteCount() to verify the number of bytes actually written,
+        notice that it can't be represented correctly for the files bigger
+        than 4GiB, however Error() can still be used to check if all the data
+        was sent.
+
+        @param file
+            The file to send, must be opened.
+        @param offset
+            The offset of the first byte to send.
+        @param size
+            The number of bytes to send, by default everything until the end
+            of the file is sent.
+
+        @return Returns a reference to the current object.
+
+        @see Write()
+
+        @since 3.3.0
+    */
+    wxSocketBase& SendFile(wxFile& file,
+                           wxFileOffset offset = 0,
+                           wxFileOffset size = wxInvalidOffset);
+
+    /**
+        Start reading the data from the socket asynchronously.
+
+        This function returns immediately and the data is read when it becomes
+        available, without blocking. When all the requested data has been
+        read, or as soon as any data has been read if @a waitAll is @false, a
+        ::wxEVT_SOCKET_READ_DONE event is sent to the event handler set by
+        SetEventHandler(). wxSocketEvent::GetData() can then be used to
+        retrieve the buffer containing the data, which can be used without
+        copying it. If the connection is lost or an error occurs before the
+        read completes, the event is sent with wxSocketEvent::GetError()
+        returning ::wxSOCKET_IOERR and the data read so far.
+
+        Only a single read operation can be in progress at any time, but
+        another one can be started from the handler of this event. While it is
+        in progress, @c wxSOCKET_INPUT events are not generated for this
+        socket.
+
+        This function can only be used with non-blocking sockets, i.e. sockets
+        without @c wxSOCKET_BLOCK flag, and with the event handler already set.
+        The pending operations are cancelled without sending any events when
+        the socket is closed.
+
+        @param nbytes
+            The number of bytes to read, must be positive.
+        @param waitAll
+            If @true, the operation is completed only when all the data is
+            read, otherwise it's completed as soon as some data is received.
+
+        @return @false if the operation couldn't be started.
+
+        @see WriteAsync(), IsReadingAsync()
+
+        @since 3.3.0
+    */
+    bool ReadAsync(wxUint32 nbytes, bool waitAll = true);
+
+    /**
+        Start writing the data to the socket asynchronously.
+
+        The data is copied into the internal buffer associated with this
+        socket, so the caller doesn't need to keep it, and is written when the
+        socket becomes writable, without blocking. When all of it has been
+        written, a ::wxEVT_SOCKET_WRITE_DONE event is sent to the event handler
+        set by SetEventHandler(), with wxSocketEvent::GetCount() returning the
+        number of bytes written.
+
+        Unlike with ReadAsync(), this function may be called again before the
+        previous operation completes: the data is then written after the data
+        queued before and one event is sent for each call.
+
+        The same restrictions on the socket as for ReadAsync() apply.
+
+        @return @false if the operation couldn't be started.
+
+        @see IsWritingAsync()
+
+        @since 3.3.0
+    */
+    bool WriteAsync(const void* buffer, wxUint32 nbytes);
+
+    /**
+        Returns @true if an asynchronous read started by ReadAsync() is in
+        progress.
+
+        @since 3.3.0
+    */
+    bool IsReadingAsync() const;
+
+    /**
+        Returns @true if some data queued by WriteAsync() remains to be
+        written.
+
+        @since 3.3.0
+    */
+    bool IsWritingAsync() const;
+
     ///@}
 
 
@@ -665,6 +665,52 @@ public:
     */
     bool ReadAll(void* buffer, size_t size);
 
+    /**
+        Gives access to the data already present in the stream internal buffer.
+
+        This function allows to read the data from the streams having an
+        internal buffer, such as wxMemoryInputStream, wxBufferedInputStream or
+        wxMappedInputStream, without copying it. It returns the number of
+        bytes available in the buffer, filling it first if it is empty, and
+        sets @a data to point to them. The bytes that were actually used must
+        then be marked as read by calling ConsumeBuffer().
+
+        Example of computing the checksum of the stream contents:
+        @code
+        const void* data;
+        while ( size_t size = stream.PeekBuffer(&data) ) {
+            crc = crc32(crc, static_cast<const Bytef*>(data), size);
+            stream.ConsumeBuffer(size);
+        }
+        @endcode
+
+        Note that the pointer returned by this function is only valid until
+        the next operation on this stream and that returning 0 doesn't mean
+        that EOF was reached, as the streams without internal buffer always
+        return 0. Read() must be used to read the data in this case.
+
+        @param data
+            Non-null pointer that is set to point to the data on return.
+        @return The number of bytes that can be accessed via @a data.
+
+        @since 3.3.0
+    */
+    size_t PeekBuffer(const void** data);
+
+    /**
+        Marks the data returned by PeekBuffer() as read.
+
+        The next read operation will return the data following the consumed
+        bytes.
+
+        @param size
+            The number of bytes to consume, which must be less or equal to the
+            value returned by the last call to PeekBuffer().
+
+        @since 3.3.0
+    */
+    void ConsumeBuffer(size_t size);
+
     /**
         Changes the stream current position.
 
@@ -724,6 +770,31 @@ protected:
         variable should be set accordingly as well).
     */
     size_t OnSysRead(void* buffer, size_t bufsize) = 0;
+
+    /**
+        Override this function to support PeekBuffer() in a derived class.
+
+        It should return the data already available in the internal buffer of
+        this stream, trying to fill the buffer if it is empty. The default
+        implementation simply returns 0.
+
+        Note that the data from the write-back buffer is handled by
+        PeekBuffer() itself and this function is not called if there is any.
+
+        @since 3.3.0
+    */
+    virtual size_t DoPeekBuffer(const void** data);
+
+    /**
+        Override this function to support ConsumeBuffer() in a derived class.
+
+        It must be overridden if DoPeekBuffer() is and should advance the
+        current position by the given number of bytes, which is guaranteed to
+        be non-zero.
+
+        @since 3.3.0
+    */
+    virtual void DoConsumeBuffer(size_t size);
 };
 
 
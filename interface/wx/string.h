@@ -1530,6 +1530,30 @@ public:
     */
     int PrintfV(const wxString& pszFormat, va_list argPtr);
 
+    /**
+        Appends the formatted string to this string.
+
+        This function works like Printf() but doesn't replace the existing
+        string contents. It is more efficient than appending the result of
+        Format() to the string, as it avoids allocating memory for the
+        temporary string and, if the string already has enough capacity, for
+        the result too, and so is useful for building long strings, e.g. logs,
+        piece by piece.
+
+        Returns the number of characters appended, or an integer less than
+        zero on error, in which case the string is not modified.
+
+        @since 3.3.0
+    */
+    int AppendFormat(const wxString& format, ...);
+
+    /**
+        Similar to AppendFormat(), but takes a va_list.
+
+        @since 3.3.0
+    */
+    int AppendFormatV(const wxString& format, va_list argPtr);
+
     ///@}
 
 
@@ -1503,6 +1503,70 @@ public:
                 const wxValidator& validator = wxDefaultValidator,
                 const wxString& name = wxTextCtrlNameStr);
 
+    /**
+        Appends the text to the end of the control without doing it
+        immediately.
+
+        The text passed to this function is accumulated and appended to the
+        control at once, using AppendText(), at most once per display frame
+        (i.e. approximately every 16ms). This is much more efficient than
+        calling AppendText() directly when appending many small chunks of
+        text in quick succession, as happens e.g. in a window showing the
+        output of a program or log messages, especially when combined with
+        SetMaxLines() limiting the total amount of text in the control.
+
+        Note that the text appended using this function is not yet available
+        when it returns, call FlushBufferedText() before using any functions
+        querying the control contents if necessary. Mixing calls to this
+        function and the other functions modifying the control contents
+        should also be avoided.
+
+        @see FlushBufferedText()
+
+        @since 3.3.0
+    */
+    void AppendTextBuffered(const wxString& text);
+
+    /**
+        Appends the text accumulated by AppendTextBuffered() immediately.
+
+        Does nothing if there is no such text.
+
+        @since 3.3.0
+    */
+    void FlushBufferedText();
+
+    /**
+        Returns the maximal number of lines set by SetMaxLines().
+
+        @since 3.3.0
+    */
+    int GetMaxLines() const;
+
+    /**
+        Limits the number of lines kept in the multiline control.
+
+        When the text appended by AppendTextBuffered() makes the number of
+        lines in the control greater than @a maxLines, the oldest lines are
+        removed, all at once, from its beginning. This is convenient for
+        implementing windows showing the last lines of some continuously
+        updated output, such as a log file. The trailing empty line, if the
+        text ends with a new line character, is not counted.
+
+        If the control already contains more than @a maxLines lines, the
+        extra ones are removed immediately.
+
+        Notice that the lines appended using AppendText() or otherwise don't
+        result in removing the extra lines, only those appended using
+        AppendTextBuffered() do.
+
+        @param maxLines The maximal number of lines or 0 for no limit, which
+            is the default.
+
+        @since 3.3.0
+    */
+    void SetMaxLines(int maxLines);
+
     /**
         Resets the internal modified flag as if the current changes had been
         saved.
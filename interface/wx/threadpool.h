@@ -0,0 +1,144 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        wx/threadpool.h
+// Purpose:     interface of wxThreadPool
+// Author:      wxWidgets team
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+    @class wxThreadPool
+
+    Pool of worker threads executing the submitted tasks.
+
+    This class allows to execute arbitrary functions, called tasks, in the
+    background threads without having to create and manage these threads
+    manually. The threads are created on demand, up to the maximal number
+    specified when creating the pool, and are reused for executing all the
+    tasks submitted to it.
+
+    The tasks submitted from outside of the pool are executed in the order of
+    their submission. Tasks submitted from inside another task are queued in
+    the queue of the thread executing it and may be taken by any other idle
+    thread of the pool ("work stealing"), which allows to efficiently split
+    the work into many small parts.
+
+    Each call to Submit() returns a @c std::future which can be used to wait
+    for the task completion and retrieve its result or the exception thrown by
+    it. Alternatively, SubmitAndCallAfter() can be used to be notified about
+    the task completion in the main thread without blocking it, e.g.
+    @code
+    void MyFrame::OnLoad(wxCommandEvent&)
+    {
+        const wxString path = ...;
+        wxThreadPool::Get().SubmitAndCallAfter
+        (
+            this,
+            [path]() { return wxImage(path); },
+            [this](std::future<wxImage>& future)
+            {
+                // This is executed in the main thread.
+                m_bitmap->SetBitmap(future.get());
+            }
+        );
+    }
+    @endcode
+
+    Most applications should just use the global pool returned by Get(), but
+    it is also possible to create separate pools, e.g. to limit the number of
+    threads used for some kind of tasks.
+
+    Note that the tasks should avoid blocking waiting for other tasks
+    submitted to the same pool, as this may result in a deadlock if all the
+    pool threads end up waiting.
+
+    This class is only available if @c wxUSE_THREADS is 1.
+
+    @library{wxbase}
+    @category{threading}
+
+    @see wxThread, wxMessageQueue
+
+    @since 3.3.0
+*/
+class wxThreadPool
+{
+public:
+    /**
+        Creates the pool using at most the given number of threads.
+
+        No threads are created immediately, they are only started when the
+        tasks are submitted to the pool.
+
+        @param maxThreads
+            Maximal number of threads to use. The default value of 0 means
+            to use as many threads as there are CPUs in the system.
+    */
+    explicit wxThreadPool(int maxThreads = 0);
+
+    /**
+        Destroys the pool.
+
+        The destructor waits until all the tasks submitted to the pool are
+        done and all its threads terminate. It must not be called from one of
+        the pool threads.
+    */
+    ~wxThreadPool();
+
+    /**
+        Returns the global pool shared by the entire program.
+
+        The global pool uses as many threads as there are CPUs in the system.
+        It is created on first use and destroyed on library shutdown.
+    */
+    static wxThreadPool& Get();
+
+    /**
+        Returns the maximal number of threads used by this pool.
+    */
+    int GetMaxThreads() const;
+
+    /**
+        Returns the number of threads created by this pool so far.
+    */
+    int GetThreadCount() const;
+
+    /**
+        Returns true if called from one of the threads of this pool.
+    */
+    bool IsWorkerThread() const;
+
+    /**
+        Executes the given function in one of the pool threads.
+
+        This function can be called from any thread.
+
+        @param func
+            Function object taking no arguments, possibly returning a value
+            of type @c R.
+        @return The future which becomes ready when the task is done and can
+            be used to retrieve the value returned by the function or the
+            exception thrown by it.
+    */
+    template <typename F>
+    std::future<R> Submit(F func);
+
+    /**
+        Executes the given function in one of the pool threads and calls
+        another function in the main thread when it is done.
+
+        This function can be called from any thread.
+
+        @param handler
+            Non-null event handler used for executing @a onDone using
+            wxEvtHandler::CallAfter(). It must remain alive until @a onDone is
+            called.
+        @param func
+            Function object taking no arguments, possibly returning a value
+            of type @c R.
+        @param onDone
+            Function object taking @c std::future<R>& as argument, the future
+            is always ready when it is called.
+    */
+    template <typename F, typename G>
+    void SubmitAndCallAfter(wxEvtHandler* handler, F func, G onDone);
+};
@@ -90,6 +90,15 @@ public:
     */
     bool IsOneShot() const;
 
+    /**
+        Returns the tolerance of the timer.
+
+        The tolerance is 0 unless it was changed by SetTolerance().
+
+        @since 3.3.0
+    */
+    int GetTolerance() const;
+
     /**
         Returns @true if the timer is running, @false if it is stopped.
     */
@@ -115,6 +124,39 @@ public:
     */
     void SetOwner(wxEvtHandler* owner, int id = -1);
 
+    /**
+        Sets the timer tolerance.
+
+        The tolerance is the maximal delay, in milliseconds, by which the
+        expiration of the timer may be postponed to allow the system to
+        coalesce it with the expirations of other timers. Using non-zero
+        tolerance for the timers which don't need to be precise, e.g. the
+        ones used for periodic updates, reduces the number of wake-ups and so
+        the power consumption of the application.
+
+        This is only a hint and the timer may still expire as soon as its
+        interval elapses, or may be delayed by more than the tolerance if the
+        application is busy. The way in which it is used depends on the
+        platform:
+        - Under MSW @c SetCoalescableTimer() is used, if available.
+        - Under macOS the tolerance of the underlying @c CFRunLoopTimer is set.
+        - Under GTK, timers with the interval and tolerance of at least one
+          second are rounded to whole seconds and expire together.
+        - Under Qt, timers with the interval and tolerance of at least one
+          second use @c Qt::VeryCoarseTimer.
+        - In the console applications under Unix, the timer expiration is
+          rounded up to the multiple of the largest power of two number of
+          milliseconds not greater than the tolerance, so that the timers
+          with similar tolerances expire at the same time.
+
+        The new tolerance only takes effect when the timer is (re)started.
+
+        @param milliseconds Non-negative tolerance, 0 to disable coalescing.
+
+        @since 3.3.0
+    */
+    void SetTolerance(int milliseconds);
+
     /**
         (Re)starts the timer. If @a milliseconds parameter is -1 (value by default),
         the previous value is used. Returns @false if the timer could not be started,
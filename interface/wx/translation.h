@@ -431,6 +431,52 @@ protected:
 class wxMsgCatalog
 {
 public:
+    /**
+        Flags for SetDefaultLoadFlags().
+
+        @since 3.3.0
+     */
+    enum
+    {
+        /**
+            Load the catalogs lazily.
+
+            When this flag is used, CreateFromFile() maps the MO file into
+            memory instead of reading it and doesn't convert all the messages
+            in it to wxString immediately. Instead, each message is looked up
+            in the hash table stored in the MO file itself when it is
+            requested for the first time, and only then converted.
+
+            This makes loading big catalogs much faster and can reduce the
+            memory consumption significantly, if only a small part of the
+            messages is actually used. The drawback is that the file remains
+            opened while the catalog is used, which can prevent it from being
+            modified under some platforms, and that errors in it are only
+            detected when the affected messages are used.
+
+            This flag is ignored for MO files without the hash table, which
+            are loaded as usual.
+         */
+        Load_Lazy = 1
+    };
+
+    /**
+        Sets the flags used for loading all the catalogs from now on.
+
+        @param flags Combination of the elements of the anonymous enum above,
+            currently can be either 0 (default) or ::Load_Lazy.
+
+        @since 3.3.0
+     */
+    static void SetDefaultLoadFlags(int flags);
+
+    /**
+        Returns the flags set by SetDefaultLoadFlags().
+
+        @since 3.3.0
+     */
+    static int GetDefaultLoadFlags();
+
     /**
         Creates catalog loaded from a MO file.
 
@@ -496,6 +542,27 @@ public:
  */
 #define wxGETTEXT_IN_CONTEXT_PLURAL(context, string, plural, n)
 
+/**
+    Same as _() but caches the result of the translation lookup.
+
+    The first time it is executed, this macro looks up the translation of the
+    given string, as _() does. It then remembers the result and reuses it on
+    the following executions, until the translations change. Translations
+    change when the language or the global wxTranslations object is changed,
+    or when a new catalog is loaded. This makes it suitable for the
+    performance-critical code, e.g. @c wxEVT_PAINT handlers, where translation
+    lookups are repeated a lot.
+
+    The cache is stored at the point of use, so this macro can only be used
+    with literal strings. It is thread-safe and doesn't use any locks.
+
+    Notice that you need to add @c --keyword="wxGETTEXT_CACHED" option to
+    xgettext invocation to extract the strings used with this macro.
+
+    @since 3.3.0
+ */
+#define wxGETTEXT_CACHED(string)
+
 /**
     This macro doesn't do anything in the program code -- it simply expands to
     the value of its argument.
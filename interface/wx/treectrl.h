@@ -42,6 +42,22 @@
     collapse its branches. These methods are not available in the native wxMSW
     and wxQt implementations.
 
+    @section treectrl_virtual Creating items on demand
+
+    Creating all items of a big tree, e.g. mirroring the file system, in
+    advance may be prohibitively expensive. Applications can avoid this by
+    adding the children of an item only when it is expanded, in the
+    wxEVT_TREE_ITEM_EXPANDING handler, after calling SetItemHasChildren() for
+    it to show the button allowing to expand it.
+
+    Alternatively, when using wxGenericTreeCtrl, it is possible to derive a
+    class from it and override OnGetItemChildrenCount(), OnGetItemText() and,
+    optionally, OnGetItemImage() and OnGetItemData() in it to let the control
+    create the children of the items itself when they are expanded. Such
+    children are deleted again when their parent item is collapsed, so only
+    the items in the expanded branches of the tree exist at any moment. This
+    is not available in the native wxMSW and wxQt implementations.
+
     @section treectrl_events Events
 
     To intercept events from a tree control, use the event table macros
@@ -840,6 +856,76 @@ public:
     virtual int OnCompareItems(const wxTreeItemId& item1,
                                const wxTreeItemId& item2);
 
+    /**
+        Override this function to create the children of the given item on
+        demand.
+
+        If this function returns a non-negative value, the control creates
+        this many children of the item when it is expanded, using
+        OnGetItemText(), OnGetItemImage() and OnGetItemData() to get their
+        attributes, and deletes them again when it is collapsed. It is called
+        for the root item when it is added and for all the items created in
+        this way, to check whether they have any children, and then again when
+        the item is expanded, so it should be fast.
+
+        Note that the children are not created if the item already has some,
+        e.g. because they were added from wxEVT_TREE_ITEM_EXPANDING handler.
+
+        The default implementation returns @c wxNOT_FOUND, meaning that the
+        children of the item are added by the application as usual.
+
+        @note This function is only available in the generic version.
+
+        @since 3.3.0
+    */
+    virtual int OnGetItemChildrenCount(const wxTreeItemId& item) const;
+
+    /**
+        Override this function to return the data to associate with a child
+        of the given item created on demand.
+
+        The returned object, which may be @NULL (as returned by the default
+        implementation), is owned by the control and is deleted when the item
+        is deleted, e.g. because its parent is collapsed.
+
+        @note This function is only available in the generic version.
+
+        @see OnGetItemChildrenCount()
+
+        @since 3.3.0
+    */
+    virtual wxTreeItemData* OnGetItemData(const wxTreeItemId& parent,
+                                          size_t index) const;
+
+    /**
+        Override this function to return the image of a child of the given
+        item created on demand.
+
+        The default implementation returns wxWithImages::NO_IMAGE.
+
+        @note This function is only available in the generic version.
+
+        @see OnGetItemChildrenCount()
+
+        @since 3.3.0
+    */
+    virtual int OnGetItemImage(const wxTreeItemId& parent, size_t index) const;
+
+    /**
+        Override this function to return the text of a child of the given
+        item created on demand.
+
+        This function must be overridden if OnGetItemChildrenCount() is.
+
+        @note This function is only available in the generic version.
+
+        @see OnGetItemChildrenCount()
+
+        @since 3.3.0
+    */
+    virtual wxString OnGetItemText(const wxTreeItemId& parent,
+                                   size_t index) const;
+
     /**
         Appends an item as the first child of @a parent, return a new item id.
 
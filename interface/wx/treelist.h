@@ -493,6 +493,37 @@ public:
     /// Delete all tree items.
     void DeleteAllItems();
 
+    /**
+        Start adding many items at once.
+
+        Adding or deleting items between the calls to this function and
+        EndBulkInsert() is much faster than doing it normally, as the control
+        doesn't update its display after each change but rebuilds it once
+        when EndBulkInsert() is called. This is especially useful when filling
+        the control with many items initially.
+
+        The calls to this function can be nested, but each of them must be
+        matched by a call to EndBulkInsert().
+
+        Notice that until then, the items added or changed in the meanwhile
+        can't be selected, expanded or otherwise manipulated in any way
+        involving their display. Also, when the display is rebuilt, all the
+        items are collapsed and the selection is reset.
+
+        @since 3.3.0
+     */
+    void BeginBulkInsert();
+
+    /**
+        Finish adding many items at once.
+
+        Updates the display of the control if anything changed since the
+        matching call to BeginBulkInsert().
+
+        @since 3.3.0
+     */
+    void EndBulkInsert();
+
     ///@}
 
 
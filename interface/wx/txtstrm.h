@@ -248,6 +248,154 @@ public:
 };
 
 
+/**
+    @class wxTextLineReader
+
+    This class reads text from an input stream line by line.
+
+    Unlike wxTextFile, it never loads the entire stream contents in memory and
+    so can be used with arbitrarily large files. And unlike
+    wxTextInputStream::ReadLine(), it reads and decodes the input in big
+    blocks, which is much more efficient.
+
+    All kinds of line terminators are recognized, see GetLineType(), and, as
+    with wxTextFile, the last line is only returned if it is not empty.
+
+    Example of counting non-empty lines in a file:
+    @code
+    wxFileInputStream input("huge.log");
+    wxTextLineReader reader(input);
+
+    size_t count = 0;
+    while ( reader.NextLine() ) {
+        if ( reader.GetLineLength() )
+            count++;
+    }
+
+    if ( !reader.IsOk() ) {
+        ... handle error ...
+    }
+    @endcode
+
+    @library{wxbase}
+    @category{streams}
+
+    @see wxTextInputStream, wxTextFile
+
+    @since 3.3.0
+*/
+class wxTextLineReader
+{
+public:
+    /// The default size of the blocks read from the stream.
+    enum { DEFAULT_BLOCK_SIZE = 65536 };
+
+    /**
+        Constructs a reader object associated with the given input stream.
+
+        @param stream
+            The underlying input stream, which must remain valid during the
+            lifetime of this object.
+        @param conv
+            The conversion used to decode the stream contents. Note that it
+            must use either a single byte for the new line characters or be
+            one of UTF-16 or UTF-32 encodings.
+        @param blockSize
+            The number of bytes to read from the stream at once.
+    */
+    wxTextLineReader(wxInputStream& stream,
+                     const wxMBConv& conv = wxConvAuto(),
+                     size_t blockSize = DEFAULT_BLOCK_SIZE);
+
+    /**
+        Returns a reference to the associated input stream.
+    */
+    const wxInputStream& GetInputStream() const;
+
+    /**
+        Advances to the next line.
+
+        After this function returns @true, the line contents can be retrieved
+        using the accessor functions below.
+
+        @return
+            @false if there are no more lines in the stream or if an error
+            occurred, use IsOk() to distinguish between the two cases.
+    */
+    bool NextLine();
+
+    /**
+        Reads the next line into the provided string.
+
+        This is a convenient wrapper around NextLine() and GetLineData()
+        reusing the memory already allocated by the string, which makes it
+        more efficient than using GetLine() in a loop.
+
+        @param line
+            Receives the line contents, without the line terminator.
+        @param type
+            If non-null, receives the type of the line terminator.
+        @return
+            @false if there are no more lines or an error occurred.
+    */
+    bool ReadLine(wxString& line, wxTextFileType* type = nullptr);
+
+    /**
+        Returns the pointer to the contents of the current line.
+
+        The returned buffer is not NUL-terminated, use GetLineLength() to
+        find out its length, and points to the internal buffer of this object,
+        so it is invalidated by the next call to NextLine().
+    */
+    const wchar_t* GetLineData() const;
+
+    /**
+        Returns the length of the current line, without the terminator.
+    */
+    size_t GetLineLength() const;
+
+    /**
+        Returns a copy of the current line as a string.
+    */
+    wxString GetLine() const;
+
+    /**
+        Returns a view of the current line.
+
+        Just as the pointer returned by GetLineData(), the view is invalidated
+        by the next call to NextLine().
+
+        This function is only available when compiling with C++17 support.
+    */
+    std::wstring_view GetLineView() const;
+
+    /**
+        Returns the type of the current line terminator.
+
+        This is always one of wxTextFileType_Unix, wxTextFileType_Dos or
+        wxTextFileType_Mac, except for the last line of the stream which is not
+        terminated with a new line, for which it is wxTextFileType_None.
+    */
+    wxTextFileType GetLineType() const;
+
+    /**
+        Returns the 1-based number of the current line.
+
+        Returns 0 if NextLine() hadn't been called yet.
+    */
+    size_t GetLineNumber() const;
+
+    /**
+        Returns @false if reading from the stream or decoding its contents
+        failed.
+
+        Note that, depending on the block size, some lines preceding the
+        invalid data may not be returned in this case.
+    */
+    bool IsOk() const;
+};
+
+
 /**
     Specifies the end-of-line characters to use with wxTextOutputStream.
 */
@@ -16,6 +16,176 @@ enum wxURIHostType
     wxURI_IPVFUTURE     ///< Host is a future ip address, wxURI is unsure what kind.
 };
 
+/**
+    Components of a URI.
+
+    These values are used by wxURIView functions to identify the component.
+
+    @since 3.3.0
+*/
+enum wxURIFieldType
+{
+    wxURI_SCHEME = 1,
+    wxURI_USERINFO = 2,
+    wxURI_SERVER = 4,
+    wxURI_PORT = 8,
+    wxURI_PATH = 16,
+    wxURI_QUERY = 32,
+    wxURI_FRAGMENT = 64
+};
+
+/**
+    Position of a URI component in the string it was parsed from.
+
+    @see wxURIView::GetRange()
+
+    @since 3.3.0
+*/
+struct wxURIRange
+{
+    /// Offset of the component from the start of the string.
+    size_t pos = 0;
+
+    /// Length of the component in bytes.
+    size_t len = 0;
+};
+
+/**
+    @class wxURIView
+
+    wxURIView parses a URI without copying any of its components.
+
+    Unlike wxURI, which stores all URI components in separate strings, this
+    class only remembers their positions in the string being parsed. This
+    makes it much faster when parsing many URIs, especially if only some of
+    their components are needed. It uses the same grammar as wxURI and finds
+    the same components as it.
+
+    The string being parsed must be in UTF-8 and remain valid for as long as
+    the components positions are used, as it is not copied.
+
+    Notice that wxURI escapes the characters not allowed in the URI
+    components, e.g. spaces or non-ASCII characters, while wxURIView doesn't
+    modify them in any way. NeedsEscaping() can be used to check if this is
+    the case for the given component.
+
+    Example:
+    @code
+        wxURIView view;
+        if ( view.Parse("https://www.wxwidgets.org/downloads/") &&
+                view.HasServer() )
+        {
+            // host is "www.wxwidgets.org"
+            std::string host(view.GetStart(wxURI_SERVER),
+                             view.GetLength(wxURI_SERVER));
+        }
+    @endcode
+
+    @library{wxbase}
+    @category{net}
+
+    @see wxURI
+
+    @since 3.3.0
+*/
+class wxURIView
+{
+public:
+    /**
+        Default constructor doesn't parse anything.
+
+        Use Parse() later.
+    */
+    wxURIView();
+
+    /**
+        Constructor parsing the given URI.
+
+        @see Parse()
+    */
+    explicit wxURIView(const char* uri);
+
+    /**
+        Parses the given URI.
+
+        Any previously parsed components are forgotten.
+
+        @param uri
+            NUL-terminated URI in UTF-8 encoding, it must remain valid while
+            this object is used.
+        @return
+            @true if the entire string was parsed, possibly with some
+            characters needing to be escaped (just as wxURI::Create() does),
+            or @false if only its initial part was.
+    */
+    bool Parse(const char* uri);
+
+    /**
+        Returns @true if the URI had the given component.
+    */
+    bool Has(wxURIFieldType field) const;
+
+    /// Same as Has(wxURI_SCHEME).
+    bool HasScheme() const;
+    /// Same as Has(wxURI_USERINFO).
+    bool HasUserInfo() const;
+    /// Same as Has(wxURI_SERVER).
+    bool HasServer() const;
+    /// Same as Has(wxURI_PORT).
+    bool HasPort() const;
+    /// Same as Has(wxURI_PATH).
+    bool HasPath() const;
+    /// Same as Has(wxURI_QUERY).
+    bool HasQuery() const;
+    /// Same as Has(wxURI_FRAGMENT).
+    bool HasFragment() const;
+
+    /**
+        Returns the string passed to Parse().
+    */
+    const char* GetSource() const;
+
+    /**
+        Returns the position of the component in the source string.
+
+        The range doesn't include the separators, such as the colon after
+        the scheme or the question mark before the query, and is empty if
+        the component is not present.
+    */
+    const wxURIRange& GetRange(wxURIFieldType field) const;
+
+    /**
+        Returns the pointer to the start of the component in the source
+        string.
+
+        Notice that the component is not NUL-terminated, use GetLength() to
+        find its end.
+    */
+    const char* GetStart(wxURIFieldType field) const;
+
+    /**
+        Returns the length of the component in bytes.
+    */
+    size_t GetLength(wxURIFieldType field) const;
+
+    /**
+        Returns the type of the server component.
+
+        @see wxURI::GetHostType()
+    */
+    wxURIHostType GetHostType() const;
+
+    /**
+        Returns @true if the component contains characters which are not
+        allowed in it.
+
+        Such characters are percent-encoded by wxURI, so the value of the
+        component returned by it is different from the source string if this
+        function returns @true and is the same otherwise.
+    */
+    bool NeedsEscaping(wxURIFieldType field) const;
+};
+
 /**
     @class wxURI
 
@@ -282,6 +452,28 @@ public:
     */
     static wxString Unescape(const wxString& uri);
 
+    /**
+        Translates all escape sequences in the UTF-8 string.
+
+        This overload doesn't allocate any memory and is useful for decoding
+        the URI components found by wxURIView.
+
+        @param uri
+            String with escaped characters in UTF-8, it doesn't need to be
+            NUL-terminated.
+        @param len
+            Length of the string in bytes.
+        @param out
+            Output buffer of at least @a len bytes, which can be the same as
+            @a uri to decode the string in place.
+        @return
+            The length of the decoded string in bytes. Notice that it is not
+            NUL-terminated.
+
+        @since 3.3.0
+    */
+    static size_t Unescape(const char* uri, size_t len, char* out);
+
     /**
         Compares this URI to another URI, and returns @true if this URI equals
         @a uricomp, otherwise it returns @false.
@@ -1452,6 +1452,46 @@ long wxExecute(const wxString& command, wxArrayString& output,
                 wxArrayString& errors, int flags = 0,
                 const wxExecuteEnv *env = nullptr);
 
+/**
+    Statistics about the child processes launched by wxExecute().
+
+    @see wxGetExecuteStats()
+
+    @since 3.3.0
+*/
+struct wxExecuteStats
+{
+    /// Total number of child processes launched successfully.
+    wxUint64 launched = 0;
+
+    /**
+        Number of child processes launched using @c posix_spawn().
+
+        Under Unix systems supporting it, i.e. Linux with glibc 2.34 or later
+        and macOS, wxExecute() uses @c posix_spawn(), which is much faster than
+        @c fork() for processes using a lot of memory, unless the child
+        process priority needs to be changed or a custom environment with a
+        different @c PATH is used. This field allows to check how often this
+        happens.
+     */
+    wxUint64 spawned = 0;
+
+    /// Total time, in microseconds, taken by launching all child processes.
+    wxUint64 launchTimeUs = 0;
+};
+
+/**
+    Returns statistics about the child processes launched by wxExecute().
+
+    This function is currently only implemented under Unix systems and
+    always returns all zeroes elsewhere.
+
+    @header{wx/utils.h}
+
+    @since 3.3.0
+*/
+wxExecuteStats wxGetExecuteStats();
+
 /**
     Returns the number uniquely identifying the current process in the system.
     If an error occurs, 0 is returned.
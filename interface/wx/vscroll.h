@@ -260,6 +260,24 @@ public:
     */
     virtual void RefreshRows(size_t from, size_t to);
 
+    /**
+        Must be called when the heights of the rows in the specified range
+        (inclusive) change.
+
+        The heights of the rows returned by OnGetRowHeight() are cached to
+        make scrolling fast even when there are many rows, so this function
+        must be called to let the window know that they changed. It also
+        refreshes these rows and all the rows below them, as their positions
+        change too.
+
+        Note that RefreshRow(), RefreshRows() and RefreshAll() also forget the
+        cached heights of the rows being refreshed, as does changing the
+        number of rows or the size of the window.
+
+        @since 3.3.0
+    */
+    void RefreshRowsHeights(size_t from, size_t to);
+
     /**
         Scroll by the specified number of pages which may be positive (to
         scroll down) or negative (to scroll up).
@@ -397,6 +415,17 @@ public:
     */
     virtual void RefreshColumns(size_t from, size_t to);
 
+    /**
+        Must be called when the widths of the columns in the specified range
+        (inclusive) change.
+
+        This is the same as wxVarVScrollHelper::RefreshRowsHeights(), but for
+        the columns widths returned by OnGetColumnWidth().
+
+        @since 3.3.0
+    */
+    void RefreshColumnsWidths(size_t from, size_t to);
+
     /**
         Scroll by the specified number of pages which may be positive (to
         scroll right) or negative (to scroll left).
@@ -412,6 +412,53 @@ public:
     */
     void SetStorage(Storage storage);
 
+    /**
+        Type of the function used with SetDataCallback().
+
+        The function is called with the data received from the server and
+        must return @true to continue receiving it or @false to pause the
+        transfer until Resume() is called.
+
+        @since 3.3.0
+    */
+    using DataCallback = std::function<bool (const void* data, size_t size)>;
+
+    /**
+        Sets the function to call with the response data as soon as it is
+        received.
+
+        Using this function implies @c Storage_None, but instead of sending
+        @c wxEVT_WEBREQUEST_DATA events, the data is passed to the given
+        function synchronously, from the same thread in which the events
+        would be processed. When using libcurl backend, the function is called
+        directly with the internal buffer of the library, without making any
+        copies of the data, which is only valid during the call.
+
+        If the function returns @false, the transfer is paused and the same
+        data will be passed to it again after calling Resume(). This can be
+        used to avoid receiving more data than can be processed, e.g. when
+        forwarding it to a slow consumer. Note that pausing is currently only
+        supported by libcurl backend and the return value of the function is
+        ignored by the others.
+
+        This function can be only called before calling Start().
+
+        @since 3.3.0
+    */
+    void SetDataCallback(const DataCallback& callback);
+
+    /**
+        Resumes the transfer paused by the data callback returning @false.
+
+        @return @true if the transfer was resumed or @false if pausing is not
+            supported by the backend or resuming it failed.
+
+        @see SetDataCallback()
+
+        @since 3.3.0
+    */
+    bool Resume();
+
     /**
         Disable SSL certificate verification.
 
@@ -543,6 +590,37 @@ public:
     const wxSecretValue& GetPassword() const;
 };
 
+/**
+    Timings of the request returned by wxWebResponse::GetTimings().
+
+    All values are in microseconds since the start of the request or -1 if
+    the corresponding value is not available, e.g. @c tlsHandshake is -1 for
+    the plain HTTP requests. Notice that @c nameLookup and @c connect may be
+    very small if an existing connection was reused.
+
+    @since 3.3.0
+
+    @library{wxnet}
+    @category{net}
+*/
+struct wxWebResponseTimings
+{
+    /// Time until the host name was resolved.
+    wxLongLong_t nameLookup;
+
+    /// Time until the connection to the host was established.
+    wxLongLong_t connect;
+
+    /// Time until the TLS handshake was completed.
+    wxLongLong_t tlsHandshake;
+
+    /// Time until the first byte of the response was received.
+    wxLongLong_t firstByte;
+
+    /// Total time of the request.
+    wxLongLong_t total;
+};
+
 /**
     A wxWebResponse allows access to the response sent by the server.
 
@@ -641,6 +719,21 @@ public:
      */
     wxString GetDataFile() const;
 
+    /**
+        Returns the timings of the different phases of the request.
+
+        This can be used to find out where the time is spent when performing
+        the requests. The values are only available once the corresponding
+        phase has completed and are all available after the request
+        completes.
+
+        @note This is only implemented in the libcurl backend, the other ones
+            return the structure with all fields set to -1.
+
+        @since 3.3.0
+     */
+    wxWebResponseTimings GetTimings() const;
+
     /**
         Returns all response data as a string.
 
@@ -820,6 +913,103 @@ public:
         @since 3.3.0
      */
     bool EnablePersistentStorage(bool enable);
+
+    /**
+        Enable or disable multiplexing several requests over the same
+        connection.
+
+        When multiplexing is enabled, HTTP/2 is used for HTTPS requests if the
+        server supports it and the requests to the same host share a single
+        connection instead of opening a new one for each of them, which is
+        much more efficient when performing many requests to the same server.
+
+        This function, as well as the other connection management functions
+        below, should be called before creating the requests that should be
+        affected by it.
+
+        @return @true if the backend supports this setting.
+
+        @note This and the other connection management functions are only
+            implemented in the libcurl backend.
+
+        @since 3.3.0
+     */
+    bool EnableMultiplexing(bool enable = true);
+
+    /**
+        Set the maximal number of simultaneously open connections.
+
+        @param maxTotal
+            The maximal total number of connections, 0 for no limit. This is
+            also used as the size of the pool of the connections kept open for
+            reuse.
+        @param maxPerHost
+            The maximal number of connections to the same host, 0 for no limit.
+
+        @return @true if the backend supports this setting.
+
+        @since 3.3.0
+     */
+    bool SetMaxConnections(int maxTotal, int maxPerHost = 0);
+
+    /**
+        Enable or disable keeping the connections alive.
+
+        If @a enable is @true, TCP keep-alive probes are sent for the open
+        connections, preventing them from being closed by the intermediate
+        hosts when they're idle. If it is @false, the connections are closed
+        after each request instead of being reused.
+
+        @return @true if the backend supports this setting.
+
+        @since 3.3.0
+     */
+    bool EnableKeepAlive(bool enable = true);
+
+    /**
+        Set the time to keep the resolved host names in the cache.
+
+        @param seconds
+            The timeout in seconds, 0 to disable caching or -1 to keep the
+            names in the cache forever.
+
+        @return @true if the backend supports this setting.
+
+        @since 3.3.0
+     */
+    bool SetDNSCacheTimeout(int seconds);
+
+    /**
+        Sets the cache to use for the requests created by this session.
+
+        When the cache is set, the GET requests using
+        wxWebRequest::Storage_Memory and without any data return the fresh
+        cached responses immediately, without contacting the server, and
+        revalidate the stale ones using conditional requests, i.e. add
+        "If-None-Match" or "If-Modified-Since" headers to them. If the server
+        replies with 304 status, the cached response is used, so the request
+        completes with the status 200 as usual. The successful responses are
+        stored in the cache if their headers allow it.
+
+        Notice that the cache can be shared with wxInternetFSHandler, see its
+        SetCache() function.
+
+        @param cache
+            The cache to use or @NULL to stop using it. The cache is not
+            owned by the session and must remain alive while it is used.
+
+        @see wxHTTPCache
+
+        @since 3.3.0
+    */
+    void SetCache(wxHTTPCache* cache);
+
+    /**
+        Returns the cache set by SetCache() or @NULL.
+
+        @since 3.3.0
+    */
+    wxHTTPCache* GetCache() const;
 };
 
 /**
@@ -884,3 +1074,130 @@ public:
 
 wxEventType wxEVT_WEBREQUEST_STATE;
 wxEventType wxEVT_WEBREQUEST_DATA;
+
+
+/**
+    @class wxWebRequestBatch
+
+    Performs many web requests using the same session, running at most the
+    given number of them concurrently.
+
+    The requests are created by calling Add() and can be configured as usual
+    before calling Start() or Wait(). All their events are sent to this
+    object itself, so handlers for ::wxEVT_WEBREQUEST_STATE should be bound to
+    it to process the results of the requests as they finish, e.g.
+    @code
+    wxWebRequestBatch batch;
+    batch.SetMaxActive(16);
+    for ( const auto& url : urls )
+        batch.Add(url);
+
+    batch.Bind(wxEVT_WEBREQUEST_STATE, [&](wxWebRequestEvent& event)
+        {
+            if ( event.GetState() == wxWebRequest::State_Completed )
+                Process(urls[event.GetId()], event.GetResponse());
+        });
+
+    if ( !batch.Wait() )
+        wxLogWarning("Some resources couldn't be retrieved.");
+    @endcode
+
+    The next request is started only after the handler for the event of the
+    finished one returns. A request is considered to be finished when it
+    switches to any state other than wxWebRequest::State_Active, including
+    wxWebRequest::State_Unauthorized: such requests may still be continued by
+    providing the credentials, but they don't count towards the maximum
+    number of active requests any more.
+
+    Note that the object must not be destroyed while it has any active
+    requests, call Cancel() and Wait() to stop them first if necessary.
+
+    @library{wxnet}
+    @category{net}
+
+    @see wxWebSession, wxWebRequest
+
+    @since 3.3.0
+*/
+class wxWebRequestBatch : public wxEvtHandler
+{
+public:
+    /**
+        Creates a batch using the given session for all requests.
+    */
+    explicit wxWebRequestBatch(const wxWebSession& session = wxWebSession::GetDefault());
+
+    /**
+        Sets the maximal number of requests running at the same time.
+
+        The default value is 8. Note that the session may limit the number of
+        connections independently of this, see wxWebSession::SetMaxConnections().
+    */
+    void SetMaxActive(int count);
+
+    /**
+        Returns the value set by SetMaxActive().
+    */
+    int GetMaxActive() const;
+
+    /**
+        Creates a new request for the given URL.
+
+        The returned request can be configured, e.g. by calling
+        wxWebRequest::SetMethod() or wxWebRequest::SetHeader(), but mustn't be
+        started directly. Its ID is its index in the batch.
+
+        If the batch is already running, the request is started as soon as
+        the number of active requests allows it.
+    */
+    wxWebRequest Add(const wxString& url);
+
+    /**
+        Returns the number of requests in the batch.
+    */
+    size_t GetCount() const;
+
+    /**
+        Returns the request with the given index.
+    */
+    wxWebRequest GetRequest(size_t n) const;
+
+    /**
+        Returns the number of finished requests.
+    */
+    size_t GetFinishedCount() const;
+
+    /**
+        Returns @true if all requests are finished.
+    */
+    bool IsFinished() const;
+
+    /**
+        Starts running the requests asynchronously.
+
+        The events of the requests are processed by the event loop, as usual.
+        Use IsFinished() in the event handler to check if all of them are
+        done.
+    */
+    void Start();
+
+    /**
+        Waits until all requests are finished.
+
+        This function calls Start() if it hadn't been called yet and runs a
+        new event loop until all the requests finish, which means that the
+        events are processed while it is running.
+
+        @return @true if all requests completed successfully, i.e. are in
+            wxWebRequest::State_Completed state.
+    */
+    bool Wait();
+
+    /**
+        Cancels all the active requests and prevents starting the other ones.
+
+        The requests which hadn't been started yet are considered to be
+        finished immediately, while the active ones finish asynchronously.
+    */
+    void Cancel();
+};
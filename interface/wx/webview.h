@@ -446,6 +446,62 @@ public:
         @see wxWebViewHandlerResponse::Finish()
     */
     virtual wxInputStream* GetStream() = 0;
+
+    /**
+        Returns the length of the response data.
+
+        The returned value is passed to the web view as the content length of
+        the response, if known. Otherwise the data is sent until the end of
+        the stream is reached.
+
+        The default implementation returns the length of the stream returned
+        by GetStream(), which may be ::wxInvalidOffset if it is not known.
+
+        @since 3.3.0
+    */
+    virtual wxFileOffset GetContentLength();
+};
+
+/**
+    @class wxWebViewHandlerResponseDataStream
+
+    Response data read from an arbitrary stream.
+
+    This class can be used to send the data which shouldn't, or can't, be
+    loaded into memory entirely, such as big media files or data generated on
+    the fly, to the web view. The stream is read in chunks as the web view
+    needs more data, so a custom wxInputStream generating the data in its
+    wxInputStream::OnSysRead() can be used for the latter.
+
+    Note that the stream may be read after wxWebViewHandler::StartRequest()
+    returns. It is read from the main thread by the macOS and WebKitGTK
+    backends, but the Edge backend may read it from another thread.
+
+    @since 3.3.0
+    @library{wxwebview}
+    @category{webview}
+
+    @see wxWebViewHandlerResponse::Finish(wxInputStream*, wxFileOffset)
+ */
+class WXDLLIMPEXP_WEBVIEW wxWebViewHandlerResponseDataStream : public wxWebViewHandlerResponseData
+{
+public:
+    /**
+        Constructor taking ownership of the stream.
+
+        @param stream
+            The stream to read the response data from, it will be deleted by
+            this object.
+        @param length
+            The length of the response data, if known. If this parameter is
+            not specified, the length of the stream is used and, if it is not
+            known either, the data is read until the end of the stream.
+    */
+    explicit wxWebViewHandlerResponseDataStream(wxInputStream* stream,
+                                                wxFileOffset length = wxInvalidOffset);
+
+    virtual wxInputStream* GetStream();
+    virtual wxFileOffset GetContentLength();
 };
 
 /**
@@ -516,6 +572,24 @@ public:
     */
     virtual void Finish(const wxString& text, const wxMBConv& conv = wxConvUTF8);
 
+    /**
+        Finishes the request with the data read from the given stream.
+
+        This is a shortcut for calling Finish() with a
+        wxWebViewHandlerResponseDataStream object and allows to send the data
+        without loading it into memory entirely.
+
+        @param stream
+            The stream to read the data from, this object takes ownership of
+            it and will delete it when the request is completed.
+        @param length
+            The length of the data, if known, see
+            wxWebViewHandlerResponseDataStream constructor.
+
+        @since 3.3.0
+    */
+    virtual void Finish(wxInputStream* stream, wxFileOffset length = wxInvalidOffset);
+
     /**
         Finishes the request as an error.
 
@@ -754,7 +828,14 @@ public:
         }
         @endcode
 
-        @note This is only used by macOS and the Edge backend.
+        The response data is passed to the web view in chunks, so it is
+        possible to send big responses using wxWebViewHandlerResponseDataStream
+        without loading them into memory.
+
+        @note This is used by macOS, WebKitGTK and the Edge backend. With
+            WebKitGTK versions older than 2.36, only the content type of the
+            response can be set and the request method is always "GET" and
+            the request data is only available since WebKitGTK 2.40.
 
         @see GetFile()
         @since 3.3.0
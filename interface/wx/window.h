@@ -2148,6 +2148,49 @@ public:
     */
     virtual void ClearBackground();
 
+    /**
+        Type of the function which can be passed to RequestFrame().
+
+        The argument is the frame time in microseconds. Only the differences
+        between the values passed to the successive calls of the callbacks
+        are meaningful.
+
+        @since 3.3.0
+    */
+    using FrameCallback = std::function<void (wxLongLong frameTime)>;
+
+    /**
+        Calls the given function once, just before the next frame of this
+        window is drawn.
+
+        This function is meant to be used for animations and windows showing
+        frequently updated data: instead of calling Refresh() from a timer,
+        which can result in redundant repaints if it fires more often than
+        the display is refreshed, the callback should update the window state
+        and call Refresh() and then call RequestFrame() again if the window
+        needs to be updated in the next frame too. This ensures that the
+        window is repainted at most once per display frame.
+
+        All callbacks requested for the same frame are called in the order of
+        the calls to this function.
+
+        Under wxGTK 3.8 or later, the callbacks are called by the widget frame
+        clock and so are synchronized with the display refresh and are not
+        called at all while the window is hidden. In the other ports, they are
+        called from a timer firing approximately 60 times per second.
+
+        @since 3.3.0
+    */
+    void RequestFrame(const FrameCallback& callback);
+
+    /**
+        Returns @true if RequestFrame() was called and its callbacks were not
+        called yet.
+
+        @since 3.3.0
+    */
+    bool HasPendingFrameCallbacks() const;
+
     /**
         Freezes the window or, in other words, prevents any updates from taking
         place on screen, the window is not redrawn at all.
@@ -3677,6 +3720,47 @@ public:
     */
     virtual bool Layout();
 
+    /**
+        Schedules the window to be laid out later.
+
+        Unlike Layout(), this function doesn't lay out the window immediately
+        but just marks it as needing to be laid out. All the scheduled layouts
+        are performed at once when the application becomes idle, so calling
+        this function many times, e.g. after each change made to the window
+        contents, results in only a single call to Layout().
+
+        If the window is laid out in some other way before the scheduled layout
+        happens, e.g. because Layout() or Fit() is called for it explicitly,
+        the scheduled layout is cancelled.
+
+        @see IsLayoutScheduled(), ProcessScheduledLayouts()
+
+        @since 3.3.0
+    */
+    void ScheduleLayout();
+
+    /**
+        Returns @true if ScheduleLayout() was called for this window and its
+        layout has not been done yet.
+
+        @since 3.3.0
+    */
+    bool IsLayoutScheduled() const;
+
+    /**
+        Performs all the layouts scheduled by ScheduleLayout().
+
+        This function is called automatically when the application becomes
+        idle and normally doesn't need to be called explicitly, but it may be
+        useful to do it when all windows must have their final layout before
+        the next idle time.
+
+        Parent windows are laid out before their children.
+
+        @since 3.3.0
+    */
+    static void ProcessScheduledLayouts();
+
     /**
         Determines whether the Layout() function will be called automatically
         when the window is resized.
@@ -0,0 +1,366 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        windowless.h
+// Purpose:     interface of wxWindowlessControl and related classes
+// Author:      wxWidgets team
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+    @class wxWindowlessControl
+
+    Base class for lightweight controls which don't have their own window.
+
+    Windowless controls are drawn by their parent wxWindowlessPanel, which
+    also determines the control under the mouse and forwards the mouse events
+    to it and the keyboard events to the control having focus. This makes them
+    much cheaper, both in memory and in creation time, than the real controls
+    and allows using thousands of them in the same window.
+
+    The controls are event handlers and the events are sent to them in the
+    same way as they would be sent to the real windows, i.e. mouse events
+    positions are relative to the control and wxEvent::GetEventObject()
+    returns the control itself. As with real windows, the mouse and keyboard
+    events which are not processed by the control are processed by its parent
+    and command events propagate to it.
+
+    Windowless controls can't be added to sizers directly, use AddToSizer()
+    to position them using the sizers.
+
+    To define a new windowless control, derive from this class and override
+    its DoGetBestSize() and DoDraw() pure virtual functions.
+
+    @library{wxcore}
+    @category{ctrl}
+
+    @see wxWindowlessStaticText, wxWindowlessStaticBitmap
+
+    @since 3.3.0
+*/
+class wxWindowlessControl : public wxEvtHandler
+{
+public:
+    /**
+        Constructor adds the control to its parent.
+
+        The control is owned by the parent, which deletes it when it is
+        destroyed itself, but it can also be deleted directly at any moment.
+
+        @param parent
+            The parent window, must be non-null.
+        @param id
+            The control identifier, a new unique identifier is allocated if it
+            is @c wxID_ANY.
+        @param pos
+            The control position in the parent client coordinates.
+        @param size
+            The control size: any components different from @c -1 are used as
+            the minimal size of the control, instead of its best size.
+    */
+    wxWindowlessControl(wxWindowlessPanel* parent,
+                        wxWindowID id = wxID_ANY,
+                        const wxPoint& pos = wxDefaultPosition,
+                        const wxSize& size = wxDefaultSize);
+
+    /**
+        Destructor removes the control from its parent.
+    */
+    virtual ~wxWindowlessControl();
+
+    /// Returns the parent window of this control.
+    wxWindowlessPanel* GetParent() const;
+
+    /// Returns the control identifier.
+    wxWindowID GetId() const;
+
+    /**
+        Sets the position and size of the control in the parent coordinates.
+
+        The size components equal to @c -1 are replaced with the
+        corresponding components of the best size.
+    */
+    void SetSize(const wxRect& rect);
+
+    /// Sets the size of the control without changing its position.
+    void SetSize(const wxSize& size);
+
+    /// Moves the control without changing its size.
+    void Move(const wxPoint& pos);
+
+    /// Returns the rectangle covered by the control in its parent.
+    const wxRect& GetRect() const;
+
+    /// Returns the position of the control in its parent.
+    wxPoint GetPosition() const;
+
+    /// Returns the size of the control.
+    wxSize GetSize() const;
+
+    /// Sets the minimal size of the control, used by the sizers.
+    void SetMinSize(const wxSize& size);
+
+    /// Returns the minimal size set by SetMinSize().
+    wxSize GetMinSize() const;
+
+    /**
+        Returns the minimal size with its unspecified components replaced with
+        the components of the best size.
+    */
+    wxSize GetEffectiveMinSize() const;
+
+    /// Returns the size appropriate for the control contents.
+    wxSize GetBestSize() const;
+
+    /// Discards the cached best size.
+    void InvalidateBestSize();
+
+    /// Shows or hides the control, returns @true if its state changed.
+    bool Show(bool show = true);
+
+    /// Same as Show(false).
+    bool Hide();
+
+    /// Returns @true if the control is shown.
+    bool IsShown() const;
+
+    /**
+        Enables or disables the control, returns @true if its state changed.
+
+        Disabled controls don't get any mouse or keyboard events.
+    */
+    bool Enable(bool enable = true);
+
+    /// Same as Enable(false).
+    bool Disable();
+
+    /// Returns @true if the control itself is enabled.
+    bool IsThisEnabled() const;
+
+    /// Returns @true if both the control and its parent are enabled.
+    bool IsEnabled() const;
+
+    /// Sets the font used by the control, the parent font is used by default.
+    void SetFont(const wxFont& font);
+
+    /// Returns the font used by the control.
+    wxFont GetFont() const;
+
+    /**
+        Sets the colour of the control text.
+
+        The parent foreground colour is used by default.
+    */
+    void SetForegroundColour(const wxColour& colour);
+
+    /// Returns the colour of the control text.
+    wxColour GetForegroundColour() const;
+
+    /**
+        Returns @true if the control can get focus.
+
+        The controls accepting focus get it when they're clicked or when
+        SetFocus() is called. Such controls get @c wxEVT_SET_FOCUS and @c
+        wxEVT_KILL_FOCUS events and all keyboard events while they have
+        focus.
+
+        Default implementation returns @false.
+    */
+    virtual bool AcceptsFocus() const;
+
+    /// Gives focus to this control, which must accept it.
+    void SetFocus();
+
+    /// Returns @true if this control has focus.
+    bool HasFocus() const;
+
+    /// Refreshes the area of the parent covered by this control.
+    void Refresh();
+
+    /**
+        Adds the control to the given sizer.
+
+        The sizer positions the control as it would position a window.
+
+        @return The new sizer item.
+    */
+    wxSizerItem* AddToSizer(wxSizer* sizer, const wxSizerFlags& flags);
+
+    /**
+        Draws the control.
+
+        This function is called by the parent to draw the control, it sets up
+        the DC and calls DoDraw().
+    */
+    void Draw(wxDC& dc);
+
+protected:
+    /**
+        Must be overridden to return the size the control needs.
+
+        The derived class constructor should call
+        @c SetSize(GetEffectiveMinSize()) to give the control its initial size.
+    */
+    virtual wxSize DoGetBestSize() const = 0;
+
+    /**
+        Must be overridden to draw the control.
+
+        The DC is clipped to the control rectangle and already uses the
+        control font and foreground colour.
+    */
+    virtual void DoDraw(wxDC& dc, const wxRect& rect) = 0;
+
+    /**
+        Updates the control after a change of its contents.
+
+        This function invalidates the best size and updates the control
+        layout, it should be called by the derived classes when the change
+        affects the control size.
+    */
+    void UpdateAfterChange();
+};
+
+/**
+    @class wxWindowlessStaticText
+
+    Windowless equivalent of wxGenericStaticText.
+
+    The label can contain mnemonics, which are underlined but, as for
+    wxStaticText, have no other effect. Multi-line labels are supported too.
+
+    @library{wxcore}
+    @category{ctrl}
+
+    @since 3.3.0
+*/
+class wxWindowlessStaticText : public wxWindowlessControl
+{
+public:
+    /**
+        Constructor.
+
+        @param style
+            One of @c wxALIGN_LEFT (default), @c wxALIGN_CENTRE_HORIZONTAL
+            or @c wxALIGN_RIGHT.
+
+        See wxWindowlessControl::wxWindowlessControl() for the other
+        parameters.
+    */
+    wxWindowlessStaticText(wxWindowlessPanel* parent,
+                           wxWindowID id,
+                           const wxString& label,
+                           const wxPoint& pos = wxDefaultPosition,
+                           const wxSize& size = wxDefaultSize,
+                           long style = 0);
+
+    /// Changes the label, updating the control size if necessary.
+    void SetLabel(const wxString& label);
+
+    /// Returns the label, including the mnemonics.
+    const wxString& GetLabel() const;
+};
+
+/**
+    @class wxWindowlessStaticBitmap
+
+    Windowless equivalent of wxGenericStaticBitmap.
+
+    The bitmap is centred in the control if it is bigger than the bitmap.
+
+    @library{wxcore}
+    @category{ctrl}
+
+    @since 3.3.0
+*/
+class wxWindowlessStaticBitmap : public wxWindowlessControl
+{
+public:
+    /**
+        Constructor.
+
+        See wxWindowlessControl::wxWindowlessControl() for the parameters.
+    */
+    wxWindowlessStaticBitmap(wxWindowlessPanel* parent,
+                             wxWindowID id,
+                             const wxBitmapBundle& bitmap,
+                             const wxPoint& pos = wxDefaultPosition,
+                             const wxSize& size = wxDefaultSize);
+
+    /// Changes the bitmap, updating the control size if necessary.
+    void SetBitmap(const wxBitmapBundle& bitmap);
+
+    /// Returns the bitmap.
+    const wxBitmapBundle& GetBitmap() const;
+};
+
+/**
+    @class wxWindowlessPanel
+
+    Panel containing windowless controls.
+
+    This window draws all the windowless controls created with it as parent
+    in its @c wxEVT_PAINT handler, so it shouldn't be handled in the user code,
+    and forwards the mouse and keyboard events to them. It can also contain
+    normal child windows, which are always shown above the windowless
+    controls.
+
+    Only the controls intersecting the updated area are redrawn and
+    determining the control under mouse doesn't involve the windowing system,
+    so using many windowless controls is much more efficient than using the
+    same number of windows.
+
+    @library{wxcore}
+    @category{miscwnd}
+
+    @see wxWindowlessControl
+
+    @since 3.3.0
+*/
+class wxWindowlessPanel : public wxPanel
+{
+public:
+    /// Default constructor, Create() must be called later.
+    wxWindowlessPanel();
+
+    /// Constructor creating the window, see wxPanel::wxPanel().
+    wxWindowlessPanel(wxWindow *parent,
+                      wxWindowID winid = wxID_ANY,
+                      const wxPoint& pos = wxDefaultPosition,
+                      const wxSize& size = wxDefaultSize,
+                      long style = wxTAB_TRAVERSAL | wxNO_BORDER,
+                      const wxString& name = wxPanelNameStr);
+
+    /// Creates the window for two-step construction.
+    bool Create(wxWindow *parent,
+                wxWindowID winid = wxID_ANY,
+                const wxPoint& pos = wxDefaultPosition,
+                const wxSize& size = wxDefaultSize,
+                long style = wxTAB_TRAVERSAL | wxNO_BORDER,
+                const wxString& name = wxPanelNameStr);
+
+    /// Destructor deletes all windowless controls.
+    virtual ~wxWindowlessPanel();
+
+    /// Returns the number of windowless controls in this window.
+    size_t GetControlsCount() const;
+
+    /**
+        Returns the windowless control with the given index.
+
+        The controls are stored in the order of their creation, which is also
+        the order in which they're drawn.
+    */
+    wxWindowlessControl* GetControl(size_t n) const;
+
+    /// Deletes all windowless controls.
+    void DestroyControls();
+
+    /**
+        Returns the shown control at the given point or @NULL.
+
+        If several controls overlap, the last created one is returned.
+    */
+    wxWindowlessControl* HitTestControl(const wxPoint& pt) const;
+
+    /// Returns the control which has focus when this window has it.
+    wxWindowlessControl* GetFocusedControl() const;
+};
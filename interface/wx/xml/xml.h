@@ -553,7 +553,19 @@ public:
 enum wxXmlDocumentLoadFlag
 {
     wxXMLDOC_NONE,
-    wxXMLDOC_KEEP_WHITESPACE_NODES
+    wxXMLDOC_KEEP_WHITESPACE_NODES,
+
+    /**
+        Allocate the nodes and attributes from big memory blocks.
+
+        This makes loading big documents faster and uses less memory, but the
+        memory of a block is only freed once all the nodes allocated from it
+        are deleted. The nodes can still be detached from the document and
+        deleted individually as usual.
+
+        @since 3.3.0
+     */
+    wxXMLDOC_USE_ARENA
 };
 
 
@@ -572,6 +584,313 @@ struct wxXmlParseError
 };
 
 
+/**
+    @class wxXmlParseHandler
+
+    Base class for the objects notified about the elements being parsed by
+    wxXmlDocument::Load().
+
+    This allows to process the document incrementally, while it's being
+    parsed, and, by deleting the nodes which are not needed any longer, to
+    avoid keeping the entire document in memory, which can be significant for
+    big files.
+
+    Example of counting all "item" elements in a document of any size:
+    @code
+    class ItemCounter : public wxXmlParseHandler
+    {
+    public:
+        bool OnElementParsed(wxXmlNode* node) override
+        {
+            if ( node->GetName() != "item" )
+                return false;
+
+            m_count++;
+            return true;
+        }
+
+        int m_count = 0;
+    };
+
+    ItemCounter counter;
+    wxXmlDocument doc;
+    doc.Load(stream, counter);
+    @endcode
+
+    @library{wxxml}
+    @category{xml}
+
+    @since 3.3.0
+ */
+class wxXmlParseHandler
+{
+public:
+    /// Default constructor.
+    wxXmlParseHandler();
+
+    /// Trivial but virtual destructor.
+    virtual ~wxXmlParseHandler();
+
+    /**
+        Called after parsing the closing tag of an element.
+
+        When this function is called, @a node and all of its children are
+        fully parsed and @a node is the last child of its parent, which is
+        the document node for the root element.
+
+        @param node
+            The element node which has just been parsed.
+        @return
+            @true if the node is not needed any longer, in which case it is
+            removed from the document and deleted, or @false to keep it.
+     */
+    virtual bool OnElementParsed(wxXmlNode* node) = 0;
+};
+
+
+/**
+    Kinds of the items returned by wxXmlReader::Next().
+
+    @since 3.3.0
+*/
+enum wxXmlReaderEvent
+{
+    /// The entire document has been read.
+    wxXML_READER_END_DOCUMENT,
+
+    /// Parsing the document failed, use wxXmlReader::GetError() for details.
+    wxXML_READER_ERROR,
+
+    /// Start tag of an element, its name and attributes are available.
+    wxXML_READER_START_ELEMENT,
+
+    /// End tag of an element, its name is available.
+    wxXML_READER_END_ELEMENT,
+
+    /// Text contents of an element, available using wxXmlReader::GetValue().
+    wxXML_READER_TEXT,
+
+    /// Contents of a CDATA section, available using wxXmlReader::GetValue().
+    wxXML_READER_CDATA,
+
+    /// Comment, available using wxXmlReader::GetValue().
+    wxXML_READER_COMMENT,
+
+    /**
+        Processing instruction: its target is returned by
+        wxXmlReader::GetName() and its data by wxXmlReader::GetValue().
+     */
+    wxXML_READER_PI,
+
+    /// Document type declaration, available using wxXmlReader::GetDoctype().
+    wxXML_READER_DOCTYPE
+};
+
+
+/**
+    @class wxXmlStringView
+
+    Non-owning view of a string in UTF-8 encoding returned by wxXmlReader.
+
+    The view refers to the data inside wxXmlReader and is only valid until
+    the next call to wxXmlReader::Next(), use ToString() to make a copy of it
+    if it's needed for longer.
+
+    @library{wxxml}
+    @category{xml}
+
+    @since 3.3.0
+ */
+class wxXmlStringView
+{
+public:
+    /// Default constructor creates an empty view.
+    wxXmlStringView();
+
+    /// Constructor from the data pointer and length in bytes.
+    wxXmlStringView(const char* data, size_t length);
+
+    /// Returns the pointer to the data, which is not NUL-terminated.
+    const char* data() const;
+
+    /// Returns the length of the data in bytes.
+    size_t length() const;
+
+    /// Same as length().
+    size_t size() const;
+
+    /// Returns @true if the view is empty.
+    bool empty() const;
+
+    /// Returns a string containing the copy of the data.
+    wxString ToString() const;
+
+    /// Returns @true if the data is the same as the given UTF-8 string.
+    bool IsSameAs(const char* s) const;
+
+    /// Comparison operators using IsSameAs().
+    bool operator==(const char* s) const;
+    bool operator!=(const char* s) const;
+
+    /**
+        Conversion to std::string_view.
+
+        This operator is only available when using C++17 or later.
+     */
+    operator std::string_view() const;
+};
+
+
+/**
+    @class wxXmlReader
+
+    Pull parser returning the items of an XML document one by one.
+
+    Unlike wxXmlDocument, this class doesn't build the tree of wxXmlNode
+    objects representing the document and doesn't allocate memory for each of
+    its items, so it can be used to process arbitrarily big documents using
+    a constant amount of memory. The document is read from the stream only
+    as needed.
+
+    The names and values of the items are returned as wxXmlStringView objects
+    which are only valid until the next call to Next(). Text consisting of
+    several parts, e.g. containing entity references, is always returned as
+    a single wxXML_READER_TEXT item.
+
+    Example of summing the values of all "item" elements in a document:
+    @code
+    wxXmlReader reader(stream);
+    double total = 0;
+    for ( ;; )
+    {
+        switch ( reader.Next() )
+        {
+            case wxXML_READER_START_ELEMENT:
+                if ( reader.GetName() == "item" )
+                {
+                    wxXmlStringView value;
+                    if ( reader.GetAttribute("value", &value) )
+                        total += atof(value.ToString().utf8_str());
+                }
+                break;
+
+            case wxXML_READER_ERROR:
+                wxLogError("Error at line %d: %s",
+                           reader.GetError().line, reader.GetError().message);
+                return false;
+
+            case wxXML_READER_END_DOCUMENT:
+                return true;
+
+            default:
+                break;
+        }
+    }
+    @endcode
+
+    wxXmlDocument::Load() is implemented using this class.
+
+    @library{wxxml}
+    @category{xml}
+
+    @since 3.3.0
+ */
+class wxXmlReader
+{
+public:
+    /**
+        Creates the reader for the given stream.
+
+        The stream must remain valid for the lifetime of the reader.
+
+        @param stream
+            The stream to read the document from.
+        @param flags
+            Only ::wxXMLDOC_KEEP_WHITESPACE_NODES is currently supported: if
+            it is not specified, text consisting of white space only is not
+            returned.
+     */
+    explicit wxXmlReader(wxInputStream& stream, int flags = wxXMLDOC_NONE);
+
+    /**
+        Advances to the next item of the document and returns its kind.
+
+        After the end of the document is reached or an error occurs, this
+        function keeps returning the same ::wxXML_READER_END_DOCUMENT or
+        ::wxXML_READER_ERROR value.
+     */
+    wxXmlReaderEvent Next();
+
+    /// Returns the kind of the current item, i.e. the last value of Next().
+    wxXmlReaderEvent GetEvent() const;
+
+    /// Returns the element name or the processing instruction target.
+    wxXmlStringView GetName() const;
+
+    /**
+        Returns the value of the current item.
+
+        This is the text, the CDATA section or the comment contents or the
+        processing instruction data.
+     */
+    wxXmlStringView GetValue() const;
+
+    /// Returns the number of attributes of the current element.
+    size_t GetAttributeCount() const;
+
+    /// Returns the name of the attribute with the given index.
+    wxXmlStringView GetAttributeName(size_t n) const;
+
+    /// Returns the value of the attribute with the given index.
+    wxXmlStringView GetAttributeValue(size_t n) const;
+
+    /**
+        Finds the attribute with the given name.
+
+        @param name
+            The attribute name in UTF-8.
+        @param value
+            If non-null, receives the value of the attribute if it was found.
+        @return
+            @true if the current element has this attribute.
+     */
+    bool GetAttribute(const char* name, wxXmlStringView* value) const;
+
+    /// Returns the document type for ::wxXML_READER_DOCTYPE item.
+    wxXmlDoctype GetDoctype() const;
+
+    /// Returns the line number of the current item.
+    int GetLineNumber() const;
+
+    /**
+        Returns the number of elements containing the current item.
+
+        This is 0 for both the start and the end of the root element and 1 for
+        its children.
+     */
+    int GetDepth() const;
+
+    /**
+        Returns the version from the XML declaration.
+
+        This is only available after reading the declaration, i.e. after the
+        first call to Next().
+     */
+    const wxString& GetVersion() const;
+
+    /**
+        Returns the encoding from the XML declaration.
+
+        As with GetVersion(), this is only available after reading the
+        declaration and defaults to "UTF-8".
+     */
+    const wxString& GetFileEncoding() const;
+
+    /// Returns information about the error after ::wxXML_READER_ERROR.
+    const wxXmlParseError& GetError() const;
+};
+
+
 /**
     @class wxXmlDocument
 
@@ -841,6 +1160,10 @@ public:
         less memory however makes impossible to recreate exactly the loaded text with a
         Save() call later. Read the initial description of this class for more info.
 
+        If @a flags contains wxXMLDOC_USE_ARENA, the nodes are allocated from
+        big memory blocks instead of individually, which is faster for big
+        documents.
+
         Create an wxXmlParseError object and pass it to this function to get more
         information if an error occurred during XML parsing (this parameter is
         only available since wxWidgets 3.3.0).
@@ -857,6 +1180,19 @@ public:
     bool Load(wxInputStream& stream, int flags = wxXMLDOC_NONE,
               wxXmlParseError* err = nullptr);
 
+    /**
+        Like Load(wxInputStream&, int, wxXmlParseError*) but also calls the
+        given @a handler for each element as soon as it is parsed.
+
+        Notice that if the handler deletes the root node, the loaded document
+        is empty and IsOk() returns @false for it, even if the function itself
+        returns @true.
+
+        @since 3.3.0
+    */
+    bool Load(wxInputStream& stream, wxXmlParseHandler& handler,
+              int flags = wxXMLDOC_NONE, wxXmlParseError* err = nullptr);
+
     /**
         Saves XML tree creating a file named with given string.
 
@@ -874,6 +1210,77 @@ public:
     */
     virtual bool Save(wxOutputStream& stream, int indentstep = 2) const;
 
+    /**
+        Saves the document in the compact binary format.
+
+        The binary format stores each distinct string, such as element or
+        attribute name, only once and doesn't need to be parsed, so loading
+        it with LoadBinary() is much faster than loading XML. It is used for
+        the compiled XRC resources created by @c wxrc with @c \--binary
+        option, but can be used for any other documents too.
+
+        Note that this format is specific to wxWidgets and may change in
+        future versions, so it should be used only for the files created by
+        the same program version, and not for exchanging data.
+
+        @return @true on success, @false if the document is empty or an
+            error occurred while writing to the stream.
+
+        @since 3.3.0
+    */
+    bool SaveBinary(wxOutputStream& stream) const;
+
+    /**
+        Loads the document saved by SaveBinary() from memory.
+
+        The data is only used during this call and doesn't need to remain
+        valid after it returns, so it can be, for example, a memory-mapped
+        file (see wxMappedFile).
+
+        @param data Pointer to the data, starting with the signature checked
+            by IsBinary().
+        @param length Length of the data in bytes.
+        @param flags May be ::wxXMLDOC_USE_ARENA, other flags are ignored.
+        @return @true on success, @false if the data is not in the supported
+            binary format or is corrupted, an error is logged in this case.
+
+        @since 3.3.0
+    */
+    bool LoadBinary(const void* data, size_t length, int flags = wxXMLDOC_NONE);
+
+    /**
+        Loads the document saved by SaveBinary() from the given stream.
+
+        This overload reads all the data from the stream into memory and
+        then loads it.
+
+        @since 3.3.0
+    */
+    bool LoadBinary(wxInputStream& stream, int flags = wxXMLDOC_NONE);
+
+    /**
+        Returns @true if the data starts with the signature of the format
+        used by SaveBinary().
+
+        This can be used to decide whether Load() or LoadBinary() should be
+        used for loading the given data.
+
+        @since 3.3.0
+    */
+    static bool IsBinary(const void* data, size_t length);
+
+    /**
+        Returns @true if the stream contents start with the signature of the
+        format used by SaveBinary().
+
+        The data read from the stream to check for the signature is put back
+        into it using wxInputStream::Ungetch(), so the stream can still be
+        passed to Load() or LoadBinary() after calling this function.
+
+        @since 3.3.0
+    */
+    static bool IsBinary(wxInputStream& stream);
+
     /**
         Sets the document node of this document.
 
@@ -247,6 +247,12 @@ public:
         If you are sure that the argument is name of single XRC file (rather
         than an URL or a wildcard), use LoadFile() instead.
 
+        @note
+        Since wxWidgets 3.3.0 the files can also be in the compiled binary
+        format created by @c wxrc @c \--binary (see
+        wxXmlDocument::SaveBinary()). Such local files are mapped into memory
+        and loaded directly from it.
+
         @see LoadFile(), LoadAllFiles()
     */
     bool Load(const wxString& filemask);
@@ -568,6 +574,16 @@ public:
     */
     virtual bool CanHandle(wxXmlNode* node) = 0;
 
+    /**
+        Returns the classes added with AddHandledClass().
+
+        If this array is empty, as it is by default, CanHandle() is called
+        for the object nodes of all classes.
+
+        @since 3.3.0
+    */
+    const wxArrayString& GetHandledClasses() const;
+
     /**
         Sets the parent resource.
     */
@@ -587,6 +603,22 @@ protected:
     */
     void AddWindowStyles();
 
+    /**
+        Add the class (e.g. @c "wxButton") to the list of classes of the
+        object nodes which may be handled by this handler.
+
+        If any classes are added, wxXmlResource only calls CanHandle() of this
+        handler for the object nodes of these classes, which makes finding
+        the handler for each node faster. All the classes which CanHandle()
+        may return @true for must be added, including the ones handled only
+        in some context, such as @c "notebookpage", so this function is
+        usually called from the handler constructor for each class checked
+        with IsOfClass() in CanHandle().
+
+        @since 3.3.0
+    */
+    void AddHandledClass(const wxString& classname);
+
     /**
         Creates children.
     */
@@ -434,6 +434,49 @@ public:
         @see overview_archive_byname
     */
     bool OpenEntry(wxZipEntry& entry);
+
+    /**
+        Closes the current entry if one is open, then opens the entry with the
+        given name.
+
+        This is equivalent to calling OpenEntry() with the entry returned by
+        FindEntry() and, just as it, only works if the zip is on a seekable
+        stream.
+
+        @return @false if there is no entry with this name or it couldn't be
+            opened.
+
+        @since 3.3.0
+    */
+    bool OpenEntry(const wxString& name, wxPathFormat format = wxPATH_NATIVE);
+
+    /**
+        Returns the entry with the given name or @NULL if there is none.
+
+        The first call to this function reads the entire central directory of
+        the zip and builds the index of all its entries, so that finding them
+        afterwards takes constant time, independently of their number. This
+        is much faster than iterating over all the entries with GetNextEntry()
+        for a zip containing many of them, but it only works if the zip is on
+        a seekable stream. Note that wxArchiveFSHandler uses this function
+        automatically for the zip files, so that accessing the entries of big
+        zip archives via wxFileSystem is fast too.
+
+        The returned pointer is owned by the stream and remains valid until it
+        is destroyed. If the zip contains several entries with the same name,
+        the first one of them is returned.
+
+        The entry name is normalized in the same way as by
+        wxZipEntry::GetInternalName(), i.e. it uses @a format to interpret it,
+        and directories may be specified with or without the trailing slash.
+
+        This function doesn't affect the current entry nor the entries returned
+        by subsequent calls to GetNextEntry().
+
+        @since 3.3.0
+    */
+    const wxZipEntry *FindEntry(const wxString& name,
+                                wxPathFormat format = wxPATH_NATIVE);
 };
 
 
@@ -556,6 +599,25 @@ public:
     void SetLevel(int level);
     ///@}
 
+    ///@{
+    /**
+        Set the number of threads used for compressing the entries created
+        after this call.
+
+        By default, 1 thread is used, i.e. the data is compressed in the
+        thread writing it. Using more threads allows to compress the data of
+        each entry faster, see wxZlibOutputStream::SetThreadCount() for more
+        details, but notice that the entries themselves are still written
+        one after another.
+
+        These functions are only available if @c wxUSE_THREADS is 1.
+
+        @since 3.3.0
+    */
+    int GetThreadCount() const;
+    void SetThreadCount(int count);
+    ///@}
+
     /**
         Create a new directory entry (see wxArchiveEntry::IsDir) with the given
         name and timestamp.
@@ -0,0 +1,157 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        wx/zstdstream.h
+// Purpose:     Zstandard [de]compression classes documentation
+// Author:      wxWidgets team
+// Created:     2026-10-14
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+    @class wxZstdInputStream
+
+    This filter stream decompresses data in Zstandard format.
+
+    Zstandard format is used by .zst files created by zstd utility. It
+    provides compression ratios comparable to those of Gzip format used by
+    wxZlibInputStream, or better at higher compression levels, but with
+    much faster decompression.
+
+    Input consisting of several concatenated Zstandard frames is decompressed
+    as a single stream, as it is done by zstd utility itself.
+
+    This class is only available if @c wxUSE_LIBZSTD is set to 1, which
+    requires libzstd library headers and libraries to be available. When using
+    configure, @c --with-libzstd option must be used to enable it.
+
+    @library{wxbase}
+    @category{archive,streams}
+
+    @see wxInputStream, wxZlibInputStream, wxLZMAInputStream,
+        wxZstdOutputStream
+
+    @since 3.3.0
+*/
+class wxZstdInputStream : public wxFilterInputStream
+{
+public:
+    /**
+        Create decompressing stream associated with the given underlying
+        stream.
+
+        This overload does not take ownership of the @a stream.
+    */
+    wxZstdInputStream(wxInputStream& stream);
+
+    /**
+        Create decompressing stream associated with the given underlying
+        stream and takes ownership of it.
+
+        As with the base wxFilterInputStream class, passing @a stream by
+        pointer indicates that this object takes ownership of it and will
+        delete it when it is itself destroyed.
+     */
+    wxZstdInputStream(wxInputStream* stream);
+};
+
+/**
+    @class wxZstdOutputStream
+
+    This filter stream compresses data using Zstandard format.
+
+    Output generated by this class is compatible with zstd utility and
+    includes the checksum of the uncompressed data.
+
+    This class is only available if @c wxUSE_LIBZSTD is set to 1, see
+    wxZstdInputStream for more details.
+
+    @library{wxbase}
+    @category{archive,streams}
+
+    @see wxOutputStream, wxZlibOutputStream, wxLZMAOutputStream,
+        wxZstdInputStream
+
+    @since 3.3.0
+*/
+class wxZstdOutputStream : public wxFilterOutputStream
+{
+public:
+    /**
+        Create compressing stream associated with the given underlying
+        stream.
+
+        This overload does not take ownership of the @a stream.
+
+        @param stream
+            The stream to write the compressed data to.
+        @param level
+            Compression level, from 1 (fastest) to 19 (best compression) or
+            even 22 for even more memory-hungry compression. Negative values
+            other than -1 select even faster compression modes. The default
+            value of -1 corresponds to the library default level, currently 3.
+    */
+    wxZstdOutputStream(wxOutputStream& stream, int level = -1);
+
+    /**
+        Create compressing stream associated with the given underlying
+        stream and takes ownership of it.
+
+        As with the base wxFilterOutputStream class, passing @a stream by
+        pointer indicates that this object takes ownership of it and will
+        delete it when it is itself destroyed.
+     */
+    wxZstdOutputStream(wxOutputStream* stream, int level = -1);
+
+    /**
+        Use the given number of threads for compression.
+
+        If @a count is greater than 1, the input data is compressed by the
+        given number of worker threads created by libzstd itself, in parallel
+        with the calling thread. The special value 0 means using as many
+        threads as there are CPUs in the system, while 1 corresponds to the
+        default single threaded compression.
+
+        The output produced when using multiple threads is still compatible
+        with any Zstandard decoder, but may differ from the output produced
+        when using a single thread.
+
+        This function must be called before writing any data to the stream.
+
+        @return @true if the number of threads was set or @false if libzstd
+            was built without multithreading support or if some data had
+            been already written to the stream.
+
+        @since 3.3.0
+     */
+    bool SetThreadCount(int count);
+};
+
+/**
+    Filter class factory for Zstandard streams.
+
+    This factory allows creating wxZstdInputStream and wxZstdOutputStream
+    objects for the files with ".zst" extension or with "application/zstd"
+    MIME type using wxFilterClassFactory::Find().
+
+    @library{wxbase}
+    @category{archive,streams}
+
+    @since 3.3.0
+*/
+class wxZstdClassFactory : public wxFilterClassFactory
+{
+public:
+    wxZstdClassFactory();
+};
+
+/**
+    Return the version of libzstd library used by Zstandard stream classes.
+
+    @see wxVersionInfo
+
+    @header{wx/zstdstream.h}
+    @library{wxbase}
+
+    @since 3.3.0
+*/
+wxVersionInfo wxGetLibZstdVersionInfo();
@@ -84,10 +84,49 @@ public:
         will inflate corrupted data.
 
         Returns @true if the dictionary was successfully set.
+
+        Notice that the dictionary can't be used when compressing the data
+        using multiple threads, see SetThreadCount(), and this function
+        always returns @false in this case.
     */
     bool SetDictionary(const char *data, size_t datalen);
     bool SetDictionary(const wxMemoryBuffer &buf);
     ///@}
+
+    /**
+        Compress the data using multiple threads.
+
+        When using more than one thread, the data written to the stream is
+        split into blocks of 128KiB which are compressed independently by the
+        worker threads of the global wxThreadPool, in the same way as done by
+        the @c pigz utility. The output remains a valid zlib, gzip or raw
+        deflate stream which can be decompressed by wxZlibInputStream or any
+        other program as usual, but it is slightly bigger than the one
+        produced when using a single thread: this is the price to pay for
+        much faster compression of big amounts of data on multi-core systems.
+
+        As the blocks are compressed asynchronously, errors are only detected
+        when their output is written to the underlying stream, which may only
+        happen when Sync() or Close() is called.
+
+        This function must be called before writing anything to the stream,
+        typically immediately after creating it, and before calling
+        SetDictionary(), as preset dictionaries are not supported in this
+        mode.
+
+        @param count The maximal number of threads to use, 0 means to use as
+            many threads as wxThreadPool::GetMaxThreads() and 1 means to
+            compress the data in the thread writing to the stream, which is
+            the default behaviour. Notice that no more than
+            wxThreadPool::GetMaxThreads() threads are used in any case.
+        @return @true if the number of threads was changed or @false if it's
+            too late to do it because some data had been already written.
+
+        This function is only available if @c wxUSE_THREADS is 1.
+
+        @since 3.3.0
+    */
+    bool SetThreadCount(int count);
 };
 
 
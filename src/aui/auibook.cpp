@@ -74,6 +74,7 @@ wxAuiTabContainer::wxAuiTabContainer()
 {
     m_tabOffset = 0;
     m_flags = 0;
+    m_tabSizesScale = 0.0;
     m_art = new wxAuiDefaultTabArt;
 
     AddButton(wxAUI_BUTTON_LEFT, wxLEFT);
@@ -96,6 +97,8 @@ void wxAuiTabContainer::SetArtProvider(wxAuiTabArt* art)
     {
         m_art->SetFlags(m_flags);
     }
+
+    InvalidateTabSizes();
 }
 
 wxAuiTabArt* wxAuiTabContainer::GetArtProvider() const
@@ -134,6 +137,8 @@ void wxAuiTabContainer::SetFlags(unsigned int flags)
     {
         m_art->SetFlags(m_flags);
     }
+
+    InvalidateTabSizes();
 }
 
 unsigned int wxAuiTabContainer::GetFlags() const
@@ -145,16 +150,22 @@ unsigned int wxAuiTabContainer::GetFlags() const
 void wxAuiTabContainer::SetNormalFont(const wxFont& font)
 {
     m_art->SetNormalFont(font);
+
+    InvalidateTabSizes();
 }
 
 void wxAuiTabContainer::SetSelectedFont(const wxFont& font)
 {
     m_art->SetSelectedFont(font);
+
+    InvalidateTabSizes();
 }
 
 void wxAuiTabContainer::SetMeasuringFont(const wxFont& font)
 {
     m_art->SetMeasuringFont(font);
+
+    InvalidateTabSizes();
 }
 
 void wxAuiTabContainer::SetColour(const wxColour& colour)
@@ -175,6 +186,10 @@ void wxAuiTabContainer::SetRect(const wxRect& rect, wxWindow* wnd)
     {
         m_art->SetSizingInfo(rect.GetSize(), m_pages.GetCount(), wnd);
     }
+
+    // sizing information may affect the tab sizes, e.g. when using fixed
+    // width tabs
+    InvalidateTabSizes();
 }
 
 bool wxAuiTabContainer::AddPage(wxWindow* page,
@@ -191,6 +206,7 @@ bool wxAuiTabContainer::AddPage(wxWindow* page,
     if (m_art)
     {
         m_art->SetSizingInfo(m_rect.GetSize(), m_pages.GetCount(), page);
+        InvalidateTabSizes();
     }
 
     return true;
@@ -214,6 +230,7 @@ bool wxAuiTabContainer::InsertPage(wxWindow* page,
     if (m_art)
     {
         m_art->SetSizingInfo(m_rect.GetSize(), m_pages.GetCount(), page);
+        InvalidateTabSizes();
     }
 
     return true;
@@ -252,6 +269,7 @@ bool wxAuiTabContainer::RemovePage(wxWindow* wnd)
             if (m_art)
             {
                 m_art->SetSizingInfo(m_rect.GetSize(), m_pages.GetCount(), wnd);
+                InvalidateTabSizes();
             }
 
             return true;
@@ -411,6 +429,58 @@ int wxAuiTabContainer::GetCloseButtonState(const wxAuiNotebookPage& page) const
 }
 
 
+void wxAuiTabContainer::InvalidateTabSizes()
+{
+    m_tabSizes.clear();
+}
+
+wxSize wxAuiTabContainer::GetTabSize(wxDC& dc,
+                                     wxWindow* wnd,
+                                     size_t idx,
+                                     int* x_extent)
+{
+    const double scale = wnd->GetDPIScaleFactor();
+    if ( scale != m_tabSizesScale )
+    {
+        InvalidateTabSizes();
+        m_tabSizesScale = scale;
+    }
+
+    if ( m_tabSizes.size() != m_pages.GetCount() )
+        m_tabSizes.resize(m_pages.GetCount());
+
+    const wxAuiNotebookPage& page = m_pages.Item(idx);
+    const int closeButtonState = GetCloseButtonState(page);
+
+    // Measuring the text is relatively expensive, so only do it if anything
+    // affecting the tab size has changed since the last time.
+    TabSizeInfo& info = m_tabSizes[idx];
+    if ( info.size == wxSize() ||
+            info.caption != page.caption ||
+                !info.bitmap.IsSameAs(page.bitmap) ||
+                    info.active != page.active ||
+                        info.closeButtonState != closeButtonState )
+    {
+        info.caption = page.caption;
+        info.bitmap = page.bitmap;
+        info.active = page.active;
+        info.closeButtonState = closeButtonState;
+
+        info.extent = 0;
+        info.size = m_art->GetTabSize(dc,
+                                      wnd,
+                                      page.caption,
+                                      page.bitmap,
+                                      page.active,
+                                      closeButtonState,
+                                      &info.extent);
+    }
+
+    *x_extent = info.extent;
+
+    return info.size;
+}
+
 // Render() renders the tab catalog to the specified DC
 // It is a virtual function and can be overridden to
 // provide custom drawing capabilities
@@ -435,10 +505,16 @@ void wxAuiTabContainer::Render(wxDC* raw_dc, wxWindow* wnd)
     // text is rendered correctly
     dc.SetLayoutDirection(raw_dc->GetLayoutDirection());
 
-    wxBitmap bmp;
-    // create off-screen bitmap
-    bmp.Create(m_rect.GetWidth(), m_rect.GetHeight(),*raw_dc);
-    dc.SelectObject(bmp);
+    // create off-screen bitmap, reusing the one from the last time if it has
+    // the right size
+    if ( !m_renderBitmap.IsOk() ||
+            m_renderBitmap.GetLogicalSize() != m_rect.GetSize() ||
+                m_renderBitmap.GetScaleFactor() != raw_dc->GetContentScaleFactor() )
+    {
+        m_renderBitmap.Create(m_rect.GetWidth(), m_rect.GetHeight(), *raw_dc);
+    }
+
+    dc.SelectObject(m_renderBitmap);
 
     if (!dc.IsOk())
         return;
@@ -454,16 +530,8 @@ void wxAuiTabContainer::Render(wxDC* raw_dc, wxWindow* wnd)
     int visible_width = 0;
     for (i = 0; i < page_count; ++i)
     {
-        wxAuiNotebookPage& page = m_pages.Item(i);
-
         int x_extent = 0;
-        wxSize size = m_art->GetTabSize(dc,
-                            wnd,
-                            page.caption,
-                            page.bitmap,
-                            page.active,
-                            GetCloseButtonState(page),
-                            &x_extent);
+        wxSize size = GetTabSize(dc, wnd, i, &x_extent);
 
         if (i+1 < page_count)
             total_width += x_extent;
@@ -796,21 +864,13 @@ bool wxAuiTabContainer::IsTabVisible(int tabPage, int tabOffset, wxDC* dc, wxWin
     // See if the given page is visible at the given tab offset (effectively scroll position)
     for (i = tabOffset; i < page_count; ++i)
     {
-        wxAuiNotebookPage& page = m_pages.Item(i);
-
         rect.width = m_rect.width - right_buttons_width - offset - wnd->FromDIP(2);
 
         if (rect.width <= 0)
             return false; // haven't found the tab, and we've run out of space, so return false
 
         int x_extent = 0;
-        m_art->GetTabSize(*dc,
-                            wnd,
-                            page.caption,
-                            page.bitmap,
-                            page.active,
-                            GetCloseButtonState(page),
-                            &x_extent);
+        GetTabSize(*dc, wnd, i, &x_extent);
 
         offset += x_extent;
 
@@ -3316,20 +3376,20 @@ void wxAuiNotebook::OnTabRightUp(wxAuiNotebookEvent& evt)
 void wxAuiNotebook::SetNormalFont(const wxFont& font)
 {
     m_normalFont = font;
-    GetArtProvider()->SetNormalFont(font);
+    m_tabs.SetNormalFont(font);
 }
 
 // Sets the selected tab font
 void wxAuiNotebook::SetSelectedFont(const wxFont& font)
 {
     m_selectedFont = font;
-    GetArtProvider()->SetSelectedFont(font);
+    m_tabs.SetSelectedFont(font);
 }
 
 // Sets the measuring font
 void wxAuiNotebook::SetMeasuringFont(const wxFont& font)
 {
-    GetArtProvider()->SetMeasuringFont(font);
+    m_tabs.SetMeasuringFont(font);
 }
 
 // Sets the tab font
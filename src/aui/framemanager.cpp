@@ -27,6 +27,7 @@
 #include "wx/aui/auibar.h"
 #include "wx/mdi.h"
 #include "wx/wupdlock.h"
+#include "wx/stopwatch.h"
 
 #ifndef WX_PRECOMP
     #include "wx/panel.h"
@@ -676,6 +677,9 @@ void wxAuiManager::SetArtProvider(wxAuiDockArt* art_provider)
 
     // assign the new art provider
     m_art = art_provider;
+
+    // and ensure the layout is redone using it during the next update
+    m_layoutKey.clear();
 }
 
 
@@ -2180,11 +2184,89 @@ void wxAuiManager::GetDockSizeConstraint(double* width_pct, double* height_pct)
 // one or more panes, this function should be called.  It is the
 // external entry point for running the layout engine.
 
+void wxAuiManager::GetLayoutKey(std::vector<wxUIntPtr>& key) const
+{
+    key.clear();
+
+    key.push_back(wxPtrToUInt(m_frame));
+    key.push_back(wxPtrToUInt(m_art));
+    key.push_back(m_flags);
+    key.push_back(m_hasMaximized);
+    key.push_back(static_cast<wxUIntPtr>(m_dockConstraintX * 1000000));
+    key.push_back(static_cast<wxUIntPtr>(m_dockConstraintY * 1000000));
+
+    const wxSize cli_size = m_frame->GetClientSize();
+    key.push_back(cli_size.x);
+    key.push_back(cli_size.y);
+    key.push_back(m_frame->FromDIP(100));
+
+    static const int metrics[] =
+    {
+        wxAUI_DOCKART_SASH_SIZE,
+        wxAUI_DOCKART_CAPTION_SIZE,
+        wxAUI_DOCKART_GRIPPER_SIZE,
+        wxAUI_DOCKART_PANE_BORDER_SIZE,
+        wxAUI_DOCKART_PANE_BUTTON_SIZE,
+    };
+    for ( size_t n = 0; n < WXSIZEOF(metrics); n++ )
+        key.push_back(m_art->GetMetric(metrics[n]));
+
+    // Note that we include the addresses of the panes and docks too, as the
+    // UI parts store pointers to them and so must be recreated if they move.
+    for ( size_t n = 0; n < m_panes.GetCount(); n++ )
+    {
+        const wxAuiPaneInfo& p = m_panes.Item(n);
+
+        key.push_back(wxPtrToUInt(&p));
+        key.push_back(wxPtrToUInt(p.window));
+        key.push_back(p.state & ~wxAuiPaneInfo::optionActive);
+        key.push_back(p.dock_direction);
+        key.push_back(p.dock_layer);
+        key.push_back(p.dock_row);
+        key.push_back(p.dock_pos);
+        key.push_back(p.dock_proportion);
+        key.push_back(p.best_size.x);
+        key.push_back(p.best_size.y);
+        key.push_back(p.min_size.x);
+        key.push_back(p.min_size.y);
+        key.push_back(p.max_size.x);
+        key.push_back(p.max_size.y);
+
+        // The size of the fixed docks depends on the size of their panes
+        // windows if they don't specify any size explicitly.
+        if ( p.best_size == wxDefaultSize && p.min_size == wxDefaultSize )
+        {
+            const wxSize size = p.window->GetSize();
+            key.push_back(size.x);
+            key.push_back(size.y);
+        }
+    }
+
+    for ( size_t n = 0; n < m_docks.GetCount(); n++ )
+    {
+        const wxAuiDockInfo& dock = m_docks.Item(n);
+
+        key.push_back(wxPtrToUInt(&dock));
+        key.push_back(dock.dock_direction);
+        key.push_back(dock.dock_layer);
+        key.push_back(dock.dock_row);
+        key.push_back(dock.size);
+        key.push_back(dock.min_size);
+        key.push_back(dock.resizable);
+        key.push_back(dock.toolbar);
+        key.push_back(dock.fixed);
+    }
+}
+
 void wxAuiManager::Update()
 {
     m_hoverButton = nullptr;
     m_actionPart = nullptr;
 
+#if wxUSE_STOPWATCH
+    wxStopWatch sw;
+#endif // wxUSE_STOPWATCH
+
     wxSizer* sizer;
     int i, pane_count = m_panes.GetCount();
 
@@ -2245,11 +2327,25 @@ void wxAuiManager::Update()
         noUpdates.Lock(m_frame);
 #endif // __WXMSW__
 
-    // delete old sizer first
-    m_frame->SetSizer(nullptr);
+    // If nothing affecting the layout of the docked panes has changed since
+    // the last update, we can reuse the existing sizers and UI parts and
+    // only need to update the panes visibility and the floating frames.
+    std::vector<wxUIntPtr> layoutKey;
+    GetLayoutKey(layoutKey);
 
-    // create a layout for all of the panes
-    sizer = LayoutAll(m_panes, m_docks, m_uiParts, false);
+    const bool relayout = !m_frame->GetSizer() || layoutKey != m_layoutKey;
+    if ( relayout )
+    {
+        // delete old sizer first
+        m_frame->SetSizer(nullptr);
+
+        // create a layout for all of the panes
+        sizer = LayoutAll(m_panes, m_docks, m_uiParts, false);
+    }
+    else
+    {
+        sizer = m_frame->GetSizer();
+    }
 
     // hide or show panes as necessary,
     // and float panes as necessary
@@ -2325,6 +2421,17 @@ void wxAuiManager::Update()
     }
 
 
+    if ( !relayout )
+    {
+        Repaint();
+
+#if wxUSE_STOPWATCH
+        wxLogTrace("aui", "Update() reused the existing layout in %ldms",
+                   sw.Time());
+#endif // wxUSE_STOPWATCH
+        return;
+    }
+
     // keep track of the old window rectangles so we can
     // refresh those windows whose rect has changed
     std::vector<wxRect> old_pane_rects;
@@ -2369,6 +2476,16 @@ void wxAuiManager::Update()
 
     Repaint();
 
+    // Remember the state corresponding to the current layout: notice that it
+    // must be done after laying out the frame, as this can change the sizes
+    // of the windows used in the key.
+    GetLayoutKey(m_layoutKey);
+
+#if wxUSE_STOPWATCH
+    wxLogTrace("aui", "Update() recreated the layout of %d panes in %ldms",
+               pane_count, sw.Time());
+#endif // wxUSE_STOPWATCH
+
     // set frame's minimum size
 
 /*
@@ -35,6 +35,7 @@
 #include "wx/cmdline.h"
 #include "wx/confbase.h"
 #include "wx/evtloop.h"
+#include "wx/evtprofiler.h"
 #include "wx/filename.h"
 #include "wx/msgout.h"
 #include "wx/scopedptr.h"
@@ -410,6 +411,11 @@ void wxAppConsoleBase::WakeUpIdle()
 
 bool wxAppConsoleBase::ProcessIdle()
 {
+    // GUI applications measure the total idle time, including the part spent
+    // here, in their overridden version.
+    const wxLongLong_t profileStart = IsGUI() ? -1
+                                              : wxEventProfiler::StartTiming();
+
     // synthesize an idle event and check if more of them are needed
     wxIdleEvent event;
     event.SetEventObject(this);
@@ -424,6 +430,9 @@ bool wxAppConsoleBase::ProcessIdle()
     // Garbage collect all objects previously scheduled for destruction.
     DeletePendingObjects();
 
+    if ( profileStart != -1 )
+        wxEventProfiler::OnIdleEnd(profileStart);
+
     return event.MoreRequested();
 }
 
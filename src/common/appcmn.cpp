@@ -38,6 +38,7 @@
 #include "wx/thread.h"
 #include "wx/vidmode.h"
 #include "wx/evtloop.h"
+#include "wx/evtprofiler.h"
 #include "wx/uilocale.h"
 
 #if wxUSE_FONTMAP
@@ -406,9 +407,16 @@ bool wxAppBase::SafeYieldFor(wxWindow *win, long eventsToProcess)
 // Returns true if more time is needed.
 bool wxAppBase::ProcessIdle()
 {
+    const wxLongLong_t profileStart = wxEventProfiler::StartTiming();
+
     // call the base class version first to send the idle event to wxTheApp
     // itself
     bool needMore = wxAppConsoleBase::ProcessIdle();
+
+    // do the layouts scheduled since the last time before anything else, so
+    // that the idle event handlers see the windows in their final state
+    wxWindow::ProcessScheduledLayouts();
+
     wxIdleEvent event;
     wxWindowList::compatibility_iterator node = wxTopLevelWindows.GetFirst();
     while (node)
@@ -424,6 +432,9 @@ bool wxAppBase::ProcessIdle()
 
     wxUpdateUIEvent::ResetUpdateTime();
 
+    if ( profileStart != -1 )
+        wxEventProfiler::OnIdleEnd(profileStart);
+
     return needMore;
 }
 
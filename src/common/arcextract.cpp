@@ -0,0 +1,462 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        src/common/arcextract.cpp
+// Purpose:     wxArchiveExtractor implementation
+// Author:      wxWidgets team
+// Created:     2026-10-14
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+// ============================================================================
+// declarations
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// headers
+// ----------------------------------------------------------------------------
+
+// for compilers that support precompilation, includes "wx.h".
+#include "wx/wxprec.h"
+
+
+#if wxUSE_STREAMS && wxUSE_ARCHIVE_STREAMS && wxUSE_FFILE
+
+#include "wx/arcextract.h"
+
+#ifndef WX_PRECOMP
+    #include "wx/log.h"
+    #include "wx/translation.h"
+    #include "wx/utils.h"
+#endif // WX_PRECOMP
+
+#include "wx/filename.h"
+#include "wx/wfstream.h"
+
+#if wxUSE_TARSTREAM
+    #include "wx/tarstrm.h"
+#endif
+#if wxUSE_ZIPSTREAM
+    #include "wx/zipstrm.h"
+#endif
+
+#if wxUSE_THREADS
+    #include "wx/msgqueue.h"
+    #include "wx/threadpool.h"
+#endif
+
+#include <memory>
+#include <vector>
+
+// ----------------------------------------------------------------------------
+// event tables and such
+// ----------------------------------------------------------------------------
+
+wxDEFINE_EVENT( wxEVT_ARCHIVE_EXTRACT, wxArchiveExtractorEvent );
+
+wxIMPLEMENT_DYNAMIC_CLASS(wxArchiveExtractorEvent, wxEvent);
+
+// ----------------------------------------------------------------------------
+// private types
+// ----------------------------------------------------------------------------
+
+// Information about an archive entry collected before extracting it.
+struct wxArchiveExtractor::Item
+{
+    // The entry itself, which is used only for opening it and is not
+    // modified otherwise.
+    std::unique_ptr<wxArchiveEntry> entry;
+
+    // The entry name and the full path of the corresponding file.
+    wxString name,
+             path;
+
+    wxFileOffset size = 0;
+};
+
+namespace
+{
+
+// The size of the buffer used for copying the data of each entry.
+const size_t COPY_BUFFER_SIZE = 65536;
+
+// Return the full path of the file or directory to create for the given entry
+// inside the destination directory or empty string if the entry name is
+// invalid or unsafe, i.e. would result in creating a file outside of it.
+wxString GetEntryPath(const wxString& destDir, const wxArchiveEntry& entry)
+{
+    const wxString name = entry.GetName();
+    const wxFileName fn = entry.IsDir() ? wxFileName::DirName(name)
+                                        : wxFileName::FileName(name);
+
+    if ( fn.IsAbsolute() || fn.HasVolume() )
+        return wxString();
+
+    const wxArrayString& dirs = fn.GetDirs();
+    for ( size_t n = 0; n < dirs.size(); n++ )
+    {
+        if ( dirs[n] == wxS("..") )
+            return wxString();
+    }
+
+    if ( entry.IsDir() )
+        return dirs.empty() ? wxString() : destDir + wxFILE_SEP_PATH + fn.GetPath();
+
+    if ( !fn.HasName() || fn.GetFullName() == wxS("..") )
+        return wxString();
+
+    return destDir + wxFILE_SEP_PATH + fn.GetFullPath();
+}
+
+// Return the permissions to use for the file or directory created for the
+// given entry.
+int GetEntryPermissions(const wxArchiveEntry& entry)
+{
+    // Don't set any special bits, such as set-user-ID one, even if they're
+    // present in the archive, as this could be dangerous.
+    const int mask = wxPOSIX_USER_READ | wxPOSIX_USER_WRITE | wxPOSIX_USER_EXECUTE |
+                     wxPOSIX_GROUP_READ | wxPOSIX_GROUP_WRITE | wxPOSIX_GROUP_EXECUTE |
+                     wxPOSIX_OTHERS_READ | wxPOSIX_OTHERS_WRITE | wxPOSIX_OTHERS_EXECUTE;
+
+#if wxUSE_ZIPSTREAM
+    if ( const wxZipEntry* const zip = dynamic_cast<const wxZipEntry*>(&entry) )
+        return zip->GetMode() & mask;
+#endif
+#if wxUSE_TARSTREAM
+    if ( const wxTarEntry* const tar = dynamic_cast<const wxTarEntry*>(&entry) )
+        return tar->GetMode() & mask;
+#endif
+
+    // For the other formats we only know whether the entry is read-only.
+    int perms = entry.IsDir() ? wxS_DIR_DEFAULT : wxS_DEFAULT;
+    if ( entry.IsReadOnly() )
+        perms &= ~(wxPOSIX_USER_WRITE | wxPOSIX_GROUP_WRITE | wxPOSIX_OTHERS_WRITE);
+    return perms;
+}
+
+// Set the modification time and permissions of the file or directory created
+// for the given entry.
+void SetEntryAttributes(const wxString& path, const wxArchiveEntry& entry)
+{
+    wxFileName fn = entry.IsDir() ? wxFileName::DirName(path)
+                                  : wxFileName::FileName(path);
+
+#if wxUSE_DATETIME
+    // Notice that this must be done before changing the permissions, as the
+    // file may become read-only.
+    const wxDateTime dt = entry.GetDateTime();
+    if ( dt.IsValid() )
+        fn.SetTimes(&dt, &dt, nullptr);
+#endif // wxUSE_DATETIME
+
+    fn.SetPermissions(GetEntryPermissions(entry));
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// wxArchiveExtractor implementation
+// ============================================================================
+
+wxArchiveExtractor::wxArchiveExtractor(const wxString& archive,
+                                       const wxArchiveClassFactory* factory)
+    : m_archive(archive),
+      m_factory(factory)
+{
+    if ( !m_factory )
+        m_factory = wxArchiveClassFactory::Find(archive, wxSTREAM_FILEEXT);
+}
+
+void wxArchiveExtractor::SetThreadCount(int count)
+{
+    wxCHECK_RET( count >= 0, wxS("invalid number of threads") );
+
+    m_threadCount = count;
+}
+
+wxArchiveInputStream*
+wxArchiveExtractor::OpenArchive(wxInputStream* stream) const
+{
+    std::unique_ptr<wxInputStream> ptr(stream);
+    if ( !ptr->IsOk() )
+        return nullptr;
+
+    return m_factory->NewStream(ptr.release());
+}
+
+void wxArchiveExtractor::SendProgressEvent(const Item& item, bool ok)
+{
+    m_countDone++;
+    m_sizeDone += item.size;
+
+    wxArchiveExtractorEvent event(wxEVT_ARCHIVE_EXTRACT);
+    event.SetEventObject(this);
+    event.m_entryName = item.name;
+    event.m_path = item.path;
+    event.m_ok = ok;
+    event.m_countDone = m_countDone;
+    event.m_countTotal = m_countTotal;
+    event.m_sizeDone = m_sizeDone;
+    event.m_sizeTotal = m_sizeTotal;
+
+    ProcessEvent(event);
+}
+
+/* static */
+bool wxArchiveExtractor::ExtractFile(wxArchiveInputStream& arc,
+                                     const Item& item,
+                                     char* buf,
+                                     size_t bufSize)
+{
+    // Use a copy of the entry as opening it may modify it.
+    std::unique_ptr<wxArchiveEntry> entry(item.entry->Clone());
+    if ( !arc.OpenEntry(*entry) )
+    {
+        wxLogError(_("Failed to open archive entry \"%s\"."), item.name);
+        return false;
+    }
+
+    wxFFileOutputStream out(item.path);
+    if ( !out.IsOk() )
+        return false;
+
+    while ( arc.Read(buf, bufSize).LastRead() )
+    {
+        if ( !out.WriteAll(buf, arc.LastRead()) )
+            break;
+    }
+
+    // Notice that some formats, e.g. ZIP, only detect errors, such as CRC
+    // mismatch, at the end of the entry data.
+    if ( arc.GetLastError() != wxSTREAM_EOF )
+    {
+        wxLogError(_("Failed to extract archive entry \"%s\"."), item.name);
+        return false;
+    }
+
+    if ( !out.Close() )
+        return false;
+
+    arc.CloseEntry();
+
+    SetEntryAttributes(item.path, *entry);
+
+    return true;
+}
+
+template <typename F>
+void wxArchiveExtractor::ExtractFiles(const Item* items,
+                                      size_t count,
+                                      std::atomic<size_t>& next,
+                                      F report)
+{
+    // Each thread uses its own stream, as the streams can be only used
+    // sequentially, but all of them read the same file and, as it's
+    // seekable, can open any of its entries independently of the others.
+    std::unique_ptr<wxArchiveInputStream>
+        arc(OpenArchive(new wxFFileInputStream(m_archive)));
+
+    wxCharBuffer buf(COPY_BUFFER_SIZE);
+
+    for ( ;; )
+    {
+        const size_t n = next++;
+        if ( n >= count || m_cancelled )
+            break;
+
+        report(n, arc && ExtractFile(*arc, items[n], buf.data(), buf.length()));
+    }
+}
+
+bool wxArchiveExtractor::Extract(const wxString& destDir)
+{
+    m_cancelled = false;
+    m_countDone =
+    m_countTotal = 0;
+    m_sizeDone =
+    m_sizeTotal = 0;
+
+    if ( !m_factory )
+    {
+        wxLogError(_("Unknown format of archive \"%s\"."), m_archive);
+        return false;
+    }
+
+    // Start by collecting all the entries: this is relatively fast for
+    // seekable streams, as the data of the entries is just skipped.
+    std::unique_ptr<wxArchiveInputStream>
+        arc(OpenArchive(new wxFFileInputStream(m_archive)));
+    if ( !arc )
+        return false;
+
+    bool ok = true;
+
+    std::vector<Item> dirs,
+                      files;
+    for ( ;; )
+    {
+        std::unique_ptr<wxArchiveEntry> entry(arc->GetNextEntry());
+        if ( !entry )
+            break;
+
+        Item item;
+        item.name = entry->GetName();
+        item.path = GetEntryPath(destDir, *entry);
+        if ( item.path.empty() )
+        {
+            wxLogError(_("Not extracting archive entry \"%s\" with invalid name."),
+                       item.name);
+            ok = false;
+            continue;
+        }
+
+        const bool isDir = entry->IsDir();
+        item.entry = std::move(entry);
+        (isDir ? dirs : files).push_back(std::move(item));
+    }
+
+    if ( arc->GetLastError() != wxSTREAM_EOF )
+    {
+        wxLogError(_("Failed to read archive \"%s\"."), m_archive);
+        return false;
+    }
+
+    // The size of the entries may be only known once the entire archive has
+    // been read, so only do it now.
+    for ( auto& item : files )
+    {
+        item.size = wxMax(item.entry->GetSize(), 0);
+        m_sizeTotal += item.size;
+    }
+
+    m_countTotal = dirs.size() + files.size();
+
+    // Create all the directories, including the ones not explicitly present
+    // in the archive, first, to avoid doing it from multiple threads later.
+    if ( !wxFileName::Mkdir(destDir, wxS_DIR_DEFAULT, wxPATH_MKDIR_FULL) )
+        return false;
+
+    for ( const auto& item : dirs )
+    {
+        const bool rc = wxFileName::Mkdir(item.path, wxS_DIR_DEFAULT,
+                                          wxPATH_MKDIR_FULL);
+        if ( !rc )
+            ok = false;
+
+        SendProgressEvent(item, rc);
+
+        if ( m_cancelled )
+            return false;
+    }
+
+    // Entries are usually sorted by directory, so this avoids checking for
+    // the same directory existence repeatedly.
+    wxString lastParent;
+    for ( const auto& item : files )
+    {
+        const wxString parent = wxFileName::FileName(item.path).GetPath();
+        if ( parent == lastParent )
+            continue;
+
+        if ( !wxFileName::Mkdir(parent, wxS_DIR_DEFAULT, wxPATH_MKDIR_FULL) )
+            ok = false;
+
+        lastParent = parent;
+    }
+
+    // Now extract all the files.
+    std::atomic<size_t> next{0};
+    const size_t count = files.size();
+
+    size_t numThreads = 1;
+
+#if wxUSE_THREADS
+    wxThreadPool& pool = wxThreadPool::Get();
+
+    // Don't use the other threads of the pool from one of them, this could
+    // result in a deadlock, as we block until all of them are done.
+    if ( !pool.IsWorkerThread() )
+    {
+        numThreads = m_threadCount ? m_threadCount : pool.GetMaxThreads();
+        numThreads = wxMin(numThreads, count);
+    }
+
+    if ( numThreads > 1 )
+    {
+        // The threads report their progress using this queue, with the
+        // special index value indicating that the thread has terminated.
+        const size_t THREAD_DONE = static_cast<size_t>(-1);
+
+        struct Result
+        {
+            size_t index;
+            bool ok;
+        };
+
+        wxMessageQueue<Result> results;
+
+        std::vector<std::future<void>> tasks;
+        for ( size_t n = 0; n < numThreads; n++ )
+        {
+            tasks.push_back(pool.Submit([&]()
+                {
+                    ExtractFiles(files.data(), count, next,
+                                 [&results](size_t index, bool rc)
+                                 {
+                                     results.Post(Result{index, rc});
+                                 });
+
+                    results.Post(Result{THREAD_DONE, true});
+                }));
+        }
+
+        // Send the progress events from this thread, as expected by the
+        // event handlers.
+        for ( size_t running = numThreads; running; )
+        {
+            Result result;
+            if ( results.Receive(result) != wxMSGQUEUE_NO_ERROR )
+                break;
+
+            if ( result.index == THREAD_DONE )
+            {
+                running--;
+                continue;
+            }
+
+            if ( !result.ok )
+                ok = false;
+
+            // Don't send any more events after cancelling, even if some
+            // entries were still extracted by the other threads meanwhile.
+            if ( !m_cancelled )
+                SendProgressEvent(files[result.index], result.ok);
+        }
+
+        for ( auto& task : tasks )
+            task.get();
+    }
+    else
+#endif // wxUSE_THREADS
+    {
+        ExtractFiles(files.data(), count, next,
+                     [&](size_t index, bool rc)
+                     {
+                         if ( !rc )
+                             ok = false;
+
+                         SendProgressEvent(files[index], rc);
+                     });
+    }
+
+    if ( m_cancelled )
+        return false;
+
+    // Finally set the directories attributes: this must be done after
+    // creating all the files as doing it changes their modification time.
+    for ( const auto& item : dirs )
+        SetEntryAttributes(item.path, *item.entry);
+
+    return ok;
+}
+
+#endif // wxUSE_STREAMS && wxUSE_ARCHIVE_STREAMS && wxUSE_FFILE
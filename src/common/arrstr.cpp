@@ -22,8 +22,76 @@
 #include "wx/beforestd.h"
 #include <algorithm>
 #include <functional>
+#include <vector>
 #include "wx/afterstd.h"
 
+// wxCmpNatural() is implemented using the native functions under these
+// platforms and just forwards to wxCmpNaturalGeneric() elsewhere.
+#if defined(__WINDOWS__) || defined(__DARWIN__) || defined(__WXOSX_IPHONE__)
+    #define wxHAS_NATIVE_CMP_NATURAL
+#endif
+
+namespace
+{
+
+// Sort the strings using wxCmpNaturalGeneric() order, defined below.
+void SortStringsNatural(wxString* first, wxString* last);
+
+// Sort the strings in the given range using the provided comparison function
+// or just wxString::Cmp() if it is null.
+void SortStrings(wxString* first,
+                 wxString* last,
+                 wxArrayString::CompareFunction function)
+{
+    if ( !function )
+    {
+        std::sort(first, last);
+        return;
+    }
+
+    // Natural comparison is very expensive as it splits both strings in
+    // fragments every time it is called, so do it only once for each string
+    // instead of doing it O(N log N) times.
+    if ( function == wxCmpNaturalGeneric
+#ifndef wxHAS_NATIVE_CMP_NATURAL
+            || function == wxCmpNatural
+#endif
+       )
+    {
+        SortStringsNatural(first, last);
+        return;
+    }
+
+    std::sort(first, last,
+              [function](const wxString& s1, const wxString& s2)
+              {
+                  return function(s1, s2) < 0;
+              }
+             );
+}
+
+// Merge 2 sorted consecutive ranges of strings.
+void MergeStrings(wxString* first,
+                  wxString* middle,
+                  wxString* last,
+                  wxArrayString::CompareFunction function)
+{
+    if ( !function )
+    {
+        std::inplace_merge(first, middle, last);
+        return;
+    }
+
+    std::inplace_merge(first, middle, last,
+                       [function](const wxString& s1, const wxString& s2)
+                       {
+                           return function(s1, s2) < 0;
+                       }
+                      );
+}
+
+} // anonymous namespace
+
 // ============================================================================
 // ArrayString
 // ============================================================================
@@ -72,12 +140,8 @@ int wxArrayString::Index(const wxString& str, bool bCase, bool bFromEnd) const
 
 void wxArrayString::Sort(CompareFunction function)
 {
-    std::sort(begin(), end(),
-              [function](const wxString& s1, const wxString& s2)
-              {
-                  return function(s1, s2) < 0;
-              }
-             );
+    if ( !empty() )
+        SortStrings(data(), data() + size(), function);
 }
 
 void wxArrayString::Sort(bool reverseOrder)
@@ -114,6 +178,32 @@ int wxSortedArrayString::Index(const wxString& str,
     return it - begin();
 }
 
+void wxSortedArrayString::AddSorted(const wxString* first, const wxString* last)
+{
+    if ( first == last )
+        return;
+
+    // Inserting the strings from this array itself would invalidate the
+    // pointers, so make a copy of them first in this case.
+    if ( !empty() && first >= data() && first < data() + size() )
+    {
+        const std::vector<wxString> copy(first, last);
+        AddSorted(copy.data(), copy.data() + copy.size());
+        return;
+    }
+
+    // Instead of inserting the strings one by one, which requires moving all
+    // the subsequent elements every time, append them all at once, sort just
+    // them and merge the two sorted sequences.
+    const size_t oldCount = size();
+    insert(end(), first, last);
+
+    wxString* const items = data();
+    const SCMPFUNC function = GetCompareFunction();
+    SortStrings(items + oldCount, items + size(), function);
+    MergeStrings(items, items + oldCount, items + size(), function);
+}
+
 #else // !wxUSE_STD_CONTAINERS
 
 #ifndef   ARRAY_DEFAULT_INITIAL_SIZE    // also defined in dynarray.h
@@ -448,45 +538,29 @@ void wxArrayString::Remove(const wxString& sz)
 // negative, null or positive value depending on whether the first item is less
 // than, equal to or greater than the other one while we need a real boolean
 // predicate now that we use std::sort()
-struct wxSortPredicateAdaptor
+struct wxSortPredicateAdaptor2
 {
-    wxSortPredicateAdaptor(wxArrayString::CompareFunction compareFunction)
+    wxSortPredicateAdaptor2(wxArrayString::CompareFunction2 compareFunction)
         : m_compareFunction(compareFunction)
     {
     }
 
     bool operator()(const wxString& first, const wxString& second) const
     {
-        return (*m_compareFunction)(first, second) < 0;
+        return (*m_compareFunction)(const_cast<wxString *>(&first),
+                                    const_cast<wxString *>(&second)) < 0;
     }
 
-    wxArrayString::CompareFunction m_compareFunction;
+    wxArrayString::CompareFunction2 m_compareFunction;
 };
 
 void wxArrayString::Sort(CompareFunction compareFunction)
 {
     wxCHECK_RET( !m_autoSort, wxT("can't use this method with sorted arrays") );
 
-    std::sort(m_pItems, m_pItems + m_nCount,
-                wxSortPredicateAdaptor(compareFunction));
+    SortStrings(m_pItems, m_pItems + m_nCount, compareFunction);
 }
 
-struct wxSortPredicateAdaptor2
-{
-    wxSortPredicateAdaptor2(wxArrayString::CompareFunction2 compareFunction)
-        : m_compareFunction(compareFunction)
-    {
-    }
-
-    bool operator()(const wxString& first, const wxString& second) const
-    {
-        return (*m_compareFunction)(const_cast<wxString *>(&first),
-                                    const_cast<wxString *>(&second)) < 0;
-    }
-
-    wxArrayString::CompareFunction2 m_compareFunction;
-};
-
 void wxArrayString::Sort(CompareFunction2 compareFunction)
 {
     std::sort(m_pItems, m_pItems + m_nCount,
@@ -501,6 +575,29 @@ void wxArrayString::Sort(bool reverseOrder)
         std::sort(m_pItems, m_pItems + m_nCount);
 }
 
+void wxArrayString::DoAddSorted(const wxString* first, const wxString* last)
+{
+    wxCHECK_RET( m_autoSort, wxT("can only be used with sorted arrays") );
+
+    const size_t count = last - first;
+    if ( !count )
+        return;
+
+    // As in Add(), postpone freeing the old memory as the strings being added
+    // could be our own ones.
+    wxScopedArray<wxString> oldStrings(Grow(count));
+
+    // Append all the new strings, sort them and merge them with the existing
+    // ones instead of inserting them one by one.
+    const size_t oldCount = m_nCount;
+    std::copy(first, last, m_pItems + oldCount);
+    m_nCount += count;
+
+    SortStrings(m_pItems + oldCount, m_pItems + m_nCount, m_compareFunction);
+    MergeStrings(m_pItems, m_pItems + oldCount, m_pItems + m_nCount,
+                 m_compareFunction);
+}
+
 bool wxArrayString::operator==(const wxArrayString& a) const
 {
     if ( m_nCount != a.m_nCount )
@@ -659,14 +756,17 @@ struct wxStringFragment
     wxStringFragment() : type(Empty), value(0) {}
 
     Type     type;
-    wxString text;
+    wxString text;  // already lower-cased for LetterOrSymbol type
     wxUint64 value; // used only for Digit type
 };
 
 
-wxStringFragment GetFragment(wxString& text)
+// Extract the fragment starting at the given position, which is advanced to
+// the end of the fragment.
+wxStringFragment GetFragment(wxString::const_iterator& start,
+                             const wxString::const_iterator& end)
 {
-    if ( text.empty() )
+    if ( start == end )
         return wxStringFragment();
 
     // the maximum length of a sequence of digits that
@@ -675,8 +775,9 @@ wxStringFragment GetFragment(wxString& text)
 
     wxStringFragment         fragment;
     wxString::const_iterator it;
+    ptrdiff_t                length = 0;
 
-    for ( it = text.cbegin(); it != text.cend(); ++it )
+    for ( it = start; it != end; ++it, ++length )
     {
         const wxUniChar&       ch = *it;
         wxStringFragment::Type chType = wxStringFragment::Empty;
@@ -700,17 +801,19 @@ wxStringFragment GetFragment(wxString& text)
         // or a sequence of digits is too long
         if ( fragment.type != chType
              || (fragment.type == wxStringFragment::Digit
-                 && it - text.cbegin() > maxDigitSequenceLength) )
+                 && length > maxDigitSequenceLength) )
         {
             break;
         }
     }
 
-    fragment.text.assign(text.cbegin(), it);
+    fragment.text.assign(start, it);
     if ( fragment.type == wxStringFragment::Digit )
         fragment.text.ToULongLong(&fragment.value);
+    else if ( fragment.type == wxStringFragment::LetterOrSymbol )
+        fragment.text.MakeLower();
 
-    text.erase(0, it - text.cbegin());
+    start = it;
 
     return fragment;
 }
@@ -770,7 +873,7 @@ int CompareFragmentNatural(const wxStringFragment& lhs, const wxStringFragment&
                 case wxStringFragment::Digit:
                     return 1;
                 case wxStringFragment::LetterOrSymbol:
-                    return wxStrcoll_String(lhs.text.Lower(), rhs.text.Lower());
+                    return wxStrcoll_String(lhs.text, rhs.text);
             }
             break;
     }
@@ -780,6 +883,65 @@ int CompareFragmentNatural(const wxStringFragment& lhs, const wxStringFragment&
     return 1;
 }
 
+// Natural sort key of a string, i.e. all of its fragments.
+typedef std::vector<wxStringFragment> wxStringNaturalKey;
+
+wxStringNaturalKey GetNaturalKey(const wxString& s)
+{
+    wxStringNaturalKey key;
+
+    for ( wxString::const_iterator it = s.begin(), end = s.end(); it != end; )
+        key.push_back(GetFragment(it, end));
+
+    return key;
+}
+
+int CompareNaturalKeys(const wxStringNaturalKey& lhs,
+                       const wxStringNaturalKey& rhs)
+{
+    // Missing fragments compare as empty ones, as in wxCmpNaturalGeneric().
+    static const wxStringFragment empty;
+
+    for ( size_t n = 0; n < lhs.size() || n < rhs.size(); ++n )
+    {
+        const int comparison =
+            CompareFragmentNatural(n < lhs.size() ? lhs[n] : empty,
+                                   n < rhs.size() ? rhs[n] : empty);
+        if ( comparison != 0 )
+            return comparison;
+    }
+
+    return 0;
+}
+
+void SortStringsNatural(wxString* first, wxString* last)
+{
+    struct Item
+    {
+        wxStringNaturalKey key;
+        wxString* str;
+    };
+
+    std::vector<Item> items;
+    items.reserve(last - first);
+    for ( wxString* p = first; p != last; ++p )
+        items.push_back({GetNaturalKey(*p), p});
+
+    std::sort(items.begin(), items.end(),
+              [](const Item& item1, const Item& item2)
+              {
+                  return CompareNaturalKeys(item1.key, item2.key) < 0;
+              }
+             );
+
+    std::vector<wxString> sorted;
+    sorted.reserve(items.size());
+    for ( const auto& item : items )
+        sorted.push_back(std::move(*item.str));
+
+    std::move(sorted.begin(), sorted.end(), first);
+}
+
 } // unnamed namespace
 
 
@@ -789,15 +951,17 @@ int CompareFragmentNatural(const wxStringFragment& lhs, const wxStringFragment&
 //
 int wxCMPFUNC_CONV wxCmpNaturalGeneric(const wxString& s1, const wxString& s2)
 {
-    wxString lhs(s1);
-    wxString rhs(s2);
+    wxString::const_iterator lhs = s1.begin();
+    wxString::const_iterator rhs = s2.begin();
+    const wxString::const_iterator lhsEnd = s1.end();
+    const wxString::const_iterator rhsEnd = s2.end();
 
     int comparison = 0;
 
-    while ( (comparison == 0) && (!lhs.empty() || !rhs.empty()) )
+    while ( (comparison == 0) && (lhs != lhsEnd || rhs != rhsEnd) )
     {
-        const wxStringFragment fragmentLHS = GetFragment(lhs);
-        const wxStringFragment fragmentRHS = GetFragment(rhs);
+        const wxStringFragment fragmentLHS = GetFragment(lhs, lhsEnd);
+        const wxStringFragment fragmentRHS = GetFragment(rhs, rhsEnd);
 
         comparison = CompareFragmentNatural(fragmentLHS, fragmentRHS);
     }
@@ -810,7 +974,7 @@ int wxCMPFUNC_CONV wxCmpNaturalGeneric(const wxString& s1, const wxString& s2)
 // ----------------------------------------------------------------------------
 
 // If native natural sort function isn't available, use the generic version.
-#if !(defined(__WINDOWS__) || defined(__DARWIN__) || defined(__WXOSX_IPHONE__))
+#ifndef wxHAS_NATIVE_CMP_NATURAL
 
 int wxCMPFUNC_CONV wxCmpNatural(const wxString& s1, const wxString& s2)
 {
@@ -39,106 +39,96 @@ public:
 // Cache class - stores already requested bitmaps
 // ----------------------------------------------------------------------------
 
-using wxArtProviderBitmapsHash = std::unordered_map<wxString, wxBitmap>;
-using wxArtProviderBitmapBundlesHash = std::unordered_map<wxString, wxBitmapBundle>;
-using wxArtProviderIconBundlesHash = std::unordered_map<wxString, wxIconBundle>;
-
-class wxArtProviderCache
-{
-public:
-    bool GetBitmap(const wxString& full_id, wxBitmap* bmp);
-    void PutBitmap(const wxString& full_id, const wxBitmap& bmp)
-        { m_bitmapsHash[full_id] = bmp; }
-
-    bool GetBitmapBundle(const wxString& full_id, wxBitmapBundle* bmpbndl);
-    void PutBitmapBundle(const wxString& full_id, const wxBitmapBundle& bmpbndl)
-        { m_bitmapsBundlesHash[full_id] = bmpbndl; }
-
-    bool GetIconBundle(const wxString& full_id, wxIconBundle* bmp);
-    void PutIconBundle(const wxString& full_id, const wxIconBundle& iconbundle)
-        { m_iconBundlesHash[full_id] = iconbundle; }
-
-    void Clear();
-
-    static wxString ConstructHashID(const wxArtID& id,
-                                    const wxArtClient& client,
-                                    const wxSize& size);
-
-    static wxString ConstructHashID(const wxArtID& id,
-                                    const wxArtClient& client);
-
-private:
-    wxArtProviderBitmapsHash m_bitmapsHash;                 // cache of wxBitmaps
-    wxArtProviderBitmapBundlesHash m_bitmapsBundlesHash;    // cache of wxBitmaps
-    wxArtProviderIconBundlesHash m_iconBundlesHash;         // cache of wxIconBundles
-};
-
-bool wxArtProviderCache::GetBitmap(const wxString& full_id, wxBitmap* bmp)
-{
-    wxArtProviderBitmapsHash::iterator entry = m_bitmapsHash.find(full_id);
-    if ( entry == m_bitmapsHash.end() )
+// Key used for the cache: we avoid combining all its components in a single
+// string, as was done previously, because this is relatively expensive and
+// the cache lookups are done very often, e.g. for every toolbar button.
+struct wxArtProviderCacheKey
+{
+    wxArtProviderCacheKey(const wxArtID& id_,
+                          const wxArtClient& client_,
+                          const wxSize& size_ = wxDefaultSize)
+        : id(id_), client(client_), size(size_)
     {
-        return false;
     }
-    else
+
+    bool operator==(const wxArtProviderCacheKey& other) const
     {
-        *bmp = entry->second;
-        return true;
+        return size == other.size && id == other.id && client == other.client;
     }
-}
 
-bool wxArtProviderCache::GetBitmapBundle(const wxString& full_id, wxBitmapBundle* bmpbndl)
+    wxArtID id;
+    wxArtClient client;
+    wxSize size;
+};
+
+struct wxArtProviderCacheKeyHash
 {
-    wxArtProviderBitmapBundlesHash::iterator entry = m_bitmapsBundlesHash.find(full_id);
-    if ( entry == m_bitmapsBundlesHash.end() )
-    {
-        return false;
-    }
-    else
+    size_t operator()(const wxArtProviderCacheKey& key) const
     {
-        *bmpbndl = entry->second;
-        return true;
+        const std::hash<wxString> hashString;
+
+        size_t h = hashString(key.id);
+        h = h*31 + hashString(key.client);
+        h = h*31 + static_cast<size_t>(key.size.x);
+        h = h*31 + static_cast<size_t>(key.size.y);
+        return h;
     }
-}
+};
 
+template <typename T>
+using wxArtProviderCacheHash =
+    std::unordered_map<wxArtProviderCacheKey, T, wxArtProviderCacheKeyHash>;
 
-bool wxArtProviderCache::GetIconBundle(const wxString& full_id, wxIconBundle* bmp)
+class wxArtProviderCache
 {
-    wxArtProviderIconBundlesHash::iterator entry = m_iconBundlesHash.find(full_id);
-    if ( entry == m_iconBundlesHash.end() )
-    {
-        return false;
-    }
-    else
+public:
+    bool GetBitmap(const wxArtProviderCacheKey& key, wxBitmap* bmp) const
+        { return DoGet(m_bitmapsHash, key, bmp); }
+    void PutBitmap(const wxArtProviderCacheKey& key, const wxBitmap& bmp)
+        { m_bitmapsHash[key] = bmp; }
+
+    bool GetBitmapBundle(const wxArtProviderCacheKey& key,
+                         wxBitmapBundle* bmpbndl) const
+        { return DoGet(m_bitmapsBundlesHash, key, bmpbndl); }
+    void PutBitmapBundle(const wxArtProviderCacheKey& key,
+                         const wxBitmapBundle& bmpbndl)
+        { m_bitmapsBundlesHash[key] = bmpbndl; }
+
+    bool GetIconBundle(const wxArtProviderCacheKey& key,
+                       wxIconBundle* iconbundle) const
+        { return DoGet(m_iconBundlesHash, key, iconbundle); }
+    void PutIconBundle(const wxArtProviderCacheKey& key,
+                       const wxIconBundle& iconbundle)
+        { m_iconBundlesHash[key] = iconbundle; }
+
+    void Clear();
+
+private:
+    template <typename T>
+    static bool DoGet(const wxArtProviderCacheHash<T>& hash,
+                      const wxArtProviderCacheKey& key,
+                      T* value)
     {
-        *bmp = entry->second;
+        const auto entry = hash.find(key);
+        if ( entry == hash.end() )
+            return false;
+
+        *value = entry->second;
         return true;
     }
-}
+
+    wxArtProviderCacheHash<wxBitmap> m_bitmapsHash;                 // cache of wxBitmaps
+    wxArtProviderCacheHash<wxBitmapBundle> m_bitmapsBundlesHash;    // cache of wxBitmapBundles
+    wxArtProviderCacheHash<wxIconBundle> m_iconBundlesHash;         // cache of wxIconBundles
+};
 
 void wxArtProviderCache::Clear()
 {
     m_bitmapsHash.clear();
+    m_bitmapsBundlesHash.clear();
     m_iconBundlesHash.clear();
 }
 
-/* static */ wxString
-wxArtProviderCache::ConstructHashID(const wxArtID& id,
-                                    const wxArtClient& client)
-{
-    return id + wxT('-') + client;
-}
-
-
-/* static */ wxString
-wxArtProviderCache::ConstructHashID(const wxArtID& id,
-                                    const wxArtClient& client,
-                                    const wxSize& size)
-{
-    return ConstructHashID(id, client) + wxT('-') +
-            wxString::Format(wxT("%d-%d"), size.x, size.y);
-}
-
 // ----------------------------------------------------------------------------
 // wxBitmapBundleImplArt: uses art provider to get the bitmaps
 // ----------------------------------------------------------------------------
@@ -428,7 +418,7 @@ wxArtProvider::RescaleOrResizeIfNeeded(wxBitmap& bmp, const wxSize& sizeNeeded)
 
     wxCHECK_MSG( sm_providers, wxNullBitmap, wxT("no wxArtProvider exists") );
 
-    wxString hashId = wxArtProviderCache::ConstructHashID(id, client, size);
+    const wxArtProviderCacheKey hashId(id, client, size);
 
     wxBitmap bmp;
     if ( !sm_cache->GetBitmap(hashId, &bmp) )
@@ -490,7 +480,7 @@ wxBitmapBundle wxArtProvider::GetBitmapBundle(const wxArtID& id,
 
     wxCHECK_MSG( sm_providers, wxNullBitmap, wxT("no wxArtProvider exists") );
 
-    wxString hashId = wxArtProviderCache::ConstructHashID(id, client, size);
+    const wxArtProviderCacheKey hashId(id, client, size);
 
     wxBitmapBundle bitmapbundle; // (DoGetIconBundle(id, client));
 
@@ -554,7 +544,7 @@ wxIconBundle wxArtProvider::DoGetIconBundle(const wxArtID& id, const wxArtClient
 
     wxCHECK_MSG( sm_providers, wxNullIconBundle, wxT("no wxArtProvider exists") );
 
-    wxString hashId = wxArtProviderCache::ConstructHashID(id, client);
+    const wxArtProviderCacheKey hashId(id, client);
 
     wxIconBundle iconbundle;
     if ( !sm_cache->GetIconBundle(hashId, &iconbundle) )
@@ -13,6 +13,242 @@
 
 #include "wx/base64.h"
 
+#if wxUSE_STREAMS
+    #include "wx/stream.h"
+#endif // wxUSE_STREAMS
+
+#include "wx/private/simd.h"
+
+#include <string.h>
+
+namespace
+{
+
+const char b64[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+// this table contains the values, in base 64, of all valid characters and
+// special values WSP or INV for white space and invalid characters
+// respectively as well as a special PAD value for '='
+enum
+{
+    WSP = 200,
+    INV,
+    PAD
+};
+
+const unsigned char decode[256] =
+{
+    WSP,INV,INV,INV,INV,INV,INV,INV,INV,WSP,WSP,INV,WSP,WSP,INV,INV,
+    INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,
+    WSP,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,076,INV,INV,INV,077,
+    064,065,066,067,070,071,072,073,074,075,INV,INV,INV,PAD,INV,INV,
+    INV,000,001,002,003,004,005,006,007,010,011,012,013,014,015,016,
+    017,020,021,022,023,024,025,026,027,030,031,INV,INV,INV,INV,INV,
+    INV,032,033,034,035,036,037,040,041,042,043,044,045,046,047,050,
+    051,052,053,054,055,056,057,060,061,062,063,INV,INV,INV,INV,INV,
+    INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,
+    INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,
+    INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,
+    INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,
+    INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,
+    INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,
+    INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,
+    INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,
+};
+
+// ----------------------------------------------------------------------------
+// SIMD helpers encoding or decoding a block of data at once
+// ----------------------------------------------------------------------------
+
+// Each of the implementations below defines the sizes of the blocks it works
+// with and EncodeBlock() and DecodeBlock() functions. The latter returns false,
+// without writing anything, if the input contains anything but the base64
+// characters, i.e. whitespace, padding or invalid characters, to let the
+// scalar code deal with them.
+
+#if defined(wxHAS_SSE2)
+
+#define wxHAS_BASE64_SIMD
+
+const size_t SIMD_ENCODE_IN = 12;
+const size_t SIMD_ENCODE_OUT = 16;
+
+inline void EncodeBlock(const unsigned char* src, char* dst)
+{
+    // SSE2 doesn't have byte shuffles, so combine each 3 bytes into the low
+    // 24 bits of a 32-bit lane manually.
+    const __m128i in = _mm_setr_epi32
+                       (
+                        src[0] << 16 | src[1] << 8 | src[2],
+                        src[3] << 16 | src[4] << 8 | src[5],
+                        src[6] << 16 | src[7] << 8 | src[8],
+                        src[9] << 16 | src[10] << 8 | src[11]
+                       );
+
+    // Split each lane into 4 6-bit indices, stored in its bytes in order.
+    const __m128i mask = _mm_set1_epi32(0x3f);
+    __m128i idx = _mm_and_si128(_mm_srli_epi32(in, 18), mask);
+    idx = _mm_or_si128(idx,
+            _mm_slli_epi32(_mm_and_si128(_mm_srli_epi32(in, 12), mask), 8));
+    idx = _mm_or_si128(idx,
+            _mm_slli_epi32(_mm_and_si128(_mm_srli_epi32(in, 6), mask), 16));
+    idx = _mm_or_si128(idx, _mm_slli_epi32(_mm_and_si128(in, mask), 24));
+
+    // Map the indices to the characters by adding the offset corresponding
+    // to the range they're in: 'A' for [0, 25], 'a' - 26 for [26, 51],
+    // '0' - 52 for [52, 61] and '+' - 62 and '/' - 63 for the last two.
+    __m128i off = _mm_set1_epi8('A');
+    off = _mm_add_epi8(off, _mm_and_si128(_mm_cmpgt_epi8(idx, _mm_set1_epi8(25)),
+                                          _mm_set1_epi8('a' - 26 - 'A')));
+    off = _mm_add_epi8(off, _mm_and_si128(_mm_cmpgt_epi8(idx, _mm_set1_epi8(51)),
+                                          _mm_set1_epi8('0' - 52 - ('a' - 26))));
+    off = _mm_add_epi8(off, _mm_and_si128(_mm_cmpgt_epi8(idx, _mm_set1_epi8(61)),
+                                          _mm_set1_epi8('+' - 62 - ('0' - 52))));
+    off = _mm_add_epi8(off, _mm_and_si128(_mm_cmpgt_epi8(idx, _mm_set1_epi8(62)),
+                                          _mm_set1_epi8('/' - 63 - ('+' - 62))));
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_add_epi8(idx, off));
+}
+
+const size_t SIMD_DECODE_IN = 16;
+const size_t SIMD_DECODE_OUT = 12;
+
+// Return the mask of the bytes of the given vector in [lo, hi] range.
+inline __m128i InRange(__m128i v, char lo, char hi)
+{
+    return _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8(lo - 1)),
+                         _mm_cmplt_epi8(v, _mm_set1_epi8(hi + 1)));
+}
+
+inline bool DecodeBlock(const char* src, unsigned char* dst)
+{
+    const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+
+    // Notice that the characters with the high bit set are negative and so
+    // are never in any of these ranges.
+    const __m128i upper = InRange(in, 'A', 'Z');
+    const __m128i lower = InRange(in, 'a', 'z');
+    const __m128i digit = InRange(in, '0', '9');
+    const __m128i plus = _mm_cmpeq_epi8(in, _mm_set1_epi8('+'));
+    const __m128i slash = _mm_cmpeq_epi8(in, _mm_set1_epi8('/'));
+
+    const __m128i valid = _mm_or_si128(_mm_or_si128(upper, lower),
+                            _mm_or_si128(digit, _mm_or_si128(plus, slash)));
+    if ( _mm_movemask_epi8(valid) != 0xffff )
+        return false;
+
+    __m128i off = _mm_and_si128(upper, _mm_set1_epi8(-'A'));
+    off = _mm_or_si128(off, _mm_and_si128(lower, _mm_set1_epi8(26 - 'a')));
+    off = _mm_or_si128(off, _mm_and_si128(digit, _mm_set1_epi8(52 - '0')));
+    off = _mm_or_si128(off, _mm_and_si128(plus, _mm_set1_epi8(62 - '+')));
+    off = _mm_or_si128(off, _mm_and_si128(slash, _mm_set1_epi8(63 - '/')));
+
+    const __m128i vals = _mm_add_epi8(in, off);
+
+    // Combine the 4 6-bit values in each lane into 24 bits.
+    const __m128i mask = _mm_set1_epi32(0xff);
+    __m128i bits = _mm_slli_epi32(_mm_and_si128(vals, mask), 18);
+    bits = _mm_or_si128(bits,
+            _mm_slli_epi32(_mm_and_si128(_mm_srli_epi32(vals, 8), mask), 12));
+    bits = _mm_or_si128(bits,
+            _mm_slli_epi32(_mm_and_si128(_mm_srli_epi32(vals, 16), mask), 6));
+    bits = _mm_or_si128(bits, _mm_srli_epi32(vals, 24));
+
+    wxUint32 lanes[4];
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), bits);
+
+    for ( const wxUint32 lane : lanes )
+    {
+        *dst++ = static_cast<unsigned char>(lane >> 16);
+        *dst++ = static_cast<unsigned char>(lane >> 8);
+        *dst++ = static_cast<unsigned char>(lane);
+    }
+
+    return true;
+}
+
+#elif defined(wxHAS_NEON)
+
+#define wxHAS_BASE64_SIMD
+
+const size_t SIMD_ENCODE_IN = 48;
+const size_t SIMD_ENCODE_OUT = 64;
+
+inline void EncodeBlock(const unsigned char* src, char* dst)
+{
+    const uint8_t* const table = reinterpret_cast<const uint8_t*>(b64);
+    uint8x16x4_t lookup;
+    lookup.val[0] = vld1q_u8(table);
+    lookup.val[1] = vld1q_u8(table + 16);
+    lookup.val[2] = vld1q_u8(table + 32);
+    lookup.val[3] = vld1q_u8(table + 48);
+
+    // Deinterleave the input into the first, second and third bytes of each
+    // group of 3 and split them into 4 6-bit indices.
+    const uint8x16x3_t in = vld3q_u8(src);
+    const uint8x16_t mask = vdupq_n_u8(0x3f);
+
+    uint8x16x4_t out;
+    out.val[0] = vshrq_n_u8(in.val[0], 2);
+    out.val[1] = vandq_u8(vorrq_u8(vshlq_n_u8(in.val[0], 4),
+                                   vshrq_n_u8(in.val[1], 4)), mask);
+    out.val[2] = vandq_u8(vorrq_u8(vshlq_n_u8(in.val[1], 2),
+                                   vshrq_n_u8(in.val[2], 6)), mask);
+    out.val[3] = vandq_u8(in.val[2], mask);
+
+    for ( auto& v : out.val )
+        v = vqtbl4q_u8(lookup, v);
+
+    vst4q_u8(reinterpret_cast<uint8_t*>(dst), out);
+}
+
+const size_t SIMD_DECODE_IN = 64;
+const size_t SIMD_DECODE_OUT = 48;
+
+inline bool DecodeBlock(const char* src, unsigned char* dst)
+{
+    uint8x16x4_t in = vld4q_u8(reinterpret_cast<const uint8_t*>(src));
+
+    for ( auto& v : in.val )
+    {
+        const uint8x16_t upper = vcleq_u8(vsubq_u8(v, vdupq_n_u8('A')),
+                                          vdupq_n_u8(25));
+        const uint8x16_t lower = vcleq_u8(vsubq_u8(v, vdupq_n_u8('a')),
+                                          vdupq_n_u8(25));
+        const uint8x16_t digit = vcleq_u8(vsubq_u8(v, vdupq_n_u8('0')),
+                                          vdupq_n_u8(9));
+        const uint8x16_t plus = vceqq_u8(v, vdupq_n_u8('+'));
+        const uint8x16_t slash = vceqq_u8(v, vdupq_n_u8('/'));
+
+        const uint8x16_t valid = vorrq_u8(vorrq_u8(upper, lower),
+                                  vorrq_u8(digit, vorrq_u8(plus, slash)));
+        if ( vminvq_u8(valid) == 0 )
+            return false;
+
+        uint8x16_t off = vandq_u8(upper, vdupq_n_u8(static_cast<uint8_t>(-'A')));
+        off = vorrq_u8(off, vandq_u8(lower, vdupq_n_u8(static_cast<uint8_t>(26 - 'a'))));
+        off = vorrq_u8(off, vandq_u8(digit, vdupq_n_u8(static_cast<uint8_t>(52 - '0'))));
+        off = vorrq_u8(off, vandq_u8(plus, vdupq_n_u8(62 - '+')));
+        off = vorrq_u8(off, vandq_u8(slash, vdupq_n_u8(63 - '/')));
+
+        v = vaddq_u8(v, off);
+    }
+
+    uint8x16x3_t out;
+    out.val[0] = vorrq_u8(vshlq_n_u8(in.val[0], 2), vshrq_n_u8(in.val[1], 4));
+    out.val[1] = vorrq_u8(vshlq_n_u8(in.val[1], 4), vshrq_n_u8(in.val[2], 2));
+    out.val[2] = vorrq_u8(vshlq_n_u8(in.val[2], 6), in.val[3]);
+
+    vst3q_u8(dst, out);
+
+    return true;
+}
+
+#endif // wxHAS_SSE2/wxHAS_NEON
+
+} // anonymous namespace
+
 size_t
 wxBase64Encode(char *dst, size_t dstLen, const void *src_, size_t srcLen)
 {
@@ -20,12 +256,23 @@ wxBase64Encode(char *dst, size_t dstLen, const void *src_, size_t srcLen)
 
     const unsigned char *src = static_cast<const unsigned char *>(src_);
 
-    static const char b64[] =
-        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
-
-
     size_t encLen = 0;
 
+#ifdef wxHAS_BASE64_SIMD
+    // encode as many complete blocks as possible using SIMD and let the loop
+    // below deal with the rest
+    if ( dst )
+    {
+        for ( ; srcLen >= SIMD_ENCODE_IN && encLen + SIMD_ENCODE_OUT <= dstLen;
+              srcLen -= SIMD_ENCODE_IN, src += SIMD_ENCODE_IN )
+        {
+            EncodeBlock(src, dst);
+            dst += SIMD_ENCODE_OUT;
+            encLen += SIMD_ENCODE_OUT;
+        }
+    }
+#endif // wxHAS_BASE64_SIMD
+
     // encode blocks of 3 bytes into 4 base64 characters
     for ( ; srcLen >= 3; srcLen -= 3, src += 3 )
     {
@@ -78,36 +325,6 @@ wxBase64Decode(void *dst_, size_t dstLen,
     if ( srcLen == wxNO_LEN )
         srcLen = strlen(src);
 
-    // this table contains the values, in base 64, of all valid characters and
-    // special values WSP or INV for white space and invalid characters
-    // respectively as well as a special PAD value for '='
-    enum
-    {
-        WSP = 200,
-        INV,
-        PAD
-    };
-
-    static const unsigned char decode[256] =
-    {
-        WSP,INV,INV,INV,INV,INV,INV,INV,INV,WSP,WSP,INV,WSP,WSP,INV,INV,
-        INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,
-        WSP,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,076,INV,INV,INV,077,
-        064,065,066,067,070,071,072,073,074,075,INV,INV,INV,PAD,INV,INV,
-        INV,000,001,002,003,004,005,006,007,010,011,012,013,014,015,016,
-        017,020,021,022,023,024,025,026,027,030,031,INV,INV,INV,INV,INV,
-        INV,032,033,034,035,036,037,040,041,042,043,044,045,046,047,050,
-        051,052,053,054,055,056,057,060,061,062,063,INV,INV,INV,INV,INV,
-        INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,
-        INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,
-        INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,
-        INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,
-        INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,
-        INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,
-        INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,
-        INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,INV,
-    };
-
     // we decode input by groups of 4 characters but things are complicated by
     // the fact that there can be whitespace and other junk in it too so keep
     // record of where exactly we're inside the current quartet in this var
@@ -118,6 +335,30 @@ wxBase64Decode(void *dst_, size_t dstLen,
     const char *p;
     for ( p = src; srcLen; p++, srcLen-- )
     {
+#ifdef wxHAS_BASE64_SIMD
+        // decode entire blocks at once if we're at the start of a quartet and
+        // they don't contain anything special
+        while ( !n && !end && srcLen >= SIMD_DECODE_IN )
+        {
+            unsigned char buf[SIMD_DECODE_OUT];
+            unsigned char* const out = dst ? dst : buf;
+            if ( dst && decLen + SIMD_DECODE_OUT > dstLen )
+                break;
+
+            if ( !DecodeBlock(p, out) )
+                break;
+
+            if ( dst )
+                dst += SIMD_DECODE_OUT;
+            decLen += SIMD_DECODE_OUT;
+            p += SIMD_DECODE_IN;
+            srcLen -= SIMD_DECODE_IN;
+        }
+
+        if ( !srcLen )
+            break;
+#endif // wxHAS_BASE64_SIMD
+
         const unsigned char c = decode[static_cast<unsigned char>(*p)];
         switch ( c )
         {
@@ -234,4 +475,159 @@ wxMemoryBuffer wxBase64Decode(const char *src,
     return buf;
 }
 
+#if wxUSE_STREAMS
+
+namespace
+{
+
+// size of the chunks in which the stream functions read their input, it must
+// be a multiple of 3 for the encoding function
+const size_t STREAM_CHUNK_SIZE = 3*16*1024;
+
+// write the given buffer to the stream and return false if it failed
+bool WriteAll(wxOutputStream& dst, const void* buf, size_t len)
+{
+    return !len || dst.Write(buf, len).LastWrite() == len;
+}
+
+} // anonymous namespace
+
+size_t wxBase64Encode(wxOutputStream& dst, wxInputStream& src)
+{
+    wxCharBuffer in(STREAM_CHUNK_SIZE);
+    wxCharBuffer out(wxBase64EncodedSize(STREAM_CHUNK_SIZE));
+
+    size_t encLen = 0;
+
+    // number of bytes left over from the previous chunk at the start of "in"
+    size_t carry = 0;
+    for ( ;; )
+    {
+        const size_t len = carry +
+            src.Read(in.data() + carry, STREAM_CHUNK_SIZE - carry).LastRead();
+        if ( len == carry )
+            break;
+
+        // encode everything but the last incomplete group of 3 bytes, if any,
+        // as we'd have to pad it otherwise
+        const size_t full = len - len % 3;
+        const size_t n = wxBase64Encode(out.data(), out.length(),
+                                        in.data(), full);
+        if ( !WriteAll(dst, out.data(), n) )
+            return wxCONV_FAILED;
+
+        encLen += n;
+
+        carry = len - full;
+        memmove(in.data(), in.data() + full, carry);
+    }
+
+    if ( carry )
+    {
+        const size_t n = wxBase64Encode(out.data(), out.length(),
+                                        in.data(), carry);
+        if ( !WriteAll(dst, out.data(), n) )
+            return wxCONV_FAILED;
+
+        encLen += n;
+    }
+
+    return encLen;
+}
+
+size_t
+wxBase64Decode(wxOutputStream& dst, wxInputStream& src, wxBase64DecodeMode mode)
+{
+    wxCharBuffer in(STREAM_CHUNK_SIZE);
+    wxMemoryBuffer out(wxBase64DecodedSize(STREAM_CHUNK_SIZE));
+
+    size_t decLen = 0;
+
+    // set when we've decoded a quartet with padding, nothing can follow it
+    bool end = false;
+
+    // the chunk is cut just before the start of the last incomplete quartet,
+    // which is carried over to the next one, as wxBase64Decode() doesn't
+    // accept incomplete input
+    size_t carry = 0;
+    for ( ;; )
+    {
+        // the carried over part can only grow beyond the chunk size if the
+        // input contains a lot of junk between the characters of a single
+        // quartet, just make room for it then
+        if ( carry == in.length() )
+        {
+            if ( !in.extend(2*carry) )
+                return wxCONV_FAILED;
+        }
+
+        const size_t len = carry +
+            src.Read(in.data() + carry, in.length() - carry).LastRead();
+        if ( len == carry )
+            break;
+
+        // find the position where the incomplete quartet starts by counting
+        // the significant characters, i.e. base64 ones and padding
+        size_t cut = 0;
+        int n = 0;
+        for ( size_t pos = 0; pos < len; pos++ )
+        {
+            const unsigned char c = decode[static_cast<unsigned char>(in[pos])];
+            if ( c >= 64 && c != PAD )
+                continue;
+
+            if ( end )
+                return wxCONV_FAILED;
+
+            if ( n == 0 )
+                cut = pos;
+
+            if ( ++n == 4 )
+            {
+                n = 0;
+                cut = pos + 1;
+
+                if ( c == PAD )
+                    end = true;
+            }
+        }
+
+        // if there is no incomplete quartet, decode everything, including any
+        // trailing non-significant characters
+        if ( !n )
+            cut = len;
+
+        if ( cut )
+        {
+            const size_t outLen = wxBase64DecodedSize(cut);
+            const size_t dec = wxBase64Decode(out.GetWriteBuf(outLen), outLen,
+                                              in.data(), cut, mode);
+            if ( dec == wxCONV_FAILED || !WriteAll(dst, out.GetData(), dec) )
+                return wxCONV_FAILED;
+
+            decLen += dec;
+        }
+
+        carry = len - cut;
+        memmove(in.data(), in.data() + cut, carry);
+    }
+
+    // anything left over can't be decoded successfully unless it's just
+    // ignored characters, let wxBase64Decode() decide
+    if ( carry )
+    {
+        const size_t outLen = wxBase64DecodedSize(carry);
+        const size_t dec = wxBase64Decode(out.GetWriteBuf(outLen), outLen,
+                                          in.data(), carry, mode);
+        if ( dec == wxCONV_FAILED || !WriteAll(dst, out.GetData(), dec) )
+            return wxCONV_FAILED;
+
+        decLen += dec;
+    }
+
+    return decLen;
+}
+
+#endif // wxUSE_STREAMS
+
 #endif // wxUSE_BASE64
@@ -19,6 +19,8 @@
 #include "wx/wxprec.h"
 
 #ifndef WX_PRECOMP
+    #include "wx/app.h"
+    #include "wx/module.h"
 #endif // WX_PRECOMP
 
 #include "wx/bmpbndl.h"
@@ -27,11 +29,16 @@
 #include "wx/iconbndl.h"
 #include "wx/imaglist.h"
 #include "wx/scopeguard.h"
+#include "wx/thread.h"
+#include "wx/threadpool.h"
 #include "wx/window.h"
 
 #include "wx/private/bmpbndl.h"
 
 #include <algorithm>
+#include <memory>
+#include <unordered_map>
+#include <vector>
 
 #ifdef __WXOSX__
 #include "wx/osx/private.h"
@@ -133,6 +140,9 @@ public:
     virtual wxSize GetPreferredBitmapSizeAtScale(double scale) const override;
     virtual wxBitmap GetBitmap(const wxSize& size) override;
 
+    virtual std::function<wxImage ()> CreateImageMaker(const wxSize& size) override;
+    virtual void AddPreparedImage(const wxImage& image) override;
+
 protected:
     virtual double GetNextAvailableScale(size_t& i) const override;
 
@@ -160,6 +170,13 @@ private:
             wxBitmap::Rescale(bitmap, size);
         }
 
+        // Create a new entry from the bitmap generated in some other way.
+        Entry(const wxBitmap& bitmap_, bool generated_)
+            : bitmap(bitmap_)
+        {
+            generated = generated_;
+        }
+
         wxBitmap bitmap;
         bool generated;
     };
@@ -195,6 +212,12 @@ private:
     // Common implementation of all ctors.
     void Init(const wxBitmap* bitmaps, size_t n);
 
+    // Find the entry to use for the bitmap of the given size: return true if
+    // there is an entry of exactly this size, with its index in the provided
+    // output parameter, or false and the index of the entry to rescale and
+    // the position to insert the rescaled entry at otherwise.
+    bool FindEntry(const wxSize& size, size_t& index, size_t& insertPos) const;
+
 #ifdef __WXOSX__
     void OSXCreateNSImage();
 #endif
@@ -277,7 +300,10 @@ wxSize wxBitmapBundleImplSet::GetPreferredBitmapSizeAtScale(double scale) const
     return DoGetPreferredSize(scale);
 }
 
-wxBitmap wxBitmapBundleImplSet::GetBitmap(const wxSize& size)
+bool
+wxBitmapBundleImplSet::FindEntry(const wxSize& size,
+                                 size_t& index,
+                                 size_t& insertPos) const
 {
     // We use linear search instead if binary one because it's simpler and the
     // vector size is small enough (< 10) for it not to matter in practice.
@@ -293,7 +319,8 @@ wxBitmap wxBitmapBundleImplSet::GetBitmap(const wxSize& size)
             if ( sizeThis.x == size.x )
             {
                 // Exact match, just use it.
-                return entry.bitmap;
+                index = i;
+                return true;
             }
 
             if ( sizeThis.x < size.x )
@@ -318,26 +345,75 @@ wxBitmap wxBitmapBundleImplSet::GetBitmap(const wxSize& size)
         {
             // We know that we don't have any exact match and we've found the
             // next bigger bitmap, so rescale it to the desired size.
-            const Entry entryNew(entry, size);
-
-            m_entries.insert(m_entries.begin() + lastSmaller + 1, entryNew);
-
-            return entryNew.bitmap;
+            index = i;
+            insertPos = lastSmaller + 1;
+            return false;
         }
     }
 
     // We only get here if the requested size is larger than the size of all
     // the bitmaps we have, in which case we have no choice but to upscale one
     // of the bitmaps, so find the most appropriate one for doing it.
-    const size_t i = GetIndexToUpscale(size);
+    index = GetIndexToUpscale(size);
+    insertPos = n;
+    return false;
+}
 
-    const Entry entryNew(m_entries[i], size);
+wxBitmap wxBitmapBundleImplSet::GetBitmap(const wxSize& size)
+{
+    size_t index,
+           insertPos;
+    if ( FindEntry(size, index, insertPos) )
+        return m_entries[index].bitmap;
+
+    const Entry entryNew(m_entries[index], size);
 
-    m_entries.push_back(entryNew);
+    m_entries.insert(m_entries.begin() + insertPos, entryNew);
 
     return entryNew.bitmap;
 }
 
+std::function<wxImage ()>
+wxBitmapBundleImplSet::CreateImageMaker(const wxSize& size)
+{
+#if wxUSE_IMAGE
+    size_t index,
+           insertPos;
+    if ( FindEntry(size, index, insertPos) )
+        return {};
+
+    // Converting the bitmap to image must be done in this thread, but the
+    // rescaling itself, done in the same way as wxBitmap::Rescale() does it,
+    // can be done in the worker one.
+    auto image = std::make_shared<wxImage>(m_entries[index].bitmap.ConvertToImage());
+
+    return [image, size]()
+        {
+            return image->Scale(size.x, size.y, wxIMAGE_QUALITY_NEAREST);
+        };
+#else // !wxUSE_IMAGE
+    wxUnusedVar(size);
+
+    return {};
+#endif // wxUSE_IMAGE/!wxUSE_IMAGE
+}
+
+void wxBitmapBundleImplSet::AddPreparedImage(const wxImage& image)
+{
+#if wxUSE_IMAGE
+    // Check that the bitmap of this size hasn't been created since then.
+    size_t index,
+           insertPos;
+    if ( FindEntry(image.GetSize(), index, insertPos) )
+        return;
+
+    m_entries.insert(m_entries.begin() + insertPos,
+                     Entry(wxBitmap(image), true /* generated */));
+#else // !wxUSE_IMAGE
+    wxUnusedVar(image);
+#endif // wxUSE_IMAGE/!wxUSE_IMAGE
+}
+
 #ifdef __WXOSX__
 void wxBitmapBundleImplSet::OSXCreateNSImage()
 {
@@ -614,6 +690,126 @@ wxIcon wxBitmapBundle::GetIconFor(const wxWindow* window) const
     return GetIcon(GetPreferredBitmapSizeFor(window));
 }
 
+// ----------------------------------------------------------------------------
+// Preparing bitmaps in the background
+// ----------------------------------------------------------------------------
+
+#if wxUSE_THREADS && wxUSE_IMAGE
+
+namespace
+{
+
+// The bundles whose images are being prepared in the worker threads.
+//
+// They are kept here rather than in the tasks themselves to ensure that they
+// are only ever used, and notably destroyed, in the main thread.
+using wxPreparedBundles = std::unordered_map<unsigned, wxVector<wxBitmapBundle>>;
+
+wxPreparedBundles gs_preparedBundles;
+unsigned gs_lastPreparationId = 0;
+
+class wxBitmapBundlePrepareModule : public wxModule
+{
+public:
+    wxBitmapBundlePrepareModule() = default;
+
+    virtual bool OnInit() override { return true; }
+    virtual void OnExit() override { gs_preparedBundles.clear(); }
+
+private:
+    wxDECLARE_DYNAMIC_CLASS(wxBitmapBundlePrepareModule);
+};
+
+wxIMPLEMENT_DYNAMIC_CLASS(wxBitmapBundlePrepareModule, wxModule);
+
+} // anonymous namespace
+
+/* static */
+void
+wxBitmapBundle::PrepareBitmaps(const wxVector<wxBitmapBundle>& bundles,
+                               double scale)
+{
+    wxASSERT_MSG( wxIsMainThread(), wxS("must be called from the main thread") );
+
+    wxVector<wxBitmapBundle> toPrepare;
+    std::vector<std::function<wxImage ()>> makers;
+    for ( const auto& bundle : bundles )
+    {
+        wxBitmapBundleImpl* const impl = bundle.GetImpl();
+        if ( !impl )
+            continue;
+
+        auto maker = impl->CreateImageMaker(impl->GetPreferredBitmapSizeAtScale(scale));
+        if ( !maker )
+            continue;
+
+        toPrepare.push_back(bundle);
+        makers.push_back(std::move(maker));
+    }
+
+    if ( makers.empty() )
+        return;
+
+    // Without the application object, we can't get the results back to the
+    // main thread, so just create the bitmaps directly.
+    if ( !wxTheApp )
+    {
+        for ( size_t n = 0; n < makers.size(); ++n )
+            toPrepare[n].GetImpl()->AddPreparedImage(makers[n]());
+        return;
+    }
+
+    const unsigned id = ++gs_lastPreparationId;
+    gs_preparedBundles[id] = toPrepare;
+
+    // Note that the images vector is never copied, so that all the images are
+    // only used by a single thread at any time.
+    auto images = std::make_shared<std::vector<wxImage>>();
+
+    wxThreadPool::Get().Submit([id, makers, images]()
+        {
+            images->reserve(makers.size());
+            for ( const auto& maker : makers )
+                images->push_back(maker());
+
+            wxAppConsole* const app = wxTheApp;
+            if ( !app )
+                return;
+
+            app->CallAfter([id, images]()
+                {
+                    const auto it = gs_preparedBundles.find(id);
+                    if ( it == gs_preparedBundles.end() )
+                        return;
+
+                    const wxVector<wxBitmapBundle> bundles = it->second;
+                    gs_preparedBundles.erase(it);
+
+                    const std::vector<wxImage> results = std::move(*images);
+                    for ( size_t n = 0; n < results.size(); ++n )
+                    {
+                        if ( results[n].IsOk() )
+                            bundles[n].GetImpl()->AddPreparedImage(results[n]);
+                    }
+                });
+        });
+}
+
+#else // !(wxUSE_THREADS && wxUSE_IMAGE)
+
+/* static */
+void
+wxBitmapBundle::PrepareBitmaps(const wxVector<wxBitmapBundle>& bundles,
+                               double scale)
+{
+    // Just create the bitmaps now, which is still useful for the bundles
+    // caching them.
+    for ( const auto& bundle : bundles )
+        bundle.GetBitmap(bundle.GetPreferredBitmapSizeAtScale(scale));
+}
+
+#endif // wxUSE_THREADS && wxUSE_IMAGE/!(wxUSE_THREADS && wxUSE_IMAGE)
+
 namespace
 {
 
@@ -863,6 +1059,17 @@ size_t wxBitmapBundleImpl::GetIndexToUpscale(const wxSize& size) const
     return indexBest != (size_t)-1 ? indexBest : indexLast;
 }
 
+std::function<wxImage ()>
+wxBitmapBundleImpl::CreateImageMaker(const wxSize& WXUNUSED(size))
+{
+    return {};
+}
+
+void wxBitmapBundleImpl::AddPreparedImage(const wxImage& WXUNUSED(image))
+{
+    wxFAIL_MSG( wxS("must be overridden if CreateImageMaker() is") );
+}
+
 wxBitmapBundleImpl::~wxBitmapBundleImpl()
 {
 #ifdef __WXOSX__
@@ -23,8 +23,89 @@
 
 #include "wx/compositebookctrl.h"
 
+#ifndef WX_PRECOMP
+    #include "wx/dcclient.h"
+    #include "wx/panel.h"
+    #include "wx/sizer.h"
+#endif
+
 #include "wx/imaglist.h"
 
+// ----------------------------------------------------------------------------
+// wxBookCtrlLazyPage: placeholder for the page created on demand
+// ----------------------------------------------------------------------------
+
+// This window is used as the page itself, so that it can be used with all
+// book controls, including the native ones which require a window for each
+// page, and the real page window is created as its child when it's needed.
+class wxBookCtrlLazyPage : public wxPanel
+{
+public:
+    wxBookCtrlLazyPage(wxWindow* parent,
+                       const wxBookCtrlBase::PageFactory& factory)
+        : wxPanel(parent),
+          m_factory(factory)
+    {
+        SetSizer(new wxBoxSizer(wxVERTICAL));
+
+        BindPaint();
+    }
+
+    wxWindow* GetContent() const { return m_content; }
+
+    wxWindow* CreateContent()
+    {
+        if ( !m_content )
+        {
+            Unbind(wxEVT_PAINT, &wxBookCtrlLazyPage::OnPaint, this);
+
+            m_content = m_factory(this);
+            if ( m_content )
+            {
+                GetSizer()->Add(m_content, wxSizerFlags(1).Expand());
+                Layout();
+            }
+        }
+
+        return m_content;
+    }
+
+    bool DestroyContent()
+    {
+        if ( !m_content )
+            return false;
+
+        // This also removes it from our sizer.
+        m_content->Destroy();
+        m_content = nullptr;
+
+        BindPaint();
+
+        return true;
+    }
+
+private:
+    void BindPaint()
+    {
+        Bind(wxEVT_PAINT, &wxBookCtrlLazyPage::OnPaint, this);
+    }
+
+    // Native book controls don't use DoSetSelection(), so detect when the page
+    // is shown for the first time by waiting until it needs to be painted.
+    void OnPaint(wxPaintEvent& WXUNUSED(event))
+    {
+        wxPaintDC dc(this);
+
+        // Don't create the windows from inside the paint event handler.
+        CallAfter([this]() { CreateContent(); });
+    }
+
+    const wxBookCtrlBase::PageFactory m_factory;
+    wxWindow* m_content = nullptr;
+
+    wxDECLARE_NO_COPY_CLASS(wxBookCtrlLazyPage);
+};
+
 // ============================================================================
 // implementation
 // ============================================================================
@@ -398,6 +479,61 @@ wxBookCtrlBase::InsertPage(size_t nPage,
     return true;
 }
 
+bool
+wxBookCtrlBase::InsertPageLazy(size_t n,
+                               const PageFactory& factory,
+                               const wxString& text,
+                               bool bSelect,
+                               int imageId)
+{
+    wxCHECK_MSG( factory, false, wxS("page factory must be specified") );
+
+    wxBookCtrlLazyPage* const page = new wxBookCtrlLazyPage(this, factory);
+    if ( !InsertPage(n, page, text, bSelect, imageId) )
+    {
+        delete page;
+        return false;
+    }
+
+    return true;
+}
+
+bool wxBookCtrlBase::IsPageCreated(size_t n) const
+{
+    const wxBookCtrlLazyPage* const
+        lazy = dynamic_cast<wxBookCtrlLazyPage*>(GetPage(n));
+
+    return !lazy || lazy->GetContent();
+}
+
+wxWindow* wxBookCtrlBase::CreatePageIfNeeded(size_t n)
+{
+    wxWindow* const page = GetPage(n);
+
+    wxBookCtrlLazyPage* const lazy = dynamic_cast<wxBookCtrlLazyPage*>(page);
+
+    return lazy ? lazy->CreateContent() : page;
+}
+
+size_t wxBookCtrlBase::DestroyInactiveLazyPages()
+{
+    size_t count = 0;
+
+    const size_t numPages = GetPageCount();
+    for ( size_t n = 0; n < numPages; n++ )
+    {
+        if ( static_cast<int>(n) == GetSelection() )
+            continue;
+
+        wxBookCtrlLazyPage* const
+            lazy = dynamic_cast<wxBookCtrlLazyPage*>(GetPage(n));
+        if ( lazy && lazy->DestroyContent() )
+            count++;
+    }
+
+    return count;
+}
+
 bool wxBookCtrlBase::DeletePage(size_t nPage)
 {
     wxWindow *page = DoRemovePage(nPage);
@@ -524,6 +660,7 @@ int wxBookCtrlBase::DoSetSelection(size_t n, int flags)
             if ( wxWindow* const page = TryGetNonNullPage(n) )
             {
                 page->SetSize(GetPageRect());
+                CreatePageIfNeeded(n);
                 DoShowPage(page, true);
             }
 
@@ -27,6 +27,10 @@
 #endif //WX_PRECOMP
 
 #include "wx/cmdproc.h"
+#include "wx/file.h"
+#include "wx/filefn.h"
+#include "wx/filename.h"
+#include "wx/wfstream.h"
 
 // ============================================================================
 // implementation
@@ -114,39 +118,194 @@ void wxCommandProcessor::Store(wxCommand *command)
         {
             wxList::compatibility_iterator next = node->GetNext();
 
-            // Make sure m_lastSavedCommand won't point to freed memory
-            if ( m_lastSavedCommand && m_lastSavedCommand == node )
-                m_lastSavedCommand = wxList::compatibility_iterator();
-
-            delete (wxCommand *)node->GetData();
-            m_commands.Erase(node);
+            DeleteCommand(node);
 
             node = next;
         }
     }
 
-    if ( (int)m_commands.GetCount() == m_maxNoCommands )
+    // Try merging the new command into the current one, unless the document
+    // was saved after it, as it would be impossible to return to the saved
+    // state by undoing then.
+    wxCommand* const current = GetCurrentCommand();
+    if ( current &&
+            !(m_lastSavedCommand && m_lastSavedCommand == m_currentCommand) &&
+                m_spilledCommands.find(current) == m_spilledCommands.end() )
     {
-        wxList::compatibility_iterator firstNode = m_commands.GetFirst();
+        const size_t usageBefore = current->GetMemoryUsage();
+        if ( current->MergeWith(*command) )
+        {
+            delete command;
 
-        // Make sure m_lastSavedCommand won't point to freed memory
-        if ( m_lastSavedCommand && m_lastSavedCommand == firstNode )
-            m_lastSavedCommand = wxList::compatibility_iterator();
+            m_memoryUsage -= wxMin(usageBefore, m_memoryUsage);
+            m_memoryUsage += current->GetMemoryUsage();
 
-        wxCommand *firstCommand = (wxCommand *)firstNode->GetData();
-        delete firstCommand;
-        m_commands.Erase(firstNode);
+            EnforceLimits();
+            SetMenuStrings();
+            return;
+        }
     }
 
+    if ( (int)m_commands.GetCount() == m_maxNoCommands )
+        DeleteCommand(m_commands.GetFirst());
+
     m_commands.Append(command);
     m_currentCommand = m_commands.GetLast();
+    m_memoryUsage += command->GetMemoryUsage();
+
+    EnforceLimits();
     SetMenuStrings();
 }
 
+void wxCommandProcessor::DeleteCommand(wxList::compatibility_iterator node)
+{
+    // Make sure neither m_lastSavedCommand nor m_currentCommand point to the
+    // freed memory.
+    if ( m_lastSavedCommand && m_lastSavedCommand == node )
+        m_lastSavedCommand = wxList::compatibility_iterator();
+    if ( m_currentCommand && m_currentCommand == node )
+        m_currentCommand = wxList::compatibility_iterator();
+
+    wxCommand* const command = (wxCommand *)node->GetData();
+
+    const auto it = m_spilledCommands.find(command);
+    if ( it != m_spilledCommands.end() )
+    {
+        wxRemoveFile(it->second);
+        m_spilledCommands.erase(it);
+    }
+
+    m_memoryUsage -= wxMin(command->GetMemoryUsage(), m_memoryUsage);
+
+    delete command;
+    m_commands.Erase(node);
+}
+
+void wxCommandProcessor::SetMaxMemoryUsage(size_t maxMemory)
+{
+    m_maxMemory = maxMemory;
+
+    EnforceLimits();
+}
+
+void wxCommandProcessor::EnableSpilling(bool enable, const wxString& dir)
+{
+    m_spillingEnabled = enable;
+    m_spillDir = dir;
+}
+
+void wxCommandProcessor::EnforceLimits()
+{
+    if ( !m_maxMemory )
+        return;
+
+    // First try to save the oldest commands to disk, if possible: notice that
+    // we never spill the current command as it would need to be loaded back
+    // immediately if the user wants to undo it.
+    if ( m_spillingEnabled )
+    {
+        for ( wxList::compatibility_iterator node = m_commands.GetFirst();
+              node && node != m_currentCommand && m_memoryUsage > m_maxMemory;
+              node = node->GetNext() )
+        {
+            wxCommand* const command = (wxCommand *)node->GetData();
+            if ( m_spilledCommands.find(command) == m_spilledCommands.end() )
+                SpillCommand(*command);
+        }
+    }
+
+    // And then delete them if this wasn't enough.
+    while ( m_memoryUsage > m_maxMemory )
+    {
+        wxList::compatibility_iterator node = m_commands.GetFirst();
+        if ( !node || node == m_currentCommand )
+            break;
+
+        DeleteCommand(node);
+    }
+}
+
+bool wxCommandProcessor::SpillCommand(wxCommand& cmd)
+{
+#if wxUSE_FILE && wxUSE_STREAMS
+    if ( !cmd.CanSpill() )
+        return false;
+
+    const wxString dir = m_spillDir.empty() ? wxFileName::GetTempDir()
+                                            : m_spillDir;
+
+    wxFile file;
+    const wxString
+        filename = wxFileName::CreateTempFileName
+                   (
+                    wxFileName(dir, wxS("wxundo")).GetFullPath(),
+                    &file
+                   );
+    if ( filename.empty() )
+        return false;
+
+    const size_t usageBefore = cmd.GetMemoryUsage();
+
+    bool ok;
+    {
+        wxFileOutputStream stream(file);
+        ok = cmd.SpillToStream(stream) && stream.Close();
+    }
+
+    if ( !ok )
+    {
+        wxRemoveFile(filename);
+        return false;
+    }
+
+    m_spilledCommands[&cmd] = filename;
+
+    m_memoryUsage -= wxMin(usageBefore, m_memoryUsage);
+    m_memoryUsage += cmd.GetMemoryUsage();
+
+    return true;
+#else // !(wxUSE_FILE && wxUSE_STREAMS)
+    wxUnusedVar(cmd);
+
+    return false;
+#endif // wxUSE_FILE && wxUSE_STREAMS
+}
+
+bool wxCommandProcessor::EnsureCommandLoaded(wxCommand& cmd)
+{
+    const auto it = m_spilledCommands.find(&cmd);
+    if ( it == m_spilledCommands.end() )
+        return true;
+
+#if wxUSE_FILE && wxUSE_STREAMS
+    const size_t usageBefore = cmd.GetMemoryUsage();
+
+    bool ok;
+    {
+        wxFileInputStream stream(it->second);
+        ok = stream.IsOk() && cmd.RestoreFromStream(stream);
+    }
+
+    if ( !ok )
+        return false;
+
+    wxRemoveFile(it->second);
+    m_spilledCommands.erase(it);
+
+    m_memoryUsage -= wxMin(usageBefore, m_memoryUsage);
+    m_memoryUsage += cmd.GetMemoryUsage();
+
+    return true;
+#else // !(wxUSE_FILE && wxUSE_STREAMS)
+    // We can't have spilled any commands in this case.
+    return false;
+#endif // wxUSE_FILE && wxUSE_STREAMS
+}
+
 bool wxCommandProcessor::Undo()
 {
     wxCommand *command = GetCurrentCommand();
-    if ( command && command->CanUndo() )
+    if ( command && command->CanUndo() && EnsureCommandLoaded(*command) )
     {
         if ( UndoCommand(*command) )
         {
@@ -182,7 +341,7 @@ bool wxCommandProcessor::Redo()
         }
     }
 
-    if (redoCommand)
+    if (redoCommand && EnsureCommandLoaded(*redoCommand))
     {
         bool success = DoCommand(*redoCommand);
         if (success)
@@ -305,14 +464,13 @@ void wxCommandProcessor::ClearCommands()
     wxList::compatibility_iterator node = m_commands.GetFirst();
     while (node)
     {
-        wxCommand *command = (wxCommand *)node->GetData();
-        delete command;
-        m_commands.Erase(node);
+        DeleteCommand(node);
         node = m_commands.GetFirst();
     }
 
     m_currentCommand = wxList::compatibility_iterator();
     m_lastSavedCommand = wxList::compatibility_iterator();
+    m_memoryUsage = 0;
 }
 
 bool wxCommandProcessor::IsDirty() const
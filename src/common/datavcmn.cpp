@@ -423,6 +423,89 @@ int wxDataViewModel::Compare( const wxDataViewItem &item1, const wxDataViewItem
     return ascending ? id1 - id2 : id2 - id1;
 }
 
+bool wxDataViewModel::GetSortKeys(const wxDataViewItemArray& items,
+                                  unsigned int column,
+                                  wxVector<wxDataViewSortKey>& keys) const
+{
+    keys.clear();
+    keys.reserve(items.size());
+
+    // This must produce the same order as the default Compare()
+    // implementation, so only handle the same types as it does.
+    for ( const wxDataViewItem& item : items )
+    {
+        wxVariant value;
+        if ( HasValue(item, column) )
+            GetValue(value, item, column);
+
+        const wxString type = value.GetType();
+        if ( type == wxS("string") )
+        {
+            keys.push_back(wxDataViewSortKey(value.GetString()));
+        }
+        else if ( type == wxS("long") )
+        {
+            keys.push_back(wxDataViewSortKey(double(value.GetLong())));
+        }
+        else if ( type == wxS("double") )
+        {
+            keys.push_back(wxDataViewSortKey(value.GetDouble()));
+        }
+#if wxUSE_DATETIME
+        else if ( type == wxS("datetime") )
+        {
+            const wxDateTime dt = value.GetDateTime();
+            keys.push_back(wxDataViewSortKey(dt.GetValue().ToDouble()));
+        }
+#endif // wxUSE_DATETIME
+        else if ( type == wxS("bool") )
+        {
+            keys.push_back(wxDataViewSortKey(value.GetBool() ? 1.0 : 0.0));
+        }
+        else if ( type == wxS("wxDataViewIconText") )
+        {
+            wxDataViewIconText iconText;
+            iconText << value;
+
+            keys.push_back(wxDataViewSortKey(iconText.GetText()));
+        }
+        else if ( value.IsNull() )
+        {
+            keys.push_back(wxDataViewSortKey());
+        }
+        else
+        {
+            // Values of custom types are compared by DoCompareValues(), which
+            // we can't replicate here.
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// ---------------------------------------------------------
+// wxDataViewSortKey
+// ---------------------------------------------------------
+
+int wxDataViewSortKey::Compare(const wxDataViewSortKey& other) const
+{
+    if ( m_isNumber != other.m_isNumber )
+        return m_isNumber ? -1 : 1;
+
+    if ( m_isNumber )
+    {
+        if ( m_number < other.m_number )
+            return -1;
+        if ( m_number > other.m_number )
+            return 1;
+
+        return 0;
+    }
+
+    return m_string.Cmp(other.m_string);
+}
+
 // ---------------------------------------------------------
 // wxDataViewIndexListModel
 // ---------------------------------------------------------
@@ -672,6 +755,25 @@ unsigned int wxDataViewVirtualListModel::GetChildren( const wxDataViewItem &WXUN
     return 0;  // should we report an error ?
 }
 
+bool wxDataViewVirtualListModel::GetValuesForRange(unsigned int col,
+                                                   unsigned int firstRow,
+                                                   unsigned int count,
+                                                   wxVector<wxVariant>& values) const
+{
+    wxCHECK_MSG( firstRow <= m_size && count <= m_size - firstRow, false,
+                 "invalid range of rows" );
+
+    // Don't reuse the existing elements as GetValueByRow() may leave the
+    // variant unchanged to indicate that there is no value.
+    values.clear();
+    values.resize(count);
+
+    for ( unsigned int n = 0; n < count; n++ )
+        GetValueByRow(values[n], firstRow + n, col);
+
+    return true;
+}
+
 #endif  // __WXMAC__
 
 //-----------------------------------------------------------------------------
@@ -858,6 +960,14 @@ wxDataViewRendererBase::CheckedGetValue(const wxDataViewModel* model,
     if ( model->HasValue(item, column) )
         model->GetValue(value, item, column);
 
+    CheckValueType(value, column);
+
+    return value;
+}
+
+void
+wxDataViewRendererBase::CheckValueType(wxVariant& value, unsigned column) const
+{
     // We always allow the cell to be null, regardless of the renderer type.
     if ( !value.IsNull() )
     {
@@ -876,14 +986,30 @@ wxDataViewRendererBase::CheckedGetValue(const wxDataViewModel* model,
             value.MakeNull();
         }
     }
-
-    return value;
 }
 
 bool
 wxDataViewRendererBase::PrepareForItem(const wxDataViewModel *model,
                                        const wxDataViewItem& item,
                                        unsigned column)
+{
+    return DoPrepareForItem(model, item, column, nullptr);
+}
+
+bool
+wxDataViewRendererBase::PrepareForItem(const wxDataViewModel *model,
+                                       const wxDataViewItem& item,
+                                       unsigned column,
+                                       const wxVariant& value)
+{
+    return DoPrepareForItem(model, item, column, &value);
+}
+
+bool
+wxDataViewRendererBase::DoPrepareForItem(const wxDataViewModel *model,
+                                         const wxDataViewItem& item,
+                                         unsigned column,
+                                         const wxVariant* valueFromModel)
 {
     // This method is called by the native control, so we shouldn't allow
     // exceptions to escape from it.
@@ -891,7 +1017,20 @@ wxDataViewRendererBase::PrepareForItem(const wxDataViewModel *model,
     {
 
     // Now check if we have a value and remember it if we do.
-    wxVariant value = CheckedGetValue(model, item, column);
+    wxVariant value;
+    if ( valueFromModel )
+    {
+        // Apply the same checks as CheckedGetValue() does to the value which
+        // was already retrieved.
+        if ( model->HasValue(item, column) )
+            value = *valueFromModel;
+
+        CheckValueType(value, column);
+    }
+    else
+    {
+        value = CheckedGetValue(model, item, column);
+    }
 
     if ( !value.IsNull() )
     {
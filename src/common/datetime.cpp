@@ -77,6 +77,9 @@
 #include <ctype.h>
 #include <cmath>
 
+#include <algorithm>
+#include <map>
+
 #ifdef __WINDOWS__
     #include <winnls.h>
     #include <locale.h>
@@ -367,6 +370,309 @@ static int GetDSTOffset(wxLongLong t)
     return isDST ? wxDateTime::DST_OFFSET : 0;
 }
 
+// ----------------------------------------------------------------------------
+// Cache of the local time zone offsets
+// ----------------------------------------------------------------------------
+
+namespace
+{
+
+const wxInt64 SECONDS_IN_DAY = 86400;
+
+// Return the number of days since 1970-01-01 for the given date in the
+// proleptic Gregorian calendar, month is in 1..12 range.
+//
+// This and the next function use the well-known algorithms from
+// https://howardhinnant.github.io/date_algorithms.html
+wxInt64 DaysFromCivil(wxInt64 y, unsigned m, unsigned d)
+{
+    y -= m <= 2;
+    const wxInt64 era = (y >= 0 ? y : y - 399) / 400;
+    const unsigned yoe = static_cast<unsigned>(y - era * 400);
+    const unsigned doy = (153*(m > 2 ? m - 3 : m + 9) + 2)/5 + d - 1;
+    const unsigned doe = yoe * 365 + yoe/4 - yoe/100 + doy;
+    return era * 146097 + static_cast<wxInt64>(doe) - 719468;
+}
+
+// Fill in all the fields of struct tm, except tm_isdst, corresponding to the
+// given number of seconds since the Epoch, i.e. do what gmtime_r() does.
+void CivilFromSeconds(wxInt64 t, struct tm& tm)
+{
+    wxInt64 days = t / SECONDS_IN_DAY;
+    wxInt64 secs = t % SECONDS_IN_DAY;
+    if ( secs < 0 )
+    {
+        secs += SECONDS_IN_DAY;
+        days--;
+    }
+
+    tm.tm_hour = static_cast<int>(secs / 3600);
+    tm.tm_min = static_cast<int>(secs / 60 % 60);
+    tm.tm_sec = static_cast<int>(secs % 60);
+
+    // 1970-01-01 was Thursday
+    wxInt64 wday = (days + 4) % 7;
+    if ( wday < 0 )
+        wday += 7;
+    tm.tm_wday = static_cast<int>(wday);
+
+    const wxInt64 z = days + 719468;
+    const wxInt64 era = (z >= 0 ? z : z - 146096) / 146097;
+    const unsigned doe = static_cast<unsigned>(z - era * 146097);
+    const unsigned yoe = (doe - doe/1460 + doe/36524 - doe/146096) / 365;
+    const unsigned doy = doe - (365*yoe + yoe/4 - yoe/100);
+    const unsigned mp = (5*doy + 2)/153;
+    const unsigned d = doy - (153*mp + 2)/5 + 1;
+    const unsigned m = mp < 10 ? mp + 3 : mp - 9;
+    const wxInt64 y = static_cast<wxInt64>(yoe) + era * 400 + (m <= 2);
+
+    tm.tm_year = static_cast<int>(y - 1900);
+    tm.tm_mon = static_cast<int>(m - 1);
+    tm.tm_mday = static_cast<int>(d);
+    tm.tm_yday = static_cast<int>(days - DaysFromCivil(y, 1, 1));
+}
+
+// Return the number of seconds since the Epoch for the broken down time
+// interpreted as UTC, i.e. the inverse of CivilFromSeconds().
+wxInt64 SecondsFromCivil(const struct tm& tm)
+{
+    return DaysFromCivil(1900 + static_cast<wxInt64>(tm.tm_year),
+                         tm.tm_mon + 1, tm.tm_mday) * SECONDS_IN_DAY +
+           tm.tm_hour * 3600 + tm.tm_min * 60 + tm.tm_sec;
+}
+
+// This class allows to convert between UTC and local time without calling
+// localtime_r() and mktime() for every conversion: instead, the periods with
+// the same UTC offset are determined, using localtime_r(), for the whole
+// chunk of time containing the given time when it's used for the first time
+// and the subsequent conversions just look up the offset in them.
+//
+// As with wxGetTimeZone(), we assume that the time zone doesn't change while
+// the program is running.
+class wxLocalTimeCache
+{
+public:
+    // Get the offset of the local time from UTC in seconds and the DST flag
+    // for the given time. Returns false if it couldn't be determined.
+    bool GetOffset(time_t t, long* offset, int* isDST);
+
+    // Fill in the struct tm with the local time corresponding to the given
+    // UTC time, returns false if the cache can't be used for it.
+    bool ToLocal(time_t t, struct tm& tm)
+    {
+        long offset;
+        int isDST;
+        if ( !GetOffset(t, &offset, &isDST) )
+            return false;
+
+        CivilFromSeconds(static_cast<wxInt64>(t) + offset, tm);
+        tm.tm_isdst = isDST;
+
+        return true;
+    }
+
+    // Convert the local time to UTC if it's not close to a change of the UTC
+    // offset, i.e. if it's neither ambiguous nor invalid, and return false
+    // otherwise, meaning that mktime() needs to be used for it.
+    bool FromLocal(const struct tm& tm, time_t* t);
+
+    static wxLocalTimeCache& Get()
+    {
+        static wxLocalTimeCache s_cache;
+        return s_cache;
+    }
+
+private:
+    wxLocalTimeCache() = default;
+
+    // The offsets are computed for chunks of this length, sampling the local
+    // time once per day: this assumes that there are no periods shorter than
+    // a day, which is true for all the real time zones.
+    static const wxInt64 CHUNK_DAYS = 366;
+    static const wxInt64 CHUNK_SECONDS = CHUNK_DAYS * SECONDS_IN_DAY;
+
+    // Don't cache an unlimited number of chunks.
+    static const size_t MAX_CHUNKS = 1024;
+
+    // Period with the same UTC offset: it lasts from its start until the
+    // start of the next one or the end of the chunk.
+    struct Period
+    {
+        wxInt64 start;
+        long offset;
+        int isDST;
+    };
+
+    // Periods of the chunk, sorted by their start: if empty, the local time
+    // couldn't be determined for this chunk.
+    using Periods = std::vector<Period>;
+
+    // Determine the offset and DST flag using the standard library.
+    static bool GetFromRTL(wxInt64 t, Period& period);
+
+    // Compute the periods for the chunk with the given index.
+    static void ComputeChunk(wxInt64 chunk, Periods& periods);
+
+    std::map<wxInt64, Periods> m_chunks;
+
+    wxCriticalSection m_cs;
+
+    wxDECLARE_NO_COPY_CLASS(wxLocalTimeCache);
+};
+
+/* static */
+bool wxLocalTimeCache::GetFromRTL(wxInt64 t, Period& period)
+{
+    const time_t timet = static_cast<time_t>(t);
+    if ( static_cast<wxInt64>(timet) != t )
+        return false;
+
+    struct tm tmstruct;
+    const struct tm* const tm = wxLocaltime_r(&timet, &tmstruct);
+    if ( !tm )
+        return false;
+
+    period.start = t;
+    period.offset = static_cast<long>(SecondsFromCivil(*tm) - t);
+    period.isDST = tm->tm_isdst;
+
+    return true;
+}
+
+/* static */
+void wxLocalTimeCache::ComputeChunk(wxInt64 chunk, Periods& periods)
+{
+    const wxInt64 start = chunk * CHUNK_SECONDS;
+
+    Period period;
+    if ( !GetFromRTL(start, period) )
+        return;
+
+    periods.push_back(period);
+
+    for ( wxInt64 day = 1; day <= CHUNK_DAYS; day++ )
+    {
+        Period next;
+        if ( !GetFromRTL(start + day * SECONDS_IN_DAY, next) )
+        {
+            periods.clear();
+            return;
+        }
+
+        if ( next.offset == period.offset && next.isDST == period.isDST )
+            continue;
+
+        // Find the exact moment of the change.
+        wxInt64 lo = start + (day - 1) * SECONDS_IN_DAY,
+                hi = next.start;
+        while ( hi - lo > 1 )
+        {
+            const wxInt64 mid = lo + (hi - lo) / 2;
+
+            Period p;
+            if ( !GetFromRTL(mid, p) )
+            {
+                periods.clear();
+                return;
+            }
+
+            if ( p.offset == period.offset && p.isDST == period.isDST )
+                lo = mid;
+            else
+                hi = mid;
+        }
+
+        period = next;
+
+        // The last change at the very end of the chunk belongs to the next
+        // one.
+        if ( hi < start + CHUNK_SECONDS )
+        {
+            period.start = hi;
+            periods.push_back(period);
+        }
+    }
+}
+
+bool wxLocalTimeCache::GetOffset(time_t t, long* offset, int* isDST)
+{
+    const wxInt64 tt = static_cast<wxInt64>(t);
+
+    wxInt64 chunk = tt / CHUNK_SECONDS;
+    if ( tt % CHUNK_SECONDS < 0 )
+        chunk--;
+
+    wxCriticalSectionLocker lock(m_cs);
+
+    auto it = m_chunks.find(chunk);
+    if ( it == m_chunks.end() )
+    {
+        if ( m_chunks.size() >= MAX_CHUNKS )
+            m_chunks.clear();
+
+        it = m_chunks.insert(std::make_pair(chunk, Periods())).first;
+        ComputeChunk(chunk, it->second);
+    }
+
+    const Periods& periods = it->second;
+    if ( periods.empty() )
+        return false;
+
+    // Find the last period starting before or at the given time.
+    auto p = std::upper_bound(periods.begin(), periods.end(), tt,
+                              [](wxInt64 value, const Period& period)
+                              {
+                                  return value < period.start;
+                              });
+    --p;
+
+    *offset = p->offset;
+    *isDST = p->isDST;
+
+    return true;
+}
+
+bool wxLocalTimeCache::FromLocal(const struct tm& tm, time_t* t)
+{
+    // We don't handle the non-normalized values nor the explicitly specified
+    // DST flag here, leave this to mktime().
+    if ( tm.tm_isdst >= 0 ||
+            tm.tm_mon < 0 || tm.tm_mon > 11 ||
+            tm.tm_mday < 1 || tm.tm_mday > 31 ||
+            tm.tm_hour < 0 || tm.tm_hour > 23 ||
+            tm.tm_min < 0 || tm.tm_min > 59 ||
+            tm.tm_sec < 0 || tm.tm_sec > 59 )
+        return false;
+
+    const wxInt64 local = SecondsFromCivil(tm);
+
+    // Guess the offset using the UTC time equal to the local one and then
+    // refine it: this works as long as we're not close to an offset change.
+    long offset,
+         offset2;
+    int isDST;
+    if ( !GetOffset(static_cast<time_t>(local), &offset, &isDST) ||
+            !GetOffset(static_cast<time_t>(local - offset), &offset, &isDST) )
+        return false;
+
+    const wxInt64 utc = local - offset;
+
+    // Check that there is no change of the offset nearby, which could make
+    // this time ambiguous or invalid: as the offset changes are never bigger
+    // than a day, checking for 2 days before and after is enough.
+    const wxInt64 margin = 2*SECONDS_IN_DAY;
+    if ( !GetOffset(static_cast<time_t>(utc - margin), &offset2, &isDST) ||
+            offset2 != offset ||
+            !GetOffset(static_cast<time_t>(utc + margin), &offset2, &isDST) ||
+            offset2 != offset )
+        return false;
+
+    *t = static_cast<time_t>(utc);
+    return static_cast<wxInt64>(*t) == utc;
+}
+
+} // anonymous namespace
+
 // ============================================================================
 // implementation of wxDateTime
 // ============================================================================
@@ -1156,8 +1462,13 @@ wxDateTime wxDateTime::GetEndDST(int year, Country country)
 // the values in the tm structure contain the local time
 wxDateTime& wxDateTime::Set(const struct tm& tm)
 {
+    // avoid calling mktime() if we can
+    time_t timet;
+    if ( wxLocalTimeCache::Get().FromLocal(tm, &timet) )
+        return Set(timet);
+
     struct tm tm2(tm);
-    time_t timet = mktime(&tm2);
+    timet = mktime(&tm2);
 
     if ( timet == (time_t)-1 )
     {
@@ -1466,9 +1777,30 @@ wxDateTime::Tm wxDateTime::GetTm(const TimeZone& tz) const
     time_t time = GetTicks();
     if ( time != (time_t)-1 )
     {
-        // Try to use the RTL.
+        // Avoid calling the RTL functions if possible: for the local time,
+        // use the cached offsets and for the fixed offset just add it.
         struct tm tmstruct;
-        if ( const tm* tm = wxTryGetTm(tmstruct, time, tz) )
+        const tm* tm = nullptr;
+        if ( tz.IsLocal() )
+        {
+            if ( wxLocalTimeCache::Get().ToLocal(time, tmstruct) )
+                tm = &tmstruct;
+            else
+                tm = wxTryGetTm(tmstruct, time, tz);
+        }
+        else
+        {
+            // As in wxTryGetTm(), use the generic code for negative values.
+            const wxInt64 t = static_cast<wxInt64>(time) + tz.GetOffset();
+            if ( t >= 0 )
+            {
+                CivilFromSeconds(t, tmstruct);
+                tmstruct.tm_isdst = 0;
+                tm = &tmstruct;
+            }
+        }
+
+        if ( tm )
         {
             // adjust the milliseconds
             Tm tm2(*tm, tz);
@@ -2084,6 +2416,11 @@ int wxDateTime::IsDST(wxDateTime::Country country) const
     time_t timet = GetTicks();
     if ( timet != (time_t)-1 )
     {
+        long offset;
+        int isDST;
+        if ( wxLocalTimeCache::Get().GetOffset(timet, &offset, &isDST) )
+            return isDST;
+
         struct tm tmstruct;
         tm *tm = wxLocaltime_r(&timet, &tmstruct);
 
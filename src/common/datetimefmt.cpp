@@ -96,11 +96,21 @@ bool GetNumericToken(size_t len,
                      unsigned long *number,
                      size_t *numScannedDigits = nullptr)
 {
+    // accumulate the number directly instead of building a string and
+    // converting it, this is called for every numeric field when parsing
     size_t n = 1;
-    wxString s;
+    unsigned long value = 0;
+    bool found = false,
+         overflow = false;
     while ( p != end && wxIsdigit(*p) )
     {
-        s += *p++;
+        found = true;
+
+        const unsigned digit = *p++ - '0';
+        if ( value > (ULONG_MAX - digit) / 10 )
+            overflow = true;
+        else
+            value = value*10 + digit;
 
         if ( len && ++n > len )
             break;
@@ -111,7 +121,11 @@ bool GetNumericToken(size_t len,
         *numScannedDigits = n - 1;
     }
 
-    return !s.empty() && s.ToULong(number);
+    if ( !found || overflow )
+        return false;
+
+    *number = value;
+    return true;
 }
 
 // scans all alphabetic characters and returns the resulting string
@@ -306,6 +320,375 @@ ParseFormatAt(wxString::const_iterator& p,
     return dt;
 }
 
+// the fields found while parsing a date using the given format
+struct ParsedDateFields
+{
+    // construct the date from the fields found, using dateDef or, if it is
+    // invalid, dt itself or today as the default for the missing ones
+    bool Apply(wxDateTime& dt, const wxDateTime& dateDef) const;
+
+    // parse one of the numeric fields or the time zone offset, i.e. any of
+    // "deHIjlmMSwyYz" format specifiers, advancing input to the end of it
+    bool ParseField(wxUniChar spec,
+                    size_t width,
+                    wxString::const_iterator& input,
+                    const wxString::const_iterator& end);
+
+    // what fields have we found?
+    bool haveWDay = false,
+         haveYDay = false,
+         haveDay = false,
+         haveMon = false,
+         haveYear = false,
+         haveHour = false,
+         haveMin = false,
+         haveSec = false,
+         haveMsec = false;
+
+    bool hourIsIn12hFormat = false, // or in 24h one?
+         isPM = false;              // AM by default
+
+    bool haveTimeZone = false;
+
+    // and the value of the items we have
+    wxDateTime::wxDateTime_t msec = 0,
+                             sec = 0,
+                             min = 0,
+                             hour = 0;
+    wxDateTime::WeekDay wday = wxDateTime::Inv_WeekDay;
+    wxDateTime::wxDateTime_t yday = 0,
+                             mday = 0;
+    wxDateTime::Month mon = wxDateTime::Inv_Month;
+    int year = 0;
+    long timeZone = 0;  // time zone in seconds as expected in Tm structure
+};
+
+bool ParsedDateFields::Apply(wxDateTime& dt, const wxDateTime& dateDef) const
+{
+    wxDateTime::Tm tmDef;
+    if ( dateDef.IsValid() )
+    {
+        // take this date as default
+        tmDef = dateDef.GetTm();
+    }
+    else if ( dt.IsValid() )
+    {
+        // if this date is valid, don't change it
+        tmDef = dt.GetTm();
+    }
+    else
+    {
+        // no default and this date is invalid - fall back to Today()
+        tmDef = wxDateTime::Today().GetTm();
+    }
+
+    wxDateTime::Tm tm = tmDef;
+
+    // set the date
+    if ( haveMon )
+    {
+        tm.mon = mon;
+    }
+
+    if ( haveYear )
+    {
+        tm.year = year;
+    }
+
+    // TODO we don't check here that the values are consistent, if both year
+    //      day and month/day were found, we just ignore the year day and we
+    //      also always ignore the week day
+    if ( haveDay )
+    {
+        if ( mday > wxDateTime::GetNumberOfDays(tm.mon, tm.year) )
+            return false;
+
+        tm.mday = mday;
+    }
+    else if ( haveYDay )
+    {
+        if ( yday > wxDateTime::GetNumberOfDays(tm.year) )
+            return false;
+
+        wxDateTime::Tm tm2 = wxDateTime(1, wxDateTime::Jan, tm.year).
+                                SetToYearDay(yday).GetTm();
+
+        tm.mon = tm2.mon;
+        tm.mday = tm2.mday;
+    }
+
+    // set the time
+    if ( haveHour )
+    {
+        tm.hour = hour;
+
+        // deal with AM/PM
+        if ( hourIsIn12hFormat && isPM )
+        {
+            // translate to 24hour format
+            tm.hour += 12;
+        }
+        //else: either already in 24h format or no translation needed
+    }
+
+    if ( haveMin )
+    {
+        tm.min = min;
+    }
+
+    if ( haveSec )
+    {
+        tm.sec = sec;
+    }
+
+    if ( haveMsec )
+        tm.msec = msec;
+
+    dt.Set(tm);
+
+    if ( haveTimeZone )
+        dt.MakeFromTimezone(timeZone);
+
+    // finally check that the week day is consistent -- if we had it
+    if ( haveWDay && dt.GetWeekDay() != wday )
+        return false;
+
+    return true;
+}
+
+bool
+ParsedDateFields::ParseField(wxUniChar spec,
+                             size_t width,
+                             wxString::const_iterator& input,
+                             const wxString::const_iterator& end)
+{
+    unsigned long num;
+
+    switch ( spec.GetValue() )
+    {
+        case wxT('d'):       // day of a month (01-31)
+        case 'e':           // day of a month (1-31) (GNU extension)
+            if ( !GetNumericToken(width, input, end, &num) ||
+                    (num > 31) || (num < 1) )
+            {
+                // no match
+                return false;
+            }
+
+            // we can't check whether the day range is correct yet, will
+            // do it later - assume ok for now
+            haveDay = true;
+            mday = (wxDateTime::wxDateTime_t)num;
+            break;
+
+        case wxT('H'):       // hour in 24h format (00-23)
+            if ( !GetNumericToken(width, input, end, &num) || (num > 23) )
+            {
+                // no match
+                return false;
+            }
+
+            haveHour = true;
+            hour = (wxDateTime::wxDateTime_t)num;
+            break;
+
+        case wxT('I'):       // hour in 12h format (01-12)
+            if ( !GetNumericToken(width, input, end, &num) ||
+                    !num || (num > 12) )
+            {
+                // no match
+                return false;
+            }
+
+            haveHour = true;
+            hourIsIn12hFormat = true;
+            hour = (wxDateTime::wxDateTime_t)(num % 12); // 12 should be 0
+            break;
+
+        case wxT('j'):       // day of the year
+            if ( !GetNumericToken(width, input, end, &num) ||
+                    !num || (num > 366) )
+            {
+                // no match
+                return false;
+            }
+
+            haveYDay = true;
+            yday = (wxDateTime::wxDateTime_t)num;
+            break;
+
+        case wxT('l'):       // milliseconds (0-999)
+            if ( !GetNumericToken(width, input, end, &num) )
+                return false;
+
+            haveMsec = true;
+            msec = (wxDateTime::wxDateTime_t)num;
+            break;
+
+        case wxT('m'):       // month as a number (01-12)
+            if ( !GetNumericToken(width, input, end, &num) ||
+                    !num || (num > 12) )
+            {
+                // no match
+                return false;
+            }
+
+            haveMon = true;
+            mon = (wxDateTime::Month)(num - 1);
+            break;
+
+        case wxT('M'):       // minute as a decimal number (00-59)
+            if ( !GetNumericToken(width, input, end, &num) ||
+                    (num > 59) )
+            {
+                // no match
+                return false;
+            }
+
+            haveMin = true;
+            min = (wxDateTime::wxDateTime_t)num;
+            break;
+
+        case wxT('S'):       // second as a decimal number (00-61)
+            if ( !GetNumericToken(width, input, end, &num) ||
+                    (num > 61) )
+            {
+                // no match
+                return false;
+            }
+
+            haveSec = true;
+            sec = (wxDateTime::wxDateTime_t)num;
+            break;
+
+        case wxT('w'):       // weekday as a number (0-6), Sunday = 0
+            if ( !GetNumericToken(width, input, end, &num) ||
+                    (num > 6) )
+            {
+                // no match
+                return false;
+            }
+
+            haveWDay = true;
+            wday = (wxDateTime::WeekDay)num;
+            break;
+
+        case wxT('y'):       // year without century (00-99)
+            if ( !GetNumericToken(width, input, end, &num) ||
+                    (num > 99) )
+            {
+                // no match
+                return false;
+            }
+
+            haveYear = true;
+
+            // TODO should have an option for roll over date instead of
+            //      hard coding it here
+            year = (num > 30 ? 1900 : 2000) + (wxDateTime::wxDateTime_t)num;
+            break;
+
+        case wxT('Y'):       // year with century
+            if ( !GetNumericToken(width, input, end, &num) )
+            {
+                // no match
+                return false;
+            }
+
+            haveYear = true;
+            year = (wxDateTime::wxDateTime_t)num;
+            break;
+
+        case wxT('z'):
+            {
+                // check that we have something here at all
+                if ( input == end )
+                    return false;
+
+                if ( *input == wxS('Z') )
+                {
+                    // Time is in UTC.
+                    ++input;
+                    haveTimeZone = true;
+                    break;
+                }
+
+                // Check if there's either a plus, hyphen-minus, or
+                // minus sign.
+                bool minusFound;
+                if ( *input == wxS('+') )
+                    minusFound = false;
+                else if
+                (
+                    *input == wxS('-')
+                    || *input == wxString::FromUTF8("\xe2\x88\x92")
+                )
+                    minusFound = true;
+                else
+                    return false;   // no match
+
+                ++input;
+
+                // Here should follow exactly 2 digits for hours (HH).
+                const size_t numRequiredDigits = 2;
+                size_t numScannedDigits;
+
+                unsigned long hours;
+                if ( !GetNumericToken(numRequiredDigits, input, end,
+                                      &hours, &numScannedDigits)
+                     || numScannedDigits != numRequiredDigits)
+                {
+                    return false; // No match.
+                }
+
+                // Optionally followed by a colon separator.
+                bool mustHaveMinutes = false;
+                if ( input != end && *input == wxS(':') )
+                {
+                    mustHaveMinutes = true;
+                    ++input;
+                }
+
+                // Optionally followed by exactly 2 digits for minutes (MM).
+                unsigned long minutes = 0;
+                if ( !GetNumericToken(numRequiredDigits, input, end,
+                                      &minutes, &numScannedDigits)
+                     || numScannedDigits != numRequiredDigits)
+                {
+                    if (mustHaveMinutes || numScannedDigits)
+                    {
+                        // No match if we must have minutes, or digits
+                        // for minutes were specified but not exactly 2.
+                        return false;
+                    }
+                }
+
+                /*
+                Contemporary offset limits are -12:00 and +14:00.
+                However historically offsets of over +/- 15 hours
+                existed so be a bit more flexible. Info retrieved
+                from Time Zone Database at
+                https://www.iana.org/time-zones.
+                */
+                if ( hours > 15 || minutes > 59 )
+                    return false;   // bad format
+
+                timeZone = 3600*hours + 60*minutes;
+                if ( minusFound )
+                    timeZone = -timeZone;
+
+                haveTimeZone = true;
+            }
+            break;
+
+        default:
+            wxFAIL_MSG( "unexpected format specifier" );
+            return false;
+    }
+
+    return true;
+}
+
 } // anonymous namespace
 
 // ----------------------------------------------------------------------------
@@ -1045,35 +1428,9 @@ wxDateTime::ParseFormat(const wxString& date,
     wxCHECK_MSG( endParse, false, "end iterator pointer must be specified" );
 
     wxString str;
-    unsigned long num;
-
-    // what fields have we found?
-    bool haveWDay = false,
-         haveYDay = false,
-         haveDay = false,
-         haveMon = false,
-         haveYear = false,
-         haveHour = false,
-         haveMin = false,
-         haveSec = false,
-         haveMsec = false;
-
-    bool hourIsIn12hFormat = false, // or in 24h one?
-         isPM = false;              // AM by default
-
-    bool haveTimeZone = false;
 
-    // and the value of the items we have (init them to get rid of warnings)
-    wxDateTime_t msec = 0,
-                 sec = 0,
-                 min = 0,
-                 hour = 0;
-    WeekDay wday = Inv_WeekDay;
-    wxDateTime_t yday = 0,
-                 mday = 0;
-    wxDateTime::Month mon = Inv_Month;
-    int year = 0;
-    long timeZone = 0;  // time zone in seconds as expected in Tm structure
+    // the fields we have found
+    ParsedDateFields fields;
 
     wxString::const_iterator input = date.begin();
     const wxString::const_iterator end = date.end();
@@ -1152,37 +1509,37 @@ wxDateTime::ParseFormat(const wxString& date,
             case wxT('a'):       // a weekday name
             case wxT('A'):
                 {
-                    wday = GetWeekDayFromName
+                    fields.wday = GetWeekDayFromName
                            (
                             input, end,
                             *fmt == 'a' ? Name_Abbr : Name_Full,
                             DateLang_Local
                            );
-                    if ( wday == Inv_WeekDay )
+                    if ( fields.wday == Inv_WeekDay )
                     {
                         // no match
                         return false;
                     }
                 }
-                haveWDay = true;
+                fields.haveWDay = true;
                 break;
 
             case wxT('b'):       // a month name
             case wxT('B'):
                 {
-                    mon = GetMonthFromName
+                    fields.mon = GetMonthFromName
                           (
                             input, end,
                             *fmt == 'b' ? Name_Abbr : Name_Full,
                             DateLang_Local
                           );
-                    if ( mon == Inv_Month )
+                    if ( fields.mon == Inv_Month )
                     {
                         // no match
                         return false;
                     }
                 }
-                haveMon = true;
+                fields.haveMon = true;
                 break;
 
             case wxT('c'):       // locale default date and time  representation
@@ -1213,32 +1570,37 @@ wxDateTime::ParseFormat(const wxString& date,
 
                     const Tm tm = dt.GetTm();
 
-                    hour = tm.hour;
-                    min = tm.min;
-                    sec = tm.sec;
+                    fields.hour = tm.hour;
+                    fields.min = tm.min;
+                    fields.sec = tm.sec;
 
-                    year = tm.year;
-                    mon = tm.mon;
-                    mday = tm.mday;
+                    fields.year = tm.year;
+                    fields.mon = tm.mon;
+                    fields.mday = tm.mday;
 
-                    haveDay = haveMon = haveYear =
-                    haveHour = haveMin = haveSec = true;
+                    fields.haveDay = fields.haveMon = fields.haveYear =
+                    fields.haveHour = fields.haveMin = fields.haveSec = true;
                 }
                 break;
 
-            case wxT('d'):       // day of a month (01-31)
-            case 'e':           // day of a month (1-31) (GNU extension)
-                if ( !GetNumericToken(width, input, end, &num) ||
-                        (num > 31) || (num < 1) )
+            case wxT('d'):       // numeric fields
+            case 'e':
+            case wxT('H'):
+            case wxT('I'):
+            case wxT('j'):
+            case wxT('l'):
+            case wxT('m'):
+            case wxT('M'):
+            case wxT('S'):
+            case wxT('w'):
+            case wxT('y'):
+            case wxT('Y'):
+            case wxT('z'):       // and the time zone offset
+                if ( !fields.ParseField(*fmt, width, input, end) )
                 {
                     // no match
                     return false;
                 }
-
-                // we can't check whether the day range is correct yet, will
-                // do it later - assume ok for now
-                haveDay = true;
-                mday = (wxDateTime_t)num;
                 break;
 
             case wxT('F'):       // ISO 8601 date
@@ -1249,121 +1611,53 @@ wxDateTime::ParseFormat(const wxString& date,
 
                     const Tm tm = dt.GetTm();
 
-                    year = tm.year;
-                    mon = tm.mon;
-                    mday = tm.mday;
+                    fields.year = tm.year;
+                    fields.mon = tm.mon;
+                    fields.mday = tm.mday;
 
-                    haveDay = haveMon = haveYear = true;
+                    fields.haveDay = fields.haveMon = fields.haveYear = true;
                 }
                 break;
 
-            case wxT('H'):       // hour in 24h format (00-23)
-                if ( !GetNumericToken(width, input, end, &num) || (num > 23) )
+            case wxT('p'):       // AM or PM string
                 {
-                    // no match
-                    return false;
-                }
+                    wxString am, pm;
+                    GetAmPmStrings(&am, &pm);
+
+                    // we can never match %p in locales which don't use AM/PM
+                    if ( am.empty() || pm.empty() )
+                        return false;
 
-                haveHour = true;
-                hour = (wxDateTime_t)num;
+                    const size_t pos = input - date.begin();
+                    if ( date.compare(pos, pm.length(), pm) == 0 )
+                    {
+                        fields.isPM = true;
+                        input += pm.length();
+                    }
+                    else if ( date.compare(pos, am.length(), am) == 0 )
+                    {
+                        input += am.length();
+                    }
+                    else // no match
+                    {
+                        return false;
+                    }
+                }
                 break;
 
-            case wxT('I'):       // hour in 12h format (01-12)
-                if ( !GetNumericToken(width, input, end, &num) ||
-                        !num || (num > 12) )
-                {
-                    // no match
-                    return false;
-                }
-
-                haveHour = true;
-                hourIsIn12hFormat = true;
-                hour = (wxDateTime_t)(num % 12);        // 12 should be 0
-                break;
-
-            case wxT('j'):       // day of the year
-                if ( !GetNumericToken(width, input, end, &num) ||
-                        !num || (num > 366) )
-                {
-                    // no match
-                    return false;
-                }
-
-                haveYDay = true;
-                yday = (wxDateTime_t)num;
-                break;
-
-            case wxT('l'):       // milliseconds (0-999)
-                if ( !GetNumericToken(width, input, end, &num) )
-                    return false;
-
-                haveMsec = true;
-                msec = (wxDateTime_t)num;
-                break;
-
-            case wxT('m'):       // month as a number (01-12)
-                if ( !GetNumericToken(width, input, end, &num) ||
-                        !num || (num > 12) )
-                {
-                    // no match
-                    return false;
-                }
-
-                haveMon = true;
-                mon = (Month)(num - 1);
-                break;
-
-            case wxT('M'):       // minute as a decimal number (00-59)
-                if ( !GetNumericToken(width, input, end, &num) ||
-                        (num > 59) )
-                {
-                    // no match
-                    return false;
-                }
-
-                haveMin = true;
-                min = (wxDateTime_t)num;
-                break;
-
-            case wxT('p'):       // AM or PM string
-                {
-                    wxString am, pm;
-                    GetAmPmStrings(&am, &pm);
-
-                    // we can never match %p in locales which don't use AM/PM
-                    if ( am.empty() || pm.empty() )
-                        return false;
-
-                    const size_t pos = input - date.begin();
-                    if ( date.compare(pos, pm.length(), pm) == 0 )
-                    {
-                        isPM = true;
-                        input += pm.length();
-                    }
-                    else if ( date.compare(pos, am.length(), am) == 0 )
-                    {
-                        input += am.length();
-                    }
-                    else // no match
-                    {
-                        return false;
-                    }
-                }
-                break;
-
-            case wxT('r'):       // time as %I:%M:%S %p
+            case wxT('r'):       // time as %I:%M:%S %p
                 {
                     wxDateTime dt;
                     if ( !dt.ParseFormat(wxString(input, end),
                                          wxS("%I:%M:%S %p"), &input) )
                         return false;
 
-                    haveHour = haveMin = haveSec = true;
+                    fields.haveHour = fields.haveMin = fields.haveSec = true;
 
                     const Tm tm = dt.GetTm();
-                    hour = tm.hour;
-                    min = tm.min;
-                    sec = tm.sec;
+                    fields.hour = tm.hour;
+                    fields.min = tm.min;
+                    fields.sec = tm.sec;
                 }
                 break;
 
@@ -1374,27 +1668,15 @@ wxDateTime::ParseFormat(const wxString& date,
                     if ( !dt.IsValid() )
                         return false;
 
-                    haveHour =
-                    haveMin = true;
+                    fields.haveHour =
+                    fields.haveMin = true;
 
                     const Tm tm = dt.GetTm();
-                    hour = tm.hour;
-                    min = tm.min;
+                    fields.hour = tm.hour;
+                    fields.min = tm.min;
                 }
                 break;
 
-            case wxT('S'):       // second as a decimal number (00-61)
-                if ( !GetNumericToken(width, input, end, &num) ||
-                        (num > 61) )
-                {
-                    // no match
-                    return false;
-                }
-
-                haveSec = true;
-                sec = (wxDateTime_t)num;
-                break;
-
             case wxT('T'):       // time as %H:%M:%S
                 {
                     const wxDateTime
@@ -1402,29 +1684,17 @@ wxDateTime::ParseFormat(const wxString& date,
                     if ( !dt.IsValid() )
                         return false;
 
-                    haveHour =
-                    haveMin =
-                    haveSec = true;
+                    fields.haveHour =
+                    fields.haveMin =
+                    fields.haveSec = true;
 
                     const Tm tm = dt.GetTm();
-                    hour = tm.hour;
-                    min = tm.min;
-                    sec = tm.sec;
+                    fields.hour = tm.hour;
+                    fields.min = tm.min;
+                    fields.sec = tm.sec;
                 }
                 break;
 
-            case wxT('w'):       // weekday as a number (0-6), Sunday = 0
-                if ( !GetNumericToken(width, input, end, &num) ||
-                        (wday > 6) )
-                {
-                    // no match
-                    return false;
-                }
-
-                haveWDay = true;
-                wday = (WeekDay)num;
-                break;
-
             case wxT('x'):       // locale default date representation
                 {
 #if wxUSE_INTL
@@ -1465,13 +1735,13 @@ wxDateTime::ParseFormat(const wxString& date,
 
                     const Tm tm = dt.GetTm();
 
-                    haveDay =
-                    haveMon =
-                    haveYear = true;
+                    fields.haveDay =
+                    fields.haveMon =
+                    fields.haveYear = true;
 
-                    year = tm.year;
-                    mon = tm.mon;
-                    mday = tm.mday;
+                    fields.year = tm.year;
+                    fields.mon = tm.mon;
+                    fields.mday = tm.mday;
                 }
 
                 break;
@@ -1498,122 +1768,14 @@ wxDateTime::ParseFormat(const wxString& date,
                     if ( !dt.IsValid() )
                         return false;
 
-                    haveHour =
-                    haveMin =
-                    haveSec = true;
+                    fields.haveHour =
+                    fields.haveMin =
+                    fields.haveSec = true;
 
                     const Tm tm = dt.GetTm();
-                    hour = tm.hour;
-                    min = tm.min;
-                    sec = tm.sec;
-                }
-                break;
-
-            case wxT('y'):       // year without century (00-99)
-                if ( !GetNumericToken(width, input, end, &num) ||
-                        (num > 99) )
-                {
-                    // no match
-                    return false;
-                }
-
-                haveYear = true;
-
-                // TODO should have an option for roll over date instead of
-                //      hard coding it here
-                year = (num > 30 ? 1900 : 2000) + (wxDateTime_t)num;
-                break;
-
-            case wxT('Y'):       // year with century
-                if ( !GetNumericToken(width, input, end, &num) )
-                {
-                    // no match
-                    return false;
-                }
-
-                haveYear = true;
-                year = (wxDateTime_t)num;
-                break;
-
-            case wxT('z'):
-                {
-                    // check that we have something here at all
-                    if ( input == end )
-                        return false;
-
-                    if ( *input == wxS('Z') )
-                    {
-                        // Time is in UTC.
-                        ++input;
-                        haveTimeZone = true;
-                        break;
-                    }
-
-                    // Check if there's either a plus, hyphen-minus, or
-                    // minus sign.
-                    bool minusFound;
-                    if ( *input == wxS('+') )
-                        minusFound = false;
-                    else if
-                    (
-                        *input == wxS('-')
-                        || *input == wxString::FromUTF8("\xe2\x88\x92")
-                    )
-                        minusFound = true;
-                    else
-                        return false;   // no match
-
-                    ++input;
-
-                    // Here should follow exactly 2 digits for hours (HH).
-                    const size_t numRequiredDigits = 2;
-                    size_t numScannedDigits;
-
-                    unsigned long hours;
-                    if ( !GetNumericToken(numRequiredDigits, input, end,
-                                          &hours, &numScannedDigits)
-                         || numScannedDigits != numRequiredDigits)
-                    {
-                        return false; // No match.
-                    }
-
-                    // Optionally followed by a colon separator.
-                    bool mustHaveMinutes = false;
-                    if ( input != end && *input == wxS(':') )
-                    {
-                        mustHaveMinutes = true;
-                        ++input;
-                    }
-
-                    // Optionally followed by exactly 2 digits for minutes (MM).
-                    unsigned long minutes = 0;
-                    if ( !GetNumericToken(numRequiredDigits, input, end,
-                                          &minutes, &numScannedDigits)
-                         || numScannedDigits != numRequiredDigits)
-                    {
-                        if (mustHaveMinutes || numScannedDigits)
-                        {
-                            // No match if we must have minutes, or digits
-                            // for minutes were specified but not exactly 2.
-                            return false;
-                        }
-                    }
-
-                    /*
-                    Contemporary offset limits are -12:00 and +14:00.
-                    However historically offsets of over +/- 15 hours
-                    existed so be a bit more flexible. Info retrieved
-                    from Time Zone Database at
-                    https://www.iana.org/time-zones.
-                    */
-                    if ( hours > 15 || minutes > 59 )
-                        return false;   // bad format
-
-                    timeZone = 3600*hours + 60*minutes;
-                    if ( minusFound )
-                        timeZone = -timeZone;
-
-                    haveTimeZone = true;
+                    fields.hour = tm.hour;
+                    fields.min = tm.min;
+                    fields.sec = tm.sec;
                 }
                 break;
 
@@ -1642,91 +1804,7 @@ wxDateTime::ParseFormat(const wxString& date,
     }
 
     // format matched, try to construct a date from what we have now
-    Tm tmDef;
-    if ( dateDef.IsValid() )
-    {
-        // take this date as default
-        tmDef = dateDef.GetTm();
-    }
-    else if ( IsValid() )
-    {
-        // if this date is valid, don't change it
-        tmDef = GetTm();
-    }
-    else
-    {
-        // no default and this date is invalid - fall back to Today()
-        tmDef = Today().GetTm();
-    }
-
-    Tm tm = tmDef;
-
-    // set the date
-    if ( haveMon )
-    {
-        tm.mon = mon;
-    }
-
-    if ( haveYear )
-    {
-        tm.year = year;
-    }
-
-    // TODO we don't check here that the values are consistent, if both year
-    //      day and month/day were found, we just ignore the year day and we
-    //      also always ignore the week day
-    if ( haveDay )
-    {
-        if ( mday > GetNumberOfDays(tm.mon, tm.year) )
-            return false;
-
-        tm.mday = mday;
-    }
-    else if ( haveYDay )
-    {
-        if ( yday > GetNumberOfDays(tm.year) )
-            return false;
-
-        Tm tm2 = wxDateTime(1, Jan, tm.year).SetToYearDay(yday).GetTm();
-
-        tm.mon = tm2.mon;
-        tm.mday = tm2.mday;
-    }
-
-    // deal with AM/PM
-    if ( haveHour && hourIsIn12hFormat && isPM )
-    {
-        // translate to 24hour format
-        hour += 12;
-    }
-    //else: either already in 24h format or no translation needed
-
-    // set the time
-    if ( haveHour )
-    {
-        tm.hour = hour;
-    }
-
-    if ( haveMin )
-    {
-        tm.min = min;
-    }
-
-    if ( haveSec )
-    {
-        tm.sec = sec;
-    }
-
-    if ( haveMsec )
-        tm.msec = msec;
-
-    Set(tm);
-
-    if ( haveTimeZone )
-        MakeFromTimezone(timeZone);
-
-    // finally check that the week day is consistent -- if we had it
-    if ( haveWDay && GetWeekDay() != wday )
+    if ( !fields.Apply(*this, dateDef) )
         return false;
 
     *endParse = input;
@@ -2319,6 +2397,349 @@ bool wxDateTime::IsWorkDay(Country WXUNUSED(country)) const
     return !wxDateTimeHolidayAuthority::IsHoliday(*this);
 }
 
+// ============================================================================
+// wxDateTimeFormatter
+// ============================================================================
+
+namespace
+{
+
+// append the number padded with zeros to the given width, as "%0*d" would do
+void AppendPaddedNumber(wxString& out, int value, unsigned width)
+{
+    wxChar buf[16];
+    wxChar* const bufEnd = buf + WXSIZEOF(buf);
+    wxChar* p = bufEnd;
+
+    unsigned n = value < 0 ? 0u - static_cast<unsigned>(value)
+                           : static_cast<unsigned>(value);
+    do
+    {
+        *--p = wxT('0') + n % 10;
+        n /= 10;
+    } while ( n );
+
+    unsigned len = bufEnd - p;
+    if ( value < 0 )
+    {
+        out += wxT('-');
+        len++;
+    }
+
+    for ( ; len < width; len++ )
+        out += wxT('0');
+
+    out.append(p, bufEnd - p);
+}
+
+} // anonymous namespace
+
+/* static */
+bool
+wxDateTimeFormatter::Compile(const wxString& format,
+                             Tokens& tokens,
+                             bool forParsing)
+{
+    Token literal;
+    const auto flushLiteral = [&]()
+    {
+        if ( !literal.text.empty() )
+        {
+            tokens.push_back(literal);
+            literal.text.clear();
+        }
+    };
+
+    const wxString::const_iterator end = format.end();
+    for ( wxString::const_iterator p = format.begin(); p != end; ++p )
+    {
+        if ( *p != wxT('%') )
+        {
+            literal.text += *p;
+            continue;
+        }
+
+        const wxString::const_iterator start = p;
+
+        Token tok;
+        if ( forParsing )
+        {
+            // accept the same optional padding and width as ParseFormat()
+            if ( ++p != end && (*p == '-' || *p == '_' || *p == '0') )
+                ++p;
+
+            for ( ; p != end && wxIsdigit(*p); ++p )
+                tok.width = tok.width*10 + (*p - '0');
+        }
+        else
+        {
+            // we don't need to interpret the flags and width, as the fields
+            // using them are formatted by wxDateTime::Format(), just find
+            // where the specification ends
+            while ( ++p != end &&
+                        (*p == '-' || *p == '+' || *p == ' ' || *p == '_' ||
+                            wxIsdigit(*p)) )
+            {
+                tok.hasModifiers = true;
+            }
+        }
+
+        if ( p == end )
+        {
+            // incomplete specification at the end of the format: this is
+            // invalid and we let wxDateTime functions deal with it
+            if ( forParsing )
+                return false;
+
+            tok.text.assign(start, end);
+            tok.spec = wxT('%');
+            tok.hasModifiers = true;
+
+            flushLiteral();
+            tokens.push_back(tok);
+            break;
+        }
+
+        tok.spec = static_cast<wxChar>((*p).GetValue());
+        tok.text.assign(start, p + 1);
+
+        if ( forParsing )
+        {
+            switch ( tok.spec )
+            {
+                case wxT('%'):
+                    literal.text += wxT('%');
+                    continue;
+
+                case wxT('F'):
+                case wxT('R'):
+                case wxT('T'):
+                    // these fields are just shortcuts for the combinations
+                    // of the other ones
+                    flushLiteral();
+                    Compile(tok.spec == wxT('F') ? wxS("%Y-%m-%d")
+                                : tok.spec == wxT('R') ? wxS("%H:%M")
+                                                       : wxS("%H:%M:%S"),
+                            tokens, true);
+                    continue;
+
+                case wxT('d'):
+                case wxT('e'):
+                case wxT('H'):
+                case wxT('I'):
+                case wxT('j'):
+                case wxT('l'):
+                case wxT('m'):
+                case wxT('M'):
+                case wxT('S'):
+                case wxT('w'):
+                case wxT('y'):
+                case wxT('Y'):
+                case wxT('z'):
+                    break;
+
+                default:
+                    // locale-dependent fields need ParseFormat()
+                    return false;
+            }
+
+            // the default widths are the same as in ParseFormat()
+            if ( !tok.width )
+            {
+                switch ( tok.spec )
+                {
+                    case wxT('Y'):
+                        tok.width = 4;
+                        break;
+
+                    case wxT('j'):
+                    case wxT('l'):
+                        tok.width = 3;
+                        break;
+
+                    case wxT('w'):
+                        tok.width = 1;
+                        break;
+
+                    default:
+                        tok.width = 2;
+                }
+            }
+        }
+        else if ( tok.spec == wxT('%') && !tok.hasModifiers )
+        {
+            literal.text += wxT('%');
+            continue;
+        }
+
+        flushLiteral();
+        tokens.push_back(tok);
+    }
+
+    flushLiteral();
+
+    return true;
+}
+
+void wxDateTimeFormatter::SetFormat(const wxString& format)
+{
+    m_format = format;
+
+    m_formatTokens.clear();
+    Compile(format, m_formatTokens, false);
+
+    m_parseTokens.clear();
+    m_parseFallback = !Compile(format, m_parseTokens, true);
+    if ( m_parseFallback )
+        m_parseTokens.clear();
+}
+
+void
+wxDateTimeFormatter::FormatTo(wxString& out,
+                              const wxDateTime& dt,
+                              const wxDateTime::TimeZone& tz) const
+{
+    wxCHECK_RET( !m_format.empty(), wxT("null format in wxDateTimeFormatter") );
+
+    // not const because Tm::GetWeekDay() isn't
+    wxDateTime::Tm tm = dt.GetTm(tz);
+
+    for ( const Token& tok : m_formatTokens )
+    {
+        if ( !tok.spec )
+        {
+            out += tok.text;
+            continue;
+        }
+
+        // the numeric fields are formatted directly, exactly as Format()
+        // does it, while all the other ones are delegated to it
+        if ( !tok.hasModifiers )
+        {
+            switch ( tok.spec )
+            {
+                case wxT('d'):
+                    AppendPaddedNumber(out, tm.mday, 2);
+                    continue;
+
+                case wxT('F'):
+                    AppendPaddedNumber(out, tm.year, 4);
+                    out += wxT('-');
+                    AppendPaddedNumber(out, tm.mon + 1, 2);
+                    out += wxT('-');
+                    AppendPaddedNumber(out, tm.mday, 2);
+                    continue;
+
+                case wxT('H'):
+                    AppendPaddedNumber(out, tm.hour, 2);
+                    continue;
+
+                case wxT('I'):
+                    AppendPaddedNumber(out, tm.hour > 12 ? tm.hour - 12
+                                                         : tm.hour ? tm.hour
+                                                                   : 12,
+                                       2);
+                    continue;
+
+                case wxT('j'):
+                    AppendPaddedNumber(out, dt.GetDayOfYear(tz), 3);
+                    continue;
+
+                case wxT('l'):
+                    AppendPaddedNumber(out, tm.msec, 3);
+                    continue;
+
+                case wxT('m'):
+                    AppendPaddedNumber(out, tm.mon + 1, 2);
+                    continue;
+
+                case wxT('M'):
+                    AppendPaddedNumber(out, tm.min, 2);
+                    continue;
+
+                case wxT('S'):
+                    AppendPaddedNumber(out, tm.sec, 2);
+                    continue;
+
+                case wxT('w'):
+                    AppendPaddedNumber(out, tm.GetWeekDay(), 1);
+                    continue;
+
+                case wxT('y'):
+                    AppendPaddedNumber(out, tm.year % 100, 2);
+                    continue;
+
+                case wxT('Y'):
+                    AppendPaddedNumber(out, tm.year, 4);
+                    continue;
+            }
+        }
+
+        out += dt.Format(tok.text, tz);
+    }
+}
+
+wxString
+wxDateTimeFormatter::Format(const wxDateTime& dt,
+                            const wxDateTime::TimeZone& tz) const
+{
+    wxString s;
+    FormatTo(s, dt, tz);
+    return s;
+}
+
+bool
+wxDateTimeFormatter::Parse(const wxString& date,
+                           wxDateTime* dt,
+                           wxString::const_iterator* end,
+                           const wxDateTime& dateDef) const
+{
+    wxCHECK_MSG( dt, false, "date pointer must be specified" );
+    wxCHECK_MSG( end, false, "end iterator pointer must be specified" );
+    wxCHECK_MSG( !m_format.empty(), false, "format can't be empty" );
+
+    if ( m_parseFallback )
+        return dt->ParseFormat(date, m_format, dateDef, end);
+
+    ParsedDateFields fields;
+
+    wxString::const_iterator input = date.begin();
+    const wxString::const_iterator inputEnd = date.end();
+    for ( const Token& tok : m_parseTokens )
+    {
+        if ( tok.spec )
+        {
+            if ( !fields.ParseField(tok.spec, tok.width, input, inputEnd) )
+                return false;
+
+            continue;
+        }
+
+        // literals are matched in the same way as by ParseFormat()
+        for ( wxString::const_iterator p = tok.text.begin();
+              p != tok.text.end();
+              ++p )
+        {
+            if ( wxIsspace(*p) )
+            {
+                while ( input != inputEnd && wxIsspace(*input) )
+                    ++input;
+            }
+            else if ( input == inputEnd || *input++ != *p )
+            {
+                return false;
+            }
+        }
+    }
+
+    if ( !fields.Apply(*dt, dateDef) )
+        return false;
+
+    *end = input;
+
+    return true;
+}
+
 // ============================================================================
 // wxDateSpan
 // ============================================================================
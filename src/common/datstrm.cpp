@@ -18,8 +18,13 @@
 
 #ifndef WX_PRECOMP
     #include "wx/math.h"
+    #include "wx/utils.h"
 #endif //WX_PRECOMP
 
+#include "wx/private/simd.h"
+
+#include <string.h>
+
 namespace
 {
 
@@ -36,6 +41,197 @@ union Float64Data
     wxUint32 i[2];
 };
 
+// Size of the buffer used for converting the data before writing it to the
+// stream or after reading it from it.
+const size_t CONVERT_BUFFER_SIZE = 4096;
+
+// Return true if the data in the given byte order must be swapped to be
+// converted to or from the native one.
+inline bool NeedsSwap(bool be_order)
+{
+    return be_order != (wxBYTE_ORDER == wxBIG_ENDIAN);
+}
+
+// Helpers for swapping the bytes of a single value of the given type.
+inline wxUint16 SwapValue(wxUint16 v) { return wxUINT16_SWAP_ALWAYS(v); }
+inline wxUint32 SwapValue(wxUint32 v) { return wxUINT32_SWAP_ALWAYS(v); }
+#ifdef wxLongLong_t
+inline wxUint64 SwapValue(wxUint64 v) { return wxUINT64_SWAP_ALWAYS(v); }
+#endif
+
+// Helpers for swapping the bytes of all values of the given type in a block
+// of 16 bytes, the type argument is only used for overload resolution.
+#if defined(wxHAS_SSE2)
+
+inline __m128i SwapBytesOfWords(__m128i v)
+{
+    return _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+}
+
+inline __m128i SwapVector(__m128i v, wxUint16)
+{
+    return SwapBytesOfWords(v);
+}
+
+inline __m128i SwapVector(__m128i v, wxUint32)
+{
+    v = SwapBytesOfWords(v);
+    v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+    return _mm_shufflehi_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+}
+
+#ifdef wxLongLong_t
+inline __m128i SwapVector(__m128i v, wxUint64)
+{
+    v = SwapBytesOfWords(v);
+    v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(0, 1, 2, 3));
+    return _mm_shufflehi_epi16(v, _MM_SHUFFLE(0, 1, 2, 3));
+}
+#endif // wxLongLong_t
+
+template <typename T>
+inline void SwapBlock(unsigned char* p)
+{
+    __m128i* const pv = reinterpret_cast<__m128i*>(p);
+    _mm_storeu_si128(pv, SwapVector(_mm_loadu_si128(pv), T()));
+}
+
+#elif defined(wxHAS_NEON)
+
+inline uint8x16_t SwapVector(uint8x16_t v, wxUint16) { return vrev16q_u8(v); }
+inline uint8x16_t SwapVector(uint8x16_t v, wxUint32) { return vrev32q_u8(v); }
+#ifdef wxLongLong_t
+inline uint8x16_t SwapVector(uint8x16_t v, wxUint64) { return vrev64q_u8(v); }
+#endif
+
+template <typename T>
+inline void SwapBlock(unsigned char* p)
+{
+    vst1q_u8(p, SwapVector(vld1q_u8(p), T()));
+}
+
+#endif // SIMD
+
+// Swap the bytes of each of the count values of type T, which must be one of
+// the unsigned integer types above, stored in the given buffer, which doesn't
+// need to be properly aligned for T.
+template <typename T>
+void SwapBytes(void* buffer, size_t count)
+{
+    unsigned char* p = static_cast<unsigned char*>(buffer);
+    size_t n = 0;
+
+#if defined(wxHAS_SSE2) || defined(wxHAS_NEON)
+    const size_t valuesPerBlock = 16 / sizeof(T);
+    for ( ; n + valuesPerBlock <= count; n += valuesPerBlock, p += 16 )
+        SwapBlock<T>(p);
+#endif // SIMD
+
+    for ( ; n < count; n++, p += sizeof(T) )
+    {
+        T v;
+        memcpy(&v, p, sizeof(T));
+        v = SwapValue(v);
+        memcpy(p, &v, sizeof(T));
+    }
+}
+
+// Read size values of type T directly into the provided buffer and convert
+// them to the native byte order if necessary.
+template <typename T>
+void DoReadSwapped(void* buffer, size_t size, wxInputStream* input, bool be_order)
+{
+    input->Read(buffer, size * sizeof(T));
+
+    if ( NeedsSwap(be_order) )
+        SwapBytes<T>(buffer, input->LastRead() / sizeof(T));
+}
+
+// Write size values of type T from the given buffer using the specified byte
+// order, which requires copying them to a temporary buffer if it's different
+// from the native one.
+template <typename T>
+void DoWriteSwapped(const void* buffer, size_t size, wxOutputStream* output, bool be_order)
+{
+    if ( !NeedsSwap(be_order) )
+    {
+        output->Write(buffer, size * sizeof(T));
+        return;
+    }
+
+    const unsigned char* p = static_cast<const unsigned char*>(buffer);
+
+    T tmp[CONVERT_BUFFER_SIZE / sizeof(T)];
+    while ( size )
+    {
+        const size_t count = wxMin(size, WXSIZEOF(tmp));
+        const size_t len = count * sizeof(T);
+
+        memcpy(tmp, p, len);
+        SwapBytes<T>(tmp, count);
+
+        if ( output->Write(tmp, len).LastWrite() != len )
+            break;
+
+        p += len;
+        size -= count;
+    }
+}
+
+#if wxUSE_APPLE_IEEE
+
+// Size of the extended precision floating point numbers in the stream.
+const size_t EXTENDED_SIZE = 10;
+
+// Read the given number of numbers in extended precision format.
+template <typename T>
+void DoReadExtended(T* buffer, size_t size, wxInputStream* input)
+{
+    char tmp[CONVERT_BUFFER_SIZE / EXTENDED_SIZE * EXTENDED_SIZE];
+    while ( size )
+    {
+        const size_t count = wxMin(size, sizeof(tmp) / EXTENDED_SIZE);
+
+        input->Read(tmp, count * EXTENDED_SIZE);
+
+        const size_t countRead = input->LastRead() / EXTENDED_SIZE;
+        for ( size_t n = 0; n < countRead; n++ )
+        {
+            *buffer++ = static_cast<T>(
+                wxConvertFromIeeeExtended((const wxInt8 *)tmp + n * EXTENDED_SIZE));
+        }
+
+        if ( countRead != count )
+            break;
+
+        size -= count;
+    }
+}
+
+// Write the given number of numbers in extended precision format.
+template <typename T>
+void DoWriteExtended(const T* buffer, size_t size, wxOutputStream* output)
+{
+    char tmp[CONVERT_BUFFER_SIZE / EXTENDED_SIZE * EXTENDED_SIZE];
+    while ( size )
+    {
+        const size_t count = wxMin(size, sizeof(tmp) / EXTENDED_SIZE);
+        for ( size_t n = 0; n < count; n++ )
+        {
+            wxConvertToIeeeExtended(static_cast<double>(*buffer++),
+                                    (wxInt8 *)tmp + n * EXTENDED_SIZE);
+        }
+
+        const size_t len = count * EXTENDED_SIZE;
+        if ( output->Write(tmp, len).LastWrite() != len )
+            break;
+
+        size -= count;
+    }
+}
+
+#endif // wxUSE_APPLE_IEEE
+
 } // anonymous namespace
 
 // ----------------------------------------------------------------------------
@@ -273,51 +469,14 @@ template <class T>
 static
 void DoReadI64(T *buffer, size_t size, wxInputStream *input, bool be_order)
 {
-    typedef T DataType;
-    unsigned char *pchBuffer = (unsigned char*) buffer;
-    // TODO: Check for overflow when size is of type uint and is > than 512m
-    input->Read(pchBuffer, size * 8);
-    if ( be_order )
-    {
-        for ( wxUint32 i = 0; i < size; i++ )
-        {
-            DataType v = wxUINT64_SWAP_ON_LE(*buffer);
-            *(buffer++) = v;
-        }
-    }
-    else // little endian
-    {
-        for ( wxUint32 i=0; i<size; i++ )
-        {
-            DataType v = wxUINT64_SWAP_ON_BE(*buffer);
-            *(buffer++) = v;
-        }
-    }
+    DoReadSwapped<wxUint64>(buffer, size, input, be_order);
 }
 
 template <class T>
 static
 void DoWriteI64(const T *buffer, size_t size, wxOutputStream *output, bool be_order)
 {
-  typedef T DataType;
-  if ( be_order )
-  {
-    for ( size_t i = 0; i < size; i++ )
-    {
-      DataType i64 = wxUINT64_SWAP_ON_LE(*buffer);
-      buffer++;
-      output->Write(&i64, 8);
-    }
-  }
-  else // little endian
-  {
-    for ( size_t i=0; i < size; i++ )
-    {
-      DataType i64 = wxUINT64_SWAP_ON_BE(*buffer);
-      buffer++;
-      output->Write(&i64, 8);
-    }
-  }
+    DoWriteSwapped<wxUint64>(buffer, size, output, be_order);
 }
 
 #endif // wxLongLong_t
@@ -376,46 +535,12 @@ wxLongLong wxDataInputStream::ReadLL(void)
 
 void wxDataInputStream::Read32(wxUint32 *buffer, size_t size)
 {
-    m_input->Read(buffer, size * 4);
-
-    if (m_be_order)
-    {
-        for (wxUint32 i=0; i<size; i++)
-        {
-            wxUint32 v = wxUINT32_SWAP_ON_LE(*buffer);
-            *(buffer++) = v;
-        }
-    }
-    else
-    {
-        for (wxUint32 i=0; i<size; i++)
-        {
-            wxUint32 v = wxUINT32_SWAP_ON_BE(*buffer);
-            *(buffer++) = v;
-        }
-    }
+    DoReadSwapped<wxUint32>(buffer, size, m_input, m_be_order);
 }
 
 void wxDataInputStream::Read16(wxUint16 *buffer, size_t size)
 {
-  m_input->Read(buffer, size * 2);
-
-  if (m_be_order)
-  {
-    for (wxUint32 i=0; i<size; i++)
-    {
-      wxUint16 v = wxUINT16_SWAP_ON_LE(*buffer);
-      *(buffer++) = v;
-    }
-  }
-  else
-  {
-    for (wxUint32 i=0; i<size; i++)
-    {
-      wxUint16 v = wxUINT16_SWAP_ON_BE(*buffer);
-      *(buffer++) = v;
-    }
-  }
+    DoReadSwapped<wxUint16>(buffer, size, m_input, m_be_order);
 }
 
 void wxDataInputStream::Read8(wxUint8 *buffer, size_t size)
@@ -425,18 +550,36 @@ void wxDataInputStream::Read8(wxUint8 *buffer, size_t size)
 
 void wxDataInputStream::ReadDouble(double *buffer, size_t size)
 {
-  for (wxUint32 i=0; i<size; i++)
-  {
-    *(buffer++) = ReadDouble();
-  }
+#if wxUSE_APPLE_IEEE
+    if ( m_useExtendedPrecision )
+    {
+        DoReadExtended(buffer, size, m_input);
+        return;
+    }
+#endif // wxUSE_APPLE_IEEE
+
+#ifdef wxLongLong_t
+    // Basic precision doubles are stored as 64 bit integers would be.
+    DoReadSwapped<wxUint64>(buffer, size, m_input, m_be_order);
+#else
+    for ( size_t i = 0; i < size; i++ )
+    {
+        *(buffer++) = ReadDouble();
+    }
+#endif
 }
 
 void wxDataInputStream::ReadFloat(float *buffer, size_t size)
 {
-  for (wxUint32 i=0; i<size; i++)
-  {
-    *(buffer++) = ReadFloat();
-  }
+#if wxUSE_APPLE_IEEE
+    if ( m_useExtendedPrecision )
+    {
+        DoReadExtended(buffer, size, m_input);
+        return;
+    }
+#endif // wxUSE_APPLE_IEEE
+
+    DoReadSwapped<wxUint32>(buffer, size, m_input, m_be_order);
 }
 
 wxDataInputStream& wxDataInputStream::operator>>(wxString& s)
@@ -683,46 +826,12 @@ void wxDataOutputStream::WriteLL(const wxULongLong &ll)
 
 void wxDataOutputStream::Write32(const wxUint32 *buffer, size_t size)
 {
-  if (m_be_order)
-  {
-    for (wxUint32 i=0; i<size ;i++)
-    {
-      wxUint32 i32 = wxUINT32_SWAP_ON_LE(*buffer);
-      buffer++;
-      m_output->Write(&i32, 4);
-    }
-  }
-  else
-  {
-    for (wxUint32 i=0; i<size ;i++)
-    {
-      wxUint32 i32 = wxUINT32_SWAP_ON_BE(*buffer);
-      buffer++;
-      m_output->Write(&i32, 4);
-    }
-  }
+    DoWriteSwapped<wxUint32>(buffer, size, m_output, m_be_order);
 }
 
 void wxDataOutputStream::Write16(const wxUint16 *buffer, size_t size)
 {
-  if (m_be_order)
-  {
-    for (wxUint32 i=0; i<size ;i++)
-    {
-      wxUint16 i16 = wxUINT16_SWAP_ON_LE(*buffer);
-      buffer++;
-      m_output->Write(&i16, 2);
-    }
-  }
-  else
-  {
-    for (wxUint32 i=0; i<size ;i++)
-    {
-      wxUint16 i16 = wxUINT16_SWAP_ON_BE(*buffer);
-      buffer++;
-      m_output->Write(&i16, 2);
-    }
-  }
+    DoWriteSwapped<wxUint16>(buffer, size, m_output, m_be_order);
 }
 
 void wxDataOutputStream::Write8(const wxUint8 *buffer, size_t size)
@@ -732,18 +841,35 @@ void wxDataOutputStream::Write8(const wxUint8 *buffer, size_t size)
 
 void wxDataOutputStream::WriteDouble(const double *buffer, size_t size)
 {
-  for (wxUint32 i=0; i<size; i++)
-  {
-    WriteDouble(*(buffer++));
-  }
+#if wxUSE_APPLE_IEEE
+    if ( m_useExtendedPrecision )
+    {
+        DoWriteExtended(buffer, size, m_output);
+        return;
+    }
+#endif // wxUSE_APPLE_IEEE
+
+#ifdef wxLongLong_t
+    DoWriteSwapped<wxUint64>(buffer, size, m_output, m_be_order);
+#else
+    for ( size_t i = 0; i < size; i++ )
+    {
+        WriteDouble(*(buffer++));
+    }
+#endif
 }
 
 void wxDataOutputStream::WriteFloat(const float *buffer, size_t size)
 {
-  for (wxUint32 i=0; i<size; i++)
-  {
-    WriteFloat(*(buffer++));
-  }
+#if wxUSE_APPLE_IEEE
+    if ( m_useExtendedPrecision )
+    {
+        DoWriteExtended(buffer, size, m_output);
+        return;
+    }
+#endif // wxUSE_APPLE_IEEE
+
+    DoWriteSwapped<wxUint32>(buffer, size, m_output, m_be_order);
 }
 
 wxDataOutputStream& wxDataOutputStream::operator<<(const wxString& string)
@@ -647,6 +647,15 @@ void wxDCImpl::GetMultiLineTextExtent(const wxString& text,
     tm.GetMultiLineTextExtent(text, x, y, h);
 }
 
+void wxDCImpl::GetTextExtents(const wxArrayString& strings,
+                              wxArrayInt& widths,
+                              wxArrayInt *heights,
+                              const wxFont *font) const
+{
+    wxTextMeasure tm(GetOwner(), font && font->IsOk() ? font : &m_font);
+    tm.GetTextExtents(strings, widths, heights);
+}
+
 void wxDCImpl::DoDrawCheckMark(wxCoord x1, wxCoord y1,
                                wxCoord width, wxCoord height)
 {
@@ -23,8 +23,11 @@
 
 #ifndef WX_PRECOMP
     #include "wx/module.h"
+    #include "wx/window.h"
 #endif
 
+#include <vector>
+
 // ============================================================================
 // implementation
 // ============================================================================
@@ -33,70 +36,187 @@ wxIMPLEMENT_DYNAMIC_CLASS(wxBufferedDC, wxMemoryDC);
 wxIMPLEMENT_ABSTRACT_CLASS(wxBufferedPaintDC, wxBufferedDC);
 
 // ----------------------------------------------------------------------------
-// wxSharedDCBufferManager: helper class maintaining backing store bitmap
+// wxSharedDCBufferManager: helper class maintaining backing store bitmaps
 // ----------------------------------------------------------------------------
 
+// This class keeps a pool of buffers shared by all wxBufferedDC objects not
+// using their own buffer. Each buffer remembers the window it was last used
+// for, and is preferably reused for the same window, so that several windows
+// of different sizes painted in turn don't keep reallocating the buffers.
+// Buffer sizes are also rounded up to avoid reallocating them every time a
+// window is resized.
+//
+// The total size of the buffers not currently in use is limited and the least
+// recently used of them are freed when it's exceeded.
 class wxSharedDCBufferManager : public wxModule
 {
 public:
     wxSharedDCBufferManager() { }
 
     virtual bool OnInit() override { return true; }
-    virtual void OnExit() override { wxDELETE(ms_buffer); }
+    virtual void OnExit() override
+    {
+        for ( const auto& entry : ms_buffers )
+            delete entry.buffer;
+        ms_buffers.clear();
+    }
 
     static wxBitmap* GetBuffer(wxDC* dc, int w, int h)
     {
-        if ( ms_usingSharedBuffer )
-            return DoCreateBuffer(dc, w, h);
+        const wxWindow* const win = dc ? dc->GetWindow() : nullptr;
+        const double scale = dc ? dc->GetContentScaleFactor() : 1.0;
 
-        if ( !ms_buffer ||
-                w > ms_buffer->GetLogicalWidth() ||
-                h > ms_buffer->GetLogicalHeight() ||
-                (dc && dc->GetContentScaleFactor() != ms_buffer->GetScaleFactor()) )
+        // Find the best free buffer: the one used by the same window if it's
+        // big enough or the smallest of the fitting ones otherwise.
+        Entry* best = nullptr;
+        for ( auto& entry : ms_buffers )
         {
-            delete ms_buffer;
+            if ( entry.inUse || !entry.Fits(w, h, scale) )
+                continue;
+
+            if ( win && entry.window == win )
+            {
+                best = &entry;
+                break;
+            }
+
+            if ( !best || entry.GetMemory() < best->GetMemory() )
+                best = &entry;
+        }
 
-            ms_buffer = DoCreateBuffer(dc, w, h);
+        if ( !best )
+        {
+            // Don't keep the too small buffer previously used for this
+            // window, it would be just a waste of memory.
+            for ( auto it = ms_buffers.begin(); it != ms_buffers.end(); ++it )
+            {
+                if ( !it->inUse && win && it->window == win )
+                {
+                    delete it->buffer;
+                    ms_buffers.erase(it);
+                    break;
+                }
+            }
+
+            Entry entry;
+            entry.buffer = DoCreateBuffer(scale, RoundUpSize(w), RoundUpSize(h));
+            ms_buffers.push_back(entry);
+            best = &ms_buffers.back();
         }
 
-        ms_usingSharedBuffer = true;
-        return ms_buffer;
+        best->window = win;
+        best->inUse = true;
+
+        return best->buffer;
     }
 
     static void ReleaseBuffer(wxBitmap* buffer)
     {
-        if ( buffer == ms_buffer )
+        for ( auto& entry : ms_buffers )
         {
-            wxASSERT_MSG( ms_usingSharedBuffer, wxT("shared buffer already released") );
-            ms_usingSharedBuffer = false;
+            if ( entry.buffer == buffer )
+            {
+                wxASSERT_MSG( entry.inUse, wxT("shared buffer already released") );
+
+                entry.inUse = false;
+                entry.lastUsed = ++ms_usageCounter;
+
+                Trim();
+                return;
+            }
         }
-        else
+
+        wxFAIL_MSG( wxT("releasing unknown shared buffer") );
+    }
+
+    static void SetMaxMemory(size_t maxMemory)
+    {
+        ms_maxMemory = maxMemory;
+
+        Trim();
+    }
+
+    static size_t GetMaxMemory() { return ms_maxMemory; }
+
+private:
+    struct Entry
+    {
+        wxBitmap* buffer = nullptr;
+
+        // The window this buffer was last used for, only used for comparison
+        // and never dereferenced, so it's fine if it's already destroyed.
+        const wxWindow* window = nullptr;
+
+        // Incremented every time the buffer is released.
+        unsigned long lastUsed = 0;
+
+        bool inUse = false;
+
+        bool Fits(int w, int h, double scale) const
+        {
+            return w <= buffer->GetLogicalWidth() &&
+                    h <= buffer->GetLogicalHeight() &&
+                        scale == buffer->GetScaleFactor();
+        }
+
+        size_t GetMemory() const
         {
-            delete buffer;
+            return 4*static_cast<size_t>(buffer->GetWidth())*buffer->GetHeight();
+        }
+    };
+
+    // Free the least recently used buffers while the memory used by the free
+    // ones exceeds the limit.
+    static void Trim()
+    {
+        for ( ;; )
+        {
+            size_t memory = 0;
+            auto lru = ms_buffers.end();
+            for ( auto it = ms_buffers.begin(); it != ms_buffers.end(); ++it )
+            {
+                if ( it->inUse )
+                    continue;
+
+                memory += it->GetMemory();
+                if ( lru == ms_buffers.end() || it->lastUsed < lru->lastUsed )
+                    lru = it;
+            }
+
+            if ( memory <= ms_maxMemory )
+                break;
+
+            delete lru->buffer;
+            ms_buffers.erase(lru);
         }
     }
 
-private:
-    static wxBitmap* DoCreateBuffer(wxDC* dc, int w, int h)
+    // Round up the buffer size to avoid reallocating it too often.
+    static int RoundUpSize(int size)
     {
-        const double scale = dc ? dc->GetContentScaleFactor() : 1.0;
-        wxBitmap* const buffer = new wxBitmap;
+        static const int SIZE_STEP = 64;
+
+        return (wxMax(size, 1) + SIZE_STEP - 1) / SIZE_STEP * SIZE_STEP;
+    }
 
-        // we must always return a valid bitmap but creating a bitmap of
-        // size 0 would fail, so create a 1*1 bitmap in this case
-        buffer->CreateWithLogicalSize(wxMax(w, 1), wxMax(h, 1), scale);
+    static wxBitmap* DoCreateBuffer(double scale, int w, int h)
+    {
+        wxBitmap* const buffer = new wxBitmap;
+        buffer->CreateWithLogicalSize(w, h, scale);
 
         return buffer;
     }
 
-    static wxBitmap *ms_buffer;
-    static bool ms_usingSharedBuffer;
+    static std::vector<Entry> ms_buffers;
+    static unsigned long ms_usageCounter;
+    static size_t ms_maxMemory;
 
     wxDECLARE_DYNAMIC_CLASS(wxSharedDCBufferManager);
 };
 
-wxBitmap* wxSharedDCBufferManager::ms_buffer = nullptr;
-bool wxSharedDCBufferManager::ms_usingSharedBuffer = false;
+std::vector<wxSharedDCBufferManager::Entry> wxSharedDCBufferManager::ms_buffers;
+unsigned long wxSharedDCBufferManager::ms_usageCounter = 0;
+size_t wxSharedDCBufferManager::ms_maxMemory = 64*1024*1024;
 
 wxIMPLEMENT_DYNAMIC_CLASS(wxSharedDCBufferManager, wxModule);
 
@@ -166,3 +286,15 @@ void wxBufferedDC::UnMask()
     if ( m_style & wxBUFFER_USES_SHARED_BUFFER )
         wxSharedDCBufferManager::ReleaseBuffer(m_buffer);
 }
+
+/* static */
+void wxBufferedDC::SetSharedBuffersMaxMemory(size_t maxMemory)
+{
+    wxSharedDCBufferManager::SetMaxMemory(maxMemory);
+}
+
+/* static */
+size_t wxBufferedDC::GetSharedBuffersMaxMemory()
+{
+    return wxSharedDCBufferManager::GetMaxMemory();
+}
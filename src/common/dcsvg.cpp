@@ -41,6 +41,36 @@ namespace
 
 static const wxSize SVG_DPI(96, 96);
 
+// The size of the output buffer after which it is written to the stream.
+const size_t SVG_BUFFER_SIZE = 64*1024;
+
+// The maximal number of segments combined into a single path element: this
+// is done to avoid creating huge attribute values, which some XML parsers
+// refuse to load.
+const size_t SVG_MAX_LINE_PATH_SEGMENTS = 4096;
+
+// Append the decimal representation of the given number to the string, this
+// is much faster than using wxString::Format() for it.
+void AppendInt(std::string& s, int n)
+{
+    char buf[16];
+    char* const end = buf + sizeof(buf);
+    char* p = end;
+
+    unsigned u = n < 0 ? 0u - static_cast<unsigned>(n) : static_cast<unsigned>(n);
+    do
+    {
+        *--p = static_cast<char>('0' + u % 10);
+        u /= 10;
+    }
+    while ( u );
+
+    if ( n < 0 )
+        *--p = '-';
+
+    s.append(p, end - p);
+}
+
 // This function returns a string representation of a floating point number in
 // C locale (i.e. always using "." for the decimal separator) and with the
 // fixed precision (which is 2 for some unknown reason but this is what it was
@@ -516,11 +546,22 @@ wxSVGFileDCImpl::wxSVGFileDCImpl(wxSVGFileDC* owner, const wxString& filename,
                                  int width, int height, double dpi, const wxString& title)
     : wxDCImpl(owner)
 {
-    Init(filename, width, height, dpi, title);
+    Init(filename, nullptr, width, height, dpi, title);
 }
 
-void wxSVGFileDCImpl::Init(const wxString& filename, int width, int height,
-                           double dpi, const wxString& title)
+wxSVGFileDCImpl::wxSVGFileDCImpl(wxSVGFileDC* owner, wxOutputStream& stream,
+                                 int width, int height, double dpi, const wxString& title)
+    : wxDCImpl(owner)
+{
+    Init(wxString(), &stream, width, height, dpi, title);
+
+    // There is no file name to use for the bitmap files, so embed them.
+    m_bmp_handler.reset(new wxSVGBitmapEmbedHandler);
+}
+
+void wxSVGFileDCImpl::Init(const wxString& filename, wxOutputStream* stream,
+                           int width, int height, double dpi,
+                           const wxString& title)
 {
     m_width = width;
     m_height = height;
@@ -534,6 +575,8 @@ void wxSVGFileDCImpl::Init(const wxString& filename, int width, int height,
 
     m_gradientUniqueId = 0;
 
+    m_linePathSegments = 0;
+
     m_mm_to_pix_x = dpi / 25.4;
     m_mm_to_pix_y = dpi / 25.4;
 
@@ -554,10 +597,21 @@ void wxSVGFileDCImpl::Init(const wxString& filename, int width, int height,
 
     m_bmp_handler.reset();
 
-    if ( m_filename.empty() )
-        m_outfile.reset();
+    if ( stream )
+    {
+        m_outfile = stream;
+    }
     else
-        m_outfile.reset(new wxFileOutputStream(m_filename));
+    {
+        if ( !m_filename.empty() )
+            m_ownedStream.reset(new wxFileOutputStream(m_filename));
+
+        m_outfile = m_ownedStream.get();
+    }
+
+    m_OK = m_outfile && m_outfile->IsOk();
+
+    m_buffer.reserve(SVG_BUFFER_SIZE);
 
     const wxSize dpiSize = FromDIP(wxSize(m_width, m_height));
 
@@ -583,6 +637,8 @@ wxSVGFileDCImpl::~wxSVGFileDCImpl()
 
     s += wxS("</g>\n</svg>\n");
     write(s);
+
+    FlushBuffer();
 }
 
 void wxSVGFileDCImpl::DoGetSizeMM(int* width, int* height) const
@@ -627,11 +683,36 @@ void wxSVGFileDCImpl::DoDrawLine(wxCoord x1, wxCoord y1, wxCoord x2, wxCoord y2)
 {
     NewGraphicsIfNeeded();
 
-    wxString s;
-    s = wxString::Format(wxS("  <path d=\"M%d %d L%d %d\" %s %s/>\n"),
-        x1, y1, x2, y2, GetRenderMode(m_renderingMode), GetPenPattern(m_pen));
+    if ( m_linePathSegments == SVG_MAX_LINE_PATH_SEGMENTS )
+        CloseLinePath();
 
-    write(s);
+    if ( m_linePathEnd.empty() )
+    {
+        m_linePathEnd = wxString::Format(wxS("\" %s %s/>\n"),
+            GetRenderMode(m_renderingMode), GetPenPattern(m_pen)).utf8_string();
+
+        WriteRaw("  <path d=\"", 11);
+    }
+    else
+    {
+        WriteRaw(" ", 1);
+    }
+
+    // Each segment is a separate subpath, so that the result looks exactly
+    // the same as if they were drawn by separate elements: this ensures that
+    // the line caps are drawn at both ends of every segment and that the
+    // segments are not filled, even if they form a closed shape.
+    WriteRaw("M", 1);
+    WritePoint(x1, y1);
+    WriteRaw(" L", 2);
+    WritePoint(x2, y2);
+
+    m_linePathSegments++;
+
+    // Combining the partially transparent segments would change the result
+    // where they overlap, so don't do it for them.
+    if ( m_pen.GetColour().Alpha() != wxALPHA_OPAQUE )
+        CloseLinePath();
 
     CalcBoundingBox(x1, y1, x2, y2);
 }
@@ -641,23 +722,22 @@ void wxSVGFileDCImpl::DoDrawLines(int n, const wxPoint points[], wxCoord xoffset
     if (n > 1)
     {
         NewGraphicsIfNeeded();
-        wxString s;
+        CloseLinePath();
 
-        s = wxString::Format(wxS("  <path d=\"M%d %d"),
-            (points[0].x + xoffset), (points[0].y + yoffset));
+        WriteRaw("  <path d=\"M", 12);
+        WritePoint(points[0].x + xoffset, points[0].y + yoffset);
 
         CalcBoundingBox(points[0].x + xoffset, points[0].y + yoffset);
 
         for (int i = 1; i < n; ++i)
         {
-            s += wxString::Format(wxS(" L%d %d"), (points[i].x + xoffset), (points[i].y + yoffset));
+            WriteRaw(" L", 2);
+            WritePoint(points[i].x + xoffset, points[i].y + yoffset);
             CalcBoundingBox(points[i].x + xoffset, points[i].y + yoffset);
         }
 
-        s += wxString::Format(wxS("\" style=\"fill:none\" %s %s/>\n"),
-            GetRenderMode(m_renderingMode), GetPenPattern(m_pen));
-
-        write(s);
+        write(wxString::Format(wxS("\" style=\"fill:none\" %s %s/>\n"),
+            GetRenderMode(m_renderingMode), GetPenPattern(m_pen)));
     }
 }
 
@@ -1325,6 +1405,8 @@ void wxSVGFileDCImpl::SetBitmapHandler(wxSVGBitmapHandler* handler)
 
 void wxSVGFileDCImpl::SetShapeRenderingMode(wxSVGShapeRenderingMode renderingMode)
 {
+    CloseLinePath();
+
     m_renderingMode = renderingMode;
 }
 
@@ -1364,12 +1446,32 @@ void wxSVGFileDCImpl::NewGraphicsIfNeeded()
 
 void wxSVGFileDCImpl::DoStartNewGraphics()
 {
-    wxString s;
-
-    s = wxString::Format(wxS("<g style=\"%s %s %s\" transform=\"translate(%d %d) scale(%s %s)\">\n"),
+    const wxString style = wxString::Format(wxS("%s %s %s"),
         GetPenStyle(m_pen),
         GetBrushFill(m_brush.GetColour(), m_brush.GetStyle()),
-        GetPenStroke(m_pen.GetColour(), m_pen.GetStyle()),
+        GetPenStroke(m_pen.GetColour(), m_pen.GetStyle()));
+
+    // Define a CSS class for every distinct style instead of repeating it in
+    // every group, as the same styles are typically used many times.
+    const auto it = m_styleClasses.find(style);
+    size_t styleClass;
+    if ( it == m_styleClasses.end() )
+    {
+        styleClass = m_styleClasses.size();
+        m_styleClasses.emplace(style, styleClass);
+
+        write(wxString::Format(wxS("<style type=\"text/css\">.wxs%zu { %s }</style>\n"),
+            styleClass, style));
+    }
+    else
+    {
+        styleClass = it->second;
+    }
+
+    wxString s;
+
+    s = wxString::Format(wxS("<g class=\"wxs%zu\" transform=\"translate(%d %d) scale(%s %s)\">\n"),
+        styleClass,
         (m_deviceOriginX - m_logicalOriginX) * m_signX,
         (m_deviceOriginY - m_logicalOriginY) * m_signY,
         NumStr(m_scaleX * m_signX),
@@ -1429,7 +1531,11 @@ void wxSVGFileDCImpl::DoDrawBitmap(const wxBitmap& bmp, wxCoord x, wxCoord y,
     if ( !m_bmp_handler )
         m_bmp_handler.reset(new wxSVGBitmapFileHandler(m_filename));
 
-    m_OK = m_outfile && m_outfile->IsOk();
+    // The handler writes directly to the stream, so output everything
+    // preceding the bitmap first.
+    CloseLinePath();
+    FlushBuffer();
+
     if (!m_OK)
         return;
 
@@ -1438,13 +1544,55 @@ void wxSVGFileDCImpl::DoDrawBitmap(const wxBitmap& bmp, wxCoord x, wxCoord y,
 }
 
 void wxSVGFileDCImpl::write(const wxString& s)
+{
+    CloseLinePath();
+
+    const wxScopedCharBuffer buf = s.utf8_str();
+    WriteRaw(buf.data(), buf.length());
+}
+
+void wxSVGFileDCImpl::WriteRaw(const char* s, size_t len)
+{
+    if (!m_OK)
+        return;
+
+    m_buffer.append(s, len);
+
+    if (m_buffer.length() >= SVG_BUFFER_SIZE)
+        FlushBuffer();
+}
+
+void wxSVGFileDCImpl::WritePoint(wxCoord x, wxCoord y)
+{
+    if (!m_OK)
+        return;
+
+    AppendInt(m_buffer, x);
+    m_buffer += ' ';
+    AppendInt(m_buffer, y);
+}
+
+void wxSVGFileDCImpl::CloseLinePath()
+{
+    if (m_linePathEnd.empty())
+        return;
+
+    // Don't use write() here, as it calls this function.
+    WriteRaw(m_linePathEnd);
+
+    m_linePathEnd.clear();
+    m_linePathSegments = 0;
+}
+
+void wxSVGFileDCImpl::FlushBuffer()
 {
     m_OK = m_outfile && m_outfile->IsOk();
     if (!m_OK)
         return;
 
-    const wxCharBuffer buf = s.utf8_str();
-    m_outfile->Write(buf, strlen((const char*)buf));
+    m_outfile->Write(m_buffer.data(), m_buffer.length());
+    m_buffer.clear();
+
     m_OK = m_outfile->IsOk();
 }
 
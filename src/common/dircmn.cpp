@@ -30,6 +30,17 @@
 #include "wx/dir.h"
 #include "wx/filename.h"
 
+#if wxUSE_THREADS
+    #include "wx/msgqueue.h"
+    #include "wx/thread.h"
+    #include "wx/threadpool.h"
+
+    #include <future>
+    #include <memory>
+#endif // wxUSE_THREADS
+
+#include <vector>
+
 // ============================================================================
 // implementation
 // ============================================================================
@@ -67,6 +78,40 @@ bool wxDir::HasSubDirs(const wxString& spec) const
 
 #endif // !Unix
 
+// ----------------------------------------------------------------------------
+// wxDir::GetFirst() and GetNext() returning wxFileStat
+// ----------------------------------------------------------------------------
+
+// Unix version retrieves the information more efficiently
+#if (defined(__CYGWIN__) && defined(__WINDOWS__)) || !defined(__UNIX_LIKE__) || defined(__WINE__)
+
+bool wxDir::GetFirst(wxString *filename,
+                     wxFileStat *stat,
+                     const wxString& filespec,
+                     int flags) const
+{
+    if ( !GetFirst(filename, filespec, flags) )
+        return false;
+
+    if ( stat )
+        stat->Update(GetNameWithSep() + *filename);
+
+    return true;
+}
+
+bool wxDir::GetNext(wxString *filename, wxFileStat *stat) const
+{
+    if ( !GetNext(filename) )
+        return false;
+
+    if ( stat )
+        stat->Update(GetNameWithSep() + *filename);
+
+    return true;
+}
+
+#endif // !Unix
+
 // ----------------------------------------------------------------------------
 // wxDir::GetNameWithSep()
 // ----------------------------------------------------------------------------
@@ -256,6 +301,270 @@ size_t wxDir::GetAllFiles(const wxString& dirname,
     return nFiles;
 }
 
+// ----------------------------------------------------------------------------
+// wxDir::TraverseParallel()
+// ----------------------------------------------------------------------------
+
+namespace
+{
+
+// Append the full paths of the subdirectories and of the files of the given
+// directory to the provided arrays.
+void ReadDirEntries(const wxString& dirname,
+                    const wxString& filespec,
+                    int flags,
+                    std::vector<wxString>& subdirs,
+                    wxArrayString& files)
+{
+    // don't give the error messages for the directories which we can't open,
+    // just as Traverse() doesn't do it neither
+    wxLogNull noLog;
+
+    wxDir dir(dirname);
+    if ( !dir.IsOpened() )
+        return;
+
+    const wxString prefix = dir.GetNameWithSep();
+
+    // "." and ".." are never useful here
+    flags &= ~wxDIR_DOTDOT;
+
+    wxString name;
+    if ( flags & wxDIR_DIRS )
+    {
+        for ( bool cont = dir.GetFirst(&name, wxEmptyString,
+                                       flags & ~wxDIR_FILES);
+              cont;
+              cont = dir.GetNext(&name) )
+        {
+            subdirs.push_back(prefix + name);
+        }
+    }
+
+    if ( flags & wxDIR_FILES )
+    {
+        for ( bool cont = dir.GetFirst(&name, filespec, flags & ~wxDIR_DIRS);
+              cont;
+              cont = dir.GetNext(&name) )
+        {
+            files.push_back(prefix + name);
+        }
+    }
+}
+
+#if wxUSE_THREADS
+
+// State shared by all the threads used by TraverseParallel().
+class ParallelDirTraverser
+{
+public:
+    // Batches of files found by the worker threads, with a null pointer used
+    // to indicate that the thread has terminated.
+    typedef std::shared_ptr<wxArrayString> Batch;
+
+    ParallelDirTraverser(const wxString& dirname,
+                         const wxString& filespec,
+                         int flags,
+                         size_t batchSize)
+        : m_filespec(filespec),
+          m_flags(flags),
+          m_batchSize(batchSize),
+          m_cond(m_mutex)
+    {
+        m_dirs.push_back(dirname);
+    }
+
+    // Function executed by each of the worker threads.
+    void Work()
+    {
+        Batch batch = std::make_shared<wxArrayString>();
+        std::vector<wxString> subdirs;
+
+        for ( ;; )
+        {
+            wxString dirname;
+            {
+                wxMutexLocker lock(m_mutex);
+
+                // wait until there is something to do or there can't be
+                // anything more, because no other threads are busy
+                while ( m_dirs.empty() && m_busy && !m_stop )
+                    m_cond.Wait();
+
+                if ( m_dirs.empty() || m_stop )
+                    break;
+
+                // take the last directory to keep the traversal depth first
+                dirname = m_dirs.back();
+                m_dirs.pop_back();
+                m_busy++;
+            }
+
+            ReadDirEntries(dirname, m_filespec, m_flags, subdirs, *batch);
+
+            {
+                wxMutexLocker lock(m_mutex);
+
+                m_busy--;
+                m_dirs.insert(m_dirs.end(), subdirs.begin(), subdirs.end());
+
+                // wake up the other threads if there is more work for them
+                // or if we're done
+                if ( !subdirs.empty() || (!m_busy && m_dirs.empty()) )
+                    m_cond.Broadcast();
+            }
+
+            subdirs.clear();
+
+            if ( batch->size() >= m_batchSize )
+            {
+                m_results.Post(batch);
+                batch = std::make_shared<wxArrayString>();
+            }
+        }
+
+        if ( !batch->empty() )
+            m_results.Post(batch);
+
+        m_results.Post(Batch());
+    }
+
+    // Called from the main thread to receive the next batch.
+    Batch GetNextBatch()
+    {
+        Batch batch;
+        if ( m_results.Receive(batch) != wxMSGQUEUE_NO_ERROR )
+            return Batch();
+
+        return batch;
+    }
+
+    // Called from the main thread to make the workers terminate soon.
+    void Stop()
+    {
+        wxMutexLocker lock(m_mutex);
+
+        m_stop = true;
+        m_cond.Broadcast();
+    }
+
+private:
+    const wxString m_filespec;
+    const int m_flags;
+    const size_t m_batchSize;
+
+    wxMessageQueue<Batch> m_results;
+
+    // All the fields below are protected by this mutex.
+    wxMutex m_mutex;
+    wxCondition m_cond;
+
+    // Directories remaining to be read.
+    std::vector<wxString> m_dirs;
+
+    // Number of threads currently reading a directory.
+    int m_busy = 0;
+
+    // Set when the traversal is cancelled.
+    bool m_stop = false;
+
+    wxDECLARE_NO_COPY_CLASS(ParallelDirTraverser);
+};
+
+#endif // wxUSE_THREADS
+
+} // anonymous namespace
+
+/* static */
+size_t
+wxDir::TraverseParallel(const wxString& dirname,
+                        const std::function<bool (const wxArrayString& files)>& onFiles,
+                        const wxString& filespec,
+                        int flags,
+                        size_t batchSize)
+{
+    wxCHECK_MSG( onFiles, 0, wxS("function must be specified") );
+
+    if ( !batchSize )
+        batchSize = 1;
+
+    if ( !wxDir::Exists(dirname) )
+        return 0;
+
+    size_t nFiles = 0;
+
+#if wxUSE_THREADS
+    wxThreadPool& pool = wxThreadPool::Get();
+
+    // Don't use the other threads of the pool from one of them, this could
+    // result in a deadlock, as we block until all of them are done.
+    const int numThreads = pool.IsWorkerThread() ? 1 : pool.GetMaxThreads();
+    if ( numThreads > 1 && (flags & wxDIR_DIRS) )
+    {
+        ParallelDirTraverser traverser(dirname, filespec, flags, batchSize);
+
+        std::vector<std::future<void>> tasks;
+        for ( int n = 0; n < numThreads; n++ )
+            tasks.push_back(pool.Submit([&traverser]() { traverser.Work(); }));
+
+        // Call the user function from this thread only, so that it doesn't
+        // need to be thread-safe.
+        bool cont = true;
+        for ( int running = numThreads; running; )
+        {
+            const ParallelDirTraverser::Batch batch = traverser.GetNextBatch();
+            if ( !batch )
+            {
+                running--;
+                continue;
+            }
+
+            // Just drain the queue after stopping.
+            if ( !cont )
+                continue;
+
+            nFiles += batch->size();
+
+            if ( !onFiles(*batch) )
+            {
+                cont = false;
+                traverser.Stop();
+            }
+        }
+
+        for ( auto& task : tasks )
+            task.get();
+
+        return nFiles;
+    }
+#endif // wxUSE_THREADS
+
+    // Sequential version, using the same batches.
+    std::vector<wxString> dirs;
+    dirs.push_back(dirname);
+
+    wxArrayString batch;
+    while ( !dirs.empty() )
+    {
+        const wxString dir = dirs.back();
+        dirs.pop_back();
+
+        ReadDirEntries(dir, filespec, flags, dirs, batch);
+
+        if ( batch.size() >= batchSize || (dirs.empty() && !batch.empty()) )
+        {
+            nFiles += batch.size();
+
+            if ( !onFiles(batch) )
+                break;
+
+            batch.clear();
+        }
+    }
+
+    return nFiles;
+}
+
 // ----------------------------------------------------------------------------
 // wxDir::FindFirst()
 // ----------------------------------------------------------------------------
@@ -640,6 +640,8 @@ void wxCustomDataObject::TakeData(size_t size, void *data)
 {
     Free();
 
+    m_dataProvider = nullptr;
+
     m_size = size;
     m_data = data;
 }
@@ -675,10 +677,27 @@ bool wxCustomDataObject::GetDataHere(void *buf) const
     return true;
 }
 
+void wxCustomDataObject::DoProvideData() const
+{
+    // reset the provider before calling it, so that it's only ever called
+    // once, even if it calls GetData() itself
+    DataProvider provider;
+    provider.swap(m_dataProvider);
+
+    const wxMemoryBuffer buf = provider();
+
+    // SetData() is not const, but from the outside point of view the data
+    // object hasn't changed as it already logically contained this data
+    const_cast<wxCustomDataObject*>(this)->SetData(buf.GetDataLen(),
+                                                   buf.GetData());
+}
+
 bool wxCustomDataObject::SetData(size_t size, const void *buf)
 {
     Free();
 
+    m_dataProvider = nullptr;
+
     m_data = Alloc(size);
     if ( m_data == nullptr )
         return false;
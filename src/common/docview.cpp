@@ -67,12 +67,22 @@
     #include "wx/wfstream.h"
 #endif
 
+#if wxUSE_THREADS
+    #include "wx/threadpool.h"
+
+    #include <future>
+#endif
+
+#include <atomic>
 #include <memory>
 
 // ----------------------------------------------------------------------------
 // wxWidgets macros
 // ----------------------------------------------------------------------------
 
+wxDEFINE_EVENT(wxEVT_DOCUMENT_IO_PROGRESS, wxThreadEvent);
+wxDEFINE_EVENT(wxEVT_DOCUMENT_IO_COMPLETED, wxThreadEvent);
+
 wxIMPLEMENT_ABSTRACT_CLASS(wxDocument, wxEvtHandler);
 wxIMPLEMENT_ABSTRACT_CLASS(wxView, wxEvtHandler);
 wxIMPLEMENT_ABSTRACT_CLASS(wxDocTemplate, wxObject);
@@ -107,6 +117,32 @@ wxString FindExtension(const wxString& path)
 
 } // anonymous namespace
 
+// ----------------------------------------------------------------------------
+// wxDocumentAsyncIO: state of an asynchronous document I/O operation
+// ----------------------------------------------------------------------------
+
+class wxDocumentAsyncIO
+{
+public:
+    explicit wxDocumentAsyncIO(bool save) : m_save(save) { }
+
+    // True if saving the document, false if loading it.
+    const bool m_save;
+
+    // Set from the main thread, read from the worker one.
+    std::atomic<bool> m_cancelled{false};
+
+    // Last reported progress, only used by the worker thread.
+    std::atomic<int> m_progress{-1};
+
+#if wxUSE_THREADS
+    // Only used in the main thread.
+    std::future<void> m_future;
+#endif // wxUSE_THREADS
+
+    wxDECLARE_NO_COPY_CLASS(wxDocumentAsyncIO);
+};
+
 // ----------------------------------------------------------------------------
 // Definition of wxDocument
 // ----------------------------------------------------------------------------
@@ -131,6 +167,12 @@ bool wxDocument::DeleteContents()
 
 wxDocument::~wxDocument()
 {
+    // This is normally done in Close() already and doing it here is too late
+    // as the derived class object has already been destroyed, but still better
+    // than letting the worker thread use this object after it's deleted.
+    CancelDocumentIO();
+    WaitForDocumentIO();
+
     delete m_commandProcessor;
 
     if (GetDocumentManager())
@@ -167,6 +209,16 @@ bool wxDocument::CanClose()
 
 bool wxDocument::Close()
 {
+    // Let the document being saved finish saving it, but there is no need to
+    // continue loading it if we're going to close it.
+    if ( IsDocumentIOInProgress() )
+    {
+        if ( !m_asyncIO->m_save )
+            CancelDocumentIO();
+
+        WaitForDocumentIO();
+    }
+
     // First check if this document itself and all its children can be closed.
     if ( !CanClose() )
         return false;
@@ -402,13 +454,18 @@ bool wxDocument::OnSaveDocument(const wxString& file)
     if ( !DoSaveDocument(file) )
         return false;
 
+    FinishSaving(file);
+    return true;
+}
+
+void wxDocument::FinishSaving(const wxString& file)
+{
     if ( m_commandProcessor )
         m_commandProcessor->MarkAsSaved();
 
     Modify(false);
     SetFilename(file);
     SetDocumentSaved(true);
-    return true;
 }
 
 bool wxDocument::OnOpenDocument(const wxString& file)
@@ -419,6 +476,13 @@ bool wxDocument::OnOpenDocument(const wxString& file)
     if ( !DoOpenDocument(file) )
         return false;
 
+    FinishOpening(file);
+
+    return true;
+}
+
+void wxDocument::FinishOpening(const wxString& file)
+{
     SetFilename(file, true);
 
     // stretching the logic a little this does make sense because the document
@@ -429,10 +493,104 @@ bool wxDocument::OnOpenDocument(const wxString& file)
     SetDocumentSaved(true);
 
     UpdateAllViews();
+}
+
+bool wxDocument::OpenDocumentAsync(const wxString& file)
+{
+    return StartDocumentIO(file, false /* open */);
+}
+
+bool wxDocument::SaveDocumentAsync(const wxString& file)
+{
+    return StartDocumentIO(file, true /* save */);
+}
+
+bool wxDocument::StartDocumentIO(const wxString& file, bool save)
+{
+    wxCHECK_MSG( !m_asyncIO, false,
+                 "another document I/O operation is already in progress" );
+
+    if ( file.empty() )
+        return false;
+
+    const auto io = std::make_shared<wxDocumentAsyncIO>(save);
+    m_asyncIO = io;
+
+    // This is called in the main thread when the operation finishes.
+    const auto onDone = [this, io, file, save](bool ok)
+    {
+        m_asyncIO.reset();
+
+        if ( ok )
+        {
+            if ( save )
+                FinishSaving(file);
+            else
+                FinishOpening(file);
+        }
+
+        wxThreadEvent event(wxEVT_DOCUMENT_IO_COMPLETED);
+        event.SetEventObject(this);
+        event.SetString(file);
+        event.SetInt(ok);
+        event.SetExtraLong(save);
+        SafelyProcessEvent(event);
+    };
+
+#if wxUSE_THREADS
+    io->m_future = wxThreadPool::Get().Submit([this, file, save, onDone]()
+    {
+        const bool ok = save ? DoSaveDocument(file) : DoOpenDocument(file);
+
+        CallAfter([onDone, ok]() { onDone(ok); });
+    });
+#else // !wxUSE_THREADS
+    // We can't do it in the background, but still call the completion
+    // handler asynchronously for consistency.
+    const bool ok = save ? DoSaveDocument(file) : DoOpenDocument(file);
+
+    CallAfter([onDone, ok]() { onDone(ok); });
+#endif // wxUSE_THREADS/!wxUSE_THREADS
 
     return true;
 }
 
+void wxDocument::CancelDocumentIO()
+{
+    if ( m_asyncIO )
+        m_asyncIO->m_cancelled = true;
+}
+
+void wxDocument::WaitForDocumentIO()
+{
+#if wxUSE_THREADS
+    if ( m_asyncIO && m_asyncIO->m_future.valid() )
+        m_asyncIO->m_future.wait();
+#endif // wxUSE_THREADS
+}
+
+void wxDocument::ReportDocumentIOProgress(int percent)
+{
+    // Note that m_asyncIO is only modified by the main thread when there is
+    // no operation in progress, so it's safe to access it here.
+    if ( !m_asyncIO )
+        return;
+
+    // Don't flood the main thread with events if the progress didn't change.
+    if ( m_asyncIO->m_progress.exchange(percent) == percent )
+        return;
+
+    wxThreadEvent* const event = new wxThreadEvent(wxEVT_DOCUMENT_IO_PROGRESS);
+    event->SetEventObject(this);
+    event->SetInt(percent);
+    QueueEvent(event);
+}
+
+bool wxDocument::IsDocumentIOCancelled() const
+{
+    return m_asyncIO && m_asyncIO->m_cancelled;
+}
+
 #if wxUSE_STD_IOSTREAM
 std::istream& wxDocument::LoadObject(std::istream& stream)
 #else
@@ -1568,12 +1726,28 @@ wxDocument *wxDocManager::CreateDocument(const wxString& pathOrig, long flags)
 
     docNew->SetDocumentName(temp->GetDocumentName());
 
+    // when opening the document asynchronously, it will be added to the MRU
+    // or deleted from OnAsyncOpenCompleted()
+    const bool async = (flags & wxDOC_ASYNC) && !(flags & wxDOC_NEW);
+    if ( async )
+    {
+        docNew->Bind(wxEVT_DOCUMENT_IO_COMPLETED,
+                     &wxDocManager::OnAsyncOpenCompleted, this);
+    }
+
     wxTRY
     {
         // call the appropriate function depending on whether we're creating a
         // new file or opening an existing one
-        if ( !(flags & wxDOC_NEW ? docNew->OnNewDocument()
-                                 : docNew->OnOpenDocument(path)) )
+        bool ok;
+        if ( flags & wxDOC_NEW )
+            ok = docNew->OnNewDocument();
+        else if ( async )
+            ok = docNew->OpenDocumentAsync(path);
+        else
+            ok = docNew->OnOpenDocument(path);
+
+        if ( !ok )
         {
             docNew->DeleteAllViews();
             return nullptr;
@@ -1584,7 +1758,7 @@ wxDocument *wxDocManager::CreateDocument(const wxString& pathOrig, long flags)
     // add the successfully opened file to MRU, but only if we're going to be
     // able to reopen it successfully later which requires the template for
     // this document to be retrievable from the file extension
-    if ( !(flags & wxDOC_NEW) && temp->FileMatchesTemplate(path) )
+    if ( !(flags & wxDOC_NEW) && !async && temp->FileMatchesTemplate(path) )
         AddFileToHistory(path);
 
     // at least under Mac (where views are top level windows) it seems to be
@@ -1595,6 +1769,34 @@ wxDocument *wxDocManager::CreateDocument(const wxString& pathOrig, long flags)
     return docNew;
 }
 
+void wxDocManager::OnAsyncOpenCompleted(wxThreadEvent& event)
+{
+    event.Skip();
+
+    wxDocument * const doc = wxStaticCast(event.GetEventObject(), wxDocument);
+    doc->Unbind(wxEVT_DOCUMENT_IO_COMPLETED,
+                &wxDocManager::OnAsyncOpenCompleted, this);
+
+    if ( event.GetInt() )
+    {
+        // see the comment in CreateDocument()
+        const wxString& path = event.GetString();
+        wxDocTemplate * const temp = doc->GetDocumentTemplate();
+        if ( temp && temp->FileMatchesTemplate(path) )
+            AddFileToHistory(path);
+    }
+    else // failed to open the document, close it
+    {
+        // don't delete the document from its own event handler but check that
+        // it still exists when we get to doing it
+        CallAfter([this, doc]()
+        {
+            if ( m_docs.Member(doc) )
+                doc->DeleteAllViews();
+        });
+    }
+}
+
 wxView *wxDocManager::CreateView(wxDocument *doc, long flags)
 {
     wxDocTemplateVector templates(GetVisibleTemplates(m_templates));
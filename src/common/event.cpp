@@ -22,6 +22,7 @@
 #include "wx/event.h"
 #include "wx/eventfilter.h"
 #include "wx/evtloop.h"
+#include "wx/evtprofiler.h"
 
 #ifndef WX_PRECOMP
     #include "wx/list.h"
@@ -44,11 +45,16 @@
 #include "wx/thread.h"
 
 #if wxUSE_BASE
+    #include <atomic>
     #include <memory>
+    #include <unordered_map>
 #endif // wxUSE_BASE
 
 #if wxUSE_GUI
     #include "wx/private/rescale.h"
+
+    #include <unordered_map>
+    #include <vector>
 #endif
 
 // ----------------------------------------------------------------------------
@@ -365,6 +371,10 @@ wxEvent::wxEvent(int theId, wxEventType commandType)
     m_propagatedFrom = nullptr;
     m_wasProcessed = false;
     m_willBeProcessedAgain = false;
+    m_nextPending = nullptr;
+    m_coalesceKey = 0;
+    m_isCoalesced = false;
+    m_queueTime = -1;
 }
 
 wxEvent::wxEvent(const wxEvent& src)
@@ -381,6 +391,10 @@ wxEvent::wxEvent(const wxEvent& src)
     , m_isCommandEvent(src.m_isCommandEvent)
     , m_wasProcessed(false)
     , m_willBeProcessedAgain(false)
+    , m_nextPending(nullptr)
+    , m_coalesceKey(0)
+    , m_isCoalesced(false)
+    , m_queueTime(-1)
 {
 }
 
@@ -408,6 +422,176 @@ wxEvent& wxEvent::operator=(const wxEvent& src)
     return *this;
 }
 
+// ----------------------------------------------------------------------------
+// wxEvent memory allocation
+// ----------------------------------------------------------------------------
+
+namespace
+{
+
+// Size of the events is rounded up to a multiple of this granularity and the
+// events not bigger than the maximal size are allocated from the cache.
+constexpr size_t wxEVENT_ALLOC_GRANULARITY = 32;
+constexpr size_t wxEVENT_ALLOC_NUM_SIZES = 8;
+constexpr size_t wxEVENT_ALLOC_MAX_SIZE =
+    wxEVENT_ALLOC_GRANULARITY * wxEVENT_ALLOC_NUM_SIZES;
+
+// Maximal number of free blocks of each size kept in the cache.
+constexpr size_t wxEVENT_ALLOC_MAX_CACHED = 32;
+
+std::atomic<bool> gs_eventUseAllocCache(false);
+
+std::atomic<wxUint64> gs_eventNumAllocated(0);
+std::atomic<wxUint64> gs_eventNumReused(0);
+
+// Cache of the memory blocks of the deleted events of the current thread.
+//
+// Note that the events are often deleted in a different thread from the one
+// they were allocated in, e.g. when they're queued from a worker thread, but
+// this is fine as all blocks are allocated using the global operator new and
+// so can be freed, or cached, in any thread.
+class EventAllocCache
+{
+public:
+    // Return the cache for the current thread or null if it had been already
+    // destroyed, which can happen if events are deleted during the thread
+    // termination.
+    static EventAllocCache* Get()
+    {
+        if ( !ms_current && !ms_destroyed )
+        {
+            thread_local EventAllocCache s_cache;
+            ms_current = &s_cache;
+        }
+
+        return ms_current;
+    }
+
+    ~EventAllocCache()
+    {
+        for ( auto block : m_free )
+        {
+            while ( block )
+            {
+                FreeBlock* const next = block->next;
+                ::operator delete(block);
+                block = next;
+            }
+        }
+
+        ms_current = nullptr;
+        ms_destroyed = true;
+    }
+
+    void* Take(size_t index)
+    {
+        FreeBlock* const block = m_free[index];
+        if ( !block )
+            return nullptr;
+
+        m_free[index] = block->next;
+        m_count[index]--;
+
+        return block;
+    }
+
+    bool Put(size_t index, void* p)
+    {
+        if ( m_count[index] == wxEVENT_ALLOC_MAX_CACHED )
+            return false;
+
+        FreeBlock* const block = static_cast<FreeBlock*>(p);
+        block->next = m_free[index];
+        m_free[index] = block;
+        m_count[index]++;
+
+        return true;
+    }
+
+private:
+    EventAllocCache() = default;
+
+    struct FreeBlock
+    {
+        FreeBlock* next;
+    };
+
+    FreeBlock* m_free[wxEVENT_ALLOC_NUM_SIZES] = { nullptr };
+    size_t m_count[wxEVENT_ALLOC_NUM_SIZES] = { 0 };
+
+    // These variables are trivially destructible and so can still be used
+    // after the cache object itself is destroyed.
+    static thread_local EventAllocCache* ms_current;
+    static thread_local bool ms_destroyed;
+
+    wxDECLARE_NO_COPY_CLASS(EventAllocCache);
+};
+
+thread_local EventAllocCache* EventAllocCache::ms_current = nullptr;
+thread_local bool EventAllocCache::ms_destroyed = false;
+
+} // anonymous namespace
+
+/* static */
+void wxEvent::UseAllocCache(bool use)
+{
+    gs_eventUseAllocCache = use;
+}
+
+/* static */
+wxEventAllocStats wxEvent::GetAllocStats()
+{
+    wxEventAllocStats stats;
+    stats.allocated = gs_eventNumAllocated.load(std::memory_order_relaxed);
+    stats.reused = gs_eventNumReused.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void* wxEvent::operator new(size_t size)
+{
+    gs_eventNumAllocated.fetch_add(1, std::memory_order_relaxed);
+
+    if ( size > wxEVENT_ALLOC_MAX_SIZE )
+        return ::operator new(size);
+
+    // Always allocate the full block, even if the cache is not used, as it
+    // could be enabled before this block is deleted and then reused for a
+    // bigger event.
+    const size_t index = (size - 1) / wxEVENT_ALLOC_GRANULARITY;
+
+    if ( gs_eventUseAllocCache.load(std::memory_order_relaxed) )
+    {
+        if ( EventAllocCache* const cache = EventAllocCache::Get() )
+        {
+            if ( void* const p = cache->Take(index) )
+            {
+                gs_eventNumReused.fetch_add(1, std::memory_order_relaxed);
+                return p;
+            }
+        }
+    }
+
+    return ::operator new((index + 1) * wxEVENT_ALLOC_GRANULARITY);
+}
+
+void wxEvent::operator delete(void* p, size_t size)
+{
+    if ( !p )
+        return;
+
+    if ( size <= wxEVENT_ALLOC_MAX_SIZE &&
+            gs_eventUseAllocCache.load(std::memory_order_relaxed) )
+    {
+        if ( EventAllocCache* const cache = EventAllocCache::Get() )
+        {
+            if ( cache->Put((size - 1) / wxEVENT_ALLOC_GRANULARITY, p) )
+                return;
+        }
+    }
+
+    ::operator delete(p);
+}
+
 #endif // wxUSE_BASE
 
 #if wxUSE_GUI
@@ -474,6 +658,13 @@ bool wxUpdateUIEvent::CanUpdate(wxWindowBase *win)
        ((win->GetExtraStyle() & wxWS_EX_PROCESS_UI_UPDATES) == 0)))
         return false;
 
+    // In registered mode, also skip the windows for which no handler could
+    // exist, without even constructing the event.
+    if (win &&
+       GetMode() == wxUPDATE_UI_PROCESS_REGISTERED &&
+       !win->WXIsRegisteredForUpdateUI())
+        return false;
+
     // Don't update children of the hidden windows: this is useless as any
     // change to their state won't be seen by the user anyhow. Notice that this
     // argument doesn't apply to the hidden windows (with visible parent)
@@ -518,6 +709,107 @@ void wxUpdateUIEvent::ResetUpdateTime()
 #endif
 }
 
+// ----------------------------------------------------------------------------
+// wxUpdateUIDependency
+// ----------------------------------------------------------------------------
+
+// The state is shared between wxUpdateUIDependency and the cache entries
+// referencing it, so that they remain valid even if the dependency object
+// itself is destroyed.
+class wxUpdateUIDependency::State : public wxRefCounter
+{
+public:
+    // The value of gs_updateUIChangeCounter when this dependency was changed
+    // for the last time.
+    unsigned long m_lastChange = 0;
+};
+
+namespace
+{
+
+// Incremented every time any dependency changes.
+unsigned long gs_updateUIChangeCounter = 0;
+
+struct UpdateUICacheEntry
+{
+    // The value of gs_updateUIChangeCounter when the event was sent.
+    unsigned long m_evaluated;
+
+    std::vector< wxObjectDataPtr<wxUpdateUIDependency::State> > m_dependencies;
+};
+
+// Maps the UI elements to the dependencies of their wxEVT_UPDATE_UI handlers.
+std::unordered_map<const void*, UpdateUICacheEntry> gs_updateUICache;
+
+} // anonymous namespace
+
+wxUpdateUIDependency::wxUpdateUIDependency()
+    : m_state(new State)
+{
+}
+
+wxUpdateUIDependency::~wxUpdateUIDependency()
+{
+    // The handlers can't depend on the state which doesn't exist any more,
+    // so ensure that they're called again if they did.
+    m_state->m_lastChange = static_cast<unsigned long>(-1);
+    m_state->DecRef();
+}
+
+void wxUpdateUIDependency::MarkChanged()
+{
+    m_state->m_lastChange = ++gs_updateUIChangeCounter;
+}
+
+/* static */
+bool wxUpdateUIEvent::IsUpToDate(const void* element)
+{
+    if ( gs_updateUICache.empty() )
+        return false;
+
+    const auto it = gs_updateUICache.find(element);
+    if ( it == gs_updateUICache.end() )
+        return false;
+
+    const UpdateUICacheEntry& entry = it->second;
+    for ( const auto& state : entry.m_dependencies )
+    {
+        if ( state->m_lastChange > entry.m_evaluated )
+            return false;
+    }
+
+    return true;
+}
+
+void wxUpdateUIEvent::RememberDependencies(const void* element) const
+{
+    // If the handler didn't declare its dependencies, we must call it every
+    // time, as before.
+    if ( m_dependencies.empty() )
+    {
+        ForgetElement(element);
+        return;
+    }
+
+    UpdateUICacheEntry& entry = gs_updateUICache[element];
+    entry.m_evaluated = gs_updateUIChangeCounter;
+    entry.m_dependencies.clear();
+    for ( const wxUpdateUIDependency* dep : m_dependencies )
+    {
+        wxUpdateUIDependency::State* const state = dep->WXGetState();
+        state->IncRef();
+        entry.m_dependencies.push_back(
+            wxObjectDataPtr<wxUpdateUIDependency::State>(state));
+    }
+}
+
+/* static */
+void wxUpdateUIEvent::ForgetElement(const void* element)
+{
+    if ( !gs_updateUICache.empty() )
+        gs_updateUICache.erase(element);
+}
+
 // ----------------------------------------------------------------------------
 // wxScrollEvent
 // ----------------------------------------------------------------------------
@@ -1163,13 +1455,98 @@ void wxEventHashTable::GrowEventTypeTable()
 // wxEvtHandler
 // ----------------------------------------------------------------------------
 
+// Minimal number of dynamic event handlers for which the index is created.
+static const size_t DYNAMIC_EVENTS_INDEX_MIN_SIZE = 16;
+
+struct wxEvtHandler::DynamicEventsIndex
+{
+    // All the valid entries of m_dynamicEvents for each event type, in the
+    // same order as in it. Just as it, these vectors may contain null entries
+    // for the handlers which were unbound but not pruned yet.
+    std::unordered_map<wxEventType, DynamicEvents> byType;
+
+    // Number of null entries in m_dynamicEvents itself, which is not iterated
+    // over by SearchDynamicEventTable() when the index is used and so must be
+    // pruned separately.
+    size_t numUnbound = 0;
+};
+
+namespace
+{
+
+// This class is used to mark the vectors of dynamic event table entries as
+// being iterated over while an event handler is called: such vectors must not
+// be pruned by any nested calls to SearchDynamicEntries() made by the handler
+// as this would shift the entries which haven't been checked yet and result
+// in some handlers being skipped and others called twice.
+//
+// The guard objects form a stack in each thread and only use the
+// thread-specific pointer, so they can be safely destroyed even if the event
+// handler itself was deleted.
+class DynamicEntriesInUse
+{
+public:
+    explicit DynamicEntriesInUse(const wxVector<wxDynamicEventTableEntry*>* entries)
+        : m_entries(entries),
+          m_prev(ms_top)
+    {
+        ms_top = this;
+    }
+
+    ~DynamicEntriesInUse()
+    {
+        ms_top = m_prev;
+    }
+
+    static bool IsInUse(const wxVector<wxDynamicEventTableEntry*>* entries)
+    {
+        for ( const DynamicEntriesInUse* p = ms_top; p; p = p->m_prev )
+        {
+            if ( p->m_entries == entries )
+                return true;
+        }
+
+        return false;
+    }
+
+private:
+    const wxVector<wxDynamicEventTableEntry*>* const m_entries;
+    DynamicEntriesInUse* const m_prev;
+
+    static thread_local DynamicEntriesInUse* ms_top;
+
+    wxDECLARE_NO_COPY_CLASS(DynamicEntriesInUse);
+};
+
+thread_local DynamicEntriesInUse* DynamicEntriesInUse::ms_top = nullptr;
+
+// Remove all null entries from the vector, which must have at least one.
+void PruneUnboundEntries(wxVector<wxDynamicEventTableEntry*>& entries)
+{
+    size_t nNew = 0;
+    for ( size_t n = 0; n != entries.size(); n++ )
+    {
+        if ( entries[n] )
+            entries[nNew++] = entries[n];
+    }
+
+    wxASSERT( nNew != entries.size() );
+    entries.resize(nNew);
+}
+
+} // anonymous namespace
+
 wxEvtHandler::wxEvtHandler()
 {
     m_nextHandler = nullptr;
     m_previousHandler = nullptr;
     m_enabled = true;
     m_dynamicEvents = nullptr;
-    m_pendingEvents = nullptr;
+    m_dynamicEventsIndex = nullptr;
+    m_queuedEvents = nullptr;
+    m_hasPendingEvents = false;
+    m_pendingEventsFirst =
+    m_pendingEventsLast = nullptr;
 
     // no client data (yet)
     m_clientData = nullptr;
@@ -1205,6 +1582,7 @@ wxEvtHandler::~wxEvtHandler()
             delete entry;
         }
         delete m_dynamicEvents;
+        delete m_dynamicEventsIndex;
     }
 
     // Remove us from the list of the pending events if necessary.
@@ -1308,37 +1686,161 @@ void wxEvtHandler::QueueEvent(wxEvent *event)
         return;
     }
 
-    // 1) Add this event to our list of pending events
-    wxENTER_CRIT_SECT( m_pendingEventsLock );
+    if ( wxEventProfiler::IsRunning() )
+        event->m_queueTime = wxEventProfiler::GetTime();
+
+    // 1) Add this event to our queue of pending events: this doesn't require
+    //    any locking, so the threads queuing events don't block each other nor
+    //    the thread processing them.
+    wxEvent* head = m_queuedEvents.load();
+    do
+    {
+        event->m_nextPending = head;
+    }
+    while ( !m_queuedEvents.compare_exchange_weak(head, event) );
 
-    if ( !m_pendingEvents )
-        m_pendingEvents = new wxList;
+    // 2) Add this event handler to list of event handlers that have pending
+    //    events, unless it's already there: this does require locking the
+    //    list, but only needs to be done for the first queued event.
+    //
+    //    Notice that it's possible that the event we've just queued has been
+    //    already processed, and this handler removed from the list, by now,
+    //    which means that the handler could be added to the list without
+    //    having any pending events, but this is harmless as it will be just
+    //    removed from it again by ProcessPendingEvents().
+    if ( !m_hasPendingEvents.exchange(true) )
+        wxTheApp->AppendPendingEventHandler(this);
 
-    m_pendingEvents->Append(event);
+    // 3) Inform the system that new pending events are somewhere,
+    //    and that these should be processed in idle time.
+    wxWakeUpIdle();
+}
 
-    // 2) Add this event handler to list of event handlers that
-    //    have pending events.
+void wxEvtHandler::QueueEventCoalesced(wxEvent *event, wxUIntPtr key)
+{
+    wxCHECK_RET( event, "null event can't be posted" );
 
-    wxTheApp->AppendPendingEventHandler(this);
+    if (!wxTheApp)
+    {
+        // see the comment in QueueEvent()
+        wxLogDebug("No application object! Cannot queue this event!");
 
-    // only release m_pendingEventsLock now because otherwise there is a race
-    // condition as described in the ticket #9093: we could process the event
-    // just added to m_pendingEvents in our ProcessPendingEvents() below before
-    // we had time to append this pointer to wxHandlersWithPendingEvents list; thus
-    // breaking the invariant that a handler should be in the list iff it has
-    // any pending events to process
-    wxLEAVE_CRIT_SECT( m_pendingEventsLock );
+        delete event;
+
+        return;
+    }
+
+    event->m_coalesceKey = key;
+    event->m_isCoalesced = true;
+
+    if ( wxEventProfiler::IsRunning() )
+        event->m_queueTime = wxEventProfiler::GetTime();
+
+    wxEvent* old;
+    {
+        wxCRIT_SECT_LOCKER( lock, m_pendingEventsLock );
+
+        // Unlike QueueEvent(), we need to look for the existing event with
+        // the same key, so we need all the events in the pending list.
+        MoveQueuedEventsToPending();
+
+        wxEvent* prev = nullptr;
+        for ( old = m_pendingEventsFirst; old; old = old->m_nextPending )
+        {
+            if ( old->m_isCoalesced && old->m_coalesceKey == key )
+                break;
+
+            prev = old;
+        }
+
+        if ( old )
+        {
+            // The new event has been waiting since the old one was queued.
+            if ( old->m_queueTime != -1 )
+                event->m_queueTime = old->m_queueTime;
+
+            // Put the new event in place of the old one.
+            event->m_nextPending = old->m_nextPending;
+            old->m_nextPending = nullptr;
+
+            if ( m_pendingEventsLast == old )
+                m_pendingEventsLast = event;
+        }
+        else // Just append the new event, prev is the last one now.
+        {
+            m_pendingEventsLast = event;
+        }
+
+        if ( prev )
+            prev->m_nextPending = event;
+        else
+            m_pendingEventsFirst = event;
+    }
+
+    // Delete the replaced event only after releasing the lock, as its dtor
+    // can potentially do anything.
+    delete old;
+
+    // See the comments in QueueEvent().
+    if ( !m_hasPendingEvents.exchange(true) )
+        wxTheApp->AppendPendingEventHandler(this);
 
-    // 3) Inform the system that new pending events are somewhere,
-    //    and that these should be processed in idle time.
     wxWakeUpIdle();
 }
 
+void wxEvtHandler::MoveQueuedEventsToPending()
+{
+    // Take all the queued events at once and reverse their order to get them
+    // in the order in which they were queued.
+    wxEvent* event = m_queuedEvents.exchange(nullptr);
+    if ( !event )
+        return;
+
+    wxEvent* const last = event;
+    wxEvent* first = nullptr;
+    while ( event )
+    {
+        wxEvent* const next = event->m_nextPending;
+        event->m_nextPending = first;
+        first = event;
+        event = next;
+    }
+
+    if ( m_pendingEventsLast )
+        m_pendingEventsLast->m_nextPending = first;
+    else
+        m_pendingEventsFirst = first;
+
+    m_pendingEventsLast = last;
+}
+
+void wxEvtHandler::RemoveFromPendingEventHandlers()
+{
+    wxTheApp->RemovePendingEventHandler(this);
+    m_hasPendingEvents = false;
+
+    // Another thread could have queued an event after we had checked for them
+    // but before we reset the flag above, in which case it wouldn't have added
+    // this handler to the list, so do it now.
+    if ( m_queuedEvents.load() && !m_hasPendingEvents.exchange(true) )
+        wxTheApp->AppendPendingEventHandler(this);
+}
+
 void wxEvtHandler::DeletePendingEvents()
 {
-    if (m_pendingEvents)
-        m_pendingEvents->DeleteContents(true);
-    wxDELETE(m_pendingEvents);
+    MoveQueuedEventsToPending();
+
+    for ( wxEvent* event = m_pendingEventsFirst; event; )
+    {
+        wxEvent* const next = event->m_nextPending;
+        delete event;
+        event = next;
+    }
+
+    m_pendingEventsFirst =
+    m_pendingEventsLast = nullptr;
+
+    m_hasPendingEvents = false;
 }
 
 void wxEvtHandler::ProcessPendingEvents()
@@ -1357,25 +1859,34 @@ void wxEvtHandler::ProcessPendingEvents()
 
     wxENTER_CRIT_SECT( m_pendingEventsLock );
 
-    // this method is only called by wxApp if this handler does have
-    // pending events
-    wxCHECK_RET( m_pendingEvents && !m_pendingEvents->IsEmpty(),
-                 "should have pending events if called" );
+    MoveQueuedEventsToPending();
+
+    // this method is only called by wxApp if this handler is in its list of
+    // handlers with pending events, but it may not have any of them any more
+    // if they had been already processed, see the comment in QueueEvent()
+    if ( !m_pendingEventsFirst )
+    {
+        RemoveFromPendingEventHandlers();
+
+        wxLEAVE_CRIT_SECT( m_pendingEventsLock );
 
-    wxList::compatibility_iterator node = m_pendingEvents->GetFirst();
-    wxEvent* pEvent = static_cast<wxEvent *>(node->GetData());
+        return;
+    }
+
+    wxEvent* prev = nullptr;
+    wxEvent* pEvent = m_pendingEventsFirst;
 
     // find the first event which can be processed now:
     wxEventLoopBase* evtLoop = wxEventLoopBase::GetActive();
     if (evtLoop && evtLoop->IsYielding())
     {
-        while (node && pEvent && !evtLoop->IsEventAllowedInsideYield(pEvent->GetEventCategory()))
+        while (pEvent && !evtLoop->IsEventAllowedInsideYield(pEvent->GetEventCategory()))
         {
-            node = node->GetNext();
-            pEvent = node ? static_cast<wxEvent *>(node->GetData()) : nullptr;
+            prev = pEvent;
+            pEvent = pEvent->m_nextPending;
         }
 
-        if (!node)
+        if (!pEvent)
         {
             // all our events are NOT processable now... signal this:
             wxTheApp->DelayPendingEventHandler(this);
@@ -1394,17 +1905,31 @@ void wxEvtHandler::ProcessPendingEvents()
     // it's important we remove event from list before processing it, else a
     // nested event loop, for example from a modal dialog, might process the
     // same event again.
-    m_pendingEvents->Erase(node);
+    if ( prev )
+        prev->m_nextPending = pEvent->m_nextPending;
+    else
+        m_pendingEventsFirst = pEvent->m_nextPending;
 
-    if ( m_pendingEvents->IsEmpty() )
+    if ( m_pendingEventsLast == pEvent )
+        m_pendingEventsLast = prev;
+
+    pEvent->m_nextPending = nullptr;
+
+    if ( !m_pendingEventsFirst )
     {
+        MoveQueuedEventsToPending();
+
         // if there are no more pending events left, we don't need to
         // stay in this list
-        wxTheApp->RemovePendingEventHandler(this);
+        if ( !m_pendingEventsFirst )
+            RemoveFromPendingEventHandlers();
     }
 
     wxLEAVE_CRIT_SECT( m_pendingEventsLock );
 
+    if ( event->m_queueTime != -1 )
+        wxEventProfiler::OnQueueWaitEnd(*event, event->m_queueTime);
+
     // We must not let exceptions escape from here, there is no outer exception
     // handler to catch them and so letting them do it would just terminate the
     // program.
@@ -1435,6 +1960,17 @@ bool wxEvtHandler::ProcessEventIfMatchesId(const wxEventTableEntryBase& entry,
         event.Skip(false);
         event.m_callbackUserData = entry.m_callbackUserData;
 
+        // Remember the class of the handler before calling it, as it could be
+        // destroyed by it.
+        const wxLongLong_t profileStart = wxEventProfiler::StartTiming();
+        const wxChar* profileClass = nullptr;
+        if ( profileStart != -1 )
+        {
+            const wxEvtHandler* const target = entry.m_fn->GetEvtHandler();
+            profileClass = (target ? target : handler)->GetClassInfo()
+                                                      ->GetClassName();
+        }
+
 #if wxUSE_EXCEPTIONS
         if ( wxTheApp )
         {
@@ -1449,6 +1985,9 @@ bool wxEvtHandler::ProcessEventIfMatchesId(const wxEventTableEntryBase& entry,
             (*entry.m_fn)(handler, event);
         }
 
+        if ( profileStart != -1 )
+            wxEventProfiler::OnHandlerEnd(event, profileClass, profileStart);
+
         if (!event.GetSkipped())
             return true;
     }
@@ -1525,6 +2064,20 @@ bool wxEvtHandler::ProcessEvent(wxEvent& event)
             }
             //else: proceed normally
         }
+
+        // Measure the total time taken by processing this event if the
+        // profiler is running by calling this function recursively: it won't
+        // get here again as WasProcessed() returns true now. Notice that we
+        // must call our own version and not an overridden one.
+        const wxLongLong_t profileStart = wxEventProfiler::StartTiming();
+        if ( profileStart != -1 )
+        {
+            const bool processed = wxEvtHandler::ProcessEvent(event);
+
+            wxEventProfiler::OnDispatchEnd(event, profileStart);
+
+            return processed;
+        }
     }
 
     // Short circuit the event processing logic if we're requested to process
@@ -1781,6 +2334,24 @@ void wxEvtHandler::DoBind(int id,
     // than inserting the element at the front.
     m_dynamicEvents->push_back(entry);
 
+    if ( m_dynamicEventsIndex )
+    {
+        m_dynamicEventsIndex->byType[entry->m_eventType].push_back(entry);
+    }
+    else if ( m_dynamicEvents->size() >= DYNAMIC_EVENTS_INDEX_MIN_SIZE )
+    {
+        // Checking all the handlers for every event becomes too slow when
+        // there are many of them, so index them by the event type.
+        m_dynamicEventsIndex = new DynamicEventsIndex;
+        for ( wxDynamicEventTableEntry* const e : *m_dynamicEvents )
+        {
+            if ( e )
+                m_dynamicEventsIndex->byType[e->m_eventType].push_back(e);
+            else
+                m_dynamicEventsIndex->numUnbound++;
+        }
+    }
+
     // Make sure we get to know when a sink is destroyed
     wxEvtHandler *eventSink = func->GetEvtHandler();
     if ( eventSink && eventSink != this )
@@ -1834,6 +2405,7 @@ wxEvtHandler::DoUnbind(int id,
             // vector, which is not guaranteed by our API, but here we can use
             // this implementation detail.
             (*m_dynamicEvents)[cookie] = nullptr;
+            RemoveFromDynamicEventsIndex(entry);
 
             delete entry;
             return true;
@@ -1870,13 +2442,60 @@ wxEvtHandler::GetNextDynamicEntry(size_t& cookie) const
     return nullptr;
 }
 
+void
+wxEvtHandler::RemoveFromDynamicEventsIndex(wxDynamicEventTableEntry* entry)
+{
+    if ( !m_dynamicEventsIndex )
+        return;
+
+    // As with m_dynamicEvents itself, we can't erase the entry from the vector
+    // as we could be iterating over it, so just reset it.
+    DynamicEvents& entries = m_dynamicEventsIndex->byType[entry->m_eventType];
+    for ( auto& e : entries )
+    {
+        if ( e == entry )
+        {
+            e = nullptr;
+            break;
+        }
+    }
+
+    m_dynamicEventsIndex->numUnbound++;
+}
+
 bool wxEvtHandler::SearchDynamicEventTable( wxEvent& event )
 {
     wxCHECK_MSG( m_dynamicEvents, false,
                  wxT("caller should check that we have dynamic events") );
 
-    DynamicEvents& dynamicEvents = *m_dynamicEvents;
+    if ( m_dynamicEventsIndex )
+    {
+        const auto it = m_dynamicEventsIndex->byType.find(event.GetEventType());
+        if ( it != m_dynamicEventsIndex->byType.end() &&
+                SearchDynamicEntries(it->second, event) )
+        {
+            // Don't access anything here, this object could have been deleted.
+            return true;
+        }
+
+        // Also prune the main vector from time to time, as it is not done by
+        // SearchDynamicEntries() when using the index.
+        if ( m_dynamicEventsIndex->numUnbound &&
+                !DynamicEntriesInUse::IsInUse(m_dynamicEvents) )
+        {
+            PruneUnboundEntries(*m_dynamicEvents);
+            m_dynamicEventsIndex->numUnbound = 0;
+        }
 
+        return false;
+    }
+
+    return SearchDynamicEntries(*m_dynamicEvents, event);
+}
+
+bool
+wxEvtHandler::SearchDynamicEntries(DynamicEvents& dynamicEvents, wxEvent& event)
+{
     bool needToPruneDeleted = false;
 
     // We can't use Get{First,Next}DynamicEntry() here as they hide the deleted
@@ -1901,7 +2520,14 @@ bool wxEvtHandler::SearchDynamicEventTable( wxEvent& event )
             wxEvtHandler *handler = entry->m_fn->GetEvtHandler();
             if ( !handler )
                handler = this;
-            if ( ProcessEventIfMatchesId(*entry, handler, event) )
+
+            bool processed;
+            {
+                DynamicEntriesInUse inUse(&dynamicEvents);
+                processed = ProcessEventIfMatchesId(*entry, handler, event);
+            }
+
+            if ( processed )
             {
                 // It's important to skip pruning of the unbound event entries
                 // below because this object itself could have been deleted by
@@ -1921,18 +2547,8 @@ bool wxEvtHandler::SearchDynamicEventTable( wxEvent& event )
         }
     }
 
-    if ( needToPruneDeleted )
-    {
-        size_t nNew = 0;
-        for ( size_t n = 0; n != dynamicEvents.size(); n++ )
-        {
-            if ( dynamicEvents[n] )
-                dynamicEvents[nNew++] = dynamicEvents[n];
-        }
-
-        wxASSERT( nNew != dynamicEvents.size() );
-        dynamicEvents.resize(nNew);
-    }
+    if ( needToPruneDeleted && !DynamicEntriesInUse::IsInUse(&dynamicEvents) )
+        PruneUnboundEntries(dynamicEvents);
 
     return false;
 }
@@ -2007,6 +2623,8 @@ void wxEvtHandler::OnSinkDestroyed( wxEvtHandler *sink )
     {
         if ( entry->m_fn->GetEvtHandler() == sink )
         {
+            RemoveFromDynamicEventsIndex(entry);
+
             delete entry->m_callbackUserData;
             delete entry;
 
@@ -0,0 +1,587 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        src/common/evtprofiler.cpp
+// Purpose:     wxEventProfiler implementation
+// Author:      wxWidgets team
+// Created:     2026-10-15
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+// ============================================================================
+// declarations
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// headers
+// ----------------------------------------------------------------------------
+
+// for compilers that support precompilation, includes "wx.h".
+#include "wx/wxprec.h"
+
+
+#include "wx/evtprofiler.h"
+
+#ifndef WX_PRECOMP
+    #include "wx/app.h"
+    #include "wx/utils.h"
+#endif // WX_PRECOMP
+
+#include "wx/ffile.h"
+#include "wx/thread.h"
+
+#if wxUSE_STACKWALKER
+    #include "wx/stackwalk.h"
+#endif
+
+#include <chrono>
+#include <map>
+#include <utility>
+
+// ----------------------------------------------------------------------------
+// private classes
+// ----------------------------------------------------------------------------
+
+namespace
+{
+
+// Accumulated timings, identified by the key in the map containing them.
+struct TimingData
+{
+    void Add(const wxChar* eventClassName, wxLongLong_t duration)
+    {
+        eventClass = eventClassName;
+        count++;
+        totalTime += duration;
+        if ( duration > maxTime )
+            maxTime = duration;
+    }
+
+    const wxChar* eventClass = nullptr;
+    unsigned long count = 0;
+    wxLongLong_t totalTime = 0;
+    wxLongLong_t maxTime = 0;
+};
+
+enum class TraceKind
+{
+    Dispatch,
+    Handler,
+    Idle,
+    QueueWait
+};
+
+// A single entry of the trace, the strings here are the class names which
+// are static and so don't need to be copied.
+struct TraceEntry
+{
+    TraceKind kind;
+    wxEventType eventType;
+    const wxChar* eventClass;
+    const wxChar* handlerClass;
+    wxLongLong_t startTime;
+    wxLongLong_t duration;
+};
+
+struct ProfilerData
+{
+    void Clear()
+    {
+        dispatch.clear();
+        handlers.clear();
+        queueWait.clear();
+        idle = TimingData();
+        stalls.clear();
+        lastStallStart = -1;
+        trace.clear();
+    }
+
+    void AddTrace(TraceKind kind,
+                  const wxEvent* event,
+                  const wxChar* handlerClass,
+                  wxLongLong_t start,
+                  wxLongLong_t duration)
+    {
+        if ( trace.size() >= maxTraceEvents )
+            return;
+
+        TraceEntry entry;
+        entry.kind = kind;
+        entry.eventType = event ? event->GetEventType() : wxEVT_NULL;
+        entry.eventClass = event ? event->GetClassInfo()->GetClassName()
+                                 : nullptr;
+        entry.handlerClass = handlerClass;
+        entry.startTime = start;
+        entry.duration = duration;
+
+        trace.push_back(entry);
+    }
+
+    std::map<wxEventType, TimingData> dispatch;
+    std::map<std::pair<wxEventType, const wxChar*>, TimingData> handlers;
+    std::map<wxEventType, TimingData> queueWait;
+    TimingData idle;
+
+    std::vector<wxEventProfiler::Stall> stalls;
+
+    // Start time of the last stall, used to avoid reporting the handlers
+    // calling the one which was already reported as a stall.
+    wxLongLong_t lastStallStart = -1;
+
+    std::vector<TraceEntry> trace;
+
+    long stallThreshold = 100;
+    size_t maxTraceEvents = 1000000;
+};
+
+ProfilerData& GetData()
+{
+    static ProfilerData s_data;
+    return s_data;
+}
+
+using Clock = std::chrono::steady_clock;
+
+// Origin of all the times, set when the profiler is started for the first time
+// and never changed after this, so that the times of the events queued before
+// restarting the profiler still remain valid.
+Clock::time_point& GetTimeOrigin()
+{
+    static Clock::time_point s_origin = Clock::now();
+    return s_origin;
+}
+
+#if wxUSE_STACKWALKER
+
+class StallStackWalker : public wxStackWalker
+{
+public:
+    const wxString& GetBacktrace() const { return m_backtrace; }
+
+protected:
+    virtual void OnStackFrame(const wxStackFrame& frame) override
+    {
+        m_backtrace += wxString::Format("#%02u ", unsigned(frame.GetLevel()));
+
+        const wxString name = frame.GetName();
+        if ( !name.empty() )
+            m_backtrace += name;
+        else
+            m_backtrace += wxString::Format("%p", frame.GetAddress());
+
+        if ( frame.HasSourceLocation() )
+        {
+            m_backtrace += wxString::Format(" at %s:%u",
+                                            frame.GetFileName(),
+                                            unsigned(frame.GetLine()));
+        }
+
+        m_backtrace += '\n';
+    }
+
+private:
+    wxString m_backtrace;
+};
+
+#endif // wxUSE_STACKWALKER
+
+std::vector<wxEventProfiler::Stats>
+MakeStats(const std::map<wxEventType, TimingData>& timings)
+{
+    std::vector<wxEventProfiler::Stats> stats;
+    stats.reserve(timings.size());
+
+    for ( const auto& kv : timings )
+    {
+        wxEventProfiler::Stats s;
+        s.eventType = kv.first;
+        s.eventClass = kv.second.eventClass;
+        s.count = kv.second.count;
+        s.totalTime = kv.second.totalTime;
+        s.maxTime = kv.second.maxTime;
+
+        stats.push_back(s);
+    }
+
+    return stats;
+}
+
+// Return the string quoted and escaped as needed for JSON.
+wxString QuoteJSON(const wxString& s)
+{
+    wxString quoted;
+    quoted.reserve(s.length() + 2);
+
+    quoted += '"';
+    for ( wxUniChar ch : s )
+    {
+        switch ( ch.GetValue() )
+        {
+            case '"':
+                quoted += "\\\"";
+                break;
+
+            case '\\':
+                quoted += "\\\\";
+                break;
+
+            case '\n':
+                quoted += "\\n";
+                break;
+
+            case '\r':
+                quoted += "\\r";
+                break;
+
+            case '\t':
+                quoted += "\\t";
+                break;
+
+            default:
+                if ( ch.GetValue() < 0x20 )
+                    quoted += wxString::Format("\\u%04x", unsigned(ch.GetValue()));
+                else
+                    quoted += ch;
+        }
+    }
+    quoted += '"';
+
+    return quoted;
+}
+
+wxString GetEventName(const wxString& eventClass, wxEventType eventType)
+{
+    return wxString::Format("%s (%d)", eventClass, int(eventType));
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// wxEventProfiler implementation
+// ============================================================================
+
+std::atomic<bool> wxEventProfiler::ms_running{false};
+
+/* static */
+void wxEventProfiler::Start()
+{
+    // Ensure that the origin is initialized.
+    GetTimeOrigin();
+
+    GetData().Clear();
+
+    ms_running = true;
+}
+
+/* static */
+void wxEventProfiler::Stop()
+{
+    ms_running = false;
+}
+
+/* static */
+void wxEventProfiler::Reset()
+{
+    GetData().Clear();
+}
+
+/* static */
+void wxEventProfiler::SetStallThreshold(long ms)
+{
+    GetData().stallThreshold = ms;
+}
+
+/* static */
+long wxEventProfiler::GetStallThreshold()
+{
+    return GetData().stallThreshold;
+}
+
+/* static */
+void wxEventProfiler::SetMaxTraceEvents(size_t count)
+{
+    GetData().maxTraceEvents = count;
+}
+
+/* static */
+std::vector<wxEventProfiler::Stats> wxEventProfiler::GetDispatchStats()
+{
+    return MakeStats(GetData().dispatch);
+}
+
+/* static */
+std::vector<wxEventProfiler::Stats> wxEventProfiler::GetHandlerStats()
+{
+    const auto& handlers = GetData().handlers;
+
+    std::vector<Stats> stats;
+    stats.reserve(handlers.size());
+
+    for ( const auto& kv : handlers )
+    {
+        Stats s;
+        s.eventType = kv.first.first;
+        s.eventClass = kv.second.eventClass;
+        s.handlerClass = kv.first.second;
+        s.count = kv.second.count;
+        s.totalTime = kv.second.totalTime;
+        s.maxTime = kv.second.maxTime;
+
+        stats.push_back(s);
+    }
+
+    return stats;
+}
+
+/* static */
+std::vector<wxEventProfiler::Stats> wxEventProfiler::GetQueueWaitStats()
+{
+    return MakeStats(GetData().queueWait);
+}
+
+/* static */
+wxEventProfiler::Stats wxEventProfiler::GetIdleStats()
+{
+    const TimingData& idle = GetData().idle;
+
+    Stats s;
+    s.eventType = wxEVT_IDLE;
+    s.count = idle.count;
+    s.totalTime = idle.totalTime;
+    s.maxTime = idle.maxTime;
+
+    return s;
+}
+
+/* static */
+std::vector<wxEventProfiler::Stall> wxEventProfiler::GetStalls()
+{
+    return GetData().stalls;
+}
+
+/* static */
+wxString wxEventProfiler::GetChromeTrace()
+{
+    const ProfilerData& data = GetData();
+
+    const unsigned long pid = wxGetProcessId();
+
+    // Use the first thread for the main thread events and the second one for
+    // showing the queued events.
+    const int TID_MAIN = 1;
+    const int TID_QUEUE = 2;
+
+    wxString trace;
+    trace.reserve(100*(data.trace.size() + data.stalls.size()));
+
+    trace << "{\"traceEvents\":[\n";
+
+    const auto addMetadata = [&](const char* name, int tid, const wxString& value)
+    {
+        trace << wxString::Format("{\"name\":\"%s\",\"ph\":\"M\","
+                                  "\"pid\":%lu,\"tid\":%d,"
+                                  "\"args\":{\"name\":%s}},\n",
+                                  name, pid, tid, QuoteJSON(value));
+    };
+
+    addMetadata("process_name", TID_MAIN,
+                wxTheApp ? wxTheApp->GetAppName() : wxString("wxWidgets"));
+    addMetadata("thread_name", TID_MAIN, "Main thread");
+    addMetadata("thread_name", TID_QUEUE, "Event queue");
+
+    unsigned long queueId = 0;
+    for ( const TraceEntry& e : data.trace )
+    {
+        switch ( e.kind )
+        {
+            case TraceKind::Dispatch:
+                trace << wxString::Format
+                         (
+                            "{\"name\":%s,\"cat\":\"dispatch\",\"ph\":\"X\","
+                            "\"ts\":%" wxLongLongFmtSpec "d,\"dur\":%" wxLongLongFmtSpec "d,\"pid\":%lu,\"tid\":%d},\n",
+                            QuoteJSON(GetEventName(e.eventClass, e.eventType)),
+                            e.startTime, e.duration, pid, TID_MAIN
+                         );
+                break;
+
+            case TraceKind::Handler:
+                trace << wxString::Format
+                         (
+                            "{\"name\":%s,\"cat\":\"handler\",\"ph\":\"X\","
+                            "\"ts\":%" wxLongLongFmtSpec "d,\"dur\":%" wxLongLongFmtSpec "d,\"pid\":%lu,\"tid\":%d,"
+                            "\"args\":{\"event\":%s}},\n",
+                            QuoteJSON(e.handlerClass),
+                            e.startTime, e.duration, pid, TID_MAIN,
+                            QuoteJSON(GetEventName(e.eventClass, e.eventType))
+                         );
+                break;
+
+            case TraceKind::Idle:
+                trace << wxString::Format
+                         (
+                            "{\"name\":\"Idle\",\"cat\":\"idle\",\"ph\":\"X\","
+                            "\"ts\":%" wxLongLongFmtSpec "d,\"dur\":%" wxLongLongFmtSpec "d,\"pid\":%lu,\"tid\":%d},\n",
+                            e.startTime, e.duration, pid, TID_MAIN
+                         );
+                break;
+
+            case TraceKind::QueueWait:
+                // The waits of different events overlap, so use async events
+                // for them as the complete ones must be properly nested.
+                queueId++;
+                for ( const auto phase : { 'b', 'e' } )
+                {
+                    trace << wxString::Format
+                             (
+                                "{\"name\":%s,\"cat\":\"queue\",\"ph\":\"%c\","
+                                "\"id\":%lu,\"ts\":%" wxLongLongFmtSpec "d,\"pid\":%lu,\"tid\":%d},\n",
+                                QuoteJSON(GetEventName(e.eventClass, e.eventType)),
+                                phase, queueId,
+                                phase == 'b' ? e.startTime
+                                             : e.startTime + e.duration,
+                                pid, TID_QUEUE
+                             );
+                }
+                break;
+        }
+    }
+
+    for ( const Stall& s : data.stalls )
+    {
+        trace << wxString::Format
+                 (
+                    "{\"name\":%s,\"cat\":\"stall\",\"ph\":\"i\",\"s\":\"t\","
+                    "\"ts\":%" wxLongLongFmtSpec "d,\"pid\":%lu,\"tid\":%d,"
+                    "\"args\":{\"event\":%s,\"duration\":%" wxLongLongFmtSpec "d,\"backtrace\":%s}},\n",
+                    QuoteJSON("Stall in " + s.handlerClass),
+                    s.startTime + s.duration, pid, TID_MAIN,
+                    QuoteJSON(GetEventName(s.eventClass, s.eventType)),
+                    s.duration,
+                    QuoteJSON(s.backtrace)
+                 );
+    }
+
+    // Remove the trailing comma, which is not allowed in JSON, if we have it
+    // (we always do, because of the metadata events).
+    if ( trace.EndsWith(",\n") )
+        trace.RemoveLast(2);
+
+    trace << "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+    return trace;
+}
+
+/* static */
+bool wxEventProfiler::SaveChromeTrace(const wxString& filename)
+{
+    wxFFile file(filename, "w");
+    if ( !file.IsOpened() )
+        return false;
+
+    return file.Write(GetChromeTrace(), wxConvUTF8) && file.Close();
+}
+
+/* static */
+wxLongLong_t wxEventProfiler::GetTime()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>
+           (
+                Clock::now() - GetTimeOrigin()
+           ).count();
+}
+
+/* static */
+wxLongLong_t wxEventProfiler::DoStartTiming()
+{
+    return wxIsMainThread() ? GetTime() : -1;
+}
+
+/* static */
+void wxEventProfiler::OnDispatchEnd(const wxEvent& event, wxLongLong_t start)
+{
+    if ( !IsRunning() )
+        return;
+
+    const wxLongLong_t duration = GetTime() - start;
+
+    ProfilerData& data = GetData();
+
+    const wxChar* const eventClass = event.GetClassInfo()->GetClassName();
+    data.dispatch[event.GetEventType()].Add(eventClass, duration);
+    data.AddTrace(TraceKind::Dispatch, &event, nullptr, start, duration);
+}
+
+/* static */
+void wxEventProfiler::OnHandlerEnd(const wxEvent& event,
+                                   const wxChar* handlerClass,
+                                   wxLongLong_t start)
+{
+    if ( !IsRunning() )
+        return;
+
+    const wxLongLong_t duration = GetTime() - start;
+
+    ProfilerData& data = GetData();
+
+    const wxChar* const eventClass = event.GetClassInfo()->GetClassName();
+    data.handlers[std::make_pair(event.GetEventType(), handlerClass)]
+        .Add(eventClass, duration);
+    data.AddTrace(TraceKind::Handler, &event, handlerClass, start, duration);
+
+    // Check for the stalls, but only report the innermost handler taking too
+    // long and not all the ones calling it too.
+    if ( data.stallThreshold > 0 &&
+            duration >= data.stallThreshold*1000 &&
+                data.lastStallStart < start )
+    {
+        data.lastStallStart = start;
+
+        Stall stall;
+        stall.eventType = event.GetEventType();
+        stall.eventClass = eventClass;
+        stall.handlerClass = handlerClass;
+        stall.startTime = start;
+        stall.duration = duration;
+
+#if wxUSE_STACKWALKER
+        // Note that wxStackWalker can only walk the stack of the current
+        // thread, so the best we can do is to record the stack of the point
+        // where the handler was called from: as the handler has already
+        // returned, we can't know what exactly it was doing.
+        StallStackWalker walker;
+        walker.Walk(2);
+        stall.backtrace = walker.GetBacktrace();
+#endif // wxUSE_STACKWALKER
+
+        data.stalls.push_back(stall);
+    }
+}
+
+/* static */
+void wxEventProfiler::OnIdleEnd(wxLongLong_t start)
+{
+    if ( !IsRunning() )
+        return;
+
+    const wxLongLong_t duration = GetTime() - start;
+
+    ProfilerData& data = GetData();
+
+    data.idle.Add(nullptr, duration);
+    data.AddTrace(TraceKind::Idle, nullptr, nullptr, start, duration);
+}
+
+/* static */
+void wxEventProfiler::OnQueueWaitEnd(const wxEvent& event, wxLongLong_t queued)
+{
+    const wxLongLong_t now = StartTiming();
+    if ( now == -1 )
+        return;
+
+    const wxLongLong_t duration = now - queued;
+
+    ProfilerData& data = GetData();
+
+    const wxChar* const eventClass = event.GetClassInfo()->GetClassName();
+    data.queueWait[event.GetEventType()].Add(eventClass, duration);
+    data.AddTrace(TraceKind::QueueWait, &event, nullptr, queued, duration);
+}
@@ -28,8 +28,12 @@
 #include "wx/private/selectdispatcher.h"
 #ifdef __UNIX__
     #include "wx/unix/private/epolldispatcher.h"
+    #include "wx/unix/private/iouringdispatcher.h"
 #endif
 
+#include <errno.h>
+#include <unistd.h>
+
 static
 wxFDIODispatcher *gs_dispatcher = nullptr;
 
@@ -46,6 +50,13 @@ wxFDIODispatcher *wxFDIODispatcher::Get()
 {
     if ( !gs_dispatcher )
     {
+        // io_uring can be unavailable at run-time even if it's supported by
+        // the headers we were compiled with, so fall back to the other
+        // dispatchers if we fail to create it
+#if wxUSE_IOURING_DISPATCHER
+        gs_dispatcher = wxIOUringDispatcher::Create();
+        if ( !gs_dispatcher )
+#endif // wxUSE_IOURING_DISPATCHER
 #if wxUSE_EPOLL_DISPATCHER
         gs_dispatcher = wxEpollDispatcher::Create();
         if ( !gs_dispatcher )
@@ -67,6 +78,43 @@ void wxFDIODispatcher::DispatchPending()
         gs_dispatcher->Dispatch(0);
 }
 
+/* static */
+bool
+wxFDIODispatcher::DrainFD(int fd,
+                          const std::function<void (const char *, size_t)>& consume)
+{
+    char buf[4096];
+    for ( ;; )
+    {
+        const ssize_t size = read(fd, buf, sizeof(buf));
+        if ( size > 0 )
+        {
+            consume(buf, size);
+            continue;
+        }
+
+        if ( size == 0 )
+        {
+            errno = 0;
+            return false;
+        }
+
+        switch ( errno )
+        {
+            case EINTR:
+                continue;
+
+            case EAGAIN:
+#if defined(EWOULDBLOCK) && EWOULDBLOCK != EAGAIN
+            case EWOULDBLOCK:
+#endif
+                return true;
+        }
+
+        return false;
+    }
+}
+
 // ----------------------------------------------------------------------------
 // wxMappedFDIODispatcher
 // ----------------------------------------------------------------------------
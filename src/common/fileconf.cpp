@@ -41,6 +41,13 @@
 
 #include  "wx/stdpaths.h"
 
+#include "wx/private/hashnocase.h"
+
+#if wxUSE_THREADS
+    #include "wx/thread.h"
+    #include "wx/threadpool.h"
+#endif // wxUSE_THREADS
+
 #if defined(__WINDOWS__)
     #include "wx/msw/private.h"
 #endif  //windows.h
@@ -48,6 +55,10 @@
 #include  <stdlib.h>
 #include  <ctype.h>
 
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
 // ----------------------------------------------------------------------------
 // constants
 // ----------------------------------------------------------------------------
@@ -59,8 +70,8 @@
 // ----------------------------------------------------------------------------
 
 // compare functions for sorting the arrays
-static int LINKAGEMODE CompareEntries(wxFileConfigEntry *p1, wxFileConfigEntry *p2);
-static int LINKAGEMODE CompareGroups(wxFileConfigGroup *p1, wxFileConfigGroup *p2);
+static bool CompareEntries(wxFileConfigEntry *p1, wxFileConfigEntry *p2);
+static bool CompareGroups(wxFileConfigGroup *p1, wxFileConfigGroup *p2);
 
 // filter strings
 static wxString FilterInValue(const wxString& str);
@@ -69,24 +80,86 @@ static wxString FilterOutValue(const wxString& str);
 static wxString FilterInEntryName(const wxString& str);
 static wxString FilterOutEntryName(const wxString& str);
 
+// write the given text to the file, atomically replacing its contents
+static bool WriteConfigFile(const wxFileName& fn,
+                            const wxString& text,
+                            const wxMBConv& conv,
+                            int umask);
+
 // ============================================================================
 // private classes
 // ============================================================================
 
 // ----------------------------------------------------------------------------
-// "template" array types
+// container types
 // ----------------------------------------------------------------------------
 
-#ifdef WXMAKINGDLL_BASE
-    WX_DEFINE_SORTED_USER_EXPORTED_ARRAY(wxFileConfigEntry *, ArrayEntries,
-                                         WXDLLIMPEXP_BASE);
-    WX_DEFINE_SORTED_USER_EXPORTED_ARRAY(wxFileConfigGroup *, ArrayGroups,
-                                         WXDLLIMPEXP_BASE);
+// The entries and subgroups of each group are stored in arrays, which are
+// sorted by name only when they're enumerated, as keeping them sorted all the
+// time would make adding many elements to them too slow, and indexed by name
+// using hash maps for fast lookup.
+typedef std::vector<wxFileConfigEntry *> ArrayEntries;
+typedef std::vector<wxFileConfigGroup *> ArrayGroups;
+
+#if wxCONFIG_CASE_SENSITIVE
+    typedef std::unordered_map<wxString, wxFileConfigEntry *> MapEntries;
+    typedef std::unordered_map<wxString, wxFileConfigGroup *> MapGroups;
 #else
-    WX_DEFINE_SORTED_ARRAY(wxFileConfigEntry *, ArrayEntries);
-    WX_DEFINE_SORTED_ARRAY(wxFileConfigGroup *, ArrayGroups);
+    typedef wxStringNoCaseHashMap<wxFileConfigEntry *> MapEntries;
+    typedef wxStringNoCaseHashMap<wxFileConfigGroup *> MapGroups;
 #endif
 
+// ----------------------------------------------------------------------------
+// wxFileConfigWriter: writes the file in the background in write-behind mode
+// ----------------------------------------------------------------------------
+
+#if wxUSE_THREADS
+
+// This object is shared between wxFileConfig and the tasks submitted to the
+// thread pool, so that it remains alive even if wxFileConfig is destroyed
+// before a task, which has nothing to do any more by then, gets to run.
+class wxFileConfigWriter : public std::enable_shared_from_this<wxFileConfigWriter>
+{
+public:
+    wxFileConfigWriter(const wxFileName& fn, const wxMBConv& conv)
+        : m_fn(fn),
+          m_conv(conv.Clone()),
+          m_cond(m_mutex)
+    {
+    }
+
+    // Replace the text to write, if any, with the given one and make sure it
+    // is going to be written soon using the specified umask.
+    void Schedule(wxString&& text, int umask);
+
+    // Write the pending text, if any, in the current thread and wait until
+    // any write being done by the background thread finishes.
+    bool Sync();
+
+private:
+    // Write the pending text until there is none left, must be called with
+    // the mutex locked and does nothing if another thread is already writing.
+    void DoWritePending();
+
+    const wxFileName m_fn;
+    const std::unique_ptr<wxMBConv> m_conv;
+
+    // All the fields below are protected by this mutex.
+    wxMutex m_mutex;
+    wxCondition m_cond;
+
+    wxString m_text;
+    int m_umask = -1;
+    bool m_pending = false,     // if true, m_text must be written
+         m_writing = false,     // if true, some thread is writing the file
+         m_queued = false,      // if true, a task was submitted but not run
+         m_ok = true;           // false if any write failed
+
+    wxDECLARE_NO_COPY_CLASS(wxFileConfigWriter);
+};
+
+#endif // wxUSE_THREADS
+
 // ----------------------------------------------------------------------------
 // wxFileConfigLineList
 // ----------------------------------------------------------------------------
@@ -153,8 +226,8 @@ public:
   wxFileConfigLineList *
                   GetLine()     const { return m_pLine;      }
 
-  // modify entry attributes
-  void SetValue(const wxString& strValue, bool bUser = true);
+  // modify entry attributes, SetValue() returns true if the value changed
+  bool SetValue(const wxString& strValue, bool bUser = true);
   void SetLine(wxFileConfigLineList *pLine);
 
     wxDECLARE_NO_COPY_CLASS(wxFileConfigEntry);
@@ -169,8 +242,12 @@ class wxFileConfigGroup
 private:
   wxFileConfig *m_pConfig;          // config object we belong to
   wxFileConfigGroup  *m_pParent;    // parent group (nullptr for root group)
-  ArrayEntries  m_aEntries;         // entries in this group
-  ArrayGroups   m_aSubgroups;       // subgroups
+  mutable ArrayEntries m_aEntries;  // entries in this group
+  mutable ArrayGroups m_aSubgroups; // subgroups
+  MapEntries    m_mapEntries;       // the same entries indexed by name
+  MapGroups     m_mapSubgroups;     // and subgroups
+  mutable bool  m_entriesSorted:1,  // true if the arrays above are sorted
+                m_subgroupsSorted:1;
   wxString      m_strName;          // group's name
   wxFileConfigLineList *m_pLine;    // pointer to our line in the linked list
   wxFileConfigEntry *m_pLastEntry;  // last entry/subgroup of this group in the
@@ -182,6 +259,10 @@ private:
   // used by Rename()
   void UpdateGroupAndSubgroupsLines();
 
+  // remove the entry/subgroup from both the array and the map
+  void RemoveEntry(wxFileConfigEntry *pEntry);
+  void RemoveSubgroup(wxFileConfigGroup *pGroup);
+
 public:
   // ctor
   wxFileConfigGroup(wxFileConfigGroup *pParent, const wxString& strName, wxFileConfig *);
@@ -194,9 +275,10 @@ public:
   wxFileConfigGroup    *Parent()  const { return m_pParent; }
   wxFileConfig   *Config()  const { return m_pConfig; }
 
-  const ArrayEntries& Entries() const { return m_aEntries;   }
-  const ArrayGroups&  Groups()  const { return m_aSubgroups; }
-  bool  IsEmpty() const { return Entries().IsEmpty() && Groups().IsEmpty(); }
+  // these accessors return the sorted arrays of entries and subgroups
+  const ArrayEntries& Entries() const;
+  const ArrayGroups&  Groups()  const;
+  bool  IsEmpty() const { return m_aEntries.empty() && m_aSubgroups.empty(); }
 
   // find entry/subgroup (nullptr if not found)
   wxFileConfigGroup *FindSubgroup(const wxString& name) const;
@@ -651,6 +733,12 @@ wxFileConfig::~wxFileConfig()
     if ( m_autosave )
         Flush();
 
+#if wxUSE_THREADS
+    // don't leave any pending writes when the object is destroyed
+    if ( m_writer )
+        m_writer->Sync();
+#endif // wxUSE_THREADS
+
     CleanUp();
 
     delete m_conv;
@@ -833,6 +921,47 @@ wxFileConfig::DoSetPath(const wxString& strPath, bool createMissingComponents)
         return true;
     }
 
+    // Handle the most common case of an absolute path without any special
+    // components, as used by wxConfigPathChanger for every full key, without
+    // splitting it into an array: this is much faster, and doing it matters
+    // as this function is called twice for every access to such keys.
+    if ( strPath.length() > 1 && strPath[0] == wxCONFIG_PATH_SEPARATOR &&
+            strPath.Last() != wxCONFIG_PATH_SEPARATOR &&
+                strPath.find(wxT("/.")) == wxString::npos &&
+                    strPath.find(wxT("//")) == wxString::npos )
+    {
+        m_pCurrentGroup = m_pRootGroup;
+
+        size_t start = 1;
+        for ( ;; ) {
+            const size_t end = strPath.find(wxCONFIG_PATH_SEPARATOR, start);
+            const wxString part(strPath, start,
+                                end == wxString::npos ? wxString::npos
+                                                      : end - start);
+
+            wxFileConfigGroup *pNextGroup = m_pCurrentGroup->FindSubgroup(part);
+            if ( pNextGroup == nullptr )
+            {
+                if ( !createMissingComponents )
+                    return false;
+
+                pNextGroup = m_pCurrentGroup->AddSubgroup(part);
+            }
+
+            m_pCurrentGroup = pNextGroup;
+
+            if ( end == wxString::npos )
+                break;
+
+            start = end + 1;
+        }
+
+        // the path is already in the canonical form, so use it as is
+        m_strPath = strPath;
+
+        return true;
+    }
+
     if ( strPath[0] == wxCONFIG_PATH_SEPARATOR ) {
         // absolute path
         wxSplitPath(aParts, strPath);
@@ -891,7 +1020,7 @@ bool wxFileConfig::GetFirstGroup(wxString& str, long& lIndex) const
 
 bool wxFileConfig::GetNextGroup (wxString& str, long& lIndex) const
 {
-    if ( size_t(lIndex) < m_pCurrentGroup->Groups().GetCount() ) {
+    if ( size_t(lIndex) < m_pCurrentGroup->Groups().size() ) {
         str = m_pCurrentGroup->Groups()[(size_t)lIndex++]->Name();
         return true;
     }
@@ -907,7 +1036,7 @@ bool wxFileConfig::GetFirstEntry(wxString& str, long& lIndex) const
 
 bool wxFileConfig::GetNextEntry (wxString& str, long& lIndex) const
 {
-    if ( size_t(lIndex) < m_pCurrentGroup->Entries().GetCount() ) {
+    if ( size_t(lIndex) < m_pCurrentGroup->Entries().size() ) {
         str = m_pCurrentGroup->Entries()[(size_t)lIndex++]->Name();
         return true;
     }
@@ -917,12 +1046,12 @@ bool wxFileConfig::GetNextEntry (wxString& str, long& lIndex) const
 
 size_t wxFileConfig::GetNumberOfEntries(bool bRecursive) const
 {
-    size_t n = m_pCurrentGroup->Entries().GetCount();
+    size_t n = m_pCurrentGroup->Entries().size();
     if ( bRecursive ) {
         wxFileConfig * const self = const_cast<wxFileConfig *>(this);
 
         wxFileConfigGroup *pOldCurrentGroup = m_pCurrentGroup;
-        size_t nSubgroups = m_pCurrentGroup->Groups().GetCount();
+        size_t nSubgroups = m_pCurrentGroup->Groups().size();
         for ( size_t nGroup = 0; nGroup < nSubgroups; nGroup++ ) {
             self->m_pCurrentGroup = m_pCurrentGroup->Groups()[nGroup];
             n += GetNumberOfEntries(true);
@@ -935,12 +1064,12 @@ size_t wxFileConfig::GetNumberOfEntries(bool bRecursive) const
 
 size_t wxFileConfig::GetNumberOfGroups(bool bRecursive) const
 {
-    size_t n = m_pCurrentGroup->Groups().GetCount();
+    size_t n = m_pCurrentGroup->Groups().size();
     if ( bRecursive ) {
         wxFileConfig * const self = const_cast<wxFileConfig *>(this);
 
         wxFileConfigGroup *pOldCurrentGroup = m_pCurrentGroup;
-        size_t nSubgroups = m_pCurrentGroup->Groups().GetCount();
+        size_t nSubgroups = m_pCurrentGroup->Groups().size();
         for ( size_t nGroup = 0; nGroup < nSubgroups; nGroup++ ) {
             self->m_pCurrentGroup = m_pCurrentGroup->Groups()[nGroup];
             n += GetNumberOfGroups(true);
@@ -1111,9 +1240,11 @@ bool wxFileConfig::DoWriteString(const wxString& key, const wxString& szValue)
         wxLogTrace( FILECONF_TRACE_MASK,
                     wxT("  Setting value %s"),
                     szValue );
-        pEntry->SetValue(szValue);
 
-        SetDirty();
+        // don't mark the file as dirty, which would result in rewriting it
+        // when flushing, if the value didn't really change
+        if ( pEntry->SetValue(szValue) )
+            SetDirty();
     }
 
     return true;
@@ -1138,32 +1269,6 @@ bool wxFileConfig::Flush(bool /* bCurrentOnly */)
   if ( !IsDirty() || !m_fnLocalFile.GetFullPath() )
     return true;
 
-  // Create the directory containing the file if it doesn't exist. Although we
-  // don't always use XDG, it seems sensible to follow the XDG specification
-  // and create it with permissions 700 if it doesn't exist.
-  const wxString& outPath = m_fnLocalFile.GetPath();
-  if ( !wxFileName::DirExists(outPath) )
-  {
-      if ( !wxFileName::Mkdir(outPath,
-                              wxS_IRUSR | wxS_IWUSR | wxS_IXUSR,
-                              wxPATH_MKDIR_FULL) )
-      {
-          wxLogWarning(_("Failed to create configuration file directory."));
-          return false;
-      }
-  }
-
-  // set the umask if needed
-  wxCHANGE_UMASK(m_umask);
-
-  wxTempFile file(m_fnLocalFile.GetFullPath());
-
-  if ( !file.IsOpened() )
-  {
-    wxLogError(_("can't open user configuration file."));
-    return false;
-  }
-
   // write all strings to file
   wxString filetext;
   filetext.reserve(4096);
@@ -1172,24 +1277,53 @@ bool wxFileConfig::Flush(bool /* bCurrentOnly */)
     filetext << p->Text() << wxTextFile::GetEOL();
   }
 
-  if ( !file.Write(filetext, *m_conv) )
-  {
-    wxLogError(_("can't write user configuration file."));
-    return false;
-  }
+#ifdef __UNIX__
+  const int umask = m_umask;
+#else
+  const int umask = -1;
+#endif
 
-  if ( !file.Commit() )
+#if wxUSE_THREADS
+  if ( m_writer )
   {
-      wxLogError(_("Failed to update user configuration file."));
-
-      return false;
+    // errors will be reported by Sync()
+    m_writer->Schedule(std::move(filetext), umask);
+    ResetDirty();
+    return true;
   }
+#endif // wxUSE_THREADS
+
+  if ( !WriteConfigFile(m_fnLocalFile, filetext, *m_conv, umask) )
+    return false;
 
   ResetDirty();
 
   return true;
 }
 
+#if wxUSE_THREADS
+
+void wxFileConfig::EnableWriteBehind(bool enable)
+{
+  if ( enable )
+  {
+    if ( !m_writer )
+      m_writer = std::make_shared<wxFileConfigWriter>(m_fnLocalFile, *m_conv);
+  }
+  else if ( m_writer )
+  {
+    m_writer->Sync();
+    m_writer.reset();
+  }
+}
+
+bool wxFileConfig::Sync()
+{
+  return m_writer ? m_writer->Sync() : true;
+}
+
+#endif // wxUSE_THREADS
+
 #if wxUSE_STREAMS
 
 bool wxFileConfig::Save(wxOutputStream& os, const wxMBConv& conv)
@@ -1308,6 +1442,12 @@ bool wxFileConfig::DeleteGroup(const wxString& key)
 
 bool wxFileConfig::DeleteAll()
 {
+#if wxUSE_THREADS
+  // a pending write would recreate the file after we delete it
+  if ( m_writer )
+    m_writer->Sync();
+#endif // wxUSE_THREADS
+
   CleanUp();
 
   if ( m_fnLocalFile.IsOk() )
@@ -1337,14 +1477,6 @@ wxFileConfigLineList *wxFileConfig::LineListAppend(const wxString& str)
     wxLogTrace( FILECONF_TRACE_MASK,
                 wxT("    ** Adding Line '%s'"),
                 str );
-    wxLogTrace( FILECONF_TRACE_MASK,
-                wxT("        head: %s"),
-                ((m_linesHead) ? m_linesHead->Text()
-                               : wxString()) );
-    wxLogTrace( FILECONF_TRACE_MASK,
-                wxT("        tail: %s"),
-                ((m_linesTail) ? m_linesTail->Text()
-                               : wxString()) );
 
     wxFileConfigLineList *pLine = new wxFileConfigLineList(str);
 
@@ -1362,15 +1494,6 @@ wxFileConfigLineList *wxFileConfig::LineListAppend(const wxString& str)
 
     m_linesTail = pLine;
 
-    wxLogTrace( FILECONF_TRACE_MASK,
-                wxT("        head: %s"),
-                ((m_linesHead) ? m_linesHead->Text()
-                               : wxString()) );
-    wxLogTrace( FILECONF_TRACE_MASK,
-                wxT("        tail: %s"),
-                ((m_linesTail) ? m_linesTail->Text()
-                               : wxString()) );
-
     return m_linesTail;
 }
 
@@ -1383,14 +1506,6 @@ wxFileConfigLineList *wxFileConfig::LineListInsert(const wxString& str,
                 str,
                 ((pLine) ? pLine->Text()
                          : wxString()) );
-    wxLogTrace( FILECONF_TRACE_MASK,
-                wxT("        head: %s"),
-                ((m_linesHead) ? m_linesHead->Text()
-                               : wxString()) );
-    wxLogTrace( FILECONF_TRACE_MASK,
-                wxT("        tail: %s"),
-                ((m_linesTail) ? m_linesTail->Text()
-                               : wxString()) );
 
     if ( pLine == m_linesTail )
         return LineListAppend(str);
@@ -1413,15 +1528,6 @@ wxFileConfigLineList *wxFileConfig::LineListInsert(const wxString& str,
         pLine->SetNext(pNewLine);
     }
 
-    wxLogTrace( FILECONF_TRACE_MASK,
-                wxT("        head: %s"),
-                ((m_linesHead) ? m_linesHead->Text()
-                               : wxString()) );
-    wxLogTrace( FILECONF_TRACE_MASK,
-                wxT("        tail: %s"),
-                ((m_linesTail) ? m_linesTail->Text()
-                               : wxString()) );
-
     return pNewLine;
 }
 
@@ -1430,14 +1536,6 @@ void wxFileConfig::LineListRemove(wxFileConfigLineList *pLine)
     wxLogTrace( FILECONF_TRACE_MASK,
                 wxT("    ** Removing Line '%s'"),
                 pLine->Text() );
-    wxLogTrace( FILECONF_TRACE_MASK,
-                wxT("        head: %s"),
-                ((m_linesHead) ? m_linesHead->Text()
-                               : wxString()) );
-    wxLogTrace( FILECONF_TRACE_MASK,
-                wxT("        tail: %s"),
-                ((m_linesTail) ? m_linesTail->Text()
-                               : wxString()) );
 
     wxFileConfigLineList    *pPrev = pLine->Prev(),
                             *pNext = pLine->Next();
@@ -1456,15 +1554,6 @@ void wxFileConfig::LineListRemove(wxFileConfigLineList *pLine)
     else
         pNext->SetPrev(pPrev);
 
-    wxLogTrace( FILECONF_TRACE_MASK,
-                wxT("        head: %s"),
-                ((m_linesHead) ? m_linesHead->Text()
-                               : wxString()) );
-    wxLogTrace( FILECONF_TRACE_MASK,
-                wxT("        tail: %s"),
-                ((m_linesTail) ? m_linesTail->Text()
-                               : wxString()) );
-
     delete pLine;
 }
 
@@ -1485,10 +1574,11 @@ bool wxFileConfig::LineListIsEmpty()
 wxFileConfigGroup::wxFileConfigGroup(wxFileConfigGroup *pParent,
                                        const wxString& strName,
                                        wxFileConfig *pConfig)
-                         : m_aEntries(CompareEntries),
-                           m_aSubgroups(CompareGroups),
-                           m_strName(strName)
+                         : m_strName(strName)
 {
+  m_entriesSorted =
+  m_subgroupsSorted = true;
+
   m_pConfig = pConfig;
   m_pParent = pParent;
   m_pLine   = nullptr;
@@ -1501,16 +1591,61 @@ wxFileConfigGroup::wxFileConfigGroup(wxFileConfigGroup *pParent,
 wxFileConfigGroup::~wxFileConfigGroup()
 {
   // entries
-  size_t n, nCount = m_aEntries.GetCount();
+  size_t n, nCount = m_aEntries.size();
   for ( n = 0; n < nCount; n++ )
     delete m_aEntries[n];
 
   // subgroups
-  nCount = m_aSubgroups.GetCount();
+  nCount = m_aSubgroups.size();
   for ( n = 0; n < nCount; n++ )
     delete m_aSubgroups[n];
 }
 
+// ----------------------------------------------------------------------------
+// entries and subgroups arrays
+// ----------------------------------------------------------------------------
+
+const ArrayEntries& wxFileConfigGroup::Entries() const
+{
+  if ( !m_entriesSorted ) {
+    std::sort(m_aEntries.begin(), m_aEntries.end(), CompareEntries);
+    m_entriesSorted = true;
+  }
+
+  return m_aEntries;
+}
+
+const ArrayGroups& wxFileConfigGroup::Groups() const
+{
+  if ( !m_subgroupsSorted ) {
+    std::sort(m_aSubgroups.begin(), m_aSubgroups.end(), CompareGroups);
+    m_subgroupsSorted = true;
+  }
+
+  return m_aSubgroups;
+}
+
+void wxFileConfigGroup::RemoveEntry(wxFileConfigEntry *pEntry)
+{
+  m_mapEntries.erase(pEntry->Name());
+
+  // removing an element doesn't change the order of the remaining ones
+  const ArrayEntries::iterator it =
+    std::find(m_aEntries.begin(), m_aEntries.end(), pEntry);
+  wxCHECK_RET( it != m_aEntries.end(), wxT("entry not found") );
+  m_aEntries.erase(it);
+}
+
+void wxFileConfigGroup::RemoveSubgroup(wxFileConfigGroup *pGroup)
+{
+  m_mapSubgroups.erase(pGroup->Name());
+
+  const ArrayGroups::iterator it =
+    std::find(m_aSubgroups.begin(), m_aSubgroups.end(), pGroup);
+  wxCHECK_RET( it != m_aSubgroups.end(), wxT("subgroup not found") );
+  m_aSubgroups.erase(it);
+}
+
 // ----------------------------------------------------------------------------
 // line
 // ----------------------------------------------------------------------------
@@ -1669,7 +1804,7 @@ void wxFileConfigGroup::UpdateGroupAndSubgroupsLines()
 
 
     // also update all subgroups as they have this groups name in their lines
-    const size_t nCount = m_aSubgroups.GetCount();
+    const size_t nCount = m_aSubgroups.size();
     for ( size_t n = 0; n < nCount; n++ )
     {
         m_aSubgroups[n]->UpdateGroupAndSubgroupsLines();
@@ -1683,13 +1818,14 @@ void wxFileConfigGroup::Rename(const wxString& newName)
     if ( newName == m_strName )
         return;
 
-    // we need to remove the group from the parent and it back under the new
-    // name to keep the parents array of subgroups alphabetically sorted
-    m_pParent->m_aSubgroups.Remove(this);
+    // we need to index the group by its new name in the parent and to sort
+    // the parent subgroups again when they're used the next time
+    m_pParent->m_mapSubgroups.erase(m_strName);
 
     m_strName = newName;
 
-    m_pParent->m_aSubgroups.Add(this);
+    m_pParent->m_mapSubgroups[m_strName] = this;
+    m_pParent->m_subgroupsSorted = false;
 
     // update the group lines recursively
     UpdateGroupAndSubgroupsLines();
@@ -1708,67 +1844,20 @@ wxString wxFileConfigGroup::GetFullName() const
 // find an item
 // ----------------------------------------------------------------------------
 
-// use binary search because the array is sorted
 wxFileConfigEntry *
 wxFileConfigGroup::FindEntry(const wxString& name) const
 {
-  size_t
-       lo = 0,
-       hi = m_aEntries.GetCount();
-  wxFileConfigEntry *pEntry;
-
-  while ( lo < hi ) {
-    size_t i;
-    i = (lo + hi)/2;
-    pEntry = m_aEntries[i];
-
-    int res;
-    #if wxCONFIG_CASE_SENSITIVE
-      res = pEntry->Name().compare(name);
-    #else
-      res = pEntry->Name().CmpNoCase(name);
-    #endif
-
-    if ( res > 0 )
-      hi = i;
-    else if ( res < 0 )
-      lo = i + 1;
-    else
-      return pEntry;
-  }
+  const MapEntries::const_iterator it = m_mapEntries.find(name);
 
-  return nullptr;
+  return it == m_mapEntries.end() ? nullptr : it->second;
 }
 
 wxFileConfigGroup *
 wxFileConfigGroup::FindSubgroup(const wxString& name) const
 {
-  size_t
-       lo = 0,
-       hi = m_aSubgroups.GetCount();
-  wxFileConfigGroup *pGroup;
-
-  while ( lo < hi ) {
-    size_t i;
-    i = (lo + hi)/2;
-    pGroup = m_aSubgroups[i];
-
-    int res;
-    #if wxCONFIG_CASE_SENSITIVE
-      res = pGroup->Name().compare(name);
-    #else
-      res = pGroup->Name().CmpNoCase(name);
-    #endif
-
-    if ( res > 0 )
-      hi = i;
-    else if ( res < 0 )
-      lo = i + 1;
-    else
-      return pGroup;
-  }
+  const MapGroups::const_iterator it = m_mapSubgroups.find(name);
 
-  return nullptr;
+  return it == m_mapSubgroups.end() ? nullptr : it->second;
 }
 
 // ----------------------------------------------------------------------------
@@ -1782,7 +1871,15 @@ wxFileConfigEntry *wxFileConfigGroup::AddEntry(const wxString& strName, int nLin
 
     wxFileConfigEntry   *pEntry = new wxFileConfigEntry(this, strName, nLine);
 
-    m_aEntries.Add(pEntry);
+    // notice that we must use the entry name and not strName here as the
+    // former doesn't include the immutable prefix
+    m_mapEntries[pEntry->Name()] = pEntry;
+
+    if ( m_entriesSorted && !m_aEntries.empty() &&
+            !CompareEntries(m_aEntries.back(), pEntry) )
+        m_entriesSorted = false;
+
+    m_aEntries.push_back(pEntry);
     return pEntry;
 }
 
@@ -1793,7 +1890,13 @@ wxFileConfigGroup *wxFileConfigGroup::AddSubgroup(const wxString& strName)
 
     wxFileConfigGroup   *pGroup = new wxFileConfigGroup(this, strName, m_pConfig);
 
-    m_aSubgroups.Add(pGroup);
+    m_mapSubgroups[strName] = pGroup;
+
+    if ( m_subgroupsSorted && !m_aSubgroups.empty() &&
+            !CompareGroups(m_aSubgroups.back(), pGroup) )
+        m_subgroupsSorted = false;
+
+    m_aSubgroups.push_back(pGroup);
     return pGroup;
 }
 
@@ -1837,7 +1940,7 @@ bool wxFileConfigGroup::DeleteSubgroup(wxFileConfigGroup *pGroup)
                         : wxString() );
 
     // delete all entries...
-    size_t nCount = pGroup->m_aEntries.GetCount();
+    size_t nCount = pGroup->m_aEntries.size();
 
     wxLogTrace(FILECONF_TRACE_MASK,
                wxT("Removing %lu entries"), (unsigned long)nCount );
@@ -1856,14 +1959,15 @@ bool wxFileConfigGroup::DeleteSubgroup(wxFileConfigGroup *pGroup)
     }
 
     // ...and subgroups of this subgroup
-    nCount = pGroup->m_aSubgroups.GetCount();
+    nCount = pGroup->m_aSubgroups.size();
 
     wxLogTrace( FILECONF_TRACE_MASK,
                 wxT("Removing %lu subgroups"), (unsigned long)nCount );
 
-    for ( size_t nGroup = 0; nGroup < nCount; nGroup++ )
+    // delete them starting from the first one, see the comment above
+    while ( !pGroup->m_aSubgroups.empty() )
     {
-        pGroup->DeleteSubgroup(pGroup->m_aSubgroups[0]);
+        pGroup->DeleteSubgroup(pGroup->Groups()[0]);
     }
 
     // and then finally the group itself
@@ -1890,7 +1994,7 @@ bool wxFileConfigGroup::DeleteSubgroup(wxFileConfigGroup *pGroup)
             // our last entry is being deleted, so find the last one which
             // stays by going back until we find a subgroup or reach the
             // group line
-            const size_t nSubgroups = m_aSubgroups.GetCount();
+            const size_t nSubgroups = m_aSubgroups.size();
 
             m_pLastGroup = nullptr;
             for ( wxFileConfigLineList *pl = pLine->Prev();
@@ -1923,7 +2027,7 @@ bool wxFileConfigGroup::DeleteSubgroup(wxFileConfigGroup *pGroup)
                     pGroup->Name() );
     }
 
-    m_aSubgroups.Remove(pGroup);
+    RemoveSubgroup(pGroup);
     delete pGroup;
 
     return true;
@@ -1950,7 +2054,7 @@ bool wxFileConfigGroup::DeleteEntry(const wxString& name)
       wxFileConfigEntry *pNewLast = nullptr;
       const wxFileConfigLineList * const
         pNewLastLine = m_pLastEntry->GetLine()->Prev();
-      const size_t nEntries = m_aEntries.GetCount();
+      const size_t nEntries = m_aEntries.size();
       for ( size_t n = 0; n < nEntries; n++ ) {
         if ( m_aEntries[n]->GetLine() == pNewLastLine ) {
           pNewLast = m_aEntries[n];
@@ -1971,7 +2075,7 @@ bool wxFileConfigGroup::DeleteEntry(const wxString& name)
     m_pConfig->LineListRemove(pLine);
   }
 
-  m_aEntries.Remove(pEntry);
+  RemoveEntry(pEntry);
   delete pEntry;
 
   return true;
@@ -2019,19 +2123,19 @@ void wxFileConfigEntry::SetLine(wxFileConfigLineList *pLine)
 
 // second parameter is false if we read the value from file and prevents the
 // entry from being marked as 'dirty'
-void wxFileConfigEntry::SetValue(const wxString& strValue, bool bUser)
+bool wxFileConfigEntry::SetValue(const wxString& strValue, bool bUser)
 {
     if ( bUser && IsImmutable() )
     {
         wxLogWarning( _("attempt to change immutable key '%s' ignored."),
                       Name());
-        return;
+        return false;
     }
 
     // do nothing if it's the same value: but don't test for it if m_bHasValue
     // hadn't been set yet or we'd never write empty values to the file
     if ( m_bHasValue && strValue == m_strValue )
-        return;
+        return false;
 
     m_bHasValue = true;
     m_strValue = strValue;
@@ -2068,6 +2172,8 @@ void wxFileConfigEntry::SetValue(const wxString& strValue, bool bUser)
             Group()->SetLastEntry(this);
         }
     }
+
+    return true;
 }
 
 // ============================================================================
@@ -2078,21 +2184,21 @@ void wxFileConfigEntry::SetValue(const wxString& strValue, bool bUser)
 // compare functions for array sorting
 // ----------------------------------------------------------------------------
 
-int CompareEntries(wxFileConfigEntry *p1, wxFileConfigEntry *p2)
+bool CompareEntries(wxFileConfigEntry *p1, wxFileConfigEntry *p2)
 {
 #if wxCONFIG_CASE_SENSITIVE
-    return p1->Name().compare(p2->Name());
+    return p1->Name().compare(p2->Name()) < 0;
 #else
-    return p1->Name().CmpNoCase(p2->Name());
+    return p1->Name().CmpNoCase(p2->Name()) < 0;
 #endif
 }
 
-int CompareGroups(wxFileConfigGroup *p1, wxFileConfigGroup *p2)
+bool CompareGroups(wxFileConfigGroup *p1, wxFileConfigGroup *p2)
 {
 #if wxCONFIG_CASE_SENSITIVE
-    return p1->Name().compare(p2->Name());
+    return p1->Name().compare(p2->Name()) < 0;
 #else
-    return p1->Name().CmpNoCase(p2->Name());
+    return p1->Name().CmpNoCase(p2->Name()) < 0;
 #endif
 }
 
@@ -2262,4 +2368,140 @@ static wxString FilterOutEntryName(const wxString& str)
   return strResult;
 }
 
+static bool WriteConfigFile(const wxFileName& fn,
+                            const wxString& text,
+                            const wxMBConv& conv,
+                            int umask)
+{
+  // Create the directory containing the file if it doesn't exist. Although we
+  // don't always use XDG, it seems sensible to follow the XDG specification
+  // and create it with permissions 700 if it doesn't exist.
+  const wxString& outPath = fn.GetPath();
+  if ( !wxFileName::DirExists(outPath) )
+  {
+      if ( !wxFileName::Mkdir(outPath,
+                              wxS_IRUSR | wxS_IWUSR | wxS_IXUSR,
+                              wxPATH_MKDIR_FULL) )
+      {
+          wxLogWarning(_("Failed to create configuration file directory."));
+          return false;
+      }
+  }
+
+  // set the umask if needed
+  wxCHANGE_UMASK(umask);
+#ifndef __UNIX__
+  wxUnusedVar(umask);
+#endif
+
+  wxTempFile file(fn.GetFullPath());
+
+  if ( !file.IsOpened() )
+  {
+    wxLogError(_("can't open user configuration file."));
+    return false;
+  }
+
+  if ( !file.Write(text, conv) )
+  {
+    wxLogError(_("can't write user configuration file."));
+    return false;
+  }
+
+  if ( !file.Commit() )
+  {
+      wxLogError(_("Failed to update user configuration file."));
+
+      return false;
+  }
+
+  return true;
+}
+
+// ----------------------------------------------------------------------------
+// wxFileConfigWriter
+// ----------------------------------------------------------------------------
+
+#if wxUSE_THREADS
+
+void wxFileConfigWriter::Schedule(wxString&& text, int umask)
+{
+    wxMutexLocker lock(m_mutex);
+
+    // If the previous text hasn't been written yet, it doesn't need to be
+    // written at all any more.
+    m_text = std::move(text);
+    m_umask = umask;
+    m_pending = true;
+
+    // Don't submit another task if there is already one waiting to run or if
+    // the file is being written right now, as the pending text will be
+    // written by the writing thread when it's done in the latter case.
+    if ( m_queued || m_writing )
+        return;
+
+    m_queued = true;
+
+    const std::shared_ptr<wxFileConfigWriter> self = shared_from_this();
+    wxThreadPool::Get().Submit([self]()
+        {
+            wxMutexLocker lockTask(self->m_mutex);
+
+            self->m_queued = false;
+            self->DoWritePending();
+        });
+}
+
+void wxFileConfigWriter::DoWritePending()
+{
+    if ( m_writing )
+        return;
+
+    while ( m_pending )
+    {
+        const wxString text = std::move(m_text);
+        const int umask = m_umask;
+        m_text.clear();
+        m_pending = false;
+        m_writing = true;
+
+        // Don't keep the mutex locked while writing, so that Schedule() called
+        // from the main thread doesn't block.
+        m_mutex.Unlock();
+        const bool ok = WriteConfigFile(m_fn, text, *m_conv, umask);
+        m_mutex.Lock();
+
+        m_writing = false;
+        if ( !ok )
+            m_ok = false;
+    }
+
+    m_cond.Broadcast();
+}
+
+bool wxFileConfigWriter::Sync()
+{
+    wxMutexLocker lock(m_mutex);
+
+    // Write the pending text ourselves instead of waiting for the task to do
+    // it, as we could be called from a pool thread and the task might never
+    // start running then. If another thread is writing, wait for it instead.
+    for ( ;; )
+    {
+        DoWritePending();
+
+        if ( !m_writing )
+            break;
+
+        m_cond.Wait();
+    }
+
+    const bool ok = m_ok;
+    m_ok = true;
+
+    return ok;
+}
+
+#endif // wxUSE_THREADS
+
 #endif // wxUSE_CONFIG
@@ -2889,10 +2889,10 @@ bool wxFileName::GetTimes(wxDateTime *dtAccess,
 /* static */
 wxULongLong wxFileName::GetSize(const wxString &filename)
 {
+#if defined(__WIN32__)
     if (!wxFileExists(filename))
         return wxInvalidSize;
 
-#if defined(__WIN32__)
     wxFileHandle f(filename, wxFileHandle::ReadAttr);
     if (!f.IsOk())
         return wxInvalidSize;
@@ -2904,10 +2904,11 @@ wxULongLong wxFileName::GetSize(const wxString &filename)
 
     return wxULongLong(lpFileSizeHigh, ret);
 #else // ! __WIN32__
-    wxStructStat st;
-    if (wxStat( filename, &st) != 0)
+    // use a single stat() call instead of calling wxFileExists() first
+    const wxFileStat st(filename);
+    if ( !st.IsOk() || !st.IsFile() )
         return wxInvalidSize;
-    return wxULongLong(st.st_size);
+    return st.GetSize();
 #endif
 }
 
@@ -2978,3 +2979,129 @@ wxString wxFileName::GetHumanReadableSize(const wxString& failmsg,
 
 #endif // wxUSE_LONGLONG
 
+
+// ----------------------------------------------------------------------------
+// wxFileStat
+// ----------------------------------------------------------------------------
+
+void wxFileStat::Init()
+{
+    m_ok = false;
+    m_isSymLink = false;
+    m_mode = 0;
+    m_size = 0;
+    m_accessTime =
+    m_modificationTime =
+    m_creationTime = 0;
+}
+
+bool wxFileStat::Update(const wxString& path, int flags)
+{
+    Init();
+
+    wxStructStat st;
+
+#ifdef wxHAVE_LSTAT
+    // always use lstat() first to find out whether the path is a symlink, and
+    // only call stat() if it is and if we need to follow it, which means that
+    // a single system call is needed for anything but the symlinks
+    if ( !DoStatAny(st, path, false) )
+        return false;
+
+    const bool isSymLink = S_ISLNK(st.st_mode);
+    if ( isSymLink && !(flags & wxFILE_EXISTS_NO_FOLLOW) )
+    {
+        // a dangling symlink doesn't exist when following it
+        if ( !DoStatAny(st, path, true) )
+            return false;
+    }
+
+    SetFromStat(st, isSymLink);
+#else // !wxHAVE_LSTAT
+    wxUnusedVar(flags);
+
+    wxString strPath(path);
+#ifdef __WINDOWS__
+    RemoveTrailingSeparatorsFromPath(strPath);
+#endif // __WINDOWS__
+
+    if ( wxStat(strPath, &st) != 0 )
+        return false;
+
+    SetFromStat(st);
+#endif // wxHAVE_LSTAT/!wxHAVE_LSTAT
+
+    return true;
+}
+
+void wxFileStat::SetFromStat(const wxStructStat& st, bool isSymLink)
+{
+    m_ok = true;
+    m_isSymLink = isSymLink;
+    m_mode = st.st_mode;
+    m_size = st.st_size;
+
+    // Android defines st_*time fields as unsigned long, but time_t as long,
+    // hence the static_casts.
+    m_accessTime = static_cast<time_t>(st.st_atime);
+    m_modificationTime = static_cast<time_t>(st.st_mtime);
+    m_creationTime = static_cast<time_t>(st.st_ctime);
+}
+
+bool wxFileStat::IsFile() const
+{
+    wxCHECK_MSG( m_ok, false, "invalid wxFileStat" );
+
+    return (m_mode & S_IFMT) == S_IFREG;
+}
+
+bool wxFileStat::IsDir() const
+{
+    wxCHECK_MSG( m_ok, false, "invalid wxFileStat" );
+
+    return (m_mode & S_IFMT) == S_IFDIR;
+}
+
+int wxFileStat::GetPermissions() const
+{
+    wxCHECK_MSG( m_ok, 0, "invalid wxFileStat" );
+
+    // notice that wxS_DIR_DEFAULT includes all the permission bits
+    return m_mode & wxS_DIR_DEFAULT;
+}
+
+#if wxUSE_LONGLONG
+
+wxULongLong wxFileStat::GetSize() const
+{
+    wxCHECK_MSG( m_ok, wxInvalidSize, "invalid wxFileStat" );
+
+    return wxULongLong(static_cast<wxULongLong_t>(m_size));
+}
+
+#endif // wxUSE_LONGLONG
+
+#if wxUSE_DATETIME
+
+wxDateTime wxFileStat::GetAccessTime() const
+{
+    wxCHECK_MSG( m_ok, wxDefaultDateTime, "invalid wxFileStat" );
+
+    return wxDateTime(m_accessTime);
+}
+
+wxDateTime wxFileStat::GetModificationTime() const
+{
+    wxCHECK_MSG( m_ok, wxDefaultDateTime, "invalid wxFileStat" );
+
+    return wxDateTime(m_modificationTime);
+}
+
+wxDateTime wxFileStat::GetCreationTime() const
+{
+    wxCHECK_MSG( m_ok, wxDefaultDateTime, "invalid wxFileStat" );
+
+    return wxDateTime(m_creationTime);
+}
+
+#endif // wxUSE_DATETIME
@@ -27,6 +27,58 @@
 #include "wx/private/fileback.h"
 #include "wx/utils.h"
 
+#include <vector>
+
+namespace
+{
+
+// Find the protocol of the given location, as returned by GetProtocol(), and
+// return its start and end positions or false if it isn't explicitly given.
+bool FindProtocol(const wxString& location, size_t* start, size_t* end)
+{
+    int i, l = location.length();
+    bool fnd = false;
+
+    for (i = l-1; (i >= 0) && ((location[i] != wxT('#')) || (!fnd)); i--) {
+        if ((location[i] == wxT(':')) && (i != 1 /*win: C:\path*/)) fnd = true;
+    }
+    if (!fnd) return false;
+
+    *start = ++i;
+    for (; (i < l) && (location[i] != wxT(':')); i++) {}
+    *end = i;
+
+    return true;
+}
+
+// Handlers, in wxFileSystem::m_Handlers order, to use for the locations with
+// the given protocol: notice that this includes the handlers which can
+// open any protocols, i.e. don't override GetSupportedProtocols().
+using wxFSHandlers = std::vector<wxFileSystemHandler*>;
+std::unordered_map<wxString, wxFSHandlers> gs_handlersByProtocol;
+
+// Handlers to use for all the other protocols.
+wxFSHandlers gs_anyProtocolHandlers;
+
+// Return the handlers to use for the given location.
+const wxFSHandlers& GetHandlersForLocation(const wxString& location)
+{
+    // Reuse the same buffer to avoid allocating memory every time.
+    static thread_local wxString s_protocol;
+
+    size_t start, end;
+    if ( FindProtocol(location, &start, &end) )
+        s_protocol.assign(location, start, end - start);
+    else
+        s_protocol = wxS("file");
+
+    const auto it = gs_handlersByProtocol.find(s_protocol);
+    return it == gs_handlersByProtocol.end() ? gs_anyProtocolHandlers
+                                             : it->second;
+}
+
+} // anonymous namespace
+
 // ----------------------------------------------------------------------------
 // wxFSFile
 // ----------------------------------------------------------------------------
@@ -149,16 +201,19 @@ wxString wxFileSystemHandler::GetMimeTypeFromExt(const wxString& location)
 /* static */
 wxString wxFileSystemHandler::GetProtocol(const wxString& location)
 {
-    wxString s;
-    int i, l = location.length();
-    bool fnd = false;
+    size_t start, end;
+    if (!FindProtocol(location, &start, &end)) return wxT("file");
+    return location.substr(start, end - start);
+}
 
-    for (i = l-1; (i >= 0) && ((location[i] != wxT('#')) || (!fnd)); i--) {
-        if ((location[i] == wxT(':')) && (i != 1 /*win: C:\path*/)) fnd = true;
-    }
-    if (!fnd) return wxT("file");
-    for (++i; (i < l) && (location[i] != wxT(':')); i++) s << location[i];
-    return s;
+/* static */
+bool
+wxFileSystemHandler::HasProtocol(const wxString& location,
+                                 const wxString& protocol)
+{
+    size_t start, end;
+    if (!FindProtocol(location, &start, &end)) return protocol == wxS("file");
+    return location.compare(start, end - start, protocol) == 0;
 }
 
 
@@ -177,6 +232,16 @@ wxString wxFileSystemHandler::GetLeftLocation(const wxString& location)
 
 /* static */
 wxString wxFileSystemHandler::GetRightLocation(const wxString& location)
+{
+    size_t start, end;
+    if (!GetRightLocationRange(location, &start, &end)) return wxEmptyString;
+    return location.substr(start, end - start);
+}
+
+/* static */
+bool
+wxFileSystemHandler::GetRightLocationRange(const wxString& location,
+                                           size_t* start, size_t* end)
 {
     int i, len = location.length();
     for (i = len-1; i >= 0; i--)
@@ -195,19 +260,27 @@ wxString wxFileSystemHandler::GetRightLocation(const wxString& location)
         // Could be the protocol
         break;
     }
-    if (i == 0) return wxEmptyString;
+    if (i == 0) return false;
+
+    *end = len;
 
     const static wxString protocol(wxT("file:"));
     if (i < (int)protocol.length() - 1 || location.compare(0, i + 1, protocol))
-        return location.Mid(i + 1, len - i - 1);
+    {
+        *start = i + 1;
+        return *start < *end;
+    }
 
     int s = ++i; // Start position
     // Check if there are three '/'s after "file:"
-    int end = wxMin(len, s + 3);
-    while (i < end && location[i] == wxT('/'))
+    int last = wxMin(len, s + 3);
+    while (i < last && location[i] == wxT('/'))
         i++;
     if (i == s + 2) // Host is specified, e.g. "file://host/path"
-        return location.Mid(s, len - s);
+    {
+        *start = s;
+        return *start < *end;
+    }
     if (i > s)
     {
         // Remove the last '/' if it is preceding "C:/...".
@@ -224,7 +297,9 @@ wxString wxFileSystemHandler::GetRightLocation(const wxString& location)
                 i--;
         }
     }
-    return location.Mid(i, len - i);
+
+    *start = i;
+    return *start < *end;
 }
 
 /* static */
@@ -262,9 +337,17 @@ wxString wxFileSystemHandler::FindNext()
 
 wxString wxLocalFSHandler::ms_root;
 
+wxArrayString wxLocalFSHandler::GetSupportedProtocols() const
+{
+    wxArrayString protocols;
+    protocols.Add(wxS("file"));
+    return protocols;
+}
+
 bool wxLocalFSHandler::CanOpen(const wxString& location)
 {
-    return GetProtocol(location) == wxT("file");
+    static const wxString protocol(wxS("file"));
+    return HasProtocol(location, protocol);
 }
 
 wxFSFile* wxLocalFSHandler::OpenFile(wxFileSystem& WXUNUSED(fs), const wxString& location)
@@ -462,7 +545,6 @@ wxFSFile* wxFileSystem::OpenFile(const wxString& location, int flags)
     unsigned i, ln;
     wxChar meta;
     wxFSFile *s = nullptr;
-    wxList::compatibility_iterator node;
 
     ln = loc.length();
     meta = 0;
@@ -480,36 +562,11 @@ wxFSFile* wxFileSystem::OpenFile(const wxString& location, int flags)
 
     // try relative paths first :
     if (meta != wxT(':') && !m_Path.empty())
-    {
-        const wxString fullloc = m_Path + loc;
-        node = m_Handlers.GetFirst();
-        while (node)
-        {
-            wxFileSystemHandler *h = (wxFileSystemHandler*) node -> GetData();
-            if (h->CanOpen(fullloc))
-            {
-                s = MakeLocal(h)->OpenFile(*this, fullloc);
-                if (s) { m_LastName = fullloc; break; }
-            }
-            node = node->GetNext();
-        }
-    }
+        s = DoOpenFile(m_Path + loc);
 
     // if failed, try absolute paths :
     if (s == nullptr)
-    {
-        node = m_Handlers.GetFirst();
-        while (node)
-        {
-            wxFileSystemHandler *h = (wxFileSystemHandler*) node->GetData();
-            if (h->CanOpen(loc))
-            {
-                s = MakeLocal(h)->OpenFile(*this, loc);
-                if (s) { m_LastName = loc; break; }
-            }
-            node = node->GetNext();
-        }
-    }
+        s = DoOpenFile(loc);
 
     if (s && (flags & wxFS_SEEKABLE) != 0 && !s->GetStream()->IsSeekable())
     {
@@ -524,9 +581,26 @@ wxFSFile* wxFileSystem::OpenFile(const wxString& location, int flags)
 
 
 
+wxFSFile* wxFileSystem::DoOpenFile(const wxString& location)
+{
+    for ( wxFileSystemHandler* const h : GetHandlersForLocation(location) )
+    {
+        if (h->CanOpen(location))
+        {
+            wxFSFile* const s = MakeLocal(h)->OpenFile(*this, location);
+            if (s)
+            {
+                m_LastName = location;
+                return s;
+            }
+        }
+    }
+
+    return nullptr;
+}
+
 wxString wxFileSystem::FindFirst(const wxString& spec, int flags)
 {
-    wxList::compatibility_iterator node;
     wxString spec2(spec);
 
     m_FindFileHandler = nullptr;
@@ -534,28 +608,25 @@ wxString wxFileSystem::FindFirst(const wxString& spec, int flags)
     for (int i = spec2.length()-1; i >= 0; i--)
         if (spec2[(unsigned int) i] == wxT('\\')) spec2.GetWritableChar(i) = wxT('/'); // Want to be windows-safe
 
-    node = m_Handlers.GetFirst();
-    while (node)
+    if ( !m_Path.empty() )
     {
-        wxFileSystemHandler *h = (wxFileSystemHandler*) node -> GetData();
-        if (h -> CanOpen(m_Path + spec2))
-        {
-            m_FindFileHandler = MakeLocal(h);
-            return m_FindFileHandler -> FindFirst(m_Path + spec2, flags);
-        }
-        node = node->GetNext();
+        const wxString found = DoFindFirst(m_Path + spec2, flags);
+        if ( m_FindFileHandler )
+            return found;
     }
 
-    node = m_Handlers.GetFirst();
-    while (node)
+    return DoFindFirst(spec2, flags);
+}
+
+wxString wxFileSystem::DoFindFirst(const wxString& spec, int flags)
+{
+    for ( wxFileSystemHandler* const h : GetHandlersForLocation(spec) )
     {
-        wxFileSystemHandler *h = (wxFileSystemHandler*) node -> GetData();
-        if (h -> CanOpen(spec2))
+        if (h->CanOpen(spec))
         {
             m_FindFileHandler = MakeLocal(h);
-            return m_FindFileHandler -> FindFirst(spec2, flags);
+            return m_FindFileHandler->FindFirst(spec, flags);
         }
-        node = node->GetNext();
     }
 
     return wxEmptyString;
@@ -609,6 +680,8 @@ void wxFileSystem::AddHandler(wxFileSystemHandler *handler)
     // prepend the handler to the beginning of the list because handlers added
     // last should have the highest priority to allow overriding them
     m_Handlers.Insert((size_t)0, handler);
+
+    UpdateHandlersByProtocol();
 }
 
 wxFileSystemHandler* wxFileSystem::RemoveHandler(wxFileSystemHandler *handler)
@@ -621,16 +694,52 @@ wxFileSystemHandler* wxFileSystem::RemoveHandler(wxFileSystemHandler *handler)
     if (!m_Handlers.DeleteObject(handler))
         return nullptr;
 
+    UpdateHandlersByProtocol();
+
     return handler;
 }
 
-
-bool wxFileSystem::HasHandlerForPath(const wxString &location)
+/* static */
+void wxFileSystem::UpdateHandlersByProtocol()
 {
+    gs_handlersByProtocol.clear();
+    gs_anyProtocolHandlers.clear();
+
+    // First find all the handlers which can open any protocol and collect all
+    // the supported protocols.
     for ( wxList::compatibility_iterator node = m_Handlers.GetFirst();
-           node; node = node->GetNext() )
+          node; node = node->GetNext() )
     {
         wxFileSystemHandler *h = (wxFileSystemHandler*) node->GetData();
+
+        const wxArrayString protocols = h->GetSupportedProtocols();
+        if ( protocols.empty() )
+            gs_anyProtocolHandlers.push_back(h);
+
+        for ( const auto& protocol : protocols )
+            gs_handlersByProtocol[protocol];
+    }
+
+    // Then fill in the handlers for each protocol, preserving their order.
+    for ( auto& kv : gs_handlersByProtocol )
+    {
+        for ( wxList::compatibility_iterator node = m_Handlers.GetFirst();
+              node; node = node->GetNext() )
+        {
+            wxFileSystemHandler *h = (wxFileSystemHandler*) node->GetData();
+
+            const wxArrayString protocols = h->GetSupportedProtocols();
+            if ( protocols.empty() || protocols.Index(kv.first) != wxNOT_FOUND )
+                kv.second.push_back(h);
+        }
+    }
+}
+
+
+bool wxFileSystem::HasHandlerForPath(const wxString &location)
+{
+    for ( wxFileSystemHandler* const h : GetHandlersForLocation(location) )
+    {
         if (h->CanOpen(location))
             return true;
     }
@@ -641,6 +750,8 @@ bool wxFileSystem::HasHandlerForPath(const wxString &location)
 void wxFileSystem::CleanUpHandlers()
 {
     wxClearList(m_Handlers);
+
+    UpdateHandlersByProtocol();
 }
 
 // Returns the native path for a file URL
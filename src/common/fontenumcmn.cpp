@@ -23,12 +23,46 @@
 
 #include "wx/fontenum.h"
 #include "wx/module.h"
+#include "wx/thread.h"
+#include "wx/threadpool.h"
+
+#ifndef WX_PRECOMP
+    #include "wx/app.h"
+#endif
+
+#include <map>
+#include <unordered_set>
+
+// Enumerating fonts is thread-safe under these platforms, so it can be done
+// in a background thread.
+#if wxUSE_THREADS && (defined(__WXMSW__) || defined(__WXOSX__))
+    #define wxFONTENUM_USE_THREAD 1
+#else
+    #define wxFONTENUM_USE_THREAD 0
+#endif
 
 namespace
 {
 
-// Cached result of GetFacenames().
-wxArrayString gs_allFacenames;
+// Cached results of GetFacenames() for the given encoding and fixed width
+// flag: enumerating the fonts can be slow when there are many of them.
+using wxFacenamesCacheKey = std::pair<wxFontEncoding, bool>;
+std::map<wxFacenamesCacheKey, wxArrayString> gs_facenamesCache;
+
+// Lower case versions of all facenames, used by IsValidFacename().
+std::unordered_set<wxString> gs_allFacenamesLower;
+
+// Protects both of the caches above, as GetFacenames() can be called from a
+// background thread by GetFacenamesAsync().
+wxCRIT_SECT_DECLARE(gs_csFacenamesCache);
+
+void ClearFacenamesCache()
+{
+    wxCRIT_SECT_LOCKER(lock, gs_csFacenamesCache);
+
+    gs_facenamesCache.clear();
+    gs_allFacenamesLower.clear();
+}
 
 // Module used to ensure the cache is cleared on library shutdown and so is not
 // reused if it re-initialized again later.
@@ -38,7 +72,7 @@ public:
     wxFontEnumCacheCleanupModule() { }
 
     bool OnInit() override { return true; }
-    void OnExit() override { gs_allFacenames.clear(); }
+    void OnExit() override { ClearFacenamesCache(); }
 
 private:
     wxDECLARE_DYNAMIC_CLASS(wxFontEnumCacheCleanupModule);
@@ -82,11 +116,57 @@ public:
 /* static */
 wxArrayString wxFontEnumerator::GetFacenames(wxFontEncoding encoding, bool fixedWidthOnly)
 {
+    const wxFacenamesCacheKey key(encoding, fixedWidthOnly);
+
+    {
+        wxCRIT_SECT_LOCKER(lock, gs_csFacenamesCache);
+
+        const auto it = gs_facenamesCache.find(key);
+        if ( it != gs_facenamesCache.end() )
+            return it->second;
+    }
+
+    // Don't lock the cache while enumerating, this can take a long time.
     wxSimpleFontEnumerator temp;
     temp.EnumerateFacenames(encoding, fixedWidthOnly);
+
+    wxCRIT_SECT_LOCKER(lock, gs_csFacenamesCache);
+    gs_facenamesCache[key] = temp.m_arrFacenames;
+
     return temp.m_arrFacenames;
 }
 
+/* static */
+void
+wxFontEnumerator::GetFacenamesAsync(const FacenamesCallback& callback,
+                                    wxFontEncoding encoding,
+                                    bool fixedWidthOnly)
+{
+    wxCHECK_RET( wxTheApp, "can't be used without an application object" );
+
+#if wxFONTENUM_USE_THREAD
+    wxThreadPool::Get().SubmitAndCallAfter
+    (
+        wxTheApp,
+        [encoding, fixedWidthOnly]()
+        {
+            return GetFacenames(encoding, fixedWidthOnly);
+        },
+        [callback](std::future<wxArrayString>& facenames)
+        {
+            callback(facenames.get());
+        }
+    );
+#else // !wxFONTENUM_USE_THREAD
+    // Enumerating fonts can't be done from another thread, so just do it
+    // later, when the application is idle.
+    wxTheApp->CallAfter([callback, encoding, fixedWidthOnly]()
+        {
+            callback(GetFacenames(encoding, fixedWidthOnly));
+        });
+#endif // wxFONTENUM_USE_THREAD
+}
+
 /* static */
 wxArrayString wxFontEnumerator::GetEncodings(const wxString& facename)
 {
@@ -100,8 +180,21 @@ bool wxFontEnumerator::IsValidFacename(const wxString &facename)
 {
     // we cache the result of wxFontEnumerator::GetFacenames supposing that
     // the array of face names won't change in the session of this program
-    if ( gs_allFacenames.empty() )
-        gs_allFacenames = wxFontEnumerator::GetFacenames();
+    // (or that InvalidateCache() will be called if it does)
+    bool needToFill;
+    {
+        wxCRIT_SECT_LOCKER(lock, gs_csFacenamesCache);
+        needToFill = gs_allFacenamesLower.empty();
+    }
+
+    if ( needToFill )
+    {
+        const wxArrayString all = wxFontEnumerator::GetFacenames();
+
+        wxCRIT_SECT_LOCKER(lock, gs_csFacenamesCache);
+        for ( const auto& name : all )
+            gs_allFacenamesLower.insert(name.Lower());
+    }
 
 #ifdef __WXMSW__
     // Quoting the MSDN:
@@ -117,16 +210,14 @@ bool wxFontEnumerator::IsValidFacename(const wxString &facename)
 #endif
 
     // is given font face name a valid one ?
-    if (gs_allFacenames.Index(facename, false) == wxNOT_FOUND)
-        return false;
-
-    return true;
+    wxCRIT_SECT_LOCKER(lock, gs_csFacenamesCache);
+    return gs_allFacenamesLower.count(facename.Lower()) != 0;
 }
 
 /* static */
 void wxFontEnumerator::InvalidateCache()
 {
-    gs_allFacenames.clear();
+    ClearFacenamesCache();
 }
 
 #ifdef wxHAS_UTF8_FONTS
@@ -22,6 +22,10 @@
 #include "wx/archive.h"
 #include "wx/private/fileback.h"
 
+#if wxUSE_ZIPSTREAM
+    #include "wx/zipstrm.h"
+#endif
+
 //---------------------------------------------------------------------------
 // wxArchiveFSCacheDataImpl
 //
@@ -141,6 +145,25 @@ wxArchiveEntry *wxArchiveFSCacheDataImpl::Get(const wxString& name)
     if (!m_archive)
         return nullptr;
 
+#if wxUSE_ZIPSTREAM
+    // Zip archives in seekable streams have an index of all their entries,
+    // so use it instead of reading the entries one by one until the one we
+    // need is found.
+    wxZipInputStream * const zip = dynamic_cast<wxZipInputStream*>(m_archive);
+    if (zip && m_stream->IsSeekable())
+    {
+        const wxZipEntry *zipEntry = zip->FindEntry(name, wxPATH_UNIX);
+        if (!zipEntry || zipEntry->GetName(wxPATH_UNIX) != name)
+            return nullptr;
+
+        // Only remember this entry in the hash and not in the list of all
+        // entries, which is still filled in order by GetNext().
+        wxArchiveEntry * const entry = zipEntry->Clone();
+        m_hash[name] = std::unique_ptr<wxArchiveEntry>(entry);
+        return entry;
+    }
+#endif // wxUSE_ZIPSTREAM
+
     wxArchiveEntry *entry;
 
     while ((entry = m_archive->GetNextEntry()) != nullptr)
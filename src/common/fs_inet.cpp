@@ -21,9 +21,19 @@
 #endif
 
 #include "wx/wfstream.h"
+#include "wx/mstream.h"
 #include "wx/url.h"
 #include "wx/filesys.h"
 #include "wx/fs_inet.h"
+#include "wx/httpcache.h"
+#include "wx/protocol/http.h"
+
+#include <memory>
+
+// The cache is only used for HTTP URLs.
+#if wxUSE_URL && wxUSE_PROTOCOL_HTTP && wxUSE_DATETIME && wxUSE_FILE
+    #define wxHAS_FS_INET_CACHE
+#endif
 
 // ----------------------------------------------------------------------------
 // Helper classes
@@ -52,11 +62,130 @@ protected:
     wxString m_filename;
 };
 
+#ifdef wxHAS_FS_INET_CACHE
+
+// This stream keeps the cached data alive while it's used
+class wxCachedDataInputStream : public wxMemoryInputStream
+{
+public:
+    explicit wxCachedDataInputStream(const wxMemoryBuffer& data) :
+        wxMemoryInputStream(data.GetData(), data.GetDataLen()), m_data(data) {}
+
+private:
+    const wxMemoryBuffer m_data;
+};
+
+#endif // wxHAS_FS_INET_CACHE
+
 
 // ----------------------------------------------------------------------------
 // wxInternetFSHandler
 // ----------------------------------------------------------------------------
 
+static wxHTTPCache* gs_cache = nullptr;
+
+/* static */
+void wxInternetFSHandler::SetCache(wxHTTPCache* cache)
+{
+    gs_cache = cache;
+}
+
+/* static */
+wxHTTPCache* wxInternetFSHandler::GetCache()
+{
+    return gs_cache;
+}
+
+// Content-Type header, as defined by the RFC 2045, has the form of
+// "type/subtype" optionally followed by (multiple) "; parameter"
+// and we need just the MIME type here.
+static wxString GetMimeType(const wxString& content)
+{
+    wxString mimetype = content.BeforeFirst(';');
+    mimetype.Trim();
+    return mimetype;
+}
+
+#ifdef wxHAS_FS_INET_CACHE
+
+static wxFSFile* CreateCachedFile(const wxHTTPCacheEntry& entry,
+                                  const wxString& location,
+                                  const wxString& anchor)
+{
+    return new wxFSFile(new wxCachedDataInputStream(entry.data),
+                        location,
+                        GetMimeType(entry.contentType),
+                        anchor,
+                        wxDateTime::Now());
+}
+
+// Open the HTTP URL, using the cached data if it's still fresh or if the
+// server confirms that it's still valid, and store the response otherwise.
+static wxFSFile* OpenUsingCache(wxURL& url,
+                                wxHTTP& http,
+                                const wxString& location,
+                                const wxString& anchor)
+{
+    wxHTTPCacheEntry entry;
+    const wxHTTPCache::Status status = gs_cache->Find(location, &entry);
+    switch ( status )
+    {
+        case wxHTTPCache::Status_Fresh:
+            return CreateCachedFile(entry, location, anchor);
+
+        case wxHTTPCache::Status_Stale:
+            // Ask the server to send the data only if it has changed.
+            if ( !entry.eTag.empty() )
+                http.SetHeader("If-None-Match", entry.eTag);
+            if ( !entry.lastModified.empty() )
+                http.SetHeader("If-Modified-Since", entry.lastModified);
+            break;
+
+        case wxHTTPCache::Status_Miss:
+            break;
+    }
+
+    std::unique_ptr<wxInputStream> s(url.GetInputStream());
+    if ( !s )
+        return nullptr;
+
+    const auto getHeader = [&http](const wxString& name)
+    {
+        return http.GetHeader(name);
+    };
+
+    if ( http.GetResponse() == 304 && status == wxHTTPCache::Status_Stale )
+    {
+        if ( !gs_cache->Revalidate(location, getHeader, &entry) )
+            return nullptr;
+
+        return CreateCachedFile(entry, location, anchor);
+    }
+
+    // Read the data directly into the buffer which will be used by the cache.
+    entry = wxHTTPCacheEntry();
+    entry.contentType = http.GetContentType();
+    for ( ;; )
+    {
+        const size_t chunkSize = 64*1024;
+        s->Read(entry.data.GetAppendBuf(chunkSize), chunkSize);
+        entry.data.UngetAppendBuf(s->LastRead());
+
+        if ( !s->IsOk() )
+            break;
+    }
+
+    if ( http.GetResponse() == 200 && s->GetLastError() == wxSTREAM_EOF )
+    {
+        gs_cache->Store(location, getHeader,
+                        entry.data.GetData(), entry.data.GetDataLen());
+    }
+
+    return CreateCachedFile(entry, location, anchor);
+}
+
+#endif // wxHAS_FS_INET_CACHE
+
 static wxString StripProtocolAnchor(const wxString& location)
 {
     wxString myloc(location.BeforeLast(wxT('#')));
@@ -75,6 +204,14 @@ static wxString StripProtocolAnchor(const wxString& location)
 }
 
 
+wxArrayString wxInternetFSHandler::GetSupportedProtocols() const
+{
+    wxArrayString protocols;
+    protocols.Add(wxT("http"));
+    protocols.Add(wxT("ftp"));
+    return protocols;
+}
+
 bool wxInternetFSHandler::CanOpen(const wxString& location)
 {
 #if wxUSE_URL
@@ -101,6 +238,13 @@ wxFSFile* wxInternetFSHandler::OpenFile(wxFileSystem& WXUNUSED(fs),
     wxURL url(right);
     if (url.GetError() == wxURL_NOERR)
     {
+#ifdef wxHAS_FS_INET_CACHE
+        wxHTTP* const
+            http = gs_cache ? wxDynamicCast(&url.GetProtocol(), wxHTTP) : nullptr;
+        if ( http )
+            return OpenUsingCache(url, *http, right, GetAnchor(location));
+#endif // wxHAS_FS_INET_CACHE
+
         wxInputStream *s = url.GetInputStream();
         if (s)
         {
@@ -113,16 +257,9 @@ wxFSFile* wxInternetFSHandler::OpenFile(wxFileSystem& WXUNUSED(fs),
             }
             delete s;
 
-            // Content-Type header, as defined by the RFC 2045, has the form of
-            // "type/subtype" optionally followed by (multiple) "; parameter"
-            // and we need just the MIME type here.
-            const wxString& content = url.GetProtocol().GetContentType();
-            wxString mimetype = content.BeforeFirst(';');
-            mimetype.Trim();
-
             return new wxFSFile(new wxTemporaryFileInputStream(tmpfile),
                                 right,
-                                mimetype,
+                                GetMimeType(url.GetProtocol().GetContentType()),
                                 GetAnchor(location)
 #if wxUSE_DATETIME
                                 , wxDateTime::Now()
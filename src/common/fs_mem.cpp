@@ -91,15 +91,42 @@ wxMemoryFSHandlerBase::~wxMemoryFSHandlerBase()
     // wxFileSystem other than releasing _all_ handlers.)
 }
 
+namespace
+{
+
+const wxString& GetMemoryProtocol()
+{
+    static const wxString s_protocol(wxS("memory"));
+    return s_protocol;
+}
+
+} // anonymous namespace
+
+wxArrayString wxMemoryFSHandlerBase::GetSupportedProtocols() const
+{
+    wxArrayString protocols;
+    protocols.Add(GetMemoryProtocol());
+    return protocols;
+}
+
 bool wxMemoryFSHandlerBase::CanOpen(const wxString& location)
 {
-    return GetProtocol(location) == "memory";
+    return HasProtocol(location, GetMemoryProtocol());
 }
 
 wxFSFile * wxMemoryFSHandlerBase::OpenFile(wxFileSystem& WXUNUSED(fs),
                                            const wxString& location)
 {
-    wxMemoryFSHash::const_iterator i = m_Hash.find(GetRightLocation(location));
+    size_t start, end;
+    if ( !GetRightLocationRange(location, &start, &end) )
+        return nullptr;
+
+    // Reuse the same buffer for the file name to avoid allocating memory for
+    // it every time, as this function may be called very often.
+    static thread_local wxString s_filename;
+    s_filename.assign(location, start, end - start);
+
+    wxMemoryFSHash::const_iterator i = m_Hash.find(s_filename);
     if ( i == m_Hash.end() )
         return nullptr;
 
@@ -16,11 +16,50 @@
 #include "wx/fswatcher.h"
 #include "wx/private/fswatcher.h"
 
+#if wxUSE_THREADS
+    #include "wx/thread.h"
+    #include "wx/threadpool.h"
+
+    #include <atomic>
+#endif // wxUSE_THREADS
+
+#if wxUSE_TIMER
+    #include "wx/timer.h"
+    #include "wx/time.h"
+
+    #include <unordered_set>
+#endif // wxUSE_TIMER
+
+// ----------------------------------------------------------------------------
+// wxFSWTreeScan: state of a tree being scanned for AddTree()
+// ----------------------------------------------------------------------------
+
+struct wxFSWTreeScan
+{
+    wxFSWTreeScan(const wxString& root_, int events_, const wxString& filespec_)
+        : root(root_), events(events_), filespec(filespec_)
+    {
+    }
+
+    const wxString root;
+    const int events;
+    const wxString filespec;
+
+#if wxUSE_THREADS
+    // Set from the main thread, read from the worker one.
+    std::atomic<bool> cancelled{false};
+
+    // Protects posting the results against concurrent cancellation.
+    wxCriticalSection cs;
+#endif // wxUSE_THREADS
+};
+
 // ============================================================================
 // helpers
 // ============================================================================
 
 wxDEFINE_EVENT(wxEVT_FSWATCHER, wxFileSystemWatcherEvent);
+wxDEFINE_EVENT(wxEVT_FSWATCHER_BATCH, wxFileSystemWatcherBatchEvent);
 
 static wxString GetFSWEventChangeTypeName(int type)
 {
@@ -72,21 +111,185 @@ wxString wxFileSystemWatcherEvent::ToString() const
 }
 
 
+// ============================================================================
+// wxFileSystemWatcherBatchEvent implementation
+// ============================================================================
+
+wxIMPLEMENT_DYNAMIC_CLASS(wxFileSystemWatcherBatchEvent, wxEvent);
+
+wxEvent* wxFileSystemWatcherBatchEvent::Clone() const
+{
+    return new wxFileSystemWatcherBatchEvent(*this);
+}
+
+// ============================================================================
+// wxFSWEventBatcher: collects the events to send them together
+// ============================================================================
+
+#if wxUSE_TIMER
+
+class wxFSWEventBatcher : public wxTimer
+{
+public:
+    wxFSWEventBatcher(wxFileSystemWatcherBase& watcher, int delay)
+        : m_watcher(watcher), m_delay(delay)
+    {
+    }
+
+    int GetDelay() const { return m_delay; }
+    void SetDelay(int delay) { m_delay = delay; }
+
+    void Add(const wxFileSystemWatcherEvent& event)
+    {
+        // Drop the exact duplicates of the changes already in this batch, but
+        // never the warnings and errors.
+        if ( !event.IsError() )
+        {
+            wxString key;
+            key << event.GetChangeType() << '\n'
+                << event.GetPath().GetFullPath() << '\n'
+                << event.GetNewPath().GetFullPath();
+            if ( !m_keys.insert(key).second )
+                return;
+        }
+
+        m_lastTime = wxGetLocalTimeMillis();
+        if ( m_events.empty() )
+            m_firstTime = m_lastTime;
+
+        m_events.push_back(event);
+
+        // Don't restart the timer for every event, this would be too slow
+        // when we get thousands of them, but check in Notify() if it needs to
+        // be restarted instead.
+        if ( !IsRunning() )
+            Start(m_delay, wxTIMER_ONE_SHOT);
+    }
+
+    void Flush()
+    {
+        Stop();
+
+        if ( m_events.empty() )
+            return;
+
+        m_keys.clear();
+
+        wxFileSystemWatcherBatchEvent event;
+        event.SetEvents(m_events);
+
+        wxLogTrace(wxTRACE_FSWATCHER, "Sending batch of %zu events",
+                   event.GetEvents().size());
+
+        // Note that the handler could destroy this object, so don't use any
+        // members after this.
+        m_watcher.GetOwner()->ProcessEvent(event);
+    }
+
+    virtual void Notify() override
+    {
+        // Wait until no more changes happen for the given delay, but don't
+        // postpone delivering them indefinitely if they keep coming.
+        const wxLongLong now = wxGetLocalTimeMillis();
+        const wxLongLong idle = now - m_lastTime;
+        if ( idle < m_delay && now - m_firstTime < 10*m_delay )
+        {
+            Start((m_delay - idle).ToLong(), wxTIMER_ONE_SHOT);
+            return;
+        }
+
+        Flush();
+    }
+
+private:
+    wxFileSystemWatcherBase& m_watcher;
+    int m_delay;
+
+    wxFileSystemWatcherBatchEvent::Events m_events;
+
+    // Keys identifying the events in m_events, used to find duplicates.
+    std::unordered_set<wxString> m_keys;
+
+    // Time of the first and last events in the current batch.
+    wxLongLong m_firstTime,
+               m_lastTime;
+};
+
+#else // !wxUSE_TIMER
+
+// Batching is not supported without timers.
+class wxFSWEventBatcher
+{
+};
+
+#endif // wxUSE_TIMER/!wxUSE_TIMER
+
 // ============================================================================
 // wxFileSystemWatcherEvent implementation
 // ============================================================================
 
 wxFileSystemWatcherBase::wxFileSystemWatcherBase() :
-    m_service(nullptr), m_owner(this)
+    m_service(nullptr), m_owner(this), m_asyncTreeAdd(false)
 {
 }
 
 wxFileSystemWatcherBase::~wxFileSystemWatcherBase()
 {
+    // This must be done even if RemoveAll() is overridden.
+    CancelTreeScans();
+
     RemoveAll();
     delete m_service;
 }
 
+void wxFileSystemWatcherBase::SetBatchDelay(int delayMs)
+{
+#if wxUSE_TIMER
+    if ( delayMs > 0 )
+    {
+        if ( m_batcher )
+            m_batcher->SetDelay(delayMs);
+        else
+            m_batcher.reset(new wxFSWEventBatcher(*this, delayMs));
+
+        return;
+    }
+
+    if ( m_batcher )
+    {
+        // Reset m_batcher first, so that any events generated by the handler
+        // of the last batch are sent immediately.
+        std::unique_ptr<wxFSWEventBatcher> batcher(std::move(m_batcher));
+        batcher->Flush();
+    }
+#else // !wxUSE_TIMER
+    wxUnusedVar(delayMs);
+#endif // wxUSE_TIMER/!wxUSE_TIMER
+}
+
+int wxFileSystemWatcherBase::GetBatchDelay() const
+{
+#if wxUSE_TIMER
+    if ( m_batcher )
+        return m_batcher->GetDelay();
+#endif // wxUSE_TIMER
+
+    return 0;
+}
+
+void wxFileSystemWatcherBase::DeliverEvent(wxFileSystemWatcherEvent& event)
+{
+#if wxUSE_TIMER
+    if ( m_batcher )
+    {
+        m_batcher->Add(event);
+        return;
+    }
+#endif // wxUSE_TIMER
+
+    m_owner->ProcessEvent(event);
+}
+
 bool wxFileSystemWatcherBase::Add(const wxFileName& path, int events)
 {
     wxFSWPathType type = wxFSWPath_None;
@@ -211,13 +414,131 @@ bool wxFileSystemWatcherBase::AddTree(const wxFileName& path, int events,
         wxString m_filespec;
     };
 
-    wxDir dir(path.GetFullPath());
     // Prevent asserts or infinite loops in trees containing symlinks
     int flags = wxDIR_DIRS;
     if ( !path.ShouldFollowLink() )
     {
         flags |= wxDIR_NO_FOLLOW;
     }
+
+#if wxUSE_THREADS
+    if ( m_asyncTreeAdd )
+    {
+        // Watch the root immediately, so that at least the changes directly
+        // in it are not missed while we're scanning the rest of the tree.
+        if ( !AddAny(path.GetPathWithSep(), events, wxFSWPath_Tree, filespec) )
+            return false;
+
+        auto scan = std::make_shared<wxFSWTreeScan>(GetCanonicalPath(path),
+                                                     events, filespec);
+        m_treeScans.push_back(scan);
+
+        const wxString root = path.GetFullPath();
+        wxThreadPool::Get().Submit([this, scan, root, flags]()
+        {
+            // Pass the directories found so far to the main thread, return
+            // false if the scan was cancelled.
+            const auto post = [this, scan](wxArrayString& dirs) -> bool
+            {
+                wxCriticalSectionLocker lock(scan->cs);
+                if ( scan->cancelled )
+                    return false;
+
+                auto batch = std::make_shared<wxArrayString>();
+                batch->swap(dirs);
+
+                CallAfter([this, scan, batch]()
+                {
+                    if ( scan->cancelled )
+                        return;
+
+                    for ( const auto& dirname : *batch )
+                    {
+                        const wxFileName fn = wxFileName::DirName(dirname);
+
+                        // The directory could have been already added when
+                        // it was created after the scan started, don't watch
+                        // it twice then.
+                        if ( m_watches.count(GetCanonicalPath(fn)) )
+                            continue;
+
+                        if ( AddAny(fn, scan->events,
+                                    wxFSWPath_Tree, scan->filespec) )
+                        {
+                            wxLogTrace(wxTRACE_FSWATCHER,
+                               "--- AddTree adding directory '%s' ---", dirname);
+                        }
+                    }
+                });
+
+                return true;
+            };
+
+            class ScanTraverser : public wxDirTraverser
+            {
+            public:
+                ScanTraverser(const wxFSWTreeScan& scan,
+                              const std::function<bool (wxArrayString&)>& post)
+                    : m_scan(scan), m_post(post)
+                {
+                }
+
+                virtual wxDirTraverseResult OnFile(const wxString& WXUNUSED(filename)) override
+                {
+                    return wxDIR_CONTINUE;
+                }
+
+                virtual wxDirTraverseResult OnDir(const wxString& dirname) override
+                {
+                    if ( m_scan.cancelled )
+                        return wxDIR_STOP;
+
+                    m_dirs.push_back(dirname);
+                    if ( m_dirs.size() >= 256 && !m_post(m_dirs) )
+                        return wxDIR_STOP;
+
+                    return wxDIR_CONTINUE;
+                }
+
+                wxArrayString m_dirs;
+
+            private:
+                const wxFSWTreeScan& m_scan;
+                const std::function<bool (wxArrayString&)> m_post;
+            };
+
+            {
+                wxLogNull noLog;
+                wxDir dir(root);
+                ScanTraverser traverser(*scan, post);
+                dir.Traverse(traverser, scan->filespec, flags);
+
+                if ( !post(traverser.m_dirs) )
+                    return;
+            }
+
+            wxCriticalSectionLocker lock(scan->cs);
+            if ( scan->cancelled )
+                return;
+
+            CallAfter([this, scan]()
+            {
+                for ( auto it = m_treeScans.begin(); it != m_treeScans.end(); ++it )
+                {
+                    if ( *it == scan )
+                    {
+                        m_treeScans.erase(it);
+                        break;
+                    }
+                }
+            });
+        });
+
+        return true;
+    }
+#endif // wxUSE_THREADS
+
+    wxDir dir(path.GetFullPath());
     AddTraverser traverser(this, events, filespec);
     dir.Traverse(traverser, filespec, flags);
 
@@ -227,6 +548,31 @@ bool wxFileSystemWatcherBase::AddTree(const wxFileName& path, int events,
     return true;
 }
 
+bool wxFileSystemWatcherBase::CancelTreeScans(const wxString& path)
+{
+    bool cancelled = false;
+
+    for ( auto it = m_treeScans.begin(); it != m_treeScans.end(); )
+    {
+        wxFSWTreeScan& scan = **it;
+        if ( !path.empty() && !scan.root.StartsWith(path) )
+        {
+            ++it;
+            continue;
+        }
+
+#if wxUSE_THREADS
+        wxCriticalSectionLocker lock(scan.cs);
+        scan.cancelled = true;
+#endif // wxUSE_THREADS
+
+        it = m_treeScans.erase(it);
+        cancelled = true;
+    }
+
+    return cancelled;
+}
+
 bool wxFileSystemWatcherBase::RemoveTree(const wxFileName& path)
 {
     if (!path.DirExists())
@@ -238,8 +584,9 @@ bool wxFileSystemWatcherBase::RemoveTree(const wxFileName& path)
     {
     public:
         RemoveTraverser(wxFileSystemWatcherBase* watcher,
-                        const wxString& filespec) :
-            m_watcher(watcher), m_filespec(filespec)
+                        const wxString& filespec,
+                        bool onlyWatched) :
+            m_watcher(watcher), m_filespec(filespec), m_onlyWatched(onlyWatched)
         {
         }
 
@@ -252,15 +599,25 @@ bool wxFileSystemWatcherBase::RemoveTree(const wxFileName& path)
 
         virtual wxDirTraverseResult OnDir(const wxString& dirname) override
         {
-            m_watcher->Remove(wxFileName::DirName(dirname));
+            const wxFileName fn = wxFileName::DirName(dirname);
+            if ( !m_onlyWatched ||
+                    m_watcher->m_watches.count(GetCanonicalPath(fn)) )
+            {
+                m_watcher->Remove(fn);
+            }
             return wxDIR_CONTINUE;
         }
 
     private:
         wxFileSystemWatcherBase* m_watcher;
         wxString m_filespec;
+        bool m_onlyWatched;
     };
 
+    // If the tree is still being added asynchronously, not all of its
+    // directories are watched yet.
+    const bool onlyWatched = CancelTreeScans(GetCanonicalPath(path));
+
     // If AddTree() used a filespec, we must use the same one
     wxString canonical = GetCanonicalPath(path);
     wxFSWatchInfoMap::iterator it = m_watches.find(canonical);
@@ -289,7 +646,7 @@ bool wxFileSystemWatcherBase::RemoveTree(const wxFileName& path)
     {
         flags |= wxDIR_NO_FOLLOW;
     }
-    RemoveTraverser traverser(this, filespec);
+    RemoveTraverser traverser(this, filespec, onlyWatched);
     dir.Traverse(traverser, filespec, flags);
 
     // As in AddTree() above, handle the path itself explicitly.
@@ -300,6 +657,8 @@ bool wxFileSystemWatcherBase::RemoveTree(const wxFileName& path)
 
 bool wxFileSystemWatcherBase::RemoveAll()
 {
+    CancelTreeScans();
+
     const bool ret = m_service->RemoveAll();
     m_watches.clear();
     return ret;
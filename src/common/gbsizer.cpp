@@ -98,6 +98,7 @@ bool wxGBSizerItem::SetPos( const wxGBPosition& pos )
     {
         wxCHECK_MSG( !m_gbsizer->CheckForIntersection(pos, m_span, this), false,
                  wxT("An item is already at that position") );
+        m_gbsizer->InvalidateMinSize();
     }
     m_pos = pos;
     return true;
@@ -109,6 +110,7 @@ bool wxGBSizerItem::SetSpan( const wxGBSpan& span )
     {
         wxCHECK_MSG( !m_gbsizer->CheckForIntersection(m_pos, span, this), false,
                  wxT("An item is already at that position") );
+        m_gbsizer->InvalidateMinSize();
     }
     m_span = span;
     return true;
@@ -447,8 +449,12 @@ wxSize wxGridBagSizer::CalcMin()
     m_rowHeights.Empty();
     m_colWidths.Empty();
 
+    // Remember the item sizes to avoid recomputing them in AdjustForOverflow().
+    m_itemMinSizes.assign(m_children.GetCount(), wxDefaultSize);
+
+    size_t n = 0;
     wxSizerItemList::compatibility_iterator node = m_children.GetFirst();
-    while (node)
+    for ( ; node; node = node->GetNext(), n++ )
     {
         wxGBSizerItem* item = (wxGBSizerItem*)node->GetData();
         if ( item->IsShown() )
@@ -465,13 +471,17 @@ wxSize wxGridBagSizer::CalcMin()
                 m_colWidths.Add(m_emptyCellSize.GetWidth());
 
             // See if this item increases the size of its row(s) or col(s)
-            wxSize size(item->CalcMin());
+            const wxSize size(item->CalcMin());
+            m_itemMinSizes[n] = size;
+
+            const int heightPerRow = size.GetHeight() / (endrow-row+1);
             for (idx=row; idx <= endrow; idx++)
-                m_rowHeights[idx] = wxMax(m_rowHeights[idx], size.GetHeight() / (endrow-row+1));
+                m_rowHeights[idx] = wxMax(m_rowHeights[idx], heightPerRow);
+
+            const int widthPerCol = size.GetWidth() / (endcol-col+1);
             for (idx=col; idx <= endcol; idx++)
-                m_colWidths[idx] = wxMax(m_colWidths[idx], size.GetWidth() / (endcol-col+1));
+                m_colWidths[idx] = wxMax(m_colWidths[idx], widthPerCol);
         }
-        node = node->GetNext();
     }
 
     AdjustForOverflow();
@@ -545,15 +555,10 @@ void wxGridBagSizer::RepositionChildren(const wxSize& minSize)
             item->GetPos(row, col);
             item->GetEndPos(endrow, endcol);
 
-            height = 0;
-            for(idx=row; idx <= endrow; idx++)
-                height += m_rowHeights[idx];
-            height += (endrow - row) * m_vgap; // add a vgap for every row spanned
-
-            width = 0;
-            for (idx=col; idx <= endcol; idx++)
-                width += m_colWidths[idx];
-            width += (endcol - col) * m_hgap; // add a hgap for every col spanned
+            // The item extends from the start of its first row (column) to the
+            // end of its last one, including the gaps between them.
+            height = rowpos[endrow] + m_rowHeights[endrow] - rowpos[row];
+            width = colpos[endcol] + m_colWidths[endcol] - colpos[col];
 
             SetItemBounds(item, colpos[col], rowpos[row], width, height);
         }
@@ -571,89 +576,103 @@ void wxGridBagSizer::RepositionChildren(const wxSize& minSize)
 // fixes them.
 void wxGridBagSizer::AdjustForOverflow()
 {
-    int row, col;
+    // Normally the item sizes are already known, but compute them if we're
+    // called from outside of CalcMin().
+    if ( m_itemMinSizes.size() != m_children.GetCount() )
+    {
+        CalcMin();
+        return;
+    }
+
+    // Only the items ending in the given row or column matter for it, so
+    // group them by their last row and column to avoid looking for the items
+    // in each cell of the grid.
+    struct ItemInfo
+    {
+        ItemInfo(wxGBSizerItem* item_, const wxSize& size_)
+            : item(item_), size(size_)
+        {
+        }
+
+        wxGBSizerItem* item;
+        wxSize size;
+    };
+
+    std::vector< std::vector<ItemInfo> > itemsByEndRow(m_rowHeights.GetCount()),
+                                         itemsByEndCol(m_colWidths.GetCount());
+
+    size_t n = 0;
+    for ( wxSizerItemList::compatibility_iterator node = m_children.GetFirst();
+          node;
+          node = node->GetNext(), n++ )
+    {
+        wxGBSizerItem* item = (wxGBSizerItem*)node->GetData();
+        if ( !item->IsShown() )
+            continue;
+
+        int endrow, endcol;
+        item->GetEndPos(endrow, endcol);
+
+        const ItemInfo info(item, m_itemMinSizes[n]);
+        itemsByEndRow[endrow].push_back(info);
+        itemsByEndCol[endcol].push_back(info);
+    }
 
+    // Starting position of each row, ignoring the initial offset, using the
+    // already adjusted heights of all the previous rows.
+    std::vector<int> rowStart(m_rowHeights.GetCount() + 1, 0);
+
+    int row, col;
     for (row=0; row<(int)m_rowHeights.GetCount(); row++)
     {
         int rowExtra=INT_MAX;
         int rowHeight = m_rowHeights[row];
-        for (col=0; col<(int)m_colWidths.GetCount(); col++)
+
+        const std::vector<ItemInfo>& items = itemsByEndRow[row];
+        for ( size_t i = 0; i < items.size(); i++ )
         {
-            wxGBPosition pos(row,col);
-            wxGBSizerItem* item = FindItemAtPosition(pos);
-            if ( !item || !item->IsShown() )
-                continue;
+            // Deduct the portions of the item that are on prior rows, if any,
+            // and check how much is left.
+            int itemHeight = items[i].size.GetHeight() -
+                                (rowStart[row] -
+                                    rowStart[items[i].item->GetPos().GetRow()]);
 
-            int endrow, endcol;
-            item->GetEndPos(endrow, endcol);
+            if ( itemHeight < 0 )
+                itemHeight = 0;
 
-            // If the item starts in this position and doesn't span rows, then
-            // just look at the whole item height
-            if ( item->GetPos() == pos && endrow == row )
-            {
-                int itemHeight = item->CalcMin().GetHeight();
-                rowExtra = wxMin(rowExtra, rowHeight - itemHeight);
-                continue;
-            }
-
-            // Otherwise, only look at spanning items if they end on this row
-            if ( endrow == row )
-            {
-                // first deduct the portions of the item that are on prior rows
-                int itemHeight = item->CalcMin().GetHeight();
-                for (int r=item->GetPos().GetRow(); r<row; r++)
-                    itemHeight -= (m_rowHeights[r] + m_vgap);
-
-                if ( itemHeight < 0 )
-                    itemHeight = 0;
-
-                // and check how much is left
-                rowExtra = wxMin(rowExtra, rowHeight - itemHeight);
-            }
+            rowExtra = wxMin(rowExtra, rowHeight - itemHeight);
         }
         if ( rowExtra && rowExtra != INT_MAX )
             m_rowHeights[row] -= rowExtra;
+
+        rowStart[row + 1] = rowStart[row] + m_rowHeights[row] + m_vgap;
     }
 
     // Now do the same thing for columns
+    std::vector<int> colStart(m_colWidths.GetCount() + 1, 0);
+
     for (col=0; col<(int)m_colWidths.GetCount(); col++)
     {
         int colExtra=INT_MAX;
         int colWidth = m_colWidths[col];
-        for (row=0; row<(int)m_rowHeights.GetCount(); row++)
-        {
-            wxGBPosition pos(row,col);
-            wxGBSizerItem* item = FindItemAtPosition(pos);
-            if ( !item || !item->IsShown() )
-                continue;
-
-            int endrow, endcol;
-            item->GetEndPos(endrow, endcol);
-
-            if ( item->GetPos() == pos && endcol == col )
-            {
-                int itemWidth = item->CalcMin().GetWidth();
-                colExtra = wxMin(colExtra, colWidth - itemWidth);
-                continue;
-            }
 
-            if ( endcol == col )
-            {
-                int itemWidth = item->CalcMin().GetWidth();
-                for (int c=item->GetPos().GetCol(); c<col; c++)
-                    itemWidth -= (m_colWidths[c] + m_hgap);
+        const std::vector<ItemInfo>& items = itemsByEndCol[col];
+        for ( size_t i = 0; i < items.size(); i++ )
+        {
+            int itemWidth = items[i].size.GetWidth() -
+                                (colStart[col] -
+                                    colStart[items[i].item->GetPos().GetCol()]);
 
-                if ( itemWidth < 0 )
-                    itemWidth = 0;
+            if ( itemWidth < 0 )
+                itemWidth = 0;
 
-                colExtra = wxMin(colExtra, colWidth - itemWidth);
-            }
+            colExtra = wxMin(colExtra, colWidth - itemWidth);
         }
         if ( colExtra && colExtra != INT_MAX )
             m_colWidths[col] -= colExtra;
-    }
-
 
+        colStart[col + 1] = colStart[col] + m_colWidths[col] + m_hgap;
+    }
 }
 
 //---------------------------------------------------------------------------
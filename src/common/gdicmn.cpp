@@ -736,7 +736,102 @@ void wxDeleteStockLists()
 // wxTheXXXList stuff (semi-obsolete)
 // ============================================================================
 
+// ----------------------------------------------------------------------------
+// wxGDIObjListHash
+// ----------------------------------------------------------------------------
+
+// Key identifying the objects in wxGDIObjListBase: this struct is used for all
+// kinds of objects, with the fields not used by the given kind remaining 0.
+struct wxGDIObjListKey
+{
+    bool operator==(const wxGDIObjListKey& other) const
+    {
+        return colour == other.colour &&
+               width == other.width &&
+               style == other.style &&
+               pointSize == other.pointSize &&
+               pixelSize == other.pixelSize &&
+               family == other.family &&
+               weight == other.weight &&
+               underlined == other.underlined &&
+               encoding == other.encoding &&
+               face == other.face;
+    }
+
+    // Used by pens and brushes.
+    wxUint32 colour = 0;
+    int width = 0;
+
+    // Used by all objects.
+    int style = 0;
+
+    // Used by fonts only.
+    double pointSize = 0.0;
+    wxSize pixelSize;
+    int family = 0;
+    int weight = 0;
+    bool underlined = false;
+    int encoding = 0;
+    wxString face;
+};
+
+struct wxGDIObjListKeyHash
+{
+    size_t operator()(const wxGDIObjListKey& key) const
+    {
+        size_t h = key.colour;
+        h = h*31 + static_cast<size_t>(key.width);
+        h = h*31 + static_cast<size_t>(key.style);
+        h = h*31 + std::hash<double>()(key.pointSize);
+        h = h*31 + static_cast<size_t>(key.pixelSize.x);
+        h = h*31 + static_cast<size_t>(key.pixelSize.y);
+        h = h*31 + static_cast<size_t>(key.family);
+        h = h*31 + static_cast<size_t>(key.weight);
+        h = h*31 + key.underlined;
+        h = h*31 + static_cast<size_t>(key.encoding);
+        h = h*31 + std::hash<wxString>()(key.face);
+        return h;
+    }
+};
+
+class wxGDIObjListHash
+    : public std::unordered_map<wxGDIObjListKey, wxObject*, wxGDIObjListKeyHash>
+{
+};
+
+namespace
+{
+
+// Return the object stored in the hash for the given key, if any and if it
+// still satisfies the given predicate: this is needed because the objects
+// returned by FindOrCreateXXX() functions could have been modified since then.
+template <typename T, typename F>
+T* wxFindInGDIObjListHash(wxGDIObjListHash& hash,
+                          const wxGDIObjListKey& key,
+                          F matches)
+{
+    const auto it = hash.find(key);
+    if ( it == hash.end() )
+        return nullptr;
+
+    T* const obj = static_cast<T*>(it->second);
+    if ( !matches(*obj) )
+    {
+        hash.erase(it);
+        return nullptr;
+    }
+
+    return obj;
+}
+
+} // anonymous namespace
+
+// ----------------------------------------------------------------------------
+// wxGDIObjListBase and derived classes
+// ----------------------------------------------------------------------------
+
 wxGDIObjListBase::wxGDIObjListBase()
+    : m_hash(new wxGDIObjListHash)
 {
 }
 
@@ -746,27 +841,47 @@ wxGDIObjListBase::~wxGDIObjListBase()
     {
         delete static_cast<wxObject*>(node->GetData());
     }
+
+    delete m_hash;
 }
 
 wxPen *wxPenList::FindOrCreatePen (const wxColour& colour, int width, wxPenStyle style)
 {
+    const auto matches = [&](const wxPen& pen)
+    {
+        return pen.GetWidth() == width &&
+                pen.GetStyle() == style &&
+                    pen.GetColour() == colour;
+    };
+
+    wxGDIObjListKey key;
+    key.colour = colour.IsOk() ? colour.GetRGBA() : 0;
+    key.width = width;
+    key.style = style;
+
+    wxPen* pen = wxFindInGDIObjListHash<wxPen>(*m_hash, key, matches);
+    if ( pen )
+        return pen;
+
     for ( wxList::compatibility_iterator node = list.GetFirst();
           node;
           node = node->GetNext() )
     {
-        wxPen * const pen = (wxPen *) node->GetData();
-        if ( pen->GetWidth () == width &&
-                pen->GetStyle () == style &&
-                    pen->GetColour() == colour )
+        pen = (wxPen *) node->GetData();
+        if ( matches(*pen) )
+        {
+            (*m_hash)[key] = pen;
             return pen;
+        }
     }
 
-    wxPen* pen = nullptr;
+    pen = nullptr;
     wxPen penTmp(colour, width, style);
     if (penTmp.IsOk())
     {
         pen = new wxPen(penTmp);
         list.Append(pen);
+        (*m_hash)[key] = pen;
     }
 
     return pen;
@@ -774,21 +889,38 @@ wxPen *wxPenList::FindOrCreatePen (const wxColour& colour, int width, wxPenStyle
 
 wxBrush *wxBrushList::FindOrCreateBrush (const wxColour& colour, wxBrushStyle style)
 {
+    const auto matches = [&](const wxBrush& brush)
+    {
+        return brush.GetStyle() == style && brush.GetColour() == colour;
+    };
+
+    wxGDIObjListKey key;
+    key.colour = colour.IsOk() ? colour.GetRGBA() : 0;
+    key.style = style;
+
+    wxBrush* brush = wxFindInGDIObjListHash<wxBrush>(*m_hash, key, matches);
+    if ( brush )
+        return brush;
+
     for ( wxList::compatibility_iterator node = list.GetFirst();
           node;
           node = node->GetNext() )
     {
-        wxBrush * const brush = (wxBrush *) node->GetData ();
-        if ( brush->GetStyle() == style && brush->GetColour() == colour )
+        brush = (wxBrush *) node->GetData ();
+        if ( matches(*brush) )
+        {
+            (*m_hash)[key] = brush;
             return brush;
+        }
     }
 
-    wxBrush* brush = nullptr;
+    brush = nullptr;
     wxBrush brushTmp(colour, style);
     if (brushTmp.IsOk())
     {
         brush = new wxBrush(brushTmp);
         list.Append(brush);
+        (*m_hash)[key] = brush;
     }
 
     return brush;
@@ -819,71 +951,96 @@ wxFont *wxFontList::FindOrCreateFont(const wxFontInfo& fontInfo)
         info.Style(wxFONTSTYLE_ITALIC);
  #endif // __WXMSW__
 
-    wxFont *font;
-    wxList::compatibility_iterator node;
-    for (node = list.GetFirst(); node; node = node->GetNext())
+    const auto matches = [&](const wxFont& font)
     {
         bool same;
 
-        font = (wxFont *)node->GetData();
-
         if ( info.IsUsingSizeInPixels() )
         {
             // When the width is 0, it means that we don't care about it.
             if ( info.GetPixelSize().x == 0 )
-                same = font->GetPixelSize().y == info.GetPixelSize().y;
+                same = font.GetPixelSize().y == info.GetPixelSize().y;
             else
-                same = font->GetPixelSize() == info.GetPixelSize();
+                same = font.GetPixelSize() == info.GetPixelSize();
         }
         else
         {
-            same = font->GetFractionalPointSize() == info.GetFractionalPointSize();
+            same = font.GetFractionalPointSize() == info.GetFractionalPointSize();
         }
 
-        if ( same &&
-             font->GetStyle () == info.GetStyle() &&
-             font->GetWeight () == info.GetWeight() &&
-             font->GetUnderlined () == info.IsUnderlined() )
+        if ( !same ||
+             font.GetStyle () != info.GetStyle() ||
+             font.GetWeight () != info.GetWeight() ||
+             font.GetUnderlined () != info.IsUnderlined() )
         {
-            // empty facename matches anything at all: this is bad because
-            // depending on which fonts are already created, we might get back
-            // a different font if we create it with empty facename, but it is
-            // still better than never matching anything in the cache at all
-            // in this case
-            const wxString fontFaceName(font->GetFaceName());
-
-            if (info.GetFaceName().empty() || fontFaceName.empty())
-            {
-                same = font->GetFamily() == info.GetFamily();
+            return false;
+        }
+
+        // empty facename matches anything at all: this is bad because
+        // depending on which fonts are already created, we might get back
+        // a different font if we create it with empty facename, but it is
+        // still better than never matching anything in the cache at all
+        // in this case
+        const wxString fontFaceName(font.GetFaceName());
+
+        if (info.GetFaceName().empty() || fontFaceName.empty())
+        {
+            same = font.GetFamily() == info.GetFamily();
 
-                // In wxOSX fonts created using wxFONTFAMILY_DEFAULT can return
-                // either it or wxFONTFAMILY_SWISS from GetFamily(), which is a
-                // bug and needs to be fixed (see #23144), but for now work
-                // around it here.
+            // In wxOSX fonts created using wxFONTFAMILY_DEFAULT can return
+            // either it or wxFONTFAMILY_SWISS from GetFamily(), which is a
+            // bug and needs to be fixed (see #23144), but for now work
+            // around it here.
 #ifdef __WXOSX__
-                if ( !same &&
-                     fontInfo.GetFamily() == wxFONTFAMILY_DEFAULT &&
-                     font->GetFamily() == wxFONTFAMILY_DEFAULT )
-                {
-                    same = true;
-                }
-#endif // __WXOSX__
-            }
-            else
+            if ( !same &&
+                 fontInfo.GetFamily() == wxFONTFAMILY_DEFAULT &&
+                 font.GetFamily() == wxFONTFAMILY_DEFAULT )
             {
-                same = fontFaceName == info.GetFaceName();
+                same = true;
             }
+#endif // __WXOSX__
+        }
+        else
+        {
+            same = fontFaceName == info.GetFaceName();
+        }
 
-            if ( same && (info.GetEncoding() != wxFONTENCODING_DEFAULT) )
-            {
-                // have to match the encoding too
-                same = font->GetEncoding() == info.GetEncoding();
-            }
+        if ( same && (info.GetEncoding() != wxFONTENCODING_DEFAULT) )
+        {
+            // have to match the encoding too
+            same = font.GetEncoding() == info.GetEncoding();
+        }
 
-            if ( same )
-            {
-                return font;
-            }
+        return same;
+    };
+
+    // Notice that the key uses the requested attributes and not those of the
+    // font itself, as they are not necessarily the same, see above.
+    wxGDIObjListKey key;
+    if ( info.IsUsingSizeInPixels() )
+        key.pixelSize = info.GetPixelSize();
+    else
+        key.pointSize = info.GetFractionalPointSize();
+    key.style = info.GetStyle();
+    key.family = fontInfo.GetFamily();
+    key.weight = info.GetWeight();
+    key.underlined = info.IsUnderlined();
+    key.encoding = info.GetEncoding();
+    key.face = info.GetFaceName();
+
+    wxFont *font = wxFindInGDIObjListHash<wxFont>(*m_hash, key, matches);
+    if ( font )
+        return font;
+
+    wxList::compatibility_iterator node;
+    for (node = list.GetFirst(); node; node = node->GetNext())
+    {
+        font = (wxFont *)node->GetData();
+
+        if ( matches(*font) )
+        {
+            (*m_hash)[key] = font;
+            return font;
         }
     }
 
@@ -892,6 +1049,7 @@ wxFont *wxFontList::FindOrCreateFont(const wxFontInfo& fontInfo)
     if (font->IsOk())
     {
         list.Append(font);
+        (*m_hash)[key] = font;
     }
     else
     {
@@ -58,11 +58,18 @@ public:
     int transparent;                // transparent color index (-1 = none)
     wxAnimationDisposal disposal;   // disposal method
     long delay;                     // delay in ms (-1 = unused)
-    unsigned char *p;               // bitmap
+    unsigned char *p;               // bitmap (null until decoded)
     unsigned char *pal;             // palette
+    bool ownPal;                    // true if pal must be freed
     unsigned int ncolours;          // number of colours
     wxString comment;
 
+    // LZW-compressed image data, without the sub-block lengths, which is
+    // only decoded when the frame is used
+    wxMemoryBuffer lzw;
+    int bits;                       // initial code size
+    bool interlaced;
+
     wxDECLARE_NO_COPY_CLASS(GIFImage);
 };
 
@@ -80,7 +87,10 @@ GIFImage::GIFImage()
     delay = -1;
     p = (unsigned char *) nullptr;
     pal = (unsigned char *) nullptr;
+    ownPal = false;
     ncolours = 0;
+    bits = 0;
+    interlaced = false;
 }
 
 //---------------------------------------------------------------------------
@@ -103,7 +113,8 @@ void wxGIFDecoder::Destroy()
     {
         GIFImage *f = (GIFImage*)m_frames[i];
         free(f->p);
-        free(f->pal);
+        if (f->ownPal)
+            free(f->pal);
         delete f;
     }
 
@@ -120,10 +131,31 @@ void wxGIFDecoder::Destroy()
 
 bool wxGIFDecoder::ConvertToImage(unsigned int frame, wxImage *image) const
 {
-    unsigned char *src, *dst, *pal;
+    const unsigned char *src;
+    unsigned char *dst;
     unsigned long i;
     int      transparent;
 
+    // Don't keep the decoded data of the frames which hadn't been decoded
+    // yet, as this function is typically called for all the frames of an
+    // animation in turn and keeping all of them would use a lot of memory.
+    const GIFImage* const img = GetFrame(frame);
+    wxScopedArray<unsigned char> decoded;
+    src = img->p;
+    if ( !src )
+    {
+        decoded.reset(new unsigned char[img->w * img->h]);
+        if ( DecodeFrame(*img, decoded.get()) != wxGIF_OK )
+            return false;
+
+        src = decoded.get();
+    }
+
+    // Copy the palette as it's modified below and may be shared with the other
+    // frames.
+    unsigned char pal[768];
+    memcpy(pal, GetPalette(frame), sizeof(pal));
+
     // Store the original value of the transparency option, before it is reset
     // by Create().
     const wxString&
@@ -137,8 +169,6 @@ bool wxGIFDecoder::ConvertToImage(unsigned int frame, wxImage *image) const
     if (!image->IsOk())
         return false;
 
-    pal = GetPalette(frame);
-    src = GetData(frame);
     dst = image->GetData();
     transparent = GetTransparentColourIndex(frame);
 
@@ -270,7 +300,27 @@ wxColour wxGIFDecoder::GetTransparentColour(unsigned int frame) const
                     pal[n*3 + 2]);
 }
 
-unsigned char* wxGIFDecoder::GetData(unsigned int frame) const    { return (GetFrame(frame)->p); }
+unsigned char* wxGIFDecoder::GetData(unsigned int frame) const
+{
+    GIFImage* const img = GetFrame(frame);
+    if ( !img->p )
+    {
+        unsigned char* const p = (unsigned char *) malloc(img->w * img->h);
+        if ( !p )
+            return nullptr;
+
+        if ( DecodeFrame(*img, p) != wxGIF_OK )
+        {
+            free(p);
+            return nullptr;
+        }
+
+        img->p = p;
+    }
+
+    return img->p;
+}
+
 unsigned char* wxGIFDecoder::GetPalette(unsigned int frame) const { return (GetFrame(frame)->pal); }
 unsigned int wxGIFDecoder::GetNcolours(unsigned int frame) const  { return (GetFrame(frame)->ncolours); }
 int wxGIFDecoder::GetTransparentColourIndex(unsigned int frame) const  { return (GetFrame(frame)->transparent); }
@@ -281,10 +331,33 @@ int wxGIFDecoder::GetTransparentColourIndex(unsigned int frame) const  { return
 // GIF reading and decoding
 //---------------------------------------------------------------------------
 
-// getcode:
-//  Reads the next code from the file stream, with size 'bits'
+namespace
+{
+
+// Helper class decoding the LZW codes from the frame data.
+class GIFCodeReader
+{
+public:
+    explicit GIFCodeReader(const wxMemoryBuffer& data)
+        : m_ptr(static_cast<const unsigned char*>(data.GetData())),
+          m_end(m_ptr + data.GetDataLen())
+    {
+    }
+
+    int GetCode(int bits, int ab_fin);
+
+private:
+    const unsigned char *m_ptr;     // next byte to read
+    const unsigned char* const m_end;
+
+    int           m_restbits = 0;   // remaining valid bits
+    unsigned int  m_lastbyte = 0;   // last byte read
+};
+
+// GetCode:
+//  Reads the next code from the data, with size 'bits'
 //
-int wxGIFDecoder::getcode(wxInputStream& stream, int bits, int ab_fin)
+int GIFCodeReader::GetCode(int bits, int ab_fin)
 {
     unsigned int mask;          // bit mask
     unsigned int code;          // code (result)
@@ -296,38 +369,19 @@ int wxGIFDecoder::getcode(wxInputStream& stream, int bits, int ab_fin)
     // keep reading new bytes while needed
     while (bits > m_restbits)
     {
-        // if no bytes left in this block, read the next block
-        if (m_restbyte == 0)
-        {
-            m_restbyte = stream.GetC();
-
-            /* Some encoders are a bit broken: instead of issuing
-             * an end-of-image symbol (ab_fin) they come up with
-             * a zero-length subblock!! We catch this here so
-             * that the decoder sees an ab_fin code.
-             * We also need to check if the file doesn't end unexpectedly.
-             */
-            if (stream.Eof() || m_restbyte == 0)
-            {
-                code = ab_fin;
-                break;
-            }
-
-            // prefetch data
-            stream.Read((void *) m_buffer, m_restbyte);
-            if (stream.LastRead() != m_restbyte)
-            {
-                code = ab_fin;
-                return code;
-            }
-            m_bufp = m_buffer;
-        }
+        /* Some encoders are a bit broken: instead of issuing
+         * an end-of-image symbol (ab_fin) they come up with
+         * a zero-length subblock!! Such subblock terminates the
+         * data, so we catch this here so that the decoder sees an
+         * ab_fin code. This also takes care of truncated files.
+         */
+        if (m_ptr == m_end)
+            return ab_fin;
 
         // read next byte and isolate the bits we need
-        m_lastbyte = (unsigned char) (*m_bufp++);
+        m_lastbyte = *m_ptr++;
         mask       = (1 << (bits - m_restbits)) - 1;
         code       = code + ((m_lastbyte & mask) << m_restbits);
-        m_restbyte--;
 
         // adjust total number of bits extracted from the buffer
         m_restbits = m_restbits + 8;
@@ -339,17 +393,33 @@ int wxGIFDecoder::getcode(wxInputStream& stream, int bits, int ab_fin)
     return code;
 }
 
+} // anonymous namespace
+
 
-// dgif:
-//  GIF decoding function. The initial code size (aka root size)
-//  is 'bits'. Supports interlaced images (interl == 1).
+// DecodeFrame:
+//  GIF decoding function. Decodes the frame LZW data into the buffer 'p'
+//  which must be big enough for all its pixels. Supports interlaced images.
 //  Returns wxGIF_OK (== 0) on success, or an error code if something
 // fails (see header file for details)
+/* static */
 wxGIFErrorCode
-wxGIFDecoder::dgif(wxInputStream& stream, GIFImage *img, int interl, int bits)
+wxGIFDecoder::DecodeFrame(const GIFImage& frame, unsigned char *p)
 {
     static const int allocSize = 4096 + 1;
 
+    const GIFImage* const img = &frame;
+    const int interl = img->interlaced;
+    const int bits = img->bits;
+
+    if ( !img->w || !img->h )
+        return wxGIF_OK;
+
+    // the pixels not covered by the data in the truncated files are left
+    // with the first colour
+    memset(p, 0, img->w * img->h);
+
+    GIFCodeReader reader(img->lzw);
+
     wxScopedArray<int> ab_prefix(allocSize); // alphabet (prefixes)
     if ( !ab_prefix )
         return wxGIF_MEMERR;
@@ -386,16 +456,11 @@ wxGIFDecoder::dgif(wxInputStream& stream, GIFImage *img, int interl, int bits)
     pass     = 1;
     pos = x = y = 0;
 
-    // reset decoder vars
-    m_restbits = 0;
-    m_restbyte = 0;
-    m_lastbyte = 0;
-
     do
     {
         // get next code
         int readcode;
-        readcode = code = getcode(stream, ab_bits, ab_fin);
+        readcode = code = reader.GetCode(ab_bits, ab_fin);
 
         // end of image?
         if (code == ab_fin) break;
@@ -469,7 +534,7 @@ wxGIFDecoder::dgif(wxInputStream& stream, GIFImage *img, int interl, int bits)
         // dump stack data to the image buffer
         while (pos >= 0)
         {
-            (img->p)[x + (y * (img->w))] = (char) stack[pos];
+            p[x + (y * (img->w))] = (unsigned char) stack[pos];
             pos--;
 
             if (++x >= (img->w))
@@ -616,12 +681,11 @@ bool wxGIFDecoder::DoCanRead(wxInputStream &stream) const
 wxGIFErrorCode wxGIFDecoder::LoadGIF(wxInputStream& stream)
 {
     unsigned int  global_ncolors = 0;
-    int           bits, interl, i;
+    int           bits, i;
     wxAnimationDisposal disposal;
-    long          size;
     long          delay;
     unsigned char type = 0;
-    unsigned char pal[768];
+    unsigned char *pal = m_globalPalette;
     unsigned char buf[16];
     bool anim = true;
 
@@ -660,6 +724,7 @@ wxGIFErrorCode wxGIFDecoder::LoadGIF(wxInputStream& stream)
     }
 
     // load global color map if available
+    memset(pal, 0, sizeof(m_globalPalette));
     if ((buf[4] & 0x80) == 0x80)
     {
         int backgroundColIndex = buf[5];
@@ -827,23 +892,21 @@ wxGIFErrorCode wxGIFDecoder::LoadGIF(wxInputStream& stream)
                     }
                 }
 
-                interl = ((buf[8] & 0x40)? 1 : 0);
-                size = pimg->w * pimg->h;
+                pimg->interlaced = (buf[8] & 0x40) != 0;
 
                 pimg->transparent = transparent;
                 pimg->disposal = disposal;
                 pimg->delay = delay;
 
-                // allocate memory for image and palette
-                pimg->p   = (unsigned char *) malloc((unsigned int)size);
-                pimg->pal = (unsigned char *) malloc(768);
-
-                if ((!pimg->p) || (!pimg->pal))
-                    return wxGIF_MEMERR;
-
                 // load local color map if available, else use global map
                 if ((buf[8] & 0x80) == 0x80)
                 {
+                    pimg->pal = (unsigned char *) calloc(768, 1);
+                    if (!pimg->pal)
+                        return wxGIF_MEMERR;
+
+                    pimg->ownPal = true;
+
                     unsigned int local_ncolors = 2 << (buf[8] & 0x07);
                     unsigned int numBytes = 3 * local_ncolors;
                     stream.Read(pimg->pal, numBytes);
@@ -853,19 +916,30 @@ wxGIFErrorCode wxGIFDecoder::LoadGIF(wxInputStream& stream)
                 }
                 else
                 {
-                    memcpy(pimg->pal, pal, 768);
+                    pimg->pal = pal;
                     pimg->ncolours = global_ncolors;
                 }
 
                 // get initial code size from first byte in raster data
                 bits = stream.GetC();
-                if (stream.Eof() || bits <= 0)
+                if (stream.Eof() || bits <= 0 || bits > 11)
                     return wxGIF_INVFORMAT;
 
-                // decode image
-                wxGIFErrorCode result = dgif(stream, pimg.get(), interl, bits);
-                if (result != wxGIF_OK)
-                    return result;
+                pimg->bits = bits;
+
+                // Read the image data sub-blocks, but don't decode them yet,
+                // this will be done only when (and if) the frame is used. If
+                // the data is truncated, keep what we have, as the frame can
+                // still be partially decoded.
+                for ( int len = stream.GetC(); len > 0; len = stream.GetC() )
+                {
+                    void* const data = pimg->lzw.GetAppendBuf(len);
+                    stream.Read(data, len);
+                    pimg->lzw.UngetAppendBuf(stream.LastRead());
+
+                    if ( stream.LastRead() != (size_t)len )
+                        break;
+                }
 
                 guardDestroy.Dismiss();
 
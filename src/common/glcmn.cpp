@@ -23,9 +23,13 @@
 
 #ifndef WX_PRECOMP
     #include "wx/log.h"
+    #include "wx/image.h"
 #endif // WX_PRECOMP
 
 #include "wx/glcanvas.h"
+#include "wx/math.h"
+
+#include <string.h>
 
 // DLL options compatibility check:
 #include "wx/build.h"
@@ -119,6 +123,31 @@ wxGLCanvasBase::~wxGLCanvasBase()
 {
 }
 
+std::vector<int> wxGLCanvasBase::GetGLRectsFromRegion(const wxRegion& region) const
+{
+    const double scale = GetContentScaleFactor();
+    const int height = wxRound(GetClientSize().y * scale);
+
+    std::vector<int> rects;
+    for ( wxRegionIterator it(region); it; ++it )
+    {
+        const wxRect r = it.GetRect();
+
+        // Round outwards to ensure that the entire damaged area is covered.
+        const int x1 = static_cast<int>(std::floor(r.x * scale)),
+                  y1 = static_cast<int>(std::floor(r.y * scale)),
+                  x2 = static_cast<int>(std::ceil((r.x + r.width) * scale)),
+                  y2 = static_cast<int>(std::ceil((r.y + r.height) * scale));
+
+        rects.push_back(x1);
+        rects.push_back(height - y2);
+        rects.push_back(x2 - x1);
+        rects.push_back(y2 - y1);
+    }
+
+    return rects;
+}
+
 /* static */
 bool wxGLCanvasBase::IsExtensionInList(const char *list, const char *extension)
 {
@@ -574,5 +603,204 @@ void wxGLAPI::glEnd()
 #endif
 }
 
+// ============================================================================
+// wxGLImageUploader
+// ============================================================================
+
+// Pixel buffer objects are not available in OpenGL ES 2, which is the only
+// version we support under iOS, so don't even try using them there.
+#ifndef wxHAS_OPENGL_ES
+
+#ifndef GL_PIXEL_UNPACK_BUFFER
+    #define GL_PIXEL_UNPACK_BUFFER 0x88EC
+#endif
+#ifndef GL_STREAM_DRAW
+    #define GL_STREAM_DRAW 0x88E0
+#endif
+#ifndef GL_WRITE_ONLY
+    #define GL_WRITE_ONLY 0x88B9
+#endif
+
+#ifndef APIENTRY
+    #define APIENTRY
+#endif
+
+#define wxUSE_GL_PBO 1
+
+#else // wxHAS_OPENGL_ES
+
+#define wxUSE_GL_PBO 0
+
+#endif // !wxHAS_OPENGL_ES/wxHAS_OPENGL_ES
+
+struct wxGLImageUploaderImpl
+{
+#if wxUSE_GL_PBO
+    typedef void (APIENTRY *glGenBuffers_t)(GLsizei n, GLuint* buffers);
+    typedef void (APIENTRY *glDeleteBuffers_t)(GLsizei n, const GLuint* buffers);
+    typedef void (APIENTRY *glBindBuffer_t)(GLenum target, GLuint buffer);
+    typedef void (APIENTRY *glBufferData_t)(GLenum target, ptrdiff_t size,
+                                          const void* data, GLenum usage);
+    typedef void* (APIENTRY *glMapBuffer_t)(GLenum target, GLenum access);
+    typedef GLboolean (APIENTRY *glUnmapBuffer_t)(GLenum target);
+
+    glGenBuffers_t glGenBuffers = nullptr;
+    glDeleteBuffers_t glDeleteBuffers = nullptr;
+    glBindBuffer_t glBindBuffer = nullptr;
+    glBufferData_t glBufferData = nullptr;
+    glMapBuffer_t glMapBuffer = nullptr;
+    glUnmapBuffer_t glUnmapBuffer = nullptr;
+
+    GLuint m_pbo = 0;
+#endif // wxUSE_GL_PBO
+
+    // Only used when not using PBO for interleaving RGB and alpha.
+    std::vector<unsigned char> m_buffer;
+};
+
+namespace
+{
+
+// Copy the image data to the given buffer in the format expected by
+// glTexImage2D() for GL_RGBA format.
+void wxGLInterleaveAlpha(const wxImage& image, unsigned char* dst)
+{
+    const unsigned char* rgb = image.GetData();
+    const unsigned char* alpha = image.GetAlpha();
+
+    const size_t count = static_cast<size_t>(image.GetWidth())*image.GetHeight();
+    for ( size_t n = 0; n < count; n++ )
+    {
+        *dst++ = *rgb++;
+        *dst++ = *rgb++;
+        *dst++ = *rgb++;
+        *dst++ = *alpha++;
+    }
+}
+
+} // anonymous namespace
+
+wxGLImageUploader::wxGLImageUploader()
+    : m_impl(new wxGLImageUploaderImpl)
+{
+#if wxUSE_GL_PBO
+    #define wxGL_LOAD_FUNC(name) \
+        m_impl->name = reinterpret_cast<wxGLImageUploaderImpl::name##_t>( \
+            wxGLCanvasBase::GetGLProcAddress(#name)); \
+        if ( !m_impl->name ) \
+            ok = false
+
+    // These functions are part of OpenGL 1.5 but may still be unavailable,
+    // e.g. when using software rendering with some old drivers.
+    bool ok = true;
+    wxGL_LOAD_FUNC(glGenBuffers);
+    wxGL_LOAD_FUNC(glDeleteBuffers);
+    wxGL_LOAD_FUNC(glBindBuffer);
+    wxGL_LOAD_FUNC(glBufferData);
+    wxGL_LOAD_FUNC(glMapBuffer);
+    wxGL_LOAD_FUNC(glUnmapBuffer);
+
+    #undef wxGL_LOAD_FUNC
+
+    if ( ok )
+        m_impl->glGenBuffers(1, &m_impl->m_pbo);
+#endif // wxUSE_GL_PBO
+}
+
+wxGLImageUploader::~wxGLImageUploader()
+{
+#if wxUSE_GL_PBO
+    if ( m_impl->m_pbo )
+        m_impl->glDeleteBuffers(1, &m_impl->m_pbo);
+#endif // wxUSE_GL_PBO
+
+    delete m_impl;
+}
+
+bool wxGLImageUploader::IsUsingPBO() const
+{
+#if wxUSE_GL_PBO
+    return m_impl->m_pbo != 0;
+#else
+    return false;
+#endif
+}
+
+bool wxGLImageUploader::Upload(const wxImage& image)
+{
+    wxCHECK_MSG( image.IsOk(), false, "invalid image" );
+
+    const int width = image.GetWidth(),
+              height = image.GetHeight();
+    const bool hasAlpha = image.HasAlpha();
+    const GLenum format = hasAlpha ? GL_RGBA : GL_RGB;
+
+    // wxImage rows are not padded, so don't let OpenGL expect them to be.
+    GLint alignmentOld;
+    glGetIntegerv(GL_UNPACK_ALIGNMENT, &alignmentOld);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+    const void* pixels = nullptr;
+
+#if wxUSE_GL_PBO
+    if ( m_impl->m_pbo )
+    {
+        const size_t size = static_cast<size_t>(width)*height*(hasAlpha ? 4 : 3);
+
+        m_impl->glBindBuffer(GL_PIXEL_UNPACK_BUFFER, m_impl->m_pbo);
+
+        // Orphan the previous buffer contents, so that we don't have to wait
+        // until the previous upload from it completes.
+        m_impl->glBufferData(GL_PIXEL_UNPACK_BUFFER, size, nullptr,
+                             GL_STREAM_DRAW);
+
+        void* const dst = m_impl->glMapBuffer(GL_PIXEL_UNPACK_BUFFER,
+                                              GL_WRITE_ONLY);
+        if ( dst )
+        {
+            if ( hasAlpha )
+                wxGLInterleaveAlpha(image, static_cast<unsigned char*>(dst));
+            else
+                memcpy(dst, image.GetData(), size);
+
+            if ( m_impl->glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER) )
+            {
+                // The texture data is read from the offset 0 in the buffer
+                // and the copy happens asynchronously.
+                glTexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0,
+                             format, GL_UNSIGNED_BYTE, nullptr);
+
+                m_impl->glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+                glPixelStorei(GL_UNPACK_ALIGNMENT, alignmentOld);
+
+                return glGetError() == GL_NO_ERROR;
+            }
+        }
+
+        // Fall back to uploading the data directly below.
+        m_impl->glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    }
+#endif // wxUSE_GL_PBO
+
+    if ( hasAlpha )
+    {
+        m_impl->m_buffer.resize(static_cast<size_t>(width)*height*4);
+        wxGLInterleaveAlpha(image, m_impl->m_buffer.data());
+        pixels = m_impl->m_buffer.data();
+    }
+    else
+    {
+        // The RGB data can be used as is.
+        pixels = image.GetData();
+    }
+
+    glTexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0,
+                 format, GL_UNSIGNED_BYTE, pixels);
+
+    glPixelStorei(GL_UNPACK_ALIGNMENT, alignmentOld);
+
+    return glGetError() == GL_NO_ERROR;
+}
+
 #endif // wxUSE_GLCANVAS
 
@@ -372,6 +372,13 @@ void wxGraphicsPath::GetBox(wxDouble *x, wxDouble *y, wxDouble *w, wxDouble *h)
     GetPathData()->GetBox(x,y,w,h);
 }
 
+void wxGraphicsPath::Compile()
+{
+    // Don't call AllocExclusive() here: compiling doesn't change the path,
+    // so the compiled data can be shared by all copies of it.
+    GetPathData()->Compile();
+}
+
 bool wxGraphicsPath::Contains( wxDouble x, wxDouble y, wxPolygonFillMode fillStyle ) const
 {
     return GetPathData()->Contains(x,y,fillStyle);
@@ -849,6 +856,114 @@ void wxGraphicsContext::StrokeLines( size_t n, const wxPoint2DDouble *beginPoint
     StrokePath( path );
 }
 
+void wxGraphicsContext::DrawRectangles( size_t n, const wxRect2DDouble *rects)
+{
+    if ( !n )
+        return;
+
+    wxGraphicsPath path = CreatePath();
+    for ( size_t i = 0; i < n; ++i )
+        path.AddRectangle(rects[i].m_x, rects[i].m_y,
+                          rects[i].m_width, rects[i].m_height);
+
+    // use winding rule to fill overlapping rectangles entirely
+    DrawPath( path, wxWINDING_RULE );
+}
+
+void wxGraphicsContext::DrawEllipses( size_t n, const wxRect2DDouble *rects)
+{
+    if ( !n )
+        return;
+
+    wxGraphicsPath path = CreatePath();
+    for ( size_t i = 0; i < n; ++i )
+        path.AddEllipse(rects[i].m_x, rects[i].m_y,
+                        rects[i].m_width, rects[i].m_height);
+
+    DrawPath( path, wxWINDING_RULE );
+}
+
+namespace
+{
+
+void AddMarkerToPath(wxGraphicsPath& path,
+                     const wxPoint2DDouble& centre,
+                     wxDouble size,
+                     wxMarkerShape shape)
+{
+    switch ( shape )
+    {
+        case wxMARKER_SQUARE:
+            path.AddRectangle(centre.m_x - size/2, centre.m_y - size/2,
+                              size, size);
+            break;
+
+        case wxMARKER_CIRCLE:
+            path.AddCircle(centre.m_x, centre.m_y, size/2);
+            break;
+    }
+}
+
+} // anonymous namespace
+
+void wxGraphicsContext::DrawMarkers( size_t n, const wxPoint2DDouble *centres,
+                                     wxDouble size,
+                                     wxMarkerShape shape,
+                                     const wxColour *colours)
+{
+    if ( !n )
+        return;
+
+    if ( !colours )
+    {
+        wxGraphicsPath path = CreatePath();
+        for ( size_t i = 0; i < n; ++i )
+            AddMarkerToPath(path, centres[i], size, shape);
+
+        DrawPath( path, wxWINDING_RULE );
+        return;
+    }
+
+    // Fill the consecutive markers of the same colour, which is typically the
+    // case for markers of the same data series, at once.
+    const wxGraphicsBrush formerBrush = m_brush;
+    for ( size_t i = 0; i < n; )
+    {
+        const wxColour& col = colours[i];
+
+        wxGraphicsPath path = CreatePath();
+        for ( ; i < n && colours[i] == col; ++i )
+            AddMarkerToPath(path, centres[i], size, shape);
+
+        SetBrush( wxBrush(col) );
+        FillPath( path, wxWINDING_RULE );
+    }
+    SetBrush( formerBrush );
+
+    if ( !m_pen.IsNull() )
+    {
+        wxGraphicsPath path = CreatePath();
+        for ( size_t i = 0; i < n; ++i )
+            AddMarkerToPath(path, centres[i], size, shape);
+
+        StrokePath( path );
+    }
+}
+
+void wxGraphicsContext::StrokeLineSegments( size_t n, const wxPoint2DDouble *points)
+{
+    if ( !n )
+        return;
+
+    wxGraphicsPath path = CreatePath();
+    for ( size_t i = 0; i < n; ++i, points += 2 )
+    {
+        path.MoveToPoint(points[0].m_x, points[0].m_y);
+        path.AddLineToPoint(points[1].m_x, points[1].m_y);
+    }
+    StrokePath( path );
+}
+
 // create a 'native' matrix corresponding to these values
 wxGraphicsMatrix wxGraphicsContext::CreateMatrix( wxDouble a, wxDouble b, wxDouble c, wxDouble d,
     wxDouble tx, wxDouble ty) const
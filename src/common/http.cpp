@@ -31,6 +31,57 @@
 #include "wx/wxcrt.h"
 
 
+// ----------------------------------------------------------------------------
+// wxHTTPStream: stream used for reading the response body
+// ----------------------------------------------------------------------------
+
+class wxHTTPStream : public wxSocketInputStream
+{
+public:
+    wxHTTP *m_http;
+    size_t m_httpsize;
+    size_t m_read_bytes;
+
+    // true if the body uses chunked transfer encoding
+    bool m_chunked;
+
+    // number of bytes remaining in the current chunk
+    size_t m_chunkLeft;
+
+    // true once the entire body has been read
+    bool m_complete;
+
+    wxHTTPStream(wxHTTP *http) : wxSocketInputStream(*http)
+    {
+        m_http = http;
+        m_httpsize = 0;
+        m_read_bytes = 0;
+        m_chunked = false;
+        m_chunkLeft = 0;
+        m_complete = false;
+    }
+
+    size_t GetSize() const override { return m_httpsize; }
+    virtual ~wxHTTPStream();
+
+    // called by wxHTTP when it can't be used by this stream any longer
+    void Detach() { m_http = nullptr; }
+
+    // read and discard the rest of the body, return true if it was read
+    // entirely, i.e. if the connection can be used for the next response
+    bool SkipBody();
+
+protected:
+    size_t OnSysRead(void *buffer, size_t bufsize) override;
+
+private:
+    // read the line with the size of the next chunk and, if it's the last
+    // one, the trailer following it
+    bool ReadChunkSize();
+
+    wxDECLARE_NO_COPY_CLASS(wxHTTPStream);
+};
+
 // ----------------------------------------------------------------------------
 // wxHTTP
 // ----------------------------------------------------------------------------
@@ -49,6 +100,11 @@ wxHTTP::wxHTTP()
 
 wxHTTP::~wxHTTP()
 {
+    // the stream must not be used after this object is destroyed, but at least
+    // avoid crashing if it is
+    if ( m_stream )
+        m_stream->Detach();
+
     ClearHeaders();
 
     delete m_addr;
@@ -98,6 +154,19 @@ wxHTTP::wxHeaderConstIterator wxHTTP::FindHeader(const wxString& header) const
     return it;
 }
 
+wxHTTP::wxHeaderConstIterator
+wxHTTP::FindRequestHeader(const wxString& header) const
+{
+    wxHeaderConstIterator it = m_requestHeaders.begin();
+    for ( wxHeaderConstIterator en = m_requestHeaders.end(); it != en; ++it )
+    {
+        if ( header.CmpNoCase(it->first) == 0 )
+            break;
+    }
+
+    return it;
+}
+
 wxHTTP::wxCookieIterator wxHTTP::FindCookie(const wxString& cookie)
 {
     wxCookieIterator it = m_cookies.begin();
@@ -124,20 +193,34 @@ wxHTTP::wxCookieConstIterator wxHTTP::FindCookie(const wxString& cookie) const
 
 void wxHTTP::SetHeader(const wxString& header, const wxString& h_data)
 {
+    // forget the headers of the previous response, GetHeader() returns the
+    // request headers again after this
     if (m_read) {
         ClearHeaders();
         m_read = false;
     }
 
-    wxHeaderIterator it = FindHeader(header);
-    if (it != m_headers.end())
-        it->second = h_data;
-    else
-        m_headers[header] = h_data;
+    for ( auto& kv : m_requestHeaders )
+    {
+        if ( header.CmpNoCase(kv.first) == 0 )
+        {
+            kv.second = h_data;
+            return;
+        }
+    }
+
+    m_requestHeaders[header] = h_data;
 }
 
 wxString wxHTTP::GetHeader(const wxString& header) const
 {
+    if ( !m_read )
+    {
+        wxHeaderConstIterator it = FindRequestHeader(header);
+
+        return it == m_requestHeaders.end() ? wxGetEmptyString() : it->second;
+    }
+
     wxHeaderConstIterator it = FindHeader(header);
 
     return it == m_headers.end() ? wxGetEmptyString() : it->second;
@@ -226,19 +309,6 @@ wxHTTP::SetPostText(const wxString& contentType,
     return true;
 }
 
-void wxHTTP::SendHeaders()
-{
-    wxString buf;
-
-    for ( const auto& kv : m_headers )
-    {
-        buf.Printf("%s: %s\r\n", kv.first, kv.second);
-
-        const wxWX2MBbuf cbuf = buf.mb_str();
-        Write(cbuf, strlen(cbuf));
-    }
-}
-
 bool wxHTTP::ParseHeaders()
 {
     wxString line;
@@ -329,101 +399,185 @@ bool wxHTTP::Connect(const wxSockAddress& addr, bool WXUNUSED(wait))
     return true;
 }
 
-bool wxHTTP::BuildRequest(const wxString& path, const wxString& method)
+bool wxHTTP::OpenConnection()
+{
+    // We set m_connected back to false so wxSocketBase will know what to do.
+#ifdef __WXMAC__
+    wxSocketClient::Connect(*m_addr , false );
+    wxSocketClient::WaitOnConnect(10);
+
+    if (!wxSocketClient::IsConnected())
+        return false;
+#else
+    if (!wxProtocol::Connect(*m_addr))
+        return false;
+#endif
+
+    // Discard any data remaining from the previous connection, nothing can
+    // have been received on the new one yet as we didn't send anything.
+    Discard();
+
+    m_canReuse = m_keepAlive;
+
+    return true;
+}
+
+bool wxHTTP::WriteRequest(const wxString& path, const wxString& method)
 {
-    // Use the data in the post buffer, if any.
-    if ( !m_postBuffer.IsEmpty() )
+    // Use HTTP/1.1 for persistent connections, as HTTP/1.0 ones are closed by
+    // default.
+    wxString buf;
+    buf.Printf(wxT("%s %s HTTP/1.%d\r\n"), method, path, m_keepAlive ? 1 : 0);
+
+    // Content length must be correct, so always set it if we have anything to
+    // post, possibly overriding the value set explicitly by SetHeader().
+    const bool hasPostData = !m_postBuffer.IsEmpty();
+
+    // Also override the authorization header if we have the credentials.
+    const bool hasAuth = !m_username.empty() || !m_password.empty();
+
+    for ( const auto& kv : m_requestHeaders )
     {
-        wxString len;
-        len << m_postBuffer.GetDataLen();
+        if ( hasPostData && kv.first.CmpNoCase(wxS("Content-Length")) == 0 )
+            continue;
 
-        // Content length must be correct, so always set, possibly
-        // overriding the value set explicitly by a previous call to
-        // SetHeader("Content-Length").
-        SetHeader(wxS("Content-Length"), len);
+        if ( hasAuth && kv.first.CmpNoCase(wxS("Authorization")) == 0 )
+            continue;
+
+        buf << kv.first << wxS(": ") << kv.second << wxS("\r\n");
+    }
+
+    if ( hasPostData )
+    {
+        buf << wxS("Content-Length: ") << m_postBuffer.GetDataLen() << wxS("\r\n");
 
         // However if the user had explicitly set the content type, don't
         // override it with the content type passed to SetPostText().
-        if ( !m_contentType.empty() && GetContentType().empty() )
-            SetHeader(wxS("Content-Type"), m_contentType);
+        if ( !m_contentType.empty() &&
+                FindRequestHeader(wxS("Content-Type")) == m_requestHeaders.end() )
+        {
+            buf << wxS("Content-Type: ") << m_contentType << wxS("\r\n");
+        }
     }
 
-    m_http_response = 0;
-
     // If there is no User-Agent defined, define it.
-    if ( GetHeader(wxT("User-Agent")).empty() )
-        SetHeader(wxT("User-Agent"), wxVERSION_STRING);
+    if ( FindRequestHeader(wxS("User-Agent")) == m_requestHeaders.end() )
+        buf << wxS("User-Agent: ") << wxVERSION_STRING << wxS("\r\n");
 
     // Send authentication information
-    if (!m_username.empty() || !m_password.empty()) {
-        SetHeader(wxT("Authorization"), GenerateAuthString(m_username, m_password));
+    if ( hasAuth )
+    {
+        buf << wxS("Authorization: ")
+            << GenerateAuthString(m_username, m_password) << wxS("\r\n");
     }
 
-    wxString buf;
-    buf.Printf(wxT("%s %s HTTP/1.0\r\n"), method, path);
-    const wxWX2MBbuf pathbuf = buf.mb_str();
-    Write(pathbuf, strlen(pathbuf));
-    SendHeaders();
-    Write("\r\n", 2);
+    buf << wxS("\r\n");
+
+    // Write all the headers at once to avoid sending many small packets.
+    const wxWX2MBbuf cbuf = buf.mb_str();
+    Write(cbuf, strlen(cbuf));
 
-    if ( !m_postBuffer.IsEmpty() ) {
+    if ( hasPostData && !Error() ) {
         Write(m_postBuffer.GetData(), m_postBuffer.GetDataLen());
 
         m_postBuffer.Clear();
     }
 
-    wxString tmp_str;
-    m_lastError = ReadLine(this, tmp_str);
-    if (m_lastError != wxPROTO_NOERR)
-        return false;
+    return !Error();
+}
 
-    if (!tmp_str.Contains(wxT("HTTP/"))) {
-        // TODO: support HTTP v0.9 which can have no header.
-        // FIXME: tmp_str is not put back in the in-queue of the socket.
-        m_lastError = wxPROTO_NOERR;
-        SetHeader(wxT("Content-Length"), wxT("-1"));
-        SetHeader(wxT("Content-Type"), wxT("none/none"));
-        RestoreState();
-        return true;
-    }
+bool wxHTTP::ReadResponseHeaders()
+{
+    m_http_response = 0;
 
-    wxStringTokenizer token(tmp_str,wxT(' '));
-    wxString tmp_str2;
-    bool ret_value;
+    for ( ;; )
+    {
+        wxString tmp_str;
+        m_lastError = ReadLine(this, tmp_str);
+        if (m_lastError != wxPROTO_NOERR)
+            return false;
 
-    token.NextToken();
-    tmp_str2 = token.NextToken();
+        if (!tmp_str.Contains(wxT("HTTP/"))) {
+            // TODO: support HTTP v0.9 which can have no header.
+            // FIXME: tmp_str is not put back in the in-queue of the socket.
+            ClearHeaders();
+            ClearCookies();
+            m_read = true;
 
-    m_http_response = wxAtoi(tmp_str2);
+            m_headers[wxT("Content-Length")] = wxT("-1");
+            m_headers[wxT("Content-Type")] = wxT("none/none");
 
-    switch ( tmp_str2[0u].GetValue() )
-    {
-        case wxT('1'):
-            /* INFORMATION / SUCCESS */
-            break;
+            // The body lasts until the connection is closed.
+            m_canReuse = false;
 
-        case wxT('2'):
-            /* SUCCESS */
-            break;
+            m_lastError = wxPROTO_NOERR;
+            RestoreState();
+            return true;
+        }
 
-        case wxT('3'):
-            /* REDIRECTION */
-            break;
+        wxStringTokenizer token(tmp_str,wxT(' '));
+        const wxString version = token.NextToken();
+        const wxString code = token.NextToken();
 
-        default:
-            m_lastError = wxPROTO_NOFILE;
-            RestoreState();
+        m_http_response = wxAtoi(code);
+
+        if ( !ParseHeaders() )
             return false;
-    }
 
-    m_lastError = wxPROTO_NOERR;
-    ret_value = ParseHeaders();
+        // Skip the interim responses, such as "100 Continue", but not "101
+        // Switching Protocols" which is the final one.
+        if ( m_http_response >= 100 && m_http_response < 200 &&
+                m_http_response != 101 )
+            continue;
+
+        // HTTP/1.1 connections are persistent unless the server closes them
+        // explicitly, while HTTP/1.0 ones are closed unless it keeps them.
+        if ( m_canReuse )
+        {
+            const wxString connection = GetHeader(wxS("Connection")).Lower();
+            if ( version == wxS("HTTP/1.0") )
+                m_canReuse = connection.Contains(wxS("keep-alive"));
+            else
+                m_canReuse = !connection.Contains(wxS("close"));
+        }
 
-    return ret_value;
+        switch ( code.empty() ? wxT('0') : code[0u].GetValue() )
+        {
+            case wxT('1'):
+                /* INFORMATION / SUCCESS */
+                break;
+
+            case wxT('2'):
+                /* SUCCESS */
+                break;
+
+            case wxT('3'):
+                /* REDIRECTION */
+                break;
+
+            default:
+                m_lastError = wxPROTO_NOFILE;
+                RestoreState();
+                return false;
+        }
+
+        m_lastError = wxPROTO_NOERR;
+        return true;
+    }
 }
 
 bool wxHTTP::Abort()
 {
+    if ( m_stream )
+    {
+        m_stream->Detach();
+        m_stream = nullptr;
+    }
+
+    // The responses to the pending requests are lost.
+    m_pendingMethods.clear();
+    m_canReuse = false;
+
     return wxSocketClient::Close();
 }
 
@@ -431,73 +585,212 @@ bool wxHTTP::Abort()
 // wxHTTPStream and wxHTTP::GetInputStream
 // ----------------------------------------------------------------------------
 
-class wxHTTPStream : public wxSocketInputStream
+wxHTTPStream::~wxHTTPStream()
 {
-public:
-    wxHTTP *m_http;
-    size_t m_httpsize;
-    unsigned long m_read_bytes;
+    if ( !m_http )
+        return;
 
-    wxHTTPStream(wxHTTP *http) : wxSocketInputStream(*http)
+    m_http->m_stream = nullptr;
+
+    // We need to skip the rest of this response to get to the next one, if
+    // we have any.
+    if ( !m_complete && m_http->m_canReuse && m_http->GetPendingRequestsCount() )
+        SkipBody();
+
+    // Otherwise just close the connection, unless it can be reused.
+    if ( !m_complete || !m_http->m_canReuse )
+        m_http->Abort();
+}
+
+bool wxHTTPStream::ReadChunkSize()
+{
+    // chunk          = chunk-size [ chunk-ext ] CRLF chunk-data CRLF
+    // last-chunk     = 1*("0") [ chunk-ext ] CRLF
+    wxString line;
+    if ( wxProtocol::ReadLine(m_http, line) != wxPROTO_NOERR )
+        return false;
+
+    wxULongLong_t size;
+    if ( !line.BeforeFirst(';').Trim().ToULongLong(&size, 16) )
+        return false;
+
+    if ( size )
     {
-        m_http = http;
-        m_httpsize = 0;
-        m_read_bytes = 0;
+        m_chunkLeft = static_cast<size_t>(size);
+        return true;
     }
 
-    size_t GetSize() const override { return m_httpsize; }
-    virtual ~wxHTTPStream() { m_http->Abort(); }
+    // The last chunk is followed by the (usually empty) trailer section which
+    // is terminated by an empty line.
+    do
+    {
+        if ( wxProtocol::ReadLine(m_http, line) != wxPROTO_NOERR )
+            return false;
+    }
+    while ( !line.empty() );
 
-protected:
-    size_t OnSysRead(void *buffer, size_t bufsize) override;
+    m_complete = true;
 
-    wxDECLARE_NO_COPY_CLASS(wxHTTPStream);
-};
+    return true;
+}
+
+bool wxHTTPStream::SkipBody()
+{
+    char buf[4096];
+    while ( !m_complete )
+    {
+        OnSysRead(buf, sizeof(buf));
+        if ( m_lasterror != wxSTREAM_NO_ERROR )
+            break;
+    }
+
+    return m_complete;
+}
 
 size_t wxHTTPStream::OnSysRead(void *buffer, size_t bufsize)
 {
-    if (m_read_bytes >= m_httpsize)
+    if ( m_complete )
     {
         m_lasterror = wxSTREAM_EOF;
         return 0;
     }
 
+    if ( !m_http )
+    {
+        m_lasterror = wxSTREAM_READ_ERROR;
+        return 0;
+    }
+
+    // Never read more than the rest of the body, as the connection may be
+    // used for the next response.
+    if ( m_chunked )
+    {
+        if ( !m_chunkLeft )
+        {
+            if ( !ReadChunkSize() )
+            {
+                m_lasterror = wxSTREAM_READ_ERROR;
+                return 0;
+            }
+
+            if ( m_complete )
+            {
+                m_lasterror = wxSTREAM_EOF;
+                return 0;
+            }
+        }
+
+        if ( bufsize > m_chunkLeft )
+            bufsize = m_chunkLeft;
+    }
+    else if ( m_httpsize != (size_t)-1 )
+    {
+        if ( bufsize > m_httpsize - m_read_bytes )
+            bufsize = m_httpsize - m_read_bytes;
+    }
+
     size_t ret = wxSocketInputStream::OnSysRead(buffer, bufsize);
     m_read_bytes += ret;
 
-    if (m_httpsize==(size_t)-1 && m_lasterror == wxSTREAM_READ_ERROR )
+    if ( m_chunked )
+    {
+        m_chunkLeft -= ret;
+
+        // Each chunk data is followed by CRLF.
+        if ( !m_chunkLeft && m_lasterror == wxSTREAM_NO_ERROR )
+        {
+            wxString line;
+            if ( wxProtocol::ReadLine(m_http, line) != wxPROTO_NOERR ||
+                    !line.empty() )
+                m_lasterror = wxSTREAM_READ_ERROR;
+        }
+    }
+    else if ( m_httpsize == (size_t)-1 )
     {
         // if m_httpsize is (size_t) -1 this means read until connection closed
         // which is equivalent to getting a READ_ERROR, for clients however this
         // must be translated into EOF, as it is the expected way of signalling
         // end of the content
-        m_lasterror = wxSTREAM_EOF;
+        if ( m_lasterror == wxSTREAM_READ_ERROR )
+            m_lasterror = wxSTREAM_EOF;
+
+        if ( m_lasterror == wxSTREAM_EOF )
+            m_complete = true;
+    }
+    else if ( m_read_bytes == m_httpsize )
+    {
+        m_complete = true;
     }
 
     return ret;
 }
 
-wxInputStream *wxHTTP::GetInputStream(const wxString& path)
+wxHTTPStream *wxHTTP::CreateStream(const wxString& method)
 {
-    wxHTTPStream *inp_stream;
+    wxHTTPStream* const stream = new wxHTTPStream(this);
+
+    // Responses to HEAD requests, informational, "204 No Content" and "304
+    // Not Modified" responses never have any body, see RFC 9112 6.3.
+    if ( method == wxS("HEAD") ||
+            (m_http_response >= 100 && m_http_response < 200 &&
+                m_http_response != 101) ||
+                m_http_response == 204 ||
+                m_http_response == 304 )
+    {
+        stream->m_complete = true;
+    }
+    else if ( GetHeader(wxS("Transfer-Encoding")).Lower().Contains(wxS("chunked")) )
+    {
+        stream->m_chunked = true;
+        stream->m_httpsize = (size_t)-1;
+    }
+    else
+    {
+        wxULongLong_t size;
+        if ( GetHeader(wxS("Content-Length")).ToULongLong(&size) )
+        {
+            stream->m_httpsize = static_cast<size_t>(size);
+            stream->m_complete = size == 0;
+        }
+        else
+        {
+            // The body ends when the connection is closed, so it can't be
+            // reused.
+            stream->m_httpsize = (size_t)-1;
+            m_canReuse = false;
+        }
+    }
+
+    m_stream = stream;
 
-    wxString new_path;
+    return stream;
+}
 
+bool wxHTTP::SendRequest(const wxString& path)
+{
     m_lastError = wxPROTO_CONNERR;  // all following returns share this type of error
     if (!m_addr)
-        return nullptr;
+        return false;
 
-    // We set m_connected back to false so wxSocketBase will know what to do.
-#ifdef __WXMAC__
-    wxSocketClient::Connect(*m_addr , false );
-    wxSocketClient::WaitOnConnect(10);
+    if ( !m_keepAlive || !m_canReuse || !IsConnected() )
+    {
+        // The connection can't be used for any more requests and the responses
+        // to the ones already sent must be read before opening a new one.
+        if ( !m_pendingMethods.empty() )
+        {
+            m_lastError = wxPROTO_NETERR;
+            return false;
+        }
 
-    if (!wxSocketClient::IsConnected())
-        return nullptr;
-#else
-    if (!wxProtocol::Connect(*m_addr))
-        return nullptr;
-#endif
+        if ( m_stream )
+        {
+            m_stream->Detach();
+            m_stream = nullptr;
+        }
+
+        if ( !OpenConnection() )
+            return false;
+    }
 
     // Use the user-specified method if any or determine the method to use
     // automatically depending on whether we have anything to post or not.
@@ -505,20 +798,109 @@ wxInputStream *wxHTTP::GetInputStream(const wxString& path)
     if (method.empty())
         method = m_postBuffer.IsEmpty() ? wxS("GET"): wxS("POST");
 
-    if (!BuildRequest(path, method))
-        return nullptr;
+    if ( !WriteRequest(path, method) )
+    {
+        m_lastError = wxPROTO_NETERR;
+        Abort();
+        return false;
+    }
 
-    inp_stream = new wxHTTPStream(this);
+    m_pendingMethods.push_back(method);
 
-    if (!GetHeader(wxT("Content-Length")).empty())
-        inp_stream->m_httpsize = wxAtoi(GetHeader(wxT("Content-Length")));
-    else
-        inp_stream->m_httpsize = (size_t)-1;
+    m_lastError = wxPROTO_NOERR;
+    return true;
+}
+
+wxInputStream *wxHTTP::ReadResponse()
+{
+    wxCHECK_MSG( !m_pendingMethods.empty(), nullptr,
+                 "SendRequest() must be called first" );
 
-    inp_stream->m_read_bytes = 0;
+    // The rest of the previous response must be skipped to get to this one.
+    if ( m_stream )
+    {
+        wxHTTPStream* const stream = m_stream;
+        m_stream = nullptr;
+
+        const bool skipped = stream->SkipBody();
+        stream->Detach();
+
+        if ( !skipped )
+        {
+            Abort();
+            m_lastError = wxPROTO_NETERR;
+            return nullptr;
+        }
+    }
+
+    const wxString method = m_pendingMethods.front();
+    m_pendingMethods.pop_front();
+
+    if ( !ReadResponseHeaders() )
+    {
+        if ( m_lastError == wxPROTO_NOFILE && m_canReuse )
+        {
+            // Skip the body of the error response to allow reusing the
+            // connection, the stream closes it if this fails.
+            wxHTTPStream* const stream = CreateStream(method);
+            stream->SkipBody();
+            delete stream;
+
+            m_lastError = wxPROTO_NOFILE;
+        }
+        else
+        {
+            const wxProtocolError error = m_lastError;
+            Abort();
+            m_lastError = error;
+        }
+
+        return nullptr;
+    }
+
+    wxHTTPStream* const stream = CreateStream(method);
 
     // no error; reset m_lastError
     m_lastError = wxPROTO_NOERR;
+    return stream;
+}
+
+wxInputStream *wxHTTP::GetInputStream(const wxString& path)
+{
+    wxCHECK_MSG( m_pendingMethods.empty(), nullptr,
+                 "ReadResponse() must be used after SendRequest()" );
+
+    m_http_response = 0;
+
+    // The connection can't be reused if the previous response wasn't read
+    // entirely, as this would require reading the rest of it.
+    if ( m_stream )
+    {
+        if ( !m_stream->m_complete )
+            m_canReuse = false;
+
+        m_stream->Detach();
+        m_stream = nullptr;
+    }
+
+    // When reusing the connection, the server could have already closed it,
+    // so retry with a new one if we didn't get any response.
+    const bool reusing = m_keepAlive && m_canReuse && IsConnected();
+    const wxMemoryBuffer postBuffer(m_postBuffer);
+
+    wxInputStream *inp_stream = nullptr;
+    if ( SendRequest(path) )
+        inp_stream = ReadResponse();
+
+    if ( !inp_stream && reusing && !m_http_response )
+    {
+        Abort();
+
+        m_postBuffer = postBuffer;
+        if ( SendRequest(path) )
+            inp_stream = ReadResponse();
+    }
+
     return inp_stream;
 }
 
@@ -0,0 +1,757 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        src/common/httpcache.cpp
+// Purpose:     wxHTTPCache implementation
+// Author:      wxWidgets team
+// Created:     2026-10-14
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+// For compilers that support precompilation, includes "wx.h".
+#include "wx/wxprec.h"
+
+#if wxUSE_FILE
+
+#include "wx/httpcache.h"
+
+#ifndef WX_PRECOMP
+    #include "wx/log.h"
+#endif
+
+#include "wx/datetime.h"
+#include "wx/dir.h"
+#include "wx/file.h"
+#include "wx/filename.h"
+#include "wx/thread.h"
+#include "wx/tokenzr.h"
+
+#include <algorithm>
+#include <ctime>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Trace mask used for the messages in this file.
+#define wxTRACE_HTTPCACHE "httpcache"
+
+namespace
+{
+
+// Signature at the start of all cache files, including the format version.
+const char CACHE_FILE_SIGNATURE[] = "wxHTTPCache 1\n";
+
+const char CACHE_FILE_EXT[] = "wxcache";
+
+// Freshness lifetime used for the responses without any explicit expiration
+// time is 10% of the time since their last modification, but not more than
+// this, as recommended by RFC 9111.
+const time_t MAX_HEURISTIC_LIFETIME = 24*60*60;
+
+// Return the time corresponding to the HTTP date or -1 if it's invalid.
+time_t ParseHTTPDate(const wxString& str)
+{
+#if wxUSE_DATETIME
+    wxDateTime dt;
+    wxString::const_iterator end;
+    if ( !str.empty() && dt.ParseRfc822Date(str, &end) )
+        return dt.GetTicks();
+#else // !wxUSE_DATETIME
+    wxUnusedVar(str);
+#endif // wxUSE_DATETIME/!wxUSE_DATETIME
+
+    return -1;
+}
+
+// Return the hexadecimal FNV-1a hash of the URL used as the file name.
+wxString GetURLHash(const wxString& url)
+{
+    const wxScopedCharBuffer utf8 = url.utf8_str();
+
+    wxUint64 hash = wxULL(14695981039346656037);
+    for ( size_t n = 0; n < utf8.length(); n++ )
+    {
+        hash ^= static_cast<unsigned char>(utf8.data()[n]);
+        hash *= wxULL(1099511628211);
+    }
+
+    return wxString::Format("%016" wxLongLongFmtSpec "x",
+                            static_cast<wxULongLong_t>(hash));
+}
+
+} // anonymous namespace
+
+// ----------------------------------------------------------------------------
+// wxHTTPCacheImpl
+// ----------------------------------------------------------------------------
+
+class wxHTTPCacheImpl
+{
+public:
+    wxHTTPCacheImpl(const wxString& dir, size_t maxSize)
+        : m_dir(dir),
+          m_maxSize(maxSize)
+    {
+        if ( !m_dir.empty() )
+            LoadIndex();
+    }
+
+    // Information about a single cached response.
+    struct Item
+    {
+        wxString url;
+        wxString contentType;
+        wxString eTag;
+        wxString lastModified;
+
+        // Time after which the response is stale.
+        time_t expires = 0;
+
+        // True if the response must always be revalidated ("no-cache").
+        bool revalidate = false;
+
+        size_t size = 0;
+
+        // Only valid if inMemory is true.
+        wxMemoryBuffer data;
+        bool inMemory = false;
+    };
+
+    // Items in the most recently used first order.
+    using Items = std::list<Item>;
+
+
+    wxHTTPCache::Status Find(const wxString& url, wxHTTPCacheEntry* entry);
+
+    bool Store(const wxString& url,
+               const wxHTTPCache::HeaderGetter& getHeader,
+               const void* data, size_t size);
+
+    bool Revalidate(const wxString& url,
+                    const wxHTTPCache::HeaderGetter& getHeader,
+                    wxHTTPCacheEntry* entry);
+
+    void Remove(const wxString& url);
+    void Clear();
+
+    // Remove the least recently used items until the total size fits.
+    void Trim();
+
+    // Discard the data of the least recently used items from memory, while
+    // still keeping them on disk, until the memory size fits.
+    void TrimMemory();
+
+
+    wxCriticalSection m_cs;
+
+    const wxString m_dir;
+
+    size_t m_maxSize;
+    size_t m_maxMemorySize = 8*1024*1024;
+
+    // Total size of all items and of those with the data in memory.
+    size_t m_size = 0;
+    size_t m_memorySize = 0;
+
+    Items m_items;
+    std::unordered_map<wxString, Items::iterator> m_index;
+
+private:
+    // Compute the freshness of the response with the given headers, return
+    // false if it must not be stored at all.
+    static bool
+    GetFreshness(const wxHTTPCache::HeaderGetter& getHeader, Item& item);
+
+    static void FillEntry(const Item& item, wxHTTPCacheEntry* entry);
+
+    wxString GetFileName(const wxString& url) const;
+
+    // Read all the cache files in the directory.
+    void LoadIndex();
+
+    // Read the header of the cache file and, optionally, its data.
+    static bool ReadFile(const wxString& path, Item& item, bool withData);
+
+    // Write the item, which must have its data in memory, to disk.
+    bool WriteFile(const Item& item) const;
+
+    // Load the data of the item from disk if necessary.
+    bool EnsureInMemory(Item& item);
+
+    // Make the item the most recently used one.
+    void Touch(Items::iterator it) { m_items.splice(m_items.begin(), m_items, it); }
+
+    void AddItem(const Item& item);
+    void RemoveItem(Items::iterator it, bool deleteFile = true);
+};
+
+/* static */
+bool
+wxHTTPCacheImpl::GetFreshness(const wxHTTPCache::HeaderGetter& getHeader,
+                              Item& item)
+{
+    item.revalidate = false;
+
+    long maxAge = -1;
+
+    const wxString cacheControl = getHeader("Cache-Control");
+    wxStringTokenizer tk(cacheControl, ",");
+    while ( tk.HasMoreTokens() )
+    {
+        wxString directive = tk.GetNextToken();
+        directive.Trim().Trim(false).MakeLower();
+
+        wxString value;
+        if ( directive == "no-store" )
+            return false;
+        else if ( directive == "no-cache" )
+            item.revalidate = true;
+        else if ( directive.StartsWith("max-age=", &value) )
+        {
+            value.Replace("\"", wxString());
+            if ( !value.ToLong(&maxAge) || maxAge < 0 )
+                maxAge = 0;
+        }
+    }
+
+    // HTTP/1.0 servers may use this instead of "Cache-Control: no-cache".
+    if ( cacheControl.empty() &&
+            getHeader("Pragma").Lower().Contains("no-cache") )
+        item.revalidate = true;
+
+    // We key the responses by their URL only, so we can't store responses
+    // that may differ for reasons that are not expressed in the headers.
+    if ( getHeader("Vary").Trim().Trim(false) == "*" )
+        return false;
+
+    const time_t now = time(nullptr);
+
+    time_t date = ParseHTTPDate(getHeader("Date"));
+    if ( date == -1 )
+        date = now;
+
+    long age = 0;
+    if ( !getHeader("Age").ToLong(&age) || age < 0 )
+        age = 0;
+
+    time_t lifetime = 0;
+    if ( maxAge != -1 )
+    {
+        lifetime = maxAge;
+    }
+    else
+    {
+        const wxString expires = getHeader("Expires");
+        if ( !expires.empty() )
+        {
+            // Invalid dates, such as "0", mean that it's already expired.
+            const time_t expiresTime = ParseHTTPDate(expires);
+            if ( expiresTime != -1 )
+                lifetime = expiresTime - date;
+        }
+        else
+        {
+            const time_t lastModified = ParseHTTPDate(item.lastModified);
+            if ( lastModified != -1 && lastModified < date )
+            {
+                lifetime = wxMin((date - lastModified) / 10,
+                                 MAX_HEURISTIC_LIFETIME);
+            }
+        }
+    }
+
+    item.expires = now + lifetime - age;
+
+    return true;
+}
+
+/* static */
+void wxHTTPCacheImpl::FillEntry(const Item& item, wxHTTPCacheEntry* entry)
+{
+    if ( !entry )
+        return;
+
+    entry->data = item.data;
+    entry->contentType = item.contentType;
+    entry->eTag = item.eTag;
+    entry->lastModified = item.lastModified;
+}
+
+wxString wxHTTPCacheImpl::GetFileName(const wxString& url) const
+{
+    return wxFileName(m_dir, GetURLHash(url), CACHE_FILE_EXT).GetFullPath();
+}
+
+void wxHTTPCacheImpl::LoadIndex()
+{
+    if ( !wxFileName::Mkdir(m_dir, wxS_DIR_DEFAULT, wxPATH_MKDIR_FULL) )
+        return;
+
+    wxDir dir(m_dir);
+    if ( !dir.IsOpened() )
+        return;
+
+    // Use the modification time of the files as the approximation of the time
+    // of their last use, as we don't update them when reading.
+    std::vector< std::pair<time_t, Item> > items;
+
+    wxString name;
+    const wxString spec = wxString("*.") + CACHE_FILE_EXT;
+    for ( bool cont = dir.GetFirst(&name, spec, wxDIR_FILES);
+          cont;
+          cont = dir.GetNext(&name) )
+    {
+        const wxString path = wxFileName(m_dir, name).GetFullPath();
+
+        Item item;
+        if ( !ReadFile(path, item, false) || GetFileName(item.url) != path )
+        {
+            wxLogTrace(wxTRACE_HTTPCACHE, "Removing invalid file \"%s\"", path);
+            wxRemoveFile(path);
+            continue;
+        }
+
+        items.push_back(std::make_pair(wxFileModificationTime(path), item));
+    }
+
+    std::stable_sort(items.begin(), items.end(),
+                     [](const std::pair<time_t, Item>& a,
+                        const std::pair<time_t, Item>& b)
+                     {
+                        return a.first > b.first;
+                     });
+
+    for ( const auto& p : items )
+    {
+        const Item& item = p.second;
+
+        m_index[item.url] = m_items.insert(m_items.end(), item);
+        m_size += item.size;
+    }
+
+    wxLogTrace(wxTRACE_HTTPCACHE, "Loaded %zu entries (%zu bytes) from \"%s\"",
+               m_items.size(), m_size, m_dir);
+
+    Trim();
+}
+
+/* static */
+bool wxHTTPCacheImpl::ReadFile(const wxString& path, Item& item, bool withData)
+{
+    wxFile file;
+    if ( !file.Open(path) )
+        return false;
+
+    // Read until the empty line terminating the header.
+    std::string header;
+    size_t posEnd;
+    for ( ;; )
+    {
+        char buf[1024];
+        const ssize_t count = file.Read(buf, sizeof(buf));
+        if ( count <= 0 )
+            return false;
+
+        header.append(buf, count);
+
+        posEnd = header.find("\n\n");
+        if ( posEnd != std::string::npos )
+            break;
+
+        // Don't read arbitrarily big files not created by us.
+        if ( header.length() > 64*1024 )
+            return false;
+    }
+
+    const size_t sigLen = strlen(CACHE_FILE_SIGNATURE);
+    if ( header.compare(0, sigLen, CACHE_FILE_SIGNATURE) != 0 )
+        return false;
+
+    bool hasSize = false;
+    for ( size_t pos = sigLen; pos <= posEnd; )
+    {
+        const size_t eol = header.find('\n', pos);
+        const wxString line = wxString::FromUTF8(header.data() + pos, eol - pos);
+        pos = eol + 1;
+
+        wxString value;
+        if ( line.StartsWith("URL: ", &value) )
+            item.url = value;
+        else if ( line.StartsWith("Content-Type: ", &value) )
+            item.contentType = value;
+        else if ( line.StartsWith("ETag: ", &value) )
+            item.eTag = value;
+        else if ( line.StartsWith("Last-Modified: ", &value) )
+            item.lastModified = value;
+        else if ( line.StartsWith("Expires: ", &value) )
+        {
+            wxLongLong_t expires;
+            if ( !value.ToLongLong(&expires) )
+                return false;
+            item.expires = static_cast<time_t>(expires);
+        }
+        else if ( line.StartsWith("Revalidate: ", &value) )
+            item.revalidate = value == "1";
+        else if ( line.StartsWith("Size: ", &value) )
+        {
+            wxULongLong_t size;
+            if ( !value.ToULongLong(&size) )
+                return false;
+            item.size = static_cast<size_t>(size);
+            hasSize = true;
+        }
+    }
+
+    const wxFileOffset dataOffset = posEnd + 2;
+    if ( item.url.empty() || !hasSize ||
+            file.Length() != dataOffset + static_cast<wxFileOffset>(item.size) )
+        return false;
+
+    if ( withData )
+    {
+        if ( file.Seek(dataOffset) != dataOffset )
+            return false;
+
+        wxMemoryBuffer data(item.size);
+        if ( file.Read(data.GetWriteBuf(item.size), item.size) !=
+                static_cast<ssize_t>(item.size) )
+            return false;
+        data.UngetWriteBuf(item.size);
+
+        item.data = data;
+    }
+
+    return true;
+}
+
+bool wxHTTPCacheImpl::WriteFile(const Item& item) const
+{
+    wxTempFile file(GetFileName(item.url));
+    if ( !file.IsOpened() )
+        return false;
+
+    wxString header(CACHE_FILE_SIGNATURE);
+    header << "URL: " << item.url << "\n";
+    if ( !item.contentType.empty() )
+        header << "Content-Type: " << item.contentType << "\n";
+    if ( !item.eTag.empty() )
+        header << "ETag: " << item.eTag << "\n";
+    if ( !item.lastModified.empty() )
+        header << "Last-Modified: " << item.lastModified << "\n";
+    header << "Expires: "
+           << wxString::Format("%" wxLongLongFmtSpec "d",
+                               static_cast<wxLongLong_t>(item.expires))
+           << "\n";
+    if ( item.revalidate )
+        header << "Revalidate: 1\n";
+    header << "Size: " << item.size << "\n\n";
+
+    const wxScopedCharBuffer utf8 = header.utf8_str();
+
+    return file.Write(utf8.data(), utf8.length()) &&
+           file.Write(item.data.GetData(), item.size) &&
+           file.Commit();
+}
+
+bool wxHTTPCacheImpl::EnsureInMemory(Item& item)
+{
+    if ( item.inMemory )
+        return true;
+
+    if ( !ReadFile(GetFileName(item.url), item, true) )
+        return false;
+
+    item.inMemory = true;
+    m_memorySize += item.size;
+
+    return true;
+}
+
+void wxHTTPCacheImpl::AddItem(const Item& item)
+{
+    m_items.push_front(item);
+    m_index[item.url] = m_items.begin();
+
+    m_size += item.size;
+    m_memorySize += item.size;
+}
+
+void wxHTTPCacheImpl::RemoveItem(Items::iterator it, bool deleteFile)
+{
+    if ( deleteFile && !m_dir.empty() )
+        wxRemoveFile(GetFileName(it->url));
+
+    m_size -= it->size;
+    if ( it->inMemory )
+        m_memorySize -= it->size;
+
+    m_index.erase(it->url);
+    m_items.erase(it);
+}
+
+void wxHTTPCacheImpl::Trim()
+{
+    while ( m_size > m_maxSize )
+    {
+        wxLogTrace(wxTRACE_HTTPCACHE, "Evicting \"%s\"", m_items.back().url);
+
+        RemoveItem(std::prev(m_items.end()));
+    }
+}
+
+void wxHTTPCacheImpl::TrimMemory()
+{
+    // Without the directory all items are in memory and Trim() is enough.
+    if ( m_dir.empty() )
+        return;
+
+    for ( Items::reverse_iterator it = m_items.rbegin();
+          it != m_items.rend() && m_memorySize > m_maxMemorySize;
+          ++it )
+    {
+        if ( it->inMemory )
+        {
+            it->data = wxMemoryBuffer();
+            it->inMemory = false;
+            m_memorySize -= it->size;
+        }
+    }
+}
+
+wxHTTPCache::Status
+wxHTTPCacheImpl::Find(const wxString& url, wxHTTPCacheEntry* entry)
+{
+    const auto i = m_index.find(url);
+    if ( i == m_index.end() )
+        return wxHTTPCache::Status_Miss;
+
+    const Items::iterator it = i->second;
+    Item& item = *it;
+    if ( !EnsureInMemory(item) )
+    {
+        wxLogTrace(wxTRACE_HTTPCACHE, "Failed to read \"%s\"", url);
+
+        // Don't delete the file, it could belong to another URL with the
+        // same hash.
+        RemoveItem(it, false);
+        return wxHTTPCache::Status_Miss;
+    }
+
+    Touch(it);
+    FillEntry(item, entry);
+
+    const bool fresh = !item.revalidate && time(nullptr) < item.expires;
+
+    TrimMemory();
+
+    return fresh ? wxHTTPCache::Status_Fresh : wxHTTPCache::Status_Stale;
+}
+
+bool
+wxHTTPCacheImpl::Store(const wxString& url,
+                       const wxHTTPCache::HeaderGetter& getHeader,
+                       const void* data, size_t size)
+{
+    const auto i = m_index.find(url);
+    if ( i != m_index.end() )
+    {
+        // The file, if any, will be overwritten below, unless we can't store
+        // the new response at all, in which case the old one is useless.
+        RemoveItem(i->second, true);
+    }
+
+    Item item;
+    item.url = url;
+    item.contentType = getHeader("Content-Type");
+    item.eTag = getHeader("ETag");
+    item.lastModified = getHeader("Last-Modified");
+    item.size = size;
+
+    if ( !GetFreshness(getHeader, item) || size > m_maxSize )
+        return false;
+
+    // There is no point in storing the responses that can't be used without
+    // contacting the server and can't be revalidated either.
+    if ( item.expires <= time(nullptr) &&
+            item.eTag.empty() && item.lastModified.empty() )
+        return false;
+
+    item.data.AppendData(data, size);
+    item.inMemory = true;
+
+    if ( !m_dir.empty() && !WriteFile(item) )
+    {
+        wxLogTrace(wxTRACE_HTTPCACHE, "Failed to write \"%s\"", url);
+        return false;
+    }
+
+    wxLogTrace(wxTRACE_HTTPCACHE, "Storing \"%s\" (%zu bytes)", url, size);
+
+    AddItem(item);
+
+    Trim();
+    TrimMemory();
+
+    return true;
+}
+
+bool
+wxHTTPCacheImpl::Revalidate(const wxString& url,
+                            const wxHTTPCache::HeaderGetter& getHeader,
+                            wxHTTPCacheEntry* entry)
+{
+    const auto i = m_index.find(url);
+    if ( i == m_index.end() )
+        return false;
+
+    const Items::iterator it = i->second;
+    Item& item = *it;
+    if ( !EnsureInMemory(item) )
+    {
+        RemoveItem(it, false);
+        return false;
+    }
+
+    // The validators may be updated by the 304 response.
+    const wxString eTag = getHeader("ETag");
+    if ( !eTag.empty() )
+        item.eTag = eTag;
+
+    const wxString lastModified = getHeader("Last-Modified");
+    if ( !lastModified.empty() )
+        item.lastModified = lastModified;
+
+    FillEntry(item, entry);
+
+    if ( !GetFreshness(getHeader, item) ||
+            (!m_dir.empty() && !WriteFile(item)) )
+    {
+        // We can still use the data this time, but not any more.
+        RemoveItem(it);
+        return true;
+    }
+
+    wxLogTrace(wxTRACE_HTTPCACHE, "Revalidated \"%s\"", url);
+
+    Touch(it);
+    TrimMemory();
+
+    return true;
+}
+
+void wxHTTPCacheImpl::Remove(const wxString& url)
+{
+    const auto i = m_index.find(url);
+    if ( i != m_index.end() )
+        RemoveItem(i->second);
+}
+
+void wxHTTPCacheImpl::Clear()
+{
+    while ( !m_items.empty() )
+        RemoveItem(m_items.begin());
+}
+
+// ----------------------------------------------------------------------------
+// wxHTTPCache
+// ----------------------------------------------------------------------------
+
+wxHTTPCache::wxHTTPCache(const wxString& dir, size_t maxSize)
+    : m_impl(new wxHTTPCacheImpl(dir, maxSize))
+{
+}
+
+wxHTTPCache::~wxHTTPCache()
+{
+}
+
+const wxString& wxHTTPCache::GetDirectory() const
+{
+    return m_impl->m_dir;
+}
+
+void wxHTTPCache::SetMaxSize(size_t maxSize)
+{
+    wxCriticalSectionLocker lock(m_impl->m_cs);
+
+    m_impl->m_maxSize = maxSize;
+    m_impl->Trim();
+}
+
+size_t wxHTTPCache::GetMaxSize() const
+{
+    wxCriticalSectionLocker lock(m_impl->m_cs);
+
+    return m_impl->m_maxSize;
+}
+
+void wxHTTPCache::SetMaxMemorySize(size_t maxSize)
+{
+    wxCriticalSectionLocker lock(m_impl->m_cs);
+
+    m_impl->m_maxMemorySize = maxSize;
+    m_impl->TrimMemory();
+}
+
+size_t wxHTTPCache::GetMaxMemorySize() const
+{
+    wxCriticalSectionLocker lock(m_impl->m_cs);
+
+    return m_impl->m_maxMemorySize;
+}
+
+size_t wxHTTPCache::GetSize() const
+{
+    wxCriticalSectionLocker lock(m_impl->m_cs);
+
+    return m_impl->m_size;
+}
+
+size_t wxHTTPCache::GetCount() const
+{
+    wxCriticalSectionLocker lock(m_impl->m_cs);
+
+    return m_impl->m_items.size();
+}
+
+wxHTTPCache::Status
+wxHTTPCache::Find(const wxString& url, wxHTTPCacheEntry* entry)
+{
+    wxCriticalSectionLocker lock(m_impl->m_cs);
+
+    return m_impl->Find(url, entry);
+}
+
+bool wxHTTPCache::Store(const wxString& url,
+                        const HeaderGetter& getHeader,
+                        const void* data, size_t size)
+{
+    wxCriticalSectionLocker lock(m_impl->m_cs);
+
+    return m_impl->Store(url, getHeader, data, size);
+}
+
+bool wxHTTPCache::Revalidate(const wxString& url,
+                             const HeaderGetter& getHeader,
+                             wxHTTPCacheEntry* entry)
+{
+    wxCriticalSectionLocker lock(m_impl->m_cs);
+
+    return m_impl->Revalidate(url, getHeader, entry);
+}
+
+void wxHTTPCache::Remove(const wxString& url)
+{
+    wxCriticalSectionLocker lock(m_impl->m_cs);
+
+    m_impl->Remove(url);
+}
+
+void wxHTTPCache::Clear()
+{
+    wxCriticalSectionLocker lock(m_impl->m_cs);
+
+    m_impl->Clear();
+}
+
+#endif // wxUSE_FILE
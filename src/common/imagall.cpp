@@ -16,44 +16,58 @@
     #include "wx/image.h"
 #endif
 
+namespace
+{
+
+template <typename T>
+wxImageHandler* CreateHandler()
+{
+    return new T;
+}
+
+} // anonymous namespace
+
 //-----------------------------------------------------------------------------
 // This function allows dynamic access to all image handlers compile within
 // the library. This function should be in a separate file as some compilers
 // link against the whole object file as long as just one of is function is called!
+//
+// Note that the handlers are only created when they're needed for the first
+// time, i.e. this function itself is very cheap.
 
 void wxInitAllImageHandlers()
 {
 #if wxUSE_LIBPNG
-  wxImage::AddHandler( new wxPNGHandler );
+  wxImage::AddHandlerFactory( wxBITMAP_TYPE_PNG, &CreateHandler<wxPNGHandler> );
 #endif
 #if wxUSE_LIBJPEG
-  wxImage::AddHandler( new wxJPEGHandler );
+  wxImage::AddHandlerFactory( wxBITMAP_TYPE_JPEG, &CreateHandler<wxJPEGHandler> );
 #endif
 #if wxUSE_LIBTIFF
-  wxImage::AddHandler( new wxTIFFHandler );
+  wxImage::AddHandlerFactory( wxBITMAP_TYPE_TIFF, &CreateHandler<wxTIFFHandler> );
 #endif
 #if wxUSE_GIF
-  wxImage::AddHandler( new wxGIFHandler );
+  wxImage::AddHandlerFactory( wxBITMAP_TYPE_GIF, &CreateHandler<wxGIFHandler> );
 #endif
 #if wxUSE_PNM
-  wxImage::AddHandler( new wxPNMHandler );
+  wxImage::AddHandlerFactory( wxBITMAP_TYPE_PNM, &CreateHandler<wxPNMHandler> );
 #endif
 #if wxUSE_PCX
-  wxImage::AddHandler( new wxPCXHandler );
+  wxImage::AddHandlerFactory( wxBITMAP_TYPE_PCX, &CreateHandler<wxPCXHandler> );
 #endif
 #if wxUSE_IFF
-  wxImage::AddHandler( new wxIFFHandler );
+  wxImage::AddHandlerFactory( wxBITMAP_TYPE_IFF, &CreateHandler<wxIFFHandler> );
 #endif
 #if wxUSE_ICO_CUR
-  wxImage::AddHandler( new wxICOHandler );
-  wxImage::AddHandler( new wxCURHandler );
-  wxImage::AddHandler( new wxANIHandler );
+  wxImage::AddHandlerFactory( wxBITMAP_TYPE_ICO, &CreateHandler<wxICOHandler> );
+  wxImage::AddHandlerFactory( wxBITMAP_TYPE_CUR, &CreateHandler<wxCURHandler> );
+  wxImage::AddHandlerFactory( wxBITMAP_TYPE_ANI, &CreateHandler<wxANIHandler> );
 #endif
 #if wxUSE_TGA
-  wxImage::AddHandler( new wxTGAHandler );
+  wxImage::AddHandlerFactory( wxBITMAP_TYPE_TGA, &CreateHandler<wxTGAHandler> );
 #endif
 #if wxUSE_XPM
-  wxImage::AddHandler( new wxXPMHandler );
+  wxImage::AddHandlerFactory( wxBITMAP_TYPE_XPM, &CreateHandler<wxXPMHandler> );
 #endif
 }
 
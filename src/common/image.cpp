@@ -27,10 +27,22 @@
 #include "wx/wfstream.h"
 #include "wx/xpmdecod.h"
 
+#include "wx/private/hashnocase.h"
+#include "wx/private/parallel.h"
+#include "wx/private/premultiply.h"
+#include "wx/private/simd.h"
+
+#if wxUSE_THREADS
+    #include "wx/thread.h"
+#endif
+
 // For memcpy
 #include <string.h>
 
+#include <atomic>
 #include <unordered_set>
+#include <utility>
+#include <vector>
 
 // make the code compile with either wxFile*Stream or wxFFile*Stream:
 #define HAS_FILE_STREAMS (wxUSE_STREAMS && (wxUSE_FILE || wxUSE_FFILE))
@@ -56,6 +68,22 @@ IMPLEMENT_VARIANT_OBJECT_EXPORTED_SHALLOWCMP(wxImage,WXDLLEXPORT)
 wxList wxImage::sm_handlers;
 wxImage wxNullImage;
 
+namespace
+{
+
+// Handlers registered with wxImage::AddHandlerFactory() and not created yet.
+std::vector<std::pair<wxBitmapType, wxImage::HandlerFactory>> gs_pendingHandlers;
+
+// Set if gs_pendingHandlers is not empty, allows checking for this without
+// locking.
+std::atomic<bool> gs_hasPendingHandlers{false};
+
+#if wxUSE_THREADS
+wxCriticalSection gs_csPendingHandlers;
+#endif // wxUSE_THREADS
+
+} // anonymous namespace
+
 //-----------------------------------------------------------------------------
 // wxImageRefData
 //-----------------------------------------------------------------------------
@@ -89,12 +117,18 @@ public:
     int             m_loadFlags;
     static int      sm_defaultLoadFlags;
 
+    // function called while loading the image, if any
+    wxImageLoadProgressFunction m_loadProgress;
+
+    // global number of threads used for processing the images
+    static int      sm_defaultThreadCount;
+
 #if wxUSE_PALETTE
     wxPalette       m_palette;
 #endif // wxUSE_PALETTE
 
-    wxArrayString   m_optionNames;
-    wxArrayString   m_optionValues;
+    // the option names are case-insensitive
+    wxStringNoCaseHashMap<wxString> m_options;
 
     wxDECLARE_NO_COPY_CLASS(wxImageRefData);
 };
@@ -102,6 +136,9 @@ public:
 // For compatibility, if nothing else, loading is verbose by default.
 int wxImageRefData::sm_defaultLoadFlags = wxImage::Load_Verbose;
 
+// Don't use any extra threads unless explicitly requested.
+int wxImageRefData::sm_defaultThreadCount = 1;
+
 wxImageRefData::wxImageRefData()
 {
     m_width = 0;
@@ -265,8 +302,7 @@ wxObjectRefData* wxImage::CloneRefData(const wxObjectRefData* that) const
 #if wxUSE_PALETTE
     refData_new->m_palette = refData->m_palette;
 #endif
-    refData_new->m_optionNames = refData->m_optionNames;
-    refData_new->m_optionValues = refData->m_optionValues;
+    refData_new->m_options = refData->m_options;
     return refData_new;
 }
 
@@ -439,6 +475,34 @@ wxImage wxImage::ShrinkBy( int xFactor , int yFactor ) const
     return image;
 }
 
+namespace
+{
+
+// Copy the attributes of the original image which are preserved by scaling to
+// its scaled version, adjusting them to the new size if necessary.
+void CopyScaledAttributes(const wxImage& src, wxImage& dst)
+{
+    // If the original image has a mask, apply the mask to the new image
+    if ( src.HasMask() )
+    {
+        dst.SetMaskColour( src.GetMaskRed(),
+                           src.GetMaskGreen(),
+                           src.GetMaskBlue() );
+    }
+
+    // In case this is a cursor, make sure the hotspot is scaled accordingly:
+    if ( src.HasOption(wxIMAGE_OPTION_CUR_HOTSPOT_X) )
+        dst.SetOption(wxIMAGE_OPTION_CUR_HOTSPOT_X,
+                (src.GetOptionInt(wxIMAGE_OPTION_CUR_HOTSPOT_X)*dst.GetWidth())
+                    / src.GetWidth());
+    if ( src.HasOption(wxIMAGE_OPTION_CUR_HOTSPOT_Y) )
+        dst.SetOption(wxIMAGE_OPTION_CUR_HOTSPOT_Y,
+                (src.GetOptionInt(wxIMAGE_OPTION_CUR_HOTSPOT_Y)*dst.GetHeight())
+                    / src.GetHeight());
+}
+
+} // anonymous namespace
+
 wxImage
 wxImage::Scale( int width, int height, wxImageResizeQuality quality ) const
 {
@@ -492,21 +556,7 @@ wxImage::Scale( int width, int height, wxImageResizeQuality quality ) const
             break;
     }
 
-    // If the original image has a mask, apply the mask to the new image
-    if (M_IMGDATA->m_hasMask)
-    {
-        image.SetMaskColour( M_IMGDATA->m_maskRed,
-                            M_IMGDATA->m_maskGreen,
-                            M_IMGDATA->m_maskBlue );
-    }
-
-    // In case this is a cursor, make sure the hotspot is scaled accordingly:
-    if ( HasOption(wxIMAGE_OPTION_CUR_HOTSPOT_X) )
-        image.SetOption(wxIMAGE_OPTION_CUR_HOTSPOT_X,
-                (GetOptionInt(wxIMAGE_OPTION_CUR_HOTSPOT_X)*width)/old_width);
-    if ( HasOption(wxIMAGE_OPTION_CUR_HOTSPOT_Y) )
-        image.SetOption(wxIMAGE_OPTION_CUR_HOTSPOT_Y,
-                (GetOptionInt(wxIMAGE_OPTION_CUR_HOTSPOT_Y)*height)/old_height);
+    CopyScaledAttributes(*this, image);
 
     return image;
 }
@@ -584,6 +634,393 @@ wxImage wxImage::ResampleNearest(int width, int height) const
 namespace
 {
 
+// Return the number of threads to use for processing the given number of
+// pixels: this is 1 for small images, as it's not worth using threads for them.
+int GetThreadCountForPixels(long long numPixels)
+{
+    if ( numPixels < 256*256 )
+        return 1;
+
+    int count = wxImage::GetDefaultThreadCount();
+#if wxUSE_THREADS
+    if ( count == 0 )
+        count = wxThread::GetCPUCount();
+#endif // wxUSE_THREADS
+
+    return count;
+}
+
+// Return the number of threads to use for resampling: this depends on both
+// the source and destination image sizes as the processing time depends on
+// the larger of them.
+int
+GetThreadCountForResampling(int oldWidth, int oldHeight, int width, int height)
+{
+    return GetThreadCountForPixels(wxMax(static_cast<long long>(oldWidth)*oldHeight,
+                                         static_cast<long long>(width)*height));
+}
+
+// RGBAValue holds the values of red, green, blue and alpha channels of a pixel
+// as doubles and is used for computing the weighted sums of pixels in the
+// resampling functions below.
+//
+// Its operations are performed independently for each channel and in exactly
+// the same order as the equivalent scalar code would perform them, so the
+// results are always the same, whether SIMD instructions are used or not.
+class RGBAValue
+{
+public:
+    RGBAValue() { Set(0, 0, 0, 0); }
+
+    RGBAValue(double r, double g, double b, double a) { Set(r, g, b, a); }
+
+#if defined(wxHAS_SSE2)
+    // Create an RGBAValue containing the given pixel and, optionally, its
+    // alpha value (0 is used if it's not specified).
+    static RGBAValue FromPixel(const unsigned char* rgb, int a = 0)
+    {
+        // Converting all the channels at once is faster than converting them
+        // to doubles one by one.
+        const __m128i v = _mm_setr_epi32(rgb[0], rgb[1], rgb[2], a);
+
+        RGBAValue value;
+        value.m_rg = _mm_cvtepi32_pd(v);
+        value.m_ba = _mm_cvtepi32_pd(_mm_unpackhi_epi64(v, v));
+        return value;
+    }
+
+    double R() const { return _mm_cvtsd_f64(m_rg); }
+    double G() const { return _mm_cvtsd_f64(_mm_unpackhi_pd(m_rg, m_rg)); }
+    double B() const { return _mm_cvtsd_f64(m_ba); }
+    double A() const { return _mm_cvtsd_f64(_mm_unpackhi_pd(m_ba, m_ba)); }
+
+    RGBAValue& operator+=(const RGBAValue& other)
+    {
+        m_rg = _mm_add_pd(m_rg, other.m_rg);
+        m_ba = _mm_add_pd(m_ba, other.m_ba);
+        return *this;
+    }
+
+    RGBAValue& operator*=(const RGBAValue& other)
+    {
+        m_rg = _mm_mul_pd(m_rg, other.m_rg);
+        m_ba = _mm_mul_pd(m_ba, other.m_ba);
+        return *this;
+    }
+
+    RGBAValue& operator*=(double w)
+    {
+        const __m128d ww = _mm_set1_pd(w);
+        m_rg = _mm_mul_pd(m_rg, ww);
+        m_ba = _mm_mul_pd(m_ba, ww);
+        return *this;
+    }
+
+    RGBAValue& operator/=(const RGBAValue& other)
+    {
+        m_rg = _mm_div_pd(m_rg, other.m_rg);
+        m_ba = _mm_div_pd(m_ba, other.m_ba);
+        return *this;
+    }
+
+private:
+    void Set(double r, double g, double b, double a)
+    {
+        m_rg = _mm_set_pd(g, r);
+        m_ba = _mm_set_pd(a, b);
+    }
+
+    __m128d m_rg,
+            m_ba;
+#elif defined(wxHAS_NEON)
+    static RGBAValue FromPixel(const unsigned char* rgb, int a = 0)
+    {
+        return RGBAValue(rgb[0], rgb[1], rgb[2], a);
+    }
+
+    double R() const { return vgetq_lane_f64(m_rg, 0); }
+    double G() const { return vgetq_lane_f64(m_rg, 1); }
+    double B() const { return vgetq_lane_f64(m_ba, 0); }
+    double A() const { return vgetq_lane_f64(m_ba, 1); }
+
+    RGBAValue& operator+=(const RGBAValue& other)
+    {
+        m_rg = vaddq_f64(m_rg, other.m_rg);
+        m_ba = vaddq_f64(m_ba, other.m_ba);
+        return *this;
+    }
+
+    RGBAValue& operator*=(const RGBAValue& other)
+    {
+        m_rg = vmulq_f64(m_rg, other.m_rg);
+        m_ba = vmulq_f64(m_ba, other.m_ba);
+        return *this;
+    }
+
+    RGBAValue& operator*=(double w)
+    {
+        m_rg = vmulq_n_f64(m_rg, w);
+        m_ba = vmulq_n_f64(m_ba, w);
+        return *this;
+    }
+
+    RGBAValue& operator/=(const RGBAValue& other)
+    {
+        m_rg = vdivq_f64(m_rg, other.m_rg);
+        m_ba = vdivq_f64(m_ba, other.m_ba);
+        return *this;
+    }
+
+private:
+    void Set(double r, double g, double b, double a)
+    {
+        m_rg = vsetq_lane_f64(g, vdupq_n_f64(r), 1);
+        m_ba = vsetq_lane_f64(a, vdupq_n_f64(b), 1);
+    }
+
+    float64x2_t m_rg,
+                m_ba;
+#else // no SIMD
+    static RGBAValue FromPixel(const unsigned char* rgb, int a = 0)
+    {
+        return RGBAValue(rgb[0], rgb[1], rgb[2], a);
+    }
+
+    double R() const { return m_v[0]; }
+    double G() const { return m_v[1]; }
+    double B() const { return m_v[2]; }
+    double A() const { return m_v[3]; }
+
+    RGBAValue& operator+=(const RGBAValue& other)
+    {
+        for ( int n = 0; n < 4; n++ )
+            m_v[n] += other.m_v[n];
+        return *this;
+    }
+
+    RGBAValue& operator*=(const RGBAValue& other)
+    {
+        for ( int n = 0; n < 4; n++ )
+            m_v[n] *= other.m_v[n];
+        return *this;
+    }
+
+    RGBAValue& operator*=(double w)
+    {
+        for ( int n = 0; n < 4; n++ )
+            m_v[n] *= w;
+        return *this;
+    }
+
+    RGBAValue& operator/=(const RGBAValue& other)
+    {
+        for ( int n = 0; n < 4; n++ )
+            m_v[n] /= other.m_v[n];
+        return *this;
+    }
+
+private:
+    void Set(double r, double g, double b, double a)
+    {
+        m_v[0] = r;
+        m_v[1] = g;
+        m_v[2] = b;
+        m_v[3] = a;
+    }
+
+    double m_v[4];
+#endif // SIMD
+
+public:
+    RGBAValue operator+(const RGBAValue& other) const
+        { RGBAValue v(*this); v += other; return v; }
+    RGBAValue operator*(const RGBAValue& other) const
+        { RGBAValue v(*this); v *= other; return v; }
+    RGBAValue operator*(double w) const
+        { RGBAValue v(*this); v *= w; return v; }
+    RGBAValue operator/(const RGBAValue& other) const
+        { RGBAValue v(*this); v /= other; return v; }
+
+    // Store the colour channels, truncated to bytes, in the RGB data.
+    void StoreRGB(unsigned char* rgb) const
+    {
+        rgb[0] = static_cast<unsigned char>(R());
+        rgb[1] = static_cast<unsigned char>(G());
+        rgb[2] = static_cast<unsigned char>(B());
+    }
+
+    // Store the alpha channel, truncated to byte, in the alpha data.
+    void StoreAlpha(unsigned char* alpha) const
+    {
+        *alpha = static_cast<unsigned char>(A());
+    }
+};
+
+// The classes below provide access to the rows of the source image pixels as
+// RGBAValue objects. Both of them have GetRow() function returning an object
+// with Pixel() function returning the pixel, with its alpha value in the alpha
+// channel if the image has alpha or 0 otherwise, and AlphaWeight() returning
+// the value to multiply the pixel by to weight its colour channels with alpha
+// (with 1 in the alpha channel). The latter can only be used for the images
+// with alpha.
+
+// Simplest pixels source converting the pixels on the fly. This is the most
+// efficient one when each source pixel contributes to few destination ones.
+class RGBADirectRows
+{
+public:
+    class Row
+    {
+    public:
+        Row(const unsigned char* data, const unsigned char* alpha)
+            : m_data(data), m_alpha(alpha)
+        {
+        }
+
+        RGBAValue Pixel(int x) const
+        {
+            return m_alpha ? RGBAValue::FromPixel(m_data + x*3, m_alpha[x])
+                           : RGBAValue::FromPixel(m_data + x*3);
+        }
+
+        RGBAValue AlphaWeight(int x) const
+        {
+            const int a = m_alpha[x];
+            return RGBAValue(a, a, a, 1);
+        }
+
+    private:
+        const unsigned char* m_data;
+        const unsigned char* m_alpha;
+    };
+
+    RGBADirectRows(const unsigned char* data,
+                   const unsigned char* alpha,
+                   int width)
+        : m_data(data),
+          m_alpha(alpha),
+          m_width(width)
+    {
+    }
+
+    Row GetRow(int y) const
+    {
+        return Row(m_data + y*m_width*3, m_alpha ? m_alpha + y*m_width : nullptr);
+    }
+
+private:
+    const unsigned char* const m_data;
+    const unsigned char* const m_alpha;
+    const int m_width;
+
+    wxDECLARE_NO_COPY_CLASS(RGBADirectRows);
+};
+
+// Cache of the source image rows converted to RGBAValue.
+//
+// When upsampling, each source pixel contributes to several destination
+// pixels, so converting the rows only once and reusing them is much faster
+// than converting the same pixels again for every destination pixel.
+//
+// The cache contains the given number of rows and the row y is stored in the
+// slot y % numRows, so up to numRows consecutive rows can be used together.
+// Only the pixels in the columns registered with AddColumn() are converted.
+class RGBARowCache
+{
+public:
+    class Row
+    {
+    public:
+        Row(const RGBAValue* pixels, const RGBAValue* alphaWeights)
+            : m_pixels(pixels), m_alphaWeights(alphaWeights)
+        {
+        }
+
+        const RGBAValue& Pixel(int x) const { return m_pixels[x]; }
+        const RGBAValue& AlphaWeight(int x) const { return m_alphaWeights[x]; }
+
+    private:
+        const RGBAValue* m_pixels;
+        const RGBAValue* m_alphaWeights;
+    };
+
+    RGBARowCache(const unsigned char* data,
+                 const unsigned char* alpha,
+                 int width,
+                 int numRows)
+        : m_data(data),
+          m_alpha(alpha),
+          m_width(width),
+          m_columnUsed(width, false),
+          m_slots(numRows)
+    {
+    }
+
+    // Must be called for all the columns used before calling GetRow().
+    void AddColumn(int x)
+    {
+        if ( !m_columnUsed[x] )
+        {
+            m_columnUsed[x] = true;
+            m_columns.push_back(x);
+        }
+    }
+
+    Row GetRow(int y)
+    {
+        Slot& slot = m_slots[y % m_slots.size()];
+        if ( slot.y != y )
+        {
+            slot.y = y;
+            slot.pixels.resize(m_width);
+
+            const unsigned char* data = m_data + y*m_width*3;
+            if ( m_alpha )
+            {
+                slot.alphaWeights.resize(m_width);
+
+                const unsigned char* alpha = m_alpha + y*m_width;
+                for ( const int x : m_columns )
+                {
+                    const int a = alpha[x];
+                    slot.pixels[x] = RGBAValue::FromPixel(data + x*3, a);
+                    slot.alphaWeights[x] = RGBAValue(a, a, a, 1);
+                }
+            }
+            else
+            {
+                for ( const int x : m_columns )
+                    slot.pixels[x] = RGBAValue::FromPixel(data + x*3);
+            }
+        }
+
+        return Row(slot.pixels.data(), slot.alphaWeights.data());
+    }
+
+private:
+    struct Slot
+    {
+        Slot() : y(-1) { }
+
+        int y;
+        std::vector<RGBAValue> pixels;
+        std::vector<RGBAValue> alphaWeights;
+    };
+
+    const unsigned char* const m_data;
+    const unsigned char* const m_alpha;
+    const int m_width;
+
+    // Flags indicating whether the column is used and the list of all the
+    // used columns, in the order of their addition.
+    std::vector<bool> m_columnUsed;
+    std::vector<int> m_columns;
+
+    std::vector<Slot> m_slots;
+
+    wxDECLARE_NO_COPY_CLASS(RGBARowCache);
+};
+
 struct BoxPrecalc
 {
     int boxStart;
@@ -633,108 +1070,152 @@ void ResampleBoxPrecalc(wxVector<BoxPrecalc>& boxes, int oldDim)
     }
 }
 
-} // anonymous namespace
-
-wxImage wxImage::ResampleBox(int width, int height) const
-{
-    // This function implements a simple pre-blur/box averaging method for
-    // downsampling that gives reasonably smooth results To scale the image
-    // down we will need to gather a grid of pixels of the size of the scale
-    // factor in each direction and then do an averaging of the pixels.
-
-    wxImage ret_image(width, height, false);
-
-    wxVector<BoxPrecalc> vPrecalcs(height);
-    wxVector<BoxPrecalc> hPrecalcs(width);
-
-    ResampleBoxPrecalc(vPrecalcs, M_IMGDATA->m_height);
-    ResampleBoxPrecalc(hPrecalcs, M_IMGDATA->m_width);
-
-
-    const unsigned char* src_data = M_IMGDATA->m_data;
-    const unsigned char* src_alpha = M_IMGDATA->m_alpha;
-    unsigned char* dst_data = ret_image.GetData();
-    unsigned char* dst_alpha = nullptr;
-
-    wxCHECK_MSG( dst_data, ret_image, wxS("unable to create image") );
-
-    if ( src_alpha )
-    {
-        ret_image.SetAlpha();
-        dst_alpha = ret_image.GetAlpha();
-    }
-
-    int averaged_pixels, src_pixel_index;
-    double sum_r, sum_g, sum_b, sum_a;
-
-    for ( int y = 0; y < height; y++ )         // Destination image - Y direction
+// Compute the rows in [yStart, yEnd) range of the image resampled using box
+// averaging, dst_data and dst_alpha point to the start of the row yStart.
+void
+DoResampleBox(const unsigned char* src_data,
+              const unsigned char* src_alpha,
+              int src_width,
+              const wxVector<BoxPrecalc>& vPrecalcs,
+              const wxVector<BoxPrecalc>& hPrecalcs,
+              int yStart,
+              int yEnd,
+              unsigned char* dst_data,
+              unsigned char* dst_alpha)
+{
+    for ( int y = yStart; y < yEnd; y++ )      // Destination image - Y direction
     {
         // Source pixel in the Y direction
         const BoxPrecalc& vPrecalc = vPrecalcs[y];
 
-        for ( int x = 0; x < width; x++ )      // Destination image - X direction
+        for ( const BoxPrecalc& hPrecalc : hPrecalcs ) // Destination image - X direction
         {
-            // Source pixel in the X direction
-            const BoxPrecalc& hPrecalc = hPrecalcs[x];
 
             // Box of pixels to average
-            averaged_pixels = (vPrecalc.boxEnd - vPrecalc.boxStart + 1)
-                                * (hPrecalc.boxEnd - hPrecalc.boxStart + 1);
-            sum_r = sum_g = sum_b = sum_a = 0.0;
+            const int averaged_pixels = (vPrecalc.boxEnd - vPrecalc.boxStart + 1)
+                                          * (hPrecalc.boxEnd - hPrecalc.boxStart + 1);
+            RGBAValue sum;
 
             for ( int j = vPrecalc.boxStart; j <= vPrecalc.boxEnd; ++j )
             {
-                for ( int i = hPrecalc.boxStart; i <= hPrecalc.boxEnd; ++i )
-                {
-                    // Calculate the actual index in our source pixels
-                    src_pixel_index = j * M_IMGDATA->m_width + i;
+                // Calculate the actual index in our source pixels
+                int src_pixel_index = j * src_width + hPrecalc.boxStart;
 
-                    if (src_alpha)
+                if ( dst_alpha )
+                {
+                    for ( int i = hPrecalc.boxStart; i <= hPrecalc.boxEnd; ++i )
                     {
-                        sum_r += src_data[src_pixel_index * 3 + 0] * src_alpha[src_pixel_index];
-                        sum_g += src_data[src_pixel_index * 3 + 1] * src_alpha[src_pixel_index];
-                        sum_b += src_data[src_pixel_index * 3 + 2] * src_alpha[src_pixel_index];
-                        sum_a += src_alpha[src_pixel_index];
+                        // The alpha channel itself is just summed, so use 1
+                        // for it in the value multiplied by alpha.
+                        sum += RGBAValue::FromPixel(src_data + src_pixel_index * 3, 1)
+                                * src_alpha[src_pixel_index];
+                        src_pixel_index++;
                     }
-                    else
+                }
+                else
+                {
+                    for ( int i = hPrecalc.boxStart; i <= hPrecalc.boxEnd; ++i )
                     {
-                        sum_r += src_data[src_pixel_index * 3 + 0];
-                        sum_g += src_data[src_pixel_index * 3 + 1];
-                        sum_b += src_data[src_pixel_index * 3 + 2];
+                        sum += RGBAValue::FromPixel(src_data + src_pixel_index * 3);
+                        src_pixel_index++;
                     }
                 }
             }
 
             // Calculate the average from the sum and number of averaged pixels
-            if (src_alpha)
+            if (dst_alpha)
             {
+                const double sum_a = sum.A();
                 if (sum_a != 0)
                 {
-                    dst_data[0] = (unsigned char)(sum_r / sum_a);
-                    dst_data[1] = (unsigned char)(sum_g / sum_a);
-                    dst_data[2] = (unsigned char)(sum_b / sum_a);
+                    const RGBAValue
+                        avg = sum / RGBAValue(sum_a, sum_a, sum_a, averaged_pixels);
+                    avg.StoreRGB(dst_data);
+                    avg.StoreAlpha(dst_alpha);
                 }
                 else
                 {
                     dst_data[0] = 0;
                     dst_data[1] = 0;
                     dst_data[2] = 0;
+                    *dst_alpha = 0;
                 }
-                *dst_alpha++ = (unsigned char)(sum_a / averaged_pixels);
+                dst_alpha++;
             }
             else
             {
-                dst_data[0] = (unsigned char)(sum_r / averaged_pixels);
-                dst_data[1] = (unsigned char)(sum_g / averaged_pixels);
-                dst_data[2] = (unsigned char)(sum_b / averaged_pixels);
+                const RGBAValue
+                    avg = sum / RGBAValue(averaged_pixels, averaged_pixels,
+                                          averaged_pixels, averaged_pixels);
+                avg.StoreRGB(dst_data);
             }
             dst_data += 3;
         }
     }
+}
+
+// Resample the image using the box averaging with the given precalculated
+// boxes, which also determine the size of the returned image.
+wxImage
+ApplyBoxPrecalcs(const wxImage& image,
+                 const wxVector<BoxPrecalc>& vPrecalcs,
+                 const wxVector<BoxPrecalc>& hPrecalcs)
+{
+    const int width = hPrecalcs.size();
+    const int height = vPrecalcs.size();
+
+    wxImage ret_image(width, height, false);
+
+    const unsigned char* src_data = image.GetData();
+    const unsigned char* src_alpha = image.GetAlpha();
+    unsigned char* dst_data = ret_image.GetData();
+    unsigned char* dst_alpha = nullptr;
+
+    wxCHECK_MSG( dst_data, ret_image, wxS("unable to create image") );
+
+    if ( src_alpha )
+    {
+        ret_image.SetAlpha();
+        dst_alpha = ret_image.GetAlpha();
+    }
+
+    const int src_width = image.GetWidth();
+
+    wxParallelFor
+    (
+        height,
+        GetThreadCountForResampling(src_width, image.GetHeight(), width, height),
+        [&](int yStart, int yEnd)
+        {
+            DoResampleBox(src_data, src_alpha, src_width,
+                          vPrecalcs, hPrecalcs,
+                          yStart, yEnd,
+                          dst_data + yStart*width*3,
+                          dst_alpha ? dst_alpha + yStart*width : nullptr);
+        }
+    );
 
     return ret_image;
 }
 
+} // anonymous namespace
+
+wxImage wxImage::ResampleBox(int width, int height) const
+{
+    // This function implements a simple pre-blur/box averaging method for
+    // downsampling that gives reasonably smooth results To scale the image
+    // down we will need to gather a grid of pixels of the size of the scale
+    // factor in each direction and then do an averaging of the pixels.
+
+    wxVector<BoxPrecalc> vPrecalcs(height);
+    wxVector<BoxPrecalc> hPrecalcs(width);
+
+    ResampleBoxPrecalc(vPrecalcs, M_IMGDATA->m_height);
+    ResampleBoxPrecalc(hPrecalcs, M_IMGDATA->m_width);
+
+    return ApplyBoxPrecalcs(*this, vPrecalcs, hPrecalcs);
+}
+
 namespace
 {
 
@@ -793,89 +1274,133 @@ void ResampleBilinearPrecalc(wxVector<BilinearPrecalc>& precalcs, int oldDim)
     }
 }
 
-} // anonymous namespace
-
-wxImage wxImage::ResampleBilinear(int width, int height) const
+// Compute the rows in [yStart, yEnd) range of the image resampled using
+// bilinear interpolation, dst_data and dst_alpha point to the start of the
+// row yStart.
+template <typename Rows>
+void DoResampleBilinear(Rows& rows,
+                        const wxVector<BilinearPrecalc>& vPrecalcs,
+                        const wxVector<BilinearPrecalc>& hPrecalcs,
+                        int yStart,
+                        int yEnd,
+                        unsigned char* dst_data,
+                        unsigned char* dst_alpha)
 {
-    // This function implements a Bilinear algorithm for resampling.
-    wxImage ret_image(width, height, false);
-    const unsigned char* src_data = M_IMGDATA->m_data;
-    const unsigned char* src_alpha = M_IMGDATA->m_alpha;
-    unsigned char* dst_data = ret_image.GetData();
-    unsigned char* dst_alpha = nullptr;
-
-    wxCHECK_MSG( dst_data, ret_image, wxS("unable to create image") );
-
-    if ( src_alpha )
-    {
-        ret_image.SetAlpha();
-        dst_alpha = ret_image.GetAlpha();
-    }
-
-    wxVector<BilinearPrecalc> vPrecalcs(height);
-    wxVector<BilinearPrecalc> hPrecalcs(width);
-    ResampleBilinearPrecalc(vPrecalcs, M_IMGDATA->m_height);
-    ResampleBilinearPrecalc(hPrecalcs, M_IMGDATA->m_width);
-
-    // initialize alpha values to avoid g++ warnings about possibly
-    // uninitialized variables
-    double r1, g1, b1, a1 = 0;
-    double r2, g2, b2, a2 = 0;
-
-    for ( int dsty = 0; dsty < height; dsty++ )
+    for ( int y = yStart; y < yEnd; y++ )
     {
         // We need to calculate the source pixel to interpolate from - Y-axis
-        const BilinearPrecalc& vPrecalc = vPrecalcs[dsty];
-        const int y_offset1 = vPrecalc.offset1;
-        const int y_offset2 = vPrecalc.offset2;
+        const BilinearPrecalc& vPrecalc = vPrecalcs[y];
+        const typename Rows::Row row1 = rows.GetRow(vPrecalc.offset1);
+        const typename Rows::Row row2 = rows.GetRow(vPrecalc.offset2);
         const double dy = vPrecalc.dd;
         const double dy1 = vPrecalc.dd1;
 
-
-        for ( int dstx = 0; dstx < width; dstx++ )
+        for ( const BilinearPrecalc& hPrecalc : hPrecalcs )
         {
             // X-axis of pixel to interpolate from
-            const BilinearPrecalc& hPrecalc = hPrecalcs[dstx];
-
             const int x_offset1 = hPrecalc.offset1;
             const int x_offset2 = hPrecalc.offset2;
             const double dx = hPrecalc.dd;
             const double dx1 = hPrecalc.dd1;
 
-            int src_pixel_index00 = y_offset1 * M_IMGDATA->m_width + x_offset1;
-            int src_pixel_index01 = y_offset1 * M_IMGDATA->m_width + x_offset2;
-            int src_pixel_index10 = y_offset2 * M_IMGDATA->m_width + x_offset1;
-            int src_pixel_index11 = y_offset2 * M_IMGDATA->m_width + x_offset2;
-
             // first line
-            r1 = src_data[src_pixel_index00 * 3 + 0] * dx1 + src_data[src_pixel_index01 * 3 + 0] * dx;
-            g1 = src_data[src_pixel_index00 * 3 + 1] * dx1 + src_data[src_pixel_index01 * 3 + 1] * dx;
-            b1 = src_data[src_pixel_index00 * 3 + 2] * dx1 + src_data[src_pixel_index01 * 3 + 2] * dx;
-            if ( src_alpha )
-                a1 = src_alpha[src_pixel_index00] * dx1 + src_alpha[src_pixel_index01] * dx;
+            const RGBAValue line1 = row1.Pixel(x_offset1) * dx1
+                                        + row1.Pixel(x_offset2) * dx;
 
             // second line
-            r2 = src_data[src_pixel_index10 * 3 + 0] * dx1 + src_data[src_pixel_index11 * 3 + 0] * dx;
-            g2 = src_data[src_pixel_index10 * 3 + 1] * dx1 + src_data[src_pixel_index11 * 3 + 1] * dx;
-            b2 = src_data[src_pixel_index10 * 3 + 2] * dx1 + src_data[src_pixel_index11 * 3 + 2] * dx;
-            if ( src_alpha )
-                a2 = src_alpha[src_pixel_index10] * dx1 + src_alpha[src_pixel_index11] * dx;
+            const RGBAValue line2 = row2.Pixel(x_offset1) * dx1
+                                        + row2.Pixel(x_offset2) * dx;
 
             // result lines
+            const RGBAValue
+                result = line1 * dy1 + line2 * dy + RGBAValue(.5, .5, .5, .5);
 
-            dst_data[0] = static_cast<unsigned char>(r1 * dy1 + r2 * dy + .5);
-            dst_data[1] = static_cast<unsigned char>(g1 * dy1 + g2 * dy + .5);
-            dst_data[2] = static_cast<unsigned char>(b1 * dy1 + b2 * dy + .5);
+            result.StoreRGB(dst_data);
             dst_data += 3;
 
-            if ( src_alpha )
-                *dst_alpha++ = static_cast<unsigned char>(a1 * dy1 + a2 * dy +.5);
+            if ( dst_alpha )
+                result.StoreAlpha(dst_alpha++);
         }
     }
+}
+
+// Same as ApplyBoxPrecalcs() but for bilinear interpolation.
+wxImage
+ApplyBilinearPrecalcs(const wxImage& image,
+                      const wxVector<BilinearPrecalc>& vPrecalcs,
+                      const wxVector<BilinearPrecalc>& hPrecalcs)
+{
+    const int width = hPrecalcs.size();
+    const int height = vPrecalcs.size();
+
+    wxImage ret_image(width, height, false);
+    const unsigned char* src_data = image.GetData();
+    const unsigned char* src_alpha = image.GetAlpha();
+    unsigned char* dst_data = ret_image.GetData();
+    unsigned char* dst_alpha = nullptr;
+
+    wxCHECK_MSG( dst_data, ret_image, wxS("unable to create image") );
+
+    if ( src_alpha )
+    {
+        ret_image.SetAlpha();
+        dst_alpha = ret_image.GetAlpha();
+    }
+
+    const int src_width = image.GetWidth();
+    const int src_height = image.GetHeight();
+
+    // Caching the converted source pixels only makes sense if they're reused,
+    // i.e. if we're enlarging the image in at least one direction.
+    const bool useCache = width > src_width || height > src_height;
+
+    wxParallelFor
+    (
+        height,
+        GetThreadCountForResampling(src_width, src_height, width, height),
+        [&](int yStart, int yEnd)
+        {
+            unsigned char* const dst_data_band = dst_data + yStart*width*3;
+            unsigned char* const dst_alpha_band = dst_alpha ? dst_alpha + yStart*width
+                                                            : nullptr;
+
+            if ( useCache )
+            {
+                RGBARowCache rows(src_data, src_alpha, src_width, 2);
+                for ( const BilinearPrecalc& hPrecalc : hPrecalcs )
+                {
+                    rows.AddColumn(hPrecalc.offset1);
+                    rows.AddColumn(hPrecalc.offset2);
+                }
+
+                DoResampleBilinear(rows, vPrecalcs, hPrecalcs, yStart, yEnd,
+                                   dst_data_band, dst_alpha_band);
+            }
+            else
+            {
+                RGBADirectRows rows(src_data, src_alpha, src_width);
+                DoResampleBilinear(rows, vPrecalcs, hPrecalcs, yStart, yEnd,
+                                   dst_data_band, dst_alpha_band);
+            }
+        }
+    );
 
     return ret_image;
 }
 
+} // anonymous namespace
+
+wxImage wxImage::ResampleBilinear(int width, int height) const
+{
+    // This function implements a Bilinear algorithm for resampling.
+    wxVector<BilinearPrecalc> vPrecalcs(height);
+    wxVector<BilinearPrecalc> hPrecalcs(width);
+    ResampleBilinearPrecalc(vPrecalcs, M_IMGDATA->m_height);
+    ResampleBilinearPrecalc(hPrecalcs, M_IMGDATA->m_width);
+
+    return ApplyBilinearPrecalcs(*this, vPrecalcs, hPrecalcs);
+}
+
 // The following two local functions are for the B-spline weighting of the
 // bicubic sampling algorithm
 static inline double spline_cube(double value)
@@ -917,32 +1442,188 @@ inline void DoCalc(BicubicPrecalc& precalc, double srcpixd, int oldDim)
     }
 }
 
-void ResampleBicubicPrecalc(wxVector<BicubicPrecalc> &aWeight, int oldDim)
+void ResampleBicubicPrecalc(wxVector<BicubicPrecalc> &aWeight, int oldDim)
+{
+    const int newDim = aWeight.size();
+    wxASSERT( oldDim > 0 && newDim > 0 );
+
+    if ( newDim > 1 )
+    {
+        // We want to map pixels in the range [0..newDim-1]
+        // to the range [0..oldDim-1]
+        const double scale_factor = static_cast<double>(oldDim-1) / (newDim-1);
+
+        for ( int dstd = 0; dstd < newDim; dstd++ )
+        {
+            // We need to calculate the source pixel to interpolate from - Y-axis
+            const double srcpixd = static_cast<double>(dstd) * scale_factor;
+
+            DoCalc(aWeight[dstd], srcpixd, oldDim);
+        }
+    }
+    else
+    {
+        // Let's take the pixel from the center of the source image.
+        const double srcpixd = static_cast<double>(oldDim - 1) / 2.0;
+
+        DoCalc(aWeight[0], srcpixd, oldDim);
+    }
+}
+
+// Same as DoResampleBilinear() but using bicubic interpolation.
+template <typename Rows>
+void DoResampleBicubic(Rows& rows,
+                       const wxVector<BicubicPrecalc>& vPrecalcs,
+                       const wxVector<BicubicPrecalc>& hPrecalcs,
+                       int yStart,
+                       int yEnd,
+                       unsigned char* dst_data,
+                       unsigned char* dst_alpha)
+{
+    for ( int y = yStart; y < yEnd; y++ )
+    {
+        // We need to calculate the source pixel to interpolate from - Y-axis
+        const BicubicPrecalc& vPrecalc = vPrecalcs[y];
+        const typename Rows::Row srcRows[4] =
+        {
+            rows.GetRow(vPrecalc.offset[0]),
+            rows.GetRow(vPrecalc.offset[1]),
+            rows.GetRow(vPrecalc.offset[2]),
+            rows.GetRow(vPrecalc.offset[3]),
+        };
+
+        for ( const BicubicPrecalc& hPrecalc : hPrecalcs )
+        {
+            // Sums for each color channel
+            RGBAValue sum;
+
+            // Here we actually determine the RGBA values for the destination pixel
+            for ( int k = -1; k <= 2; k++ )
+            {
+                // Source row corresponding to the Y offset
+                const typename Rows::Row& srcRow = srcRows[k + 1];
+
+                // Loop across the X axis
+                for ( int i = -1; i <= 2; i++ )
+                {
+                    // X offset
+                    const int x_offset = hPrecalc.offset[i + 1];
+
+                    // Calculate the weight for the specified pixel according
+                    // to the bicubic b-spline kernel we're using for
+                    // interpolation
+                    const double
+                        pixel_weight = vPrecalc.weight[k + 1] * hPrecalc.weight[i + 1];
+
+                    // Create a sum of all velues for each color channel
+                    // adjusted for the pixel's calculated weight
+                    if ( dst_alpha )
+                    {
+                        // Colour channels are weighted by alpha, but the alpha
+                        // channel itself is not as its weight is 1.
+                        sum += srcRow.Pixel(x_offset) * pixel_weight
+                                * srcRow.AlphaWeight(x_offset);
+                    }
+                    else
+                    {
+                        sum += srcRow.Pixel(x_offset) * pixel_weight;
+                    }
+                }
+            }
+
+            // Put the data into the destination image.  The summed values are
+            // of double data type and are rounded here for accuracy
+            if ( dst_alpha )
+            {
+                const double sum_a = sum.A();
+                if (sum_a != 0)
+                {
+                    // Leave the alpha channel unchanged by dividing it by 1
+                    // and adding 0 to it.
+                    const RGBAValue result = sum / RGBAValue(sum_a, sum_a, sum_a, 1)
+                                                + RGBAValue(0.5, 0.5, 0.5, 0);
+                    result.StoreRGB(dst_data);
+                }
+                else
+                {
+                    dst_data[0] = 0;
+                    dst_data[1] = 0;
+                    dst_data[2] = 0;
+                }
+                sum.StoreAlpha(dst_alpha++);
+            }
+            else
+            {
+                const RGBAValue result = sum + RGBAValue(0.5, 0.5, 0.5, 0.5);
+                result.StoreRGB(dst_data);
+            }
+            dst_data += 3;
+        }
+    }
+}
+
+// Same as ApplyBoxPrecalcs() but for bicubic interpolation.
+wxImage
+ApplyBicubicPrecalcs(const wxImage& image,
+                     const wxVector<BicubicPrecalc>& vPrecalcs,
+                     const wxVector<BicubicPrecalc>& hPrecalcs)
 {
-    const int newDim = aWeight.size();
-    wxASSERT( oldDim > 0 && newDim > 0 );
+    const int width = hPrecalcs.size();
+    const int height = vPrecalcs.size();
 
-    if ( newDim > 1 )
+    wxImage ret_image(width, height, false);
+
+    const unsigned char* src_data = image.GetData();
+    const unsigned char* src_alpha = image.GetAlpha();
+    unsigned char* dst_data = ret_image.GetData();
+    unsigned char* dst_alpha = nullptr;
+
+    wxCHECK_MSG( dst_data, ret_image, wxS("unable to create image") );
+
+    if ( src_alpha )
     {
-        // We want to map pixels in the range [0..newDim-1]
-        // to the range [0..oldDim-1]
-        const double scale_factor = static_cast<double>(oldDim-1) / (newDim-1);
+        ret_image.SetAlpha();
+        dst_alpha = ret_image.GetAlpha();
+    }
 
-        for ( int dstd = 0; dstd < newDim; dstd++ )
+    const int src_width = image.GetWidth();
+    const int src_height = image.GetHeight();
+
+    // See the comment in ApplyBilinearPrecalcs().
+    const bool useCache = width > src_width || height > src_height;
+
+    wxParallelFor
+    (
+        height,
+        GetThreadCountForResampling(src_width, src_height, width, height),
+        [&](int yStart, int yEnd)
         {
-            // We need to calculate the source pixel to interpolate from - Y-axis
-            const double srcpixd = static_cast<double>(dstd) * scale_factor;
+            unsigned char* const dst_data_band = dst_data + yStart*width*3;
+            unsigned char* const dst_alpha_band = dst_alpha ? dst_alpha + yStart*width
+                                                            : nullptr;
 
-            DoCalc(aWeight[dstd], srcpixd, oldDim);
+            if ( useCache )
+            {
+                RGBARowCache rows(src_data, src_alpha, src_width, 4);
+                for ( const BicubicPrecalc& hPrecalc : hPrecalcs )
+                {
+                    for ( const int x : hPrecalc.offset )
+                        rows.AddColumn(x);
+                }
+
+                DoResampleBicubic(rows, vPrecalcs, hPrecalcs, yStart, yEnd,
+                                  dst_data_band, dst_alpha_band);
+            }
+            else
+            {
+                RGBADirectRows rows(src_data, src_alpha, src_width);
+                DoResampleBicubic(rows, vPrecalcs, hPrecalcs, yStart, yEnd,
+                                  dst_data_band, dst_alpha_band);
+            }
         }
-    }
-    else
-    {
-        // Let's take the pixel from the center of the source image.
-        const double srcpixd = static_cast<double>(oldDim - 1) / 2.0;
+    );
 
-        DoCalc(aWeight[0], srcpixd, oldDim);
-    }
+    return ret_image;
 }
 
 } // anonymous namespace
@@ -976,23 +1657,6 @@ wxImage wxImage::ResampleBicubic(int width, int height) const
     // NOTE: below the y_offset and x_offset variables are being set for edge
     // pixels using the "Mirror" method mentioned above
 
-    wxImage ret_image;
-
-    ret_image.Create(width, height, false);
-
-    const unsigned char* src_data = M_IMGDATA->m_data;
-    const unsigned char* src_alpha = M_IMGDATA->m_alpha;
-    unsigned char* dst_data = ret_image.GetData();
-    unsigned char* dst_alpha = nullptr;
-
-    wxCHECK_MSG( dst_data, ret_image, wxS("unable to create image") );
-
-    if ( src_alpha )
-    {
-        ret_image.SetAlpha();
-        dst_alpha = ret_image.GetAlpha();
-    }
-
     // Precalculate weights
     wxVector<BicubicPrecalc> vPrecalcs(height);
     wxVector<BicubicPrecalc> hPrecalcs(width);
@@ -1000,88 +1664,142 @@ wxImage wxImage::ResampleBicubic(int width, int height) const
     ResampleBicubicPrecalc(vPrecalcs, M_IMGDATA->m_height);
     ResampleBicubicPrecalc(hPrecalcs, M_IMGDATA->m_width);
 
-    for ( int dsty = 0; dsty < height; dsty++ )
+    return ApplyBicubicPrecalcs(*this, vPrecalcs, hPrecalcs);
+}
+
+// ----------------------------------------------------------------------------
+// wxImageResampler
+// ----------------------------------------------------------------------------
+
+// This class contains the tables precomputed for the chosen resampling method.
+class wxImageResamplerImpl
+{
+public:
+    wxImageResamplerImpl(const wxSize& srcSize,
+                         const wxSize& dstSize,
+                         wxImageResizeQuality quality)
+        : m_quality(quality)
     {
-        // We need to calculate the source pixel to interpolate from - Y-axis
-        const BicubicPrecalc& vPrecalc = vPrecalcs[dsty];
+        // Choose the method in the same way as wxImage::Scale() does.
+        if ( m_quality == wxIMAGE_QUALITY_HIGH )
+        {
+            m_quality = dstSize.x < srcSize.x && dstSize.y < srcSize.y
+                            ? wxIMAGE_QUALITY_BOX_AVERAGE
+                            : wxIMAGE_QUALITY_BICUBIC;
+        }
 
-        for ( int dstx = 0; dstx < width; dstx++ )
+        switch ( m_quality )
         {
-            // X-axis of pixel to interpolate from
-            const BicubicPrecalc& hPrecalc = hPrecalcs[dstx];
+            case wxIMAGE_QUALITY_NEAREST:
+                // There is nothing to precompute for this method.
+                break;
 
-            // Sums for each color channel
-            double sum_r = 0, sum_g = 0, sum_b = 0, sum_a = 0;
+            case wxIMAGE_QUALITY_BILINEAR:
+                m_vBilinear.resize(dstSize.y);
+                m_hBilinear.resize(dstSize.x);
+                ResampleBilinearPrecalc(m_vBilinear, srcSize.y);
+                ResampleBilinearPrecalc(m_hBilinear, srcSize.x);
+                break;
 
-            // Here we actually determine the RGBA values for the destination pixel
-            for ( int k = -1; k <= 2; k++ )
-            {
-                // Y offset
-                const int y_offset = vPrecalc.offset[k + 1];
+            case wxIMAGE_QUALITY_BICUBIC:
+                m_vBicubic.resize(dstSize.y);
+                m_hBicubic.resize(dstSize.x);
+                ResampleBicubicPrecalc(m_vBicubic, srcSize.y);
+                ResampleBicubicPrecalc(m_hBicubic, srcSize.x);
+                break;
 
-                // Loop across the X axis
-                for ( int i = -1; i <= 2; i++ )
-                {
-                    // X offset
-                    const int x_offset = hPrecalc.offset[i + 1];
+            case wxIMAGE_QUALITY_BOX_AVERAGE:
+                m_vBox.resize(dstSize.y);
+                m_hBox.resize(dstSize.x);
+                ResampleBoxPrecalc(m_vBox, srcSize.y);
+                ResampleBoxPrecalc(m_hBox, srcSize.x);
+                break;
 
-                    // Calculate the exact position where the source data
-                    // should be pulled from based on the x_offset and y_offset
-                    int src_pixel_index = y_offset*M_IMGDATA->m_width + x_offset;
+            case wxIMAGE_QUALITY_HIGH:
+                wxFAIL_MSG( wxS("unreachable") );
+                break;
+        }
+    }
 
-                    // Calculate the weight for the specified pixel according
-                    // to the bicubic b-spline kernel we're using for
-                    // interpolation
-                    const double
-                        pixel_weight = vPrecalc.weight[k + 1] * hPrecalc.weight[i + 1];
+    wxImage Resample(const wxImage& image, const wxSize& dstSize) const
+    {
+        switch ( m_quality )
+        {
+            case wxIMAGE_QUALITY_NEAREST:
+                return image.Scale(dstSize.x, dstSize.y, wxIMAGE_QUALITY_NEAREST);
 
-                    // Create a sum of all velues for each color channel
-                    // adjusted for the pixel's calculated weight
-                    if ( src_alpha )
-                    {
-                        const unsigned char a = src_alpha[src_pixel_index];
-                        sum_r += src_data[src_pixel_index * 3 + 0] * pixel_weight * a;
-                        sum_g += src_data[src_pixel_index * 3 + 1] * pixel_weight * a;
-                        sum_b += src_data[src_pixel_index * 3 + 2] * pixel_weight * a;
-                        sum_a += a * pixel_weight;
-                    }
-                    else
-                    {
-                        sum_r += src_data[src_pixel_index * 3 + 0] * pixel_weight;
-                        sum_g += src_data[src_pixel_index * 3 + 1] * pixel_weight;
-                        sum_b += src_data[src_pixel_index * 3 + 2] * pixel_weight;
-                    }
-                }
-            }
+            case wxIMAGE_QUALITY_BILINEAR:
+                return ApplyBilinearPrecalcs(image, m_vBilinear, m_hBilinear);
 
-            // Put the data into the destination image.  The summed values are
-            // of double data type and are rounded here for accuracy
-            if ( src_alpha )
-            {
-                if (sum_a != 0)
-                {
-                     dst_data[0] = (unsigned char)(sum_r / sum_a + 0.5);
-                     dst_data[1] = (unsigned char)(sum_g / sum_a + 0.5);
-                     dst_data[2] = (unsigned char)(sum_b / sum_a + 0.5);
-                }
-                else
-                {
-                    dst_data[0] = 0;
-                    dst_data[1] = 0;
-                    dst_data[2] = 0;
-                }
-                *dst_alpha++ = (unsigned char)sum_a;
-            }
-            else
-            {
-                dst_data[0] = (unsigned char)(sum_r + 0.5);
-                dst_data[1] = (unsigned char)(sum_g + 0.5);
-                dst_data[2] = (unsigned char)(sum_b + 0.5);
-            }
-            dst_data += 3;
+            case wxIMAGE_QUALITY_BICUBIC:
+                return ApplyBicubicPrecalcs(image, m_vBicubic, m_hBicubic);
+
+            case wxIMAGE_QUALITY_BOX_AVERAGE:
+                return ApplyBoxPrecalcs(image, m_vBox, m_hBox);
+
+            case wxIMAGE_QUALITY_HIGH:
+                // This is never used as it's replaced in the ctor.
+                break;
         }
+
+        wxFAIL_MSG( wxS("unreachable") );
+
+        return wxImage();
     }
 
+private:
+    // The actually used quality, never wxIMAGE_QUALITY_HIGH.
+    wxImageResizeQuality m_quality;
+
+    // Only the tables corresponding to m_quality are non-empty.
+    wxVector<BoxPrecalc> m_vBox,
+                         m_hBox;
+    wxVector<BilinearPrecalc> m_vBilinear,
+                              m_hBilinear;
+    wxVector<BicubicPrecalc> m_vBicubic,
+                             m_hBicubic;
+
+    wxDECLARE_NO_COPY_CLASS(wxImageResamplerImpl);
+};
+
+wxImageResampler::wxImageResampler(const wxSize& srcSize,
+                                   const wxSize& dstSize,
+                                   wxImageResizeQuality quality)
+    : m_srcSize(srcSize),
+      m_dstSize(dstSize),
+      m_quality(quality),
+      m_impl(nullptr)
+{
+    wxCHECK_RET( srcSize.x > 0 && srcSize.y > 0 &&
+                    dstSize.x > 0 && dstSize.y > 0,
+                 wxS("invalid image size") );
+
+    m_impl = new wxImageResamplerImpl(srcSize, dstSize, quality);
+}
+
+wxImageResampler::~wxImageResampler()
+{
+    delete m_impl;
+}
+
+wxImage wxImageResampler::Scale(const wxImage& image) const
+{
+    wxCHECK_MSG( m_impl, wxImage(), wxS("invalid resampler") );
+    wxCHECK_MSG( image.IsOk(), wxImage(), wxS("invalid image") );
+    wxCHECK_MSG( image.GetSize() == m_srcSize, wxImage(),
+                 wxS("image size doesn't match the resampler source size") );
+
+    // Don't do anything in this case, just as wxImage::Scale() doesn't.
+    if ( m_srcSize == m_dstSize )
+        return image;
+
+    wxImage ret_image = m_impl->Resample(image, m_dstSize);
+
+    // wxImage::Scale(), used for the nearest neighbour method, already takes
+    // care of copying the attributes.
+    if ( ret_image.IsOk() && m_quality != wxIMAGE_QUALITY_NEAREST )
+        CopyScaledAttributes(image, ret_image);
+
     return ret_image;
 }
 
@@ -1102,88 +1820,97 @@ wxImage wxImage::BlurHorizontal(int blurRadius) const
 
     // Horizontal blurring algorithm - average all pixels in the specified blur
     // radius in the X or horizontal direction
-    for ( int y = 0; y < M_IMGDATA->m_height; y++ )
-    {
-        // Variables used in the blurring algorithm
-        long sum_r = 0,
-             sum_g = 0,
-             sum_b = 0,
-             sum_a = 0;
-
-        long pixel_idx;
-        const unsigned char *src;
-        unsigned char *dst;
-
-        // Calculate the average of all pixels in the blur radius for the first
-        // pixel of the row
-        for ( int kernel_x = -blurRadius; kernel_x <= blurRadius; kernel_x++ )
-        {
-            // To deal with the pixels at the start of a row so it's not
-            // grabbing GOK values from memory at negative indices of the
-            // image's data or grabbing from the previous row
-            if ( kernel_x < 0 )
-                pixel_idx = y * M_IMGDATA->m_width;
-            else
-                pixel_idx = kernel_x + y * M_IMGDATA->m_width;
-
-            src = src_data + pixel_idx*3;
-            sum_r += src[0];
-            sum_g += src[1];
-            sum_b += src[2];
-            if ( src_alpha )
-                sum_a += src_alpha[pixel_idx];
-        }
-
-        dst = dst_data + y * M_IMGDATA->m_width*3;
-        dst[0] = (unsigned char)(sum_r / blurArea);
-        dst[1] = (unsigned char)(sum_g / blurArea);
-        dst[2] = (unsigned char)(sum_b / blurArea);
-        if ( src_alpha )
-            dst_alpha[y * M_IMGDATA->m_width] = (unsigned char)(sum_a / blurArea);
-
-        // Now average the values of the rest of the pixels by just moving the
-        // blur radius box along the row
-        for ( int x = 1; x < M_IMGDATA->m_width; x++ )
-        {
-            // Take care of edge pixels on the left edge by essentially
-            // duplicating the edge pixel
-            if ( x - blurRadius - 1 < 0 )
-                pixel_idx = y * M_IMGDATA->m_width;
-            else
-                pixel_idx = (x - blurRadius - 1) + y * M_IMGDATA->m_width;
-
-            // Subtract the value of the pixel at the left side of the blur
-            // radius box
-            src = src_data + pixel_idx*3;
-            sum_r -= src[0];
-            sum_g -= src[1];
-            sum_b -= src[2];
-            if ( src_alpha )
-                sum_a -= src_alpha[pixel_idx];
-
-            // Take care of edge pixels on the right edge
-            if ( x + blurRadius > M_IMGDATA->m_width - 1 )
-                pixel_idx = M_IMGDATA->m_width - 1 + y * M_IMGDATA->m_width;
-            else
-                pixel_idx = x + blurRadius + y * M_IMGDATA->m_width;
+    wxParallelFor
+    (
+        M_IMGDATA->m_height,
+        GetThreadCountForPixels(static_cast<long long>(M_IMGDATA->m_width)
+                                    * M_IMGDATA->m_height),
+        [&](int yStart, int yEnd)
+        {
+            for ( int y = yStart; y < yEnd; y++ )
+            {
+                // Variables used in the blurring algorithm
+                long sum_r = 0,
+                     sum_g = 0,
+                     sum_b = 0,
+                     sum_a = 0;
+
+                long pixel_idx;
+                const unsigned char *src;
+                unsigned char *dst;
+
+                // Calculate the average of all pixels in the blur radius for the first
+                // pixel of the row
+                for ( int kernel_x = -blurRadius; kernel_x <= blurRadius; kernel_x++ )
+                {
+                    // To deal with the pixels at the start of a row so it's not
+                    // grabbing GOK values from memory at negative indices of the
+                    // image's data or grabbing from the previous row
+                    if ( kernel_x < 0 )
+                        pixel_idx = y * M_IMGDATA->m_width;
+                    else
+                        pixel_idx = kernel_x + y * M_IMGDATA->m_width;
+
+                    src = src_data + pixel_idx*3;
+                    sum_r += src[0];
+                    sum_g += src[1];
+                    sum_b += src[2];
+                    if ( src_alpha )
+                        sum_a += src_alpha[pixel_idx];
+                }
+
+                dst = dst_data + y * M_IMGDATA->m_width*3;
+                dst[0] = (unsigned char)(sum_r / blurArea);
+                dst[1] = (unsigned char)(sum_g / blurArea);
+                dst[2] = (unsigned char)(sum_b / blurArea);
+                if ( src_alpha )
+                    dst_alpha[y * M_IMGDATA->m_width] = (unsigned char)(sum_a / blurArea);
+
+                // Now average the values of the rest of the pixels by just moving the
+                // blur radius box along the row
+                for ( int x = 1; x < M_IMGDATA->m_width; x++ )
+                {
+                    // Take care of edge pixels on the left edge by essentially
+                    // duplicating the edge pixel
+                    if ( x - blurRadius - 1 < 0 )
+                        pixel_idx = y * M_IMGDATA->m_width;
+                    else
+                        pixel_idx = (x - blurRadius - 1) + y * M_IMGDATA->m_width;
+
+                    // Subtract the value of the pixel at the left side of the blur
+                    // radius box
+                    src = src_data + pixel_idx*3;
+                    sum_r -= src[0];
+                    sum_g -= src[1];
+                    sum_b -= src[2];
+                    if ( src_alpha )
+                        sum_a -= src_alpha[pixel_idx];
+
+                    // Take care of edge pixels on the right edge
+                    if ( x + blurRadius > M_IMGDATA->m_width - 1 )
+                        pixel_idx = M_IMGDATA->m_width - 1 + y * M_IMGDATA->m_width;
+                    else
+                        pixel_idx = x + blurRadius + y * M_IMGDATA->m_width;
 
-            // Add the value of the pixel being added to the end of our box
-            src = src_data + pixel_idx*3;
-            sum_r += src[0];
-            sum_g += src[1];
-            sum_b += src[2];
-            if ( src_alpha )
-                sum_a += src_alpha[pixel_idx];
+                    // Add the value of the pixel being added to the end of our box
+                    src = src_data + pixel_idx*3;
+                    sum_r += src[0];
+                    sum_g += src[1];
+                    sum_b += src[2];
+                    if ( src_alpha )
+                        sum_a += src_alpha[pixel_idx];
 
-            // Save off the averaged data
-            dst = dst_data + x*3 + y*M_IMGDATA->m_width*3;
-            dst[0] = (unsigned char)(sum_r / blurArea);
-            dst[1] = (unsigned char)(sum_g / blurArea);
-            dst[2] = (unsigned char)(sum_b / blurArea);
-            if ( src_alpha )
-                dst_alpha[x + y * M_IMGDATA->m_width] = (unsigned char)(sum_a / blurArea);
+                    // Save off the averaged data
+                    dst = dst_data + x*3 + y*M_IMGDATA->m_width*3;
+                    dst[0] = (unsigned char)(sum_r / blurArea);
+                    dst[1] = (unsigned char)(sum_g / blurArea);
+                    dst[2] = (unsigned char)(sum_b / blurArea);
+                    if ( src_alpha )
+                        dst_alpha[x + y * M_IMGDATA->m_width] = (unsigned char)(sum_a / blurArea);
+                }
+            }
         }
-    }
+    );
 
     return ret_image;
 }
@@ -1205,88 +1932,97 @@ wxImage wxImage::BlurVertical(int blurRadius) const
 
     // Vertical blurring algorithm - same as horizontal but switched the
     // opposite direction
-    for ( int x = 0; x < M_IMGDATA->m_width; x++ )
-    {
-        // Variables used in the blurring algorithm
-        long sum_r = 0,
-             sum_g = 0,
-             sum_b = 0,
-             sum_a = 0;
-
-        long pixel_idx;
-        const unsigned char *src;
-        unsigned char *dst;
-
-        // Calculate the average of all pixels in our blur radius box for the
-        // first pixel of the column
-        for ( int kernel_y = -blurRadius; kernel_y <= blurRadius; kernel_y++ )
-        {
-            // To deal with the pixels at the start of a column so it's not
-            // grabbing GOK values from memory at negative indices of the
-            // image's data or grabbing from the previous column
-            if ( kernel_y < 0 )
-                pixel_idx = x;
-            else
-                pixel_idx = x + kernel_y * M_IMGDATA->m_width;
-
-            src = src_data + pixel_idx*3;
-            sum_r += src[0];
-            sum_g += src[1];
-            sum_b += src[2];
-            if ( src_alpha )
-                sum_a += src_alpha[pixel_idx];
-        }
-
-        dst = dst_data + x*3;
-        dst[0] = (unsigned char)(sum_r / blurArea);
-        dst[1] = (unsigned char)(sum_g / blurArea);
-        dst[2] = (unsigned char)(sum_b / blurArea);
-        if ( src_alpha )
-            dst_alpha[x] = (unsigned char)(sum_a / blurArea);
-
-        // Now average the values of the rest of the pixels by just moving the
-        // box along the column from top to bottom
-        for ( int y = 1; y < M_IMGDATA->m_height; y++ )
-        {
-            // Take care of pixels that would be beyond the top edge by
-            // duplicating the top edge pixel for the column
-            if ( y - blurRadius - 1 < 0 )
-                pixel_idx = x;
-            else
-                pixel_idx = x + (y - blurRadius - 1) * M_IMGDATA->m_width;
-
-            // Subtract the value of the pixel at the top of our blur radius box
-            src = src_data + pixel_idx*3;
-            sum_r -= src[0];
-            sum_g -= src[1];
-            sum_b -= src[2];
-            if ( src_alpha )
-                sum_a -= src_alpha[pixel_idx];
-
-            // Take care of the pixels that would be beyond the bottom edge of
-            // the image similar to the top edge
-            if ( y + blurRadius > M_IMGDATA->m_height - 1 )
-                pixel_idx = x + (M_IMGDATA->m_height - 1) * M_IMGDATA->m_width;
-            else
-                pixel_idx = x + (blurRadius + y) * M_IMGDATA->m_width;
+    wxParallelFor
+    (
+        M_IMGDATA->m_width,
+        GetThreadCountForPixels(static_cast<long long>(M_IMGDATA->m_width)
+                                    * M_IMGDATA->m_height),
+        [&](int xStart, int xEnd)
+        {
+            for ( int x = xStart; x < xEnd; x++ )
+            {
+                // Variables used in the blurring algorithm
+                long sum_r = 0,
+                     sum_g = 0,
+                     sum_b = 0,
+                     sum_a = 0;
+
+                long pixel_idx;
+                const unsigned char *src;
+                unsigned char *dst;
+
+                // Calculate the average of all pixels in our blur radius box for the
+                // first pixel of the column
+                for ( int kernel_y = -blurRadius; kernel_y <= blurRadius; kernel_y++ )
+                {
+                    // To deal with the pixels at the start of a column so it's not
+                    // grabbing GOK values from memory at negative indices of the
+                    // image's data or grabbing from the previous column
+                    if ( kernel_y < 0 )
+                        pixel_idx = x;
+                    else
+                        pixel_idx = x + kernel_y * M_IMGDATA->m_width;
 
-            // Add the value of the pixel being added to the end of our box
-            src = src_data + pixel_idx*3;
-            sum_r += src[0];
-            sum_g += src[1];
-            sum_b += src[2];
-            if ( src_alpha )
-                sum_a += src_alpha[pixel_idx];
+                    src = src_data + pixel_idx*3;
+                    sum_r += src[0];
+                    sum_g += src[1];
+                    sum_b += src[2];
+                    if ( src_alpha )
+                        sum_a += src_alpha[pixel_idx];
+                }
+
+                dst = dst_data + x*3;
+                dst[0] = (unsigned char)(sum_r / blurArea);
+                dst[1] = (unsigned char)(sum_g / blurArea);
+                dst[2] = (unsigned char)(sum_b / blurArea);
+                if ( src_alpha )
+                    dst_alpha[x] = (unsigned char)(sum_a / blurArea);
+
+                // Now average the values of the rest of the pixels by just moving the
+                // box along the column from top to bottom
+                for ( int y = 1; y < M_IMGDATA->m_height; y++ )
+                {
+                    // Take care of pixels that would be beyond the top edge by
+                    // duplicating the top edge pixel for the column
+                    if ( y - blurRadius - 1 < 0 )
+                        pixel_idx = x;
+                    else
+                        pixel_idx = x + (y - blurRadius - 1) * M_IMGDATA->m_width;
+
+                    // Subtract the value of the pixel at the top of our blur radius box
+                    src = src_data + pixel_idx*3;
+                    sum_r -= src[0];
+                    sum_g -= src[1];
+                    sum_b -= src[2];
+                    if ( src_alpha )
+                        sum_a -= src_alpha[pixel_idx];
 
-            // Save off the averaged data
-            dst = dst_data + (x + y * M_IMGDATA->m_width) * 3;
-            dst[0] = (unsigned char)(sum_r / blurArea);
-            dst[1] = (unsigned char)(sum_g / blurArea);
-            dst[2] = (unsigned char)(sum_b / blurArea);
-            if ( src_alpha )
-                dst_alpha[x + y * M_IMGDATA->m_width] = (unsigned char)(sum_a / blurArea);
+                    // Take care of the pixels that would be beyond the bottom edge of
+                    // the image similar to the top edge
+                    if ( y + blurRadius > M_IMGDATA->m_height - 1 )
+                        pixel_idx = x + (M_IMGDATA->m_height - 1) * M_IMGDATA->m_width;
+                    else
+                        pixel_idx = x + (blurRadius + y) * M_IMGDATA->m_width;
+
+                    // Add the value of the pixel being added to the end of our box
+                    src = src_data + pixel_idx*3;
+                    sum_r += src[0];
+                    sum_g += src[1];
+                    sum_b += src[2];
+                    if ( src_alpha )
+                        sum_a += src_alpha[pixel_idx];
+
+                    // Save off the averaged data
+                    dst = dst_data + (x + y * M_IMGDATA->m_width) * 3;
+                    dst[0] = (unsigned char)(sum_r / blurArea);
+                    dst[1] = (unsigned char)(sum_g / blurArea);
+                    dst[2] = (unsigned char)(sum_b / blurArea);
+                    if ( src_alpha )
+                        dst_alpha[x + y * M_IMGDATA->m_width] = (unsigned char)(sum_a / blurArea);
+                }
+            }
         }
-    }
+    );
 
     return ret_image;
 }
@@ -1835,24 +2571,8 @@ void wxImage::Replace( unsigned char r1, unsigned char g1, unsigned char b1,
 {
     wxCHECK_RET( IsOk(), wxT("invalid image") );
 
-    AllocExclusive();
-
-    unsigned char *data = GetData();
-
-    const int w = GetWidth();
-    const int h = GetHeight();
-
-    for (int j = 0; j < h; j++)
-        for (int i = 0; i < w; i++)
-        {
-            if ((data[0] == r1) && (data[1] == g1) && (data[2] == b1))
-            {
-                data[0] = r2;
-                data[1] = g2;
-                data[2] = b2;
-            }
-            data += 3;
-        }
+    DoApplyColourTransform(wxImageColourTransform().Replace(r1, g1, b1, r2, g2, b2),
+                           false /* don't skip mask */);
 }
 
 wxImage wxImage::ConvertToGreyscale() const
@@ -1863,12 +2583,8 @@ wxImage wxImage::ConvertToGreyscale() const
 wxImage wxImage::ConvertToGreyscale(double weight_r, double weight_g, double weight_b) const
 {
     wxImage image = *this;
-    image.ApplyToAllPixels([&image, weight_r, weight_g, weight_b](unsigned char *rgb)
-    {
-        if ( !image.HasMask() || rgb[0] != image.GetMaskRed() ||
-             rgb[1] != image.GetMaskGreen() || rgb[2] != image.GetMaskBlue() )
-            wxColour::MakeGrey(rgb, rgb + 1, rgb + 2, weight_r, weight_g, weight_b);
-    });
+    image.ApplyColourTransform(
+        wxImageColourTransform().ConvertToGreyscale(weight_r, weight_g, weight_b));
     return image;
 }
 
@@ -1895,28 +2611,24 @@ wxImage wxImage::ConvertToMono(unsigned char r, unsigned char g, unsigned char b
 wxImage wxImage::ConvertToDisabled(unsigned char brightness) const
 {
     wxImage image = *this;
-    image.ApplyToAllPixels([&image, brightness](unsigned char *rgb)
-    {
-        if ( !image.HasMask() || rgb[0] != image.GetMaskRed() ||
-             rgb[1] != image.GetMaskGreen() || rgb[2] != image.GetMaskBlue() )
-            wxColour::MakeDisabled(rgb, rgb + 1, rgb + 2, brightness);
-    });
+    image.ApplyColourTransform(wxImageColourTransform().ConvertToDisabled(brightness));
     return image;
 }
 
 wxImage wxImage::ChangeLightness(int alpha) const
 {
-    wxASSERT(alpha >= 0 && alpha <= 200);
     wxImage image = *this;
-    image.ApplyToAllPixels([&image, alpha](unsigned char *rgb)
-    {
-        if ( !image.HasMask() || rgb[0] != image.GetMaskRed() ||
-             rgb[1] != image.GetMaskGreen() || rgb[2] != image.GetMaskBlue() )
-            wxColour::ChangeLightness(rgb, rgb + 1, rgb + 2, alpha);
-    });
+    image.ApplyColourTransform(wxImageColourTransform().ChangeLightness(alpha));
     return image;
 }
 
+void wxImage::ApplyColourTransform(const wxImageColourTransform& transform)
+{
+    wxCHECK_RET( IsOk(), wxT("invalid image") );
+
+    DoApplyColourTransform(transform, true /* skip mask */);
+}
+
 int wxImage::GetWidth() const
 {
     wxCHECK_MSG( IsOk(), 0, wxT("invalid image") );
@@ -2233,6 +2945,82 @@ void wxImage::ClearAlpha()
     M_IMGDATA->m_alpha = nullptr;
 }
 
+bool wxImage::CreateFromPremultipliedARGB(int width, int height,
+                                          const wxUint32* data, int stride)
+{
+    wxCHECK_MSG( data, false, wxT("null pixel data") );
+
+    if ( !Create(width, height, false) )
+        return false;
+
+    SetAlpha();
+
+    if ( !stride )
+        stride = 4*width;
+
+    unsigned char* rgb = GetData();
+    unsigned char* alpha = GetAlpha();
+
+    std::vector<unsigned char> rgba(4*static_cast<size_t>(width));
+
+    const unsigned char* row = reinterpret_cast<const unsigned char*>(data);
+    for ( int y = 0; y < height; y++, row += stride )
+    {
+        wxUnpremultiplyPixels(reinterpret_cast<const wxUint32*>(row),
+                              &rgba[0], width);
+
+        const unsigned char* p = &rgba[0];
+        for ( int x = 0; x < width; x++, p += 4, rgb += 3 )
+        {
+            rgb[0] = p[0];
+            rgb[1] = p[1];
+            rgb[2] = p[2];
+            *alpha++ = p[3];
+        }
+    }
+
+    return true;
+}
+
+void wxImage::CopyToPremultipliedARGB(wxUint32* data, int stride) const
+{
+    wxCHECK_RET( IsOk(), wxT("invalid image") );
+    wxCHECK_RET( data, wxT("null pixel data") );
+
+    const int width = M_IMGDATA->m_width;
+    const int height = M_IMGDATA->m_height;
+
+    if ( !stride )
+        stride = 4*width;
+
+    const unsigned char* rgb = M_IMGDATA->m_data;
+    const unsigned char* alpha = M_IMGDATA->m_alpha;
+
+    unsigned char* row = reinterpret_cast<unsigned char*>(data);
+    for ( int y = 0; y < height; y++, row += stride )
+    {
+        wxUint32* const dst = reinterpret_cast<wxUint32*>(row);
+        if ( alpha )
+        {
+            for ( int x = 0; x < width; x++, rgb += 3 )
+            {
+                dst[x] = (wxUint32(*alpha++) << 24) | (wxUint32(rgb[0]) << 16) |
+                            (wxUint32(rgb[1]) << 8) | rgb[2];
+            }
+
+            wxPremultiplyPixels(dst, width);
+        }
+        else
+        {
+            for ( int x = 0; x < width; x++, rgb += 3 )
+            {
+                dst[x] = 0xff000000u | (wxUint32(rgb[0]) << 16) |
+                            (wxUint32(rgb[1]) << 8) | rgb[2];
+            }
+        }
+    }
+}
+
 
 // ----------------------------------------------------------------------------
 // mask support
@@ -2479,17 +3267,7 @@ void wxImage::SetOption(const wxString& name, const wxString& value)
 {
     AllocExclusive();
 
-    int idx = M_IMGDATA->m_optionNames.Index(name, false);
-    if ( idx == wxNOT_FOUND )
-    {
-        M_IMGDATA->m_optionNames.Add(name);
-        M_IMGDATA->m_optionValues.Add(value);
-    }
-    else
-    {
-        M_IMGDATA->m_optionNames[idx] = name;
-        M_IMGDATA->m_optionValues[idx] = value;
-    }
+    M_IMGDATA->m_options[name] = value;
 }
 
 void wxImage::SetOption(const wxString& name, int value)
@@ -2504,11 +3282,11 @@ wxString wxImage::GetOption(const wxString& name) const
     if ( !M_IMGDATA )
         return wxEmptyString;
 
-    int idx = M_IMGDATA->m_optionNames.Index(name, false);
-    if ( idx == wxNOT_FOUND )
+    const auto it = M_IMGDATA->m_options.find(name);
+    if ( it == M_IMGDATA->m_options.end() )
         return wxEmptyString;
     else
-        return M_IMGDATA->m_optionValues[idx];
+        return it->second;
 }
 
 int wxImage::GetOptionInt(const wxString& name) const
@@ -2518,7 +3296,7 @@ int wxImage::GetOptionInt(const wxString& name) const
 
 bool wxImage::HasOption(const wxString& name) const
 {
-    return M_IMGDATA ? M_IMGDATA->m_optionNames.Index(name, false) != wxNOT_FOUND
+    return M_IMGDATA ? M_IMGDATA->m_options.count(name) != 0
                      : false;
 }
 
@@ -2538,6 +3316,20 @@ int wxImage::GetDefaultLoadFlags()
     return wxImageRefData::sm_defaultLoadFlags;
 }
 
+/* static */
+void wxImage::SetDefaultThreadCount(int count)
+{
+    wxCHECK_RET( count >= 0, wxS("invalid number of threads") );
+
+    wxImageRefData::sm_defaultThreadCount = count;
+}
+
+/* static */
+int wxImage::GetDefaultThreadCount()
+{
+    return wxImageRefData::sm_defaultThreadCount;
+}
+
 void wxImage::SetLoadFlags(int flags)
 {
     AllocExclusive();
@@ -2550,6 +3342,13 @@ int wxImage::GetLoadFlags() const
     return M_IMGDATA ? M_IMGDATA->m_loadFlags : wxImageRefData::sm_defaultLoadFlags;
 }
 
+void wxImage::SetLoadProgressFunction(const wxImageLoadProgressFunction& progress)
+{
+    AllocExclusive();
+
+    M_IMGDATA->m_loadProgress = progress;
+}
+
 // Under Windows we can load wxImage not only from files but also from
 // resources.
 #if defined(__WINDOWS__) && wxUSE_WXDIB && wxUSE_IMAGE \
@@ -2766,6 +3565,67 @@ int wxImage::GetImageCount( const wxString& WXUNUSED_UNLESS_STREAMS(name),
 
 #if wxUSE_STREAMS
 
+namespace
+{
+
+// Return the type of the image in the given stream determined using the
+// signature at its beginning or wxBITMAP_TYPE_INVALID if it's unknown.
+//
+// This is much faster than calling CanRead() of all handlers in turn, but is
+// not definitive, so the handler CanRead() still needs to be called for the
+// returned type.
+wxBitmapType DetectImageType(wxInputStream& stream)
+{
+    const wxFileOffset posOld = stream.TellI();
+    if ( posOld == wxInvalidOffset )
+        return wxBITMAP_TYPE_INVALID;
+
+    unsigned char header[12];
+    const size_t len = stream.Read(header, sizeof(header)).LastRead();
+
+    if ( stream.SeekI(posOld) == wxInvalidOffset )
+        return wxBITMAP_TYPE_INVALID;
+
+    static const struct Signature
+    {
+        wxBitmapType type;
+        size_t offset;
+        const char* magic;
+        size_t len;
+    } signatures[] =
+    {
+        { wxBITMAP_TYPE_PNG,  0, "\x89PNG\r\n\x1a\n", 8 },
+        { wxBITMAP_TYPE_JPEG, 0, "\xff\xd8\xff",         3 },
+        { wxBITMAP_TYPE_GIF,  0, "GIF87a",               6 },
+        { wxBITMAP_TYPE_GIF,  0, "GIF89a",               6 },
+        { wxBITMAP_TYPE_BMP,  0, "BM",                   2 },
+        { wxBITMAP_TYPE_TIFF, 0, "II*\0",                4 },
+        { wxBITMAP_TYPE_TIFF, 0, "MM\0*",                4 },
+        { wxBITMAP_TYPE_ICO,  0, "\0\0\1\0",             4 },
+        { wxBITMAP_TYPE_CUR,  0, "\0\0\2\0",             4 },
+        { wxBITMAP_TYPE_ANI,  8, "ACON",                 4 },
+        { wxBITMAP_TYPE_IFF,  0, "FORM",                 4 },
+        { wxBITMAP_TYPE_XPM,  0, "/* XPM */",            9 },
+        { wxBITMAP_TYPE_PNM,  0, "P1",                   2 },
+        { wxBITMAP_TYPE_PNM,  0, "P2",                   2 },
+        { wxBITMAP_TYPE_PNM,  0, "P3",                   2 },
+        { wxBITMAP_TYPE_PNM,  0, "P4",                   2 },
+        { wxBITMAP_TYPE_PNM,  0, "P5",                   2 },
+        { wxBITMAP_TYPE_PNM,  0, "P6",                   2 },
+    };
+
+    for ( const auto& sig : signatures )
+    {
+        if ( len >= sig.offset + sig.len &&
+                memcmp(header + sig.offset, sig.magic, sig.len) == 0 )
+            return sig.type;
+    }
+
+    return wxBITMAP_TYPE_INVALID;
+}
+
+} // anonymous namespace
+
 bool wxImage::CanRead( wxInputStream &stream )
 {
     const wxList& list = GetHandlers();
@@ -2786,6 +3646,16 @@ int wxImage::GetImageCount( wxInputStream &stream, wxBitmapType type )
 
     if ( type == wxBITMAP_TYPE_ANY )
     {
+        // Try the handler corresponding to the image signature first.
+        wxImageHandler* const
+            detected = FindHandler(DetectImageType(stream));
+        if ( detected && detected->CanRead(stream) )
+        {
+            const int count = detected->GetImageCount(stream);
+            if ( count >= 0 )
+                return count;
+        }
+
         const wxList& list = GetHandlers();
 
         for ( wxList::compatibility_iterator node = list.GetFirst();
@@ -2793,6 +3663,9 @@ int wxImage::GetImageCount( wxInputStream &stream, wxBitmapType type )
               node = node->GetNext() )
         {
              handler = (wxImageHandler*)node->GetData();
+             if ( handler == detected )
+                 continue;
+
              if ( handler->CanRead(stream) )
              {
                  const int count = handler->GetImageCount(stream);
@@ -2832,6 +3705,10 @@ bool wxImage::DoLoad(wxImageHandler& handler, wxInputStream& stream, int index)
     const unsigned maxWidth = GetOptionInt(wxIMAGE_OPTION_MAX_WIDTH),
                    maxHeight = GetOptionInt(wxIMAGE_OPTION_MAX_HEIGHT);
 
+    // the progress function is reset by loading, as the other load settings
+    const wxImageLoadProgressFunction progress = M_IMGDATA->m_loadProgress;
+    const bool verbose = (M_IMGDATA->m_loadFlags & Load_Verbose) != 0;
+
     // Preserve the original stream position if possible to rewind back to it
     // if we failed to load the file -- maybe the next handler that we try can
     // succeed after us then.
@@ -2839,8 +3716,11 @@ bool wxImage::DoLoad(wxImageHandler& handler, wxInputStream& stream, int index)
     if ( stream.IsSeekable() )
         posOld = stream.TellI();
 
-    if ( !handler.LoadFile(this, stream,
-                           (M_IMGDATA->m_loadFlags & Load_Verbose) != 0, index) )
+    const bool ok = progress
+                        ? handler.LoadFileIncrementally(this, stream, progress,
+                                                        verbose, index)
+                        : handler.LoadFile(this, stream, verbose, index);
+    if ( !ok )
     {
         if ( posOld != wxInvalidOffset )
             stream.SeekI(posOld);
@@ -2909,12 +3789,24 @@ bool wxImage::LoadFile( wxInputStream& stream, wxBitmapType type, int index )
             return false;
         }
 
+        // Check the image signature to try the handler which is most likely
+        // to be able to load it first: this avoids calling CanRead() of all
+        // the other handlers, and creating them if they're not created yet.
+        wxImageHandler* const
+            detected = FindHandler(DetectImageType(stream));
+        if ( detected && detected->CanRead(stream) &&
+                DoLoad(*detected, stream, index) )
+            return true;
+
         const wxList& list = GetHandlers();
         for ( wxList::compatibility_iterator node = list.GetFirst();
               node;
               node = node->GetNext() )
         {
              handler = (wxImageHandler*)node->GetData();
+             if ( handler == detected )
+                 continue;
+
              if ( handler->CanRead(stream) && DoLoad(*handler, stream, index) )
                  return true;
         }
@@ -3063,6 +3955,56 @@ void wxImage::InsertHandler( wxImageHandler *handler )
     }
 }
 
+void wxImage::AddHandlerFactory( wxBitmapType imageType, HandlerFactory factory )
+{
+    wxCHECK_RET( factory, wxS("Invalid image handler factory") );
+
+    // As with AddHandler(), don't add duplicate handlers.
+    if ( FindHandler(imageType) )
+        return;
+
+#if wxUSE_THREADS
+    wxCriticalSectionLocker lock(gs_csPendingHandlers);
+#endif // wxUSE_THREADS
+
+    for ( const auto& pending : gs_pendingHandlers )
+    {
+        if ( pending.first == imageType )
+            return;
+    }
+
+    gs_pendingHandlers.emplace_back(imageType, factory);
+    gs_hasPendingHandlers = true;
+}
+
+/* static */
+void wxImage::CreatePendingHandlers(wxBitmapType imageType)
+{
+    if ( !gs_hasPendingHandlers )
+        return;
+
+#if wxUSE_THREADS
+    wxCriticalSectionLocker lock(gs_csPendingHandlers);
+#endif // wxUSE_THREADS
+
+    for ( auto it = gs_pendingHandlers.begin(); it != gs_pendingHandlers.end(); )
+    {
+        if ( imageType != wxBITMAP_TYPE_ANY && it->first != imageType )
+        {
+            ++it;
+            continue;
+        }
+
+        // Don't use AddHandler() here as it would call us recursively, but
+        // we know that there is no handler of this type yet anyhow.
+        sm_handlers.Append(it->second());
+
+        it = gs_pendingHandlers.erase(it);
+    }
+
+    gs_hasPendingHandlers = !gs_pendingHandlers.empty();
+}
+
 bool wxImage::RemoveHandler( const wxString& name )
 {
     wxImageHandler *handler = FindHandler(name);
@@ -3078,6 +4020,8 @@ bool wxImage::RemoveHandler( const wxString& name )
 
 wxImageHandler *wxImage::FindHandler( const wxString& name )
 {
+    CreatePendingHandlers();
+
     wxList::compatibility_iterator node = sm_handlers.GetFirst();
     while (node)
     {
@@ -3091,6 +4035,8 @@ wxImageHandler *wxImage::FindHandler( const wxString& name )
 
 wxImageHandler *wxImage::FindHandler( const wxString& extension, wxBitmapType bitmapType )
 {
+    CreatePendingHandlers(bitmapType);
+
     wxList::compatibility_iterator node = sm_handlers.GetFirst();
     while (node)
     {
@@ -3109,6 +4055,11 @@ wxImageHandler *wxImage::FindHandler( const wxString& extension, wxBitmapType bi
 
 wxImageHandler *wxImage::FindHandler(wxBitmapType bitmapType )
 {
+    if ( bitmapType == wxBITMAP_TYPE_INVALID )
+        return nullptr;
+
+    CreatePendingHandlers(bitmapType);
+
     wxList::compatibility_iterator node = sm_handlers.GetFirst();
     while (node)
     {
@@ -3121,6 +4072,8 @@ wxImageHandler *wxImage::FindHandler(wxBitmapType bitmapType )
 
 wxImageHandler *wxImage::FindHandlerMime( const wxString& mimetype )
 {
+    CreatePendingHandlers();
+
     wxList::compatibility_iterator node = sm_handlers.GetFirst();
     while (node)
     {
@@ -3140,6 +4093,15 @@ void wxImage::InitStandardHandlers()
 
 void wxImage::CleanUpHandlers()
 {
+    {
+#if wxUSE_THREADS
+        wxCriticalSectionLocker lock(gs_csPendingHandlers);
+#endif // wxUSE_THREADS
+
+        gs_pendingHandlers.clear();
+        gs_hasPendingHandlers = false;
+    }
+
     wxList::compatibility_iterator node = sm_handlers.GetFirst();
     while (node)
     {
@@ -3317,21 +4279,6 @@ static void DoRotateHue(unsigned char *rgb, double angle)
     rgb[2] = rgbValue.blue;
 }
 
-// Rotates the hue of each pixel in the image by angle, which is a double in the
-// range [-1.0..+1.0], where -1.0 corresponds to -360 degrees and +1.0 corresponds
-// to +360 degrees.
-void wxImage::RotateHue(double angle)
-{
-    if ( wxIsNullDouble(angle) )
-        return;
-
-    wxASSERT(angle >= -1.0 && angle <= 1.0);
-    ApplyToAllPixels([angle](unsigned char *rgb)
-    {
-        DoRotateHue(rgb, angle);
-    });
-}
-
 static void DoChangeSaturation(unsigned char *rgb, double factor)
 {
     wxImage::RGBValue rgbValue(rgb[0], rgb[1], rgb[2]);
@@ -3350,21 +4297,6 @@ static void DoChangeSaturation(unsigned char *rgb, double factor)
     rgb[2] = rgbValue.blue;
 }
 
-// Changes the saturation of each pixel in the image. factor is a double in the
-// range [-1.0..+1.0], where -1.0 corresponds to -100 percent and +1.0 corresponds
-// to +100 percent.
-void wxImage::ChangeSaturation(double factor)
-{
-    if ( wxIsNullDouble(factor) )
-        return;
-
-    wxASSERT(factor >= -1.0 && factor <= 1.0);
-    ApplyToAllPixels([factor](unsigned char *rgb)
-    {
-        DoChangeSaturation(rgb, factor);
-    });
-}
-
 static void DoChangeBrightness(unsigned char *rgb, double factor)
 {
     wxImage::RGBValue rgbValue(rgb[0], rgb[1], rgb[2]);
@@ -3383,19 +4315,328 @@ static void DoChangeBrightness(unsigned char *rgb, double factor)
     rgb[2] = rgbValue.blue;
 }
 
-// Changes the brightness (value) of each pixel in the image. factor is a double
-// in the range [-1.0..+1.0], where -1.0 corresponds to -100 percent and +1.0
-// corresponds to +100 percent.
-void wxImage::ChangeBrightness(double factor)
+//-----------------------------------------------------------------------------
+// wxImageColourTransform
+//-----------------------------------------------------------------------------
+
+wxImageColourTransform& wxImageColourTransform::AddOp(const Op& op)
+{
+    m_ops.push_back(op);
+
+    return *this;
+}
+
+wxImageColourTransform&
+wxImageColourTransform::ConvertToGreyscale(double weight_r,
+                                           double weight_g,
+                                           double weight_b)
+{
+    return AddOp(Op{Op_Greyscale, {weight_r, weight_g, weight_b}, {}});
+}
+
+wxImageColourTransform&
+wxImageColourTransform::ConvertToDisabled(unsigned char brightness)
+{
+    return AddOp(Op{Op_Disabled, {}, {brightness}});
+}
+
+wxImageColourTransform& wxImageColourTransform::ChangeLightness(int alpha)
+{
+    wxASSERT(alpha >= 0 && alpha <= 200);
+
+    return AddOp(Op{Op_Lightness, {static_cast<double>(alpha)}, {}});
+}
+
+wxImageColourTransform& wxImageColourTransform::RotateHue(double angle)
+{
+    if ( wxIsNullDouble(angle) )
+        return *this;
+
+    wxASSERT(angle >= -1.0 && angle <= 1.0);
+
+    return AddOp(Op{Op_Hue, {angle}, {}});
+}
+
+wxImageColourTransform& wxImageColourTransform::ChangeSaturation(double factor)
 {
     if ( wxIsNullDouble(factor) )
-        return;
+        return *this;
 
     wxASSERT(factor >= -1.0 && factor <= 1.0);
-    ApplyToAllPixels([factor](unsigned char *rgb)
+
+    return AddOp(Op{Op_Saturation, {factor}, {}});
+}
+
+wxImageColourTransform& wxImageColourTransform::ChangeBrightness(double factor)
+{
+    if ( wxIsNullDouble(factor) )
+        return *this;
+
+    wxASSERT(factor >= -1.0 && factor <= 1.0);
+
+    return AddOp(Op{Op_Brightness, {factor}, {}});
+}
+
+wxImageColourTransform&
+wxImageColourTransform::Replace(unsigned char r1, unsigned char g1, unsigned char b1,
+                                unsigned char r2, unsigned char g2, unsigned char b2)
+{
+    return AddOp(Op{Op_Replace, {}, {r1, g1, b1, r2, g2, b2}});
+}
+
+// This class prepares the operations of wxImageColourTransform for being
+// applied to many pixels: the consecutive operations changing all channels
+// in the same way independently of the other ones are combined into a single
+// lookup table and the products used for greyscale conversion are computed
+// only once, which gives exactly the same results as performing all these
+// operations for each pixel, but much faster.
+class wxImageColourTransformer
+{
+public:
+    explicit wxImageColourTransformer(const wxImageColourTransform& transform)
     {
-        DoChangeBrightness(rgb, factor);
-    });
+        for ( const auto& op : transform.m_ops )
+        {
+            switch ( op.type )
+            {
+                case wxImageColourTransform::Op_Greyscale:
+                    {
+                        Step step(Step_Greyscale);
+                        step.weighted.resize(3*256);
+                        for ( int n = 0; n < 256; n++ )
+                        {
+                            step.weighted[n] = n * op.values[0];
+                            step.weighted[256 + n] = n * op.values[1];
+                            step.weighted[512 + n] = n * op.values[2];
+                        }
+
+                        m_steps.push_back(step);
+                    }
+                    break;
+
+                case wxImageColourTransform::Op_Disabled:
+                case wxImageColourTransform::Op_Lightness:
+                    if ( m_steps.empty() || m_steps.back().type != Step_Table )
+                    {
+                        Step step(Step_Table);
+                        step.table.resize(256);
+                        for ( int n = 0; n < 256; n++ )
+                            step.table[n] = static_cast<unsigned char>(n);
+
+                        m_steps.push_back(step);
+                    }
+
+                    for ( auto& v : m_steps.back().table )
+                    {
+                        unsigned char r = v,
+                                      g = v,
+                                      b = v;
+                        if ( op.type == wxImageColourTransform::Op_Disabled )
+                            wxColour::MakeDisabled(&r, &g, &b, op.colours[0]);
+                        else
+                            wxColour::ChangeLightness(&r, &g, &b,
+                                                      wxRound(op.values[0]));
+                        v = r;
+                    }
+                    break;
+
+                case wxImageColourTransform::Op_Hue:
+                    m_steps.push_back(Step(Step_Hue, op.values[0]));
+                    break;
+
+                case wxImageColourTransform::Op_Saturation:
+                    m_steps.push_back(Step(Step_Saturation, op.values[0]));
+                    break;
+
+                case wxImageColourTransform::Op_Brightness:
+                    m_steps.push_back(Step(Step_Brightness, op.values[0]));
+                    break;
+
+                case wxImageColourTransform::Op_Replace:
+                    {
+                        Step step(Step_Replace);
+                        memcpy(step.colours, op.colours, sizeof(step.colours));
+
+                        m_steps.push_back(step);
+                    }
+                    break;
+            }
+        }
+    }
+
+    void Apply(unsigned char* rgb) const
+    {
+        for ( const auto& step : m_steps )
+        {
+            switch ( step.type )
+            {
+                case Step_Table:
+                    rgb[0] = step.table[rgb[0]];
+                    rgb[1] = step.table[rgb[1]];
+                    rgb[2] = step.table[rgb[2]];
+                    break;
+
+                case Step_Greyscale:
+                    {
+                        const double luma = step.weighted[rgb[0]] +
+                                                step.weighted[256 + rgb[1]] +
+                                                    step.weighted[512 + rgb[2]];
+                        rgb[0] =
+                        rgb[1] =
+                        rgb[2] = (wxByte)wxRound(luma);
+                    }
+                    break;
+
+                case Step_Hue:
+                    DoRotateHue(rgb, step.value);
+                    break;
+
+                case Step_Saturation:
+                    DoChangeSaturation(rgb, step.value);
+                    break;
+
+                case Step_Brightness:
+                    DoChangeBrightness(rgb, step.value);
+                    break;
+
+                case Step_Replace:
+                    if ( rgb[0] == step.colours[0] &&
+                            rgb[1] == step.colours[1] &&
+                                rgb[2] == step.colours[2] )
+                    {
+                        rgb[0] = step.colours[3];
+                        rgb[1] = step.colours[4];
+                        rgb[2] = step.colours[5];
+                    }
+                    break;
+            }
+        }
+    }
+
+private:
+    enum StepType
+    {
+        Step_Table,
+        Step_Greyscale,
+        Step_Hue,
+        Step_Saturation,
+        Step_Brightness,
+        Step_Replace
+    };
+
+    struct Step
+    {
+        explicit Step(StepType type_, double value_ = 0.0)
+            : type(type_), value(value_)
+        {
+        }
+
+        StepType type;
+
+        // The angle or factor for the HSV steps.
+        double value;
+
+        // The old and new colours for Step_Replace.
+        unsigned char colours[6] = { 0 };
+
+        // The new value of every channel value for Step_Table.
+        std::vector<unsigned char> table;
+
+        // The products of all channel values by the corresponding weights for
+        // Step_Greyscale.
+        std::vector<double> weighted;
+    };
+
+    std::vector<Step> m_steps;
+
+    wxDECLARE_NO_COPY_CLASS(wxImageColourTransformer);
+};
+
+void wxImage::DoApplyColourTransform(const wxImageColourTransform& transform,
+                                     bool skipMask)
+{
+    wxCHECK_RET( IsOk(), wxT("invalid image") );
+
+    if ( transform.IsEmpty() )
+        return;
+
+    AllocExclusive();
+
+    const wxImageColourTransformer transformer(transform);
+
+    const int width = M_IMGDATA->m_width;
+    unsigned char* const data = M_IMGDATA->m_data;
+
+    skipMask = skipMask && M_IMGDATA->m_hasMask;
+    const unsigned char maskRed = M_IMGDATA->m_maskRed,
+                        maskGreen = M_IMGDATA->m_maskGreen,
+                        maskBlue = M_IMGDATA->m_maskBlue;
+
+    wxParallelFor
+    (
+        M_IMGDATA->m_height,
+        GetThreadCountForPixels(static_cast<long long>(width)
+                                    * M_IMGDATA->m_height),
+        [&](int yStart, int yEnd)
+        {
+            // Images, and icons in particular, typically contain many pixels
+            // of the same colour following each other, so remember the last
+            // transformed colour to avoid transforming it again.
+            unsigned char lastIn[3] = { 0 },
+                          lastOut[3] = { 0 };
+            bool hasLast = false;
+
+            unsigned char* p = data + 3*static_cast<size_t>(width)*yStart;
+            unsigned char* const end = data + 3*static_cast<size_t>(width)*yEnd;
+            for ( ; p != end; p += 3 )
+            {
+                if ( skipMask && p[0] == maskRed &&
+                        p[1] == maskGreen && p[2] == maskBlue )
+                    continue;
+
+                if ( hasLast && p[0] == lastIn[0] &&
+                        p[1] == lastIn[1] && p[2] == lastIn[2] )
+                {
+                    p[0] = lastOut[0];
+                    p[1] = lastOut[1];
+                    p[2] = lastOut[2];
+                    continue;
+                }
+
+                memcpy(lastIn, p, 3);
+                transformer.Apply(p);
+                memcpy(lastOut, p, 3);
+                hasLast = true;
+            }
+        }
+    );
+}
+
+// Rotates the hue of each pixel in the image by angle, which is a double in the
+// range [-1.0..+1.0], where -1.0 corresponds to -360 degrees and +1.0 corresponds
+// to +360 degrees.
+void wxImage::RotateHue(double angle)
+{
+    DoApplyColourTransform(wxImageColourTransform().RotateHue(angle),
+                           false /* don't skip mask */);
+}
+
+// Changes the saturation of each pixel in the image. factor is a double in the
+// range [-1.0..+1.0], where -1.0 corresponds to -100 percent and +1.0 corresponds
+// to +100 percent.
+void wxImage::ChangeSaturation(double factor)
+{
+    DoApplyColourTransform(wxImageColourTransform().ChangeSaturation(factor),
+                           false /* don't skip mask */);
+}
+
+// Changes the brightness (value) of each pixel in the image. factor is a double
+// in the range [-1.0..+1.0], where -1.0 corresponds to -100 percent and +1.0
+// corresponds to +100 percent.
+void wxImage::ChangeBrightness(double factor)
+{
+    DoApplyColourTransform(wxImageColourTransform().ChangeBrightness(factor),
+                           false /* don't skip mask */);
 }
 
 // Changes the hue, the saturation and the brightness (value) of each pixel in
@@ -3406,22 +4647,10 @@ void wxImage::ChangeBrightness(double factor)
 // where -1.0 corresponds to -100 percent and +1.0 corresponds to +100 percent.
 void wxImage::ChangeHSV(double angleH, double factorS, double factorV)
 {
-    if ( wxIsNullDouble(angleH) && wxIsNullDouble(factorS) && wxIsNullDouble(factorV) )
-        return;
-
-    wxASSERT(angleH >= -1.0 && angleH <= 1.0 && factorS >= -1.0 &&
-             factorS <= 1.0 && factorV >= -1.0 && factorV <= 1.0);
-    ApplyToAllPixels([angleH, factorS, factorV](unsigned char *rgb)
-    {
-        if ( !wxIsNullDouble(angleH) )
-            DoRotateHue(rgb, angleH);
-
-        if ( !wxIsNullDouble(factorS) )
-            DoChangeSaturation(rgb, factorS);
-
-        if ( !wxIsNullDouble(factorV) )
-            DoChangeBrightness(rgb, factorV);
-    });
+    DoApplyColourTransform(wxImageColourTransform().RotateHue(angleH)
+                                                   .ChangeSaturation(factorS)
+                                                   .ChangeBrightness(factorV),
+                           false /* don't skip mask */);
 }
 
 //-----------------------------------------------------------------------------
@@ -3437,6 +4666,25 @@ int wxImageHandler::GetImageCount( wxInputStream& stream )
             CallIfCanSeek(&wxImageHandler::DoGetImageCount, this);
 }
 
+bool
+wxImageHandler::LoadFileIncrementally(wxImage *image,
+                                      wxInputStream& stream,
+                                      const wxImageLoadProgressFunction& progress,
+                                      bool verbose,
+                                      int index)
+{
+    if ( !LoadFile(image, stream, verbose, index) )
+        return false;
+
+    if ( progress && !progress(*image, 0, image->GetHeight()) )
+    {
+        image->Destroy();
+        return false;
+    }
+
+    return true;
+}
+
 bool wxImageHandler::CanRead( const wxString& name )
 {
     wxImageFileInputStream stream(name);
@@ -38,6 +38,7 @@
 
 #include "wx/filefn.h"
 #include "wx/wfstream.h"
+#include "wx/private/imageload.h"
 
 // For memcpy
 #include <string.h>
@@ -229,7 +230,18 @@ static inline void wx_cmyk_to_rgb(unsigned char* rgb, const unsigned char* cmyk)
     #pragma warning(disable:4611)
 #endif /* VC++ */
 
-bool wxJPEGHandler::LoadFile( wxImage *image, wxInputStream& stream, bool verbose, int WXUNUSED(index) )
+bool wxJPEGHandler::LoadFile( wxImage *image, wxInputStream& stream, bool verbose, int index )
+{
+    return LoadFileIncrementally(image, stream, wxImageLoadProgressFunction(),
+                                 verbose, index);
+}
+
+bool
+wxJPEGHandler::LoadFileIncrementally(wxImage *image,
+                                     wxInputStream& stream,
+                                     const wxImageLoadProgressFunction& progress,
+                                     bool verbose,
+                                     int WXUNUSED(index))
 {
     wxCHECK_MSG( image, false, "null image pointer" );
 
@@ -279,12 +291,19 @@ bool wxJPEGHandler::LoadFile( wxImage *image, wxInputStream& stream, bool verbos
         bytesPerPixel = 3;
     }
 
-    // scale the picture to fit in the specified max size if necessary
+    // scale the picture to fit in the specified max size if necessary: this
+    // is done by libjpeg during the IDCT and so is much faster than decoding
+    // the image at full size and rescaling it later
     if ( maxWidth > 0 || maxHeight > 0 )
     {
+        // libjpeg rounds the scaled size up, so do it here too to ensure that
+        // the image size fits and doesn't need to be rescaled again later by
+        // wxImage itself; also note that libjpeg doesn't support scaling by
+        // more than 1/8, but in this case the rest will be done by wxImage.
         unsigned& scale = cinfo.scale_denom;
-        while ( (maxWidth && (cinfo.image_width / scale > maxWidth)) ||
-                    (maxHeight && (cinfo.image_height / scale > maxHeight)) )
+        while ( scale < 8 &&
+                    ((maxWidth && (cinfo.image_width + scale - 1) / scale > maxWidth) ||
+                     (maxHeight && (cinfo.image_height + scale - 1) / scale > maxHeight)) )
         {
             scale *= 2;
         }
@@ -301,20 +320,45 @@ bool wxJPEGHandler::LoadFile( wxImage *image, wxInputStream& stream, bool verbos
     image->SetMask( false );
     ptr = image->GetData();
 
-    unsigned stride = cinfo.output_width * bytesPerPixel;
-    JSAMPARRAY tempbuf = (*cinfo.mem->alloc_sarray)
-                            ((j_common_ptr) &cinfo, JPOOL_IMAGE, stride, 1 );
+    wxImageLoadProgressReporter reporter(progress, *image);
 
-    while ( cinfo.output_scanline < cinfo.output_height )
+    if (cinfo.out_color_space == JCS_RGB)
     {
-        jpeg_read_scanlines( &cinfo, tempbuf, 1 );
-        if (cinfo.out_color_space == JCS_RGB)
+        // decode directly into the image data, as many rows at once as
+        // libjpeg can produce, avoiding the extra copy
+        const unsigned stride = cinfo.output_width * 3;
+        const int maxRows = wxMax(cinfo.rec_outbuf_height, 1);
+
+        // note that this memory is freed by jpeg_finish_decompress() or
+        // jpeg_destroy_decompress() in case of error
+        JSAMPARRAY rows = (JSAMPARRAY)(*cinfo.mem->alloc_small)
+                            ((j_common_ptr) &cinfo, JPOOL_IMAGE,
+                             maxRows * sizeof(JSAMPROW));
+
+        while ( cinfo.output_scanline < cinfo.output_height )
         {
-            memcpy( ptr, tempbuf[0], stride );
-            ptr += stride;
+            const unsigned
+                numRows = wxMin(unsigned(maxRows),
+                                cinfo.output_height - cinfo.output_scanline);
+            for ( unsigned n = 0; n < numRows; n++ )
+                rows[n] = ptr + (cinfo.output_scanline + n)*stride;
+
+            jpeg_read_scanlines( &cinfo, rows, numRows );
+
+            if ( !reporter.RowsDone(cinfo.output_scanline) )
+                break;
         }
-        else // CMYK
+    }
+    else // CMYK
+    {
+        unsigned stride = cinfo.output_width * bytesPerPixel;
+        JSAMPARRAY tempbuf = (*cinfo.mem->alloc_sarray)
+                                ((j_common_ptr) &cinfo, JPOOL_IMAGE, stride, 1 );
+
+        while ( cinfo.output_scanline < cinfo.output_height )
         {
+            jpeg_read_scanlines( &cinfo, tempbuf, 1 );
+
             const unsigned char* inptr = (const unsigned char*) tempbuf[0];
             for (size_t i = 0; i < cinfo.output_width; i++)
             {
@@ -322,9 +366,20 @@ bool wxJPEGHandler::LoadFile( wxImage *image, wxInputStream& stream, bool verbos
                 ptr += 3;
                 inptr += 4;
             }
+
+            if ( !reporter.RowsDone(cinfo.output_scanline) )
+                break;
         }
     }
 
+    if ( reporter.IsCancelled() )
+    {
+        (cinfo.src->term_source)(&cinfo);
+        jpeg_destroy_decompress( &cinfo );
+        image->Destroy();
+        return false;
+    }
+
     // set up resolution if available: it's part of optional JFIF APP0 chunk
     if ( cinfo.saw_JFIF_marker )
     {
@@ -28,8 +28,11 @@
     #include "wx/intl.h"
     #include "wx/palette.h"
     #include "wx/stream.h"
+    #include "wx/utils.h"
 #endif
 
+#include "wx/private/imageload.h"
+
 #include "png.h"
 
 // For memcpy
@@ -110,6 +113,7 @@ struct wxPNGImageData
         info_ptr = (png_infop) nullptr;
         png_ptr = (png_structp) nullptr;
         ok = false;
+        cancelled = false;
     }
 
     bool Alloc(png_uint_32 width, png_uint_32 height, unsigned char* buf)
@@ -153,13 +157,17 @@ struct wxPNGImageData
         }
     }
 
-    void DoLoadPNGFile(wxImage* image, wxPNGInfoStruct& wxinfo);
+    void DoLoadPNGFile(wxImage* image, wxPNGInfoStruct& wxinfo,
+                       const wxImageLoadProgressFunction& progress);
 
     unsigned char** lines;
     unsigned char* m_buf;
     png_infop info_ptr;
     png_structp png_ptr;
     bool ok;
+
+    // set if loading was cancelled by the progress function
+    bool cancelled;
 };
 
 } // anonymous namespace
@@ -243,17 +251,22 @@ bool wxPNGHandler::DoCanRead( wxInputStream& stream )
     return memcmp(hdr, "\211PNG", WXSIZEOF(hdr)) == 0;
 }
 
-// convert data from RGB to wxImage format
+// convert data from RGBA to wxImage format, lines contain the given number of
+// rows of the image starting from y0
 static
 void CopyDataFromPNG(wxImage *image,
                      unsigned char **lines,
                      png_uint_32 width,
+                     png_uint_32 y0,
                      png_uint_32 height)
 {
+    const size_t offset = (size_t)y0 * width;
+
     // allocated on demand if we have any non-opaque pixels
-    unsigned char *alpha = nullptr;
+    unsigned char *alpha = image->HasAlpha() ? image->GetAlpha() + offset
+                                             : nullptr;
 
-    unsigned char *ptrDst = image->GetData();
+    unsigned char *ptrDst = image->GetData() + 3 * offset;
     {
         for ( png_uint_32 y = 0; y < height; y++ )
         {
@@ -268,7 +281,7 @@ void CopyDataFromPNG(wxImage *image,
                 // the first time we encounter a transparent pixel we must
                 // allocate alpha channel for the image
                 if ( !IsOpaque(a) && !alpha )
-                    alpha = InitAlpha(image, x, y);
+                    alpha = InitAlpha(image, x, y0 + y);
 
                 if ( alpha )
                     *alpha++ = a;
@@ -293,7 +306,8 @@ void CopyDataFromPNG(wxImage *image,
 // "returns" its result via wxPNGImageData: use its "ok" field to check
 // whether loading succeeded or failed.
 void
-wxPNGImageData::DoLoadPNGFile(wxImage* image, wxPNGInfoStruct& wxinfo)
+wxPNGImageData::DoLoadPNGFile(wxImage* image, wxPNGInfoStruct& wxinfo,
+                              const wxImageLoadProgressFunction& progress)
 {
     png_uint_32 width, height = 0;
     int bit_depth, color_type;
@@ -329,6 +343,9 @@ wxPNGImageData::DoLoadPNGFile(wxImage* image, wxPNGInfoStruct& wxinfo)
     png_set_strip_16( png_ptr );
     png_set_packing( png_ptr );
 
+    const int passes = png_set_interlace_handling( png_ptr );
+    png_read_update_info( png_ptr, info_ptr );
+
     image->Create((int)width, (int)height, (bool) false /* no need to init pixels */);
 
     if (!image->IsOk())
@@ -338,10 +355,61 @@ wxPNGImageData::DoLoadPNGFile(wxImage* image, wxPNGInfoStruct& wxinfo)
         (color_type & PNG_COLOR_MASK_ALPHA) ||
         png_get_valid(png_ptr, info_ptr, PNG_INFO_tRNS);
 
-    if (!Alloc(width, height, needCopy ? nullptr : image->GetData()))
-        return;
+    wxImageLoadProgressReporter reporter(progress, *image);
+
+    if ( passes > 1 )
+    {
+        // interlaced images are only complete after the last pass, so there
+        // is no choice but to decode them entirely
+        if (!Alloc(width, height, needCopy ? nullptr : image->GetData()))
+            return;
+
+        png_read_image( png_ptr, lines );
+
+        if (needCopy)
+            CopyDataFromPNG(image, lines, width, 0, height);
+    }
+    else if ( needCopy )
+    {
+        // decode the image by bands of rows into an intermediate RGBA buffer
+        // which doesn't need to be as big as the entire image
+        const png_uint_32 bandHeight = wxMin(height, 16);
+        if (!Alloc(width, bandHeight, nullptr))
+            return;
+
+        for ( png_uint_32 y = 0; y < height; y += bandHeight )
+        {
+            const png_uint_32 rows = wxMin(bandHeight, height - y);
+            png_read_rows( png_ptr, lines, nullptr, rows );
+
+            CopyDataFromPNG(image, lines, width, y, rows);
+
+            if ( !reporter.RowsDone(y + rows) )
+            {
+                cancelled = true;
+                return;
+            }
+        }
+    }
+    else // decode directly into the image
+    {
+        if (!Alloc(width, height, image->GetData()))
+            return;
+
+        const png_uint_32 bandHeight = 16;
+        for ( png_uint_32 y = 0; y < height; y += bandHeight )
+        {
+            const png_uint_32 rows = wxMin(bandHeight, height - y);
+            png_read_rows( png_ptr, lines + y, nullptr, rows );
+
+            if ( !reporter.RowsDone(y + rows) )
+            {
+                cancelled = true;
+                return;
+            }
+        }
+    }
 
-    png_read_image( png_ptr, lines );
     png_read_end( png_ptr, info_ptr );
 
 #if wxUSE_PALETTE
@@ -411,9 +479,12 @@ wxPNGImageData::DoLoadPNGFile(wxImage* image, wxPNGInfoStruct& wxinfo)
     }
 
 
-    // loaded successfully, now init wxImage with this data
-    if (needCopy)
-        CopyDataFromPNG(image, lines, width, height);
+    // report the rows of the interlaced images, if not done yet
+    if ( !reporter.AllDone() )
+    {
+        cancelled = true;
+        return;
+    }
 
     // This will indicate to the caller that loading succeeded.
     ok = true;
@@ -423,18 +494,29 @@ bool
 wxPNGHandler::LoadFile(wxImage *image,
                        wxInputStream& stream,
                        bool verbose,
-                       int WXUNUSED(index))
+                       int index)
+{
+    return LoadFileIncrementally(image, stream, wxImageLoadProgressFunction(),
+                                 verbose, index);
+}
+
+bool
+wxPNGHandler::LoadFileIncrementally(wxImage *image,
+                                    wxInputStream& stream,
+                                    const wxImageLoadProgressFunction& progress,
+                                    bool verbose,
+                                    int WXUNUSED(index))
 {
     wxPNGInfoStruct wxinfo;
     wxinfo.verbose = verbose;
     wxinfo.stream.in = &stream;
 
     wxPNGImageData data;
-    data.DoLoadPNGFile(image, wxinfo);
+    data.DoLoadPNGFile(image, wxinfo, progress);
 
     if ( !data.ok )
     {
-        if (verbose)
+        if (verbose && !data.cancelled)
         {
            wxLogError(_("Couldn't load a PNG image - file is corrupted or not enough memory."));
         }
@@ -660,11 +742,21 @@ bool wxPNGHandler::SaveFile( wxImage *image, wxOutputStream& stream, bool verbos
                                   : PNG_COLOR_TYPE_GRAY;
     }
 
+    // When saving speed matters more than the file size, use the fastest
+    // compression level and only the cheapest filters, which still work well
+    // for the typical screen contents. Note that the filters are not used for
+    // the palette images by default anyhow.
+    const bool fast = image->GetOptionInt(wxIMAGE_OPTION_PNG_FAST) != 0;
+
     if (image->HasOption(wxIMAGE_OPTION_PNG_FILTER))
         png_set_filter( png_ptr, PNG_FILTER_TYPE_BASE, image->GetOptionInt(wxIMAGE_OPTION_PNG_FILTER) );
+    else if (fast && !bUsePalette)
+        png_set_filter( png_ptr, PNG_FILTER_TYPE_BASE, PNG_FILTER_NONE | PNG_FILTER_SUB );
 
     if (image->HasOption(wxIMAGE_OPTION_PNG_COMPRESSION_LEVEL))
         png_set_compression_level( png_ptr, image->GetOptionInt(wxIMAGE_OPTION_PNG_COMPRESSION_LEVEL) );
+    else if (fast)
+        png_set_compression_level( png_ptr, 1 /* Z_BEST_SPEED */ );
 
     if (image->HasOption(wxIMAGE_OPTION_PNG_COMPRESSION_MEM_LEVEL))
         png_set_compression_mem_level( png_ptr, image->GetOptionInt(wxIMAGE_OPTION_PNG_COMPRESSION_MEM_LEVEL) );
@@ -738,7 +830,10 @@ bool wxPNGHandler::SaveFile( wxImage *image, wxOutputStream& stream, bool verbos
 
     png_set_sBIT( png_ptr, info_ptr, &sig_bit );
     png_write_info( png_ptr, info_ptr );
-    png_set_shift( png_ptr, &sig_bit );
+
+    // Note that we don't need to call png_set_shift() as the significant bits
+    // are always the same as the bit depth: doing it would be useless, but
+    // still costly, as libpng would process all the bytes of each row anyhow.
     png_set_packing( png_ptr );
 
     unsigned char *
@@ -754,9 +849,40 @@ bool wxPNGHandler::SaveFile( wxImage *image, wxOutputStream& stream, bool verbos
 
     const unsigned char *pColors = image->GetData();
 
+    // The most common case of 8 bit RGB images, with or without alpha, is
+    // handled separately as it can be done much faster than in general.
+    const bool isRGB8 = iColorType == wxPNG_TYPE_COLOUR && iBitDepth == 8;
+
     for (int y = 0; y != iHeight; ++y)
     {
+        if ( isRGB8 && !bUseAlpha )
+        {
+            // the row data can be used directly, libpng copies it anyhow
+            png_write_row( png_ptr, const_cast<png_bytep>(pColors) );
+            pColors += 3*iWidth;
+            continue;
+        }
+
         unsigned char *pData = data;
+
+        if ( isRGB8 && pAlpha && !bHasMask )
+        {
+            for (int x = 0; x != iWidth; x++)
+            {
+                pData[0] = pColors[0];
+                pData[1] = pColors[1];
+                pData[2] = pColors[2];
+                pData[3] = *pAlpha++;
+
+                pData += 4;
+                pColors += 3;
+            }
+
+            png_bytep row_ptr = data;
+            png_write_rows( png_ptr, &row_ptr, 1 );
+            continue;
+        }
+
         for (int x = 0; x != iWidth; x++)
         {
             png_color_8 clr;
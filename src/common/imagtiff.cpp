@@ -39,6 +39,7 @@ extern "C"
 }
 #include "wx/filefn.h"
 #include "wx/wfstream.h"
+#include "wx/private/imageload.h"
 
 #ifndef TIFFLINKAGEMODE
     #define TIFFLINKAGEMODE LINKAGEMODE
@@ -288,37 +289,46 @@ TIFFwxOpen(wxOutputStream &stream, const char* name, const char* mode)
     return tif;
 }
 
-bool wxTIFFHandler::LoadFile( wxImage *image, wxInputStream& stream, bool verbose, int index )
+// Copy the given number of rows of ABGR data from the raster to the image,
+// starting at the row y0.
+static void
+CopyDataFromRaster(wxImage *image, const wxUint32 *raster,
+                   wxUint32 y0, wxUint32 rows, bool hasAlpha)
 {
-    if (index == -1)
-        index = 0;
+    const size_t w = image->GetWidth();
+    const size_t offset = y0 * w;
 
-    image->Destroy();
-
-    TIFF *tif = TIFFwxOpen( stream, "image", "r" );
+    unsigned char *ptr = image->GetData() + 3 * offset;
 
-    if (!tif)
-    {
-        if (verbose)
-        {
-            wxLogError( _("TIFF: Error loading image.") );
-        }
+    unsigned char *alpha = hasAlpha ? image->GetAlpha() + offset : nullptr;
 
-        return false;
-    }
+    wxUint32 pos = 0;
 
-    if (!TIFFSetDirectory( tif, (tdir_t)index ))
+    for (wxUint32 i = 0; i < rows; i++)
     {
-        if (verbose)
+        for (wxUint32 j = 0; j < w; j++)
         {
-            wxLogError( _("Invalid TIFF image index.") );
-        }
-
-        TIFFClose( tif );
+            *(ptr++) = (unsigned char)TIFFGetR(raster[pos]);
+            *(ptr++) = (unsigned char)TIFFGetG(raster[pos]);
+            *(ptr++) = (unsigned char)TIFFGetB(raster[pos]);
+            if ( hasAlpha )
+                *(alpha++) = (unsigned char)TIFFGetA(raster[pos]);
 
-        return false;
+            pos++;
+        }
     }
+}
 
+// Load the image from the current directory of the given TIFF, which is not
+// closed by this function. If the rectangle is specified, only this region of
+// the image is loaded, and the progress function is not used in this case.
+static bool
+LoadTIFFDirectory(TIFF *tif,
+                  wxImage *image,
+                  const wxImageLoadProgressFunction& progress,
+                  bool verbose,
+                  const wxRect* rect = nullptr)
+{
     wxUint32 w, h;
     wxUint32 *raster;
 
@@ -348,9 +358,61 @@ bool wxTIFFHandler::LoadFile( wxImage *image, wxInputStream& stream, bool verbos
         || (extraSamples == 0 && samplesPerPixel == 4
             && photometric == PHOTOMETRIC_RGB);
 
+    wxUint16 planarConfig = PLANARCONFIG_CONTIG;
+    (void) TIFFGetField(tif, TIFFTAG_PLANARCONFIG, &planarConfig);
+
+    char msg[1024] = "";
+    const bool readScanlines =
+        (planarConfig == PLANARCONFIG_CONTIG && samplesPerPixel == 2
+            && extraSamples == 1)
+        &&
+        (
+            ( !TIFFRGBAImageOK(tif, msg) )
+            || (bitsPerSample == 8)
+        );
+
+    wxUint16 orientation = ORIENTATION_TOPLEFT;
+    (void) TIFFGetFieldDefaulted(tif, TIFFTAG_ORIENTATION, &orientation);
+
+    // When loading only a part of the image, decode just the strips or tiles
+    // intersecting it if possible, i.e. if the image uses the standard
+    // orientation, otherwise load the entire image and extract the region.
+    wxUint32 x0 = 0,
+             y0 = 0,
+             outW = w,
+             outH = h;
+    bool extractRegion = false;
+    if ( rect )
+    {
+        if ( rect->x < 0 || rect->y < 0 ||
+                rect->width <= 0 || rect->height <= 0 ||
+                    (wxUint32)rect->x + rect->width > w ||
+                        (wxUint32)rect->y + rect->height > h )
+        {
+            if ( verbose )
+            {
+                wxLogError( _("TIFF: Invalid image region.") );
+            }
+
+            return false;
+        }
+
+        if ( readScanlines || orientation != ORIENTATION_TOPLEFT )
+        {
+            extractRegion = true;
+        }
+        else
+        {
+            x0 = rect->x;
+            y0 = rect->y;
+            outW = rect->width;
+            outH = rect->height;
+        }
+    }
+
     // guard against integer overflow during multiplication which could result
     // in allocating a too small buffer and then overflowing it
-    const double bytesNeeded = (double)w * (double)h * sizeof(wxUint32);
+    const double bytesNeeded = (double)outW * (double)outH * sizeof(wxUint32);
     if ( bytesNeeded >= wxUINT32_MAX )
     {
         if ( verbose )
@@ -358,12 +420,37 @@ bool wxTIFFHandler::LoadFile( wxImage *image, wxInputStream& stream, bool verbos
             wxLogError( _("TIFF: Image size is abnormally big.") );
         }
 
-        TIFFClose(tif);
-
         return false;
     }
 
-    raster = (wxUint32*) _TIFFmalloc( (wxUint32)bytesNeeded );
+    // When using the progress function, decode the image by bands of rows
+    // corresponding to whole strips or tiles, to avoid decoding them more
+    // than once, into a raster big enough for one band only. This is only
+    // done for the images using the standard orientation as the rows of the
+    // images with the other ones are not stored in the order we need.
+    wxUint32 bandHeight = outH;
+    if ( progress && !readScanlines )
+    {
+        wxUint32 unit = 0;
+        if ( TIFFIsTiled(tif) )
+            (void) TIFFGetField(tif, TIFFTAG_TILELENGTH, &unit);
+        else
+            (void) TIFFGetFieldDefaulted(tif, TIFFTAG_ROWSPERSTRIP, &unit);
+
+        if ( orientation == ORIENTATION_TOPLEFT && unit > 0 )
+        {
+            bandHeight = unit;
+            while ( bandHeight < 16 )
+                bandHeight += unit;
+
+            if ( bandHeight > outH )
+                bandHeight = outH;
+        }
+    }
+
+    const bool decodeByBands = bandHeight < outH || outW < w || outH < h;
+
+    raster = (wxUint32*) _TIFFmalloc( outW * bandHeight * sizeof(wxUint32) );
 
     if (!raster)
     {
@@ -372,12 +459,10 @@ bool wxTIFFHandler::LoadFile( wxImage *image, wxInputStream& stream, bool verbos
             wxLogError( _("TIFF: Couldn't allocate memory.") );
         }
 
-        TIFFClose( tif );
-
         return false;
     }
 
-    image->Create( (int)w, (int)h );
+    image->Create( (int)outW, (int)outH );
     if (!image->IsOk())
     {
         if (verbose)
@@ -386,7 +471,6 @@ bool wxTIFFHandler::LoadFile( wxImage *image, wxInputStream& stream, bool verbos
         }
 
         _TIFFfree( raster );
-        TIFFClose( tif );
 
         return false;
     }
@@ -394,21 +478,10 @@ bool wxTIFFHandler::LoadFile( wxImage *image, wxInputStream& stream, bool verbos
     if ( hasAlpha )
         image->SetAlpha();
 
-    wxUint16 planarConfig = PLANARCONFIG_CONTIG;
-    (void) TIFFGetField(tif, TIFFTAG_PLANARCONFIG, &planarConfig);
+    wxImageLoadProgressReporter reporter(progress, *image, 1);
 
     bool ok = true;
-    char msg[1024] = "";
-    if
-    (
-        (planarConfig == PLANARCONFIG_CONTIG && samplesPerPixel == 2
-            && extraSamples == 1)
-        &&
-        (
-            ( !TIFFRGBAImageOK(tif, msg) )
-            || (bitsPerSample == 8)
-        )
-    )
+    if ( readScanlines )
     {
         const bool isGreyScale = (bitsPerSample == 8);
         unsigned char *buf = (unsigned char *)_TIFFmalloc(TIFFScanlineSize(tif));
@@ -457,47 +530,63 @@ bool wxTIFFHandler::LoadFile( wxImage *image, wxInputStream& stream, bool verbos
 
         _TIFFfree(buf);
     }
+    else if ( decodeByBands )
+    {
+        TIFFRGBAImage img;
+        ok = TIFFRGBAImageBegin(&img, tif, 0, msg) != 0;
+        if ( ok )
+        {
+            img.req_orientation = ORIENTATION_TOPLEFT;
+
+            for ( wxUint32 y = 0; y < outH; y += bandHeight )
+            {
+                const wxUint32 rows = wxMin(bandHeight, outH - y);
+
+                img.row_offset = y0 + y;
+                img.col_offset = x0;
+                if ( !TIFFRGBAImageGet(&img, raster, outW, rows) )
+                {
+                    ok = false;
+                    break;
+                }
+
+                CopyDataFromRaster(image, raster, y, rows, hasAlpha);
+
+                if ( !reporter.RowsDone(y + rows) )
+                    break;
+            }
+
+            TIFFRGBAImageEnd(&img);
+        }
+    }
     else
     {
         ok = TIFFReadRGBAImageOriented( tif, w, h, raster,
             ORIENTATION_TOPLEFT, 0 ) != 0;
     }
 
+    if ( ok && !decodeByBands )
+    {
+        CopyDataFromRaster(image, raster, 0, h, hasAlpha);
+
+        reporter.AllDone();
+    }
 
-    if (!ok)
+    if ( !ok || reporter.IsCancelled() )
     {
-        if (verbose)
+        if ( verbose && !ok )
         {
             wxLogError( _("TIFF: Error reading image.") );
         }
 
         _TIFFfree( raster );
         image->Destroy();
-        TIFFClose( tif );
 
         return false;
     }
 
-    unsigned char *ptr = image->GetData();
-
-    unsigned char *alpha = image->GetAlpha();
-
-    wxUint32 pos = 0;
-
-    for (wxUint32 i = 0; i < h; i++)
-    {
-        for (wxUint32 j = 0; j < w; j++)
-        {
-            *(ptr++) = (unsigned char)TIFFGetR(raster[pos]);
-            *(ptr++) = (unsigned char)TIFFGetG(raster[pos]);
-            *(ptr++) = (unsigned char)TIFFGetB(raster[pos]);
-            if ( hasAlpha )
-                *(alpha++) = (unsigned char)TIFFGetA(raster[pos]);
-
-            pos++;
-        }
-    }
-
+    if ( extractRegion )
+        *image = image->GetSubImage(*rect);
 
     image->SetOption(wxIMAGE_OPTION_TIFF_PHOTOMETRIC, photometric);
 
@@ -575,9 +664,57 @@ bool wxTIFFHandler::LoadFile( wxImage *image, wxInputStream& stream, bool verbos
 
     _TIFFfree( raster );
 
+    return true;
+}
+
+bool wxTIFFHandler::LoadFile( wxImage *image, wxInputStream& stream, bool verbose, int index )
+{
+    return LoadFileIncrementally(image, stream, wxImageLoadProgressFunction(),
+                                 verbose, index);
+}
+
+bool
+wxTIFFHandler::LoadFileIncrementally(wxImage *image,
+                                     wxInputStream& stream,
+                                     const wxImageLoadProgressFunction& progress,
+                                     bool verbose,
+                                     int index)
+{
+    if (index == -1)
+        index = 0;
+
+    image->Destroy();
+
+    TIFF *tif = TIFFwxOpen( stream, "image", "r" );
+
+    if (!tif)
+    {
+        if (verbose)
+        {
+            wxLogError( _("TIFF: Error loading image.") );
+        }
+
+        return false;
+    }
+
+    if (!TIFFSetDirectory( tif, (tdir_t)index ))
+    {
+        if (verbose)
+        {
+            wxLogError( _("Invalid TIFF image index.") );
+        }
+
+        TIFFClose( tif );
+
+        return false;
+    }
+
+
+    const bool ok = LoadTIFFDirectory(tif, image, progress, verbose);
+
     TIFFClose( tif );
 
-    return true;
+    return ok;
 }
 
 int wxTIFFHandler::DoGetImageCount( wxInputStream& stream )
@@ -898,6 +1035,97 @@ bool wxTIFFHandler::DoCanRead( wxInputStream& stream )
            (hdr[0] == 'M' && hdr[1] == 'M');
 }
 
+//-----------------------------------------------------------------------------
+// wxTIFFReader
+//-----------------------------------------------------------------------------
+
+wxTIFFReader::wxTIFFReader(wxInputStream& stream)
+{
+    m_current = -1;
+
+    m_tif = TIFFwxOpen( stream, "image", "r" );
+    if ( !m_tif )
+        return;
+
+    // Remember the offsets of all directories to be able to switch to any of
+    // them directly instead of walking the chain of directories from the
+    // beginning of the file, as TIFFSetDirectory() does.
+    do
+    {
+        m_offsets.push_back(TIFFCurrentDirOffset(m_tif));
+    } while ( TIFFReadDirectory(m_tif) );
+
+    // Note that m_current remains -1 as the state of the TIFF object after
+    // TIFFReadDirectory() fails is not well-defined, so the page will be
+    // selected again when it's used.
+}
+
+wxTIFFReader::~wxTIFFReader()
+{
+    if ( m_tif )
+        TIFFClose( m_tif );
+}
+
+bool wxTIFFReader::SelectPage(int page)
+{
+    wxCHECK_MSG( m_tif, false, wxS("invalid TIFF reader") );
+    wxCHECK_MSG( page >= 0 && page < GetPageCount(), false,
+                 wxS("invalid TIFF page index") );
+
+    if ( page != m_current )
+    {
+        if ( !TIFFSetSubDirectory(m_tif, (toff_t)m_offsets[page]) )
+        {
+            m_current = -1;
+            return false;
+        }
+
+        m_current = page;
+    }
+
+    return true;
+}
+
+wxSize wxTIFFReader::GetPageSize(int page)
+{
+    if ( !SelectPage(page) )
+        return wxDefaultSize;
+
+    wxUint32 w = 0,
+             h = 0;
+    TIFFGetField( m_tif, TIFFTAG_IMAGEWIDTH, &w );
+    TIFFGetField( m_tif, TIFFTAG_IMAGELENGTH, &h );
+
+    return wxSize((int)w, (int)h);
+}
+
+bool wxTIFFReader::DoLoadPage(int page, wxImage* image, const wxRect* rect)
+{
+    wxCHECK_MSG( image, false, wxS("null image pointer") );
+
+    image->Destroy();
+
+    if ( !SelectPage(page) )
+    {
+        wxLogError( _("Invalid TIFF image index.") );
+
+        return false;
+    }
+
+    return LoadTIFFDirectory(m_tif, image, wxImageLoadProgressFunction(),
+                             true, rect);
+}
+
+bool wxTIFFReader::LoadPage(int page, wxImage* image)
+{
+    return DoLoadPage(page, image, nullptr);
+}
+
+bool wxTIFFReader::LoadPageRegion(int page, const wxRect& rect, wxImage* image)
+{
+    return DoLoadPage(page, image, &rect);
+}
+
 #endif  // wxUSE_STREAMS
 
 /*static*/ wxVersionInfo wxTIFFHandler::GetLibraryVersionInfo()
@@ -287,6 +287,14 @@ wxItemAttr* wxListCtrlBase::OnGetItemColumnAttr(long item, long WXUNUSED(column)
     return OnGetItemAttr(item);
 }
 
+bool wxListCtrlBase::OnFindItemByPrefix(long WXUNUSED(start),
+                                        const wxString& WXUNUSED(prefix),
+                                        long& WXUNUSED(item)) const
+{
+    // Use the default search implementation.
+    return false;
+}
+
 // ----------------------------------------------------------------------------
 // Images support
 // ----------------------------------------------------------------------------
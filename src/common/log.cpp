@@ -41,7 +41,9 @@
 #include "wx/vector.h"
 
 // other standard headers
+#include <atomic>
 #include <errno.h>
+#include <memory>
 
 #include <string.h>
 
@@ -393,7 +395,14 @@ wxLog::OnLog(wxLogLevel level,
         logger = wxPerThreadLogger;
         if ( !logger )
         {
-            if ( ms_pLogger )
+            // thread-safe global logger can be used directly, but notice that
+            // we can't count repetitions when doing it
+            wxLog * const loggerGlobal = ms_pLogger;
+            if ( loggerGlobal && loggerGlobal->IsThreadSafe() )
+            {
+                loggerGlobal->CallDoLogNow(level, msg, info, false);
+            }
+            else if ( loggerGlobal )
             {
                 // buffer the messages until they can be shown from the main
                 // thread
@@ -426,9 +435,10 @@ wxLog::OnLog(wxLogLevel level,
 void
 wxLog::CallDoLogNow(wxLogLevel level,
                     const wxString& msg,
-                    const wxLogRecordInfo& info)
+                    const wxLogRecordInfo& info,
+                    bool countRepetitions)
 {
-    if ( GetRepetitionCounting() )
+    if ( countRepetitions && GetRepetitionCounting() )
     {
         if ( msg == gs_prevLog.msg )
         {
@@ -605,7 +615,15 @@ void wxLog::SetComponentLevel(const wxString& component, wxLogLevel level)
     {
         wxCRIT_SECT_LOCKER(lock, GetLevelsCS());
 
-        GetComponentLevels()[component] = level;
+        auto& componentLevels = GetComponentLevels();
+        componentLevels[component] = level;
+
+        ms_maxComponentLevel = wxLOG_FatalError;
+        for ( const auto& kv : componentLevels )
+        {
+            if ( kv.second > ms_maxComponentLevel )
+                ms_maxComponentLevel = kv.second;
+        }
     }
 }
 
@@ -668,6 +686,8 @@ void wxLog::AddTraceMask(const wxString& str)
     wxCRIT_SECT_LOCKER(lock, GetTraceMaskCS());
 
     TraceMasks().push_back(str);
+
+    ms_hasTraceMasks = true;
 }
 
 void wxLog::RemoveTraceMask(const wxString& str)
@@ -677,6 +697,8 @@ void wxLog::RemoveTraceMask(const wxString& str)
     int index = TraceMasks().Index(str);
     if ( index != wxNOT_FOUND )
         TraceMasks().RemoveAt((size_t)index);
+
+    ms_hasTraceMasks = !TraceMasks().empty();
 }
 
 void wxLog::ClearTraceMasks()
@@ -684,10 +706,16 @@ void wxLog::ClearTraceMasks()
     wxCRIT_SECT_LOCKER(lock, GetTraceMaskCS());
 
     TraceMasks().Clear();
+
+    ms_hasTraceMasks = false;
 }
 
 /*static*/ bool wxLog::IsAllowedTraceMask(const wxString& mask)
 {
+    // avoid locking in the common case of not having any trace masks at all
+    if ( !HasTraceMasks() )
+        return false;
+
     wxCRIT_SECT_LOCKER(lock, GetTraceMaskCS());
 
     const wxArrayString& masks = GetTraceMasks();
@@ -1002,6 +1030,375 @@ wxLogInterposerTemp::wxLogInterposerTemp()
     #pragma warning(default:4355)
 #endif // VC++
 
+#if wxUSE_THREADS
+
+// ----------------------------------------------------------------------------
+// wxLogAsyncImpl: the queue of log records and the thread logging them
+// ----------------------------------------------------------------------------
+
+// The queue is a bounded multiple producers queue (due to D. Vyukov) used with
+// a single consumer: each cell has a sequence number which is equal to the
+// position of the producer when it can be written to and to the position of
+// the consumer plus 1 when it can be read from, so that the producers only
+// need a single compare-and-swap to reserve a cell and never wait.
+class wxLogAsyncImpl : public wxThread
+{
+public:
+    wxLogAsyncImpl(wxLog *target, size_t capacity)
+        : wxThread(wxTHREAD_JOINABLE),
+          m_target(target)
+    {
+        size_t size = 2;
+        while ( size < capacity )
+            size *= 2;
+
+        m_cells.reset(new Cell[size]);
+        m_mask = size - 1;
+        for ( size_t n = 0; n < size; n++ )
+            m_cells[n].sequence.store(n, std::memory_order_relaxed);
+    }
+
+    virtual ~wxLogAsyncImpl()
+    {
+        delete m_target;
+    }
+
+    // Start the thread, if this fails, the records are logged synchronously.
+    void Start()
+    {
+        m_running = Run() == wxTHREAD_NO_ERROR;
+    }
+
+    // Stop the thread after logging all the queued records.
+    void Stop()
+    {
+        if ( !m_running )
+            return;
+
+        m_stop.store(true);
+        m_wakeUp.Post();
+        Wait();
+
+        m_running = false;
+    }
+
+    void SetRateLimit(unsigned maxPerSecond)
+    {
+        m_rateLimit.store(maxPerSecond, std::memory_order_relaxed);
+    }
+
+    unsigned GetRateLimit() const
+    {
+        return m_rateLimit.load(std::memory_order_relaxed);
+    }
+
+    size_t GetDroppedCount() const
+    {
+        return m_droppedTotal.load(std::memory_order_relaxed);
+    }
+
+    // Called from any thread, never blocks unless the thread couldn't be
+    // started.
+    void Push(wxLogLevel level,
+              const wxString& msg,
+              const wxLogRecordInfo& info)
+    {
+        if ( level > wxLOG_Warning && !CheckRateLimit(info.timestampMS) )
+        {
+            Drop();
+            return;
+        }
+
+        if ( !m_running )
+        {
+            wxCriticalSectionLocker lock(m_syncCS);
+            m_target->LogRecord(level, msg, info);
+            return;
+        }
+
+        Cell* cell;
+        size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+        for ( ;; )
+        {
+            cell = &m_cells[pos & m_mask];
+
+            const size_t seq = cell->sequence.load(std::memory_order_acquire);
+            const wxIntPtr diff = static_cast<wxIntPtr>(seq - pos);
+            if ( diff == 0 )
+            {
+                if ( m_enqueuePos.compare_exchange_weak
+                                  (
+                                    pos, pos + 1,
+                                    std::memory_order_relaxed
+                                  ) )
+                    break;
+            }
+            else if ( diff < 0 )
+            {
+                // The queue is full, drop the record rather than waiting for
+                // the writer thread.
+                Drop();
+                return;
+            }
+            else // Another producer took this cell, try the next one.
+            {
+                pos = m_enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        cell->level = level;
+        cell->msg = msg;
+        cell->info = info;
+
+        // This store and the check of m_sleeping below must be sequentially
+        // consistent with the opposite operations in Entry() to ensure that we
+        // never leave the thread sleeping with a non-empty queue.
+        cell->sequence.store(pos + 1);
+
+        if ( !m_hasUnflushed.load(std::memory_order_relaxed) )
+            m_hasUnflushed.store(true);
+
+        if ( m_sleeping.load() && m_sleeping.exchange(false) )
+            m_wakeUp.Post();
+    }
+
+    // Wait until all the records queued before are logged and flush target.
+    void Flush()
+    {
+        if ( !m_running )
+        {
+            wxCriticalSectionLocker lock(m_syncCS);
+            m_target->Flush();
+            return;
+        }
+
+        // Flushing from the target itself would deadlock.
+        if ( wxThread::This() == this )
+            return;
+
+        // Avoid waking up the thread when nothing was logged, as Flush() is
+        // called from every idle event handler in GUI applications.
+        wxCriticalSectionLocker lock(m_flushCS);
+        if ( !m_hasUnflushed.exchange(false) )
+            return;
+
+        m_flushRequested.store(true);
+        m_wakeUp.Post();
+        m_flushDone.Wait();
+    }
+
+protected:
+    virtual ExitCode Entry() override
+    {
+        for ( ;; )
+        {
+            LogQueued();
+
+            if ( m_flushRequested.exchange(false) )
+            {
+                LogQueued();
+                m_target->Flush();
+                m_flushDone.Post();
+            }
+
+            if ( m_stop.load() )
+            {
+                LogQueued();
+                break;
+            }
+
+            m_sleeping.store(true);
+            if ( HasQueued() || m_flushRequested.load() || m_stop.load() )
+            {
+                m_sleeping.store(false);
+                continue;
+            }
+
+            m_wakeUp.Wait();
+            m_sleeping.store(false);
+        }
+
+        return nullptr;
+    }
+
+private:
+    struct Cell
+    {
+        std::atomic<size_t> sequence;
+
+        wxLogLevel level = 0;
+        wxString msg;
+        wxLogRecordInfo info;
+    };
+
+    // Check whether one more record can be logged in the second containing
+    // the given time: this is approximate, as the counter may be reset
+    // concurrently with being incremented, but good enough for our purposes.
+    bool CheckRateLimit(wxLongLong_t timestampMS)
+    {
+        const unsigned limit = m_rateLimit.load(std::memory_order_relaxed);
+        if ( !limit )
+            return true;
+
+        const wxLongLong_t second = timestampMS / 1000;
+        wxLongLong_t current = m_rateSecond.load(std::memory_order_relaxed);
+        if ( second > current &&
+                m_rateSecond.compare_exchange_strong(current, second) )
+            m_rateCount.store(0, std::memory_order_relaxed);
+
+        return m_rateCount.fetch_add(1, std::memory_order_relaxed) < limit;
+    }
+
+    void Drop()
+    {
+        m_droppedTotal.fetch_add(1, std::memory_order_relaxed);
+        m_droppedToReport.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // These functions are only called from the writer thread.
+    bool HasQueued() const
+    {
+        return m_cells[m_dequeuePos & m_mask].sequence.load() == m_dequeuePos + 1;
+    }
+
+    void LogQueued()
+    {
+        for ( ;; )
+        {
+            Cell& cell = m_cells[m_dequeuePos & m_mask];
+            if ( cell.sequence.load(std::memory_order_acquire) != m_dequeuePos + 1 )
+                break;
+
+            // Formatting the record is done by the target and so in this
+            // thread, the producer only had to copy it.
+            const wxLogLevel level = cell.level;
+            wxString msg;
+            msg.swap(cell.msg);
+            const wxLogRecordInfo info = cell.info;
+
+            cell.sequence.store(m_dequeuePos + m_mask + 1,
+                                std::memory_order_release);
+            m_dequeuePos++;
+
+            m_target->LogRecord(level, msg, info);
+        }
+
+        const size_t dropped = m_droppedToReport.exchange(0);
+        if ( dropped )
+        {
+            wxLogRecordInfo info;
+            info.timestampMS = wxGetUTCTimeMillis().GetValue();
+            info.threadId = wxThread::GetCurrentId();
+
+            wxString msg;
+#if wxUSE_INTL
+            msg.Printf(wxPLURAL("%lu log message was discarded.",
+                                "%lu log messages were discarded.",
+                                dropped),
+                       static_cast<unsigned long>(dropped));
+#else
+            msg.Printf(wxS("%lu log message(s) were discarded."),
+                       static_cast<unsigned long>(dropped));
+#endif
+            m_target->LogRecord(wxLOG_Warning, msg, info);
+        }
+    }
+
+
+    wxLog* const m_target;
+
+    std::unique_ptr<Cell[]> m_cells;
+    size_t m_mask = 0;
+
+    // Position of the next cell to be written by the producers.
+    std::atomic<size_t> m_enqueuePos{0};
+
+    // Position of the next cell to be read by the writer thread.
+    size_t m_dequeuePos = 0;
+
+    // The writer thread waits on this semaphore when the queue is empty and
+    // sets m_sleeping before doing it to let the producers know that they need
+    // to wake it up.
+    wxSemaphore m_wakeUp;
+    std::atomic<bool> m_sleeping{false};
+
+    std::atomic<bool> m_stop{false};
+
+    // Set when a record is queued and reset by Flush().
+    std::atomic<bool> m_hasUnflushed{false};
+
+    // Flush() sets the flag and waits for the writer thread to post the
+    // semaphore after flushing target, the critical section serializes the
+    // concurrent calls to it.
+    std::atomic<bool> m_flushRequested{false};
+    wxSemaphore m_flushDone;
+    wxCriticalSection m_flushCS;
+
+    // Rate limit, if non-zero, and the number of records in the current
+    // second.
+    std::atomic<unsigned> m_rateLimit{0};
+    std::atomic<wxLongLong_t> m_rateSecond{0};
+    std::atomic<unsigned> m_rateCount{0};
+
+    std::atomic<size_t> m_droppedTotal{0};
+    std::atomic<size_t> m_droppedToReport{0};
+
+    // Only used if the thread couldn't be started.
+    bool m_running = false;
+    wxCriticalSection m_syncCS;
+
+    wxDECLARE_NO_COPY_CLASS(wxLogAsyncImpl);
+};
+
+// ----------------------------------------------------------------------------
+// wxLogAsync
+// ----------------------------------------------------------------------------
+
+wxLogAsync::wxLogAsync(wxLog *target, size_t capacity)
+    : m_impl(new wxLogAsyncImpl(target, capacity))
+{
+    wxASSERT_MSG( target, "log target must be specified" );
+
+    m_impl->Start();
+}
+
+wxLogAsync::~wxLogAsync()
+{
+    m_impl->Stop();
+    delete m_impl;
+}
+
+void wxLogAsync::SetRateLimit(unsigned maxPerSecond)
+{
+    m_impl->SetRateLimit(maxPerSecond);
+}
+
+unsigned wxLogAsync::GetRateLimit() const
+{
+    return m_impl->GetRateLimit();
+}
+
+size_t wxLogAsync::GetDroppedCount() const
+{
+    return m_impl->GetDroppedCount();
+}
+
+void wxLogAsync::Flush()
+{
+    wxLog::Flush();
+
+    m_impl->Flush();
+}
+
+void wxLogAsync::DoLogRecord(wxLogLevel level,
+                             const wxString& msg,
+                             const wxLogRecordInfo& info)
+{
+    m_impl->Push(level, msg, info);
+}
+
+#endif // wxUSE_THREADS
+
 // ============================================================================
 // Global functions/variables
 // ============================================================================
@@ -1018,6 +1415,8 @@ bool            wxLog::ms_bAutoCreate  = true;
 bool            wxLog::ms_bVerbose     = false;
 
 wxLogLevel      wxLog::ms_logLevel     = wxLOG_Max;  // log everything by default
+wxLogLevel      wxLog::ms_maxComponentLevel = wxLOG_FatalError;
+std::atomic<bool> wxLog::ms_hasTraceMasks{false};
 
 size_t          wxLog::ms_suspendCount = 0;
 
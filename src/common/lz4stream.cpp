@@ -0,0 +1,420 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        src/common/lz4stream.cpp
+// Purpose:     Implementation of LZ4 stream classes
+// Author:      wxWidgets team
+// Created:     2026-10-14
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+// ============================================================================
+// declarations
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// headers
+// ----------------------------------------------------------------------------
+
+// for compilers that support precompilation, includes "wx.h".
+#include "wx/wxprec.h"
+
+
+#if wxUSE_LIBLZ4 && wxUSE_STREAMS
+
+#include "wx/lz4stream.h"
+
+#ifndef WX_PRECOMP
+    #include "wx/log.h"
+    #include "wx/translation.h"
+    #include "wx/utils.h"
+#endif // WX_PRECOMP
+
+#include <lz4.h>
+#include <lz4frame.h>
+
+namespace wxPrivate
+{
+
+// ----------------------------------------------------------------------------
+// Constants
+// ----------------------------------------------------------------------------
+
+// The size of the buffer used for reading the compressed data and of the
+// chunks of data compressed at once.
+const size_t wxLZ4_CHUNK_SIZE = 65536;
+
+// ----------------------------------------------------------------------------
+// Private helpers
+// ----------------------------------------------------------------------------
+
+// Holds either the compression or the decompression context, depending on the
+// stream kind, and the buffer for its input or output respectively.
+struct wxLZ4Stream
+{
+    wxLZ4Stream()
+    {
+        memset(&m_prefs, 0, sizeof(m_prefs));
+    }
+
+    ~wxLZ4Stream()
+    {
+        if ( m_cctx )
+            LZ4F_freeCompressionContext(m_cctx);
+        if ( m_dctx )
+            LZ4F_freeDecompressionContext(m_dctx);
+        delete [] m_buf;
+    }
+
+    LZ4F_cctx* m_cctx = nullptr;
+    LZ4F_dctx* m_dctx = nullptr;
+
+    // Used for compression only.
+    LZ4F_preferences_t m_prefs;
+
+    wxUint8* m_buf = nullptr;
+    size_t m_bufSize = 0;
+
+    // The part of m_buf containing the data: for decompression, the range
+    // [m_bufPos, m_bufLen) hasn't been decompressed yet, for compression, the
+    // first m_bufLen bytes haven't been written to the output yet.
+    size_t m_bufPos = 0,
+           m_bufLen = 0;
+
+    // For decompression: true if the last frame was completely decoded.
+    // For compression: true if the frame was ended and nothing else can be
+    // written to the stream.
+    bool m_frameDone = false;
+};
+
+} // namespace wxPrivate
+
+using namespace wxPrivate;
+
+// ============================================================================
+// implementation
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Functions
+// ----------------------------------------------------------------------------
+
+wxVersionInfo wxGetLibLZ4VersionInfo()
+{
+    const int ver = LZ4_versionNumber();
+
+    return wxVersionInfo
+           (
+            "liblz4",
+            ver / 10000,
+            (ver % 10000) / 100,
+            ver % 100
+           );
+}
+
+// ----------------------------------------------------------------------------
+// wxLZ4Data: common helpers for compression and decompression
+// ----------------------------------------------------------------------------
+
+wxLZ4Data::wxLZ4Data()
+{
+    m_stream = new wxLZ4Stream;
+    m_pos = 0;
+}
+
+wxLZ4Data::~wxLZ4Data()
+{
+    delete m_stream;
+}
+
+// ----------------------------------------------------------------------------
+// wxLZ4InputStream: decompression
+// ----------------------------------------------------------------------------
+
+void wxLZ4InputStream::Init()
+{
+    const LZ4F_errorCode_t
+        rc = LZ4F_createDecompressionContext(&m_stream->m_dctx, LZ4F_VERSION);
+    if ( LZ4F_isError(rc) )
+    {
+        wxLogError(_("Failed to initialize LZ4 decompression: %s"),
+                   LZ4F_getErrorName(rc));
+        m_stream->m_dctx = nullptr;
+        m_lasterror = wxSTREAM_READ_ERROR;
+        return;
+    }
+
+    m_stream->m_bufSize = wxLZ4_CHUNK_SIZE;
+    m_stream->m_buf = new wxUint8[m_stream->m_bufSize];
+}
+
+size_t wxLZ4InputStream::OnSysRead(void* outbuf, size_t size)
+{
+    wxUint8* const out = static_cast<wxUint8*>(outbuf);
+    size_t outPos = 0;
+
+    // Decompress input as long as we don't have any errors (including EOF, as
+    // it doesn't make sense to continue after it either) and have space to
+    // decompress it to.
+    while ( m_lasterror == wxSTREAM_NO_ERROR && outPos < size )
+    {
+        // Get more input data if needed.
+        bool inputEnded = false;
+        if ( m_stream->m_bufPos == m_stream->m_bufLen )
+        {
+            m_parent_i_stream->Read(m_stream->m_buf, m_stream->m_bufSize);
+            m_stream->m_bufPos = 0;
+            m_stream->m_bufLen = m_parent_i_stream->LastRead();
+
+            if ( !m_stream->m_bufLen )
+            {
+                if ( m_parent_i_stream->GetLastError() != wxSTREAM_EOF )
+                {
+                    m_lasterror = wxSTREAM_READ_ERROR;
+                    return 0;
+                }
+
+                // We still need to let the decoder output the data it may
+                // have kept since the last call.
+                inputEnded = true;
+            }
+        }
+
+        // Do decompress: on input, these variables contain the available
+        // sizes and on output the number of bytes consumed and produced.
+        size_t srcSize = m_stream->m_bufLen - m_stream->m_bufPos;
+        size_t dstSize = size - outPos;
+        const size_t rc = LZ4F_decompress(m_stream->m_dctx,
+                                          out + outPos, &dstSize,
+                                          m_stream->m_buf + m_stream->m_bufPos,
+                                          &srcSize,
+                                          nullptr);
+        if ( LZ4F_isError(rc) )
+        {
+            wxLogError(_("LZ4 decompression error: %s"),
+                       LZ4F_getErrorName(rc));
+
+            m_lasterror = wxSTREAM_READ_ERROR;
+            return 0;
+        }
+
+        m_stream->m_bufPos += srcSize;
+        outPos += dstSize;
+
+        // Notice that we continue after the end of the frame, as the input
+        // may consist of several concatenated frames. Also notice that the
+        // return value is only meaningful if any progress was made, as the
+        // decoder returns the size of the next frame header otherwise.
+        if ( srcSize || dstSize )
+            m_stream->m_frameDone = rc == 0;
+
+        if ( inputEnded && !dstSize )
+        {
+            if ( !m_stream->m_frameDone )
+            {
+                wxLogError(_("LZ4 decompression error: %s"),
+                           _("input is truncated"));
+
+                m_lasterror = wxSTREAM_READ_ERROR;
+                return 0;
+            }
+
+            m_lasterror = wxSTREAM_EOF;
+        }
+    }
+
+    // Return the number of bytes actually read, this may be less than the
+    // requested size if we hit EOF.
+    m_pos += outPos;
+    return outPos;
+}
+
+// ----------------------------------------------------------------------------
+// wxLZ4OutputStream: compression
+// ----------------------------------------------------------------------------
+
+void wxLZ4OutputStream::Init(int level)
+{
+    LZ4F_errorCode_t
+        rc = LZ4F_createCompressionContext(&m_stream->m_cctx, LZ4F_VERSION);
+    if ( LZ4F_isError(rc) )
+    {
+        wxLogError(_("Failed to initialize LZ4 compression: %s"),
+                   LZ4F_getErrorName(rc));
+        m_stream->m_cctx = nullptr;
+        m_lasterror = wxSTREAM_WRITE_ERROR;
+        return;
+    }
+
+    // Level 0 means the default (fast) compression for LZ4, while levels
+    // from 3 to 12 use the slower high compression mode.
+    LZ4F_preferences_t& prefs = m_stream->m_prefs;
+    prefs.compressionLevel = level == -1 ? 0 : level;
+
+    // Include the checksum of the data, as lz4 command line utility does.
+    prefs.frameInfo.contentChecksumFlag = LZ4F_contentChecksumEnabled;
+
+    // The buffer must be big enough for the frame header and for the result
+    // of compressing a chunk of data, including the data which could have
+    // been buffered by LZ4 internally.
+    m_stream->m_bufSize = LZ4F_HEADER_SIZE_MAX +
+                            LZ4F_compressBound(wxLZ4_CHUNK_SIZE, &prefs);
+    m_stream->m_buf = new wxUint8[m_stream->m_bufSize];
+
+    // Write the frame header into the buffer, it will be output later.
+    rc = LZ4F_compressBegin(m_stream->m_cctx,
+                            m_stream->m_buf, m_stream->m_bufSize,
+                            &prefs);
+    if ( LZ4F_isError(rc) )
+    {
+        wxLogError(_("Failed to initialize LZ4 compression: %s"),
+                   LZ4F_getErrorName(rc));
+        m_lasterror = wxSTREAM_WRITE_ERROR;
+        return;
+    }
+
+    m_stream->m_bufLen = rc;
+}
+
+size_t wxLZ4OutputStream::OnSysWrite(const void *inbuf, size_t size)
+{
+    if ( m_stream->m_frameDone )
+        m_lasterror = wxSTREAM_WRITE_ERROR;
+
+    const wxUint8* const in = static_cast<const wxUint8*>(inbuf);
+
+    // Compress as long as we have any input data, but stop at first error as
+    // it's useless to try to continue after it (or even starting if the stream
+    // had already been in an error state).
+    for ( size_t inPos = 0;
+          m_lasterror == wxSTREAM_NO_ERROR && inPos < size;
+          inPos += wxLZ4_CHUNK_SIZE )
+    {
+        if ( !CompressChunk(in + inPos, wxMin(size - inPos, wxLZ4_CHUNK_SIZE)) )
+            return 0;
+    }
+
+    if ( m_lasterror != wxSTREAM_NO_ERROR )
+        return 0;
+
+    m_pos += size;
+    return size;
+}
+
+bool wxLZ4OutputStream::CompressChunk(const void *buffer, size_t size)
+{
+    // Make sure we have enough space in the buffer for the compressed data.
+    if ( m_stream->m_bufSize - m_stream->m_bufLen <
+            LZ4F_compressBound(size, &m_stream->m_prefs) && !UpdateOutput() )
+        return false;
+
+    const size_t rc = LZ4F_compressUpdate(m_stream->m_cctx,
+                                          m_stream->m_buf + m_stream->m_bufLen,
+                                          m_stream->m_bufSize - m_stream->m_bufLen,
+                                          buffer, size,
+                                          nullptr);
+    if ( LZ4F_isError(rc) )
+    {
+        wxLogError(_("LZ4 compression error: %s"), LZ4F_getErrorName(rc));
+
+        m_lasterror = wxSTREAM_WRITE_ERROR;
+        return false;
+    }
+
+    m_stream->m_bufLen += rc;
+
+    return true;
+}
+
+bool wxLZ4OutputStream::UpdateOutput()
+{
+    const size_t numOut = m_stream->m_bufLen;
+    m_parent_o_stream->Write(m_stream->m_buf, numOut);
+    if ( m_parent_o_stream->LastWrite() != numOut )
+    {
+        m_lasterror = wxSTREAM_WRITE_ERROR;
+        return false;
+    }
+
+    m_stream->m_bufLen = 0;
+
+    return true;
+}
+
+bool wxLZ4OutputStream::DoFlush(bool finish)
+{
+    if ( m_lasterror != wxSTREAM_NO_ERROR )
+        return false;
+
+    // Nothing to do if the frame had been already ended.
+    if ( m_stream->m_frameDone )
+        return true;
+
+    // Passing 0 to LZ4F_compressBound() returns the size needed for flushing.
+    if ( m_stream->m_bufSize - m_stream->m_bufLen <
+            LZ4F_compressBound(0, &m_stream->m_prefs) && !UpdateOutput() )
+        return false;
+
+    wxUint8* const out = m_stream->m_buf + m_stream->m_bufLen;
+    const size_t outSize = m_stream->m_bufSize - m_stream->m_bufLen;
+    const size_t rc = finish
+                        ? LZ4F_compressEnd(m_stream->m_cctx, out, outSize, nullptr)
+                        : LZ4F_flush(m_stream->m_cctx, out, outSize, nullptr);
+    if ( LZ4F_isError(rc) )
+    {
+        wxLogError(_("LZ4 compression error when flushing output: %s"),
+                   LZ4F_getErrorName(rc));
+
+        m_lasterror = wxSTREAM_WRITE_ERROR;
+        return false;
+    }
+
+    m_stream->m_bufLen += rc;
+
+    if ( finish )
+        m_stream->m_frameDone = true;
+
+    return UpdateOutput();
+}
+
+bool wxLZ4OutputStream::Close()
+{
+    if ( !DoFlush(true) )
+        return false;
+
+    return wxFilterOutputStream::Close() && IsOk();
+}
+
+// ----------------------------------------------------------------------------
+// wxLZ4ClassFactory: allow creating streams from extension/MIME type
+// ----------------------------------------------------------------------------
+
+wxIMPLEMENT_DYNAMIC_CLASS(wxLZ4ClassFactory, wxFilterClassFactory);
+
+static wxLZ4ClassFactory g_wxLZ4ClassFactory;
+
+wxLZ4ClassFactory::wxLZ4ClassFactory()
+{
+    if ( this == &g_wxLZ4ClassFactory )
+        PushFront();
+}
+
+const wxChar * const *
+wxLZ4ClassFactory::GetProtocols(wxStreamProtocolType type) const
+{
+    static const wxChar *mime[] = { wxT("application/x-lz4"), nullptr };
+    static const wxChar *encs[] = { wxT("lz4"), nullptr };
+    static const wxChar *exts[] = { wxT(".lz4"), nullptr };
+
+    const wxChar* const* ret = nullptr;
+    switch ( type )
+    {
+        case wxSTREAM_PROTOCOL: ret = encs; break;
+        case wxSTREAM_MIMETYPE: ret = mime; break;
+        case wxSTREAM_ENCODING: ret = encs; break;
+        case wxSTREAM_FILEEXT:  ret = exts; break;
+    }
+
+    return ret;
+}
+
+#endif // wxUSE_LIBLZ4 && wxUSE_STREAMS
@@ -0,0 +1,139 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        src/common/mappedfilecmn.cpp
+// Purpose:     Common parts of wxMappedFile and wxMappedInputStream
+// Author:      wxWidgets team
+// Created:     2026-10-14
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+// For compilers that support precompilation, includes "wx.h".
+#include "wx/wxprec.h"
+
+
+#if wxUSE_FILE
+
+#include "wx/mappedfile.h"
+
+#include <string.h>
+
+// ============================================================================
+// wxMappedFile implementation
+// ============================================================================
+
+bool wxMappedFile::Open(const wxString& filename)
+{
+    Close();
+
+    m_opened = DoOpen(filename);
+
+    return m_opened;
+}
+
+void wxMappedFile::Close()
+{
+    if ( !m_opened )
+        return;
+
+    if ( m_data )
+        DoClose();
+
+    m_data = nullptr;
+    m_length = 0;
+    m_opened = false;
+}
+
+#if wxUSE_STREAMS
+
+// ============================================================================
+// wxMappedInputStream implementation
+// ============================================================================
+
+wxMappedInputStream::wxMappedInputStream(const wxString& filename)
+    : m_file(filename)
+{
+    if ( !m_file.IsOpened() )
+        m_lasterror = wxSTREAM_READ_ERROR;
+}
+
+bool wxMappedInputStream::IsOk() const
+{
+    return wxInputStream::IsOk() && m_file.IsOpened();
+}
+
+wxFileOffset wxMappedInputStream::GetLength() const
+{
+    return m_file.GetLength();
+}
+
+size_t wxMappedInputStream::OnSysRead(void *buffer, size_t size)
+{
+    const size_t avail = m_file.GetLength() - m_pos;
+    if ( !avail )
+    {
+        m_lasterror = wxSTREAM_EOF;
+        return 0;
+    }
+
+    if ( size > avail )
+        size = avail;
+
+    memcpy(buffer, m_file.GetData() + m_pos, size);
+    m_pos += size;
+
+    return size;
+}
+
+wxFileOffset wxMappedInputStream::OnSysSeek(wxFileOffset pos, wxSeekMode mode)
+{
+    wxFileOffset newPos;
+    switch ( mode )
+    {
+        case wxFromStart:
+            newPos = pos;
+            break;
+
+        case wxFromCurrent:
+            newPos = m_pos + pos;
+            break;
+
+        case wxFromEnd:
+            newPos = m_file.GetLength() + pos;
+            break;
+
+        default:
+            wxFAIL_MSG( wxS("invalid seek mode") );
+            return wxInvalidOffset;
+    }
+
+    if ( newPos < 0 || newPos > static_cast<wxFileOffset>(m_file.GetLength()) )
+        return wxInvalidOffset;
+
+    m_pos = static_cast<size_t>(newPos);
+
+    return newPos;
+}
+
+wxFileOffset wxMappedInputStream::OnSysTell() const
+{
+    return m_pos;
+}
+
+size_t wxMappedInputStream::DoPeekBuffer(const void **data)
+{
+    *data = m_file.GetData() + m_pos;
+
+    return m_file.GetLength() - m_pos;
+}
+
+void wxMappedInputStream::DoConsumeBuffer(size_t size)
+{
+    wxCHECK_RET( size <= m_file.GetLength() - m_pos,
+                 wxS("consuming more than was peeked") );
+
+    m_pos += size;
+}
+
+#endif // wxUSE_STREAMS
+
+#endif // wxUSE_FILE
@@ -472,4 +472,120 @@ wxString wxMarkupParser::Strip(const wxString& text)
     return output.GetText();
 }
 
+// ============================================================================
+// wxMarkupParsedText implementation
+// ============================================================================
+
+class wxMarkupParsedText::Recorder : public wxMarkupParserOutput
+{
+public:
+    explicit Recorder(wxMarkupParsedText& parsed)
+        : m_parsed(parsed)
+    {
+    }
+
+    virtual void OnText(const wxString& text) override
+    {
+        AddElement(Element::Kind_Text, m_parsed.m_texts.size());
+        m_parsed.m_texts.push_back(text);
+    }
+
+    virtual void OnBoldStart() override { AddTag(&wxMarkupParserOutput::OnBoldStart); }
+    virtual void OnBoldEnd() override { AddTag(&wxMarkupParserOutput::OnBoldEnd); }
+
+    virtual void OnItalicStart() override { AddTag(&wxMarkupParserOutput::OnItalicStart); }
+    virtual void OnItalicEnd() override { AddTag(&wxMarkupParserOutput::OnItalicEnd); }
+
+    virtual void OnUnderlinedStart() override { AddTag(&wxMarkupParserOutput::OnUnderlinedStart); }
+    virtual void OnUnderlinedEnd() override { AddTag(&wxMarkupParserOutput::OnUnderlinedEnd); }
+
+    virtual void OnStrikethroughStart() override { AddTag(&wxMarkupParserOutput::OnStrikethroughStart); }
+    virtual void OnStrikethroughEnd() override { AddTag(&wxMarkupParserOutput::OnStrikethroughEnd); }
+
+    virtual void OnBigStart() override { AddTag(&wxMarkupParserOutput::OnBigStart); }
+    virtual void OnBigEnd() override { AddTag(&wxMarkupParserOutput::OnBigEnd); }
+
+    virtual void OnSmallStart() override { AddTag(&wxMarkupParserOutput::OnSmallStart); }
+    virtual void OnSmallEnd() override { AddTag(&wxMarkupParserOutput::OnSmallEnd); }
+
+    virtual void OnTeletypeStart() override { AddTag(&wxMarkupParserOutput::OnTeletypeStart); }
+    virtual void OnTeletypeEnd() override { AddTag(&wxMarkupParserOutput::OnTeletypeEnd); }
+
+    virtual void OnSpanStart(const wxMarkupSpanAttributes& attrs) override
+    {
+        AddSpan(Element::Kind_SpanStart, attrs);
+    }
+
+    virtual void OnSpanEnd(const wxMarkupSpanAttributes& attrs) override
+    {
+        AddSpan(Element::Kind_SpanEnd, attrs);
+    }
+
+private:
+    void AddElement(Element::Kind kind,
+                    size_t index,
+                    void (wxMarkupParserOutput::*tagFunc)() = nullptr)
+    {
+        Element element;
+        element.kind = kind;
+        element.tagFunc = tagFunc;
+        element.index = index;
+
+        m_parsed.m_elements.push_back(element);
+    }
+
+    void AddTag(void (wxMarkupParserOutput::*tagFunc)())
+    {
+        AddElement(Element::Kind_Tag, 0, tagFunc);
+    }
+
+    void AddSpan(Element::Kind kind, const wxMarkupSpanAttributes& attrs)
+    {
+        AddElement(kind, m_parsed.m_spans.size());
+        m_parsed.m_spans.push_back(attrs);
+    }
+
+    wxMarkupParsedText& m_parsed;
+
+    wxDECLARE_NO_COPY_CLASS(Recorder);
+};
+
+bool wxMarkupParsedText::Parse(const wxString& text)
+{
+    m_elements.clear();
+    m_texts.clear();
+    m_spans.clear();
+
+    Recorder recorder(*this);
+    wxMarkupParser parser(recorder);
+    m_ok = parser.Parse(text);
+
+    return m_ok;
+}
+
+void wxMarkupParsedText::Output(wxMarkupParserOutput& output) const
+{
+    for ( const Element& element : m_elements )
+    {
+        switch ( element.kind )
+        {
+            case Element::Kind_Text:
+                output.OnText(m_texts[element.index]);
+                break;
+
+            case Element::Kind_Tag:
+                (output.*element.tagFunc)();
+                break;
+
+            case Element::Kind_SpanStart:
+                output.OnSpanStart(m_spans[element.index]);
+                break;
+
+            case Element::Kind_SpanEnd:
+                output.OnSpanEnd(m_spans[element.index]);
+                break;
+        }
+    }
+}
+
 #endif // wxUSE_MARKUP
@@ -24,6 +24,7 @@
 
 #ifndef WX_PRECOMP
     #include "wx/log.h"
+    #include "wx/image.h"
 #endif
 
 #include "wx/mediactrl.h"
@@ -440,6 +441,28 @@ wxFileOffset wxMediaCtrl::GetDownloadTotal()
     return wxInvalidOffset;
 }
 
+//---------------------------------------------------------------------------
+// wxMediaCtrl::SetFrameCallback
+// wxMediaCtrl::GetFrameStats
+//
+// Just forward to the backend, which needs to support video frame access
+//---------------------------------------------------------------------------
+bool wxMediaCtrl::SetFrameCallback(const wxMediaFrameCallback& callback)
+{
+    if(m_imp)
+        return m_imp->SetFrameCallback(callback);
+    return false;
+}
+
+bool wxMediaCtrl::GetFrameStats(wxMediaFrameStats* stats)
+{
+    wxCHECK_MSG( stats, false, "output parameter must be non-null" );
+
+    if(m_imp)
+        return m_imp->GetFrameStats(stats);
+    return false;
+}
+
 //---------------------------------------------------------------------------
 // wxMediaCtrl::DoMoveWindow
 //
@@ -521,6 +544,147 @@ void wxMediaBackendCommonBase::QueueStopEvent()
 }
 
 
+//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//
+//  wxMediaFrame
+//
+//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+namespace
+{
+
+inline unsigned char ClipToByte(int value)
+{
+    return static_cast<unsigned char>(value < 0 ? 0 : value > 255 ? 255 : value);
+}
+
+// Convert a single pixel from BT.601 limited range YUV to RGB.
+inline void YUVToRGB(int y, int u, int v, unsigned char* rgb)
+{
+    const int c = 298*(y - 16) + 128;
+    const int d = u - 128;
+    const int e = v - 128;
+
+    rgb[0] = ClipToByte((c + 409*e) >> 8);
+    rgb[1] = ClipToByte((c - 100*d - 208*e) >> 8);
+    rgb[2] = ClipToByte((c + 516*d) >> 8);
+}
+
+} // anonymous namespace
+
+wxImage wxMediaFrame::ToImage() const
+{
+    const int w = m_width,
+              h = m_height;
+    if ( w <= 0 || h <= 0 || !m_planeCount )
+        return wxImage();
+
+    // Offsets of the colour components for the packed RGB formats, with
+    // alpha offset being -1 if there is no alpha.
+    int bpp = 0,
+        r = 0, g = 0, b = 0, a = -1;
+    if ( m_format == "RGB" )
+    {
+        // This is the only format which can be used by wxImage directly.
+        if ( m_strides[0] == 3*w )
+        {
+            return wxImage(w, h, const_cast<unsigned char*>(m_planes[0]),
+                           true /* static data */);
+        }
+
+        bpp = 3; r = 0; g = 1; b = 2;
+    }
+    else if ( m_format == "BGR" )
+        { bpp = 3; r = 2; g = 1; b = 0; }
+    else if ( m_format == "RGBx" || m_format == "RGBA" )
+        { bpp = 4; r = 0; g = 1; b = 2; a = 3; }
+    else if ( m_format == "BGRx" || m_format == "BGRA" )
+        { bpp = 4; r = 2; g = 1; b = 0; a = 3; }
+    else if ( m_format == "xRGB" || m_format == "ARGB" )
+        { bpp = 4; r = 1; g = 2; b = 3; a = 0; }
+    else if ( m_format == "xBGR" || m_format == "ABGR" )
+        { bpp = 4; r = 3; g = 2; b = 1; a = 0; }
+
+    // The "x" formats have padding instead of alpha.
+    if ( a != -1 && m_format.find('x') != wxString::npos )
+        a = -1;
+
+    wxImage image(w, h, false /* don't clear */);
+    unsigned char* out = image.GetData();
+
+    if ( bpp )
+    {
+        if ( a != -1 )
+            image.InitAlpha();
+        unsigned char* alpha = image.GetAlpha();
+
+        for ( int y = 0; y < h; y++ )
+        {
+            const unsigned char* in = m_planes[0] + y*m_strides[0];
+            for ( int x = 0; x < w; x++, in += bpp )
+            {
+                *out++ = in[r];
+                *out++ = in[g];
+                *out++ = in[b];
+                if ( alpha )
+                    *alpha++ = in[a];
+            }
+        }
+
+        return image;
+    }
+
+    if ( m_format == "I420" || m_format == "YV12" )
+    {
+        if ( m_planeCount < 3 )
+            return wxImage();
+
+        // YV12 has the same layout as I420 but with U and V planes swapped.
+        const int planeU = m_format == "I420" ? 1 : 2,
+                  planeV = m_format == "I420" ? 2 : 1;
+
+        for ( int y = 0; y < h; y++ )
+        {
+            const unsigned char* const lineY = m_planes[0] + y*m_strides[0];
+            const unsigned char* const
+                lineU = m_planes[planeU] + (y/2)*m_strides[planeU];
+            const unsigned char* const
+                lineV = m_planes[planeV] + (y/2)*m_strides[planeV];
+
+            for ( int x = 0; x < w; x++, out += 3 )
+                YUVToRGB(lineY[x], lineU[x/2], lineV[x/2], out);
+        }
+
+        return image;
+    }
+
+    if ( m_format == "NV12" || m_format == "NV21" )
+    {
+        if ( m_planeCount < 2 )
+            return wxImage();
+
+        // Both formats use interleaved chroma plane, in UV or VU order.
+        const int offU = m_format == "NV12" ? 0 : 1,
+                  offV = 1 - offU;
+
+        for ( int y = 0; y < h; y++ )
+        {
+            const unsigned char* const lineY = m_planes[0] + y*m_strides[0];
+            const unsigned char* const lineUV = m_planes[1] + (y/2)*m_strides[1];
+
+            for ( int x = 0; x < w; x++, out += 3 )
+            {
+                const unsigned char* const uv = lineUV + (x/2)*2;
+                YUVToRGB(lineY[x], uv[offU], uv[offV], out);
+            }
+        }
+
+        return image;
+    }
+
+    return wxImage();
+}
+
 //
 // Force link default backends in -
 // see https://wiki.wxwidgets.org/RTTI
@@ -274,6 +274,8 @@ wxMenuItemBase::wxMenuItemBase(wxMenu *parentMenu,
 wxMenuItemBase::~wxMenuItemBase()
 {
     delete m_subMenu;
+
+    wxUpdateUIEvent::ForgetElement(this);
 }
 
 #if wxUSE_ACCEL
@@ -639,22 +641,27 @@ void wxMenuBase::UpdateUI(wxEvtHandler* source)
         wxMenuItem* item = node->GetData();
         if ( !item->IsSeparator() )
         {
-            wxWindowID itemid = item->GetId();
-            wxUpdateUIEvent event(itemid);
-            event.SetEventObject( this );
-
-            if ( !item->IsCheckable() )
-                event.DisallowCheck();
-
-            if ( source->ProcessEvent(event) )
+            if ( !wxUpdateUIEvent::IsUpToDate(item) )
             {
-                // if anything changed, update the changed attribute
-                if (event.GetSetText())
-                    SetLabel(itemid, event.GetText());
-                if (event.GetSetChecked())
-                    Check(itemid, event.GetChecked());
-                if (event.GetSetEnabled())
-                    Enable(itemid, event.GetEnabled());
+                wxWindowID itemid = item->GetId();
+                wxUpdateUIEvent event(itemid);
+                event.SetEventObject( this );
+
+                if ( !item->IsCheckable() )
+                    event.DisallowCheck();
+
+                if ( source->ProcessEvent(event) )
+                {
+                    // if anything changed, update the changed attribute
+                    if (event.GetSetText())
+                        SetLabel(itemid, event.GetText());
+                    if (event.GetSetChecked())
+                        Check(itemid, event.GetChecked());
+                    if (event.GetSetEnabled())
+                        Enable(itemid, event.GetEnabled());
+                }
+
+                event.RememberDependencies(item);
             }
 
             // recurse to the submenus
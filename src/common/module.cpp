@@ -18,11 +18,32 @@
     #include "wx/log.h"
 #endif
 
+#include "wx/thread.h"
+
+#include <chrono>
+
 #define TRACE_MODULE wxT("module")
 
+namespace
+{
+
+// Protects the lazy modules list from concurrent initialization.
+wxCRIT_SECT_DECLARE(gs_csLazyModules);
+
+// Return the number of microseconds since the given time point.
+long GetMicrosecondsSince(std::chrono::steady_clock::time_point start)
+{
+    using namespace std::chrono;
+    return static_cast<long>(
+        duration_cast<microseconds>(steady_clock::now() - start).count());
+}
+
+} // anonymous namespace
+
 wxIMPLEMENT_ABSTRACT_CLASS(wxModule, wxObject);
 
 wxModuleList wxModule::ms_modules;
+wxModuleList wxModule::ms_lazyModules;
 bool wxModule::ms_areInitialized = false;
 
 void wxModule::RegisterModule(wxModule* module)
@@ -33,20 +54,37 @@ void wxModule::RegisterModule(wxModule* module)
 
 void wxModule::UnregisterModule(wxModule* module)
 {
-    for ( wxModuleList::iterator it = ms_modules.begin();
-          it != ms_modules.end();
-          ++it )
+    for ( wxModuleList* modules : { &ms_modules, &ms_lazyModules } )
     {
-        if ( *it == module )
+        for ( wxModuleList::iterator it = modules->begin();
+              it != modules->end();
+              ++it )
         {
-            ms_modules.erase(it);
-            break;
+            if ( *it == module )
+            {
+                modules->erase(it);
+                break;
+            }
         }
     }
 
     delete module;
 }
 
+wxModule* wxModule::FindModule(wxClassInfo* classInfo)
+{
+    for ( const wxModuleList* modules : { &ms_modules, &ms_lazyModules } )
+    {
+        for ( wxModule* module : *modules )
+        {
+            if ( module->GetClassInfo() == classInfo )
+                return module;
+        }
+    }
+
+    return nullptr;
+}
+
 // Collect up all module-derived classes, create an instance of each,
 // and register them.
 void wxModule::RegisterModules()
@@ -91,47 +129,30 @@ bool wxModule::DoInitializeModule(wxModule *module,
     {
         wxClassInfo * cinfo = dependencies[i];
 
-        // Check if the module is already initialized
-        wxModuleList::const_iterator it;
-        for ( it = initializedModules.begin();
-              it != initializedModules.end();
-              ++it )
+        // find the module in the registered modules list
+        wxModule *moduleDep = FindModule(cinfo);
+        if ( !moduleDep )
         {
-            if ( (*it)->GetClassInfo() == cinfo )
-                break;
+            wxLogError(_("Dependency \"%s\" of module \"%s\" doesn't exist."),
+                       cinfo->GetClassName(),
+                       module->GetClassInfo()->GetClassName());
+            return false;
         }
 
-        if ( it != initializedModules.end() )
-        {
-            // this dependency is already initialized, nothing to do
+        // Check if the module is already initialized, this is the case for
+        // the dependencies of lazy modules initialized after startup too
+        if ( moduleDep->m_state == State_Initialized )
             continue;
-        }
-
-        // find the module in the registered modules list
-        for ( it = ms_modules.begin(); it != ms_modules.end(); ++it )
-        {
-            wxModule *moduleDep = *it;
-            if ( moduleDep->GetClassInfo() == cinfo )
-            {
-                if ( !DoInitializeModule(moduleDep, initializedModules ) )
-                {
-                    // failed to initialize a dependency, so fail this one too
-                    return false;
-                }
 
-                break;
-            }
-        }
-
-        if ( it == ms_modules.end() )
+        if ( !DoInitializeModule(moduleDep, initializedModules ) )
         {
-            wxLogError(_("Dependency \"%s\" of module \"%s\" doesn't exist."),
-                       cinfo->GetClassName(),
-                       module->GetClassInfo()->GetClassName());
+            // failed to initialize a dependency, so fail this one too
             return false;
         }
     }
 
+    const auto start = std::chrono::steady_clock::now();
+
     if ( !module->Init() )
     {
         wxLogError(_("Module \"%s\" initialization failed"),
@@ -139,8 +160,11 @@ bool wxModule::DoInitializeModule(wxModule *module,
         return false;
     }
 
-    wxLogTrace(TRACE_MODULE, wxT("Module \"%s\" initialized"),
-               module->GetClassInfo()->GetClassName());
+    // Use "module" trace mask, e.g. set WXTRACE=module, to see how long each
+    // module initialization takes.
+    wxLogTrace(TRACE_MODULE, wxT("Module \"%s\" initialized in %ldus"),
+               module->GetClassInfo()->GetClassName(),
+               GetMicrosecondsSince(start));
 
     module->m_state = State_Initialized;
     initializedModules.push_back(module);
@@ -151,6 +175,8 @@ bool wxModule::DoInitializeModule(wxModule *module,
 // Initialize user-defined modules
 bool wxModule::InitializeModules()
 {
+    const auto start = std::chrono::steady_clock::now();
+
     wxModuleList initializedModules;
 
     for ( wxModuleList::const_iterator it = ms_modules.begin();
@@ -160,8 +186,9 @@ bool wxModule::InitializeModules()
         wxModule *module = *it;
 
         // the module could have been already initialized as dependency of
-        // another one
-        if ( module->m_state == State_Registered )
+        // another one, and lazy modules are only initialized on demand (or as
+        // dependencies of non-lazy modules)
+        if ( module->m_state == State_Registered && !module->m_lazy )
         {
             if ( !DoInitializeModule( module, initializedModules ) )
             {
@@ -174,14 +201,82 @@ bool wxModule::InitializeModules()
         }
     }
 
+    // keep the lazy modules to initialize them later
+    for ( wxModule* module : ms_modules )
+    {
+        if ( module->m_state == State_Registered )
+            ms_lazyModules.push_back(module);
+    }
+
     // remember the real initialisation order
     ms_modules = initializedModules;
 
     ms_areInitialized = true;
 
+    wxLogTrace(TRACE_MODULE,
+               wxT("%zu modules initialized in %ldus, %zu lazy modules deferred"),
+               ms_modules.size(), GetMicrosecondsSince(start),
+               ms_lazyModules.size());
+
     return true;
 }
 
+bool wxModule::InitializeLazyModules(wxClassInfo* classInfo)
+{
+    wxCRIT_SECT_LOCKER(lock, gs_csLazyModules);
+
+    wxCHECK_MSG( ms_areInitialized, false,
+                 wxS("Lazy modules can't be initialized before the others") );
+
+    if ( ms_lazyModules.empty() )
+        return true;
+
+    const auto start = std::chrono::steady_clock::now();
+
+    wxModuleList initializedModules;
+    bool ok = true;
+    for ( wxModule* module : ms_lazyModules )
+    {
+        if ( module->m_state != State_Registered ||
+                !module->GetClassInfo()->IsKindOf(classInfo) )
+            continue;
+
+        if ( !DoInitializeModule(module, initializedModules) )
+        {
+            ok = false;
+            break;
+        }
+    }
+
+    if ( initializedModules.empty() )
+        return ok;
+
+    // Move the newly initialized modules, including any lazy dependencies,
+    // to the main list to ensure they're cleaned up in the correct order.
+    for ( wxModule* module : initializedModules )
+    {
+        ms_modules.push_back(module);
+
+        for ( wxModuleList::iterator it = ms_lazyModules.begin();
+              it != ms_lazyModules.end();
+              ++it )
+        {
+            if ( *it == module )
+            {
+                ms_lazyModules.erase(it);
+                break;
+            }
+        }
+    }
+
+    wxLogTrace(TRACE_MODULE,
+               wxT("%zu lazy modules of class %s initialized in %ldus"),
+               initializedModules.size(), classInfo->GetClassName(),
+               GetMicrosecondsSince(start));
+
+    return ok;
+}
+
 void wxModule::CleanUpModules()
 {
     DoCleanUpModules(ms_modules);
@@ -219,6 +314,14 @@ void wxModule::DoCleanUpModules(const wxModuleList& modules)
     }
 
     ms_modules.clear();
+
+    // including the lazy modules which were never used
+    for ( wxModule* module : ms_lazyModules )
+    {
+        delete module;
+    }
+
+    ms_lazyModules.clear();
 }
 
 bool wxModule::ResolveNamedDependencies()
@@ -137,6 +137,22 @@ size_t wxMemoryInputStream::OnSysRead(void *buffer, size_t nbytes)
     return m_i_streambuf->GetIntPosition() - pos;
 }
 
+size_t wxMemoryInputStream::DoPeekBuffer(const void **data)
+{
+    const size_t pos = m_i_streambuf->GetIntPosition();
+    *data = static_cast<char*>(m_i_streambuf->GetBufferStart()) + pos;
+
+    return m_length - pos;
+}
+
+void wxMemoryInputStream::DoConsumeBuffer(size_t size)
+{
+    const size_t pos = m_i_streambuf->GetIntPosition();
+    wxCHECK_RET( size <= m_length - pos, wxT("consuming more than was peeked") );
+
+    m_i_streambuf->SetIntPosition(pos + size);
+}
+
 wxFileOffset wxMemoryInputStream::OnSysSeek(wxFileOffset pos, wxSeekMode mode)
 {
     return m_i_streambuf->Seek(pos, mode);
@@ -17,6 +17,14 @@
 
 #include "wx/numformatter.h"
 #include "wx/uilocale.h"
+#include "wx/wxcrt.h"
+
+#include <algorithm>
+
+// See the comment in src/common/string.cpp explaining why we check for this.
+#if wxHAS_CXX17_INCLUDE(<charconv>)
+    #include <charconv>
+#endif
 
 // ============================================================================
 // wxNumberFormatter implementation
@@ -260,3 +268,362 @@ bool wxNumberFormatter::FromString(wxString s, double *val)
     ReplaceSeparatorIfNecessary(s, GetDecimalSeparator(), '.');
     return s.ToCDouble(val);
 }
+
+// ============================================================================
+// wxCachedNumberFormatter implementation
+// ============================================================================
+
+namespace
+{
+
+// Enough for 20 digits of the largest 64 bit integer, its sign and the
+// separators between the groups of digits.
+const size_t MAX_INT_CHARS = 32;
+
+// Output the digits of the given number into the buffer ending at the given
+// position, right to left, and return the pointer to the first one.
+wxChar* FormatDigitsBackwards(wxChar* end, wxULongLong_t val, wxChar sep)
+{
+    wxChar* p = end;
+    for ( int n = 0; ; ++n )
+    {
+        if ( sep && n && n % 3 == 0 )
+            *--p = sep;
+
+        *--p = wxT('0') + static_cast<int>(val % 10);
+        val /= 10;
+        if ( !val )
+            break;
+    }
+
+    return p;
+}
+
+bool IsAsciiDigit(wxChar ch)
+{
+    return ch >= wxT('0') && ch <= wxT('9');
+}
+
+} // anonymous namespace
+
+void wxCachedNumberFormatter::UpdateFromLocale()
+{
+    m_decimalSep = wxNumberFormatter::GetDecimalSeparator();
+    if ( !wxNumberFormatter::GetThousandsSeparatorIfUsed(&m_thousandsSep) )
+        m_thousandsSep = 0;
+}
+
+// ----------------------------------------------------------------------------
+// Conversion to string
+// ----------------------------------------------------------------------------
+
+wxString
+wxCachedNumberFormatter::DoFormatInt(wxULongLong_t absval,
+                                     bool negative,
+                                     int style) const
+{
+    wxASSERT_MSG( !(style & wxNumberFormatter::Style_NoTrailingZeroes),
+                  "Style_NoTrailingZeroes can't be used with integer values" );
+
+    wxChar buf[MAX_INT_CHARS];
+    wxChar* const end = buf + WXSIZEOF(buf);
+
+    const wxChar sep = style & wxNumberFormatter::Style_WithThousandsSep
+                        ? m_thousandsSep
+                        : 0;
+
+    wxChar* start = FormatDigitsBackwards(end, absval, sep);
+    if ( negative )
+        *--start = wxT('-');
+
+    return wxString(start, end - start);
+}
+
+wxString wxCachedNumberFormatter::ToString(long val, int style) const
+{
+    // Note that negating the unsigned value avoids the overflow for LONG_MIN.
+    const wxULongLong_t absval = val < 0 ? 0 - static_cast<wxULongLong_t>(val)
+                                         : static_cast<wxULongLong_t>(val);
+    return DoFormatInt(absval, val < 0, style);
+}
+
+#ifdef wxHAS_LONG_LONG_T_DIFFERENT_FROM_LONG
+
+wxString wxCachedNumberFormatter::ToString(wxLongLong_t val, int style) const
+{
+    const wxULongLong_t absval = val < 0 ? 0 - static_cast<wxULongLong_t>(val)
+                                         : static_cast<wxULongLong_t>(val);
+    return DoFormatInt(absval, val < 0, style);
+}
+
+#endif // wxHAS_LONG_LONG_T_DIFFERENT_FROM_LONG
+
+wxString wxCachedNumberFormatter::ToString(wxULongLong_t val, int style) const
+{
+    return DoFormatInt(val, false, style);
+}
+
+wxString
+wxCachedNumberFormatter::ToString(double val, int precision, int style) const
+{
+    wxCHECK_MSG( precision >= -1, wxString(), "Invalid negative precision" );
+
+    // Get the number in "C" locale first, avoiding any allocations if we can.
+    const char* start = nullptr;
+    const char* end = nullptr;
+
+#ifdef __cpp_lib_to_chars
+    char buf[128];
+
+    // Use the same format as wxString::FromCDouble() does.
+    const std::to_chars_result res =
+        precision == -1
+            ? std::to_chars(buf, buf + sizeof(buf), val,
+                            std::chars_format::general, 6)
+            : std::to_chars(buf, buf + sizeof(buf), val,
+                            std::chars_format::fixed, precision);
+    if ( res.ec == std::errc{} )
+    {
+        start = buf;
+        end = res.ptr;
+    }
+#endif // __cpp_lib_to_chars
+
+    // If to_chars() is not available or the buffer is too small for it, fall
+    // back to the slower way.
+    wxScopedCharBuffer fallback;
+    if ( !start )
+    {
+        fallback = wxString::FromCDouble(val, precision).utf8_str();
+        start = fallback.data();
+        end = start + fallback.length();
+    }
+
+    // Thousands separators and trailing zeroes are not relevant for the
+    // numbers in scientific format, as in wxNumberFormatter::ToString().
+    const char* const posExp = std::find_if(start, end,
+                                   [](char ch) { return ch == 'e' || ch == 'E'; });
+    const bool isScientific = posExp != end;
+
+    const char* const posDigits = std::find_if(start, posExp,
+                                   [](char ch) { return ch >= '0' && ch <= '9'; });
+    const char* const posDecSep = std::find(posDigits, posExp, '.');
+
+    const wxChar sep = !isScientific &&
+                        (style & wxNumberFormatter::Style_WithThousandsSep)
+                            ? m_thousandsSep
+                            : 0;
+
+    // Find the end of the fractional part to keep.
+    const char* endFrac = posExp;
+    if ( !isScientific &&
+            (style & wxNumberFormatter::Style_NoTrailingZeroes) &&
+                posDecSep != posExp )
+    {
+        while ( endFrac[-1] == '0' )
+            --endFrac;
+
+        // If nothing remains after the separator, drop it too.
+        if ( endFrac == posDecSep + 1 )
+            endFrac = posDecSep;
+    }
+
+    wxString s;
+    s.reserve((end - start) + (posDecSep - posDigits) / 3);
+
+    for ( const char* p = start; p != posDigits; ++p )
+        s += static_cast<wxChar>(*p);
+
+    for ( const char* p = posDigits; p != posDecSep; ++p )
+    {
+        if ( sep && p != posDigits && (posDecSep - p) % 3 == 0 )
+            s += sep;
+
+        s += static_cast<wxChar>(*p);
+    }
+
+    if ( endFrac != posDecSep )
+    {
+        s += m_decimalSep;
+        for ( const char* p = posDecSep + 1; p != endFrac; ++p )
+            s += static_cast<wxChar>(*p);
+    }
+
+    for ( const char* p = posExp; p != end; ++p )
+        s += static_cast<wxChar>(*p);
+
+    // Remove sign from orphaned zero.
+    if ( endFrac != posExp && s == wxS("-0") )
+        s = wxS("0");
+
+    return s;
+}
+
+// ----------------------------------------------------------------------------
+// Conversion from strings
+// ----------------------------------------------------------------------------
+
+bool
+wxCachedNumberFormatter::DoParseInt(const wxString& s,
+                                    wxULongLong_t maxPos,
+                                    wxULongLong_t maxNeg,
+                                    wxULongLong_t* absval,
+                                    bool* negative) const
+{
+    wxString::const_iterator it = s.begin();
+    const wxString::const_iterator end = s.end();
+
+    // Skip the leading whitespace and the sign, just as strtol() does.
+    while ( it != end &&
+                (wxIsspace(*it) || (m_thousandsSep && *it == m_thousandsSep)) )
+        ++it;
+
+    *negative = false;
+    if ( it != end && (*it == '+' || *it == '-') )
+    {
+        *negative = *it == '-';
+        if ( *negative && !maxNeg )
+            return false;
+
+        ++it;
+    }
+
+    const wxULongLong_t maxVal = *negative ? maxNeg : maxPos;
+
+    wxULongLong_t val = 0;
+    bool hasDigits = false;
+    for ( ; it != end; ++it )
+    {
+        const wxChar ch = *it;
+        if ( m_thousandsSep && ch == m_thousandsSep )
+            continue;
+
+        if ( !IsAsciiDigit(ch) )
+            return false;
+
+        const unsigned digit = ch - wxT('0');
+        if ( val > (maxVal - digit) / 10 )
+            return false;
+
+        val = val*10 + digit;
+        hasDigits = true;
+    }
+
+    if ( !hasDigits )
+        return false;
+
+    *absval = val;
+
+    return true;
+}
+
+bool wxCachedNumberFormatter::FromString(const wxString& s, long *val) const
+{
+    wxCHECK_MSG( val, false, "null output pointer" );
+
+    wxULongLong_t absval;
+    bool negative;
+    if ( !DoParseInt(s,
+                     static_cast<wxULongLong_t>(LONG_MAX),
+                     static_cast<wxULongLong_t>(LONG_MAX) + 1,
+                     &absval, &negative) )
+        return false;
+
+    *val = negative ? static_cast<long>(0 - absval) : static_cast<long>(absval);
+
+    return true;
+}
+
+#ifdef wxHAS_LONG_LONG_T_DIFFERENT_FROM_LONG
+
+bool
+wxCachedNumberFormatter::FromString(const wxString& s, wxLongLong_t *val) const
+{
+    wxCHECK_MSG( val, false, "null output pointer" );
+
+    wxULongLong_t absval;
+    bool negative;
+    if ( !DoParseInt(s,
+                     static_cast<wxULongLong_t>(wxINT64_MAX),
+                     static_cast<wxULongLong_t>(wxINT64_MAX) + 1,
+                     &absval, &negative) )
+        return false;
+
+    *val = negative ? static_cast<wxLongLong_t>(0 - absval)
+                    : static_cast<wxLongLong_t>(absval);
+
+    return true;
+}
+
+#endif // wxHAS_LONG_LONG_T_DIFFERENT_FROM_LONG
+
+bool
+wxCachedNumberFormatter::FromString(const wxString& s, wxULongLong_t *val) const
+{
+    wxCHECK_MSG( val, false, "null output pointer" );
+
+    // Don't accept negative numbers at all, see wxNumberFormatter version.
+    bool negative;
+    return DoParseInt(s, wxUINT64_MAX, 0, val, &negative);
+}
+
+bool wxCachedNumberFormatter::FromString(const wxString& s, double *val) const
+{
+    wxCHECK_MSG( val, false, "null output pointer" );
+
+    // Translate the string to "C" locale representation in a local buffer,
+    // which is big enough for any reasonable number.
+    char buf[128];
+    size_t len = 0;
+    bool hasDecSep = false;
+    for ( wxString::const_iterator it = s.begin(); it != s.end(); ++it )
+    {
+        wxChar ch = *it;
+        if ( m_thousandsSep && ch == m_thousandsSep )
+            continue;
+
+        if ( ch == m_decimalSep && !hasDecSep )
+        {
+            ch = wxT('.');
+            hasDecSep = true;
+        }
+
+        // Non-ASCII characters can't appear in a valid number.
+        if ( static_cast<unsigned>(ch) > 0x7f )
+            return false;
+
+        if ( len == sizeof(buf) )
+        {
+            // Fall back to the slow path for abnormally long strings.
+            wxString str(s);
+            if ( m_thousandsSep )
+                str.Replace(wxString(m_thousandsSep), wxString());
+            ReplaceSeparatorIfNecessary(str, m_decimalSep, '.');
+            return str.ToCDouble(val);
+        }
+
+        buf[len++] = static_cast<char>(ch);
+    }
+
+#ifdef __cpp_lib_to_chars
+    const char* start = buf;
+    const char* const end = buf + len;
+
+    // Skip whitespace and "+" which from_chars() doesn't accept, just as
+    // wxString::ToCDouble() does.
+    while ( start != end && wxIsspace(*start) )
+        ++start;
+    if ( start != end && *start == '+' )
+        ++start;
+
+    // Leave the hexadecimal numbers handling to wxString::ToCDouble().
+    if ( end - start < 2 || start[0] != '0' || (start[1] != 'x' && start[1] != 'X') )
+    {
+        const std::from_chars_result res = std::from_chars(start, end, *val);
+
+        return res.ec == std::errc{} && res.ptr == end;
+    }
+#endif // __cpp_lib_to_chars
+
+    return wxString::FromAscii(buf, len).ToCDouble(val);
+}
@@ -21,6 +21,14 @@
 
 #include <string.h>
 
+#if !wxUSE_EXTENDED_RTTI
+    #include "wx/thread.h"
+
+    #include <algorithm>
+    #include <unordered_map>
+    #include <vector>
+#endif // !wxUSE_EXTENDED_RTTI
+
 // we must disable optimizations for VC.NET because otherwise its too eager
 // linker discards wxClassInfo objects in release build thus breaking many,
 // many things
@@ -58,7 +66,9 @@ wxClassInfo wxObject::ms_classInfo( wxT("wxObject"), nullptr, nullptr,
 #endif
 
 wxClassInfo* wxClassInfo::sm_first = nullptr;
+#if wxUSE_EXTENDED_RTTI
 wxHashTable* wxClassInfo::sm_classTable = nullptr;
+#endif // wxUSE_EXTENDED_RTTI
 
 // when using XTI, this method is already implemented inline inside
 // wxDECLARE_DYNAMIC_CLASS but otherwise we intentionally make this function
@@ -118,6 +128,8 @@ wxClassInfo::~wxClassInfo()
     Unregister();
 }
 
+#if wxUSE_EXTENDED_RTTI
+
 wxClassInfo *wxClassInfo::FindClass(const wxString& className)
 {
     if ( sm_classTable )
@@ -271,16 +283,250 @@ wxClassInfo::const_iterator wxClassInfo::end_classinfo()
     return const_iterator(nullptr, nullptr);
 }
 
+#else // !wxUSE_EXTENDED_RTTI
+
+namespace
+{
+
+// All classes sorted by name: this is built on demand from the linked list of
+// all wxClassInfo objects by BuildClassTable() instead of inserting each class
+// into a hash table during static initialization.
+//
+// Both of these are function-local statics to avoid depending on the order of
+// static initialization, as wxClassInfo objects are static themselves.
+std::vector<wxClassInfo*>& GetClassTable()
+{
+    static std::vector<wxClassInfo*> s_classTable;
+    return s_classTable;
+}
+
+#if wxUSE_THREADS
+wxCriticalSection& GetClassTableCS()
+{
+    static wxCriticalSection s_csClassTable;
+    return s_csClassTable;
+}
+#endif // wxUSE_THREADS
+
+bool CompareClassInfoNames(const wxClassInfo* info1, const wxClassInfo* info2)
+{
+    return wxStrcmp(info1->GetClassName(), info2->GetClassName()) < 0;
+}
+
+// Return the class with the given name or null.
+wxClassInfo* FindInClassTable(const wxString& className)
+{
+    const std::vector<wxClassInfo*>& table = GetClassTable();
+
+    const auto it = std::lower_bound
+                    (
+                        table.begin(), table.end(), className,
+                        [](const wxClassInfo* info, const wxString& name)
+                        {
+                            return name.compare(info->GetClassName()) > 0;
+                        }
+                    );
+
+    if ( it == table.end() || className != (*it)->GetClassName() )
+        return nullptr;
+
+    return *it;
+}
+
+} // anonymous namespace
+
+std::atomic<bool> wxClassInfo::sm_classTableDirty(false);
+
+/* static */
+void wxClassInfo::BuildClassTable()
+{
+    if ( !sm_classTableDirty.load(std::memory_order_acquire) )
+        return;
+
+    std::vector<wxClassInfo*>& table = GetClassTable();
+    table.clear();
+
+    for ( wxClassInfo *info = sm_first; info; info = info->m_next )
+    {
+        if ( info->m_className )
+            table.push_back(info);
+    }
+
+    std::sort(table.begin(), table.end(), CompareClassInfoNames);
+
+    // Using wxIMPLEMENT_DYNAMIC_CLASS() macro twice (which may happen if you
+    // link any object module twice mistakenly, or link twice against wx shared
+    // library) would make FindClass() return either of the two classes, so
+    // try to detect it here.
+    for ( size_t n = 1; n < table.size(); ++n )
+    {
+        wxASSERT_MSG( wxStrcmp(table[n - 1]->m_className,
+                               table[n]->m_className) != 0,
+            wxString::Format
+            (
+                wxT("Class \"%s\" already in RTTI table - have you used wxIMPLEMENT_DYNAMIC_CLASS() multiple times or linked some object file twice)?"),
+                table[n]->m_className
+            )
+        );
+    }
+
+    // Assign the class IDs only the first time the table is built, as the IDs
+    // can't be changed later because IsKindOf() may be using them from other
+    // threads without locking. The classes registered after this, e.g. when
+    // loading a plugin, just don't get any IDs.
+    static bool s_idsAssigned = false;
+    if ( !s_idsAssigned )
+    {
+        s_idsAssigned = true;
+
+        // Find the direct descendants of each class using its primary base.
+        std::unordered_map<const wxClassInfo*, std::vector<wxClassInfo*>> children;
+        std::vector<wxClassInfo*> roots;
+        for ( wxClassInfo* info : table )
+        {
+            if ( info->m_baseInfo1 )
+                children[info->m_baseInfo1].push_back(info);
+            else
+                roots.push_back(info);
+        }
+
+        // Number the classes in depth-first order, so that all descendants
+        // of a class get consecutive IDs following its own one.
+        struct Frame
+        {
+            wxClassInfo* info;
+            size_t nextChild;
+        };
+
+        int nextId = 0;
+        std::vector<Frame> stack;
+        for ( wxClassInfo* root : roots )
+        {
+            root->m_hasSecondaryBases = root->m_baseInfo2 != nullptr;
+            root->m_lastDescendantId = nextId++;
+            stack.push_back({root, 0});
+
+            while ( !stack.empty() )
+            {
+                Frame& frame = stack.back();
+                wxClassInfo* const parent = frame.info;
+
+                const auto it = children.find(parent);
+                if ( it == children.end() || frame.nextChild == it->second.size() )
+                {
+                    // All descendants have been numbered, we can now publish
+                    // this class ID: notice that the ID was temporarily kept
+                    // in m_lastDescendantId until now.
+                    const int classId = parent->m_lastDescendantId;
+                    parent->m_lastDescendantId = nextId - 1;
+                    parent->m_classId.store(classId, std::memory_order_release);
+
+                    stack.pop_back();
+                    continue;
+                }
+
+                wxClassInfo* const child = it->second[frame.nextChild++];
+                child->m_hasSecondaryBases = child->m_baseInfo2 != nullptr ||
+                                                parent->m_hasSecondaryBases;
+                child->m_lastDescendantId = nextId++;
+                stack.push_back({child, 0});
+            }
+        }
+    }
+
+    sm_classTableDirty.store(false, std::memory_order_release);
+}
+
+wxClassInfo *wxClassInfo::FindClass(const wxString& className)
+{
+#if wxUSE_THREADS
+    wxCriticalSectionLocker lock(GetClassTableCS());
+#endif // wxUSE_THREADS
+
+    BuildClassTable();
+
+    return FindInClassTable(className);
+}
+
+void wxClassInfo::Unregister()
+{
+    // The class has already been removed from the linked list by the dtor,
+    // just ensure that the table doesn't keep a dangling pointer to it.
+    sm_classTableDirty = true;
+}
+
+wxObject *wxCreateDynamicObject(const wxString& name)
+{
+    wxClassInfo* const info = wxClassInfo::FindClass(name);
+
+    return info ? info->CreateObject() : nullptr;
+}
+
+// iterator interface
+wxClassInfo::const_iterator::value_type
+wxClassInfo::const_iterator::operator*() const
+{
+    return GetClassTable()[m_index];
+}
+
+wxClassInfo::const_iterator& wxClassInfo::const_iterator::operator++()
+{
+    if ( ++m_index >= GetClassTable().size() )
+        m_index = static_cast<size_t>(-1);
+
+    return *this;
+}
+
+const wxClassInfo::const_iterator wxClassInfo::const_iterator::operator++(int)
+{
+    wxClassInfo::const_iterator tmp = *this;
+    ++*this;
+    return tmp;
+}
+
+wxClassInfo::const_iterator wxClassInfo::begin_classinfo()
+{
+#if wxUSE_THREADS
+    wxCriticalSectionLocker lock(GetClassTableCS());
+#endif // wxUSE_THREADS
+
+    BuildClassTable();
+
+    return GetClassTable().empty() ? end_classinfo() : const_iterator(0);
+}
+
+wxClassInfo::const_iterator wxClassInfo::end_classinfo()
+{
+    return const_iterator();
+}
+
+#endif // wxUSE_EXTENDED_RTTI/!wxUSE_EXTENDED_RTTI
+
 // ----------------------------------------------------------------------------
 // wxObjectRefData
 // ----------------------------------------------------------------------------
 
 void wxRefCounter::DecRef()
 {
-    wxASSERT_MSG( m_count > 0, "invalid ref data count" );
+    wxASSERT_MSG( GetRefCount() > 0, "invalid ref data count" );
 
-    if ( --m_count == 0 )
-        delete this;
+    if ( m_mtSafe )
+    {
+        // The release part ensures that all our previous accesses to the
+        // object happen before its deletion in another thread, while the
+        // acquire one does the same for the accesses from the other threads
+        // if we delete it here.
+        if ( m_count.fetch_sub(1, std::memory_order_acq_rel) == 1 )
+            delete this;
+    }
+    else
+    {
+        const int count = m_count.load(std::memory_order_relaxed) - 1;
+        if ( count == 0 )
+            delete this;
+        else
+            m_count.store(count, std::memory_order_relaxed);
+    }
 }
 
 
@@ -322,12 +568,15 @@ void wxObject::AllocExclusive()
     }
     else if ( m_refData->GetRefCount() > 1 )
     {
-        // note that ref is not going to be destroyed in this case
-        const wxObjectRefData* ref = m_refData;
-        UnRef();
+        // Clone the data before releasing our reference to it: if the data
+        // is shared with other threads, it could be destroyed as soon as we
+        // do it.
+        wxObjectRefData* const ref = CloneRefData(m_refData);
+        if ( ref && m_refData->IsMTSafe() )
+            ref->SetMTSafe();
 
-        // ... so we can still access it
-        m_refData = CloneRefData(ref);
+        UnRef();
+        m_refData = ref;
     }
     //else: ref count is 1, we are exclusive owners of m_refData anyhow
 
@@ -165,6 +165,12 @@ public:
     virtual void Reset() override;
 
     wxBitmap m_bmpSaved;
+
+    // The part of the overlay area drawn over since the last Clear(), in
+    // logical coordinates, empty if nothing was drawn. Only this part needs
+    // to be restored by Clear().
+    wxRect m_rectDirty;
+
     int m_x;
     int m_y;
     int m_width;
@@ -235,6 +241,7 @@ void wxOverlayImpl::Init( wxDC* dc, int x , int y , int width , int height )
         return;
     }
     m_window = dc->GetWindow();
+    m_rectDirty = wxRect();
     m_bmpSaved.Create(width, height, *dc);
     wxMemoryDC dcMem(m_bmpSaved);
     m_x = x ;
@@ -247,7 +254,19 @@ void wxOverlayImpl::Init( wxDC* dc, int x , int y , int width , int height )
 
 void wxOverlayImpl::Clear(wxDC* dc)
 {
-    dc->DrawBitmap(m_bmpSaved, m_x, m_y);
+    const wxRect rect = m_rectDirty.Intersect(wxRect(m_x, m_y, m_width, m_height));
+    if ( !rect.IsEmpty() )
+    {
+        // Restoring the whole area is slow for big windows, so restrict it to
+        // the part which was really changed.
+        wxDCClipper clip(*dc, rect);
+        dc->DrawBitmap(m_bmpSaved, m_x, m_y);
+    }
+
+    m_rectDirty = wxRect();
+
+    // Don't count restoring the window contents as drawing on the overlay.
+    dc->GetImpl()->ResetBoundingBox();
 }
 
 void wxOverlayImpl::Reset()
@@ -262,10 +281,26 @@ void wxOverlayImpl::BeginDrawing(wxDC* dc)
 {
     // Make sure no drawing is done outside of overlay area
     dc->SetClippingRegion(m_x, m_y, m_width, m_height);
+
+    // Use the bounding box to determine what is drawn on the overlay.
+    dc->GetImpl()->ResetBoundingBox();
 }
 
-void wxOverlayImpl::EndDrawing(wxDC* WXUNUSED(dc))
+void wxOverlayImpl::EndDrawing(wxDC* dc)
 {
+    const wxDCImpl* const impl = dc->GetImpl();
+    if ( !impl->HasBoundingBox() )
+        return;
+
+    // The bounding box doesn't take the pen width into account, and the
+    // anti-aliased drawing may extend beyond it too, so add some margin.
+    const int margin = wxMax(dc->GetPen().GetWidth(), 1) + 2;
+
+    wxRect rect(wxPoint(impl->MinX(), impl->MinY()),
+                wxPoint(impl->MaxX(), impl->MaxY()));
+    rect.Inflate(margin);
+
+    m_rectDirty.Union(rect);
 }
 
 #ifndef wxHAS_NATIVE_OVERLAY
@@ -0,0 +1,319 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        src/common/paintprofiler.cpp
+// Purpose:     wxPaintProfiler implementation
+// Author:      wxWidgets team
+// Created:     2026-10-15
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+// ============================================================================
+// declarations
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// headers
+// ----------------------------------------------------------------------------
+
+// for compilers that support precompilation, includes "wx.h".
+#include "wx/wxprec.h"
+
+
+#include "wx/paintprofiler.h"
+
+#ifndef WX_PRECOMP
+    #include "wx/dcclient.h"
+    #include "wx/window.h"
+#endif // WX_PRECOMP
+
+#include "wx/evtprofiler.h"
+#include "wx/overlay.h"
+
+#include <algorithm>
+#include <memory>
+#include <unordered_map>
+
+// ----------------------------------------------------------------------------
+// private classes
+// ----------------------------------------------------------------------------
+
+namespace
+{
+
+// Paint times, in microseconds, above which the overlay shows the window as
+// slow or too slow, respectively (the latter corresponds to 60 FPS).
+constexpr wxLongLong_t SLOW_PAINT_TIME = 4000;
+constexpr wxLongLong_t TOO_SLOW_PAINT_TIME = 16000;
+
+struct WindowData
+{
+    wxPaintProfiler::WindowStats stats;
+
+    // Data about the last paint, used for drawing the overlay.
+    wxRect lastUpdateRect;
+    unsigned long lastPrimitiveCount = 0;
+
+    // Only used when the overlay is shown.
+    std::unique_ptr<wxOverlay> overlay;
+};
+
+struct PaintData
+{
+    std::unordered_map<const wxWindowBase*, WindowData> windows;
+
+    // Statistics of the windows which had been already destroyed.
+    std::vector<wxPaintProfiler::WindowStats> destroyed;
+
+    bool showOverlay = false;
+};
+
+PaintData& GetData()
+{
+    static PaintData s_data;
+    return s_data;
+}
+
+wxColour GetOverlayColour(wxLongLong_t paintTime)
+{
+    if ( paintTime >= TOO_SLOW_PAINT_TIME )
+        return *wxRED;
+
+    if ( paintTime >= SLOW_PAINT_TIME )
+        return wxColour(255, 165, 0);
+
+    return *wxGREEN;
+}
+
+void DrawOverlay(wxWindow* win)
+{
+    PaintData& data = GetData();
+    if ( !data.showOverlay )
+        return;
+
+    const auto it = data.windows.find(win);
+    if ( it == data.windows.end() )
+        return;
+
+    WindowData& wd = it->second;
+    if ( !wd.overlay )
+        wd.overlay.reset(new wxOverlay());
+
+    wxClientDC dc(win);
+    wxDCOverlay overlaydc(*wd.overlay, &dc);
+    overlaydc.Clear();
+
+    const wxColour colour = GetOverlayColour(wd.stats.lastTime);
+
+    dc.SetPen(wxPen(colour, 2));
+    dc.SetBrush(*wxTRANSPARENT_BRUSH);
+    dc.DrawRectangle(wd.lastUpdateRect);
+
+    dc.SetBackgroundMode(wxBRUSHSTYLE_SOLID);
+    dc.SetTextBackground(*wxBLACK);
+    dc.SetTextForeground(colour);
+    dc.DrawText(wxString::Format("%.1fms, %lu primitives",
+                                 wd.stats.lastTime / 1000.,
+                                 wd.lastPrimitiveCount),
+                wd.lastUpdateRect.GetTopLeft());
+}
+
+// Reset all the overlays and refresh the windows to remove them.
+void RemoveOverlays()
+{
+    for ( auto& kv : GetData().windows )
+    {
+        WindowData& wd = kv.second;
+        if ( wd.overlay )
+        {
+            wd.overlay->Reset();
+            wd.overlay.reset();
+
+            const_cast<wxWindowBase*>(kv.first)->Refresh();
+        }
+    }
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// wxPaintProfiler implementation
+// ============================================================================
+
+std::atomic<bool> wxPaintProfiler::ms_running{false};
+std::atomic<unsigned long> wxPaintProfiler::ms_primitiveCount{0};
+
+/* static */
+void wxPaintProfiler::Start()
+{
+    Reset();
+
+    ms_running = true;
+}
+
+/* static */
+void wxPaintProfiler::Stop()
+{
+    ms_running = false;
+}
+
+/* static */
+void wxPaintProfiler::Reset()
+{
+    RemoveOverlays();
+
+    PaintData& data = GetData();
+    data.windows.clear();
+    data.destroyed.clear();
+}
+
+/* static */
+std::vector<wxPaintProfiler::WindowStats> wxPaintProfiler::GetWindowStats()
+{
+    const PaintData& data = GetData();
+
+    std::vector<WindowStats> stats(data.destroyed);
+    for ( const auto& kv : data.windows )
+        stats.push_back(kv.second.stats);
+
+    std::sort(stats.begin(), stats.end(),
+              [](const WindowStats& s1, const WindowStats& s2)
+              {
+                  return s1.totalTime > s2.totalTime;
+              });
+
+    return stats;
+}
+
+/* static */
+bool wxPaintProfiler::GetWindowStats(const wxWindow* win, WindowStats* stats)
+{
+    wxCHECK_MSG( stats, false, "output parameter must be non-null" );
+
+    const PaintData& data = GetData();
+
+    const auto it = data.windows.find(win);
+    if ( it == data.windows.end() )
+        return false;
+
+    *stats = it->second.stats;
+
+    return true;
+}
+
+/* static */
+void wxPaintProfiler::ShowOverlay(bool show)
+{
+    PaintData& data = GetData();
+    if ( show == data.showOverlay )
+        return;
+
+    data.showOverlay = show;
+
+    if ( show )
+    {
+        // Show the overlays for all already painted windows immediately.
+        for ( auto& kv : data.windows )
+        {
+            wxWindow* const win = kv.second.stats.window;
+            win->CallAfter([win]() { DrawOverlay(win); });
+        }
+    }
+    else
+    {
+        RemoveOverlays();
+    }
+}
+
+/* static */
+bool wxPaintProfiler::IsShowingOverlay()
+{
+    return GetData().showOverlay;
+}
+
+/* static */
+bool wxPaintProfiler::ProcessPaintEvent(const wxWindowBase* win, wxEvent& event)
+{
+    // This is only called with the non-const pointer to the window for which
+    // we need to call non-const methods.
+    wxWindow* const window = const_cast<wxWindow*>(static_cast<const wxWindow*>(win));
+
+    // Compute everything we need before painting, as the window could be
+    // destroyed by the paint handler (even though this is not supposed to
+    // happen).
+    const wxRegion& updateRegion = win->GetUpdateRegion();
+
+    wxLongLong_t updateArea = 0;
+    for ( wxRegionIterator it(updateRegion); it; ++it )
+        updateArea += static_cast<wxLongLong_t>(it.GetW()) * it.GetH();
+
+    const wxSize clientSize = win->GetClientSize();
+    const wxLongLong_t windowArea = static_cast<wxLongLong_t>(clientSize.x) * clientSize.y;
+
+    PaintData& data = GetData();
+
+    WindowData& wd = data.windows[win];
+    if ( !wd.stats.window )
+    {
+        wd.stats.window = window;
+        wd.stats.className = win->GetClassInfo()->GetClassName();
+        wd.stats.name = win->GetName();
+    }
+
+    wd.lastUpdateRect = updateRegion.GetBox();
+
+    // The overlay must be reset when the window is repainted.
+    if ( wd.overlay )
+        wd.overlay->Reset();
+
+    const unsigned long primitivesBefore = ms_primitiveCount;
+    const wxLongLong_t start = wxEventProfiler::GetTime();
+
+    const bool processed = win->GetEventHandler()->SafelyProcessEvent(event);
+
+    const wxLongLong_t duration = wxEventProfiler::GetTime() - start;
+    const unsigned long primitives = ms_primitiveCount - primitivesBefore;
+
+    // Look up the window again as it could have been destroyed by the
+    // handler, invalidating wd.
+    const auto it = data.windows.find(win);
+    if ( it == data.windows.end() )
+        return processed;
+
+    WindowData& wdAfter = it->second;
+    WindowStats& stats = wdAfter.stats;
+
+    stats.paintCount++;
+    stats.totalTime += duration;
+    stats.lastTime = duration;
+    if ( duration > stats.maxTime )
+        stats.maxTime = duration;
+
+    stats.updateArea += updateArea;
+    stats.windowArea += windowArea;
+    if ( updateArea >= windowArea )
+        stats.fullPaintCount++;
+
+    stats.primitiveCount += primitives;
+    wdAfter.lastPrimitiveCount = primitives;
+
+    if ( data.showOverlay )
+        window->CallAfter([window]() { DrawOverlay(window); });
+
+    return processed;
+}
+
+/* static */
+void wxPaintProfiler::OnWindowDestroyed(const wxWindowBase* win)
+{
+    PaintData& data = GetData();
+
+    const auto it = data.windows.find(win);
+    if ( it == data.windows.end() )
+        return;
+
+    WindowStats& stats = it->second.stats;
+    stats.window = nullptr;
+    data.destroyed.push_back(stats);
+
+    data.windows.erase(it);
+}
@@ -26,11 +26,124 @@
 
 #include "wx/persist.h"
 
+#include <limits.h>
+
+#include <vector>
+
 namespace
 {
 
 wxPersistenceManager* gs_manager = nullptr;
 
+// Functions converting the values to and from their representation in the
+// config, which is the same one as used by wxConfig itself.
+inline wxString ValueToString(bool value)
+{
+    return value ? wxString("1") : wxString("0");
+}
+
+inline wxString ValueToString(int value)
+{
+    return wxString::Format("%d", value);
+}
+
+inline wxString ValueToString(long value)
+{
+    return wxString::Format("%ld", value);
+}
+
+inline wxString ValueToString(const wxString& value)
+{
+    return value;
+}
+
+bool ValueFromString(const wxString& str, long *value)
+{
+    return str.ToLong(value);
+}
+
+bool ValueFromString(const wxString& str, int *value)
+{
+    long l;
+    if ( !str.ToLong(&l) || l < INT_MIN || l > INT_MAX )
+        return false;
+
+    *value = static_cast<int>(l);
+    return true;
+}
+
+bool ValueFromString(const wxString& str, bool *value)
+{
+    long l;
+    if ( !str.ToLong(&l) )
+        return false;
+
+    *value = l != 0;
+    return true;
+}
+
+bool ValueFromString(const wxString& str, wxString *value)
+{
+    *value = str;
+    return true;
+}
+
+// Read all the entries in the current group of the config and its subgroups,
+// recursively, prefixing their names with the given string.
+void
+ReadAllEntries(wxConfigBase& conf,
+               const wxString& prefix,
+               std::unordered_map<wxString, wxString>& values)
+{
+    // Don't modify the config while enumerating its entries.
+    std::vector<wxString> names;
+    wxString name;
+    long index;
+    for ( bool cont = conf.GetFirstEntry(name, index);
+          cont;
+          cont = conf.GetNextEntry(name, index) )
+    {
+        names.push_back(name);
+    }
+
+    for ( const auto& entry : names )
+    {
+        // Integer values must be read as such, as they can't be read as
+        // strings with all config implementations (e.g. wxRegConfig).
+        wxString value;
+        if ( conf.GetEntryType(entry) == wxConfigBase::Type_Integer )
+        {
+            long l;
+            if ( !conf.Read(entry, &l) )
+                continue;
+
+            value = ValueToString(l);
+        }
+        else if ( !conf.Read(entry, &value) )
+        {
+            continue;
+        }
+
+        values[prefix + entry] = value;
+    }
+
+    names.clear();
+    for ( bool cont = conf.GetFirstGroup(name, index);
+          cont;
+          cont = conf.GetNextGroup(name, index) )
+    {
+        names.push_back(name);
+    }
+
+    for ( const auto& group : names )
+    {
+        const wxString path = group + wxCONFIG_PATH_SEPARATOR;
+
+        wxConfigPathChanger change(&conf, path);
+        ReadAllEntries(conf, prefix + path, values);
+    }
+}
+
 } // anonymous namespace
 
 // ============================================================================
@@ -98,10 +211,26 @@ wxPersistenceManager::Register(void *obj, wxPersistentObject *po)
 
 void wxPersistenceManager::Unregister(void *obj)
 {
-    if ( !m_persistentObjects.erase(obj) )
+    const auto it = m_persistentObjects.find(obj);
+    if ( it == m_persistentObjects.end() )
     {
         wxFAIL_MSG( "unregistering object which is not registered" );
+        return;
     }
+
+    m_knownValues.erase(it->second.get());
+    m_persistentObjects.erase(it);
+}
+
+wxPersistenceManager::KnownValues *
+wxPersistenceManager::GetKnownValues(const wxPersistentObject& who)
+{
+    // Don't keep the values of the objects which are not registered, as we
+    // wouldn't know when to forget them.
+    if ( Find(who.GetObject()) != &who )
+        return nullptr;
+
+    return &m_knownValues[&who];
 }
 
 void wxPersistenceManager::Save(void *obj)
@@ -123,41 +252,124 @@ bool wxPersistenceManager::Restore(void *obj)
     const auto it = m_persistentObjects.find(obj);
     wxCHECK_MSG( it != m_persistentObjects.end(), false, "not registered" );
 
+    LoadValues(obj);
+
     return it->second->Restore();
 }
 
-namespace
+bool wxPersistenceManager::LoadValues(void *obj)
 {
+    const auto it = m_persistentObjects.find(obj);
+    wxCHECK_MSG( it != m_persistentObjects.end(), false, "not registered" );
+
+    KnownValues& known = m_knownValues[it->second.get()];
+    if ( known.loaded )
+        return true;
+
+    wxConfigBase* const conf = GetConfig();
+    if ( !conf )
+        return false;
+
+    // We can only read all the settings at once if they're stored in the same
+    // group, which is the case by default, but might not be if GetKey() is
+    // overridden.
+    const wxString group = GetKey(*it->second, wxString());
+    if ( group.empty() || group.Last() != wxCONFIG_PATH_SEPARATOR )
+        return false;
+
+    known.group = group;
+    known.loaded = true;
+
+    // Note that the values already known are the ones we had written, so they
+    // can't be different from those stored in the config and it's fine to
+    // overwrite them.
+    if ( conf->HasGroup(group.substr(0, group.length() - 1)) )
+    {
+        wxConfigPathChanger change(conf, group);
+        ReadAllEntries(*conf, group, known.values);
+    }
+
+    return true;
+}
 
 template <typename T>
-inline bool
-DoSaveValue(wxConfigBase *conf, const wxString& key, T value)
+bool
+wxPersistenceManager::DoSaveValue(const wxPersistentObject& who,
+                                  const wxString& name,
+                                  T value)
 {
-    return conf && conf->Write(key, value);
+    wxConfigBase* const conf = GetConfig();
+    if ( !conf )
+        return false;
+
+    const wxString key = GetKey(who, name);
+
+    KnownValues* const known = GetKnownValues(who);
+    if ( known )
+    {
+        const wxString str = ValueToString(value);
+
+        const auto it = known->values.find(key);
+        if ( it != known->values.end() && it->second == str )
+            return true;
+
+        if ( !conf->Write(key, value) )
+            return false;
+
+        known->values[key] = str;
+        return true;
+    }
+
+    return conf->Write(key, value);
 }
 
 template <typename T>
 bool
-DoRestoreValue(wxConfigBase *conf, const wxString& key, T *value)
+wxPersistenceManager::DoRestoreValue(const wxPersistentObject& who,
+                                     const wxString& name,
+                                     T *value)
 {
-    return conf && conf->Read(key, value);
-}
+    wxConfigBase* const conf = GetConfig();
+    if ( !conf )
+        return false;
 
-} // anonymous namespace
+    const wxString key = GetKey(who, name);
+
+    KnownValues* const known = GetKnownValues(who);
+    if ( known )
+    {
+        const auto it = known->values.find(key);
+        if ( it != known->values.end() )
+            return ValueFromString(it->second, value);
+
+        // If all the values in this group were loaded, this one just doesn't
+        // exist, there is no need to check for it in the config.
+        if ( known->loaded && key.StartsWith(known->group) )
+            return false;
+    }
+
+    if ( !conf->Read(key, value) )
+        return false;
+
+    if ( known )
+        known->values[key] = ValueToString(*value);
+
+    return true;
+}
 
 #define wxPERSIST_DEFINE_SAVE_RESTORE_FOR(Type)                               \
     bool wxPersistenceManager::SaveValue(const wxPersistentObject& who,       \
                                          const wxString& name,                \
                                          Type value)                          \
     {                                                                         \
-        return DoSaveValue(GetConfig(), GetKey(who, name), value);            \
+        return DoSaveValue(who, name, value);                                 \
     }                                                                         \
                                                                               \
     bool wxPersistenceManager::RestoreValue(const wxPersistentObject& who,    \
                                             const wxString& name,             \
                                             Type *value)                      \
     {                                                                         \
-        return DoRestoreValue(GetConfig(), GetKey(who, name), value);         \
+        return DoRestoreValue(who, name, value);                              \
     }
 
 wxPERSIST_DEFINE_SAVE_RESTORE_FOR(bool)
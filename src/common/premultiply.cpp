@@ -0,0 +1,169 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        src/common/premultiply.cpp
+// Purpose:     Conversions of pixels to and from premultiplied alpha
+// Author:      wxWidgets team
+// Created:     2026-10-14
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+// for compilers that support precompilation, includes "wx.h".
+#include "wx/wxprec.h"
+
+#include "wx/private/premultiply.h"
+#include "wx/private/simd.h"
+
+// The results of the functions here are the same as those of GDK functions
+// doing the same thing, whether SIMD instructions are used or not.
+
+// SIMD versions of the functions processing the pixels as bytes assume that
+// the alpha channel is the last byte of the pixel in memory.
+#if defined(wxHAS_NEON) && !defined(WORDS_BIGENDIAN)
+    #define wxHAS_NEON_LE
+#endif
+
+// ============================================================================
+// implementation
+// ============================================================================
+
+void wxUnpremultiplyPixels(const wxUint32* src, unsigned char* dst, int count)
+{
+    int i = 0;
+
+    // Note that the SIMD versions of this function rely on the division of
+    // the integer values, which are exactly representable as floats, giving
+    // the correctly rounded result and so being always the same as the
+    // integer division done by the scalar version.
+#if defined(wxHAS_SSE2)
+    const __m128i mask = _mm_set1_epi32(0xff);
+    const __m128 one = _mm_set1_ps(1);
+    for ( ; i + 4 <= count; i += 4, dst += 16 )
+    {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        const __m128i a = _mm_srli_epi32(v, 24);
+        const __m128i half = _mm_srli_epi32(a, 1);
+
+        // Avoid dividing by 0: colour components are 0 if alpha is, anyhow.
+        const __m128 af = _mm_max_ps(_mm_cvtepi32_ps(a), one);
+
+        __m128i res = _mm_slli_epi32(a, 24);
+        for ( int n = 0; n < 3; n++ )
+        {
+            // All values fit into 16 bits, so the 16 bit min is fine here.
+            __m128i c = _mm_and_si128(_mm_srli_epi32(v, 16 - 8*n), mask);
+            c = _mm_min_epi16(c, a);
+            c = _mm_add_epi32(_mm_sub_epi32(_mm_slli_epi32(c, 8), c), half);
+            c = _mm_cvttps_epi32(_mm_div_ps(_mm_cvtepi32_ps(c), af));
+            res = _mm_or_si128(res, _mm_slli_epi32(c, 8*n));
+        }
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), res);
+    }
+#elif defined(wxHAS_NEON_LE)
+    const uint32x4_t mask = vdupq_n_u32(0xff);
+    const float32x4_t one = vdupq_n_f32(1);
+    for ( ; i + 4 <= count; i += 4, dst += 16 )
+    {
+        const uint32x4_t v = vld1q_u32(src + i);
+        const uint32x4_t a = vshrq_n_u32(v, 24);
+        const uint32x4_t half = vshrq_n_u32(a, 1);
+        const float32x4_t af = vmaxq_f32(vcvtq_f32_u32(a), one);
+
+        const uint32x4_t r = vandq_u32(vshrq_n_u32(v, 16), mask);
+        const uint32x4_t g = vandq_u32(vshrq_n_u32(v, 8), mask);
+        const uint32x4_t b = vandq_u32(v, mask);
+
+        uint32x4_t c[3] = { r, g, b };
+        for ( int n = 0; n < 3; n++ )
+        {
+            c[n] = vminq_u32(c[n], a);
+            c[n] = vaddq_u32(vmulq_n_u32(c[n], 0xff), half);
+            c[n] = vcvtq_u32_f32(vdivq_f32(vcvtq_f32_u32(c[n]), af));
+        }
+
+        uint32x4_t res = vshlq_n_u32(a, 24);
+        res = vorrq_u32(res, c[0]);
+        res = vorrq_u32(res, vshlq_n_u32(c[1], 8));
+        res = vorrq_u32(res, vshlq_n_u32(c[2], 16));
+
+        vst1q_u8(dst, vreinterpretq_u8_u32(res));
+    }
+#endif // SIMD
+
+    for ( ; i < count; i++, dst += 4 )
+    {
+        const wxUint32 v = src[i];
+        const wxUint32 a = v >> 24;
+        for ( int n = 0; n < 3; n++ )
+        {
+            wxUint32 c = (v >> (16 - 8*n)) & 0xff;
+            if ( c > a )
+                c = a;
+            dst[n] = a ? static_cast<unsigned char>((c*0xff + a/2) / a) : 0;
+        }
+        dst[3] = static_cast<unsigned char>(a);
+    }
+}
+
+void wxPremultiplyPixels(wxUint32* p, int count)
+{
+    int i = 0;
+
+    // All versions compute c*a/255 with rounding as ((t >> 8) + t) >> 8 where
+    // t = c*a + 0x80, just as GDK does.
+#if defined(wxHAS_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i round = _mm_set1_epi16(0x80);
+    // Alpha channel itself is multiplied by 0xff, i.e. preserved.
+    const __m128i alphaLanes = _mm_set_epi16(0xff, 0, 0, 0, 0xff, 0, 0, 0);
+
+    const auto multiply = [&](__m128i x)
+    {
+        __m128i a = _mm_shufflelo_epi16(x, _MM_SHUFFLE(3, 3, 3, 3));
+        a = _mm_shufflehi_epi16(a, _MM_SHUFFLE(3, 3, 3, 3));
+        a = _mm_or_si128(a, alphaLanes);
+
+        const __m128i t = _mm_add_epi16(_mm_mullo_epi16(x, a), round);
+        return _mm_srli_epi16(_mm_add_epi16(_mm_srli_epi16(t, 8), t), 8);
+    };
+
+    for ( ; i + 4 <= count; i += 4 )
+    {
+        __m128i* const pv = reinterpret_cast<__m128i*>(p + i);
+        const __m128i v = _mm_loadu_si128(pv);
+        const __m128i lo = multiply(_mm_unpacklo_epi8(v, zero));
+        const __m128i hi = multiply(_mm_unpackhi_epi8(v, zero));
+        _mm_storeu_si128(pv, _mm_packus_epi16(lo, hi));
+    }
+#elif defined(wxHAS_NEON_LE)
+    for ( ; i + 8 <= count; i += 8 )
+    {
+        uint8_t* const pv = reinterpret_cast<uint8_t*>(p + i);
+        uint8x8x4_t v = vld4_u8(pv);
+        for ( int n = 0; n < 3; n++ )
+        {
+            // This computes (t + ((t + 0x80) >> 8) + 0x80) >> 8 for t = c*a,
+            // which is the same as the formula above.
+            const uint16x8_t t = vmull_u8(v.val[n], v.val[3]);
+            v.val[n] = vraddhn_u16(t, vrshrq_n_u16(t, 8));
+        }
+        vst4_u8(pv, v);
+    }
+#endif // SIMD
+
+    for ( ; i < count; i++ )
+    {
+        const wxUint32 v = p[i];
+        const wxUint32 a = v >> 24;
+        if (a == 0xff)
+            continue;
+
+        wxUint32 res = a << 24;
+        for ( int n = 0; n < 3; n++ )
+        {
+            const wxUint32 t = ((v >> 8*n) & 0xff)*a + 0x80;
+            res |= (((t >> 8) + t) >> 8) << 8*n;
+        }
+        p[i] = res;
+    }
+}
@@ -1902,10 +1902,36 @@ bool wxPrintPreviewBase::SetCurrentPage(int pageNum)
     if (m_currentPage == pageNum)
         return true;
 
+    // Keep the page we're leaving as the user is likely to return to it.
+    if (m_previewBitmap)
+        m_pageBitmaps[m_currentPage] = *m_previewBitmap;
+
     m_currentPage = pageNum;
 
     InvalidatePreviewBitmap();
 
+    // Only keep the pages close to the current one to limit memory usage.
+    for ( auto it = m_pageBitmaps.begin(); it != m_pageBitmaps.end(); )
+    {
+        if ( abs(it->first - m_currentPage) > 2 )
+            it = m_pageBitmaps.erase(it);
+        else
+            ++it;
+    }
+
+    // And use the bitmap of the new page if we had already rendered it.
+    const auto it = m_pageBitmaps.find(m_currentPage);
+    if ( it != m_pageBitmaps.end() )
+    {
+        if ( it->second.IsOk() )
+        {
+            m_previewBitmap = new wxBitmap(it->second);
+            UpdateStatusText(m_currentPage);
+        }
+
+        m_pageBitmaps.erase(it);
+    }
+
     if (m_previewCanvas)
     {
         AdjustScrollbars(m_previewCanvas);
@@ -1977,7 +2003,10 @@ void wxPrintPreviewBase::InvalidatePreviewBitmap()
 bool wxPrintPreviewBase::UpdatePageRendering()
 {
     if ( m_previewBitmap )
+    {
+        RenderAdjacentPage();
         return false;
+    }
 
     if ( m_previewFailed )
         return false;
@@ -1991,6 +2020,40 @@ bool wxPrintPreviewBase::UpdatePageRendering()
     return true;
 }
 
+void wxPrintPreviewBase::RenderAdjacentPage()
+{
+    // We can't render anything before the printout was prepared when
+    // rendering the current page.
+    if ( !m_previewCanvas || !m_printingPrepared || m_previewFailed )
+        return;
+
+    for ( int pageNum : { m_currentPage + 1, m_currentPage - 1 } )
+    {
+        if ( pageNum < m_minPage || pageNum > m_maxPage )
+            continue;
+
+        if ( m_pageBitmaps.count(pageNum) ||
+                !m_previewPrintout->HasPage(pageNum) )
+            continue;
+
+        wxRect pageRect, paperRect;
+        CalcRects(m_previewCanvas, pageRect, paperRect);
+
+        // Remember the failure to render a page as an invalid bitmap to avoid
+        // trying to do it again, as it will be rendered, with the appropriate
+        // error reporting, by RenderPage() if the user switches to it anyhow.
+        wxBitmap& bmp = m_pageBitmaps[pageNum];
+        bmp.Create(pageRect.width, pageRect.height);
+        if ( !bmp.IsOk() || !RenderPageIntoBitmap(bmp, pageNum) )
+            bmp = wxNullBitmap;
+
+        // Render just one page at a time to avoid blocking the UI for too
+        // long, but make sure we get another idle event to continue.
+        wxWakeUpIdle();
+        return;
+    }
+}
+
 bool wxPrintPreviewBase::PaintPage(wxPreviewCanvas *canvas, wxDC& dc)
 {
     DrawBlankPage(canvas, dc);
@@ -2112,6 +2175,13 @@ bool wxPrintPreviewBase::RenderPage(int pageNum)
         return false;
     }
 
+    UpdateStatusText(pageNum);
+
+    return true;
+}
+
+void wxPrintPreviewBase::UpdateStatusText(int pageNum)
+{
 #if wxUSE_STATUSBAR
     wxString status;
     if (m_maxPage != 0)
@@ -2121,9 +2191,9 @@ bool wxPrintPreviewBase::RenderPage(int pageNum)
 
     if (m_previewFrame)
         m_previewFrame->SetStatusText(status);
+#else
+    wxUnusedVar(pageNum);
 #endif
-
-    return true;
 }
 
 bool wxPrintPreviewBase::DrawBlankPage(wxPreviewCanvas *canvas, wxDC& dc)
@@ -2160,6 +2230,7 @@ void wxPrintPreviewBase::SetZoom(int percent)
     m_currentZoom = percent;
 
     InvalidatePreviewBitmap();
+    m_pageBitmaps.clear();
 
     if (m_previewCanvas)
     {
@@ -22,14 +22,18 @@
 
 #include "wx/process.h"
 
+#include "wx/private/processoutput.h"
+
 // ----------------------------------------------------------------------------
 // event tables and such
 // ----------------------------------------------------------------------------
 
 wxDEFINE_EVENT( wxEVT_END_PROCESS, wxProcessEvent );
+wxDEFINE_EVENT( wxEVT_PROCESS_OUTPUT, wxProcessOutputEvent );
 
 wxIMPLEMENT_DYNAMIC_CLASS(wxProcess, wxEvtHandler);
 wxIMPLEMENT_DYNAMIC_CLASS(wxProcessEvent, wxEvent);
+wxIMPLEMENT_DYNAMIC_CLASS(wxProcessOutputEvent, wxEvent);
 
 // ============================================================================
 // wxProcess implementation
@@ -49,6 +53,10 @@ void wxProcess::Init(wxEvtHandler *parent, int id, int flags)
     m_priority   = wxPRIORITY_DEFAULT;
     m_redirect   = (flags & wxPROCESS_REDIRECT) != 0;
 
+    m_outputChunkSize = 0;
+    m_outputReader = nullptr;
+    m_outputSuspended = false;
+
 #if wxUSE_STREAMS
     m_inputStream  = nullptr;
     m_errorStream  = nullptr;
@@ -140,6 +148,53 @@ bool wxProcess::IsErrorAvailable() const
 
 #endif // wxUSE_STREAMS
 
+// ----------------------------------------------------------------------------
+// output events support
+// ----------------------------------------------------------------------------
+
+void wxProcess::OnOutput(const wxMemoryBuffer& data, bool isError)
+{
+    wxProcessOutputEvent event(m_id, m_pid, data, isError);
+    ProcessEvent(event);
+}
+
+void wxProcess::SetOutputReader(wxProcessOutputReader* reader)
+{
+    m_outputReader = reader;
+
+    // Apply the previous SuspendOutput() call, if any, to the new reader.
+    if ( m_outputReader && m_outputSuspended )
+        m_outputReader->Suspend();
+}
+
+void wxProcess::SuspendOutput()
+{
+    wxCHECK_RET( IsOutputEventsEnabled(),
+                 wxS("Output events must be enabled to suspend output") );
+
+    if ( m_outputSuspended )
+        return;
+
+    m_outputSuspended = true;
+
+    if ( m_outputReader )
+        m_outputReader->Suspend();
+}
+
+void wxProcess::ResumeOutput()
+{
+    wxCHECK_RET( IsOutputEventsEnabled(),
+                 wxS("Output events must be enabled to resume output") );
+
+    if ( !m_outputSuspended )
+        return;
+
+    m_outputSuspended = false;
+
+    if ( m_outputReader )
+        m_outputReader->Resume();
+}
+
 // ----------------------------------------------------------------------------
 // process killing
 // ----------------------------------------------------------------------------
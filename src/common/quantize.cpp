@@ -38,15 +38,25 @@
 #ifndef WX_PRECOMP
     #include "wx/palette.h"
     #include "wx/image.h"
+    #include "wx/utils.h"
 #endif
 
 #ifdef __WXMSW__
     #include "wx/msw/private.h"
 #endif
 
+#if wxUSE_THREADS
+    #include "wx/thread.h"
+#endif
+
+#include "wx/private/parallel.h"
+
 #include <stdlib.h>
 #include <string.h>
 
+#include <algorithm>
+#include <vector>
+
 namespace
 {
 
@@ -990,7 +1000,6 @@ fill_inverse_cmap (j_decompress_ptr cinfo, int c0, int c1, int c2)
  * Map some rows of pixels to the output colormapped representation.
  */
 
-#if 0
 void
 pass2_no_dither (j_decompress_ptr cinfo,
          JSAMPARRAY input_buf, JSAMPARRAY output_buf, int num_rows)
@@ -1023,12 +1032,11 @@ pass2_no_dither (j_decompress_ptr cinfo,
     }
   }
 }
-#endif
 
 void
-pass2_fs_dither (j_decompress_ptr cinfo,
+fs_dither_rows (j_decompress_ptr cinfo, FSERRPTR fserrors, bool& on_odd_row,
          JSAMPARRAY input_buf, JSAMPARRAY output_buf, int num_rows)
-/* This version performs Floyd-Steinberg dithering */
+/* Floyd-Steinberg dithering using the given error array and row parity */
 {
   my_cquantize_ptr cquantize = (my_cquantize_ptr) cinfo->cquantize;
   hist3d histogram = cquantize->histogram;
@@ -1054,20 +1062,20 @@ pass2_fs_dither (j_decompress_ptr cinfo,
   for (row = 0; row < num_rows; row++) {
     inptr = input_buf[row];
     outptr = output_buf[row];
-    if (cquantize->on_odd_row) {
+    if (on_odd_row) {
       /* work right to left in this row */
       inptr += (width-1) * 3;   /* so point to rightmost pixel */
       outptr += width-1;
       dir = -1;
       dir3 = -3;
-      errorptr = cquantize->fserrors + (width+1)*3; /* => entry after last column */
-      cquantize->on_odd_row = false; /* flip for next time */
+      errorptr = fserrors + (width+1)*3; /* => entry after last column */
+      on_odd_row = false; /* flip for next time */
     } else {
       /* work left to right in this row */
       dir = 1;
       dir3 = 3;
-      errorptr = cquantize->fserrors; /* => entry before first real column */
-      cquantize->on_odd_row = true; /* flip for next time */
+      errorptr = fserrors; /* => entry before first real column */
+      on_odd_row = true; /* flip for next time */
     }
     /* Preset error values: no error propagated to first pixel from left */
     cur0 = cur1 = cur2 = 0;
@@ -1187,6 +1195,17 @@ pass2_fs_dither (j_decompress_ptr cinfo,
   }
 }
 
+void
+pass2_fs_dither (j_decompress_ptr cinfo,
+         JSAMPARRAY input_buf, JSAMPARRAY output_buf, int num_rows)
+/* This version performs Floyd-Steinberg dithering */
+{
+  my_cquantize_ptr cquantize = (my_cquantize_ptr) cinfo->cquantize;
+
+  fs_dither_rows(cinfo, cquantize->fserrors, cquantize->on_odd_row,
+         input_buf, output_buf, num_rows);
+}
+
 /*
  * Initialize the error-limiting transfer function (lookup table).
  * The raw F-S error computation can potentially compute error values of up to
@@ -1408,6 +1427,79 @@ prepare_range_limit_table (j_decompress_ptr cinfo)
       cinfo->sample_range_limit, CENTERJSAMPLE * sizeof(JSAMPLE));
 }
 
+
+/*
+ * Fill the entire inverse colormap at once.  This is needed before mapping
+ * the pixels using multiple threads, as the inverse colormap can't be filled
+ * on demand when it is shared between them, and is cheap enough to do, as it
+ * takes only a tiny fraction of the time needed to map a big image.
+ */
+
+void
+fill_entire_inverse_cmap (j_decompress_ptr cinfo)
+{
+  my_cquantize_ptr cquantize = (my_cquantize_ptr) cinfo->cquantize;
+  hist3d histogram = cquantize->histogram;
+  int c0, c1, c2;
+
+  for (c0 = 0; c0 < HIST_C0_ELEMS; c0 += BOX_C0_ELEMS) {
+    for (c1 = 0; c1 < HIST_C1_ELEMS; c1 += BOX_C1_ELEMS) {
+      for (c2 = 0; c2 < HIST_C2_ELEMS; c2 += BOX_C2_ELEMS) {
+        if (histogram[c0][c1][c2] == 0)
+          fill_inverse_cmap(cinfo, c0, c1, c2);
+      }
+    }
+  }
+}
+
+
+/*
+ * Number of rows dithered independently of the other ones when performing
+ * Floyd-Steinberg dithering using multiple threads.  Using bands of fixed
+ * size, rather than one band per thread, ensures that the result doesn't
+ * depend on the number of threads used.
+ */
+
+#define FS_BAND_ROWS  64
+
+void
+pass2_parallel (j_decompress_ptr cinfo,
+         JSAMPARRAY input_buf, JSAMPARRAY output_buf, int num_rows,
+         bool dither, int num_threads)
+/* Map the rows using the given number of threads, with or without dithering */
+{
+  fill_entire_inverse_cmap(cinfo);
+
+  if (!dither) {
+    wxParallelFor(num_rows, num_threads,
+      [=](int start, int end) {
+        pass2_no_dither(cinfo, input_buf + start, output_buf + start,
+                        end - start);
+      });
+    return;
+  }
+
+  const int num_bands = (num_rows + FS_BAND_ROWS - 1) / FS_BAND_ROWS;
+  const size_t arraysize = (size_t) (cinfo->output_width + 2) * 3;
+
+  wxParallelFor(num_bands, num_threads,
+    [=](int start, int end) {
+      std::vector<FSERROR> fserrors(arraysize);
+
+      for (int band = start; band < end; band++) {
+        const int row = band * FS_BAND_ROWS;
+
+        /* Each band starts without errors propagated from the previous one */
+        std::fill(fserrors.begin(), fserrors.end(), 0);
+        bool on_odd_row = false;
+
+        fs_dither_rows(cinfo, &fserrors[0], on_odd_row,
+                       input_buf + row, output_buf + row,
+                       wxMin(FS_BAND_ROWS, num_rows - row));
+      }
+    });
+}
+
 } // anonymous namespace
 
 
@@ -1418,7 +1510,7 @@ prepare_range_limit_table (j_decompress_ptr cinfo)
 wxIMPLEMENT_DYNAMIC_CLASS(wxQuantize, wxObject);
 
 void wxQuantize::DoQuantize(unsigned w, unsigned h, unsigned char **in_rows, unsigned char **out_rows,
-    unsigned char *palette, int desiredNoColours)
+    unsigned char *palette, int desiredNoColours, int flags)
 {
     j_decompress dec;
     my_cquantize_ptr cquantize;
@@ -1436,7 +1528,25 @@ void wxQuantize::DoQuantize(unsigned w, unsigned h, unsigned char **in_rows, uns
     cquantize->pub.finish_pass(&dec);
 
     cquantize->pub.start_pass(&dec, false);
-    cquantize->pub.color_quantize(&dec, in_rows, out_rows, h);
+    if ( flags & (wxQUANTIZE_NO_DITHER | wxQUANTIZE_MULTITHREADED) )
+    {
+        int numThreads = 1;
+        if ( flags & wxQUANTIZE_MULTITHREADED )
+        {
+            numThreads = wxImage::GetDefaultThreadCount();
+#if wxUSE_THREADS
+            if ( numThreads == 0 )
+                numThreads = wxThread::GetCPUCount();
+#endif // wxUSE_THREADS
+        }
+
+        pass2_parallel(&dec, in_rows, out_rows, h,
+                       !(flags & wxQUANTIZE_NO_DITHER), numThreads);
+    }
+    else
+    {
+        cquantize->pub.color_quantize(&dec, in_rows, out_rows, h);
+    }
     cquantize->pub.finish_pass(&dec);
 
 
@@ -1505,7 +1615,7 @@ bool wxQuantize::Quantize(const wxImage& src, wxImage& dest,
         outrows[i] = data8bit + w * i;
 
     //RGB->palette
-    DoQuantize(w, h, rows, outrows, palette, desiredNoColours);
+    DoQuantize(w, h, rows, outrows, palette, desiredNoColours, flags);
 
     delete[] rows;
     delete[] outrows;
@@ -31,6 +31,12 @@
     #include "wx/crt.h"
 #endif //WX_PRECOMP
 
+#if wxUSE_STREAMS
+    #include "wx/stream.h"
+#endif // wxUSE_STREAMS
+
+#include <vector>
+
 // At least FreeBSD requires this.
 #if defined(__UNIX__)
 #   include <sys/types.h>
@@ -89,6 +95,9 @@ namespace
 #define REG_NOTEOL    0x0008    // Same as PCRE2_NOTEOL.
 #define REG_NOSUB     0x0020    // Don't return matches.
 #define REG_NOTEMPTY  0x0100    // Same as PCRE2_NOTEMPTY.
+#define REG_JIT       0x0200    // Use pcre2_jit_compile() (non-standard).
+#define REG_NOUTFCHECK 0x0400   // Same as PCRE2_NO_UTF_CHECK (non-standard).
+#define REG_NOTEMPTY_ATSTART 0x0800 // Same as PCRE2_NOTEMPTY_ATSTART (ditto).
 
 enum
 {
@@ -159,14 +168,23 @@ int wx_regcomp(regex_t* preg, const wxRegChar* pattern, int cflags)
         return REG_BADPAT;
     }
 
+    // JIT compilation may fail, e.g. if it's not supported by the library or
+    // the current platform, but this is not an error, pcre2_match() will just
+    // use the interpreter then.
+    if ( cflags & REG_JIT )
+        pcre2_jit_compile(preg->code, PCRE2_JIT_COMPLETE);
+
     preg->match_data = pcre2_match_data_create_from_pattern(preg->code, nullptr);
 
     return REG_NOERROR;
 }
 
+// Non-standard offset parameter is the position in the string at which to
+// start matching, unlike when passing string + offset, the text before it is
+// still taken into account by the assertions such as "^" and "\b".
 int
 wx_regexec(const regex_t* preg, const wxRegChar* string, size_t len,
-           size_t nmatch, regmatch_t* pmatch, int eflags)
+           size_t nmatch, regmatch_t* pmatch, int eflags, size_t offset = 0)
 {
     int options = 0;
 
@@ -176,17 +194,37 @@ wx_regexec(const regex_t* preg, const wxRegChar* string, size_t len,
         options |= PCRE2_NOTEOL;
     if ( eflags & REG_NOTEMPTY )
         options |= PCRE2_NOTEMPTY;
-
-    const int rc = pcre2_match
-                   (
-                        preg->code,
-                        (PCRE2_SPTR)string,
-                        len,
-                        0,                      // start offset
-                        options,
-                        preg->match_data,
-                        nullptr                    // use default context
-                   );
+    if ( eflags & REG_NOUTFCHECK )
+        options |= PCRE2_NO_UTF_CHECK;
+    if ( eflags & REG_NOTEMPTY_ATSTART )
+        options |= PCRE2_NOTEMPTY_ATSTART;
+
+    int rc = pcre2_match
+             (
+                preg->code,
+                (PCRE2_SPTR)string,
+                len,
+                offset,
+                options,
+                preg->match_data,
+                nullptr                 // use default context
+             );
+
+    // JIT code uses a fixed size stack which may be too small for some
+    // expressions, fall back to the interpreter in this case.
+    if ( rc == PCRE2_ERROR_JIT_STACKLIMIT )
+    {
+        rc = pcre2_match
+             (
+                preg->code,
+                (PCRE2_SPTR)string,
+                len,
+                offset,
+                options | PCRE2_NO_JIT,
+                preg->match_data,
+                nullptr
+             );
+    }
 
     if ( rc == PCRE2_ERROR_NOMATCH )
         return REG_NOMATCH;
@@ -296,13 +334,33 @@ public:
 
     // RE operations
     bool Compile(wxString expr, int flags = 0);
-    bool Matches(const wxRegChar *str, int flags, size_t len) const;
+    //
+    // checkUTF can be set to false if the string is known to be valid, e.g.
+    // because it's a part of a string previously passed to this function
+    bool Matches(const wxRegChar *str, int flags, size_t len,
+                 bool checkUTF = true) const;
     bool GetMatch(size_t *start, size_t *len, size_t index = 0) const;
     size_t GetMatchCount() const;
     int Replace(wxString *pattern, const wxString& replacement,
                 size_t maxMatches = 0) const;
 
+    size_t ForEachMatch(const wxRegChar *str, size_t len,
+                        const wxRegEx::MatchFunction& func,
+                        int flags, size_t maxMatches) const;
+#if wxUSE_STREAMS
+    int ReplaceToStream(const wxRegChar *str, size_t len,
+                        const wxString& replacement,
+                        wxOutputStream& out,
+                        size_t maxMatches) const;
+#endif // wxUSE_STREAMS
+
 private:
+    // translate our wxRE_NOTXXX flags to regexec() ones
+    static int GetExecFlags(int flags);
+
+    // allocate m_Matches if it's needed and wasn't done yet
+    void AllocMatchesIfNeeded() const;
+
     // return the string containing the error message for the given err code
     wxString GetErrorMsg(int errorcode) const;
 
@@ -951,7 +1009,7 @@ bool wxRegExImpl::Compile(wxString expr, int flags)
 {
     Reinit();
 
-    wxASSERT_MSG( !(flags & ~(wxRE_ADVANCED | wxRE_BASIC | wxRE_ICASE | wxRE_NOSUB | wxRE_NEWLINE)),
+    wxASSERT_MSG( !(flags & ~(wxRE_ADVANCED | wxRE_BASIC | wxRE_ICASE | wxRE_NOSUB | wxRE_NEWLINE | wxRE_JIT)),
                   wxT("unrecognized flags in wxRegEx::Compile") );
 
     // Deal with the directors and embedded options first (this can modify
@@ -979,6 +1037,8 @@ bool wxRegExImpl::Compile(wxString expr, int flags)
         flagsRE |= REG_NOSUB;
     if ( flags & wxRE_NEWLINE )
         flagsRE |= REG_NEWLINE;
+    if ( flags & wxRE_JIT )
+        flagsRE |= REG_JIT;
 
 #ifndef WXREGEX_CONVERT_TO_MB
     const wxChar *exprstr = expr.c_str();
@@ -1048,33 +1108,21 @@ bool wxRegExImpl::Compile(wxString expr, int flags)
 
 bool wxRegExImpl::Matches(const wxRegChar *str,
                           int flags,
-                          size_t len) const
+                          size_t len,
+                          bool checkUTF) const
 {
     wxCHECK_MSG( IsValid(), false, wxT("must successfully Compile() first") );
 
-    // translate our flags to regexec() ones
-    wxASSERT_MSG( !(flags & ~(wxRE_NOTBOL | wxRE_NOTEOL | wxRE_NOTEMPTY)),
-                  wxT("unrecognized flags in wxRegEx::Matches") );
+    int flagsRE = GetExecFlags(flags);
+    if ( !checkUTF )
+        flagsRE |= REG_NOUTFCHECK;
 
-    int flagsRE = 0;
-    if ( flags & wxRE_NOTBOL )
-        flagsRE |= REG_NOTBOL;
-    if ( flags & wxRE_NOTEOL )
-        flagsRE |= REG_NOTEOL;
-    if ( flags & wxRE_NOTEMPTY )
-        flagsRE |= REG_NOTEMPTY;
-
-    // allocate matches array if needed
-    wxRegExImpl *self = wxConstCast(this, wxRegExImpl);
-    if ( !m_Matches && m_nMatches )
-    {
-        self->m_Matches = new wxRegExMatches(m_nMatches);
-    }
+    AllocMatchesIfNeeded();
 
     wxRegExMatches::match_type matches = m_Matches ? m_Matches->get() : nullptr;
 
     // do match it
-    int rc = wx_regexec(&self->m_RegEx, str, len, m_nMatches, matches, flagsRE);
+    int rc = wx_regexec(&m_RegEx, str, len, m_nMatches, matches, flagsRE);
 
     switch ( rc )
     {
@@ -1094,6 +1142,32 @@ bool wxRegExImpl::Matches(const wxRegChar *str,
     }
 }
 
+/* static */
+int wxRegExImpl::GetExecFlags(int flags)
+{
+    wxASSERT_MSG( !(flags & ~(wxRE_NOTBOL | wxRE_NOTEOL | wxRE_NOTEMPTY)),
+                  wxT("unrecognized flags in wxRegEx::Matches") );
+
+    int flagsRE = 0;
+    if ( flags & wxRE_NOTBOL )
+        flagsRE |= REG_NOTBOL;
+    if ( flags & wxRE_NOTEOL )
+        flagsRE |= REG_NOTEOL;
+    if ( flags & wxRE_NOTEMPTY )
+        flagsRE |= REG_NOTEMPTY;
+
+    return flagsRE;
+}
+
+void wxRegExImpl::AllocMatchesIfNeeded() const
+{
+    if ( !m_Matches && m_nMatches )
+    {
+        wxRegExImpl *self = wxConstCast(this, wxRegExImpl);
+        self->m_Matches = new wxRegExMatches(m_nMatches);
+    }
+}
+
 bool wxRegExImpl::GetMatch(size_t *start, size_t *len, size_t index) const
 {
     wxCHECK_MSG( IsValid(), false, wxT("must successfully Compile() first") );
@@ -1160,10 +1234,16 @@ int wxRegExImpl::Replace(wxString *text,
 
     // note that "^" shouldn't match after the first call to Matches() so we
     // use wxRE_NOTBOL to prevent it from happening
+    //
+    // also don't check the validity of the string again after the first call:
+    // PCRE checks the entire subject every time, which would make the loop
+    // quadratic in the text length, and we always continue at a character
+    // boundary
     while ( (!maxMatches || countRepl < maxMatches) &&
              Matches(textstr + matchStart,
                      countRepl ? wxRE_NOTBOL : 0,
-                     textlen - matchStart) )
+                     textlen - matchStart,
+                     countRepl == 0) )
     {
         // the string possibly contains back references: we need to calculate
         // the replacement text anew after each match
@@ -1248,6 +1328,240 @@ int wxRegExImpl::Replace(wxString *text,
     return countRepl;
 }
 
+size_t wxRegExImpl::ForEachMatch(const wxRegChar *str, size_t len,
+                                 const wxRegEx::MatchFunction& func,
+                                 int flags, size_t maxMatches) const
+{
+    wxCHECK_MSG( IsValid(), 0, wxT("must successfully Compile() first") );
+
+    AllocMatchesIfNeeded();
+
+    // Unlike Matches(), we always need the position of the match, even if
+    // wxRE_NOSUB was used.
+    regmatch_t whole;
+    regmatch_t* const matches = m_Matches ? m_Matches->get() : &whole;
+    const size_t nMatches = m_Matches ? m_nMatches : 1;
+
+    const int flagsRE = GetExecFlags(flags);
+
+    // Continue matching in the same string from the end of the previous match
+    // instead of passing the rest of the string as a new one, this ensures
+    // that the assertions work correctly and that all the offsets are
+    // relative to the start of the string.
+    size_t count = 0;
+    size_t offset = 0;
+    int flagsExtra = 0;
+    while ( !maxMatches || count < maxMatches )
+    {
+        const int rc = wx_regexec(&m_RegEx, str, len, nMatches, matches,
+                                  flagsRE | flagsExtra, offset);
+        if ( rc != REG_NOERROR )
+        {
+            if ( rc != REG_NOMATCH )
+            {
+                wxLogError(_("Failed to find match for regular expression: %s"),
+                           GetErrorMsg(rc));
+            }
+
+            break;
+        }
+
+        count++;
+
+        const size_t start = matches[0].rm_so;
+        const size_t end = matches[0].rm_eo;
+        if ( !func(start, end - start) )
+            break;
+
+        // There is no need to check the string validity more than once and
+        // if the match was empty, don't find the same empty match again.
+        offset = end;
+        flagsExtra = REG_NOUTFCHECK;
+        if ( end == start )
+            flagsExtra |= REG_NOTEMPTY_ATSTART;
+    }
+
+    return count;
+}
+
+#if wxUSE_STREAMS
+
+namespace
+{
+
+// Helper writing parts of the text to the stream in UTF-8.
+class wxRegExStreamWriter
+{
+public:
+    explicit wxRegExStreamWriter(wxOutputStream& out) : m_out(out) { }
+
+    bool Write(const char* s, size_t len)
+    {
+        return !len || m_out.Write(s, len).LastWrite() == len;
+    }
+
+#ifndef WXREGEX_CONVERT_TO_MB
+    bool Write(const wxChar* s, size_t len)
+    {
+        if ( !len )
+            return true;
+
+        const size_t lenUTF8 = wxConvUTF8.FromWChar(nullptr, 0, s, len);
+        if ( lenUTF8 == wxCONV_FAILED )
+            return false;
+
+        // Reuse the same buffer for all the writes, growing it if necessary.
+        if ( m_buf.length() < lenUTF8 )
+            m_buf.extend(lenUTF8);
+
+        wxConvUTF8.FromWChar(m_buf.data(), lenUTF8, s, len);
+
+        return Write(m_buf.data(), lenUTF8);
+    }
+#endif // !WXREGEX_CONVERT_TO_MB
+
+private:
+    wxOutputStream& m_out;
+    wxCharBuffer m_buf;
+
+    wxDECLARE_NO_COPY_CLASS(wxRegExStreamWriter);
+};
+
+} // anonymous namespace
+
+int wxRegExImpl::ReplaceToStream(const wxRegChar *str, size_t len,
+                                 const wxString& replacement,
+                                 wxOutputStream& out,
+                                 size_t maxMatches) const
+{
+    wxCHECK_MSG( IsValid(), wxNOT_FOUND, wxT("must successfully Compile() first") );
+
+    // Parse the replacement once instead of doing it for every match: it is
+    // split in literal parts, already converted to UTF-8, each of which is
+    // followed by a back reference (with the index possibly equal to -1 for
+    // the last part not followed by anything).
+    struct Part
+    {
+        wxCharBuffer literal;
+        size_t index;
+    };
+    std::vector<Part> parts;
+
+    wxString literal;
+    for ( wxString::const_iterator it = replacement.begin(),
+                                   end = replacement.end();
+          ;
+          ++it )
+    {
+        size_t index = (size_t)-1;
+        if ( it != end )
+        {
+            if ( *it == '\\' )
+            {
+                if ( ++it == end )
+                    break;
+
+                if ( wxIsdigit(*it) )
+                {
+                    index = 0;
+                    for ( ; it != end && wxIsdigit(*it); ++it )
+                        index = index*10 + (*it).GetValue() - '0';
+                    --it;
+                }
+                //else: backslash used as escape character
+            }
+            else if ( *it == '&' )
+            {
+                // treat this as "\0" for compatibility with Replace()
+                index = 0;
+            }
+
+            if ( index == (size_t)-1 )
+            {
+                literal += *it;
+                continue;
+            }
+
+            if ( index && index >= m_nMatches )
+            {
+                wxFAIL_MSG( wxT("invalid back reference") );
+
+                // just eat it...
+                continue;
+            }
+        }
+
+        Part part;
+        part.literal = literal.utf8_str();
+        part.index = index;
+        parts.push_back(part);
+
+        literal.clear();
+
+        if ( it == end )
+            break;
+    }
+
+    if ( !literal.empty() )
+    {
+        Part part;
+        part.literal = literal.utf8_str();
+        part.index = (size_t)-1;
+        parts.push_back(part);
+    }
+
+    wxRegExStreamWriter writer(out);
+
+    // The end of the part of the text already written to the stream.
+    size_t written = 0;
+    bool ok = true;
+
+    const size_t count = ForEachMatch
+    (
+        str, len,
+        [&](size_t start, size_t matchLen)
+        {
+            ok = writer.Write(str + written, start - written);
+
+            for ( size_t n = 0; ok && n < parts.size(); n++ )
+            {
+                const Part& part = parts[n];
+                ok = writer.Write(part.literal.data(), part.literal.length());
+
+                if ( !ok || part.index == (size_t)-1 )
+                    continue;
+
+                if ( part.index == 0 )
+                {
+                    // This works even with wxRE_NOSUB.
+                    ok = writer.Write(str + start, matchLen);
+                }
+                else
+                {
+                    // Skip the subexpressions which didn't participate in the
+                    // match.
+                    const regmatch_t& m = m_Matches->get()[part.index];
+                    if ( m.rm_so != static_cast<regoff_t>(-1) )
+                        ok = writer.Write(str + m.rm_so, m.rm_eo - m.rm_so);
+                }
+            }
+
+            written = start + matchLen;
+
+            return ok;
+        },
+        0,
+        maxMatches
+    );
+
+    if ( ok )
+        ok = writer.Write(str + written, len - written);
+
+    return ok ? static_cast<int>(count) : wxNOT_FOUND;
+}
+
+#endif // wxUSE_STREAMS
+
 // ----------------------------------------------------------------------------
 // wxRegEx: all methods are mostly forwarded to wxRegExImpl
 // ----------------------------------------------------------------------------
@@ -1295,6 +1609,18 @@ bool wxRegEx::Matches(const wxString& str, int flags) const
     return m_impl->Matches(textstr, flags, textlen);
 }
 
+bool wxRegEx::Matches(const wxChar *str, int flags, size_t len) const
+{
+    wxCHECK_MSG( IsValid(), false, wxT("must successfully Compile() first") );
+
+#ifndef WXREGEX_CONVERT_TO_MB
+    // Use the text directly, without copying it into a temporary string.
+    return m_impl->Matches(str, flags, len);
+#else
+    return Matches(wxString(str, len), flags);
+#endif
+}
+
 bool wxRegEx::GetMatch(size_t *start, size_t *len, size_t index) const
 {
     wxCHECK_MSG( IsValid(), false, wxT("must successfully Compile() first") );
@@ -1331,6 +1657,75 @@ int wxRegEx::Replace(wxString *pattern,
     return m_impl->Replace(pattern, replacement, maxMatches);
 }
 
+size_t wxRegEx::ForEachMatch(const wxString& text,
+                             const MatchFunction& func,
+                             int flags,
+                             size_t maxMatches) const
+{
+    wxCHECK_MSG( IsValid(), 0, wxT("must successfully Compile() first") );
+
+#ifndef WXREGEX_CONVERT_TO_MB
+    const wxChar* const textstr = text.c_str();
+    const size_t textlen = text.length();
+#else
+    const wxScopedCharBuffer textstr = text.utf8_str();
+    const size_t textlen = textstr.length();
+#endif
+
+    return m_impl->ForEachMatch(textstr, textlen, func, flags, maxMatches);
+}
+
+size_t wxRegEx::ForEachMatch(const wxChar *text, size_t len,
+                             const MatchFunction& func,
+                             int flags,
+                             size_t maxMatches) const
+{
+    wxCHECK_MSG( IsValid(), 0, wxT("must successfully Compile() first") );
+
+#ifndef WXREGEX_CONVERT_TO_MB
+    return m_impl->ForEachMatch(text, len, func, flags, maxMatches);
+#else
+    return ForEachMatch(wxString(text, len), func, flags, maxMatches);
+#endif
+}
+
+#if wxUSE_STREAMS
+
+int wxRegEx::ReplaceToStream(const wxString& text,
+                             const wxString& replacement,
+                             wxOutputStream& out,
+                             size_t maxMatches) const
+{
+    wxCHECK_MSG( IsValid(), wxNOT_FOUND, wxT("must successfully Compile() first") );
+
+#ifndef WXREGEX_CONVERT_TO_MB
+    const wxChar* const textstr = text.c_str();
+    const size_t textlen = text.length();
+#else
+    const wxScopedCharBuffer textstr = text.utf8_str();
+    const size_t textlen = textstr.length();
+#endif
+
+    return m_impl->ReplaceToStream(textstr, textlen, replacement, out,
+                                   maxMatches);
+}
+
+int wxRegEx::ReplaceToStream(const wxChar *text, size_t len,
+                             const wxString& replacement,
+                             wxOutputStream& out,
+                             size_t maxMatches) const
+{
+    wxCHECK_MSG( IsValid(), wxNOT_FOUND, wxT("must successfully Compile() first") );
+
+#ifndef WXREGEX_CONVERT_TO_MB
+    return m_impl->ReplaceToStream(text, len, replacement, out, maxMatches);
+#else
+    return ReplaceToStream(wxString(text, len), replacement, out, maxMatches);
+#endif
+}
+
+#endif // wxUSE_STREAMS
+
 wxString wxRegEx::QuoteMeta(const wxString& str)
 {
     static const wxString s_strMetaChars = wxS("\\^$.|?*+()[]{}");
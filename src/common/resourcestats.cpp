@@ -0,0 +1,300 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        src/common/resourcestats.cpp
+// Purpose:     wxResourceStats implementation
+// Author:      wxWidgets team
+// Created:     2026-10-15
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+// ============================================================================
+// declarations
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// headers
+// ----------------------------------------------------------------------------
+
+// for compilers that support precompilation, includes "wx.h".
+#include "wx/wxprec.h"
+
+
+#include "wx/resourcestats.h"
+
+#ifndef WX_PRECOMP
+    #include "wx/bitmap.h"
+    #include "wx/region.h"
+    #include "wx/window.h"
+#endif // WX_PRECOMP
+
+#include "wx/module.h"
+#include "wx/thread.h"
+
+#include <algorithm>
+#include <map>
+#include <unordered_set>
+
+// ----------------------------------------------------------------------------
+// private classes
+// ----------------------------------------------------------------------------
+
+namespace
+{
+
+struct TrackedObjects
+{
+    // GDI objects can be created and destroyed in any thread, so access to
+    // them must be protected by the critical section.
+    wxCriticalSection critSect;
+    std::unordered_set<const wxGDIObject*> gdiObjects;
+
+    // Windows are only used in the main thread, but we still use the same
+    // critical section to allow retrieving the statistics from any thread.
+    std::unordered_set<const wxWindowBase*> windows;
+};
+
+TrackedObjects& GetTracked()
+{
+    static TrackedObjects s_tracked;
+    return s_tracked;
+}
+
+// Helper accumulating the statistics for the objects of the same class.
+struct ClassData
+{
+    wxResourceStats::Stats stats;
+
+    // Distinct ref data objects already counted for the GDI objects.
+    std::unordered_set<const wxObjectRefData*> refData;
+};
+
+using ClassMap = std::map<wxString, ClassData>;
+
+// Return the estimated size of the given GDI object resource.
+size_t EstimateBytes(const wxGDIObject* obj)
+{
+    const wxClassInfo* const info = obj->GetClassInfo();
+
+#ifdef __WXMSW__
+    // Under MSW, icons and cursors are not bitmaps but all of them use the
+    // same wxGDIImage base class.
+    if ( info->IsKindOf(wxCLASSINFO(wxGDIImage)) )
+    {
+        const wxGDIImage* const image = static_cast<const wxGDIImage*>(obj);
+#else // !__WXMSW__
+    if ( info->IsKindOf(wxCLASSINFO(wxBitmap)) )
+    {
+        const wxBitmap* const image = static_cast<const wxBitmap*>(obj);
+#endif // __WXMSW__/!__WXMSW__
+
+        int depth = image->GetDepth();
+        if ( depth <= 0 )
+            depth = 32;
+
+        const size_t bits = static_cast<size_t>(image->GetWidth()) *
+                                image->GetHeight() * depth;
+        return (bits + 7) / 8;
+    }
+
+    if ( info->IsKindOf(wxCLASSINFO(wxRegion)) )
+    {
+        size_t rects = 0;
+        for ( wxRegionIterator it(*static_cast<const wxRegion*>(obj)); it; ++it )
+            rects++;
+
+        return rects*sizeof(wxRect);
+    }
+
+    return 0;
+}
+
+std::vector<wxResourceStats::Stats> GetSortedStats(const ClassMap& classes)
+{
+    std::vector<wxResourceStats::Stats> stats;
+    stats.reserve(classes.size());
+    for ( const auto& kv : classes )
+        stats.push_back(kv.second.stats);
+
+    std::sort(stats.begin(), stats.end(),
+              [](const wxResourceStats::Stats& s1,
+                 const wxResourceStats::Stats& s2)
+              {
+                  if ( s1.bytes != s2.bytes )
+                      return s1.bytes > s2.bytes;
+
+                  return s1.objects > s2.objects;
+              });
+
+    return stats;
+}
+
+ClassMap CollectGDIStats()
+{
+    TrackedObjects& tracked = GetTracked();
+    wxCriticalSectionLocker lock(tracked.critSect);
+
+    ClassMap classes;
+    for ( const wxGDIObject* obj : tracked.gdiObjects )
+    {
+        const wxClassInfo* const info = obj->GetClassInfo();
+
+        // Skip the objects which are being destroyed in another thread: their
+        // derived part is already gone and they can't be used any more.
+        if ( info == wxCLASSINFO(wxGDIObject) )
+            continue;
+
+        ClassData& data = classes[info->GetClassName()];
+        data.stats.objects++;
+
+        const wxObjectRefData* const refData = obj->GetRefData();
+        if ( !refData || !obj->IsOk() )
+            continue;
+
+        if ( !data.refData.insert(refData).second )
+            continue;
+
+        data.stats.resources++;
+        data.stats.bytes += EstimateBytes(obj);
+    }
+
+    for ( auto& kv : classes )
+        kv.second.stats.className = kv.first;
+
+    return classes;
+}
+
+ClassMap CollectWindowStats()
+{
+    TrackedObjects& tracked = GetTracked();
+    wxCriticalSectionLocker lock(tracked.critSect);
+
+    ClassMap classes;
+    for ( const wxWindowBase* win : tracked.windows )
+    {
+        wxResourceStats::Stats&
+            stats = classes[win->GetClassInfo()->GetClassName()].stats;
+
+        stats.objects++;
+        if ( win->GetHandle() )
+            stats.resources++;
+    }
+
+    for ( auto& kv : classes )
+        kv.second.stats.className = kv.first;
+
+    return classes;
+}
+
+} // anonymous namespace
+
+// ----------------------------------------------------------------------------
+// wxResourceStatsModule: stop tracking before the static objects are destroyed
+// ----------------------------------------------------------------------------
+
+// Global GDI objects, such as wxNullBitmap, may be destroyed after our own
+// data, so we must stop accessing it before the library shutdown.
+class wxResourceStatsModule : public wxModule
+{
+public:
+    wxResourceStatsModule() {}
+    bool OnInit() override { return true; }
+    void OnExit() override { wxResourceStats::Enable(false); }
+
+private:
+    wxDECLARE_DYNAMIC_CLASS(wxResourceStatsModule);
+};
+
+wxIMPLEMENT_DYNAMIC_CLASS(wxResourceStatsModule, wxModule);
+
+// ============================================================================
+// wxResourceStats implementation
+// ============================================================================
+
+std::atomic<bool> wxResourceStats::ms_enabled{false};
+
+/* static */
+void wxResourceStats::Enable(bool enable)
+{
+    TrackedObjects& tracked = GetTracked();
+    wxCriticalSectionLocker lock(tracked.critSect);
+
+    ms_enabled = enable;
+
+    // We can't keep the pointers to the objects when not tracking them, as
+    // they could be destroyed without us knowing about it.
+    if ( !enable )
+    {
+        tracked.gdiObjects.clear();
+        tracked.windows.clear();
+    }
+}
+
+/* static */
+std::vector<wxResourceStats::Stats> wxResourceStats::GetGDIStats()
+{
+    return GetSortedStats(CollectGDIStats());
+}
+
+/* static */
+std::vector<wxResourceStats::Stats> wxResourceStats::GetWindowStats()
+{
+    return GetSortedStats(CollectWindowStats());
+}
+
+/* static */
+bool wxResourceStats::GetStats(const wxString& className, Stats* stats)
+{
+    wxCHECK_MSG( stats, false, "output parameter must be non-null" );
+
+    for ( const ClassMap& classes : { CollectGDIStats(), CollectWindowStats() } )
+    {
+        const auto it = classes.find(className);
+        if ( it != classes.end() )
+        {
+            *stats = it->second.stats;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/* static */
+void wxResourceStats::OnGDIObjectCreated(const wxGDIObject* obj)
+{
+    TrackedObjects& tracked = GetTracked();
+    wxCriticalSectionLocker lock(tracked.critSect);
+
+    // Check for this again as tracking could have been disabled since the
+    // caller checked it.
+    if ( IsEnabled() )
+        tracked.gdiObjects.insert(obj);
+}
+
+/* static */
+void wxResourceStats::OnGDIObjectDestroyed(const wxGDIObject* obj)
+{
+    TrackedObjects& tracked = GetTracked();
+    wxCriticalSectionLocker lock(tracked.critSect);
+
+    tracked.gdiObjects.erase(obj);
+}
+
+/* static */
+void wxResourceStats::OnWindowCreated(const wxWindowBase* win)
+{
+    TrackedObjects& tracked = GetTracked();
+    wxCriticalSectionLocker lock(tracked.critSect);
+
+    if ( IsEnabled() )
+        tracked.windows.insert(win);
+}
+
+/* static */
+void wxResourceStats::OnWindowDestroyed(const wxWindowBase* win)
+{
+    TrackedObjects& tracked = GetTracked();
+    wxCriticalSectionLocker lock(tracked.critSect);
+
+    tracked.windows.erase(win);
+}
@@ -353,6 +353,11 @@ void wxSizerItem::DoSetSizer(wxSizer *sizer)
 {
     m_kind = Item_Sizer;
     m_sizer = sizer;
+
+    // We don't know the sizer containing this item here, wxSizer sets it when
+    // the item is added to it, but invalidate all the cached sizes in case the
+    // sizer of an existing item is replaced.
+    wxSizer::InvalidateAllMinSizes();
 }
 
 wxSizerItem::wxSizerItem(wxSizer *sizer,
@@ -576,6 +581,10 @@ bool wxSizerItem::InformFirstDirection(int direction, int size, int availableOth
         }
     }
 
+    // Our minimal size changed, so must the minimal size of the sizer.
+    if ( didUse )
+        InvalidateContainingSizer();
+
     return didUse;
 }
 
@@ -605,6 +614,61 @@ wxSize wxSizerItem::GetMinSizeWithBorder() const
     return AddBorderToSize(m_minSize);
 }
 
+void wxSizerItem::SetMinSize(const wxSize& size)
+{
+    if ( IsWindow() )
+        m_window->SetMinSize(size);
+    m_minSize = size;
+
+    InvalidateContainingSizer();
+}
+
+void wxSizerItem::SetProportion(int proportion)
+{
+    m_proportion = proportion;
+
+    InvalidateContainingSizer();
+}
+
+void wxSizerItem::SetFlag(int flag)
+{
+    m_flag = flag;
+
+    InvalidateContainingSizer();
+}
+
+void wxSizerItem::SetBorder(int border)
+{
+    m_border = border;
+
+    InvalidateContainingSizer();
+}
+
+void wxSizerItem::InvalidateContainingSizer()
+{
+    wxSizer* sizer = nullptr;
+    switch ( m_kind )
+    {
+        case Item_Window:
+            sizer = m_window->GetContainingSizer();
+            break;
+
+        case Item_Sizer:
+            sizer = m_sizer;
+            break;
+
+        default:
+            break;
+    }
+
+    // Spacers don't know which sizer they belong to, so invalidate all of
+    // them, this is cheap and doesn't happen often anyhow.
+    if ( sizer )
+        sizer->InvalidateMinSize();
+    else
+        wxSizer::InvalidateAllMinSizes();
+}
+
 wxSize wxSizerItem::GetMaxSizeWithBorder() const
 {
     return AddBorderToSize(GetMaxSize());
@@ -762,6 +826,8 @@ void wxSizerItem::Show( bool show )
         default:
             wxFAIL_MSG( wxT("unexpected wxSizerItem::m_kind") );
     }
+
+    InvalidateContainingSizer();
 }
 
 bool wxSizerItem::IsShown() const
@@ -800,11 +866,79 @@ bool wxSizerItem::IsShown() const
 // wxSizer
 //---------------------------------------------------------------------------
 
+bool wxSizer::ms_minSizeCacheEnabled = false;
+unsigned wxSizer::ms_minSizeCacheGeneration = 1;
+
 wxSizer::~wxSizer()
 {
     wxClearList(m_children);
 }
 
+/* static */
+void wxSizer::EnableMinSizeCache(bool enable)
+{
+    ms_minSizeCacheEnabled = enable;
+
+    // Don't reuse anything cached before the cache was disabled.
+    InvalidateAllMinSizes();
+}
+
+/* static */
+void wxSizer::InvalidateAllMinSizes()
+{
+    // Generation 0 is used for "invalid", so skip it when wrapping around.
+    if ( !++ms_minSizeCacheGeneration )
+        ms_minSizeCacheGeneration = 1;
+}
+
+void wxSizer::InvalidateMinSize()
+{
+    for ( wxSizer* sizer = this; sizer; sizer = sizer->m_containingSizer )
+    {
+        sizer->m_minSizeCacheGeneration = 0;
+        sizer->m_layoutGeneration = 0;
+    }
+}
+
+void wxSizer::CacheMinSize(const wxSize& size)
+{
+    m_minSizeCache = size;
+    m_minSizeCacheGeneration = ms_minSizeCacheGeneration;
+}
+
+wxSize wxSizer::CalcMinCached()
+{
+    if ( !ms_minSizeCacheEnabled )
+        return CalcMin();
+
+    if ( m_minSizeCacheGeneration != ms_minSizeCacheGeneration )
+        CacheMinSize(CalcMin());
+
+    return m_minSizeCache;
+}
+
+void wxSizer::SetDimension(const wxPoint& pos, const wxSize& size)
+{
+    // There is no need to lay out a nested sizer again if neither its geometry
+    // nor anything inside it changed since the last time. Notice that the
+    // top level sizer is always laid out, as Layout() could be called
+    // explicitly to take into account some change we don't know about.
+    if ( ms_minSizeCacheEnabled &&
+            m_containingSizer &&
+                m_layoutGeneration == ms_minSizeCacheGeneration &&
+                    pos == m_position && size == m_size )
+        return;
+
+    m_position = pos;
+    m_size = size;
+    Layout();
+
+    // This call is required for wxWrapSizer to be able to calculate its
+    // minimal size correctly.
+    if ( InformFirstDirection(wxHORIZONTAL, size.x, size.y) )
+        InvalidateMinSize();
+}
+
 wxSizerItem* wxSizer::DoInsert( size_t index, wxSizerItem *item )
 {
     // The helper class that solves two problems when
@@ -852,11 +986,16 @@ wxSizerItem* wxSizer::DoInsert( size_t index, wxSizerItem *item )
         }
     }
 
-    if ( item->GetSizer() )
-        item->GetSizer()->SetContainingWindow( m_containingWindow );
+    if ( wxSizer* const sizer = item->GetSizer() )
+    {
+        sizer->SetContainingWindow( m_containingWindow );
+        sizer->m_containingSizer = this;
+    }
 
     m_children.Insert( index, item );
 
+    InvalidateMinSize();
+
     return guard.Release();
 }
 
@@ -919,6 +1058,7 @@ bool wxSizer::Remove( wxSizer *sizer )
         {
             delete item;
             m_children.Erase( node );
+            InvalidateMinSize();
             return true;
         }
 
@@ -939,6 +1079,8 @@ bool wxSizer::Remove( int index )
     delete node->GetData();
     m_children.Erase( node );
 
+    InvalidateMinSize();
+
     return true;
 }
 
@@ -953,9 +1095,11 @@ bool wxSizer::Detach( wxSizer *sizer )
 
         if (item->GetSizer() == sizer)
         {
+            sizer->m_containingSizer = nullptr;
             item->DetachSizer();
             delete item;
             m_children.Erase( node );
+            InvalidateMinSize();
             return true;
         }
         node = node->GetNext();
@@ -977,6 +1121,7 @@ bool wxSizer::Detach( wxWindow *window )
         {
             delete item;
             m_children.Erase( node );
+            InvalidateMinSize();
             return true;
         }
         node = node->GetNext();
@@ -996,10 +1141,14 @@ bool wxSizer::Detach( int index )
     wxSizerItem *item = node->GetData();
 
     if ( item->IsSizer() )
+    {
+        item->GetSizer()->m_containingSizer = nullptr;
         item->DetachSizer();
+    }
 
     delete item;
     m_children.Erase( node );
+    InvalidateMinSize();
     return true;
 }
 
@@ -1014,6 +1163,7 @@ bool wxSizer::Replace( wxWindow *oldwin, wxWindow *newwin, bool recursive )
         {
             item->AssignWindow(newwin);
             newwin->SetContainingSizer( this );
+            InvalidateMinSize();
             return true;
         }
         else if (recursive && item->IsSizer())
@@ -1036,6 +1186,8 @@ bool wxSizer::Replace( wxSizer *oldsz, wxSizer *newsz, bool recursive )
         if (item->GetSizer() == oldsz)
         {
             item->AssignSizer(newsz);
+            newsz->m_containingSizer = this;
+            InvalidateMinSize();
             return true;
         }
         else if (recursive && item->IsSizer())
@@ -1066,6 +1218,10 @@ bool wxSizer::Replace( size_t old, wxSizerItem *newitem )
 
     if (wxWindow* const w = newitem->GetWindow())
         w->SetContainingSizer(this);
+    else if (wxSizer* const sizer = newitem->GetSizer())
+        sizer->m_containingSizer = this;
+
+    InvalidateMinSize();
 
     return true;
 }
@@ -1085,6 +1241,8 @@ void wxSizer::Clear( bool delete_windows )
 
     // Now empty the list
     wxClearList(m_children);
+
+    InvalidateMinSize();
 }
 
 void wxSizer::DeleteWindows()
@@ -1179,6 +1337,19 @@ void wxSizer::Layout()
     // for layout
     const wxSize minSize = CalcMin();
 
+    // Notice that this must be done before repositioning the children, as
+    // doing it may invalidate our minimal size again.
+    if ( ms_minSizeCacheEnabled )
+    {
+        CacheMinSize(minSize);
+        m_layoutGeneration = ms_minSizeCacheGeneration;
+    }
+
+    // If we're laying out the entire window, any layout scheduled for it
+    // doesn't need to be done any more.
+    if ( m_containingWindow && m_containingWindow->GetSizer() == this )
+        m_containingWindow->WXCancelScheduledLayout();
+
     // Applies the layout and repositions/resizes the items
     wxWindow::ChildrenRepositioningGuard repositionGuard(m_containingWindow);
 
@@ -1223,7 +1394,7 @@ wxSize wxSizer::VirtualFitSize( wxWindow *window )
 
 wxSize wxSizer::GetMinSize()
 {
-    wxSize ret( CalcMin() );
+    wxSize ret( CalcMinCached() );
     if (ret.x < m_minSize.x) ret.x = m_minSize.x;
     if (ret.y < m_minSize.y) ret.y = m_minSize.y;
     return ret;
@@ -1233,6 +1404,8 @@ void wxSizer::DoSetMinSize( int width, int height )
 {
     m_minSize.x = width;
     m_minSize.y = height;
+
+    InvalidateMinSize();
 }
 
 bool wxSizer::DoSetItemMinSize( wxWindow *window, int width, int height )
@@ -2134,6 +2307,8 @@ void wxFlexGridSizer::AddGrowableRow( size_t idx, int proportion )
 
     m_growableRows.Add( idx );
     m_growableRowsProportions.Add( proportion );
+
+    InvalidateMinSize();
 }
 
 void wxFlexGridSizer::AddGrowableCol( size_t idx, int proportion )
@@ -2147,6 +2322,8 @@ void wxFlexGridSizer::AddGrowableCol( size_t idx, int proportion )
 
     m_growableCols.Add( idx );
     m_growableColsProportions.Add( proportion );
+
+    InvalidateMinSize();
 }
 
 // helper function for RemoveGrowableCol/Row()
@@ -2170,11 +2347,15 @@ DoRemoveFromArrays(size_t idx, wxArrayInt& items, wxArrayInt& proportions)
 void wxFlexGridSizer::RemoveGrowableCol( size_t idx )
 {
     DoRemoveFromArrays(idx, m_growableCols, m_growableColsProportions);
+
+    InvalidateMinSize();
 }
 
 void wxFlexGridSizer::RemoveGrowableRow( size_t idx )
 {
     DoRemoveFromArrays(idx, m_growableRows, m_growableRowsProportions);
+
+    InvalidateMinSize();
 }
 
 //---------------------------------------------------------------------------
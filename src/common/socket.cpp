@@ -41,12 +41,21 @@
 #include "wx/thread.h"
 #include "wx/evtloop.h"
 #include "wx/link.h"
+#include "wx/file.h"
+
+#include <deque>
 
 #include "wx/private/fd.h"
 #include "wx/private/socket.h"
 
 #ifdef __UNIX__
     #include <errno.h>
+    #include <sys/uio.h>
+    #include <netinet/tcp.h>
+#endif
+
+#ifdef __LINUX__
+    #include <sys/sendfile.h>
 #endif
 
 // we use MSG_NOSIGNAL to avoid getting SIGPIPE when sending data to a remote
@@ -109,6 +118,8 @@ WX_CHECK_BUILD_OPTIONS("wxNet")
 
 // event
 wxDEFINE_EVENT(wxEVT_SOCKET, wxSocketEvent);
+wxDEFINE_EVENT(wxEVT_SOCKET_READ_DONE, wxSocketEvent);
+wxDEFINE_EVENT(wxEVT_SOCKET_WRITE_DONE, wxSocketEvent);
 
 // discard buffer
 #define MAX_DISCARD_SIZE (10 * 1024)
@@ -196,6 +207,26 @@ private:
     wxDECLARE_NO_COPY_CLASS(wxSocketWaitModeChanger);
 };
 
+// wxSocketAsyncState contains the data of the asynchronous operations in
+// progress for a socket
+class wxSocketAsyncState
+{
+public:
+    // the data read so far and the size of the data to read, 0 if there is
+    // no read in progress, and whether all of it must be read
+    wxMemoryBuffer readBuf;
+    wxUint32 readSize = 0;
+    bool readAll = true;
+
+    // all the data queued for writing, the offset of the first byte not
+    // written yet and the offsets of the ends of all pending write requests,
+    // with the first one starting at writeStart
+    wxMemoryBuffer writeBuf;
+    size_t writeDone = 0;
+    size_t writeStart = 0;
+    std::deque<size_t> writeEnds;
+};
+
 // wxSocketRead/WriteGuard are instantiated before starting reading
 // from/writing to the socket
 class wxSocketReadGuard
@@ -754,6 +785,91 @@ int wxSocketImpl::Write(const void *buffer, int size)
     return ret;
 }
 
+int wxSocketImpl::WriteV(const wxSocketBuffer *buffers, int count)
+{
+    if ( m_fd == INVALID_SOCKET || m_server || !m_stream )
+    {
+        m_error = wxSOCKET_INVSOCK;
+        return -1;
+    }
+
+    wxCHECK_MSG( count > 0 && count <= MAX_WRITEV_BUFFERS, -1,
+                 "invalid number of buffers" );
+
+    int ret;
+
+#ifdef __WINDOWS__
+    WSABUF bufs[MAX_WRITEV_BUFFERS];
+    for ( int n = 0; n < count; n++ )
+    {
+        bufs[n].buf = static_cast<CHAR *>(const_cast<void *>(buffers[n].data));
+        bufs[n].len = buffers[n].size;
+    }
+
+    DWORD sent;
+    ret = WSASend(m_fd, bufs, count, &sent, 0, nullptr, nullptr) == 0
+            ? static_cast<int>(sent)
+            : SOCKET_ERROR;
+#else // !__WINDOWS__
+    iovec iov[MAX_WRITEV_BUFFERS];
+    for ( int n = 0; n < count; n++ )
+    {
+        iov[n].iov_base = const_cast<void *>(buffers[n].data);
+        iov[n].iov_len = buffers[n].size;
+    }
+
+    msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = iov;
+    msg.msg_iovlen = count;
+
+#ifdef wxNEEDS_IGNORE_SIGPIPE
+    IgnoreSignal ignore(SIGPIPE);
+#endif
+
+    DO_WHILE_EINTR( ret, sendmsg(m_fd, &msg, wxSOCKET_MSG_NOSIGNAL) );
+#endif // __WINDOWS__/!__WINDOWS__
+
+    m_error = ret == SOCKET_ERROR ? GetLastError() : wxSOCKET_NOERROR;
+
+    return ret;
+}
+
+int wxSocketImpl::SendFile(int fd, wxFileOffset offset, int size)
+{
+    if ( m_fd == INVALID_SOCKET || m_server )
+    {
+        m_error = wxSOCKET_INVSOCK;
+        return -1;
+    }
+
+#ifdef __LINUX__
+    if ( m_stream )
+    {
+        off_t off = offset;
+
+        int ret;
+        DO_WHILE_EINTR( ret, sendfile(m_fd, fd, &off, size) );
+
+        if ( ret != -1 )
+            m_error = wxSOCKET_NOERROR;
+        else if ( errno == EINVAL || errno == ENOSYS )
+            m_error = wxSOCKET_INVOP; // this kind of file is not supported
+        else
+            m_error = GetLastError();
+
+        return ret;
+    }
+#else // !__LINUX__
+    wxUnusedVar(fd);
+    wxUnusedVar(offset);
+    wxUnusedVar(size);
+#endif // __LINUX__/!__LINUX__
+
+    m_error = wxSOCKET_INVOP;
+    return -1;
+}
+
 // ==========================================================================
 // wxSocketBase
 // ==========================================================================
@@ -847,6 +963,8 @@ void wxSocketBase::Init()
     m_eventmask    =
     m_eventsgot    = 0;
 
+    m_async        = nullptr;
+
     // when we create the first socket in the main thread we initialize the
     // OS-dependent socket stuff: notice that this means that the user code
     // needs to call wxSocket::Initialize() itself if the first socket it
@@ -885,6 +1003,8 @@ wxSocketBase::~wxSocketBase()
 
     // Free the pushback buffer
     free(m_unread);
+
+    delete m_async;
 }
 
 bool wxSocketBase::Destroy()
@@ -952,6 +1072,9 @@ bool wxSocketBase::Close()
     // Interrupt pending waits
     InterruptWait();
 
+    // Cancel the pending asynchronous operations without notifying about them
+    wxDELETE(m_async);
+
     ShutdownOutput();
 
     m_connected = false;
@@ -1299,6 +1422,456 @@ wxSocketBase& wxSocketBase::WriteMsg(const void *buffer, wxUint32 nbytes)
     return *this;
 }
 
+wxSocketBase& wxSocketBase::WriteV(const wxSocketBuffer *buffers, size_t count)
+{
+    wxSocketWriteGuard write(this);
+
+    m_lcount_write = DoWriteV(buffers, count);
+    m_lcount = m_lcount_write;
+
+    return *this;
+}
+
+// This is the same as DoWrite() but writes the data from several buffers at
+// once for the stream sockets, which can't be done for the datagram ones as
+// each write would result in a separate datagram for them anyhow
+wxUint32 wxSocketBase::DoWriteV(const wxSocketBuffer *buffers, size_t count)
+{
+    wxCHECK_MSG( m_impl, 0, "socket must be valid" );
+    wxCHECK_MSG( buffers || !count, 0, "null buffers" );
+
+    wxUint32 total = 0;
+
+    if ( !m_impl->m_stream )
+    {
+        for ( size_t n = 0; n < count; n++ )
+        {
+            const wxUint32 written = DoWrite(buffers[n].data, buffers[n].size);
+            total += written;
+            if ( written != buffers[n].size )
+                break;
+        }
+
+        return total;
+    }
+
+    // the index of the first buffer with some data remaining and the offset
+    // of this data in it
+    size_t first = 0;
+    wxUint32 offset = 0;
+    for ( ;; )
+    {
+        while ( first < count && offset == buffers[first].size )
+        {
+            first++;
+            offset = 0;
+        }
+
+        if ( first == count )
+            break;
+
+        if ( !m_connected )
+        {
+            if ( (m_flags & wxSOCKET_WAITALL_WRITE) || !total )
+                SetError(wxSOCKET_IOERR);
+            break;
+        }
+
+        wxSocketBuffer chunk[wxSocketImpl::MAX_WRITEV_BUFFERS];
+        chunk[0].data = static_cast<const char *>(buffers[first].data) + offset;
+        chunk[0].size = buffers[first].size - offset;
+
+        int numChunks = 1;
+        for ( size_t n = first + 1;
+              n < count && numChunks < wxSocketImpl::MAX_WRITEV_BUFFERS;
+              n++ )
+        {
+            chunk[numChunks++] = buffers[n];
+        }
+
+        const int ret = m_impl->WriteV(chunk, numChunks);
+        if ( ret == -1 )
+        {
+            if ( m_impl->GetLastError() == wxSOCKET_WOULDBLOCK )
+            {
+                if ( m_flags & wxSOCKET_NOWAIT_WRITE )
+                    break;
+
+                if ( !DoWaitWithTimeout(wxSOCKET_OUTPUT_FLAG) )
+                {
+                    SetError(wxSOCKET_TIMEDOUT);
+                    break;
+                }
+
+                continue;
+            }
+            else // "real" error
+            {
+                SetError(wxSOCKET_IOERR);
+                break;
+            }
+        }
+
+        total += ret;
+
+        if ( !(m_flags & wxSOCKET_WAITALL_WRITE) )
+            break;
+
+        // skip the data which was written
+        for ( wxUint32 left = ret; left; )
+        {
+            const wxUint32 remaining = buffers[first].size - offset;
+            if ( left < remaining )
+            {
+                offset += left;
+                break;
+            }
+
+            left -= remaining;
+            first++;
+            offset = 0;
+        }
+    }
+
+    return total;
+}
+
+#if wxUSE_FILE
+
+wxSocketBase&
+wxSocketBase::SendFile(wxFile& file, wxFileOffset offset, wxFileOffset size)
+{
+    wxSocketWriteGuard write(this);
+
+    // like WriteMsg(), always send all the data
+    wxSocketWaitModeChanger changeFlags(this, wxSOCKET_WAITALL_WRITE);
+
+    // notice that the count can't be represented correctly for huge files
+    m_lcount_write = static_cast<wxUint32>(DoSendFile(file, offset, size));
+    m_lcount = m_lcount_write;
+
+    return *this;
+}
+
+wxFileOffset
+wxSocketBase::DoSendFile(wxFile& file, wxFileOffset offset, wxFileOffset size)
+{
+    wxCHECK_MSG( m_impl, 0, "socket must be valid" );
+    wxCHECK_MSG( file.IsOpened(), 0, "file must be opened" );
+
+    if ( size == wxInvalidOffset )
+    {
+        const wxFileOffset length = file.Length();
+        if ( length == wxInvalidOffset || length < offset )
+        {
+            SetError(wxSOCKET_IOERR);
+            return 0;
+        }
+
+        size = length - offset;
+    }
+
+    // limit the size of a single sendfile() call to fit into an int
+    const wxFileOffset MAX_CHUNK = 0x40000000;
+
+    // try sending the file without copying it first, this may be not
+    // supported at all or not supported for this kind of file in which case
+    // we fall back to the loop below
+    wxFileOffset total = 0;
+    while ( total < size )
+    {
+        if ( !m_connected )
+        {
+            SetError(wxSOCKET_IOERR);
+            return total;
+        }
+
+        const int ret = m_impl->SendFile(file.fd(), offset + total,
+                                         wxMin(size - total, MAX_CHUNK));
+        if ( ret == -1 )
+        {
+            const wxSocketError err = m_impl->m_error;
+            if ( err == wxSOCKET_INVOP && !total )
+                break;
+
+            if ( err == wxSOCKET_WOULDBLOCK )
+            {
+                if ( !DoWaitWithTimeout(wxSOCKET_OUTPUT_FLAG) )
+                {
+                    SetError(wxSOCKET_TIMEDOUT);
+                    return total;
+                }
+
+                continue;
+            }
+
+            SetError(wxSOCKET_IOERR);
+            return total;
+        }
+
+        if ( !ret )
+        {
+            // the file is shorter than expected
+            SetError(wxSOCKET_IOERR);
+            return total;
+        }
+
+        total += ret;
+    }
+
+    if ( total == size )
+        return total;
+
+    if ( file.Seek(offset) == wxInvalidOffset )
+    {
+        SetError(wxSOCKET_IOERR);
+        return 0;
+    }
+
+    wxCharBuffer buf(64*1024);
+    while ( total < size )
+    {
+        const ssize_t
+            numRead = file.Read(buf.data(),
+                                wxMin(size - total,
+                                      static_cast<wxFileOffset>(buf.length())));
+        if ( numRead <= 0 )
+        {
+            SetError(wxSOCKET_IOERR);
+            break;
+        }
+
+        const wxUint32 written = DoWrite(buf.data(), numRead);
+        total += written;
+        if ( written != static_cast<wxUint32>(numRead) )
+            break;
+    }
+
+    return total;
+}
+
+#endif // wxUSE_FILE
+
+// --------------------------------------------------------------------------
+// Asynchronous IO
+// --------------------------------------------------------------------------
+
+bool wxSocketBase::ReadAsync(wxUint32 nbytes, bool waitAll)
+{
+    wxCHECK_MSG( m_impl, false, "socket must be valid" );
+    wxCHECK_MSG( m_handler, false, "event handler must be set" );
+    wxCHECK_MSG( !(m_flags & wxSOCKET_BLOCK), false,
+                 "asynchronous IO requires non-blocking socket" );
+    wxCHECK_MSG( nbytes, false, "nothing to read" );
+    wxCHECK_MSG( !IsReadingAsync(), false, "already reading" );
+
+    if ( !m_async )
+        m_async = new wxSocketAsyncState;
+
+    m_async->readBuf.SetBufSize(nbytes);
+    m_async->readSize = nbytes;
+    m_async->readAll = waitAll;
+
+    // read the data which may be already available right now, the rest of
+    // it will be read when we're notified about it in OnRequest()
+    DoReadAsync();
+
+    return true;
+}
+
+bool wxSocketBase::WriteAsync(const void *buffer, wxUint32 nbytes)
+{
+    wxCHECK_MSG( m_impl, false, "socket must be valid" );
+    wxCHECK_MSG( m_handler, false, "event handler must be set" );
+    wxCHECK_MSG( !(m_flags & wxSOCKET_BLOCK), false,
+                 "asynchronous IO requires non-blocking socket" );
+    wxCHECK_MSG( buffer || !nbytes, false, "null buffer" );
+
+    if ( !m_async )
+        m_async = new wxSocketAsyncState;
+
+    const bool wasWriting = IsWritingAsync();
+
+    m_async->writeBuf.AppendData(buffer, nbytes);
+    m_async->writeEnds.push_back(m_async->writeBuf.GetDataLen());
+
+    // if we're already writing, the new data will be written after the
+    // existing one when the socket becomes writable
+    if ( !wasWriting )
+        DoWriteAsync();
+
+    return true;
+}
+
+bool wxSocketBase::IsReadingAsync() const
+{
+    return m_async && m_async->readSize;
+}
+
+bool wxSocketBase::IsWritingAsync() const
+{
+    return m_async && !m_async->writeEnds.empty();
+}
+
+void wxSocketBase::DoReadAsync()
+{
+    wxSocketAsyncState& async = *m_async;
+
+    wxSocketError error = wxSOCKET_NOERROR;
+    {
+        wxSocketReadGuard read(this);
+        wxSocketWaitModeChanger changeFlags(this, wxSOCKET_NOWAIT_READ);
+
+        char * const buffer = static_cast<char *>(async.readBuf.GetData());
+        for ( ;; )
+        {
+            const wxUint32 done = async.readBuf.GetDataLen();
+            if ( done == async.readSize )
+                break;
+
+            SetError(wxSOCKET_NOERROR);
+
+            const wxUint32 ret = DoRead(buffer + done, async.readSize - done);
+            async.readBuf.SetDataLen(done + ret);
+
+            if ( !ret )
+            {
+                // notice that reading 0 bytes is not an error for UDP, but
+                // it doesn't matter as the read is completed below then
+                error = LastError();
+                if ( m_closed )
+                    error = wxSOCKET_IOERR;
+                break;
+            }
+        }
+    }
+
+    if ( error != wxSOCKET_NOERROR )
+        CompleteReadAsync(error);
+    else if ( async.readBuf.GetDataLen() == async.readSize ||
+                (!async.readAll && async.readBuf.GetDataLen()) )
+        CompleteReadAsync(wxSOCKET_NOERROR);
+}
+
+void wxSocketBase::CompleteReadAsync(wxSocketError error)
+{
+    wxSocketAsyncState& async = *m_async;
+
+    wxSocketEvent event(wxEVT_SOCKET_READ_DONE, m_id);
+    event.m_event      = wxSOCKET_INPUT;
+    event.m_clientData = m_clientData;
+    event.m_data       = async.readBuf;
+    event.m_count      = async.readBuf.GetDataLen();
+    event.m_error      = error;
+    event.SetEventObject(this);
+
+    // notice that the buffer given to the event must not be reused
+    async.readBuf = wxMemoryBuffer();
+    async.readSize = 0;
+
+    m_handler->AddPendingEvent(event);
+}
+
+void wxSocketBase::DoWriteAsync()
+{
+    wxSocketAsyncState& async = *m_async;
+
+    wxSocketError error = wxSOCKET_NOERROR;
+    {
+        wxSocketWriteGuard write(this);
+        wxSocketWaitModeChanger changeFlags(this, wxSOCKET_NOWAIT_WRITE);
+
+        const char * const buffer = static_cast<char *>(async.writeBuf.GetData());
+        const size_t total = async.writeBuf.GetDataLen();
+        while ( async.writeDone < total )
+        {
+            SetError(wxSOCKET_NOERROR);
+
+            const size_t
+                size = wxMin(total - async.writeDone, size_t(0x40000000));
+            const wxUint32 ret = DoWrite(buffer + async.writeDone, size);
+            async.writeDone += ret;
+
+            if ( !ret )
+            {
+                // we will continue when the socket becomes writable again
+                // unless there was a real error
+                error = LastError();
+                if ( error == wxSOCKET_WOULDBLOCK )
+                    error = wxSOCKET_NOERROR;
+                else if ( error == wxSOCKET_NOERROR && !m_connected )
+                    error = wxSOCKET_IOERR;
+                break;
+            }
+        }
+    }
+
+    if ( error != wxSOCKET_NOERROR )
+    {
+        CompleteWritesAsync(error);
+        return;
+    }
+
+    CompleteWritesAsync(wxSOCKET_NOERROR);
+
+    // don't let the buffer grow indefinitely if we never manage to write
+    // everything, but avoid moving the data too often
+    if ( async.writeEnds.empty() )
+    {
+        async.writeBuf.SetDataLen(0);
+        async.writeDone =
+        async.writeStart = 0;
+    }
+    else if ( async.writeStart > async.writeBuf.GetDataLen() / 2 )
+    {
+        char * const buffer = static_cast<char *>(async.writeBuf.GetData());
+        const size_t shift = async.writeStart;
+        const size_t remaining = async.writeBuf.GetDataLen() - shift;
+
+        memmove(buffer, buffer + shift, remaining);
+        async.writeBuf.SetDataLen(remaining);
+        async.writeDone -= shift;
+        async.writeStart = 0;
+        for ( size_t& end : async.writeEnds )
+            end -= shift;
+    }
+}
+
+void wxSocketBase::CompleteWritesAsync(wxSocketError error)
+{
+    wxSocketAsyncState& async = *m_async;
+
+    // send the events for all the requests which were completely written or,
+    // in case of error, for all of them
+    while ( !async.writeEnds.empty() )
+    {
+        const size_t end = async.writeEnds.front();
+        if ( end > async.writeDone && error == wxSOCKET_NOERROR )
+            break;
+
+        const size_t done = wxMin(end, async.writeDone);
+
+        wxSocketEvent event(wxEVT_SOCKET_WRITE_DONE, m_id);
+        event.m_event      = wxSOCKET_OUTPUT;
+        event.m_clientData = m_clientData;
+        event.m_count      = done > async.writeStart ? done - async.writeStart : 0;
+        event.m_error      = error;
+        event.SetEventObject(this);
+
+        m_handler->AddPendingEvent(event);
+
+        async.writeStart = end;
+        async.writeEnds.pop_front();
+    }
+
+    if ( error != wxSOCKET_NOERROR )
+    {
+        async.writeBuf.SetDataLen(0);
+        async.writeDone =
+        async.writeStart = 0;
+    }
+}
+
 wxSocketBase& wxSocketBase::Unread(const void *buffer, wxUint32 nbytes)
 {
     if (nbytes != 0)
@@ -1774,6 +2347,41 @@ void wxSocketBase::OnRequest(wxSocketNotify notification)
     // use this in DoWait()
     m_eventsgot |= flag;
 
+    // the events consumed by the asynchronous operations in progress are not
+    // forwarded to the user code, notice that we can be called from inside
+    // DoRead/WriteAsync() themselves
+    if ( m_async )
+    {
+        switch ( notification )
+        {
+            case wxSOCKET_INPUT:
+                if ( IsReadingAsync() && !m_reading )
+                {
+                    DoReadAsync();
+                    return;
+                }
+                break;
+
+            case wxSOCKET_OUTPUT:
+                if ( IsWritingAsync() && !m_writing )
+                {
+                    DoWriteAsync();
+                    return;
+                }
+                break;
+
+            case wxSOCKET_LOST:
+                if ( IsReadingAsync() && !m_reading )
+                    CompleteReadAsync(wxSOCKET_IOERR);
+                if ( IsWritingAsync() && !m_writing )
+                    CompleteWritesAsync(wxSOCKET_IOERR);
+                break;
+
+            default:
+                break;
+        }
+    }
+
     // send the wx event if enabled and we're interested in it
     if ( m_notify && (m_eventmask & flag) && m_handler )
     {
@@ -2008,6 +2616,43 @@ wxSocketBase::SetOption(int level, int optname, const void *optval, int optlen)
                       static_cast<const char *>(optval), optlen) == 0;
 }
 
+bool wxSocketBase::SetNoDelay(bool noDelay)
+{
+    const int value = noDelay;
+    return SetOption(IPPROTO_TCP, TCP_NODELAY, &value, sizeof(value));
+}
+
+bool wxSocketBase::SetCork(bool cork)
+{
+    const int value = cork;
+
+#if defined(TCP_CORK)
+    return SetOption(IPPROTO_TCP, TCP_CORK, &value, sizeof(value));
+#elif defined(TCP_NOPUSH)
+    // BSD systems don't send the partial frames when TCP_NOPUSH is set, but,
+    // unlike with TCP_CORK, clearing it doesn't send them immediately, so do
+    // it explicitly by toggling TCP_NODELAY
+    if ( !SetOption(IPPROTO_TCP, TCP_NOPUSH, &value, sizeof(value)) )
+        return false;
+
+    if ( !cork )
+    {
+        int noDelay = 0;
+        int len = sizeof(noDelay);
+        if ( GetOption(IPPROTO_TCP, TCP_NODELAY, &noDelay, &len) && !noDelay )
+        {
+            SetNoDelay(true);
+            SetNoDelay(false);
+        }
+    }
+
+    return true;
+#else
+    wxUnusedVar(value);
+    return false;
+#endif
+}
+
 bool wxSocketBase::SetLocal(const wxIPV4address& local)
 {
     m_localAddress = local;
@@ -41,6 +41,7 @@
 
 #include "wx/encconv.h"
 #include "wx/fontmap.h"
+#include "wx/private/simd.h"
 #include "wx/private/unicode.h"
 
 #ifdef __DARWIN__
@@ -952,6 +953,69 @@ extern const unsigned char tableUtf8Lengths[256] = {
                    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0   // F5..FF
 };
 
+// The functions below are used to convert the ASCII characters, which are
+// often the vast majority of the text, in blocks of this size instead of one
+// by one. They use SIMD instructions if available and are written to allow
+// the compiler to vectorize them otherwise.
+static const size_t utf8AsciiBlock = 16;
+
+static inline bool wxIsAsciiBlock(const char *p)
+{
+#if defined(wxHAS_SSE2)
+    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    return _mm_movemask_epi8(v) == 0;
+#elif defined(wxHAS_NEON)
+    return vmaxvq_u8(vld1q_u8(reinterpret_cast<const uint8_t*>(p))) < 0x80;
+#else
+    unsigned char mask = 0;
+    for ( size_t n = 0; n < utf8AsciiBlock; n++ )
+        mask |= static_cast<unsigned char>(p[n]);
+
+    return !(mask & 0x80);
+#endif
+}
+
+static inline bool wxIsAsciiBlock(const wchar_t *p)
+{
+    wxUint32 mask = 0;
+    for ( size_t n = 0; n < utf8AsciiBlock; n++ )
+        mask |= static_cast<wxUint32>(p[n]);
+
+    return !(mask & ~0x7Fu);
+}
+
+static inline void wxCopyAsciiBlock(wchar_t *dst, const char *src)
+{
+#if defined(wxHAS_SSE2) && (SIZEOF_WCHAR_T == 2 || SIZEOF_WCHAR_T == 4)
+    // widen the bytes, which are all less than 0x80, by interleaving them
+    // with zeroes
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+    const __m128i lo = _mm_unpacklo_epi8(v, zero),
+                  hi = _mm_unpackhi_epi8(v, zero);
+
+    __m128i* const out = reinterpret_cast<__m128i*>(dst);
+#if SIZEOF_WCHAR_T == 2
+    _mm_storeu_si128(out, lo);
+    _mm_storeu_si128(out + 1, hi);
+#else // SIZEOF_WCHAR_T == 4
+    _mm_storeu_si128(out, _mm_unpacklo_epi16(lo, zero));
+    _mm_storeu_si128(out + 1, _mm_unpackhi_epi16(lo, zero));
+    _mm_storeu_si128(out + 2, _mm_unpacklo_epi16(hi, zero));
+    _mm_storeu_si128(out + 3, _mm_unpackhi_epi16(hi, zero));
+#endif // SIZEOF_WCHAR_T
+#else
+    for ( size_t n = 0; n < utf8AsciiBlock; n++ )
+        dst[n] = static_cast<wchar_t>(src[n]);
+#endif
+}
+
+static inline void wxCopyAsciiBlock(char *dst, const wchar_t *src)
+{
+    for ( size_t n = 0; n < utf8AsciiBlock; n++ )
+        dst[n] = static_cast<char>(src[n]);
+}
+
 size_t
 wxMBConvStrictUTF8::ToWChar(wchar_t *dst, size_t dstLen,
                             const char *src, size_t srcLen) const
@@ -962,8 +1026,34 @@ wxMBConvStrictUTF8::ToWChar(wchar_t *dst, size_t dstLen,
     if ( srcLen == wxNO_LEN )
         srcLen = strlen(src) + 1;
 
+    // don't check for the ASCII blocks again before this position if the
+    // last check failed, as this would be too slow for non-ASCII text
+    const char *nextBlock = src;
+
     for ( const char *p = src; ; p++ )
     {
+        while ( p >= nextBlock && srcLen != wxNO_LEN &&
+                    srcLen >= utf8AsciiBlock &&
+                        (!out || dstLen >= utf8AsciiBlock) )
+        {
+            if ( !wxIsAsciiBlock(p) )
+            {
+                nextBlock = p + utf8AsciiBlock;
+                break;
+            }
+
+            if ( out )
+            {
+                wxCopyAsciiBlock(out, p);
+                out += utf8AsciiBlock;
+                dstLen -= utf8AsciiBlock;
+            }
+
+            p += utf8AsciiBlock;
+            srcLen -= utf8AsciiBlock;
+            written += utf8AsciiBlock;
+        }
+
         if ( (srcLen == wxNO_LEN ? !*p : !srcLen) )
         {
             // all done successfully, just add the trailing NUL if we are not
@@ -1075,8 +1165,36 @@ wxMBConvStrictUTF8::FromWChar(char *dst, size_t dstLen,
     size_t written = 0;
 
     const wchar_t* const end = srcLen == wxNO_LEN ? nullptr : src + srcLen;
+
+    // we can't read the blocks beyond the terminating NUL, so find it first
+    const size_t lenBlocks = end ? srcLen : wxWcslen(src);
+
+    // see the comment in ToWChar()
+    const wchar_t *nextBlock = src;
+
     for ( const wchar_t *wp = src; ; )
     {
+        while ( wp >= nextBlock &&
+                    lenBlocks - static_cast<size_t>(wp - src) >= utf8AsciiBlock &&
+                        (!out || dstLen >= utf8AsciiBlock) )
+        {
+            if ( !wxIsAsciiBlock(wp) )
+            {
+                nextBlock = wp + utf8AsciiBlock;
+                break;
+            }
+
+            if ( out )
+            {
+                wxCopyAsciiBlock(out, wp);
+                out += utf8AsciiBlock;
+                dstLen -= utf8AsciiBlock;
+            }
+
+            wp += utf8AsciiBlock;
+            written += utf8AsciiBlock;
+        }
+
         if ( end ? wp == end : !*wp )
         {
             // all done successfully, just add the trailing NUL if we are not
@@ -894,6 +894,23 @@ wxInputStream& wxInputStream::Read(wxOutputStream& stream_out)
 
     for ( ;; )
     {
+        // Avoid copying the data into our own buffer if possible.
+        const void* data;
+        const size_t bytes_buffered = PeekBuffer(&data);
+        if ( bytes_buffered )
+        {
+            const size_t bytes_written =
+                stream_out.Write(data, bytes_buffered).LastWrite();
+            ConsumeBuffer(bytes_written);
+
+            lastcount += bytes_written;
+
+            if ( bytes_written != bytes_buffered )
+                break;
+
+            continue;
+        }
+
         size_t bytes_read = Read(buf, WXSIZEOF(buf)).LastRead();
         if ( !bytes_read )
             break;
@@ -909,6 +926,58 @@ wxInputStream& wxInputStream::Read(wxOutputStream& stream_out)
     return *this;
 }
 
+size_t wxInputStream::PeekBuffer(const void **data)
+{
+    wxCHECK_MSG( data, 0, wxT("null data pointer") );
+
+    // The data in the write back buffer must be returned first.
+    if ( m_wback )
+    {
+        *data = m_wback + m_wbackcur;
+        return m_wbacksize - m_wbackcur;
+    }
+
+    if ( !IsOk() )
+        return 0;
+
+    return DoPeekBuffer(data);
+}
+
+void wxInputStream::ConsumeBuffer(size_t size)
+{
+    m_lastcount = size;
+
+    if ( m_wback )
+    {
+        wxCHECK_RET( size <= m_wbacksize - m_wbackcur,
+                     wxT("consuming more than was peeked") );
+
+        m_wbackcur += size;
+        if ( m_wbackcur == m_wbacksize )
+        {
+            free(m_wback);
+            m_wback = nullptr;
+            m_wbacksize = 0;
+            m_wbackcur = 0;
+        }
+
+        return;
+    }
+
+    if ( size )
+        DoConsumeBuffer(size);
+}
+
+size_t wxInputStream::DoPeekBuffer(const void ** WXUNUSED(data))
+{
+    return 0;
+}
+
+void wxInputStream::DoConsumeBuffer(size_t WXUNUSED(size))
+{
+    wxFAIL_MSG( wxT("must be overridden if DoPeekBuffer() is") );
+}
+
 bool wxInputStream::ReadAll(void *buffer_, size_t size)
 {
     char* buffer = static_cast<char*>(buffer_);
@@ -1443,6 +1512,23 @@ wxFileOffset wxBufferedInputStream::OnSysTell() const
     return m_parent_i_stream->TellI();
 }
 
+size_t wxBufferedInputStream::DoPeekBuffer(const void **data)
+{
+    // This fills the buffer if it's empty.
+    const size_t left = m_i_streambuf->GetDataLeft();
+    *data = m_i_streambuf->GetBufferPos();
+
+    return left;
+}
+
+void wxBufferedInputStream::DoConsumeBuffer(size_t size)
+{
+    wxCHECK_RET( size <= m_i_streambuf->GetBytesLeft(),
+                 wxT("consuming more than was peeked") );
+
+    m_i_streambuf->SetIntPosition(m_i_streambuf->GetIntPosition() + size);
+}
+
 void wxBufferedInputStream::SetInputStreamBuffer(wxStreamBuffer *buffer)
 {
     wxCHECK_RET( buffer, wxT("wxBufferedInputStream needs buffer") );
@@ -1624,6 +1710,22 @@ wxFileOffset wxWrapperInputStream::OnSysTell() const
     return m_parent_i_stream->TellI();
 }
 
+size_t wxWrapperInputStream::DoPeekBuffer(const void **data)
+{
+    wxCHECK_MSG(m_parent_i_stream, 0, "Stream not valid");
+
+    wxON_BLOCK_EXIT_THIS0(wxWrapperInputStream::SynchronizeLastError);
+    return m_parent_i_stream->PeekBuffer(data);
+}
+
+void wxWrapperInputStream::DoConsumeBuffer(size_t size)
+{
+    wxCHECK_RET(m_parent_i_stream, "Stream not valid");
+
+    wxON_BLOCK_EXIT_THIS0(wxWrapperInputStream::SynchronizeLastError);
+    m_parent_i_stream->ConsumeBuffer(size);
+}
+
 // ----------------------------------------------------------------------------
 // Some IOManip function
 // ----------------------------------------------------------------------------
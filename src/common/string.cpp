@@ -245,6 +245,18 @@ void wxString::PosLenToImpl(size_t pos, size_t len,
         }
         else // have valid length too
         {
+#if wxUSE_STRING_POS_CACHE
+            // there is no need to iterate over pure ASCII strings, see
+            // DoPosToImpl()
+            const size_t implLenTotal = m_impl.length();
+            const Cache::Element * const cache = FindCacheElement();
+            if ( cache && cache->len == implLenTotal && pos <= implLenTotal )
+            {
+                *implLen = wxMin(len, implLenTotal - pos);
+                return;
+            }
+#endif // wxUSE_STRING_POS_CACHE
+
             // we need to handle the case of length specifying a substring
             // going beyond the end of the string, just as std::string does
             const const_iterator e(end());
@@ -661,6 +673,36 @@ int wxString::compare(size_t nStart, size_t nLen,
 
 int wxString::compare(const char* sz) const
 {
+#if wxUSE_UNICODE_WCHAR
+    // Comparing with ASCII strings is very common and doesn't require
+    // converting them, which would allocate memory, if the current encoding
+    // is known to be ASCII-compatible.
+    if ( wxLocaleIsUtf8 )
+    {
+        const char* p = sz;
+        while ( *p && static_cast<unsigned char>(*p) < 0x80 )
+            p++;
+
+        if ( !*p )
+        {
+            const size_t len = m_impl.length();
+            for ( size_t n = 0; ; n++ )
+            {
+                const wchar_t chThis = n < len ? m_impl[n] : 0;
+                const wchar_t chOther = static_cast<unsigned char>(sz[n]);
+                if ( chThis != chOther || !chOther )
+                {
+                    // Also handle embedded NULs in this string correctly.
+                    if ( chThis == chOther && n < len )
+                        return 1;
+
+                    return chThis < chOther ? -1 : chThis > chOther ? 1 : 0;
+                }
+            }
+        }
+    }
+#endif // wxUSE_UNICODE_WCHAR
+
     return m_impl.compare(ImplStr(sz));
 }
 
@@ -1919,6 +1961,18 @@ int wxString::DoPrintfWchar(const wxChar *format, ...)
 
     return iLen;
 }
+
+int wxString::DoAppendFormatWchar(const wxChar *format, ...)
+{
+    va_list argptr;
+    va_start(argptr, format);
+
+    int iLen = AppendFormatV(format, argptr);
+
+    va_end(argptr);
+
+    return iLen;
+}
 #endif // !wxUSE_UTF8_LOCALE_ONLY
 
 #if wxUSE_UNICODE_UTF8
@@ -1933,6 +1987,18 @@ int wxString::DoPrintfUtf8(const char *format, ...)
 
     return iLen;
 }
+
+int wxString::DoAppendFormatUtf8(const char *format, ...)
+{
+    va_list argptr;
+    va_start(argptr, format);
+
+    int iLen = AppendFormatV(wxString::FromUTF8(format), argptr);
+
+    va_end(argptr);
+
+    return iLen;
+}
 #endif // wxUSE_UNICODE_UTF8
 
 /*
@@ -2071,21 +2137,120 @@ static int DoStringPrintfV(wxString& str,
     return str.length();
 }
 
-int wxString::PrintfV(const wxString& format, va_list argptr)
+// Size of the buffer on the stack used for formatting the strings short
+// enough to fit into it, which are the vast majority of them in practice.
+static const size_t FORMAT_STACK_BUFFER_SIZE = 512;
+
+// Format into the provided buffer of FORMAT_STACK_BUFFER_SIZE and return the
+// length of the result or -1 if it didn't fit or an error occurred.
+template <typename CharType>
+static int
+DoFormatIntoStackBuffer(CharType *buf, const wxString& format, va_list argptr)
+{
+    va_list argptrcopy;
+    wxVaCopy(argptrcopy, argptr);
+
+    const int len = wxVsnprintf(buf, FORMAT_STACK_BUFFER_SIZE, format, argptrcopy);
+    va_end(argptrcopy);
+
+    return len >= 0 && static_cast<size_t>(len) < FORMAT_STACK_BUFFER_SIZE
+            ? len
+            : -1;
+}
+
+int wxString::DoFormatV(const wxString& format, va_list argptr, bool append)
 {
+    PreserveErrno preserveErrno;
+
+    // Try formatting into a buffer on the stack first: if the result fits
+    // into it, the only memory allocation needed is the one for the string
+    // itself (if any, as its existing buffer may be big enough). Notice that
+    // we can't format directly into the string as the arguments may refer
+    // to its current contents.
+#if wxUSE_UNICODE_UTF8
+    #if !wxUSE_UTF8_LOCALE_ONLY
+    if ( wxLocaleIsUtf8 )
+    #endif
+    {
+        char buf[FORMAT_STACK_BUFFER_SIZE];
+        const int len = DoFormatIntoStackBuffer(buf, format, argptr);
+        if ( len >= 0 )
+        {
+            // the result must be validated as any (invalid) bytes could have
+            // been inserted into it by "%c" or similar
+            SubstrBufFromMB str(ImplStr(buf, len, wxMBConvStrictUTF8()));
+            if ( str.len == static_cast<size_t>(len) )
+            {
+                if ( !append )
+                    clear();
+
+                const size_t
+                    lenAdded = wxStringOperations::CountChars(str.data, str.len);
+                wxSTRING_UPDATE_CACHED_LENGTH(lenAdded);
+
+                m_impl.append(str.data, str.len);
+
+                return static_cast<int>(lenAdded);
+            }
+        }
+    }
+    #if !wxUSE_UTF8_LOCALE_ONLY
+    else
+    #endif
+#endif // wxUSE_UNICODE_UTF8
+#if !wxUSE_UTF8_LOCALE_ONLY
+    {
+        wchar_t buf[FORMAT_STACK_BUFFER_SIZE];
+        const int len = DoFormatIntoStackBuffer(buf, format, argptr);
+        if ( len >= 0 )
+        {
+            if ( append )
+                this->append(buf, len);
+            else
+                assign(buf, len);
+
+            return len;
+        }
+    }
+#endif // !wxUSE_UTF8_LOCALE_ONLY
+
+    // The result is too long, so format it into a separate string, allocating
+    // as much memory as needed.
+    wxString str;
 #if wxUSE_UTF8_LOCALE_ONLY
-    return DoStringPrintfV<wxUTF8StringBuffer>(*this, format, argptr);
+    const int len = DoStringPrintfV<wxUTF8StringBuffer>(str, format, argptr);
 #else
     #if wxUSE_UNICODE_UTF8
-    if ( wxLocaleIsUtf8 )
-        return DoStringPrintfV<wxUTF8StringBuffer>(*this, format, argptr);
-    else
-        // wxChar* version
-        return DoStringPrintfV<wxStringBuffer>(*this, format, argptr);
+    const int len = wxLocaleIsUtf8
+                        ? DoStringPrintfV<wxUTF8StringBuffer>(str, format, argptr)
+                        : DoStringPrintfV<wxStringBuffer>(str, format, argptr);
     #else
-        return DoStringPrintfV(*this, format, argptr);
+    const int len = DoStringPrintfV(str, format, argptr);
     #endif // UTF8/WCHAR
 #endif
+
+    if ( append )
+    {
+        if ( len > 0 )
+            *this += str;
+    }
+    else
+    {
+        // this also clears this string in case of error, as before
+        swap(str);
+    }
+
+    return len;
+}
+
+int wxString::PrintfV(const wxString& format, va_list argptr)
+{
+    return DoFormatV(format, argptr, false);
+}
+
+int wxString::AppendFormatV(const wxString& format, va_list argptr)
+{
+    return DoFormatV(format, argptr, true);
 }
 
 // ----------------------------------------------------------------------------
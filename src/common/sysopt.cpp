@@ -26,15 +26,16 @@
 #ifndef WX_PRECOMP
     #include "wx/app.h"
     #include "wx/string.h"
-    #include "wx/arrstr.h"
 #endif
 
+#include "wx/private/hashnocase.h"
+
 // ----------------------------------------------------------------------------
 // private globals
 // ----------------------------------------------------------------------------
 
-static wxArrayString gs_optionNames,
-                     gs_optionValues;
+// the option names are case-insensitive
+static wxStringNoCaseHashMap<wxString> gs_options;
 
 // ============================================================================
 // wxSystemOptions implementation
@@ -43,17 +44,7 @@ static wxArrayString gs_optionNames,
 // Option functions (arbitrary name/value mapping)
 void wxSystemOptions::SetOption(const wxString& name, const wxString& value)
 {
-    int idx = gs_optionNames.Index(name, false);
-    if (idx == wxNOT_FOUND)
-    {
-        gs_optionNames.Add(name);
-        gs_optionValues.Add(value);
-    }
-    else
-    {
-        gs_optionNames[idx] = name;
-        gs_optionValues[idx] = value;
-    }
+    gs_options[name] = value;
 }
 
 void wxSystemOptions::SetOption(const wxString& name, int value)
@@ -65,10 +56,10 @@ wxString wxSystemOptions::GetOption(const wxString& name)
 {
     wxString val;
 
-    int idx = gs_optionNames.Index(name, false);
-    if ( idx != wxNOT_FOUND )
+    const auto it = gs_options.find(name);
+    if ( it != gs_options.end() )
     {
-        val = gs_optionValues[idx];
+        val = it->second;
     }
     else // not set explicitly
     {
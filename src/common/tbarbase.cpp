@@ -63,6 +63,8 @@ wxToolBarToolBase::~wxToolBarToolBase()
 
     if ( IsControl() )
         GetControl()->Destroy();
+
+    wxUpdateUIEvent::ForgetElement(this);
 }
 
 
@@ -789,6 +791,9 @@ void wxToolBarBase::UpdateWindowUI(long flags)
         if ( tool->IsSeparator() )
             continue;
 
+        if ( wxUpdateUIEvent::IsUpToDate(tool) )
+            continue;
+
         int toolid = tool->GetId();
 
         wxUpdateUIEvent event(toolid);
@@ -808,6 +813,8 @@ void wxToolBarBase::UpdateWindowUI(long flags)
                 // Set tooltip?
 #endif // 0
         }
+
+        event.RememberDependencies(tool);
     }
 }
 
@@ -29,6 +29,7 @@
 #endif // WX_PRECOMP
 
 #include "wx/ffile.h"
+#include "wx/timer.h"
 
 extern WXDLLEXPORT_DATA(const char) wxTextCtrlNameStr[] = "text";
 
@@ -1173,6 +1174,137 @@ bool wxTextCtrlBase::EmulateKeyPress(const wxKeyEvent& event)
     return handled;
 }
 
+// ----------------------------------------------------------------------------
+// buffered appending
+// ----------------------------------------------------------------------------
+
+// Accumulates the text passed to AppendTextBuffered() and flushes it from the
+// timer, if available, expiring after a delay corresponding to a display frame.
+class wxTextCtrlBase::AppendBuffer
+#if wxUSE_TIMER
+    : public wxTimer
+#endif // wxUSE_TIMER
+{
+public:
+    explicit AppendBuffer(wxTextCtrlBase* text)
+        : m_text(text)
+    {
+    }
+
+    // schedule appending the pending text, if not done yet
+    void ScheduleFlush()
+    {
+#if wxUSE_TIMER
+        if ( !IsRunning() )
+            StartOnce(FLUSH_DELAY);
+#else // !wxUSE_TIMER
+        m_text->FlushBufferedText();
+#endif // wxUSE_TIMER/!wxUSE_TIMER
+    }
+
+    void CancelFlush()
+    {
+#if wxUSE_TIMER
+        Stop();
+#endif // wxUSE_TIMER
+    }
+
+#if wxUSE_TIMER
+    virtual void Notify() override
+    {
+        m_text->FlushBufferedText();
+    }
+#endif // wxUSE_TIMER
+
+    // the text not appended to the control yet
+    wxString m_pending;
+
+    // the value set by SetMaxLines()
+    int m_maxLines = 0;
+
+private:
+    // delay before appending the text, in ms, roughly one frame at 60Hz
+    static const int FLUSH_DELAY = 16;
+
+    wxTextCtrlBase* const m_text;
+
+    wxDECLARE_NO_COPY_CLASS(AppendBuffer);
+};
+
+wxTextCtrlBase::wxTextCtrlBase() = default;
+
+wxTextCtrlBase::~wxTextCtrlBase() = default;
+
+void wxTextCtrlBase::AppendTextBuffered(const wxString& text)
+{
+    if ( !m_appendBuffer )
+        m_appendBuffer.reset(new AppendBuffer(this));
+
+    m_appendBuffer->m_pending += text;
+    m_appendBuffer->ScheduleFlush();
+}
+
+void wxTextCtrlBase::FlushBufferedText()
+{
+    if ( !m_appendBuffer )
+        return;
+
+    m_appendBuffer->CancelFlush();
+
+    if ( m_appendBuffer->m_pending.empty() )
+        return;
+
+    wxString text;
+    text.swap(m_appendBuffer->m_pending);
+
+    AppendText(text);
+
+    TrimToMaxLines();
+}
+
+void wxTextCtrlBase::SetMaxLines(int maxLines)
+{
+    wxCHECK_RET( maxLines >= 0, wxS("invalid number of lines") );
+
+    if ( !m_appendBuffer )
+    {
+        if ( !maxLines )
+            return;
+
+        m_appendBuffer.reset(new AppendBuffer(this));
+    }
+
+    m_appendBuffer->m_maxLines = maxLines;
+
+    TrimToMaxLines();
+}
+
+int wxTextCtrlBase::GetMaxLines() const
+{
+    return m_appendBuffer ? m_appendBuffer->m_maxLines : 0;
+}
+
+void wxTextCtrlBase::TrimToMaxLines()
+{
+    const int maxLines = m_appendBuffer->m_maxLines;
+    if ( !maxLines || !IsMultiLine() )
+        return;
+
+    int numLines = GetNumberOfLines();
+
+    // don't count the empty line after the trailing newline
+    if ( numLines > 0 && !GetLineLength(numLines - 1) )
+        numLines--;
+
+    if ( numLines <= maxLines )
+        return;
+
+    // remove all the lines in excess at once
+    const long end = XYToPosition(0, numLines - maxLines);
+    if ( end > 0 )
+        Remove(0, end);
+}
+
 // ----------------------------------------------------------------------------
 // Other miscellaneous stuff
 // ----------------------------------------------------------------------------
@@ -111,6 +111,16 @@ void wxTextMeasureBase::GetMultiLineTextExtent(const wxString& text,
                                                wxCoord *width,
                                                wxCoord *height,
                                                wxCoord *heightOneLine)
+{
+    MeasuringGuard guard(*this);
+
+    DoGetMultiLineTextExtent(text, width, height, heightOneLine);
+}
+
+void wxTextMeasureBase::DoGetMultiLineTextExtent(const wxString& text,
+                                                 wxCoord *width,
+                                                 wxCoord *height,
+                                                 wxCoord *heightOneLine)
 {
     // To make the code simpler, make sure that the width and height pointers
     // are always valid, by making them point to dummy variables if necessary.
@@ -123,8 +133,6 @@ void wxTextMeasureBase::GetMultiLineTextExtent(const wxString& text,
     *width = 0;
     *height = 0;
 
-    MeasuringGuard guard(*this);
-
     // It's noticeably faster to handle the case of a string which isn't
     // actually multiline specially here, to skip iteration above in this case.
     if ( text.find('\n') == wxString::npos )
@@ -208,6 +216,34 @@ wxSize wxTextMeasureBase::GetLargestStringExtent(size_t n,
     return wxSize(widthMax, heightMax);
 }
 
+void wxTextMeasureBase::GetTextExtents(size_t n,
+                                       const wxString* strings,
+                                       wxArrayInt& widths,
+                                       wxArrayInt* heights)
+{
+    widths.clear();
+    widths.reserve(n);
+    if ( heights )
+    {
+        heights->clear();
+        heights->reserve(n);
+    }
+
+    // Set up the font only once for all the strings instead of doing it for
+    // each of them, as GetMultiLineTextExtent() would do.
+    MeasuringGuard guard(*this);
+
+    wxCoord w, h;
+    for ( size_t i = 0; i < n; ++i )
+    {
+        DoGetMultiLineTextExtent(strings[i], &w, &h);
+
+        widths.push_back(w);
+        if ( heights )
+            heights->push_back(h);
+    }
+}
+
 bool wxTextMeasureBase::GetPartialTextExtents(const wxString& text,
                                               wxArrayInt& widths,
                                               double scaleX)
@@ -0,0 +1,546 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        src/common/threadpool.cpp
+// Purpose:     wxThreadPool implementation and wxParallelFor() using it
+// Author:      wxWidgets team
+// Created:     2026-10-14
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+// ============================================================================
+// declarations
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// headers
+// ----------------------------------------------------------------------------
+
+// for compilers that support precompilation, includes "wx.h".
+#include "wx/wxprec.h"
+
+
+#include "wx/private/parallel.h"
+
+#if wxUSE_THREADS
+
+#ifndef WX_PRECOMP
+    #include "wx/module.h"
+#endif // WX_PRECOMP
+
+#include "wx/thread.h"
+#include "wx/threadpool.h"
+
+#include <atomic>
+#include <algorithm>
+#include <deque>
+#include <memory>
+#include <vector>
+
+// ----------------------------------------------------------------------------
+// constants
+// ----------------------------------------------------------------------------
+
+namespace
+{
+
+// Maximal number of worker threads we create, whatever is requested.
+constexpr int MAX_WORKER_THREADS = 256;
+
+// Number of bands to split the range into for each thread: using more than
+// one band per thread allows to balance the load between the threads better
+// when some bands take longer to process than the others.
+constexpr int BANDS_PER_THREAD = 4;
+
+using Task = std::function<void ()>;
+
+// ----------------------------------------------------------------------------
+// PoolWorker: data associated with a single worker thread
+// ----------------------------------------------------------------------------
+
+struct PoolWorker
+{
+    PoolWorker() = default;
+
+    // The pool this worker belongs to.
+    wxThreadPoolImpl* pool = nullptr;
+
+    // The thread itself, only non-null once it has been started.
+    wxThread* thread = nullptr;
+
+    // Protects the tasks queue below.
+    wxMutex mutex;
+
+    // Tasks submitted from this worker thread itself: they're taken by the
+    // worker from the back of the queue, as the most recently submitted tasks
+    // are likely to use the data still in the cache, while the other workers
+    // steal them from the front.
+    std::deque<Task> tasks;
+
+    wxDECLARE_NO_COPY_CLASS(PoolWorker);
+};
+
+// The worker running in the current thread, if any.
+thread_local PoolWorker* gs_currentWorker = nullptr;
+
+} // anonymous namespace
+
+// ----------------------------------------------------------------------------
+// wxThreadPoolImpl: work-stealing pool of threads
+// ----------------------------------------------------------------------------
+
+class wxThreadPoolImpl
+{
+public:
+    explicit wxThreadPoolImpl(int maxThreads)
+        : m_maxThreads(maxThreads),
+          m_workers(new PoolWorker[maxThreads]),
+          m_numWorkers(0),
+          m_numPending(0),
+          m_cond(m_mutex),
+          m_numIdle(0),
+          m_shutdown(false)
+    {
+        for ( int n = 0; n < m_maxThreads; n++ )
+            m_workers[n].pool = this;
+    }
+
+    ~wxThreadPoolImpl()
+    {
+        wxASSERT_MSG( !GetCurrentWorker(),
+                      wxS("thread pool can't be destroyed from its own thread") );
+
+        {
+            wxMutexLocker lock(m_mutex);
+            m_shutdown = true;
+            m_cond.Broadcast();
+        }
+
+        // The workers only exit when there are no more tasks to do.
+        const int numWorkers = m_numWorkers;
+        for ( int n = 0; n < numWorkers; n++ )
+        {
+            wxThread* const thread = m_workers[n].thread;
+            thread->Wait();
+            delete thread;
+        }
+    }
+
+    int GetMaxThreads() const { return m_maxThreads; }
+
+    int GetThreadCount() const { return m_numWorkers; }
+
+    // Return the worker running in the current thread if it belongs to this
+    // pool or null otherwise.
+    PoolWorker* GetCurrentWorker() const
+    {
+        return gs_currentWorker && gs_currentWorker->pool == this
+                ? gs_currentWorker
+                : nullptr;
+    }
+
+    void Submit(Task&& task)
+    {
+        PoolWorker* const self = GetCurrentWorker();
+        if ( self )
+        {
+            wxMutexLocker lock(self->mutex);
+            self->tasks.push_back(std::move(task));
+        }
+
+        Task taskNow;
+        {
+            wxMutexLocker lock(m_mutex);
+
+            if ( !self )
+                m_queue.push_back(std::move(task));
+
+            // Note that this must be done while holding m_mutex to ensure that
+            // no worker starts waiting after checking m_numPending but before
+            // we signal the condition below.
+            ++m_numPending;
+
+            // Start a new thread if the idle ones are not enough to execute
+            // all the pending tasks.
+            if ( m_numPending > m_numIdle && m_numWorkers < m_maxThreads )
+                StartWorker();
+
+            if ( m_numIdle > 0 )
+                m_cond.Signal();
+
+            if ( m_numWorkers )
+                return;
+
+            // We can't run the task in any other thread, so do it right now.
+            taskNow = std::move(m_queue.back());
+            m_queue.pop_back();
+            --m_numPending;
+        }
+
+        taskNow();
+    }
+
+private:
+    class WorkerThread : public wxThread
+    {
+    public:
+        WorkerThread(wxThreadPoolImpl& pool, PoolWorker& worker)
+            : wxThread(wxTHREAD_JOINABLE),
+              m_pool(pool),
+              m_worker(worker)
+        {
+        }
+
+    protected:
+        virtual ExitCode Entry() override
+        {
+            m_pool.WorkerLoop(m_worker);
+
+            return nullptr;
+        }
+
+    private:
+        wxThreadPoolImpl& m_pool;
+        PoolWorker& m_worker;
+    };
+
+    // Start a new worker thread, must be called with m_mutex locked.
+    bool StartWorker()
+    {
+        PoolWorker& worker = m_workers[m_numWorkers];
+
+        wxThread* const thread = new WorkerThread(*this, worker);
+        if ( thread->Run() != wxTHREAD_NO_ERROR )
+        {
+            // Not being able to create more threads is not fatal, the existing
+            // ones will do.
+            delete thread;
+            return false;
+        }
+
+        worker.thread = thread;
+        ++m_numWorkers;
+
+        return true;
+    }
+
+    // Find a task to execute in the given worker thread.
+    bool TakeTask(PoolWorker& self, Task& task)
+    {
+        // Start with our own tasks.
+        {
+            wxMutexLocker lock(self.mutex);
+            if ( !self.tasks.empty() )
+            {
+                task = std::move(self.tasks.back());
+                self.tasks.pop_back();
+                --m_numPending;
+                return true;
+            }
+        }
+
+        // Then check for the tasks submitted from outside of the pool.
+        {
+            wxMutexLocker lock(m_mutex);
+            if ( !m_queue.empty() )
+            {
+                task = std::move(m_queue.front());
+                m_queue.pop_front();
+                --m_numPending;
+                return true;
+            }
+        }
+
+        // Finally try to steal a task from another worker.
+        const int numWorkers = m_numWorkers;
+        for ( int n = 0; n < numWorkers; n++ )
+        {
+            PoolWorker& other = m_workers[n];
+            if ( &other == &self )
+                continue;
+
+            wxMutexLocker lock(other.mutex);
+            if ( !other.tasks.empty() )
+            {
+                task = std::move(other.tasks.front());
+                other.tasks.pop_front();
+                --m_numPending;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    // Function executed by the worker threads.
+    void WorkerLoop(PoolWorker& self)
+    {
+        gs_currentWorker = &self;
+
+        for ( ;; )
+        {
+            Task task;
+            if ( TakeTask(self, task) )
+            {
+                task();
+                continue;
+            }
+
+            wxMutexLocker lock(m_mutex);
+
+            // Some task could have been added since we checked.
+            if ( m_numPending > 0 )
+                continue;
+
+            if ( m_shutdown )
+                break;
+
+            ++m_numIdle;
+            m_cond.Wait();
+            --m_numIdle;
+        }
+
+        gs_currentWorker = nullptr;
+    }
+
+
+    const int m_maxThreads;
+
+    // All the workers, only the first m_numWorkers of them are used.
+    const std::unique_ptr<PoolWorker[]> m_workers;
+
+    // The number of started workers, only modified with m_mutex locked.
+    std::atomic<int> m_numWorkers;
+
+    // The number of tasks not taken by any worker yet.
+    std::atomic<int> m_numPending;
+
+    // Protects the fields below.
+    wxMutex m_mutex;
+
+    // Signalled when a new task is added or we're shutting down.
+    wxCondition m_cond;
+
+    // Tasks submitted from outside of the pool threads.
+    std::deque<Task> m_queue;
+
+    // The number of workers waiting for m_cond.
+    int m_numIdle;
+
+    bool m_shutdown;
+
+    wxDECLARE_NO_COPY_CLASS(wxThreadPoolImpl);
+};
+
+namespace
+{
+
+// ----------------------------------------------------------------------------
+// ParallelJob: a range to be processed in bands by several threads
+// ----------------------------------------------------------------------------
+
+class ParallelJob
+{
+public:
+    ParallelJob(int count,
+                int numBands,
+                const std::function<void (int, int)>& func)
+        : m_func(func),
+          m_count(count),
+          m_numBands(numBands),
+          m_nextBand(0),
+          m_doneBands(0),
+          m_doneCond(m_doneMutex)
+    {
+    }
+
+    // Process the bands not taken by any other thread yet, until there are
+    // no more of them.
+    //
+    // Note that this may be called after WaitUntilDone() returned, when the
+    // function is not valid any more, but it's not used then.
+    void Run()
+    {
+        for ( ;; )
+        {
+            const int band = m_nextBand++;
+            if ( band >= m_numBands )
+                break;
+
+            // Compute the band boundaries in a way ensuring that they cover
+            // the entire range without any gaps.
+            const long long count = m_count;
+            const int start = static_cast<int>(count*band / m_numBands);
+            const int end = static_cast<int>(count*(band + 1) / m_numBands);
+            m_func(start, end);
+
+            if ( ++m_doneBands == m_numBands )
+            {
+                wxMutexLocker lock(m_doneMutex);
+                m_doneCond.Broadcast();
+            }
+        }
+    }
+
+    // Wait until all bands have been processed.
+    void WaitUntilDone()
+    {
+        wxMutexLocker lock(m_doneMutex);
+        while ( m_doneBands < m_numBands )
+            m_doneCond.Wait();
+    }
+
+private:
+    const std::function<void (int, int)>& m_func;
+
+    const int m_count;
+    const int m_numBands;
+
+    // Index of the next band to process and the number of processed bands.
+    std::atomic<int> m_nextBand,
+                     m_doneBands;
+
+    wxMutex m_doneMutex;
+    wxCondition m_doneCond;
+
+    wxDECLARE_NO_COPY_CLASS(ParallelJob);
+};
+
+// The global pool, created on demand.
+wxThreadPool* gs_threadPool = nullptr;
+
+// Critical section protecting gs_threadPool creation.
+wxCriticalSection gs_threadPoolCS;
+
+} // anonymous namespace
+
+// ----------------------------------------------------------------------------
+// module destroying the global pool on library shutdown
+// ----------------------------------------------------------------------------
+
+class wxThreadPoolModule : public wxModule
+{
+public:
+    wxThreadPoolModule() = default;
+
+    virtual bool OnInit() override { return true; }
+    virtual void OnExit() override
+    {
+        delete gs_threadPool;
+        gs_threadPool = nullptr;
+    }
+
+private:
+    wxDECLARE_DYNAMIC_CLASS(wxThreadPoolModule);
+};
+
+wxIMPLEMENT_DYNAMIC_CLASS(wxThreadPoolModule, wxModule);
+
+// ============================================================================
+// implementation
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// wxThreadPool
+// ----------------------------------------------------------------------------
+
+namespace
+{
+
+int GetPoolThreadCount(int maxThreads)
+{
+    if ( maxThreads <= 0 )
+        maxThreads = wxThread::GetCPUCount();
+
+    return wxClip(maxThreads, 1, MAX_WORKER_THREADS);
+}
+
+} // anonymous namespace
+
+wxThreadPool::wxThreadPool(int maxThreads)
+    : m_impl(new wxThreadPoolImpl(GetPoolThreadCount(maxThreads)))
+{
+}
+
+wxThreadPool::~wxThreadPool()
+{
+    delete m_impl;
+}
+
+/* static */
+wxThreadPool& wxThreadPool::Get()
+{
+    wxCriticalSectionLocker lock(gs_threadPoolCS);
+    if ( !gs_threadPool )
+        gs_threadPool = new wxThreadPool;
+
+    return *gs_threadPool;
+}
+
+int wxThreadPool::GetMaxThreads() const
+{
+    return m_impl->GetMaxThreads();
+}
+
+int wxThreadPool::GetThreadCount() const
+{
+    return m_impl->GetThreadCount();
+}
+
+bool wxThreadPool::IsWorkerThread() const
+{
+    return m_impl->GetCurrentWorker() != nullptr;
+}
+
+void wxThreadPool::DoSubmit(std::function<void ()> task)
+{
+    m_impl->Submit(std::move(task));
+}
+
+// ----------------------------------------------------------------------------
+// wxParallelFor
+// ----------------------------------------------------------------------------
+
+void
+wxParallelFor(int count,
+              int numThreads,
+              const std::function<void (int start, int end)>& func)
+{
+    if ( count <= 0 )
+        return;
+
+    numThreads = std::min(numThreads, count);
+    if ( numThreads <= 1 )
+    {
+        func(0, count);
+        return;
+    }
+
+    wxThreadPool& pool = wxThreadPool::Get();
+
+    const int numBands = std::min(count, numThreads*BANDS_PER_THREAD);
+    const auto job = std::make_shared<ParallelJob>(count, numBands, func);
+
+    // The current thread processes the bands too, so we need one helper less.
+    // The helpers may not get to run before all the bands are processed, in
+    // which case they just won't do anything.
+    numThreads = std::min(numThreads - 1, pool.GetMaxThreads());
+    for ( int n = 0; n < numThreads; n++ )
+        pool.Submit([job]() { job->Run(); });
+
+    job->Run();
+
+    job->WaitUntilDone();
+}
+
+#else // !wxUSE_THREADS
+
+void
+wxParallelFor(int count,
+              int WXUNUSED(numThreads),
+              const std::function<void (int start, int end)>& func)
+{
+    if ( count > 0 )
+        func(0, count);
+}
+
+#endif // wxUSE_THREADS/!wxUSE_THREADS
@@ -133,5 +133,20 @@ bool wxTimer::IsOneShot() const
     return m_impl->IsOneShot();
 }
 
+void wxTimer::SetTolerance(int milliseconds)
+{
+    wxCHECK_RET( m_impl, wxT("uninitialized timer") );
+    wxCHECK_RET( milliseconds >= 0, wxT("invalid timer tolerance") );
+
+    m_impl->SetTolerance(milliseconds);
+}
+
+int wxTimer::GetTolerance() const
+{
+    wxCHECK_MSG( m_impl, 0, wxT("uninitialized timer") );
+
+    return m_impl->GetTolerance();
+}
+
 #endif // wxUSE_TIMER
 
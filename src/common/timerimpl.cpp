@@ -34,6 +34,7 @@ wxTimerImpl::wxTimerImpl(wxTimer *timer)
     m_idTimer = wxID_ANY;
     m_milli = 0;
     m_oneShot = false;
+    m_tolerance = 0;
 }
 
 void wxTimerImpl::SetOwner(wxEvtHandler *owner, int timerid)
@@ -40,11 +40,13 @@
 #include "wx/dir.h"
 #include "wx/file.h"
 #include "wx/filename.h"
+#include "wx/mappedfile.h"
 #include "wx/tokenzr.h"
 #include "wx/fontmap.h"
 #include "wx/stdpaths.h"
 #include "wx/version.h"
 #include "wx/uilocale.h"
+#include "wx/thread.h"
 
 #ifdef __WINDOWS__
     #include "wx/dynlib.h"
@@ -853,15 +855,28 @@ public:
     wxMsgCatalogFile();
     ~wxMsgCatalogFile();
 
-    // load the catalog from disk
+    // load the catalog from disk, mapping it into memory instead of reading
+    // it if map is true
     bool LoadFile(const wxString& filename,
-                  wxPluralFormsCalculatorPtr& rPluralFormsCalculator);
+                  wxPluralFormsCalculatorPtr& rPluralFormsCalculator,
+                  bool map = false);
     bool LoadData(const DataBuffer& data,
                   wxPluralFormsCalculatorPtr& rPluralFormsCalculator);
 
     // fills the hash with string-translation pairs
     bool FillHash(wxTranslationsHashMap& hash, const wxString& domain) const;
 
+    // return true if the catalog has a usable hash table
+    bool HasHashTable() const { return m_pHashTable != nullptr; }
+
+    // find the translation of the given msgid, in the catalog charset, using
+    // the hash table: returns the translated strings, including all plural
+    // forms separated by NULs, and their total length or nullptr if not found
+    const char* FindTranslation(const char* msgid, size_t32& len) const;
+
+    // the conversion to use for the catalog strings
+    wxMBConv& GetConv() const { return *m_conv; }
+
     // return the charset of the strings in this catalog or empty string if
     // none/unknown
     wxString GetCharset() const { return m_charset; }
@@ -888,6 +903,9 @@ private:
                   ofsHashTable;   //        +18:  offset of hash table start
     };
 
+    // the file mapped into memory, if LoadFile() was asked to map it
+    wxMappedFile m_mappedFile;
+
     // all data is stored here
     DataBuffer m_data;
 
@@ -897,8 +915,17 @@ private:
     wxMsgTableEntry  *m_pOrigTable,   // pointer to original   strings
                      *m_pTransTable;  //            translated
 
+    // hash table, if present
+    size_t32          m_nHashSize = 0;
+    const size_t32   *m_pHashTable = nullptr;
+
     wxString m_charset;               // from the message catalog header
 
+    // conversion used for the strings, points either to m_convOwned or to
+    // the global conversion object
+    wxMBConv* m_conv = nullptr;
+    std::unique_ptr<wxMBConv> m_convOwned;
+
 
     // swap the 2 halves of 32 bit integer if needed
     size_t32 Swap(size_t32 ui) const
@@ -941,8 +968,26 @@ wxMsgCatalogFile::~wxMsgCatalogFile()
 
 // open disk file and read in its contents
 bool wxMsgCatalogFile::LoadFile(const wxString& filename,
-                                wxPluralFormsCalculatorPtr& rPluralFormsCalculator)
+                                wxPluralFormsCalculatorPtr& rPluralFormsCalculator,
+                                bool map)
 {
+    if ( map && m_mappedFile.Open(filename) && m_mappedFile.GetData() )
+    {
+        if ( !LoadData
+              (
+                DataBuffer::CreateNonOwned(m_mappedFile.GetData(),
+                                           m_mappedFile.GetLength()),
+                rPluralFormsCalculator
+              ) )
+        {
+            wxLogWarning(_("'%s' is not a valid message catalog."), filename);
+            return false;
+        }
+
+        return true;
+    }
+    //else: fall back to reading the file if it couldn't be mapped
+
     wxFile fileMsg(filename);
     if ( !fileMsg.IsOpened() )
         return false;
@@ -1008,6 +1053,22 @@ bool wxMsgCatalogFile::LoadData(const DataBuffer& data,
     m_pTransTable = reinterpret_cast<const wxMsgTableEntry*>(data.data() +
                     Swap(pHeader->ofsTransTable));
 
+    // the hash table is optional and we only use it if it looks valid, notice
+    // that its size must be greater than 2 for the lookup algorithm to work
+    m_nHashSize = Swap(pHeader->nHashSize);
+    const size_t32 ofsHashTable = Swap(pHeader->ofsHashTable);
+    if ( m_nHashSize > 2 &&
+            ofsHashTable <= data.length() &&
+                m_nHashSize <= (data.length() - ofsHashTable) / sizeof(size_t32) )
+    {
+        m_pHashTable = reinterpret_cast<const size_t32*>(data.data() +
+                       ofsHashTable);
+    }
+    else
+    {
+        m_pHashTable = nullptr;
+    }
+
     // now parse catalog's header and try to extract catalog charset and
     // plural forms formula from it:
 
@@ -1064,35 +1125,89 @@ bool wxMsgCatalogFile::LoadData(const DataBuffer& data,
             rPluralFormsCalculator.reset(wxPluralFormsCalculator::make());
     }
 
+    if ( !m_charset.empty() )
+    {
+        m_convOwned.reset(new wxCSConv(m_charset));
+        m_conv = m_convOwned.get();
+    }
+    else // no need to convert the encoding
+    {
+        // we must somehow convert the narrow strings in the message catalog to
+        // wide strings, so use the default conversion if we have no charset
+        m_conv = wxConvCurrent;
+    }
+
     // everything is fine
     return true;
 }
 
-bool wxMsgCatalogFile::FillHash(wxTranslationsHashMap& hash,
-                                const wxString& domain) const
+const char* wxMsgCatalogFile::FindTranslation(const char* msgid,
+                                              size_t32& len) const
 {
-    wxUnusedVar(domain); // silence warning in Unicode build
+    wxCHECK_MSG( m_pHashTable, nullptr, "no hash table in the catalog" );
 
-    // conversion to use to convert catalog strings to the GUI encoding
-    wxMBConv *inputConv = nullptr;
+    // This is the same algorithm as used by GNU gettext, which created the
+    // hash table, see hash-string.c and _nl_find_msg() in dcigettext.c.
+    size_t32 hashVal = 0;
+    size_t32 msgidLen = 0;
+    for ( const char* p = msgid; *p; ++p, ++msgidLen )
+    {
+        hashVal = (hashVal << 4) + static_cast<unsigned char>(*p);
+        const size_t32 g = hashVal & (size_t32(0xf) << 28);
+        if ( g )
+        {
+            hashVal ^= g >> 24;
+            hashVal ^= g;
+        }
+    }
 
-    std::unique_ptr<wxMBConv> inputConvPtr; // just to delete inputConv if needed
+    size_t32 idx = hashVal % m_nHashSize;
+    const size_t32 incr = 1 + hashVal % (m_nHashSize - 2);
 
-    if ( !m_charset.empty() )
+    // Limit the number of probes to avoid looping forever in a corrupted
+    // file which doesn't have any empty entries in its hash table.
+    for ( size_t32 probes = 0; probes < m_nHashSize; probes++ )
     {
-        inputConv = new wxCSConv(m_charset);
+        size_t32 nstr = Swap(m_pHashTable[idx]);
+        if ( !nstr )
+            return nullptr; // empty entry, the string is not in the catalog
 
-        // As we allocated it ourselves, we need to delete it, so ensure
-        // this happens.
-        inputConvPtr.reset(inputConv);
-    }
-    else // no need to convert the encoding
-    {
-        // we must somehow convert the narrow strings in the message catalog to
-        // wide strings, so use the default conversion if we have no charset
-        inputConv = wxConvCurrent;
+        // the indices in the hash table are 1-based
+        nstr--;
+
+        // Note that the length of the original string may be greater than
+        // that of msgid as it also contains the plural form, if any, after
+        // the singular one, which is what we compare with.
+        if ( nstr < m_numStrings && Swap(m_pOrigTable[nstr].nLen) >= msgidLen )
+        {
+            const char* const orig = StringAtOfs(m_pOrigTable, nstr);
+            if ( orig && strcmp(orig, msgid) == 0 )
+            {
+                const char* const trans = StringAtOfs(m_pTransTable, nstr);
+                if ( trans )
+                    len = Swap(m_pTransTable[nstr].nLen);
+
+                return trans;
+            }
+        }
+
+        if ( idx >= m_nHashSize - incr )
+            idx -= m_nHashSize - incr;
+        else
+            idx += incr;
     }
 
+    return nullptr;
+}
+
+bool wxMsgCatalogFile::FillHash(wxTranslationsHashMap& hash,
+                                const wxString& domain) const
+{
+    wxUnusedVar(domain); // silence warning in Unicode build
+
+    // conversion to use to convert catalog strings to the GUI encoding
+    wxMBConv* const inputConv = m_conv;
+
     for (size_t32 i = 0; i < m_numStrings; i++)
     {
         const char *data = StringAtOfs(m_pOrigTable, i);
@@ -1138,6 +1253,22 @@ bool wxMsgCatalogFile::FillHash(wxTranslationsHashMap& hash,
 // wxMsgCatalog class
 // ----------------------------------------------------------------------------
 
+// Data used by the lazily loaded catalogs.
+struct wxMsgCatalog::LazyData
+{
+    wxMsgCatalogFile m_file;
+
+    // the strings which were looked up but not found in the catalog
+    std::unordered_set<wxString> m_missing;
+
+#if wxUSE_THREADS
+    // protects m_messages and m_missing which are modified by GetString()
+    wxCriticalSection m_cs;
+#endif // wxUSE_THREADS
+};
+
+int wxMsgCatalog::ms_defaultLoadFlags = 0;
+
 wxMsgCatalog::wxMsgCatalog(const wxString& domain)
     : m_pNext(nullptr), m_domain(domain)
 {
@@ -1151,6 +1282,28 @@ wxMsgCatalog *wxMsgCatalog::CreateFromFile(const wxString& filename,
 {
     std::unique_ptr<wxMsgCatalog> cat(new wxMsgCatalog(domain));
 
+    if ( ms_defaultLoadFlags & Load_Lazy )
+    {
+        std::unique_ptr<LazyData> lazy(new LazyData);
+
+        if ( !lazy->m_file.LoadFile(filename, cat->m_pluralFormsCalculator,
+                                    true /* map */) )
+            return nullptr;
+
+        // Without the hash table we can't look up the strings efficiently,
+        // so just load all of them, as usual, if there is none.
+        if ( lazy->m_file.HasHashTable() )
+        {
+            cat->m_lazy = std::move(lazy);
+            return cat.release();
+        }
+
+        if ( !lazy->m_file.FillHash(cat->m_messages, domain) )
+            return nullptr;
+
+        return cat.release();
+    }
+
     wxMsgCatalogFile file;
 
     if ( !file.LoadFile(filename, cat->m_pluralFormsCalculator) )
@@ -1186,6 +1339,16 @@ const wxString *wxMsgCatalog::GetString(const wxString& str, unsigned n, const w
     {
         index = m_pluralFormsCalculator->evaluate(n);
     }
+
+    if ( m_lazy )
+    {
+        if (context.IsEmpty())
+            return DoLazyLookup(index ? str + wxChar(index) : str, str, index);
+
+        const wxString msgid = context + wxString('\x04') + str;
+        return DoLazyLookup(index ? msgid + wxChar(index) : msgid, msgid, index);
+    }
+
     wxTranslationsHashMap::const_iterator i;
     if (index != 0)
     {
@@ -1210,6 +1373,54 @@ const wxString *wxMsgCatalog::GetString(const wxString& str, unsigned n, const w
         return nullptr;
 }
 
+const wxString *wxMsgCatalog::DoLazyLookup(const wxString& key,
+                                           const wxString& msgid,
+                                           int index) const
+{
+#if wxUSE_THREADS
+    // GetString() may be called from multiple threads and, unlike in non-lazy
+    // mode, we modify the data here.
+    wxCriticalSectionLocker lock(m_lazy->m_cs);
+#endif // wxUSE_THREADS
+
+    const wxTranslationsHashMap::const_iterator i = m_messages.find(key);
+    if ( i != m_messages.end() )
+        return &i->second;
+
+    if ( m_lazy->m_missing.count(key) )
+        return nullptr;
+
+    const wxMsgCatalogFile& file = m_lazy->m_file;
+
+    size_t32 length = 0;
+    const wxCharBuffer msgidConv = msgid.mb_str(file.GetConv());
+    const char* const data = msgidConv.data()
+                                ? file.FindTranslation(msgidConv, length)
+                                : nullptr;
+
+    // Find the plural form with the given index, see the comment in FillHash()
+    // about the access to the data.
+    size_t offset = 0;
+    for ( int n = 0; data && offset < length; n++ )
+    {
+        const char * const str = data + offset;
+        if ( n == index )
+        {
+            wxString msgstr(str, file.GetConv());
+            if ( msgstr.empty() )
+                break;
+
+            return &(m_messages[key] = msgstr);
+        }
+
+        offset += wxStrnlen(str, length - offset) + 1;
+    }
+
+    m_lazy->m_missing.insert(key);
+
+    return nullptr;
+}
+
 
 // ----------------------------------------------------------------------------
 // wxTranslations
@@ -1224,6 +1435,17 @@ bool gs_translationsOwned = false;
 } // anonymous namespace
 
 
+std::atomic<unsigned> wxTranslations::ms_generation{1};
+
+/*static*/
+void wxTranslations::IncrementGeneration()
+{
+    // Skip the special values used by wxTranslationCache when wrapping around.
+    unsigned generation = ++ms_generation;
+    while ( generation == 0 || generation == static_cast<unsigned>(-1) )
+        generation = ++ms_generation;
+}
+
 /*static*/
 wxTranslations *wxTranslations::Get()
 {
@@ -1233,6 +1455,8 @@ wxTranslations *wxTranslations::Get()
 /*static*/
 void wxTranslations::Set(wxTranslations *t)
 {
+    IncrementGeneration();
+
     if ( gs_translationsOwned )
         delete gs_translations;
     gs_translations = t;
@@ -1242,6 +1466,8 @@ void wxTranslations::Set(wxTranslations *t)
 /*static*/
 void wxTranslations::SetNonOwned(wxTranslations *t)
 {
+    IncrementGeneration();
+
     if ( gs_translationsOwned )
         delete gs_translations;
     gs_translations = t;
@@ -1258,6 +1484,9 @@ wxTranslations::wxTranslations()
 
 wxTranslations::~wxTranslations()
 {
+    // The cached translations may refer to the strings in our catalogs.
+    IncrementGeneration();
+
     delete m_loader;
 
     // free catalogs memory
@@ -1290,6 +1519,8 @@ void wxTranslations::SetLanguage(wxLanguage lang)
 
 void wxTranslations::SetLanguage(const wxString& lang)
 {
+    IncrementGeneration();
+
     m_lang = lang;
 }
 
@@ -1401,6 +1632,8 @@ bool wxTranslations::LoadCatalog(const wxString& domain, const wxString& lang)
         m_pMsgCat = cat;
         m_catalogMap[domain] = cat;
 
+        IncrementGeneration();
+
         return true;
     }
     else
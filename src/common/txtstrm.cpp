@@ -407,6 +407,273 @@ wxTextInputStream& wxTextInputStream::operator>>(float& f)
     return *this;
 }
 
+// ----------------------------------------------------------------------------
+// wxTextLineReader
+// ----------------------------------------------------------------------------
+
+wxTextLineReader::wxTextLineReader(wxInputStream& s,
+                                   const wxMBConv& conv,
+                                   size_t blockSize)
+  : m_input(s),
+    m_conv(conv.Clone()),
+    m_blockSize(blockSize ? blockSize : DEFAULT_BLOCK_SIZE)
+{
+}
+
+wxTextLineReader::~wxTextLineReader()
+{
+    delete m_conv;
+}
+
+bool wxTextLineReader::NextLine()
+{
+    if ( m_error )
+        return false;
+
+    size_t searchFrom = m_nextLine;
+    for ( ;; )
+    {
+        const size_t len = m_text.size();
+
+        size_t searched = len;
+        for ( size_t n = searchFrom; n < len; ++n )
+        {
+            const wchar_t ch = m_text[n];
+            if ( ch != L'\n' && ch != L'\r' )
+                continue;
+
+            size_t next = n + 1;
+            wxTextFileType type = wxTextFileType_Unix;
+            if ( ch == L'\r' )
+            {
+                if ( next == len && !m_eof )
+                {
+                    // We can't know whether this is a DOS or Mac line ending
+                    // before reading the next character.
+                    searched = n;
+                    break;
+                }
+
+                if ( next < len && m_text[next] == L'\n' )
+                {
+                    type = wxTextFileType_Dos;
+                    ++next;
+                }
+                else
+                {
+                    type = wxTextFileType_Mac;
+                }
+            }
+
+            m_lineStart = m_nextLine;
+            m_lineLen = n - m_nextLine;
+            m_lineType = type;
+            m_nextLine = next;
+            m_lineNumber++;
+
+            return true;
+        }
+
+        if ( m_eof )
+        {
+            m_lineStart = m_nextLine;
+            m_lineLen = len - m_nextLine;
+            m_lineType = wxTextFileType_None;
+
+            // Anything remaining is the last line without the terminator.
+            if ( !m_lineLen )
+                return false;
+
+            m_nextLine = len;
+            m_lineNumber++;
+
+            return true;
+        }
+
+        // Don't keep the already consumed text, this also invalidates the
+        // current line, as documented.
+        m_text.erase(0, m_nextLine);
+        searchFrom = searched - m_nextLine;
+        m_lineStart =
+        m_lineLen =
+        m_nextLine = 0;
+
+        if ( !ReadMore() && m_error )
+            return false;
+    }
+}
+
+bool wxTextLineReader::ReadLine(wxString& line, wxTextFileType* type)
+{
+    if ( !NextLine() )
+        return false;
+
+    line.assign(GetLineData(), m_lineLen);
+
+    if ( type )
+        *type = m_lineType;
+
+    return true;
+}
+
+bool wxTextLineReader::ReadMore()
+{
+    while ( !m_eof )
+    {
+        const size_t oldLen = m_raw.size();
+        m_raw.resize(oldLen + m_blockSize);
+        m_input.Read(&m_raw[oldLen], m_blockSize);
+
+        const size_t lastRead = m_input.LastRead();
+        m_raw.resize(oldLen + lastRead);
+
+        size_t len;
+        if ( lastRead )
+        {
+            len = FindDecodableLength(oldLen);
+        }
+        else
+        {
+            if ( m_input.GetLastError() == wxSTREAM_READ_ERROR )
+            {
+                m_error = true;
+                return false;
+            }
+
+            // Decode everything that remains at the end of the stream.
+            m_eof = true;
+            len = m_raw.size();
+        }
+
+        if ( len )
+            return Decode(len);
+    }
+
+    return false;
+}
+
+size_t wxTextLineReader::FindDecodableLength(size_t searchFrom)
+{
+    if ( !m_unitLen )
+    {
+        // We can't use GetMBNulLen() with wxConvAuto before it sees the input,
+        // so determine the encoding from the BOM ourselves in this case.
+        if ( dynamic_cast<wxConvAuto*>(m_conv) )
+        {
+            const size_t lenBOM = m_raw.size() < 4 ? m_raw.size() : 4;
+            switch ( wxConvAuto::DetectBOM(m_raw.data(), lenBOM) )
+            {
+                case wxBOM_Unknown:
+                    // Wait until we have enough data.
+                    if ( m_raw.size() < 4 )
+                        return 0;
+                    m_unitLen = 1;
+                    break;
+
+                case wxBOM_UTF16BE:
+                case wxBOM_UTF16LE:
+                    m_unitLen = 2;
+                    m_bomLen = 2;
+                    break;
+
+                case wxBOM_UTF32BE:
+                case wxBOM_UTF32LE:
+                    m_unitLen = 4;
+                    m_bomLen = 4;
+                    break;
+
+                case wxBOM_UTF8:
+                    m_unitLen = 1;
+                    m_bomLen = 3;
+                    break;
+
+                case wxBOM_None:
+                    m_unitLen = 1;
+                    break;
+            }
+        }
+        else
+        {
+            m_unitLen = m_conv->GetMBNulLen();
+            if ( m_unitLen == wxCONV_FAILED )
+                m_unitLen = 1;
+        }
+
+        // We may have skipped the search before, so do it now.
+        searchFrom = 0;
+    }
+
+    // Find the last code unit corresponding to CR or LF: it is always safe to
+    // split the input after it, as it can't be part of a multi-unit sequence
+    // in any encoding, and we don't need to know the byte order for this.
+    const unsigned char* const p =
+        reinterpret_cast<const unsigned char*>(m_raw.data());
+    const size_t unit = m_unitLen;
+    const size_t stop = searchFrom - searchFrom % unit;
+    for ( size_t end = m_raw.size() - m_raw.size() % unit; end > stop; end -= unit )
+    {
+        const unsigned char* const u = p + end - unit;
+
+        size_t i = 0;
+        if ( u[0] != '\n' && u[0] != '\r' )
+        {
+            if ( u[unit - 1] != '\n' && u[unit - 1] != '\r' )
+                continue;
+
+            i = unit - 1;
+        }
+
+        bool onlyNulsOtherwise = true;
+        for ( size_t n = 0; n < unit; ++n )
+        {
+            if ( n != i && u[n] )
+            {
+                onlyNulsOtherwise = false;
+                break;
+            }
+        }
+
+        if ( onlyNulsOtherwise )
+            return end;
+    }
+
+    return 0;
+}
+
+bool wxTextLineReader::Decode(size_t len)
+{
+    // No encoding produces more than one wide character per input byte, but
+    // leave space for the trailing NUL which some conversions may write.
+    const size_t oldLen = m_text.size();
+    m_text.resize(oldLen + len + 1);
+
+    const size_t rc = m_conv->ToWChar(&m_text[oldLen], len + 1,
+                                      m_raw.data(), len);
+    if ( rc == wxCONV_FAILED )
+    {
+        m_text.resize(oldLen);
+
+        // wxConvAuto fails to decode the BOM on its own, which happens if the
+        // stream doesn't contain anything else, but this is not an error.
+        if ( !m_eof || len != m_bomLen )
+        {
+            m_error = true;
+            return false;
+        }
+    }
+    else
+    {
+        m_text.resize(oldLen + rc);
+    }
+
+    m_raw.erase(0, len);
+
+    // The BOM may only occur at the start of the stream.
+    m_bomLen = 0;
+
+    return true;
+}
+
 
 
 wxTextOutputStream::wxTextOutputStream(wxOutputStream& s,
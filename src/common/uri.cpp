@@ -27,12 +27,155 @@
 
 #include "wx/uri.h"
 
+#include <string.h>
+
 // ---------------------------------------------------------------------------
 // definitions
 // ---------------------------------------------------------------------------
 
 wxIMPLEMENT_CLASS(wxURI, wxObject);
 
+namespace
+{
+
+// Classes of characters used by the URI grammar (see RFC 3986), a character
+// can belong to several of them.
+enum
+{
+    CharClass_Unreserved = 0x001,   // ALPHA / DIGIT / "-" / "." / "_" / "~"
+    CharClass_SubDelim   = 0x002,   // "!" / "$" / "&" / "'" / "(" / ")"
+                                    // / "*" / "+" / "," / ";" / "="
+    CharClass_Colon      = 0x004,
+    CharClass_At         = 0x008,
+    CharClass_Slash      = 0x010,
+    CharClass_Question   = 0x020,
+    CharClass_Hex        = 0x040,   // HEXDIG
+    CharClass_Alpha      = 0x080,   // ALPHA
+    CharClass_Hash       = 0x100
+};
+
+// Characters which can appear in the different URI components unescaped.
+enum
+{
+    // userinfo      = *( unreserved / pct-encoded / sub-delims / ":" )
+    Chars_UserInfo = CharClass_Unreserved | CharClass_SubDelim | CharClass_Colon,
+
+    // reg-name      = *( unreserved / pct-encoded / sub-delims )
+    Chars_RegName = CharClass_Unreserved | CharClass_SubDelim,
+
+    // pchar         = unreserved / pct-encoded / sub-delims / ":" / "@"
+    //
+    // plus the segments separator, but without the colon for the relative
+    // paths of the URIs without scheme
+    Chars_PathNoColon = Chars_RegName | CharClass_At | CharClass_Slash,
+    Chars_Path = Chars_PathNoColon | CharClass_Colon,
+
+    // query         = *( pchar / "/" / "?" )
+    // fragment      = *( pchar / "/" / "?" )
+    Chars_Query = Chars_Path | CharClass_Question
+};
+
+// Classes of all ASCII characters, non-ASCII ones don't belong to any.
+const wxUint16 gs_charClasses[256] =
+{
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+    0x000, 0x002, 0x000, 0x100, 0x002, 0x000, 0x002, 0x002,
+    0x002, 0x002, 0x002, 0x002, 0x002, 0x001, 0x001, 0x010,
+    0x041, 0x041, 0x041, 0x041, 0x041, 0x041, 0x041, 0x041,
+    0x041, 0x041, 0x004, 0x002, 0x000, 0x002, 0x000, 0x020,
+    0x008, 0x0c1, 0x0c1, 0x0c1, 0x0c1, 0x0c1, 0x0c1, 0x081,
+    0x081, 0x081, 0x081, 0x081, 0x081, 0x081, 0x081, 0x081,
+    0x081, 0x081, 0x081, 0x081, 0x081, 0x081, 0x081, 0x081,
+    0x081, 0x081, 0x081, 0x000, 0x000, 0x000, 0x000, 0x001,
+    0x000, 0x0c1, 0x0c1, 0x0c1, 0x0c1, 0x0c1, 0x0c1, 0x081,
+    0x081, 0x081, 0x081, 0x081, 0x081, 0x081, 0x081, 0x081,
+    0x081, 0x081, 0x081, 0x081, 0x081, 0x081, 0x081, 0x081,
+    0x081, 0x081, 0x081, 0x000, 0x000, 0x000, 0x001, 0x000,
+};
+
+inline bool HasClass(char c, int classes)
+{
+    return (gs_charClasses[static_cast<unsigned char>(c)] & classes) != 0;
+}
+
+inline bool IsAlphaChar(char c)
+{
+    return HasClass(c, CharClass_Alpha);
+}
+
+inline bool IsDigitChar(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+inline bool IsHexChar(char c)
+{
+    return HasClass(c, CharClass_Hex);
+}
+
+// pct-encoded   = "%" HEXDIG HEXDIG
+inline bool IsEscapedAt(const char* p)
+{
+    return p[0] == '%' && IsHexChar(p[1]) && IsHexChar(p[2]);
+}
+
+// Append the characters in [p, end) range to the string, escaping all of them
+// except those of the given classes and the already escaped ones.
+void AppendEscaped(std::string& s, const char* p, const char* end,
+                   int allowed)
+{
+    static const char* hexDigits = "0123456789abcdef";
+
+    while ( p != end )
+    {
+        const char* const start = p;
+        while ( p != end && HasClass(*p, allowed) )
+            ++p;
+
+        s.append(start, p);
+
+        if ( p == end )
+            break;
+
+        if ( IsEscapedAt(p) )
+        {
+            s.append(p, 3);
+            p += 3;
+        }
+        else // really needs escaping
+        {
+            const char c = *p++;
+
+            s += '%';
+            s += hexDigits[(c >> 4) & 15];
+            s += hexDigits[c & 15];
+        }
+    }
+}
+
+// Return the value of the URI component, escaping it if necessary.
+wxString
+GetComponent(const wxURIView& view, wxURIFieldType field, int allowed = 0)
+{
+    const char* const start = view.GetStart(field);
+    const size_t len = view.GetLength(field);
+
+    // the characters not needing escaping are always ASCII
+    if ( !view.NeedsEscaping(field) )
+        return wxString::FromAscii(start, len);
+
+    std::string s;
+    s.reserve(len + len / 2);
+    AppendEscaped(s, start, start + len, allowed);
+
+    return wxString::FromAscii(s.data(), s.length());
+}
+
+} // anonymous namespace
+
 // ===========================================================================
 // wxURI implementation
 // ===========================================================================
@@ -111,51 +254,52 @@ wxString wxURI::Unescape(const wxString& uri)
     const wxScopedCharBuffer& uriU8(uri.utf8_str());
     const size_t len = uriU8.length();
 
-    // the unescaped version can't be longer than the original one
-    wxCharBuffer buf(uriU8.length());
-    char *p = buf.data();
-
-    const char* const end = uriU8.data() + len;
-    for ( const char* s = uriU8.data(); s != end; ++s, ++p )
-    {
-        char c = *s;
-        if ( c == '%' && s < end - 2 && IsHex(s[1]) && IsHex(s[2]) )
-        {
-            c = (CharToHex(s[1]) << 4) | CharToHex(s[2]);
-            s += 2;
-        }
-
-        *p = c;
-    }
+    // don't bother converting the string back if there is nothing to decode
+    if ( !memchr(uriU8.data(), '%', len) )
+        return uri;
 
-    *p = '\0';
+    // the unescaped version can't be longer than the original one
+    wxCharBuffer buf(len);
+    buf.data()[Unescape(uriU8.data(), len, buf.data())] = '\0';
 
     return wxString::FromUTF8(buf);
 }
 
-void wxURI::AppendNextEscaped(wxString& s, const char *& p)
+/* static */
+size_t wxURI::Unescape(const char* s, size_t len, char* out)
 {
-    // check for an already encoded character:
-    //
-    // pct-encoded   = "%" HEXDIG HEXDIG
-    if ( p[0] == '%' && IsHex(p[1]) && IsHex(p[2]) )
-    {
-        s += *p++;
-        s += *p++;
-        s += *p++;
-    }
-    else // really needs escaping
+    const char* const end = s + len;
+    char* p = out;
+
+    for ( ;; )
     {
-        static const char* hexDigits = "0123456789abcdef";
+        // copy everything until the next escape sequence at once
+        const char* const
+            pct = static_cast<const char*>(memchr(s, '%', end - s));
+        const char* const next = pct ? pct : end;
 
-        const char c = *p++;
+        if ( p != s )
+            memmove(p, s, next - s);
+        p += next - s;
 
-        s += '%';
-        s += hexDigits[(c >> 4) & 15];
-        s += hexDigits[c & 15];
+        if ( !pct )
+            break;
+
+        if ( end - pct > 2 && IsHexChar(pct[1]) && IsHexChar(pct[2]) )
+        {
+            *p++ = static_cast<char>((CharToHex(pct[1]) << 4) |
+                                     CharToHex(pct[2]));
+            s = pct + 3;
+        }
+        else // not a valid escape sequence, keep it as is
+        {
+            *p++ = '%';
+            s = pct + 1;
+        }
     }
-}
 
+    return p - out;
+}
 // ---------------------------------------------------------------------------
 // GetUser
 // GetPassword
@@ -306,6 +450,72 @@ bool wxURI::IsRelative() const
     return !HasScheme() && !HasServer();
 }
 
+// ---------------------------------------------------------------------------
+// Parse
+//
+// Master URI parsing method. Uses wxURIView to find the components and then
+// copies them, escaping if necessary.
+// ---------------------------------------------------------------------------
+
+bool wxURI::Parse(const char *uri)
+{
+    wxURIView view;
+    const bool ok = view.Parse(uri);
+
+    if ( view.HasScheme() )
+        m_scheme = GetComponent(view, wxURI_SCHEME);
+    if ( view.HasUserInfo() )
+        m_userinfo = GetComponent(view, wxURI_USERINFO, Chars_UserInfo);
+    if ( view.HasServer() )
+        m_server = GetComponent(view, wxURI_SERVER, Chars_RegName);
+    if ( view.HasPort() )
+        m_port = GetComponent(view, wxURI_PORT);
+    if ( view.HasPath() )
+    {
+        const bool noColon = !view.HasScheme() &&
+                                *view.GetStart(wxURI_PATH) != '/';
+        m_path = GetComponent(view, wxURI_PATH,
+                              noColon ? Chars_PathNoColon : Chars_Path);
+    }
+    if ( view.HasQuery() )
+        m_query = GetComponent(view, wxURI_QUERY, Chars_Query);
+    if ( view.HasFragment() )
+        m_fragment = GetComponent(view, wxURI_FRAGMENT, Chars_Query);
+
+    m_hostType = view.GetHostType();
+
+    m_fields = 0;
+    for ( int field = wxURI_SCHEME; field <= wxURI_FRAGMENT; field <<= 1 )
+    {
+        if ( view.Has(static_cast<wxURIFieldType>(field)) )
+            m_fields |= field;
+    }
+
+    return ok;
+}
+
+// ===========================================================================
+// wxURIView implementation
+// ===========================================================================
+
+void
+wxURIView::SetRange(wxURIFieldType field, const char* start, const char* end)
+{
+    wxURIRange& range = m_ranges[GetIndex(field)];
+    range.pos = start - m_source;
+    range.len = end - start;
+
+    m_fields |= field;
+}
+
+void wxURIView::ResetField(wxURIFieldType field)
+{
+    m_ranges[GetIndex(field)] = wxURIRange();
+
+    m_fields &= ~field;
+    m_escape &= ~field;
+}
+
 // ---------------------------------------------------------------------------
 // Parse
 //
@@ -315,64 +525,88 @@ bool wxURI::IsRelative() const
 // URI-reference = URI / relative
 // ---------------------------------------------------------------------------
 
-bool wxURI::Parse(const char *uri)
+bool wxURIView::Parse(const char* uri)
 {
+    *this = wxURIView();
+
+    m_source = uri;
+
     uri = ParseScheme(uri);
-    if ( uri )
-        uri = ParseAuthority(uri);
-    if ( uri )
-        uri = ParsePath(uri);
-    if ( uri )
-        uri = ParseQuery(uri);
-    if ( uri )
-        uri = ParseFragment(uri);
+    uri = ParseAuthority(uri);
+    uri = ParsePath(uri);
+    uri = ParseQuery(uri);
+    uri = ParseFragment(uri);
 
     // we only succeed if we parsed the entire string
-    return uri && *uri == '\0';
+    return *uri == '\0';
 }
 
-const char* wxURI::ParseScheme(const char *uri)
+const char* wxURIView::ParseComponent(wxURIFieldType field,
+                                      const char* uri,
+                                      int allowed,
+                                      int terminators)
 {
-    const char * const start = uri;
+    const char* const start = uri;
+
+    for ( ;; )
+    {
+        while ( HasClass(*uri, allowed) )
+            ++uri;
+
+        if ( !*uri || HasClass(*uri, terminators) )
+            break;
+
+        // already encoded characters are left as is, while all the others
+        // will need to be escaped
+        if ( IsEscapedAt(uri) )
+        {
+            uri += 3;
+        }
+        else
+        {
+            m_escape |= field;
+            ++uri;
+        }
+    }
 
+    SetRange(field, start, uri);
+
+    return uri;
+}
+
+const char* wxURIView::ParseScheme(const char *uri)
+{
     // assume that we have a scheme if we have the valid start of it
-    if ( IsAlpha(*uri) )
+    if ( IsAlphaChar(*uri) )
     {
-        m_scheme += *uri++;
+        const char* p = uri + 1;
 
         //scheme        = ALPHA *( ALPHA / DIGIT / "+" / "-" / "." )
-        while (IsAlpha(*uri) || IsDigit(*uri) ||
-               *uri == '+'   ||
-               *uri == '-'   ||
-               *uri == '.')
+        while ( IsAlphaChar(*p) || IsDigitChar(*p) ||
+                *p == '+' || *p == '-' || *p == '.' )
         {
-            m_scheme += *uri++;
+            ++p;
         }
 
         //valid scheme?
-        if (*uri == ':')
+        if ( *p == ':' )
         {
-            //mark the scheme as valid
-            m_fields |= wxURI_SCHEME;
+            SetRange(wxURI_SCHEME, uri, p);
 
             //move reference point up to input buffer
-            ++uri;
-        }
-        else // no valid scheme finally
-        {
-            uri = start; // rewind
-            m_scheme.clear();
+            uri = p + 1;
         }
+        //else: no valid scheme finally
     }
     //else: can't have schema, possible a relative URI
 
     return uri;
 }
 
-const char* wxURI::ParseAuthority(const char* uri)
+const char* wxURIView::ParseAuthority(const char* uri)
 {
-    // URI			 = scheme ":" hier-part [ "?" query ] [ "#" fragment ]
-    // hier-part	 = "//" authority path-abempty
+    // URI           = scheme ":" hier-part [ "?" query ] [ "#" fragment ]
+    // hier-part     = "//" authority path-abempty
     bool leadswithdoubleslash = uri[0] == '/' && uri[1] == '/';
     if(leadswithdoubleslash)
     {
@@ -385,77 +619,50 @@ const char* wxURI::ParseAuthority(const char* uri)
     // server component in the case of [server][#fragment].
     // Otherwise they don't want us to parse the server at all
     // for file uris.
-    if (m_scheme == "file") // RFC 8089 allows for leading "//" with file
-    { // look for [server][#fragment] case
-        bool serverfragmentfound = false;
+    if (GetLength(wxURI_SCHEME) == 4 &&
+            memcmp(GetStart(wxURI_SCHEME), "file", 4) == 0)
+    { // RFC 8089 allows for leading "//" with file, look for [server][#fragment] case
         const char* uristart = uri;
         uri = ParseServer(uri);
-        if(HasServer())
-        {
-            uri = ParseFragment(uri);
-            serverfragmentfound = HasFragment();
-        }
-        if(!serverfragmentfound)
+        uri = ParseFragment(uri);
+        if(!HasFragment())
         { // nope... clear fields, return to point after opening slashes
             uri = uristart;
-            m_server.erase();
-            m_fields &= ~wxURI_SERVER;
+            ResetField(wxURI_SERVER);
         }
     }
     else if(leadswithdoubleslash)
     { // normal RFC-based authority parsing
-        // authority	 = [ userinfo "@" ] host [ ":" port ]
-        // file-hier-part = ( "//" auth-path ) / local-path
-        const char* uristart = uri;
+        // authority     = [ userinfo "@" ] host [ ":" port ]
+        //
+        // notice that the host is always found, even if it's empty
         uri = ParseUserInfo(uri);
         uri = ParseServer(uri);
-        if (!HasServer() && HasUserInfo()) // in practice this case doesn't happen without scheme-based parsing
-        { // userinfo can't exist without host, backtrack and reparse
-            m_userinfo.erase();
-            m_fields &= ~wxURI_USERINFO;
-            uri = uristart;
-            uri = ParseServer(uri);
-        }
         uri = ParsePort(uri);
-        if (!HasServer()) // in practice this case doesn't happen without scheme-based parsing
-        {
-            m_port.erase(); // port can't exist without host
-            m_fields &= ~wxURI_PORT;
-            uri = uristart - 2; // nothing found, skip to before the leading "//"
-        }
     }
 
     return uri;
 }
 
-const char* wxURI::ParseUserInfo(const char* uri)
+const char* wxURIView::ParseUserInfo(const char* uri)
 {
-    const char * const start = uri;
-
     // userinfo      = *( unreserved / pct-encoded / sub-delims / ":" )
-    while ( *uri && *uri != '@' && *uri != '/' && *uri != '#' && *uri != '?' )
-    {
-        if ( IsUnreserved(*uri) || IsSubDelim(*uri) || *uri == ':' )
-            m_userinfo += *uri++;
-        else
-            AppendNextEscaped(m_userinfo, uri);
-    }
+    const char* const end = ParseComponent(wxURI_USERINFO, uri, Chars_UserInfo,
+                                           CharClass_At | CharClass_Slash |
+                                           CharClass_Hash | CharClass_Question);
 
-    if ( *uri++ == '@' )
+    if ( *end == '@' )
     {
         // valid userinfo
-        m_fields |= wxURI_USERINFO;
-    }
-    else
-    {
-        uri = start; // rewind
-        m_userinfo.clear();
+        return end + 1;
     }
 
-    return uri;
+    ResetField(wxURI_USERINFO);
+
+    return uri; // rewind
 }
 
-const char* wxURI::ParseServer(const char* uri)
+const char* wxURIView::ParseServer(const char* uri)
 {
     const char * const start = uri;
 
@@ -468,25 +675,20 @@ const char* wxURI::ParseServer(const char* uri)
         {
             m_hostType = wxURI_IPV6ADDRESS;
 
-            m_server.assign(start + 1, uri - start - 1);
-            ++uri;
+            SetRange(wxURI_SERVER, start + 1, uri);
+            return uri + 1;
         }
-        else
-        {
-            uri = start + 1; // skip the leading '[' again
 
-            if (ParseIPvFuture(uri) && *uri == ']')
-            {
-                m_hostType = wxURI_IPVFUTURE;
+        uri = start + 1; // skip the leading '[' again
 
-                m_server.assign(start + 1, uri - start - 1);
-                ++uri;
-            }
-            else // unrecognized IP literal
-            {
-                uri = start;
-            }
+        if (ParseIPvFuture(uri) && *uri == ']')
+        {
+            m_hostType = wxURI_IPVFUTURE;
+
+            SetRange(wxURI_SERVER, start + 1, uri);
+            return uri + 1;
         }
+        //else: unrecognized IP literal
     }
     else // IPv4 or a reg-name
     {
@@ -494,51 +696,34 @@ const char* wxURI::ParseServer(const char* uri)
         {
             m_hostType = wxURI_IPV4ADDRESS;
 
-            m_server.assign(start, uri - start);
-        }
-        else
-        {
-            uri = start;
-        }
-    }
-
-    if ( m_hostType == wxURI_REGNAME )
-    {
-        uri = start;
-        // reg-name      = *( unreserved / pct-encoded / sub-delims )
-        while ( *uri && *uri != '/' && *uri != ':' && *uri != '#' && *uri != '?' )
-        {
-            if ( IsUnreserved(*uri) || IsSubDelim(*uri) )
-                m_server += *uri++;
-            else
-                AppendNextEscaped(m_server, uri);
+            SetRange(wxURI_SERVER, start, uri);
+            return uri;
         }
     }
 
-    m_fields |= wxURI_SERVER;
-
-    return uri;
+    // reg-name      = *( unreserved / pct-encoded / sub-delims )
+    return ParseComponent(wxURI_SERVER, start, Chars_RegName,
+                          CharClass_Slash | CharClass_Colon |
+                          CharClass_Hash | CharClass_Question);
 }
 
 
-const char* wxURI::ParsePort(const char* uri)
+const char* wxURIView::ParsePort(const char* uri)
 {
     // port          = *DIGIT
     if( *uri == ':' )
     {
-        ++uri;
-        while ( IsDigit(*uri) )
-        {
-            m_port += *uri++;
-        }
+        const char* const start = ++uri;
+        while ( IsDigitChar(*uri) )
+            ++uri;
 
-        m_fields |= wxURI_PORT;
+        SetRange(wxURI_PORT, start, uri);
     }
 
     return uri;
 }
 
-const char* wxURI::ParsePath(const char* uri)
+const char* wxURIView::ParsePath(const char* uri)
 {
     // hier-part     = "//" authority path-abempty
     //               / path-absolute
@@ -563,101 +748,43 @@ const char* wxURI::ParsePath(const char* uri)
     //
     // pchar         = unreserved / pct-encoded / sub-delims / ":" / "@"
 
-    if (IsEndPath(*uri)
-        // When authority is present,
-        // the path must either be empty or begin with a slash ("/") character.
-        // When authority is not present,
-        // the path cannot begin with two slash characters ("//").
-        || (m_server.length() ? (!(!*uri || *uri == '/')) : (*uri == '/' && *(uri+1) == '/')))
+    if (*uri == '\0' || *uri == '#' || *uri == '?')
         return uri;
-    const char* uristart = uri;
-    const bool isAbsolute = *uri == '/';
-    if (isAbsolute)
-    {
-        m_path += *uri++;
-        // segment-nz	 = 1*pchar
-        while (!IsEndPath(*uri))
-        {
-            if (IsPCharNE(*uri) || *uri == '/')
-                m_path += *uri++;
-            else
-                AppendNextEscaped(m_path, uri);
-        }
-        m_fields |= wxURI_PATH; //mark the path as valid
-    }
-    else if (*uri) //Relative path
-    {
-        if (!HasScheme())
-        {
-            // segment-nz-nc = 1*( unreserved / pct-encoded / sub-delims / "@" )
-            //				 ; non-zero-length segment without any colon ":"
-            while (!IsEndPath(*uri))
-            {
-                if (IsPCharNCNE(*uri) || *uri == '/')
-                    m_path += *uri++;
-                else
-                    AppendNextEscaped(m_path, uri);
-            }
-        }
-        else
-        {
-            // segment-nz	 = 1*pchar
-            while (!IsEndPath(*uri))
-            {
-                if (IsPCharNE(*uri) || *uri == '/')
-                    m_path += *uri++;
-                else
-                    AppendNextEscaped(m_path, uri);
-            }
-        }
-        if (uri != uristart)
-            m_fields |= wxURI_PATH; // mark the path as valid
-    }
-    return uri;
+
+    // When authority is present,
+    // the path must either be empty or begin with a slash ("/") character.
+    // When authority is not present,
+    // the path cannot begin with two slash characters ("//").
+    if (GetLength(wxURI_SERVER) ? *uri != '/' : (uri[0] == '/' && uri[1] == '/'))
+        return uri;
+
+    // relative paths can't contain colons if there is no scheme
+    const int allowed = *uri == '/' || HasScheme() ? Chars_Path
+                                                   : Chars_PathNoColon;
+
+    return ParseComponent(wxURI_PATH, uri, allowed,
+                          CharClass_Hash | CharClass_Question);
 }
 
 
-const char* wxURI::ParseQuery(const char* uri)
+const char* wxURIView::ParseQuery(const char* uri)
 {
     // query         = *( pchar / "/" / "?" )
     if ( *uri == '?' )
-    {
-        ++uri;
-        while ( *uri && *uri != '#' )
-        {
-            if ( IsPCharNE(*uri) || *uri == '/' || *uri == '?' )
-                m_query += *uri++;
-            else
-                AppendNextEscaped(m_query, uri);
-        }
-
-        m_fields |= wxURI_QUERY;
-    }
+        uri = ParseComponent(wxURI_QUERY, uri + 1, Chars_Query, CharClass_Hash);
 
     return uri;
 }
 
 
-const char* wxURI::ParseFragment(const char* uri)
+const char* wxURIView::ParseFragment(const char* uri)
 {
     // fragment      = *( pchar / "/" / "?" )
     if ( *uri == '#' )
-    {
-        ++uri;
-        while ( *uri )
-        {
-            if ( IsPCharNE(*uri) || *uri == '/' || *uri == '?' )
-                m_fragment += *uri++;
-            else
-                AppendNextEscaped(m_fragment, uri);
-        }
-
-        m_fields |= wxURI_FRAGMENT;
-    }
+        uri = ParseComponent(wxURI_FRAGMENT, uri + 1, Chars_Query, 0);
 
     return uri;
 }
-
 // ---------------------------------------------------------------------------
 // Resolve
 //
@@ -836,13 +963,13 @@ void wxURI::Resolve(const wxURI& base, int flags)
 // the input string back to its original position on failure.
 // ---------------------------------------------------------------------------
 
-bool wxURI::ParseH16(const char*& uri)
+bool wxURIView::ParseH16(const char*& uri)
 {
     // h16           = 1*4HEXDIG
-    if(!IsHex(*uri))
+    if(!IsHexChar(*uri))
         return false;
 
-    if(IsHex(*++uri) && IsHex(*++uri) && IsHex(*++uri))
+    if(IsHexChar(*++uri) && IsHexChar(*++uri) && IsHexChar(*++uri))
         ++uri;
 
     return true;
@@ -857,7 +984,7 @@ bool wxURI::ParseH16(const char*& uri)
 // to its original position on failure.
 // ---------------------------------------------------------------------------
 
-bool wxURI::ParseIPv4address(const char*& uri)
+bool wxURIView::ParseIPv4address(const char*& uri)
 {
     //IPv4address   = dec-octet "." dec-octet "." dec-octet "." dec-octet
     //
@@ -868,13 +995,13 @@ bool wxURI::ParseIPv4address(const char*& uri)
     //                / "25" %x30-35                ; 250-255
     size_t iIPv4 = 0;
     const char* uriOrig = uri;
-    if (IsDigit(*uri))
+    if (IsDigitChar(*uri))
     {
         ++iIPv4;
 
 
         //each ip part must be between 0-255 (dupe of version in for loop)
-        if( (IsDigit(*++uri) && IsDigit(*++uri) &&
+        if( (IsDigitChar(*++uri) && IsDigitChar(*++uri) &&
            //100 or less  (note !)
            !( (*(uri-2) == '1') ||
            //240 or less
@@ -888,18 +1015,18 @@ bool wxURI::ParseIPv4address(const char*& uri)
             return false;
         }
 
-        if(IsDigit(*uri))
+        if(IsDigitChar(*uri))
             ++uri;
 
         //compilers should unroll this loop
         for(; iIPv4 < 4; ++iIPv4)
         {
-            if (*uri != '.' || !IsDigit(*++uri))
+            if (*uri != '.' || !IsDigitChar(*++uri))
                 break;
 
             //each ip part must be between 0-255
             uriOrig = uri;
-            if( (IsDigit(*++uri) && IsDigit(*++uri) &&
+            if( (IsDigitChar(*++uri) && IsDigitChar(*++uri) &&
                //100 or less  (note !)
                !( (*(uri-2) == '1') ||
                //240 or less
@@ -912,14 +1039,14 @@ bool wxURI::ParseIPv4address(const char*& uri)
             {
                 return false;
             }
-            if(IsDigit(*uri))
+            if(IsDigitChar(*uri))
                 ++uri;
         }
     }
     return iIPv4 == 4;
 }
 
-bool wxURI::ParseIPv6address(const char*& uri)
+bool wxURIView::ParseIPv6address(const char*& uri)
 {
     // IPv6address   =                            6( h16 ":" ) ls32
     //               /                       "::" 5( h16 ":" ) ls32
@@ -1022,19 +1149,19 @@ bool wxURI::ParseIPv6address(const char*& uri)
     return doublecolon && *uri == ']'; // can only be empty if a "::" was detecte
 }
 
-bool wxURI::ParseIPvFuture(const char*& uri)
+bool wxURIView::ParseIPvFuture(const char*& uri)
 {
     // IPvFuture     = "v" 1*HEXDIG "." 1*( unreserved / sub-delims / ":" )
-    if (*++uri != 'v' || !IsHex(*++uri))
+    if (*++uri != 'v' || !IsHexChar(*++uri))
         return false;
 
-    while (IsHex(*++uri))
+    while (IsHexChar(*++uri))
         ;
 
-    if (*uri != '.' || !(IsUnreserved(*++uri) || IsSubDelim(*uri) || *uri == ':'))
+    if (*uri != '.' || !(HasClass(*++uri, Chars_RegName) || *uri == ':'))
         return false;
 
-    while(IsUnreserved(*++uri) || IsSubDelim(*uri) || *uri == ':') {}
+    while(HasClass(*++uri, Chars_RegName) || *uri == ':') {}
 
     return true;
 }
@@ -1049,13 +1176,7 @@ bool wxURI::ParseIPvFuture(const char*& uri)
 // unreserved    = ALPHA / DIGIT / "-" / "." / "_" / "~"
 bool wxURI::IsUnreserved(char c)
 {
-    return IsAlpha(c) ||
-           IsDigit(c) ||
-           c == '-' ||
-           c == '.' ||
-           c == '_' ||
-           c == '~'
-           ;
+    return HasClass(c, CharClass_Unreserved);
 }
 
 bool wxURI::IsReserved(char c)
@@ -1066,48 +1187,32 @@ bool wxURI::IsReserved(char c)
 // gen-delims    = ":" / "/" / "?" / "#" / "[" / "]" / "@"
 bool wxURI::IsGenDelim(char c)
 {
-    return c == ':' ||
-           c == '/' ||
-           c == '?' ||
-           c == '#' ||
+    return HasClass(c, CharClass_Colon | CharClass_Slash | CharClass_Question |
+                       CharClass_Hash | CharClass_At) ||
            c == '[' ||
-           c == ']' ||
-           c == '@';
+           c == ']';
 }
 
 // sub-delims    = "!" / "$" / "&" / "'" / "(" / ")"
 //               / "*" / "+" / "," / ";" / "="
 bool wxURI::IsSubDelim(char c)
 {
-    return c == '!' ||
-           c == '$' ||
-           c == '&' ||
-           c == '\'' ||
-           c == '(' ||
-           c == ')' ||
-           c == '*' ||
-           c == '+' ||
-           c == ',' ||
-           c == ';' ||
-           c == '='
-           ;
+    return HasClass(c, CharClass_SubDelim);
 }
 
 bool wxURI::IsHex(char c)
 {
-    return IsDigit(c) ||
-           (c >= 'a' && c <= 'f') ||
-           (c >= 'A' && c <= 'F');
+    return IsHexChar(c);
 }
 
 bool wxURI::IsAlpha(char c)
 {
-    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+    return IsAlphaChar(c);
 }
 
 bool wxURI::IsDigit(char c)
 {
-    return c >= '0' && c <= '9';
+    return IsDigitChar(c);
 }
 
 bool wxURI::IsEndPath(char c)
@@ -1119,10 +1224,10 @@ bool wxURI::IsEndPath(char c)
 // pct-encoded handled outside, NC is for no colon for relative paths
 bool wxURI::IsPCharNCNE(char c)
 {
-    return IsUnreserved(c) || IsSubDelim(c) || c == '@' || c == '/';
+    return HasClass(c, Chars_PathNoColon);
 }
 
 bool wxURI::IsPCharNE(char c)
 {
-    return IsPCharNCNE(c) || c == ':';
+    return HasClass(c, Chars_Path);
 }
@@ -222,6 +222,41 @@ wxAny wxVariant::GetAny() const
 
 #endif // wxUSE_ANY
 
+// -----------------------------------------------------------------
+// Helper for checking the type of the variant data
+// -----------------------------------------------------------------
+
+namespace
+{
+
+// Return the data as the given type, which must be one of the classes defined
+// in this file, if it is of this type or null otherwise.
+//
+// This is much faster than comparing the result of GetType() with the type
+// name, as it avoids creating a temporary string, and so is used in the most
+// commonly used functions.
+#ifndef wxNO_RTTI
+
+template <typename T>
+inline T* GetDataAs(wxObjectRefData* data, const wxChar* WXUNUSED(type))
+{
+    return dynamic_cast<T*>(data);
+}
+
+#else // wxNO_RTTI
+
+template <typename T>
+inline T* GetDataAs(wxObjectRefData* data, const wxChar* type)
+{
+    return data && static_cast<wxVariantData*>(data)->GetType() == type
+            ? static_cast<T*>(data)
+            : nullptr;
+}
+
+#endif // !wxNO_RTTI/wxNO_RTTI
+
+} // anonymous namespace
+
 // -----------------------------------------------------------------
 // wxVariantDataLong
 // -----------------------------------------------------------------
@@ -367,10 +402,11 @@ bool wxVariant::operator!= (long value) const
 
 void wxVariant::operator= (long value)
 {
-    if (GetType() == wxT("long") &&
-        m_refData->GetRefCount() == 1)
+    wxVariantDataLong* const
+        data = GetDataAs<wxVariantDataLong>(m_refData, wxT("long"));
+    if ( data && data->GetRefCount() == 1 )
     {
-        ((wxVariantDataLong*)GetData())->SetValue(value);
+        data->SetValue(value);
     }
     else
     {
@@ -507,10 +543,11 @@ bool wxVariant::operator!= (double value) const
 
 void wxVariant::operator= (double value)
 {
-    if (GetType() == wxT("double") &&
-        m_refData->GetRefCount() == 1)
+    wxVariantDoubleData* const
+        data = GetDataAs<wxVariantDoubleData>(m_refData, wxT("double"));
+    if ( data && data->GetRefCount() == 1 )
     {
-        ((wxVariantDoubleData*)GetData())->SetValue(value);
+        data->SetValue(value);
     }
     else
     {
@@ -650,10 +687,11 @@ bool wxVariant::operator!= (bool value) const
 
 void wxVariant::operator= (bool value)
 {
-    if (GetType() == wxT("bool") &&
-        m_refData->GetRefCount() == 1)
+    wxVariantDataBool* const
+        data = GetDataAs<wxVariantDataBool>(m_refData, wxT("bool"));
+    if ( data && data->GetRefCount() == 1 )
     {
-        ((wxVariantDataBool*)GetData())->SetValue(value);
+        data->SetValue(value);
     }
     else
     {
@@ -801,10 +839,11 @@ bool wxVariant::operator==(const wxUniChar& value) const
 
 wxVariant& wxVariant::operator=(const wxUniChar& value)
 {
-    if (GetType() == wxT("char") &&
-        m_refData->GetRefCount() == 1)
+    wxVariantDataChar* const
+        data = GetDataAs<wxVariantDataChar>(m_refData, wxT("char"));
+    if ( data && data->GetRefCount() == 1 )
     {
-        ((wxVariantDataChar*)GetData())->SetValue(value);
+        data->SetValue(value);
     }
     else
     {
@@ -996,10 +1035,11 @@ bool wxVariant::operator!= (const wxString& value) const
 
 wxVariant& wxVariant::operator= (const wxString& value)
 {
-    if (GetType() == wxT("string") &&
-        m_refData->GetRefCount() == 1)
+    wxVariantDataString* const
+        data = GetDataAs<wxVariantDataString>(m_refData, wxT("string"));
+    if ( data && data->GetRefCount() == 1 )
     {
-        ((wxVariantDataString*)GetData())->SetValue(value);
+        data->SetValue(value);
     }
     else
     {
@@ -1235,9 +1275,11 @@ bool wxVariant::operator!= (void* value) const
 
 void wxVariant::operator= (void* value)
 {
-    if (GetType() == wxT("void*") && (m_refData->GetRefCount() == 1))
+    wxVariantDataVoidPtr* const
+        data = GetDataAs<wxVariantDataVoidPtr>(m_refData, wxT("void*"));
+    if ( data && data->GetRefCount() == 1 )
     {
-        ((wxVariantDataVoidPtr*)GetData())->SetValue(value);
+        data->SetValue(value);
     }
     else
     {
@@ -1367,10 +1409,11 @@ bool wxVariant::operator!= (const wxDateTime& value) const
 
 void wxVariant::operator= (const wxDateTime& value)
 {
-    if (GetType() == wxT("datetime") &&
-        m_refData->GetRefCount() == 1)
+    wxVariantDataDateTime* const
+        data = GetDataAs<wxVariantDataDateTime>(m_refData, wxT("datetime"));
+    if ( data && data->GetRefCount() == 1 )
     {
-        ((wxVariantDataDateTime*)GetData())->SetValue(value);
+        data->SetValue(value);
     }
     else
     {
@@ -1689,10 +1732,11 @@ bool wxVariant::operator!=(wxLongLong value) const
 
 void wxVariant::operator=(wxLongLong value)
 {
-    if ( GetType() == wxS("longlong") &&
-         m_refData->GetRefCount() == 1 )
+    wxVariantDataLongLong* const
+        data = GetDataAs<wxVariantDataLongLong>(m_refData, wxT("longlong"));
+    if ( data && data->GetRefCount() == 1 )
     {
-        ((wxVariantDataLongLong*)GetData())->SetValue(value);
+        data->SetValue(value);
     }
     else
     {
@@ -1889,10 +1933,11 @@ bool wxVariant::operator!=(wxULongLong value) const
 
 void wxVariant::operator=(wxULongLong value)
 {
-    if ( GetType() == wxS("ulonglong") &&
-         m_refData->GetRefCount() == 1 )
+    wxVariantDataULongLong* const
+        data = GetDataAs<wxVariantDataULongLong>(m_refData, wxT("ulonglong"));
+    if ( data && data->GetRefCount() == 1 )
     {
-        ((wxVariantDataULongLong*)GetData())->SetValue(value);
+        data->SetValue(value);
     }
     else
     {
@@ -2112,10 +2157,11 @@ bool wxVariant::operator!= (const wxVariantList& value) const
 
 void wxVariant::operator= (const wxVariantList& value)
 {
-    if (GetType() == wxT("list") &&
-        m_refData->GetRefCount() == 1)
+    wxVariantDataList* const
+        data = GetDataAs<wxVariantDataList>(m_refData, wxT("list"));
+    if ( data && data->GetRefCount() == 1 )
     {
-        ((wxVariantDataList*)GetData())->SetValue(value);
+        data->SetValue(value);
     }
     else
     {
@@ -2244,6 +2290,14 @@ size_t wxVariant::GetCount() const
 
 bool wxVariant::Convert(long* value) const
 {
+    // Check for the most common case first without calling GetType().
+    if ( const wxVariantDataLong* const
+            data = GetDataAs<wxVariantDataLong>(m_refData, wxT("long")) )
+    {
+        *value = data->GetValue();
+        return true;
+    }
+
     wxString type(GetType());
     if (type == wxS("double"))
         *value = (long) (((wxVariantDoubleData*)GetData())->GetValue());
@@ -2279,6 +2333,14 @@ bool wxVariant::Convert(long* value) const
 
 bool wxVariant::Convert(bool* value) const
 {
+    // Check for the most common case first without calling GetType().
+    if ( const wxVariantDataBool* const
+            data = GetDataAs<wxVariantDataBool>(m_refData, wxT("bool")) )
+    {
+        *value = data->GetValue();
+        return true;
+    }
+
     wxString type(GetType());
     if (type == wxT("double"))
         *value = ((int) (((wxVariantDoubleData*)GetData())->GetValue()) != 0);
@@ -2305,6 +2367,14 @@ bool wxVariant::Convert(bool* value) const
 
 bool wxVariant::Convert(double* value) const
 {
+    // Check for the most common case first without calling GetType().
+    if ( const wxVariantDoubleData* const
+            data = GetDataAs<wxVariantDoubleData>(m_refData, wxT("double")) )
+    {
+        *value = data->GetValue();
+        return true;
+    }
+
     wxString type(GetType());
     if (type == wxT("double"))
         *value = ((wxVariantDoubleData*)GetData())->GetValue();
@@ -2332,6 +2402,14 @@ bool wxVariant::Convert(double* value) const
 
 bool wxVariant::Convert(wxUniChar* value) const
 {
+    // Check for the most common case first without calling GetType().
+    if ( const wxVariantDataChar* const
+            data = GetDataAs<wxVariantDataChar>(m_refData, wxT("char")) )
+    {
+        *value = data->GetValue();
+        return true;
+    }
+
     wxString type(GetType());
     if (type == wxT("char"))
         *value = ((wxVariantDataChar*)GetData())->GetValue();
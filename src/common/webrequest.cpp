@@ -13,6 +13,7 @@
 #if wxUSE_WEBREQUEST
 
 #include "wx/webrequest.h"
+#include "wx/httpcache.h"
 #include "wx/mstream.h"
 #include "wx/module.h"
 #include "wx/uri.h"
@@ -20,9 +21,11 @@
 #include "wx/filename.h"
 #include "wx/stdpaths.h"
 #include "wx/wfstream.h"
+#include "wx/apptrait.h"
 
 #ifndef WX_PRECOMP
     #include "wx/app.h"
+    #include "wx/evtloop.h"
     #include "wx/translation.h"
     #include "wx/utils.h"
 #endif
@@ -57,6 +60,57 @@ static const wxStringCharType* wxNO_IMPL_MSG
 #define wxCHECK_IMPL(rc) wxCHECK_MSG( m_impl, (rc), wxNO_IMPL_MSG )
 #define wxCHECK_IMPL_VOID() wxCHECK_RET( m_impl, wxNO_IMPL_MSG )
 
+namespace
+{
+
+// Response created from the data stored in the session cache.
+class wxWebResponseCached : public wxWebResponseImpl
+{
+public:
+    wxWebResponseCached(wxWebRequestImpl& request,
+                        const wxString& url,
+                        const wxHTTPCacheEntry& entry)
+        : wxWebResponseImpl(request),
+          m_url(url),
+          m_entry(entry)
+    {
+        Init();
+
+        const size_t size = m_entry.data.GetDataLen();
+        memcpy(GetDataBuffer(size), m_entry.data.GetData(), size);
+        ReportDataReceived(size);
+    }
+
+    wxFileOffset GetContentLength() const override
+        { return m_entry.data.GetDataLen(); }
+
+    wxString GetURL() const override { return m_url; }
+
+    wxString GetHeader(const wxString& name) const override
+    {
+        if ( name.IsSameAs("Content-Type", false) )
+            return m_entry.contentType;
+        if ( name.IsSameAs("ETag", false) )
+            return m_entry.eTag;
+        if ( name.IsSameAs("Last-Modified", false) )
+            return m_entry.lastModified;
+        if ( name.IsSameAs("Content-Length", false) )
+            return wxString::Format("%zu", m_entry.data.GetDataLen());
+
+        return wxString();
+    }
+
+    int GetStatus() const override { return 200; }
+
+    wxString GetStatusText() const override { return "OK"; }
+
+private:
+    const wxString m_url;
+    const wxHTTPCacheEntry m_entry;
+};
+
+} // anonymous namespace
+
 //
 // wxWebRequestImpl
 //
@@ -112,6 +166,96 @@ void wxWebRequestImpl::SetFinalStateFromStatus()
     }
 }
 
+bool wxWebRequestImpl::StartUsingCache()
+{
+    wxHTTPCache* const cache = m_session.GetCache();
+    if ( !cache )
+        return false;
+
+    // Only simple GET requests are cached and we need to have the data in
+    // memory to store it.
+    if ( (!m_method.empty() && m_method != "GET") || m_dataSize ||
+            m_storage != wxWebRequest::Storage_Memory )
+        return false;
+
+    wxHTTPCacheEntry entry;
+    switch ( cache->Find(m_url, &entry) )
+    {
+        case wxHTTPCache::Status_Fresh:
+            wxLogTrace(wxTRACE_WEBREQUEST, "Request %p: using cached response",
+                       this);
+
+            m_cachedResponse = wxWebResponseImplPtr
+                               (
+                                    new wxWebResponseCached(*this, m_url, entry)
+                               );
+
+            SetState(wxWebRequest::State_Active);
+            SetState(wxWebRequest::State_Completed);
+            return true;
+
+        case wxHTTPCache::Status_Stale:
+            // Ask the server to send the data only if it has changed.
+            if ( !entry.eTag.empty() )
+            {
+                SetHeader("If-None-Match", entry.eTag);
+                m_revalidating = true;
+            }
+            if ( !entry.lastModified.empty() )
+            {
+                SetHeader("If-Modified-Since", entry.lastModified);
+                m_revalidating = true;
+            }
+            break;
+
+        case wxHTTPCache::Status_Miss:
+            break;
+    }
+
+    m_usingCache = true;
+
+    return false;
+}
+
+void wxWebRequestImpl::UpdateCache()
+{
+    wxHTTPCache* const cache = m_session.GetCache();
+    const wxWebResponseImplPtr response = GetResponse();
+    if ( !cache || !response )
+        return;
+
+    const auto getHeader = [&response](const wxString& name)
+    {
+        return response->GetHeader(name);
+    };
+
+    switch ( response->GetStatus() )
+    {
+        case 200:
+            cache->Store(m_url, getHeader,
+                         response->m_readBuffer.GetData(),
+                         response->m_readBuffer.GetDataLen());
+            break;
+
+        case 304:
+            if ( m_revalidating )
+            {
+                wxHTTPCacheEntry entry;
+                if ( cache->Revalidate(m_url, getHeader, &entry) )
+                {
+                    wxLogTrace(wxTRACE_WEBREQUEST,
+                               "Request %p: using revalidated response", this);
+
+                    m_cachedResponse = wxWebResponseImplPtr
+                                       (
+                                            new wxWebResponseCached(*this, m_url, entry)
+                                       );
+                }
+            }
+            break;
+    }
+}
+
 void wxWebRequestImpl::SetData(const wxString& text, const wxString& contentType, const wxMBConv& conv)
 {
     m_dataText = text.mb_str(conv);
@@ -159,8 +303,9 @@ wxFileOffset wxWebRequestImpl::GetBytesReceived() const
 
 wxFileOffset wxWebRequestImpl::GetBytesExpectedToReceive() const
 {
-    if ( GetResponse() )
-        return GetResponse()->GetContentLength();
+    const wxWebResponseImplPtr response = GetEffectiveResponse();
+    if ( response )
+        return response->GetContentLength();
     else
         return -1;
 }
@@ -324,7 +469,10 @@ void wxWebRequestImpl::ProcessStateEvent(wxWebRequest::State state, const wxStri
     IncRef();
     const wxWebRequestImplPtr request(this);
 
-    const wxWebResponseImplPtr& response = GetResponse();
+    if ( state == wxWebRequest::State_Completed && m_usingCache )
+        UpdateCache();
+
+    const wxWebResponseImplPtr response = GetEffectiveResponse();
 
     wxWebRequestEvent evt(wxEVT_WEBREQUEST_STATE, GetId(), state,
                           wxWebRequest(request), wxWebResponse(response), failMsg);
@@ -455,6 +603,26 @@ wxWebRequest::Storage wxWebRequest::GetStorage() const
     return m_impl->GetStorage();
 }
 
+void wxWebRequest::SetDataCallback(const DataCallback& callback)
+{
+    wxCHECK_IMPL_VOID();
+
+    wxCHECK_RET( GetState() == State_Idle,
+                 "data callback can't be changed after starting the request" );
+
+    m_impl->SetDataCallback(callback);
+}
+
+bool wxWebRequest::Resume()
+{
+    wxCHECK_IMPL( false );
+
+    wxCHECK_MSG( m_impl->HasDataCallback(), false,
+                 "only requests using data callback can be resumed" );
+
+    return m_impl->Resume();
+}
+
 void wxWebRequest::Start()
 {
     wxCHECK_IMPL_VOID();
@@ -462,6 +630,9 @@ void wxWebRequest::Start()
     wxCHECK_RET( m_impl->GetState() == wxWebRequest::State_Idle,
                  "Completed requests can not be restarted" );
 
+    if ( m_impl->StartUsingCache() )
+        return;
+
     m_impl->Start();
 }
 
@@ -479,7 +650,7 @@ wxWebResponse wxWebRequest::GetResponse() const
 {
     wxCHECK_IMPL( wxWebResponse() );
 
-    return wxWebResponse(m_impl->GetResponse());
+    return wxWebResponse(m_impl->GetEffectiveResponse());
 }
 
 wxWebAuthChallenge wxWebRequest::GetAuthChallenge() const
@@ -741,6 +912,22 @@ void wxWebResponseImpl::ReportDataReceived(size_t sizeReceived)
             break;
 
         case wxWebRequest::Storage_None:
+            if ( m_request.HasDataCallback() )
+            {
+                // Pausing is not supported by this backend, otherwise it
+                // would have called the callback itself.
+                if ( !m_request.CallDataCallback(m_readBuffer.GetData(),
+                                                 m_readBuffer.GetDataLen()) )
+                {
+                    wxLogTrace(wxTRACE_WEBREQUEST,
+                               "Request %p: pausing not supported", &m_request);
+                }
+
+                // Unlike below, we can reuse the same buffer.
+                m_readBuffer.Clear();
+                break;
+            }
+
             m_request.IncRef();
             const wxWebRequestImplPtr request(&m_request);
 
@@ -883,6 +1070,13 @@ wxString wxWebResponse::GetDataFile() const
     return m_impl->GetDataFile();
 }
 
+wxWebResponseTimings wxWebResponse::GetTimings() const
+{
+    wxCHECK_IMPL( wxWebResponseTimings() );
+
+    return m_impl->GetTimings();
+}
+
 
 //
 // wxWebSessionImpl
@@ -1022,7 +1216,11 @@ wxWebSession::CreateRequest(wxEvtHandler* handler, const wxString& url, int id)
 {
     wxCHECK_IMPL( wxWebRequest() );
 
-    return wxWebRequest(m_impl->CreateRequest(*this, handler, url, id));
+    const wxWebRequestImplPtr impl = m_impl->CreateRequest(*this, handler, url, id);
+    if ( impl )
+        impl->SetURL(url);
+
+    return wxWebRequest(impl);
 }
 
 wxVersionInfo wxWebSession::GetLibraryVersionInfo()
@@ -1073,6 +1271,203 @@ bool wxWebSession::EnablePersistentStorage(bool enable)
     return m_impl->EnablePersistentStorage(enable);
 }
 
+bool wxWebSession::EnableMultiplexing(bool enable)
+{
+    return m_impl->EnableMultiplexing(enable);
+}
+
+bool wxWebSession::SetMaxConnections(int maxTotal, int maxPerHost)
+{
+    wxCHECK_MSG( maxTotal >= 0 && maxPerHost >= 0, false,
+                 "invalid number of connections" );
+
+    return m_impl->SetMaxConnections(maxTotal, maxPerHost);
+}
+
+bool wxWebSession::EnableKeepAlive(bool enable)
+{
+    return m_impl->EnableKeepAlive(enable);
+}
+
+bool wxWebSession::SetDNSCacheTimeout(int seconds)
+{
+    return m_impl->SetDNSCacheTimeout(seconds);
+}
+
+void wxWebSession::SetCache(wxHTTPCache* cache)
+{
+    wxCHECK_IMPL_VOID();
+
+    m_impl->SetCache(cache);
+}
+
+wxHTTPCache* wxWebSession::GetCache() const
+{
+    wxCHECK_IMPL( nullptr );
+
+    return m_impl->GetCache();
+}
+
+//
+// wxWebRequestBatch
+//
+
+wxWebRequestBatch::wxWebRequestBatch(const wxWebSession& session)
+    : m_session(session)
+{
+    m_maxActive = 8;
+}
+
+wxWebRequestBatch::~wxWebRequestBatch()
+{
+    // The requests keep a pointer to this object to send it their events.
+    wxASSERT_MSG( !m_active, "destroying batch with active requests" );
+}
+
+void wxWebRequestBatch::SetMaxActive(int count)
+{
+    wxCHECK_RET( count > 0, "invalid number of active requests" );
+
+    m_maxActive = count;
+
+    if ( m_started )
+        StartNext();
+}
+
+wxWebRequest wxWebRequestBatch::Add(const wxString& url)
+{
+    wxWebRequest request = m_session.CreateRequest(this, url,
+                                                     static_cast<int>(m_requests.size()));
+    wxCHECK_MSG( request.IsOk(), request, "failed to create the request" );
+
+    m_requests.push_back(request);
+    m_isFinished.push_back(false);
+
+    if ( m_started )
+        StartNext();
+
+    return request;
+}
+
+wxWebRequest wxWebRequestBatch::GetRequest(size_t n) const
+{
+    wxCHECK_MSG( n < m_requests.size(), wxWebRequest(), "invalid index" );
+
+    return m_requests[n];
+}
+
+void wxWebRequestBatch::Start()
+{
+    wxCHECK_RET( !m_started, "batch already started" );
+
+    m_started = true;
+
+    StartNext();
+}
+
+bool wxWebRequestBatch::Wait()
+{
+    wxCHECK_MSG( !m_loop, false, "recursive wait for the same batch" );
+
+    if ( !m_started )
+        Start();
+
+    if ( !IsFinished() )
+    {
+        wxAppTraits* const traits = wxApp::GetTraitsIfExists();
+        wxCHECK_MSG( traits, false, "can't wait for the requests without wxApp" );
+
+        std::unique_ptr<wxEventLoopBase> loop(traits->CreateEventLoop());
+
+        m_loop = loop.get();
+        loop->Run();
+        m_loop = nullptr;
+    }
+
+    for ( const auto& request : m_requests )
+    {
+        if ( request.GetState() != wxWebRequest::State_Completed )
+            return false;
+    }
+
+    return true;
+}
+
+void wxWebRequestBatch::Cancel()
+{
+    m_cancelled = true;
+
+    // The requests which haven't been started yet will never be, consider
+    // them finished immediately.
+    for ( ; m_next < m_requests.size(); m_next++ )
+        MarkFinished(m_next);
+
+    for ( size_t n = 0; n < m_requests.size(); n++ )
+    {
+        if ( !m_isFinished[n] )
+            m_requests[n].Cancel();
+    }
+}
+
+void wxWebRequestBatch::StartNext()
+{
+    while ( !m_cancelled && m_active < m_maxActive &&
+                m_next < m_requests.size() )
+    {
+        m_active++;
+        m_requests[m_next++].Start();
+    }
+}
+
+void wxWebRequestBatch::MarkFinished(size_t n)
+{
+    m_isFinished[n] = true;
+    m_finished++;
+
+    if ( m_loop && IsFinished() )
+        m_loop->ScheduleExit();
+}
+
+bool wxWebRequestBatch::ProcessEvent(wxEvent& event)
+{
+    const bool processed = wxEvtHandler::ProcessEvent(event);
+
+    // Start the next request only after letting the application handle the
+    // event of the finished one.
+    if ( event.GetEventType() == wxEVT_WEBREQUEST_STATE )
+    {
+        switch ( static_cast<wxWebRequestEvent&>(event).GetState() )
+        {
+            case wxWebRequest::State_Idle:
+            case wxWebRequest::State_Active:
+                break;
+
+            case wxWebRequest::State_Unauthorized:
+            case wxWebRequest::State_Completed:
+            case wxWebRequest::State_Failed:
+            case wxWebRequest::State_Cancelled:
+                {
+                    const int id = event.GetId();
+                    wxCHECK_MSG( id >= 0 &&
+                                    static_cast<size_t>(id) < m_requests.size(),
+                                 processed, "event from unknown request" );
+
+                    // The request may be resumed after the authentication
+                    // challenge and finish again, don't count it twice.
+                    if ( !m_isFinished[id] )
+                    {
+                        m_active--;
+                        MarkFinished(id);
+                        StartNext();
+                    }
+                }
+                break;
+        }
+    }
+
+    return processed;
+}
+
 // ----------------------------------------------------------------------------
 // Module ensuring all global/singleton objects are destroyed on shutdown.
 // ----------------------------------------------------------------------------
@@ -128,6 +128,20 @@ wxWebResponseCURL::wxWebResponseCURL(wxWebRequestCURL& request) :
 
 size_t wxWebResponseCURL::CURLOnWrite(void* buffer, size_t size)
 {
+    if ( m_request.HasDataCallback() )
+    {
+        // Pass the data directly to the callback without copying it.
+        if ( !m_request.CallDataCallback(buffer, size) )
+        {
+            // libcurl will call us again with the same data after resuming.
+            wxLogTrace(wxTRACE_WEBREQUEST, "Request %p: paused", &m_request);
+            return CURL_WRITEFUNC_PAUSE;
+        }
+
+        m_request.ReportDataReceived(size);
+        return size;
+    }
+
     void* buf = GetDataBuffer(size);
     memcpy(buf, buffer, size);
     ReportDataReceived(size);
@@ -216,6 +230,62 @@ int wxWebResponseCURL::GetStatus() const
     return status;
 }
 
+namespace
+{
+
+// Get the time in microseconds using either the given curl_off_t info, if
+// supported, or the older double one otherwise.
+wxLongLong_t
+GetCURLTimeInfo(CURL* handle, int info, CURLINFO infoDouble)
+{
+#if CURL_AT_LEAST_VERSION(7, 61, 0)
+    if ( wxWebSessionCURL::CurlRuntimeAtLeastVersion(7, 61, 0) )
+    {
+        curl_off_t t;
+        if ( curl_easy_getinfo(handle, static_cast<CURLINFO>(info), &t) != CURLE_OK )
+            return -1;
+
+        return t;
+    }
+#else
+    wxUnusedVar(info);
+#endif // curl >= 7.61
+
+    double t;
+    if ( curl_easy_getinfo(handle, infoDouble, &t) != CURLE_OK )
+        return -1;
+
+    return static_cast<wxLongLong_t>(t * 1000000);
+}
+
+} // anonymous namespace
+
+wxWebResponseTimings wxWebResponseCURL::GetTimings() const
+{
+#if CURL_AT_LEAST_VERSION(7, 61, 0)
+    #define wxCURL_TIME_INFO(name) CURLINFO_ ## name ## _T, CURLINFO_ ## name
+#else
+    #define wxCURL_TIME_INFO(name) 0, CURLINFO_ ## name
+#endif
+
+    CURL* const handle = GetHandle();
+
+    wxWebResponseTimings timings;
+    timings.nameLookup = GetCURLTimeInfo(handle, wxCURL_TIME_INFO(NAMELOOKUP_TIME));
+    timings.connect = GetCURLTimeInfo(handle, wxCURL_TIME_INFO(CONNECT_TIME));
+    timings.tlsHandshake = GetCURLTimeInfo(handle, wxCURL_TIME_INFO(APPCONNECT_TIME));
+    timings.firstByte = GetCURLTimeInfo(handle, wxCURL_TIME_INFO(STARTTRANSFER_TIME));
+    timings.total = GetCURLTimeInfo(handle, wxCURL_TIME_INFO(TOTAL_TIME));
+
+    #undef wxCURL_TIME_INFO
+
+    // APPCONNECT_TIME is 0 for plain HTTP connections
+    if ( !timings.tlsHandshake )
+        timings.tlsHandshake = -1;
+
+    return timings;
+}
+
 //
 // wxWebRequestCURL
 //
@@ -279,6 +349,8 @@ wxWebRequestCURL::wxWebRequestCURL(wxWebSession & session,
     // Enable all supported authentication methods
     curl_easy_setopt(m_handle, CURLOPT_HTTPAUTH, CURLAUTH_ANY);
     curl_easy_setopt(m_handle, CURLOPT_PROXYAUTH, CURLAUTH_ANY);
+
+    m_sessionImpl.ApplyOptions(m_handle);
 }
 
 wxWebRequestCURL::~wxWebRequestCURL()
@@ -352,6 +424,13 @@ bool wxWebRequestCURL::StartRequest()
     return true;
 }
 
+bool wxWebRequestCURL::Resume()
+{
+    wxLogTrace(wxTRACE_WEBREQUEST, "Request %p: resuming", this);
+
+    return curl_easy_pause(m_handle, CURLPAUSE_CONT) == CURLE_OK;
+}
+
 void wxWebRequestCURL::DoCancel()
 {
     m_sessionImpl.CancelRequest(this);
@@ -954,12 +1033,130 @@ wxWebSessionCURL::CreateRequest(wxWebSession& session,
             curl_multi_setopt(m_handle, CURLMOPT_SOCKETFUNCTION, SocketCallback);
             curl_multi_setopt(m_handle, CURLMOPT_TIMERDATA, this);
             curl_multi_setopt(m_handle, CURLMOPT_TIMERFUNCTION, TimerCallback);
+
+            ApplyMultiOptions();
         }
     }
 
     return wxWebRequestImplPtr(new wxWebRequestCURL(session, *this, handler, url, id));
 }
 
+bool wxWebSessionCURL::EnableMultiplexing(bool enable)
+{
+#if CURL_AT_LEAST_VERSION(7, 43, 0)
+    if ( !CurlRuntimeAtLeastVersion(7, 43, 0) )
+        return false;
+
+    m_multiplexing = enable;
+    ApplyMultiOptions();
+
+    return true;
+#else
+    wxUnusedVar(enable);
+    return false;
+#endif
+}
+
+bool wxWebSessionCURL::SetMaxConnections(int maxTotal, int maxPerHost)
+{
+#if CURL_AT_LEAST_VERSION(7, 30, 0)
+    if ( !CurlRuntimeAtLeastVersion(7, 30, 0) )
+        return false;
+
+    m_maxTotalConnections = maxTotal;
+    m_maxHostConnections = maxPerHost;
+    ApplyMultiOptions();
+
+    return true;
+#else
+    wxUnusedVar(maxTotal);
+    wxUnusedVar(maxPerHost);
+    return false;
+#endif
+}
+
+bool wxWebSessionCURL::EnableKeepAlive(bool enable)
+{
+    m_keepAlive = enable;
+
+    return true;
+}
+
+bool wxWebSessionCURL::SetDNSCacheTimeout(int seconds)
+{
+    m_hasDNSCacheTimeout = true;
+    m_dnsCacheTimeout = seconds;
+
+    return true;
+}
+
+void wxWebSessionCURL::ApplyMultiOptions()
+{
+    // The options will be applied when the handle is created.
+    if ( !m_handle )
+        return;
+
+#if CURL_AT_LEAST_VERSION(7, 43, 0)
+    if ( m_multiplexing != -1 )
+    {
+        curl_multi_setopt(m_handle, CURLMOPT_PIPELINING,
+                          m_multiplexing ? CURLPIPE_MULTIPLEX : CURLPIPE_NOTHING);
+    }
+#endif // curl >= 7.43
+
+#if CURL_AT_LEAST_VERSION(7, 30, 0)
+    if ( m_maxTotalConnections != -1 )
+    {
+        curl_multi_setopt(m_handle, CURLMOPT_MAX_TOTAL_CONNECTIONS,
+                          m_maxTotalConnections);
+
+        // Also keep as many connections in the cache for reusing them later,
+        // by default it's only 4 times the number of transfers.
+        if ( m_maxTotalConnections )
+        {
+            curl_multi_setopt(m_handle, CURLMOPT_MAXCONNECTS,
+                              m_maxTotalConnections);
+        }
+    }
+
+    if ( m_maxHostConnections != -1 )
+    {
+        curl_multi_setopt(m_handle, CURLMOPT_MAX_HOST_CONNECTIONS,
+                          m_maxHostConnections);
+    }
+#endif // curl >= 7.30
+}
+
+void wxWebSessionCURL::ApplyOptions(CURL* handle) const
+{
+#if CURL_AT_LEAST_VERSION(7, 47, 0)
+    if ( m_multiplexing == 1 && CurlRuntimeAtLeastVersion(7, 47, 0) )
+    {
+        // Use HTTP/2 for HTTPS and wait for the existing connections to the
+        // same host to be established to multiplex over them instead of
+        // opening new ones.
+        curl_easy_setopt(handle, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_2TLS);
+        curl_easy_setopt(handle, CURLOPT_PIPEWAIT, 1L);
+    }
+#endif // curl >= 7.47
+
+    switch ( m_keepAlive )
+    {
+        case 0:
+            curl_easy_setopt(handle, CURLOPT_FORBID_REUSE, 1L);
+            break;
+
+        case 1:
+#if CURL_AT_LEAST_VERSION(7, 25, 0)
+            curl_easy_setopt(handle, CURLOPT_TCP_KEEPALIVE, 1L);
+#endif // curl >= 7.25
+            break;
+    }
+
+    if ( m_hasDNSCacheTimeout )
+        curl_easy_setopt(handle, CURLOPT_DNS_CACHE_TIMEOUT, m_dnsCacheTimeout);
+}
+
 bool wxWebSessionCURL::StartRequest(wxWebRequestCURL & request)
 {
     // Add request easy handle to multi handle
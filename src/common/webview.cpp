@@ -145,6 +145,22 @@ public:
     wxInputStream* m_stream;
 };
 
+// wxWebViewHandlerResponseData
+wxFileOffset wxWebViewHandlerResponseData::GetContentLength()
+{
+    wxInputStream* const stream = GetStream();
+    return stream ? stream->GetLength() : wxInvalidOffset;
+}
+
+// wxWebViewHandlerResponseDataStream
+wxFileOffset wxWebViewHandlerResponseDataStream::GetContentLength()
+{
+    if (m_length != wxInvalidOffset)
+        return m_length;
+
+    return wxWebViewHandlerResponseData::GetContentLength();
+}
+
 // wxWebViewHandlerResponse
 void wxWebViewHandlerResponse::Finish(const wxString& text,
     const wxMBConv& conv)
@@ -153,6 +169,12 @@ void wxWebViewHandlerResponse::Finish(const wxString& text,
         new wxWebViewHandlerResponseDataString(text.mb_str(conv))));
 }
 
+void wxWebViewHandlerResponse::Finish(wxInputStream* stream, wxFileOffset length)
+{
+    Finish(wxSharedPtr<wxWebViewHandlerResponseData>(
+        new wxWebViewHandlerResponseDataStream(stream, length)));
+}
+
 // wxWebViewHandlerResponseDataFile
 class wxWebViewHandlerResponseDataFile : public wxWebViewHandlerResponseData
 {
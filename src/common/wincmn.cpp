@@ -44,6 +44,7 @@
     #include "wx/sizer.h"
     #include "wx/menu.h"
     #include "wx/button.h"
+    #include "wx/app.h"
 #endif //WX_PRECOMP
 
 #if wxUSE_DRAG_AND_DROP
@@ -70,8 +71,17 @@
     #include "wx/sysopt.h"
 #endif
 
+#if wxUSE_TIMER
+    #include "wx/timer.h"
+#endif // wxUSE_TIMER
+
 #include "wx/display.h"
+#include "wx/module.h"
+#include "wx/paintprofiler.h"
+#include "wx/resourcestats.h"
 #include "wx/platinfo.h"
+#include "wx/time.h"
+#include "wx/weakref.h"
 #include "wx/recguard.h"
 #include "wx/private/rescale.h"
 #include "wx/private/window.h"
@@ -83,6 +93,9 @@
 
 #include <math.h>
 
+#include <algorithm>
+#include <vector>
+
 // Windows List
 WXDLLIMPEXP_DATA_CORE(wxWindowList) wxTopLevelWindows;
 
@@ -105,6 +118,75 @@ bool IsInCaptureStack(wxWindowBase* win);
 // static data
 // ----------------------------------------------------------------------------
 
+namespace
+{
+
+// Windows for which ScheduleLayout() was called, in no particular order.
+//
+// Invariant: a window is in this vector iff its m_layoutScheduled is set.
+std::vector<wxWindowBase*> gs_scheduledLayouts;
+
+// Windows with pending frame callbacks using the generic implementation of
+// DoRequestFrame().
+std::vector<wxWindowBase*> gs_frameRequests;
+
+// Windows whose frame callbacks are being currently called, the destroyed
+// windows are replaced with null pointers in it.
+std::vector<wxWindowBase*>* gs_frameRequestsInProgress = nullptr;
+
+#if wxUSE_TIMER
+
+// Timer used to call the frame callbacks of the windows in gs_frameRequests.
+class wxFrameRequestTimer : public wxTimer
+{
+public:
+    // We don't know the real refresh rate of the display, so use the most
+    // common one.
+    static constexpr int INTERVAL = 1000 / 60;
+
+    virtual void Notify() override
+    {
+        // Callbacks can request another frame, which must not be done in this
+        // one, so start with an empty vector.
+        std::vector<wxWindowBase*> windows;
+        windows.swap(gs_frameRequests);
+
+        gs_frameRequestsInProgress = &windows;
+
+        const wxLongLong frameTime = wxGetUTCTimeUSec();
+        for ( wxWindowBase* win : windows )
+        {
+            if ( win )
+                win->WXProcessFrameCallbacks(frameTime);
+        }
+
+        gs_frameRequestsInProgress = nullptr;
+    }
+};
+
+wxFrameRequestTimer* gs_frameRequestTimer = nullptr;
+
+#endif // wxUSE_TIMER
+
+} // anonymous namespace
+
+#if wxUSE_TIMER
+
+class wxFrameRequestModule : public wxModule
+{
+public:
+    wxFrameRequestModule() = default;
+
+    virtual bool OnInit() override { return true; }
+    virtual void OnExit() override { wxDELETE(gs_frameRequestTimer); }
+
+private:
+    wxDECLARE_DYNAMIC_CLASS(wxFrameRequestModule);
+};
+
+wxIMPLEMENT_DYNAMIC_CLASS(wxFrameRequestModule, wxModule);
+
+#endif // wxUSE_TIMER
 
 wxIMPLEMENT_ABSTRACT_CLASS(wxWindowBase, wxEvtHandler);
 
@@ -314,9 +396,14 @@ wxWindowBase::wxWindowBase()
     m_windowSizer = nullptr;
     m_containingSizer = nullptr;
     m_autoLayout = false;
+    m_layoutScheduled = false;
 
     m_disableFocusFromKbd = false;
 
+    m_hasIdleHandler =
+    m_hasUpdateUIHandler =
+    m_checkedEventTable = false;
+
 #if wxUSE_DRAG_AND_DROP
     m_dropTarget = nullptr;
 #endif // wxUSE_DRAG_AND_DROP
@@ -356,6 +443,9 @@ wxWindowBase::wxWindowBase()
     m_isBeingDeleted = false;
 
     m_freezeCount = 0;
+
+    if ( wxResourceStats::IsEnabled() )
+        wxResourceStats::OnWindowCreated(this);
 }
 
 // common part of window creation process
@@ -461,6 +551,13 @@ wxWindowBase::~wxWindowBase()
     // immediately: don't leave dangling pointers.
     wxPendingDelete.DeleteObject(this);
 
+    wxUpdateUIEvent::ForgetElement(this);
+
+    wxPaintProfiler::OnWindowDestroyed(this);
+
+    if ( wxResourceStats::IsEnabled() )
+        wxResourceStats::OnWindowDestroyed(this);
+
     // Just in case we've loaded a top-level window via LoadNativeDialog but
     // we weren't a dialog class
     wxTopLevelWindows.DeleteObject(this);
@@ -511,6 +608,13 @@ wxWindowBase::~wxWindowBase()
 
     delete m_windowSizer;
 
+    WXCancelScheduledLayout();
+
+    // Note that this only cancels the generic frame request, the ports using
+    // their own implementation must cancel it in their own dtor.
+    if ( !m_frameCallbacks.empty() )
+        wxWindowBase::DoCancelFrameRequest();
+
 #if wxUSE_DRAG_AND_DROP
     delete m_dropTarget;
 #endif // wxUSE_DRAG_AND_DROP
@@ -625,6 +729,11 @@ void wxWindowBase::DoCentre(int dir)
 void wxWindowBase::Fit()
 {
     SetSize(GetBestSize());
+
+    // Resizing the window may or not have laid it out, but if it was going to
+    // be done later anyhow, do it now, as its new size is already known.
+    if ( m_layoutScheduled )
+        Layout();
 }
 
 // fits virtual size (ie. scrolled area etc.) around children
@@ -659,6 +768,10 @@ void wxWindowBase::InvalidateBestSize()
 {
     m_bestSizeCache = wxDefaultSize;
 
+    // the minimal size of the sizer containing us depends on our best size
+    if ( m_containingSizer )
+        m_containingSizer->InvalidateMinSize();
+
     // parent's best size calculation may depend on its children's
     // as long as child window we are in is not top level window itself
     // (because the TLW size is never resized automatically)
@@ -1071,6 +1184,9 @@ void wxWindowBase::DoSetSizeHints( int minW, int minH,
     m_maxWidth = maxW;
     m_minHeight = minH;
     m_maxHeight = maxH;
+
+    if ( m_containingSizer )
+        m_containingSizer->InvalidateMinSize();
 }
 
 void wxWindowBase::DoSetVirtualSize( int x, int y )
@@ -1152,6 +1268,10 @@ bool wxWindowBase::Show(bool show)
     {
         m_isShown = show;
 
+        // hidden windows don't take space in the sizer
+        if ( m_containingSizer )
+            m_containingSizer->InvalidateMinSize();
+
         return true;
     }
     else
@@ -1534,6 +1654,9 @@ bool wxWindowBase::RemoveEventHandler(wxEvtHandler *handlerToRemove)
 
 bool wxWindowBase::HandleWindowEvent(wxEvent& event) const
 {
+    if ( wxPaintProfiler::IsRunning() && event.GetEventType() == wxEVT_PAINT )
+        return wxPaintProfiler::ProcessPaintEvent(this, event);
+
     // SafelyProcessEvent() will handle exceptions nicely
     return GetEventHandler()->SafelyProcessEvent(event);
 }
@@ -2472,8 +2595,138 @@ void wxWindowBase::SatisfyConstraints()
 
 #endif // wxUSE_CONSTRAINTS
 
+void wxWindowBase::ScheduleLayout()
+{
+    if ( m_layoutScheduled )
+        return;
+
+    m_layoutScheduled = true;
+    gs_scheduledLayouts.push_back(this);
+
+    // Ensure that we get an idle event in which the layout is done.
+    wxWakeUpIdle();
+}
+
+void wxWindowBase::WXCancelScheduledLayout()
+{
+    if ( !m_layoutScheduled )
+        return;
+
+    m_layoutScheduled = false;
+    gs_scheduledLayouts.erase(std::find(gs_scheduledLayouts.begin(),
+                                        gs_scheduledLayouts.end(),
+                                        this));
+}
+
+/* static */
+void wxWindowBase::ProcessScheduledLayouts()
+{
+    if ( gs_scheduledLayouts.empty() )
+        return;
+
+    // Lay out the parent windows before their children, as doing it often
+    // lays out the children too, and then they don't need to be done again.
+    const auto depth = [](const wxWindowBase* win)
+    {
+        int n = 0;
+        for ( ; win; win = win->GetParent() )
+            n++;
+        return n;
+    };
+
+    std::stable_sort(gs_scheduledLayouts.begin(), gs_scheduledLayouts.end(),
+                     [depth](const wxWindowBase* w1, const wxWindowBase* w2)
+                     {
+                         return depth(w1) < depth(w2);
+                     });
+
+    // Notice that the vector can be modified by Layout(), e.g. if it lays out
+    // (or destroys) other scheduled windows, so don't use iterators here.
+    while ( !gs_scheduledLayouts.empty() )
+    {
+        wxWindowBase* const win = gs_scheduledLayouts.front();
+        gs_scheduledLayouts.erase(gs_scheduledLayouts.begin());
+        win->m_layoutScheduled = false;
+
+        if ( !win->IsBeingDeleted() )
+            win->Layout();
+    }
+}
+
+// ----------------------------------------------------------------------------
+// frame callbacks
+// ----------------------------------------------------------------------------
+
+void wxWindowBase::RequestFrame(const FrameCallback& callback)
+{
+    wxCHECK_RET( callback, "frame callback must be valid" );
+
+    const bool first = m_frameCallbacks.empty();
+
+    m_frameCallbacks.push_back(callback);
+
+    if ( first )
+        DoRequestFrame();
+}
+
+void wxWindowBase::WXProcessFrameCallbacks(wxLongLong frameTime)
+{
+    // Callbacks may call RequestFrame() again, which must schedule them for
+    // the next frame, so take them out of m_frameCallbacks first.
+    std::vector<FrameCallback> callbacks;
+    callbacks.swap(m_frameCallbacks);
+
+    // Stop calling them if this window is destroyed by one of them.
+    wxWeakRef<wxWindowBase> self(this);
+    for ( const FrameCallback& callback : callbacks )
+    {
+        if ( !self )
+            break;
+
+        callback(frameTime);
+    }
+}
+
+void wxWindowBase::DoRequestFrame()
+{
+#if wxUSE_TIMER
+    gs_frameRequests.push_back(this);
+
+    if ( !gs_frameRequestTimer )
+        gs_frameRequestTimer = new wxFrameRequestTimer;
+
+    if ( !gs_frameRequestTimer->IsRunning() )
+        gs_frameRequestTimer->StartOnce(wxFrameRequestTimer::INTERVAL);
+#else // !wxUSE_TIMER
+    // Without timers, we can only call the callbacks as soon as possible.
+    CallAfter([this]()
+        {
+            WXProcessFrameCallbacks(wxGetUTCTimeUSec());
+        });
+#endif // wxUSE_TIMER/!wxUSE_TIMER
+}
+
+void wxWindowBase::DoCancelFrameRequest()
+{
+    gs_frameRequests.erase(std::remove(gs_frameRequests.begin(),
+                                       gs_frameRequests.end(),
+                                       this),
+                           gs_frameRequests.end());
+
+    if ( gs_frameRequestsInProgress )
+    {
+        std::replace(gs_frameRequestsInProgress->begin(),
+                     gs_frameRequestsInProgress->end(),
+                     this,
+                     static_cast<wxWindowBase*>(nullptr));
+    }
+}
+
 bool wxWindowBase::Layout()
 {
+    // This layout makes the one scheduled before unnecessary.
+    WXCancelScheduledLayout();
+
     // If there is a sizer, use it instead of the constraints
     if ( GetSizer() )
     {
@@ -2750,12 +3003,17 @@ void wxWindowBase::AdjustForParentClientOrigin(int& x, int& y, int sizeFlags) co
 
 void wxWindowBase::UpdateWindowUI(long flags)
 {
-    wxUpdateUIEvent event(GetId());
-    event.SetEventObject(this);
-
-    if ( GetEventHandler()->ProcessEvent(event) )
+    if ( !wxUpdateUIEvent::IsUpToDate(this) )
     {
-        DoUpdateWindowUI(event);
+        wxUpdateUIEvent event(GetId());
+        event.SetEventObject(this);
+
+        if ( GetEventHandler()->ProcessEvent(event) )
+        {
+            DoUpdateWindowUI(event);
+        }
+
+        event.RememberDependencies(this);
     }
 
     if (flags & wxUPDATE_UI_RECURSE)
@@ -2792,8 +3050,24 @@ bool wxWindowBase::SendIdleEvents(wxIdleEvent& event)
     OnInternalIdle();
 
     // should we send idle event to this window?
-    if (wxIdleEvent::GetMode() == wxIDLE_PROCESS_ALL ||
-        HasExtraStyle(wxWS_EX_PROCESS_IDLE))
+    bool sendIdle;
+    switch ( wxIdleEvent::GetMode() )
+    {
+        case wxIDLE_PROCESS_ALL:
+            sendIdle = true;
+            break;
+
+        case wxIDLE_PROCESS_SPECIFIED:
+            sendIdle = HasExtraStyle(wxWS_EX_PROCESS_IDLE);
+            break;
+
+        case wxIDLE_PROCESS_REGISTERED:
+        default:
+            sendIdle = WXIsRegisteredForIdle();
+            break;
+    }
+
+    if ( sendIdle )
     {
         event.SetEventObject(this);
         HandleWindowEvent(event);
@@ -2818,6 +3092,76 @@ void wxWindowBase::OnInternalIdle()
         UpdateWindowUI(wxUPDATE_UI_FROMIDLE);
 }
 
+void wxWindowBase::CheckEventTableHandlers() const
+{
+    if ( m_checkedEventTable )
+        return;
+
+    m_checkedEventTable = true;
+
+    for ( const wxEventTable* table = GetEventTable();
+          table;
+          table = table->baseTable )
+    {
+        for ( const wxEventTableEntry* entry = table->entries;
+              entry->m_fn;
+              entry++ )
+        {
+            if ( entry->m_eventType == wxEVT_IDLE )
+                m_hasIdleHandler = true;
+            else if ( entry->m_eventType == wxEVT_UPDATE_UI )
+                m_hasUpdateUIHandler = true;
+        }
+    }
+}
+
+bool wxWindowBase::WXIsRegisteredForIdle() const
+{
+    // We don't know which events the pushed event handlers may handle, so be
+    // conservative and always send events to the windows using them.
+    if ( GetEventHandler() != this )
+        return true;
+
+    CheckEventTableHandlers();
+
+    return m_hasIdleHandler || HasExtraStyle(wxWS_EX_PROCESS_IDLE);
+}
+
+bool wxWindowBase::WXIsRegisteredForUpdateUI() const
+{
+    // UI update events propagate upwards until the top level parent, so check
+    // all the windows which could handle them.
+    for ( const wxWindowBase* win = this; win; win = win->GetParent() )
+    {
+        if ( win->GetEventHandler() != win )
+            return true;
+
+        win->CheckEventTableHandlers();
+
+        if ( win->m_hasUpdateUIHandler ||
+                win->HasExtraStyle(wxWS_EX_PROCESS_UI_UPDATES) )
+            return true;
+
+        if ( win->IsTopLevel() )
+            break;
+    }
+
+    return false;
+}
+
+bool wxWindowBase::OnDynamicBind(wxDynamicEventTableEntry& entry)
+{
+    // Notice that we never reset these flags, even if the handler is unbound
+    // later, as this is not worth the trouble: sending a few unnecessary
+    // events is harmless.
+    if ( entry.m_eventType == wxEVT_IDLE )
+        m_hasIdleHandler = true;
+    else if ( entry.m_eventType == wxEVT_UPDATE_UI )
+        m_hasUpdateUIHandler = true;
+
+    return wxEvtHandler::OnDynamicBind(entry);
+}
+
 // ----------------------------------------------------------------------------
 // Conversions between various pixel kinds and dialog units translations
 // ----------------------------------------------------------------------------
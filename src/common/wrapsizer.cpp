@@ -20,7 +20,6 @@
 
 
 #include "wx/wrapsizer.h"
-#include "wx/vector.h"
 
 namespace
 {
@@ -76,6 +75,7 @@ wxWrapSizer::wxWrapSizer(int orient, int flags)
              m_minSizeMinor(0),
              m_maxSizeMajor(0),
              m_minItemMajor(INT_MAX),
+             m_itemMinSizesValid(false),
              m_rows(orient ^ wxBOTH)
 {
 }
@@ -166,6 +166,10 @@ wxSize wxWrapSizer::CalcMin()
     if ( m_children.empty() )
         return wxSize();
 
+    // The items sizes may have changed since the last call, so measure them
+    // again, but only once, if we need them.
+    m_itemMinSizesValid = false;
+
     // We come here to calculate min size in two different situations:
     // 1 - Immediately after InformFirstDirection, then we find a min size that
     //     uses one dimension maximally and the other direction minimally.
@@ -208,6 +212,28 @@ wxSize wxWrapSizer::CalcMin()
     return m_calculatedMinSize;
 }
 
+const std::vector<wxSize>& wxWrapSizer::GetShownItemsMinSizes()
+{
+    if ( !m_itemMinSizesValid )
+    {
+        m_itemMinSizes.clear();
+        m_itemMinSizes.reserve(m_children.size());
+
+        for ( wxSizerItemList::const_iterator i = m_children.begin();
+              i != m_children.end();
+              ++i )
+        {
+            wxSizerItem * const item = *i;
+            if ( item->IsShown() )
+                m_itemMinSizes.push_back(item->CalcMin());
+        }
+
+        m_itemMinSizesValid = true;
+    }
+
+    return m_itemMinSizes;
+}
+
 void wxWrapSizer::CalcMinFittingSize(const wxSize& szBoundary)
 {
     // Min size based on current line layout. It is important to
@@ -248,19 +274,14 @@ void wxWrapSizer::CalcMaxSingleItemSize()
     // Find max item size in each direction
     int maxMajor = 0;    // Widest item
     int maxMinor = 0;    // Line height
-    for ( wxSizerItemList::const_iterator i = m_children.begin();
-          i != m_children.end();
-          ++i )
+    const std::vector<wxSize>& sizes = GetShownItemsMinSizes();
+    for ( size_t n = 0; n < sizes.size(); n++ )
     {
-        wxSizerItem * const item = *i;
-        if ( item->IsShown() )
-        {
-            wxSize sz = item->CalcMin();
-            if ( SizeInMajorDir(sz) > maxMajor )
-                maxMajor = SizeInMajorDir(sz);
-            if ( SizeInMinorDir(sz) > maxMinor )
-                maxMinor = SizeInMinorDir(sz);
-        }
+        wxSize sz = sizes[n];
+        if ( SizeInMajorDir(sz) > maxMajor )
+            maxMajor = SizeInMajorDir(sz);
+        if ( SizeInMinorDir(sz) > maxMinor )
+            maxMinor = SizeInMinorDir(sz);
     }
 
     // This is, of course, not our real minimal size but if we return more
@@ -282,15 +303,10 @@ void wxWrapSizer::CalcMinFromMajor(int totMajor)
     int rowTotalMajor = 0;      // sum of major sizes of items in this row
 
     // pack the items in each row until we reach totMajor, then start a new row
-    for ( wxSizerItemList::const_iterator i = m_children.begin();
-          i != m_children.end();
-          ++i )
+    const std::vector<wxSize>& sizes = GetShownItemsMinSizes();
+    for ( size_t n = 0; n < sizes.size(); n++ )
     {
-        wxSizerItem * const item = *i;
-        if ( !item->IsShown() )
-            continue;
-
-        wxSize minItemSize = item->CalcMin();
+        wxSize minItemSize = sizes[n];
         const int itemMajor = SizeInMajorDir(minItemSize);
         const int itemMinor = SizeInMinorDir(minItemSize);
 
@@ -328,8 +344,8 @@ void wxWrapSizer::CalcMinFromMajor(int totMajor)
 // Helper struct for CalcMinFromMinor
 struct wxWrapLine
 {
-    wxWrapLine() : m_first(nullptr), m_width(0) { }
-    wxSizerItem *m_first;
+    wxWrapLine() : m_firstMajor(-1), m_width(0) { }
+    int m_firstMajor;   // Major size of the first non-empty item, if any
     int m_width;        // Width of line
 };
 
@@ -345,23 +361,20 @@ void wxWrapSizer::CalcMinFromMinor(int totMinor)
     int totMajor = 0;    // Sum of widths
     int maxMinor = 0;    // Line height
     int maxMajor = 0;    // Widest item
-    int itemCount = 0;
-    wxSizerItemList::compatibility_iterator node = m_children.GetFirst();
-    wxSize sz;
-    while (node)
+
+    // All the item sizes are computed only once and reused in all the
+    // iterations of the loop below.
+    const std::vector<wxSize>& sizes = GetShownItemsMinSizes();
+    const size_t itemCount = sizes.size();
+    size_t n;
+    for ( n = 0; n < itemCount; n++ )
     {
-        wxSizerItem *item = node->GetData();
-        if ( item->IsShown() )
-        {
-            sz = item->CalcMin();
-            totMajor += SizeInMajorDir(sz);
-            if ( SizeInMinorDir(sz)>maxMinor )
-                maxMinor = SizeInMinorDir(sz);
-            if ( SizeInMajorDir(sz)>maxMinor )
-                maxMajor = SizeInMajorDir(sz);
-            itemCount++;
-        }
-        node = node->GetNext();
+        wxSize sz = sizes[n];
+        totMajor += SizeInMajorDir(sz);
+        if ( SizeInMinorDir(sz)>maxMinor )
+            maxMinor = SizeInMinorDir(sz);
+        if ( SizeInMajorDir(sz)>maxMinor )
+            maxMajor = SizeInMajorDir(sz);
     }
 
     // The trivial case
@@ -394,44 +407,42 @@ void wxWrapSizer::CalcMinFromMinor(int totMinor)
     // 3d - Otherwise increase width by known smallest item
     //      and redo loop
 
-    // First algo step: put items on lines of known max width
-    wxVector<wxWrapLine*> lines;
+    // First algo step: put items on lines of known max width, this vector is
+    // reused for all iterations to avoid reallocating it every time.
+    std::vector<wxWrapLine> lines;
 
     int sumMinor;       // Sum of all minor sizes (height of all lines)
 
     // While we still have items 'spilling over' extend the tested line width
     for ( ;; )
     {
-        wxWrapLine *line = new wxWrapLine;
-        lines.push_back( line );
+        lines.clear();
+        lines.push_back(wxWrapLine());
 
         int tailSize = 0;   // Width of what exceeds nrLines
         maxMinor = 0;
         sumMinor = 0;
-        for ( node=m_children.GetFirst(); node; node=node->GetNext() )
+        for ( n = 0; n < itemCount; n++ )
         {
-            wxSizerItem *item = node->GetData();
-            if ( item->IsShown() )
+            wxSize sz = sizes[n];
+            if ( lines.back().m_width+SizeInMajorDir(sz)>lineSize )
             {
-                sz = item->GetMinSizeWithBorder();
-                if ( line->m_width+SizeInMajorDir(sz)>lineSize )
-                {
-                    line = new wxWrapLine;
-                    lines.push_back(line);
-                    sumMinor += maxMinor;
-                    maxMinor = 0;
-                }
-                line->m_width += SizeInMajorDir(sz);
-                if ( line->m_width && !line->m_first )
-                    line->m_first = item;
-                if ( SizeInMinorDir(sz)>maxMinor )
-                    maxMinor = SizeInMinorDir(sz);
-                if ( sumMinor+maxMinor>totMinor )
-                {
-                    // Keep track of widest tail item
-                    if ( SizeInMajorDir(sz)>tailSize )
-                        tailSize = SizeInMajorDir(sz);
-                }
+                lines.push_back(wxWrapLine());
+                sumMinor += maxMinor;
+                maxMinor = 0;
+            }
+
+            wxWrapLine& line = lines.back();
+            line.m_width += SizeInMajorDir(sz);
+            if ( line.m_width && line.m_firstMajor == -1 )
+                line.m_firstMajor = SizeInMajorDir(sz);
+            if ( SizeInMinorDir(sz)>maxMinor )
+                maxMinor = SizeInMinorDir(sz);
+            if ( sumMinor+maxMinor>totMinor )
+            {
+                // Keep track of widest tail item
+                if ( SizeInMajorDir(sz)>tailSize )
+                    tailSize = SizeInMajorDir(sz);
             }
         }
 
@@ -445,8 +456,8 @@ void wxWrapSizer::CalcMinFromMinor(int totMinor)
             {
                 // Take what is not used on this line, see how much extension we get
                 // by adding first item on next line.
-                int size = lineSize-lines[ix]->m_width; // Left over at end of this line
-                int extSize = GetSizeInMajorDir(lines[ix+1]->m_first->GetMinSizeWithBorder()) - size;
+                int size = lineSize-lines[ix].m_width; // Left over at end of this line
+                int extSize = lines[ix+1].m_firstMajor - size;
                 if ( (extSize>=tailSize && (extSize<bestExtSize || bestExtSize<tailSize)) ||
                     (extSize>bestExtSize && bestExtSize<tailSize) )
                     bestExtSize = extSize;
@@ -454,14 +465,7 @@ void wxWrapSizer::CalcMinFromMinor(int totMinor)
             // Have an extension size, ready to redo line layout
             lineSize += bestExtSize;
         }
-
-        // Clear helper items
-        for ( wxVector<wxWrapLine*>::iterator it=lines.begin(); it<lines.end(); ++it )
-            delete *it;
-        lines.clear();
-
-        // No spill over?
-        if ( !tailSize )
+        else // No spill over
         {
             // Add minor size of the last line
             sumMinor += maxMinor;
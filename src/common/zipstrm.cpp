@@ -278,6 +278,9 @@ protected:
     virtual size_t OnSysRead(void *buffer, size_t size) override;
     virtual wxFileOffset OnSysTell() const override { return m_pos; }
 
+    virtual size_t DoPeekBuffer(const void **data) override;
+    virtual void DoConsumeBuffer(size_t size) override;
+
 private:
     wxFileOffset m_pos;
     wxFileOffset m_len;
@@ -305,6 +308,23 @@ size_t wxStoredInputStream::OnSysRead(void *buffer, size_t size)
     return count;
 }
 
+size_t wxStoredInputStream::DoPeekBuffer(const void **data)
+{
+    // Pass through the parent stream buffer, if any, without going beyond the
+    // end of this entry.
+    size_t count = m_parent_i_stream->PeekBuffer(data);
+    if (m_len - m_pos < wxFileOffset(count))
+        count = wx_truncate_cast(size_t, m_len - m_pos);
+
+    return count;
+}
+
+void wxStoredInputStream::DoConsumeBuffer(size_t size)
+{
+    m_parent_i_stream->ConsumeBuffer(size);
+    m_pos += size;
+}
+
 
 /////////////////////////////////////////////////////////////////////////////
 // Stored output stream
@@ -1596,6 +1616,9 @@ void wxZipInputStream::Init()
     m_position = wxInvalidOffset;
     m_signature = 0;
     m_TotalEntries = 0;
+    m_centralOffset = wxInvalidOffset;
+    m_centralSize = 0;
+    m_indexLoaded = false;
     m_lasterror = m_parent_i_stream->GetLastError();
 }
 
@@ -1701,6 +1724,8 @@ bool wxZipInputStream::LoadEndRecord()
         m_signature = magic;
         m_position = endrec.GetOffset();
         m_offsetAdjustment = 0;
+        m_centralOffset = m_position;
+        m_centralSize = endrec.GetSize();
         return true;
     }
 
@@ -1716,6 +1741,8 @@ bool wxZipInputStream::LoadEndRecord()
         if ( endrec.GetOffset() >= 0 && endrec.GetOffset() < m_position )
         {
             m_offsetAdjustment = m_position - endrec.GetOffset();
+            m_centralOffset = m_position;
+            m_centralSize = recSize;
             return true;
         }
     }
@@ -1825,23 +1852,129 @@ wxStreamError wxZipInputStream::ReadCentral()
     m_position += size;
     m_signature = ReadSignature();
 
+    if (!AdjustOffset(m_entry)) {
+        m_signature = 0;
+        return wxSTREAM_READ_ERROR;
+    }
+
+    return wxSTREAM_NO_ERROR;
+}
+
+// Apply the offset adjustment for the zips appended to something else and
+// set the entry key.
+//
+bool wxZipInputStream::AdjustOffset(wxZipEntry& entry) const
+{
     if (m_offsetAdjustment) {
         // Offset read from the stream is 4 bytes independently of the
         // platform, but it's not clear if it can become greater than max
         // 32-bit value after adjustment. For now consider that it can't.
-        wxFileOffset ofs = wxUint32(m_entry.GetOffset());
+        wxFileOffset ofs = wxUint32(entry.GetOffset());
         ofs += m_offsetAdjustment;
-        if (ofs > wxUINT32_MAX) {
-            m_signature = 0;
-            return wxSTREAM_READ_ERROR;
+        if (ofs > wxUINT32_MAX)
+            return false;
+
+        entry.SetOffset(ofs);
+    }
+
+    entry.SetKey(entry.GetOffset());
+
+    return true;
+}
+
+// Read the entire central directory at once and index all its entries by
+// name.
+//
+bool wxZipInputStream::LoadIndex()
+{
+    if (m_indexLoaded)
+        return true;
+
+    if (m_position == wxInvalidOffset)
+        if (!LoadEndRecord())
+            return false;
+
+    // only seekable streams have the central directory available up front
+    wxCHECK_MSG(m_parentSeekable, false,
+                wxT("zip entries can only be found in seekable streams"));
+
+    if (m_centralOffset == wxInvalidOffset)
+        return false;
+
+    // check the size before allocating the buffer for it, the directory must
+    // be in the file
+    const wxFileOffset length = m_parent_i_stream->GetLength();
+    if (m_centralSize < 0 || (length != wxInvalidOffset &&
+            m_centralSize > length - m_centralOffset)) {
+        wxLogError(_("error reading zip central directory"));
+        m_lasterror = wxSTREAM_READ_ERROR;
+        return false;
+    }
+
+    const size_t size = static_cast<size_t>(m_centralSize);
+    wxMemoryBuffer buf(size);
+
+    // don't disturb the entry being currently read, if any
+    const wxFileOffset pos = m_parent_i_stream->TellI();
+
+    bool ok = QuietSeek(*m_parent_i_stream, m_centralOffset) != wxInvalidOffset
+              && m_parent_i_stream->Read(buf.GetWriteBuf(size), size)
+                                   .LastRead() == size;
+
+    if (pos != wxInvalidOffset)
+        QuietSeek(*m_parent_i_stream, pos);
+
+    if (!ok) {
+        wxLogError(_("error reading zip central directory"));
+        m_lasterror = wxSTREAM_READ_ERROR;
+        return false;
+    }
+
+    buf.UngetWriteBuf(size);
+
+    wxMemoryInputStream central(buf.GetData(), size);
+    m_index.reserve(m_TotalEntries);
+
+    char magic[4];
+    while (central.Read(magic, 4).LastRead() == 4 &&
+            CrackUint32(magic) == CENTRAL_MAGIC) {
+        std::unique_ptr<wxZipEntry> entry(new wxZipEntry);
+        if (!entry->ReadCentral(central, GetConv()) || !AdjustOffset(*entry)) {
+            wxLogError(_("error reading zip central directory"));
+            m_lasterror = wxSTREAM_READ_ERROR;
+            m_index.clear();
+            return false;
         }
 
-        m_entry.SetOffset(ofs);
+        // in the unlikely case of duplicate names, the first one wins
+        const wxString name = entry->GetInternalName();
+        m_index.emplace(name, std::move(entry));
     }
 
-    m_entry.SetKey(m_entry.GetOffset());
+    m_indexLoaded = true;
+    return true;
+}
 
-    return wxSTREAM_NO_ERROR;
+const wxZipEntry *wxZipInputStream::FindEntry(const wxString& name,
+                                              wxPathFormat format)
+{
+    if (!LoadIndex())
+        return nullptr;
+
+    const auto it = m_index.find(wxZipEntry::GetInternalName(name, format));
+    return it != m_index.end() ? it->second.get() : nullptr;
+}
+
+bool wxZipInputStream::OpenEntry(const wxString& name, wxPathFormat format)
+{
+    if (!LoadIndex())
+        return false;
+
+    const auto it = m_index.find(wxZipEntry::GetInternalName(name, format));
+    if (it == m_index.end())
+        return false;
+
+    return DoOpen(it->second.get());
 }
 
 wxStreamError wxZipInputStream::ReadLocal(bool readEndRec /*=false*/)
@@ -2177,6 +2310,7 @@ void wxZipOutputStream::Init(int level)
     m_offsetAdjustment = wxInvalidOffset;
     m_endrecWritten = false;
     m_format = wxZIP_FORMAT_DEFAULT;
+    m_threadCount = 1;
 }
 
 wxZipOutputStream::~wxZipOutputStream()
@@ -2355,6 +2489,10 @@ wxOutputStream *wxZipOutputStream::OpenCompressor(
             else
                 m_deflate->Open(stream);
 
+#if wxUSE_THREADS
+            m_deflate->SetThreadCount(m_threadCount);
+#endif // wxUSE_THREADS
+
             return m_deflate;
         }
 
@@ -0,0 +1,410 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        src/common/zstdstream.cpp
+// Purpose:     Implementation of Zstandard stream classes
+// Author:      wxWidgets team
+// Created:     2026-10-14
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+// ============================================================================
+// declarations
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// headers
+// ----------------------------------------------------------------------------
+
+// for compilers that support precompilation, includes "wx.h".
+#include "wx/wxprec.h"
+
+
+#if wxUSE_LIBZSTD && wxUSE_STREAMS
+
+#include "wx/zstdstream.h"
+
+#ifndef WX_PRECOMP
+    #include "wx/log.h"
+    #include "wx/translation.h"
+#endif // WX_PRECOMP
+
+#if wxUSE_THREADS
+    #include "wx/thread.h"
+#endif // wxUSE_THREADS
+
+#include <zstd.h>
+
+namespace wxPrivate
+{
+
+// ----------------------------------------------------------------------------
+// Private helpers
+// ----------------------------------------------------------------------------
+
+// Holds either the compression or the decompression context, depending on the
+// stream kind, and the buffer for its input or output respectively.
+struct wxZstdStream
+{
+    wxZstdStream()
+    {
+        memset(&m_in, 0, sizeof(m_in));
+        memset(&m_out, 0, sizeof(m_out));
+    }
+
+    ~wxZstdStream()
+    {
+        ZSTD_freeCCtx(m_cctx);
+        ZSTD_freeDCtx(m_dctx);
+        delete [] m_buf;
+    }
+
+    ZSTD_CCtx* m_cctx = nullptr;
+    ZSTD_DCtx* m_dctx = nullptr;
+
+    // Only one of these buffers uses m_buf, depending on the stream kind.
+    ZSTD_inBuffer m_in;
+    ZSTD_outBuffer m_out;
+
+    wxUint8* m_buf = nullptr;
+    size_t m_bufSize = 0;
+
+    // For decompression: true if the last frame was completely decoded.
+    // For compression: true if the frame was ended and nothing else can be
+    // written to the stream.
+    bool m_frameDone = false;
+};
+
+} // namespace wxPrivate
+
+using namespace wxPrivate;
+
+// ============================================================================
+// implementation
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Functions
+// ----------------------------------------------------------------------------
+
+wxVersionInfo wxGetLibZstdVersionInfo()
+{
+    const unsigned ver = ZSTD_versionNumber();
+
+    return wxVersionInfo
+           (
+            "libzstd",
+            ver / 10000,
+            (ver % 10000) / 100,
+            ver % 100
+           );
+}
+
+// ----------------------------------------------------------------------------
+// wxZstdData: common helpers for compression and decompression
+// ----------------------------------------------------------------------------
+
+wxZstdData::wxZstdData()
+{
+    m_stream = new wxZstdStream;
+    m_pos = 0;
+}
+
+wxZstdData::~wxZstdData()
+{
+    delete m_stream;
+}
+
+// ----------------------------------------------------------------------------
+// wxZstdInputStream: decompression
+// ----------------------------------------------------------------------------
+
+void wxZstdInputStream::Init()
+{
+    m_stream->m_dctx = ZSTD_createDCtx();
+    if ( !m_stream->m_dctx )
+    {
+        wxLogError(_("Failed to allocate memory for Zstandard decompression."));
+        m_lasterror = wxSTREAM_READ_ERROR;
+        return;
+    }
+
+    m_stream->m_bufSize = ZSTD_DStreamInSize();
+    m_stream->m_buf = new wxUint8[m_stream->m_bufSize];
+    m_stream->m_in.src = m_stream->m_buf;
+}
+
+size_t wxZstdInputStream::OnSysRead(void* outbuf, size_t size)
+{
+    ZSTD_inBuffer& in = m_stream->m_in;
+
+    ZSTD_outBuffer out;
+    out.dst = outbuf;
+    out.size = size;
+    out.pos = 0;
+
+    // Decompress input as long as we don't have any errors (including EOF, as
+    // it doesn't make sense to continue after it either) and have space to
+    // decompress it to.
+    while ( m_lasterror == wxSTREAM_NO_ERROR && out.pos < out.size )
+    {
+        // Get more input data if needed.
+        bool inputEnded = false;
+        if ( in.pos == in.size )
+        {
+            m_parent_i_stream->Read(m_stream->m_buf, m_stream->m_bufSize);
+            in.pos = 0;
+            in.size = m_parent_i_stream->LastRead();
+
+            if ( !in.size )
+            {
+                if ( m_parent_i_stream->GetLastError() != wxSTREAM_EOF )
+                {
+                    m_lasterror = wxSTREAM_READ_ERROR;
+                    return 0;
+                }
+
+                // We still need to let the decoder output the data it may
+                // have kept since the last call.
+                inputEnded = true;
+            }
+        }
+
+        // Do decompress.
+        const size_t inPosOld = in.pos,
+                     posOld = out.pos;
+        const size_t rc = ZSTD_decompressStream(m_stream->m_dctx, &out, &in);
+        if ( ZSTD_isError(rc) )
+        {
+            wxLogError(_("Zstandard decompression error: %s"),
+                       ZSTD_getErrorName(rc));
+
+            m_lasterror = wxSTREAM_READ_ERROR;
+            return 0;
+        }
+
+        // Notice that we continue after the end of the frame, as the input
+        // may consist of several concatenated frames. Also notice that the
+        // return value is only meaningful if any progress was made, as the
+        // decoder returns the size of the next frame header otherwise.
+        if ( in.pos != inPosOld || out.pos != posOld )
+            m_stream->m_frameDone = rc == 0;
+
+        if ( inputEnded && out.pos == posOld )
+        {
+            if ( !m_stream->m_frameDone )
+            {
+                wxLogError(_("Zstandard decompression error: %s"),
+                           _("input is truncated"));
+
+                m_lasterror = wxSTREAM_READ_ERROR;
+                return 0;
+            }
+
+            m_lasterror = wxSTREAM_EOF;
+        }
+    }
+
+    // Return the number of bytes actually read, this may be less than the
+    // requested size if we hit EOF.
+    m_pos += out.pos;
+    return out.pos;
+}
+
+// ----------------------------------------------------------------------------
+// wxZstdOutputStream: compression
+// ----------------------------------------------------------------------------
+
+void wxZstdOutputStream::Init(int level)
+{
+    m_stream->m_cctx = ZSTD_createCCtx();
+    if ( !m_stream->m_cctx )
+    {
+        wxLogError(_("Failed to allocate memory for Zstandard compression."));
+        m_lasterror = wxSTREAM_WRITE_ERROR;
+        return;
+    }
+
+    if ( level == -1 )
+        level = ZSTD_CLEVEL_DEFAULT;
+
+    size_t rc = ZSTD_CCtx_setParameter(m_stream->m_cctx,
+                                       ZSTD_c_compressionLevel, level);
+
+    // Include the checksum of the data, as zstd command line utility does.
+    if ( !ZSTD_isError(rc) )
+        rc = ZSTD_CCtx_setParameter(m_stream->m_cctx, ZSTD_c_checksumFlag, 1);
+
+    if ( ZSTD_isError(rc) )
+    {
+        wxLogError(_("Failed to initialize Zstandard compression: %s"),
+                   ZSTD_getErrorName(rc));
+        m_lasterror = wxSTREAM_WRITE_ERROR;
+        return;
+    }
+
+    m_stream->m_bufSize = ZSTD_CStreamOutSize();
+    m_stream->m_buf = new wxUint8[m_stream->m_bufSize];
+    m_stream->m_out.dst = m_stream->m_buf;
+    m_stream->m_out.size = m_stream->m_bufSize;
+}
+
+#if wxUSE_THREADS
+
+bool wxZstdOutputStream::SetThreadCount(int count)
+{
+    wxCHECK_MSG( count >= 0, false, wxS("invalid number of threads") );
+
+    if ( !m_stream->m_cctx || m_pos || m_stream->m_frameDone )
+        return false;
+
+    if ( count == 0 )
+        count = wxThread::GetCPUCount();
+
+    // Notice that 0 workers means using the current thread only for zstd,
+    // while 1 means using 1 extra thread, which is not what we want.
+    const size_t rc = ZSTD_CCtx_setParameter(m_stream->m_cctx,
+                                             ZSTD_c_nbWorkers,
+                                             count > 1 ? count : 0);
+
+    // This fails if libzstd was compiled without multithreading support.
+    return !ZSTD_isError(rc);
+}
+
+#endif // wxUSE_THREADS
+
+size_t wxZstdOutputStream::OnSysWrite(const void *inbuf, size_t size)
+{
+    if ( m_stream->m_frameDone )
+        m_lasterror = wxSTREAM_WRITE_ERROR;
+
+    ZSTD_inBuffer in;
+    in.src = inbuf;
+    in.size = size;
+    in.pos = 0;
+
+    // Compress as long as we have any input data, but stop at first error as
+    // it's useless to try to continue after it (or even starting if the stream
+    // had already been in an error state).
+    while ( m_lasterror == wxSTREAM_NO_ERROR && in.pos < in.size )
+    {
+        const size_t rc = ZSTD_compressStream2(m_stream->m_cctx,
+                                               &m_stream->m_out, &in,
+                                               ZSTD_e_continue);
+        if ( ZSTD_isError(rc) )
+        {
+            wxLogError(_("Zstandard compression error: %s"),
+                       ZSTD_getErrorName(rc));
+
+            m_lasterror = wxSTREAM_WRITE_ERROR;
+            return 0;
+        }
+
+        // Flush the output buffer when it becomes full.
+        if ( m_stream->m_out.pos == m_stream->m_out.size && !UpdateOutput() )
+            return 0;
+    }
+
+    m_pos += size;
+    return size;
+}
+
+bool wxZstdOutputStream::UpdateOutput()
+{
+    // Write the buffer contents to the real output, taking care only to write
+    // as much of it as we actually have, as the buffer can (and very likely
+    // will) be incomplete.
+    const size_t numOut = m_stream->m_out.pos;
+    m_parent_o_stream->Write(m_stream->m_buf, numOut);
+    if ( m_parent_o_stream->LastWrite() != numOut )
+    {
+        m_lasterror = wxSTREAM_WRITE_ERROR;
+        return false;
+    }
+
+    m_stream->m_out.pos = 0;
+
+    return true;
+}
+
+bool wxZstdOutputStream::DoFlush(bool finish)
+{
+    // Nothing to do if the frame had been already ended.
+    if ( m_stream->m_frameDone )
+        return IsOk();
+
+    ZSTD_inBuffer in;
+    memset(&in, 0, sizeof(in));
+
+    while ( m_lasterror == wxSTREAM_NO_ERROR )
+    {
+        const size_t rc = ZSTD_compressStream2(m_stream->m_cctx,
+                                               &m_stream->m_out, &in,
+                                               finish ? ZSTD_e_end
+                                                      : ZSTD_e_flush);
+        if ( ZSTD_isError(rc) )
+        {
+            wxLogError(_("Zstandard compression error when flushing output: %s"),
+                       ZSTD_getErrorName(rc));
+
+            m_lasterror = wxSTREAM_WRITE_ERROR;
+            break;
+        }
+
+        if ( !UpdateOutput() )
+            break;
+
+        // Non-zero return value means that there is more data to output.
+        if ( rc == 0 )
+        {
+            if ( finish )
+                m_stream->m_frameDone = true;
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool wxZstdOutputStream::Close()
+{
+    if ( !DoFlush(true) )
+        return false;
+
+    return wxFilterOutputStream::Close() && IsOk();
+}
+
+// ----------------------------------------------------------------------------
+// wxZstdClassFactory: allow creating streams from extension/MIME type
+// ----------------------------------------------------------------------------
+
+wxIMPLEMENT_DYNAMIC_CLASS(wxZstdClassFactory, wxFilterClassFactory);
+
+static wxZstdClassFactory g_wxZstdClassFactory;
+
+wxZstdClassFactory::wxZstdClassFactory()
+{
+    if ( this == &g_wxZstdClassFactory )
+        PushFront();
+}
+
+const wxChar * const *
+wxZstdClassFactory::GetProtocols(wxStreamProtocolType type) const
+{
+    static const wxChar *mime[] = { wxT("application/zstd"), nullptr };
+    static const wxChar *encs[] = { wxT("zstd"), nullptr };
+    static const wxChar *exts[] = { wxT(".zst"), nullptr };
+
+    const wxChar* const* ret = nullptr;
+    switch ( type )
+    {
+        case wxSTREAM_PROTOCOL: ret = encs; break;
+        case wxSTREAM_MIMETYPE: ret = mime; break;
+        case wxSTREAM_ENCODING: ret = encs; break;
+        case wxSTREAM_FILEEXT:  ret = exts; break;
+    }
+
+    return ret;
+}
+
+#endif // wxUSE_LIBZSTD && wxUSE_STREAMS
@@ -23,6 +23,14 @@
     #include "wx/utils.h"
 #endif
 
+#if wxUSE_THREADS
+    #include "wx/threadpool.h"
+
+    #include <deque>
+    #include <future>
+    #include <string>
+#endif // wxUSE_THREADS
+
 
 // normally, the compiler options should contain -I../zlib, but it is
 // apparently not the case for all MSW makefiles and so, unless we use
@@ -205,12 +213,31 @@ size_t wxZlibInputStream::OnSysRead(void *buffer, size_t size)
   m_inflate->avail_out = size;
 
   while (err == Z_OK && m_inflate->avail_out > 0) {
+    // When the parent stream has its own buffer, decompress directly from it
+    // instead of copying its contents into ours first. Notice that we never
+    // keep pointing into the parent buffer after consuming the data from it.
+    size_t peeked = 0;
     if (m_inflate->avail_in == 0 && m_parent_i_stream->IsOk()) {
-      m_parent_i_stream->Read(m_z_buffer, m_z_size);
-      m_inflate->next_in = m_z_buffer;
-      m_inflate->avail_in = m_parent_i_stream->LastRead();
+      const void *data;
+      peeked = m_parent_i_stream->PeekBuffer(&data);
+      if (peeked > static_cast<uInt>(-1))
+        peeked = static_cast<uInt>(-1);
+      if (peeked) {
+        m_inflate->next_in = (unsigned char *)data;
+        m_inflate->avail_in = peeked;
+      } else {
+        m_parent_i_stream->Read(m_z_buffer, m_z_size);
+        m_inflate->next_in = m_z_buffer;
+        m_inflate->avail_in = m_parent_i_stream->LastRead();
+      }
     }
     err = inflate(m_inflate, Z_SYNC_FLUSH);
+    if (peeked) {
+      // Any data not used by inflate() remains in the parent stream, which
+      // also means that it doesn't need to be put back there at the end.
+      m_parent_i_stream->ConsumeBuffer(peeked - m_inflate->avail_in);
+      m_inflate->avail_in = 0;
+    }
   }
 
   switch (err) {
@@ -274,6 +301,418 @@ bool wxZlibInputStream::SetDictionary(const wxMemoryBuffer &buf)
 }
 
 
+#if wxUSE_THREADS
+
+// ----------------------------------------------------------------------------
+// wxZlibParallelDeflate: compresses the blocks of data in the thread pool
+// ----------------------------------------------------------------------------
+
+// This uses the same approach as pigz: the input is split into blocks which
+// are compressed independently, using the end of the previous block as the
+// dictionary to avoid losing too much compression ratio, and terminated with
+// the empty stored block allowing to simply concatenate them. The resulting
+// raw deflate stream is then wrapped in zlib or gzip header and trailer,
+// written by this class itself, using the checksums of the individual blocks
+// combined together.
+
+namespace
+{
+
+enum
+{
+    // The size of the independently compressed blocks.
+    ZSTREAM_PARALLEL_BLOCK_SIZE = 128*1024,
+
+    // The size of the deflate window, i.e. of the dictionary to use.
+    ZSTREAM_WINDOW_SIZE = 1 << MAX_WBITS
+};
+
+struct DeflatedBlock
+{
+    std::string data;
+
+    // The checksum of the uncompressed data, crc32 or adler32, depending on
+    // the output format, and its length.
+    uLong check = 0;
+    size_t inputLen = 0;
+
+    bool ok = false;
+};
+
+DeflatedBlock
+DeflateBlock(const std::string& input,
+             const std::string& dict,
+             int level,
+             int flags,
+             bool final)
+{
+    DeflatedBlock block;
+    block.inputLen = input.size();
+
+    z_stream z;
+    memset(&z, 0, sizeof(z));
+    if ( deflateInit2(&z, level, Z_DEFLATED, -MAX_WBITS,
+                      8, Z_DEFAULT_STRATEGY) != Z_OK )
+        return block;
+
+    if ( !dict.empty() )
+    {
+        deflateSetDictionary(&z,
+                             reinterpret_cast<const Bytef*>(dict.data()),
+                             static_cast<uInt>(dict.size()));
+    }
+
+    z.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(input.data()));
+    z.avail_in = static_cast<uInt>(input.size());
+
+    // Note that deflateBound() doesn't take the flush markers into account,
+    // so add some extra space for them, but be ready to grow the buffer too.
+    block.data.resize(deflateBound(&z, z.avail_in) + 16);
+
+    for ( ;; )
+    {
+        z.next_out = reinterpret_cast<Bytef*>(&block.data[z.total_out]);
+        z.avail_out = static_cast<uInt>(block.data.size() - z.total_out);
+
+        const int err = deflate(&z, final ? Z_FINISH : Z_SYNC_FLUSH);
+        if ( err != Z_OK && err != Z_STREAM_END && err != Z_BUF_ERROR )
+            break;
+
+        if ( final ? err == Z_STREAM_END : z.avail_out != 0 )
+        {
+            block.data.resize(z.total_out);
+            block.ok = true;
+            break;
+        }
+
+        block.data.resize(2*block.data.size());
+    }
+
+    deflateEnd(&z);
+
+    const Bytef* const buf = reinterpret_cast<const Bytef*>(input.data());
+    const uInt len = static_cast<uInt>(input.size());
+    switch ( flags )
+    {
+        case wxZLIB_ZLIB:
+            block.check = adler32(adler32(0, Z_NULL, 0), buf, len);
+            break;
+
+        case wxZLIB_GZIP:
+            block.check = crc32(crc32(0, Z_NULL, 0), buf, len);
+            break;
+    }
+
+    return block;
+}
+
+} // anonymous namespace
+
+class wxZlibParallelDeflate
+{
+public:
+    wxZlibParallelDeflate(int level, int flags, int threads)
+        : m_level(level),
+          m_flags(flags)
+    {
+        SetThreadCount(threads);
+        Reset();
+    }
+
+    void SetThreadCount(int threads)
+    {
+        // Allow for more blocks than threads to keep all of them busy while
+        // the output of the already compressed blocks is being written.
+        m_maxPending = 2*static_cast<size_t>(threads);
+    }
+
+    // Return true if nothing has been output yet or if the stream had been
+    // already terminated, meaning that it can be reused after Reset().
+    bool CanReset() const
+    {
+        return m_finished ||
+                (!m_headerWritten && m_block.empty() && m_pending.empty());
+    }
+
+    void Reset()
+    {
+        m_block.clear();
+        m_dict.clear();
+        m_pending.clear();
+        m_check = m_flags == wxZLIB_GZIP ? crc32(0, Z_NULL, 0)
+                                         : adler32(0, Z_NULL, 0);
+        m_totalIn = 0;
+        m_headerWritten = false;
+        m_finished = false;
+    }
+
+    bool Write(wxOutputStream& out, const char* data, size_t size)
+    {
+        if ( m_finished )
+            return false;
+
+        while ( size )
+        {
+            const size_t len = wxMin(size,
+                                     ZSTREAM_PARALLEL_BLOCK_SIZE - m_block.size());
+            m_block.append(data, len);
+            data += len;
+            size -= len;
+
+            if ( m_block.size() == ZSTREAM_PARALLEL_BLOCK_SIZE &&
+                    !SubmitBlock(out, false) )
+                return false;
+        }
+
+        return true;
+    }
+
+    // Write out everything written so far, also terminating the stream if
+    // final is true.
+    bool Flush(wxOutputStream& out, bool final)
+    {
+        // Nothing more can be written once the stream was terminated.
+        if ( m_finished )
+            return true;
+
+        if ( final || !m_block.empty() )
+        {
+            if ( !SubmitBlock(out, final) )
+                return false;
+        }
+
+        while ( !m_pending.empty() )
+        {
+            if ( !WriteFirstPending(out) )
+                return false;
+        }
+
+        if ( final )
+        {
+            if ( !WriteTrailer(out) )
+                return false;
+
+            m_finished = true;
+        }
+        else
+        {
+            // Behave as Z_FULL_FLUSH used by wxZlibOutputStream in this case
+            // and don't refer to the data written before the next block.
+            m_dict.clear();
+        }
+
+        return true;
+    }
+
+private:
+    static bool DoWrite(wxOutputStream& out, const void* data, size_t size)
+    {
+        if ( out.Write(data, size).LastWrite() != size )
+        {
+            wxLogDebug(wxT("wxZlibOutputStream: Error writing to underlying stream"));
+            return false;
+        }
+
+        return true;
+    }
+
+    bool WriteHeader(wxOutputStream& out)
+    {
+        const int level = m_level == Z_DEFAULT_COMPRESSION ? 6 : m_level;
+
+        switch ( m_flags )
+        {
+            case wxZLIB_ZLIB:
+                {
+                    // Use the same FLEVEL values as zlib itself.
+                    int flevel;
+                    if ( level < 2 )
+                        flevel = 0;
+                    else if ( level < 6 )
+                        flevel = 1;
+                    else if ( level == 6 )
+                        flevel = 2;
+                    else
+                        flevel = 3;
+
+                    unsigned header = (Z_DEFLATED + ((MAX_WBITS - 8) << 4)) << 8;
+                    header |= flevel << 6;
+                    header += 31 - header % 31;
+
+                    const unsigned char buf[] =
+                    {
+                        static_cast<unsigned char>(header >> 8),
+                        static_cast<unsigned char>(header & 0xff)
+                    };
+                    return DoWrite(out, buf, sizeof(buf));
+                }
+
+            case wxZLIB_GZIP:
+                {
+                    // No file name, no modification time and unknown OS.
+                    const unsigned char buf[] =
+                    {
+                        0x1f, 0x8b, Z_DEFLATED, 0,
+                        0, 0, 0, 0,
+                        static_cast<unsigned char>(level == 9 ? 2
+                                                    : level == 1 ? 4 : 0),
+                        0xff
+                    };
+                    return DoWrite(out, buf, sizeof(buf));
+                }
+        }
+
+        return true;
+    }
+
+    bool WriteTrailer(wxOutputStream& out)
+    {
+        const wxUint32 check = static_cast<wxUint32>(m_check);
+
+        switch ( m_flags )
+        {
+            case wxZLIB_ZLIB:
+                {
+                    const unsigned char buf[] =
+                    {
+                        static_cast<unsigned char>(check >> 24),
+                        static_cast<unsigned char>(check >> 16),
+                        static_cast<unsigned char>(check >> 8),
+                        static_cast<unsigned char>(check)
+                    };
+                    return DoWrite(out, buf, sizeof(buf));
+                }
+
+            case wxZLIB_GZIP:
+                {
+                    const unsigned char buf[] =
+                    {
+                        static_cast<unsigned char>(check),
+                        static_cast<unsigned char>(check >> 8),
+                        static_cast<unsigned char>(check >> 16),
+                        static_cast<unsigned char>(check >> 24),
+                        static_cast<unsigned char>(m_totalIn),
+                        static_cast<unsigned char>(m_totalIn >> 8),
+                        static_cast<unsigned char>(m_totalIn >> 16),
+                        static_cast<unsigned char>(m_totalIn >> 24)
+                    };
+                    return DoWrite(out, buf, sizeof(buf));
+                }
+        }
+
+        return true;
+    }
+
+    bool SubmitBlock(wxOutputStream& out, bool final)
+    {
+        if ( !m_headerWritten )
+        {
+            if ( !WriteHeader(out) )
+                return false;
+
+            m_headerWritten = true;
+        }
+
+        if ( m_pending.size() >= m_maxPending && !WriteFirstPending(out) )
+            return false;
+
+        std::string nextDict;
+        if ( m_block.size() >= ZSTREAM_WINDOW_SIZE )
+        {
+            nextDict.assign(m_block, m_block.size() - ZSTREAM_WINDOW_SIZE,
+                        ZSTREAM_WINDOW_SIZE);
+        }
+        else
+        {
+            nextDict = m_dict + m_block;
+            if ( nextDict.size() > ZSTREAM_WINDOW_SIZE )
+                nextDict.erase(0, nextDict.size() - ZSTREAM_WINDOW_SIZE);
+        }
+
+        auto job = [input = std::move(m_block),
+                    dict = std::move(m_dict),
+                    level = m_level,
+                    flags = m_flags,
+                    final]()
+        {
+            return DeflateBlock(input, dict, level, flags, final);
+        };
+
+        m_block.clear();
+        m_dict = std::move(nextDict);
+
+        // Waiting for the other tasks from a worker thread could deadlock if
+        // all the workers did it, so just compress synchronously in this case.
+        wxThreadPool& pool = wxThreadPool::Get();
+        if ( pool.IsWorkerThread() )
+        {
+            std::promise<DeflatedBlock> promise;
+            promise.set_value(job());
+            m_pending.push_back(promise.get_future());
+        }
+        else
+        {
+            m_pending.push_back(pool.Submit(std::move(job)));
+        }
+
+        return true;
+    }
+
+    bool WriteFirstPending(wxOutputStream& out)
+    {
+        const DeflatedBlock block = m_pending.front().get();
+        m_pending.pop_front();
+
+        if ( !block.ok )
+        {
+            wxLogError(_("Can't write to deflate stream: %s"),
+                       _("failed to compress data"));
+            return false;
+        }
+
+        const z_off_t len = static_cast<z_off_t>(block.inputLen);
+        switch ( m_flags )
+        {
+            case wxZLIB_ZLIB:
+                m_check = adler32_combine(m_check, block.check, len);
+                break;
+
+            case wxZLIB_GZIP:
+                m_check = crc32_combine(m_check, block.check, len);
+                break;
+        }
+
+        m_totalIn += static_cast<wxUint32>(block.inputLen);
+
+        return DoWrite(out, block.data.data(), block.data.size());
+    }
+
+
+    const int m_level;
+    const int m_flags;
+    size_t m_maxPending = 0;
+
+    // The data not submitted for compression yet.
+    std::string m_block;
+
+    // The dictionary to use for the next block.
+    std::string m_dict;
+
+    // The blocks being compressed, in the order of their output.
+    std::deque<std::future<DeflatedBlock>> m_pending;
+
+    // The checksum of all the data output so far and its size modulo 2^32.
+    uLong m_check = 0;
+    wxUint32 m_totalIn = 0;
+
+    bool m_headerWritten = false;
+    bool m_finished = false;
+
+    wxDECLARE_NO_COPY_CLASS(wxZlibParallelDeflate);
+};
+
+#endif // wxUSE_THREADS
+
 //////////////////////
 // wxZlibOutputStream
 //////////////////////
@@ -300,6 +739,7 @@ void wxZlibOutputStream::Init(int level, int flags)
   m_z_buffer = new unsigned char[ZSTREAM_BUFFER_SIZE];
   m_z_size = ZSTREAM_BUFFER_SIZE;
   m_pos = 0;
+  m_parallel = nullptr;
 
   if ( level == -1 )
   {
@@ -310,6 +750,9 @@ void wxZlibOutputStream::Init(int level, int flags)
     wxASSERT_MSG(level >= 0 && level <= 9, wxT("wxZlibOutputStream compression level must be between 0 and 9!"));
   }
 
+  m_level = level;
+  m_flags = flags;
+
   // if gzip is asked for but not supported...
   if (flags == wxZLIB_GZIP && !CanHandleGZip()) {
     wxLogError(_("Gzip not supported by this version of zlib"));
@@ -350,6 +793,9 @@ bool wxZlibOutputStream::Close()
    deflateEnd(m_deflate);
    wxDELETE(m_deflate);
    wxDELETEA(m_z_buffer);
+#if wxUSE_THREADS
+   wxDELETE(m_parallel);
+#endif // wxUSE_THREADS
 
   return wxFilterOutputStream::Close() && IsOk();
  }
@@ -361,6 +807,14 @@ void wxZlibOutputStream::DoFlush(bool final)
   if (!IsOk())
     return;
 
+#if wxUSE_THREADS
+  if (m_parallel) {
+    if (!m_parallel->Flush(*m_parent_o_stream, final))
+      m_lasterror = wxSTREAM_WRITE_ERROR;
+    return;
+  }
+#endif // wxUSE_THREADS
+
   int err = Z_OK;
   bool done = false;
 
@@ -396,6 +850,19 @@ size_t wxZlibOutputStream::OnSysWrite(const void *buffer, size_t size)
   if (!IsOk() || !size)
     return 0;
 
+#if wxUSE_THREADS
+  if (m_parallel) {
+    if (!m_parallel->Write(*m_parent_o_stream,
+                           static_cast<const char*>(buffer), size)) {
+      m_lasterror = wxSTREAM_WRITE_ERROR;
+      return 0;
+    }
+
+    m_pos += size;
+    return size;
+  }
+#endif // wxUSE_THREADS
+
   int err = Z_OK;
   m_deflate->next_in = const_cast<unsigned char*>(static_cast<const unsigned char*>(buffer));
   m_deflate->avail_in = size;
@@ -436,6 +903,12 @@ size_t wxZlibOutputStream::OnSysWrite(const void *buffer, size_t size)
 
 bool wxZlibOutputStream::SetDictionary(const char *data, size_t datalen)
 {
+#if wxUSE_THREADS
+    // Preset dictionaries are not supported when compressing in parallel.
+    if ( m_parallel )
+        return false;
+#endif // wxUSE_THREADS
+
     return deflateSetDictionary(m_deflate, reinterpret_cast<const Bytef*>(data), datalen) == Z_OK;
 }
 
@@ -444,5 +917,42 @@ bool wxZlibOutputStream::SetDictionary(const wxMemoryBuffer &buf)
     return SetDictionary((char*)buf.GetData(), buf.GetDataLen());
 }
 
+#if wxUSE_THREADS
+
+bool wxZlibOutputStream::SetThreadCount(int count)
+{
+    wxCHECK_MSG( count >= 0, false, wxT("invalid number of threads") );
+
+    if ( !m_deflate )
+        return false;
+
+    // It's too late to change the way the data is compressed once any of it
+    // has been output.
+    if ( m_deflate->total_in || m_deflate->total_out ||
+            (m_parallel && !m_parallel->CanReset()) )
+        return false;
+
+    if ( count == 0 )
+        count = wxThreadPool::Get().GetMaxThreads();
+
+    if ( count == 1 )
+    {
+        wxDELETE(m_parallel);
+    }
+    else if ( m_parallel )
+    {
+        m_parallel->SetThreadCount(count);
+        m_parallel->Reset();
+    }
+    else
+    {
+        m_parallel = new wxZlibParallelDeflate(m_level, m_flags, count);
+    }
+
+    return true;
+}
+
+#endif // wxUSE_THREADS
+
 #endif
   // wxUSE_ZLIB && wxUSE_STREAMS
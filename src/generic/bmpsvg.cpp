@@ -71,6 +71,7 @@
 
 #ifndef WX_PRECOMP
     #include "wx/utils.h"                   // Only for wxMin()
+    #include "wx/module.h"
 #endif // WX_PRECOMP
 
 #include "wx/bmpbndl.h"
@@ -81,10 +82,16 @@
 #else
     #define wxNO_SVG_FILE
 #endif
+#include "wx/image.h"
 #include "wx/rawbmp.h"
 
 #include "wx/private/bmpbndl.h"
 
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
 // ----------------------------------------------------------------------------
 // private helpers
 // ----------------------------------------------------------------------------
@@ -92,97 +99,333 @@
 namespace
 {
 
-class wxBitmapBundleImplSVG : public wxBitmapBundleImpl
+// Maximal total size of the bitmaps in wxSVGCache.
+size_t gs_svgCacheMaxSize = 16*1024*1024;
+
+class wxSVGCache;
+wxSVGCache* gs_svgCache = nullptr;
+
+// Parsed SVG image shared by all the bundles created from the same data.
+class wxSVGDocument
 {
 public:
-    // Ctor must be passed a valid NSVGimage and takes ownership of it.
-    wxBitmapBundleImplSVG(NSVGimage* svgImage, const wxSize& sizeDef)
+    // Takes ownership of the (valid) image.
+    wxSVGDocument(NSVGimage* svgImage, unsigned id)
         : m_svgImage(svgImage),
-          m_svgRasterizer(nsvgCreateRasterizer()),
-          m_sizeDef(sizeDef)
+          m_id(id)
     {
     }
 
-    ~wxBitmapBundleImplSVG()
+    ~wxSVGDocument();
+
+    NSVGimage* GetImage() const { return m_svgImage; }
+    unsigned GetId() const { return m_id; }
+
+private:
+    NSVGimage* const m_svgImage;
+
+    // Unique identifier used as part of the key in the cache.
+    const unsigned m_id;
+
+    // Key of this document in wxSVGCache::m_documents or null if it's not
+    // there, as happens if it was created before the cache.
+    const std::string* m_key = nullptr;
+
+    friend class wxSVGCache;
+
+    wxDECLARE_NO_COPY_CLASS(wxSVGDocument);
+};
+
+using wxSVGDocumentPtr = std::shared_ptr<wxSVGDocument>;
+
+// Process-wide cache of the parsed SVG documents, keyed by their contents,
+// and of the bitmaps rasterized from them, keyed by the document and the
+// bitmap size. The total size of the bitmaps is limited and the least
+// recently used ones are removed from the cache when it is exceeded.
+//
+// Note that this cache is not thread-safe, as wxBitmapBundle can only be used
+// from the main thread anyhow.
+class wxSVGCache
+{
+public:
+    wxSVGCache()
+        : m_svgRasterizer(nsvgCreateRasterizer())
+    {
+    }
+
+    ~wxSVGCache()
     {
+        // The remaining documents are still used by some bundles, but they
+        // won't be able to use the cache any longer.
+        for ( const auto& kv : m_documents )
+        {
+            if ( const wxSVGDocumentPtr doc = kv.second.lock() )
+                doc->m_key = nullptr;
+        }
+
         nsvgDeleteRasterizer(m_svgRasterizer);
-        nsvgDelete(m_svgImage);
+    }
+
+    NSVGrasterizer* GetRasterizer() const { return m_svgRasterizer; }
+
+    // Return the existing document for this data, if any.
+    wxSVGDocumentPtr FindDocument(const std::string& data) const
+    {
+        const auto it = m_documents.find(data);
+        return it == m_documents.end() ? wxSVGDocumentPtr() : it->second.lock();
+    }
+
+    // Create and remember the document for the given data.
+    wxSVGDocumentPtr AddDocument(std::string&& data, NSVGimage* svgImage)
+    {
+        wxSVGDocumentPtr doc(new wxSVGDocument(svgImage, ++m_lastId));
+
+        const auto res = m_documents.emplace(std::move(data), doc);
+        if ( !res.second )
+            res.first->second = doc;
+        doc->m_key = &res.first->first;
+
+        return doc;
+    }
+
+    // Called when the document is destroyed.
+    void RemoveDocument(const wxSVGDocument& doc);
+
+    // Return the cached bitmap of the given size or invalid bitmap.
+    wxBitmap GetBitmap(const wxSVGDocument& doc, const wxSize& size);
+
+    // Add the bitmap to the cache, possibly removing the other ones from it.
+    void AddBitmap(const wxSVGDocument& doc, const wxBitmap& bitmap);
+
+    // Remove the least recently used bitmaps until their total size is not
+    // greater than the maximal one.
+    void Trim();
+
+private:
+    struct BitmapKey
+    {
+        unsigned id;
+        int width;
+        int height;
+
+        bool operator==(const BitmapKey& other) const
+        {
+            return id == other.id &&
+                    width == other.width &&
+                        height == other.height;
+        }
+    };
+
+    struct BitmapKeyHash
+    {
+        size_t operator()(const BitmapKey& key) const
+        {
+            size_t h = key.id;
+            h = h*31 + static_cast<size_t>(key.width);
+            h = h*31 + static_cast<size_t>(key.height);
+            return h;
+        }
+    };
+
+    struct BitmapEntry
+    {
+        BitmapKey key;
+        wxBitmap bitmap;
+    };
+
+    using BitmapList = std::list<BitmapEntry>;
+
+    static BitmapKey MakeKey(const wxSVGDocument& doc, const wxSize& size)
+    {
+        BitmapKey key;
+        key.id = doc.GetId();
+        key.width = size.x;
+        key.height = size.y;
+        return key;
+    }
+
+    static size_t GetBitmapSize(const BitmapKey& key)
+    {
+        return static_cast<size_t>(key.width)*key.height*4;
+    }
+
+    void EraseBitmap(BitmapList::iterator it)
+    {
+        m_totalSize -= GetBitmapSize(it->key);
+        m_bitmapsMap.erase(it->key);
+        m_bitmaps.erase(it);
+    }
+
+
+    NSVGrasterizer* const m_svgRasterizer;
+
+    std::unordered_map<std::string, std::weak_ptr<wxSVGDocument>> m_documents;
+    unsigned m_lastId = 0;
+
+    // Bitmaps in the order of use, the most recently used one first.
+    BitmapList m_bitmaps;
+    std::unordered_map<BitmapKey, BitmapList::iterator, BitmapKeyHash> m_bitmapsMap;
+    size_t m_totalSize = 0;
+
+    wxDECLARE_NO_COPY_CLASS(wxSVGCache);
+};
+
+void wxSVGCache::RemoveDocument(const wxSVGDocument& doc)
+{
+    // Check that the map entry still refers to this document, it could have
+    // been replaced by a new one for the same data.
+    const auto it = m_documents.find(*doc.m_key);
+    if ( it != m_documents.end() && it->second.expired() )
+        m_documents.erase(it);
+
+    for ( auto itBmp = m_bitmaps.begin(); itBmp != m_bitmaps.end(); )
+    {
+        if ( itBmp->key.id == doc.GetId() )
+            EraseBitmap(itBmp++);
+        else
+            ++itBmp;
+    }
+}
+
+wxBitmap wxSVGCache::GetBitmap(const wxSVGDocument& doc, const wxSize& size)
+{
+    const auto it = m_bitmapsMap.find(MakeKey(doc, size));
+    if ( it == m_bitmapsMap.end() )
+        return wxBitmap();
+
+    // Make this bitmap the most recently used one.
+    m_bitmaps.splice(m_bitmaps.begin(), m_bitmaps, it->second);
+
+    return it->second->bitmap;
+}
+
+void wxSVGCache::AddBitmap(const wxSVGDocument& doc, const wxBitmap& bitmap)
+{
+    const BitmapKey key = MakeKey(doc, bitmap.GetSize());
+
+    const size_t size = GetBitmapSize(key);
+    if ( size > gs_svgCacheMaxSize )
+        return;
+
+    const auto it = m_bitmapsMap.find(key);
+    if ( it != m_bitmapsMap.end() )
+        EraseBitmap(it->second);
+
+    BitmapEntry entry;
+    entry.key = key;
+    entry.bitmap = bitmap;
+    m_bitmaps.push_front(entry);
+    m_bitmapsMap[key] = m_bitmaps.begin();
+    m_totalSize += size;
+
+    Trim();
+}
+
+void wxSVGCache::Trim()
+{
+    while ( m_totalSize > gs_svgCacheMaxSize )
+        EraseBitmap(std::prev(m_bitmaps.end()));
+}
+
+wxSVGDocument::~wxSVGDocument()
+{
+    if ( m_key )
+        gs_svgCache->RemoveDocument(*this);
+
+    nsvgDelete(m_svgImage);
+}
+
+class wxBitmapBundleImplSVG : public wxBitmapBundleImpl
+{
+public:
+    // Ctor must be passed a valid document.
+    wxBitmapBundleImplSVG(const wxSVGDocumentPtr& doc, const wxSize& sizeDef)
+        : m_doc(doc),
+          m_sizeDef(sizeDef)
+    {
     }
 
     virtual wxSize GetDefaultSize() const override;
     virtual wxSize GetPreferredBitmapSizeAtScale(double scale) const override;
     virtual wxBitmap GetBitmap(const wxSize& size) override;
 
+#if wxUSE_IMAGE
+    virtual std::function<wxImage ()> CreateImageMaker(const wxSize& size) override;
+    virtual void AddPreparedImage(const wxImage& image) override;
+#endif // wxUSE_IMAGE
+
 private:
     wxBitmap DoRasterize(const wxSize& size);
 
-    NSVGimage* const m_svgImage;
-    NSVGrasterizer* const m_svgRasterizer;
+    const wxSVGDocumentPtr m_doc;
 
     const wxSize m_sizeDef;
 
     // Cache the last used bitmap (may be invalid if not used yet).
     //
-    // Note that we cache only the last bitmap and not all the bitmaps ever
-    // requested from GetBitmap() for the different sizes because there would
-    // be no way to clear such cache and its growth could be unbounded,
-    // resulting in too many bitmap objects being used in an application using
-    // SVG for all of its icons.
+    // The bitmaps of all the other sizes requested from GetBitmap() are
+    // cached in wxSVGCache, which is shared by all bundles and limits the
+    // total size of the bitmaps in it, but keep the last one here too to
+    // avoid looking it up there every time.
     wxBitmap m_cachedBitmap;
 
     wxDECLARE_NO_COPY_CLASS(wxBitmapBundleImplSVG);
 };
 
-} // anonymous namespace
-
-// ============================================================================
-// wxBitmapBundleImplSVG implementation
-// ============================================================================
-
-wxSize wxBitmapBundleImplSVG::GetDefaultSize() const
+// Module creating and destroying the global cache.
+class wxSVGCacheModule : public wxModule
 {
-    return m_sizeDef;
-}
+public:
+    wxSVGCacheModule() = default;
 
-wxSize wxBitmapBundleImplSVG::GetPreferredBitmapSizeAtScale(double scale) const
-{
-    // We consider that we can render at any scale.
-    return m_sizeDef*scale;
-}
+    virtual bool OnInit() override
+    {
+        gs_svgCache = new wxSVGCache;
+        return true;
+    }
 
-wxBitmap wxBitmapBundleImplSVG::GetBitmap(const wxSize& size)
-{
-    if ( !m_cachedBitmap.IsOk() || m_cachedBitmap.GetSize() != size )
+    virtual void OnExit() override
     {
-        m_cachedBitmap = DoRasterize(size);
+        wxDELETE(gs_svgCache);
     }
 
-    return m_cachedBitmap;
-}
+private:
+    wxDECLARE_DYNAMIC_CLASS(wxSVGCacheModule);
+};
 
-wxBitmap wxBitmapBundleImplSVG::DoRasterize(const wxSize& size)
+wxIMPLEMENT_DYNAMIC_CLASS(wxSVGCacheModule, wxModule);
+
+// Rasterize the image into RGBA buffer with straight alpha.
+void
+RasterizeToBuffer(NSVGimage* svgImage,
+                  NSVGrasterizer* svgRasterizer,
+                  const wxSize& size,
+                  wxVector<unsigned char>& buffer)
 {
-    wxVector<unsigned char> buffer(size.x*size.y*4);
+    buffer.resize(size.x*size.y*4);
     nsvgRasterize
     (
-        m_svgRasterizer,
-        m_svgImage,
+        svgRasterizer,
+        svgImage,
         0.0, 0.0,           // no offset
         wxMin
         (
-            size.x/m_svgImage->width,
-            size.y/m_svgImage->height
+            size.x/svgImage->width,
+            size.y/svgImage->height
         ),                  // scale
         &buffer[0],
         size.x, size.y,
         size.x*4            // stride -- we have no gaps between lines
     );
+}
 
+// Create the bitmap from the buffer filled by RasterizeToBuffer().
+wxBitmap BitmapFromBuffer(const wxSize& size, const unsigned char* src)
+{
     wxBitmap bitmap(size, 32);
     wxAlphaPixelData bmpdata(bitmap);
     wxAlphaPixelData::Iterator dst(bmpdata);
 
-    const unsigned char* src = &buffer[0];
     for ( int y = 0; y < size.y; ++y )
     {
         dst.MoveTo(bmpdata, 0, y);
@@ -216,9 +459,152 @@ wxBitmap wxBitmapBundleImplSVG::DoRasterize(const wxSize& size)
     return bitmap;
 }
 
+} // anonymous namespace
+
+// ============================================================================
+// wxBitmapBundleImplSVG implementation
+// ============================================================================
+
+wxSize wxBitmapBundleImplSVG::GetDefaultSize() const
+{
+    return m_sizeDef;
+}
+
+wxSize wxBitmapBundleImplSVG::GetPreferredBitmapSizeAtScale(double scale) const
+{
+    // We consider that we can render at any scale.
+    return m_sizeDef*scale;
+}
+
+wxBitmap wxBitmapBundleImplSVG::GetBitmap(const wxSize& size)
+{
+    if ( !m_cachedBitmap.IsOk() || m_cachedBitmap.GetSize() != size )
+    {
+        if ( gs_svgCache )
+            m_cachedBitmap = gs_svgCache->GetBitmap(*m_doc, size);
+        else
+            m_cachedBitmap = wxBitmap();
+
+        if ( !m_cachedBitmap.IsOk() )
+        {
+            m_cachedBitmap = DoRasterize(size);
+
+            if ( gs_svgCache )
+                gs_svgCache->AddBitmap(*m_doc, m_cachedBitmap);
+        }
+    }
+
+    return m_cachedBitmap;
+}
+
+wxBitmap wxBitmapBundleImplSVG::DoRasterize(const wxSize& size)
+{
+    wxVector<unsigned char> buffer;
+
+    // Normally we reuse the same rasterizer for all images, but create a
+    // temporary one if we're called before the cache initialization or
+    // after its destruction.
+    if ( gs_svgCache )
+    {
+        RasterizeToBuffer(m_doc->GetImage(), gs_svgCache->GetRasterizer(),
+                          size, buffer);
+    }
+    else
+    {
+        NSVGrasterizer* const svgRasterizer = nsvgCreateRasterizer();
+        RasterizeToBuffer(m_doc->GetImage(), svgRasterizer, size, buffer);
+        nsvgDeleteRasterizer(svgRasterizer);
+    }
+
+    return BitmapFromBuffer(size, &buffer[0]);
+}
+
+#if wxUSE_IMAGE
+
+std::function<wxImage ()>
+wxBitmapBundleImplSVG::CreateImageMaker(const wxSize& size)
+{
+    if ( m_cachedBitmap.IsOk() && m_cachedBitmap.GetSize() == size )
+        return {};
+
+    if ( gs_svgCache && gs_svgCache->GetBitmap(*m_doc, size).IsOk() )
+        return {};
+
+    // Parsed image is never modified and remains valid while we're alive, so
+    // it can be rasterized in another thread, using its own rasterizer.
+    NSVGimage* const svgImage = m_doc->GetImage();
+
+    return [svgImage, size]()
+        {
+            wxVector<unsigned char> buffer;
+
+            NSVGrasterizer* const svgRasterizer = nsvgCreateRasterizer();
+            RasterizeToBuffer(svgImage, svgRasterizer, size, buffer);
+            nsvgDeleteRasterizer(svgRasterizer);
+
+            // Store the RGBA data in the image without any conversions, so
+            // that BitmapFromBuffer() produces the same bitmap from it later.
+            wxImage image(size, false /* don't clear */);
+            image.SetAlpha();
+
+            unsigned char* rgb = image.GetData();
+            unsigned char* alpha = image.GetAlpha();
+            const unsigned char* src = &buffer[0];
+            for ( int n = size.x*size.y; n > 0; --n )
+            {
+                *rgb++ = src[0];
+                *rgb++ = src[1];
+                *rgb++ = src[2];
+                *alpha++ = src[3];
+                src += 4;
+            }
+
+            return image;
+        };
+}
+
+void wxBitmapBundleImplSVG::AddPreparedImage(const wxImage& image)
+{
+    const wxSize size = image.GetSize();
+
+    wxVector<unsigned char> buffer(size.x*size.y*4);
+
+    const unsigned char* rgb = image.GetData();
+    const unsigned char* alpha = image.GetAlpha();
+    unsigned char* dst = &buffer[0];
+    for ( int n = size.x*size.y; n > 0; --n )
+    {
+        *dst++ = *rgb++;
+        *dst++ = *rgb++;
+        *dst++ = *rgb++;
+        *dst++ = *alpha++;
+    }
+
+    // The bitmap of this size is likely to be requested soon, so keep it as
+    // the last used one, in addition to storing it in the cache.
+    m_cachedBitmap = BitmapFromBuffer(size, &buffer[0]);
+
+    if ( gs_svgCache )
+        gs_svgCache->AddBitmap(*m_doc, m_cachedBitmap);
+}
+
+#endif // wxUSE_IMAGE
+
 /* static */
 wxBitmapBundle wxBitmapBundle::FromSVG(char* data, const wxSize& sizeDef)
 {
+    // Parse each SVG image only once, if possible. Note that we need to copy
+    // the data before parsing it, as it gets modified by nsvgParse().
+    std::string key;
+    if ( gs_svgCache )
+    {
+        key = data;
+
+        const wxSVGDocumentPtr doc = gs_svgCache->FindDocument(key);
+        if ( doc )
+            return wxBitmapBundle(new wxBitmapBundleImplSVG(doc, sizeDef));
+    }
+
     NSVGimage* const svgImage = nsvgParse(data, "px", 96);
     if ( !svgImage )
         return wxBitmapBundle();
@@ -232,7 +618,13 @@ wxBitmapBundle wxBitmapBundle::FromSVG(char* data, const wxSize& sizeDef)
         return wxBitmapBundle();
     }
 
-    return wxBitmapBundle(new wxBitmapBundleImplSVG(svgImage, sizeDef));
+    wxSVGDocumentPtr doc;
+    if ( gs_svgCache )
+        doc = gs_svgCache->AddDocument(std::move(key), svgImage);
+    else
+        doc.reset(new wxSVGDocument(svgImage, 0));
+
+    return wxBitmapBundle(new wxBitmapBundleImplSVG(doc, sizeDef));
 }
 
 /* static */
@@ -252,6 +644,21 @@ wxBitmapBundle wxBitmapBundle::FromSVG(const wxByte* data, size_t len, const wxS
     return FromSVG(copy.data(), sizeDef);
 }
 
+/* static */
+void wxBitmapBundle::SetSVGCacheMaxSize(size_t maxSize)
+{
+    gs_svgCacheMaxSize = maxSize;
+
+    if ( gs_svgCache )
+        gs_svgCache->Trim();
+}
+
+/* static */
+size_t wxBitmapBundle::GetSVGCacheMaxSize()
+{
+    return gs_svgCacheMaxSize;
+}
+
 /* static */
 wxBitmapBundle wxBitmapBundle::FromSVGFile(const wxString& path, const wxSize& sizeDef)
 {
@@ -47,6 +47,8 @@
 #include "wx/selstore.h"
 #include "wx/stopwatch.h"
 #include "wx/weakref.h"
+#include "wx/except.h"
+#include "wx/threadpool.h"
 #include "wx/generic/private/markuptext.h"
 #include "wx/generic/private/rowheightcache.h"
 #include "wx/generic/private/widthcalc.h"
@@ -528,6 +530,12 @@ public:
     void InsertChild(wxDataViewMainWindow* window,
                      wxDataViewTreeNode *node, unsigned index);
 
+    // Add all the given nodes as children of this one at once: this is much
+    // faster than inserting them one by one as they're sorted only once, if
+    // necessary, and only when this node is open.
+    void AddChildren(wxDataViewMainWindow* window,
+                     const wxDataViewTreeNodes& nodes);
+
     void RemoveChild(unsigned index)
     {
         wxCHECK_RET( m_branchData != nullptr, "leaf node doesn't have children" );
@@ -645,6 +653,25 @@ public:
 
     void Resort(wxDataViewMainWindow* window);
 
+    // Reorder the children so that the child with the index order[n] becomes
+    // the n-th one and remember that they're now sorted in the given order.
+    void SetChildrenOrder(const std::vector<unsigned>& order,
+                          const SortOrder& sortOrder)
+    {
+        wxCHECK_RET( m_branchData, "leaf node doesn't have children" );
+
+        wxDataViewTreeNodes& nodes = m_branchData->children;
+        wxCHECK_RET( order.size() == nodes.size(), "invalid children order" );
+
+        wxDataViewTreeNodes sorted;
+        sorted.reserve(nodes.size());
+        for ( unsigned n : order )
+            sorted.push_back(nodes[n]);
+
+        nodes.swap(sorted);
+        m_branchData->sortOrder = sortOrder;
+    }
+
     // Should be called after changing the item value to update its position in
     // the control if necessary.
     void PutInSortOrder(wxDataViewMainWindow* window)
@@ -726,6 +753,13 @@ public:
     bool IsList() const { return GetModel()->IsListModel(); }
     bool IsVirtualList() const { return m_root == nullptr; }
 
+    // Retrieve the values of the given model column for the given range of
+    // rows of a virtual list at once, return false if not supported.
+    bool GetVirtualListValues(unsigned int col,
+                              unsigned int firstRow,
+                              unsigned int count,
+                              wxVector<wxVariant>& values) const;
+
     // notifications from wxDataViewModel
     bool ItemAdded( const wxDataViewItem &parent, const wxDataViewItem &item );
     bool ItemDeleted( const wxDataViewItem &parent, const wxDataViewItem &item );
@@ -735,16 +769,10 @@ public:
     }
     bool ValueChanged( const wxDataViewItem &item, unsigned int model_column );
     bool Cleared();
-    void Resort()
-    {
-        ClearRowHeightCache();
+    void Resort();
 
-        if (!IsVirtualList())
-        {
-            m_root->Resort(this);
-        }
-        UpdateDisplay();
-    }
+    // Enable or disable sorting the list models in the background.
+    void EnableBackgroundSorting(bool enable);
     void ClearRowHeightCache()
     {
         if ( m_rowHeightCache )
@@ -1036,6 +1064,47 @@ private:
     bool                        m_currentColSetByKeyboard;
     HeightCache                *m_rowHeightCache;
 
+#if wxUSE_THREADS
+    // Data used for sorting in the background, shared with the worker thread
+    // doing it.
+    struct BackgroundSortData
+    {
+        // Input: the sort keys and the ids of the items.
+        wxVector<wxDataViewSortKey> keys;
+        std::vector<wxUIntPtr> ids;
+        bool ascending = true;
+
+        // Output: the order of the items.
+        std::vector<unsigned> order;
+    };
+
+    // Start sorting the items in the background if possible, return false if
+    // they need to be sorted synchronously.
+    bool StartBackgroundSort();
+
+    // Called in the main thread when the background sort is done.
+    void OnBackgroundSortDone(unsigned generation);
+
+    // If background sorting is in progress, abandon it and sort the items
+    // synchronously: this is needed before changing the items, as the code
+    // doing it relies on them being already sorted.
+    void CompleteBackgroundSort();
+
+    // Abandon the background sort, if any, without sorting the items.
+    void CancelBackgroundSort();
+
+    bool                        m_backgroundSortEnabled;
+    bool                        m_backgroundSortPending;
+
+    // Incremented every time a new background sort is started or cancelled,
+    // used to ignore the results of the sorts which are not needed any more.
+    unsigned                    m_backgroundSortGeneration;
+
+    std::shared_ptr<BackgroundSortData> m_backgroundSortData;
+    SortOrder                   m_backgroundSortOrder;
+    std::future<void>           m_backgroundSortFuture;
+#endif // wxUSE_THREADS
+
 #if wxUSE_DRAG_AND_DROP
     int                         m_dragCount;
     wxPoint                     m_dragStart;
@@ -1929,6 +1998,25 @@ void wxDataViewTreeNode::InsertChild(wxDataViewMainWindow* window,
 }
 
 
+void wxDataViewTreeNode::AddChildren(wxDataViewMainWindow* window,
+                                     const wxDataViewTreeNodes& nodes)
+{
+    if ( nodes.empty() )
+        return;
+
+    if (!m_branchData)
+        m_branchData = new BranchNodeData;
+
+    wxDataViewTreeNodes& children = m_branchData->children;
+    children.reserve(children.size() + nodes.size());
+    children.insert(children.end(), nodes.begin(), nodes.end());
+
+    // The children are not sorted any more, but this is only a problem if
+    // the node is open, as otherwise they will be sorted when it is opened.
+    m_branchData->sortOrder = SortOrder();
+    Resort(window);
+}
+
 void wxDataViewTreeNode::Resort(wxDataViewMainWindow* window)
 {
     if (!m_branchData)
@@ -2111,6 +2199,12 @@ wxDataViewMainWindow::wxDataViewMainWindow( wxDataViewCtrl *parent, wxWindowID i
         m_rowHeightCache = nullptr;
     }
 
+#if wxUSE_THREADS
+    m_backgroundSortEnabled = false;
+    m_backgroundSortPending = false;
+    m_backgroundSortGeneration = 0;
+#endif // wxUSE_THREADS
+
 #if wxUSE_DRAG_AND_DROP
     m_dragCount = 0;
     m_dragStart = wxPoint(0,0);
@@ -2142,6 +2236,13 @@ wxDataViewMainWindow::wxDataViewMainWindow( wxDataViewCtrl *parent, wxWindowID i
 
 wxDataViewMainWindow::~wxDataViewMainWindow()
 {
+#if wxUSE_THREADS
+    // The worker thread uses this object, so wait until it's done.
+    CancelBackgroundSort();
+    if ( m_backgroundSortFuture.valid() )
+        m_backgroundSortFuture.wait();
+#endif // wxUSE_THREADS
+
     DestroyTree();
     delete m_renameTimer;
     delete m_rowHeightCache;
@@ -2512,6 +2613,35 @@ wxBitmap wxDataViewMainWindow::CreateItemBitmap( unsigned int row, int &indent )
 
 #endif // wxUSE_DRAG_AND_DROP
 
+bool
+wxDataViewMainWindow::GetVirtualListValues(unsigned int col,
+                                           unsigned int firstRow,
+                                           unsigned int count,
+                                           wxVector<wxVariant>& values) const
+{
+    wxCHECK_MSG( IsVirtualList(), false, "only for virtual list models" );
+
+    // Don't let the exceptions thrown by the model escape, as in
+    // wxDataViewRenderer::PrepareForItem().
+    wxTRY
+    {
+        const wxDataViewListModel* const
+            model = static_cast<const wxDataViewListModel*>(GetModel());
+        if ( !model->GetValuesForRange(col, firstRow, count, values) )
+            return false;
+    }
+    wxCATCH_ALL
+    (
+        wxLogDebug("Retrieving the values from the model threw an exception");
+        return false;
+    )
+
+    wxCHECK_MSG( values.size() == count, false,
+                 "model returned wrong number of values" );
+
+    return true;
+}
+
 void wxDataViewMainWindow::OnPaint( wxPaintEvent &WXUNUSED(event) )
 {
     wxDataViewModel *model = GetModel();
@@ -2815,6 +2945,10 @@ void wxDataViewMainWindow::OnPaint( wxPaintEvent &WXUNUSED(event) )
     wxDataViewColumn * const
         expander = GetExpanderColumnOrFirstOne(GetOwner());
 
+    // For virtual lists the rows are the same as the model rows, so we can
+    // retrieve the values of all the visible cells of each column at once.
+    wxVector<wxVariant> values;
+
     // redraw all cells for all rows which must be repainted and all columns
     wxRect cell_rect;
     cell_rect.x = x_start;
@@ -2829,6 +2963,10 @@ void wxDataViewMainWindow::OnPaint( wxPaintEvent &WXUNUSED(event) )
         if ( cell_rect.width <= 0 )
             continue;
 
+        const bool hasValues = IsVirtualList() &&
+            GetVirtualListValues(col->GetModelColumn(),
+                                 item_start, item_count, values);
+
         cell_rect.y = first_line_start;
         for (unsigned int item = item_start; item < item_last; item++)
         {
@@ -2863,7 +3001,10 @@ void wxDataViewMainWindow::OnPaint( wxPaintEvent &WXUNUSED(event) )
                 state |= wxDATAVIEW_CELL_SELECTED;
 
             cell->SetState(state);
-            const bool hasValue = cell->PrepareForItem(model, dataitem, col->GetModelColumn());
+            const bool hasValue = hasValues
+                ? cell->PrepareForItem(model, dataitem, col->GetModelColumn(),
+                                       values[item - item_start])
+                : cell->PrepareForItem(model, dataitem, col->GetModelColumn());
 
             // draw the background
             if ( !selected )
@@ -3103,6 +3244,10 @@ Walker(wxDataViewTreeNode * node, DoJob & func, WalkFlags flags = Walk_All)
 
 bool wxDataViewMainWindow::ItemAdded(const wxDataViewItem & parent, const wxDataViewItem & item)
 {
+#if wxUSE_THREADS
+    CompleteBackgroundSort();
+#endif // wxUSE_THREADS
+
     if (IsVirtualList())
     {
         wxDataViewVirtualListModel *list_model =
@@ -3219,6 +3364,10 @@ bool wxDataViewMainWindow::ItemAdded(const wxDataViewItem & parent, const wxData
 bool wxDataViewMainWindow::ItemDeleted(const wxDataViewItem& parent,
                                        const wxDataViewItem& item)
 {
+#if wxUSE_THREADS
+    CompleteBackgroundSort();
+#endif // wxUSE_THREADS
+
     if (IsVirtualList())
     {
         wxDataViewVirtualListModel *list_model =
@@ -3341,6 +3490,10 @@ bool wxDataViewMainWindow::ItemDeleted(const wxDataViewItem& parent,
 
 bool wxDataViewMainWindow::DoItemChanged(const wxDataViewItem & item, int view_column)
 {
+#if wxUSE_THREADS
+    CompleteBackgroundSort();
+#endif // wxUSE_THREADS
+
     if ( !IsVirtualList() )
     {
         if ( m_rowHeightCache )
@@ -3746,8 +3899,17 @@ int wxDataViewMainWindow::GetLineStart( unsigned int row ) const
     if ( m_rowHeightCache->GetLineStart(row, start) )
         return start;
 
-    unsigned int r;
-    for (r = 0; r < row; r++)
+    // start from the end of the part of the cache without gaps, its
+    // position is known
+    unsigned int r = m_rowHeightCache->GetValidCount();
+    if ( r )
+    {
+        int height = 0;
+        m_rowHeightCache->GetLineInfo(r - 1, start, height);
+        start += height;
+    }
+
+    for ( ; r < row; r++ )
     {
         int height = 0;
         if ( !m_rowHeightCache->GetLineHeight(r, height) )
@@ -3791,8 +3953,16 @@ int wxDataViewMainWindow::GetLineAt( unsigned int y ) const
         return rowCount;
     }
 
-    // sum all item heights until y is reached
+    // sum all item heights until y is reached, starting from the end of the
+    // part of the cache without gaps, as y is known to be after it
     unsigned int yy = 0;
+    row = m_rowHeightCache->GetValidCount();
+    if ( row )
+    {
+        m_rowHeightCache->GetLineInfo(row - 1, start, height);
+        yy = start + height;
+    }
+
     for (;;)
     {
         height = 0;
@@ -4417,6 +4587,160 @@ wxDataViewMainWindow::GetRowByItem(const wxDataViewItem & item,
     }
 }
 
+void wxDataViewMainWindow::Resort()
+{
+    ClearRowHeightCache();
+
+    if (!IsVirtualList())
+    {
+#if wxUSE_THREADS
+        // Keep showing the items in their current order until the sort is
+        // done, the display will be updated when it happens.
+        if ( StartBackgroundSort() )
+            return;
+
+        CancelBackgroundSort();
+#endif // wxUSE_THREADS
+
+        m_root->Resort(this);
+    }
+    UpdateDisplay();
+}
+
+void wxDataViewMainWindow::EnableBackgroundSorting(bool enable)
+{
+#if wxUSE_THREADS
+    m_backgroundSortEnabled = enable;
+
+    if ( !enable )
+        CompleteBackgroundSort();
+#else // !wxUSE_THREADS
+    wxUnusedVar(enable);
+#endif // wxUSE_THREADS/!wxUSE_THREADS
+}
+
+#if wxUSE_THREADS
+
+bool wxDataViewMainWindow::StartBackgroundSort()
+{
+    // Only the list models are sorted in the background, as only the top
+    // level items need to be sorted for them, and only when using a column
+    // as the sort key, as otherwise the model Compare() must be used.
+    if ( !m_backgroundSortEnabled || !IsList() )
+        return false;
+
+    const SortOrder sortOrder = GetSortOrder();
+    if ( !sortOrder.UsesColumn() )
+        return false;
+
+    const wxDataViewTreeNodes& nodes = m_root->GetChildNodes();
+
+    wxDataViewItemArray items;
+    items.reserve(nodes.size());
+    for ( const auto node : nodes )
+        items.push_back(node->GetItem());
+
+    auto data = std::make_shared<BackgroundSortData>();
+    if ( !GetModel()->GetSortKeys(items, sortOrder.GetColumn(), data->keys) )
+        return false;
+
+    wxCHECK_MSG( data->keys.size() == items.size(), false,
+                 "wrong number of sort keys" );
+
+    data->ids.reserve(items.size());
+    for ( const auto& item : items )
+        data->ids.push_back(wxPtrToUInt(item.GetID()));
+    data->ascending = sortOrder.IsAscending();
+
+    // We can't have more than one sort running at once, as we wouldn't be
+    // able to wait for all of them to finish in our dtor, so wait for the
+    // previous one, if any, whose results are not needed any more anyhow.
+    CancelBackgroundSort();
+    if ( m_backgroundSortFuture.valid() )
+        m_backgroundSortFuture.wait();
+
+    const unsigned generation = ++m_backgroundSortGeneration;
+
+    m_backgroundSortPending = true;
+    m_backgroundSortData = data;
+    m_backgroundSortOrder = sortOrder;
+
+    m_backgroundSortFuture = wxThreadPool::Get().Submit([this, data, generation]()
+        {
+            const auto& keys = data->keys;
+            const auto& ids = data->ids;
+
+            std::vector<unsigned>& order = data->order;
+            order.resize(keys.size());
+            for ( unsigned n = 0; n < order.size(); n++ )
+                order[n] = n;
+
+            // Use the same order as wxDataViewModel::Compare(), which
+            // compares the items ids if their values are equal.
+            const bool ascending = data->ascending;
+            std::sort(order.begin(), order.end(),
+                      [&](unsigned n1, unsigned n2)
+                      {
+                          int rc = keys[n1].Compare(keys[n2]);
+                          if ( !rc && ids[n1] != ids[n2] )
+                              rc = ids[n1] < ids[n2] ? -1 : 1;
+
+                          return ascending ? rc < 0 : rc > 0;
+                      });
+
+            CallAfter(&wxDataViewMainWindow::OnBackgroundSortDone, generation);
+        });
+
+    return true;
+}
+
+void wxDataViewMainWindow::OnBackgroundSortDone(unsigned generation)
+{
+    // Check that this sort was not cancelled in the meanwhile.
+    if ( !m_backgroundSortPending || generation != m_backgroundSortGeneration )
+        return;
+
+    m_backgroundSortPending = false;
+
+    // Note that this is only called once the sort order is computed, so this
+    // is not going to block for any noticeable time.
+    m_backgroundSortFuture.wait();
+
+    std::shared_ptr<BackgroundSortData> data;
+    data.swap(m_backgroundSortData);
+
+    m_root->SetChildrenOrder(data->order, m_backgroundSortOrder);
+
+    ClearRowHeightCache();
+    UpdateDisplay();
+}
+
+void wxDataViewMainWindow::CompleteBackgroundSort()
+{
+    if ( !m_backgroundSortPending )
+        return;
+
+    CancelBackgroundSort();
+
+    if ( m_root )
+        m_root->Resort(this);
+
+    ClearRowHeightCache();
+    UpdateDisplay();
+}
+
+void wxDataViewMainWindow::CancelBackgroundSort()
+{
+    if ( !m_backgroundSortPending )
+        return;
+
+    m_backgroundSortPending = false;
+    m_backgroundSortGeneration++;
+    m_backgroundSortData.reset();
+}
+
+#endif // wxUSE_THREADS
+
 static void BuildTreeHelper( wxDataViewMainWindow *window, const wxDataViewModel * model,
                              const wxDataViewItem & item, wxDataViewTreeNode * node)
 {
@@ -4426,6 +4750,8 @@ static void BuildTreeHelper( wxDataViewMainWindow *window, const wxDataViewModel
     wxDataViewItemArray children;
     unsigned int num = model->GetChildren( item, children);
 
+    wxDataViewTreeNodes nodes;
+    nodes.reserve(num);
     for ( unsigned int index = 0; index < num; index++ )
     {
         wxDataViewTreeNode *n = new wxDataViewTreeNode(node, children[index]);
@@ -4433,9 +4759,11 @@ static void BuildTreeHelper( wxDataViewMainWindow *window, const wxDataViewModel
         if( model->IsContainer(children[index]) )
             n->SetHasChildren( true );
 
-        node->InsertChild(window, n, index);
+        nodes.push_back(n);
     }
 
+    node->AddChildren(window, nodes);
+
     if ( node->IsOpen() )
         node->ChangeSubTreeCount(+num);
 }
@@ -4460,6 +4788,10 @@ void wxDataViewMainWindow::BuildTree(wxDataViewModel * model)
 
 void wxDataViewMainWindow::DestroyTree()
 {
+#if wxUSE_THREADS
+    CancelBackgroundSort();
+#endif // wxUSE_THREADS
+
     if (!IsVirtualList())
     {
         wxDELETE(m_root);
@@ -6010,6 +6342,19 @@ unsigned int wxDataViewCtrl::GetColumnCount() const
     return m_cols.size();
 }
 
+bool wxDataViewCtrl::EnableBackgroundSorting(bool enable)
+{
+#if wxUSE_THREADS
+    m_clientArea->EnableBackgroundSorting(enable);
+
+    return true;
+#else // !wxUSE_THREADS
+    wxUnusedVar(enable);
+
+    return false;
+#endif // wxUSE_THREADS/!wxUSE_THREADS
+}
+
 bool wxDataViewCtrl::SetRowHeight( int lineHeight )
 {
     if ( !m_clientArea )
@@ -6330,20 +6675,25 @@ int wxDataViewCtrl::GetSelections( wxDataViewItemArray & sel ) const
 {
     sel.Empty();
     const wxSelectionStore& selections = m_clientArea->GetSelections();
+    sel.reserve(selections.GetSelectedCount());
 
     wxSelectionStore::IterationState cookie;
-    for ( unsigned row = selections.GetFirstSelectedItem(cookie);
-          row != wxSelectionStore::NO_SELECTION;
-          row = selections.GetNextSelectedItem(cookie) )
+    unsigned from, to;
+    for ( bool cont = selections.GetFirstSelectedRange(cookie, from, to);
+          cont;
+          cont = selections.GetNextSelectedRange(cookie, from, to) )
     {
-        wxDataViewItem item = m_clientArea->GetItemByRow(row);
-        if ( item.IsOk() )
+        for ( unsigned row = from; row <= to; row++ )
         {
-            sel.Add(item);
-        }
-        else
-        {
-            wxFAIL_MSG( "invalid item in selection - bad internal state" );
+            wxDataViewItem item = m_clientArea->GetItemByRow(row);
+            if ( item.IsOk() )
+            {
+                sel.Add(item);
+            }
+            else
+            {
+                wxFAIL_MSG( "invalid item in selection - bad internal state" );
+            }
         }
     }
 
@@ -29,6 +29,11 @@
 #include "wx/paper.h"
 #include "wx/filename.h"
 #include "wx/stdpaths.h"
+#include "wx/mstream.h"
+
+#if wxUSE_ZLIB
+    #include "wx/zstream.h"
+#endif
 
 #ifdef __WXMSW__
 
@@ -54,6 +59,14 @@
 // start and end of document/page
 //-----------------------------------------------------------------------------
 
+// Short names for the most commonly used operators, reducing the size of the
+// output for the drawings containing many lines.
+static const char *wxPostScriptHeaderShortcuts =
+"/m { moveto } bind def\n"
+"/l { lineto } bind def\n"
+"/ls { newpath moveto lineto stroke } bind def\n" // x1 y1 x2 y2
+;
+
 static const char *wxPostScriptHeaderConicTo = "\
 /conicto {\n\
     /to_y exch def\n\
@@ -210,6 +223,118 @@ static const char *wxPostScriptHeaderStrSplit =
 "    }loop\n"        // [ str-items
 "  ]\n"              // [ str-items ]
 "} def\n";
+//-------------------------------------------------------------------------------
+// helpers
+//-------------------------------------------------------------------------------
+
+// The size of the output buffer after which it is written out.
+static const size_t PS_BUFFER_SIZE = 64*1024;
+
+// Append the number to the string using the format suitable for PostScript,
+// i.e. always using period as decimal separator, with at most 6 fractional
+// digits and without trailing zeroes. This is much faster than formatting the
+// numbers using wxString.
+static void wxAppendPSNumber(std::string& s, double value)
+{
+    if ( !(fabs(value) < 1e12) )
+    {
+        // This is not supposed to happen with any reasonable coordinates, but
+        // still output something valid for the huge or invalid numbers.
+        s += wxString::FromCDouble(wxIsNaN(value) ? 0 : value, 6).utf8_string();
+        return;
+    }
+
+    const bool negative = value < 0;
+    if ( negative )
+        value = -value;
+
+    const wxUint64 v = static_cast<wxUint64>(value*1000000 + 0.5);
+    wxUint64 intPart = v / 1000000;
+    unsigned frac = static_cast<unsigned>(v % 1000000);
+
+    if ( negative && v )
+        s += '-';
+
+    char buf[32];
+    char* const end = buf + sizeof(buf);
+    char* p = end;
+    do
+    {
+        *--p = static_cast<char>('0' + intPart % 10);
+        intPart /= 10;
+    }
+    while ( intPart );
+
+    s.append(p, end - p);
+
+    if ( frac )
+    {
+        int digits = 6;
+        while ( frac % 10 == 0 )
+        {
+            frac /= 10;
+            digits--;
+        }
+
+        p = end;
+        for ( int i = 0; i < digits; i++ )
+        {
+            *--p = static_cast<char>('0' + frac % 10);
+            frac /= 10;
+        }
+        *--p = '.';
+
+        s.append(p, end - p);
+    }
+}
+
+// Return the data encoded using ASCII base-85 encoding used by the PostScript
+// ASCII85Decode filter, including the end of data marker and split into lines.
+static std::string wxEncodeASCII85(const unsigned char* data, size_t len)
+{
+    std::string s;
+    s.reserve(len*5/4 + len/60 + 8);
+
+    size_t lineLen = 0;
+    for ( size_t n = 0; n < len; n += 4 )
+    {
+        const size_t count = wxMin(len - n, size_t(4));
+
+        wxUint32 group = 0;
+        for ( size_t i = 0; i < 4; i++ )
+            group = (group << 8) | (i < count ? data[n + i] : 0);
+
+        if ( group == 0 && count == 4 )
+        {
+            s += 'z';
+            lineLen++;
+        }
+        else
+        {
+            char chars[5];
+            for ( int i = 4; i >= 0; i-- )
+            {
+                chars[i] = static_cast<char>('!' + group % 85);
+                group /= 85;
+            }
+
+            // The partial last group is output using count + 1 characters.
+            s.append(chars, count + 1);
+            lineLen += count + 1;
+        }
+
+        if ( lineLen >= 75 )
+        {
+            s += '\n';
+            lineLen = 0;
+        }
+    }
+
+    s += "~>\n";
+
+    return s;
+}
+
 //-------------------------------------------------------------------------------
 // wxPostScriptDC
 //-------------------------------------------------------------------------------
@@ -227,6 +352,16 @@ wxPostScriptDC::wxPostScriptDC(const wxPrintData& printData)
 {
 }
 
+void wxPostScriptDC::SetBitmapEncoding(wxPostScriptBitmapEncoding encoding)
+{
+    static_cast<wxPostScriptDCImpl*>(GetImpl())->SetBitmapEncoding(encoding);
+}
+
+wxPostScriptBitmapEncoding wxPostScriptDC::GetBitmapEncoding() const
+{
+    return static_cast<const wxPostScriptDCImpl*>(GetImpl())->GetBitmapEncoding();
+}
+
 // we don't want to use only 72 dpi from PS print
 static const int DPI = 600;
 static const double PS2DEV = 600.0 / 72.0;
@@ -303,10 +438,16 @@ void wxPostScriptDCImpl::Init()
     m_underlineThickness = 0.0;
 
     m_isFontChanged = false;
+
+    m_currentLineWidth = -1;
+
+    m_bitmapEncoding = wxPS_BITMAP_HEX;
 }
 
 wxPostScriptDCImpl::~wxPostScriptDCImpl ()
 {
+    PsFlush();
+
     if (m_pstream)
     {
         fclose( m_pstream );
@@ -371,6 +512,9 @@ void wxPostScriptDCImpl::DestroyClippingRegion()
     {
         m_clipping = false;
         PsPrint( "grestore\n" );
+
+        // The line width may have been changed since "gsave".
+        m_currentLineWidth = -1;
     }
 
     wxDCImpl::DestroyClippingRegion();
@@ -409,15 +553,9 @@ void wxPostScriptDCImpl::DoDrawLine (wxCoord x1, wxCoord y1, wxCoord x2, wxCoord
 
     SetPen( m_pen );
 
-    wxString buffer;
-    buffer.Printf( "newpath\n"
-                   "%f %f moveto\n"
-                   "%f %f lineto\n"
-                   "stroke\n",
-            XLOG2DEV(x1), YLOG2DEV(y1),
-            XLOG2DEV(x2), YLOG2DEV(y2) );
-    buffer.Replace( ",", "." );
-    PsPrint( buffer );
+    PsPrintPoint( XLOG2DEV(x1), YLOG2DEV(y1) );
+    PsPrintPoint( XLOG2DEV(x2), YLOG2DEV(y2) );
+    PsPrint( "ls\n" );
 
     CalcBoundingBox( x1, y1, x2, y2 );
 }
@@ -562,15 +700,9 @@ void wxPostScriptDCImpl::DoDrawPoint (wxCoord x, wxCoord y)
 
     SetPen (m_pen);
 
-    wxString buffer;
-    buffer.Printf( "newpath\n"
-                   "%f %f moveto\n"
-                   "%f %f lineto\n"
-                   "stroke\n",
-            XLOG2DEV(x),   YLOG2DEV(y),
-            XLOG2DEV(x+1), YLOG2DEV(y) );
-    buffer.Replace( ",", "." );
-    PsPrint( buffer );
+    PsPrintPoint( XLOG2DEV(x),   YLOG2DEV(y) );
+    PsPrintPoint( XLOG2DEV(x+1), YLOG2DEV(y) );
+    PsPrint( "ls\n" );
 
     CalcBoundingBox( x, y );
 }
@@ -587,27 +719,7 @@ void wxPostScriptDCImpl::DoDrawPolygon (int n, const wxPoint points[], wxCoord x
 
         PsPrint( "newpath\n" );
 
-        double xx = XLOG2DEV(points[0].x + xoffset);
-        double yy = YLOG2DEV(points[0].y + yoffset);
-
-        wxString buffer;
-        buffer.Printf( "%f %f moveto\n", xx, yy );
-        buffer.Replace( ",", "." );
-        PsPrint( buffer );
-
-        CalcBoundingBox( points[0].x + xoffset, points[0].y + yoffset );
-
-        for (int i = 1; i < n; i++)
-        {
-            xx = XLOG2DEV(points[i].x + xoffset);
-            yy = YLOG2DEV(points[i].y + yoffset);
-
-            buffer.Printf( "%f %f lineto\n", xx, yy );
-            buffer.Replace( ",", "." );
-            PsPrint( buffer );
-
-            CalcBoundingBox( points[i].x + xoffset, points[i].y + yoffset);
-        }
+        PsPrintPath( n, points, xoffset, yoffset );
 
         PsPrint( (fillStyle == wxODDEVEN_RULE ? "eofill\n" : "fill\n") );
     }
@@ -618,27 +730,7 @@ void wxPostScriptDCImpl::DoDrawPolygon (int n, const wxPoint points[], wxCoord x
 
         PsPrint( "newpath\n" );
 
-        double xx = XLOG2DEV(points[0].x + xoffset);
-        double yy = YLOG2DEV(points[0].y + yoffset);
-
-        wxString buffer;
-        buffer.Printf( "%f %f moveto\n", xx, yy );
-        buffer.Replace( ",", "." );
-        PsPrint( buffer );
-
-        CalcBoundingBox( points[0].x + xoffset, points[0].y + yoffset );
-
-        for (int i = 1; i < n; i++)
-        {
-            xx = XLOG2DEV(points[i].x + xoffset);
-            yy = YLOG2DEV(points[i].y + yoffset);
-
-            buffer.Printf( "%f %f lineto\n", xx, yy );
-            buffer.Replace( ",", "." );
-            PsPrint( buffer );
-
-            CalcBoundingBox( points[i].x + xoffset, points[i].y + yoffset);
-        }
+        PsPrintPath( n, points, xoffset, yoffset );
 
         PsPrint( "closepath\n" );
         PsPrint( "stroke\n" );
@@ -659,29 +751,7 @@ void wxPostScriptDCImpl::DoDrawPolyPolygon (int n, const int count[], const wxPo
 
         int ofs = 0;
         for (int i = 0; i < n; ofs += count[i++])
-        {
-            double xx = XLOG2DEV(points[ofs].x + xoffset);
-            double yy = YLOG2DEV(points[ofs].y + yoffset);
-
-            wxString buffer;
-            buffer.Printf( "%f %f moveto\n", xx, yy );
-            buffer.Replace( ",", "." );
-            PsPrint( buffer );
-
-            CalcBoundingBox( points[ofs].x + xoffset, points[ofs].y + yoffset );
-
-            for (int j = 1; j < count[i]; j++)
-            {
-                xx = XLOG2DEV(points[ofs+j].x + xoffset);
-                yy = YLOG2DEV(points[ofs+j].y + yoffset);
-
-                buffer.Printf( "%f %f lineto\n", xx, yy );
-                buffer.Replace( ",", "." );
-                PsPrint( buffer );
-
-                CalcBoundingBox( points[ofs+j].x + xoffset, points[ofs+j].y + yoffset);
-            }
-        }
+            PsPrintPath( count[i], points + ofs, xoffset, yoffset );
         PsPrint( (fillStyle == wxODDEVEN_RULE ? "eofill\n" : "fill\n") );
     }
 
@@ -693,29 +763,7 @@ void wxPostScriptDCImpl::DoDrawPolyPolygon (int n, const int count[], const wxPo
 
         int ofs = 0;
         for (int i = 0; i < n; ofs += count[i++])
-        {
-            double xx = XLOG2DEV(points[ofs].x + xoffset);
-            double yy = YLOG2DEV(points[ofs].y + yoffset);
-
-            wxString buffer;
-            buffer.Printf( "%f %f moveto\n", xx, yy );
-            buffer.Replace( ",", "." );
-            PsPrint( buffer );
-
-            CalcBoundingBox( points[ofs].x + xoffset, points[ofs].y + yoffset );
-
-            for (int j = 1; j < count[i]; j++)
-            {
-                xx = XLOG2DEV(points[ofs+j].x + xoffset);
-                yy = YLOG2DEV(points[ofs+j].y + yoffset);
-
-                buffer.Printf( "%f %f lineto\n", xx, yy );
-                buffer.Replace( ",", "." );
-                PsPrint( buffer );
-
-                CalcBoundingBox( points[ofs+j].x + xoffset, points[ofs+j].y + yoffset);
-            }
-        }
+            PsPrintPath( count[i], points + ofs, xoffset, yoffset );
         PsPrint( "closepath\n" );
         PsPrint( "stroke\n" );
     }
@@ -732,26 +780,9 @@ void wxPostScriptDCImpl::DoDrawLines (int n, const wxPoint points[], wxCoord xof
 
     SetPen (m_pen);
 
-    int i;
-    for ( i =0; i<n ; i++ )
-        CalcBoundingBox( points[i].x+xoffset, points[i].y+yoffset );
-
-    wxString buffer;
-    buffer.Printf( "newpath\n"
-                   "%f %f moveto\n",
-              XLOG2DEV(points[0].x+xoffset),
-              YLOG2DEV(points[0].y+yoffset) );
-    buffer.Replace( ",", "." );
-    PsPrint( buffer );
+    PsPrint( "newpath\n" );
 
-    for (i = 1; i < n; i++)
-    {
-        buffer.Printf( "%f %f lineto\n",
-                  XLOG2DEV(points[i].x+xoffset),
-                  YLOG2DEV(points[i].y+yoffset) );
-        buffer.Replace( ",", "." );
-        PsPrint( buffer );
-    }
+    PsPrintPath( n, points, xoffset, yoffset );
 
     PsPrint( "stroke\n" );
 }
@@ -767,20 +798,17 @@ void wxPostScriptDCImpl::DoDrawRectangle (wxCoord x, wxCoord y, wxCoord width, w
     {
         SetBrush( m_brush );
 
-        wxString buffer;
-        buffer.Printf( "newpath\n"
-                       "%f %f moveto\n"
-                       "%f %f lineto\n"
-                       "%f %f lineto\n"
-                       "%f %f lineto\n"
-                       "closepath\n"
-                       "fill\n",
-                XLOG2DEV(x),         YLOG2DEV(y),
-                XLOG2DEV(x + width), YLOG2DEV(y),
-                XLOG2DEV(x + width), YLOG2DEV(y + height),
-                XLOG2DEV(x),         YLOG2DEV(y + height) );
-        buffer.Replace( ",", "." );
-        PsPrint( buffer );
+        PsPrint( "newpath\n" );
+        PsPrintPoint( XLOG2DEV(x),         YLOG2DEV(y) );
+        PsPrint( "m\n" );
+        PsPrintPoint( XLOG2DEV(x + width), YLOG2DEV(y) );
+        PsPrint( "l\n" );
+        PsPrintPoint( XLOG2DEV(x + width), YLOG2DEV(y + height) );
+        PsPrint( "l\n" );
+        PsPrintPoint( XLOG2DEV(x),         YLOG2DEV(y + height) );
+        PsPrint( "l\n"
+                 "closepath\n"
+                 "fill\n" );
 
         CalcBoundingBox( wxPoint(x, y), wxSize(width, height) );
     }
@@ -789,20 +817,17 @@ void wxPostScriptDCImpl::DoDrawRectangle (wxCoord x, wxCoord y, wxCoord width, w
     {
         SetPen (m_pen);
 
-        wxString buffer;
-        buffer.Printf( "newpath\n"
-                       "%f %f moveto\n"
-                       "%f %f lineto\n"
-                       "%f %f lineto\n"
-                       "%f %f lineto\n"
-                       "closepath\n"
-                       "stroke\n",
-                XLOG2DEV(x),         YLOG2DEV(y),
-                XLOG2DEV(x + width), YLOG2DEV(y),
-                XLOG2DEV(x + width), YLOG2DEV(y + height),
-                XLOG2DEV(x),         YLOG2DEV(y + height) );
-        buffer.Replace( ",", "." );
-        PsPrint( buffer );
+        PsPrint( "newpath\n" );
+        PsPrintPoint( XLOG2DEV(x),         YLOG2DEV(y) );
+        PsPrint( "m\n" );
+        PsPrintPoint( XLOG2DEV(x + width), YLOG2DEV(y) );
+        PsPrint( "l\n" );
+        PsPrintPoint( XLOG2DEV(x + width), YLOG2DEV(y + height) );
+        PsPrint( "l\n" );
+        PsPrintPoint( XLOG2DEV(x),         YLOG2DEV(y + height) );
+        PsPrint( "l\n"
+                 "closepath\n"
+                 "stroke\n" );
 
         CalcBoundingBox( wxPoint(x, y), wxSize(width, height) );
     }
@@ -952,6 +977,10 @@ void wxPostScriptDCImpl::DoDrawBitmap( const wxBitmap& bitmap, wxCoord x, wxCoor
     double xx = XLOG2DEV(x);
     double yy = YLOG2DEV(y + bitmap.GetHeight());
 
+    if ( m_bitmapEncoding != wxPS_BITMAP_HEX &&
+            DoDrawCompressedBitmap(image, xx, yy, ww, hh) )
+        return;
+
     wxString buffer;
     buffer.Printf( "/origstate save def\n"
                    "20 dict begin\n"
@@ -992,16 +1021,82 @@ void wxPostScriptDCImpl::DoDrawBitmap( const wxBitmap& bitmap, wxCoord x, wxCoor
         *(bufferindex++) = '\n';
         *bufferindex = 0;
 
-        if (m_pstream)
-            fwrite( charbuffer, 1, strlen( charbuffer ), m_pstream );
-        else
-            PsPrint( charbuffer );
+        PsWrite( charbuffer, bufferindex - charbuffer.data() );
     }
 
     PsPrint( "end\n" );
     PsPrint( "origstate restore\n" );
 }
 
+bool wxPostScriptDCImpl::DoDrawCompressedBitmap(const wxImage& image,
+                                                double xx, double yy,
+                                                double ww, double hh)
+{
+    const int w = image.GetWidth();
+    const int h = image.GetHeight();
+
+    wxMemoryOutputStream mstream;
+    const char* filter = nullptr;
+
+    switch ( m_bitmapEncoding )
+    {
+        case wxPS_BITMAP_HEX:
+            break;
+
+        case wxPS_BITMAP_FLATE:
+#if wxUSE_ZLIB
+            {
+                // Note that FlateDecode filter expects the zlib header.
+                wxZlibOutputStream zstream(mstream, wxZ_DEFAULT_COMPRESSION,
+                                           wxZLIB_ZLIB);
+                zstream.Write(image.GetData(), 3*size_t(w)*h);
+                if ( zstream.Close() )
+                    filter = "FlateDecode";
+            }
+#endif // wxUSE_ZLIB
+            break;
+
+        case wxPS_BITMAP_DCT:
+#if wxUSE_LIBJPEG
+            if ( wxImage::FindHandler(wxBITMAP_TYPE_JPEG) == nullptr )
+                wxImage::AddHandler(new wxJPEGHandler);
+
+            if ( image.SaveFile(mstream, wxBITMAP_TYPE_JPEG) )
+                filter = "DCTDecode";
+#endif // wxUSE_LIBJPEG
+            break;
+    }
+
+    if ( !filter )
+        return false;
+
+    wxString buffer;
+    buffer.Printf( "/origstate save def\n"
+                   "%f %f translate\n"
+                   "%f %f scale\n"
+                   "/DeviceRGB setcolorspace\n"
+                   "<<\n"
+                   "/ImageType 1 /Width %d /Height %d /BitsPerComponent 8\n"
+                   "/Decode [0 1 0 1 0 1] /ImageMatrix [%d 0 0 %d 0 %d]\n"
+                   "/DataSource currentfile /ASCII85Decode filter /%s filter\n"
+                   ">> image\n",
+            xx, yy, ww, hh, w, h, w, -h, h, filter );
+    buffer.Replace( ",", "." );
+    PsPrint( buffer );
+
+    wxCharBuffer data(mstream.GetLength());
+    mstream.CopyTo(data.data(), data.length());
+
+    const std::string
+        encoded = wxEncodeASCII85(reinterpret_cast<unsigned char*>(data.data()),
+                                  data.length());
+    PsWrite( encoded.data(), encoded.length() );
+
+    PsPrint( "origstate restore\n" );
+
+    return true;
+}
+
 // Set PostScript color
 void wxPostScriptDCImpl::SetPSColour(const wxColor& col)
 {
@@ -1023,14 +1118,10 @@ void wxPostScriptDCImpl::SetPSColour(const wxColor& col)
 
     if (!(red == m_currentRed && green == m_currentGreen && blue == m_currentBlue))
     {
-        double redPS = (double)red / 255.0;
-        double bluePS = (double)blue / 255.0;
-        double greenPS = (double)green / 255.0;
-
-        wxString buffer;
-        buffer.Printf( "%f %f %f setrgbcolor\n", redPS, greenPS, bluePS );
-        buffer.Replace( ",", "." );
-        PsPrint( buffer );
+        PsPrintNumber( red / 255.0 );
+        PsPrintNumber( green / 255.0 );
+        PsPrintNumber( blue / 255.0 );
+        PsPrint( "setrgbcolor\n" );
 
         m_currentRed = red;
         m_currentBlue = blue;
@@ -1168,10 +1259,17 @@ void wxPostScriptDCImpl::SetPen( const wxPen& pen )
     else
         width = (double) m_pen.GetWidth();
 
+    // Avoid repeating this for every line, as SetPen() is called before
+    // drawing each of them.
+    const double lineWidth = width * DEV2PS * m_scaleX;
+    if ( lineWidth != m_currentLineWidth )
+    {
+        PsPrintNumber( lineWidth );
+        PsPrint( "setlinewidth\n" );
+        m_currentLineWidth = lineWidth;
+    }
+
     wxString buffer;
-    buffer.Printf( "%f setlinewidth\n", width * DEV2PS * m_scaleX );
-    buffer.Replace( ",", "." );
-    PsPrint( buffer );
 
 /*
      Line style - WRONG: 2nd arg is OFFSET
@@ -1679,8 +1777,11 @@ bool wxPostScriptDCImpl::StartDoc( const wxString& WXUNUSED(message) )
     PsPrint( wxPostScriptHeaderReencodeISO1 );
     PsPrint( wxPostScriptHeaderReencodeISO2 );
     PsPrint( wxPostScriptHeaderStrSplit );
+    PsPrint( wxPostScriptHeaderShortcuts );
     PsPrint( "%%EndProlog\n" );
 
+    m_currentLineWidth = -1;
+
     SetBrush( *wxBLACK_BRUSH );
     SetPen( *wxBLACK_PEN );
     SetBackground( *wxWHITE_BRUSH );
@@ -1706,6 +1807,8 @@ void wxPostScriptDCImpl::EndDoc ()
         PsPrint( "grestore\n" );
     }
 
+    PsFlush();
+
     if ( m_pstream ) {
         fclose( m_pstream );
         m_pstream = nullptr;
@@ -1809,6 +1912,9 @@ void wxPostScriptDCImpl::StartPage()
     buffer.Printf( wxT("%%%%Page: %d\n"), m_pageNumber++ );
     PsPrint( buffer );
 
+    // The graphics state is reset by "showpage" at the end of each page.
+    m_currentLineWidth = -1;
+
 #if 0
     wxPostScriptPrintNativeData *data =
         wxDynamicCast(m_printData.GetNativeData(), wxPostScriptPrintNativeData);
@@ -1845,6 +1951,9 @@ void wxPostScriptDCImpl::EndPage ()
     wxCHECK_RET( m_ok , wxT("invalid postscript dc") );
 
     PsPrint( "showpage\n" );
+
+    // Write out each page as soon as it's done.
+    PsFlush();
 }
 
 bool wxPostScriptDCImpl::DoBlit( wxCoord xdest, wxCoord ydest,
@@ -1881,7 +1990,52 @@ wxCoord wxPostScriptDCImpl::GetCharHeight() const
 
 void wxPostScriptDCImpl::PsPrint( const wxString& str )
 {
-    const wxCharBuffer psdata(str.utf8_str());
+    const wxScopedCharBuffer psdata(str.utf8_str());
+    PsWrite( psdata.data(), psdata.length() );
+}
+
+void wxPostScriptDCImpl::PsPrint( const char* psdata )
+{
+    PsWrite( psdata, strlen( psdata ) );
+}
+
+void wxPostScriptDCImpl::PsWrite( const char* data, size_t len )
+{
+    m_psBuffer.append( data, len );
+
+    if ( m_psBuffer.length() >= PS_BUFFER_SIZE )
+        PsFlush();
+}
+
+void wxPostScriptDCImpl::PsPrintNumber( double value )
+{
+    wxAppendPSNumber( m_psBuffer, value );
+    m_psBuffer += ' ';
+}
+
+void wxPostScriptDCImpl::PsPrintPath( int n, const wxPoint points[],
+                                      wxCoord xoffset, wxCoord yoffset )
+{
+    for (int i = 0; i < n; i++)
+    {
+        const wxCoord x = points[i].x + xoffset;
+        const wxCoord y = points[i].y + yoffset;
+
+        PsPrintPoint( XLOG2DEV(x), YLOG2DEV(y) );
+        PsPrint( i == 0 ? "m\n" : "l\n" );
+
+        CalcBoundingBox( x, y );
+    }
+}
+
+void wxPostScriptDCImpl::PsFlush()
+{
+    if ( m_psBuffer.empty() )
+        return;
+
+    // Don't keep the data in the buffer even if we fail to write it below.
+    std::string psdata;
+    psdata.swap( m_psBuffer );
 
     switch (m_printData.GetPrintMode())
     {
@@ -1897,7 +2051,7 @@ void wxPostScriptDCImpl::PsPrint( const wxString& str )
                 wxCHECK_RET( data, wxS("Cannot obtain output stream") );
                 wxOutputStream* outputstream = data->GetOutputStream();
                 wxCHECK_RET( outputstream, wxT("invalid outputstream") );
-                outputstream->Write( psdata, strlen( psdata ) );
+                outputstream->Write( psdata.data(), psdata.length() );
             }
             break;
 #endif // wxUSE_STREAMS
@@ -1905,7 +2059,7 @@ void wxPostScriptDCImpl::PsPrint( const wxString& str )
         // save data into file
         default:
             wxCHECK_RET( m_pstream, wxT("invalid postscript dc") );
-            fwrite( psdata, 1, strlen( psdata ), m_pstream );
+            fwrite( psdata.data(), 1, psdata.length(), m_pstream );
     }
 }
 
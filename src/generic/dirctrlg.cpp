@@ -42,6 +42,10 @@
 #include "wx/artprov.h"
 #include "wx/mimetype.h"
 
+#if wxUSE_THREADS
+    #include "wx/generic/private/dirlister.h"
+#endif
+
 #if wxUSE_STATLINE
     #include "wx/statline.h"
 #endif
@@ -417,11 +421,37 @@ bool wxGenericDirCtrl::Create(wxWindow *parent,
 
 wxGenericDirCtrl::~wxGenericDirCtrl()
 {
+    // Ensure that no callbacks referencing this object are called any more:
+    // the tree items are only going to be deleted later.
+    if ( m_treeCtrl )
+    {
+        const wxTreeItemId rootId = m_treeCtrl->GetRootItem();
+        if ( rootId.IsOk() )
+            CancelBackgroundExpansion(rootId);
+    }
+}
+
+void wxGenericDirCtrl::CancelBackgroundExpansion(wxTreeItemId itemId)
+{
+    wxDirItemData* const data = GetItemData(itemId);
+    if ( !data || !data->m_isExpanded )
+        return;
+
+    data->m_lister.reset();
+
+    wxTreeItemIdValue cookie;
+    for ( wxTreeItemId child = m_treeCtrl->GetFirstChild(itemId, cookie);
+          child.IsOk();
+          child = m_treeCtrl->GetNextChild(itemId, cookie) )
+    {
+        CancelBackgroundExpansion(child);
+    }
 }
 
 void wxGenericDirCtrl::Init()
 {
     m_showHidden = false;
+    m_backgroundExpansion = false;
     m_currentFilter = 0;
     m_currentFilterStr.clear(); // Default: any file
     m_treeCtrl = nullptr;
@@ -615,7 +645,10 @@ void wxGenericDirCtrl::OnExpandItem(wxTreeEvent &event)
     if (!m_rootId.IsOk())
         m_rootId = m_treeCtrl->GetRootItem();
 
-    ExpandDir(parentId);
+    if ( m_backgroundExpansion )
+        PopulateNode(parentId, true /* in background */);
+    else
+        ExpandDir(parentId);
 }
 
 void wxGenericDirCtrl::OnCollapseItem(wxTreeEvent &event )
@@ -632,6 +665,7 @@ void wxGenericDirCtrl::CollapseDir(wxTreeItemId parentId)
         return;
 
     data->m_isExpanded = false;
+    data->m_lister.reset();
 
     m_treeCtrl->Freeze();
     if (parentId != m_treeCtrl->GetRootItem())
@@ -640,12 +674,20 @@ void wxGenericDirCtrl::CollapseDir(wxTreeItemId parentId)
     m_treeCtrl->Thaw();
 }
 
-void wxGenericDirCtrl::PopulateNode(wxTreeItemId parentId)
+void wxGenericDirCtrl::PopulateNode(wxTreeItemId parentId, bool background)
 {
     wxDirItemData *data = GetItemData(parentId);
 
     if (data->m_isExpanded)
-        return;
+    {
+        if (!data->m_lister || background)
+            return;
+
+        // The node is still being populated in background, but we need all
+        // of its children right now, so start again synchronously.
+        data->m_lister.reset();
+        m_treeCtrl->DeleteChildren(parentId);
+    }
 
     data->m_isExpanded = true;
 
@@ -657,8 +699,6 @@ void wxGenericDirCtrl::PopulateNode(wxTreeItemId parentId)
 
     wxASSERT(data);
 
-    wxString path;
-
     wxString dirName(data->m_path);
 
 #if defined(__WINDOWS__)
@@ -672,14 +712,60 @@ void wxGenericDirCtrl::PopulateNode(wxTreeItemId parentId)
     }
 #endif
 
-    // This may take a longish time. Go to busy cursor
-    wxBusyCursor busy;
-
 #if defined(__WINDOWS__)
     if (dirName.Last() == ':')
         dirName += wxString(wxFILE_SEP_PATH);
 #endif
 
+#if wxUSE_THREADS
+    if (background)
+    {
+        wxAsyncDirLister::Params params;
+        params.dirname = dirName;
+        params.dirFlags = wxDIR_DIRS;
+        if (!HasFlag(wxDIRCTRL_DIR_ONLY) && !m_currentFilterStr.empty())
+        {
+            params.fileFlags = wxDIR_FILES;
+            params.fileSpecs = wxSplit(m_currentFilterStr, wxT(';'), wxT('\0'));
+        }
+        if (m_showHidden)
+        {
+            params.dirFlags |= wxDIR_HIDDEN;
+            params.fileFlags |= wxDIR_HIDDEN;
+        }
+        params.sort = true;
+
+        // Note that the item can't be deleted while the callbacks can still
+        // be called, as this would destroy its data and cancel the lister.
+        data->m_lister = std::make_shared<wxAsyncDirLister>
+        (
+            this,
+            params,
+            [this, parentId, dirName](const wxAsyncDirLister::Entries& entries)
+            {
+                m_treeCtrl->Freeze();
+                for ( const auto& entry : entries )
+                    AppendEntry(parentId, dirName, entry.name, entry.isDir);
+                m_treeCtrl->Thaw();
+            },
+            [this, parentId]()
+            {
+                // Now we really know whether we have any children.
+                if ( !m_treeCtrl->GetChildrenCount(parentId, false) )
+                    m_treeCtrl->SetItemHasChildren(parentId, false);
+
+                GetItemData(parentId)->m_lister.reset();
+            }
+        );
+        return;
+    }
+#else // !wxUSE_THREADS
+    wxUnusedVar(background);
+#endif // wxUSE_THREADS/!wxUSE_THREADS
+
+    // This may take a longish time. Go to busy cursor
+    wxBusyCursor busy;
+
     wxArrayString dirs;
     wxArrayString filenames;
 
@@ -746,15 +832,28 @@ void wxGenericDirCtrl::PopulateNode(wxTreeItemId parentId)
     // Add the sorted dirs
     size_t i;
     for (i = 0; i < dirs.GetCount(); i++)
+        AppendEntry(parentId, dirName, dirs[i], true);
+
+    // Add the sorted filenames
+    for (i = 0; i < filenames.GetCount(); i++)
+        AppendEntry(parentId, dirName, filenames[i], false);
+}
+
+void wxGenericDirCtrl::AppendEntry(wxTreeItemId parentId,
+                                   const wxString& dirName,
+                                   const wxString& name,
+                                   bool isDir)
+{
+    wxString path = dirName;
+    if (!wxEndsWithPathSeparator(path))
+        path += wxString(wxFILE_SEP_PATH);
+    path += name;
+
+    wxDirItemData *dir_item = new wxDirItemData(path, name, isDir);
+
+    if (isDir)
     {
-        eachFilename = dirs[i];
-        path = dirName;
-        if (!wxEndsWithPathSeparator(path))
-            path += wxString(wxFILE_SEP_PATH);
-        path += eachFilename;
-
-        wxDirItemData *dir_item = new wxDirItemData(path,eachFilename,true);
-        wxTreeItemId treeid = AppendItem( parentId, eachFilename,
+        wxTreeItemId treeid = AppendItem( parentId, name,
                                       wxFileIconsTable::folder, -1, dir_item);
         m_treeCtrl->SetItemImage( treeid, wxFileIconsTable::folder_open,
                                   wxTreeItemIcon_Expanded );
@@ -766,24 +865,12 @@ void wxGenericDirCtrl::PopulateNode(wxTreeItemId parentId)
         // the user really tries to open this item
         m_treeCtrl->SetItemHasChildren(treeid);
     }
-
-    // Add the sorted filenames
-    if (!HasFlag(wxDIRCTRL_DIR_ONLY))
+    else
     {
-        for (i = 0; i < filenames.GetCount(); i++)
-        {
-            eachFilename = filenames[i];
-            path = dirName;
-            if (!wxEndsWithPathSeparator(path))
-                path += wxString(wxFILE_SEP_PATH);
-            path += eachFilename;
-            //path = dirName + wxString(wxT("/")) + eachFilename;
-            wxDirItemData *dir_item = new wxDirItemData(path,eachFilename,false);
-            int image_id = wxFileIconsTable::file;
-            if (eachFilename.Find(wxT('.')) != wxNOT_FOUND)
-                image_id = wxTheFileIconsTable->GetIconID(eachFilename.AfterLast(wxT('.')));
-            (void) AppendItem( parentId, eachFilename, image_id, -1, dir_item);
-        }
+        int image_id = wxFileIconsTable::file;
+        if (name.Find(wxT('.')) != wxNOT_FOUND)
+            image_id = wxTheFileIconsTable->GetIconID(name.AfterLast(wxT('.')));
+        (void) AppendItem( parentId, name, image_id, -1, dir_item);
     }
 }
 
@@ -30,6 +30,10 @@
 #include "wx/tokenzr.h"
 #include "wx/imaglist.h"
 
+#if wxUSE_THREADS
+    #include "wx/generic/private/dirlister.h"
+#endif
+
 #ifdef __WINDOWS__
     #include "wx/msw/wrapwin.h"
 #endif
@@ -143,6 +147,23 @@ wxFileData::wxFileData( const wxString &filePath, const wxString &fileName, file
     ReadData();
 }
 
+wxFileData::wxFileData( const wxString &filePath, const wxString &fileName,
+                        fileType type, int image_id, const wxFileStat& stat )
+{
+    Init();
+    m_fileName = fileName;
+    m_filePath = filePath;
+    m_type = type;
+    m_image = image_id;
+
+    // We show the information about the links themselves and not their
+    // targets, so we need to retrieve it again for them.
+    if ( stat.IsOk() && !stat.IsSymLink() )
+        SetFromStat(stat);
+    else
+        ReadData();
+}
+
 void wxFileData::Init()
 {
     m_size = 0;
@@ -181,39 +202,41 @@ void wxFileData::ReadData()
 
     // OTHER PLATFORMS
 
-    wxStructStat buff;
-
 #if defined(__UNIX__) && !defined(__VMS)
-    const bool hasStat = wxLstat( m_filePath, &buff ) == 0;
-    if ( hasStat )
-        m_type |= S_ISLNK(buff.st_mode) ? is_link : 0;
+    SetFromStat(wxFileStat(m_filePath, wxFILE_EXISTS_NO_FOLLOW));
 #else // no lstat()
-    const bool hasStat = wxStat( m_filePath, &buff ) == 0;
+    SetFromStat(wxFileStat(m_filePath));
 #endif
+}
+
+void wxFileData::SetFromStat(const wxFileStat& stat)
+{
+    const int perms = stat.IsOk() ? stat.GetPermissions() : 0;
 
-    if ( hasStat )
+    if ( stat.IsOk() )
     {
-        m_type |= (buff.st_mode & S_IFDIR) != 0 ? is_dir : 0;
-        m_type |= (buff.st_mode & wxS_IXUSR) != 0 ? is_exe : 0;
+        m_type |= stat.IsSymLink() ? is_link : 0;
+        m_type |= stat.IsDir() ? is_dir : 0;
+        m_type |= (perms & wxS_IXUSR) != 0 ? is_exe : 0;
 
-        m_size = buff.st_size;
+        m_size = static_cast<wxFileOffset>(stat.GetSize().GetValue());
 
-        m_dateTime = buff.st_mtime;
+        m_dateTime = stat.GetModificationTime();
     }
 
 #if defined(__UNIX__)
-    if ( hasStat )
+    if ( stat.IsOk() )
     {
         m_permissions.Printf(wxT("%c%c%c%c%c%c%c%c%c"),
-                             buff.st_mode & wxS_IRUSR ? wxT('r') : wxT('-'),
-                             buff.st_mode & wxS_IWUSR ? wxT('w') : wxT('-'),
-                             buff.st_mode & wxS_IXUSR ? wxT('x') : wxT('-'),
-                             buff.st_mode & wxS_IRGRP ? wxT('r') : wxT('-'),
-                             buff.st_mode & wxS_IWGRP ? wxT('w') : wxT('-'),
-                             buff.st_mode & wxS_IXGRP ? wxT('x') : wxT('-'),
-                             buff.st_mode & wxS_IROTH ? wxT('r') : wxT('-'),
-                             buff.st_mode & wxS_IWOTH ? wxT('w') : wxT('-'),
-                             buff.st_mode & wxS_IXOTH ? wxT('x') : wxT('-'));
+                             perms & wxS_IRUSR ? wxT('r') : wxT('-'),
+                             perms & wxS_IWUSR ? wxT('w') : wxT('-'),
+                             perms & wxS_IXUSR ? wxT('x') : wxT('-'),
+                             perms & wxS_IRGRP ? wxT('r') : wxT('-'),
+                             perms & wxS_IWGRP ? wxT('w') : wxT('-'),
+                             perms & wxS_IXGRP ? wxT('x') : wxT('-'),
+                             perms & wxS_IROTH ? wxT('r') : wxT('-'),
+                             perms & wxS_IWOTH ? wxT('w') : wxT('-'),
+                             perms & wxS_IXOTH ? wxT('x') : wxT('-'));
     }
 #elif defined(__WIN32__)
     DWORD attribs = ::GetFileAttributes(m_filePath.c_str());
@@ -369,6 +392,8 @@ wxFileListCtrl::wxFileListCtrl()
     m_showHidden = false;
     m_sort_forward = true;
     m_sort_field = wxFileData::FileList_Name;
+
+    Init();
 }
 
 wxFileListCtrl::wxFileListCtrl(wxWindow *win,
@@ -394,10 +419,27 @@ wxFileListCtrl::wxFileListCtrl(wxWindow *win,
 
     m_dirName = wxT("*");
 
+    Init();
+
     if (style & wxLC_REPORT)
         ChangeToReportMode();
 }
 
+void wxFileListCtrl::Init()
+{
+    m_backgroundUpdate = false;
+    m_hasSelectAfterUpdate = false;
+}
+
+void wxFileListCtrl::EnableBackgroundUpdate(bool enable)
+{
+#if wxUSE_THREADS
+    m_backgroundUpdate = enable;
+#else
+    wxUnusedVar(enable);
+#endif
+}
+
 void wxFileListCtrl::ChangeToListMode()
 {
     ClearAll();
@@ -487,6 +529,12 @@ void wxFileListCtrl::UpdateFiles()
     if ( m_dirName == wxT("*") )
         return;
 
+#if wxUSE_THREADS
+    // Any previous update is obsolete now.
+    m_lister.reset();
+#endif
+    m_hasSelectAfterUpdate = false;
+
     wxBusyCursor bcur; // this may take a while...
 
     DeleteAllItems();
@@ -549,6 +597,69 @@ void wxFileListCtrl::UpdateFiles()
         if (dirname.empty())
             dirname = wxFILE_SEP_PATH;
 
+#if wxUSE_THREADS
+        if ( m_backgroundUpdate )
+        {
+            wxString dirPrefix(dirname);
+            if (dirPrefix.Last() != wxFILE_SEP_PATH)
+                dirPrefix += wxFILE_SEP_PATH;
+
+            const int hiddenFlag = m_showHidden ? wxDIR_HIDDEN : 0;
+
+            wxAsyncDirLister::Params params;
+            params.dirname = dirname;
+            params.dirFlags = wxDIR_DIRS | hiddenFlag;
+            if ( !m_wild.empty() )
+            {
+                params.fileFlags = wxDIR_FILES | hiddenFlag;
+                params.fileSpecs = wxSplit(m_wild, wxT(';'), wxT('\0'));
+            }
+            params.wantStat = true;
+
+            // The items are sorted only once all of them are added, so that
+            // the user can start scrolling through them immediately.
+            m_lister.reset(new wxAsyncDirLister
+            (
+                this,
+                params,
+                [this, dirPrefix](const wxAsyncDirLister::Entries& entries)
+                {
+                    Freeze();
+
+                    wxListItem item;
+                    item.m_col = 0;
+                    for ( const auto& entry : entries )
+                    {
+                        wxFileData* const fd = new wxFileData
+                            (
+                                dirPrefix + entry.name,
+                                entry.name,
+                                entry.isDir ? wxFileData::is_dir
+                                            : wxFileData::is_file,
+                                entry.isDir ? wxFileIconsTable::folder
+                                            : wxFileIconsTable::file,
+                                entry.stat
+                            );
+
+                        item.m_itemId = GetItemCount();
+                        if (Add(fd, item) == -1)
+                            delete fd;
+                    }
+
+                    Thaw();
+                },
+                [this]()
+                {
+                    SortItems(m_sort_field, m_sort_forward);
+                    DoSelectAfterUpdate();
+
+                    m_lister.reset();
+                }
+            ));
+            return;
+        }
+#endif // wxUSE_THREADS
+
         wxLogNull logNull;
         wxDir dir(dirname);
 
@@ -564,16 +675,17 @@ void wxFileListCtrl::UpdateFiles()
             wxString f;
 
             // Get the directories first (not matched against wildcards):
-            cont = dir.GetFirst(&f, wxEmptyString, wxDIR_DIRS | hiddenFlag);
+            wxFileStat stat;
+            cont = dir.GetFirst(&f, &stat, wxEmptyString, wxDIR_DIRS | hiddenFlag);
             while (cont)
             {
-                wxFileData *fd = new wxFileData(dirPrefix + f, f, wxFileData::is_dir, wxFileIconsTable::folder);
+                wxFileData *fd = new wxFileData(dirPrefix + f, f, wxFileData::is_dir, wxFileIconsTable::folder, stat);
                 if (Add(fd, item) != -1)
                     item.m_itemId++;
                 else
                     delete fd;
 
-                cont = dir.GetNext(&f);
+                cont = dir.GetNext(&f, &stat);
             }
 
             // Tokenize the wildcard string, so we can handle more than 1
@@ -581,17 +693,17 @@ void wxFileListCtrl::UpdateFiles()
             wxStringTokenizer tokenWild(m_wild, wxT(";"));
             while ( tokenWild.HasMoreTokens() )
             {
-                cont = dir.GetFirst(&f, tokenWild.GetNextToken(),
+                cont = dir.GetFirst(&f, &stat, tokenWild.GetNextToken(),
                                         wxDIR_FILES | hiddenFlag);
                 while (cont)
                 {
-                    wxFileData *fd = new wxFileData(dirPrefix + f, f, wxFileData::is_file, wxFileIconsTable::file);
+                    wxFileData *fd = new wxFileData(dirPrefix + f, f, wxFileData::is_file, wxFileIconsTable::file, stat);
                     if (Add(fd, item) != -1)
                         item.m_itemId++;
                     else
                         delete fd;
 
-                    cont = dir.GetNext(&f);
+                    cont = dir.GetNext(&f, &stat);
                 }
             }
         }
@@ -677,12 +789,7 @@ void wxFileListCtrl::GoToParentDir()
             m_dirName = wxT("/");
 #endif
         UpdateFiles();
-        long id = FindItem( 0, fname );
-        if (id != wxNOT_FOUND)
-        {
-            SetItemState( id, wxLIST_STATE_SELECTED, wxLIST_STATE_SELECTED );
-            EnsureVisible( id );
-        }
+        SelectAfterUpdate(fname);
     }
 }
 
@@ -698,10 +805,39 @@ void wxFileListCtrl::GoToDir( const wxString &dir )
 
     m_dirName = dir;
     UpdateFiles();
+    SelectAfterUpdate(wxString());
+}
 
-    SetItemState( 0, wxLIST_STATE_SELECTED, wxLIST_STATE_SELECTED );
+void wxFileListCtrl::SelectAfterUpdate(const wxString& name)
+{
+    m_selectAfterUpdate = name;
+    m_hasSelectAfterUpdate = true;
+
+#if wxUSE_THREADS
+    if ( m_lister )
+        return;
+#endif
+
+    DoSelectAfterUpdate();
+}
+
+void wxFileListCtrl::DoSelectAfterUpdate()
+{
+    if ( !m_hasSelectAfterUpdate )
+        return;
+
+    m_hasSelectAfterUpdate = false;
+
+    long id = 0;
+    if ( !m_selectAfterUpdate.empty() )
+    {
+        id = FindItem( 0, m_selectAfterUpdate );
+        if (id == wxNOT_FOUND)
+            return;
+    }
 
-    EnsureVisible( 0 );
+    SetItemState( id, wxLIST_STATE_SELECTED, wxLIST_STATE_SELECTED );
+    EnsureVisible( id );
 }
 
 void wxFileListCtrl::FreeItemData(wxListItem& item)
@@ -854,6 +990,10 @@ void wxFileListCtrl::SortItems(wxFileData::fileListFieldType field, bool forward
 
 wxFileListCtrl::~wxFileListCtrl()
 {
+#if wxUSE_THREADS
+    m_lister.reset();
+#endif
+
     // Normally the data are freed via an EVT_LIST_DELETE_ALL_ITEMS event and
     // wxFileListCtrl::OnListDeleteAllItems. But if the event is generated after
     // the destruction of the wxFileListCtrl we need to free any data here:
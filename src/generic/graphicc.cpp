@@ -87,7 +87,7 @@ using namespace std;
 #ifndef __WXGTK3__
 #include "wx/gtk/dc.h"
 #endif
-#include "wx/gtk/private/object.h"
+#include "wx/gtk/private/layoutcache.h"
 #endif
 
 #ifdef __WXQT__
@@ -183,8 +183,17 @@ public :
 
     virtual bool Contains( wxDouble x, wxDouble y, wxPolygonFillMode fillStyle = wxWINDING_RULE) const override;
 
+    // keeps a copy of the path to avoid copying it every time it's drawn
+    virtual void Compile() override;
+
 private :
+    // must be called whenever the path changes
+    void DiscardCompiledPath();
+
     cairo_t* m_pathContext;
+
+    // the copy of the path made by Compile(), if any
+    cairo_path_t* m_compiledPath = nullptr;
 };
 
 class WXDLLIMPEXP_CORE wxCairoMatrixData : public wxGraphicsMatrixData
@@ -483,6 +492,14 @@ public:
     virtual void ClearRectangle( wxDouble x, wxDouble y, wxDouble w, wxDouble h ) override;
     virtual void DrawRectangle( wxDouble x, wxDouble y, wxDouble w, wxDouble h) override;
 
+    virtual void DrawRectangles( size_t n, const wxRect2DDouble *rects) override;
+    virtual void DrawEllipses( size_t n, const wxRect2DDouble *rects) override;
+    virtual void DrawMarkers( size_t n, const wxPoint2DDouble *centres,
+                              wxDouble size,
+                              wxMarkerShape shape = wxMARKER_SQUARE,
+                              const wxColour *colours = nullptr) override;
+    virtual void StrokeLineSegments( size_t n, const wxPoint2DDouble *points) override;
+
     virtual void Translate( wxDouble dx , wxDouble dy ) override;
     virtual void Scale( wxDouble xScale , wxDouble yScale ) override;
     virtual void Rotate( wxDouble angle ) override;
@@ -558,23 +575,66 @@ protected:
     // consistency with the text drawn by GTK itself.
     float m_fontScalingFactor;
 
-    // Function applying the Pango font description for the given font scaled by
-    // the font scaling factor if necessary to the specified layout.
-    void ApplyFont(PangoLayout* layout, const wxFont& font) const
+    // Return the given font scaled by the font scaling factor if necessary.
+    wxFont GetScaledFont(const wxFont& font) const
     {
         // Only scale the font if we really need to do it.
-        DoApplyFont(layout, m_fontScalingFactor == 1.0f
-                                ? font
-                                : font.Scaled(m_fontScalingFactor));
+        return m_fontScalingFactor == 1.0f ? font
+                                           : font.Scaled(m_fontScalingFactor);
     }
 #else // GTK < 3
     // Provide the same function even if it does nothing in this case to keep
     // the same code for all GTK versions.
-    void ApplyFont(PangoLayout* layout, const wxFont& font) const
+    const wxFont& GetScaledFont(const wxFont& font) const
     {
-        DoApplyFont(layout, font);
+        return font;
     }
 #endif // __WXGTK3__
+
+    // Layout of the given UTF-8 text using the given font, taken from
+    // wxPangoLayoutCache, if possible, or created for this context otherwise.
+    class TextLayout
+    {
+    public:
+        TextLayout(const wxCairoContext& gc,
+                   const wxFont& font,
+                   const char* text, size_t len)
+        {
+            const wxFont& scaledFont = gc.GetScaledFont(font);
+
+            if ( wxPangoLayoutCache* const cache = wxPangoLayoutCache::Get() )
+            {
+                m_layout = cache->GetForCairo(gc.m_context, scaledFont, text, len);
+                m_owned = false;
+            }
+            else
+            {
+                m_layout = pango_cairo_create_layout(gc.m_context);
+                m_owned = true;
+
+                DoApplyFont(m_layout, scaledFont);
+                pango_layout_set_text(m_layout, text, len);
+
+                // Note that Pango attributes don't depend on font size, so
+                // it doesn't matter whether we use the scaled font here.
+                font.GTKSetPangoAttrs(m_layout);
+            }
+        }
+
+        ~TextLayout()
+        {
+            if ( m_owned )
+                g_object_unref(m_layout);
+        }
+
+        operator PangoLayout*() const { return m_layout; }
+
+    private:
+        PangoLayout* m_layout;
+        bool m_owned;
+
+        wxDECLARE_NO_COPY_CLASS(TextLayout);
+    };
 #endif // __WXGTK__
 
 #ifdef __WXMAC__
@@ -1266,6 +1326,7 @@ wxCairoPathData::wxCairoPathData( wxGraphicsRenderer* renderer, cairo_t* pathcon
 
 wxCairoPathData::~wxCairoPathData()
 {
+    DiscardCompiledPath();
     cairo_destroy(m_pathContext);
 }
 
@@ -1275,21 +1336,40 @@ wxGraphicsObjectRefData *wxCairoPathData::Clone() const
     cairo_t* pathcontext = cairo_create(surface);
     cairo_surface_destroy (surface);
 
-    cairo_path_t* path = cairo_copy_path(m_pathContext);
+    cairo_path_t* path = (cairo_path_t*)GetNativePath();
     cairo_append_path(pathcontext, path);
-    cairo_path_destroy(path);
+    UnGetNativePath(path);
     return new wxCairoPathData( GetRenderer() ,pathcontext);
 }
 
 
 void* wxCairoPathData::GetNativePath() const
 {
+    if ( m_compiledPath )
+        return m_compiledPath;
+
     return cairo_copy_path(m_pathContext) ;
 }
 
 void wxCairoPathData::UnGetNativePath(void *p) const
 {
-    cairo_path_destroy((cairo_path_t*)p);
+    if ( p != m_compiledPath )
+        cairo_path_destroy((cairo_path_t*)p);
+}
+
+void wxCairoPathData::Compile()
+{
+    if ( !m_compiledPath )
+        m_compiledPath = cairo_copy_path(m_pathContext);
+}
+
+void wxCairoPathData::DiscardCompiledPath()
+{
+    if ( m_compiledPath )
+    {
+        cairo_path_destroy(m_compiledPath);
+        m_compiledPath = nullptr;
+    }
 }
 
 //
@@ -1298,16 +1378,22 @@ void wxCairoPathData::UnGetNativePath(void *p) const
 
 void wxCairoPathData::MoveToPoint( wxDouble x , wxDouble y )
 {
+    DiscardCompiledPath();
+
     cairo_move_to(m_pathContext,x,y);
 }
 
 void wxCairoPathData::AddLineToPoint( wxDouble x , wxDouble y )
 {
+    DiscardCompiledPath();
+
     cairo_line_to(m_pathContext,x,y);
 }
 
 void wxCairoPathData::AddPath( const wxGraphicsPathData* path )
 {
+    DiscardCompiledPath();
+
     cairo_path_t* p = (cairo_path_t*)path->GetNativePath();
     cairo_append_path(m_pathContext, p);
     UnGetNativePath(p);
@@ -1315,11 +1401,15 @@ void wxCairoPathData::AddPath( const wxGraphicsPathData* path )
 
 void wxCairoPathData::CloseSubpath()
 {
+    DiscardCompiledPath();
+
     cairo_close_path(m_pathContext);
 }
 
 void wxCairoPathData::AddCurveToPoint( wxDouble cx1, wxDouble cy1, wxDouble cx2, wxDouble cy2, wxDouble x, wxDouble y )
 {
+    DiscardCompiledPath();
+
     cairo_curve_to(m_pathContext,cx1,cy1,cx2,cy2,x,y);
 }
 
@@ -1336,6 +1426,8 @@ void wxCairoPathData::GetCurrentPoint( wxDouble* x, wxDouble* y) const
 
 void wxCairoPathData::AddArc( wxDouble x, wxDouble y, wxDouble r, double startAngle, double endAngle, bool clockwise )
 {
+    DiscardCompiledPath();
+
     // as clockwise means positive in our system (y pointing downwards)
     // TODO make this interpretation dependent of the
     // real device trans
@@ -1348,6 +1440,8 @@ void wxCairoPathData::AddArc( wxDouble x, wxDouble y, wxDouble r, double startAn
 // transforms each point of this path by the matrix
 void wxCairoPathData::Transform( const wxGraphicsMatrixData* matrix )
 {
+    DiscardCompiledPath();
+
     // as we don't have a true path object, we have to apply the inverse
     // matrix to the context
     cairo_matrix_t m = *((cairo_matrix_t*) matrix->GetNativeMatrix());
@@ -1404,30 +1498,42 @@ bool wxCairoPathData::Contains( wxDouble x, wxDouble y, wxPolygonFillMode fillSt
 
 void wxCairoPathData::AddRectangle(wxDouble x, wxDouble y, wxDouble w, wxDouble h)
 {
+    DiscardCompiledPath();
+
     cairo_rectangle(m_pathContext, x, y, w, h);
 }
 
 void wxCairoPathData::AddCircle(wxDouble x, wxDouble y, wxDouble r)
 {
+    DiscardCompiledPath();
+
     cairo_move_to(m_pathContext, x+r, y);
     cairo_arc(m_pathContext, x, y, r, 0.0, 2*M_PI);
     cairo_close_path(m_pathContext);
 }
 
-void wxCairoPathData::AddEllipse(wxDouble x, wxDouble y, wxDouble w, wxDouble h)
+// Add the ellipse to the current path of the given context.
+static void wxCairoAddEllipse(cairo_t* cr, wxDouble x, wxDouble y, wxDouble w, wxDouble h)
 {
     if (w <= 0 || h <= 0)
         return;
 
-    cairo_move_to(m_pathContext, x+w, y+h/2.0);
+    cairo_move_to(cr, x+w, y+h/2.0);
     w /= 2.0;
     h /= 2.0;
-    cairo_save(m_pathContext);
-    cairo_translate(m_pathContext, x+w, y+h);
-    cairo_scale(m_pathContext, w, h);
-    cairo_arc(m_pathContext, 0.0, 0.0, 1.0, 0.0, 2*M_PI);
-    cairo_restore(m_pathContext);
-    cairo_close_path(m_pathContext);
+    cairo_save(cr);
+    cairo_translate(cr, x+w, y+h);
+    cairo_scale(cr, w, h);
+    cairo_arc(cr, 0.0, 0.0, 1.0, 0.0, 2*M_PI);
+    cairo_restore(cr);
+    cairo_close_path(cr);
+}
+
+void wxCairoPathData::AddEllipse(wxDouble x, wxDouble y, wxDouble w, wxDouble h)
+{
+    DiscardCompiledPath();
+
+    wxCairoAddEllipse(m_pathContext, x, y, w, h);
 }
 
 //-----------------------------------------------------------------------------
@@ -2807,6 +2913,130 @@ void wxCairoContext::DrawRectangle( wxDouble x, wxDouble y, wxDouble w, wxDouble
     }
 }
 
+void wxCairoContext::DrawRectangles( size_t n, const wxRect2DDouble *rects )
+{
+    // Add all rectangles to a single path, which is then filled and stroked
+    // only once, with the winding rule to fill the overlapping ones entirely.
+    if ( !m_brush.IsNull() )
+    {
+        ((wxCairoBrushData*)m_brush.GetRefData())->Apply(this);
+        for ( size_t i = 0; i < n; ++i )
+            cairo_rectangle(m_context, rects[i].m_x, rects[i].m_y,
+                            rects[i].m_width, rects[i].m_height);
+        cairo_set_fill_rule(m_context, CAIRO_FILL_RULE_WINDING);
+        cairo_fill(m_context);
+    }
+    if ( !m_pen.IsNull() )
+    {
+        OffsetHelper helper(ShouldOffset(), m_context, m_pen);
+        ((wxCairoPenData*)m_pen.GetRefData())->Apply(this);
+        for ( size_t i = 0; i < n; ++i )
+            cairo_rectangle(m_context, rects[i].m_x, rects[i].m_y,
+                            rects[i].m_width, rects[i].m_height);
+        cairo_stroke(m_context);
+    }
+}
+
+void wxCairoContext::DrawEllipses( size_t n, const wxRect2DDouble *rects )
+{
+    if ( !m_brush.IsNull() )
+    {
+        ((wxCairoBrushData*)m_brush.GetRefData())->Apply(this);
+        for ( size_t i = 0; i < n; ++i )
+            wxCairoAddEllipse(m_context, rects[i].m_x, rects[i].m_y,
+                              rects[i].m_width, rects[i].m_height);
+        cairo_set_fill_rule(m_context, CAIRO_FILL_RULE_WINDING);
+        cairo_fill(m_context);
+    }
+    if ( !m_pen.IsNull() )
+    {
+        OffsetHelper helper(ShouldOffset(), m_context, m_pen);
+        ((wxCairoPenData*)m_pen.GetRefData())->Apply(this);
+        for ( size_t i = 0; i < n; ++i )
+            wxCairoAddEllipse(m_context, rects[i].m_x, rects[i].m_y,
+                              rects[i].m_width, rects[i].m_height);
+        cairo_stroke(m_context);
+    }
+}
+
+// Add the marker to the current path of the given context.
+static void wxCairoAddMarker(cairo_t* cr,
+                             const wxPoint2DDouble& centre,
+                             wxDouble size,
+                             wxMarkerShape shape)
+{
+    switch ( shape )
+    {
+        case wxMARKER_SQUARE:
+            cairo_rectangle(cr, centre.m_x - size/2, centre.m_y - size/2,
+                            size, size);
+            break;
+
+        case wxMARKER_CIRCLE:
+            cairo_new_sub_path(cr);
+            cairo_arc(cr, centre.m_x, centre.m_y, size/2, 0.0, 2*M_PI);
+            cairo_close_path(cr);
+            break;
+    }
+}
+
+void wxCairoContext::DrawMarkers( size_t n, const wxPoint2DDouble *centres,
+                                  wxDouble size,
+                                  wxMarkerShape shape,
+                                  const wxColour *colours )
+{
+    if ( colours )
+    {
+        // Fill the consecutive markers of the same colour, which is typically
+        // the case for markers of the same data series, at once.
+        cairo_set_fill_rule(m_context, CAIRO_FILL_RULE_WINDING);
+        for ( size_t i = 0; i < n; )
+        {
+            const wxColour& col = colours[i];
+            cairo_set_source_rgba(m_context,
+                                  col.Red()/255.0, col.Green()/255.0,
+                                  col.Blue()/255.0, col.Alpha()/255.0);
+
+            for ( ; i < n && colours[i] == col; ++i )
+                wxCairoAddMarker(m_context, centres[i], size, shape);
+
+            cairo_fill(m_context);
+        }
+    }
+    else if ( !m_brush.IsNull() )
+    {
+        ((wxCairoBrushData*)m_brush.GetRefData())->Apply(this);
+        for ( size_t i = 0; i < n; ++i )
+            wxCairoAddMarker(m_context, centres[i], size, shape);
+        cairo_set_fill_rule(m_context, CAIRO_FILL_RULE_WINDING);
+        cairo_fill(m_context);
+    }
+
+    if ( !m_pen.IsNull() )
+    {
+        OffsetHelper helper(ShouldOffset(), m_context, m_pen);
+        ((wxCairoPenData*)m_pen.GetRefData())->Apply(this);
+        for ( size_t i = 0; i < n; ++i )
+            wxCairoAddMarker(m_context, centres[i], size, shape);
+        cairo_stroke(m_context);
+    }
+}
+
+void wxCairoContext::StrokeLineSegments( size_t n, const wxPoint2DDouble *points )
+{
+    if ( !m_pen.IsNull() )
+    {
+        OffsetHelper helper(ShouldOffset(), m_context, m_pen);
+        ((wxCairoPenData*)m_pen.GetRefData())->Apply(this);
+        for ( size_t i = 0; i < n; ++i, points += 2 )
+        {
+            cairo_move_to(m_context, points[0].m_x, points[0].m_y);
+            cairo_line_to(m_context, points[1].m_x, points[1].m_y);
+        }
+        cairo_stroke(m_context);
+    }
+}
+
 void wxCairoContext::Rotate( wxDouble angle )
 {
     cairo_rotate(m_context,angle);
@@ -2955,13 +3185,7 @@ void wxCairoContext::DoDrawText(const wxString& str, wxDouble x, wxDouble y)
     const wxFont& font = fontData->GetFont();
     if ( font.IsOk() )
     {
-        wxGtkObject<PangoLayout> layout(pango_cairo_create_layout (m_context));
-        ApplyFont(layout, font);
-        pango_layout_set_text(layout, data, data.length());
-
-        // Note that Pango attributes don't depend on font size, so we don't
-        // need to use the scaled font here.
-        font.GTKSetPangoAttrs(layout);
+        const TextLayout layout(*this, font, data, data.length());
 
         cairo_move_to(m_context, x, y);
         pango_cairo_show_layout (m_context, layout);
@@ -3013,14 +3237,12 @@ void wxCairoContext::GetTextExtent( const wxString &str, wxDouble *width, wxDoub
         // measuring its extent.
         int w, h;
 
-        wxGtkObject<PangoLayout> layout(pango_cairo_create_layout (m_context));
-        ApplyFont(layout, font);
         const wxCharBuffer data = str.utf8_str();
         if ( !data )
         {
             return;
         }
-        pango_layout_set_text(layout, data, data.length());
+        const TextLayout layout(*this, font, data, data.length());
         pango_layout_get_pixel_size (layout, &w, &h);
         if ( width )
             *width = w;
@@ -3081,11 +3303,9 @@ void wxCairoContext::GetPartialTextExtents(const wxString& text, wxArrayDouble&
     int w = 0;
     if (data.length())
     {
-        wxGtkObject<PangoLayout> layout(pango_cairo_create_layout(m_context));
         const wxFont& font = static_cast<wxCairoFontData*>(m_font.GetRefData())->GetFont();
 
-        ApplyFont(layout, font);
-        pango_layout_set_text(layout, data, data.length());
+        const TextLayout layout(*this, font, data, data.length());
         PangoLayoutIter* iter = pango_layout_get_iter(layout);
         PangoRectangle rect;
         do {
@@ -46,9 +46,11 @@
 #include "wx/renderer.h"
 #include "wx/headerctrl.h"
 #include "wx/scopeguard.h"
+#include "wx/weakref.h"
 
 #if wxUSE_CLIPBOARD
     #include "wx/clipbrd.h"
+    #include "wx/dataobj.h"
 #endif // wxUSE_CLIPBOARD
 
 #include "wx/generic/gridsel.h"
@@ -61,6 +63,8 @@ const char wxGridNameStr[] = "grid";
 // Required for wxIs... functions
 #include <ctype.h>
 
+#include <algorithm>
+
 // ----------------------------------------------------------------------------
 // globals
 // ----------------------------------------------------------------------------
@@ -1149,10 +1153,11 @@ wxGridCellAttrData::FindIndex(int row, int col) const
 
 wxGridRowOrColAttrData::~wxGridRowOrColAttrData()
 {
-    size_t count = m_attrs.GetCount();
-    for ( size_t n = 0; n < count; n++ )
+    for ( wxGridRowOrColToAttrMap::iterator it = m_attrs.begin();
+          it != m_attrs.end();
+          ++it )
     {
-        m_attrs[n]->DecRef();
+        it->second->DecRef();
     }
 }
 
@@ -1160,10 +1165,10 @@ wxGridCellAttr *wxGridRowOrColAttrData::GetAttr(int rowOrCol) const
 {
     wxGridCellAttr *attr = nullptr;
 
-    int n = m_rowsOrCols.Index(rowOrCol);
-    if ( n != wxNOT_FOUND )
+    wxGridRowOrColToAttrMap::const_iterator it = m_attrs.find(rowOrCol);
+    if ( it != m_attrs.end() )
     {
-        attr = m_attrs[(size_t)n];
+        attr = it->second;
         attr->IncRef();
     }
 
@@ -1172,47 +1177,50 @@ wxGridCellAttr *wxGridRowOrColAttrData::GetAttr(int rowOrCol) const
 
 void wxGridRowOrColAttrData::SetAttr(wxGridCellAttr *attr, int rowOrCol)
 {
-    int i = m_rowsOrCols.Index(rowOrCol);
-    if ( i == wxNOT_FOUND )
+    wxGridRowOrColToAttrMap::iterator it = m_attrs.find(rowOrCol);
+    if ( it == m_attrs.end() )
     {
         if ( attr )
         {
             // store the new attribute, taking its ownership
-            m_rowsOrCols.Add(rowOrCol);
-            m_attrs.Add(attr);
+            m_attrs[rowOrCol] = attr;
         }
         // nothing to remove
     }
     else // we have an attribute for this row or column
     {
-        size_t n = (size_t)i;
-
         // notice that this code works correctly even when the old attribute is
         // the same as the new one: as we own of it, we must call DecRef() on
         // it in any case and this won't result in destruction of the new
         // attribute if it's the same as old one because it must have ref count
         // of at least 2 to be passed to us while we keep a reference to it too
-        m_attrs[n]->DecRef();
+        it->second->DecRef();
 
         if ( attr )
         {
             // replace the attribute with the new one
-            m_attrs[n] = attr;
+            it->second = attr;
         }
         else // remove the attribute
         {
-            m_rowsOrCols.RemoveAt(n);
-            m_attrs.RemoveAt(n);
+            m_attrs.erase(it);
         }
     }
 }
 
 void wxGridRowOrColAttrData::UpdateAttrRowsOrCols( size_t pos, int numRowsOrCols )
 {
-    size_t count = m_attrs.GetCount();
-    for ( size_t n = 0; n < count; n++ )
+    if ( !numRowsOrCols || m_attrs.empty() )
+        return;
+
+    // As the keys of the map change, rebuild it in one go instead of trying
+    // to update it in place.
+    wxGridRowOrColToAttrMap newAttrs;
+    for ( wxGridRowOrColToAttrMap::iterator it = m_attrs.begin();
+          it != m_attrs.end();
+          ++it )
     {
-        int & rowOrCol = m_rowsOrCols[n];
+        int rowOrCol = it->first;
         if ( (size_t)rowOrCol >= pos )
         {
             if ( numRowsOrCols > 0 )
@@ -1220,22 +1228,171 @@ void wxGridRowOrColAttrData::UpdateAttrRowsOrCols( size_t pos, int numRowsOrCols
                 // If rows or cols inserted, increment row/col counter where necessary
                 rowOrCol += numRowsOrCols;
             }
-            else if ( numRowsOrCols < 0)
+            else // numRowsOrCols < 0
             {
-                // If rows/cols deleted, either decrement row/col counter (if row/col still exists)
-                if ((size_t)rowOrCol >= pos - numRowsOrCols)
+                // If rows/cols deleted, either decrement row/col counter (if
+                // row/col still exists) or remove the attribute entirely.
+                if ( (size_t)rowOrCol >= pos - numRowsOrCols )
+                {
                     rowOrCol += numRowsOrCols;
+                }
                 else
                 {
-                    m_rowsOrCols.RemoveAt(n);
-                    m_attrs[n]->DecRef();
-                    m_attrs.RemoveAt(n);
-                    n--;
-                    count--;
+                    it->second->DecRef();
+                    continue;
                 }
             }
         }
+
+        newAttrs[rowOrCol] = it->second;
+    }
+
+    m_attrs.swap(newAttrs);
+}
+
+// ----------------------------------------------------------------------------
+// wxGridBlockAttrData
+// ----------------------------------------------------------------------------
+
+namespace
+{
+
+// Update the range of rows or columns from first to last, inclusive, after
+// inserting (if count > 0) or deleting (if count < 0) the given number of them
+// at the given position. Returns false if the range became empty.
+bool UpdateBlockRange(int& first, int& last, int pos, int count)
+{
+    if ( count > 0 )
+    {
+        // Note that inserting inside the range extends it.
+        if ( first >= pos )
+            first += count;
+        if ( last >= pos )
+            last += count;
+    }
+    else if ( count < 0 )
+    {
+        const int end = pos - count;
+
+        if ( first >= end )
+            first += count;
+        else if ( first >= pos )
+            first = pos;
+
+        if ( last >= end )
+            last += count;
+        else if ( last >= pos )
+            last = pos - 1;
+    }
+
+    return first <= last;
+}
+
+} // anonymous namespace
+
+wxGridBlockAttrData::~wxGridBlockAttrData()
+{
+    for ( const BlockAttr& ba : m_blocks )
+        ba.attr->DecRef();
+}
+
+void
+wxGridBlockAttrData::SetAttr(wxGridCellAttr *attr,
+                             const wxGridBlockCoords& block)
+{
+    std::vector<BlockAttr> blocks;
+    blocks.reserve(m_blocks.size() + 1);
+
+    for ( const BlockAttr& ba : m_blocks )
+    {
+        if ( !ba.block.Intersects(block) )
+        {
+            blocks.push_back(ba);
+            continue;
+        }
+
+        // Keep only the parts of the existing block outside of the new one,
+        // each of them needs its own reference to the attribute.
+        const wxGridBlockDiffResult diff = ba.block.Difference(block, wxHORIZONTAL);
+        for ( const wxGridBlockCoords& part : diff.m_parts )
+        {
+            if ( part == wxGridNoBlockCoords )
+                continue;
+
+            ba.attr->IncRef();
+            blocks.push_back({part, ba.attr});
+        }
+
+        ba.attr->DecRef();
+    }
+
+    if ( attr )
+        blocks.push_back({block, attr});
+
+    m_blocks.swap(blocks);
+}
+
+wxGridCellAttr *wxGridBlockAttrData::GetAttr(int row, int col) const
+{
+    const wxGridCellCoords coords(row, col);
+    for ( const BlockAttr& ba : m_blocks )
+    {
+        if ( ba.block.Contains(coords) )
+        {
+            ba.attr->IncRef();
+            return ba.attr;
+        }
+    }
+
+    return nullptr;
+}
+
+void wxGridBlockAttrData::UpdateAttrRows( size_t pos, int numRows )
+{
+    std::vector<BlockAttr> blocks;
+    blocks.reserve(m_blocks.size());
+
+    for ( BlockAttr ba : m_blocks )
+    {
+        int top = ba.block.GetTopRow(),
+            bottom = ba.block.GetBottomRow();
+        if ( !UpdateBlockRange(top, bottom, static_cast<int>(pos), numRows) )
+        {
+            // All the rows of this block were deleted.
+            ba.attr->DecRef();
+            continue;
+        }
+
+        ba.block.SetTopRow(top);
+        ba.block.SetBottomRow(bottom);
+        blocks.push_back(ba);
+    }
+
+    m_blocks.swap(blocks);
+}
+
+void wxGridBlockAttrData::UpdateAttrCols( size_t pos, int numCols )
+{
+    std::vector<BlockAttr> blocks;
+    blocks.reserve(m_blocks.size());
+
+    for ( BlockAttr ba : m_blocks )
+    {
+        int left = ba.block.GetLeftCol(),
+            right = ba.block.GetRightCol();
+        if ( !UpdateBlockRange(left, right, static_cast<int>(pos), numCols) )
+        {
+            // All the columns of this block were deleted.
+            ba.attr->DecRef();
+            continue;
+        }
+
+        ba.block.SetLeftCol(left);
+        ba.block.SetRightCol(right);
+        blocks.push_back(ba);
     }
+
+    m_blocks.swap(blocks);
 }
 
 // ----------------------------------------------------------------------------
@@ -1273,7 +1430,7 @@ wxGridCellAttr *wxGridCellAttrProvider::GetAttr(int row, int col,
                 {
                     // Basically implement old version.
                     // Also check merge cache, so we don't have to re-merge every time..
-                    wxGridCellAttr *attrcell = m_data->m_cellAttrs.GetAttr(row, col);
+                    wxGridCellAttr *attrcell = m_data->GetCellAttr(row, col);
                     wxGridCellAttr *attrrow = m_data->m_rowAttrs.GetAttr(row);
                     wxGridCellAttr *attrcol = m_data->m_colAttrs.GetAttr(col);
 
@@ -1326,7 +1483,7 @@ wxGridCellAttr *wxGridCellAttrProvider::GetAttr(int row, int col,
                 break;
 
             case (wxGridCellAttr::Cell):
-                attr = m_data->m_cellAttrs.GetAttr(row, col);
+                attr = m_data->GetCellAttr(row, col);
                 break;
 
             case (wxGridCellAttr::Col):
@@ -1373,11 +1530,31 @@ void wxGridCellAttrProvider::SetColAttr(wxGridCellAttr *attr, int col)
     m_data->m_colAttrs.SetAttr(attr, col);
 }
 
+void wxGridCellAttrProvider::SetAttrRange(wxGridCellAttr *attr,
+                                          const wxGridBlockCoords& block)
+{
+    const wxGridBlockCoords b = block.Canonicalize();
+    if ( b.GetTopRow() < 0 || b.GetLeftCol() < 0 )
+    {
+        wxFAIL_MSG( wxS("invalid block") );
+
+        if ( attr )
+            attr->DecRef();
+        return;
+    }
+
+    if ( !m_data )
+        InitData();
+
+    m_data->m_blockAttrs.SetAttr(attr, b);
+}
+
 void wxGridCellAttrProvider::UpdateAttrRows( size_t pos, int numRows )
 {
     if ( m_data )
     {
         m_data->m_cellAttrs.UpdateAttrRows( pos, numRows );
+        m_data->m_blockAttrs.UpdateAttrRows( pos, numRows );
 
         m_data->m_rowAttrs.UpdateAttrRowsOrCols( pos, numRows );
     }
@@ -1388,6 +1565,7 @@ void wxGridCellAttrProvider::UpdateAttrCols( size_t pos, int numCols )
     if ( m_data )
     {
         m_data->m_cellAttrs.UpdateAttrCols( pos, numCols );
+        m_data->m_blockAttrs.UpdateAttrCols( pos, numCols );
 
         m_data->m_colAttrs.UpdateAttrRowsOrCols( pos, numCols );
     }
@@ -1846,6 +2024,138 @@ void  wxGridTableBase::SetValueAsCustom( int WXUNUSED(row), int WXUNUSED(col),
 {
 }
 
+// ----------------------------------------------------------------------------
+// wxGridPagedTableBase
+// ----------------------------------------------------------------------------
+
+wxIMPLEMENT_ABSTRACT_CLASS(wxGridPagedTableBase, wxGridTableBase);
+
+wxGridPagedTableBase::wxGridPagedTableBase(int pageSize)
+{
+    m_pageSize = wxMax(pageSize, 1);
+    m_prefetchRows = m_pageSize;
+}
+
+void wxGridPagedTableBase::SetPageSize(int pageSize)
+{
+    wxCHECK_RET( pageSize > 0, "page size must be positive" );
+
+    m_pageSize = pageSize;
+
+    InvalidateAllRows();
+}
+
+void wxGridPagedTableBase::SetPrefetchRows(int rows)
+{
+    wxCHECK_RET( rows >= 0, "number of rows to prefetch can't be negative" );
+
+    m_prefetchRows = rows;
+}
+
+void wxGridPagedTableBase::PrepareRows(int topRow, int bottomRow)
+{
+    const int numRows = GetNumberRows();
+    if ( !numRows )
+        return;
+
+    const int numPages = (numRows + m_pageSize - 1) / m_pageSize;
+    if ( static_cast<int>(m_pages.size()) < numPages )
+        m_pages.resize(numPages, Page_Missing);
+
+    const int firstRow = wxMax(topRow - m_prefetchRows, 0);
+    const int lastRow = wxMin(bottomRow + m_prefetchRows, numRows - 1);
+    if ( firstRow > lastRow )
+        return;
+
+    // Request all consecutive missing pages at once.
+    const int lastPage = lastRow / m_pageSize;
+    for ( int page = firstRow / m_pageSize; page <= lastPage; )
+    {
+        if ( m_pages[page] != Page_Missing )
+        {
+            page++;
+            continue;
+        }
+
+        const int firstPage = page;
+        for ( ; page <= lastPage && m_pages[page] == Page_Missing; page++ )
+            m_pages[page] = Page_Requested;
+
+        const int first = firstPage*m_pageSize;
+        FetchRows(first, wxMin(page*m_pageSize, numRows) - first);
+    }
+}
+
+bool wxGridPagedTableBase::IsRowAvailable(int row)
+{
+    const size_t page = row / m_pageSize;
+
+    return page < m_pages.size() && m_pages[page] == Page_Available;
+}
+
+void wxGridPagedTableBase::NotifyRowsFetched(int firstRow, int numRows)
+{
+    wxCHECK_RET( firstRow >= 0 && numRows >= 0, "invalid rows range" );
+
+    const int endRow = wxMin(firstRow + numRows, GetNumberRows());
+    if ( endRow <= firstRow )
+        return;
+
+    const int numPages = (endRow + m_pageSize - 1) / m_pageSize;
+    if ( static_cast<int>(m_pages.size()) < numPages )
+        m_pages.resize(numPages, Page_Missing);
+
+    // Only the pages entirely covered by the fetched rows become available,
+    // the last page may be incomplete if it is the last page of the table.
+    for ( int page = (firstRow + m_pageSize - 1) / m_pageSize;
+          page < numPages;
+          page++ )
+    {
+        if ( wxMin((page + 1)*m_pageSize, GetNumberRows()) > endRow )
+            break;
+
+        m_pages[page] = Page_Available;
+    }
+
+    RefreshRows(firstRow, endRow - firstRow);
+}
+
+void wxGridPagedTableBase::InvalidateRows(int firstRow, int numRows)
+{
+    wxCHECK_RET( firstRow >= 0 && numRows >= 0, "invalid rows range" );
+
+    if ( !numRows )
+        return;
+
+    const int lastPage = wxMin((firstRow + numRows - 1) / m_pageSize,
+                               static_cast<int>(m_pages.size()) - 1);
+    for ( int page = firstRow / m_pageSize; page <= lastPage; page++ )
+        m_pages[page] = Page_Missing;
+
+    RefreshRows(firstRow, numRows);
+}
+
+void wxGridPagedTableBase::InvalidateAllRows()
+{
+    m_pages.clear();
+
+    if ( GetView() )
+        GetView()->ForceRefresh();
+}
+
+void wxGridPagedTableBase::RefreshRows(int firstRow, int numRows)
+{
+    wxGrid* const grid = GetView();
+    if ( !grid )
+        return;
+
+    const int lastRow = wxMin(firstRow + numRows, grid->GetNumberRows()) - 1;
+    if ( lastRow < firstRow || !grid->GetNumberCols() )
+        return;
+
+    grid->RefreshBlock(firstRow, 0, lastRow, grid->GetNumberCols() - 1);
+}
+
 //////////////////////////////////////////////////////////////////////
 //
 // Message class for the grid table to send requests and notifications
@@ -2833,6 +3143,7 @@ wxGrid::~wxGrid()
 
     delete m_typeRegistry;
     delete m_selection;
+    delete m_renderCache;
 
     delete m_setFixedRows;
     delete m_setFixedCols;
@@ -3040,9 +3351,11 @@ wxGrid::SetTable(wxGridTableBase *table,
 
         // kill row and column size arrays
         m_colWidths.Empty();
-        m_colRights.Empty();
+        m_colRights.clear();
         m_rowHeights.Empty();
-        m_rowBottoms.Empty();
+        m_rowBottoms.clear();
+
+        ClearRenderCache();
     }
 
     if (table)
@@ -3100,6 +3413,8 @@ void wxGrid::Init()
     m_selection = nullptr;
     m_defaultCellAttr = nullptr;
     m_typeRegistry = nullptr;
+    m_renderCache = nullptr;
+    m_autoSizeSampleRows = 0;
 
     m_setFixedRows =
     m_setFixedCols = nullptr;
@@ -3213,35 +3528,23 @@ void wxGrid::Init()
 void wxGrid::InitRowHeights()
 {
     m_rowHeights.Empty();
-    m_rowBottoms.Empty();
 
     m_rowHeights.Alloc( m_numRows );
-    m_rowBottoms.Alloc( m_numRows );
 
     m_rowHeights.Add( m_defaultRowHeight, m_numRows );
 
-    for ( int i = 0; i < m_numRows; i++ )
-    {
-        int rowBottom = ( GetRowPos( i ) + 1 ) * m_defaultRowHeight;
-        m_rowBottoms.Add( rowBottom );
-    }
+    m_rowBottoms.Init( m_rowHeights, m_rowAt );
 }
 
 void wxGrid::InitColWidths()
 {
     m_colWidths.Empty();
-    m_colRights.Empty();
 
     m_colWidths.Alloc( m_numCols );
-    m_colRights.Alloc( m_numCols );
 
     m_colWidths.Add( m_defaultColWidth, m_numCols );
 
-    for ( int i = 0; i < m_numCols; i++ )
-    {
-        int colRight = ( GetColPos( i ) + 1 ) * m_defaultColWidth;
-        m_colRights.Add( colRight );
-    }
+    m_colRights.Init( m_colWidths, m_colAt );
 }
 
 int wxGrid::GetColWidth(int col) const
@@ -3255,16 +3558,16 @@ int wxGrid::GetColWidth(int col) const
 
 int wxGrid::GetColLeft(int col) const
 {
-    if ( m_colRights.IsEmpty() )
+    if ( m_colRights.empty() )
         return GetColPos( col ) * m_defaultColWidth;
 
-    return m_colRights[col] - GetColWidth(col);
+    return m_colRights.GetEnd(col) - GetColWidth(col);
 }
 
 int wxGrid::GetColRight(int col) const
 {
-    return m_colRights.IsEmpty() ? (GetColPos( col ) + 1) * m_defaultColWidth
-                                 : m_colRights[col];
+    return m_colRights.empty() ? (GetColPos( col ) + 1) * m_defaultColWidth
+                               : m_colRights.GetEnd(col);
 }
 
 int wxGrid::GetRowHeight(int row) const
@@ -3279,16 +3582,16 @@ int wxGrid::GetRowHeight(int row) const
 
 int wxGrid::GetRowTop(int row) const
 {
-    if ( m_rowBottoms.IsEmpty() )
+    if ( m_rowBottoms.empty() )
         return GetRowPos( row ) * m_defaultRowHeight;
 
-    return m_rowBottoms[row] - GetRowHeight(row);
+    return m_rowBottoms.GetEnd(row) - GetRowHeight(row);
 }
 
 int wxGrid::GetRowBottom(int row) const
 {
-    return m_rowBottoms.IsEmpty() ? (GetRowPos( row ) + 1) * m_defaultRowHeight
-                                  : m_rowBottoms[row];
+    return m_rowBottoms.empty() ? (GetRowPos( row ) + 1) * m_defaultRowHeight
+                                : m_rowBottoms.GetEnd(row);
 }
 
 void wxGrid::CalcDimensions()
@@ -3459,20 +3762,7 @@ bool wxGrid::Redimension( const wxGridTableMessage& msg )
             if ( !m_rowHeights.IsEmpty() )
             {
                 m_rowHeights.Insert( m_defaultRowHeight, pos, numRows );
-                m_rowBottoms.Insert( 0, pos, numRows );
-
-                int bottom = 0;
-                if ( pos > 0 )
-                    bottom = m_rowBottoms[GetRowAt( pos - 1 )];
-
-                int rowPos;
-                for ( rowPos = pos; rowPos < m_numRows; rowPos++ )
-                {
-                    i = GetRowAt( rowPos );
-
-                    bottom += GetRowHeight(i);
-                    m_rowBottoms[i] = bottom;
-                }
+                m_rowBottoms.Init( m_rowHeights, m_rowAt );
             }
 
             UpdateCurrentCellOnRedim();
@@ -3513,20 +3803,7 @@ bool wxGrid::Redimension( const wxGridTableMessage& msg )
             if ( !m_rowHeights.IsEmpty() )
             {
                 m_rowHeights.Add( m_defaultRowHeight, numRows );
-                m_rowBottoms.Add( 0, numRows );
-
-                int bottom = 0;
-                if ( oldNumRows > 0 )
-                    bottom = m_rowBottoms[oldNumRows - 1];
-
-                int rowPos;
-                for ( rowPos = oldNumRows; rowPos < m_numRows; rowPos++ )
-                {
-                    i = GetRowAt( rowPos );
-
-                    bottom += GetRowHeight(i);
-                    m_rowBottoms[i] = bottom;
-                }
+                m_rowBottoms.Init( m_rowHeights, m_rowAt );
             }
 
             UpdateCurrentCellOnRedim();
@@ -3566,17 +3843,7 @@ bool wxGrid::Redimension( const wxGridTableMessage& msg )
             if ( !m_rowHeights.IsEmpty() )
             {
                 m_rowHeights.RemoveAt( pos, numRows );
-                m_rowBottoms.RemoveAt( pos, numRows );
-
-                int h = 0;
-                int rowPos;
-                for ( rowPos = 0; rowPos < m_numRows; rowPos++ )
-                {
-                    i = GetRowAt( rowPos );
-
-                    h += GetRowHeight(i);
-                    m_rowBottoms[i] = h;
-                }
+                m_rowBottoms.Init( m_rowHeights, m_rowAt );
             }
 
             UpdateCurrentCellOnRedim();
@@ -3638,20 +3905,7 @@ bool wxGrid::Redimension( const wxGridTableMessage& msg )
             if ( !m_colWidths.IsEmpty() )
             {
                 m_colWidths.Insert( m_defaultColWidth, pos, numCols );
-                m_colRights.Insert( 0, pos, numCols );
-
-                int right = 0;
-                if ( pos > 0 )
-                    right = m_colRights[GetColAt( pos - 1 )];
-
-                int colPos;
-                for ( colPos = pos; colPos < m_numCols; colPos++ )
-                {
-                    i = GetColAt( colPos );
-
-                    right += GetColWidth(i);
-                    m_colRights[i] = right;
-                }
+                m_colRights.Init( m_colWidths, m_colAt );
             }
 
             // See comment for wxGRIDTABLE_NOTIFY_COLS_APPENDED case explaining
@@ -3697,20 +3951,7 @@ bool wxGrid::Redimension( const wxGridTableMessage& msg )
             if ( !m_colWidths.IsEmpty() )
             {
                 m_colWidths.Add( m_defaultColWidth, numCols );
-                m_colRights.Add( 0, numCols );
-
-                int right = 0;
-                if ( oldNumCols > 0 )
-                    right = m_colRights[GetColAt( oldNumCols - 1 )];
-
-                int colPos;
-                for ( colPos = oldNumCols; colPos < m_numCols; colPos++ )
-                {
-                    i = GetColAt( colPos );
-
-                    right += GetColWidth(i);
-                    m_colRights[i] = right;
-                }
+                m_colRights.Init( m_colWidths, m_colAt );
             }
 
             // Notice that this must be called after updating m_colWidths above
@@ -3756,17 +3997,7 @@ bool wxGrid::Redimension( const wxGridTableMessage& msg )
             if ( !m_colWidths.IsEmpty() )
             {
                 m_colWidths.RemoveAt( pos, numCols );
-                m_colRights.RemoveAt( pos, numCols );
-
-                int w = 0;
-                int colPos;
-                for ( colPos = 0; colPos < m_numCols; colPos++ )
-                {
-                    i = GetColAt( colPos );
-
-                    w += GetColWidth(i);
-                    m_colRights[i] = w;
-                }
+                m_colRights.Init( m_colWidths, m_colAt );
             }
 
             // See comment for wxGRIDTABLE_NOTIFY_COLS_APPENDED case explaining
@@ -5387,20 +5618,7 @@ void wxGrid::RefreshAfterRowPosChange()
     // unless we calculate them dynamically because all rows heights are the
     // same and it's easy to do
     if ( !m_rowHeights.empty() )
-    {
-        int rowBottom = 0;
-        for ( int rowPos = 0; rowPos < m_numRows; rowPos++ )
-        {
-            int rowID = GetRowAt( rowPos );
-
-            // Ignore the currently hidden rows.
-            const int height = m_rowHeights[rowID];
-            if ( height > 0 )
-                rowBottom += height;
-
-            m_rowBottoms[rowID] = rowBottom;
-        }
-    }
+        m_rowBottoms.Init( m_rowHeights, m_rowAt );
 
     // and make the changes visible
     RefreshArea(wxGA_Cells | wxGA_RowLabels);
@@ -5488,20 +5706,7 @@ void wxGrid::RefreshAfterColPosChange()
     // unless we calculate them dynamically because all columns widths are the
     // same and it's easy to do
     if ( !m_colWidths.empty() )
-    {
-        int colRight = 0;
-        for ( int colPos = 0; colPos < m_numCols; colPos++ )
-        {
-            int colID = GetColAt( colPos );
-
-            // Ignore the currently hidden columns.
-            const int width = m_colWidths[colID];
-            if ( width > 0 )
-                colRight += width;
-
-            m_colRights[colID] = colRight;
-        }
-    }
+        m_colRights.Init( m_colWidths, m_colAt );
 
     int areas = wxGA_Cells;
 
@@ -5744,6 +5949,8 @@ bool wxGrid::ProcessTableMessage( const wxGridTableMessage& msg )
         case wxGRIDTABLE_NOTIFY_COLS_INSERTED:
         case wxGRIDTABLE_NOTIFY_COLS_APPENDED:
         case wxGRIDTABLE_NOTIFY_COLS_DELETED:
+            // the cells have moved, so the cached data is not valid any longer
+            ClearRenderCache();
             return Redimension( msg );
 
         default:
@@ -6032,6 +6239,91 @@ void wxGrid::RefreshBlock(const wxGridCellCoords& coords)
     }
 }
 
+void wxGrid::RefreshCells(const std::vector<wxGridCellCoords>& cells)
+{
+    if ( cells.empty() )
+        return;
+
+    // Only schedule the refresh once, all the cells passed to this function
+    // before it happens will be refreshed together.
+    if ( m_cellsToRefresh.empty() )
+        CallAfter(&wxGrid::DoRefreshCells);
+
+    m_cellsToRefresh.insert(m_cellsToRefresh.end(), cells.begin(), cells.end());
+}
+
+void wxGrid::DoRefreshCells()
+{
+    std::vector<wxGridCellCoords> cells;
+    cells.swap(m_cellsToRefresh);
+
+    // If we're frozen, the entire grid will be refreshed when we're thawed.
+    if ( !ShouldRefresh() )
+        return;
+
+    // Avoid refreshing the same cell several times if it was updated more
+    // than once since the last refresh.
+    std::sort(cells.begin(), cells.end(),
+              [](const wxGridCellCoords& c1, const wxGridCellCoords& c2)
+              {
+                  return c1.GetRow() < c2.GetRow() ||
+                            (c1.GetRow() == c2.GetRow() &&
+                                c1.GetCol() < c2.GetCol());
+              });
+    cells.erase(std::unique(cells.begin(), cells.end()), cells.end());
+
+    for ( const auto& coords : cells )
+    {
+        int row = coords.GetRow();
+        int col = coords.GetCol();
+
+        // The grid could have been shrunk since the cell was added.
+        if ( row < 0 || row >= m_numRows || col < 0 || col >= m_numCols )
+            continue;
+
+        if ( !IsRowShown(row) || !IsColShown(col) )
+            continue;
+
+        // Refresh the main cell of a multicell block.
+        int cellRows, cellCols;
+        if ( GetCellSize(row, col, &cellRows, &cellCols) == CellSpan_Inside )
+        {
+            row += cellRows;
+            col += cellCols;
+        }
+
+        // The cell contents may overflow into the empty cells to its right:
+        // refresh them too, as the old contents could have done it even if
+        // the new one doesn't. Notice that it never overflows from the
+        // frozen part of the grid into the scrollable one.
+        int colLast = col;
+        if ( GetCellAttrPtr(row, col)->CanOverflow() )
+        {
+            const int posEnd = GetColPos(col) < m_numFrozenCols
+                                ? m_numFrozenCols
+                                : m_numCols;
+            for ( int pos = GetColPos(col) + 1; pos < posEnd; pos++ )
+            {
+                const int colNext = GetColAt(pos);
+                if ( !m_table->IsEmptyCell(row, colNext) )
+                    break;
+
+                colLast = colNext;
+            }
+        }
+
+        wxGridWindow* const gridWindow = CellToGridWindow(row, col);
+
+        const wxRect rect = BlockToDeviceRect(wxGridCellCoords(row, col),
+                                              wxGridCellCoords(row, colLast),
+                                              gridWindow);
+        if ( rect.IsEmpty() )
+            continue;
+
+        gridWindow->Refresh(false, &rect);
+    }
+}
+
 void wxGrid::RefreshRect(wxRect* rect)
 {
     if ( rect )
@@ -6136,7 +6428,6 @@ void wxGrid::OnDPIChanged(wxDPIChangedEvent& event)
     // inside InitPixelFields() above).
     if ( !m_rowHeights.empty() )
     {
-        int total = 0;
         for ( unsigned i = 0; i < m_rowHeights.size(); ++i )
         {
             int height = m_rowHeights[i];
@@ -6145,12 +6436,10 @@ void wxGrid::OnDPIChanged(wxDPIChangedEvent& event)
             if ( height <= 0 )
                 continue;
 
-            height = event.ScaleY(height);
-            total += height;
-
-            m_rowHeights[i] = height;
-            m_rowBottoms[i] = total;
+            m_rowHeights[i] = event.ScaleY(height);
         }
+
+        m_rowBottoms.Init( m_rowHeights, m_rowAt );
     }
 
     // Similarly for columns, except that here we need to update the native
@@ -6160,7 +6449,6 @@ void wxGrid::OnDPIChanged(wxDPIChangedEvent& event)
         colHeader = m_useNativeHeader ? GetGridColHeader() : nullptr;
     if ( !m_colWidths.empty() )
     {
-        int total = 0;
         for ( unsigned i = 0; i < m_colWidths.size(); ++i )
         {
             int width = m_colWidths[i];
@@ -6168,15 +6456,13 @@ void wxGrid::OnDPIChanged(wxDPIChangedEvent& event)
             if ( width <= 0 )
                 continue;
 
-            width = event.ScaleX(width);
-            total += width;
-
-            m_colWidths[i] = width;
-            m_colRights[i] = total;
+            m_colWidths[i] = event.ScaleX(width);
 
             if ( colHeader )
                 colHeader->UpdateColumn(i);
         }
+
+        m_colRights.Init( m_colWidths, m_colAt );
     }
     else if ( colHeader )
     {
@@ -6639,6 +6925,24 @@ void wxGrid::DrawGridCellArea( wxDC& dc, const wxGridCellCoordsVector& cells )
         return;
 
     int i, numCells = cells.size();
+
+    // let the table know which rows are going to be drawn, this allows it to
+    // start fetching their data if it doesn't have it yet
+    if ( numCells )
+    {
+        int topRow = m_numRows,
+            bottomRow = -1;
+        for ( i = 0; i < numCells; i++ )
+        {
+            const int row = cells[i].GetRow();
+            if ( row < topRow )
+                topRow = row;
+            if ( row > bottomRow )
+                bottomRow = row;
+        }
+
+        m_table->PrepareRows(topRow, bottomRow);
+    }
     wxGridCellCoordsVector redrawCells;
 
     for ( i = numCells - 1; i >= 0; i-- )
@@ -6809,6 +7113,12 @@ void wxGrid::DrawCell( wxDC& dc, const wxGridCellCoords& coords )
     {
         attr->GetEditorPtr(this, row, col)->PaintBackground(dc, rect, *attr);
     }
+    else if ( !m_table->IsRowAvailable(row) )
+    {
+        // the table doesn't have the data for this row yet, it will refresh
+        // it when it gets it
+        DrawCellPlaceholder(dc, *attr, rect, row, col);
+    }
     else
     {
         // but all the rest is drawn by the cell renderer and hence may be customized
@@ -6817,6 +7127,20 @@ void wxGrid::DrawCell( wxDC& dc, const wxGridCellCoords& coords )
     }
 }
 
+void wxGrid::DrawCellPlaceholder( wxDC& dc, const wxGridCellAttr& attr,
+                                  const wxRect& rect,
+                                  int WXUNUSED(row), int WXUNUSED(col) )
+{
+    dc.SetBrush(attr.GetBackgroundColour());
+    dc.SetPen(*wxTRANSPARENT_PEN);
+    dc.DrawRectangle(rect);
+
+    dc.SetBackgroundMode(wxBRUSHSTYLE_TRANSPARENT);
+    dc.SetFont(attr.GetFont());
+    dc.SetTextForeground(wxSystemSettings::GetColour(wxSYS_COLOUR_GRAYTEXT));
+    DrawTextRectangle(dc, wxS("..."), rect, wxALIGN_CENTRE, wxALIGN_CENTRE);
+}
+
 void wxGrid::DrawCellHighlight( wxDC& dc, const wxGridCellAttr *attr )
 {
     // don't show highlight when the grid doesn't have focus
@@ -7767,22 +8091,22 @@ void wxGrid::GetTextBoxSize( const wxDC& dc,
 {
     wxCoord w = 0;
     wxCoord h = 0;
-    wxCoord lineW = 0, lineH = 0;
 
-    size_t i;
-    for ( i = 0; i < lines.GetCount(); i++ )
+    // Measure all lines at once, this is faster than doing it one by one.
+    wxArrayInt widths, heights;
+    dc.GetTextExtents( lines, widths, &heights );
+
+    for ( size_t i = 0; i < lines.GetCount(); i++ )
     {
         if ( lines[i].empty() )
         {
-            // GetTextExtent() would return 0 for empty lines, but we still
-            // need to account for their height.
+            // Use the same height for the empty lines as we always did.
             h += dc.GetCharHeight();
         }
         else
         {
-            dc.GetTextExtent( lines[i], &lineW, &lineH );
-            w = wxMax( w, lineW );
-            h += lineH;
+            w = wxMax( w, widths[i] );
+            h += heights[i];
         }
     }
 
@@ -8256,9 +8580,8 @@ wxGridCellCoords wxGrid::XYToCell(int x, int y, wxGridWindow *gridWindow) const
 }
 
 // compute row or column from some (unscrolled) coordinate value, using either
-// m_defaultRowHeight/m_defaultColWidth or binary search on array of
-// m_rowBottoms/m_colRights to do it quickly in O(log n) time.
-// NOTE: This may not work correctly for reordered columns.
+// m_defaultRowHeight/m_defaultColWidth or the search in m_rowBottoms/m_colRights
+// to do it quickly in O(log n) time.
 int wxGrid::PosToLinePos(int coord,
                          bool clipToMinMax,
                          const wxGridOperations& oper,
@@ -8273,11 +8596,11 @@ int wxGrid::PosToLinePos(int coord,
     wxCHECK_MSG( defaultLineSize, -1, "can't have 0 default line size" );
 
     int maxPos = coord / defaultLineSize;
-    int minPos = oper.GetFirstLine(this, gridWindow);
+    const int minPos = oper.GetFirstLine(this, gridWindow);
 
     // check for the simplest case: if we have no explicit line sizes
     // configured, then we already know the line this position falls in
-    const wxArrayInt& lineEnds = oper.GetLineEnds(this);
+    const wxGridLineEnds& lineEnds = oper.GetLineEnds(this);
     if ( lineEnds.empty() )
     {
         if ( maxPos < (numLines + minPos) )
@@ -8286,45 +8609,20 @@ int wxGrid::PosToLinePos(int coord,
         return clipToMinMax ? numLines + minPos - 1 : -1;
     }
 
-    // binary search is quite efficient and we can't really make any assumptions
-    // on where to start here since row and columns could be of size 0 if they are
-    // hidden. While this could be made more efficient, some profiling will be
-    // necessary to determine if it really is a performance bottleneck
     maxPos = numLines + minPos - 1;
 
-    // check if the position is beyond the last column
-    const int lineAtMaxPos = oper.GetLineAt(this, maxPos);
-    if ( coord >= lineEnds[lineAtMaxPos] )
+    // notice that this skips the lines of size 0, i.e. hidden ones
+    const int pos = lineEnds.FindPos(coord);
+
+    // check if the position is beyond the last line of this window
+    if ( pos > maxPos )
         return clipToMinMax ? maxPos : wxNOT_FOUND;
 
     // or before the first one
-    const int lineAt0 = oper.GetLineAt(this, minPos);
-    if ( coord < oper.GetLineStartPos(this, lineAt0) )
+    if ( pos < minPos )
         return clipToMinMax ? minPos : wxNOT_FOUND;
-    else if ( coord < lineEnds[lineAt0] )
-        return minPos;
-
-    // finally do perform the binary search
-    while ( minPos < maxPos )
-    {
-        wxCHECK_MSG( lineEnds[oper.GetLineAt(this, minPos)] <= coord &&
-                        coord < lineEnds[oper.GetLineAt(this, maxPos)],
-                     -1,
-                     "wxGrid: internal error in PosToLinePos()" );
-
-        if ( coord >= lineEnds[oper.GetLineAt(this, maxPos - 1)] )
-            return maxPos;
-        else
-            maxPos--;
-
-        const int median = minPos + (maxPos - minPos + 1) / 2;
-        if ( coord < lineEnds[oper.GetLineAt(this, median)] )
-            maxPos = median;
-        else
-            minPos = median;
-    }
 
-    return maxPos;
+    return pos;
 }
 
 int
@@ -10282,7 +10580,7 @@ void wxGrid::SetDefaultRowSize( int height, bool resizeExistingRows )
         // arrays (which also allows us to take advantage of
         // some speed optimisations)
         m_rowHeights.Empty();
-        m_rowBottoms.Empty();
+        m_rowBottoms.clear();
         CalcDimensions();
     }
 }
@@ -10384,10 +10682,7 @@ void wxGrid::DoSetRowSize( int row, int height )
         return;
 
 
-    for ( int rowPos = GetRowPos(row); rowPos < m_numRows; rowPos++ )
-    {
-        m_rowBottoms[GetRowAt(rowPos)] += diff;
-    }
+    m_rowBottoms.Add(row, diff);
 
     InvalidateBestSize();
 
@@ -10451,7 +10746,7 @@ void wxGrid::SetDefaultColSize( int width, bool resizeExistingCols )
         // arrays (which also allows us to take advantage of
         // some speed optimisations)
         m_colWidths.Empty();
-        m_colRights.Empty();
+        m_colRights.clear();
 
         CalcDimensions();
     }
@@ -10532,10 +10827,7 @@ void wxGrid::DoSetColSize( int col, int width )
     }
     //else: will be refreshed when the header is redrawn
 
-    for ( int colPos = GetColPos(col); colPos < m_numCols; colPos++ )
-    {
-        m_colRights[GetColAt(colPos)] += diff;
-    }
+    m_colRights.Add(col, diff);
 
     InvalidateBestSize();
 
@@ -10709,10 +11001,17 @@ wxGrid::AutoSizeColOrRow(int colOrRow, bool setAsMin, wxGridDirection direction)
     wxGridCellAttrPtr attr;
     wxGridCellRendererPtr renderer;
 
+    // For the grids with many rows, we may measure only some of them.
+    const std::vector<int> sampledRows = column ? GetAutoSizeRowsSample()
+                                                : std::vector<int>();
+
     wxCoord extent, extentMax = 0;
-    int max = column ? m_numRows : m_numCols;
-    for ( int rowOrCol = 0; rowOrCol < max; rowOrCol++ )
+    int max = sampledRows.empty() ? column ? m_numRows : m_numCols
+                                  : static_cast<int>(sampledRows.size());
+    for ( int n = 0; n < max; n++ )
     {
+        const int rowOrCol = sampledRows.empty() ? n : sampledRows[n];
+
         if ( column )
         {
             if ( !IsRowShown(rowOrCol) )
@@ -10914,6 +11213,66 @@ wxGrid::AutoSizeColOrRow(int colOrRow, bool setAsMin, wxGridDirection direction)
     }
 }
 
+void wxGrid::SetAutoSizeSampleRows(int numRows)
+{
+    wxCHECK_RET( numRows >= 0, "invalid number of rows" );
+
+    m_autoSizeSampleRows = numRows;
+}
+
+std::vector<int> wxGrid::GetAutoSizeRowsSample() const
+{
+    std::vector<int> rows;
+
+    if ( !m_autoSizeSampleRows || m_numRows <= m_autoSizeSampleRows )
+        return rows;
+
+    rows.reserve(m_autoSizeSampleRows);
+
+    // Always measure the currently visible rows, as it would be unexpected
+    // if their contents didn't fit after auto sizing.
+    int cw, ch;
+    m_gridWin->GetClientSize(&cw, &ch);
+
+    int top, bottom;
+    CalcGridWindowUnscrolledPosition(0, 0, nullptr, &top, m_gridWin);
+    CalcGridWindowUnscrolledPosition(0, ch, nullptr, &bottom, m_gridWin);
+
+    const int rowTop = YToRow(top, true, m_gridWin);
+    const int rowBottom = YToRow(bottom, true, m_gridWin);
+    for ( int pos = GetRowPos(rowTop);
+          pos <= GetRowPos(rowBottom) &&
+            static_cast<int>(rows.size()) < m_autoSizeSampleRows / 2;
+          pos++ )
+    {
+        rows.push_back(GetRowAt(pos));
+    }
+
+    // Then take some rows at the beginning and at the end, as these are the
+    // rows which the user is most likely to see.
+    const int numEdge = (m_autoSizeSampleRows - static_cast<int>(rows.size())) / 4;
+    for ( int n = 0; n < numEdge; n++ )
+    {
+        rows.push_back(n);
+        rows.push_back(m_numRows - 1 - n);
+    }
+
+    // And use random rows for the rest. Use a fixed seed for the random
+    // numbers generator to get the same results every time.
+    wxUint64 seed = 12345;
+    while ( static_cast<int>(rows.size()) < m_autoSizeSampleRows )
+    {
+        seed = seed*6364136223846793005ULL + 1442695040888963407ULL;
+        rows.push_back(static_cast<int>((seed >> 33) % m_numRows));
+    }
+
+    // Measure the rows in order and avoid measuring the same row twice.
+    std::sort(rows.begin(), rows.end());
+    rows.erase(std::unique(rows.begin(), rows.end()), rows.end());
+
+    return rows;
+}
+
 wxCoord wxGrid::CalcColOrRowLabelAreaMinSize(wxGridDirection direction)
 {
     // calculate size for the rows or columns?
@@ -11076,6 +11435,10 @@ void wxGrid::SetCellValue( int row, int col, const wxString& s )
     if ( m_table )
     {
         m_table->SetValue( row, col, s );
+
+        if ( m_renderCache )
+            m_renderCache->InvalidateCell(row, col);
+
         if ( ShouldRefresh() )
         {
             wxRect rect( CellToRect( row, col ) );
@@ -11397,9 +11760,121 @@ void wxGrid::ClearSelection()
         m_selection->ClearSelection();
 }
 
-bool wxGrid::CopySelection()
+#if wxUSE_CLIPBOARD
+
+namespace
+{
+
+// Serialize the given block of cells as text, with the cells separated by TABs
+// and the rows by the native EOL.
+wxString GetGridBlockAsText(const wxGrid& grid, const wxGridBlockCoords& block)
+{
+    const wxString eol = wxTextFile::GetEOL();
+
+    wxString text;
+    wxString line;
+    for ( int row = block.GetTopRow(); row <= block.GetBottomRow(); row++ )
+    {
+        // Build each row separately to avoid reallocating the (potentially
+        // huge) result string too often: once we know the length of the first
+        // row, we can reserve the space for all of them at once.
+        line.clear();
+        for ( int col = block.GetLeftCol(); col <= block.GetRightCol(); col++ )
+        {
+            if ( col != block.GetLeftCol() )
+                line += '\t';
+
+            line += grid.GetCellValue(row, col);
+        }
+
+        if ( row == block.GetTopRow() )
+        {
+            const int numRows = block.GetBottomRow() - block.GetTopRow() + 1;
+            text.reserve((line.length() + eol.length())*numRows);
+        }
+        else
+        {
+            text += eol;
+        }
+
+        text += line;
+    }
+
+    return text;
+}
+
+// Append the text with HTML special characters escaped to the given string.
+void AppendEscapedHTML(wxString& html, const wxString& text)
+{
+    for ( wxString::const_iterator it = text.begin(); it != text.end(); ++it )
+    {
+        const wxUniChar ch = *it;
+        switch ( ch.GetValue() )
+        {
+            case '&':
+                html += wxS("&amp;");
+                break;
+
+            case '<':
+                html += wxS("&lt;");
+                break;
+
+            case '>':
+                html += wxS("&gt;");
+                break;
+
+            case '\n':
+                html += wxS("<br>");
+                break;
+
+            default:
+                html += ch;
+        }
+    }
+}
+
+// Serialize the given block of cells as an HTML table.
+wxString GetGridBlockAsHTML(const wxGrid& grid, const wxGridBlockCoords& block)
+{
+    wxString html;
+    wxString line;
+
+    html += wxS("<table>\n");
+    for ( int row = block.GetTopRow(); row <= block.GetBottomRow(); row++ )
+    {
+        line.clear();
+        line += wxS("<tr>");
+        for ( int col = block.GetLeftCol(); col <= block.GetRightCol(); col++ )
+        {
+            line += wxS("<td>");
+            AppendEscapedHTML(line, grid.GetCellValue(row, col));
+            line += wxS("</td>");
+        }
+        line += wxS("</tr>\n");
+
+        if ( row == block.GetTopRow() )
+        {
+            const int numRows = block.GetBottomRow() - block.GetTopRow() + 1;
+            html.reserve(line.length()*numRows + 32);
+        }
+
+        html += line;
+    }
+    html += wxS("</table>\n");
+
+    return html;
+}
+
+} // anonymous namespace
+
+#endif // wxUSE_CLIPBOARD
+
+bool wxGrid::CopySelection(int flags)
 {
 #if wxUSE_CLIPBOARD
+    wxCHECK_MSG( flags & (wxGRID_COPY_TEXT | wxGRID_COPY_HTML), false,
+                 "at least one format must be specified" );
+
     // Coordinates of the selected block to copy to clipboard.
     wxGridBlockCoords sel;
 
@@ -11439,29 +11914,53 @@ bool wxGrid::CopySelection()
         return false;
     }
 
-    bool firstRow = true;
-    wxString buf;
-    for (int row = sel.GetTopRow(); row <= sel.GetBottomRow(); row++)
+    // When deferring, the data is only created when it's pasted, which may
+    // happen after this grid is destroyed, so use a weak reference to it.
+    wxWeakRef<wxGrid> self(this);
+    const bool deferred = (flags & wxGRID_COPY_DEFERRED) != 0;
+
+    wxDataObjectComposite* const data = new wxDataObjectComposite;
+
+    if ( flags & wxGRID_COPY_TEXT )
     {
-        if (firstRow)
-            firstRow = false;
+        wxTextDataObject* const text = new wxTextDataObject;
+        if ( deferred )
+        {
+            text->SetTextProvider([self, sel]()
+            {
+                return self ? GetGridBlockAsText(*self, sel) : wxString();
+            });
+        }
         else
-            buf += wxTextFile::GetEOL();
+        {
+            text->SetText(GetGridBlockAsText(*this, sel));
+        }
 
-        bool firstColumn = true;
+        data->Add(text, true /* preferred */);
+    }
 
-        for (int col = sel.GetLeftCol(); col <= sel.GetRightCol(); col++)
+    if ( flags & wxGRID_COPY_HTML )
+    {
+        wxHTMLDataObject* const html = new wxHTMLDataObject;
+        if ( deferred )
         {
-            if (firstColumn)
-                firstColumn = false;
-            else
-                buf += '\t';
-
-            buf += GetCellValue(row, col);
+            html->SetHTMLProvider([self, sel]()
+            {
+                return self ? GetGridBlockAsHTML(*self, sel) : wxString();
+            });
+        }
+        else
+        {
+            html->SetHTML(GetGridBlockAsHTML(*this, sel));
         }
+
+        data->Add(html);
     }
 
-    wxTheClipboard->SetData(new wxTextDataObject(buf));
+    if ( !wxTheClipboard->SetData(data) )
+        return false;
+#else // !wxUSE_CLIPBOARD
+    wxUnusedVar(flags);
 #endif // wxUSE_CLIPBOARD
 
     return true;
@@ -11893,6 +12392,265 @@ int wxGridSizesInfo::GetSize(unsigned pos) const
     return it->second;
 }
 
+// ----------------------------------------------------------------------------
+// wxGridLineEnds
+// ----------------------------------------------------------------------------
+
+void wxGridLineEnds::clear()
+{
+    m_tree.clear();
+    m_posOf.clear();
+}
+
+void wxGridLineEnds::Init(const wxArrayInt& sizes, const wxArrayInt& lineAt)
+{
+    clear();
+
+    const int count = static_cast<int>(sizes.size());
+    if ( !count )
+        return;
+
+    wxASSERT_MSG( lineAt.empty() || lineAt.size() == sizes.size(),
+                  "lines order inconsistent with their sizes" );
+
+    m_tree.resize(count + 1);
+    if ( !lineAt.empty() )
+        m_posOf.resize(count);
+
+    for ( int pos = 0; pos < count; pos++ )
+    {
+        const int line = lineAt.empty() ? pos : lineAt[pos];
+        if ( !lineAt.empty() )
+            m_posOf[line] = pos;
+
+        m_tree[pos + 1] = wxMax(sizes[line], 0);
+    }
+
+    // Build the tree in linear time by propagating each node value to its
+    // parent, i.e. the next node whose range includes it.
+    for ( int i = 1; i <= count; i++ )
+    {
+        const int parent = i + (i & -i);
+        if ( parent <= count )
+            m_tree[parent] += m_tree[i];
+    }
+}
+
+int wxGridLineEnds::GetEnd(int line) const
+{
+    int end = 0;
+    for ( int i = GetPosOf(line) + 1; i > 0; i -= i & -i )
+        end += m_tree[i];
+
+    return end;
+}
+
+void wxGridLineEnds::Add(int line, int diff)
+{
+    const int count = static_cast<int>(m_tree.size()) - 1;
+    for ( int i = GetPosOf(line) + 1; i <= count; i += i & -i )
+        m_tree[i] += diff;
+}
+
+int wxGridLineEnds::FindPos(int coord) const
+{
+    const int count = static_cast<int>(m_tree.size()) - 1;
+
+    int step = 1;
+    while ( step*2 <= count )
+        step *= 2;
+
+    // Find the number of lines ending at or before the given coordinate by
+    // descending the tree, this is the position of the next line.
+    int pos = 0;
+    for ( ; step > 0; step /= 2 )
+    {
+        const int next = pos + step;
+        if ( next <= count && m_tree[next] <= coord )
+        {
+            pos = next;
+            coord -= m_tree[next];
+        }
+    }
+
+    return pos;
+}
+
+// ----------------------------------------------------------------------------
+// wxGridRenderCache
+// ----------------------------------------------------------------------------
+
+wxGridRenderCache::wxGridRenderCache(size_t maxCells)
+    : m_maxCells(maxCells)
+{
+}
+
+const wxGridRenderCache::Entry*
+wxGridRenderCache::Find(int row, int col,
+                        const wxString& value, const wxFont& font) const
+{
+    const auto it = m_entries.find(CoordsToKey(row, col));
+    if ( it == m_entries.end() )
+        return nullptr;
+
+    const Entry& entry = it->second;
+    if ( entry.valueHash != wxStringHash::stringHash(value.wx_str()) ||
+            entry.font != font )
+        return nullptr;
+
+    return &entry;
+}
+
+wxGridRenderCache::Entry&
+wxGridRenderCache::Get(int row, int col,
+                       const wxString& value, const wxFont& font)
+{
+    // Don't let the cache grow indefinitely, the simplest way to do it is to
+    // just start from scratch when it becomes too big.
+    if ( m_entries.size() >= m_maxCells )
+        m_entries.clear();
+
+    const unsigned long valueHash = wxStringHash::stringHash(value.wx_str());
+
+    Entry& entry = m_entries[CoordsToKey(row, col)];
+    if ( entry.valueHash != valueHash || entry.font != font )
+    {
+        entry = Entry();
+        entry.valueHash = valueHash;
+        entry.font = font;
+    }
+
+    return entry;
+}
+
+bool
+wxGridRenderCache::GetLines(int row, int col,
+                            const wxString& value, const wxFont& font,
+                            int width,
+                            wxArrayString& lines) const
+{
+    const Entry* const entry = Find(row, col, value, font);
+    if ( !entry || entry->linesWidth != width )
+        return false;
+
+    lines = entry->lines;
+    return true;
+}
+
+void
+wxGridRenderCache::SetLines(int row, int col,
+                            const wxString& value, const wxFont& font,
+                            int width,
+                            const wxArrayString& lines)
+{
+    Entry& entry = Get(row, col, value, font);
+    entry.linesWidth = width;
+    entry.lines = lines;
+}
+
+bool
+wxGridRenderCache::GetBestSize(int row, int col,
+                               const wxString& value, const wxFont& font,
+                               wxSize& size) const
+{
+    const Entry* const entry = Find(row, col, value, font);
+    if ( !entry || entry->bestSize == wxDefaultSize )
+        return false;
+
+    size = entry->bestSize;
+    return true;
+}
+
+void
+wxGridRenderCache::SetBestSize(int row, int col,
+                               const wxString& value, const wxFont& font,
+                               const wxSize& size)
+{
+    Get(row, col, value, font).bestSize = size;
+}
+
+bool
+wxGridRenderCache::GetBestWidth(int row, int col,
+                                const wxString& value, const wxFont& font,
+                                int height,
+                                int& width) const
+{
+    const Entry* const entry = Find(row, col, value, font);
+    if ( !entry || entry->bestWidthHeight != height )
+        return false;
+
+    width = entry->bestWidth;
+    return true;
+}
+
+void
+wxGridRenderCache::SetBestWidth(int row, int col,
+                                const wxString& value, const wxFont& font,
+                                int height,
+                                int width)
+{
+    Entry& entry = Get(row, col, value, font);
+    entry.bestWidthHeight = height;
+    entry.bestWidth = width;
+}
+
+bool
+wxGridRenderCache::GetBestHeight(int row, int col,
+                                 const wxString& value, const wxFont& font,
+                                 int width,
+                                 int& height) const
+{
+    const Entry* const entry = Find(row, col, value, font);
+    if ( !entry || entry->bestHeightWidth != width )
+        return false;
+
+    height = entry->bestHeight;
+    return true;
+}
+
+void
+wxGridRenderCache::SetBestHeight(int row, int col,
+                                 const wxString& value, const wxFont& font,
+                                 int width,
+                                 int height)
+{
+    Entry& entry = Get(row, col, value, font);
+    entry.bestHeightWidth = width;
+    entry.bestHeight = height;
+}
+
+void wxGridRenderCache::InvalidateCell(int row, int col)
+{
+    m_entries.erase(CoordsToKey(row, col));
+}
+
+void wxGridRenderCache::Clear()
+{
+    m_entries.clear();
+}
+
+void wxGrid::EnableRenderCache(bool enable)
+{
+    if ( enable == IsRenderCacheEnabled() )
+        return;
+
+    if ( enable )
+    {
+        m_renderCache = new wxGridRenderCache();
+    }
+    else
+    {
+        delete m_renderCache;
+        m_renderCache = nullptr;
+    }
+}
+
+void wxGrid::ClearRenderCache()
+{
+    if ( m_renderCache )
+        m_renderCache->Clear();
+}
+
 // ----------------------------------------------------------------------------
 // drop target
 // ----------------------------------------------------------------------------
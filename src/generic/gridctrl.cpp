@@ -398,16 +398,24 @@ wxGridCellAutoWrapStringRenderer::GetTextLines(wxGrid& grid,
     dc.SetFont(attr.GetFont());
     const wxCoord maxWidth = rect.GetWidth();
 
+    const wxString text = grid.GetCellValue(row, col);
+
+    wxGridRenderCache* const cache = grid.GetRenderCache();
+
+    wxArrayString physicalLines;
+    if ( cache &&
+            cache->GetLines(row, col, text, attr.GetFont(), maxWidth,
+                            physicalLines) )
+        return physicalLines;
+
     // Transform logical lines into physical ones, wrapping the longer ones.
-    const wxArrayString
-        logicalLines = wxSplit(grid.GetCellValue(row, col), '\n', '\0');
+    const wxArrayString logicalLines = wxSplit(text, '\n', '\0');
 
     // Trying to do anything if the column is hidden anyhow doesn't make sense
     // and we run into problems in BreakLine() in this case.
     if ( maxWidth <= 0 )
         return logicalLines;
 
-    wxArrayString physicalLines;
     for ( wxArrayString::const_iterator it = logicalLines.begin();
           it != logicalLines.end();
           ++it )
@@ -425,6 +433,9 @@ wxGridCellAutoWrapStringRenderer::GetTextLines(wxGrid& grid,
         }
     }
 
+    if ( cache )
+        cache->SetLines(row, col, text, attr.GetFont(), maxWidth, physicalLines);
+
     return physicalLines;
 }
 
@@ -556,12 +567,25 @@ wxGridCellAutoWrapStringRenderer::GetBestHeight(wxGrid& grid,
                                                 int row, int col,
                                                 int width)
 {
+    wxGridRenderCache* const cache = grid.GetRenderCache();
+    const wxString text = cache ? grid.GetCellValue(row, col) : wxString();
+
+    int height;
+    if ( cache &&
+            cache->GetBestHeight(row, col, text, attr.GetFont(), width, height) )
+        return height;
+
     const int lineHeight = dc.GetCharHeight();
 
     // Use as many lines as we need for this width and add a small border to
     // improve the appearance.
-    return GetTextLines(grid, dc, attr, wxSize(width, lineHeight),
-                        row, col).size() * lineHeight + AUTOWRAP_Y_MARGIN;
+    height = GetTextLines(grid, dc, attr, wxSize(width, lineHeight),
+                          row, col).size() * lineHeight + AUTOWRAP_Y_MARGIN;
+
+    if ( cache )
+        cache->SetBestHeight(row, col, text, attr.GetFont(), width, height);
+
+    return height;
 }
 
 int
@@ -571,6 +595,15 @@ wxGridCellAutoWrapStringRenderer::GetBestWidth(wxGrid& grid,
                                                int row, int col,
                                                int height)
 {
+    const wxString text = grid.GetCellValue(row, col);
+
+    wxGridRenderCache* const cache = grid.GetRenderCache();
+
+    int width;
+    if ( cache &&
+            cache->GetBestWidth(row, col, text, attr.GetFont(), height, width) )
+        return width;
+
     const int lineHeight = dc.GetCharHeight();
 
     // Base the maximal number of lines either on how many fit or how many
@@ -582,17 +615,20 @@ wxGridCellAutoWrapStringRenderer::GetBestWidth(wxGrid& grid,
     // lines in the text than can fit in the available height.
     const size_t maxLines = wxMax(
                               (height - AUTOWRAP_Y_MARGIN)/lineHeight,
-                              1 + grid.GetCellValue(row, col).Freq(wxS('\n')));
+                              1 + text.Freq(wxS('\n')));
 
     // Increase width until all the text fits.
     //
     // TODO: this is not the most efficient to do it for the long strings.
     const int charWidth = dc.GetCharWidth();
-    int width = 2*charWidth;
+    width = 2*charWidth;
     while ( GetTextLines(grid, dc, attr, wxSize(width, height),
                          row, col).size() > maxLines )
         width += charWidth;
 
+    if ( cache )
+        cache->SetBestWidth(row, col, text, attr.GetFont(), height, width);
+
     return width;
 }
 
@@ -613,7 +649,20 @@ wxSize wxGridCellStringRenderer::GetBestSize(wxGrid& grid,
                                              wxDC& dc,
                                              int row, int col)
 {
-    return DoGetBestSize(attr, dc, grid.GetCellValue(row, col));
+    const wxString text = grid.GetCellValue(row, col);
+
+    wxGridRenderCache* const cache = grid.GetRenderCache();
+
+    wxSize size;
+    if ( cache && cache->GetBestSize(row, col, text, attr.GetFont(), size) )
+        return size;
+
+    size = DoGetBestSize(attr, dc, text);
+
+    if ( cache )
+        cache->SetBestSize(row, col, text, attr.GetFont(), size);
+
+    return size;
 }
 
 void wxGridCellStringRenderer::Draw(wxGrid& grid,
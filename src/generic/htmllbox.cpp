@@ -20,6 +20,7 @@
 
 
 #ifndef WX_PRECOMP
+    #include "wx/app.h"
     #include "wx/dcclient.h"
 #endif //WX_PRECOMP
 
@@ -30,6 +31,9 @@
 #include "wx/html/htmlcell.h"
 #include "wx/html/winpars.h"
 
+#include <list>
+#include <unordered_map>
+
 // this hack forces the linker to always link in m_* files
 #include "wx/html/forcelnk.h"
 FORCE_WXHTML_MODULES()
@@ -41,6 +45,9 @@ FORCE_WXHTML_MODULES()
 // small border always added to the cells:
 static const wxCoord CELL_BORDER = 2;
 
+// max number of items parsed by PrecacheItems() during a single idle event
+static const size_t PRECACHE_BATCH_SIZE = 10;
+
 const char wxHtmlListBoxNameStr[] = "htmlListBox";
 const char wxSimpleHtmlListBoxNameStr[] = "simpleHtmlListBox";
 
@@ -54,96 +61,152 @@ const char wxSimpleHtmlListBoxNameStr[] = "simpleHtmlListBox";
 
 // this class is used by wxHtmlListBox to cache the parsed representation of
 // the items to avoid doing it anew each time an item must be drawn
+//
+// the cells are laid out for the given width, so it is a part of the key too,
+// and the least recently used cell is discarded when the cache is full
 class wxHtmlListBoxCache
 {
-private:
-    // invalidate a single item, used by Clear() and InvalidateRange()
-    void InvalidateItem(size_t n)
-    {
-        m_items[n] = (size_t)-1;
-        wxDELETE(m_cells[n]);
-    }
-
 public:
     wxHtmlListBoxCache()
     {
-        for ( size_t n = 0; n < SIZE; n++ )
-        {
-            m_items[n] = (size_t)-1;
-            m_cells[n] = nullptr;
-        }
-
-        m_next = 0;
+        m_maxSize = DEFAULT_SIZE;
     }
 
     ~wxHtmlListBoxCache()
     {
-        for ( size_t n = 0; n < SIZE; n++ )
-        {
-            delete m_cells[n];
-        }
+        Clear();
     }
 
     // completely invalidate the cache
     void Clear()
     {
-        for ( size_t n = 0; n < SIZE; n++ )
+        for ( Entries::const_iterator it = m_entries.begin();
+              it != m_entries.end();
+              ++it )
         {
-            InvalidateItem(n);
+            delete it->cell;
         }
+
+        m_entries.clear();
+        m_index.clear();
     }
 
-    // return the cached cell for this index or nullptr if none
-    wxHtmlCell *Get(size_t item) const
+    // return the cached cell for this index laid out for the given width or
+    // nullptr if none
+    wxHtmlCell *Get(size_t item, int width)
     {
-        for ( size_t n = 0; n < SIZE; n++ )
-        {
-            if ( m_items[n] == item )
-                return m_cells[n];
-        }
+        const Index::const_iterator it = m_index.find(item);
+        if ( it == m_index.end() || it->second->width != width )
+            return nullptr;
 
-        return nullptr;
+        // this item is now the most recently used one
+        m_entries.splice(m_entries.begin(), m_entries, it->second);
+
+        return it->second->cell;
     }
 
-    // returns true if we already have this item cached
-    bool Has(size_t item) const { return Get(item) != nullptr; }
+    // returns true if we already have this item cached for any width
+    bool HasItem(size_t item) const { return m_index.count(item) != 0; }
+
+    // returns true if storing another item would discard an existing one
+    bool IsFull() const { return m_entries.size() >= m_maxSize; }
 
-    // ensure that the item is cached
-    void Store(size_t item, wxHtmlCell *cell)
+    // ensure that the item is cached, replacing its existing cell, if any
+    void Store(size_t item, int width, wxHtmlCell *cell)
     {
-        delete m_cells[m_next];
-        m_cells[m_next] = cell;
-        m_items[m_next] = item;
+        InvalidateItem(item);
 
-        // advance to the next item wrapping around if there are no more
-        if ( ++m_next == SIZE )
-            m_next = 0;
+        // discard the least recently used items if there is no more space
+        while ( !m_entries.empty() && IsFull() )
+        {
+            InvalidateItem(m_entries.back().item);
+        }
+
+        Entry entry;
+        entry.item = item;
+        entry.width = width;
+        entry.cell = cell;
+        m_entries.push_front(entry);
+        m_index[item] = m_entries.begin();
     }
 
     // forget the cached value of the item(s) between the given ones (inclusive)
     void InvalidateRange(size_t from, size_t to)
     {
-        for ( size_t n = 0; n < SIZE; n++ )
+        if ( to - from < m_index.size() )
+        {
+            for ( size_t item = from; item <= to; item++ )
+                InvalidateItem(item);
+        }
+        else // iterating over the cached items is faster
         {
-            if ( m_items[n] >= from && m_items[n] <= to )
+            for ( Index::iterator it = m_index.begin(); it != m_index.end(); )
             {
-                InvalidateItem(n);
+                if ( it->first >= from && it->first <= to )
+                {
+                    delete it->second->cell;
+                    m_entries.erase(it->second);
+                    it = m_index.erase(it);
+                }
+                else
+                {
+                    ++it;
+                }
             }
         }
     }
 
+    // get or change the max number of the items we cache
+    size_t GetMaxSize() const { return m_maxSize; }
+
+    void SetMaxSize(size_t size)
+    {
+        m_maxSize = size;
+
+        while ( m_entries.size() > m_maxSize )
+        {
+            InvalidateItem(m_entries.back().item);
+        }
+    }
+
 private:
-    // the max number of the items we cache
-    enum { SIZE = 50 };
+    // the default max number of the items we cache
+    enum { DEFAULT_SIZE = 50 };
 
-    // the index of the LRU (oldest) cell
-    size_t m_next;
+    // invalidate a single item, if it's cached
+    void InvalidateItem(size_t item)
+    {
+        const Index::iterator it = m_index.find(item);
+        if ( it == m_index.end() )
+            return;
 
-    // the parsed representation of the cached item or nullptr
-    wxHtmlCell *m_cells[SIZE];
+        delete it->second->cell;
+        m_entries.erase(it->second);
+        m_index.erase(it);
+    }
 
-    // the index of the currently cached item (only valid if m_cells != nullptr)
-    size_t m_items[SIZE];
+    struct Entry
+    {
+        // the index of the item
+        size_t item;
+
+        // the width for which the cell was laid out
+        int width;
+
+        // the parsed representation of the item, owned by us
+        wxHtmlCell *cell;
+    };
+
+    // the cached items, from the most to the least recently used one
+    typedef std::list<Entry> Entries;
+    Entries m_entries;
+
+    // the map from item indices to their entries in m_entries
+    typedef std::unordered_map<size_t, Entries::iterator> Index;
+    Index m_index;
+
+    // the max number of the items we cache
+    size_t m_maxSize;
 };
 
 // ----------------------------------------------------------------------------
@@ -236,6 +299,9 @@ void wxHtmlListBox::Init()
     m_htmlParser = nullptr;
     m_htmlRendStyle = new wxHtmlListBoxStyle(*this);
     m_cache = new wxHtmlListBoxCache;
+
+    m_precacheNext =
+    m_precacheEnd = 0;
 }
 
 bool wxHtmlListBox::Create(wxWindow *parent,
@@ -314,21 +380,93 @@ wxHtmlCell* wxHtmlListBox::CreateCellForItem(size_t n) const
     // can quickly find the item:
     cell->SetId(wxString::Format(wxT("%lu"), (unsigned long)n));
 
-    cell->Layout(GetClientSize().x - 2*GetMargins().x);
+    cell->Layout(GetCellWidth());
 
     return cell;
 }
 
-void wxHtmlListBox::CacheItem(size_t n) const
+int wxHtmlListBox::GetCellWidth() const
 {
-    if ( !m_cache->Has(n) )
-        m_cache->Store(n, CreateCellForItem(n));
+    return GetClientSize().x - 2*GetMargins().x;
+}
+
+wxHtmlCell* wxHtmlListBox::CacheItem(size_t n) const
+{
+    const int width = GetCellWidth();
+
+    wxHtmlCell* cell = m_cache->Get(n, width);
+    if ( !cell )
+    {
+        cell = CreateCellForItem(n);
+        if ( cell )
+            m_cache->Store(n, width, cell);
+    }
+
+    return cell;
+}
+
+void wxHtmlListBox::SetCacheSize(size_t numItems)
+{
+    m_cache->SetMaxSize(numItems);
+}
+
+size_t wxHtmlListBox::GetCacheSize() const
+{
+    return m_cache->GetMaxSize();
+}
+
+void wxHtmlListBox::PrecacheItems(size_t from, size_t to)
+{
+    wxCHECK_RET( from <= to, wxT("invalid range") );
+
+    // don't parse more items than can be cached without discarding the
+    // visible ones, as we would just waste time on parsing them otherwise
+    const size_t numVisible = GetVisibleRowsEnd() - GetVisibleRowsBegin();
+    const size_t cacheSize = GetCacheSize();
+    if ( cacheSize <= numVisible )
+        return;
+
+    m_precacheNext = from;
+    m_precacheEnd = wxMin(to - from + 1, cacheSize - numVisible) + from;
+
+    wxWakeUpIdle();
+}
+
+void wxHtmlListBox::DoPrecacheSomeItems()
+{
+    const size_t end = wxMin(m_precacheEnd, GetItemCount());
+    const int width = GetCellWidth();
+
+    for ( size_t numParsed = 0;
+          m_precacheNext < end && numParsed < PRECACHE_BATCH_SIZE;
+          m_precacheNext++ )
+    {
+        if ( !m_cache->Get(m_precacheNext, width) )
+        {
+            wxHtmlCell* const cell = CreateCellForItem(m_precacheNext);
+            if ( cell )
+                m_cache->Store(m_precacheNext, width, cell);
+
+            numParsed++;
+        }
+    }
+
+    if ( m_precacheNext < end )
+    {
+        // continue during the next idle event
+        wxWakeUpIdle();
+    }
+    else
+    {
+        m_precacheNext =
+        m_precacheEnd = 0;
+    }
 }
 
 void wxHtmlListBox::OnSize(wxSizeEvent& event)
 {
-    // we need to relayout all the cached cells
-    m_cache->Clear();
+    // nothing to do with the cached cells: as they are cached for the
+    // specific width, they will be laid out anew when they're needed
 
     event.Skip();
 }
@@ -359,6 +497,9 @@ void wxHtmlListBox::SetItemCount(size_t count)
     // the items are going to change, forget the old ones
     m_cache->Clear();
 
+    m_precacheNext =
+    m_precacheEnd = 0;
+
     wxVListBox::SetItemCount(count);
 }
 
@@ -389,9 +530,7 @@ wxHtmlListBox::OnDrawBackground(wxDC& dc, const wxRect& rect, size_t n) const
 
 void wxHtmlListBox::OnDrawItem(wxDC& dc, const wxRect& rect, size_t n) const
 {
-    CacheItem(n);
-
-    wxHtmlCell *cell = m_cache->Get(n);
+    wxHtmlCell *cell = CacheItem(n);
     wxCHECK_RET( cell, wxT("this cell should be cached!") );
 
     wxHtmlRenderingInfo htmlRendInfo;
@@ -422,16 +561,25 @@ void wxHtmlListBox::OnDrawItem(wxDC& dc, const wxRect& rect, size_t n) const
 
 wxCoord wxHtmlListBox::OnMeasureItem(size_t n) const
 {
-    // Notice that we can't cache the cell here because we could be called from
-    // some code updating an existing cell which could be displaced from the
-    // cache if we called CacheItem() and destroyed -- resulting in a crash
-    // when we return to its method from here, see #16651.
+    // Reuse the already parsed item if we have it.
+    const int width = GetCellWidth();
+    if ( const wxHtmlCell * const cached = m_cache->Get(n, width) )
+        return cached->GetHeight() + cached->GetDescent() + 4;
+
     wxHtmlCell * const cell = CreateCellForItem(n);
     if ( !cell )
         return 0;
 
     const wxCoord h = cell->GetHeight() + cell->GetDescent() + 4;
-    delete cell;
+
+    // Notice that we can't cache the cell here if doing it would remove
+    // another cell from the cache because we could be called from some code
+    // updating an existing cell which would be destroyed then -- resulting in
+    // a crash when we return to its method from here, see #16651.
+    if ( !m_cache->HasItem(n) && !m_cache->IsFull() )
+        m_cache->Store(n, width, cell);
+    else
+        delete cell;
 
     return h;
 }
@@ -524,8 +672,7 @@ bool wxHtmlListBox::PhysicalCoordsToCell(wxPoint& pos, wxHtmlCell*& cell) const
     // convert mouse coordinates to coords relative to item's wxHtmlCell:
     pos -= GetRootCellCoords(n);
 
-    CacheItem(n);
-    cell = m_cache->Get(n);
+    cell = CacheItem(n);
 
     return true;
 }
@@ -559,6 +706,9 @@ void wxHtmlListBox::OnInternalIdle()
 {
     wxVListBox::OnInternalIdle();
 
+    if ( m_precacheNext < m_precacheEnd )
+        DoPrecacheSomeItems();
+
     if ( wxHtmlWindowMouseHelper::DidMouseMove() )
     {
         wxPoint pos = ScreenToClient(wxGetMousePosition());
@@ -16,12 +16,21 @@
 
 #ifndef WX_PRECOMP
     #include "wx/dc.h"
+    #include "wx/dcmemory.h"
     #include "wx/icon.h"
     #include "wx/image.h"
 #endif
 
 #include "wx/settings.h"
 
+namespace
+{
+
+// Maximal width of the atlas bitmap, in pixels.
+const int wxIMAGELIST_ATLAS_MAX_WIDTH = 2048;
+
+} // anonymous namespace
+
 //-----------------------------------------------------------------------------
 //  wxImageList
 //-----------------------------------------------------------------------------
@@ -43,6 +52,8 @@ void wxGenericImageList::Destroy()
 {
     (void)RemoveAll();
 
+    InvalidateAtlas();
+
     // Make it invalid.
     m_size = wxSize(0, 0);
 }
@@ -64,6 +75,8 @@ bool wxGenericImageList::Create( int width, int height, bool mask, int WXUNUSED(
     m_size = wxSize(wxMax(width, 0), wxMax(height, 0));
     m_useMask = mask;
 
+    InvalidateAtlas();
+
     // Images must have proper size
     return m_size != wxSize(0, 0);
 }
@@ -138,6 +151,8 @@ int wxGenericImageList::Add( const wxBitmap &bitmap )
     // prevents it from having one), so leave them alone. This is clearly a
     // hack but OTOH nobody uses multi-image bitmaps with a scale factor and it
     // avoids problems when using scaled bitmaps in the image list, see #23994.
+    InvalidateAtlas();
+
     if ( bitmapSize.x == m_size.x || bitmap.GetScaleFactor() != 1.0 )
     {
         m_images.push_back(GetImageListBitmap(bitmap));
@@ -221,6 +236,8 @@ wxGenericImageList::Replace(int index,
 
     m_images[index] = GetImageListBitmap(bmp);
 
+    InvalidateAtlas();
+
     return true;
 }
 
@@ -233,6 +250,8 @@ bool wxGenericImageList::Remove( int index )
 
     m_images.erase(m_images.begin() + index);
 
+    InvalidateAtlas();
+
     return true;
 }
 
@@ -242,6 +261,8 @@ bool wxGenericImageList::RemoveAll()
 
     m_images.clear();
 
+    InvalidateAtlas();
+
     return true;
 }
 
@@ -255,6 +276,84 @@ bool wxGenericImageList::GetSize( int WXUNUSED(index), int &width, int &height )
     return true;
 }
 
+void wxGenericImageList::EnableAtlas(bool enable)
+{
+    m_atlasEnabled = enable;
+
+    InvalidateAtlas();
+}
+
+void wxGenericImageList::InvalidateAtlas()
+{
+    m_atlasDC.reset();
+    m_atlas = wxNullBitmap;
+    m_atlasUnusable = false;
+}
+
+int wxGenericImageList::GetAtlasColumns() const
+{
+    return wxMax(1, wxIMAGELIST_ATLAS_MAX_WIDTH / m_size.x);
+}
+
+bool wxGenericImageList::UpdateAtlas()
+{
+    if ( m_atlasDC )
+        return true;
+
+    if ( m_atlasUnusable || m_images.empty() )
+        return false;
+
+#if wxUSE_IMAGE
+    const int count = static_cast<int>(m_images.size());
+    // Don't make the atlas wider than needed if it has a single row: this
+    // doesn't change the position of any images in it.
+    const int cols = wxMin(count, GetAtlasColumns());
+    const int rows = (count + cols - 1) / cols;
+
+    wxImage atlas(cols*m_size.x, rows*m_size.y);
+    atlas.InitAlpha();
+    memset(atlas.GetAlpha(), wxIMAGE_ALPHA_TRANSPARENT,
+           atlas.GetWidth()*atlas.GetHeight());
+
+    for ( int n = 0; n < count; n++ )
+    {
+        const wxBitmap& bmp = m_images[n];
+
+        // We could support scaled bitmaps too if they all used the same scale
+        // factor, but this is not worth the complexity, so just use the
+        // images directly for them.
+        if ( bmp.GetScaleFactor() != 1.0 || bmp.GetSize() != m_size )
+        {
+            m_atlasUnusable = true;
+            return false;
+        }
+
+        // Convert the mask, if any, to alpha, as the atlas can only use one of
+        // them for all its images.
+        wxImage img = bmp.ConvertToImage();
+        if ( !img.HasAlpha() )
+            img.InitAlpha();
+
+        atlas.Paste(img, (n % cols)*m_size.x, (n / cols)*m_size.y);
+    }
+
+    m_atlas = wxBitmap(atlas);
+    m_atlasDC.reset(new wxMemoryDC);
+    m_atlasDC->SelectObjectAsSource(m_atlas);
+    if ( !m_atlasDC->IsOk() )
+    {
+        InvalidateAtlas();
+        m_atlasUnusable = true;
+        return false;
+    }
+
+    return true;
+#else // !wxUSE_IMAGE
+    m_atlasUnusable = true;
+    return false;
+#endif // wxUSE_IMAGE/!wxUSE_IMAGE
+}
+
 bool wxGenericImageList::Draw( int index, wxDC &dc, int x, int y,
                         int flags, bool WXUNUSED(solidBackground) )
 {
@@ -262,7 +361,19 @@ bool wxGenericImageList::Draw( int index, wxDC &dc, int x, int y,
     if ( !bmp )
         return false;
 
-    dc.DrawBitmap(*bmp, x, y, (flags & wxIMAGELIST_DRAW_TRANSPARENT) != 0);
+    // The atlas always uses alpha, so it can only be used when drawing the
+    // images transparently.
+    const bool transparent = (flags & wxIMAGELIST_DRAW_TRANSPARENT) != 0;
+    if ( m_atlasEnabled && transparent && UpdateAtlas() )
+    {
+        const int cols = GetAtlasColumns();
+
+        return dc.Blit(x, y, m_size.x, m_size.y, m_atlasDC.get(),
+                       (index % cols)*m_size.x, (index / cols)*m_size.y,
+                       wxCOPY, true /* use mask */);
+    }
+
+    dc.DrawBitmap(*bmp, x, y, transparent);
 
     return true;
 }
@@ -95,44 +95,43 @@ static const int MARGIN_AROUND_CHECKBOX = 5;
 // wxListItemData
 // ----------------------------------------------------------------------------
 
-wxListItemData::wxListItemData(wxListItemData&& other)
+wxListItemData::wxListItemData(wxListMainWindow *owner)
 {
-    m_owner = other.m_owner;
-
-    // Take ownership of the pointers from the other object and reset them.
-    std::swap(m_attr, other.m_attr);
-    std::swap(m_rect, other.m_rect);
+    if ( !owner->InReportView() )
+        GetExtra().m_hasRect = true;
 }
 
-wxListItemData& wxListItemData::operator=(wxListItemData&& other)
+wxListItemData::Extra& wxListItemData::GetExtra()
 {
-    m_image = other.m_image;
-    m_data = other.m_data;
-    m_owner = other.m_owner;
-
-    // Swap them to let our pointers be deleted by the other object if necessary.
-    std::swap(m_attr, other.m_attr);
-    std::swap(m_rect, other.m_rect);
+    if ( !m_extra )
+        m_extra.reset(new Extra);
 
-    return *this;
+    return *m_extra;
 }
 
-wxListItemData::~wxListItemData()
+void wxListItemData::SetImage( int image )
 {
-    // in the virtual list control the attributes are managed by the main
-    // program, so don't delete them
-    if ( !m_owner->IsVirtual() )
-        delete m_attr;
+    if ( image != -1 || m_extra )
+        GetExtra().m_image = image;
+}
 
-    delete m_rect;
+void wxListItemData::SetData( wxUIntPtr data )
+{
+    if ( data || m_extra )
+        GetExtra().m_data = data;
 }
 
-wxListItemData::wxListItemData(wxListMainWindow *owner)
+void wxListItemData::SetAttr(wxItemAttr *attr)
 {
-    m_owner = owner;
+    if ( !attr && !m_extra )
+        return;
 
-    if ( !owner->InReportView() )
-        m_rect = new wxRect;
+    Extra& extra = GetExtra();
+    if ( extra.m_ownsAttr )
+        delete extra.m_attr;
+
+    extra.m_attr = attr;
+    extra.m_ownsAttr = false;
 }
 
 // Check if the item is visible
@@ -157,78 +156,85 @@ void wxListItemData::SetItem( const wxListItem &info )
     if ( info.m_mask & wxLIST_MASK_TEXT )
         SetText(info.m_text);
     if ( info.m_mask & wxLIST_MASK_IMAGE )
-        m_image = info.m_image;
+        SetImage(info.m_image);
     if ( info.m_mask & wxLIST_MASK_DATA )
-        m_data = info.m_data;
+        SetData(info.m_data);
 
     if ( info.HasAttributes() )
     {
-        if ( m_attr )
-            m_attr->AssignFrom(*info.GetAttributes());
+        Extra& extra = GetExtra();
+        if ( extra.m_ownsAttr )
+        {
+            extra.m_attr->AssignFrom(*info.GetAttributes());
+        }
         else
-            m_attr = new wxItemAttr(*info.GetAttributes());
+        {
+            extra.m_attr = new wxItemAttr(*info.GetAttributes());
+            extra.m_ownsAttr = true;
+        }
     }
 
-    if ( m_rect )
+    if ( HasRect() )
     {
-        m_rect->x =
-        m_rect->y =
-        m_rect->height = 0;
-        m_rect->width = info.m_width;
+        wxRect& rect = m_extra->m_rect;
+        rect.x =
+        rect.y =
+        rect.height = 0;
+        rect.width = info.m_width;
     }
 }
 
 void wxListItemData::SetPosition( int x, int y )
 {
-    wxCHECK_RET( m_rect, wxT("unexpected SetPosition() call") );
+    wxCHECK_RET( HasRect(), wxT("unexpected SetPosition() call") );
 
-    m_rect->x = x;
-    m_rect->y = y;
+    m_extra->m_rect.x = x;
+    m_extra->m_rect.y = y;
 }
 
 void wxListItemData::SetSize( int width, int height )
 {
-    wxCHECK_RET( m_rect, wxT("unexpected SetSize() call") );
+    wxCHECK_RET( HasRect(), wxT("unexpected SetSize() call") );
 
     if ( width != -1 )
-        m_rect->width = width;
+        m_extra->m_rect.width = width;
     if ( height != -1 )
-        m_rect->height = height;
+        m_extra->m_rect.height = height;
 }
 
 bool wxListItemData::IsHit( int x, int y ) const
 {
-    wxCHECK_MSG( m_rect, false, wxT("can't be called in this mode") );
+    wxCHECK_MSG( HasRect(), false, wxT("can't be called in this mode") );
 
-    return wxRect(GetX(), GetY(), GetWidth(), GetHeight()).Contains(x, y);
+    return m_extra->m_rect.Contains(x, y);
 }
 
 int wxListItemData::GetX() const
 {
-    wxCHECK_MSG( m_rect, 0, wxT("can't be called in this mode") );
+    wxCHECK_MSG( HasRect(), 0, wxT("can't be called in this mode") );
 
-    return m_rect->x;
+    return m_extra->m_rect.x;
 }
 
 int wxListItemData::GetY() const
 {
-    wxCHECK_MSG( m_rect, 0, wxT("can't be called in this mode") );
+    wxCHECK_MSG( HasRect(), 0, wxT("can't be called in this mode") );
 
-    return m_rect->y;
+    return m_extra->m_rect.y;
 }
 
 int wxListItemData::GetWidth() const
 {
-    wxCHECK_MSG( m_rect, 0, wxT("can't be called in this mode") );
+    wxCHECK_MSG( HasRect(), 0, wxT("can't be called in this mode") );
 
-    return m_rect->width;
+    return m_extra->m_rect.width;
 }
 
 int wxListItemData::GetHeight() const
 {
-    wxCHECK_MSG( m_rect, 0, wxT("can't be called in this mode") );
+    wxCHECK_MSG( HasRect(), 0, wxT("can't be called in this mode") );
 
-    return m_rect->height;
+    return m_extra->m_rect.height;
 }
 
 void wxListItemData::GetItem( wxListItem &info ) const
@@ -241,18 +247,18 @@ void wxListItemData::GetItem( wxListItem &info ) const
     if ( mask & wxLIST_MASK_TEXT )
         info.m_text = m_text;
     if ( mask & wxLIST_MASK_IMAGE )
-        info.m_image = m_image;
+        info.m_image = GetImage();
     if ( mask & wxLIST_MASK_DATA )
-        info.m_data = m_data;
+        info.m_data = m_extra ? m_extra->m_data : 0;
 
-    if ( m_attr )
+    if ( const wxItemAttr* const attr = GetAttr() )
     {
-        if ( m_attr->HasTextColour() )
-            info.SetTextColour(m_attr->GetTextColour());
-        if ( m_attr->HasBackgroundColour() )
-            info.SetBackgroundColour(m_attr->GetBackgroundColour());
-        if ( m_attr->HasFont() )
-            info.SetFont(m_attr->GetFont());
+        if ( attr->HasTextColour() )
+            info.SetTextColour(attr->GetTextColour());
+        if ( attr->HasBackgroundColour() )
+            info.SetBackgroundColour(attr->GetBackgroundColour());
+        if ( attr->HasFont() )
+            info.SetFont(attr->GetFont());
     }
 }
 
@@ -3387,8 +3393,10 @@ class wxListCtrlMaxWidthCalculator : public wxMaxWidthCalculatorBase
 public:
     wxListCtrlMaxWidthCalculator(wxListMainWindow *listmain, unsigned int column)
         : wxMaxWidthCalculatorBase(column),
-          m_listmain(listmain)
+          m_listmain(listmain),
+          m_dc(listmain)
     {
+        m_dc.SetFont(listmain->GetFont());
     }
 
     virtual void UpdateWithRow(int row) override
@@ -3398,11 +3406,51 @@ public:
         wxListItem item;
         line->m_items.at(GetColumn()).GetItem(item);
 
-        UpdateWithWidth(m_listmain->GetItemWidthWithImage(&item));
+        const int imageWidth = m_listmain->GetItemImageWidth(item);
+        if ( item.GetText().empty() )
+        {
+            UpdateWithWidth(imageWidth);
+            return;
+        }
+
+        // Don't measure the text immediately but collect several strings to
+        // measure them all at once, which is much faster. Note that we still
+        // need to do it often enough for the timeout check done by the base
+        // class to work.
+        m_texts.push_back(item.GetText());
+        m_imageWidths.push_back(imageWidth);
+
+        if ( m_texts.size() == BATCH_SIZE )
+            MeasurePendingRows();
+    }
+
+    // Must be called before using GetMaxWidth() to account for all rows.
+    void MeasurePendingRows()
+    {
+        if ( m_texts.empty() )
+            return;
+
+        wxArrayInt widths;
+        m_dc.GetTextExtents(m_texts, widths);
+
+        for ( size_t n = 0; n < widths.size(); n++ )
+            UpdateWithWidth(m_imageWidths[n] + widths[n]);
+
+        m_texts.clear();
+        m_imageWidths.clear();
     }
 
 private:
+    static const size_t BATCH_SIZE = 50;
+
     wxListMainWindow* const m_listmain;
+
+    wxClientDC m_dc;
+
+    // Texts of the rows which haven't been measured yet and the widths of
+    // their images.
+    wxArrayString m_texts;
+    wxArrayInt m_imageWidths;
 };
 
 
@@ -3443,6 +3491,7 @@ void wxListMainWindow::SetColumnWidth( int col, int width )
 
             calculator.ComputeBestColumnWidth(GetItemCount(),
                                               first_visible, last_visible);
+            calculator.MeasurePendingRows();
             widthInfo.nMaxWidth = calculator.GetMaxWidth();
             widthInfo.bNeedsUpdate = false;
         }
@@ -3985,7 +4034,7 @@ void wxListMainWindow::RecalculatePositions()
     wxClientDC dc( this );
     dc.SetFont( GetFont() );
 
-    const size_t count = GetItemCount();
+    const size_t count = (size_t)GetItemCount();
 
     int iconSpacing;
     if ( HasFlag(wxLC_ICON) && m_normal_images )
@@ -4238,6 +4287,14 @@ long wxListMainWindow::GetNextItem( long item,
         // any will do
         return (size_t)ret;
 
+    if ( state == wxLIST_STATE_SELECTED && IsVirtual() )
+    {
+        // the selection store can find the next selected item directly,
+        // without checking all the items, of which there can be many
+        const unsigned line = m_selStore.FindSelectedItem(ret);
+        return line == wxSelectionStore::NO_SELECTION ? -1 : (long)line;
+    }
+
     size_t count = GetItemCount();
     for ( size_t line = (size_t)ret; line < count; line++ )
     {
@@ -4648,22 +4705,25 @@ long wxListMainWindow::InsertColumn( long col, const wxListItem &item )
     return idx;
 }
 
-int wxListMainWindow::GetItemWidthWithImage(wxListItem * item)
+int wxListMainWindow::GetItemImageWidth(const wxListItem& item) const
 {
-    int width = 0;
-    wxClientDC dc(this);
+    if ( item.GetImage() == -1 )
+        return 0;
 
-    dc.SetFont( GetFont() );
+    int ix, iy;
+    GetImageSize( item.GetImage(), ix, iy );
+    return ix + IMAGE_MARGIN_IN_REPORT_MODE;
+}
 
-    if (item->GetImage() != -1)
-    {
-        int ix, iy;
-        GetImageSize( item->GetImage(), ix, iy );
-        width += ix + IMAGE_MARGIN_IN_REPORT_MODE;
-    }
+int wxListMainWindow::GetItemWidthWithImage(wxListItem * item)
+{
+    int width = GetItemImageWidth(*item);
 
     if (!item->GetText().empty())
     {
+        wxClientDC dc(this);
+        dc.SetFont( GetFont() );
+
         wxCoord w;
         dc.GetTextExtent( item->GetText(), &w, nullptr );
         width += w;
@@ -4791,45 +4851,70 @@ wxListMainWindow::PrefixFindItem(size_t idParent,
     if ( idParent == (size_t)-1 )
         return idParent;
 
-    // match is case insensitive as this is more convenient to the user: having
-    // to press Shift-letter to go to the item starting with a capital letter
-    // would be too bothersome
-    wxString prefix = prefixOrig.Lower();
-
     // determine the starting point: we shouldn't take the current item (this
     // allows to switch between two items starting with the same letter just by
     // pressing it) but we shouldn't jump to the next one if the user is
     // continuing to type as otherwise he might easily skip the item he wanted
     size_t itemid = idParent;
-    if ( prefix.length() == 1 )
+    if ( prefixOrig.length() == 1 )
     {
         itemid += 1;
     }
 
+    const size_t count = (size_t)GetItemCount();
+
+    if ( IsVirtual() )
+    {
+        // let the virtual control find the item itself if it can, searching
+        // all items one by one can take a long time if there are many of them
+        long found;
+        if ( GetListCtrl()->OnFindItemByPrefix(itemid < count ? itemid : 0,
+                                               prefixOrig, found) )
+        {
+            wxCHECK_MSG( found >= -1 && found < (long)count, (size_t)-1,
+                         "invalid item returned by OnFindItemByPrefix()" );
+
+            return found == -1 ? (size_t)-1 : (size_t)found;
+        }
+    }
+
+    // match is case insensitive as this is more convenient to the user: having
+    // to press Shift-letter to go to the item starting with a capital letter
+    // would be too bothersome
+    const wxString prefix = prefixOrig.Lower();
+
+    const auto matches = [this, &prefix](size_t line)
+    {
+        // don't use GetLine() for the virtual controls as it would retrieve
+        // all the other attributes of the item too
+        const wxString text = IsVirtual()
+                                ? GetListCtrl()->OnGetItemText(line, 0)
+                                : GetLine(line)->GetText(0);
+
+        return text.Lower().StartsWith(prefix);
+    };
+
     // look for the item starting with the given prefix after it
-    while ( ( itemid < (size_t)GetItemCount() ) &&
-            !GetLine(itemid)->GetText(0).Lower().StartsWith(prefix) )
+    while ( ( itemid < count ) && !matches(itemid) )
     {
         itemid += 1;
     }
 
     // if we haven't found anything...
-    if ( !( itemid < (size_t)GetItemCount() ) )
+    if ( !( itemid < count ) )
     {
         // ... wrap to the beginning
         itemid = 0;
 
         // and try all the items (stop when we get to the one we started from)
-        while ( ( itemid < (size_t)GetItemCount() ) && itemid != idParent &&
-                    !GetLine(itemid)->GetText(0).Lower().StartsWith(prefix) )
+        while ( ( itemid < count ) && itemid != idParent && !matches(itemid) )
         {
             itemid += 1;
         }
         // If we haven't found the item, id will be (size_t)-1, as per
         // documentation
-        if ( !( itemid < (size_t)GetItemCount() ) ||
-             ( ( itemid == idParent ) &&
-               !GetLine(itemid)->GetText(0).Lower().StartsWith(prefix) ) )
+        if ( !( itemid < count ) ||
+             ( ( itemid == idParent ) && !matches(itemid) ) )
         {
             itemid = (size_t)-1;
         }
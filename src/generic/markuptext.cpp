@@ -35,13 +35,45 @@
 
 #if wxUSE_GRAPHICS_CONTEXT
     #include "wx/graphics.h"
-
-    #include <memory>
 #endif
 
+#include <memory>
+#include <unordered_map>
+
 namespace
 {
 
+// ----------------------------------------------------------------------------
+// Cache of the parsed markup strings
+// ----------------------------------------------------------------------------
+
+// The same markup strings are typically measured and rendered many times, e.g.
+// when wxDataViewCtrl is repainted, so keep the results of parsing them.
+//
+// Note that this is only used from the main thread, as wxMarkupText itself.
+std::shared_ptr<const wxMarkupParsedText> GetParsedFromCache(const wxString& markup)
+{
+    using Cache = std::unordered_map<wxString, std::shared_ptr<const wxMarkupParsedText>>;
+    static Cache s_cache;
+
+    const auto it = s_cache.find(markup);
+    if ( it != s_cache.end() )
+        return it->second;
+
+    // Don't let the cache grow indefinitely, just start anew when it becomes
+    // too big: this is simple and good enough as the strings in use at any
+    // given moment will be quickly parsed and cached again.
+    if ( s_cache.size() >= 1024 )
+        s_cache.clear();
+
+    auto parsed = std::make_shared<wxMarkupParsedText>();
+    parsed->Parse(markup);
+
+    s_cache.emplace(markup, parsed);
+
+    return parsed;
+}
+
 // ----------------------------------------------------------------------------
 // wxMarkupParserMeasureOutput: measure the extends of a markup string.
 // ----------------------------------------------------------------------------
@@ -309,16 +341,34 @@ private:
 // wxMarkupText implementation
 // ============================================================================
 
+const wxMarkupParsedText& wxMarkupTextBase::GetParsedMarkup() const
+{
+    if ( !m_parsed )
+        m_parsed = GetParsedFromCache(m_markup);
+
+    return *m_parsed;
+}
+
+const wxMarkupParsedText& wxMarkupTextBase::GetParsedMarkupForMeasuring() const
+{
+    if ( !m_parsedForMeasuring )
+        m_parsedForMeasuring = GetParsedFromCache(GetMarkupForMeasuring());
+
+    return *m_parsedForMeasuring;
+}
+
 wxSize wxMarkupTextBase::Measure(wxDC& dc, int *visibleHeight) const
 {
-    wxMarkupParserMeasureOutput out(dc, visibleHeight);
-    wxMarkupParser parser(out);
-    if ( !parser.Parse(GetMarkupForMeasuring()) )
+    const wxMarkupParsedText& parsed = GetParsedMarkupForMeasuring();
+    if ( !parsed.IsOk() )
     {
         wxFAIL_MSG( "Invalid markup" );
         return wxDefaultSize;
     }
 
+    wxMarkupParserMeasureOutput out(dc, visibleHeight);
+    parsed.Output(out);
+
     return out.GetSize();
 }
 
@@ -337,8 +387,7 @@ void wxMarkupText::Render(wxDC& dc, const wxRect& rect, int flags)
     rectText.height = visibleHeight;
 
     wxMarkupParserRenderLabelOutput out(dc, rectText.CentreIn(rect), flags);
-    wxMarkupParser parser(out);
-    parser.Parse(m_markup);
+    GetParsedMarkup().Output(out);
 }
 
 
@@ -353,8 +402,7 @@ void wxItemMarkupText::Render(wxWindow *win,
                               wxEllipsizeMode ellipsizeMode)
 {
     wxMarkupParserRenderItemOutput out(win, dc, rect, rendererFlags, ellipsizeMode);
-    wxMarkupParser parser(out);
-    parser.Parse(m_markup);
+    GetParsedMarkup().Output(out);
 }
 
 #endif // wxUSE_MARKUP
@@ -18,6 +18,8 @@
     #include "wx/utils.h"
 #endif
 
+#include <algorithm>
+
 // ========================================================================
 // Classes to interface with X.org code
 // ========================================================================
@@ -84,6 +86,16 @@ public:
         unsigned int rwidth, unsigned int rheight);
 
 protected:
+    static BoxPtr miFindBand(
+        Region pReg,
+        wxCoord y);
+    static bool miUnionAppend(
+        Region top,
+        Region bottom,
+        Region newReg);
+    static bool miUnionAppendToBand(
+        Region pReg,
+        const Box& box);
     static Region XCreateRegion(void);
     static void miSetExtents (
         Region pReg);
@@ -214,9 +226,11 @@ public:
         : wxGDIRefData(),
           REGION()
     {
-        size = refData.size;
+        // Note that the array must be big enough for at least one box, as
+        // in all the other regions.
+        size = wxMax(refData.numRects, 1);
         numRects = refData.numRects;
-        rects = (Box*)malloc(numRects*sizeof(Box));
+        rects = (Box*)malloc(size*sizeof(Box));
         memcpy(rects, refData.rects, numRects*sizeof(Box));
         extents = refData.extents;
     }
@@ -354,7 +368,8 @@ bool wxRegionGeneric::DoSubtract(const wxRegion& region)
         return true;
     }
 
-    return REGION::XSubtractRegion(M_REGIONDATA_OF(region),M_REGIONDATA,M_REGIONDATA);
+    AllocExclusive();
+    return REGION::XSubtractRegion(M_REGIONDATA,M_REGIONDATA_OF(region),M_REGIONDATA);
 }
 
 bool wxRegionGeneric::DoXor(const wxRegion& region)
@@ -1475,6 +1490,162 @@ miUnionO (
     return 0;        /* lint */
 }
 
+/*-
+ *-----------------------------------------------------------------------
+ * miUnionAppend --
+ *        Handle the union of two regions when one of them lies completely
+ *        above the other one: the result is just the concatenation of their
+ *        boxes, with the bands at the boundary coalesced if possible.
+ *
+ *        This is a common case when accumulating the rectangles to update,
+ *        and when the destination is the top region, its boxes are not
+ *        copied at all, so that adding N rectangles one by one from top to
+ *        bottom takes O(N) and not O(N^2) time.
+ *
+ * Results:
+ *        false if memory allocation failed.
+ *
+ * Side Effects:
+ *        newReg is overwritten.
+ *
+ *-----------------------------------------------------------------------
+ */
+bool REGION::
+miUnionAppend(
+    Region           top,
+    Region           bottom,
+    Region           newReg)
+{
+    const long topNumRects = top->numRects;
+    const long numRects = topNumRects + bottom->numRects;
+
+    Box extents;
+    extents.x1 = wxMin(top->extents.x1, bottom->extents.x1);
+    extents.y1 = top->extents.y1;
+    extents.x2 = wxMax(top->extents.x2, bottom->extents.x2);
+    extents.y2 = bottom->extents.y2;
+
+    if (newReg == top)
+    {
+        if (newReg->size < numRects)
+        {
+            /* Grow the array geometrically to amortize the cost of this */
+            const long size = wxMax(numRects, 2*newReg->size);
+            BoxPtr rects = (BoxPtr)realloc((char *) newReg->rects,
+                                           (unsigned) (sizeof(BoxRec) * size));
+            if (!rects)
+                return false;
+
+            newReg->rects = rects;
+            newReg->size = size;
+        }
+
+        memcpy((char *) &newReg->rects[topNumRects], (char *) bottom->rects,
+               (int) (bottom->numRects * sizeof(BoxRec)));
+    }
+    else
+    {
+        BoxPtr rects = (BoxPtr)malloc((unsigned) (sizeof(BoxRec) * numRects));
+        if (!rects)
+            return false;
+
+        memcpy((char *) rects, (char *) top->rects,
+               (int) (topNumRects * sizeof(BoxRec)));
+        memcpy((char *) &rects[topNumRects], (char *) bottom->rects,
+               (int) (bottom->numRects * sizeof(BoxRec)));
+
+        free((char *) newReg->rects);
+        newReg->rects = rects;
+        newReg->size = numRects;
+    }
+
+    newReg->numRects = numRects;
+    newReg->extents = extents;
+
+    /* Find the start of the last band of the top region and coalesce it */
+    long prevBand = topNumRects - 1;
+    while (prevBand > 0 &&
+           newReg->rects[prevBand - 1].y1 == newReg->rects[topNumRects - 1].y1)
+    {
+        prevBand--;
+    }
+
+    (void) miCoalesce(newReg, prevBand, topNumRects);
+
+    return true;
+}
+
+/*-
+ *-----------------------------------------------------------------------
+ * miUnionAppendToBand --
+ *        Handle the union of the region with a box to the right of all the
+ *        boxes in its last band and spanning exactly the same rows. This is
+ *        a common case when adding the rectangles from left to right.
+ *
+ * Results:
+ *        false if memory allocation failed.
+ *
+ * Side Effects:
+ *        The box is merged into pReg.
+ *
+ *-----------------------------------------------------------------------
+ */
+bool REGION::
+miUnionAppendToBand(
+    Region           pReg,
+    const Box&       box)
+{
+    BoxPtr pLast = &pReg->rects[pReg->numRects - 1];
+
+    if (pLast->x2 == box.x1)
+    {
+        pLast->x2 = box.x2;
+    }
+    else
+    {
+        if (pReg->numRects == pReg->size)
+        {
+            const long size = 2*pReg->size;
+            BoxPtr rects = (BoxPtr)realloc((char *) pReg->rects,
+                                           (unsigned) (sizeof(BoxRec) * size));
+            if (!rects)
+                return false;
+
+            pReg->rects = rects;
+            pReg->size = size;
+        }
+
+        pReg->rects[pReg->numRects++] = box;
+    }
+
+    if (box.x2 > pReg->extents.x2)
+        pReg->extents.x2 = box.x2;
+
+    /*
+     * The modified band could now be the same as the previous one, so try
+     * to coalesce them to keep the region in the canonical form.
+     */
+    long curBand = pReg->numRects - 1;
+    while (curBand > 0 && pReg->rects[curBand - 1].y1 == box.y1)
+    {
+        curBand--;
+    }
+
+    if (curBand > 0)
+    {
+        long prevBand = curBand - 1;
+        const wxCoord prevY1 = pReg->rects[prevBand].y1;
+        while (prevBand > 0 && pReg->rects[prevBand - 1].y1 == prevY1)
+        {
+            prevBand--;
+        }
+
+        (void) miCoalesce(pReg, prevBand, curBand);
+    }
+
+    return true;
+}
+
 bool REGION::
 XUnionRegion(
     Region           reg1,
@@ -1531,6 +1702,32 @@ XUnionRegion(
         return 1;
     }
 
+    /*
+     * One of the regions is completely below the other one
+     */
+    if (reg1->extents.y2 <= reg2->extents.y1)
+        return miUnionAppend(reg1, reg2, newReg);
+
+    if (reg2->extents.y2 <= reg1->extents.y1)
+        return miUnionAppend(reg2, reg1, newReg);
+
+    /*
+     * A single box is added to the right of the last band of the region
+     */
+    for (int i = 0; i < 2; i++)
+    {
+        Region const pReg = i == 0 ? reg1 : reg2;
+        Region const pOther = i == 0 ? reg2 : reg1;
+
+        if (newReg != pReg || pOther->numRects != 1)
+            continue;
+
+        const Box& box = pOther->rects[0];
+        const Box& last = pReg->rects[pReg->numRects - 1];
+        if (box.y1 == last.y1 && box.y2 == last.y2 && box.x1 >= last.x2)
+            return miUnionAppendToBand(pReg, box);
+    }
+
     miRegionOp (newReg, reg1, reg2, miUnionO,
                     miUnionNonO, miUnionNonO);
 
@@ -1831,17 +2028,33 @@ bool REGION::XEqualRegion(Region r1, Region r2)
     return true;
 }
 
-bool REGION::XPointInRegion(Region pRegion, int x, int y)
+/*
+ *        Return the first box which is not completely above the given row
+ *        or the end of the boxes if there is none: as the bands are sorted,
+ *        binary search can be used to find it.
+ */
+BoxPtr REGION::miFindBand(Region pReg, wxCoord y)
 {
-    int i;
+    return std::lower_bound(pReg->rects, pReg->rects + pReg->numRects, y,
+                            [](const Box& box, wxCoord y) { return box.y2 <= y; });
+}
 
+bool REGION::XPointInRegion(Region pRegion, int x, int y)
+{
     if (pRegion->numRects == 0)
         return false;
     if (!INBOX(pRegion->extents, x, y))
         return false;
-    for (i=0; i<pRegion->numRects; i++)
+
+    const BoxPtr pboxEnd = pRegion->rects + pRegion->numRects;
+    for (BoxPtr pbox = miFindBand(pRegion, y);
+         pbox != pboxEnd && pbox->y1 <= y;
+         pbox++)
     {
-        if (INBOX (pRegion->rects[i], x, y))
+        if (pbox->x1 > x)
+            break;      /* the boxes in the band are sorted by x */
+
+        if (INBOX (*pbox, x, y))
             return true;
     }
     return false;
@@ -1871,7 +2084,7 @@ wxRegionContain REGION::XRectInRegion(Region region,
     partIn = false;
 
     /* can stop when both partOut and partIn are true, or we reach prect->y2 */
-    for (pbox = region->rects, pboxEnd = pbox + region->numRects;
+    for (pbox = miFindBand(region, ry), pboxEnd = region->rects + region->numRects;
          pbox < pboxEnd;
          pbox++)
     {
@@ -189,27 +189,57 @@ unsigned int RowRanges::CountTo(unsigned int row) const
 // HeightCache
 // ----------------------------------------------------------------------------
 
+namespace
+{
+
+// Return the value of the lowest bit set in the given number.
+inline unsigned int LowBit(unsigned int n)
+{
+    return n & (~n + 1);
+}
+
+} // anonymous namespace
+
+void HeightCache::Append(int height)
+{
+    // The new node covers the rows [n + 1 - lowbit(n + 1), n], so its value
+    // is the sum of the new row height and of the nodes covering the rows
+    // before it in this range.
+    const unsigned int n = m_tree.size();
+    const unsigned int first = n + 1 - LowBit(n + 1);
+
+    int sum = height;
+    for ( unsigned int i = n; i > first; i -= LowBit(i) )
+        sum += m_tree[i - 1];
+
+    m_tree.push_back(sum);
+}
+
+void HeightCache::AddToTree(unsigned int row, int diff)
+{
+    const unsigned int count = m_tree.size();
+    for ( unsigned int i = row + 1; i <= count; i += LowBit(i) )
+        m_tree[i - 1] += diff;
+}
+
+int HeightCache::GetSumBefore(unsigned int row) const
+{
+    int sum = 0;
+    for ( unsigned int i = row; i > 0; i -= LowBit(i) )
+        sum += m_tree[i - 1];
+
+    return sum;
+}
+
 bool HeightCache::GetLineInfo(unsigned int row, int &start, int &height)
 {
-    int y = 0;
-    bool found = false;
+    if ( row >= m_validCount )
+        return false;
 
-    for ( const auto& kv : m_heightToRowRange )
-    {
-        int rowHeight = kv.first;
-        const RowRanges& rowRanges = kv.second;
-        if (rowRanges.Has(row))
-        {
-            height = rowHeight;
-            found = true;
-        }
-        y += rowHeight * (rowRanges.CountTo(row));
-    }
-    if (found)
-    {
-        start = y;
-    }
-    return found;
+    start = GetSumBefore(row);
+    height = m_heights[row];
+
+    return true;
 }
 
 bool HeightCache::GetLineStart(unsigned int row, int &start)
@@ -220,92 +250,99 @@ bool HeightCache::GetLineStart(unsigned int row, int &start)
 
 bool HeightCache::GetLineHeight(unsigned int row, int &height)
 {
-    for ( const auto& kv : m_heightToRowRange )
-    {
-        int rowHeight = kv.first;
-        const RowRanges& rowRanges = kv.second;
-        if (rowRanges.Has(row))
-        {
-            height = rowHeight;
-            return true;
-        }
-    }
-    return false;
+    if ( row >= m_heights.size() || m_heights[row] == -1 )
+        return false;
+
+    height = m_heights[row];
+    return true;
 }
 
 bool HeightCache::GetLineAt(int y, unsigned int &row)
 {
-    unsigned int total = 0;
+    if ( y < 0 || !m_validCount )
+        return false;
 
-    for ( const auto& kv : m_heightToRowRange )
-    {
-        const RowRanges& rowRanges = kv.second;
-        total += rowRanges.CountAll();
-    }
+    // Find the number of rows ending at or before y, i.e. the index of the
+    // row containing it, by descending the tree.
+    const unsigned int count = m_tree.size();
 
-    if (total == 0)
-    {
-        return false;
-    }
+    unsigned int step = 1;
+    while ( step <= count / 2 )
+        step *= 2;
 
-    int lo = 0;
-    int hi = total;
-    int start, height;
-    while (lo < hi)
+    unsigned int pos = 0;
+    int remaining = y;
+    for ( ; step; step /= 2 )
     {
-        int mid = (lo + hi) / 2;
-        if (GetLineInfo(mid, start, height))
+        const unsigned int next = pos + step;
+        if ( next <= count && m_tree[next - 1] <= remaining )
         {
-            if (start + height <= y)
-            {
-                lo = mid + 1;
-            }
-            else
-            {
-                hi = mid;
-            }
-        }
-        else
-        {
-            // should never happen, except the HeightCache has gaps which is an
-            // invalid state
-            return false;
+            pos = next;
+            remaining -= m_tree[next - 1];
         }
     }
-    if (GetLineInfo(lo, start, height))
+
+    // The rows after the first gap have unknown positions, so we can't say
+    // anything about them, and the position after the last row is invalid.
+    if ( pos >= m_validCount )
+        return false;
+
+    row = pos;
+    return true;
+}
+
+void HeightCache::Put(unsigned int row, int height)
+{
+    wxCHECK_RET( height >= 0, "invalid row height" );
+
+    if ( row >= m_heights.size() )
     {
-        if (y < start)
+        // Add the rows of unknown height before this one, if necessary.
+        while ( m_heights.size() < row )
         {
-            // given y point is before the first row
-            return false;
+            m_heights.push_back(-1);
+            Append(0);
         }
-        row = lo;
-        return true;
+
+        m_heights.push_back(height);
+        Append(height);
     }
-    else
+    else // Update the existing row.
     {
-        // given y point is after the last row
-        return false;
+        const int old = m_heights[row];
+        m_heights[row] = height;
+
+        AddToTree(row, old == -1 ? height : height - old);
     }
-}
 
-void HeightCache::Put(unsigned int row, int height)
-{
-    m_heightToRowRange[height].Add(row);
+    // Filling a gap may have made more rows valid.
+    if ( row == m_validCount )
+    {
+        const unsigned int count = m_heights.size();
+        while ( m_validCount < count && m_heights[m_validCount] != -1 )
+            m_validCount++;
+    }
 }
 
 void HeightCache::Remove(unsigned int row)
 {
-    for ( auto& kv : m_heightToRowRange )
-    {
-        RowRanges& rowRanges = kv.second;
-        rowRanges.Remove(row);
-    }
+    if ( row >= m_heights.size() )
+        return;
+
+    // Note that the remaining part of the tree doesn't depend on the rows
+    // being removed, so it doesn't need to be updated.
+    m_heights.resize(row);
+    m_tree.resize(row);
+
+    if ( m_validCount > row )
+        m_validCount = row;
 }
 
 void HeightCache::Clear()
 {
-    m_heightToRowRange.clear();
+    m_heights.clear();
+    m_tree.clear();
+    m_validCount = 0;
 }
 
 HeightCache::~HeightCache()
@@ -20,168 +20,256 @@
 
 #include "wx/selstore.h"
 
+#include <algorithm>
+
 // ============================================================================
 // wxSelectionStore
 // ============================================================================
 
 const unsigned wxSelectionStore::NO_SELECTION = static_cast<unsigned>(-1);
 
-// ----------------------------------------------------------------------------
-// tests
-// ----------------------------------------------------------------------------
+namespace
+{
 
-bool wxSelectionStore::IsSelected(unsigned item) const
+// 100 is hardcoded but it shouldn't matter much: the important thing is that
+// we don't refresh everything when really few (e.g. 1 or 2) items change state
+const unsigned MANY_ITEMS = 100;
+
+// Add the indices of the items in the given range to the array unless it's
+// null or already contains more than MANY_ITEMS elements, as there is no need
+// to keep track of the individual items then.
+void AddChangedItems(wxArrayInt *itemsChanged, unsigned from, unsigned to)
 {
-    bool isSel = m_itemsSel.Index(item) != wxNOT_FOUND;
+    if ( !itemsChanged )
+        return;
 
-    // if the default state is to be selected, being in m_itemsSel means that
-    // the item is not selected, so we have to inverse the logic
-    return m_defaultState ? !isSel : isSel;
+    for ( unsigned item = from;
+          item <= to && itemsChanged->size() <= MANY_ITEMS;
+          item++ )
+    {
+        itemsChanged->push_back(item);
+    }
 }
 
+} // anonymous namespace
+
 // ----------------------------------------------------------------------------
-// Select*()
+// ranges management
 // ----------------------------------------------------------------------------
 
-bool wxSelectionStore::SelectItem(unsigned item, bool select)
+size_t wxSelectionStore::FindRange(unsigned item) const
 {
-    // search for the item ourselves as like this we get the index where to
-    // insert it later if needed, so we do only one search in the array instead
-    // of two (adding item to a sorted array requires a search)
-    size_t index = m_itemsSel.IndexForInsert(item);
-    bool isSel = index < m_itemsSel.GetCount() && m_itemsSel[index] == item;
+    const Ranges::const_iterator it =
+        std::lower_bound(m_ranges.begin(), m_ranges.end(), item,
+                         [](const Range& range, unsigned n)
+                         {
+                             return range.to < n;
+                         });
+
+    return it - m_ranges.begin();
+}
 
-    if ( select != m_defaultState )
+unsigned wxSelectionStore::SetNonDefault(unsigned itemFrom, unsigned itemTo,
+                                         wxArrayInt *itemsChanged)
+{
+    // All the existing ranges overlapping or adjacent to the new one are
+    // merged with it, start with the first of them.
+    const size_t first = FindRange(itemFrom ? itemFrom - 1 : 0);
+
+    unsigned numChanged = 0;
+
+    // The first item of the new range not covered by any existing ones yet.
+    unsigned next = itemFrom;
+
+    size_t last;
+    for ( last = first; last < m_ranges.size(); last++ )
     {
-        if ( !isSel )
+        const Range& range = m_ranges[last];
+        if ( range.from > itemTo && range.from - itemTo > 1 )
+            break;
+
+        // The items in the gap before this range change their state.
+        if ( range.from > next )
         {
-            m_itemsSel.AddAt(item, index);
+            const unsigned gapTo = std::min(range.from - 1, itemTo);
 
-            return true;
+            numChanged += gapTo - next + 1;
+            AddChangedItems(itemsChanged, next, gapTo);
         }
+
+        if ( range.to >= next )
+            next = range.to + 1;
+    }
+
+    // And so do the items after the last overlapping range.
+    if ( next <= itemTo )
+    {
+        numChanged += itemTo - next + 1;
+        AddChangedItems(itemsChanged, next, itemTo);
+    }
+
+    Range merged;
+    merged.from = itemFrom;
+    merged.to = itemTo;
+
+    if ( first < last )
+    {
+        merged.from = std::min(merged.from, m_ranges[first].from);
+        merged.to = std::max(merged.to, m_ranges[last - 1].to);
+
+        m_ranges[first] = merged;
+        m_ranges.erase(m_ranges.begin() + first + 1, m_ranges.begin() + last);
+    }
+    else
+    {
+        m_ranges.insert(m_ranges.begin() + first, merged);
+    }
+
+    m_numNonDefault += numChanged;
+
+    return numChanged;
+}
+
+unsigned wxSelectionStore::SetDefault(unsigned itemFrom, unsigned itemTo,
+                                      wxArrayInt *itemsChanged)
+{
+    // Find all the ranges overlapping the given one.
+    const size_t first = FindRange(itemFrom);
+
+    unsigned numChanged = 0;
+
+    size_t last;
+    for ( last = first;
+          last < m_ranges.size() && m_ranges[last].from <= itemTo;
+          last++ )
+    {
+        const Range& range = m_ranges[last];
+        const unsigned from = std::max(range.from, itemFrom),
+                       to = std::min(range.to, itemTo);
+
+        numChanged += to - from + 1;
+        AddChangedItems(itemsChanged, from, to);
+    }
+
+    if ( first == last )
+        return 0;
+
+    // The parts of the first and last ranges outside of the given one remain.
+    Ranges remaining;
+    if ( m_ranges[first].from < itemFrom )
+    {
+        Range left;
+        left.from = m_ranges[first].from;
+        left.to = itemFrom - 1;
+        remaining.push_back(left);
     }
-    else // reset to default state
+
+    if ( m_ranges[last - 1].to > itemTo )
     {
-        if ( isSel )
+        Range right;
+        right.from = itemTo + 1;
+        right.to = m_ranges[last - 1].to;
+        remaining.push_back(right);
+    }
+
+    m_ranges.erase(m_ranges.begin() + first, m_ranges.begin() + last);
+    m_ranges.insert(m_ranges.begin() + first, remaining.begin(), remaining.end());
+
+    m_numNonDefault -= numChanged;
+
+    return numChanged;
+}
+
+void wxSelectionStore::InvertDefaultState()
+{
+    // The items which had the default state now have the non-default one and
+    // vice versa, so just use the gaps between the existing ranges.
+    Ranges inverted;
+    unsigned numNonDefault = 0;
+
+    Range gap;
+    gap.from = 0;
+    for ( Ranges::const_iterator it = m_ranges.begin();
+          it != m_ranges.end() && it->from < m_count;
+          ++it )
+    {
+        if ( it->from > gap.from )
         {
-            m_itemsSel.RemoveAt(index);
-            return true;
+            gap.to = it->from - 1;
+            inverted.push_back(gap);
+            numNonDefault += gap.to - gap.from + 1;
         }
+
+        gap.from = it->to + 1;
     }
 
-    return false;
+    if ( gap.from < m_count )
+    {
+        gap.to = m_count - 1;
+        inverted.push_back(gap);
+        numNonDefault += gap.to - gap.from + 1;
+    }
+
+    m_ranges.swap(inverted);
+    m_numNonDefault = numNonDefault;
+    m_defaultState = !m_defaultState;
+}
+
+// ----------------------------------------------------------------------------
+// tests
+// ----------------------------------------------------------------------------
+
+bool wxSelectionStore::IsSelected(unsigned item) const
+{
+    const size_t n = FindRange(item);
+    const bool isNonDefault = n < m_ranges.size() && m_ranges[n].from <= item;
+
+    // if the default state is to be selected, being in m_ranges means that
+    // the item is not selected, so we have to inverse the logic
+    return m_defaultState ? !isNonDefault : isNonDefault;
+}
+
+// ----------------------------------------------------------------------------
+// Select*()
+// ----------------------------------------------------------------------------
+
+bool wxSelectionStore::SelectItem(unsigned item, bool select)
+{
+    const unsigned numChanged = select != m_defaultState
+                                    ? SetNonDefault(item, item)
+                                    : SetDefault(item, item);
+
+    return numChanged != 0;
 }
 
 bool wxSelectionStore::SelectRange(unsigned itemFrom, unsigned itemTo,
                                    bool select,
                                    wxArrayInt *itemsChanged)
 {
-    // 100 is hardcoded but it shouldn't matter much: the important thing is
-    // that we don't refresh everything when really few (e.g. 1 or 2) items
-    // change state
-    static const unsigned MANY_ITEMS = 100;
-
     wxASSERT_MSG( itemFrom <= itemTo, wxT("should be in order") );
 
+    if ( itemsChanged )
+        itemsChanged->Empty();
+
     // are we going to have more [un]selected items than the other ones?
-    if ( itemTo - itemFrom > m_count/2 )
-    {
-        if ( select != m_defaultState )
-        {
-            // the default state now becomes the same as 'select'
-            m_defaultState = select;
-
-            // so all the old selections (which had state select) shouldn't be
-            // selected any more, but all the other ones should
-            wxSelectedIndices selOld = m_itemsSel;
-            m_itemsSel.Empty();
-
-            // TODO: it should be possible to optimize the searches a bit
-            //       knowing the possible range
-
-            unsigned item;
-            for ( item = 0; item < itemFrom; item++ )
-            {
-                if ( selOld.Index(item) == wxNOT_FOUND )
-                    m_itemsSel.Add(item);
-            }
-
-            for ( item = itemTo + 1; item < m_count; item++ )
-            {
-                if ( selOld.Index(item) == wxNOT_FOUND )
-                    m_itemsSel.Add(item);
-            }
-
-            // many items (> half) changed state
-            itemsChanged = nullptr;
-        }
-        else // select == m_defaultState
-        {
-            // get the inclusive range of items between itemFrom and itemTo
-            size_t count = m_itemsSel.GetCount(),
-                   start = m_itemsSel.IndexForInsert(itemFrom),
-                   end = m_itemsSel.IndexForInsert(itemTo);
-
-            if ( start == count || m_itemsSel[start] < itemFrom )
-            {
-                start++;
-            }
-
-            if ( end == count || m_itemsSel[end] > itemTo )
-            {
-                end--;
-            }
-
-            if ( start <= end )
-            {
-                // delete all of them (from end to avoid changing indices)
-                for ( int i = end; i >= (int)start; i-- )
-                {
-                    if ( itemsChanged )
-                    {
-                        if ( itemsChanged->GetCount() > MANY_ITEMS )
-                        {
-                            // stop counting (see comment below)
-                            itemsChanged = nullptr;
-                        }
-                        else
-                        {
-                            itemsChanged->Add(m_itemsSel[i]);
-                        }
-                    }
-
-                    m_itemsSel.RemoveAt(i);
-                }
-            }
-        }
-    }
-    else // "few" items change state
+    if ( itemTo - itemFrom > m_count/2 && select != m_defaultState )
     {
-        if ( itemsChanged )
-        {
-            itemsChanged->Empty();
-        }
+        // the default state now becomes the same as 'select', so all the
+        // items in the range just need to have the default state
+        InvertDefaultState();
+        SetDefault(itemFrom, itemTo);
 
-        // just add the items to the selection
-        for ( unsigned item = itemFrom; item <= itemTo; item++ )
-        {
-            if ( SelectItem(item, select) && itemsChanged )
-            {
-                itemsChanged->Add(item);
-
-                if ( itemsChanged->GetCount() > MANY_ITEMS )
-                {
-                    // stop counting them, we'll just eat gobs of memory
-                    // for nothing at all - faster to refresh everything in
-                    // this case
-                    itemsChanged = nullptr;
-                }
-            }
-        }
+        // many items (> half) changed state
+        return false;
     }
 
-    // we set it to nullptr if there are many items changing state
-    return itemsChanged != nullptr;
+    const unsigned numChanged = select != m_defaultState
+                                    ? SetNonDefault(itemFrom, itemTo, itemsChanged)
+                                    : SetDefault(itemFrom, itemTo, itemsChanged);
+
+    // if many items changed state, it's faster to refresh everything than
+    // to refresh them individually
+    return itemsChanged && numChanged <= MANY_ITEMS;
 }
 
 // ----------------------------------------------------------------------------
@@ -190,85 +278,74 @@ bool wxSelectionStore::SelectRange(unsigned itemFrom, unsigned itemTo,
 
 void wxSelectionStore::OnItemsInserted(unsigned item, unsigned numItems)
 {
-    const size_t count = m_itemsSel.GetCount();
+    if ( !numItems )
+        return;
 
-    size_t idx = m_itemsSel.IndexForInsert(item);
+    size_t n = FindRange(item);
+
+    // If the items are inserted in the middle of a range, split it in two.
+    if ( n < m_ranges.size() && m_ranges[n].from < item )
+    {
+        Range right;
+        right.from = item;
+        right.to = m_ranges[n].to;
+
+        m_ranges[n].to = item - 1;
+        m_ranges.insert(m_ranges.begin() + ++n, right);
+    }
 
-    for ( size_t i = idx; i < count; i++ )
+    for ( ; n < m_ranges.size(); n++ )
     {
-        m_itemsSel[i] += numItems;
+        m_ranges[n].from += numItems;
+        m_ranges[n].to += numItems;
     }
 
+    m_count += numItems;
+
     if ( m_defaultState )
     {
         // All newly inserted items are not selected, so if the default state
         // is to be selected, we need to manually add them to the deselected
         // items indices.
-        for ( unsigned n = item; n < item + numItems; n++ )
-        {
-            m_itemsSel.AddAt(n, idx++);
-        }
+        SetNonDefault(item, item + numItems - 1);
     }
-
-    m_count += numItems;
 }
 
 void wxSelectionStore::OnItemDelete(unsigned item)
 {
-    size_t count = m_itemsSel.GetCount(),
-           i = m_itemsSel.IndexForInsert(item);
-
-    if ( i < count && m_itemsSel[i] == item )
-    {
-        // this item itself was in m_itemsSel, remove it from there
-        m_itemsSel.RemoveAt(i);
-
-        count--;
-    }
-
-    // and adjust the index of all which follow it
-    while ( i < count )
-    {
-        // all following elements must be greater than the one we deleted
-        wxASSERT_MSG( m_itemsSel[i] > item, wxT("logic error") );
-
-        m_itemsSel[i++]--;
-    }
-
-    m_count--;
+    OnItemsDeleted(item, 1);
 }
 
 bool wxSelectionStore::OnItemsDeleted(unsigned item, unsigned numItems)
 {
-    bool anyDeletedInSelItems = false,
-         allDeletedInSelItems = true;
+    if ( !numItems )
+        return false;
 
-    size_t i = m_itemsSel.IndexForInsert(item);
+    // Forget about the state of the deleted items.
+    const unsigned numNonDefault = SetDefault(item, item + numItems - 1);
 
-    const unsigned firstAfterDeleted = item + numItems;
-    while ( i < m_itemsSel.size() )
+    // Adjust the indices of all the items after them.
+    size_t n = FindRange(item);
+    const size_t firstAfter = n;
+    for ( ; n < m_ranges.size(); n++ )
     {
-        if ( m_itemsSel[i] < firstAfterDeleted )
-        {
-            // This item is going to be deleted, so remove it from the
-            // selected indices entirely. Notice that we do not update i here
-            // as it now refers to the next element.
-            m_itemsSel.RemoveAt(i);
-
-            anyDeletedInSelItems = true;
-        }
-        else
-        {
-            // This item remains, just update its index.
-            m_itemsSel[i++] -= numItems;
+        m_ranges[n].from -= numItems;
+        m_ranges[n].to -= numItems;
+    }
 
-            allDeletedInSelItems = false;
-        }
+    // The ranges before and after the deleted items could have become
+    // adjacent and need to be merged now.
+    if ( firstAfter > 0 && firstAfter < m_ranges.size() &&
+            m_ranges[firstAfter - 1].to + 1 == m_ranges[firstAfter].from )
+    {
+        m_ranges[firstAfter - 1].to = m_ranges[firstAfter].to;
+        m_ranges.erase(m_ranges.begin() + firstAfter);
     }
 
     m_count -= numItems;
 
-    return m_defaultState ? allDeletedInSelItems : anyDeletedInSelItems;
+    // return true if any of the deleted items were selected
+    return m_defaultState ? numNonDefault < numItems : numNonDefault != 0;
 }
 
 
@@ -276,14 +353,8 @@ void wxSelectionStore::SetItemCount(unsigned count)
 {
     // forget about all items whose indices are now invalid if the size
     // decreased
-    if ( count < m_count )
-    {
-        for ( size_t i = m_itemsSel.GetCount(); i > 0; i-- )
-        {
-            if ( m_itemsSel[i - 1] >= count )
-                m_itemsSel.RemoveAt(i - 1);
-        }
-    }
+    if ( !m_ranges.empty() && m_ranges.back().to >= count )
+        SetDefault(count, m_ranges.back().to);
 
     // remember the new number of items
     m_count = count;
@@ -293,6 +364,27 @@ void wxSelectionStore::SetItemCount(unsigned count)
 // Iteration
 // ----------------------------------------------------------------------------
 
+unsigned wxSelectionStore::FindSelectedItem(unsigned item) const
+{
+    const size_t n = FindRange(item);
+
+    if ( !m_defaultState )
+    {
+        // Simple case when we directly have the selected items.
+        if ( n == m_ranges.size() )
+            return NO_SELECTION;
+
+        return std::max(item, m_ranges[n].from);
+    }
+
+    // Skip the range of unselected items containing this one, if any: the
+    // item after it must be selected, as the ranges are never adjacent.
+    if ( n < m_ranges.size() && m_ranges[n].from <= item )
+        item = m_ranges[n].to + 1;
+
+    return item < m_count ? item : NO_SELECTION;
+}
+
 unsigned wxSelectionStore::GetFirstSelectedItem(IterationState& cookie) const
 {
     cookie = 0;
@@ -302,28 +394,52 @@ unsigned wxSelectionStore::GetFirstSelectedItem(IterationState& cookie) const
 
 unsigned wxSelectionStore::GetNextSelectedItem(IterationState& cookie) const
 {
-    if ( m_defaultState )
+    // The cookie is just the index of the next item to check.
+    if ( cookie >= NO_SELECTION )
+        return NO_SELECTION;
+
+    const unsigned item = FindSelectedItem(static_cast<unsigned>(cookie));
+    if ( item != NO_SELECTION )
+        cookie = item + 1;
+
+    return item;
+}
+
+bool wxSelectionStore::GetFirstSelectedRange(IterationState& cookie,
+                                             unsigned& from,
+                                             unsigned& to) const
+{
+    cookie = 0;
+
+    return GetNextSelectedRange(cookie, from, to);
+}
+
+bool wxSelectionStore::GetNextSelectedRange(IterationState& cookie,
+                                            unsigned& from,
+                                            unsigned& to) const
+{
+    // The cookie has the same meaning as for GetNextSelectedItem().
+    if ( cookie >= NO_SELECTION )
+        return false;
+
+    from = FindSelectedItem(static_cast<unsigned>(cookie));
+    if ( from == NO_SELECTION )
+        return false;
+
+    const size_t n = FindRange(from);
+    if ( !m_defaultState )
     {
-        // We have no choice but to iterate over all items in this case. It
-        // shouldn't be that bad in practice because (almost) all items are
-        // supposed to be selected if m_defaultState == true anyhow.
-        for ( unsigned item = cookie; ; item++ )
-        {
-            if ( item >= m_count )
-                return NO_SELECTION;
-
-            if ( IsSelected(item) )
-            {
-                cookie = item + 1;
-                return item;
-            }
-        }
+        // The item is inside the range of selected items.
+        to = m_ranges[n].to;
     }
-    else // Simple case when we directly have the selected items.
+    else
     {
-        if ( cookie >= m_itemsSel.size() )
-            return NO_SELECTION;
-
-        return m_itemsSel[cookie++];
+        // The selected items continue until the next unselected one.
+        to = n < m_ranges.size() ? std::min(m_ranges[n].from, m_count) - 1
+                                 : m_count - 1;
     }
+
+    cookie = to + 1;
+
+    return true;
 }
@@ -44,6 +44,8 @@
     #include "wx/osx/private.h"
 #endif
 
+#include <algorithm>
+
 // -----------------------------------------------------------------------------
 // array types
 // -----------------------------------------------------------------------------
@@ -186,6 +188,11 @@ public:
 
     void SetHasPlus(bool has = true) { m_hasPlus = has; }
 
+    // children of an item are virtual if they were created by the control
+    // itself and are deleted when it is collapsed
+    void SetHasVirtualChildren(bool has = true) { m_hasVirtualChildren = has; }
+    bool HasVirtualChildren() const { return m_hasVirtualChildren != 0; }
+
     void SetBold(bool bold)
     {
         m_isBold = bold;
@@ -199,6 +206,10 @@ public:
     void SetX(int x) { m_x = x; }
     void SetY(int y) { m_y = y; }
 
+    // move this item and all its visible children vertically by the given
+    // amount
+    void OffsetY(int dy);
+
     int GetHeight() const { return m_height; }
     int GetWidth() const { return m_width; }
 
@@ -355,6 +366,7 @@ private:
                                           // children but has a [+] button
     unsigned int        m_isBold      :1; // render the label in bold font
     unsigned int        m_ownsAttr    :1; // delete attribute when done
+    unsigned int        m_hasVirtualChildren :1; // children created on demand
 
     wxDECLARE_NO_COPY_CLASS(wxGenericTreeItem);
 };
@@ -625,6 +637,7 @@ wxGenericTreeItem::wxGenericTreeItem(wxGenericTreeItem *parent,
     m_hasHilight = false;
     m_hasPlus = false;
     m_isBold = false;
+    m_hasVirtualChildren = false;
 
     m_parent = parent;
 
@@ -791,7 +804,26 @@ wxGenericTreeItem *wxGenericTreeItem::HitTest(const wxPoint& point,
 
     // evaluate children
     size_t count = m_children.GetCount();
-    for ( size_t n = 0; n < count; n++ )
+    size_t n = 0;
+    if ( !theCtrl->m_dirty && count > 1 )
+    {
+        // The children are laid out from top to bottom, so only the subtree
+        // of the last child starting above the point can contain it, there is
+        // no need to check all the others.
+        const wxArrayGenericTreeItems::const_iterator it =
+            std::lower_bound(m_children.begin(), m_children.end(), point.y,
+                             [](const wxGenericTreeItem* child, int y)
+                             {
+                                 return child->GetY() < y;
+                             });
+        if ( it == m_children.begin() )
+            return nullptr;
+
+        n = it - m_children.begin() - 1;
+        count = n + 1;
+    }
+
+    for ( ; n < count; n++ )
     {
         wxGenericTreeItem *res = m_children[n]->HitTest( point,
                                                          theCtrl,
@@ -841,8 +873,18 @@ void wxGenericTreeItem::CalculateSize(wxGenericTreeCtrl* control)
     if ( m_width != 0 )
         return;
 
+    const int heightOld = m_height;
+    const int lineHeightOld = control->m_lineHeight;
+
     wxClientDC dc(control);
     DoCalculateSize(control, dc, false /* normal font not used */);
+
+    // If the height of the line changed, the positions of all the items below
+    // it need to be recalculated.
+    if ( control->m_lineHeight != lineHeightOld ||
+            (heightOld && m_height != heightOld &&
+                control->HasFlag(wxTR_HAS_VARIABLE_ROW_HEIGHT)) )
+        control->m_dirty = true;
 }
 
 void
@@ -912,6 +954,18 @@ wxGenericTreeItem::DoCalculateSize(wxGenericTreeCtrl* control,
     m_width = state_w + image_w + m_widthText + 2;
 }
 
+void wxGenericTreeItem::OffsetY(int dy)
+{
+    m_y += dy;
+
+    if ( IsExpanded() )
+    {
+        const size_t count = m_children.Count();
+        for ( size_t i = 0; i < count; i++ )
+            m_children[i]->OffsetY(dy);
+    }
+}
+
 void wxGenericTreeItem::RecursiveResetSize()
 {
     m_width = 0;
@@ -1111,6 +1165,7 @@ void wxGenericTreeCtrl::SetWindowStyleFlag(long styles)
     if (m_anchor && !HasFlag(wxTR_HIDE_ROOT) && (styles & wxTR_HIDE_ROOT))
     {
         // if we will hide the root, make sure children are visible
+        CreateVirtualChildren(m_anchor);
         m_anchor->SetHasPlus();
         m_anchor->Expand();
         CalculatePositions();
@@ -1316,6 +1371,8 @@ bool wxGenericTreeCtrl::SetFont( const wxFont &font )
     if (m_anchor)
         m_anchor->RecursiveResetTextSize();
 
+    m_dirty = true;
+
     return true;
 }
 
@@ -1696,10 +1753,14 @@ wxTreeItemId wxGenericTreeCtrl::AddRoot(const wxString& text,
         data->m_pItem = m_anchor;
     }
 
+    if ( OnGetItemChildrenCount(m_anchor) > 0 )
+        m_anchor->SetHasPlus();
+
     if (HasFlag(wxTR_HIDE_ROOT))
     {
         // if root is hidden, make sure we can navigate
         // into children
+        CreateVirtualChildren(m_anchor);
         m_anchor->SetHasPlus();
         m_anchor->Expand();
         CalculatePositions();
@@ -1785,6 +1846,7 @@ void wxGenericTreeCtrl::DeleteChildren(const wxTreeItemId& itemId)
     wxGenericTreeItem *item = (wxGenericTreeItem*) itemId.m_pItem;
     ChildrenClosing(item);
     item->DeleteChildren(this);
+    item->SetHasVirtualChildren(false);
     InvalidateBestSize();
 }
 
@@ -1894,10 +1956,12 @@ void wxGenericTreeCtrl::Expand(const wxTreeItemId& itemId)
         return;
     }
 
+    CreateVirtualChildren(item);
+
     item->Expand();
     if ( !IsFrozen() )
     {
-        CalculatePositions();
+        CalculateSubtreePositions(item);
 
         RefreshSubtree(item);
     }
@@ -1938,6 +2002,17 @@ void wxGenericTreeCtrl::Collapse(const wxTreeItemId& itemId)
     ChildrenClosing(item);
     item->Collapse();
 
+    // Virtual children are only kept while their parent is expanded.
+    if ( item->HasVirtualChildren() )
+    {
+        if ( IsDescendantOf(item, m_underMouse) )
+            m_underMouse = nullptr;
+
+        item->DeleteChildren(this);
+        item->SetHasVirtualChildren(false);
+        InvalidateBestSize();
+    }
+
 #if 0  // TODO why should items be collapsed recursively?
     wxArrayGenericTreeItems& children = item->GetChildren();
     size_t count = children.GetCount();
@@ -1947,7 +2022,7 @@ void wxGenericTreeCtrl::Collapse(const wxTreeItemId& itemId)
     }
 #endif
 
-    CalculatePositions();
+    CalculateSubtreePositions(item);
 
     RefreshSubtree(item);
 
@@ -1955,6 +2030,80 @@ void wxGenericTreeCtrl::Collapse(const wxTreeItemId& itemId)
     GetEventHandler()->ProcessEvent( event );
 }
 
+// ----------------------------------------------------------------------------
+// virtual children support
+// ----------------------------------------------------------------------------
+
+int
+wxGenericTreeCtrl::OnGetItemChildrenCount(const wxTreeItemId& WXUNUSED(item)) const
+{
+    // By default, the items don't have any virtual children.
+    return wxNOT_FOUND;
+}
+
+wxString
+wxGenericTreeCtrl::OnGetItemText(const wxTreeItemId& WXUNUSED(parent),
+                                 size_t WXUNUSED(index)) const
+{
+    // This must be overridden if OnGetItemChildrenCount() is.
+    wxFAIL_MSG( "wxGenericTreeCtrl::OnGetItemText not supposed to be called" );
+
+    return wxEmptyString;
+}
+
+int
+wxGenericTreeCtrl::OnGetItemImage(const wxTreeItemId& WXUNUSED(parent),
+                                  size_t WXUNUSED(index)) const
+{
+    return NO_IMAGE;
+}
+
+wxTreeItemData*
+wxGenericTreeCtrl::OnGetItemData(const wxTreeItemId& WXUNUSED(parent),
+                                 size_t WXUNUSED(index)) const
+{
+    return nullptr;
+}
+
+void wxGenericTreeCtrl::CreateVirtualChildren(wxGenericTreeItem *item)
+{
+    // Don't do anything if the children had been already added, either by
+    // us or by the application from its wxEVT_TREE_ITEM_EXPANDING handler.
+    if ( item->HasChildren() )
+        return;
+
+    const int count = OnGetItemChildrenCount(item);
+    if ( count <= 0 )
+        return;
+
+    wxArrayGenericTreeItems& children = item->GetChildren();
+    children.reserve(count);
+    for ( int n = 0; n < count; n++ )
+    {
+        wxTreeItemData* const data = OnGetItemData(item, n);
+
+        wxGenericTreeItem* const child =
+            new wxGenericTreeItem(item,
+                                  OnGetItemText(item, n),
+                                  OnGetItemImage(item, n),
+                                  NO_IMAGE,
+                                  data);
+        if ( data != nullptr )
+        {
+            data->m_pItem = child;
+        }
+
+        children.push_back(child);
+
+        if ( OnGetItemChildrenCount(child) > 0 )
+            child->SetHasPlus();
+    }
+
+    item->SetHasVirtualChildren();
+
+    InvalidateBestSize();
+}
+
 void wxGenericTreeCtrl::CollapseAndReset(const wxTreeItemId& item)
 {
     Collapse(item);
@@ -2757,18 +2906,15 @@ wxGenericTreeCtrl::PaintLevel(wxGenericTreeItem *item,
         int count = children.GetCount();
         if (count > 0)
         {
-            int n = 0, oldY;
-            do {
-                oldY = y;
-                PaintLevel(children[n], dc, 1, y);
-            } while (++n < count);
+            PaintChildren(item, dc, 1, y);
 
             if ( !HasFlag(wxTR_NO_LINES) && HasFlag(wxTR_LINES_AT_ROOT)
                     && count > 0 )
             {
                 // draw line down to last child
                 origY += GetLineHeight(children[0])>>1;
-                oldY += GetLineHeight(children[n-1])>>1;
+                int oldY = children[count-1]->GetY();
+                oldY += GetLineHeight(children[count-1])>>1;
                 dc.DrawLine(3, origY, 3, oldY);
             }
         }
@@ -2896,17 +3042,13 @@ wxGenericTreeCtrl::PaintLevel(wxGenericTreeItem *item,
         int count = children.GetCount();
         if (count > 0)
         {
-            int n = 0, oldY;
-            ++level;
-            do {
-                oldY = y;
-                PaintLevel(children[n], dc, level, y);
-            } while (++n < count);
+            PaintChildren(item, dc, level + 1, y);
 
             if (!HasFlag(wxTR_NO_LINES) && count > 0)
             {
                 // draw line down to last child
-                oldY += GetLineHeight(children[n-1])>>1;
+                int oldY = children[count-1]->GetY();
+                oldY += GetLineHeight(children[count-1])>>1;
                 if (HasButtons())
                     y_mid += 5;
 
@@ -2932,6 +3074,52 @@ wxGenericTreeCtrl::PaintLevel(wxGenericTreeItem *item,
     }
 }
 
+void
+wxGenericTreeCtrl::PaintChildren(wxGenericTreeItem *item,
+                                 wxDC &dc,
+                                 int level,
+                                 int &y)
+{
+    wxArrayGenericTreeItems& children = item->GetChildren();
+    int first = 0,
+        last = children.GetCount();
+
+    // If the positions are up to date, we can skip the children which are
+    // completely outside of the area being repainted, which is important for
+    // the items with very many children. Otherwise we need to paint all of
+    // them, as this updates their positions.
+    if ( !m_dirty && last > 1 )
+    {
+        const wxRect rect = GetUpdateRegion().GetBox();
+        const int top = dc.DeviceToLogicalY(rect.y);
+        const int bottom = dc.DeviceToLogicalY(rect.y + rect.height);
+
+        const auto startsBefore = [](const wxGenericTreeItem* child, int pos)
+        {
+            return child->GetY() < pos;
+        };
+
+        // The last child starting above the top of the update area may
+        // still have some visible children.
+        first = std::lower_bound(children.begin(), children.end(),
+                                 top + 1, startsBefore) - children.begin();
+        if ( first > 0 )
+        {
+            first--;
+            y = children[first]->GetY();
+        }
+
+        last = std::lower_bound(children.begin() + first, children.end(),
+                                bottom, startsBefore) - children.begin();
+    }
+
+    for ( int n = first; n < last; n++ )
+        PaintLevel(children[n], dc, level, y);
+
+    if ( last < (int)children.GetCount() )
+        y = GetSubtreeBottom(children.Last());
+}
+
 void wxGenericTreeCtrl::DrawDropEffect(wxGenericTreeItem *item)
 {
     if ( item )
@@ -4023,6 +4211,84 @@ void wxGenericTreeCtrl::CalculatePositions()
     CalculateLevel( m_anchor, dc, 0, y ); // start recursion
 }
 
+void wxGenericTreeCtrl::CalculateSubtreePositions(wxGenericTreeItem *item)
+{
+    // If the positions are not up to date anyhow, we need to recalculate all
+    // of them.
+    if ( m_dirty )
+    {
+        CalculatePositions();
+        return;
+    }
+
+    // Nothing changes on screen if the item itself is not shown.
+    int level = 0;
+    for ( wxGenericTreeItem* parent = item->GetParent();
+          parent;
+          parent = parent->GetParent() )
+    {
+        if ( !parent->IsExpanded() )
+            return;
+
+        level++;
+    }
+
+    wxClientDC dc(this);
+    PrepareDC( dc );
+
+    dc.SetFont( m_normalFont );
+
+    dc.SetPen( m_dottedPen );
+
+    // Calculating the sizes of the newly shown items may increase the line
+    // height, in which case the positions of all items change.
+    const int lineHeightOld = m_lineHeight;
+
+    int y = item->GetY();
+    CalculateLevel( item, dc, level, y );
+
+    if ( m_lineHeight != lineHeightOld )
+    {
+        CalculatePositions();
+        return;
+    }
+
+    // Find the first item below this subtree, i.e. the next sibling of the
+    // item or of its closest ancestor having one: it still has its old
+    // position and all the items after it must be moved by the same amount.
+    int dy = 0;
+    for ( wxGenericTreeItem* child = item; ; )
+    {
+        wxGenericTreeItem* const parent = child->GetParent();
+        if ( !parent )
+            break;
+
+        const wxArrayGenericTreeItems& siblings = parent->GetChildren();
+        const size_t count = siblings.GetCount();
+        for ( size_t n = siblings.Index(child) + 1; n < count; n++ )
+        {
+            if ( !dy )
+            {
+                dy = y - siblings[n]->GetY();
+                if ( !dy )
+                    return;
+            }
+
+            siblings[n]->OffsetY(dy);
+        }
+
+        child = parent;
+    }
+}
+
+int wxGenericTreeCtrl::GetSubtreeBottom(wxGenericTreeItem *item) const
+{
+    while ( item->IsExpanded() && item->HasChildren() )
+        item = item->GetChildren().Last();
+
+    return item->GetY() + GetLineHeight(item);
+}
+
 void wxGenericTreeCtrl::Refresh(bool eraseBackground, const wxRect *rect)
 {
     if ( !IsFrozen() )
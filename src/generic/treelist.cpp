@@ -353,6 +353,9 @@ public:
     void DeleteItem(Node* item);
     void DeleteAllItems();
 
+    void BeginBulkInsert() { m_bulkInsertDepth++; }
+    void EndBulkInsert();
+
     Node* GetRootItem() const { return m_root; }
 
     const wxString& GetItemText(Node* item, unsigned col) const;
@@ -400,6 +403,28 @@ private:
     // items with non-root item as parent are added (and currently never reset
     // after this).
     bool m_isFlat;
+
+    // Number of BeginBulkInsert() calls without the matching EndBulkInsert()
+    // ones and the flag set if anything was changed since the first of them,
+    // no notifications are sent while the bulk insertion is in progress.
+    unsigned m_bulkInsertDepth;
+    bool m_changedDuringBulkInsert;
+
+    // The last item appended to its parent, cached to avoid having to walk
+    // over all the children of the parent to find it when appending the next
+    // one. May be null and is reset whenever any item is deleted.
+    Node* m_lastAppended;
+
+    // Return true if we shouldn't notify about the changes right now.
+    bool IsInBulkInsert()
+    {
+        if ( !m_bulkInsertDepth )
+            return false;
+
+        m_changedDuringBulkInsert = true;
+
+        return true;
+    }
 };
 
 // ============================================================================
@@ -412,6 +437,9 @@ wxTreeListModel::wxTreeListModel(wxTreeListCtrl* treelist)
 {
     m_numColumns = 0;
     m_isFlat = true;
+    m_bulkInsertDepth = 0;
+    m_changedDuringBulkInsert = false;
+    m_lastAppended = nullptr;
 }
 
 wxTreeListModel::~wxTreeListModel()
@@ -501,7 +529,12 @@ wxTreeListModel::InsertItem(Node* parent,
     {
         if ( previous == wxTLI_LAST )
         {
-            previous = parent->GetChild();
+            // Usually items are appended one after another, so start
+            // searching from the last appended one, if possible.
+            if ( m_lastAppended && m_lastAppended->GetParent() == parent )
+                previous = m_lastAppended;
+            else
+                previous = parent->GetChild();
 
             // Find the last child.
             for ( ;; )
@@ -523,7 +556,11 @@ wxTreeListModel::InsertItem(Node* parent,
         previous->InsertNext(newItem.get());
     }
 
-    ItemAdded(ToDVI(parent), ToDVI(newItem.get()));
+    if ( !newItem->GetNext() )
+        m_lastAppended = newItem.get();
+
+    if ( !IsInBulkInsert() )
+        ItemAdded(ToDVI(parent), ToDVI(newItem.get()));
 
     // The item was successfully inserted in the tree and so will be deleted by
     // it, we can detach it now.
@@ -538,6 +575,9 @@ void wxTreeListModel::DeleteItem(Node* item)
 
     Node* const parent = item->GetParent();
 
+    // The cached item could be the item being deleted or one of its children.
+    m_lastAppended = nullptr;
+
     Node* previous = parent->GetChild();
     if ( previous == item )
     {
@@ -563,17 +603,38 @@ void wxTreeListModel::DeleteItem(Node* item)
     // Note that the item is already deleted by now, so we can't use it in any
     // way, e.g. by calling ToDVI(item) which does dereference the pointer, but
     // ToNonRootDVI() that we use here does not.
-    ItemDeleted(ToDVI(parent), ToNonRootDVI(item));
+    if ( !IsInBulkInsert() )
+        ItemDeleted(ToDVI(parent), ToNonRootDVI(item));
 }
 
 void wxTreeListModel::DeleteAllItems()
 {
+    m_lastAppended = nullptr;
+
     while ( m_root->GetChild() )
     {
         m_root->DeleteChild();
     }
 
-    Cleared();
+    if ( !IsInBulkInsert() )
+        Cleared();
+}
+
+void wxTreeListModel::EndBulkInsert()
+{
+    wxCHECK_RET( m_bulkInsertDepth, "Not inside BeginBulkInsert()" );
+
+    if ( --m_bulkInsertDepth )
+        return;
+
+    // Let the view rebuild itself once instead of notifying it about every
+    // change done since BeginBulkInsert().
+    if ( m_changedDuringBulkInsert )
+    {
+        m_changedDuringBulkInsert = false;
+
+        Cleared();
+    }
 }
 
 const wxString& wxTreeListModel::GetItemText(Node* item, unsigned col) const
@@ -599,7 +660,8 @@ void wxTreeListModel::SetItemText(Node* item, unsigned col, const wxString& text
     else
         item->SetColumnText(text, col, m_numColumns);
 
-    ValueChanged(ToDVI(item), col);
+    if ( !IsInBulkInsert() )
+        ValueChanged(ToDVI(item), col);
 }
 
 void wxTreeListModel::SetItemImage(Node* item, int closed, int opened)
@@ -609,7 +671,8 @@ void wxTreeListModel::SetItemImage(Node* item, int closed, int opened)
     item->m_imageClosed = closed;
     item->m_imageOpened = opened;
 
-    ValueChanged(ToDVI(item), 0);
+    if ( !IsInBulkInsert() )
+        ValueChanged(ToDVI(item), 0);
 }
 
 wxClientData* wxTreeListModel::GetItemData(Node* item) const
@@ -632,7 +695,8 @@ void wxTreeListModel::CheckItem(Node* item, wxCheckBoxState checkedState)
 
     item->m_checkedState = checkedState;
 
-    ItemChanged(ToDVI(item));
+    if ( !IsInBulkInsert() )
+        ItemChanged(ToDVI(item));
 }
 
 void
@@ -1010,6 +1074,20 @@ void wxTreeListCtrl::DeleteAllItems()
         m_model->DeleteAllItems();
 }
 
+void wxTreeListCtrl::BeginBulkInsert()
+{
+    wxCHECK_RET( m_model, "Must create first" );
+
+    m_model->BeginBulkInsert();
+}
+
+void wxTreeListCtrl::EndBulkInsert()
+{
+    wxCHECK_RET( m_model, "Must create first" );
+
+    m_model->EndBulkInsert();
+}
+
 // ----------------------------------------------------------------------------
 // Tree navigation
 // ----------------------------------------------------------------------------
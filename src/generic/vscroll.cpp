@@ -28,6 +28,8 @@
 
 #include "wx/utils.h"   // For wxMin/wxMax().
 
+#include <algorithm>
+
 // ============================================================================
 // wxVarScrollHelperEvtHandler declaration
 // ============================================================================
@@ -275,6 +277,30 @@ wxCoord wxVarScrollHelperBase::GetUnitsSize(size_t unitMin, size_t unitMax) cons
         return -GetUnitsSize(unitMax, unitMin);
     //else: unitMin < unitMax
 
+    // if we know the position of the first unit, use the cached positions,
+    // computing those of the units beyond the end of the cache if necessary
+    if ( unitMin <= m_unitsPos.size() )
+    {
+        if ( m_unitsPos.empty() )
+            m_unitsPos.push_back(0);
+
+        if ( unitMax >= m_unitsPos.size() )
+        {
+            OnGetUnitsSizeHint(m_unitsPos.size() - 1, unitMax);
+
+            m_unitsPos.reserve(unitMax + 1);
+            for ( size_t unit = m_unitsPos.size() - 1; unit < unitMax; ++unit )
+            {
+                m_unitsPos.push_back(m_unitsPos.back() + OnGetUnitSize(unit));
+            }
+        }
+
+        return m_unitsPos[unitMax] - m_unitsPos[unitMin];
+    }
+
+    // otherwise avoid computing the sizes of all the units before unitMin
+    // just to find the size of a few units in the middle
+
     // let the user code know that we're going to need all these units
     OnGetUnitsSizeHint(unitMin, unitMax);
 
@@ -470,6 +496,9 @@ void wxVarScrollHelperBase::SetUnitCount(size_t count)
     // save the number of units
     m_unitMax = count;
 
+    // the units are going to change, forget their sizes
+    m_unitsPos.clear();
+
     // and our estimate for their total height
     m_sizeTotal = EstimateTotalSize();
 
@@ -487,6 +516,9 @@ void wxVarScrollHelperBase::SetUnitCount(size_t count)
 
 void wxVarScrollHelperBase::RefreshUnit(size_t unit)
 {
+    // its size could have changed
+    InvalidateUnitsSizes(unit);
+
     // is this unit visible?
     if ( !IsVisible(unit) )
     {
@@ -498,11 +530,7 @@ void wxVarScrollHelperBase::RefreshUnit(size_t unit)
     wxRect rect;
     AssignOrient(rect.width, rect.height,
                  GetNonOrientationTargetSize(), OnGetUnitSize(unit));
-
-    for ( size_t n = GetVisibleBegin(); n < unit; ++n )
-    {
-        IncOrient(rect.x, rect.y, OnGetUnitSize(n));
-    }
+    IncOrient(rect.x, rect.y, GetUnitsSize(GetVisibleBegin(), unit));
 
     // do refresh it
     m_targetWindow->RefreshRect(rect);
@@ -512,6 +540,9 @@ void wxVarScrollHelperBase::RefreshUnits(size_t from, size_t to)
 {
     wxASSERT_MSG( from <= to, wxT("RefreshUnits(): empty range") );
 
+    // their sizes could have changed
+    InvalidateUnitsSizes(from);
+
     // clump the range to just the visible units -- it is useless to refresh
     // the other ones
     if ( from < GetVisibleBegin() )
@@ -522,17 +553,10 @@ void wxVarScrollHelperBase::RefreshUnits(size_t from, size_t to)
 
     // calculate the rect occupied by these units on screen
     int orient_size = 0,
-        orient_pos = 0;
+        orient_pos = GetUnitsSize(GetVisibleBegin(), from);
 
     int nonorient_size = GetNonOrientationTargetSize();
 
-    for ( size_t nBefore = GetVisibleBegin();
-          nBefore < from;
-          nBefore++ )
-    {
-        orient_pos += OnGetUnitSize(nBefore);
-    }
-
     for ( size_t nBetween = from; nBetween <= to; nBetween++ )
     {
         orient_size += OnGetUnitSize(nBetween);
@@ -546,8 +570,27 @@ void wxVarScrollHelperBase::RefreshUnits(size_t from, size_t to)
     m_targetWindow->RefreshRect(rect);
 }
 
+void wxVarScrollHelperBase::RefreshUnitsSizes(size_t from, size_t to)
+{
+    wxASSERT_MSG( from <= to, wxT("RefreshUnitsSizes(): empty range") );
+
+    InvalidateUnitsSizes(from);
+
+    // the number of the visible units and the scrollbar thumb size could
+    // have changed
+    UpdateScrollbar();
+
+    // all the units after the first changed one are moved, so refresh them
+    // and not just the units in the given range
+    if ( from < GetVisibleEnd() )
+        RefreshUnits(from, GetVisibleEnd() - 1);
+}
+
 void wxVarScrollHelperBase::RefreshAll()
 {
+    // the sizes of all units could have changed
+    m_unitsPos.clear();
+
     UpdateScrollbar();
 
     m_targetWindow->Refresh();
@@ -577,6 +620,22 @@ bool wxVarScrollHelperBase::ScrollLayout()
 int wxVarScrollHelperBase::VirtualHitTest(wxCoord coord) const
 {
     const size_t unitMax = GetVisibleEnd();
+
+    // use binary search if we know the positions of all visible units
+    if ( unitMax < m_unitsPos.size() )
+    {
+        const std::vector<wxCoord>::const_iterator
+            begin = m_unitsPos.begin() + GetVisibleBegin() + 1,
+            end = m_unitsPos.begin() + unitMax + 1;
+
+        const std::vector<wxCoord>::const_iterator
+            it = std::upper_bound(begin, end, *(begin - 1) + coord);
+        if ( it == end )
+            return wxNOT_FOUND;
+
+        return it - m_unitsPos.begin() - 1;
+    }
+
     for ( size_t unit = GetVisibleBegin(); unit < unitMax; ++unit )
     {
         coord -= OnGetUnitSize(unit);
@@ -708,6 +767,10 @@ bool wxVarScrollHelperBase::DoScrollPages(int pages)
 
 void wxVarScrollHelperBase::HandleOnSize(wxSizeEvent& event)
 {
+    // the sizes of the units may depend on the window size, e.g. when the
+    // text is wrapped, so don't rely on the cached ones any longer
+    m_unitsPos.clear();
+
     if ( m_unitMax )
     {
         // sometimes change in varscrollable window's size can result in
@@ -0,0 +1,711 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        src/generic/windowless.cpp
+// Purpose:     Lightweight controls drawn by their parent window
+// Author:      wxWidgets team
+// Created:     2026-10-15
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+// For compilers that support precompilation, includes "wx.h".
+#include "wx/wxprec.h"
+
+#include "wx/windowless.h"
+
+#ifndef WX_PRECOMP
+    #include "wx/control.h"
+    #include "wx/dcclient.h"
+    #include "wx/settings.h"
+    #include "wx/sizer.h"
+#endif
+
+#include <algorithm>
+#include <iterator>
+
+// ----------------------------------------------------------------------------
+// wxWindowlessSizer: sizer positioning a single windowless control
+// ----------------------------------------------------------------------------
+
+class wxWindowlessSizer : public wxSizer
+{
+public:
+    explicit wxWindowlessSizer(wxWindowlessControl* control)
+        : m_control(control)
+    {
+        wxASSERT_MSG( !control->m_sizer, "control is already in a sizer" );
+
+        control->m_sizer = this;
+    }
+
+    virtual ~wxWindowlessSizer()
+    {
+        if ( m_control )
+            m_control->m_sizer = nullptr;
+    }
+
+    virtual wxSize CalcMin() override
+    {
+        if ( !m_control || !m_control->IsShown() )
+            return wxSize();
+
+        return m_control->GetEffectiveMinSize();
+    }
+
+    virtual void RepositionChildren(const wxSize& WXUNUSED(minSize)) override
+    {
+        if ( m_control )
+            m_control->SetSize(wxRect(m_position, m_size));
+    }
+
+    // This is used by wxSizerItem to determine if this sizer is shown.
+    virtual bool AreAnyItemsShown() const override
+    {
+        return m_control && m_control->IsShown();
+    }
+
+    // Called when the control is destroyed before this sizer.
+    void DetachControl() { m_control = nullptr; }
+
+private:
+    wxWindowlessControl* m_control;
+
+    wxDECLARE_NO_COPY_CLASS(wxWindowlessSizer);
+};
+
+// ============================================================================
+// wxWindowlessControl implementation
+// ============================================================================
+
+wxWindowlessControl::wxWindowlessControl(wxWindowlessPanel* parent,
+                                         wxWindowID id,
+                                         const wxPoint& pos,
+                                         const wxSize& size)
+    : m_parent(parent),
+      m_id(id == wxID_ANY ? wxWindow::NewControlId() : id),
+      m_rect(pos == wxDefaultPosition ? wxPoint() : pos, wxSize()),
+      m_minSize(size),
+      m_ownsId(id == wxID_ANY)
+{
+    wxCHECK_RET( parent, "windowless control must have a parent" );
+
+    parent->AddControl(this);
+}
+
+wxWindowlessControl::~wxWindowlessControl()
+{
+    if ( m_sizer )
+    {
+        m_sizer->DetachControl();
+        m_sizer->InvalidateMinSize();
+
+        if ( m_parent )
+            m_parent->ScheduleLayout();
+    }
+
+    if ( m_parent )
+        m_parent->RemoveControl(this);
+
+    if ( m_ownsId )
+        wxWindow::UnreserveControlId(m_id);
+}
+
+bool wxWindowlessControl::TryAfter(wxEvent& event)
+{
+    // Propagate the command events to the parent window as it would be done if
+    // this were a real window, but don't forward the other events to wxApp:
+    // the parent does it itself if they're not processed here.
+    if ( m_parent && event.ShouldPropagate() )
+    {
+        wxPropagateOnce propagateOnce(event, this);
+
+        return m_parent->GetEventHandler()->ProcessEvent(event);
+    }
+
+    return false;
+}
+
+void wxWindowlessControl::SetSize(const wxRect& rect)
+{
+    // The size components equal to -1 mean to use the best size.
+    wxRect rectNew = rect;
+    if ( rectNew.width == wxDefaultCoord || rectNew.height == wxDefaultCoord )
+    {
+        const wxSize best = GetBestSize();
+        if ( rectNew.width == wxDefaultCoord )
+            rectNew.width = best.x;
+        if ( rectNew.height == wxDefaultCoord )
+            rectNew.height = best.y;
+    }
+
+    if ( rectNew == m_rect )
+        return;
+
+    Refresh();
+    m_rect = rectNew;
+    Refresh();
+}
+
+void wxWindowlessControl::SetMinSize(const wxSize& size)
+{
+    m_minSize = size;
+
+    if ( m_sizer )
+        m_sizer->InvalidateMinSize();
+}
+
+wxSize wxWindowlessControl::GetBestSize() const
+{
+    if ( !m_bestSizeCache.IsFullySpecified() )
+        m_bestSizeCache = DoGetBestSize();
+
+    return m_bestSizeCache;
+}
+
+void wxWindowlessControl::InvalidateBestSize()
+{
+    m_bestSizeCache = wxDefaultSize;
+
+    if ( m_sizer )
+        m_sizer->InvalidateMinSize();
+}
+
+wxSize wxWindowlessControl::GetEffectiveMinSize() const
+{
+    wxSize size = m_minSize;
+    if ( !size.IsFullySpecified() )
+        size.SetDefaults(GetBestSize());
+
+    return size;
+}
+
+void wxWindowlessControl::UpdateAfterChange()
+{
+    InvalidateBestSize();
+
+    // Update the size of a control not managed by a sizer immediately.
+    if ( !m_sizer )
+    {
+        SetSize(GetEffectiveMinSize());
+    }
+    else if ( m_parent )
+    {
+        // And let the sizer do it for the controls managed by it.
+        m_parent->ScheduleLayout();
+    }
+
+    Refresh();
+}
+
+bool wxWindowlessControl::Show(bool show)
+{
+    if ( show == m_isShown )
+        return false;
+
+    m_isShown = show;
+
+    if ( !show && m_parent )
+    {
+        // Hidden controls can't be hovered or have focus.
+        if ( m_parent->m_hovered == this )
+            m_parent->m_hovered = nullptr;
+        if ( m_parent->m_focused == this )
+            m_parent->SetFocusedControl(nullptr);
+        if ( m_parent->m_mouseCapture == this )
+            m_parent->m_mouseCapture = nullptr;
+    }
+
+    if ( m_sizer )
+    {
+        m_sizer->InvalidateMinSize();
+        if ( m_parent )
+            m_parent->ScheduleLayout();
+    }
+
+    if ( m_parent )
+        m_parent->RefreshRect(m_rect);
+
+    return true;
+}
+
+bool wxWindowlessControl::Enable(bool enable)
+{
+    if ( enable == m_isEnabled )
+        return false;
+
+    m_isEnabled = enable;
+
+    if ( !enable && m_parent && m_parent->m_focused == this )
+        m_parent->SetFocusedControl(nullptr);
+
+    Refresh();
+
+    return true;
+}
+
+bool wxWindowlessControl::IsEnabled() const
+{
+    return m_isEnabled && m_parent && m_parent->IsEnabled();
+}
+
+void wxWindowlessControl::SetFont(const wxFont& font)
+{
+    m_font = font;
+
+    UpdateAfterChange();
+}
+
+wxFont wxWindowlessControl::GetFont() const
+{
+    if ( m_font.IsOk() || !m_parent )
+        return m_font;
+
+    return m_parent->GetFont();
+}
+
+void wxWindowlessControl::SetForegroundColour(const wxColour& colour)
+{
+    m_fgColour = colour;
+
+    Refresh();
+}
+
+wxColour wxWindowlessControl::GetForegroundColour() const
+{
+    if ( m_fgColour.IsOk() || !m_parent )
+        return m_fgColour;
+
+    return m_parent->GetForegroundColour();
+}
+
+void wxWindowlessControl::SetFocus()
+{
+    wxCHECK_RET( m_parent, "no parent" );
+    wxCHECK_RET( AcceptsFocus(), "control doesn't accept focus" );
+
+    m_parent->SetFocusedControl(this);
+
+    if ( !m_parent->HasFocus() )
+        m_parent->SetFocus();
+}
+
+bool wxWindowlessControl::HasFocus() const
+{
+    return m_parent && m_parent->m_focused == this && m_parent->HasFocus();
+}
+
+void wxWindowlessControl::Refresh()
+{
+    if ( m_parent && m_isShown )
+        m_parent->RefreshRect(m_rect);
+}
+
+wxSizerItem*
+wxWindowlessControl::AddToSizer(wxSizer* sizer, const wxSizerFlags& flags)
+{
+    wxCHECK_MSG( sizer, nullptr, "null sizer" );
+    wxCHECK_MSG( !m_sizer, nullptr, "control is already in a sizer" );
+
+    return sizer->Add(new wxWindowlessSizer(this), flags);
+}
+
+void wxWindowlessControl::Draw(wxDC& dc)
+{
+    wxDCClipper clip(dc, m_rect);
+
+    dc.SetFont(GetFont());
+    dc.SetTextForeground(IsEnabled()
+                            ? GetForegroundColour()
+                            : wxSystemSettings::GetColour(wxSYS_COLOUR_GRAYTEXT));
+
+    DoDraw(dc, m_rect);
+}
+
+// ============================================================================
+// wxWindowlessStaticText implementation
+// ============================================================================
+
+wxWindowlessStaticText::wxWindowlessStaticText(wxWindowlessPanel* parent,
+                                               wxWindowID id,
+                                               const wxString& label,
+                                               const wxPoint& pos,
+                                               const wxSize& size,
+                                               long style)
+    : wxWindowlessControl(parent, id, pos, size),
+      m_label(label),
+      m_style(style)
+{
+    UpdateLabel();
+
+    SetSize(GetEffectiveMinSize());
+}
+
+void wxWindowlessStaticText::UpdateLabel()
+{
+    m_mnemonic = wxControl::FindAccelIndex(m_label, &m_labelOnly);
+}
+
+void wxWindowlessStaticText::SetLabel(const wxString& label)
+{
+    if ( label == m_label )
+        return;
+
+    m_label = label;
+    UpdateLabel();
+
+    UpdateAfterChange();
+}
+
+wxSize wxWindowlessStaticText::DoGetBestSize() const
+{
+    if ( !GetParent() )
+        return wxSize();
+
+    wxClientDC dc(GetParent());
+    dc.SetFont(GetFont());
+
+    return dc.GetMultiLineTextExtent(m_labelOnly);
+}
+
+void wxWindowlessStaticText::DoDraw(wxDC& dc, const wxRect& rect)
+{
+    dc.DrawLabel(m_labelOnly, rect,
+                 (m_style & wxALIGN_MASK) | wxALIGN_TOP, m_mnemonic);
+}
+
+// ============================================================================
+// wxWindowlessStaticBitmap implementation
+// ============================================================================
+
+wxWindowlessStaticBitmap::wxWindowlessStaticBitmap(wxWindowlessPanel* parent,
+                                                   wxWindowID id,
+                                                   const wxBitmapBundle& bitmap,
+                                                   const wxPoint& pos,
+                                                   const wxSize& size)
+    : wxWindowlessControl(parent, id, pos, size),
+      m_bitmap(bitmap)
+{
+    SetSize(GetEffectiveMinSize());
+}
+
+void wxWindowlessStaticBitmap::SetBitmap(const wxBitmapBundle& bitmap)
+{
+    m_bitmap = bitmap;
+
+    UpdateAfterChange();
+}
+
+wxSize wxWindowlessStaticBitmap::DoGetBestSize() const
+{
+    if ( !m_bitmap.IsOk() || !GetParent() )
+        return wxSize();
+
+    return m_bitmap.GetPreferredLogicalSizeFor(GetParent());
+}
+
+void wxWindowlessStaticBitmap::DoDraw(wxDC& dc, const wxRect& rect)
+{
+    if ( !m_bitmap.IsOk() )
+        return;
+
+    const wxBitmap bmp = m_bitmap.GetBitmapFor(GetParent());
+
+    // Centre the bitmap in the control, as wxStaticBitmap does by default.
+    const wxSize size = bmp.GetLogicalSize();
+    dc.DrawBitmap(bmp,
+                  rect.x + (rect.width - size.x) / 2,
+                  rect.y + (rect.height - size.y) / 2,
+                  true /* use mask */);
+}
+
+// ============================================================================
+// wxWindowlessPanel implementation
+// ============================================================================
+
+wxIMPLEMENT_DYNAMIC_CLASS(wxWindowlessPanel, wxPanel);
+
+bool wxWindowlessPanel::Create(wxWindow *parent,
+                               wxWindowID winid,
+                               const wxPoint& pos,
+                               const wxSize& size,
+                               long style,
+                               const wxString& name)
+{
+    if ( !wxPanel::Create(parent, winid, pos, size, style, name) )
+        return false;
+
+    Bind(wxEVT_PAINT, &wxWindowlessPanel::OnPaint, this);
+
+
+    Bind(wxEVT_SET_FOCUS, &wxWindowlessPanel::OnFocus, this);
+    Bind(wxEVT_KILL_FOCUS, &wxWindowlessPanel::OnFocus, this);
+
+    return true;
+}
+
+wxWindowlessPanel::~wxWindowlessPanel()
+{
+    DoDestroyControls();
+}
+
+void wxWindowlessPanel::DestroyControls()
+{
+    DoDestroyControls();
+
+    Refresh();
+}
+
+void wxWindowlessPanel::DoDestroyControls()
+{
+    m_hovered =
+    m_focused =
+    m_mouseCapture = nullptr;
+
+    // Avoid removing the controls from the vector one by one.
+    std::vector<wxWindowlessControl*> controls;
+    controls.swap(m_controls);
+
+    for ( wxWindowlessControl* control : controls )
+    {
+        control->m_parent = nullptr;
+        delete control;
+    }
+}
+
+void wxWindowlessPanel::AddControl(wxWindowlessControl* control)
+{
+    // The control doesn't have any size yet, so there is nothing to refresh.
+    m_controls.push_back(control);
+}
+
+void wxWindowlessPanel::RemoveControl(wxWindowlessControl* control)
+{
+    if ( m_hovered == control )
+        m_hovered = nullptr;
+    if ( m_focused == control )
+        m_focused = nullptr;
+    if ( m_mouseCapture == control )
+        m_mouseCapture = nullptr;
+
+    // Controls are often destroyed in the reverse order of their creation, so
+    // search from the end.
+    std::vector<wxWindowlessControl*>::reverse_iterator
+        it = std::find(m_controls.rbegin(), m_controls.rend(), control);
+    wxCHECK_RET( it != m_controls.rend(), "control not found" );
+
+    m_controls.erase(std::next(it).base());
+
+    control->Refresh();
+}
+
+wxWindowlessControl* wxWindowlessPanel::HitTestControl(const wxPoint& pt) const
+{
+    // Controls created later are drawn over the earlier ones, so check them
+    // first.
+    for ( std::vector<wxWindowlessControl*>::const_reverse_iterator
+            it = m_controls.rbegin(); it != m_controls.rend(); ++it )
+    {
+        wxWindowlessControl* const control = *it;
+        if ( control->IsShown() && control->GetRect().Contains(pt) )
+            return control;
+    }
+
+    return nullptr;
+}
+
+bool wxWindowlessPanel::AcceptsFocus() const
+{
+    for ( wxWindowlessControl* control : m_controls )
+    {
+        if ( control->IsShown() && control->IsThisEnabled() &&
+                control->AcceptsFocus() )
+            return true;
+    }
+
+    return wxPanel::AcceptsFocus();
+}
+
+void wxWindowlessPanel::SetFocusedControl(wxWindowlessControl* control)
+{
+    if ( control == m_focused )
+        return;
+
+    const bool hasFocus = HasFocus();
+
+    if ( m_focused )
+    {
+        if ( hasFocus )
+            SendFocusEvent(m_focused, wxEVT_KILL_FOCUS);
+        m_focused->Refresh();
+    }
+
+    m_focused = control;
+
+    if ( m_focused )
+    {
+        if ( hasFocus )
+            SendFocusEvent(m_focused, wxEVT_SET_FOCUS);
+        m_focused->Refresh();
+    }
+}
+
+void wxWindowlessPanel::SendFocusEvent(wxWindowlessControl* control,
+                                       wxEventType type)
+{
+    wxFocusEvent event(type, control->GetId());
+    event.SetEventObject(control);
+    control->ProcessEvent(event);
+}
+
+bool wxWindowlessPanel::SendMouseEvent(wxWindowlessControl* control,
+                                       const wxMouseEvent& event,
+                                       wxEventType type)
+{
+    wxMouseEvent eventControl(event);
+    if ( type != wxEVT_NULL )
+        eventControl.SetEventType(type);
+    eventControl.SetEventObject(control);
+    eventControl.SetId(control->GetId());
+
+    // Use the control coordinates, as for the real windows.
+    eventControl.SetPosition(event.GetPosition() - control->GetPosition());
+
+    return control->ProcessEvent(eventControl);
+}
+
+bool wxWindowlessPanel::SendKeyEvent(wxWindowlessControl* control,
+                                     const wxKeyEvent& event)
+{
+    wxKeyEvent eventControl(event);
+    eventControl.SetEventObject(control);
+    eventControl.SetId(control->GetId());
+
+    return control->ProcessEvent(eventControl);
+}
+
+void wxWindowlessPanel::OnPaint(wxPaintEvent& WXUNUSED(event))
+{
+    wxPaintDC dc(this);
+
+    const wxRegion& updateRegion = GetUpdateRegion();
+    for ( wxWindowlessControl* control : m_controls )
+    {
+        if ( !control->IsShown() )
+            continue;
+
+        // Don't bother drawing the controls outside of the updated area, this
+        // is important when there are many of them.
+        if ( updateRegion.Contains(control->GetRect()) == wxOutRegion )
+            continue;
+
+        control->Draw(dc);
+    }
+}
+
+bool wxWindowlessPanel::TryBefore(wxEvent& event)
+{
+    // Let the windowless controls process the mouse and keyboard events before
+    // this window itself, so that its handlers only get the events which were
+    // not processed by them, as it would be the case for the real children.
+    if ( event.GetEventObject() == this )
+    {
+        if ( wxMouseEvent* const mouseEvent = wxDynamicCast(&event, wxMouseEvent) )
+        {
+            if ( ProcessMouseEvent(*mouseEvent) )
+                return true;
+        }
+        else if ( wxKeyEvent* const keyEvent = wxDynamicCast(&event, wxKeyEvent) )
+        {
+            if ( m_focused && SendKeyEvent(m_focused, *keyEvent) )
+                return true;
+        }
+    }
+
+    return wxPanel::TryBefore(event);
+}
+
+bool wxWindowlessPanel::ProcessMouseEvent(const wxMouseEvent& event)
+{
+    const wxEventType type = event.GetEventType();
+
+    // Disabled controls don't get mouse events, just as disabled windows.
+    wxWindowlessControl* control = nullptr;
+    if ( type != wxEVT_LEAVE_WINDOW )
+    {
+        control = HitTestControl(event.GetPosition());
+        if ( control && !control->IsEnabled() )
+            control = nullptr;
+    }
+
+    // Generate the enter and leave events for the controls themselves.
+    if ( control != m_hovered )
+    {
+        if ( m_hovered )
+            SendMouseEvent(m_hovered, event, wxEVT_LEAVE_WINDOW);
+
+        m_hovered = control;
+
+        if ( m_hovered )
+            SendMouseEvent(m_hovered, event, wxEVT_ENTER_WINDOW);
+    }
+
+    if ( type == wxEVT_ENTER_WINDOW || type == wxEVT_LEAVE_WINDOW )
+        return false;
+
+    // While a mouse button is pressed, all mouse events inside this window go
+    // to the control in which it was pressed, as they would if it were a
+    // window. Note that we don't capture the mouse, so this doesn't work for
+    // the events outside of it and we need to reset the pressed control on the
+    // next button press in case we missed the button release.
+    if ( event.ButtonDown() )
+    {
+        m_mouseCapture = control;
+
+        if ( control && control->AcceptsFocus() )
+            control->SetFocus();
+    }
+
+    wxWindowlessControl* const target = m_mouseCapture ? m_mouseCapture
+                                                       : control;
+    const bool processed = target && SendMouseEvent(target, event);
+
+    if ( event.ButtonUp() && !event.ButtonIsDown(wxMOUSE_BTN_ANY) )
+        m_mouseCapture = nullptr;
+
+    return processed;
+}
+
+void wxWindowlessPanel::OnFocus(wxFocusEvent& event)
+{
+    if ( event.GetEventType() == wxEVT_SET_FOCUS )
+    {
+        // Give focus to the first control accepting it if none had it yet.
+        if ( !m_focused )
+        {
+            for ( wxWindowlessControl* control : m_controls )
+            {
+                if ( control->IsShown() && control->IsEnabled() &&
+                        control->AcceptsFocus() )
+                {
+                    m_focused = control;
+                    break;
+                }
+            }
+        }
+
+        if ( m_focused )
+        {
+            SendFocusEvent(m_focused, wxEVT_SET_FOCUS);
+            m_focused->Refresh();
+        }
+    }
+    else // wxEVT_KILL_FOCUS
+    {
+        if ( m_focused )
+        {
+            SendFocusEvent(m_focused, wxEVT_KILL_FOCUS);
+            m_focused->Refresh();
+        }
+    }
+
+    event.Skip();
+}
@@ -22,6 +22,8 @@
 #include "wx/math.h"
 #include "wx/rawbmp.h"
 
+#include "wx/private/premultiply.h"
+
 #include "wx/gtk/private/object.h"
 #include "wx/gtk/private.h"
 
@@ -584,6 +586,46 @@ static void CopyImageData(
     }
 }
 
+#ifdef __WXGTK3__
+// Create a pixbuf with the same contents as the given surface, this is faster
+// than gdk_pixbuf_get_from_surface() for the common surface formats.
+static GdkPixbuf* PixbufFromSurface(cairo_surface_t* surface, int w, int h)
+{
+    const cairo_format_t format = cairo_image_surface_get_format(surface);
+    if (format != CAIRO_FORMAT_ARGB32 && format != CAIRO_FORMAT_RGB24)
+        return gdk_pixbuf_get_from_surface(surface, 0, 0, w, h);
+
+    const bool hasAlpha = format == CAIRO_FORMAT_ARGB32;
+    GdkPixbuf* pixbuf = gdk_pixbuf_new(GDK_COLORSPACE_RGB, hasAlpha, 8, w, h);
+    if (pixbuf == nullptr)
+        return nullptr;
+
+    cairo_surface_flush(surface);
+    const guchar* src = cairo_image_surface_get_data(surface);
+    const int srcStride = cairo_image_surface_get_stride(surface);
+    guchar* dst = gdk_pixbuf_get_pixels(pixbuf);
+    const int dstStride = gdk_pixbuf_get_rowstride(pixbuf);
+    for (int j = 0; j < h; j++, src += srcStride, dst += dstStride)
+    {
+        const guint32* s = reinterpret_cast<const guint32*>(src);
+        if (hasAlpha)
+            wxUnpremultiplyPixels(s, dst, w);
+        else
+        {
+            guchar* d = dst;
+            for (int i = 0; i < w; i++, d += 3)
+            {
+                d[0] = guchar(s[i] >> 16);
+                d[1] = guchar(s[i] >> 8);
+                d[2] = guchar(s[i]);
+            }
+        }
+    }
+
+    return pixbuf;
+}
+#endif // __WXGTK3__
+
 #if wxUSE_IMAGE
 #ifdef __WXGTK3__
 void wxBitmap::InitFromImage(const wxImage& image, int depth, double scale)
@@ -600,21 +642,44 @@ void wxBitmap::InitFromImage(const wxImage& image, int depth, double scale)
     wxBitmapRefData* bmpData = new wxBitmapRefData(w, h, depth);
     bmpData->m_scaleFactor = scale;
     m_refData = bmpData;
-    GdkPixbuf* pixbuf_dst = gdk_pixbuf_new(GDK_COLORSPACE_RGB, depth == 32, 8, w, h);
-    bmpData->m_pixbufNoMask = pixbuf_dst;
-    wxASSERT(bmpData->m_bpp == 32 || !gdk_pixbuf_get_has_alpha(bmpData->m_pixbufNoMask));
     const guchar* src = image.GetData();
 
-    guchar* dst = gdk_pixbuf_get_pixels(pixbuf_dst);
-    const int dstStride = gdk_pixbuf_get_rowstride(pixbuf_dst);
-    CopyImageData(dst, gdk_pixbuf_get_n_channels(pixbuf_dst), dstStride, src, 3, 3 * w, w, h);
-
-    if (depth == 32 && alpha)
+    if (depth == 1)
     {
-        for (int j = 0; j < h; j++, dst += dstStride)
-            for (int i = 0; i < w; i++)
-                dst[i * 4 + 3] = *alpha++;
+        GdkPixbuf* pixbuf_dst = gdk_pixbuf_new(GDK_COLORSPACE_RGB, false, 8, w, h);
+        bmpData->m_pixbufNoMask = pixbuf_dst;
+        CopyImageData(gdk_pixbuf_get_pixels(pixbuf_dst), 3,
+            gdk_pixbuf_get_rowstride(pixbuf_dst), src, 3, 3 * w, w, h);
     }
+    else
+    {
+        // Write the image data directly to the surface used for drawing the
+        // bitmap, instead of creating a pixbuf which would have to be
+        // converted to the surface later anyhow.
+        cairo_surface_t* surface = cairo_image_surface_create(
+            depth == 32 ? CAIRO_FORMAT_ARGB32 : CAIRO_FORMAT_RGB24, w, h);
+        bmpData->m_surface = surface;
+
+        guchar* dst = cairo_image_surface_get_data(surface);
+        const int dstStride = cairo_image_surface_get_stride(surface);
+        if (depth == 32)
+        {
+            image.CopyToPremultipliedARGB(reinterpret_cast<guint32*>(dst), dstStride);
+        }
+        else
+        {
+            // Alpha, if any, must be ignored here.
+            const guchar* s = src;
+            for (int j = 0; j < h; j++, dst += dstStride)
+            {
+                guint32* d = reinterpret_cast<guint32*>(dst);
+                for (int i = 0; i < w; i++, s += 3)
+                    d[i] = 0xff000000u | (guint32(s[0]) << 16) | (guint32(s[1]) << 8) | s[2];
+            }
+        }
+        cairo_surface_mark_dirty(surface);
+    }
+
     if (image.HasMask())
     {
         const guchar r = image.GetMaskRed();
@@ -622,7 +687,7 @@ void wxBitmap::InitFromImage(const wxImage& image, int depth, double scale)
         const guchar b = image.GetMaskBlue();
         cairo_surface_t* surface = cairo_image_surface_create(CAIRO_FORMAT_A8, w, h);
         const int stride = cairo_image_surface_get_stride(surface);
-        dst = cairo_image_surface_get_data(surface);
+        guchar* dst = cairo_image_surface_get_data(surface);
         memset(dst, 0xff, stride * h);
         for (int j = 0; j < h; j++, dst += stride)
             for (int i = 0; i < w; i++, src += 3)
@@ -804,7 +869,7 @@ wxImage wxBitmap::ConvertToImage() const
         pixbuf_src = bmpData->m_pixbufNoMask;
     else if (bmpData->m_surface)
     {
-        pixbuf_src = gdk_pixbuf_get_from_surface(bmpData->m_surface, 0, 0, w, h);
+        pixbuf_src = PixbufFromSurface(bmpData->m_surface, w, h);
         bmpData->m_pixbufNoMask = pixbuf_src;
         wxASSERT(bmpData->m_bpp == 32 || !gdk_pixbuf_get_has_alpha(bmpData->m_pixbufNoMask));
     }
@@ -1282,7 +1347,7 @@ GdkPixbuf* wxBitmap::GetPixbufNoMask() const
     const int w = bmpData->m_width;
     const int h = bmpData->m_height;
     if (bmpData->m_surface)
-        pixbuf = gdk_pixbuf_get_from_surface(bmpData->m_surface, 0, 0, w, h);
+        pixbuf = PixbufFromSurface(bmpData->m_surface, w, h);
     else
         pixbuf = gdk_pixbuf_new(GDK_COLORSPACE_RGB, bmpData->m_bpp == 32, 8, w, h);
     bmpData->m_pixbufNoMask = pixbuf;
@@ -0,0 +1,210 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        src/gtk/layoutcache.cpp
+// Purpose:     wxPangoLayoutCache implementation
+// Author:      wxWidgets team
+// Created:     2026-10-14
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+// for compilers that support precompilation, includes "wx.h".
+#include "wx/wxprec.h"
+
+#ifndef WX_PRECOMP
+    #include "wx/font.h"
+    #include "wx/module.h"
+    #include "wx/thread.h"
+#endif //WX_PRECOMP
+
+#include "wx/fontutil.h"
+#include "wx/gtk/private/layoutcache.h"
+
+#include <pango/pangocairo.h>
+
+namespace
+{
+
+wxPangoLayoutCache* gs_layoutCache = nullptr;
+
+} // anonymous namespace
+
+// ============================================================================
+// wxPangoLayoutCache implementation
+// ============================================================================
+
+/* static */
+wxPangoLayoutCache* wxPangoLayoutCache::Get()
+{
+#if wxUSE_THREADS
+    if ( !wxThread::IsMain() )
+        return nullptr;
+#endif // wxUSE_THREADS
+
+    return gs_layoutCache;
+}
+
+bool wxPangoLayoutCache::Key::operator==(const Key& other) const
+{
+    return context == other.context &&
+            underlined == other.underlined &&
+                strikethrough == other.strikethrough &&
+                    text == other.text &&
+                        pango_font_description_equal(desc, other.desc);
+}
+
+size_t wxPangoLayoutCache::KeyHash::operator()(const Key& key) const
+{
+    size_t h = std::hash<std::string>()(key.text);
+    h = h*31 + pango_font_description_hash(key.desc);
+    h = h*31 + std::hash<PangoContext*>()(key.context);
+    h = h*31 + (key.underlined ? 1 : 0) + (key.strikethrough ? 2 : 0);
+    return h;
+}
+
+PangoLayout* wxPangoLayoutCache::Find(const Key& key)
+{
+    const auto it = m_index.find(key);
+    if ( it == m_index.end() )
+    {
+        m_misses++;
+        return nullptr;
+    }
+
+    m_hits++;
+
+    m_entries.splice(m_entries.begin(), m_entries, it->second);
+
+    return it->second->layout;
+}
+
+void wxPangoLayoutCache::Add(const Key& key, PangoLayout* layout)
+{
+    if ( !m_maxCount )
+    {
+        // We can't delete the layout immediately, as it's going to be used by
+        // the caller, so just keep it until the next call.
+        if ( m_uncached )
+            g_object_unref(m_uncached);
+        m_uncached = layout;
+        return;
+    }
+
+    while ( m_entries.size() >= m_maxCount )
+        RemoveLast();
+
+    // The key stored in the cache must have its own copy of the description.
+    m_entries.push_front(Entry{key, layout});
+
+    Entry& entry = m_entries.front();
+    entry.key.desc = pango_font_description_copy(key.desc);
+
+    m_index.emplace(entry.key, m_entries.begin());
+}
+
+void wxPangoLayoutCache::RemoveLast()
+{
+    Entry& entry = m_entries.back();
+
+    m_index.erase(entry.key);
+    pango_font_description_free(const_cast<PangoFontDescription*>(entry.key.desc));
+    g_object_unref(entry.layout);
+
+    m_entries.pop_back();
+}
+
+PangoLayout*
+wxPangoLayoutCache::GetForContext(PangoContext* context,
+                                  const wxFont& font,
+                                  const char* text, size_t len)
+{
+    const Key key{context, font.GetNativeFontInfo()->description,
+                  false, false, std::string(text, len)};
+
+    if ( PangoLayout* const layout = Find(key) )
+        return layout;
+
+    PangoLayout* const layout = pango_layout_new(context);
+    pango_layout_set_font_description(layout, key.desc);
+    pango_layout_set_text(layout, key.text.c_str(), key.text.length());
+
+    Add(key, layout);
+
+    return layout;
+}
+
+PangoLayout*
+wxPangoLayoutCache::GetForCairo(cairo_t* cr,
+                                const wxFont& font,
+                                const char* text, size_t len)
+{
+    const Key key{nullptr, font.GetNativeFontInfo()->description,
+                  font.GetUnderlined(), font.GetStrikethrough(),
+                  std::string(text, len)};
+
+    if ( PangoLayout* const layout = Find(key) )
+    {
+        // This does nothing if the layout context already corresponds to
+        // this Cairo context, e.g. if it uses the same transformation, and
+        // lays out the text again otherwise.
+        pango_cairo_update_layout(cr, layout);
+        return layout;
+    }
+
+    PangoLayout* const layout = pango_cairo_create_layout(cr);
+    pango_layout_set_font_description(layout, key.desc);
+    pango_layout_set_text(layout, key.text.c_str(), key.text.length());
+
+    // Note that Pango attributes don't depend on font size, so they can be
+    // set for the scaled font too.
+    font.GTKSetPangoAttrs(layout);
+
+    Add(key, layout);
+
+    return layout;
+}
+
+void wxPangoLayoutCache::SetMaxCount(size_t maxCount)
+{
+    m_maxCount = maxCount;
+
+    while ( m_entries.size() > m_maxCount )
+        RemoveLast();
+}
+
+void wxPangoLayoutCache::Clear()
+{
+    while ( !m_entries.empty() )
+        RemoveLast();
+
+    if ( m_uncached )
+    {
+        g_object_unref(m_uncached);
+        m_uncached = nullptr;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// wxPangoLayoutCacheModule
+// ----------------------------------------------------------------------------
+
+class wxPangoLayoutCacheModule : public wxModule
+{
+public:
+    wxPangoLayoutCacheModule() = default;
+
+    virtual bool OnInit() override
+    {
+        gs_layoutCache = new wxPangoLayoutCache;
+        return true;
+    }
+
+    virtual void OnExit() override
+    {
+        wxDELETE(gs_layoutCache);
+    }
+
+private:
+    wxDECLARE_DYNAMIC_CLASS(wxPangoLayoutCacheModule);
+};
+
+wxIMPLEMENT_DYNAMIC_CLASS(wxPangoLayoutCacheModule, wxModule);
@@ -28,6 +28,7 @@
 #include "wx/fontutil.h"
 #include "wx/gtk/private.h"
 #include "wx/gtk/dc.h"
+#include "wx/gtk/private/layoutcache.h"
 
 #ifndef __WXGTK3__
     #include "wx/gtk/dcclient.h"
@@ -41,6 +42,7 @@ void wxTextMeasure::Init()
 {
     m_context = nullptr;
     m_layout = nullptr;
+    m_layoutCache = nullptr;
 
 #ifndef __WXGTK3__
     m_wdc = nullptr;
@@ -77,7 +79,13 @@ void wxTextMeasure::BeginMeasuring()
     {
         m_context = gtk_widget_get_pango_context( m_win->GetHandle() );
         if ( m_context )
-            m_layout = pango_layout_new(m_context);
+        {
+            // Measuring the same strings, e.g. the labels of the controls,
+            // happens often, so reuse their layouts if we can.
+            m_layoutCache = wxPangoLayoutCache::Get();
+            if ( !m_layoutCache )
+                m_layout = pango_layout_new(m_context);
+        }
     }
 
     // set the font to use
@@ -90,6 +98,8 @@ void wxTextMeasure::BeginMeasuring()
 
 void wxTextMeasure::EndMeasuring()
 {
+    m_layoutCache = nullptr;
+
     if ( !m_layout )
         return;
 
@@ -104,6 +114,23 @@ void wxTextMeasure::EndMeasuring()
     {
         g_object_unref (m_layout);
     }
+
+    m_layout = nullptr;
+}
+
+PangoLayout* wxTextMeasure::GetLayout(const wxString& text)
+{
+    const wxScopedCharBuffer data = text.utf8_str();
+
+    if ( m_layoutCache )
+    {
+        return m_layoutCache->GetForContext(m_context, GetFont(),
+                                            data, data.length());
+    }
+
+    pango_layout_set_text(m_layout, data, data.length());
+
+    return m_layout;
 }
 
 // Notice we don't check here the font. It is supposed to be OK before the call.
@@ -123,26 +150,25 @@ void wxTextMeasure::DoGetTextExtent(const wxString& string,
         return;
     }
 
-    // Set layout's text
-    pango_layout_set_text(m_layout, string.utf8_str(), -1);
+    PangoLayout* const layout = GetLayout(string);
 
     if ( m_dc )
     {
         // in device units
-        pango_layout_get_pixel_size(m_layout, width, height);
+        pango_layout_get_pixel_size(layout, width, height);
     }
     else // win
     {
         // the logical rect bounds the ink rect
         PangoRectangle rect;
-        pango_layout_get_extents(m_layout, nullptr, &rect);
+        pango_layout_get_extents(layout, nullptr, &rect);
         *width = PANGO_PIXELS(rect.width);
         *height = PANGO_PIXELS(rect.height);
     }
 
     if (descent)
     {
-        PangoLayoutIter *iter = pango_layout_get_iter(m_layout);
+        PangoLayoutIter *iter = pango_layout_get_iter(layout);
         int baseline = pango_layout_iter_get_baseline(iter);
         pango_layout_iter_free(iter);
         *descent = *height - PANGO_PIXELS(baseline);
@@ -159,17 +185,16 @@ bool wxTextMeasure::DoGetPartialTextExtents(const wxString& text,
                                             wxArrayInt& widths,
                                             double scaleX)
 {
-    if ( !m_layout )
+    if ( !m_context )
         return wxTextMeasureBase::DoGetPartialTextExtents(text, widths, scaleX);
 
-    // Set layout's text
-    pango_layout_set_text(m_layout, text.utf8_str(), -1);
+    PangoLayout* const layout = GetLayout(text);
 
     // Calculate the position of each character based on the widths of
     // the previous characters
 
     // Code borrowed from Scintilla's PlatGTK
-    PangoLayoutIter *iter = pango_layout_get_iter(m_layout);
+    PangoLayoutIter *iter = pango_layout_get_iter(layout);
     PangoRectangle pos;
     pango_layout_iter_get_cluster_extents(iter, nullptr, &pos);
     size_t i = 0;
@@ -17,6 +17,8 @@
 #include "wx/gtk/private/wrapgtk.h"
 #include "wx/gtk/private/threads.h"
 
+#include <stdlib.h>
+
 // ----------------------------------------------------------------------------
 // wxTimerImpl
 // ----------------------------------------------------------------------------
@@ -56,7 +58,21 @@ bool wxGTKTimerImpl::Start(int millisecs, bool oneShot)
 
     wxASSERT_MSG( !m_sourceId, wxT("shouldn't be still running") );
 
-    m_sourceId = g_timeout_add(m_milli, timeout_callback, this);
+    // GLib doesn't allow specifying the tolerance directly, but the timers
+    // created by g_timeout_add_seconds() all expire together at the same
+    // time, so use it if the difference from the requested interval due to
+    // rounding it to whole seconds and the up to one second of additional
+    // delay is within the tolerance
+    const int seconds = (m_milli + 500) / 1000;
+    if ( seconds > 0 &&
+            abs(seconds*1000 - m_milli) + 1000 <= m_tolerance )
+    {
+        m_sourceId = g_timeout_add_seconds(seconds, timeout_callback, this);
+    }
+    else
+    {
+        m_sourceId = g_timeout_add(m_milli, timeout_callback, this);
+    }
 
     return true;
 }
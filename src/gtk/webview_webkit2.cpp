@@ -30,16 +30,20 @@
 #include "wx/filesys.h"
 #include "wx/base64.h"
 #include "wx/log.h"
+#include "wx/mstream.h"
 #include "wx/gtk/private/webview_webkit2_extension.h"
 #include "wx/gtk/private/string.h"
 #include "wx/gtk/private/webkit.h"
 #include "wx/gtk/private/error.h"
+#include "wx/gtk/private/object.h"
 #include "wx/gtk/private/variant.h"
 #include "wx/private/jsscriptwrapper.h"
 #include <webkit2/webkit2.h>
 #include <JavaScriptCore/JSValueRef.h>
 #include <JavaScriptCore/JSStringRef.h>
 
+#include <map>
+
 #if WEBKIT_CHECK_VERSION(2, 10, 0)
 #define wxHAVE_WEBKIT_WEBSITE_DATA_MANAGER
 #endif
@@ -472,6 +476,346 @@ wxgtk_webview_webkit_title_changed(GtkWidget* widget,
     g_free(title);
 }
 
+// ----------------------------------------------------------------------------
+// GInputStream reading the data of wxWebViewHandlerResponseData
+// ----------------------------------------------------------------------------
+
+// This stream is read by WebKit in chunks as it needs the data, so that the
+// entire response never needs to be in memory at once.
+struct wxGtkWebViewResponseStream
+{
+    GInputStream parent;
+
+    // Allocated on the heap as GObject doesn't run C++ ctors and dtors.
+    wxSharedPtr<wxWebViewHandlerResponseData>* data;
+};
+
+struct wxGtkWebViewResponseStreamClass
+{
+    GInputStreamClass parent_class;
+};
+
+static GObjectClass* wxGtkWebViewResponseStreamParentClass;
+
+extern "C" {
+
+static gssize
+wxgtk_webview_response_stream_read(GInputStream* gstream,
+                                   void* buffer,
+                                   gsize count,
+                                   GCancellable* WXUNUSED(cancellable),
+                                   GError** error)
+{
+    wxGtkWebViewResponseStream* const
+        self = reinterpret_cast<wxGtkWebViewResponseStream*>(gstream);
+
+    wxInputStream* const stream = (*self->data)->GetStream();
+    if ( !stream )
+        return 0;
+
+    const size_t numRead = stream->Read(buffer, count).LastRead();
+    if ( !numRead )
+    {
+        switch ( stream->GetLastError() )
+        {
+            case wxSTREAM_NO_ERROR:
+            case wxSTREAM_EOF:
+                break;
+
+            default:
+                g_set_error_literal(error, G_IO_ERROR, G_IO_ERROR_FAILED,
+                                    "Reading the response data failed");
+                return -1;
+        }
+    }
+
+    return numRead;
+}
+
+// WebKit reads the stream asynchronously and the default implementation of
+// this function reads it in a worker thread, but we want to read it in the
+// main thread to allow using any wxInputStream, so do it synchronously here,
+// the completion callback is still called asynchronously by GTask.
+static void
+wxgtk_webview_response_stream_read_async(GInputStream* gstream,
+                                         void* buffer,
+                                         gsize count,
+                                         int WXUNUSED(io_priority),
+                                         GCancellable* cancellable,
+                                         GAsyncReadyCallback callback,
+                                         gpointer user_data)
+{
+    GTask* const task = g_task_new(gstream, cancellable, callback, user_data);
+
+    GError* error = nullptr;
+    const gssize numRead = wxgtk_webview_response_stream_read(gstream, buffer,
+                                                              count, cancellable,
+                                                              &error);
+    if ( numRead < 0 )
+        g_task_return_error(task, error);
+    else
+        g_task_return_int(task, numRead);
+
+    g_object_unref(task);
+}
+
+static gssize
+wxgtk_webview_response_stream_read_finish(GInputStream* WXUNUSED(gstream),
+                                          GAsyncResult* result,
+                                          GError** error)
+{
+    return g_task_propagate_int(G_TASK(result), error);
+}
+
+static void wxgtk_webview_response_stream_finalize(GObject* object)
+{
+    wxGtkWebViewResponseStream* const
+        self = reinterpret_cast<wxGtkWebViewResponseStream*>(object);
+
+    delete self->data;
+
+    wxGtkWebViewResponseStreamParentClass->finalize(object);
+}
+
+static void wxgtk_webview_response_stream_class_init(void* g_class, void*)
+{
+    GInputStreamClass* const stream_class = G_INPUT_STREAM_CLASS(g_class);
+    stream_class->read_fn = wxgtk_webview_response_stream_read;
+    stream_class->read_async = wxgtk_webview_response_stream_read_async;
+    stream_class->read_finish = wxgtk_webview_response_stream_read_finish;
+
+    G_OBJECT_CLASS(g_class)->finalize = wxgtk_webview_response_stream_finalize;
+
+    wxGtkWebViewResponseStreamParentClass =
+        G_OBJECT_CLASS(g_type_class_peek_parent(g_class));
+}
+
+} // extern "C"
+
+static GType wxGtkWebViewResponseStreamType()
+{
+    static GType type;
+    if ( type == 0 )
+    {
+        const char* name = "wxGtkWebViewResponseStream";
+        char buf[40];
+        for ( unsigned i = 0; g_type_from_name(name); i++ )
+        {
+            g_snprintf(buf, sizeof(buf), "wxGtkWebViewResponseStream%u", i);
+            name = buf;
+        }
+        const GTypeInfo info = {
+            sizeof(wxGtkWebViewResponseStreamClass),
+            nullptr, nullptr,
+            wxgtk_webview_response_stream_class_init,
+            nullptr, nullptr,
+            sizeof(wxGtkWebViewResponseStream), 0,
+            nullptr, nullptr
+        };
+        type = g_type_register_static(
+            G_TYPE_INPUT_STREAM, name, &info, GTypeFlags(0));
+    }
+    return type;
+}
+
+static GInputStream*
+wxGtkWebViewResponseStreamNew(const wxSharedPtr<wxWebViewHandlerResponseData>& data)
+{
+    wxGtkWebViewResponseStream* const self = static_cast<wxGtkWebViewResponseStream*>(
+        g_object_new(wxGtkWebViewResponseStreamType(), nullptr));
+
+    self->data = new wxSharedPtr<wxWebViewHandlerResponseData>(data);
+
+    return G_INPUT_STREAM(self);
+}
+
+// ----------------------------------------------------------------------------
+// wxWebViewHandler request and response implementation
+// ----------------------------------------------------------------------------
+
+class wxWebViewWebKitHandlerRequest : public wxWebViewHandlerRequest
+{
+public:
+    explicit wxWebViewWebKitHandlerRequest(WebKitURISchemeRequest* request)
+        : m_request(request),
+          m_dataStream(nullptr)
+    { }
+
+    ~wxWebViewWebKitHandlerRequest() { delete m_dataStream; }
+
+    virtual wxString GetRawURI() const override
+    {
+        return wxString::FromUTF8(webkit_uri_scheme_request_get_uri(m_request));
+    }
+
+    virtual wxInputStream* GetData() const override
+    {
+#if WEBKIT_CHECK_VERSION(2, 40, 0)
+        if ( !m_dataStream && wx_check_webkit_version(2, 40, 0) )
+        {
+            wxGtkObject<GInputStream>
+                body(webkit_uri_scheme_request_get_http_body(m_request));
+            if ( !body )
+                return nullptr;
+
+            char buf[4096];
+            gssize numRead;
+            while ( (numRead = g_input_stream_read(body, buf, sizeof(buf),
+                                                   nullptr, nullptr)) > 0 )
+            {
+                m_data.AppendData(buf, numRead);
+            }
+
+            m_dataStream = new wxMemoryInputStream(m_data.GetData(),
+                                                   m_data.GetDataLen());
+        }
+#endif // WebKit 2.40+
+
+        return m_dataStream;
+    }
+
+    virtual wxString GetMethod() const override
+    {
+#if WEBKIT_CHECK_VERSION(2, 36, 0)
+        if ( wx_check_webkit_version(2, 36, 0) )
+        {
+            const char* const
+                method = webkit_uri_scheme_request_get_http_method(m_request);
+            if ( method )
+                return wxString::FromUTF8(method);
+        }
+#endif // WebKit 2.36+
+
+        return "GET";
+    }
+
+    virtual wxString GetHeader(const wxString& name) const override
+    {
+#if WEBKIT_CHECK_VERSION(2, 36, 0)
+        if ( wx_check_webkit_version(2, 36, 0) )
+        {
+            SoupMessageHeaders* const
+                headers = webkit_uri_scheme_request_get_http_headers(m_request);
+            if ( headers )
+            {
+                return wxString::FromUTF8(
+                    soup_message_headers_get_one(headers, name.utf8_str()));
+            }
+        }
+#else // WebKit < 2.36
+        wxUnusedVar(name);
+#endif // WebKit 2.36+/older
+
+        return wxString();
+    }
+
+private:
+    WebKitURISchemeRequest* const m_request;
+
+    mutable wxInputStream* m_dataStream;
+    mutable wxMemoryBuffer m_data;
+
+    wxDECLARE_NO_COPY_CLASS(wxWebViewWebKitHandlerRequest);
+};
+
+class wxWebViewWebKitHandlerResponse : public wxWebViewHandlerResponse
+{
+public:
+    explicit wxWebViewWebKitHandlerResponse(WebKitURISchemeRequest* request)
+        : m_request(WEBKIT_URI_SCHEME_REQUEST(g_object_ref(request))),
+          m_status(200)
+    { }
+
+    ~wxWebViewWebKitHandlerResponse() { g_object_unref(m_request); }
+
+    virtual void SetStatus(int status) override
+    { m_status = status; }
+
+    virtual void SetContentType(const wxString& contentType) override
+    { m_contentType = contentType; }
+
+    virtual void SetHeader(const wxString& name, const wxString& value) override
+    { m_headers[name] = value; }
+
+    using wxWebViewHandlerResponse::Finish;
+
+    virtual void Finish(wxSharedPtr<wxWebViewHandlerResponseData> data) override
+    {
+        GInputStream* gstream;
+        gint64 length;
+        if ( data )
+        {
+            gstream = wxGtkWebViewResponseStreamNew(data);
+
+            const wxFileOffset contentLength = data->GetContentLength();
+            length = contentLength == wxInvalidOffset ? -1 : contentLength;
+        }
+        else
+        {
+            gstream = g_memory_input_stream_new();
+            length = 0;
+        }
+
+        wxGtkObject<GInputStream> stream(gstream);
+
+        const wxScopedCharBuffer contentType = m_contentType.utf8_str();
+
+#if WEBKIT_CHECK_VERSION(2, 36, 0)
+        if ( wx_check_webkit_version(2, 36, 0) )
+        {
+            wxGtkObject<WebKitURISchemeResponse>
+                response(webkit_uri_scheme_response_new(stream, length));
+
+            webkit_uri_scheme_response_set_status(response, m_status, nullptr);
+            if ( !m_contentType.empty() )
+                webkit_uri_scheme_response_set_content_type(response, contentType);
+
+            if ( !m_headers.empty() )
+            {
+                SoupMessageHeaders* const
+                    headers = soup_message_headers_new(SOUP_MESSAGE_HEADERS_RESPONSE);
+                for ( const auto& kv : m_headers )
+                {
+                    soup_message_headers_replace(headers,
+                                                 kv.first.utf8_str(),
+                                                 kv.second.utf8_str());
+                }
+
+                // This takes ownership of the headers.
+                webkit_uri_scheme_response_set_http_headers(response, headers);
+            }
+
+            webkit_uri_scheme_request_finish_with_response(m_request, response);
+            return;
+        }
+#endif // WebKit 2.36+
+
+        // Only the content type can be set with the older versions.
+        webkit_uri_scheme_request_finish(m_request, stream, length,
+                                         m_contentType.empty() ? nullptr
+                                                               : contentType.data());
+    }
+
+    virtual void FinishWithError() override
+    {
+        const char* const uri = webkit_uri_scheme_request_get_uri(m_request);
+
+        wxGtkError error(g_error_new(WEBKIT_NETWORK_ERROR,
+                                     WEBKIT_NETWORK_ERROR_FILE_DOES_NOT_EXIST,
+                                     "File not found: %s", uri));
+        webkit_uri_scheme_request_finish_error(m_request, error);
+    }
+
+private:
+    WebKitURISchemeRequest* const m_request;
+
+    int m_status;
+    wxString m_contentType;
+    std::map<wxString, wxString> m_headers;
+
+    wxDECLARE_NO_COPY_CLASS(wxWebViewWebKitHandlerResponse);
+};
+
 static void
 wxgtk_webview_webkit_uri_scheme_request_cb(WebKitURISchemeRequest *request,
                                            wxWebViewWebKit *webKitCtrl)
@@ -492,27 +836,11 @@ wxgtk_webview_webkit_uri_scheme_request_cb(WebKitURISchemeRequest *request,
 
     if(handler)
     {
-        const wxString uri = wxString::FromUTF8(webkit_uri_scheme_request_get_uri(request));
+        const wxWebViewWebKitHandlerRequest handlerRequest(request);
+        wxSharedPtr<wxWebViewHandlerResponse>
+            response(new wxWebViewWebKitHandlerResponse(request));
 
-        wxFSFile* file = handler->GetFile(uri);
-        if(file)
-        {
-            gint64 length = file->GetStream()->GetLength();
-            guint8 *data = g_new(guint8, length);
-            file->GetStream()->Read(data, length);
-            GInputStream *stream = g_memory_input_stream_new_from_data(data,
-                                                                       length,
-                                                                       g_free);
-            wxString mime = file->GetMimeType();
-            webkit_uri_scheme_request_finish(request, stream, length, mime.utf8_str());
-        }
-        else
-        {
-            wxGtkError error(g_error_new(WEBKIT_NETWORK_ERROR,
-                                         WEBKIT_NETWORK_ERROR_FILE_DOES_NOT_EXIST,
-                                         "File not found: %s", uri.utf8_str().data()));
-            webkit_uri_scheme_request_finish_error(request, error);
-        }
+        handler->StartRequest(handlerRequest, response);
     }
     else
     {
@@ -2782,11 +2782,15 @@ void wxWindowGTK::Init()
 
     m_showOnIdle = false;
     m_needCursorReset = false;
+    m_styleUpdateDeferred = false;
+    m_styleUpdatePending = false;
+    m_styleUpdateForced = false;
     m_noExpose = false;
     m_nativeSizeEvent = false;
 #ifdef __WXGTK3__
     m_paintContext = nullptr;
     m_styleProvider = nullptr;
+    m_frameTickId = 0;
     m_needSizeEvent = false;
 #endif
 
@@ -2981,6 +2985,10 @@ wxWindowGTK::~wxWindowGTK()
     if ( g_windowUnderMouse == this )
         g_windowUnderMouse = nullptr;
 
+    // The base class dtor can't call our override of this function.
+    if ( HasPendingFrameCallbacks() )
+        DoCancelFrameRequest();
+
     if (m_wxwindow)
     {
         GTKDisconnect(m_wxwindow);
@@ -3177,11 +3185,24 @@ void wxWindowGTK::PostCreation()
     if (!WX_IS_PIZZA(gtk_widget_get_parent(m_widget)) && !GTK_IS_WINDOW(m_widget))
         gtk_widget_set_size_request(m_widget, m_width, m_height);
 
-    // apply any font or color changes made before creation
-    GTKApplyWidgetStyle();
+    // Apply any font or color changes made before creation together with
+    // those inherited from the parent: as each of SetFont() and SetXXXColour()
+    // called by InheritAttributes() would regenerate and reload the widget
+    // style, defer doing it until we know the final attributes, to do it at
+    // most once per window.
+    m_styleUpdateDeferred = true;
+    m_styleUpdatePending = true;
 
     InheritAttributes();
 
+    m_styleUpdateDeferred = false;
+    if ( m_styleUpdatePending )
+    {
+        m_styleUpdatePending = false;
+        GTKApplyWidgetStyle(m_styleUpdateForced);
+        m_styleUpdateForced = false;
+    }
+
     // if the window had been disabled before being created, it should be
     // created in the initially disabled state
     if ( !m_isEnabled )
@@ -5847,6 +5868,14 @@ GtkRcStyle* wxWindowGTK::GTKCreateWidgetStyle()
 
 void wxWindowGTK::GTKApplyWidgetStyle(bool forceStyle)
 {
+    if ( m_styleUpdateDeferred )
+    {
+        m_styleUpdatePending = true;
+        if ( forceStyle )
+            m_styleUpdateForced = true;
+        return;
+    }
+
     const wxColour& fg = m_foregroundColour;
     const wxColour& bg = m_backgroundColour;
     const bool isFg = fg.IsOk();
@@ -6795,3 +6824,61 @@ void wxWindowGTK::DoThaw()
     if (m_wxwindow && m_wxwindow != m_widget)
         GTKThawWidget(m_wxwindow);
 }
+
+#if GTK_CHECK_VERSION(3,8,0)
+extern "C" {
+static gboolean
+wx_frame_tick_callback(GtkWidget*, GdkFrameClock* clock, gpointer data)
+{
+    wxWindowGTK* const win = static_cast<wxWindowGTK*>(data);
+    win->GTKHandleFrameTick(gdk_frame_clock_get_frame_time(clock));
+
+    // Callbacks requesting another frame add a new tick callback.
+    return G_SOURCE_REMOVE;
+}
+}
+
+void wxWindowGTK::GTKHandleFrameTick(gint64 frameTime)
+{
+    m_frameTickId = 0;
+
+    WXProcessFrameCallbacks(frameTime);
+}
+#endif // GTK+ >= 3.8
+
+void wxWindowGTK::DoRequestFrame()
+{
+#if GTK_CHECK_VERSION(3,8,0)
+    // Use the frame clock to call the callbacks during the update phase of the
+    // next frame, just before it is painted, when possible. Note that this
+    // means that they're not called while the window is hidden.
+    if ( m_widget && wx_is_at_least_gtk3(8) )
+    {
+        if ( !m_frameTickId )
+        {
+            m_frameTickId = gtk_widget_add_tick_callback(m_widget,
+                                                         wx_frame_tick_callback,
+                                                         this, nullptr);
+        }
+
+        return;
+    }
+#endif // GTK+ >= 3.8
+
+    wxWindowBase::DoRequestFrame();
+}
+
+void wxWindowGTK::DoCancelFrameRequest()
+{
+#if GTK_CHECK_VERSION(3,8,0)
+    if ( m_frameTickId )
+    {
+        if ( m_widget )
+            gtk_widget_remove_tick_callback(m_widget, m_frameTickId);
+        m_frameTickId = 0;
+        return;
+    }
+#endif // GTK+ >= 3.8
+
+    wxWindowBase::DoCancelFrameRequest();
+}
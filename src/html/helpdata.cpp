@@ -269,6 +269,30 @@ wxHtmlHelpData::~wxHtmlHelpData()
 {
 }
 
+bool wxHtmlHelpData::GetPageText(const wxString& fullpath, wxString& text)
+{
+    // Opening and filtering the pages is much slower than searching in their
+    // text, so keep it to make the subsequent searches faster.
+    const auto it = m_pagesText.find(fullpath);
+    if ( it != m_pagesText.end() )
+    {
+        text = it->second;
+        return true;
+    }
+
+    wxFileSystem fsys;
+    wxFSFile* const file = fsys.OpenFile(fullpath);
+    if ( !file )
+        return false;
+
+    text = wxHtmlSearchEngine::GetText(*file);
+    delete file;
+
+    m_pagesText[fullpath] = text;
+
+    return true;
+}
+
 bool wxHtmlHelpData::LoadMSProject(wxHtmlBookRecord *book, wxFileSystem& fsys,
                                    const wxString& indexfile,
                                    const wxString& contentsfile)
@@ -821,7 +845,6 @@ wxHtmlSearchStatus::wxHtmlSearchStatus(wxHtmlHelpData* data, const wxString& key
 
 bool wxHtmlSearchStatus::Search()
 {
-    wxFSFile *file;
     int i = m_CurIndex;  // shortcut
     bool found = false;
     wxString thepage;
@@ -852,17 +875,15 @@ bool wxHtmlSearchStatus::Search()
     }
     else m_LastPage = thepage;
 
-    wxFileSystem fsys;
-    file = fsys.OpenFile(m_Data->m_contents[i].book->GetFullPath(thepage));
-    if (file)
+    wxString text;
+    if (m_Data->GetPageText(m_Data->m_contents[i].book->GetFullPath(thepage), text))
     {
-        if (m_Engine.Scan(*file))
+        if (m_Engine.ScanText(text))
         {
             m_Name = m_Data->m_contents[i].name;
             m_CurItem = &m_Data->m_contents[i];
             found = true;
         }
-        delete file;
     }
     return found;
 }
@@ -925,14 +946,15 @@ static inline wxString CompressSpaces(const wxString & str)
 
 bool wxHtmlSearchEngine::Scan(const wxFSFile& file)
 {
-    wxASSERT_MSG(!m_Keyword.empty(), wxT("wxHtmlSearchEngine::LookFor must be called before scanning!"));
+    return ScanText(GetText(file));
+}
 
+/* static */
+wxString wxHtmlSearchEngine::GetText(const wxFSFile& file)
+{
     wxHtmlFilterHTML filter;
     wxString bufStr = filter.ReadFile(file);
 
-    if (!m_CaseSensitive)
-        bufStr.MakeLower();
-
     {   // remove html tags
         wxString bufStrCopy;
         bufStrCopy.reserve( bufStr.size() );
@@ -965,20 +987,34 @@ bool wxHtmlSearchEngine::Scan(const wxFSFile& file)
         bufStr.swap( bufStrCopy );
     }
 
+    // remove continuous spaces
+    return CompressSpaces( bufStr );
+}
+
+bool wxHtmlSearchEngine::ScanText(const wxString& text) const
+{
+    wxASSERT_MSG(!m_Keyword.empty(), wxT("wxHtmlSearchEngine::LookFor must be called before scanning!"));
+
     wxString keyword = m_Keyword;
+    wxString bufStr = text;
+
+    if (!m_CaseSensitive)
+        bufStr.MakeLower();
 
     if (m_WholeWords)
     {
-        // insert ' ' at the beginning and at the end
+        // insert ' ' at the beginning and at the end, the text is already
+        // compressed, so only do it if it doesn't have spaces there yet
         keyword.insert( 0, wxT(" ") );
         keyword.append( wxT(" ") );
-        bufStr.insert( 0, wxT(" ") );
-        bufStr.append( wxT(" ") );
+        if ( !bufStr.StartsWith(wxT(" ")) )
+            bufStr.insert( 0, wxT(" ") );
+        if ( !bufStr.EndsWith(wxT(" ")) )
+            bufStr.append( wxT(" ") );
     }
 
     // remove continuous spaces
     keyword = CompressSpaces( keyword );
-    bufStr = CompressSpaces( bufStr );
 
     // finally do the search
     return bufStr.find( keyword ) != wxString::npos;
@@ -26,6 +26,10 @@
 
 #include <stdlib.h>
 
+#include <algorithm>
+#include <limits.h>
+#include <vector>
+
 //-----------------------------------------------------------------------------
 // Helper classes
 //-----------------------------------------------------------------------------
@@ -187,6 +191,9 @@ void wxHtmlCell::SetLink(const wxHtmlLinkInfo& link)
 void wxHtmlCell::Layout(int WXUNUSED(w))
 {
     SetPos(0, 0);
+
+    if ( m_Parent )
+        m_Parent->InvalidateDrawIndex();
 }
 
 
@@ -326,6 +333,18 @@ wxHtmlWordCell::wxHtmlWordCell(const wxString& word, const wxDC& dc) : wxHtmlCel
     m_allowLinebreak = true;
 }
 
+wxHtmlWordCell::wxHtmlWordCell(const wxString& word,
+                               wxCoord width, wxCoord height, wxCoord descent)
+    : wxHtmlCell()
+    , m_Word(word)
+{
+    m_Width = width;
+    m_Height = height;
+    m_Descent = descent;
+    SetCanLiveOnPagebreak(false);
+    m_allowLinebreak = true;
+}
+
 void wxHtmlWordCell::SetPreviousWord(wxHtmlWordCell *cell)
 {
     if ( cell && m_Parent == cell->m_Parent &&
@@ -660,6 +679,266 @@ wxString wxHtmlWordCell::GetDescription() const
 }
 
 
+//-----------------------------------------------------------------------------
+// wxHtmlContainerDrawIndex
+//-----------------------------------------------------------------------------
+
+namespace
+{
+
+// Flags describing the effects of calling DrawInvisible() for a cell.
+enum
+{
+    DrawEffect_Font     = 1,
+    DrawEffect_FgColour = 2,
+    DrawEffect_BgColour = 4,
+    DrawEffect_BgBrush  = 8,
+
+    // Not a rendering state change, but the cell must still be processed.
+    DrawEffect_Widget   = 16
+};
+
+// Effects of calling DrawInvisible() for a sequence of cells, represented by
+// the (at most one per effect) cells which need to be processed to get the
+// same rendering state.
+class wxHtmlDrawEffects
+{
+public:
+    wxHtmlDrawEffects() : m_count(0), m_flags(0) { }
+
+    // Add the effects of a cell following all the already added ones.
+    void Add(wxHtmlCell* cell, int flags)
+    {
+        m_flags |= flags;
+
+        flags &= ~DrawEffect_Widget;
+        if ( !flags )
+            return;
+
+        // Forget the cells whose all effects are overridden by this one.
+        int count = 0;
+        for ( int n = 0; n < m_count; n++ )
+        {
+            m_cellFlags[n] &= ~flags;
+            if ( m_cellFlags[n] )
+            {
+                m_cells[count] = m_cells[n];
+                m_cellFlags[count] = m_cellFlags[n];
+                count++;
+            }
+        }
+
+        m_cells[count] = cell;
+        m_cellFlags[count] = flags;
+        m_count = count + 1;
+    }
+
+    // Add the effects of the cells following all the already added ones.
+    void Add(const wxHtmlDrawEffects& other)
+    {
+        for ( int n = 0; n < other.m_count; n++ )
+            Add(other.m_cells[n], other.m_cellFlags[n]);
+
+        m_flags |= other.m_flags;
+    }
+
+    // The widgets must be repositioned even when they're invisible, so the
+    // cells containing them can't be skipped.
+    bool HasWidgets() const { return (m_flags & DrawEffect_Widget) != 0; }
+
+    void Apply(wxDC& dc, wxHtmlRenderingInfo& info) const
+    {
+        for ( int n = 0; n < m_count; n++ )
+            m_cells[n]->DrawInvisible(dc, 0, 0, info);
+    }
+
+private:
+    // There can be at most one cell per effect, i.e. 4 of them.
+    wxHtmlCell* m_cells[4];
+    int m_cellFlags[4];
+    int m_count;
+
+    int m_flags;
+};
+
+} // anonymous namespace
+
+// Index of the children of a container allowing to find the ones visible in
+// the given vertical range without iterating over all the preceding ones.
+//
+// It stores checkpoints every CHECKPOINT_STEP children with the effects of
+// all the cells before and after it, which allows to skip these cells while
+// still leaving the DC in the same state as if they had been processed.
+class wxHtmlContainerDrawIndex
+{
+public:
+    struct Checkpoint
+    {
+        // The first cell after the checkpoint, null for the last one.
+        wxHtmlCell* cell;
+
+        // The effects of all the cells before and after the checkpoint.
+        wxHtmlDrawEffects before,
+                          after;
+
+        // The bottom-most coordinate of all the cells before and the top-most
+        // coordinate of the cells after the checkpoint.
+        int bottomBefore,
+            topAfter;
+    };
+
+    explicit wxHtmlContainerDrawIndex(wxHtmlCell* firstChild);
+
+    // Returns the effects of all the cells in this container.
+    const wxHtmlDrawEffects& GetAllEffects() const
+    {
+        return m_checkpoints.front().after;
+    }
+
+    // Returns the last checkpoint before which all the cells are above the
+    // given coordinate and can be skipped.
+    const Checkpoint& GetFirstVisible(int y) const
+    {
+        const auto it = std::partition_point
+                        (
+                            m_checkpoints.begin(),
+                            m_checkpoints.end(),
+                            [y](const Checkpoint& cp)
+                            {
+                                return cp.bottomBefore <= y &&
+                                            !cp.before.HasWidgets();
+                            }
+                        );
+
+        // The first checkpoint always satisfies the condition.
+        return *(it - 1);
+    }
+
+    // Returns the first checkpoint, not before the given one, after which all
+    // the cells are below the given coordinate and can be skipped.
+    const Checkpoint& GetLastVisible(const Checkpoint& first, int y) const
+    {
+        const auto it = std::partition_point
+                        (
+                            m_checkpoints.begin() + (&first - &m_checkpoints[0]),
+                            m_checkpoints.end() - 1,
+                            [y](const Checkpoint& cp)
+                            {
+                                return cp.topAfter <= y ||
+                                            cp.after.HasWidgets();
+                            }
+                        );
+
+        return *it;
+    }
+
+private:
+    static int GetEffects(wxHtmlCell* cell);
+
+    // Number of cells between the checkpoints.
+    static const int CHECKPOINT_STEP = 32;
+
+    std::vector<Checkpoint> m_checkpoints;
+
+    wxDECLARE_NO_COPY_CLASS(wxHtmlContainerDrawIndex);
+};
+
+/* static */
+int wxHtmlContainerDrawIndex::GetEffects(wxHtmlCell* cell)
+{
+    // Test for the most common case first.
+    if ( cell->IsTerminalCell() )
+    {
+        if ( wxDynamicCast(cell, wxHtmlWordCell) )
+            return 0;
+
+        if ( wxDynamicCast(cell, wxHtmlFontCell) )
+            return DrawEffect_Font;
+
+        if ( wxHtmlColourCell* const
+                clrCell = wxDynamicCast(cell, wxHtmlColourCell) )
+        {
+            const unsigned flags = clrCell->GetFlags();
+
+            int effects = 0;
+            if ( flags & wxHTML_CLR_FOREGROUND )
+                effects |= DrawEffect_FgColour;
+            if ( flags & wxHTML_CLR_BACKGROUND )
+                effects |= DrawEffect_BgColour | DrawEffect_BgBrush;
+            if ( flags & wxHTML_CLR_TRANSPARENT_BACKGROUND )
+                effects |= DrawEffect_BgColour;
+
+            return effects;
+        }
+
+        if ( wxDynamicCast(cell, wxHtmlWidgetCell) )
+            return DrawEffect_Widget;
+    }
+
+    return 0;
+}
+
+wxHtmlContainerDrawIndex::wxHtmlContainerDrawIndex(wxHtmlCell* firstChild)
+{
+    // Compute the effects and the extent of the cells before each checkpoint
+    // and, temporarily, of the cells between it and the next one.
+    wxHtmlDrawEffects effects;
+    int bottom = INT_MIN;
+
+    int n = 0;
+    for ( wxHtmlCell* cell = firstChild; cell; cell = cell->GetNext(), n++ )
+    {
+        if ( n % CHECKPOINT_STEP == 0 )
+        {
+            Checkpoint cp;
+            cp.cell = cell;
+            cp.before = effects;
+            cp.bottomBefore = bottom;
+            cp.topAfter = INT_MAX;
+            m_checkpoints.push_back(cp);
+        }
+
+        Checkpoint& cp = m_checkpoints.back();
+
+        wxHtmlContainerCell* const
+            cont = cell->IsTerminalCell()
+                    ? nullptr
+                    : static_cast<wxHtmlContainerCell*>(cell);
+        if ( cont )
+        {
+            const wxHtmlDrawEffects& contEffects = cont->GetDrawIndex().GetAllEffects();
+            effects.Add(contEffects);
+            cp.after.Add(contEffects);
+        }
+        else
+        {
+            const int cellEffects = GetEffects(cell);
+            effects.Add(cell, cellEffects);
+            cp.after.Add(cell, cellEffects);
+        }
+
+        bottom = wxMax(bottom, cell->GetPosY() + cell->GetHeight());
+        cp.topAfter = wxMin(cp.topAfter, cell->GetPosY());
+    }
+
+    Checkpoint last;
+    last.cell = nullptr;
+    last.before = effects;
+    last.bottomBefore = bottom;
+    last.topAfter = INT_MAX;
+    m_checkpoints.push_back(last);
+
+    // Now accumulate the effects and extent of all the following cells.
+    for ( size_t k = m_checkpoints.size() - 1; k > 0; k-- )
+    {
+        const Checkpoint& next = m_checkpoints[k];
+        Checkpoint& cp = m_checkpoints[k - 1];
+
+        cp.after.Add(next.after);
+        cp.topAfter = wxMin(cp.topAfter, next.topAfter);
+    }
+}
+
 //-----------------------------------------------------------------------------
 // wxHtmlContainerCell
 //-----------------------------------------------------------------------------
@@ -680,10 +959,13 @@ wxHtmlContainerCell::wxHtmlContainerCell(wxHtmlContainerCell *parent) : wxHtmlCe
     m_MinHeight = 0;
     m_MinHeightAlign = wxHTML_ALIGN_TOP;
     m_LastLayout = -1;
+    m_drawIndex = nullptr;
 }
 
 wxHtmlContainerCell::~wxHtmlContainerCell()
 {
+    delete m_drawIndex;
+
     wxHtmlCell *cell = m_Cells;
     while ( cell )
     {
@@ -755,10 +1037,6 @@ void wxHtmlContainerCell::Layout(int w)
 {
     wxHtmlCell::Layout(w);
 
-    if (m_LastLayout == w)
-        return;
-    m_LastLayout = w;
-
     // VS: Any attempt to layout with negative or zero width leads to hell,
     // but we can't ignore such attempts completely, since it sometimes
     // happen (e.g. when trying how small a table can be), so use at least one
@@ -766,33 +1044,43 @@ void wxHtmlContainerCell::Layout(int w)
     if (w < 1)
         w = 1;
 
-    wxHtmlCell *nextCell;
-    long xpos = 0, ypos = m_IndentTop;
-    int xdelta = 0, ybasicpos = 0;
-    int s_width, s_indent;
-    int ysizeup = 0, ysizedown = 0;
-    int MaxLineWidth = 0;
-    int curLineWidth = 0;
-    m_MaxTotalWidth = 0;
-
-
     /*
 
     WIDTH ADJUSTING :
 
     */
 
+    int width;
     if (m_WidthFloatUnits == wxHTML_UNITS_PERCENT)
     {
-        if (m_WidthFloat < 0) m_Width = (100 + m_WidthFloat) * w / 100;
-        else m_Width = m_WidthFloat * w / 100;
+        if (m_WidthFloat < 0) width = (100 + m_WidthFloat) * w / 100;
+        else width = m_WidthFloat * w / 100;
     }
     else
     {
-        if (m_WidthFloat < 0) m_Width = w + m_WidthFloat;
-        else m_Width = m_WidthFloat;
+        if (m_WidthFloat < 0) width = w + m_WidthFloat;
+        else width = m_WidthFloat;
     }
 
+    // The layout depends only on our own width, so there is nothing to do if
+    // it didn't change, even if the width available to us did, as happens
+    // for fixed width containers inside a window being resized.
+    if (m_LastLayout == width)
+        return;
+    m_LastLayout = width;
+    m_Width = width;
+
+    InvalidateDrawIndex();
+
+    wxHtmlCell *nextCell;
+    long xpos = 0, ypos = m_IndentTop;
+    int xdelta = 0, ybasicpos = 0;
+    int s_width, s_indent;
+    int ysizeup = 0, ysizedown = 0;
+    int MaxLineWidth = 0;
+    int curLineWidth = 0;
+    m_MaxTotalWidth = 0;
+
     if (m_Cells)
     {
         int l = (m_IndentLeft < 0) ? (-m_IndentLeft * m_Width / 100) : m_IndentLeft;
@@ -1033,6 +1321,27 @@ void wxHtmlContainerCell::UpdateRenderingStatePost(wxHtmlRenderingInfo& info,
         info.GetState().SetSelectionState(wxHTML_SEL_IN);
 }
 
+const wxHtmlContainerDrawIndex& wxHtmlContainerCell::GetDrawIndex()
+{
+    if ( !m_drawIndex )
+        m_drawIndex = new wxHtmlContainerDrawIndex(m_Cells);
+
+    return *m_drawIndex;
+}
+
+void wxHtmlContainerCell::InvalidateDrawIndex()
+{
+    // If the index of this container doesn't exist, the indices of its parents
+    // don't exist neither, as they can only be created after the one of this
+    // container, so there is no need to continue.
+    for ( wxHtmlContainerCell* cont = this;
+          cont && cont->m_drawIndex;
+          cont = cont->GetParent() )
+    {
+        wxDELETE(cont->m_drawIndex);
+    }
+}
+
 #define mMin(a, b) (((a) < (b)) ? (a) : (b))
 #define mMax(a, b) (((a) < (b)) ? (b) : (a))
 
@@ -1124,8 +1433,27 @@ void wxHtmlContainerCell::Draw(wxDC& dc, int x, int y, int view_y1, int view_y2,
     }
     if (m_Cells)
     {
+        wxHtmlCell *cell = m_Cells,
+                   *end = nullptr;
+
+        // Unless there is a selection, which also affects the rendering state,
+        // skip directly to the first visible cell and stop after the last one.
+        const wxHtmlContainerDrawIndex::Checkpoint* last = nullptr;
+        if ( !info.GetSelection() )
+        {
+            const wxHtmlContainerDrawIndex& index = GetDrawIndex();
+
+            const wxHtmlContainerDrawIndex::Checkpoint&
+                first = index.GetFirstVisible(view_y1 - ylocal);
+            last = &index.GetLastVisible(first, view_y2 - ylocal);
+
+            first.before.Apply(dc, info);
+            cell = first.cell;
+            end = last->cell;
+        }
+
         // draw container's contents:
-        for (wxHtmlCell *cell = m_Cells; cell; cell = cell->GetNext())
+        for (; cell != end; cell = cell->GetNext())
         {
 
             // optimize drawing: don't render off-screen content:
@@ -1146,6 +1474,9 @@ void wxHtmlContainerCell::Draw(wxDC& dc, int x, int y, int view_y1, int view_y2,
                 cell->DrawInvisible(dc, xlocal, ylocal, info);
             }
         }
+
+        if ( last )
+            last->after.Apply(dc, info);
     }
 }
 
@@ -1156,6 +1487,16 @@ void wxHtmlContainerCell::DrawInvisible(wxDC& dc, int x, int y,
 {
     if (m_Cells)
     {
+        if ( !info.GetSelection() )
+        {
+            const wxHtmlDrawEffects& effects = GetDrawIndex().GetAllEffects();
+            if ( !effects.HasWidgets() )
+            {
+                effects.Apply(dc, info);
+                return;
+            }
+        }
+
         for (wxHtmlCell *cell = m_Cells; cell; cell = cell->GetNext())
         {
             UpdateRenderingStatePre(info, cell);
@@ -1196,6 +1537,7 @@ void wxHtmlContainerCell::InsertCell(wxHtmlCell *f)
     }
     f->SetParent(this);
     m_LastLayout = -1;
+    InvalidateDrawIndex();
 }
 
 
@@ -1233,6 +1575,8 @@ void wxHtmlContainerCell::Detach(wxHtmlCell *cell)
 
     cell->SetParent(nullptr);
     cell->SetNext(nullptr);
+
+    InvalidateDrawIndex();
 }
 
 
@@ -415,7 +415,7 @@ void wxHtmlWindow::SetFonts(const wxString& normal_face, const wxString& fixed_f
     m_Parser->SetFonts(normal_face, fixed_face, sizes);
 
     // re-layout the page after changing fonts:
-    DoSetPage(*(m_Parser->GetSource()));
+    DoSetPage(GetPageSource());
 }
 
 void wxHtmlWindow::SetStandardFonts(int size,
@@ -425,7 +425,7 @@ void wxHtmlWindow::SetStandardFonts(int size,
     m_Parser->SetStandardFonts(size, normal_face, fixed_face);
 
     // re-layout the page after changing fonts:
-    DoSetPage(*(m_Parser->GetSource()));
+    DoSetPage(GetPageSource());
 }
 
 bool wxHtmlWindow::SetPage(const wxString& source)
@@ -436,15 +436,10 @@ bool wxHtmlWindow::SetPage(const wxString& source)
     return DoSetPage(source);
 }
 
-bool wxHtmlWindow::DoSetPage(const wxString& source)
+wxString wxHtmlWindow::ProcessSource(const wxString& source) const
 {
     wxString newsrc(source);
 
-    wxDELETE(m_selection);
-
-    // we will soon delete all the cells, so clear pointers to them:
-    m_tmpSelFromCell = nullptr;
-
     // pass HTML through registered processors:
     if (m_Processors || m_GlobalProcessors)
     {
@@ -490,6 +485,21 @@ bool wxHtmlWindow::DoSetPage(const wxString& source)
         }
     }
 
+    return newsrc;
+}
+
+bool wxHtmlWindow::DoSetPage(const wxString& source)
+{
+    const wxString newsrc = ProcessSource(source);
+
+    wxDELETE(m_selection);
+
+    // we will soon delete all the cells, so clear pointers to them:
+    m_tmpSelFromCell = nullptr;
+
+    // the new page replaces all the fragments appended to the old one
+    m_appendedSource.clear();
+
     // ...and run the parser on it:
     wxClientDC dc(this);
     dc.SetMapMode(wxMM_TEXT);
@@ -525,7 +535,57 @@ bool wxHtmlWindow::DoSetPage(const wxString& source)
 
 bool wxHtmlWindow::AppendToPage(const wxString& source)
 {
-    return DoSetPage(*(GetParser()->GetSource()) + source);
+    return DoSetPage(GetPageSource() + source);
+}
+
+bool wxHtmlWindow::AppendFragmentToPage(const wxString& fragment)
+{
+    if ( !m_Cell )
+        return DoSetPage(fragment);
+
+    wxClientDC dc(this);
+    dc.SetMapMode(wxMM_TEXT);
+
+    double pixelScale = 1.0;
+#ifndef wxHAS_DPI_INDEPENDENT_PIXELS
+    pixelScale = GetDPIScaleFactor();
+#endif
+
+    m_Parser->SetDC(&dc, pixelScale, 1.0);
+
+    // Parse the fragment on its own, without parsing the existing page again,
+    // but preserve the page source in the parser, as it's still used for the
+    // existing cells.
+    m_Parser->SetSourceAndSaveState(wxString());
+    wxHtmlContainerCell* const
+        cell = static_cast<wxHtmlContainerCell*>(m_Parser->Parse(ProcessSource(fragment)));
+    m_Parser->RestoreState();
+
+    m_Parser->SetDC(nullptr);
+
+    wxCHECK_MSG( cell, false, wxS("wxHtmlParser::Parse() returned nullptr?") );
+
+    m_appendedSource += fragment;
+
+    // Only the new cell needs to be laid out, all the existing ones already
+    // are laid out for the current width and won't be laid out again, so this
+    // is fast even if the page is already big.
+    m_Cell->InsertCell(cell);
+    CreateLayout();
+
+    // And also only the new cell needs to be redrawn, if it's visible.
+    if ( m_tmpCanDrawLocks == 0 )
+    {
+        const wxPoint pos = CalcScrolledPosition(cell->GetAbsPos());
+        RefreshRect(wxRect(pos, wxSize(GetClientSize().x, cell->GetHeight())));
+    }
+
+    return true;
+}
+
+wxString wxHtmlWindow::GetPageSource() const
+{
+    return *m_Parser->GetSource() + m_appendedSource;
 }
 
 bool wxHtmlWindow::LoadPage(const wxString& location)
@@ -1340,7 +1400,7 @@ void wxHtmlWindow::OnSize(wxSizeEvent& event)
 void wxHtmlWindow::OnDPIChanged(wxDPIChangedEvent& WXUNUSED(event))
 {
     wxBitmapBundle bmpBg = m_bmpBg;
-    DoSetPage(*(m_Parser->GetSource()));
+    DoSetPage(GetPageSource());
     SetBackgroundImage(bmpBg);
 }
 
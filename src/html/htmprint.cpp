@@ -215,6 +215,8 @@ wxHtmlPrintout::wxHtmlPrintout(const wxString& title) : wxPrintout(title)
 {
     m_BasePathIsDir = true;
     m_HeaderHeight = m_FooterHeight = 0;
+    m_PageBreaksPixelScale = m_PageBreaksFontScale = 0;
+    InvalidatePageBreaks();
     SetMargins(); // to default values
     SetStandardFonts(DEFAULT_PRINT_FONT_SIZE);
 }
@@ -354,9 +356,9 @@ void wxHtmlPrintout::OnPreparePrinting()
     }
 
     /* prepare main renderer: */
-    m_Renderer.SetDC(GetDC(),
-                      (double)ppiPrinterY / TYPICAL_SCREEN_DPI,
-                      (double)ppiPrinterY / (double)ppiScreenY);
+    const double pixelScale = (double)ppiPrinterY / TYPICAL_SCREEN_DPI,
+                 fontScale = (double)ppiPrinterY / (double)ppiScreenY;
+    m_Renderer.SetDC(GetDC(), pixelScale, fontScale);
 
     const int printAreaW = int(ppmm_h * (mm_w - m_MarginLeft - m_MarginRight));
     int printAreaH = int(ppmm_v * (mm_h - m_MarginTop - m_MarginBottom));
@@ -365,19 +367,41 @@ void wxHtmlPrintout::OnPreparePrinting()
     if ( m_FooterHeight )
         printAreaH -= int(m_FooterHeight + m_MarginSpace * ppmm_v);
 
-    m_Renderer.SetSize(printAreaW, printAreaH);
-    m_Renderer.SetHtmlText(m_Document, m_BasePath, m_BasePathIsDir);
+    // The document layout only depends on the size of the printable area and
+    // the scale factors, so if we had already paginated it using the same
+    // values, e.g. because the same printout is printed after previewing it
+    // or printed several times, the existing page breaks can be reused.
+    const wxSize printArea(printAreaW, printAreaH);
+    const bool reuseLayout = printArea == m_PageBreaksSize &&
+                                pixelScale == m_PageBreaksPixelScale &&
+                                    fontScale == m_PageBreaksFontScale;
+    if ( !reuseLayout )
+    {
+        m_Renderer.SetSize(printAreaW, printAreaH);
+        m_Renderer.SetHtmlText(m_Document, m_BasePath, m_BasePathIsDir);
+    }
 
-    if ( CheckFit(wxSize(printAreaW, printAreaH),
+    if ( CheckFit(printArea,
                   wxSize(m_Renderer.GetTotalWidth(),
                          m_Renderer.GetTotalHeight())) || IsPreview() )
     {
         // do paginate the document
-        CountPages();
+        if ( !reuseLayout )
+        {
+            CountPages();
+
+            m_PageBreaksSize = printArea;
+            m_PageBreaksPixelScale = pixelScale;
+            m_PageBreaksFontScale = fontScale;
+        }
+    }
+    else
+    {
+        // if we don't have any page breaks, our GetPageInfo() will return 0
+        // as max page and so nothing will be printed
+        m_PageBreaks.clear();
+        InvalidatePageBreaks();
     }
-    //else: if we don't call CountPages() m_PageBreaks remains empty and our
-    //      GetPageInfo() will return 0 as max page and so nothing will be
-    //      printed
 }
 
 bool wxHtmlPrintout::OnBeginDocument(int startPage, int endPage)
@@ -426,6 +450,8 @@ void wxHtmlPrintout::SetHtmlText(const wxString& html, const wxString &basepath,
     m_Document = html;
     m_BasePath = basepath;
     m_BasePathIsDir = isdir;
+
+    InvalidatePageBreaks();
 }
 
 void wxHtmlPrintout::SetHtmlFile(const wxString& htmlfile)
@@ -603,6 +629,8 @@ void wxHtmlPrintout::SetFonts(const wxString& normal_face, const wxString& fixed
 {
     m_Renderer.SetFonts(normal_face, fixed_face, sizes);
     m_RendererHdr.SetFonts(normal_face, fixed_face, sizes);
+
+    InvalidatePageBreaks();
 }
 
 void wxHtmlPrintout::SetStandardFonts(int size,
@@ -611,6 +639,8 @@ void wxHtmlPrintout::SetStandardFonts(int size,
 {
     m_Renderer.SetStandardFonts(size, normal_face, fixed_face);
     m_RendererHdr.SetStandardFonts(size, normal_face, fixed_face);
+
+    InvalidatePageBreaks();
 }
 
 
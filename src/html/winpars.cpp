@@ -47,6 +47,7 @@ wxHtmlWinParser::wxHtmlWinParser(wxHtmlWindowInterface *wndIface)
     m_whitespaceMode = Whitespace_Normal;
     m_lastWordCell = nullptr;
     m_posColumn = 0;
+    m_currentFont = nullptr;
 
     {
         int i, j, k, l, m;
@@ -62,6 +63,10 @@ wxHtmlWinParser::wxHtmlWinParser(wxHtmlWindowInterface *wndIface)
         SetFonts(wxEmptyString, wxEmptyString, nullptr);
     }
 
+    // tag handler modules are only initialized when they're needed for the
+    // first time, which is now
+    wxModule::InitializeLazyModules(wxCLASSINFO(wxHtmlTagsModule));
+
     // fill in wxHtmlParser's tables:
     wxList::compatibility_iterator node = m_Modules.GetFirst();
     while (node)
@@ -145,6 +150,9 @@ void wxHtmlWinParser::SetFonts(const wxString& normal_face,
     m_FontFaceFixed = fixed_face;
     m_FontFaceNormal = normal_face;
 
+    m_currentFont = nullptr;
+    ClearWordExtents();
+
     for (i = 0; i < 2; i++)
         for (j = 0; j < 2; j++)
             for (k = 0; k < 2; k++)
@@ -406,6 +414,29 @@ void wxHtmlWinParser::FlushWordBuf(wxChar *buf, int& len)
     len = 0;
 }
 
+void wxHtmlWinParser::AddWord(const wxString& word)
+{
+    // Don't use the cached extents if the font was changed without using
+    // CreateCurrentFont(), e.g. by a custom tag handler.
+    if ( !m_currentFont || !m_DC->GetFont().IsSameAs(*m_currentFont) )
+    {
+        AddWord(new wxHtmlWordCell(word, *m_DC));
+        return;
+    }
+
+    WordExtentsMap& extents = m_wordExtents[m_currentFont];
+    WordExtentsMap::const_iterator it = extents.find(word);
+    if ( it == extents.end() )
+    {
+        WordExtent ext;
+        m_DC->GetTextExtent(word, &ext.width, &ext.height, &ext.descent);
+        it = extents.emplace(word, ext).first;
+    }
+
+    const WordExtent& ext = it->second;
+    AddWord(new wxHtmlWordCell(word, ext.width, ext.height, ext.descent));
+}
+
 void wxHtmlWinParser::AddWord(wxHtmlWordCell *word)
 {
     ApplyStateToCell(word);
@@ -504,6 +535,10 @@ void wxHtmlWinParser::SetDC(wxDC *dc, double pixel_scale, double font_scale)
     m_DC = dc;
     m_PixelScale = pixel_scale;
     m_FontScale = font_scale;
+
+    // The extents measured using the previous DC may be different.
+    m_currentFont = nullptr;
+    ClearWordExtents();
 }
 
 void wxHtmlWinParser::SetFontPointSize(int pt)
@@ -550,6 +585,7 @@ wxFont* wxHtmlWinParser::CreateCurrentFont()
 
     if (*fontptr != nullptr && (*faceptr != face))
     {
+        m_wordExtents.erase(*fontptr);
         wxDELETE(*fontptr);
     }
 
@@ -565,6 +601,7 @@ wxFont* wxHtmlWinParser::CreateCurrentFont()
                        );
     }
     m_DC->SetFont(**fontptr);
+    m_currentFont = *fontptr;
     return (*fontptr);
 }
 
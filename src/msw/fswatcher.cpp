@@ -126,8 +126,13 @@ bool wxFSWatcherImplMSW::SetUpWatch(wxFSWatchEntryMSW& watch)
 
 void wxFSWatcherImplMSW::SendEvent(wxFileSystemWatcherEvent& evt)
 {
-    // called from worker thread, so posting event in thread-safe way
-    wxQueueEvent(m_watcher->GetOwner(), evt.Clone());
+    // called from worker thread, so deliver the event from the main thread,
+    // using a deep copy of it to avoid sharing any data between threads
+    std::shared_ptr<wxFileSystemWatcherEvent>
+        clone(static_cast<wxFileSystemWatcherEvent*>(evt.Clone()));
+
+    wxFileSystemWatcherBase* const watcher = m_watcher;
+    watcher->CallAfter([watcher, clone]() { watcher->DeliverEvent(*clone); });
 }
 
 bool wxFSWatcherImplMSW::DoSetUpWatch(wxFSWatchEntryMSW& watch)
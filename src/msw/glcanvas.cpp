@@ -817,6 +817,28 @@ bool wxGLCanvasBase::IsExtensionSupported(const char *extension)
     return s_extensionsList && IsExtensionInList(s_extensionsList, extension);
 }
 
+/* static */
+void* wxGLCanvasBase::GetGLProcAddress(const char *name)
+{
+    const PROC proc = wglGetProcAddress(name);
+
+    // Some drivers return small integer values instead of null on failure.
+    switch ( reinterpret_cast<wxUIntPtr>(proc) )
+    {
+        case 0:
+        case 1:
+        case 2:
+        case 3:
+        case static_cast<wxUIntPtr>(-1):
+            // Core OpenGL 1.1 functions are only exported from opengl32.dll.
+            return reinterpret_cast<void*>(
+                        ::GetProcAddress(::GetModuleHandle(wxT("opengl32.dll")),
+                                         name));
+    }
+
+    return reinterpret_cast<void*>(proc);
+}
+
 // ----------------------------------------------------------------------------
 // pixel format stuff
 // ----------------------------------------------------------------------------
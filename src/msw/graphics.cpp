@@ -435,6 +435,14 @@ public:
 
     virtual void DrawRectangle( wxDouble x, wxDouble y, wxDouble w, wxDouble h ) override;
 
+    virtual void DrawRectangles( size_t n, const wxRect2DDouble *rects) override;
+    virtual void DrawEllipses( size_t n, const wxRect2DDouble *rects) override;
+    virtual void DrawMarkers( size_t n, const wxPoint2DDouble *centres,
+                              wxDouble size,
+                              wxMarkerShape shape = wxMARKER_SQUARE,
+                              const wxColour *colours = nullptr) override;
+    virtual void StrokeLineSegments( size_t n, const wxPoint2DDouble *points) override;
+
     // stroke lines connecting each of the points
     virtual void StrokeLines( size_t n, const wxPoint2DDouble *points) override;
 
@@ -2039,6 +2047,164 @@ void wxGDIPlusContext::DrawRectangle( wxDouble x, wxDouble y, wxDouble w, wxDoub
     }
 }
 
+void wxGDIPlusContext::DrawRectangles( size_t n, const wxRect2DDouble *rects )
+{
+    if (m_composition == wxCOMPOSITION_DEST || !n)
+        return;
+
+    OffsetHelper helper(this, m_context, m_pen);
+    Brush *brush = m_brush.IsNull() ? nullptr : ((wxGDIPlusBrushData*)m_brush.GetRefData())->GetGDIPlusBrush();
+    Pen *pen = m_pen.IsNull() ? nullptr : ((wxGDIPlusPenData*)m_pen.GetGraphicsData())->GetGDIPlusPen();
+
+    wxVector<RectF> crects(n);
+    for ( size_t i = 0; i < n; i++ )
+    {
+        wxRect2DDouble r = rects[i];
+        if ( r.m_width < 0 )
+        {
+            r.m_x += r.m_width;
+            r.m_width = -r.m_width;
+        }
+
+        if ( r.m_height < 0 )
+        {
+            r.m_y += r.m_height;
+            r.m_height = -r.m_height;
+        }
+
+        crects[i] = RectF((REAL)r.m_x, (REAL)r.m_y, (REAL)r.m_width, (REAL)r.m_height);
+    }
+
+    if ( brush )
+    {
+        // As in DrawRectangle(), fill only the inside of the rectangles.
+        if ( pen )
+        {
+            const REAL offset = pen->GetWidth();
+
+            wxVector<RectF> inner(crects);
+            for ( size_t i = 0; i < n; i++ )
+                inner[i].Inflate(-offset/2, -offset/2);
+
+            m_context->FillRectangles(brush, &inner[0], (INT)n);
+        }
+        else
+        {
+            m_context->FillRectangles(brush, &crects[0], (INT)n);
+        }
+    }
+
+    if ( pen )
+    {
+        m_context->DrawRectangles(pen, &crects[0], (INT)n);
+    }
+}
+
+void wxGDIPlusContext::DrawEllipses( size_t n, const wxRect2DDouble *rects )
+{
+    if (m_composition == wxCOMPOSITION_DEST || !n)
+        return;
+
+    OffsetHelper helper(this, m_context, m_pen);
+
+    GraphicsPath path(FillModeWinding);
+    for ( size_t i = 0; i < n; i++ )
+    {
+        path.AddEllipse((REAL)rects[i].m_x, (REAL)rects[i].m_y,
+                        (REAL)rects[i].m_width, (REAL)rects[i].m_height);
+    }
+
+    if ( !m_brush.IsNull() )
+        m_context->FillPath(((wxGDIPlusBrushData*)m_brush.GetRefData())->GetGDIPlusBrush(), &path);
+
+    if ( !m_pen.IsNull() )
+        m_context->DrawPath(((wxGDIPlusPenData*)m_pen.GetGraphicsData())->GetGDIPlusPen(), &path);
+}
+
+// Add the marker to the given path.
+static void wxGDIPlusAddMarker(GraphicsPath& path,
+                               const wxPoint2DDouble& centre,
+                               wxDouble size,
+                               wxMarkerShape shape)
+{
+    const REAL x = (REAL)(centre.m_x - size/2),
+               y = (REAL)(centre.m_y - size/2);
+
+    switch ( shape )
+    {
+        case wxMARKER_SQUARE:
+            path.AddRectangle(RectF(x, y, (REAL)size, (REAL)size));
+            break;
+
+        case wxMARKER_CIRCLE:
+            path.AddEllipse(x, y, (REAL)size, (REAL)size);
+            break;
+    }
+}
+
+void wxGDIPlusContext::DrawMarkers( size_t n, const wxPoint2DDouble *centres,
+                                    wxDouble size,
+                                    wxMarkerShape shape,
+                                    const wxColour *colours )
+{
+    if (m_composition == wxCOMPOSITION_DEST || !n)
+        return;
+
+    OffsetHelper helper(this, m_context, m_pen);
+
+    if ( colours )
+    {
+        // Fill the consecutive markers of the same colour at once, reusing
+        // the same brush for all of them.
+        SolidBrush brush(wxColourToColor(colours[0]));
+        for ( size_t i = 0; i < n; )
+        {
+            const wxColour& col = colours[i];
+            brush.SetColor(wxColourToColor(col));
+
+            GraphicsPath path(FillModeWinding);
+            for ( ; i < n && colours[i] == col; i++ )
+                wxGDIPlusAddMarker(path, centres[i], size, shape);
+
+            m_context->FillPath(&brush, &path);
+        }
+    }
+
+    if ( !colours && m_brush.IsNull() && m_pen.IsNull() )
+        return;
+
+    GraphicsPath path(FillModeWinding);
+    for ( size_t i = 0; i < n; i++ )
+        wxGDIPlusAddMarker(path, centres[i], size, shape);
+
+    if ( !colours && !m_brush.IsNull() )
+        m_context->FillPath(((wxGDIPlusBrushData*)m_brush.GetRefData())->GetGDIPlusBrush(), &path);
+
+    if ( !m_pen.IsNull() )
+        m_context->DrawPath(((wxGDIPlusPenData*)m_pen.GetGraphicsData())->GetGDIPlusPen(), &path);
+}
+
+void wxGDIPlusContext::StrokeLineSegments( size_t n, const wxPoint2DDouble *points )
+{
+    if (m_composition == wxCOMPOSITION_DEST || !n)
+        return;
+
+    if ( !m_pen.IsNull() )
+    {
+        OffsetHelper helper(this, m_context, m_pen);
+
+        GraphicsPath path;
+        for ( size_t i = 0; i < n; i++, points += 2 )
+        {
+            path.StartFigure();
+            path.AddLine((REAL)points[0].m_x, (REAL)points[0].m_y,
+                         (REAL)points[1].m_x, (REAL)points[1].m_y);
+        }
+
+        m_context->DrawPath(((wxGDIPlusPenData*)m_pen.GetGraphicsData())->GetGDIPlusPen(), &path);
+    }
+}
+
 void wxGDIPlusContext::StrokeLines( size_t n, const wxPoint2DDouble *points)
 {
    if (m_composition == wxCOMPOSITION_DEST)
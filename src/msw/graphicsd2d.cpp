@@ -1345,6 +1345,9 @@ public :
     // appends an ellipse
     void AddEllipse(wxDouble x, wxDouble y, wxDouble w, wxDouble h) override;
 
+    // closes the geometry and creates the geometry group used for drawing it
+    void Compile() override;
+
 private:
     void EnsureGeometryOpen();
 
@@ -1378,7 +1381,11 @@ private :
 
     wxCOMPtr<ID2D1Factory> m_direct2dfactory;
 
+    // the geometry group returned by GetFullGeometry() is reused until the
+    // path is modified or a different fill mode is requested
     mutable wxCOMPtr<ID2D1GeometryGroup> m_combinedGeometry;
+    mutable D2D1_FILL_MODE m_combinedFillMode;
+
     wxVector<ID2D1Geometry*> m_pTransformedGeometries;
 
     bool m_currentPointSet;
@@ -1401,6 +1408,7 @@ private :
 wxD2DPathData::wxD2DPathData(wxGraphicsRenderer* renderer, ID2D1Factory* d2dFactory) :
     wxGraphicsPathData(renderer),
     m_direct2dfactory(d2dFactory),
+    m_combinedFillMode(D2D1_FILL_MODE_ALTERNATE),
     m_currentPointSet(false),
     m_currentPoint(D2D1::Point2F(0.0f, 0.0f)),
     m_figureOpened(false),
@@ -1482,6 +1490,8 @@ void wxD2DPathData::Flush()
 
         if( m_geometryWritable )
         {
+            m_combinedGeometry.reset();
+
             HRESULT hr = m_geometrySink->Close();
             wxCHECK_HRESULT_RET(hr);
             m_geometryWritable = false;
@@ -1491,6 +1501,10 @@ void wxD2DPathData::Flush()
 
 void wxD2DPathData::EnsureGeometryOpen()
 {
+    // This is called before any modification of the path, so the geometry
+    // group created for its previous state can't be used any longer.
+    m_combinedGeometry.reset();
+
     if (!m_geometryWritable)
     {
         wxCOMPtr<ID2D1PathGeometry> newPathGeometry;
@@ -1576,6 +1590,9 @@ void wxD2DPathData::EndFigure(D2D1_FIGURE_END figureEnd)
 
 ID2D1Geometry* wxD2DPathData::GetFullGeometry(D2D1_FILL_MODE fillMode) const
 {
+    if ( m_combinedGeometry && m_combinedFillMode == fillMode )
+        return m_combinedGeometry;
+
     // Our final path geometry is represented by geometry group
     // which contains all transformed geometries plus current geometry.
 
@@ -1595,9 +1612,17 @@ ID2D1Geometry* wxD2DPathData::GetFullGeometry(D2D1_FILL_MODE fillMode) const
     wxFAILED_HRESULT_MSG(hr);
     delete []pGeometries;
 
+    m_combinedFillMode = fillMode;
+
     return m_combinedGeometry;
 }
 
+void wxD2DPathData::Compile()
+{
+    Flush();
+    GetFullGeometry(GetFillMode());
+}
+
 bool wxD2DPathData::IsEmpty() const
 {
     return !m_currentPointSet && !m_figureOpened &&
@@ -3939,6 +3964,17 @@ public:
 
     void DrawEllipse(wxDouble x, wxDouble y, wxDouble w, wxDouble h) override;
 
+    void DrawRectangles(size_t n, const wxRect2DDouble* rects) override;
+
+    void DrawEllipses(size_t n, const wxRect2DDouble* rects) override;
+
+    void DrawMarkers(size_t n, const wxPoint2DDouble* centres,
+                     wxDouble size,
+                     wxMarkerShape shape = wxMARKER_SQUARE,
+                     const wxColour* colours = nullptr) override;
+
+    void StrokeLineSegments(size_t n, const wxPoint2DDouble* points) override;
+
     void DrawBitmap(const wxGraphicsBitmap& bmp, wxDouble x, wxDouble y, wxDouble w, wxDouble h) override;
 
     void DrawBitmap(const wxBitmap& bmp, wxDouble x, wxDouble y, wxDouble w, wxDouble h) override;
@@ -4948,6 +4984,189 @@ void wxD2DContext::DrawEllipse(wxDouble x, wxDouble y, wxDouble w, wxDouble h)
     }
 }
 
+// Direct2D doesn't provide any functions for drawing many shapes at once, but
+// the drawing calls are batched by the render target itself, so it's enough
+// to avoid the per-item overhead of binding the brush and pen in these
+// functions.
+
+void wxD2DContext::DrawRectangles(size_t n, const wxRect2DDouble* rects)
+{
+    if (m_composition == wxCOMPOSITION_DEST || !n)
+        return;
+
+    OffsetHelper helper(this, m_pen);
+
+    EnsureInitialized();
+    AdjustRenderTargetSize();
+
+    if (!m_brush.IsNull())
+    {
+        wxD2DBrushData* brushData = wxGetD2DBrushData(m_brush);
+        brushData->Bind(this);
+        for (size_t i = 0; i < n; ++i)
+        {
+            const wxRect2DDouble& r = rects[i];
+            D2D1_RECT_F rect = { (FLOAT)r.m_x, (FLOAT)r.m_y, (FLOAT)(r.m_x + r.m_width), (FLOAT)(r.m_y + r.m_height) };
+            GetRenderTarget()->FillRectangle(rect, brushData->GetBrush());
+        }
+    }
+
+    if (!m_pen.IsNull())
+    {
+        wxD2DPenData* penData = wxGetD2DPenData(m_pen);
+        penData->SetWidth(this);
+        penData->Bind(this);
+        for (size_t i = 0; i < n; ++i)
+        {
+            const wxRect2DDouble& r = rects[i];
+            D2D1_RECT_F rect = { (FLOAT)r.m_x, (FLOAT)r.m_y, (FLOAT)(r.m_x + r.m_width), (FLOAT)(r.m_y + r.m_height) };
+            GetRenderTarget()->DrawRectangle(rect, penData->GetBrush(), penData->GetWidth(), penData->GetStrokeStyle());
+        }
+    }
+}
+
+void wxD2DContext::DrawEllipses(size_t n, const wxRect2DDouble* rects)
+{
+    if (m_composition == wxCOMPOSITION_DEST || !n)
+        return;
+
+    OffsetHelper helper(this, m_pen);
+
+    EnsureInitialized();
+    AdjustRenderTargetSize();
+
+    wxVector<D2D1_ELLIPSE> ellipses(n);
+    for (size_t i = 0; i < n; ++i)
+    {
+        const wxRect2DDouble& r = rects[i];
+        D2D1_ELLIPSE ellipse = {
+            { (FLOAT)(r.m_x + r.m_width / 2), (FLOAT)(r.m_y + r.m_height / 2) }, // center point
+            (FLOAT)(r.m_width / 2),                      // radius x
+            (FLOAT)(r.m_height / 2)                      // radius y
+        };
+        ellipses[i] = ellipse;
+    }
+
+    if (!m_brush.IsNull())
+    {
+        wxD2DBrushData* brushData = wxGetD2DBrushData(m_brush);
+        brushData->Bind(this);
+        for (size_t i = 0; i < n; ++i)
+            GetRenderTarget()->FillEllipse(ellipses[i], brushData->GetBrush());
+    }
+
+    if (!m_pen.IsNull())
+    {
+        wxD2DPenData* penData = wxGetD2DPenData(m_pen);
+        penData->SetWidth(this);
+        penData->Bind(this);
+        for (size_t i = 0; i < n; ++i)
+            GetRenderTarget()->DrawEllipse(ellipses[i], penData->GetBrush(), penData->GetWidth(), penData->GetStrokeStyle());
+    }
+}
+
+void wxD2DContext::DrawMarkers(size_t n, const wxPoint2DDouble* centres,
+                               wxDouble size,
+                               wxMarkerShape shape,
+                               const wxColour* colours)
+{
+    if (m_composition == wxCOMPOSITION_DEST || !n)
+        return;
+
+    OffsetHelper helper(this, m_pen);
+
+    EnsureInitialized();
+    AdjustRenderTargetSize();
+
+    const FLOAT half = (FLOAT)(size / 2);
+
+    // Fill or stroke all markers using the given brush.
+    const auto drawAll = [=](ID2D1Brush* brush, const wxD2DPenData* penData)
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            if (colours && !penData)
+                ((ID2D1SolidColorBrush*)brush)->SetColor(wxD2DConvertColour(colours[i]));
+
+            const FLOAT x = (FLOAT)centres[i].m_x,
+                        y = (FLOAT)centres[i].m_y;
+
+            switch (shape)
+            {
+                case wxMARKER_SQUARE:
+                {
+                    D2D1_RECT_F rect = { x - half, y - half, x + half, y + half };
+                    if (penData)
+                        GetRenderTarget()->DrawRectangle(rect, brush, penData->GetWidth(), penData->GetStrokeStyle());
+                    else
+                        GetRenderTarget()->FillRectangle(rect, brush);
+                    break;
+                }
+
+                case wxMARKER_CIRCLE:
+                {
+                    D2D1_ELLIPSE ellipse = { { x, y }, half, half };
+                    if (penData)
+                        GetRenderTarget()->DrawEllipse(ellipse, brush, penData->GetWidth(), penData->GetStrokeStyle());
+                    else
+                        GetRenderTarget()->FillEllipse(ellipse, brush);
+                    break;
+                }
+            }
+        }
+    };
+
+    if (colours)
+    {
+        // Use a single brush whose colour is changed for each marker, which
+        // is much cheaper than creating a new brush for each of them.
+        wxCOMPtr<ID2D1SolidColorBrush> brush;
+        HRESULT hr = GetRenderTarget()->CreateSolidColorBrush(wxD2DConvertColour(colours[0]), &brush);
+        wxCHECK_HRESULT_RET(hr);
+
+        drawAll(brush, nullptr);
+    }
+    else if (!m_brush.IsNull())
+    {
+        wxD2DBrushData* brushData = wxGetD2DBrushData(m_brush);
+        brushData->Bind(this);
+        drawAll(brushData->GetBrush(), nullptr);
+    }
+
+    if (!m_pen.IsNull())
+    {
+        wxD2DPenData* penData = wxGetD2DPenData(m_pen);
+        penData->SetWidth(this);
+        penData->Bind(this);
+        drawAll(penData->GetBrush(), penData);
+    }
+}
+
+void wxD2DContext::StrokeLineSegments(size_t n, const wxPoint2DDouble* points)
+{
+    if (m_composition == wxCOMPOSITION_DEST || !n)
+        return;
+
+    if (m_pen.IsNull())
+        return;
+
+    OffsetHelper helper(this, m_pen);
+
+    EnsureInitialized();
+    AdjustRenderTargetSize();
+
+    wxD2DPenData* penData = wxGetD2DPenData(m_pen);
+    penData->SetWidth(this);
+    penData->Bind(this);
+    for (size_t i = 0; i < n; ++i, points += 2)
+    {
+        GetRenderTarget()->DrawLine(
+            D2D1::Point2F((FLOAT)points[0].m_x, (FLOAT)points[0].m_y),
+            D2D1::Point2F((FLOAT)points[1].m_x, (FLOAT)points[1].m_y),
+            penData->GetBrush(), penData->GetWidth(), penData->GetStrokeStyle());
+    }
+}
+
 void wxD2DContext::Flush()
 {
     wxStack<LayerData> layersToRestore;
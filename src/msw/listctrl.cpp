@@ -2820,6 +2820,17 @@ bool wxListCtrl::MSWOnNotify(int idCtrl, WXLPARAM lParam, WXLPARAM *result)
                         startPos = 0;
                     }
 
+                    // Let the control find the item itself if it can.
+                    long found;
+                    if ( OnFindItemByPrefix(startPos, searchstr, found) )
+                    {
+                        wxCHECK_MSG( found >= -1 && found < maxPos, false,
+                                     "invalid item returned by OnFindItemByPrefix()" );
+
+                        *result = found;
+                        return true;
+                    }
+
                     // Linear search in a control with a lot of items can take
                     // a long time so we limit the total time of the search to
                     // ensure that the program doesn't appear to hang.
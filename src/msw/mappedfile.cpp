@@ -0,0 +1,104 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        src/msw/mappedfile.cpp
+// Purpose:     wxMappedFile implementation using Win32 file mappings
+// Author:      wxWidgets team
+// Created:     2026-10-14
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+// For compilers that support precompilation, includes "wx.h".
+#include "wx/wxprec.h"
+
+
+#if wxUSE_FILE
+
+#ifndef WX_PRECOMP
+    #include "wx/intl.h"
+    #include "wx/log.h"
+#endif // WX_PRECOMP
+
+#include "wx/mappedfile.h"
+
+#include "wx/msw/private.h"
+
+bool wxMappedFile::DoOpen(const wxString& filename)
+{
+    // Allow other processes to write to the file, as is usually the case for
+    // the log files, for example.
+    const HANDLE hFile = ::CreateFile
+                         (
+                            filename.t_str(),
+                            GENERIC_READ,
+                            FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                            nullptr,
+                            OPEN_EXISTING,
+                            FILE_ATTRIBUTE_NORMAL,
+                            nullptr
+                         );
+    if ( hFile == INVALID_HANDLE_VALUE )
+    {
+        wxLogSysError(_("can't open file '%s'"), filename);
+        return false;
+    }
+
+    bool ok = false;
+
+    LARGE_INTEGER size;
+    if ( !::GetFileSizeEx(hFile, &size) )
+    {
+        wxLogSysError(_("can't find length of file '%s'"), filename);
+    }
+    else if ( static_cast<wxULongLong_t>(size.QuadPart) > SIZE_MAX )
+    {
+        wxLogError(_("File \"%s\" is too big to be mapped into memory."),
+                   filename);
+    }
+    else if ( size.QuadPart == 0 )
+    {
+        // Empty files can't be mapped, but there is nothing to map anyhow.
+        ok = true;
+    }
+    else
+    {
+        const HANDLE hMapping = ::CreateFileMapping(hFile, nullptr,
+                                                    PAGE_READONLY, 0, 0,
+                                                    nullptr);
+        if ( !hMapping )
+        {
+            wxLogSysError(_("Failed to map file \"%s\" into memory"), filename);
+        }
+        else
+        {
+            const void* const
+                data = ::MapViewOfFile(hMapping, FILE_MAP_READ, 0, 0, 0);
+            if ( !data )
+            {
+                wxLogSysError(_("Failed to map file \"%s\" into memory"),
+                              filename);
+            }
+            else
+            {
+                m_data = static_cast<const char*>(data);
+                m_length = static_cast<size_t>(size.QuadPart);
+                ok = true;
+            }
+
+            // The view keeps the mapping object alive, so we don't need to
+            // keep this handle.
+            ::CloseHandle(hMapping);
+        }
+    }
+
+    ::CloseHandle(hFile);
+
+    return ok;
+}
+
+void wxMappedFile::DoClose()
+{
+    if ( !::UnmapViewOfFile(m_data) )
+        wxLogLastError(wxS("UnmapViewOfFile"));
+}
+
+#endif // wxUSE_FILE
@@ -26,6 +26,7 @@
 
 #include "wx/msw/private.h"
 #include "wx/msw/private/hiddenwin.h"
+#include "wx/dynlib.h"
 
 #include <unordered_map>
 
@@ -118,15 +119,45 @@ bool wxMSWTimerImpl::Start(int milliseconds, bool oneShot)
         return false;
 
     m_id = GetNewTimerId(this);
+
+    // SetCoalescableTimer() is only available since Windows 8, so load it
+    // dynamically
+    typedef UINT_PTR (WINAPI *SetCoalescableTimer_t)(HWND, UINT_PTR, UINT,
+                                                      TIMERPROC, ULONG);
+    static SetCoalescableTimer_t s_pfnSetCoalescableTimer = nullptr;
+    static bool s_initDone = false;
+
+    if ( m_tolerance > 0 && !s_initDone )
+    {
+        wxLoadedDLL dllUser32("user32.dll");
+        wxDL_INIT_FUNC(s_pfn, SetCoalescableTimer, dllUser32);
+        s_initDone = true;
+    }
+
     // SetTimer() normally returns just idTimer but this might change in the
     // future so use its return value to be safe
-    UINT_PTR ret = ::SetTimer
-             (
-              wxTimerHiddenWindowModule::GetHWND(),  // window for WM_TIMER
-              m_id,                                  // timer ID to create
-              (UINT)m_milli,                         // delay
-              nullptr                                // timer proc (unused)
-             );
+    UINT_PTR ret;
+    if ( m_tolerance > 0 && s_pfnSetCoalescableTimer )
+    {
+        ret = s_pfnSetCoalescableTimer
+              (
+                wxTimerHiddenWindowModule::GetHWND(),
+                m_id,
+                (UINT)m_milli,
+                nullptr,
+                (ULONG)m_tolerance
+              );
+    }
+    else
+    {
+        ret = ::SetTimer
+              (
+                wxTimerHiddenWindowModule::GetHWND(),  // window for WM_TIMER
+                m_id,                                  // timer ID to create
+                (UINT)m_milli,                         // delay
+                nullptr                                // timer proc (unused)
+              );
+    }
 
     if ( ret == 0 )
     {
@@ -1120,3 +1120,9 @@ long wxExecute(const wchar_t* const* argv, int flags, wxProcess* handler,
 {
     return wxExecuteImpl(argv, flags, handler, env);
 }
+
+wxExecuteStats wxGetExecuteStats()
+{
+    // Not implemented under MSW.
+    return wxExecuteStats();
+}
@@ -234,6 +234,10 @@ public:
         // put content
         if (data)
         {
+            const wxFileOffset length = data->GetContentLength();
+            if (length != wxInvalidOffset)
+                SetHeader("Content-Length", wxString::Format("%" wxFileOffsetFmtSpec "d", length));
+
             IStream* stream = new wxWebViewEdgeHandlerResponseStream(data);
             HRESULT hr = m_response->put_Content(stream);
             if (FAILED(hr))
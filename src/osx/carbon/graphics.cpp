@@ -1509,8 +1509,22 @@ public:
 
     virtual void DrawRectangle( wxDouble x, wxDouble y, wxDouble w, wxDouble h ) override;
 
+    virtual void DrawRectangles( size_t n, const wxRect2DDouble *rects ) override;
+
+    virtual void DrawEllipses( size_t n, const wxRect2DDouble *rects ) override;
+
+    virtual void DrawMarkers( size_t n, const wxPoint2DDouble *centres,
+                              wxDouble size,
+                              wxMarkerShape shape = wxMARKER_SQUARE,
+                              const wxColour *colours = nullptr ) override;
+
+    virtual void StrokeLineSegments( size_t n, const wxPoint2DDouble *points ) override;
+
     void SetNativeContext( CGContextRef cg );
 
+    // return true if either the brush or the pen uses a gradient
+    bool UsesShading() const;
+
     class OffsetHelper;
 
     wxDECLARE_NO_COPY_CLASS(wxMacCoreGraphicsContext);
@@ -2750,6 +2764,181 @@ void wxMacCoreGraphicsContext::DrawRectangle( wxDouble x, wxDouble y, wxDouble w
     }
 }
 
+bool wxMacCoreGraphicsContext::UsesShading() const
+{
+    return (!m_brush.IsNull() && ((wxMacCoreGraphicsBrushData*)m_brush.GetRefData())->IsShading()) ||
+           (!m_pen.IsNull() && ((wxMacCoreGraphicsPenData*)m_pen.GetRefData())->IsShading());
+}
+
+void wxMacCoreGraphicsContext::DrawRectangles( size_t n, const wxRect2DDouble *rects )
+{
+    if (!EnsureIsValid())
+        return;
+
+    if (m_composition == wxCOMPOSITION_DEST || !n)
+        return;
+
+    // when using shading, we have to go back to drawing paths
+    if ( UsesShading() )
+    {
+        wxGraphicsContext::DrawRectangles( n, rects );
+        return;
+    }
+
+    wxVector<CGRect> cgrects(n);
+    for ( size_t i = 0; i < n; ++i )
+    {
+        const wxRect2DDouble& r = rects[i];
+        cgrects[i] = CGRectMake( (CGFloat) r.m_x , (CGFloat) r.m_y , (CGFloat) r.m_width , (CGFloat) r.m_height );
+    }
+
+    if ( !m_brush.IsNull() )
+    {
+        ((wxMacCoreGraphicsBrushData*)m_brush.GetRefData())->Apply(this);
+        CGContextFillRects(m_cgContext, &cgrects[0], n);
+    }
+
+    if ( !m_pen.IsNull() )
+    {
+        OffsetHelper helper(ShouldOffset(), m_cgContext, m_pen);
+        ((wxMacCoreGraphicsPenData*)m_pen.GetRefData())->Apply(this);
+        CGContextAddRects(m_cgContext, &cgrects[0], n);
+        CGContextStrokePath(m_cgContext);
+    }
+}
+
+void wxMacCoreGraphicsContext::DrawEllipses( size_t n, const wxRect2DDouble *rects )
+{
+    if (!EnsureIsValid())
+        return;
+
+    if (m_composition == wxCOMPOSITION_DEST || !n)
+        return;
+
+    if ( UsesShading() )
+    {
+        wxGraphicsContext::DrawEllipses( n, rects );
+        return;
+    }
+
+    const CGPathDrawingMode mode = m_brush.IsNull() ? kCGPathStroke
+                                                    : m_pen.IsNull() ? kCGPathFill
+                                                                     : kCGPathFillStroke;
+
+    OffsetHelper helper(ShouldOffset(), m_cgContext, m_pen);
+    if ( !m_brush.IsNull() )
+        ((wxMacCoreGraphicsBrushData*)m_brush.GetRefData())->Apply(this);
+    if ( !m_pen.IsNull() )
+        ((wxMacCoreGraphicsPenData*)m_pen.GetRefData())->Apply(this);
+
+    for ( size_t i = 0; i < n; ++i )
+    {
+        const wxRect2DDouble& r = rects[i];
+        CGContextAddEllipseInRect(m_cgContext,
+            CGRectMake( (CGFloat) r.m_x , (CGFloat) r.m_y , (CGFloat) r.m_width , (CGFloat) r.m_height ));
+    }
+
+    CGContextDrawPath(m_cgContext, mode);
+}
+
+void wxMacCoreGraphicsContext::DrawMarkers( size_t n, const wxPoint2DDouble *centres,
+                                            wxDouble size,
+                                            wxMarkerShape shape,
+                                            const wxColour *colours )
+{
+    if (!EnsureIsValid())
+        return;
+
+    if (m_composition == wxCOMPOSITION_DEST || !n)
+        return;
+
+    if ( UsesShading() )
+    {
+        wxGraphicsContext::DrawMarkers( n, centres, size, shape, colours );
+        return;
+    }
+
+    const CGFloat half = (CGFloat) size / 2;
+    const auto addMarkers = [=](size_t from, size_t to)
+    {
+        for ( size_t i = from; i < to; ++i )
+        {
+            const CGRect rect = CGRectMake( (CGFloat) centres[i].m_x - half,
+                                            (CGFloat) centres[i].m_y - half,
+                                            (CGFloat) size, (CGFloat) size );
+            switch ( shape )
+            {
+                case wxMARKER_SQUARE:
+                    CGContextAddRect(m_cgContext, rect);
+                    break;
+
+                case wxMARKER_CIRCLE:
+                    CGContextAddEllipseInRect(m_cgContext, rect);
+                    break;
+            }
+        }
+    };
+
+    OffsetHelper helper(ShouldOffset(), m_cgContext, m_pen);
+
+    if ( colours )
+    {
+        // fill each run of markers of the same colour at once
+        for ( size_t start = 0; start < n; )
+        {
+            const wxColour& col = colours[start];
+            size_t end = start + 1;
+            while ( end < n && colours[end] == col )
+                ++end;
+
+            CGContextSetFillColorWithColor(m_cgContext, col.GetCGColor());
+            addMarkers(start, end);
+            CGContextFillPath(m_cgContext);
+
+            start = end;
+        }
+    }
+    else if ( !m_brush.IsNull() )
+    {
+        ((wxMacCoreGraphicsBrushData*)m_brush.GetRefData())->Apply(this);
+        addMarkers(0, n);
+        CGContextFillPath(m_cgContext);
+    }
+
+    if ( !m_pen.IsNull() )
+    {
+        ((wxMacCoreGraphicsPenData*)m_pen.GetRefData())->Apply(this);
+        addMarkers(0, n);
+        CGContextStrokePath(m_cgContext);
+    }
+}
+
+void wxMacCoreGraphicsContext::StrokeLineSegments( size_t n, const wxPoint2DDouble *points )
+{
+    if ( m_pen.IsNull() )
+        return ;
+
+    if (!EnsureIsValid())
+        return;
+
+    if (m_composition == wxCOMPOSITION_DEST || !n)
+        return;
+
+    if ( ((wxMacCoreGraphicsPenData*)m_pen.GetRefData())->IsShading() )
+    {
+        wxGraphicsContext::StrokeLineSegments( n, points );
+        return;
+    }
+
+    wxVector<CGPoint> cgpoints(2*n);
+    for ( size_t i = 0; i < 2*n; ++i )
+        cgpoints[i] = CGPointMake( (CGFloat) points[i].m_x, (CGFloat) points[i].m_y );
+
+    OffsetHelper helper(ShouldOffset(), m_cgContext, m_pen);
+    ((wxMacCoreGraphicsPenData*)m_pen.GetRefData())->Apply(this);
+    CGContextStrokeLineSegments(m_cgContext, &cgpoints[0], 2*n);
+}
+
 // concatenates this transform with the current transform of this context
 void wxMacCoreGraphicsContext::ConcatTransform( const wxGraphicsMatrix& matrix )
 {
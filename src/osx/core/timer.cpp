@@ -81,6 +81,9 @@ bool wxOSXTimerImpl::Start( int milliseconds, bool mode )
 
     wxASSERT_MSG( m_info->m_timerRef != nullptr, wxT("unable to create timer"));
 
+    if ( m_tolerance > 0 )
+        CFRunLoopTimerSetTolerance( m_info->m_timerRef, m_tolerance / 1000.0 );
+
     CFRunLoopRef runLoop = nullptr;
 #if wxOSX_USE_IPHONE
     runLoop = CFRunLoopGetMain();
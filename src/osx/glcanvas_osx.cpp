@@ -30,6 +30,8 @@
 
 #include "wx/osx/private.h"
 
+#include <dlfcn.h>
+
 // These 'WX' values are the same as 'NS' ones
 // Source: https://developer.apple.com/library/mac/documentation/
 //  Cocoa/Reference/ApplicationKit/Classes/NSOpenGLPixelFormat_Class/index.html
@@ -540,6 +542,13 @@ bool wxGLCanvasBase::IsExtensionSupported(const char *extension)
     return IsExtensionInList(extensions.ToAscii(), extension);
 }
 
+/* static */
+void* wxGLCanvasBase::GetGLProcAddress(const char *name)
+{
+    // All OpenGL functions are directly exported by the framework.
+    return dlsym(RTLD_DEFAULT, name);
+}
+
 // ----------------------------------------------------------------------------
 // wxGLApp
 // ----------------------------------------------------------------------------
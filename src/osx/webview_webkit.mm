@@ -1023,6 +1023,9 @@ public:
 class API_AVAILABLE(macos(10.13)) wxWebViewWebkitHandlerResponse: public wxWebViewHandlerResponse
 {
 public:
+    // Size of the chunks in which the response data is passed to WebKit.
+    enum { RESPONSE_CHUNK_SIZE = 64*1024 };
+
     wxWebViewWebkitHandlerResponse(id<WKURLSchemeTask> task):
         m_status(200),
         m_task([task retain])
@@ -1048,11 +1051,17 @@ public:
                      forKey:wxCFStringRef(name).AsNSString()];
     }
 
+    using wxWebViewHandlerResponse::Finish;
+
     virtual void Finish(wxSharedPtr<wxWebViewHandlerResponseData> data) override
     {
         m_data = data;
         wxInputStream* stream = data->GetStream();
-        size_t length = stream->GetLength();
+
+        const wxFileOffset length = data->GetContentLength();
+        if ( length != wxInvalidOffset && ![m_headers objectForKey:@"Content-Length"] )
+            SetHeader("Content-Length", wxString::Format("%" wxFileOffsetFmtSpec "d", length));
+
         NSHTTPURLResponse* response = [[NSHTTPURLResponse alloc] initWithURL:m_task.request.URL
                                                                   statusCode:m_status
                                                                  HTTPVersion:nil
@@ -1060,12 +1069,19 @@ public:
         [m_task didReceiveResponse:response];
         [response release];
 
-        //Load the data, we malloc it so it is tidied up properly
-        void* buffer = malloc(length);
-        stream->Read(buffer, length);
-        NSData *taskData = [[NSData alloc] initWithBytesNoCopy:buffer length:length];
-        [m_task didReceiveData:taskData];
-        [taskData release];
+        // Pass the data in chunks to avoid having to load the entire stream,
+        // which can be arbitrarily big, into memory.
+        if ( stream )
+        {
+            char buffer[RESPONSE_CHUNK_SIZE];
+            while ( stream->Read(buffer, sizeof(buffer)).LastRead() )
+            {
+                NSData *taskData = [[NSData alloc] initWithBytes:buffer
+                                                          length:stream->LastRead()];
+                [m_task didReceiveData:taskData];
+                [taskData release];
+            }
+        }
 
         [m_task didFinish];
     }
@@ -1886,6 +1886,20 @@ wxPGProperty* wxPropertyGridManager::DoGetPropertyByName( const wxString& name )
             return p;
         }
     }
+
+    // The property may be among the not yet created children of a category.
+    for ( size_t i = 0; i < GetPageCount(); i++ )
+    {
+        wxPropertyGridPageState* pState = m_arrPages[i]->GetStatePtr();
+        if ( pState->DoCreateLazyChildren() )
+        {
+            wxPGProperty* p = pState->BaseGetPropertyByName(name);
+            if ( p )
+            {
+                return p;
+            }
+        }
+    }
     return nullptr;
 }
 
@@ -2321,6 +2321,10 @@ bool wxPGProperty::DoHide( bool hide, wxPGPropertyValuesFlags flags )
 
 bool wxPGProperty::HasVisibleChildren() const
 {
+    // Assume that the children which will be created are going to be visible.
+    if ( HasLazyChildren() )
+        return true;
+
     for ( wxPGProperty* child : m_children )
     {
         if ( !child->HasFlag(wxPGPropertyFlags::Hidden) )
@@ -2330,6 +2334,12 @@ bool wxPGProperty::HasVisibleChildren() const
     return false;
 }
 
+bool wxPGProperty::HasLazyChildren() const
+{
+    return IsCategory() &&
+           static_cast<const wxPropertyCategory*>(this)->m_lazyChildren;
+}
+
 bool wxPGProperty::RecreateEditor()
 {
     wxPropertyGrid* pg = GetGrid();
@@ -3025,6 +3035,35 @@ wxString wxPropertyCategory::GetValueAsString(wxPGPropValFormatFlags flags) cons
     return IsValueUnspecified() ? wxString() : wxPGProperty::GetValueAsString(flags);
 }
 
+void wxPropertyCategory::SetLazyChildren(const wxPGLazyChildrenFunction& func)
+{
+    m_lazyChildren = func;
+    if ( !m_lazyChildren )
+        return;
+
+    // Children will be created when the category is expanded.
+    SetExpanded(false);
+
+    if ( m_parentState )
+    {
+        m_parentState->m_hasLazyChildren = true;
+        m_parentState->VirtualHeightChanged();
+    }
+}
+
+void wxPropertyCategory::CreateLazyChildren()
+{
+    if ( !m_lazyChildren )
+        return;
+
+    // Reset the function before calling it, so that HasLazyChildren() returns
+    // false while the children are being added.
+    wxPGLazyChildrenFunction func;
+    func.swap(m_lazyChildren);
+
+    func(this);
+}
+
 static int DoGetTextExtent(const wxWindow* wnd, const wxString& label, const wxFont& font)
 {
     int x = 0, y = 0;
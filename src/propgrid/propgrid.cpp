@@ -387,6 +387,8 @@ void wxPropertyGrid::Init1()
     m_inCommitChangesFromEditor = false;
     m_inDoSelectProperty = false;
     m_inOnValidationFailure = false;
+    m_updateEditor = false;
+    m_updateLevel = 0;
     m_permanentValidationFailureBehavior = wxPGVFBFlags::Default;
     m_dragStatus = 0;
     m_editorFocused = false;
@@ -2584,10 +2586,23 @@ void wxPropertyGrid::DrawItems( const wxPGProperty* p1, const wxPGProperty* p2 )
     if ( IsFrozen() )
         return;
 
+    if ( m_updateLevel )
+    {
+        // Just remember what to redraw, EndUpdate() will do it. If items were
+        // added, it will redraw everything anyhow.
+        if ( !m_pState->m_itemsAdded )
+            m_updateRect.Union(GetPropertyRect(p1, p2));
+        return;
+    }
+
     if ( m_pState->m_itemsAdded )
         PrepareAfterItemsAdded();
 
-    wxRect r = GetPropertyRect(p1, p2);
+    DoRefreshLogicalRect(GetPropertyRect(p1, p2));
+}
+
+void wxPropertyGrid::DoRefreshLogicalRect( wxRect r )
+{
     if ( !r.IsEmpty() )
     {
         // Convert rectangle from logical grid coordinates to physical ones
@@ -2603,6 +2618,40 @@ void wxPropertyGrid::DrawItems( const wxPGProperty* p1, const wxPGProperty* p2 )
 
 // -----------------------------------------------------------------------
 
+void wxPropertyGrid::BeginUpdate()
+{
+    m_updateLevel++;
+}
+
+void wxPropertyGrid::EndUpdate()
+{
+    wxCHECK_RET( m_updateLevel > 0,
+                 wxS("EndUpdate() called without matching BeginUpdate()") );
+
+    if ( --m_updateLevel )
+        return;
+
+    const wxRect r = m_updateRect;
+    m_updateRect = wxRect();
+
+    if ( m_updateEditor )
+    {
+        m_updateEditor = false;
+        RefreshEditor();
+    }
+
+    // Thaw() will redraw everything when it's called.
+    if ( IsFrozen() )
+        return;
+
+    if ( m_pState->m_itemsAdded )
+        Refresh();
+    else
+        DoRefreshLogicalRect(r);
+}
+
+// -----------------------------------------------------------------------
+
 void wxPropertyGrid::RefreshProperty( wxPGProperty* p )
 {
     if ( m_pState->DoIsPropertySelected(p) || p->IsChildSelected(true) )
@@ -4427,6 +4476,12 @@ bool wxPropertyGrid::UnfocusEditor()
 
 void wxPropertyGrid::RefreshEditor()
 {
+    if ( m_updateLevel )
+    {
+        m_updateEditor = true;
+        return;
+    }
+
     wxPGProperty* p = GetSelection();
     if ( !p )
         return;
@@ -4931,7 +4986,7 @@ bool wxPropertyGrid::HandleMouseClick( int x, unsigned int y, wxMouseEvent &even
         else
         {
         // Click on margin.
-            if ( p->GetChildCount() )
+            if ( p->GetChildCount() || p->HasLazyChildren() )
             {
                 int nx = x + m_marginWidth - marginEnds; // Normalize x.
 
@@ -5771,7 +5826,7 @@ void wxPropertyGrid::HandleKeyEvent( wxKeyEvent &event, bool fromChild )
         // Travel and expand/collapse
         int selectDir = -2;
 
-        if ( p->GetChildCount() )
+        if ( p->GetChildCount() || p->HasLazyChildren() )
         {
             if ( action == wxPGKeyboardAction::CollapseProperty || secondAction == wxPGKeyboardAction::CollapseProperty )
             {
@@ -302,7 +302,7 @@ bool wxPropertyGridInterface::ExpandAll( bool doExpand )
     for ( it = GetVIterator( wxPG_ITERATE_ALL ); !it.AtEnd(); it.Next() )
     {
         wxPGProperty* p = it.GetProperty();
-        if ( p->HasAnyChild() )
+        if ( p->HasAnyChild() || p->HasLazyChildren() )
         {
             if ( doExpand )
             {
@@ -495,7 +495,13 @@ void wxPropertyGridInterface::SetBoolChoices( const wxString& trueChoice,
 
 wxPGProperty* wxPropertyGridInterface::DoGetPropertyByName( const wxString& name ) const
 {
-    return m_pState->BaseGetPropertyByName(name);
+    wxPGProperty* p = m_pState->BaseGetPropertyByName(name);
+
+    // The property may be among the not yet created children of a category.
+    if ( !p && m_pState->DoCreateLazyChildren() )
+        p = m_pState->BaseGetPropertyByName(name);
+
+    return p;
 }
 
 // -----------------------------------------------------------------------
@@ -203,6 +203,7 @@ wxPropertyGridPageState::wxPropertyGridPageState()
     , m_vhCalcPending(false)
     , m_isSplitterPreSet(false)
     , m_dontCenterSplitter(false)
+    , m_hasLazyChildren(false)
 {
     m_regularArray.SetParentState(this);
 }
@@ -302,6 +303,7 @@ void wxPropertyGridPageState::DoClear()
 
         m_currentCategory = nullptr;
         m_itemsAdded = false;
+        m_hasLazyChildren = false;
 
         m_virtualHeight = 0;
         m_vhCalcPending = false;
@@ -478,6 +480,43 @@ wxPGProperty* wxPropertyGridPageState::BaseGetPropertyByName( const wxString& na
 
 // -----------------------------------------------------------------------
 
+bool wxPropertyGridPageState::DoCreateLazyChildren()
+{
+    if ( !m_hasLazyChildren )
+        return false;
+
+    bool created = false;
+
+    // Creating the children of a category may add more lazily populated
+    // categories, which are handled too as they are appended to the stack.
+    std::vector<wxPGProperty*> pending{&m_regularArray};
+    while ( !pending.empty() )
+    {
+        wxPGProperty* p = pending.back();
+        pending.pop_back();
+
+        if ( p->HasLazyChildren() )
+        {
+            static_cast<wxPropertyCategory*>(p)->CreateLazyChildren();
+            created = true;
+        }
+
+        // Only categories can be lazily populated and their parents are
+        // always categories too.
+        for ( wxPGProperty* child : p->m_children )
+        {
+            if ( child->IsCategory() )
+                pending.push_back(child);
+        }
+    }
+
+    m_hasLazyChildren = false;
+
+    return created;
+}
+
+// -----------------------------------------------------------------------
+
 void wxPropertyGridPageState::DoSetPropertyName( wxPGProperty* p,
                                                  const wxString& newName )
 {
@@ -1328,6 +1367,9 @@ bool wxPropertyGridPageState::DoExpand( wxPGProperty* p )
 {
     wxCHECK_MSG( p, false, wxS("invalid property id") );
 
+    if ( p->HasLazyChildren() )
+        static_cast<wxPropertyCategory*>(p)->CreateLazyChildren();
+
     if ( !p->HasAnyChild() ) return false;
 
     if ( p->IsExpanded() ) return false;
@@ -1730,6 +1772,9 @@ wxPGProperty* wxPropertyGridPageState::DoInsert( wxPGProperty* parent, int index
         (parentIsCategory || parentIsRoot) )
         m_dictName[property->GetBaseName()] = property;
 
+    if ( property->HasLazyChildren() )
+        m_hasLazyChildren = true;
+
     VirtualHeightChanged();
 
     // Update values of all parents if they are containers of composed values.
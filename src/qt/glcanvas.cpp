@@ -12,6 +12,7 @@
 #include "wx/qt/private/winevent.h"
 #include "wx/glcanvas.h"
 
+#include <QOpenGLContext>
 #include <QOpenGLWidget>
 #include <QSurfaceFormat>
 #include <QtWidgets/QGestureRecognizer>
@@ -491,6 +492,16 @@ bool wxGLCanvas::SwapBuffers()
     return true;
 }
 
+/* static */
+void* wxGLCanvasBase::GetGLProcAddress(const char *name)
+{
+    QOpenGLContext* const context = QOpenGLContext::currentContext();
+    if ( !context )
+        return nullptr;
+
+    return reinterpret_cast<void*>(context->getProcAddress(name));
+}
+
 bool wxGLCanvas::QtCanPaintWithoutActivePainter() const
 {
     return true;
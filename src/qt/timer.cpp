@@ -27,7 +27,13 @@ bool wxQtTimerImpl::Start( int millisecs, bool oneShot )
     if ( m_timerId >= 0 )
         return false;
 
-    m_timerId = startTimer( GetInterval() );
+    // Very coarse timers are rounded to whole seconds, so only use them if
+    // this is allowed by the timer tolerance.
+    const Qt::TimerType type = GetInterval() >= 1000 && GetTolerance() >= 1000
+                                ? Qt::VeryCoarseTimer
+                                : Qt::CoarseTimer;
+
+    m_timerId = startTimer( GetInterval(), type );
 
     return m_timerId >= 0;
 }
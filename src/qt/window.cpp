@@ -1469,7 +1469,7 @@ bool wxWindowQt::QtHandlePaintEvent ( QWidget *handler, QPaintEvent *event )
 
             // send the paint event (wxWindowDC will draw directly):
             wxPaintEvent paint( this );
-            handled = ProcessWindowEvent(paint);
+            handled = HandleWindowEvent(paint);
             m_updateRegion.Clear();
         }
         else
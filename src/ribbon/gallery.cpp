@@ -38,15 +38,9 @@ public:
     wxRibbonGalleryItem() = default;
 
     void SetId(int id) {m_id = id;}
+    int GetId() const {return m_id;}
     void SetBitmap(const wxBitmap& bitmap) {m_bitmap = bitmap;}
     const wxBitmap& GetBitmap() const {return m_bitmap;}
-    void SetIsVisible(bool visible) {m_is_visible = visible;}
-    void SetPosition(int x, int y, const wxSize& size)
-    {
-        m_position = wxRect(wxPoint(x, y), size);
-    }
-    bool IsVisible() const {return m_is_visible;}
-    const wxRect& GetPosition() const {return m_position;}
 
     void SetClientObject(wxClientData *data) {m_client_data.SetClientObject(data);}
     wxClientData *GetClientObject() const {return m_client_data.GetClientObject();}
@@ -56,9 +50,7 @@ public:
 protected:
     wxBitmap m_bitmap;
     wxClientDataContainer m_client_data;
-    wxRect m_position;
     int m_id = 0;
-    bool m_is_visible = false;
 };
 
 wxBEGIN_EVENT_TABLE(wxRibbonGallery, wxRibbonControl)
@@ -162,20 +154,14 @@ void wxRibbonGallery::OnMouseMove(wxMouseEvent& evt)
         else
             pos.y += m_scroll_amount;
 
-        size_t item_count = m_items.Count();
-        size_t item_i;
-        for(item_i = 0; item_i < item_count; ++item_i)
+        const int item_i = HitTestItem(pos);
+        if(item_i != -1)
         {
-            wxRibbonGalleryItem *item = m_items.Item(item_i);
-            if(!item->IsVisible())
-                continue;
-
-            if(item->GetPosition().Contains(pos))
+            hovered_item = GetItem(item_i);
+            if(m_mouse_active_rect == &m_active_item_rect &&
+                m_active_item_rect == GetItemRect(item_i))
             {
-                if(m_mouse_active_rect == &item->GetPosition())
-                    active_item = item;
-                hovered_item = item;
-                break;
+                active_item = hovered_item;
             }
         }
     }
@@ -260,21 +246,12 @@ void wxRibbonGallery::OnMouseDown(wxMouseEvent& evt)
             pos.x += m_scroll_amount;
         else
             pos.y += m_scroll_amount;
-        size_t item_count = m_items.Count();
-        size_t item_i;
-        for(item_i = 0; item_i < item_count; ++item_i)
+        const int item_i = HitTestItem(pos);
+        if(item_i != -1)
         {
-            wxRibbonGalleryItem *item = m_items.Item(item_i);
-            if(!item->IsVisible())
-                continue;
-
-            const wxRect& rect = item->GetPosition();
-            if(rect.Contains(pos))
-            {
-                m_active_item = item;
-                m_mouse_active_rect = &rect;
-                break;
-            }
+            m_active_item = GetItem(item_i);
+            m_active_item_rect = GetItemRect(item_i);
+            m_mouse_active_rect = &m_active_item_rect;
         }
     }
     else if(m_scroll_up_button_rect.Contains(pos))
@@ -458,25 +435,169 @@ bool wxRibbonGallery::ScrollPixels(int pixels)
 
 void wxRibbonGallery::EnsureVisible(const wxRibbonGalleryItem* item)
 {
-    if(item == nullptr || !item->IsVisible() || IsEmpty())
+    if(item == nullptr || m_items_per_line == 0 || IsEmpty())
+        return;
+
+    const int item_i = GetItemIndex(item);
+    if(item_i == -1)
         return;
 
+    const wxRect rect = GetItemRect(item_i);
     if(m_art->GetFlags() & wxRIBBON_BAR_FLOW_VERTICAL)
     {
-        int x = item->GetPosition().GetLeft();
-        int base_x = m_items.Item(0)->GetPosition().GetLeft();
-        int delta = x - base_x - m_scroll_amount;
+        int delta = rect.GetLeft() - m_client_rect.GetLeft() - m_scroll_amount;
         ScrollLines(delta / m_bitmap_padded_size.GetWidth());
     }
     else
     {
-        int y = item->GetPosition().GetTop();
-        int base_y = m_items.Item(0)->GetPosition().GetTop();
-        int delta = y - base_y - m_scroll_amount;
+        int delta = rect.GetTop() - m_client_rect.GetTop() - m_scroll_amount;
         ScrollLines(delta / m_bitmap_padded_size.GetHeight());
     }
 }
 
+wxRect wxRibbonGallery::GetItemRect(unsigned int n) const
+{
+    wxCHECK_MSG( m_items_per_line > 0, wxRect(), "gallery not laid out" );
+
+    const int line = n / m_items_per_line;
+    const int pos_in_line = n % m_items_per_line;
+
+    wxPoint pt = m_client_rect.GetPosition();
+    if(m_art && m_art->GetFlags() & wxRIBBON_BAR_FLOW_VERTICAL)
+    {
+        pt.x += line * m_bitmap_padded_size.x;
+        pt.y += pos_in_line * m_bitmap_padded_size.y;
+    }
+    else
+    {
+        pt.x += pos_in_line * m_bitmap_padded_size.x;
+        pt.y += line * m_bitmap_padded_size.y;
+    }
+
+    return wxRect(pt, m_bitmap_padded_size);
+}
+
+int wxRibbonGallery::HitTestItem(const wxPoint& pos) const
+{
+    if(m_items_per_line == 0)
+        return -1;
+
+    const wxPoint rel = pos - m_client_rect.GetPosition();
+    if(rel.x < 0 || rel.y < 0)
+        return -1;
+
+    int line, pos_in_line;
+    if(m_art && m_art->GetFlags() & wxRIBBON_BAR_FLOW_VERTICAL)
+    {
+        line = rel.x / m_bitmap_padded_size.x;
+        pos_in_line = rel.y / m_bitmap_padded_size.y;
+    }
+    else
+    {
+        line = rel.y / m_bitmap_padded_size.y;
+        pos_in_line = rel.x / m_bitmap_padded_size.x;
+    }
+
+    if(pos_in_line >= m_items_per_line)
+        return -1;
+
+    const unsigned int n = line * m_items_per_line + pos_in_line;
+    if(n >= GetCount())
+        return -1;
+
+    return n;
+}
+
+void wxRibbonGallery::GetVisibleItems(unsigned int* first,
+                                      unsigned int* last) const
+{
+    *first =
+    *last = 0;
+
+    if(m_items_per_line == 0)
+        return;
+
+    int line_size, visible_size;
+    if(m_art && m_art->GetFlags() & wxRIBBON_BAR_FLOW_VERTICAL)
+    {
+        line_size = m_bitmap_padded_size.x;
+        visible_size = m_client_rect.GetWidth();
+    }
+    else
+    {
+        line_size = m_bitmap_padded_size.y;
+        visible_size = m_client_rect.GetHeight();
+    }
+
+    const int first_line = m_scroll_amount / line_size;
+    const int last_line = (m_scroll_amount + visible_size - 1) / line_size;
+
+    *first = wxMin(first_line * m_items_per_line, GetCount());
+    *last = wxMin((last_line + 1) * m_items_per_line, GetCount());
+}
+
+wxBitmap wxRibbonGallery::OnGetItemBitmap(unsigned int WXUNUSED(n)) const
+{
+    wxFAIL_MSG( "must be overridden if SetVirtualItemCount() is used" );
+
+    return wxBitmap();
+}
+
+wxBitmap wxRibbonGallery::GetItemBitmap(unsigned int n)
+{
+    if(!m_virtual)
+        return m_items.Item(n)->GetBitmap();
+
+    std::unordered_map<unsigned int, wxBitmap>::const_iterator
+        it = m_bitmap_cache.find(n);
+    if(it != m_bitmap_cache.end())
+        return it->second;
+
+    const wxBitmap bitmap = OnGetItemBitmap(n);
+    wxASSERT(!bitmap.IsOk() || bitmap.GetLogicalSize() == m_bitmap_size);
+
+    m_bitmap_cache[n] = bitmap;
+    return bitmap;
+}
+
+void wxRibbonGallery::SetVirtualItemCount(unsigned int count,
+                                          const wxSize& bitmapSize)
+{
+    Clear();
+
+    m_virtual = true;
+
+    // Items are only created when they're needed, see GetItem().
+    m_items.SetCount(count);
+
+    if(m_bitmap_size != bitmapSize)
+    {
+        m_bitmap_size = bitmapSize;
+        CalculateMinSize();
+    }
+
+    Layout();
+    Refresh(false);
+}
+
+void wxRibbonGallery::RefreshItemBitmaps()
+{
+    m_bitmap_cache.clear();
+    Refresh(false);
+}
+
+int wxRibbonGallery::GetItemIndex(const wxRibbonGalleryItem* item) const
+{
+    if(item == nullptr)
+        return -1;
+
+    // Virtual items use their index as their ID.
+    if(m_virtual)
+        return item->GetId();
+
+    return m_items.Index(const_cast<wxRibbonGalleryItem*>(item));
+}
+
 bool wxRibbonGallery::IsHovered() const
 {
     return m_hovered;
@@ -503,23 +624,48 @@ void wxRibbonGallery::OnPaint(wxPaintEvent& WXUNUSED(evt))
     bool offset_vertical = true;
     if(m_art->GetFlags() & wxRIBBON_BAR_FLOW_VERTICAL)
         offset_vertical = false;
-    size_t item_count = m_items.Count();
-    size_t item_i;
-    for(item_i = 0; item_i < item_count; ++item_i)
+
+    // Only draw the items which are actually visible.
+    unsigned int first, last;
+    GetVisibleItems(&first, &last);
+
+    unsigned int item_i;
+    for(item_i = first; item_i < last; ++item_i)
     {
-        wxRibbonGalleryItem *item = m_items.Item(item_i);
-        if(!item->IsVisible())
-            continue;
+        wxRibbonGalleryItem *item = GetItem(item_i);
 
-        const wxRect& pos = item->GetPosition();
-        wxRect offset_pos(pos);
+        wxRect offset_pos = GetItemRect(item_i);
         if(offset_vertical)
             offset_pos.SetTop(offset_pos.GetTop() - m_scroll_amount);
         else
             offset_pos.SetLeft(offset_pos.GetLeft() - m_scroll_amount);
         m_art->DrawGalleryItemBackground(dc, this, offset_pos, item);
-        dc.DrawBitmap(item->GetBitmap(), offset_pos.GetLeft() + padding_left,
-            offset_pos.GetTop() + padding_top);
+
+        const wxBitmap bitmap = GetItemBitmap(item_i);
+        if(bitmap.IsOk())
+        {
+            dc.DrawBitmap(bitmap, offset_pos.GetLeft() + padding_left,
+                offset_pos.GetTop() + padding_top);
+        }
+    }
+
+    // Keep only the bitmaps of the items around the visible ones in the cache,
+    // so that scrolling by a page in either direction doesn't need to fetch
+    // them again.
+    if(m_virtual)
+    {
+        const unsigned int page = last - first;
+        const unsigned int keep_first = first > page ? first - page : 0;
+        const unsigned int keep_last = last + page;
+
+        for(std::unordered_map<unsigned int, wxBitmap>::iterator
+                it = m_bitmap_cache.begin(); it != m_bitmap_cache.end(); )
+        {
+            if(it->first < keep_first || it->first >= keep_last)
+                it = m_bitmap_cache.erase(it);
+            else
+                ++it;
+        }
     }
 }
 
@@ -530,6 +676,7 @@ void wxRibbonGallery::OnSize(wxSizeEvent& WXUNUSED(evt))
 
 wxRibbonGalleryItem* wxRibbonGallery::Append(const wxBitmap& bitmap, int id)
 {
+    wxCHECK_MSG(!m_virtual, nullptr, "can't append items to virtual gallery");
     wxASSERT(bitmap.IsOk());
     if(m_items.IsEmpty())
     {
@@ -574,6 +721,14 @@ void wxRibbonGallery::Clear()
         delete item;
     }
     m_items.Clear();
+    m_bitmap_cache.clear();
+    m_virtual = false;
+
+    m_selected_item = nullptr;
+    m_hovered_item = nullptr;
+    m_active_item = nullptr;
+    if(m_mouse_active_rect == &m_active_item_rect)
+        m_mouse_active_rect = nullptr;
 }
 
 bool wxRibbonGallery::IsSizingContinuous() const
@@ -624,52 +779,39 @@ bool wxRibbonGallery::Layout()
         &m_extension_button_rect);
     m_client_rect = wxRect(origin, client_size);
 
-    int x_cursor = 0;
-    int y_cursor = 0;
-
-    size_t item_count = m_items.Count();
-    size_t item_i;
-    long art_flags = m_art->GetFlags();
-    for(item_i = 0; item_i < item_count; ++item_i)
+    // All items have the same size, so their positions can be computed from
+    // their indices and we only need to determine how many of them fit into
+    // a single row (or column, for vertical galleries) and how many of those
+    // there are.
+    int line_length, line_size, item_size;
+    if(m_art->GetFlags() & wxRIBBON_BAR_FLOW_VERTICAL)
     {
-        wxRibbonGalleryItem *item = m_items.Item(item_i);
-        item->SetIsVisible(true);
-        if(art_flags & wxRIBBON_BAR_FLOW_VERTICAL)
-        {
-            if(y_cursor + m_bitmap_padded_size.y > client_size.GetHeight())
-            {
-                if(y_cursor == 0)
-                    break;
-                y_cursor = 0;
-                x_cursor += m_bitmap_padded_size.x;
-            }
-            item->SetPosition(origin.x + x_cursor, origin.y + y_cursor,
-                m_bitmap_padded_size);
-            y_cursor += m_bitmap_padded_size.y;
-        }
-        else
-        {
-            if(x_cursor + m_bitmap_padded_size.x > client_size.GetWidth())
-            {
-                if(x_cursor == 0)
-                    break;
-                x_cursor = 0;
-                y_cursor += m_bitmap_padded_size.y;
-            }
-            item->SetPosition(origin.x + x_cursor, origin.y + y_cursor,
-                m_bitmap_padded_size);
-            x_cursor += m_bitmap_padded_size.x;
-        }
+        line_length = client_size.GetHeight();
+        item_size = m_bitmap_padded_size.y;
+        line_size = m_bitmap_padded_size.x;
     }
-    for(; item_i < item_count; ++item_i)
+    else
     {
-        wxRibbonGalleryItem *item = m_items.Item(item_i);
-        item->SetIsVisible(false);
+        line_length = client_size.GetWidth();
+        item_size = m_bitmap_padded_size.x;
+        line_size = m_bitmap_padded_size.y;
+    }
+
+    m_items_per_line = item_size > 0 ? line_length / item_size : 0;
+    if(m_items_per_line < 0)
+        m_items_per_line = 0;
+
+    const int item_count = GetCount();
+    if(m_items_per_line == 0 || item_count == 0)
+    {
+        m_scroll_limit = 0;
     }
-    if(art_flags & wxRIBBON_BAR_FLOW_VERTICAL)
-        m_scroll_limit = x_cursor;
     else
-        m_scroll_limit = y_cursor;
+    {
+        // We can scroll until the start of the last line.
+        const int lines = (item_count + m_items_per_line - 1) / m_items_per_line;
+        m_scroll_limit = (lines - 1) * line_size;
+    }
     if(m_scroll_amount >= m_scroll_limit)
     {
         m_scroll_amount = m_scroll_limit;
@@ -817,7 +959,17 @@ wxRibbonGalleryItem* wxRibbonGallery::GetItem(unsigned int n)
 {
     if(n >= GetCount())
         return nullptr;
-    return m_items.Item(n);
+
+    wxRibbonGalleryItem* item = m_items.Item(n);
+    if(!item)
+    {
+        // Create virtual items on demand.
+        item = new wxRibbonGalleryItem;
+        item->SetId(n);
+        m_items[n] = item;
+    }
+
+    return item;
 }
 
 void wxRibbonGallery::SetSelection(wxRibbonGalleryItem* item)
@@ -33,6 +33,8 @@
 #include "wx/hashmap.h"
 #include "wx/dynarray.h"
 #include "wx/math.h"
+#include "wx/time.h"
+#include "wx/thread.h"
 
 #include "wx/richtext/richtextctrl.h"
 #include "wx/richtext/richtextstyles.h"
@@ -583,22 +585,22 @@ void wxRichTextObject::SetMargins(int leftMargin, int rightMargin, int topMargin
 
 int wxRichTextObject::GetLeftMargin() const
 {
-    return GetAttributes().GetTextBoxAttr().GetMargins().GetLeft().GetValue();
+    return GetSharedAttributes().GetTextBoxAttr().GetMargins().GetLeft().GetValue();
 }
 
 int wxRichTextObject::GetRightMargin() const
 {
-    return GetAttributes().GetTextBoxAttr().GetMargins().GetRight().GetValue();
+    return GetSharedAttributes().GetTextBoxAttr().GetMargins().GetRight().GetValue();
 }
 
 int wxRichTextObject::GetTopMargin() const
 {
-    return GetAttributes().GetTextBoxAttr().GetMargins().GetTop().GetValue();
+    return GetSharedAttributes().GetTextBoxAttr().GetMargins().GetTop().GetValue();
 }
 
 int wxRichTextObject::GetBottomMargin() const
 {
-    return GetAttributes().GetTextBoxAttr().GetMargins().GetBottom().GetValue();
+    return GetSharedAttributes().GetTextBoxAttr().GetMargins().GetBottom().GetValue();
 }
 
 // Calculate the available content space in the given rectangle, given the
@@ -607,7 +609,7 @@ wxRect wxRichTextObject::GetAvailableContentArea(wxDC& dc, wxRichTextDrawingCont
 {
     wxRect marginRect, borderRect, contentRect, paddingRect, outlineRect;
     marginRect = outerRect;
-    wxRichTextAttr attr(GetAttributes());
+    wxRichTextAttr attr(GetSharedAttributes());
     const_cast<wxRichTextObject*>(this)->AdjustAttributes(attr, context);
     GetBoxRects(dc, GetBuffer(), attr, marginRect, borderRect, contentRect, paddingRect, outlineRect);
     return contentRect;
@@ -751,11 +753,11 @@ bool wxRichTextObject::DrawBoxAttributes(wxDC& dc, wxRichTextBuffer* buffer, con
             if (obj)
             {
                 wxRichTextCompositeObject* composite = obj->GetParentContainer();
-                if (composite && composite->GetAttributes().HasBackgroundColour())
-                    bgColour = composite->GetAttributes().GetBackgroundColour();
+                if (composite && composite->GetSharedAttributes().HasBackgroundColour())
+                    bgColour = composite->GetSharedAttributes().GetBackgroundColour();
             }
             if (!bgColour.IsOk() && buffer)
-                bgColour = buffer->GetAttributes().GetBackgroundColour();
+                bgColour = buffer->GetSharedAttributes().GetBackgroundColour();
             if (!bgColour.IsOk())
                 bgColour = *wxWHITE;
             dc.SetBrush(wxBrush(bgColour));
@@ -1203,7 +1205,7 @@ void wxRichTextObject::Dump(wxTextOutputStream& stream)
 {
     stream << GetClassInfo()->GetClassName() << wxT("\n");
     stream << wxString::Format(wxT("Size: %d,%d. Position: %d,%d, Range: %ld,%ld"), m_size.x, m_size.y, m_pos.x, m_pos.y, m_range.GetStart(), m_range.GetEnd()) << wxT("\n");
-    stream << wxString::Format(wxT("Text colour: %d,%d,%d."), (int) m_attributes.GetTextColour().Red(), (int) m_attributes.GetTextColour().Green(), (int) m_attributes.GetTextColour().Blue()) << wxT("\n");
+    stream << wxString::Format(wxT("Text colour: %d,%d,%d."), (int) m_attributes.Get().GetTextColour().Red(), (int) m_attributes.Get().GetTextColour().Green(), (int) m_attributes.Get().GetTextColour().Blue()) << wxT("\n");
 }
 
 // Gets the containing buffer
@@ -1899,6 +1901,14 @@ void wxRichTextCompositeObject::Invalidate(const wxRichTextRange& invalidRange)
     }
 }
 
+void wxRichTextCompositeObject::ShareAttributes()
+{
+    wxRichTextObject::ShareAttributes();
+
+    for (wxRichTextObjectList::compatibility_iterator node = m_children.GetFirst(); node; node = node->GetNext())
+        node->GetData()->ShareAttributes();
+}
+
 // Move the object recursively, by adding the offset from old to new
 void wxRichTextCompositeObject::Move(const wxPoint& pt)
 {
@@ -1949,6 +1959,8 @@ void wxRichTextParagraphLayoutBox::Init()
     m_ownRange = wxRichTextRange(0, -1);
 
     m_invalidRange = wxRICHTEXT_ALL;
+    m_deferredLayoutStart = -1;
+    m_deferredRelayout = false;
 
     m_partialParagraph = false;
     m_floatCollector = nullptr;
@@ -1962,6 +1974,8 @@ void wxRichTextParagraphLayoutBox::Clear()
         delete m_floatCollector;
     m_floatCollector = nullptr;
     m_partialParagraph = false;
+    m_deferredLayoutStart = -1;
+    m_deferredRelayout = false;
 }
 
 /// Copy
@@ -2084,7 +2098,7 @@ bool wxRichTextParagraphLayoutBox::Draw(wxDC& dc, wxRichTextDrawingContext& cont
 
     wxRect thisRect(GetPosition(), GetCachedSize());
 
-    wxRichTextAttr attr(GetAttributes());
+    wxRichTextAttr attr(GetSharedAttributes());
     AdjustAttributes(attr, context);
 
     int flags = style;
@@ -2148,7 +2162,7 @@ bool wxRichTextParagraphLayoutBox::Layout(wxDC& dc, wxRichTextDrawingContext& co
     wxRect availableSpace;
     bool formatRect = (style & wxRICHTEXT_LAYOUT_SPECIFIED_RECT) == wxRICHTEXT_LAYOUT_SPECIFIED_RECT;
 
-    wxRichTextAttr attr(GetAttributes());
+    wxRichTextAttr attr(GetSharedAttributes());
     AdjustAttributes(attr, context);
 
     // If only laying out a specific area, the passed rect has a different meaning:
@@ -2212,15 +2226,58 @@ bool wxRichTextParagraphLayoutBox::Layout(wxDC& dc, wxRichTextDrawingContext& co
     // Get invalid range, rounding to paragraph start/end.
     wxRichTextRange invalidRange = GetInvalidRange(true);
 
-    if (invalidRange == wxRICHTEXT_NONE && !formatRect)
+    if (invalidRange == wxRICHTEXT_NONE && !formatRect && !HasDeferredLayout())
         return true;
 
+    // Take over the layout deferred by the previous incremental layout, if
+    // any: it will be deferred again below if we have to stop early again.
+    const long deferredStart = m_deferredLayoutStart;
+    const bool deferredRelayout = m_deferredRelayout;
+    m_deferredLayoutStart = -1;
+    m_deferredRelayout = false;
+
+    // Only the top-level container can be laid out incrementally, as the size
+    // of the nested ones must be known to lay out their parents.
+    const bool incremental = context.GetIncrementalLayout() && !GetParent() &&
+                                !formatRect && !hasVerticalAlignment;
+    const int incrementalBottom = context.GetIncrementalLayoutBottom();
+    const wxLongLong incrementalDeadline = context.GetIncrementalLayoutMaxMillis() > 0
+        ? wxGetLocalTimeMillis() + context.GetIncrementalLayoutMaxMillis()
+        : wxLongLong(0);
+
+    // Returns true if incremental layout must stop before this paragraph,
+    // which is going to be positioned at availableSpace.y. We never stop
+    // before the point where the previous layout stopped, to ensure that the
+    // out of date positions of the remaining paragraphs are all below the
+    // area which must be laid out, and so are never used for drawing it.
+    auto mustDeferLayout = [&](wxRichTextObject* obj)
+    {
+        if (!incremental)
+            return false;
+
+        if (deferredStart != -1 && obj->GetRange().GetStart() < deferredStart)
+            return false;
+
+        if (incrementalBottom != -1 && availableSpace.y > incrementalBottom &&
+                obj->GetPosition().y > incrementalBottom)
+            return true;
+
+        return incrementalDeadline != 0 && wxGetLocalTimeMillis() > incrementalDeadline;
+    };
+
+    // The first paragraph whose layout was deferred, if any.
+    wxRichTextObjectList::compatibility_iterator deferredNode;
+
+    long startPos = invalidRange.GetStart();
+    if (deferredStart != -1 && (invalidRange == wxRICHTEXT_NONE || deferredStart < startPos))
+        startPos = deferredStart;
+
     if (invalidRange == wxRICHTEXT_ALL || hasVerticalAlignment)
         layoutAll = true;
     else    // If we know what range is affected, start laying out from that point on.
-        if (invalidRange.GetStart() >= GetOwnRange().GetStart())
+        if (startPos >= GetOwnRange().GetStart())
     {
-        wxRichTextParagraph* firstParagraph = GetParagraphAtPosition(invalidRange.GetStart());
+        wxRichTextParagraph* firstParagraph = GetParagraphAtPosition(startPos);
         if (firstParagraph)
         {
             wxRichTextObjectList::compatibility_iterator firstNode = m_children.Find(firstParagraph);
@@ -2275,16 +2332,26 @@ bool wxRichTextParagraphLayoutBox::Layout(wxDC& dc, wxRichTextDrawingContext& co
 
         if (child && child->IsShown())
         {
+            if (mustDeferLayout(child))
+            {
+                m_deferredLayoutStart = child->GetRange().GetStart();
+                m_deferredRelayout = layoutAll || deferredRelayout ||
+                    (invalidRange != wxRICHTEXT_NONE && invalidRange.GetEnd() >= m_deferredLayoutStart);
+                deferredNode = node;
+                break;
+            }
+
             // TODO: what if the child hasn't been laid out (e.g. involved in Undo) but still has 'old' lines
             if ( !forceQuickLayout &&
                     (layoutAll ||
                         child->GetLines().empty() ||
-                            !child->GetRange().IsOutside(invalidRange)) )
+                            !child->GetRange().IsOutside(invalidRange) ||
+                                (deferredRelayout && child->GetRange().GetStart() >= deferredStart)) )
             {
                 // Lays out the object first with a given amount of space, and then if no width was specified in attr,
                 // lays out the object again using the minimum size
                 child->LayoutToBestSize(dc, context, GetBuffer(),
-                        attr, child->GetAttributes(), availableSpace, rect, style&~wxRICHTEXT_LAYOUT_SPECIFIED_RECT);
+                        attr, child->GetSharedAttributes(), availableSpace, rect, style&~wxRICHTEXT_LAYOUT_SPECIFIED_RECT);
 
                 // Layout must set the cached size
                 availableSpace.y += child->GetCachedSize().y;
@@ -2318,7 +2385,7 @@ bool wxRichTextParagraphLayoutBox::Layout(wxDC& dc, wxRichTextDrawingContext& co
                             child->SetImpactedByFloatingObjects(-1);
 
                             child->LayoutToBestSize(dc, context, GetBuffer(),
-                                attr, child->GetAttributes(), availableSpace, rect, style&~wxRICHTEXT_LAYOUT_SPECIFIED_RECT);
+                                attr, child->GetSharedAttributes(), availableSpace, rect, style&~wxRICHTEXT_LAYOUT_SPECIFIED_RECT);
 
                             availableSpace.y += child->GetCachedSize().y;
                             maxWidth = wxMax(maxWidth, child->GetCachedSize().x);
@@ -2351,14 +2418,30 @@ bool wxRichTextParagraphLayoutBox::Layout(wxDC& dc, wxRichTextDrawingContext& co
                     wxRichTextParagraph* nodeChild = wxDynamicCast(node->GetData(), wxRichTextParagraph);
                     if (nodeChild)
                     {
-                        if (nodeChild->GetLines().empty())
+                        if (mustDeferLayout(nodeChild))
+                        {
+                            m_deferredLayoutStart = nodeChild->GetRange().GetStart();
+                            m_deferredRelayout = deferredRelayout;
+                            deferredNode = node;
+                            break;
+                        }
+
+                        // The paragraphs whose layout was deferred were not
+                        // moved together with the preceding ones, so compute
+                        // the offset for each of them individually.
+                        const bool isDeferred = deferredStart != -1 &&
+                            nodeChild->GetRange().GetStart() >= deferredStart;
+                        if (isDeferred)
+                            inc = availableSpace.y - nodeChild->GetPosition().y;
+
+                        if (nodeChild->GetLines().empty() || (isDeferred && deferredRelayout))
                         {
                             nodeChild->SetImpactedByFloatingObjects(-1);
 
                             // Lays out the object first with a given amount of space, and then if no width was specified in attr,
                             // lays out the object again using the minimum size
                             nodeChild->LayoutToBestSize(dc, context, GetBuffer(),
-                                        attr, nodeChild->GetAttributes(), availableSpace, rect, style&~wxRICHTEXT_LAYOUT_SPECIFIED_RECT);
+                                        attr, nodeChild->GetSharedAttributes(), availableSpace, rect, style&~wxRICHTEXT_LAYOUT_SPECIFIED_RECT);
                         }
                         else
                         {
@@ -2382,13 +2465,33 @@ bool wxRichTextParagraphLayoutBox::Layout(wxDC& dc, wxRichTextDrawingContext& co
         node = node->GetNext();
     }
 
+    // The paragraphs whose layout was deferred keep their old sizes and will
+    // be moved by the same offset as the first of them, unless they need to
+    // be laid out again, so use this as an estimate of our size for now.
+    int deferredOffset = 0;
+    if (deferredNode)
+    {
+        deferredOffset = availableSpace.y - deferredNode->GetData()->GetPosition().y;
+
+        for (n = deferredNode; n; n = n->GetNext())
+        {
+            wxRichTextParagraph* child = wxDynamicCast(n->GetData(), wxRichTextParagraph);
+            if (child)
+            {
+                maxWidth = wxMax(maxWidth, child->GetCachedSize().x);
+                maxMinWidth = wxMax(maxMinWidth, child->GetMinSize().x);
+                maxMaxWidth = wxMax(maxMaxWidth, child->GetMaxSize().x);
+            }
+        }
+    }
+
     int maxContentHeight = 0;
 
     node = m_children.GetLast();
     if (node && node->GetData()->IsShown())
     {
         wxRichTextObject* child = node->GetData();
-        maxHeight = child->GetPosition().y - (GetPosition().y + topMargin) + child->GetCachedSize().y;
+        maxHeight = child->GetPosition().y + deferredOffset - (GetPosition().y + topMargin) + child->GetCachedSize().y;
         maxContentHeight = maxHeight;
     }
     else
@@ -2875,7 +2978,7 @@ bool wxRichTextParagraphLayoutBox::InsertFragment(long position, wxRichTextParag
     wxRichTextParagraph* para = GetParagraphAtPosition(position);
     if (para)
     {
-        wxRichTextAttr originalAttr = para->GetAttributes();
+        wxRichTextAttr originalAttr = para->GetSharedAttributes();
         wxRichTextProperties originalProperties = para->GetProperties();
 
         wxRichTextObjectList::compatibility_iterator node = m_children.Find(para);
@@ -2945,9 +3048,9 @@ bool wxRichTextParagraphLayoutBox::InsertFragment(long position, wxRichTextParag
             wxRichTextParagraph* firstPara = wxDynamicCast(firstParaNode->GetData(), wxRichTextParagraph);
             wxASSERT(firstPara != nullptr);
 
-            if (!(fragment.GetAttributes().GetFlags() & wxTEXT_ATTR_KEEP_FIRST_PARA_STYLE))
+            if (!(fragment.GetSharedAttributes().GetFlags() & wxTEXT_ATTR_KEEP_FIRST_PARA_STYLE))
             {
-                para->SetAttributes(firstPara->GetAttributes());
+                para->SetAttributes(firstPara->GetSharedAttributes());
                 para->SetProperties(firstPara->GetProperties());
             }
 
@@ -2959,7 +3062,7 @@ bool wxRichTextParagraphLayoutBox::InsertFragment(long position, wxRichTextParag
             wxRichTextObjectList::compatibility_iterator objectNode = firstPara->GetChildren().GetFirst();
 
             if (objectNode && firstPara->GetChildren().GetCount() == 1 && objectNode->GetData()->IsEmpty())
-                emptyParagraphAttributes = objectNode->GetData()->GetAttributes();
+                emptyParagraphAttributes = objectNode->GetData()->GetSharedAttributes();
 
             while (objectNode)
             {
@@ -3026,9 +3129,9 @@ bool wxRichTextParagraphLayoutBox::InsertFragment(long position, wxRichTextParag
                 }
             }
 
-            if ((fragment.GetAttributes().GetFlags() & wxTEXT_ATTR_KEEP_FIRST_PARA_STYLE) && firstPara)
+            if ((fragment.GetSharedAttributes().GetFlags() & wxTEXT_ATTR_KEEP_FIRST_PARA_STYLE) && firstPara)
             {
-                finalPara->SetAttributes(firstPara->GetAttributes());
+                finalPara->SetAttributes(firstPara->GetSharedAttributes());
                 finalPara->SetProperties(firstPara->GetProperties());
             }
             else if (finalPara && finalPara != para)
@@ -3256,7 +3359,7 @@ bool wxRichTextParagraphLayoutBox::DeleteRange(const wxRichTextRange& range)
                 obj->DeleteRange(range);
 
                 wxRichTextRange thisRange = obj->GetRange();
-                wxRichTextAttr thisAttr = obj->GetAttributes();
+                wxRichTextAttr thisAttr = obj->GetSharedAttributes();
 
                 // If the whole paragraph is within the range to delete,
                 // delete the whole thing.
@@ -3296,7 +3399,7 @@ bool wxRichTextParagraphLayoutBox::DeleteRange(const wxRichTextRange& range)
                         if (range.GetStart() == range.GetEnd() && range.GetStart() == thisRange.GetEnd())
                             nextParaAttr = thisAttr;
                         else
-                            nextParaAttr = nextParagraph->GetAttributes();
+                            nextParaAttr = nextParagraph->GetSharedAttributes();
                     }
 
                     if (firstPara && nextParagraph && firstPara != nextParagraph)
@@ -3559,7 +3662,7 @@ bool wxRichTextParagraphLayoutBox::SetStyle(const wxRichTextRange& range, const
                         wxRichTextRemoveStyle(newPara->GetAttributes(), style);
                     }
                     else if (resetExistingStyle)
-                        newPara->GetAttributes() = wholeStyle;
+                        newPara->SetAttributes(wholeStyle);
                     else
                     {
                         if (applyMinimal)
@@ -3641,10 +3744,10 @@ bool wxRichTextParagraphLayoutBox::SetStyle(const wxRichTextRange& range, const
                         {
                             // Preserve the URL as it's not really a formatting style but a property of the object
                             wxString url;
-                            if (child->GetAttributes().HasURL() && !characterAttributes.HasURL())
-                                url = child->GetAttributes().GetURL();
+                            if (child->GetSharedAttributes().HasURL() && !characterAttributes.HasURL())
+                                url = child->GetSharedAttributes().GetURL();
 
-                            child->GetAttributes() = characterAttributes;
+                            child->SetAttributes(characterAttributes);
 
                             if (!url.IsEmpty())
                                 child->GetAttributes().SetURL(url);
@@ -3655,7 +3758,7 @@ bool wxRichTextParagraphLayoutBox::SetStyle(const wxRichTextRange& range, const
                             {
                                 // Only apply attributes that will make a difference to the combined
                                 // style as seen on the display
-                                wxRichTextAttr combinedAttr(newPara->GetCombinedAttributes(child->GetAttributes(), true));
+                                wxRichTextAttr combinedAttr(newPara->GetCombinedAttributes(child->GetSharedAttributes(), true));
                                 wxRichTextApplyStyle(child->GetAttributes(), characterAttributes, & combinedAttr);
                             }
                             else
@@ -3690,7 +3793,7 @@ void wxRichTextParagraphLayoutBox::SetStyle(wxRichTextObject* obj, const wxRichT
     bool haveControl = (buffer->GetRichTextCtrl() != nullptr);
 
     wxRichTextAction *action = nullptr;
-    wxRichTextAttr newAttr = obj->GetAttributes();
+    wxRichTextAttr newAttr = obj->GetSharedAttributes();
     if (resetExistingStyle)
         newAttr = textAttr;
     else
@@ -3706,7 +3809,7 @@ void wxRichTextParagraphLayoutBox::SetStyle(wxRichTextObject* obj, const wxRichT
         action->GetAttributes() = newAttr;
     }
     else
-        obj->GetAttributes() = newAttr;
+        obj->SetAttributes(newAttr);
 
     if (haveControl && withUndo)
         buffer->SubmitAction(action);
@@ -3737,14 +3840,14 @@ bool wxRichTextParagraphLayoutBox::DoGetStyle(long position, wxRichTextAttr& sty
             if (combineStyles)
             {
                 // Start with the base style
-                style = GetAttributes();
+                style = GetSharedAttributes();
                 style.GetTextBoxAttr().Reset();
 
                 // Apply the paragraph style
-                wxRichTextApplyStyle(style, obj->GetAttributes());
+                wxRichTextApplyStyle(style, obj->GetSharedAttributes());
             }
             else
-                style = obj->GetAttributes();
+                style = obj->GetSharedAttributes();
 
             return true;
         }
@@ -3757,10 +3860,10 @@ bool wxRichTextParagraphLayoutBox::DoGetStyle(long position, wxRichTextAttr& sty
             if (combineStyles)
             {
                 wxRichTextParagraph* para = wxDynamicCast(obj->GetParent(), wxRichTextParagraph);
-                style = para ? para->GetCombinedAttributes(obj->GetAttributes()) : obj->GetAttributes();
+                style = para ? para->GetCombinedAttributes(obj->GetSharedAttributes()) : obj->GetSharedAttributes();
             }
             else
-                style = obj->GetAttributes();
+                style = obj->GetSharedAttributes();
 
             return true;
         }
@@ -3822,7 +3925,7 @@ bool wxRichTextParagraphLayoutBox::GetStyleForRange(const wxRichTextRange& range
                     wxRichTextObject* child = childNode->GetData();
                     if (!(child->GetRange().GetStart() > range.GetEnd() || child->GetRange().GetEnd() < range.GetStart()))
                     {
-                        wxRichTextAttr childStyle = para->GetCombinedAttributes(child->GetAttributes(), true /* include box attributes */);
+                        wxRichTextAttr childStyle = para->GetCombinedAttributes(child->GetSharedAttributes(), true /* include box attributes */);
 
                         // Now collect character attributes only
                         childStyle.SetFlags(childStyle.GetFlags() & wxTEXT_ATTR_CHARACTER);
@@ -3882,7 +3985,7 @@ bool wxRichTextParagraphLayoutBox::HasCharacterAttributes(const wxRichTextRange&
                     if (!childRange.IsOutside(range) && wxDynamicCast(child, wxRichTextPlainText))
                     {
                         foundCount ++;
-                        wxRichTextAttr textAttr = para->GetCombinedAttributes(child->GetAttributes());
+                        wxRichTextAttr textAttr = para->GetCombinedAttributes(child->GetSharedAttributes());
                         textAttr.SetFlags(textAttr.GetFlags() & ~wxTEXT_ATTR_PARAGRAPH);
 
                         if (textAttr.EqPartial(style, false /* strong test - attributes must be valid in both objects */))
@@ -3923,9 +4026,9 @@ bool wxRichTextParagraphLayoutBox::HasParagraphAttributes(const wxRichTextRange&
 
             if (!para->GetRange().IsOutside(range))
             {
-                wxRichTextAttr textAttr = GetAttributes();
+                wxRichTextAttr textAttr = GetSharedAttributes();
                 // Apply the paragraph style
-                wxRichTextApplyStyle(textAttr, para->GetAttributes());
+                wxRichTextApplyStyle(textAttr, para->GetSharedAttributes());
 
                 // These flags can mess up EqPartial because they don't represent existence of the attributes,
                 // only the attributes.
@@ -4155,6 +4258,20 @@ void wxRichTextParagraphLayoutBox::DoInvalidate(const wxRichTextRange& invalidRa
         if (invalidRange.GetEnd() > m_invalidRange.GetEnd())
             m_invalidRange.SetEnd(invalidRange.GetEnd());
     }
+
+    // The positions of the paragraphs following the invalid range may change,
+    // so conservatively extend the deferred part of the layout to include all
+    // of them, as we can't know by how much the deferred start has shifted.
+    if (HasDeferredLayout() && invalidRange != wxRICHTEXT_NONE)
+    {
+        if (invalidRange == wxRICHTEXT_ALL)
+        {
+            m_deferredLayoutStart = -1;
+            m_deferredRelayout = false;
+        }
+        else if (invalidRange.GetStart() < m_deferredLayoutStart)
+            m_deferredLayoutStart = wxMax(invalidRange.GetStart(), GetOwnRange().GetStart());
+    }
 }
 
 // Do the (in)validation both up and down the hierarchy
@@ -4251,26 +4368,26 @@ bool wxRichTextParagraphLayoutBox::ApplyStyleSheet(wxRichTextStyleSheet* styleSh
 
             int outline = -1;
             int num = -1;
-            if (para->GetAttributes().HasOutlineLevel())
-                outline = para->GetAttributes().GetOutlineLevel();
-            if (para->GetAttributes().HasBulletNumber())
-                num = para->GetAttributes().GetBulletNumber();
+            if (para->GetSharedAttributes().HasOutlineLevel())
+                outline = para->GetSharedAttributes().GetOutlineLevel();
+            if (para->GetSharedAttributes().HasBulletNumber())
+                num = para->GetSharedAttributes().GetBulletNumber();
 
-            if (!para->GetAttributes().GetParagraphStyleName().IsEmpty() && !para->GetAttributes().GetListStyleName().IsEmpty())
+            if (!para->GetSharedAttributes().GetParagraphStyleName().IsEmpty() && !para->GetSharedAttributes().GetListStyleName().IsEmpty())
             {
-                int currentIndent = para->GetAttributes().GetLeftIndent();
+                int currentIndent = para->GetSharedAttributes().GetLeftIndent();
 
-                wxRichTextParagraphStyleDefinition* paraDef = styleSheet->FindParagraphStyle(para->GetAttributes().GetParagraphStyleName());
-                wxRichTextListStyleDefinition* listDef = styleSheet->FindListStyle(para->GetAttributes().GetListStyleName());
+                wxRichTextParagraphStyleDefinition* paraDef = styleSheet->FindParagraphStyle(para->GetSharedAttributes().GetParagraphStyleName());
+                wxRichTextListStyleDefinition* listDef = styleSheet->FindListStyle(para->GetSharedAttributes().GetListStyleName());
                 if (paraDef && !listDef)
                 {
-                    para->GetAttributes() = paraDef->GetStyleMergedWithBase(styleSheet);
+                    para->SetAttributes(paraDef->GetStyleMergedWithBase(styleSheet));
                     foundCount ++;
                 }
                 else if (listDef && !paraDef)
                 {
                     // Set overall style defined for the list style definition
-                    para->GetAttributes() = listDef->GetStyleMergedWithBase(styleSheet);
+                    para->SetAttributes(listDef->GetStyleMergedWithBase(styleSheet));
 
                     // Apply the style for this level
                     wxRichTextApplyStyle(para->GetAttributes(), * listDef->GetLevelAttributes(listDef->FindLevelForIndent(currentIndent)));
@@ -4279,30 +4396,30 @@ bool wxRichTextParagraphLayoutBox::ApplyStyleSheet(wxRichTextStyleSheet* styleSh
                 else if (listDef && paraDef)
                 {
                     // Combines overall list style, style for level, and paragraph style
-                    para->GetAttributes() = listDef->CombineWithParagraphStyle(currentIndent, paraDef->GetStyleMergedWithBase(styleSheet));
+                    para->SetAttributes(listDef->CombineWithParagraphStyle(currentIndent, paraDef->GetStyleMergedWithBase(styleSheet)));
                     foundCount ++;
                 }
             }
-            else if (para->GetAttributes().GetParagraphStyleName().IsEmpty() && !para->GetAttributes().GetListStyleName().IsEmpty())
+            else if (para->GetSharedAttributes().GetParagraphStyleName().IsEmpty() && !para->GetSharedAttributes().GetListStyleName().IsEmpty())
             {
-                int currentIndent = para->GetAttributes().GetLeftIndent();
+                int currentIndent = para->GetSharedAttributes().GetLeftIndent();
 
-                wxRichTextListStyleDefinition* listDef = styleSheet->FindListStyle(para->GetAttributes().GetListStyleName());
+                wxRichTextListStyleDefinition* listDef = styleSheet->FindListStyle(para->GetSharedAttributes().GetListStyleName());
 
                 // Overall list definition style
-                para->GetAttributes() = listDef->GetStyleMergedWithBase(styleSheet);
+                para->SetAttributes(listDef->GetStyleMergedWithBase(styleSheet));
 
                 // Style for this level
                 wxRichTextApplyStyle(para->GetAttributes(), * listDef->GetLevelAttributes(listDef->FindLevelForIndent(currentIndent)));
 
                 foundCount ++;
             }
-            else if (!para->GetAttributes().GetParagraphStyleName().IsEmpty() && para->GetAttributes().GetListStyleName().IsEmpty())
+            else if (!para->GetSharedAttributes().GetParagraphStyleName().IsEmpty() && para->GetSharedAttributes().GetListStyleName().IsEmpty())
             {
-                wxRichTextParagraphStyleDefinition* def = styleSheet->FindParagraphStyle(para->GetAttributes().GetParagraphStyleName());
+                wxRichTextParagraphStyleDefinition* def = styleSheet->FindParagraphStyle(para->GetSharedAttributes().GetParagraphStyleName());
                 if (def)
                 {
-                    para->GetAttributes() = def->GetStyleMergedWithBase(styleSheet);
+                    para->SetAttributes(def->GetStyleMergedWithBase(styleSheet));
                     foundCount ++;
                 }
             }
@@ -4379,7 +4496,7 @@ bool wxRichTextParagraphLayoutBox::SetListStyle(const wxRichTextRange& range, wx
 
                 if (def)
                 {
-                    int thisIndent = newPara->GetAttributes().GetLeftIndent();
+                    int thisIndent = newPara->GetSharedAttributes().GetLeftIndent();
                     int thisLevel = specifyLevel ? specifiedLevel : def->FindLevelForIndent(thisIndent);
 
                     // How is numbering going to work?
@@ -4396,7 +4513,7 @@ bool wxRichTextParagraphLayoutBox::SetListStyle(const wxRichTextRange& range, wx
 
                     // Now we need to do numbering
                     // Preserve the existing list item continuation bullet style, if any
-                    if (para->GetAttributes().HasBulletStyle() && (para->GetAttributes().GetBulletStyle() & wxTEXT_ATTR_BULLET_STYLE_CONTINUATION))
+                    if (para->GetSharedAttributes().HasBulletStyle() && (para->GetSharedAttributes().GetBulletStyle() & wxTEXT_ATTR_BULLET_STYLE_CONTINUATION))
                         newPara->GetAttributes().SetBulletStyle(newPara->GetAttributes().GetBulletStyle()|wxTEXT_ATTR_BULLET_STYLE_CONTINUATION);
                     else
                     {
@@ -4408,7 +4525,7 @@ bool wxRichTextParagraphLayoutBox::SetListStyle(const wxRichTextRange& range, wx
                         n ++;
                     }
                 }
-                else if (!newPara->GetAttributes().GetListStyleName().IsEmpty())
+                else if (!newPara->GetSharedAttributes().GetListStyleName().IsEmpty())
                 {
                     // if def is null, remove list style, applying any associated paragraph style
                     // to restore the attributes
@@ -4421,12 +4538,12 @@ bool wxRichTextParagraphLayoutBox::SetListStyle(const wxRichTextRange& range, wx
                     // Eliminate the main list-related attributes
                     newPara->GetAttributes().SetFlags(newPara->GetAttributes().GetFlags() & ~wxTEXT_ATTR_LEFT_INDENT & ~wxTEXT_ATTR_BULLET_STYLE & ~wxTEXT_ATTR_BULLET_NUMBER & ~wxTEXT_ATTR_BULLET_TEXT & wxTEXT_ATTR_LIST_STYLE_NAME);
 
-                    if (styleSheet && !newPara->GetAttributes().GetParagraphStyleName().IsEmpty())
+                    if (styleSheet && !newPara->GetSharedAttributes().GetParagraphStyleName().IsEmpty())
                     {
-                        wxRichTextParagraphStyleDefinition* newParaDef = styleSheet->FindParagraphStyle(newPara->GetAttributes().GetParagraphStyleName());
+                        wxRichTextParagraphStyleDefinition* newParaDef = styleSheet->FindParagraphStyle(newPara->GetSharedAttributes().GetParagraphStyleName());
                         if (newParaDef)
                         {
-                            newPara->GetAttributes() = newParaDef->GetStyleMergedWithBase(styleSheet);
+                            newPara->SetAttributes(newParaDef->GetStyleMergedWithBase(styleSheet));
                         }
                     }
                 }
@@ -4553,13 +4670,13 @@ bool wxRichTextParagraphLayoutBox::DoNumberList(const wxRichTextRange& range, co
                 wxRichTextListStyleDefinition* defToUse = def;
                 if (!defToUse)
                 {
-                    if (styleSheet && !newPara->GetAttributes().GetListStyleName().IsEmpty())
-                        defToUse = styleSheet->FindListStyle(newPara->GetAttributes().GetListStyleName());
+                    if (styleSheet && !newPara->GetSharedAttributes().GetListStyleName().IsEmpty())
+                        defToUse = styleSheet->FindListStyle(newPara->GetSharedAttributes().GetListStyleName());
                 }
 
                 if (defToUse)
                 {
-                    int thisIndent = newPara->GetAttributes().GetLeftIndent();
+                    int thisIndent = newPara->GetSharedAttributes().GetLeftIndent();
                     int thisLevel = defToUse->FindLevelForIndent(thisIndent);
 
                     // If we've specified a level to apply to all, change the level.
@@ -4581,7 +4698,7 @@ bool wxRichTextParagraphLayoutBox::DoNumberList(const wxRichTextRange& range, co
                     wxRichTextApplyStyle(newPara->GetAttributes(), listStyle);
 
                     // Preserve the existing list item continuation bullet style, if any
-                    if (para->GetAttributes().HasBulletStyle() && (para->GetAttributes().GetBulletStyle() & wxTEXT_ATTR_BULLET_STYLE_CONTINUATION))
+                    if (para->GetSharedAttributes().HasBulletStyle() && (para->GetSharedAttributes().GetBulletStyle() & wxTEXT_ATTR_BULLET_STYLE_CONTINUATION))
                         newPara->GetAttributes().SetBulletStyle(newPara->GetAttributes().GetBulletStyle()|wxTEXT_ATTR_BULLET_STYLE_CONTINUATION);
 
                     // OK, we've (re)applied the style, now let's get the numbering right.
@@ -4610,14 +4727,14 @@ bool wxRichTextParagraphLayoutBox::DoNumberList(const wxRichTextRange& range, co
                     // Use the current numbering if -1 and we have a bullet number already
                     if (levels[currentLevel] == -1)
                     {
-                        if (newPara->GetAttributes().HasBulletNumber())
-                            levels[currentLevel] = newPara->GetAttributes().GetBulletNumber();
+                        if (newPara->GetSharedAttributes().HasBulletNumber())
+                            levels[currentLevel] = newPara->GetSharedAttributes().GetBulletNumber();
                         else
                             levels[currentLevel] = 1;
                     }
                     else
                     {
-                        if (!(para->GetAttributes().HasBulletStyle() && (para->GetAttributes().GetBulletStyle() & wxTEXT_ATTR_BULLET_STYLE_CONTINUATION)))
+                        if (!(para->GetSharedAttributes().HasBulletStyle() && (para->GetSharedAttributes().GetBulletStyle() & wxTEXT_ATTR_BULLET_STYLE_CONTINUATION)))
                             levels[currentLevel] ++;
                     }
 
@@ -4699,7 +4816,7 @@ bool wxRichTextParagraphLayoutBox::FindNextParagraphNumber(wxRichTextParagraph*
 {
     // TODO: add GetNextChild/GetPreviousChild to composite
     // Search for a paragraph that isn't a continuation paragraph (no bullet)
-    while (previousParagraph && previousParagraph->GetAttributes().HasBulletStyle() && previousParagraph->GetAttributes().GetBulletStyle() & wxTEXT_ATTR_BULLET_STYLE_CONTINUATION)
+    while (previousParagraph && previousParagraph->GetSharedAttributes().HasBulletStyle() && previousParagraph->GetSharedAttributes().GetBulletStyle() & wxTEXT_ATTR_BULLET_STYLE_CONTINUATION)
     {
         wxRichTextObjectList::compatibility_iterator node = ((wxRichTextCompositeObject*) previousParagraph->GetParent())->GetChildren().Find(previousParagraph);
         if (node)
@@ -4714,33 +4831,33 @@ bool wxRichTextParagraphLayoutBox::FindNextParagraphNumber(wxRichTextParagraph*
             previousParagraph = nullptr;
     }
 
-    if (!previousParagraph || !previousParagraph->GetAttributes().HasFlag(wxTEXT_ATTR_BULLET_STYLE) || previousParagraph->GetAttributes().GetBulletStyle() == wxTEXT_ATTR_BULLET_STYLE_NONE)
+    if (!previousParagraph || !previousParagraph->GetSharedAttributes().HasFlag(wxTEXT_ATTR_BULLET_STYLE) || previousParagraph->GetSharedAttributes().GetBulletStyle() == wxTEXT_ATTR_BULLET_STYLE_NONE)
         return false;
 
     wxRichTextBuffer* buffer = GetBuffer();
     wxRichTextStyleSheet* styleSheet = buffer->GetStyleSheet();
-    if (styleSheet && !previousParagraph->GetAttributes().GetListStyleName().IsEmpty())
+    if (styleSheet && !previousParagraph->GetSharedAttributes().GetListStyleName().IsEmpty())
     {
-        wxRichTextListStyleDefinition* def = styleSheet->FindListStyle(previousParagraph->GetAttributes().GetListStyleName());
+        wxRichTextListStyleDefinition* def = styleSheet->FindListStyle(previousParagraph->GetSharedAttributes().GetListStyleName());
         if (def)
         {
             // int thisIndent = previousParagraph->GetAttributes().GetLeftIndent();
             // int thisLevel = def->FindLevelForIndent(thisIndent);
 
-            bool isOutline = (previousParagraph->GetAttributes().GetBulletStyle() & wxTEXT_ATTR_BULLET_STYLE_OUTLINE) != 0;
+            bool isOutline = (previousParagraph->GetSharedAttributes().GetBulletStyle() & wxTEXT_ATTR_BULLET_STYLE_OUTLINE) != 0;
 
-            attr.SetFlags(previousParagraph->GetAttributes().GetFlags() & (wxTEXT_ATTR_BULLET_STYLE|wxTEXT_ATTR_BULLET_NUMBER|wxTEXT_ATTR_BULLET_TEXT|wxTEXT_ATTR_BULLET_NAME));
-            if (previousParagraph->GetAttributes().HasBulletName())
-                attr.SetBulletName(previousParagraph->GetAttributes().GetBulletName());
-            attr.SetBulletStyle(previousParagraph->GetAttributes().GetBulletStyle());
-            attr.SetListStyleName(previousParagraph->GetAttributes().GetListStyleName());
+            attr.SetFlags(previousParagraph->GetSharedAttributes().GetFlags() & (wxTEXT_ATTR_BULLET_STYLE|wxTEXT_ATTR_BULLET_NUMBER|wxTEXT_ATTR_BULLET_TEXT|wxTEXT_ATTR_BULLET_NAME));
+            if (previousParagraph->GetSharedAttributes().HasBulletName())
+                attr.SetBulletName(previousParagraph->GetSharedAttributes().GetBulletName());
+            attr.SetBulletStyle(previousParagraph->GetSharedAttributes().GetBulletStyle());
+            attr.SetListStyleName(previousParagraph->GetSharedAttributes().GetListStyleName());
 
-            int nextNumber = previousParagraph->GetAttributes().GetBulletNumber() + 1;
+            int nextNumber = previousParagraph->GetSharedAttributes().GetBulletNumber() + 1;
             attr.SetBulletNumber(nextNumber);
 
             if (isOutline)
             {
-                wxString text = previousParagraph->GetAttributes().GetBulletText();
+                wxString text = previousParagraph->GetSharedAttributes().GetBulletText();
                 if (!text.IsEmpty())
                 {
                     int pos = text.Find(wxT('.'), true);
@@ -5151,7 +5268,7 @@ bool wxRichTextParagraph::Layout(wxDC& dc, wxRichTextDrawingContext& context, co
             // The position will be determined by its location in its line,
             // and not by the child's actual position.
             child->LayoutToBestSize(dc, context, buffer,
-                    attr, child->GetAttributes(), availableRect, parentRect, style);
+                    attr, child->GetSharedAttributes(), availableRect, parentRect, style);
 
             if (oldSize != child->GetCachedSize())
             {
@@ -5240,7 +5357,7 @@ bool wxRichTextParagraph::Layout(wxDC& dc, wxRichTextDrawingContext& context, co
                     // lays out the object again using the minimum size
                     child->Invalidate(wxRICHTEXT_ALL);
                     child->LayoutToBestSize(dc, context, buffer,
-                                attr, child->GetAttributes(), availableRect, parentRect.GetSize(), style);
+                                attr, child->GetSharedAttributes(), availableRect, parentRect.GetSize(), style);
                     childSize = child->GetCachedSize();
                     childDescent = child->GetDescent();
 
@@ -5975,7 +6092,7 @@ bool wxRichTextParagraph::FindPosition(wxDC& dc, wxRichTextDrawingContext& conte
         else
         {
             *height = dc.GetCharHeight();
-            int indent = ConvertTenthsMMToPixels(dc, m_attributes.GetLeftIndent());
+            int indent = ConvertTenthsMMToPixels(dc, m_attributes.Get().GetLeftIndent());
             pt = wxPoint(indent, GetCachedSize().y);
         }
 
@@ -6467,61 +6584,61 @@ bool wxRichTextParagraph::FindWrapPosition(const wxRichTextRange& range, wxDC& d
 /// Get the bullet text for this paragraph.
 wxString wxRichTextParagraph::GetBulletText()
 {
-    if (GetAttributes().GetBulletStyle() == wxTEXT_ATTR_BULLET_STYLE_NONE ||
-        (GetAttributes().GetBulletStyle() & wxTEXT_ATTR_BULLET_STYLE_BITMAP))
+    if (GetSharedAttributes().GetBulletStyle() == wxTEXT_ATTR_BULLET_STYLE_NONE ||
+        (GetSharedAttributes().GetBulletStyle() & wxTEXT_ATTR_BULLET_STYLE_BITMAP))
         return wxEmptyString;
 
-    int number = GetAttributes().GetBulletNumber();
+    int number = GetSharedAttributes().GetBulletNumber();
 
     wxString text;
-    if ((GetAttributes().GetBulletStyle() & wxTEXT_ATTR_BULLET_STYLE_ARABIC) || (GetAttributes().GetBulletStyle() & wxTEXT_ATTR_BULLET_STYLE_OUTLINE))
+    if ((GetSharedAttributes().GetBulletStyle() & wxTEXT_ATTR_BULLET_STYLE_ARABIC) || (GetSharedAttributes().GetBulletStyle() & wxTEXT_ATTR_BULLET_STYLE_OUTLINE))
     {
         text.Printf(wxT("%d"), number);
     }
-    else if (GetAttributes().GetBulletStyle() & wxTEXT_ATTR_BULLET_STYLE_LETTERS_UPPER)
+    else if (GetSharedAttributes().GetBulletStyle() & wxTEXT_ATTR_BULLET_STYLE_LETTERS_UPPER)
     {
         // TODO: Unicode, and also check if number > 26
         text.Printf(wxT("%c"), (wxChar) (number+64));
     }
-    else if (GetAttributes().GetBulletStyle() & wxTEXT_ATTR_BULLET_STYLE_LETTERS_LOWER)
+    else if (GetSharedAttributes().GetBulletStyle() & wxTEXT_ATTR_BULLET_STYLE_LETTERS_LOWER)
     {
         // TODO: Unicode, and also check if number > 26
         text.Printf(wxT("%c"), (wxChar) (number+96));
     }
-    else if (GetAttributes().GetBulletStyle() & wxTEXT_ATTR_BULLET_STYLE_ROMAN_UPPER)
+    else if (GetSharedAttributes().GetBulletStyle() & wxTEXT_ATTR_BULLET_STYLE_ROMAN_UPPER)
     {
         text = wxRichTextDecimalToRoman(number);
     }
-    else if (GetAttributes().GetBulletStyle() & wxTEXT_ATTR_BULLET_STYLE_ROMAN_LOWER)
+    else if (GetSharedAttributes().GetBulletStyle() & wxTEXT_ATTR_BULLET_STYLE_ROMAN_LOWER)
     {
         text = wxRichTextDecimalToRoman(number);
         text.MakeLower();
     }
-    else if (GetAttributes().GetBulletStyle() & wxTEXT_ATTR_BULLET_STYLE_SYMBOL)
+    else if (GetSharedAttributes().GetBulletStyle() & wxTEXT_ATTR_BULLET_STYLE_SYMBOL)
     {
-        text = GetAttributes().GetBulletText();
+        text = GetSharedAttributes().GetBulletText();
     }
 
-    if (GetAttributes().GetBulletStyle() & wxTEXT_ATTR_BULLET_STYLE_OUTLINE)
+    if (GetSharedAttributes().GetBulletStyle() & wxTEXT_ATTR_BULLET_STYLE_OUTLINE)
     {
         // The outline style relies on the text being computed statically,
         // since it depends on other levels points (e.g. 1.2.1.1). So normally the bullet text
         // should be stored in the attributes; if not, just use the number for this
         // level, as previously computed.
-        if (!GetAttributes().GetBulletText().IsEmpty())
-            text = GetAttributes().GetBulletText();
+        if (!GetSharedAttributes().GetBulletText().IsEmpty())
+            text = GetSharedAttributes().GetBulletText();
     }
 
-    if (GetAttributes().GetBulletStyle() & wxTEXT_ATTR_BULLET_STYLE_PARENTHESES)
+    if (GetSharedAttributes().GetBulletStyle() & wxTEXT_ATTR_BULLET_STYLE_PARENTHESES)
     {
         text = wxT("(") + text + wxT(")");
     }
-    else if (GetAttributes().GetBulletStyle() & wxTEXT_ATTR_BULLET_STYLE_RIGHT_PARENTHESIS)
+    else if (GetSharedAttributes().GetBulletStyle() & wxTEXT_ATTR_BULLET_STYLE_RIGHT_PARENTHESIS)
     {
         text = text + wxT(")");
     }
 
-    if (GetAttributes().GetBulletStyle() & wxTEXT_ATTR_BULLET_STYLE_PERIOD)
+    if (GetSharedAttributes().GetBulletStyle() & wxTEXT_ATTR_BULLET_STYLE_PERIOD)
     {
         text += wxT(".");
     }
@@ -6582,10 +6699,10 @@ wxRichTextAttr wxRichTextParagraph::GetCombinedAttributes(const wxRichTextAttr&
                 attr.SetFlags(attr.GetFlags() & ~wxTEXT_ATTR_BACKGROUND_COLOUR);
             }
         }
-        wxRichTextApplyStyle(attr, GetAttributes());
+        wxRichTextApplyStyle(attr, GetSharedAttributes());
     }
     else
-        attr = GetAttributes();
+        attr = GetSharedAttributes();
 
     wxRichTextApplyStyle(attr, contentStyle);
     return attr;
@@ -6608,10 +6725,10 @@ wxRichTextAttr wxRichTextParagraph::GetCombinedAttributes(bool includingBoxAttr)
                 attr.SetFlags(attr.GetFlags() & ~wxTEXT_ATTR_BACKGROUND_COLOUR);
             }
         }
-        wxRichTextApplyStyle(attr, GetAttributes());
+        wxRichTextApplyStyle(attr, GetSharedAttributes());
     }
     else
-        attr = GetAttributes();
+        attr = GetSharedAttributes();
 
     return attr;
 }
@@ -6643,14 +6760,14 @@ void wxRichTextParagraph::LayoutFloat(wxDC& dc, wxRichTextDrawingContext& contex
         if (anchored && anchored->IsFloating() && !floatCollector->HasFloat(anchored))
         {
             int x = 0;
-            wxRichTextAttr parentAttr(GetAttributes());
+            wxRichTextAttr parentAttr(GetSharedAttributes());
             AdjustAttributes(parentAttr, context);
 #if 1
             // 27-09-2012
             wxRect availableSpace = GetParent()->GetAvailableContentArea(dc, context, rect);
 
             anchored->LayoutToBestSize(dc, context, GetBuffer(),
-                parentAttr, anchored->GetAttributes(),
+                parentAttr, anchored->GetSharedAttributes(),
                 parentRect, availableSpace,
                 style);
             wxSize size = anchored->GetCachedSize();
@@ -6661,10 +6778,10 @@ void wxRichTextParagraph::LayoutFloat(wxDC& dc, wxRichTextDrawingContext& contex
 #endif
 
             int offsetY = 0;
-            if (anchored->GetAttributes().GetTextBoxAttr().GetTop().IsValid())
-                offsetY = converter.GetPixels(anchored->GetAttributes().GetTextBoxAttr().GetTop(), wxVERTICAL);
+            if (anchored->GetSharedAttributes().GetTextBoxAttr().GetTop().IsValid())
+                offsetY = converter.GetPixels(anchored->GetSharedAttributes().GetTextBoxAttr().GetTop(), wxVERTICAL);
 
-            int pos = floatCollector->GetFitPosition(anchored->GetAttributes().GetTextBoxAttr().GetFloatMode(), rect.y + offsetY, size.y);
+            int pos = floatCollector->GetFitPosition(anchored->GetSharedAttributes().GetTextBoxAttr().GetFloatMode(), rect.y + offsetY, size.y);
 
             // I can't remember why we tried to update the top offset here, but anyhow it results in
             // a wrong position being computed, so don't.
@@ -6685,9 +6802,9 @@ void wxRichTextParagraph::LayoutFloat(wxDC& dc, wxRichTextDrawingContext& contex
                 }
             }
 #endif
-            if (anchored->GetAttributes().GetTextBoxAttr().GetFloatMode() == wxTEXT_BOX_ATTR_FLOAT_LEFT)
+            if (anchored->GetSharedAttributes().GetTextBoxAttr().GetFloatMode() == wxTEXT_BOX_ATTR_FLOAT_LEFT)
                 x = rect.x;
-            else if (anchored->GetAttributes().GetTextBoxAttr().GetFloatMode() == wxTEXT_BOX_ATTR_FLOAT_RIGHT)
+            else if (anchored->GetSharedAttributes().GetTextBoxAttr().GetFloatMode() == wxTEXT_BOX_ATTR_FLOAT_RIGHT)
                 x = rect.x + rect.width - size.x;
 
             //anchored->SetPosition(wxPoint(x, pos));
@@ -6783,7 +6900,126 @@ wxRichTextPlainText::wxRichTextPlainText(const wxString& text, wxRichTextObject*
     if (style)
         SetAttributes(*style);
 
-    m_text = text;
+    m_length = 0;
+    SetText(text);
+}
+
+// The maximal number of pieces the text is stored in before joining them.
+static const size_t wxRICHTEXT_MAX_TEXT_PIECES = 64;
+
+const wxString& wxRichTextPlainText::GetText() const
+{
+    static const wxString s_emptyText;
+    if (m_pieces.empty())
+        return s_emptyText;
+
+    const Piece& first = m_pieces[0];
+    if (m_pieces.size() != 1 || first.start != 0 || first.length != first.buffer->length())
+    {
+        std::shared_ptr<wxString> buffer = std::make_shared<wxString>();
+        buffer->reserve(m_length);
+        for (const auto& piece : m_pieces)
+            buffer->append(*piece.buffer, piece.start, piece.length);
+
+        m_pieces.assign(1, Piece(buffer, 0, m_length));
+    }
+
+    return *m_pieces[0].buffer;
+}
+
+void wxRichTextPlainText::SetText(const wxString& text)
+{
+    m_pieces.clear();
+    m_length = text.length();
+    if (m_length)
+        m_pieces.push_back(Piece(std::make_shared<const wxString>(text), 0, m_length));
+}
+
+wxString wxRichTextPlainText::DoGetText(size_t start, size_t length) const
+{
+    wxString text;
+    for (const auto& piece : m_pieces)
+    {
+        if (length == 0)
+            break;
+
+        if (start >= piece.length)
+        {
+            start -= piece.length;
+            continue;
+        }
+
+        const size_t count = wxMin(length, piece.length - start);
+        text.append(*piece.buffer, piece.start + start, count);
+        length -= count;
+        start = 0;
+    }
+
+    return text;
+}
+
+void wxRichTextPlainText::DoSplitPieces(size_t index, std::vector<Piece>& tail)
+{
+    tail.clear();
+
+    size_t offset = 0;
+    for (size_t n = 0; n < m_pieces.size(); n++)
+    {
+        Piece& piece = m_pieces[n];
+        if (index < offset + piece.length)
+        {
+            size_t first = n;
+            if (index > offset)
+            {
+                // Split this piece in two, both parts still using its buffer.
+                const size_t headLength = index - offset;
+                tail.push_back(Piece(piece.buffer, piece.start + headLength, piece.length - headLength));
+                piece.length = headLength;
+                first++;
+            }
+
+            tail.insert(tail.end(), m_pieces.begin() + first, m_pieces.end());
+            m_pieces.erase(m_pieces.begin() + first, m_pieces.end());
+            break;
+        }
+
+        offset += piece.length;
+    }
+
+    size_t tailLength = 0;
+    for (const auto& piece : tail)
+        tailLength += piece.length;
+
+    m_length -= tailLength;
+}
+
+void wxRichTextPlainText::DoAppendPieces(const std::vector<Piece>& pieces)
+{
+    for (const auto& piece : pieces)
+    {
+        if (!piece.length)
+            continue;
+
+        m_length += piece.length;
+
+        // Undo the previous split of the same buffer if possible.
+        if (!m_pieces.empty())
+        {
+            Piece& last = m_pieces.back();
+            if (last.buffer == piece.buffer && last.start + last.length == piece.start)
+            {
+                last.length += piece.length;
+                continue;
+            }
+        }
+
+        m_pieces.push_back(piece);
+    }
+
+    // Don't let the number of pieces grow indefinitely, as this would make
+    // working with them slower.
+    if (m_pieces.size() > wxRICHTEXT_MAX_TEXT_PIECES)
+        GetText();
 }
 
 #define USE_KERNING_FIX 1
@@ -6797,7 +7033,7 @@ bool wxRichTextPlainText::Draw(wxDC& dc, wxRichTextDrawingContext& context, cons
     wxRichTextParagraph* para = wxDynamicCast(GetParent(), wxRichTextParagraph);
     wxASSERT (para != nullptr);
 
-    wxRichTextAttr textAttr(para ? para->GetCombinedAttributes(GetAttributes(), false /* no box attributes */) : GetAttributes());
+    wxRichTextAttr textAttr(para ? para->GetCombinedAttributes(GetSharedAttributes(), false /* no box attributes */) : GetSharedAttributes());
     AdjustAttributes(textAttr, context);
 
     // Let's make the assumption for now that for content in a paragraph, including
@@ -6828,15 +7064,11 @@ bool wxRichTextPlainText::Draw(wxDC& dc, wxRichTextDrawingContext& context, cons
     // In case of partial selection we need to preprocess stringWhole too.
     if (allSelected || noneSelected)
     {
-        const wxString* pWholeString = &m_text;
-        if (context.HasVirtualText(this))
-        {
-            if (context.GetVirtualText(this, stringWhole) && stringWhole.length() == m_text.length())
-                pWholeString = &stringWhole;
-        }
-
         long len = range.GetLength();
-        stringChunk = pWholeString->Mid(range.GetStart() - offset, (size_t) len);
+        if (context.HasVirtualText(this) && context.GetVirtualText(this, stringWhole) && stringWhole.length() == m_length)
+            stringChunk = stringWhole.Mid(range.GetStart() - offset, (size_t) len);
+        else
+            stringChunk = DoGetText(range.GetStart() - offset, (size_t) len);
 
         // Replace line break characters with spaces
         wxString toRemove = wxRichTextLineBreakChar;
@@ -6849,11 +7081,11 @@ bool wxRichTextPlainText::Draw(wxDC& dc, wxRichTextDrawingContext& context, cons
     }
     else
     {
-        stringWhole = m_text;
+        stringWhole = GetText();
         if (context.HasVirtualText(this))
         {
-            if (!context.GetVirtualText(this, stringWhole) || stringWhole.length() != m_text.length())
-                stringWhole = m_text;
+            if (!context.GetVirtualText(this, stringWhole) || stringWhole.length() != m_length)
+                stringWhole = GetText();
         }
 
         // Replace line break characters with spaces
@@ -7198,7 +7430,9 @@ void wxRichTextPlainText::Copy(const wxRichTextPlainText& obj)
 {
     wxRichTextObject::Copy(obj);
 
-    m_text = obj.m_text;
+    // Just share the text with the other object.
+    m_pieces = obj.m_pieces;
+    m_length = obj.m_length;
 }
 
 /// Get/set the object size for the given range. Returns false if the range
@@ -7213,7 +7447,7 @@ bool wxRichTextPlainText::GetRangeSize(const wxRichTextRange& range, wxSize& siz
 
     int relativeX = position.x - GetParent()->GetPosition().x;
 
-    wxRichTextAttr textAttr(para ? para->GetCombinedAttributes(GetAttributes()) : GetAttributes());
+    wxRichTextAttr textAttr(para ? para->GetCombinedAttributes(GetSharedAttributes()) : GetSharedAttributes());
     const_cast<wxRichTextPlainText*>(this)->AdjustAttributes(textAttr, context);
 
     // Always assume unformatted text, since at this level we have no knowledge
@@ -7261,15 +7495,11 @@ bool wxRichTextPlainText::GetRangeSize(const wxRichTextRange& range, wxSize& siz
     {
         // We don't need stringWhole. Only prepare stringChunk.
         wxString stringWhole;
-        const wxString* pWholeString = &m_text;
-        if (context.HasVirtualText(this))
-        {
-            if (context.GetVirtualText(this, stringWhole) && stringWhole.length() == m_text.length())
-                pWholeString = &stringWhole;
-        }
-
         long len = range.GetLength();
-        stringChunk = pWholeString->Mid(startPos, (size_t) len);
+        if (context.HasVirtualText(this) && context.GetVirtualText(this, stringWhole) && stringWhole.length() == m_length)
+            stringChunk = stringWhole.Mid(startPos, (size_t) len);
+        else
+            stringChunk = DoGetText(startPos, (size_t) len);
 
         // Replace line break characters with spaces
         wxString toRemove = wxRichTextLineBreakChar;
@@ -7419,16 +7649,15 @@ wxRichTextObject* wxRichTextPlainText::DoSplit(long pos)
 {
     long index = pos - GetRange().GetStart();
 
-    if (index < 0 || index >= (int) m_text.length())
+    if (index < 0 || index >= (long) m_length)
         return nullptr;
 
-    wxString firstPart = m_text.Mid(0, index);
-    wxString secondPart = m_text.Mid(index);
-
-    m_text = firstPart;
+    const size_t length = m_length;
 
-    wxRichTextPlainText* newObject = new wxRichTextPlainText(secondPart);
-    newObject->SetAttributes(GetAttributes());
+    wxRichTextPlainText* newObject = new wxRichTextPlainText;
+    DoSplitPieces(index, newObject->m_pieces);
+    newObject->m_length = length - m_length;
+    newObject->SetAttributes(GetSharedAttributes());
     newObject->SetProperties(GetProperties());
 
     newObject->SetRange(wxRichTextRange(pos, GetRange().GetEnd()));
@@ -7440,7 +7669,7 @@ wxRichTextObject* wxRichTextPlainText::DoSplit(long pos)
 /// Calculate range
 void wxRichTextPlainText::CalculateRange(long start, long& end)
 {
-    end = start + m_text.length() - 1;
+    end = start + m_length - 1;
     m_range.SetRange(start, end);
 }
 
@@ -7453,14 +7682,18 @@ bool wxRichTextPlainText::DeleteRange(const wxRichTextRange& range)
 
     if (r.GetStart() == GetRange().GetStart() && r.GetEnd() == GetRange().GetEnd())
     {
-        m_text.Empty();
+        SetText(wxString());
         return true;
     }
 
     long startIndex = r.GetStart() - GetRange().GetStart();
     long len = r.GetLength();
 
-    m_text = m_text.Mid(0, startIndex) + m_text.Mid(startIndex+len);
+    // Drop the pieces in the range, keeping the rest of them.
+    std::vector<Piece> tail, deleted;
+    DoSplitPieces(startIndex + len, tail);
+    DoSplitPieces(startIndex, deleted);
+    DoAppendPieces(tail);
     return true;
 }
 
@@ -7474,7 +7707,7 @@ wxString wxRichTextPlainText::GetTextForRange(const wxRichTextRange& range) cons
     long startIndex = r.GetStart() - GetRange().GetStart();
     long len = r.GetLength();
 
-    return m_text.Mid(startIndex, len);
+    return DoGetText(startIndex, len);
 }
 
 /// Returns true if this object can merge itself with the given one.
@@ -7484,15 +7717,15 @@ bool wxRichTextPlainText::CanMerge(wxRichTextObject* object, wxRichTextDrawingCo
     if (!context.GetVirtualAttributesEnabled())
     {
         return object->GetClassInfo() == wxCLASSINFO(wxRichTextPlainText) &&
-            (m_text.empty() || (wxTextAttrEq(GetAttributes(), object->GetAttributes()) && m_properties == object->GetProperties()));
+            (IsEmpty() || (wxTextAttrEq(GetSharedAttributes(), object->GetSharedAttributes()) && m_properties == object->GetProperties()));
     }
     else
     {
         wxRichTextPlainText* otherObj = wxDynamicCast(object, wxRichTextPlainText);
-        if (!otherObj || m_text.empty())
+        if (!otherObj || IsEmpty())
             return false;
 
-        if (!wxTextAttrEq(GetAttributes(), object->GetAttributes()) || !(m_properties == object->GetProperties()))
+        if (!wxTextAttrEq(GetSharedAttributes(), object->GetSharedAttributes()) || !(m_properties == object->GetProperties()))
             return false;
 
         // Check if differing virtual attributes makes it impossible to merge
@@ -7522,8 +7755,8 @@ bool wxRichTextPlainText::Merge(wxRichTextObject* object, wxRichTextDrawingConte
 
     if (textObject)
     {
-        m_text += textObject->GetText();
-        wxRichTextApplyStyle(m_attributes, textObject->GetAttributes());
+        DoAppendPieces(textObject->m_pieces);
+        wxRichTextApplyStyle(GetAttributes(), textObject->GetSharedAttributes());
         return true;
     }
     else
@@ -7535,7 +7768,7 @@ bool wxRichTextPlainText::CanSplit(wxRichTextDrawingContext& context) const
     // If this object has any virtual attributes at all, whether for the whole object
     // or individual ones, we should try splitting it by calling Split.
     // Must be more than one character in order to be able to split.
-    return m_text.length() > 1 && context.HasVirtualAttributes(const_cast<wxRichTextPlainText*>(this));
+    return m_length > 1 && context.HasVirtualAttributes(const_cast<wxRichTextPlainText*>(this));
 }
 
 wxRichTextObject* wxRichTextPlainText::Split(wxRichTextDrawingContext& context)
@@ -7558,7 +7791,7 @@ wxRichTextObject* wxRichTextPlainText::Split(wxRichTextDrawingContext& context)
 
                 // We will gather up runs of text with the same virtual attributes
 
-                int len = m_text.length();
+                int len = m_length;
                 int i = 0;
 
                 // runStart and runEnd represent the accumulated run with a consistent attribute
@@ -7566,7 +7799,7 @@ wxRichTextObject* wxRichTextPlainText::Split(wxRichTextDrawingContext& context)
                 int runStart = -1;
                 int runEnd = -1;
                 wxRichTextAttr currentAttr;
-                wxString text = m_text;
+                wxString text = GetText();
                 wxRichTextPlainText* lastPlainText = this;
 
                 for (i = 0; i < (int) positions.GetCount(); i++)
@@ -7613,7 +7846,7 @@ wxRichTextObject* wxRichTextPlainText::Split(wxRichTextDrawingContext& context)
                                     {
                                         wxRichTextPlainText* obj = new wxRichTextPlainText;
                                         lastPlainText = obj;
-                                        obj->SetAttributes(GetAttributes());
+                                        obj->SetAttributes(GetSharedAttributes());
                                         obj->SetProperties(GetProperties());
                                         obj->SetParent(parent);
 
@@ -7655,7 +7888,7 @@ wxRichTextObject* wxRichTextPlainText::Split(wxRichTextDrawingContext& context)
                                 {
                                     wxRichTextPlainText* obj = new wxRichTextPlainText;
                                     lastPlainText = obj;
-                                    obj->SetAttributes(GetAttributes());
+                                    obj->SetAttributes(GetSharedAttributes());
                                     obj->SetProperties(GetProperties());
                                     obj->SetParent(parent);
 
@@ -7696,7 +7929,7 @@ wxRichTextObject* wxRichTextPlainText::Split(wxRichTextDrawingContext& context)
                         {
                             wxRichTextPlainText* obj = new wxRichTextPlainText;
                             lastPlainText = obj;
-                            obj->SetAttributes(GetAttributes());
+                            obj->SetAttributes(GetSharedAttributes());
                             obj->SetProperties(GetProperties());
                             obj->SetParent(parent);
 
@@ -7717,7 +7950,7 @@ wxRichTextObject* wxRichTextPlainText::Split(wxRichTextDrawingContext& context)
                         wxASSERT(runStart != 0);
 
                         wxRichTextPlainText* obj = new wxRichTextPlainText;
-                        obj->SetAttributes(GetAttributes());
+                        obj->SetAttributes(GetSharedAttributes());
                         obj->SetProperties(GetProperties());
                         obj->SetParent(parent);
 
@@ -7742,18 +7975,19 @@ wxRichTextObject* wxRichTextPlainText::Split(wxRichTextDrawingContext& context)
 void wxRichTextPlainText::Dump(wxTextOutputStream& stream)
 {
     wxRichTextObject::Dump(stream);
-    stream << m_text << wxT("\n");
+    stream << GetText() << wxT("\n");
 }
 
 /// Get the first position from pos that has a line break character.
 long wxRichTextPlainText::GetFirstLineBreakPosition(long pos)
 {
+    const wxString& text = GetText();
     int i;
-    int len = m_text.length();
+    int len = text.length();
     int startPos = pos - m_range.GetStart();
     for (i = startPos; i < len; i++)
     {
-        wxChar ch = m_text[i];
+        wxChar ch = text[i];
         if (ch == wxRichTextLineBreakChar)
         {
             return i + m_range.GetStart();
@@ -7967,7 +8201,7 @@ bool wxRichTextParagraphLayoutBox::InsertNewlineWithUndo(wxRichTextBuffer* buffe
             pos1 ++;
 
         // Now see if we need to number the paragraph.
-        if (newPara->GetAttributes().HasBulletNumber())
+        if (newPara->GetSharedAttributes().HasBulletNumber())
         {
             wxRichTextAttr numberingAttr;
             if (FindNextParagraphNumber(para, numberingAttr))
@@ -8193,9 +8427,9 @@ wxRichTextAttr wxRichTextParagraphLayoutBox::GetStyleForNewParagraph(wxRichTextB
         bool foundAttributes = false;
 
         // Look for a matching paragraph style
-        if (lookUpNewParaStyle && !para->GetAttributes().GetParagraphStyleName().IsEmpty() && buffer->GetStyleSheet())
+        if (lookUpNewParaStyle && !para->GetSharedAttributes().GetParagraphStyleName().IsEmpty() && buffer->GetStyleSheet())
         {
-            wxRichTextParagraphStyleDefinition* paraDef = buffer->GetStyleSheet()->FindParagraphStyle(para->GetAttributes().GetParagraphStyleName());
+            wxRichTextParagraphStyleDefinition* paraDef = buffer->GetStyleSheet()->FindParagraphStyle(para->GetSharedAttributes().GetParagraphStyleName());
             if (paraDef)
             {
                 // If we're not at the end of the paragraph, then we apply THIS style, and not the designated next style.
@@ -8219,26 +8453,26 @@ wxRichTextAttr wxRichTextParagraphLayoutBox::GetStyleForNewParagraph(wxRichTextB
         }
 
         // Also apply list style if present
-        if (lookUpNewParaStyle && !para->GetAttributes().GetListStyleName().IsEmpty() && buffer->GetStyleSheet())
+        if (lookUpNewParaStyle && !para->GetSharedAttributes().GetListStyleName().IsEmpty() && buffer->GetStyleSheet())
         {
-            wxRichTextListStyleDefinition* listDef = buffer->GetStyleSheet()->FindListStyle(para->GetAttributes().GetListStyleName());
+            wxRichTextListStyleDefinition* listDef = buffer->GetStyleSheet()->FindListStyle(para->GetSharedAttributes().GetListStyleName());
             if (listDef)
             {
-                int thisIndent = para->GetAttributes().GetLeftIndent();
-                int thisLevel = para->GetAttributes().HasOutlineLevel() ? para->GetAttributes().GetOutlineLevel() : listDef->FindLevelForIndent(thisIndent);
+                int thisIndent = para->GetSharedAttributes().GetLeftIndent();
+                int thisLevel = para->GetSharedAttributes().HasOutlineLevel() ? para->GetSharedAttributes().GetOutlineLevel() : listDef->FindLevelForIndent(thisIndent);
 
                 // Apply the overall list style, and item style for this level
                 wxRichTextAttr listStyle(listDef->GetCombinedStyleForLevel(thisLevel, buffer->GetStyleSheet()));
                 wxRichTextApplyStyle(attr, listStyle);
                 attr.SetOutlineLevel(thisLevel);
-                if (para->GetAttributes().HasBulletNumber())
-                    attr.SetBulletNumber(para->GetAttributes().GetBulletNumber());
+                if (para->GetSharedAttributes().HasBulletNumber())
+                    attr.SetBulletNumber(para->GetSharedAttributes().GetBulletNumber());
             }
         }
 
         if (!foundAttributes)
         {
-            attr = para->GetAttributes();
+            attr = para->GetSharedAttributes();
             int flags = attr.GetFlags();
 
             // Eliminate character styles
@@ -8283,7 +8517,7 @@ bool wxRichTextParagraphLayoutBox::DeleteRangeWithUndo(const wxRichTextRange& ra
             wxRichTextParagraph* nextPara = GetParagraphAtPosition(range.GetStart()+1);
             if (nextPara && nextPara != para)
             {
-                action->GetOldParagraphs().GetChildren().GetFirst()->GetData()->SetAttributes(nextPara->GetAttributes());
+                action->GetOldParagraphs().GetChildren().GetFirst()->GetData()->SetAttributes(nextPara->GetSharedAttributes());
                 action->GetOldParagraphs().GetAttributes().SetFlags(action->GetOldParagraphs().GetAttributes().GetFlags() | wxTEXT_ATTR_KEEP_FIRST_PARA_STYLE);
             }
         }
@@ -8811,6 +9045,7 @@ bool wxRichTextBuffer::LoadFile(const wxString& filename, wxRichTextFileType typ
         SetDefaultStyle(wxRichTextAttr());
         handler->SetFlags(GetHandlerFlags());
         bool success = handler->LoadFile(this, filename);
+        ShareAttributes();
         Invalidate(wxRICHTEXT_ALL);
         return success;
     }
@@ -8842,6 +9077,7 @@ bool wxRichTextBuffer::LoadFile(wxInputStream& stream, wxRichTextFileType type)
         SetDefaultStyle(wxRichTextAttr());
         handler->SetFlags(GetHandlerFlags());
         bool success = handler->LoadFile(this, stream);
+        ShareAttributes();
         Invalidate(wxRICHTEXT_ALL);
         return success;
     }
@@ -9423,7 +9659,7 @@ void wxRichTextBox::Copy(const wxRichTextBox& obj)
 bool wxRichTextBox::EditProperties(wxWindow* parent, wxRichTextBuffer* buffer)
 {
     wxRichTextObjectPropertiesDialog boxDlg(this, wxGetTopLevelParent(parent), wxID_ANY, _("Box Properties"));
-    boxDlg.SetAttributes(GetAttributes());
+    boxDlg.SetAttributes(GetSharedAttributes());
 
     if (boxDlg.ShowModal() == wxID_OK && buffer->GetRichTextCtrl()->IsEditable())
     {
@@ -9826,8 +10062,8 @@ bool wxRichTextCell::AdjustAttributes(wxRichTextAttr& attr, wxRichTextDrawingCon
     wxRichTextObject::AdjustAttributes(attr, context);
 
     wxRichTextTable* table = wxDynamicCast(GetParent(), wxRichTextTable);
-    if (IsShown() && table && table->GetAttributes().GetTextBoxAttr().HasCollapseBorders() &&
-        table->GetAttributes().GetTextBoxAttr().GetCollapseBorders() == wxTEXT_BOX_ATTR_COLLAPSE_FULL)
+    if (IsShown() && table && table->GetSharedAttributes().GetTextBoxAttr().HasCollapseBorders() &&
+        table->GetSharedAttributes().GetTextBoxAttr().GetCollapseBorders() == wxTEXT_BOX_ATTR_COLLAPSE_FULL)
     {
         // Collapse borders:
         // (1) Reset left and top for all cells unless there is no table border there;
@@ -9840,7 +10076,7 @@ bool wxRichTextCell::AdjustAttributes(wxRichTextAttr& attr, wxRichTextDrawingCon
             if (col == 0)
             {
                 // Only remove the cell border on the left edge if we have a table border
-                if (table->GetAttributes().GetTextBoxAttr().GetBorder().GetLeft().IsValid())
+                if (table->GetSharedAttributes().GetTextBoxAttr().GetBorder().GetLeft().IsValid())
                     attr.GetTextBoxAttr().GetBorder().GetLeft().Reset();
             }
             else
@@ -9849,7 +10085,7 @@ bool wxRichTextCell::AdjustAttributes(wxRichTextAttr& attr, wxRichTextDrawingCon
             if (row == 0)
             {
                 // Only remove the cell border on the top edge if we have a table border
-                if (table->GetAttributes().GetTextBoxAttr().GetBorder().GetTop().IsValid())
+                if (table->GetSharedAttributes().GetTextBoxAttr().GetBorder().GetTop().IsValid())
                     attr.GetTextBoxAttr().GetBorder().GetTop().Reset();
             }
             else
@@ -9894,7 +10130,7 @@ bool wxRichTextCell::AdjustAttributes(wxRichTextAttr& attr, wxRichTextDrawingCon
             // then we must reset the border, if there's a right table border.
             if (!adjacentCellRight)
             {
-                if (table->GetAttributes().GetTextBoxAttr().GetBorder().GetRight().IsValid())
+                if (table->GetSharedAttributes().GetTextBoxAttr().GetBorder().GetRight().IsValid())
                     attr.GetTextBoxAttr().GetBorder().GetRight().Reset();
             }
             else
@@ -9902,7 +10138,7 @@ bool wxRichTextCell::AdjustAttributes(wxRichTextAttr& attr, wxRichTextDrawingCon
                 if (!attr.GetTextBoxAttr().GetBorder().GetRight().IsValid() ||
                     attr.GetTextBoxAttr().GetBorder().GetRight().GetWidth().GetValue() == 0)
                 {
-                    attr.GetTextBoxAttr().GetBorder().GetRight() = adjacentCellRight->GetAttributes().GetTextBoxAttr().GetBorder().GetLeft();
+                    attr.GetTextBoxAttr().GetBorder().GetRight() = adjacentCellRight->GetSharedAttributes().GetTextBoxAttr().GetBorder().GetLeft();
                 }
             }
 
@@ -9941,7 +10177,7 @@ bool wxRichTextCell::AdjustAttributes(wxRichTextAttr& attr, wxRichTextDrawingCon
             // then we must reset the border, if there's a bottom table border.
             if (!adjacentCellBelow)
             {
-                if (table->GetAttributes().GetTextBoxAttr().GetBorder().GetBottom().IsValid())
+                if (table->GetSharedAttributes().GetTextBoxAttr().GetBorder().GetBottom().IsValid())
                     attr.GetTextBoxAttr().GetBorder().GetBottom().Reset();
             }
             else
@@ -9949,7 +10185,7 @@ bool wxRichTextCell::AdjustAttributes(wxRichTextAttr& attr, wxRichTextDrawingCon
                 if (!attr.GetTextBoxAttr().GetBorder().GetBottom().IsValid() ||
                     attr.GetTextBoxAttr().GetBorder().GetBottom().GetWidth().GetValue() == 0)
                 {
-                    attr.GetTextBoxAttr().GetBorder().GetBottom() = adjacentCellBelow->GetAttributes().GetTextBoxAttr().GetBorder().GetTop();
+                    attr.GetTextBoxAttr().GetBorder().GetBottom() = adjacentCellBelow->GetSharedAttributes().GetTextBoxAttr().GetBorder().GetTop();
                 }
             }
         }
@@ -9989,7 +10225,7 @@ bool wxRichTextCell::EditProperties(wxWindow* parent, wxRichTextBuffer* buffer)
             wxRichTextCell* cell = table->GetCell(range.GetStart());
             if (cell)
             {
-                wxRichTextAttr cellStyle = cell->GetAttributes();
+                wxRichTextAttr cellStyle = cell->GetSharedAttributes();
 
                 CollectStyle(attr, cellStyle, clashingAttr, absentAttr);
 
@@ -10000,7 +10236,7 @@ bool wxRichTextCell::EditProperties(wxWindow* parent, wxRichTextBuffer* buffer)
     }
     else
     {
-        attr = GetAttributes();
+        attr = GetSharedAttributes();
     }
 
     wxString caption;
@@ -10101,8 +10337,8 @@ bool wxRichTextTable::Draw(wxDC& dc, wxRichTextDrawingContext& context, const wx
     // If the table is not collapsed (in which case the outer table box provides the border),
     // draw the overall border again using cell borders in case it has been overwritten by
     // adjacent cell borders of different colours.
-    if (!GetAttributes().GetTextBoxAttr().HasCollapseBorders() ||
-        GetAttributes().GetTextBoxAttr().GetCollapseBorders() != wxTEXT_BOX_ATTR_COLLAPSE_FULL)
+    if (!GetSharedAttributes().GetTextBoxAttr().HasCollapseBorders() ||
+        GetSharedAttributes().GetTextBoxAttr().GetCollapseBorders() != wxTEXT_BOX_ATTR_COLLAPSE_FULL)
     {
         int colCount = GetColumnCount();
         int rowCount = GetRowCount();
@@ -10117,7 +10353,7 @@ bool wxRichTextTable::Draw(wxDC& dc, wxRichTextDrawingContext& context, const wx
                     if (cell && cell->IsShown() && !cell->GetRange().IsOutside(range))
                     {
                         wxRect childRect(cell->GetPosition(), cell->GetCachedSize());
-                        wxRichTextAttr attr(cell->GetAttributes());
+                        wxRichTextAttr attr(cell->GetSharedAttributes());
                         cell->AdjustAttributes(attr, context);
                         if (row != 0)
                             attr.GetTextBoxAttr().GetBorder().GetTop().Reset();
@@ -10316,7 +10552,7 @@ bool wxRichTextTable::Layout(wxDC& dc, wxRichTextDrawingContext& context, const
     wxRect availableSpace = GetAvailableContentArea(dc, context, rect);
     wxTextAttrDimensionConverter converter(dc, scale, availableSpace.GetSize());
 
-    wxRichTextAttr attr(GetAttributes());
+    wxRichTextAttr attr(GetSharedAttributes());
     AdjustAttributes(attr, context);
 
     bool tableHasPercentWidth = (attr.GetTextBoxAttr().GetWidth().GetUnits() == wxTEXT_ATTR_UNITS_PERCENTAGE);
@@ -10523,10 +10759,10 @@ bool wxRichTextTable::Layout(wxDC& dc, wxRichTextDrawingContext& context, const
                     int absoluteCellWidth = -1;
                     int percentageCellWidth = -1;
 
-                    if (cell->GetAttributes().GetTextBoxAttr().GetWidth().IsValid())
+                    if (cell->GetSharedAttributes().GetTextBoxAttr().GetWidth().IsValid())
                     {
-                        int w = cellConverter.GetPixels(cell->GetAttributes().GetTextBoxAttr().GetWidth(), wxHORIZONTAL);
-                        if (cell->GetAttributes().GetTextBoxAttr().GetWidth().GetUnits() == wxTEXT_ATTR_UNITS_PERCENTAGE)
+                        int w = cellConverter.GetPixels(cell->GetSharedAttributes().GetTextBoxAttr().GetWidth(), wxHORIZONTAL);
+                        if (cell->GetSharedAttributes().GetTextBoxAttr().GetWidth().GetUnits() == wxTEXT_ATTR_UNITS_PERCENTAGE)
                         {
                             percentageCellWidth = w;
                         }
@@ -10559,8 +10795,8 @@ bool wxRichTextTable::Layout(wxDC& dc, wxRichTextDrawingContext& context, const
                     if (cell->GetMaxSize().x && cell->GetMaxSize().x > maxColWidths[i])
                         maxColWidths[i] = cell->GetMaxSize().x;
 
-                    if (cell->GetAttributes().GetTextBoxAttr().HasWhitespaceMode() &&
-                        (cell->GetAttributes().GetTextBoxAttr().GetWhitespaceMode() == wxTEXT_BOX_ATTR_WHITESPACE_NO_WRAP))
+                    if (cell->GetSharedAttributes().GetTextBoxAttr().HasWhitespaceMode() &&
+                        (cell->GetSharedAttributes().GetTextBoxAttr().GetWhitespaceMode() == wxTEXT_BOX_ATTR_WHITESPACE_NO_WRAP))
                     {
                         if (cell->GetMaxSize().x > minColWidthsNoWrap[i])
                             minColWidthsNoWrap[i] = cell->GetMaxSize().x;
@@ -10617,9 +10853,9 @@ bool wxRichTextTable::Layout(wxDC& dc, wxRichTextDrawingContext& context, const
                     int cellWidth = 0;
                     if (spans > 0)
                     {
-                        if (cell->GetAttributes().GetTextBoxAttr().GetWidth().IsValid())
+                        if (cell->GetSharedAttributes().GetTextBoxAttr().GetWidth().IsValid())
                         {
-                            cellWidth = cellConverter.GetPixels(cell->GetAttributes().GetTextBoxAttr().GetWidth(), wxHORIZONTAL);
+                            cellWidth = cellConverter.GetPixels(cell->GetSharedAttributes().GetTextBoxAttr().GetWidth(), wxHORIZONTAL);
                             // Override absolute width with minimum width if necessary
                             if (cell->GetMinSize().x > 0 && cellWidth != -1 && cell->GetMinSize().x > cellWidth)
                                 cellWidth = cell->GetMinSize().x;
@@ -10873,9 +11109,9 @@ bool wxRichTextTable::Layout(wxDC& dc, wxRichTextDrawingContext& context, const
             {
                 // Get max specified cell height
                 // Don't handle percentages for height
-                if (cell->GetAttributes().GetTextBoxAttr().GetHeight().IsValid() && cell->GetAttributes().GetTextBoxAttr().GetHeight().GetUnits() != wxTEXT_ATTR_UNITS_PERCENTAGE)
+                if (cell->GetSharedAttributes().GetTextBoxAttr().GetHeight().IsValid() && cell->GetSharedAttributes().GetTextBoxAttr().GetHeight().GetUnits() != wxTEXT_ATTR_UNITS_PERCENTAGE)
                 {
-                    int h = cellConverter.GetPixels(cell->GetAttributes().GetTextBoxAttr().GetHeight());
+                    int h = cellConverter.GetPixels(cell->GetSharedAttributes().GetTextBoxAttr().GetHeight());
                     if (h > maxSpecifiedCellHeight)
                         maxSpecifiedCellHeight = h;
                 }
@@ -11140,7 +11376,7 @@ bool wxRichTextTable::CreateTable(int rows, int cols)
         for (j = 0; j < cols; j++)
         {
             wxRichTextCell* cell = new wxRichTextCell;
-            cell->GetAttributes() = cellattr;
+            cell->SetAttributes(cellattr);
 
             AppendChild(cell);
             cell->AddParagraph(wxEmptyString);
@@ -11461,7 +11697,7 @@ bool wxRichTextTable::AddRows(int startRow, int noRows, const wxRichTextAttr& at
         for (j = 0; j < m_colCount; j++)
         {
             wxRichTextCell* cell = new wxRichTextCell;
-            cell->GetAttributes() = cellattr;
+            cell->SetAttributes(cellattr);
 
             AppendChild(cell);
             cell->AddParagraph(wxEmptyString);
@@ -11512,7 +11748,7 @@ bool wxRichTextTable::AddColumns(int startCol, int noCols, const wxRichTextAttr&
         for (j = 0; j < noCols; j++)
         {
             wxRichTextCell* cell = new wxRichTextCell;
-            cell->GetAttributes() = cellattr;
+            cell->SetAttributes(cellattr);
 
             AppendChild(cell);
             cell->AddParagraph(wxEmptyString);
@@ -11540,7 +11776,7 @@ bool wxRichTextTable::AddColumns(int startCol, int noCols, const wxRichTextAttr&
 bool wxRichTextTable::EditProperties(wxWindow* parent, wxRichTextBuffer* buffer)
 {
     wxRichTextObjectPropertiesDialog boxDlg(this, wxGetTopLevelParent(parent), wxID_ANY, _("Table Properties"));
-    boxDlg.SetAttributes(GetAttributes());
+    boxDlg.SetAttributes(GetSharedAttributes());
 
     if (boxDlg.ShowModal() == wxID_OK)
     {
@@ -11737,6 +11973,8 @@ bool wxRichTextCommand::Do()
             action->GetRichTextCtrl()->Thaw();
     }
 
+    ShareAttributes();
+
     return true;
 }
 
@@ -11754,9 +11992,24 @@ bool wxRichTextCommand::Undo()
             action->GetRichTextCtrl()->Thaw();
     }
 
+    ShareAttributes();
+
     return true;
 }
 
+// Share the attributes modified by the actions with the other objects again.
+void wxRichTextCommand::ShareAttributes()
+{
+    for (wxList::compatibility_iterator node = m_actions.GetFirst(); node; node = node->GetNext())
+    {
+        wxRichTextAction* action = (wxRichTextAction*) node->GetData();
+
+        wxRichTextParagraphLayoutBox* container = action->GetContainer();
+        if (container)
+            container->ShareAttributes();
+    }
+}
+
 void wxRichTextCommand::ClearActions()
 {
     wxClearList(m_actions);
@@ -12026,8 +12279,8 @@ bool wxRichTextAction::Do()
             wxRichTextObject* obj = m_objectAddress.GetObject(m_buffer); // container->GetChildAtPosition(GetRange().GetStart());
             if (obj)
             {
-                wxRichTextAttr oldAttr = obj->GetAttributes();
-                obj->GetAttributes() = m_attributes;
+                wxRichTextAttr oldAttr = obj->GetSharedAttributes();
+                obj->SetAttributes(m_attributes);
                 m_attributes = oldAttr;
             }
 
@@ -12254,7 +12507,7 @@ void wxRichTextAction::UpdateAppearance(long caretPosition, bool sendUpdateEvent
         {
             wxRect containerRect = container->GetRect();
 
-            m_ctrl->LayoutContent();
+            m_ctrl->LayoutContentIncrementally();
 
             // Refresh everything if there were floating objects or the container changed size
             // (we can't yet optimize in these cases, since more complex interaction with other content occurs)
@@ -12529,7 +12782,7 @@ bool wxRichTextImage::LoadImageCache(wxDC& dc, wxRichTextDrawingContext& context
         return true;
     }
 
-    wxRichTextAttr attr(GetAttributes());
+    wxRichTextAttr attr(GetSharedAttributes());
     AdjustAttributes(attr, context);
 
     if (!context.GetImagesEnabled())
@@ -12594,7 +12847,7 @@ bool wxRichTextImage::LoadImageCache(wxDC& dc, wxRichTextDrawingContext& context
             marginRect = wxRect(0, 0, sz.x, sz.y);
             if (GetParent() && GetParent()->GetParent())
             {
-                buffer->GetBoxRects(dc, buffer, GetParent()->GetParent()->GetAttributes(), marginRect, borderRect, contentRect, paddingRect, outlineRect);
+                buffer->GetBoxRects(dc, buffer, GetParent()->GetParent()->GetSharedAttributes(), marginRect, borderRect, contentRect, paddingRect, outlineRect);
                 sz = contentRect.GetSize();
             }
 
@@ -12603,7 +12856,7 @@ bool wxRichTextImage::LoadImageCache(wxDC& dc, wxRichTextDrawingContext& context
                 // Find the actual space available when margin is taken into account
                 wxRect imgMarginRect, imgBorderRect, imgContentRect, imgPaddingRect, imgOutlineRect;
                 imgMarginRect = wxRect(0, 0, 100, 100); // To force GetBoxRects to return content rect
-                GetBoxRects(dc, buffer, GetAttributes(), imgMarginRect, imgBorderRect, imgContentRect, imgPaddingRect, imgOutlineRect);
+                GetBoxRects(dc, buffer, GetSharedAttributes(), imgMarginRect, imgBorderRect, imgContentRect, imgPaddingRect, imgOutlineRect);
                 sz += (imgContentRect.GetSize() - wxSize(100, 100));
             }
 
@@ -12762,7 +13015,7 @@ bool wxRichTextImage::Draw(wxDC& dc, wxRichTextDrawingContext& context, const wx
     if (!IsShown())
         return true;
 
-    wxRichTextAttr attr(GetAttributes());
+    wxRichTextAttr attr(GetSharedAttributes());
     AdjustAttributes(attr, context);
 
     wxPoint position = rect.GetPosition();
@@ -12828,7 +13081,7 @@ bool wxRichTextImage::Layout(wxDC& dc, wxRichTextDrawingContext& context, const
     wxRect marginRect, borderRect, contentRect, paddingRect, outlineRect;
     contentRect = wxRect(wxPoint(0,0), imageSize);
 
-    wxRichTextAttr attr(GetAttributes());
+    wxRichTextAttr attr(GetSharedAttributes());
     AdjustAttributes(attr, context);
 
     GetBoxRects(dc, GetBuffer(), attr, marginRect, borderRect, contentRect, paddingRect, outlineRect);
@@ -12859,7 +13112,7 @@ bool wxRichTextImage::GetRangeSize(const wxRichTextRange& range, wxSize& size, i
         return true;
     }
 
-    wxRichTextAttr attr(GetAttributes());
+    wxRichTextAttr attr(GetSharedAttributes());
     const_cast<wxRichTextImage*>(this)->AdjustAttributes(attr, context);
 
     wxRect marginRect, borderRect, contentRect, paddingRect, outlineRect;
@@ -12903,7 +13156,7 @@ void wxRichTextImage::Copy(const wxRichTextImage& obj)
 bool wxRichTextImage::EditProperties(wxWindow* parent, wxRichTextBuffer* buffer)
 {
     wxRichTextObjectPropertiesDialog imageDlg(this, wxGetTopLevelParent(parent), wxID_ANY, _("Picture Properties"));
-    imageDlg.SetAttributes(GetAttributes());
+    imageDlg.SetAttributes(GetSharedAttributes());
 
     if (imageDlg.ShowModal() == wxID_OK && buffer->GetRichTextCtrl()->IsEditable())
     {
@@ -14111,6 +14364,306 @@ void wxRichTextAttr::CollectCommonAttributes(const wxRichTextAttr& attr, wxRichT
     m_textBoxAttr.CollectCommonAttributes(attr.m_textBoxAttr, clashingAttr.m_textBoxAttr, absentAttr.m_textBoxAttr);
 }
 
+// ----------------------------------------------------------------------------
+// wxRichTextSharedAttr
+// ----------------------------------------------------------------------------
+
+struct wxRichTextSharedAttrData
+{
+    explicit wxRichTextSharedAttrData(const wxRichTextAttr& attr_)
+        : attr(attr_)
+    {
+    }
+
+    wxRichTextAttr attr;
+
+    // The following fields are only used for the shared attributes.
+    size_t hash = 0;
+    int refCount = 0;
+    bool shared = false;
+};
+
+namespace
+{
+
+// Hash only the attributes taken into account by wxRichTextAttr::operator==,
+// it's fine to omit some of them, as this only results in more comparisons.
+size_t wxRichTextAttrHash(const wxRichTextAttr& attr)
+{
+    size_t hash = 0;
+    const auto combine = [&hash](size_t value)
+    {
+        hash ^= value + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    };
+    const auto combineColour = [&combine](const wxColour& colour)
+    {
+        combine(colour.IsOk() ? colour.GetRGBA() : 0);
+    };
+    const std::hash<wxString> hashString;
+
+    combine(attr.GetFlags());
+
+    if (attr.HasTextColour())
+        combineColour(attr.GetTextColour());
+    if (attr.HasBackgroundColour())
+        combineColour(attr.GetBackgroundColour());
+    if (attr.HasAlignment())
+        combine(attr.GetAlignment());
+    if (attr.HasLeftIndent())
+        combine(attr.GetLeftIndent());
+    if (attr.HasFontSize())
+        combine(attr.GetFontSize());
+    if (attr.HasFontWeight())
+        combine(attr.GetFontWeight());
+    if (attr.HasFontItalic())
+        combine(attr.GetFontStyle());
+    if (attr.HasFontFaceName())
+        combine(hashString(attr.GetFontFaceName()));
+    if (attr.HasCharacterStyleName())
+        combine(hashString(attr.GetCharacterStyleName()));
+    if (attr.HasParagraphStyleName())
+        combine(hashString(attr.GetParagraphStyleName()));
+    if (attr.HasListStyleName())
+        combine(hashString(attr.GetListStyleName()));
+    if (attr.HasURL())
+        combine(hashString(attr.GetURL()));
+
+    combine(attr.GetTextBoxAttr().GetFlags());
+
+    return hash;
+}
+
+// The table of all shared attributes.
+class wxRichTextSharedAttrTable
+{
+public:
+    wxRichTextSharedAttrTable()
+        : m_empty(wxRichTextAttr())
+    {
+        // The empty attributes are used by all default-constructed objects,
+        // so keep them around permanently.
+        m_empty.hash = wxRichTextAttrHash(m_empty.attr);
+        m_empty.refCount = 1;
+        m_empty.shared = true;
+        m_entries.insert(std::make_pair(m_empty.hash, &m_empty));
+    }
+
+    wxRichTextSharedAttrTable(const wxRichTextSharedAttrTable&) = delete;
+    wxRichTextSharedAttrTable& operator=(const wxRichTextSharedAttrTable&) = delete;
+
+    static wxRichTextSharedAttrTable& Get()
+    {
+        static wxRichTextSharedAttrTable s_table;
+        return s_table;
+    }
+
+    wxRichTextSharedAttrData* GetEmpty()
+    {
+        wxCRIT_SECT_LOCKER(lock, m_critSect);
+
+        m_empty.refCount++;
+        return &m_empty;
+    }
+
+    // Return the shared data equal to the given attributes, creating it if
+    // necessary. If the private data is given, it is reused for the new entry
+    // or deleted.
+    wxRichTextSharedAttrData* Intern(const wxRichTextAttr& attr,
+                                     wxRichTextSharedAttrData* privateData = nullptr)
+    {
+        const size_t hash = wxRichTextAttrHash(attr);
+
+        wxCRIT_SECT_LOCKER(lock, m_critSect);
+
+        const auto range = m_entries.equal_range(hash);
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            wxRichTextSharedAttrData* const data = it->second;
+            if (data->attr == attr)
+            {
+                data->refCount++;
+                delete privateData;
+                return data;
+            }
+        }
+
+        wxRichTextSharedAttrData* data = privateData;
+        if (!data)
+            data = new wxRichTextSharedAttrData(attr);
+
+        data->hash = hash;
+        data->refCount = 1;
+        data->shared = true;
+        m_entries.insert(std::make_pair(hash, data));
+
+        return data;
+    }
+
+    void AddRef(wxRichTextSharedAttrData* data)
+    {
+        wxCRIT_SECT_LOCKER(lock, m_critSect);
+
+        data->refCount++;
+    }
+
+    // Release the shared data, deleting it if it's not used any more.
+    void Release(wxRichTextSharedAttrData* data)
+    {
+        wxCRIT_SECT_LOCKER(lock, m_critSect);
+
+        if (--data->refCount == 0)
+        {
+            Remove(data);
+            delete data;
+        }
+    }
+
+    // Return the data which can be modified: either the same one, if it was
+    // used by the caller only, or a copy of it.
+    wxRichTextSharedAttrData* Unshare(wxRichTextSharedAttrData* data)
+    {
+        wxCRIT_SECT_LOCKER(lock, m_critSect);
+
+        if (data->refCount == 1 && data != &m_empty)
+        {
+            Remove(data);
+        }
+        else
+        {
+            data->refCount--;
+            data = new wxRichTextSharedAttrData(data->attr);
+        }
+
+        data->shared = false;
+
+        return data;
+    }
+
+    size_t GetCount()
+    {
+        wxCRIT_SECT_LOCKER(lock, m_critSect);
+
+        return m_entries.size();
+    }
+
+private:
+    void Remove(wxRichTextSharedAttrData* data)
+    {
+        const auto range = m_entries.equal_range(data->hash);
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            if (it->second == data)
+            {
+                m_entries.erase(it);
+                break;
+            }
+        }
+    }
+
+    wxCRIT_SECT_DECLARE_MEMBER(m_critSect);
+
+    std::unordered_multimap<size_t, wxRichTextSharedAttrData*> m_entries;
+
+    wxRichTextSharedAttrData m_empty;
+};
+
+} // anonymous namespace
+
+wxRichTextSharedAttr::wxRichTextSharedAttr()
+{
+    m_data = wxRichTextSharedAttrTable::Get().GetEmpty();
+}
+
+wxRichTextSharedAttr::wxRichTextSharedAttr(const wxRichTextAttr& attr)
+{
+    m_data = wxRichTextSharedAttrTable::Get().Intern(attr);
+}
+
+wxRichTextSharedAttr::wxRichTextSharedAttr(const wxRichTextSharedAttr& other)
+{
+    if (other.m_data->shared)
+    {
+        m_data = other.m_data;
+        wxRichTextSharedAttrTable::Get().AddRef(m_data);
+    }
+    else
+    {
+        // Don't share the private data of the other object as it may still
+        // be modified using the reference returned by its GetWritable().
+        m_data = wxRichTextSharedAttrTable::Get().Intern(other.m_data->attr);
+    }
+}
+
+wxRichTextSharedAttr& wxRichTextSharedAttr::operator=(const wxRichTextSharedAttr& other)
+{
+    if (other.m_data != m_data)
+    {
+        wxRichTextSharedAttr tmp(other);
+        std::swap(m_data, tmp.m_data);
+    }
+
+    return *this;
+}
+
+wxRichTextSharedAttr& wxRichTextSharedAttr::operator=(const wxRichTextAttr& attr)
+{
+    if (!m_data->shared)
+    {
+        // Modify the private data in place, as it's not shared anyhow.
+        m_data->attr = attr;
+    }
+    else if (&attr != &m_data->attr)
+    {
+        wxRichTextSharedAttr tmp(attr);
+        std::swap(m_data, tmp.m_data);
+    }
+
+    return *this;
+}
+
+wxRichTextSharedAttr::~wxRichTextSharedAttr()
+{
+    Release();
+}
+
+void wxRichTextSharedAttr::Release()
+{
+    if (m_data->shared)
+        wxRichTextSharedAttrTable::Get().Release(m_data);
+    else
+        delete m_data;
+}
+
+const wxRichTextAttr& wxRichTextSharedAttr::Get() const
+{
+    return m_data->attr;
+}
+
+wxRichTextAttr& wxRichTextSharedAttr::GetWritable()
+{
+    if (m_data->shared)
+        m_data = wxRichTextSharedAttrTable::Get().Unshare(m_data);
+
+    return m_data->attr;
+}
+
+void wxRichTextSharedAttr::Share()
+{
+    if (!m_data->shared)
+        m_data = wxRichTextSharedAttrTable::Get().Intern(m_data->attr, m_data);
+}
+
+bool wxRichTextSharedAttr::IsShared() const
+{
+    return m_data->shared;
+}
+
+/* static */
+size_t wxRichTextSharedAttr::GetSharedCount()
+{
+    return wxRichTextSharedAttrTable::Get().GetCount();
+}
+
 // Partial equality test
 bool wxTextAttrBorder::EqPartial(const wxTextAttrBorder& border, bool weakTest) const
 {
@@ -29,6 +29,13 @@
 #include "wx/arrimpl.cpp"
 #include "wx/fontenum.h"
 #include "wx/accel.h"
+#include "wx/wfstream.h"
+
+#if wxUSE_THREADS
+    #include "wx/threadpool.h"
+#endif
+
+#include <atomic>
 
 #if defined (__WXGTK__) || defined(__WXX11__)
 #define wxHAVE_PRIMARY_SELECTION 1
@@ -65,6 +72,7 @@ wxDEFINE_EVENT( wxEVT_RICHTEXT_PROPERTIES_CHANGED, wxRichTextEvent );
 wxDEFINE_EVENT( wxEVT_RICHTEXT_SELECTION_CHANGED, wxRichTextEvent );
 wxDEFINE_EVENT( wxEVT_RICHTEXT_BUFFER_RESET, wxRichTextEvent );
 wxDEFINE_EVENT( wxEVT_RICHTEXT_FOCUS_OBJECT_CHANGED, wxRichTextEvent );
+wxDEFINE_EVENT( wxEVT_RICHTEXT_FILE_LOADED, wxRichTextEvent );
 
 #if wxRICHTEXT_USE_OWN_CARET
 
@@ -351,6 +359,11 @@ wxRichTextCtrl::~wxRichTextCtrl()
     delete m_contextMenu;
 
     m_delayedImageProcessingTimer.Stop();
+
+#if wxUSE_FFILE && wxUSE_STREAMS
+    // The worker thread must not use this object once it's destroyed.
+    CancelAsyncLoad();
+#endif
 }
 
 /// Member initialisation
@@ -465,8 +478,17 @@ void wxRichTextCtrl::OnPaint(wxPaintEvent& WXUNUSED(event))
 
         wxRect availableSpace(GetUnscaledSize(GetClientSize()));
         wxRichTextDrawingContext context(& GetBuffer());
-        if (GetBuffer().IsDirty())
+        if (GetBuffer().IsDirty() || GetBuffer().HasDeferredLayout())
         {
+            // Only lay out a large buffer up to the bottom of the visible
+            // area, the rest of it will be laid out in idle time.
+            if (GetBuffer().GetOwnRange().GetEnd() > m_delayedLayoutThreshold)
+            {
+                const int visibleBottom = GetUnscaledPoint(GetLogicalPoint(wxPoint(0, 0))).y +
+                                            availableSpace.height;
+                context.EnableIncrementalLayout(true, visibleBottom);
+            }
+
             dc.SetUserScale(GetScale(), GetScale());
 
             GetBuffer().Defragment(context);
@@ -1536,7 +1558,7 @@ bool wxRichTextCtrl::ProcessBackKey(wxKeyEvent& event, int flags)
     // If we're at the start of a list item with a bullet, let's 'delete' the bullet, i.e.
     // make it a continuation paragraph.
     if (!HasSelection() && para && ((m_caretPosition+1) == para->GetRange().GetStart()) &&
-        para->GetAttributes().HasBulletStyle() && (para->GetAttributes().GetBulletStyle() & wxTEXT_ATTR_BULLET_STYLE_CONTINUATION) == 0)
+        para->GetSharedAttributes().HasBulletStyle() && (para->GetSharedAttributes().GetBulletStyle() & wxTEXT_ATTR_BULLET_STYLE_CONTINUATION) == 0)
     {
         wxRichTextParagraph* newPara = wxDynamicCast(para->Clone(), wxRichTextParagraph);
         newPara->GetAttributes().SetBulletStyle(newPara->GetAttributes().GetBulletStyle() | wxTEXT_ATTR_BULLET_STYLE_CONTINUATION);
@@ -1687,6 +1709,11 @@ Adding Shift does the above but starts/extends selection.
 
 bool wxRichTextCtrl::KeyboardNavigate(int keyCode, int flags)
 {
+    // Navigation may use the positions of the paragraphs below the visible
+    // area, so make sure they are up to date.
+    if (GetBuffer().HasDeferredLayout())
+        LayoutContent();
+
     bool success = false;
 
     if (keyCode == WXK_RIGHT || keyCode == WXK_NUMPAD_RIGHT)
@@ -1812,6 +1839,11 @@ bool wxRichTextCtrl::ScrollIntoView(long position, int keyCode)
     if (!m_verticalScrollbarEnabled)
         return false;
 
+    // The line may be below the part of the buffer laid out incrementally.
+    if (GetBuffer().HasDeferredLayout() &&
+            (GetFocusObject() != &GetBuffer() || position >= GetBuffer().GetDeferredLayoutStart() - 1))
+        LayoutContent();
+
     wxRichTextLine* line = GetVisibleLineForCaretPosition(position);
 
     if (!line)
@@ -1841,7 +1873,7 @@ bool wxRichTextCtrl::ScrollIntoView(long position, int keyCode)
 
     {
         wxClientDC dc(this);
-        wxRichTextObject::GetTotalMargin(dc, & GetBuffer(), GetBuffer().GetAttributes(), leftMargin, rightMargin,
+        wxRichTextObject::GetTotalMargin(dc, & GetBuffer(), GetBuffer().GetSharedAttributes(), leftMargin, rightMargin,
             topMargin, bottomMargin);
     }
     clientSize.y -= (int) (0.5 + bottomMargin * GetScale());
@@ -2848,6 +2880,10 @@ void wxRichTextCtrl::ForceDelayedLayout()
         Refresh(false);
         Update();
     }
+    else if (GetBuffer().HasDeferredLayout())
+    {
+        LayoutContent();
+    }
 }
 
 /// Idle-time processing
@@ -2873,6 +2909,14 @@ void wxRichTextCtrl::OnIdle(wxIdleEvent& event)
         ShowPosition(m_fullLayoutSavedPosition);
         Refresh(false);
     }
+    else if (GetBuffer().HasDeferredLayout() && !IsFrozen())
+    {
+        // Continue positioning the paragraphs below the visible area, whose
+        // layout was deferred after editing the buffer, a bit at a time.
+        DoLayoutContent(LayoutContent_TimeSlice);
+        if (GetBuffer().HasDeferredLayout())
+            event.RequestMore();
+    }
 
     const int imageProcessingInterval = wxRICHTEXT_DEFAULT_DELAYED_IMAGE_PROCESSING_INTERVAL;
 
@@ -3039,8 +3083,91 @@ bool wxRichTextCtrl::RecreateBuffer(const wxSize& size)
 // file IO functions
 // ----------------------------------------------------------------------------
 #if wxUSE_FFILE && wxUSE_STREAMS
+
+// The state of the file being loaded by LoadFileAsync().
+class wxRichTextAsyncLoad
+{
+public:
+    ~wxRichTextAsyncLoad()
+    {
+        // The style sheet is only taken over by the control if the file was
+        // loaded successfully.
+        delete buffer.GetStyleSheet();
+    }
+
+    // Load the file into the buffer, may be called from a worker thread.
+    void Load();
+
+    wxString filename;
+    std::unique_ptr<wxRichTextFileHandler> handler;
+
+    // This buffer is only used by the worker thread until it's done.
+    wxRichTextBuffer buffer;
+
+    std::atomic<bool> cancelled{false};
+    bool success = false;
+
+#if wxUSE_THREADS
+    std::future<void> future;
+#endif
+};
+
+namespace
+{
+
+// Input stream stopping reading the file as soon as the load is cancelled.
+class wxRichTextAsyncLoadStream : public wxFilterInputStream
+{
+public:
+    wxRichTextAsyncLoadStream(wxInputStream& stream,
+                              const std::atomic<bool>& cancelled)
+        : wxFilterInputStream(stream),
+          m_cancelled(cancelled)
+    {
+    }
+
+protected:
+    virtual size_t OnSysRead(void *buffer, size_t size) override
+    {
+        if ( m_cancelled )
+        {
+            m_lasterror = wxSTREAM_READ_ERROR;
+            return 0;
+        }
+
+        const size_t count = m_parent_i_stream->Read(buffer, size).LastRead();
+        m_lasterror = m_parent_i_stream->GetLastError();
+        return count;
+    }
+
+private:
+    const std::atomic<bool>& m_cancelled;
+};
+
+} // anonymous namespace
+
+void wxRichTextAsyncLoad::Load()
+{
+    // Errors are reported by the control in the main thread, don't log them
+    // from here, especially as they're expected when the load is cancelled.
+    wxLogNull noLog;
+
+    wxFFileInputStream fileStream(filename);
+    if ( !fileStream.IsOk() )
+        return;
+
+    wxRichTextAsyncLoadStream stream(fileStream, cancelled);
+
+    buffer.SetDefaultStyle(wxRichTextAttr());
+    success = handler->LoadFile(&buffer, stream) && !cancelled;
+
+    buffer.ShareAttributes();
+}
+
 bool wxRichTextCtrl::DoLoadFile(const wxString& filename, int fileType)
 {
+    CancelAsyncLoad();
+
     SetFocusObject(& GetBuffer(), true);
 
     bool success = GetBuffer().LoadFile(filename, (wxRichTextFileType)fileType);
@@ -3065,6 +3192,156 @@ bool wxRichTextCtrl::DoLoadFile(const wxString& filename, int fileType)
     }
 }
 
+bool wxRichTextCtrl::LoadFileAsync(const wxString& filename, int fileType)
+{
+    CancelAsyncLoad();
+
+    wxRichTextFileHandler* const handler =
+        wxRichTextBuffer::FindHandlerFilenameOrType(filename,
+                                                    (wxRichTextFileType)fileType);
+    if ( !handler || !handler->CanLoad() )
+        return false;
+
+    // Use a separate handler object in the worker thread as the handlers may
+    // keep some state while loading and the global one may be used by the
+    // main thread in the meanwhile.
+    wxRichTextFileHandler* const
+        handlerCopy = wxDynamicCast(handler->GetClassInfo()->CreateObject(),
+                                    wxRichTextFileHandler);
+    if ( !handlerCopy )
+    {
+        // We can't load the file in the background with this handler, do it
+        // synchronously, but still notify about it asynchronously for
+        // consistency.
+        const bool success = DoLoadFile(filename, fileType);
+        CallAfter([this, filename, success]()
+            {
+                wxRichTextEvent event(wxEVT_RICHTEXT_FILE_LOADED, GetId());
+                event.SetEventObject(this);
+                event.SetString(filename);
+                event.SetInt(success);
+                GetEventHandler()->ProcessEvent(event);
+            });
+        return true;
+    }
+
+    handlerCopy->SetFlags(GetBuffer().GetHandlerFlags());
+    handlerCopy->SetEncoding(handler->GetEncoding());
+
+    auto load = std::make_shared<wxRichTextAsyncLoad>();
+    load->filename = filename;
+    load->handler.reset(handlerCopy);
+
+    m_asyncLoad = load;
+
+#if wxUSE_THREADS
+    load->future = wxThreadPool::Get().Submit([this, load]()
+        {
+            load->Load();
+
+            if ( !load->cancelled )
+                CallAfter(&wxRichTextCtrl::OnAsyncLoadDone, load);
+        });
+#else // !wxUSE_THREADS
+    load->Load();
+
+    CallAfter(&wxRichTextCtrl::OnAsyncLoadDone, load);
+#endif // wxUSE_THREADS/!wxUSE_THREADS
+
+    return true;
+}
+
+void wxRichTextCtrl::CancelAsyncLoad()
+{
+    if ( !m_asyncLoad )
+        return;
+
+    std::shared_ptr<wxRichTextAsyncLoad> load;
+    load.swap(m_asyncLoad);
+
+    load->cancelled = true;
+
+#if wxUSE_THREADS
+    // This shouldn't take long as the worker stops reading the file as soon
+    // as it notices that it was cancelled.
+    load->future.wait();
+#endif
+}
+
+void wxRichTextCtrl::OnAsyncLoadDone(std::shared_ptr<wxRichTextAsyncLoad> load)
+{
+    // Check that this load was not cancelled in the meanwhile.
+    if ( load != m_asyncLoad )
+        return;
+
+    m_asyncLoad.reset();
+
+#if wxUSE_THREADS
+    // The worker is done with the buffer once it queues this call, but still
+    // wait for it to ensure that the task has completely finished.
+    load->future.wait();
+#endif
+
+    if ( load->success )
+    {
+        wxRichTextBuffer& buffer = GetBuffer();
+        wxRichTextBuffer& loaded = load->buffer;
+
+        SetFocusObject(& buffer, true);
+
+        buffer.ResetAndClearCommands();
+        buffer.Clear();
+        buffer.SetDefaultStyle(wxRichTextAttr());
+        buffer.SetAttributes(loaded.GetSharedAttributes());
+        buffer.GetProperties() = loaded.GetProperties();
+        buffer.SetPartialParagraph(loaded.GetPartialParagraph());
+
+        // Move the loaded objects to our buffer instead of copying them, as
+        // there may be a lot of them.
+        wxRichTextObjectList& children = loaded.GetChildren();
+        for ( wxRichTextObjectList::compatibility_iterator node = children.GetFirst();
+              node;
+              node = node->GetNext() )
+        {
+            wxRichTextObject* const child = node->GetData();
+            child->SetParent(& buffer);
+            buffer.GetChildren().Append(child);
+        }
+        children.Clear();
+
+        // Notify about the style sheet change from here, as nobody was
+        // notified about it when the file was loaded into the other buffer.
+        if ( wxRichTextStyleSheet* const sheet = loaded.GetStyleSheet() )
+        {
+            loaded.SetStyleSheet(nullptr);
+            buffer.SetStyleSheetAndNotify(sheet);
+        }
+
+        buffer.UpdateRanges();
+        buffer.Invalidate(wxRICHTEXT_ALL);
+
+        m_filename = load->filename;
+
+        DiscardEdits();
+        SetInsertionPoint(0);
+        LayoutContent();
+        PositionCaret();
+        SetupScrollbars(true);
+        Refresh(false);
+        wxTextCtrl::SendTextUpdatedEvent(this);
+    }
+    else
+    {
+        wxLogError(_("File couldn't be loaded."));
+    }
+
+    wxRichTextEvent event(wxEVT_RICHTEXT_FILE_LOADED, GetId());
+    event.SetEventObject(this);
+    event.SetString(load->filename);
+    event.SetInt(load->success);
+    GetEventHandler()->ProcessEvent(event);
+}
+
 bool wxRichTextCtrl::DoSaveFile(const wxString& filename, int fileType)
 {
     if (GetBuffer().SaveFile(filename, (wxRichTextFileType)fileType))
@@ -3387,7 +3664,7 @@ wxRichTextBox* wxRichTextCtrl::WriteTextBox(const wxRichTextAttr& textAttr)
     textBox->SetParent(nullptr);
 
     // If the box has an invalid foreground colour, its text will mimic any upstream value (see #15224)
-    if (!textBox->GetAttributes().GetTextColour().IsOk())
+    if (!textBox->GetSharedAttributes().GetTextColour().IsOk())
     {
         textBox->GetAttributes().SetTextColour(GetBasicStyle().GetTextColour());
     }
@@ -4111,7 +4388,7 @@ bool wxRichTextCtrl::SetFont(const wxFont& font)
 {
     wxControl::SetFont(font);
 
-    wxRichTextAttr attr = GetBuffer().GetAttributes();
+    wxRichTextAttr attr = GetBuffer().GetSharedAttributes();
     attr.SetFont(font);
     GetBuffer().SetBasicStyle(attr);
 
@@ -4268,43 +4545,72 @@ bool wxRichTextCtrl::MoveCaret(long pos, bool showAtLineStart, wxRichTextParagra
 /// setting the caret position.
 bool wxRichTextCtrl::LayoutContent(bool onlyVisibleRect)
 {
-    if (GetBuffer().IsDirty() || onlyVisibleRect)
-    {
-        wxRect availableSpace(GetUnscaledSize(GetClientSize()));
-        if (availableSpace.width == 0)
-            availableSpace.width = 10;
-        if (availableSpace.height == 0)
-            availableSpace.height = 10;
+    if (onlyVisibleRect)
+        DoLayoutContent(LayoutContent_VisibleRect);
+    else if (GetBuffer().IsDirty() || GetBuffer().HasDeferredLayout())
+        DoLayoutContent(LayoutContent_Full);
 
-        int flags = wxRICHTEXT_FIXED_WIDTH|wxRICHTEXT_VARIABLE_HEIGHT;
-        if (onlyVisibleRect)
-        {
-            flags |= wxRICHTEXT_LAYOUT_SPECIFIED_RECT;
-            availableSpace.SetPosition(GetUnscaledPoint(GetLogicalPoint(wxPoint(0, 0))));
-        }
+    return true;
+}
 
-        wxClientDC dc(this);
+/// Layout the buffer after editing it, deferring the layout of the part of
+/// a large buffer below the visible area until idle time.
+bool wxRichTextCtrl::LayoutContentIncrementally()
+{
+    if (GetBuffer().GetOwnRange().GetEnd() <= m_delayedLayoutThreshold)
+        return LayoutContent();
 
-        PrepareDC(dc);
-        dc.SetFont(GetFont());
-        dc.SetUserScale(GetScale(), GetScale());
+    if (GetBuffer().IsDirty())
+        DoLayoutContent(LayoutContent_Visible);
 
-        wxRichTextDrawingContext context(& GetBuffer());
-        GetBuffer().Defragment(context);
-        GetBuffer().UpdateRanges();     // If items were deleted, ranges need recalculation
-        DoLayoutBuffer(GetBuffer(), dc, context, availableSpace, availableSpace, flags);
-        GetBuffer().Invalidate(wxRICHTEXT_NONE);
+    return true;
+}
 
-        dc.SetUserScale(1.0, 1.0);
+void wxRichTextCtrl::DoLayoutContent(LayoutContentMode mode)
+{
+    wxRect availableSpace(GetUnscaledSize(GetClientSize()));
+    if (availableSpace.width == 0)
+        availableSpace.width = 10;
+    if (availableSpace.height == 0)
+        availableSpace.height = 10;
 
-        if (!IsFrozen() && !onlyVisibleRect)
-            SetupScrollbars();
+    int flags = wxRICHTEXT_FIXED_WIDTH|wxRICHTEXT_VARIABLE_HEIGHT;
+    if (mode == LayoutContent_VisibleRect)
+    {
+        flags |= wxRICHTEXT_LAYOUT_SPECIFIED_RECT;
+        availableSpace.SetPosition(GetUnscaledPoint(GetLogicalPoint(wxPoint(0, 0))));
+    }
+
+    wxClientDC dc(this);
+
+    PrepareDC(dc);
+    dc.SetFont(GetFont());
+    dc.SetUserScale(GetScale(), GetScale());
 
-        if (GetDelayedImageLoading())
-            RequestDelayedImageProcessing();
+    wxRichTextDrawingContext context(& GetBuffer());
+    if (mode == LayoutContent_Visible)
+    {
+        const int visibleBottom = GetUnscaledPoint(GetLogicalPoint(wxPoint(0, 0))).y +
+                                    availableSpace.height;
+        context.EnableIncrementalLayout(true, visibleBottom);
+    }
+    else if (mode == LayoutContent_TimeSlice)
+    {
+        context.EnableIncrementalLayout(true, -1, wxRICHTEXT_DEFAULT_LAYOUT_TIME_SLICE);
     }
 
-    return true;
+    GetBuffer().Defragment(context);
+    GetBuffer().UpdateRanges();     // If items were deleted, ranges need recalculation
+    DoLayoutBuffer(GetBuffer(), dc, context, availableSpace, availableSpace, flags);
+    GetBuffer().Invalidate(wxRICHTEXT_NONE);
+
+    dc.SetUserScale(1.0, 1.0);
+
+    if (!IsFrozen() && mode != LayoutContent_VisibleRect)
+        SetupScrollbars();
+
+    if (GetDelayedImageLoading())
+        RequestDelayedImageProcessing();
 }
 
 void wxRichTextCtrl::DoLayoutBuffer(wxRichTextBuffer& buffer, wxDC& dc, wxRichTextDrawingContext& context, const wxRect& rect, const wxRect& parentRect, int flags)
@@ -4760,14 +5066,14 @@ wxRichTextRange wxRichTextCtrl::FindRangeForList(long pos, bool& isNumberedList)
     wxRichTextParagraphLayoutBox* focusObject = GetFocusObject();
     wxRichTextRange range = wxRichTextRange(-1, -1);
     wxRichTextParagraph* para = focusObject->GetParagraphAtPosition(pos);
-    if (!para || !para->GetAttributes().HasListStyleName())
+    if (!para || !para->GetSharedAttributes().HasListStyleName())
         return range;
     else
     {
-        wxString listStyle = para->GetAttributes().GetListStyleName();
+        wxString listStyle = para->GetSharedAttributes().GetListStyleName();
         range = para->GetRange();
 
-        isNumberedList = para->GetAttributes().HasBulletNumber();
+        isNumberedList = para->GetSharedAttributes().HasBulletNumber();
 
         // Search back
         wxRichTextObjectList::compatibility_iterator initialNode = focusObject->GetChildren().Find(para);
@@ -4779,7 +5085,7 @@ wxRichTextRange wxRichTextCtrl::FindRangeForList(long pos, bool& isNumberedList)
                 wxRichTextParagraph* p = wxDynamicCast(startNode->GetData(), wxRichTextParagraph);
                 if (p)
                 {
-                    if (!p->GetAttributes().HasListStyleName() || p->GetAttributes().GetListStyleName() != listStyle)
+                    if (!p->GetSharedAttributes().HasListStyleName() || p->GetSharedAttributes().GetListStyleName() != listStyle)
                         break;
                     else
                         range.SetStart(p->GetRange().GetStart());
@@ -4795,7 +5101,7 @@ wxRichTextRange wxRichTextCtrl::FindRangeForList(long pos, bool& isNumberedList)
                 wxRichTextParagraph* p = wxDynamicCast(endNode->GetData(), wxRichTextParagraph);
                 if (p)
                 {
-                    if (!p->GetAttributes().HasListStyleName() || p->GetAttributes().GetListStyleName() != listStyle)
+                    if (!p->GetSharedAttributes().HasListStyleName() || p->GetSharedAttributes().GetListStyleName() != listStyle)
                         break;
                     else
                         range.SetEnd(p->GetRange().GetEnd());
@@ -4952,8 +5258,8 @@ bool wxRichTextCtrl::DoSetMargins(const wxPoint& pt)
 
 wxPoint wxRichTextCtrl::DoGetMargins() const
 {
-    return wxPoint(GetBuffer().GetAttributes().GetTextBoxAttr().GetMargins().GetLeft().GetValue(),
-                   GetBuffer().GetAttributes().GetTextBoxAttr().GetMargins().GetTop().GetValue());
+    return wxPoint(GetBuffer().GetSharedAttributes().GetTextBoxAttr().GetMargins().GetLeft().GetValue(),
+                   GetBuffer().GetSharedAttributes().GetTextBoxAttr().GetMargins().GetTop().GetValue());
 }
 
 bool wxRichTextCtrl::SetFocusObject(wxRichTextParagraphLayoutBox* obj, bool setCaretPosition)
@@ -5270,7 +5576,7 @@ bool wxRichTextCtrl::ProcessDelayedImageLoading(const wxRect& screenRect, wxRich
                             if (marginRect.GetSize() != wxDefaultSize)
                             {
                                 wxClientDC dc(this);
-                                wxRichTextAttr attr(imageObj->GetAttributes());
+                                wxRichTextAttr attr(imageObj->GetSharedAttributes());
                                 imageObj->AdjustAttributes(attr, context);
                                 imageObj->GetBoxRects(dc, & GetBuffer(), attr, marginRect, borderRect, contentRect, paddingRect, outlineRect);
 
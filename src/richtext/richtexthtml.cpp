@@ -91,8 +91,8 @@ bool wxRichTextHTMLHandler::DoSaveFile(wxRichTextBuffer *buffer, wxOutputStream&
     {
         wxTextOutputStream str(stream, wxEOL_NATIVE, *conv);
 
-        wxRichTextAttr currentParaStyle = buffer->GetAttributes();
-        wxRichTextAttr currentCharStyle = buffer->GetAttributes();
+        wxRichTextAttr currentParaStyle = buffer->GetSharedAttributes();
+        wxRichTextAttr currentCharStyle = buffer->GetSharedAttributes();
 
         if ((GetFlags() & wxRICHTEXT_HANDLER_NO_HEADER_FOOTER) == 0)
             str << wxT("<html><head></head><body>\n");
@@ -124,7 +124,7 @@ bool wxRichTextHTMLHandler::DoSaveFile(wxRichTextBuffer *buffer, wxOutputStream&
                     wxRichTextPlainText* textObj = wxDynamicCast(obj, wxRichTextPlainText);
                     if (textObj && !textObj->IsEmpty())
                     {
-                        wxRichTextAttr charStyle(para->GetCombinedAttributes(obj->GetAttributes()));
+                        wxRichTextAttr charStyle(para->GetCombinedAttributes(obj->GetSharedAttributes()));
                         BeginCharacterFormatting(currentCharStyle, charStyle, paraStyle, str);
 
                         wxString text = textObj->GetText();
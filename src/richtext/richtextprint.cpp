@@ -34,6 +34,7 @@
 wxRichTextPrintout::wxRichTextPrintout(const wxString& title) : wxPrintout(title)
 {
     m_numPages = wxRICHTEXT_PRINT_MAX_PAGES;
+    m_pageBreaksScale = 0;
 
     SetMargins(); // to default values
 }
@@ -46,18 +47,28 @@ void wxRichTextPrintout::OnPreparePrinting()
 {
     wxBusyCursor wait;
 
+    wxRect rect, headerRect, footerRect;
+
+    /// Sets the DC scaling and returns important page rectangles
+    CalculateScaling(GetDC(), rect, headerRect, footerRect);
+
+    // Reuse the existing page breaks if the buffer was already laid out using
+    // the same page setup and wasn't modified since then, e.g. when printing
+    // the same printout after previewing it.
+    if (GetRichTextBuffer() && !GetRichTextBuffer()->IsDirty() &&
+            rect == m_pageBreaksRect &&
+                GetRichTextBuffer()->GetScale() == m_pageBreaksScale)
+        return;
+
     m_numPages = 1;
 
     m_pageBreaksStart.Clear();
     m_pageBreaksEnd.Clear();
     m_pageYOffsets.Clear();
 
-    int lastStartPos = 0;
+    InvalidatePageBreaks();
 
-    wxRect rect, headerRect, footerRect;
-
-    /// Sets the DC scaling and returns important page rectangles
-    CalculateScaling(GetDC(), rect, headerRect, footerRect);
+    int lastStartPos = 0;
 
     if (GetRichTextBuffer())
     {
@@ -145,6 +156,9 @@ void wxRichTextPrintout::OnPreparePrinting()
         m_pageBreaksStart.Add(lastStartPos);
         m_pageBreaksEnd.Add(GetRichTextBuffer()->GetOwnRange().GetEnd());
         m_pageYOffsets.Add(yOffset);
+
+        m_pageBreaksRect = rect;
+        m_pageBreaksScale = GetRichTextBuffer()->GetScale();
     }
 }
 
@@ -315,6 +329,8 @@ void wxRichTextPrintout::SetMargins(int top, int bottom, int left, int right)
     m_marginBottom = bottom;
     m_marginLeft = left;
     m_marginRight = right;
+
+    InvalidatePageBreaks();
 }
 
 /// Calculate scaling and rectangles, setting the device context scaling
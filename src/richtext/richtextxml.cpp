@@ -56,6 +56,102 @@ namespace
 
 std::unordered_map<wxString, wxString> gs_nodeNameToClassMap;
 
+// Return true if this is the <richtext> root element of the document.
+bool IsRichTextRoot(const wxXmlNode* node)
+{
+    const wxXmlNode* const parent = node->GetParent();
+
+    return parent && parent->GetType() == wxXML_DOCUMENT_NODE &&
+            node->GetType() == wxXML_ELEMENT_NODE &&
+                node->GetName() == wxT("richtext");
+}
+
+// Imports the objects into the buffer while the document is being parsed, so
+// that only the XML nodes of the object being currently parsed need to be
+// kept in memory instead of the nodes for the entire document.
+class wxRichTextXMLStreamingImporter : public wxXmlParseHandler
+{
+public:
+    wxRichTextXMLStreamingImporter(wxRichTextXMLHandler* handler,
+                                   wxRichTextBuffer* buffer)
+        : m_handler(handler),
+          m_buffer(buffer)
+    {
+    }
+
+    virtual bool OnElementParsed(wxXmlNode* node) override
+    {
+        wxXmlNode* const parent = node->GetParent();
+        if ( !parent || node->GetType() != wxXML_ELEMENT_NODE )
+            return false;
+
+        // Top level elements, typically the main paragraph layout box.
+        if ( IsRichTextRoot(parent) )
+        {
+            if ( node == m_layoutNode )
+            {
+                // Its children have been already imported, so we're done.
+                m_layoutNode = nullptr;
+            }
+            else if ( node->GetName() != wxT("richtext-version") )
+            {
+                m_handler->ImportXML(m_buffer, m_buffer, node);
+            }
+
+            return true;
+        }
+
+        // The children of the top level element: import them immediately
+        // instead of waiting until the element itself is fully parsed.
+        if ( !parent->GetParent() || !IsRichTextRoot(parent->GetParent()) )
+            return false;
+
+        if ( parent->GetName() == wxT("richtext-version") ||
+                node->GetName() == wxT("stylesheet") )
+            return false;
+
+        wxRichTextObject* const
+            obj = m_handler->CreateObjectForXMLName(m_buffer, node->GetName());
+        if ( !obj )
+            return false;
+
+        if ( parent != m_layoutNode )
+        {
+            // This is the first object inside this element, import the
+            // element itself now, all its other children, such as the style
+            // sheet or properties, must have been already parsed.
+            m_layoutNode = parent;
+            m_layoutRecurse = false;
+            m_buffer->ImportFromXML(m_buffer, parent, m_handler, &m_layoutRecurse);
+        }
+
+        if ( !m_layoutRecurse )
+        {
+            delete obj;
+            return true;
+        }
+
+        m_buffer->AppendChild(obj);
+        m_handler->ImportXML(m_buffer, obj, node);
+
+        // Don't keep the attributes modified while importing the object
+        // unique to it, there are usually only a few distinct ones.
+        obj->ShareAttributes();
+
+        return true;
+    }
+
+private:
+    wxRichTextXMLHandler* const m_handler;
+    wxRichTextBuffer* const m_buffer;
+
+    // The top level element whose children are being imported, if any.
+    wxXmlNode* m_layoutNode = nullptr;
+
+    // Whether the children of m_layoutNode should be imported at all.
+    bool m_layoutRecurse = false;
+};
+
 } // anonymous namespace
 
 void wxRichTextXMLHandler::Init()
@@ -73,41 +169,15 @@ bool wxRichTextXMLHandler::DoLoadFile(wxRichTextBuffer *buffer, wxInputStream& s
     buffer->ResetAndClearCommands();
     buffer->Clear();
 
-    wxXmlDocument* xmlDoc = new wxXmlDocument;
-    bool success = true;
+    // Objects are created while parsing, so we only need to check that the
+    // document was a valid one once it has been fully loaded.
+    wxRichTextXMLStreamingImporter importer(this, buffer);
 
-    if (!xmlDoc->Load(stream))
-    {
+    wxXmlDocument xmlDoc;
+    bool success = xmlDoc.Load(stream, importer) &&
+                    xmlDoc.GetRoot() && IsRichTextRoot(xmlDoc.GetRoot());
+    if (!success)
         buffer->ResetAndClearCommands();
-        success = false;
-    }
-    else
-    {
-        if (xmlDoc->GetRoot() && xmlDoc->GetRoot()->GetType() == wxXML_ELEMENT_NODE && xmlDoc->GetRoot()->GetName() == wxT("richtext"))
-        {
-            wxXmlNode* child = xmlDoc->GetRoot()->GetChildren();
-            while (child)
-            {
-                if (child->GetType() == wxXML_ELEMENT_NODE)
-                {
-                    wxString name = child->GetName();
-                    if (name == wxT("richtext-version"))
-                    {
-                    }
-                    else
-                        ImportXML(buffer, buffer, child);
-                }
-
-                child = child->GetNext();
-            }
-        }
-        else
-        {
-            success = false;
-        }
-    }
-
-    delete xmlDoc;
 
     buffer->UpdateRanges();
 
@@ -2228,7 +2298,7 @@ wxString wxRichTextXMLHelper::AddAttributes(const wxRichTextAttr& attr, bool isP
 // Create a string containing style attributes, plus further object 'attributes' (shown, id)
 wxString wxRichTextXMLHelper::AddAttributes(wxRichTextObject* obj, bool isPara)
 {
-    wxString style = AddAttributes(obj->GetAttributes(), isPara);
+    wxString style = AddAttributes(obj->GetSharedAttributes(), isPara);
     if (!obj->IsShown())
         style << wxT(" show=\"0\"");
     return style;
@@ -122,11 +122,95 @@ public:
     SurfaceData* GetSurfaceFontData() const { return m_surfaceFontData; }
     void SetSurfaceFontData(SurfaceData* data) { m_surfaceFontData=data; }
 
+    // Range of the characters for which GetAsciiWidths() returns the widths.
+    enum
+    {
+        AsciiFirst = 0x20,
+        AsciiLast = 0x7e
+    };
+
+    // Return the widths of the printable ASCII characters when using this
+    // font, which must be selected into the given DC, or null if the text
+    // extents can't be computed by just adding them because this font uses
+    // kerning or ligatures for these characters.
+    const int* GetAsciiWidths(wxDC& dc);
+
 private:
     int m_ascent;
     SurfaceData* m_surfaceFontData;
+
+    // The cache used by GetAsciiWidths() and the DC parameters for which it
+    // was computed: it needs to be recomputed if they change.
+    enum class AsciiWidthsState
+    {
+        Unknown,
+        Valid,
+        Unusable
+    };
+
+    AsciiWidthsState m_asciiWidthsState = AsciiWidthsState::Unknown;
+    wxSize m_asciiWidthsPPI;
+    double m_asciiWidthsScale = 0.0;
+    int m_asciiWidths[AsciiLast - AsciiFirst + 1];
 };
 
+const int* wxFontWithAscent::GetAsciiWidths(wxDC& dc)
+{
+    double scaleX, scaleY;
+    dc.GetUserScale(&scaleX, &scaleY);
+
+    const wxSize ppi = dc.GetPPI();
+    const double scale = scaleX * dc.GetContentScaleFactor();
+    if ( m_asciiWidthsState != AsciiWidthsState::Unknown &&
+            (ppi != m_asciiWidthsPPI || scale != m_asciiWidthsScale) )
+    {
+        m_asciiWidthsState = AsciiWidthsState::Unknown;
+    }
+
+    if ( m_asciiWidthsState == AsciiWidthsState::Unknown )
+    {
+        m_asciiWidthsPPI = ppi;
+        m_asciiWidthsScale = scale;
+
+        for ( int c = AsciiFirst; c <= AsciiLast; c++ )
+        {
+            int h;
+            dc.GetTextExtent(wxString(static_cast<char>(c)),
+                             &m_asciiWidths[c - AsciiFirst], &h);
+        }
+
+        // Check that the widths of the individual characters can be just
+        // added together for a string containing all of them and the pairs
+        // most likely to be kerned or combined into ligatures.
+        wxString test;
+        for ( int c = AsciiFirst; c <= AsciiLast; c++ )
+            test += static_cast<char>(c);
+        test += "AVAWAYATLTLVLYPAFATaTeToVaVeWaYaYoffifflfjr.y.\"\"''";
+
+        wxArrayInt positions;
+        m_asciiWidthsState = AsciiWidthsState::Unusable;
+        if ( dc.GetPartialTextExtents(test, positions) &&
+                positions.size() == test.length() )
+        {
+            m_asciiWidthsState = AsciiWidthsState::Valid;
+
+            int pos = 0;
+            for ( size_t n = 0; n < test.length(); n++ )
+            {
+                pos += m_asciiWidths[test[n].GetValue() - AsciiFirst];
+                if ( positions[n] != pos )
+                {
+                    m_asciiWidthsState = AsciiWidthsState::Unusable;
+                    break;
+                }
+            }
+        }
+    }
+
+    return m_asciiWidthsState == AsciiWidthsState::Valid ? m_asciiWidths
+                                                         : nullptr;
+}
+
 void SetAscent(Font& f, int ascent)
 {
     wxFontWithAscent::FromFID(f.GetID())->SetAscent(ascent);
@@ -661,13 +745,43 @@ void SurfaceImpl::DrawTextTransparent(PRectangle rc, Font &font, XYPOSITION ybas
 }
 
 
+// Return the cached widths of the characters to use for measuring the given
+// string, if it consists of printable ASCII characters only and the font
+// allows doing this, or null otherwise.
+static const int*
+GetAsciiWidthsFor(wxDC& dc, Font& font, const char *s, int len)
+{
+    wxFontWithAscent* const fwa = wxFontWithAscent::FromFID(font.GetID());
+    if ( !fwa )
+        return nullptr;
+
+    for ( int i = 0; i < len; i++ ) {
+        const unsigned char c = static_cast<unsigned char>(s[i]);
+        if ( c < wxFontWithAscent::AsciiFirst || c > wxFontWithAscent::AsciiLast )
+            return nullptr;
+    }
+
+    return fwa->GetAsciiWidths(dc);
+}
+
 void SurfaceImpl::MeasureWidths(Font &font, const char *s, int len, XYPOSITION *positions) {
 
+    SetFont(font);
+
+    // Measuring the text is expensive, so avoid doing it for the common case
+    // of ASCII text, for which we can use the cached widths.
+    if ( const int* const widths = GetAsciiWidthsFor(*hdc, font, s, len) ) {
+        int pos = 0;
+        for ( int i = 0; i < len; i++ ) {
+            pos += widths[static_cast<unsigned char>(s[i]) - wxFontWithAscent::AsciiFirst];
+            positions[i] = pos;
+        }
+        return;
+    }
+
     wxString   str = stc2wx(s, len);
     wxArrayInt tpos;
 
-    SetFont(font);
-
     hdc->GetPartialTextExtents(str, tpos);
 
     // Map the widths back to the UTF-8 input string
@@ -701,6 +815,14 @@ void SurfaceImpl::MeasureWidths(Font &font, const char *s, int len, XYPOSITION *
 
 XYPOSITION SurfaceImpl::WidthText(Font &font, const char *s, int len) {
     SetFont(font);
+
+    if ( const int* const widths = GetAsciiWidthsFor(*hdc, font, s, len) ) {
+        int width = 0;
+        for ( int i = 0; i < len; i++ )
+            width += widths[static_cast<unsigned char>(s[i]) - wxFontWithAscent::AsciiFirst];
+        return width;
+    }
+
     int w;
     int h;
 
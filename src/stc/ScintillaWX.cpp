@@ -214,6 +214,7 @@ ScintillaWX::ScintillaWX(wxStyledTextCtrl* win) {
     stc   = win;
     wheelVRotation = 0;
     wheelHRotation = 0;
+    idleWorkQueued = false;
     Initialise();
 #ifdef __WXMSW__
     sysCaretBitmap = 0;
@@ -734,6 +735,23 @@ void ScintillaWX::FineTickerCancel(TickReason reason) {
     }
 }
 
+
+void ScintillaWX::QueueIdleWork(WorkNeeded::workItems items, Sci::Position upTo) {
+    Editor::QueueIdleWork(items, upTo);
+
+    // Do the work, i.e. styling the text after the modified position and
+    // updating the UI, after returning to the event loop, as the other ports
+    // do, instead of never doing it at all. Notice that the pending call is
+    // discarded if the control is destroyed before it happens.
+    if ( !idleWorkQueued ) {
+        idleWorkQueued = true;
+        stc->CallAfter([this]() {
+            idleWorkQueued = false;
+            IdleWork();
+        });
+    }
+}
+
 //----------------------------------------------------------------------
 
 
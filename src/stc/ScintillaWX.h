@@ -151,6 +151,7 @@ public:
     virtual bool FineTickerRunning(TickReason reason) override;
     virtual void FineTickerStart(TickReason reason, int millis, int tolerance) override;
     virtual void FineTickerCancel(TickReason reason) override;
+    virtual void QueueIdleWork(WorkNeeded::workItems items, Sci::Position upTo) override;
 
     // Event delegates
     void DoPaint(wxDC* dc, wxRect rect);
@@ -217,6 +218,9 @@ private:
     int                 wheelHRotation;
     SurfaceData*        m_surfaceData;
 
+    // True if IdleWork() is going to be called soon.
+    bool                idleWorkQueued;
+
     // For use in creating a system caret
     bool HasCaretSizeChanged();
     bool CreateSystemCaret();
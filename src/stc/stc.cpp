@@ -5215,6 +5215,186 @@ wxStyledTextCtrl::DoSaveFile(const wxString& filename, int WXUNUSED(fileType))
     return false;
 }
 
+#if wxUSE_FFILE || wxUSE_FILE
+
+namespace
+{
+
+#if wxUSE_FFILE
+typedef wxFFile wxSTCFile;
+
+inline bool RewindFile(wxFFile& file) { return file.Seek(0); }
+#else
+typedef wxFile wxSTCFile;
+
+inline bool RewindFile(wxFile& file) { return file.Seek(0) != wxInvalidOffset; }
+#endif
+
+// Set the EOL mode of the control to correspond to the first EOL in the given
+// text, return false if it doesn't contain any EOLs.
+//
+// We only use the first line because there is not much we can do if the file
+// uses inconsistent EOLs anyhow, we'd need to ask the user about the one we
+// should really use and we don't currently provide a way to do it.
+//
+// We also only check for Unix and DOS EOLs but not classic Mac CR-only one as
+// it's obsolete by now.
+template <typename T>
+bool DetectEOLMode(wxStyledTextCtrl& stc, const T* text, size_t len, T prev)
+{
+    for ( size_t n = 0; n < len; n++ )
+    {
+        if ( text[n] == '\n' )
+        {
+            // Set EOL mode to ensure that the new lines inserted into the
+            // text use the same EOLs as the existing ones.
+            if ( (n > 0 ? text[n - 1] : prev) == '\r' )
+                stc.SetEOLMode(wxSTC_EOL_CRLF);
+            else
+                stc.SetEOLMode(wxSTC_EOL_LF);
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// Return the length of the prefix of the given buffer not ending in the
+// middle of a UTF-8 sequence.
+size_t GetCompleteUTF8Length(const char* buf, size_t len)
+{
+    // Find the start of the last sequence, which is at most 4 bytes long.
+    for ( size_t n = 1; n <= 4 && n <= len; n++ )
+    {
+        const unsigned char c = static_cast<unsigned char>(buf[len - n]);
+        if ( (c & 0xC0) == 0x80 )
+            continue; // continuation byte
+
+        size_t seqLen;
+        if ( c < 0x80 )
+            seqLen = 1;
+        else if ( (c & 0xE0) == 0xC0 )
+            seqLen = 2;
+        else if ( (c & 0xF0) == 0xE0 )
+            seqLen = 3;
+        else
+            seqLen = 4;
+
+        return seqLen > n ? len - n : len;
+    }
+
+    // Either empty or invalid, which will be detected by the caller anyhow.
+    return len;
+}
+
+// Load the file contents directly into the document if it is in UTF-8, which
+// is the encoding used by Scintilla internally, without converting it to
+// wxString, or return false if it isn't, leaving the control empty in this
+// case.
+bool LoadUTF8File(wxStyledTextCtrl& stc, wxSTCFile& file)
+{
+    // Read the file in chunks of this size.
+    static const size_t CHUNK_SIZE = 1024*1024;
+
+    // The buffer contains the bytes carried over from the previous chunk
+    // followed by the new chunk.
+    wxCharBuffer buf(CHUNK_SIZE + 4);
+    size_t carry = 0;
+    bool first = true;
+    bool eolDetected = false;
+    char prev = '\0';
+
+    const bool undoCollection = stc.GetUndoCollection();
+    stc.SetUndoCollection(false);
+    stc.ClearAll();
+
+    const wxFileOffset length = file.Length();
+    if ( length > 0 && length < INT_MAX )
+        stc.Allocate(static_cast<int>(length) + 1);
+
+    bool ok = true;
+    for ( ;; )
+    {
+        const size_t count = file.Read(buf.data() + carry, CHUNK_SIZE);
+        if ( count == static_cast<size_t>(wxInvalidOffset) || file.Error() )
+        {
+            ok = false;
+            break;
+        }
+
+        const char* data = buf.data();
+        size_t len = carry + count;
+
+        if ( first )
+        {
+            first = false;
+
+            static const unsigned char BOM_UTF8[] = { 0xEF, 0xBB, 0xBF };
+            if ( len >= 3 && memcmp(data, BOM_UTF8, 3) == 0 )
+            {
+                data += 3;
+                len -= 3;
+            }
+            else if ( len >= 2 &&
+                        ((data[0] == '\xFF' && data[1] == '\xFE') ||
+                         (data[0] == '\xFE' && data[1] == '\xFF') ||
+                         (data[0] == '\0' && data[1] == '\0')) )
+            {
+                // UTF-16 or UTF-32 BOM.
+                ok = false;
+                break;
+            }
+        }
+
+        // Keep any incomplete sequence at the end for the next chunk, unless
+        // this is the last one.
+        const size_t complete = count ? GetCompleteUTF8Length(data, len) : len;
+
+        if ( complete )
+        {
+            if ( wxConvUTF8.ToWChar(nullptr, 0, data, complete) == wxCONV_FAILED )
+            {
+                ok = false;
+                break;
+            }
+
+            if ( !eolDetected )
+                eolDetected = DetectEOLMode(stc, data, complete, prev);
+            prev = data[complete - 1];
+
+            stc.AppendTextRaw(data, static_cast<int>(complete));
+        }
+
+        carry = len - complete;
+        if ( carry )
+        {
+            if ( !count )
+            {
+                // Incomplete sequence at the end of file.
+                ok = false;
+                break;
+            }
+
+            memmove(buf.data(), data + complete, carry);
+        }
+
+        if ( !count )
+            break;
+    }
+
+    if ( !ok )
+        stc.ClearAll();
+
+    stc.SetUndoCollection(undoCollection);
+
+    return ok;
+}
+
+} // anonymous namespace
+
+#endif // wxUSE_FFILE || wxUSE_FILE
+
 bool
 wxStyledTextCtrl::DoLoadFile(const wxString& filename, int WXUNUSED(fileType))
 {
@@ -5231,26 +5411,22 @@ wxStyledTextCtrl::DoLoadFile(const wxString& filename, int WXUNUSED(fileType))
 
     if ( file.IsOpened() )
     {
+        // Try loading UTF-8 files, which are by far the most common ones,
+        // directly first, as this is much faster for big files.
+        if ( LoadUTF8File(*this, file) )
+        {
+            EmptyUndoBuffer();
+            SetSavePoint();
+
+            return true;
+        }
+
+        // Otherwise read the entire file and let wxConvAuto determine its
+        // encoding.
         wxString text;
-        if ( file.ReadAll(&text, wxConvAuto()) )
+        if ( RewindFile(file) && file.ReadAll(&text, wxConvAuto()) )
         {
-            // Detect the EOL: we use just the first line because there is not
-            // much we can do if the file uses inconsistent EOLs anyhow, we'd
-            // need to ask the user about the one we should really use and we
-            // don't currently provide a way to do it.
-            //
-            // We also only check for Unix and DOS EOLs but not classic Mac
-            // CR-only one as it's obsolete by now.
-            const wxString::size_type posLF = text.find('\n');
-            if ( posLF != wxString::npos )
-            {
-                // Set EOL mode to ensure that the new lines inserted into the
-                // text use the same EOLs as the existing ones.
-                if ( posLF > 0 && text[posLF - 1] == '\r' )
-                    SetEOLMode(wxSTC_EOL_CRLF);
-                else
-                    SetEOLMode(wxSTC_EOL_LF);
-            }
+            DetectEOLMode(*this, text.wc_str(), text.length(), wxT('\0'));
             //else: Use the default EOL for the current platform.
 
             SetValue(text);
@@ -33,6 +33,7 @@
 #include <unistd.h>
 
 #include <dirent.h>
+#include <fcntl.h>              // for AT_SYMLINK_NOFOLLOW
 
 // ----------------------------------------------------------------------------
 // macros
@@ -57,11 +58,15 @@ public:
     void SetFlags(int flags) { m_flags = flags; }
 
     void Rewind() { rewinddir(m_dir); }
-    bool Read(wxString *filename);
+    bool Read(wxString *filename, wxFileStat *stat = nullptr);
 
     const wxString& GetName() const { return m_dirname; }
 
 private:
+    // return true if the given entry is a directory, using its type if it's
+    // available and falling back to checking the full path otherwise
+    bool IsDir(const dirent *de, const wxString& fullname) const;
+
     DIR     *m_dir;
 
     wxString m_dirname;
@@ -109,7 +114,46 @@ wxDirData::~wxDirData()
     }
 }
 
-bool wxDirData::Read(wxString *filename)
+bool wxDirData::IsDir(const dirent *de, const wxString& fullname) const
+{
+#ifdef DT_DIR
+    // avoid calling stat() if the directory entry already gives us the type,
+    // which is the case for all commonly used file systems
+    switch ( de->d_type )
+    {
+        case DT_DIR:
+            return true;
+
+        case DT_LNK:
+            // we need to check what the link points to unless we don't
+            // follow the links at all, in which case it's not a directory
+            if ( m_flags & wxDIR_NO_FOLLOW )
+                return false;
+            break;
+
+        case DT_UNKNOWN:
+            // this file system doesn't provide the type
+            break;
+
+        default:
+            return false;
+    }
+#else // !DT_DIR
+    wxUnusedVar(de);
+#endif // DT_DIR/!DT_DIR
+
+    // notice that we may want to check the type of the path itself and not
+    // whatever it points to in case of a symlink
+    wxFileName fn = wxFileName::DirName(fullname);
+    if ( m_flags & wxDIR_NO_FOLLOW )
+    {
+        fn.DontFollowLink();
+    }
+
+    return fn.DirExists();
+}
+
+bool wxDirData::Read(wxString *filename, wxFileStat *stat)
 {
     dirent *de = nullptr;    // just to silence compiler warnings
     bool matches = false;
@@ -141,23 +185,22 @@ bool wxDirData::Read(wxString *filename)
             break;
         }
 
-        // check the type now: notice that we may want to check the type of
-        // the path itself and not whatever it points to in case of a symlink
-        wxFileName fn = wxFileName::DirName(path + de_d_name);
-        if ( m_flags & wxDIR_NO_FOLLOW )
+        // check the type now if we need to, but only if we're interested in
+        // either files or directories but not both
+        if ( (m_flags & (wxDIR_FILES | wxDIR_DIRS)) != (wxDIR_FILES | wxDIR_DIRS) )
         {
-            fn.DontFollowLink();
-        }
+            const bool isDir = IsDir(de, path + de_d_name);
 
-        if ( !(m_flags & wxDIR_FILES) && !fn.DirExists() )
-        {
-            // it's a file, but we don't want them
-            continue;
-        }
-        else if ( !(m_flags & wxDIR_DIRS) && fn.DirExists() )
-        {
-            // it's a dir, and we don't want it
-            continue;
+            if ( !(m_flags & wxDIR_FILES) && !isDir )
+            {
+                // it's a file, but we don't want them
+                continue;
+            }
+            else if ( !(m_flags & wxDIR_DIRS) && isDir )
+            {
+                // it's a dir, and we don't want it
+                continue;
+            }
         }
 
         // finally, check the name
@@ -175,6 +218,38 @@ bool wxDirData::Read(wxString *filename)
 
     *filename = de_d_name;
 
+    if ( stat )
+    {
+#ifdef AT_SYMLINK_NOFOLLOW
+        // use the name relative to the directory to avoid resolving the full
+        // path again, and avoid following symlinks initially to find out if
+        // this entry is one
+        const int fd = dirfd(m_dir);
+
+        wxStructStat st;
+        if ( fstatat(fd, de->d_name, &st, AT_SYMLINK_NOFOLLOW) == 0 )
+        {
+            const bool isSymLink = S_ISLNK(st.st_mode);
+            if ( !isSymLink || (m_flags & wxDIR_NO_FOLLOW) ||
+                    fstatat(fd, de->d_name, &st, 0) == 0 )
+            {
+                stat->SetFromStat(st, isSymLink);
+            }
+            else // dangling symlink
+            {
+                *stat = wxFileStat();
+            }
+        }
+        else
+        {
+            *stat = wxFileStat();
+        }
+#else // !AT_SYMLINK_NOFOLLOW
+        stat->Update(path + de_d_name,
+                     m_flags & wxDIR_NO_FOLLOW ? wxFILE_EXISTS_NO_FOLLOW : 0);
+#endif // AT_SYMLINK_NOFOLLOW/!AT_SYMLINK_NOFOLLOW
+    }
+
     return true;
 }
 
@@ -189,7 +264,8 @@ wxDirData::~wxDirData()
 {
 }
 
-bool wxDirData::Read(wxString * WXUNUSED(filename))
+bool wxDirData::Read(wxString * WXUNUSED(filename),
+                     wxFileStat * WXUNUSED(stat))
 {
     return false;
 }
@@ -263,6 +339,19 @@ void wxDir::Close()
 bool wxDir::GetFirst(wxString *filename,
                      const wxString& filespec,
                      int flags) const
+{
+    return GetFirst(filename, nullptr, filespec, flags);
+}
+
+bool wxDir::GetNext(wxString *filename) const
+{
+    return GetNext(filename, nullptr);
+}
+
+bool wxDir::GetFirst(wxString *filename,
+                     wxFileStat *stat,
+                     const wxString& filespec,
+                     int flags) const
 {
     wxCHECK_MSG( IsOpened(), false, wxT("must wxDir::Open() first") );
 
@@ -271,16 +360,16 @@ bool wxDir::GetFirst(wxString *filename,
     M_DIR->SetFileSpec(filespec);
     M_DIR->SetFlags(flags);
 
-    return GetNext(filename);
+    return GetNext(filename, stat);
 }
 
-bool wxDir::GetNext(wxString *filename) const
+bool wxDir::GetNext(wxString *filename, wxFileStat *stat) const
 {
     wxCHECK_MSG( IsOpened(), false, wxT("must wxDir::Open() first") );
 
     wxCHECK_MSG( filename, false, wxT("bad pointer in wxDir::GetNext()") );
 
-    return M_DIR->Read(filename);
+    return M_DIR->Read(filename, stat);
 }
 
 bool wxDir::HasSubDirs(const wxString& spec) const
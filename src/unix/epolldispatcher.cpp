@@ -68,6 +68,13 @@ static uint32_t GetEpollMask(int flags, int fd)
                    wxT("Registered fd %d for exceptional events"), fd);
     }
 
+    if ( flags & wxFDIO_EDGE_TRIGGERED )
+    {
+        ep |= EPOLLET;
+        wxLogTrace(wxEpollDispatcher_Trace,
+                   wxT("Registered fd %d for edge-triggered events"), fd);
+    }
+
     return ep;
 }
 
@@ -160,6 +167,13 @@ bool wxEpollDispatcher::UnregisterFD(int fd)
     return true;
 }
 
+void wxEpollDispatcher::SetMaxEvents(int maxEvents)
+{
+    wxCHECK_RET( maxEvents > 0, wxT("invalid number of events") );
+
+    m_maxEvents = maxEvents;
+}
+
 int
 wxEpollDispatcher::DoPoll(epoll_event *events, int numEvents, int timeout) const
 {
@@ -204,19 +218,24 @@ bool wxEpollDispatcher::HasPending() const
 
 int wxEpollDispatcher::Dispatch(int timeout)
 {
-    epoll_event events[16];
+    // take the buffer as the handlers called below could dispatch the events
+    // recursively, e.g. by running a nested event loop
+    std::vector<epoll_event> events;
+    events.swap(m_events);
+    events.resize(m_maxEvents);
 
-    const int rc = DoPoll(events, WXSIZEOF(events), timeout);
+    const int rc = DoPoll(events.data(), m_maxEvents, timeout);
 
     if ( rc == -1 )
     {
         wxLogSysError(_("Waiting for IO on epoll descriptor %d failed"),
                       m_epollDescriptor);
+        m_events.swap(events);
         return -1;
     }
 
     int numEvents = 0;
-    for ( epoll_event *p = events; p < events + rc; p++ )
+    for ( const epoll_event *p = events.data(); p < events.data() + rc; p++ )
     {
         wxFDIOHandler * const handler = (wxFDIOHandler *)(p->data.ptr);
         if ( !handler )
@@ -241,6 +260,8 @@ int wxEpollDispatcher::Dispatch(int timeout)
         numEvents++;
     }
 
+    m_events.swap(events);
+
     return numEvents;
 }
 
@@ -18,9 +18,12 @@
 #ifdef wxHAS_INOTIFY
 
 #include <sys/inotify.h>
+#include <errno.h>
 #include <unistd.h>
 #include "wx/private/fswatcher.h"
 
+#include <set>
+#include <string>
 #include <unordered_map>
 
 // ============================================================================
@@ -103,7 +106,19 @@ public:
         int wd = DoAddInotify(watch.get());
         if (wd == -1)
         {
-            wxLogSysError( _("Unable to add inotify watch") );
+            if ( errno == ENOSPC )
+            {
+                // This is common when watching big trees, so give the user a
+                // hint about how to fix it.
+                wxLogError(_("Unable to add inotify watch for \"%s\": the "
+                             "maximal number of watches was reached, consider "
+                             "increasing fs.inotify.max_user_watches."),
+                           watch->GetPath());
+            }
+            else
+            {
+                wxLogSysError( _("Unable to add inotify watch") );
+            }
             return false;
         }
 
@@ -170,13 +185,20 @@ public:
         wxCHECK_MSG( IsOk(), -1,
                     "Inotify not initialized or invalid inotify descriptor" );
 
-        // read events
-        // TODO differentiate depending on params
-        char buf[128 * sizeof(inotify_event)];
+        // read events: use a big enough buffer to get all the events
+        // generated by a burst of activity at once, which also allows to
+        // coalesce more of them below
+        char buf[1024 * sizeof(inotify_event)];
         int left = ReadEventsToBuf(buf, sizeof(buf));
         if (left == -1)
             return -1;
 
+        // (wd, name) of the entries for which we had already sent a modify
+        // event in this batch: inotify itself only merges identical events
+        // if they immediately follow each other, but writing to several files
+        // at once interleaves them and we don't need to report each of them
+        std::set<std::pair<int, std::string>> modified;
+
         // left > 0, we have events
         char* memory = buf;
         int event_count = 0;
@@ -185,8 +207,25 @@ public:
             event_count++;
             inotify_event* e = (inotify_event*)memory;
 
-            // process one inotify_event
-            ProcessNativeEvent(*e);
+            const std::pair<int, std::string>
+                entry(e->wd, e->len ? e->name : "");
+            if ( (e->mask & ~IN_ISDIR) == IN_MODIFY )
+            {
+                if ( modified.insert(entry).second )
+                    ProcessNativeEvent(*e);
+                else
+                    wxLogTrace(wxTRACE_FSWATCHER, "Coalesced modify event");
+            }
+            else
+            {
+                // Any subsequent modification of this entry must be reported
+                // if something else happened to it in the meanwhile.
+                if ( !modified.empty() )
+                    modified.erase(entry);
+
+                // process one inotify_event
+                ProcessNativeEvent(*e);
+            }
 
             int offset = sizeof(inotify_event) + e->len;
             left -= offset;
@@ -538,7 +577,7 @@ protected:
     void SendEvent(wxFileSystemWatcherEvent& evt)
     {
         wxLogTrace(wxTRACE_FSWATCHER, evt.ToString());
-        m_watcher->GetOwner()->ProcessEvent(evt);
+        m_watcher->DeliverEvent(evt);
     }
 
     int ReadEventsToBuf(char* buf, int size)
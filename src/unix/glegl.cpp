@@ -40,6 +40,7 @@
 #include <EGL/eglext.h>
 
 #include <memory>
+#include <vector>
 
 constexpr const char* TRACE_EGL = "glegl";
 
@@ -645,6 +646,12 @@ bool wxGLCanvasBase::IsExtensionSupported(const char *extension)
     return IsExtensionInList(eglQueryString(dpy, EGL_EXTENSIONS), extension);
 }
 
+/* static */
+void* wxGLCanvasBase::GetGLProcAddress(const char *name)
+{
+    return reinterpret_cast<void*>(eglGetProcAddress(name));
+}
+
 
 /* static */
 EGLConfig wxGLCanvasEGL::InitConfig(const wxGLAttributes& dispAttrs)
@@ -791,32 +798,146 @@ void wxGLCanvasEGL::FreeDefaultConfig()
 // other GL methods
 // ----------------------------------------------------------------------------
 
+namespace
+{
+
+#ifndef EGL_BUFFER_AGE_EXT
+    #define EGL_BUFFER_AGE_EXT 0x313D
+#endif
+
+// Both eglSwapBuffersWithDamageKHR() and eglSetDamageRegionKHR() (as well as
+// eglSwapBuffersWithDamageEXT()) have this signature.
+typedef EGLBoolean (EGLAPIENTRYP wxEGLRectsFunc)(EGLDisplay dpy,
+                                                  EGLSurface surface,
+                                                  const EGLint* rects,
+                                                  EGLint n_rects);
+
+// Return the given function if the extension providing it is available.
+wxEGLRectsFunc wxEGLGetRectsFunc(const char* extension, const char* name)
+{
+    if ( !wxGLCanvasBase::IsExtensionSupported(extension) )
+        return nullptr;
+
+    return reinterpret_cast<wxEGLRectsFunc>(eglGetProcAddress(name));
+}
+
+wxEGLRectsFunc wxEGLGetSwapBuffersWithDamage()
+{
+    static const wxEGLRectsFunc s_func = []()
+    {
+        wxEGLRectsFunc func = wxEGLGetRectsFunc(
+                                "EGL_KHR_swap_buffers_with_damage",
+                                "eglSwapBuffersWithDamageKHR");
+        if ( !func )
+        {
+            func = wxEGLGetRectsFunc("EGL_EXT_swap_buffers_with_damage",
+                                     "eglSwapBuffersWithDamageEXT");
+        }
+
+        return func;
+    }();
+
+    return s_func;
+}
+
+wxEGLRectsFunc wxEGLGetSetDamageRegion()
+{
+    static const wxEGLRectsFunc s_func =
+        wxEGLGetRectsFunc("EGL_KHR_partial_update", "eglSetDamageRegionKHR");
+
+    return s_func;
+}
+
+bool wxEGLHasBufferAge()
+{
+    // Partial update extension also allows querying the buffer age.
+    static const bool s_hasBufferAge =
+        wxGLCanvasBase::IsExtensionSupported("EGL_EXT_buffer_age") ||
+        wxGLCanvasBase::IsExtensionSupported("EGL_KHR_partial_update");
+
+    return s_hasBufferAge;
+}
+
+} // anonymous namespace
+
+bool wxGLCanvasEGL::SetSwapInterval(int interval)
+{
+    // EGL doesn't support adaptive vsync.
+    if ( interval < 0 )
+        return false;
+
+    // We can't call eglSwapInterval() right now as it applies to the surface
+    // of the current context, which might not be ours, so do it the next
+    // time SwapBuffers() is called.
+    m_swapInterval = interval;
+    m_swapIntervalSet = false;
+
+    return true;
+}
+
+int wxGLCanvasEGL::GetBufferAge()
+{
+    if ( !m_surface || !wxEGLHasBufferAge() )
+        return -1;
+
+    EGLint age = 0;
+    if ( !eglQuerySurface(m_display, m_surface, EGL_BUFFER_AGE_EXT, &age) )
+    {
+        wxLogTrace(TRACE_EGL, "Querying buffer age failed for %p: %#x",
+                   this, eglGetError());
+        return -1;
+    }
+
+    return age;
+}
+
+bool wxGLCanvasEGL::SetDamageRegion(const wxRegion& region)
+{
+    const wxEGLRectsFunc setDamageRegion = wxEGLGetSetDamageRegion();
+    if ( !m_surface || !setDamageRegion )
+        return false;
+
+    const std::vector<int> rects = GetGLRectsFromRegion(region);
+    return setDamageRegion(m_display, m_surface,
+                           rects.data(), rects.size() / 4) == EGL_TRUE;
+}
+
 bool wxGLCanvasEGL::SwapBuffers()
 {
-    // Before doing anything else, ensure that eglSwapBuffers() doesn't block:
-    // under Wayland we don't want it to because we use the surface callback to
-    // know when we should draw anyhow and with X11 it blocks for up to a
-    // second when the window is entirely occluded and because we can't detect
-    // this currently (our IsShownOnScreen() doesn't account for all cases in
-    // which this happens) we must prevent it from blocking to avoid making the
-    // entire application completely unusable just because one of its windows
-    // using wxGLCanvas got occluded or unmapped (e.g. due to a move to another
-    // workspace).
+    return DoSwapBuffers(nullptr);
+}
+
+bool wxGLCanvasEGL::SwapBuffersWithDamage(const wxRegion& damage)
+{
+    return DoSwapBuffers(&damage);
+}
+
+bool wxGLCanvasEGL::DoSwapBuffers(const wxRegion* damage)
+{
+    // Before doing anything else, ensure that eglSwapBuffers() doesn't block
+    // unless the application explicitly requested it by calling
+    // SetSwapInterval(): under Wayland we don't want it to because we use the
+    // surface callback to know when we should draw anyhow and with X11 it
+    // blocks for up to a second when the window is entirely occluded and
+    // because we can't detect this currently (our IsShownOnScreen() doesn't
+    // account for all cases in which this happens) we must prevent it from
+    // blocking to avoid making the entire application completely unusable
+    // just because one of its windows using wxGLCanvas got occluded or
+    // unmapped (e.g. due to a move to another workspace).
     if ( !m_swapIntervalSet )
     {
-        // Ensure that eglSwapBuffers() doesn't block, as we use the surface
-        // callback to know when we should draw ourselves already.
-        if ( eglSwapInterval(m_display, 0) )
+        if ( eglSwapInterval(m_display, m_swapInterval) )
         {
-            wxLogTrace(TRACE_EGL, "Set EGL swap interval to 0 for %p", this);
+            wxLogTrace(TRACE_EGL, "Set EGL swap interval to %d for %p",
+                       m_swapInterval, this);
 
             // It shouldn't be necessary to set it again.
             m_swapIntervalSet = true;
         }
         else
         {
-            wxLogTrace(TRACE_EGL, "eglSwapInterval(0) failed for %p: %#x",
-                       this, eglGetError());
+            wxLogTrace(TRACE_EGL, "eglSwapInterval(%d) failed for %p: %#x",
+                       m_swapInterval, this, eglGetError());
         }
     }
 
@@ -849,6 +970,17 @@ bool wxGLCanvasEGL::SwapBuffers()
 
     wxLogTrace(TRACE_EGL, "Swapping buffers for window %p", this);
 
+    if ( damage )
+    {
+        const wxEGLRectsFunc swapWithDamage = wxEGLGetSwapBuffersWithDamage();
+        if ( swapWithDamage )
+        {
+            const std::vector<int> rects = GetGLRectsFromRegion(*damage);
+            return swapWithDamage(m_display, m_surface,
+                                  rects.data(), rects.size() / 4) == EGL_TRUE;
+        }
+    }
+
     return eglSwapBuffers(m_display, m_surface);
 }
 
@@ -642,6 +642,13 @@ bool wxGLCanvasBase::IsExtensionSupported(const char *extension)
                              extension);
 }
 
+/* static */
+void* wxGLCanvasBase::GetGLProcAddress(const char *name)
+{
+    return reinterpret_cast<void*>(
+                glXGetProcAddress(reinterpret_cast<const GLubyte*>(name)));
+}
+
 
 /* static */
 bool wxGLCanvasX11::IsGLXMultiSampleAvailable()
@@ -772,17 +779,21 @@ int wxGLCanvasX11::GetGLXVersion()
 namespace
 {
 
-// Call glXSwapIntervalEXT() if present.
+#ifndef GLX_BACK_BUFFER_AGE_EXT
+    #define GLX_BACK_BUFFER_AGE_EXT 0x20F4
+#endif
+
+typedef void (*PFNGLXSWAPINTERVALEXTPROC)(Display *dpy,
+                                          GLXDrawable drawable,
+                                          int interval);
+
+// Return glXSwapIntervalEXT() if present.
 //
 // For now just try using EXT_swap_control extension, in principle there is
 // also a MESA one, but it's not clear if it's worth falling back on it (or
 // preferring to use it?).
-void wxGLSetSwapInterval(Display* dpy, GLXDrawable drawable, int interval)
+PFNGLXSWAPINTERVALEXTPROC wxGLGetSwapIntervalFunc()
 {
-    typedef void (*PFNGLXSWAPINTERVALEXTPROC)(Display *dpy,
-                                              GLXDrawable drawable,
-                                              int interval);
-
     static PFNGLXSWAPINTERVALEXTPROC s_glXSwapIntervalEXT = nullptr;
     static bool s_glXSwapIntervalEXTInit = false;
     if ( !s_glXSwapIntervalEXTInit )
@@ -793,11 +804,18 @@ void wxGLSetSwapInterval(Display* dpy, GLXDrawable drawable, int interval)
         s_glXSwapIntervalEXTInit = true;
     }
 
-    if ( s_glXSwapIntervalEXT )
+    return s_glXSwapIntervalEXT;
+}
+
+// Call glXSwapIntervalEXT() if present.
+void wxGLSetSwapInterval(Display* dpy, GLXDrawable drawable, int interval)
+{
+    const PFNGLXSWAPINTERVALEXTPROC func = wxGLGetSwapIntervalFunc();
+    if ( func )
     {
         wxLogTrace(TRACE_GLX, "Setting GLX swap interval to %d", interval);
 
-        s_glXSwapIntervalEXT(dpy, drawable, interval);
+        func(dpy, drawable, interval);
     }
 }
 
@@ -810,11 +828,12 @@ bool wxGLCanvasX11::SwapBuffers()
 
     const auto dpy = wxGetX11Display();
 
-    // Disable blocking in glXSwapBuffers, as this is needed under XWayland for
-    // the reasons explained in wxGLCanvasEGL::SwapBuffers().
+    // Disable blocking in glXSwapBuffers, unless requested otherwise by
+    // SetSwapInterval(), as this is needed under XWayland for the reasons
+    // explained in wxGLCanvasEGL::DoSwapBuffers().
     if ( !m_swapIntervalSet )
     {
-        wxGLSetSwapInterval(dpy, xid, 0);
+        wxGLSetSwapInterval(dpy, xid, m_swapInterval);
 
         // Don't try again in any case, if we failed this time, we'll fail the
         // next one anyhow.
@@ -825,6 +844,37 @@ bool wxGLCanvasX11::SwapBuffers()
     return true;
 }
 
+bool wxGLCanvasX11::SetSwapInterval(int interval)
+{
+    if ( !wxGLGetSwapIntervalFunc() )
+        return false;
+
+    // Negative values enable adaptive vsync, which requires another extension.
+    if ( interval < 0 && !IsExtensionSupported("GLX_EXT_swap_control_tear") )
+        return false;
+
+    // Just remember it, it will be applied by the next SwapBuffers() call, as
+    // we may not have the X11 window yet.
+    m_swapInterval = interval;
+    m_swapIntervalSet = false;
+
+    return true;
+}
+
+int wxGLCanvasX11::GetBufferAge()
+{
+    static const bool s_hasBufferAge = IsExtensionSupported("GLX_EXT_buffer_age");
+
+    const Window xid = GetXWindow();
+    if ( !xid || !s_hasBufferAge )
+        return -1;
+
+    unsigned int age = 0;
+    glXQueryDrawable(wxGetX11Display(), xid, GLX_BACK_BUFFER_AGE_EXT, &age);
+
+    return static_cast<int>(age);
+}
+
 bool wxGLCanvasX11::IsShownOnScreen() const
 {
     return GetXWindow() && wxGLCanvasBase::IsShownOnScreen();
@@ -0,0 +1,701 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        src/unix/iouringdispatcher.cpp
+// Purpose:     implements dispatcher using Linux io_uring interface
+// Author:      wxWidgets team
+// Created:     2026-10-14
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+// ============================================================================
+// declarations
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// headers
+// ----------------------------------------------------------------------------
+
+// for compilers that support precompilation, includes "wx.h".
+#include "wx/wxprec.h"
+
+#if wxUSE_IOURING_DISPATCHER
+
+#include "wx/unix/private/iouringdispatcher.h"
+#include "wx/unix/private.h"
+#include "wx/stopwatch.h"
+
+#ifndef WX_PRECOMP
+    #include "wx/log.h"
+    #include "wx/intl.h"
+#endif
+
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <endian.h>
+#include <errno.h>
+#include <poll.h>
+#include <string.h>
+#include <unistd.h>
+
+#define wxIOUringDispatcher_Trace wxT("iouringdispatcher")
+
+namespace
+{
+
+// The number of submission queue entries, the completion queue is twice as
+// big by default. This limits the number of requests which can be queued
+// before being submitted, but not the number of registered descriptors.
+const unsigned RING_SIZE = 256;
+
+// The user data of the poll requests contains the descriptor in its low
+// part and the entry generation in the high part, except for the highest bit
+// which is set for the update requests.
+const unsigned GENERATION_MASK = 0x7fffffff;
+const __u64 USER_DATA_UPDATE = static_cast<__u64>(1) << 63;
+
+// Completions with this user data correspond to the requests which are not
+// associated with any descriptor and are ignored.
+const __u64 USER_DATA_NONE = 0;
+
+inline __u64 MakeUserData(int fd, unsigned generation)
+{
+    return (static_cast<__u64>(generation) << 32) | static_cast<__u32>(fd);
+}
+
+// Return true if the given poll result corresponds to an event dispatched to
+// the handler.
+inline bool IsEvent(int res)
+{
+    return res > 0 && (res & (POLLIN | POLLHUP | POLLOUT | POLLERR | POLLNVAL));
+}
+
+inline unsigned LoadAcquire(const unsigned* p)
+{
+    return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+}
+
+inline void StoreRelease(unsigned* p, unsigned value)
+{
+    __atomic_store_n(p, value, __ATOMIC_RELEASE);
+}
+
+} // anonymous namespace
+
+// helper: return POLLxxx mask corresponding to the given flags (and also log
+// debugging messages about it)
+static __u32 GetPollMask(int flags, int fd)
+{
+    wxUnusedVar(fd); // unused if wxLogTrace() disabled
+
+    __u32 mask = 0;
+
+    if ( flags & wxFDIO_INPUT )
+    {
+        mask |= POLLIN;
+        wxLogTrace(wxIOUringDispatcher_Trace,
+                   wxT("Registered fd %d for input events"), fd);
+    }
+
+    if ( flags & wxFDIO_OUTPUT )
+    {
+        mask |= POLLOUT;
+        wxLogTrace(wxIOUringDispatcher_Trace,
+                   wxT("Registered fd %d for output events"), fd);
+    }
+
+    if ( flags & wxFDIO_EXCEPTION )
+    {
+        mask |= POLLERR | POLLHUP;
+        wxLogTrace(wxIOUringDispatcher_Trace,
+                   wxT("Registered fd %d for exceptional events"), fd);
+    }
+
+#if __BYTE_ORDER == __BIG_ENDIAN
+    // poll32_events field is stored with its 16 bit halves swapped
+    mask = (mask << 16) | (mask >> 16);
+#endif
+
+    return mask;
+}
+
+// ----------------------------------------------------------------------------
+// wxIOUringDispatcher::Ring
+// ----------------------------------------------------------------------------
+
+struct wxIOUringDispatcher::Ring
+{
+    Ring() = default;
+
+    ~Ring()
+    {
+        if ( sqes != MAP_FAILED )
+            munmap(sqes, sqesSize);
+        if ( cqPtr != MAP_FAILED && cqPtr != sqPtr )
+            munmap(cqPtr, cqSize);
+        if ( sqPtr != MAP_FAILED )
+            munmap(sqPtr, sqSize);
+    }
+
+    // map the rings of the given io_uring descriptor into memory
+    bool Map(int fd, const io_uring_params& params)
+    {
+        sqSize = params.sq_off.array + params.sq_entries*sizeof(__u32);
+        cqSize = params.cq_off.cqes + params.cq_entries*sizeof(io_uring_cqe);
+
+        const bool singleMmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if ( singleMmap )
+        {
+            if ( cqSize > sqSize )
+                sqSize = cqSize;
+            cqSize = sqSize;
+        }
+
+        sqPtr = mmap(nullptr, sqSize, PROT_READ | PROT_WRITE,
+                     MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+        if ( sqPtr == MAP_FAILED )
+            return false;
+
+        if ( singleMmap )
+        {
+            cqPtr = sqPtr;
+        }
+        else
+        {
+            cqPtr = mmap(nullptr, cqSize, PROT_READ | PROT_WRITE,
+                         MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+            if ( cqPtr == MAP_FAILED )
+                return false;
+        }
+
+        sqesSize = params.sq_entries*sizeof(io_uring_sqe);
+        void* const p = mmap(nullptr, sqesSize, PROT_READ | PROT_WRITE,
+                             MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+        if ( p == MAP_FAILED )
+            return false;
+        sqes = static_cast<io_uring_sqe*>(p);
+
+        char* const sq = static_cast<char*>(sqPtr);
+        sqHead = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+        sqTail = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+        sqMask = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+        sqEntries = params.sq_entries;
+
+        // We always use the submission queue entries in order, so the index
+        // array can be initialized once and for all.
+        unsigned* const sqArray = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+        for ( unsigned n = 0; n < sqEntries; n++ )
+            sqArray[n] = n;
+
+        char* const cq = static_cast<char*>(cqPtr);
+        cqHead = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+        cqTail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+        cqMask = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+        cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+
+        return true;
+    }
+
+    bool HasCompletions() const
+    {
+        return *cqHead != LoadAcquire(cqTail);
+    }
+
+    unsigned GetPendingSubmissions() const
+    {
+        return *sqTail - LoadAcquire(sqHead);
+    }
+
+
+    void *sqPtr = MAP_FAILED,
+         *cqPtr = MAP_FAILED;
+    size_t sqSize = 0,
+           cqSize = 0,
+           sqesSize = 0;
+    io_uring_sqe *sqes = static_cast<io_uring_sqe*>(MAP_FAILED);
+
+    unsigned *sqHead = nullptr,
+             *sqTail = nullptr;
+    unsigned sqMask = 0,
+             sqEntries = 0;
+
+    unsigned *cqHead = nullptr,
+             *cqTail = nullptr;
+    unsigned cqMask = 0;
+    io_uring_cqe *cqes = nullptr;
+
+    wxDECLARE_NO_COPY_CLASS(Ring);
+};
+
+// ----------------------------------------------------------------------------
+// wxIOUringDispatcher
+// ----------------------------------------------------------------------------
+
+/* static */
+wxIOUringDispatcher *wxIOUringDispatcher::Create()
+{
+    io_uring_params params;
+    memset(&params, 0, sizeof(params));
+
+    // Failing to create io_uring is not an error, it can be disabled by the
+    // system administrator or forbidden by the seccomp filter, so don't log
+    // anything and just let the caller fall back to another dispatcher.
+    const int ringDescriptor = syscall(__NR_io_uring_setup, RING_SIZE, &params);
+    if ( ringDescriptor == -1 )
+    {
+        wxLogTrace(wxIOUringDispatcher_Trace,
+                   wxT("Failed to create io_uring: %s"), wxSysErrorMsgStr());
+        return nullptr;
+    }
+
+    // We rely on being able to pass timeout to io_uring_enter() directly and
+    // on not losing any completions, which requires Linux 5.11 or later.
+    const __u32 requiredFeatures = IORING_FEAT_EXT_ARG | IORING_FEAT_NODROP;
+    if ( (params.features & requiredFeatures) != requiredFeatures )
+    {
+        wxLogTrace(wxIOUringDispatcher_Trace,
+                   wxT("io_uring features %x are not supported"),
+                   requiredFeatures & ~params.features);
+        close(ringDescriptor);
+        return nullptr;
+    }
+
+    Ring* const ring = new Ring();
+    if ( !ring->Map(ringDescriptor, params) )
+    {
+        wxLogSysError(_("Failed to map io_uring descriptor %d"), ringDescriptor);
+        delete ring;
+        close(ringDescriptor);
+        return nullptr;
+    }
+
+    // Updating the existing poll requests, which is much faster than
+    // removing them and adding new ones, is only supported since Linux 5.13
+    // and there is no feature flag for it, so check if trying to update a
+    // non-existent request fails with ENOENT or with EINVAL.
+    io_uring_sqe* const sqe = &ring->sqes[*ring->sqTail & ring->sqMask];
+    memset(sqe, 0, sizeof(*sqe));
+    sqe->opcode = IORING_OP_POLL_REMOVE;
+    sqe->fd = -1;
+    sqe->addr = USER_DATA_UPDATE;
+    sqe->len = IORING_POLL_UPDATE_EVENTS;
+    sqe->user_data = USER_DATA_NONE;
+    StoreRelease(ring->sqTail, *ring->sqTail + 1);
+
+    bool canUpdate = false;
+    if ( syscall(__NR_io_uring_enter, ringDescriptor, 1, 1,
+                 IORING_ENTER_GETEVENTS, nullptr, 0) == 1 )
+    {
+        const unsigned head = *ring->cqHead;
+        canUpdate = ring->cqes[head & ring->cqMask].res == -ENOENT;
+        StoreRelease(ring->cqHead, head + 1);
+    }
+
+    wxLogTrace(wxIOUringDispatcher_Trace,
+               wxT("io_uring fd %d created (poll update %ssupported)"),
+               ringDescriptor, canUpdate ? wxT("") : wxT("not "));
+    return new wxIOUringDispatcher(ringDescriptor, ring, canUpdate);
+}
+
+wxIOUringDispatcher::wxIOUringDispatcher(int ringDescriptor,
+                                         Ring *ring,
+                                         bool canUpdate)
+    : m_ringDescriptor(ringDescriptor),
+      m_ring(ring),
+      m_canUpdate(canUpdate)
+{
+    wxASSERT_MSG( ringDescriptor != -1, wxT("invalid descriptor") );
+}
+
+wxIOUringDispatcher::~wxIOUringDispatcher()
+{
+    // all the pending requests are cancelled when the descriptor is closed
+    delete m_ring;
+
+    if ( close(m_ringDescriptor) != 0 )
+    {
+        wxLogSysError(_("Error closing io_uring descriptor"));
+    }
+}
+
+io_uring_sqe *wxIOUringDispatcher::GetSQE()
+{
+    if ( m_ring->GetPendingSubmissions() == m_ring->sqEntries )
+    {
+        // the queue is full, submit the requests to make space in it
+        if ( !Enter(0, 0) || m_ring->GetPendingSubmissions() == m_ring->sqEntries )
+            return nullptr;
+    }
+
+    io_uring_sqe* const sqe = &m_ring->sqes[*m_ring->sqTail & m_ring->sqMask];
+    memset(sqe, 0, sizeof(*sqe));
+    return sqe;
+}
+
+void wxIOUringDispatcher::QueuePoll(int fd, const Entry& entry)
+{
+    io_uring_sqe* const sqe = GetSQE();
+    if ( !sqe )
+    {
+        wxLogError(_("Failed to queue poll request for descriptor %d"), fd);
+        return;
+    }
+
+    sqe->opcode = IORING_OP_POLL_ADD;
+    sqe->fd = fd;
+    sqe->poll32_events = entry.events;
+    sqe->user_data = MakeUserData(fd, entry.generation);
+
+    // the request will be submitted by the next call to Enter()
+    StoreRelease(m_ring->sqTail, *m_ring->sqTail + 1);
+}
+
+void
+wxIOUringDispatcher::QueuePollUpdate(int fd,
+                                     unsigned oldGeneration,
+                                     const Entry& entry)
+{
+    io_uring_sqe* const sqe = GetSQE();
+    if ( !sqe )
+    {
+        wxLogError(_("Failed to queue poll request for descriptor %d"), fd);
+        return;
+    }
+
+    sqe->opcode = IORING_OP_POLL_REMOVE;
+    sqe->fd = -1;
+    sqe->len = IORING_POLL_UPDATE_EVENTS | IORING_POLL_UPDATE_USER_DATA;
+    sqe->addr = MakeUserData(fd, oldGeneration);
+    sqe->off = MakeUserData(fd, entry.generation);
+    sqe->poll32_events = entry.events;
+    sqe->user_data = MakeUserData(fd, entry.generation) | USER_DATA_UPDATE;
+
+    StoreRelease(m_ring->sqTail, *m_ring->sqTail + 1);
+}
+
+void wxIOUringDispatcher::QueuePollRemove(int fd, const Entry& entry)
+{
+    io_uring_sqe* const sqe = GetSQE();
+    if ( !sqe )
+        return;
+
+    sqe->opcode = IORING_OP_POLL_REMOVE;
+    sqe->fd = -1;
+    sqe->addr = MakeUserData(fd, entry.generation);
+    sqe->user_data = USER_DATA_NONE;
+
+    StoreRelease(m_ring->sqTail, *m_ring->sqTail + 1);
+}
+
+bool wxIOUringDispatcher::RegisterFD(int fd, wxFDIOHandler* handler, int flags)
+{
+    if ( m_entries.count(fd) )
+    {
+        wxLogError(_("Failed to add descriptor %d to io_uring descriptor %d"),
+                   fd, m_ringDescriptor);
+        return false;
+    }
+
+    const Entry entry = { handler, GetPollMask(flags, fd), NextGeneration() };
+    m_entries[fd] = entry;
+
+    QueuePoll(fd, entry);
+
+    wxLogTrace(wxIOUringDispatcher_Trace,
+               wxT("Added fd %d (handler %p) to io_uring %d"),
+               fd, handler, m_ringDescriptor);
+
+    return true;
+}
+
+bool wxIOUringDispatcher::ModifyFD(int fd, wxFDIOHandler* handler, int flags)
+{
+    const auto it = m_entries.find(fd);
+    if ( it == m_entries.end() )
+    {
+        wxLogError(_("Failed to modify descriptor %d in io_uring descriptor %d"),
+                   fd, m_ringDescriptor);
+        return false;
+    }
+
+    Entry& entry = it->second;
+    entry.handler = handler;
+
+    // there is no need to do anything else if only the handler changes
+    const unsigned events = GetPollMask(flags, fd);
+    if ( events != entry.events )
+    {
+        entry.events = events;
+
+        // the completion of the existing request, if it happens before it's
+        // modified, will be ignored because it has a different generation
+        const unsigned oldGeneration = entry.generation;
+        entry.generation = NextGeneration();
+
+        if ( m_canUpdate )
+        {
+            QueuePollUpdate(fd, oldGeneration, entry);
+        }
+        else
+        {
+            Entry oldEntry = entry;
+            oldEntry.generation = oldGeneration;
+            QueuePollRemove(fd, oldEntry);
+            QueuePoll(fd, entry);
+        }
+    }
+
+    wxLogTrace(wxIOUringDispatcher_Trace,
+               wxT("Modified fd %d (handler: %p) on io_uring %d"),
+               fd, handler, m_ringDescriptor);
+    return true;
+}
+
+bool wxIOUringDispatcher::UnregisterFD(int fd)
+{
+    const auto it = m_entries.find(fd);
+    if ( it == m_entries.end() )
+    {
+        wxLogError(_("Failed to unregister descriptor %d from io_uring descriptor %d"),
+                   fd, m_ringDescriptor);
+        return true;
+    }
+
+    QueuePollRemove(fd, it->second);
+    m_entries.erase(it);
+
+    wxLogTrace(wxIOUringDispatcher_Trace,
+               wxT("removed fd %d from %d"), fd, m_ringDescriptor);
+    return true;
+}
+
+bool wxIOUringDispatcher::Enter(unsigned minComplete, int timeout) const
+{
+    __kernel_timespec ts;
+    io_uring_getevents_arg arg;
+    memset(&arg, 0, sizeof(arg));
+    if ( timeout > 0 )
+    {
+        ts.tv_sec = timeout / 1000;
+        ts.tv_nsec = (timeout % 1000) * 1000000;
+        arg.ts = reinterpret_cast<__u64>(&ts);
+    }
+
+    const int rc = syscall(__NR_io_uring_enter, m_ringDescriptor,
+                           m_ring->GetPendingSubmissions(), minComplete,
+                           IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG,
+                           &arg, sizeof(arg));
+    if ( rc != -1 )
+        return true;
+
+    switch ( errno )
+    {
+        case EINTR:
+        case ETIME:
+            return true;
+
+        case EBUSY:
+            // the completion queue is full, this is not an error either and
+            // just means we need to process the completions first
+            return m_ring->HasCompletions();
+    }
+
+    return false;
+}
+
+unsigned wxIOUringDispatcher::NextGeneration()
+{
+    // generation 0 is never used to ensure that USER_DATA_NONE is never
+    // returned by MakeUserData()
+    m_lastGeneration = (m_lastGeneration + 1) & GENERATION_MASK;
+    if ( !m_lastGeneration )
+        m_lastGeneration = 1;
+
+    return m_lastGeneration;
+}
+
+const wxIOUringDispatcher::Entry *
+wxIOUringDispatcher::FindEntry(wxUint64 userData) const
+{
+    // note that this also returns nullptr for USER_DATA_NONE because the
+    // generation 0 is never used
+    const auto it = m_entries.find(static_cast<int>(userData & 0xffffffff));
+    if ( it == m_entries.end() ||
+            it->second.generation != static_cast<unsigned>(userData >> 32) )
+        return nullptr;
+
+    return &it->second;
+}
+
+bool wxIOUringDispatcher::HasEventCompletions() const
+{
+    bool atHead = true;
+    const unsigned tail = LoadAcquire(m_ring->cqTail);
+    for ( unsigned head = *m_ring->cqHead; head != tail; head++ )
+    {
+        const io_uring_cqe& cqe = m_ring->cqes[head & m_ring->cqMask];
+
+        // the failed update requests are not events, but still need to be
+        // processed, so they can't be discarded
+        bool ignore;
+        if ( cqe.user_data & USER_DATA_UPDATE )
+        {
+            ignore = cqe.res != -ENOENT ||
+                        !FindEntry(cqe.user_data & ~USER_DATA_UPDATE);
+        }
+        else if ( FindEntry(cqe.user_data) )
+        {
+            if ( IsEvent(cqe.res) )
+                return true;
+
+            ignore = false;
+        }
+        else
+        {
+            ignore = true;
+        }
+
+        // this completion would be ignored by ProcessCompletions() anyhow
+        if ( ignore && atHead )
+            StoreRelease(m_ring->cqHead, head + 1);
+        else
+            atHead = false;
+    }
+
+    return false;
+}
+
+bool wxIOUringDispatcher::HasPending() const
+{
+    if ( HasEventCompletions() )
+        return true;
+
+    // submit the queued requests and check if any of them completed already
+    return Enter(0, 0) && HasEventCompletions();
+}
+
+int wxIOUringDispatcher::ProcessCompletions()
+{
+    int numEvents = 0;
+
+    // Don't process the completions added while we're doing it to avoid
+    // looping forever if events keep arriving, and don't cache the head, as
+    // the handlers could call Dispatch() recursively and process some of
+    // the completions themselves.
+    for ( unsigned n = LoadAcquire(m_ring->cqTail) - *m_ring->cqHead; n; n-- )
+    {
+        const unsigned head = *m_ring->cqHead;
+        if ( head == LoadAcquire(m_ring->cqTail) )
+            break;
+
+        const io_uring_cqe& cqe = m_ring->cqes[head & m_ring->cqMask];
+        const __u64 userData = cqe.user_data;
+        const int res = cqe.res;
+
+        StoreRelease(m_ring->cqHead, head + 1);
+
+        const int fd = static_cast<int>(userData & 0xffffffff);
+
+        if ( userData & USER_DATA_UPDATE )
+        {
+            // if the request to update didn't find the existing one, it must
+            // have completed in the meanwhile, so make a new one, unless the
+            // entry had been modified again or removed since then
+            if ( res == -ENOENT )
+            {
+                const Entry* const entry = FindEntry(userData & ~USER_DATA_UPDATE);
+                if ( entry )
+                    QueuePoll(fd, *entry);
+            }
+            else if ( res < 0 )
+            {
+                wxLogTrace(wxIOUringDispatcher_Trace,
+                           wxT("Updating poll for fd %d failed: %s"),
+                           fd, wxSysErrorMsgStr(-res));
+            }
+
+            continue;
+        }
+
+        const Entry* entry = FindEntry(userData);
+        if ( !entry )
+        {
+            // the descriptor was unregistered or modified in the meanwhile
+            continue;
+        }
+
+        if ( res < 0 )
+        {
+            // don't rearm the request to avoid getting the same error again
+            wxLogTrace(wxIOUringDispatcher_Trace,
+                       wxT("Polling fd %d failed: %s"),
+                       fd, wxSysErrorMsgStr(-res));
+            continue;
+        }
+
+        wxFDIOHandler * const handler = entry->handler;
+        if ( !handler )
+        {
+            wxFAIL_MSG( wxT("null handler in io_uring entry?") );
+            continue;
+        }
+
+        // note that for compatibility with wxSelectDispatcher we call
+        // OnReadWaiting() on POLLHUP, as wxEpollDispatcher does
+        bool dispatched = true;
+        if ( res & (POLLIN | POLLHUP) )
+            handler->OnReadWaiting();
+        else if ( res & POLLOUT )
+            handler->OnWriteWaiting();
+        else if ( res & (POLLERR | POLLNVAL) )
+            handler->OnExceptionWaiting();
+        else
+            dispatched = false;
+
+        if ( dispatched )
+            numEvents++;
+
+        // the poll request is one-shot, so rearm it unless the handler has
+        // unregistered or modified the descriptor
+        entry = FindEntry(userData);
+        if ( entry )
+            QueuePoll(fd, *entry);
+    }
+
+    return numEvents;
+}
+
+int wxIOUringDispatcher::Dispatch(int timeout)
+{
+    wxMilliClock_t timeEnd;
+    if ( timeout > 0 )
+        timeEnd = wxGetLocalTimeMillis() + timeout;
+
+    for ( ;; )
+    {
+        // don't wait if there are some completions to process already
+        const unsigned minComplete = timeout != 0 && !HasEventCompletions();
+        if ( !Enter(minComplete, timeout) )
+        {
+            wxLogSysError(_("Waiting for IO on io_uring descriptor %d failed"),
+                          m_ringDescriptor);
+            return -1;
+        }
+
+        const int numEvents = ProcessCompletions();
+
+        // we could have got only the completions of the stale requests, in
+        // which case we need to wait again until the timeout expires
+        if ( numEvents || !timeout )
+            return numEvents;
+
+        if ( timeout > 0 )
+        {
+            timeout = wxMilliClockToLong(timeEnd - wxGetLocalTimeMillis());
+            if ( timeout <= 0 )
+                return 0;
+        }
+    }
+}
+
+#endif // wxUSE_IOURING_DISPATCHER
@@ -0,0 +1,88 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        src/unix/mappedfile.cpp
+// Purpose:     wxMappedFile implementation using mmap()
+// Author:      wxWidgets team
+// Created:     2026-10-14
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+// For compilers that support precompilation, includes "wx.h".
+#include "wx/wxprec.h"
+
+
+#if wxUSE_FILE
+
+#ifndef WX_PRECOMP
+    #include "wx/intl.h"
+    #include "wx/log.h"
+#endif // WX_PRECOMP
+
+#include "wx/mappedfile.h"
+#include "wx/filefn.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+bool wxMappedFile::DoOpen(const wxString& filename)
+{
+    const int fd = wxOpen(filename, O_RDONLY, 0);
+    if ( fd == -1 )
+    {
+        wxLogSysError(_("can't open file '%s'"), filename);
+        return false;
+    }
+
+    bool ok = false;
+
+    wxStructStat st;
+    if ( fstat(fd, &st) != 0 )
+    {
+        wxLogSysError(_("can't find length of file on file descriptor %d"), fd);
+    }
+    else if ( !S_ISREG(st.st_mode) )
+    {
+        wxLogError(_("Only regular files can be mapped into memory, "
+                     "\"%s\" is not one."), filename);
+    }
+    else if ( static_cast<wxULongLong_t>(st.st_size) > SIZE_MAX )
+    {
+        wxLogError(_("File \"%s\" is too big to be mapped into memory."),
+                   filename);
+    }
+    else if ( st.st_size == 0 )
+    {
+        // Empty files can't be mapped, but there is nothing to map anyhow.
+        ok = true;
+    }
+    else
+    {
+        const size_t length = static_cast<size_t>(st.st_size);
+        void* const data = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+        if ( data == MAP_FAILED )
+        {
+            wxLogSysError(_("Failed to map file \"%s\" into memory"), filename);
+        }
+        else
+        {
+            m_data = static_cast<const char*>(data);
+            m_length = length;
+            ok = true;
+        }
+    }
+
+    // The mapping remains valid after closing the descriptor.
+    close(fd);
+
+    return ok;
+}
+
+void wxMappedFile::DoClose()
+{
+    if ( munmap(const_cast<char*>(m_data), m_length) != 0 )
+        wxLogSysError(_("Failed to unmap file from memory"));
+}
+
+#endif // wxUSE_FILE
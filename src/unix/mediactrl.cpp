@@ -18,6 +18,7 @@
 
 #if GST_CHECK_VERSION(1,0,0)
 #include <gst/video/video.h>
+#include "wx/unix/private/gstframetap.h"
 #else
 #include <gst/interfaces/xoverlay.h>
 #endif
@@ -147,6 +148,11 @@ public:
     virtual bool SetVolume(double dVolume) override;
     virtual double GetVolume() override;
 
+#if GST_CHECK_VERSION(1,0,0)
+    virtual bool SetFrameCallback(const wxMediaFrameCallback& callback) override;
+    virtual bool GetFrameStats(wxMediaFrameStats* stats) override;
+#endif
+
     //------------implementation from now on-----------------------------------
     bool CheckForErrors();
     bool DoLoad(const wxString& locstring);
@@ -176,6 +182,9 @@ public:
     GstXOverlay*    m_xoverlay;     // X Overlay that contains the GST video
 #endif
     wxMutex         m_asynclock;    // See "discussion of internals"
+#if GST_CHECK_VERSION(1,0,0)
+    wxGStreamerFrameTap m_frameTap; // Gives access to the decoded frames
+#endif
     class wxGStreamerMediaEventHandler* m_eventHandler; // see below
 
     // Mutex protecting just the variables below which are set from
@@ -1141,6 +1150,8 @@ bool wxGStreamerMediaBackend::CreateControl(wxControl* ctrl, wxWindow* parent,
     GstPad *video_sinkpad = gst_element_get_static_pad (videosink, "sink");
     g_signal_connect (video_sinkpad, "notify::caps", G_CALLBACK (gst_notify_caps_callback), this);
     gst_object_unref (video_sinkpad);
+
+    m_frameTap.Attach(videosink);
 #else
     g_signal_connect(m_playbin, "notify::stream-info",
                      G_CALLBACK(gst_notify_stream_info_callback), this);
@@ -1232,6 +1243,10 @@ bool wxGStreamerMediaBackend::DoLoad(const wxString& locstring)
     // free current media resources
     gst_element_set_state (m_playbin, GST_STATE_NULL);
 
+#if GST_CHECK_VERSION(1,0,0)
+    m_frameTap.ResetStats();
+#endif
+
     // Make sure the passed URI is valid and tell playbin to load it
     // non-file uris are encoded
     wxASSERT(gst_uri_protocol_is_valid("file"));
@@ -1554,6 +1569,27 @@ wxLongLong wxGStreamerMediaBackend::GetDownloadTotal()
     return length;
 }
 
+#if GST_CHECK_VERSION(1,0,0)
+
+//-----------------------------------------------------------------------------
+// wxGStreamerMediaBackend::SetFrameCallback
+// wxGStreamerMediaBackend::GetFrameStats
+//
+// Give access to the frames reaching the video sink, see wxGStreamerFrameTap
+//-----------------------------------------------------------------------------
+bool wxGStreamerMediaBackend::SetFrameCallback(const wxMediaFrameCallback& callback)
+{
+    m_frameTap.SetCallback(callback);
+    return true;
+}
+
+bool wxGStreamerMediaBackend::GetFrameStats(wxMediaFrameStats* stats)
+{
+    return m_frameTap.GetStats(stats);
+}
+
+#endif // GST_CHECK_VERSION(1,0,0)
+
 //-----------------------------------------------------------------------------
 // wxGStreamerMediaBackend::SetVolume
 // wxGStreamerMediaBackend::GetVolume
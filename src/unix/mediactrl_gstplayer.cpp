@@ -34,6 +34,8 @@ wxGCC_WARNING_SUPPRESS(cast-qual)
 #include <gst/player/player.h>      // main gstreamer player header
 wxGCC_WARNING_RESTORE()
 
+#include "wx/unix/private/gstframetap.h"
+
 //=============================================================================
 //  Declarations
 //=============================================================================
@@ -92,18 +94,23 @@ public:
     virtual wxLongLong GetDownloadProgress() override;
     virtual wxLongLong GetDownloadTotal() override;
 
+    virtual bool SetFrameCallback(const wxMediaFrameCallback& callback) override;
+    virtual bool GetFrameStats(wxMediaFrameStats* stats) override;
+
     bool DoLoad(const wxString& locstring);
     wxMediaCtrl* GetControl() { return m_ctrl; } // for C Callbacks
 
     void VideoDimensionsChanged(int width, int height);
     void StateChanged(GstPlayerState state);
     void EndOfStream();
+    void VideoSinkChanged();
 
     GstPlayer              *m_player;
     GstPlayerVideoRenderer *m_video_renderer;
     wxSize                  m_videoSize;
     wxMediaState            m_last_state;
     bool                    m_loaded;
+    wxGStreamerFrameTap     m_frameTap;
 
     wxDECLARE_DYNAMIC_CLASS(wxGStreamerMediaBackend);
 };
@@ -231,7 +238,13 @@ wxGStreamerMediaBackend::~wxGStreamerMediaBackend()
 {
     m_video_renderer = nullptr;
     if (m_player)
+    {
+        GstElement* const pipeline = gst_player_get_pipeline(m_player);
+        g_signal_handlers_disconnect_by_data(pipeline, this);
+        gst_object_unref(pipeline);
+
         gst_object_unref(m_player);
+    }
     m_player = nullptr;
 }
 
@@ -251,6 +264,11 @@ static void end_of_stream_callback(GstPlayer * WXUNUSED(player), wxGStreamerMedi
     be->EndOfStream();
 }
 
+static void notify_video_sink_callback(GObject * WXUNUSED(pipeline), GParamSpec * WXUNUSED(pspec), wxGStreamerMediaBackend* be)
+{
+    be->VideoSinkChanged();
+}
+
 #define GST_WAYLAND_DISPLAY_HANDLE_CONTEXT_TYPE "GstWaylandDisplayHandleContextType"
 static GstBusSyncReply bus_sync_handler(GstBus * WXUNUSED(bus), GstMessage* msg,  gpointer WXUNUSED(user_data))
 {
@@ -424,6 +442,14 @@ bool wxGStreamerMediaBackend::CreateControl(wxControl* ctrl, wxWindow* parent,
     g_signal_connect(m_player, "state-changed", G_CALLBACK(state_changed_callback), this);
     g_signal_connect(m_player, "end-of-stream", G_CALLBACK(end_of_stream_callback), this);
 
+    // The video sink is created by the renderer, possibly only later, so
+    // check if it's already available and also track any changes to it.
+    GstElement* const pipeline = gst_player_get_pipeline(m_player);
+    g_signal_connect(pipeline, "notify::video-sink", G_CALLBACK(notify_video_sink_callback), this);
+    gst_object_unref(pipeline);
+
+    VideoSinkChanged();
+
     return true;
 }
 
@@ -467,6 +493,7 @@ bool wxGStreamerMediaBackend::DoLoad(const wxString& locstring)
 
     gst_player_stop(m_player);
     m_loaded = false;
+    m_frameTap.ResetStats();
     gst_player_set_uri(m_player, (const char*)locstring.mb_str());
     gst_player_pause(m_player);
 
@@ -513,6 +540,26 @@ void wxGStreamerMediaBackend::EndOfStream()
         QueueFinishEvent();
 }
 
+// Called from any thread.
+void wxGStreamerMediaBackend::VideoSinkChanged()
+{
+    GstElement* const pipeline = gst_player_get_pipeline(m_player);
+
+    GstElement* videosink = nullptr;
+    g_object_get(pipeline, "video-sink", &videosink, nullptr);
+    gst_object_unref(pipeline);
+
+    if (videosink)
+    {
+        m_frameTap.Attach(videosink);
+        gst_object_unref(videosink);
+    }
+    else
+    {
+        m_frameTap.Detach();
+    }
+}
+
 bool wxGStreamerMediaBackend::SetPosition(wxLongLong where)
 {
     gst_player_seek(m_player, where.GetValue() * GST_MSECOND);
@@ -584,6 +631,17 @@ wxLongLong wxGStreamerMediaBackend::GetDownloadTotal()
     return 0;
 }
 
+bool wxGStreamerMediaBackend::SetFrameCallback(const wxMediaFrameCallback& callback)
+{
+    m_frameTap.SetCallback(callback);
+    return true;
+}
+
+bool wxGStreamerMediaBackend::GetFrameStats(wxMediaFrameStats* stats)
+{
+    return m_frameTap.GetStats(stats);
+}
+
 // Force link into main library so this backend can be loaded
 #include "wx/html/forcelnk.h"
 FORCE_LINK_ME(basewxmediabackends)
@@ -0,0 +1,1437 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        src/unix/shmipc.cpp
+// Purpose:     wxIPC implementation using shared memory
+// Author:      wxWidgets team
+// Created:     2026-10-15
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+// ============================================================================
+// declarations
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// headers
+// ----------------------------------------------------------------------------
+
+// For compilers that support precompilation, includes "wx.h".
+#include "wx/wxprec.h"
+
+#include "wx/shmipc.h"
+
+#ifdef wxHAS_SHARED_MEMORY_IPC
+
+#ifndef WX_PRECOMP
+    #include "wx/intl.h"
+    #include "wx/log.h"
+    #include "wx/event.h"
+    #include "wx/module.h"
+    #include "wx/utils.h"
+#endif // WX_PRECOMP
+
+#include "wx/msgqueue.h"
+#include "wx/thread.h"
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <signal.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+// ----------------------------------------------------------------------------
+// constants
+// ----------------------------------------------------------------------------
+
+namespace
+{
+
+// Value stored in the shared blocks once they're fully initialized.
+const wxUint32 SHM_IPC_MAGIC = 0x77784950;
+
+// All waits are done in steps of this duration to be able to notice that the
+// peer process died without notifying us about it.
+const int WAIT_INTERVAL_MS = 100;
+
+// Maximal time to wait for the server to accept a connection.
+const int CONNECT_TIMEOUT_MS = 10000;
+
+const size_t MAX_SEGMENT_NAME_LEN = 128;
+const size_t MAX_TOPIC_LEN = 1024;
+
+// Codes of the messages exchanged between the processes.
+enum MessageCode
+{
+    MSG_EXECUTE = 1,
+    MSG_REQUEST,
+    MSG_POKE,
+    MSG_ADVISE_START,
+    MSG_ADVISE_STOP,
+    MSG_ADVISE,
+    MSG_DISCONNECT,
+
+    // Replies to MSG_REQUEST, MSG_ADVISE_START and MSG_ADVISE_STOP.
+    MSG_REPLY,
+    MSG_FAIL
+};
+
+// States of the connection request in the server control block.
+enum ConnectState
+{
+    Connect_Idle,       // no request
+    Connect_Pending,    // request posted by the client
+    Connect_Processing, // request seen by the server
+    Connect_Accepted,   // the server accepted the connection
+    Connect_Rejected    // or not
+};
+
+// ----------------------------------------------------------------------------
+// helpers for dealing with the shared memory
+// ----------------------------------------------------------------------------
+
+bool IsProcessAlive(pid_t pid)
+{
+    return kill(pid, 0) == 0 || errno != ESRCH;
+}
+
+// Mutex and condition variable which can be used from different processes.
+//
+// Under Linux these objects are implemented using futexes and so waking up
+// the waiting process doesn't involve any system calls if it's not sleeping.
+struct SharedSync
+{
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+
+    // Must be called only once, by the process creating the shared memory.
+    bool Init()
+    {
+        pthread_mutexattr_t mattr;
+        if ( pthread_mutexattr_init(&mattr) != 0 )
+            return false;
+
+        bool ok = pthread_mutexattr_setpshared(&mattr,
+                                               PTHREAD_PROCESS_SHARED) == 0 &&
+                    pthread_mutex_init(&mutex, &mattr) == 0;
+        pthread_mutexattr_destroy(&mattr);
+        if ( !ok )
+            return false;
+
+        pthread_condattr_t cattr;
+        if ( pthread_condattr_init(&cattr) != 0 )
+        {
+            pthread_mutex_destroy(&mutex);
+            return false;
+        }
+
+        ok = pthread_condattr_setpshared(&cattr, PTHREAD_PROCESS_SHARED) == 0 &&
+                pthread_cond_init(&cond, &cattr) == 0;
+        pthread_condattr_destroy(&cattr);
+        if ( !ok )
+        {
+            pthread_mutex_destroy(&mutex);
+            return false;
+        }
+
+        return true;
+    }
+
+    void Lock() { pthread_mutex_lock(&mutex); }
+    void Unlock() { pthread_mutex_unlock(&mutex); }
+
+    // Wake up all processes waiting for this object.
+    void Broadcast() { pthread_cond_broadcast(&cond); }
+
+    // Wait until woken up or the given time elapses, the mutex must be locked.
+    void Wait(int milliseconds)
+    {
+        timespec ts;
+        clock_gettime(CLOCK_REALTIME, &ts);
+
+        ts.tv_sec += milliseconds / 1000;
+        ts.tv_nsec += (milliseconds % 1000) * 1000000L;
+        if ( ts.tv_nsec >= 1000000000L )
+        {
+            ts.tv_sec++;
+            ts.tv_nsec -= 1000000000L;
+        }
+
+        pthread_cond_timedwait(&cond, &mutex, &ts);
+    }
+};
+
+class SharedSyncLocker
+{
+public:
+    explicit SharedSyncLocker(SharedSync& sync) : m_sync(sync) { m_sync.Lock(); }
+    ~SharedSyncLocker() { m_sync.Unlock(); }
+
+private:
+    SharedSync& m_sync;
+
+    wxDECLARE_NO_COPY_CLASS(SharedSyncLocker);
+};
+
+// A POSIX shared memory object mapped into our address space.
+class SharedSegment
+{
+public:
+    SharedSegment() = default;
+
+    ~SharedSegment()
+    {
+        if ( m_data )
+            munmap(m_data, m_size);
+    }
+
+    // Create a new segment of the given size, fails if it already exists.
+    bool Create(const wxString& name, size_t size)
+    {
+        const int fd = shm_open(name.utf8_str(), O_RDWR | O_CREAT | O_EXCL,
+                                S_IRUSR | S_IWUSR);
+        if ( fd == -1 )
+        {
+            wxLogSysError(_("Failed to create shared memory object \"%s\""),
+                          name);
+            return false;
+        }
+
+        if ( ftruncate(fd, size) != 0 )
+        {
+            wxLogSysError(_("Failed to set the size of shared memory object \"%s\""),
+                          name);
+            close(fd);
+            shm_unlink(name.utf8_str());
+            return false;
+        }
+
+        if ( !Map(fd, size, name) )
+        {
+            shm_unlink(name.utf8_str());
+            return false;
+        }
+
+        return true;
+    }
+
+    // Open an existing segment which must be at least of the given size.
+    bool Open(const wxString& name, size_t minSize)
+    {
+        const int fd = shm_open(name.utf8_str(), O_RDWR, 0);
+        if ( fd == -1 )
+            return false;
+
+        struct stat st;
+        if ( fstat(fd, &st) != 0 ||
+                static_cast<wxULongLong_t>(st.st_size) < minSize ||
+                    static_cast<wxULongLong_t>(st.st_size) > SIZE_MAX )
+        {
+            close(fd);
+            return false;
+        }
+
+        return Map(fd, static_cast<size_t>(st.st_size), name);
+    }
+
+    static void Unlink(const wxString& name)
+    {
+        shm_unlink(name.utf8_str());
+    }
+
+    void* GetData() const { return m_data; }
+    size_t GetSize() const { return m_size; }
+
+private:
+    // Map the given descriptor, closing it in any case.
+    bool Map(int fd, size_t size, const wxString& name)
+    {
+        void* const data = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                                MAP_SHARED, fd, 0);
+        close(fd);
+
+        if ( data == MAP_FAILED )
+        {
+            wxLogSysError(_("Failed to map shared memory object \"%s\""), name);
+            return false;
+        }
+
+        m_data = data;
+        m_size = size;
+
+        return true;
+    }
+
+    void* m_data = nullptr;
+    size_t m_size = 0;
+
+    wxDECLARE_NO_COPY_CLASS(SharedSegment);
+};
+
+// ----------------------------------------------------------------------------
+// layout of the shared memory
+// ----------------------------------------------------------------------------
+
+// Control block created by the server, used by the clients to connect to it.
+struct ControlBlock
+{
+    wxUint32 magic;
+    pid_t serverPid;
+
+    SharedSync sync;
+
+    // All the fields below are protected by the mutex.
+
+    // One of ConnectState values.
+    wxUint32 state;
+
+    // Incremented by each new client request.
+    wxUint32 request;
+
+    // The client making the request and the name of the connection segment
+    // created by it and the topic of the connection, in UTF-8.
+    pid_t clientPid;
+    char segment[MAX_SEGMENT_NAME_LEN];
+    char topic[MAX_TOPIC_LEN];
+};
+
+// Single direction ring buffer header, the data follows the connection block.
+struct RingHeader
+{
+    SharedSync sync;
+
+    // Total numbers of bytes ever written to and read from this buffer.
+    wxUint64 written;
+    wxUint64 read;
+
+    // Set when either side closes the connection.
+    wxUint32 closed;
+};
+
+// Connection block created by the client for each new connection.
+struct ConnectionBlock
+{
+    wxUint32 magic;
+    wxUint32 ringSize;
+
+    pid_t clientPid;
+    pid_t serverPid;
+
+    // Index 0 is used for the data sent from the client to the server and
+    // index 1 in the other direction.
+    RingHeader rings[2];
+};
+
+// Header of each message written to the ring buffer, it is followed by the
+// item string in UTF-8 and then by the data.
+struct MessageHeader
+{
+    wxUint8 code;
+    wxUint8 format;
+    wxUint32 itemLen;
+    wxUint64 dataLen;
+};
+
+// Message read from the ring buffer.
+struct Message
+{
+    MessageCode code = MSG_FAIL;
+    wxIPCFormat format = wxIPC_INVALID;
+    wxString item;
+    std::vector<char> data;
+};
+
+typedef std::shared_ptr<Message> MessagePtr;
+
+wxString GetControlSegmentName(const wxString& serverName)
+{
+    // Shared memory object names must start with a slash and can't contain
+    // any other ones.
+    wxString name(serverName);
+    name.Replace("/", "_");
+
+    return "/wxipc-" + name;
+}
+
+} // anonymous namespace
+
+// ----------------------------------------------------------------------------
+// wxSharedMemoryIPCModule: owns the handler used for dispatching the messages
+// ----------------------------------------------------------------------------
+
+class wxSharedMemoryIPCModule : public wxModule
+{
+public:
+    wxSharedMemoryIPCModule() = default;
+
+    // get the global handler creating it if necessary, this must be called
+    // from the main thread
+    static wxEvtHandler& GetHandler()
+    {
+        if ( !ms_handler )
+            ms_handler = new wxEvtHandler;
+
+        return *ms_handler;
+    }
+
+    // as ms_handler is initialized on demand, don't do anything in OnInit()
+    virtual bool OnInit() override { return true; }
+    virtual void OnExit() override { wxDELETE(ms_handler); }
+
+private:
+    static wxEvtHandler *ms_handler;
+
+    wxDECLARE_DYNAMIC_CLASS(wxSharedMemoryIPCModule);
+    wxDECLARE_NO_COPY_CLASS(wxSharedMemoryIPCModule);
+};
+
+wxIMPLEMENT_DYNAMIC_CLASS(wxSharedMemoryIPCModule, wxModule);
+
+wxEvtHandler *wxSharedMemoryIPCModule::ms_handler = nullptr;
+
+// ----------------------------------------------------------------------------
+// wxSharedMemoryIPCImpl: implementation of the connection
+// ----------------------------------------------------------------------------
+
+class wxSharedMemoryIPCImpl
+{
+public:
+    // Create the object implementing the given connection using the shared
+    // memory segment of the given connection block, which must be already
+    // initialized, and start receiving the messages from the other side.
+    static bool Attach(wxSharedMemoryConnection* conn,
+                       std::unique_ptr<SharedSegment> segment,
+                       bool isServer,
+                       const wxString& topic);
+
+    ~wxSharedMemoryIPCImpl();
+
+    // Send a message to the other side, return false if it failed because the
+    // connection was closed.
+    bool Send(MessageCode code,
+              const wxString& item = wxString(),
+              wxIPCFormat format = wxIPC_INVALID,
+              const void* data = nullptr,
+              size_t size = 0);
+
+    // Wait for the reply to a previously sent message, return null if the
+    // connection was closed before getting it.
+    MessagePtr WaitForReply();
+
+    // Keep the last reply received by Request() alive as long as necessary.
+    void SetLastReply(const MessagePtr& reply) { m_lastReply = reply; }
+
+    // Close the connection, the other side is notified about it but the
+    // messages already written can still be read by it.
+    void Close();
+
+private:
+    // Data shared between the main thread and the reader one.
+    struct State
+    {
+        // Only used in the main thread, reset when the connection is destroyed.
+        wxSharedMemoryConnection* conn = nullptr;
+
+        // Set to stop the reader thread.
+        std::atomic<bool> stop{false};
+
+        // Set by the reader thread when the connection is lost.
+        std::atomic<bool> lost{false};
+
+        // Replies to the messages sent by us are posted here.
+        wxMessageQueue<MessagePtr> replies;
+    };
+
+    class ReaderThread : public wxThread
+    {
+    public:
+        explicit ReaderThread(wxSharedMemoryIPCImpl& impl)
+            : wxThread(wxTHREAD_JOINABLE),
+              m_impl(impl)
+        {
+        }
+
+    protected:
+        virtual void* Entry() override
+        {
+            m_impl.ReadMessages();
+            return nullptr;
+        }
+
+    private:
+        wxSharedMemoryIPCImpl& m_impl;
+    };
+
+    wxSharedMemoryIPCImpl(std::unique_ptr<SharedSegment> segment,
+                          bool isServer,
+                          const wxString& topic);
+
+    ConnectionBlock& GetBlock() const
+    {
+        return *static_cast<ConnectionBlock*>(m_segment->GetData());
+    }
+
+    pid_t GetPeerPid() const
+    {
+        return m_isServer ? GetBlock().clientPid : GetBlock().serverPid;
+    }
+
+    RingHeader& GetRing(bool out) const
+    {
+        return GetBlock().rings[out == m_isServer ? 1 : 0];
+    }
+
+    char* GetRingData(bool out) const
+    {
+        char* const data = static_cast<char*>(m_segment->GetData()) +
+                            sizeof(ConnectionBlock);
+
+        return out == m_isServer ? data + GetBlock().ringSize : data;
+    }
+
+    // Write or read the given number of bytes, blocking until it is done.
+    bool WriteRaw(const void* buf, size_t size);
+    bool ReadRaw(void* buf, size_t size);
+
+    bool ReadMessage(Message& msg);
+
+    // Called in the reader thread, returns when the connection is closed.
+    void ReadMessages();
+
+    // Called in the main thread to dispatch the message to the connection.
+    static void Dispatch(State& state, const Message& msg);
+
+
+    const std::unique_ptr<SharedSegment> m_segment;
+    const bool m_isServer;
+    const wxString m_topic;
+
+    // Used by the reader thread to dispatch the messages, must be initialized
+    // in the main thread.
+    wxEvtHandler& m_handler;
+
+    std::shared_ptr<State> m_state;
+
+    ReaderThread* m_thread = nullptr;
+
+    // Serializes writing messages from different threads.
+    wxCriticalSection m_writeCS;
+
+    MessagePtr m_lastReply;
+
+    wxDECLARE_NO_COPY_CLASS(wxSharedMemoryIPCImpl);
+};
+
+wxSharedMemoryIPCImpl::wxSharedMemoryIPCImpl(std::unique_ptr<SharedSegment> segment,
+                                             bool isServer,
+                                             const wxString& topic)
+    : m_segment(std::move(segment)),
+      m_isServer(isServer),
+      m_topic(topic),
+      m_handler(wxSharedMemoryIPCModule::GetHandler()),
+      m_state(std::make_shared<State>())
+{
+}
+
+/* static */
+bool wxSharedMemoryIPCImpl::Attach(wxSharedMemoryConnection* conn,
+                                   std::unique_ptr<SharedSegment> segment,
+                                   bool isServer,
+                                   const wxString& topic)
+{
+    wxCHECK_MSG( !conn->m_impl, false, "connection already attached" );
+
+    std::unique_ptr<wxSharedMemoryIPCImpl>
+        impl(new wxSharedMemoryIPCImpl(std::move(segment), isServer, topic));
+
+    impl->m_thread = new ReaderThread(*impl);
+    if ( impl->m_thread->Run() != wxTHREAD_NO_ERROR )
+    {
+        wxLogError(_("Failed to start the IPC thread."));
+
+        delete impl->m_thread;
+        impl->m_thread = nullptr;
+
+        return false;
+    }
+
+    impl->m_state->conn = conn;
+    conn->m_impl = impl.release();
+
+    return true;
+}
+
+wxSharedMemoryIPCImpl::~wxSharedMemoryIPCImpl()
+{
+    Close();
+
+    m_state->conn = nullptr;
+}
+
+void wxSharedMemoryIPCImpl::Close()
+{
+    m_state->stop = true;
+
+    for ( RingHeader& ring : GetBlock().rings )
+    {
+        SharedSyncLocker lock(ring.sync);
+        ring.closed = true;
+        ring.sync.Broadcast();
+    }
+
+    if ( m_thread )
+    {
+        m_thread->Wait();
+        wxDELETE(m_thread);
+    }
+}
+
+bool wxSharedMemoryIPCImpl::WriteRaw(const void* buf, size_t size)
+{
+    RingHeader& ring = GetRing(true);
+    char* const data = GetRingData(true);
+    const size_t ringSize = GetBlock().ringSize;
+
+    const char* p = static_cast<const char*>(buf);
+    while ( size )
+    {
+        size_t pos,
+               len;
+
+        {
+            SharedSyncLocker lock(ring.sync);
+            for ( ;; )
+            {
+                if ( ring.closed )
+                    return false;
+
+                const size_t used = static_cast<size_t>(ring.written - ring.read);
+                if ( used < ringSize )
+                {
+                    pos = static_cast<size_t>(ring.written % ringSize);
+                    len = wxMin(size, wxMin(ringSize - used, ringSize - pos));
+                    break;
+                }
+
+                ring.sync.Wait(WAIT_INTERVAL_MS);
+
+                if ( !IsProcessAlive(GetPeerPid()) )
+                    return false;
+            }
+        }
+
+        // Copy the data without holding the lock, this is safe as nobody else
+        // accesses this part of the buffer until we update "written" below.
+        memcpy(data + pos, p, len);
+
+        {
+            SharedSyncLocker lock(ring.sync);
+            ring.written += len;
+            ring.sync.Broadcast();
+        }
+
+        p += len;
+        size -= len;
+    }
+
+    return true;
+}
+
+bool wxSharedMemoryIPCImpl::ReadRaw(void* buf, size_t size)
+{
+    RingHeader& ring = GetRing(false);
+    const char* const data = GetRingData(false);
+    const size_t ringSize = GetBlock().ringSize;
+
+    char* p = static_cast<char*>(buf);
+    while ( size )
+    {
+        size_t pos,
+               len;
+
+        {
+            SharedSyncLocker lock(ring.sync);
+            for ( ;; )
+            {
+                if ( m_state->stop )
+                    return false;
+
+                // Notice that we still read the data written before the other
+                // side closed the connection.
+                const size_t used = static_cast<size_t>(ring.written - ring.read);
+                if ( used )
+                {
+                    pos = static_cast<size_t>(ring.read % ringSize);
+                    len = wxMin(size, wxMin(used, ringSize - pos));
+                    break;
+                }
+
+                if ( ring.closed )
+                    return false;
+
+                ring.sync.Wait(WAIT_INTERVAL_MS);
+
+                if ( !IsProcessAlive(GetPeerPid()) )
+                    return false;
+            }
+        }
+
+        memcpy(p, data + pos, len);
+
+        {
+            SharedSyncLocker lock(ring.sync);
+            ring.read += len;
+            ring.sync.Broadcast();
+        }
+
+        p += len;
+        size -= len;
+    }
+
+    return true;
+}
+
+bool wxSharedMemoryIPCImpl::Send(MessageCode code,
+                                 const wxString& item,
+                                 wxIPCFormat format,
+                                 const void* data,
+                                 size_t size)
+{
+    const wxScopedCharBuffer itemUTF8 = item.utf8_str();
+
+    MessageHeader header;
+    header.code = static_cast<wxUint8>(code);
+    header.format = static_cast<wxUint8>(format);
+    header.itemLen = static_cast<wxUint32>(itemUTF8.length());
+    header.dataLen = size;
+
+    wxCriticalSectionLocker lock(m_writeCS);
+
+    return WriteRaw(&header, sizeof(header)) &&
+            WriteRaw(itemUTF8.data(), header.itemLen) &&
+                WriteRaw(data, size);
+}
+
+bool wxSharedMemoryIPCImpl::ReadMessage(Message& msg)
+{
+    MessageHeader header;
+    if ( !ReadRaw(&header, sizeof(header)) )
+        return false;
+
+    if ( header.dataLen > SIZE_MAX )
+        return false;
+
+    msg.code = static_cast<MessageCode>(header.code);
+    msg.format = static_cast<wxIPCFormat>(header.format);
+
+    if ( header.itemLen )
+    {
+        wxCharBuffer item(header.itemLen);
+        if ( !ReadRaw(item.data(), header.itemLen) )
+            return false;
+
+        msg.item = wxString::FromUTF8(item.data(), header.itemLen);
+    }
+
+    msg.data.resize(static_cast<size_t>(header.dataLen));
+
+    return ReadRaw(msg.data.data(), msg.data.size());
+}
+
+void wxSharedMemoryIPCImpl::ReadMessages()
+{
+    const std::shared_ptr<State> state = m_state;
+
+    bool disconnected = false;
+    for ( ;; )
+    {
+        const MessagePtr msg = std::make_shared<Message>();
+        if ( !ReadMessage(*msg) )
+            break;
+
+        switch ( msg->code )
+        {
+            case MSG_REPLY:
+            case MSG_FAIL:
+                state->replies.Post(msg);
+                continue;
+
+            case MSG_DISCONNECT:
+                disconnected = true;
+                break;
+
+            default:
+                break;
+        }
+
+        m_handler.CallAfter([state, msg]() { Dispatch(*state, *msg); });
+
+        if ( disconnected )
+            break;
+    }
+
+    state->lost = true;
+
+    // Wake up WaitForReply() if it's waiting.
+    state->replies.Post(MessagePtr());
+
+    // If the connection was lost without getting the disconnection message,
+    // e.g. because the other process crashed, we still need to notify our
+    // connection about it, unless it's being closed by us.
+    if ( !disconnected && !state->stop )
+    {
+        const MessagePtr msg = std::make_shared<Message>();
+        msg->code = MSG_DISCONNECT;
+
+        m_handler.CallAfter([state, msg]() { Dispatch(*state, *msg); });
+    }
+}
+
+MessagePtr wxSharedMemoryIPCImpl::WaitForReply()
+{
+    for ( ;; )
+    {
+        MessagePtr msg;
+        switch ( m_state->replies.ReceiveTimeout(WAIT_INTERVAL_MS, msg) )
+        {
+            case wxMSGQUEUE_NO_ERROR:
+                return msg;
+
+            case wxMSGQUEUE_TIMEOUT:
+                if ( m_state->lost )
+                    return MessagePtr();
+                break;
+
+            case wxMSGQUEUE_MISC_ERROR:
+                return MessagePtr();
+        }
+    }
+}
+
+/* static */
+void wxSharedMemoryIPCImpl::Dispatch(State& state, const Message& msg)
+{
+    wxSharedMemoryConnection* const conn = state.conn;
+
+    // Connection could have been already destroyed.
+    if ( !conn )
+        return;
+
+    wxSharedMemoryIPCImpl* const impl = conn->m_impl;
+    const wxString& topic = impl->m_topic;
+
+    // Data pointer which is never null, even for empty data.
+    const void* const data = msg.data.empty() ? "" : msg.data.data();
+    const size_t size = msg.data.size();
+
+    switch ( msg.code )
+    {
+        case MSG_EXECUTE:
+            conn->OnExecute(topic, data, size, msg.format);
+            break;
+
+        case MSG_ADVISE:
+            conn->OnAdvise(topic, msg.item, data, size, msg.format);
+            break;
+
+        case MSG_ADVISE_START:
+            impl->Send(conn->OnStartAdvise(topic, msg.item) ? MSG_REPLY
+                                                            : MSG_FAIL);
+            break;
+
+        case MSG_ADVISE_STOP:
+            impl->Send(conn->OnStopAdvise(topic, msg.item) ? MSG_REPLY
+                                                           : MSG_FAIL);
+            break;
+
+        case MSG_POKE:
+            conn->OnPoke(topic, msg.item, data, size, msg.format);
+            break;
+
+        case MSG_REQUEST:
+            {
+                size_t userSize = wxNO_LEN;
+                const void *userData = conn->OnRequest(topic,
+                                                       msg.item,
+                                                       &userSize,
+                                                       msg.format);
+                if ( !userData )
+                {
+                    impl->Send(MSG_FAIL);
+                    break;
+                }
+
+                if ( userSize == wxNO_LEN )
+                {
+                    switch ( msg.format )
+                    {
+                        case wxIPC_TEXT:
+                        case wxIPC_UTF8TEXT:
+                            userSize = strlen(static_cast<const char *>(userData)) + 1;
+                            break;
+
+                        case wxIPC_UNICODETEXT:
+                            userSize = (wcslen(static_cast<const wchar_t *>(userData)) + 1)
+                                        * sizeof(wchar_t);
+                            break;
+
+                        default:
+                            userSize = 0;
+                    }
+                }
+
+                impl->Send(MSG_REPLY, wxString(), msg.format, userData, userSize);
+            }
+            break;
+
+        case MSG_DISCONNECT:
+            if ( conn->GetConnected() )
+            {
+                impl->Close();
+
+                conn->SetConnected(false);
+                conn->OnDisconnect();
+            }
+            break;
+
+        default:
+            wxLogDebug("Unknown IPC message code %d received.", msg.code);
+            break;
+    }
+}
+
+// ============================================================================
+// wxSharedMemoryConnection implementation
+// ============================================================================
+
+wxIMPLEMENT_DYNAMIC_CLASS(wxSharedMemoryConnection, wxConnectionBase);
+
+wxSharedMemoryConnection::~wxSharedMemoryConnection()
+{
+    Disconnect();
+
+    delete m_impl;
+}
+
+bool wxSharedMemoryConnection::Disconnect()
+{
+    if ( !GetConnected() )
+        return true;
+
+    if ( m_impl )
+    {
+        m_impl->Send(MSG_DISCONNECT);
+        m_impl->Close();
+    }
+
+    SetConnected(false);
+
+    return true;
+}
+
+bool wxSharedMemoryConnection::DoExecute(const void *data,
+                                         size_t size,
+                                         wxIPCFormat format)
+{
+    return m_impl && m_impl->Send(MSG_EXECUTE, wxString(), format, data, size);
+}
+
+const void *wxSharedMemoryConnection::Request(const wxString& item,
+                                              size_t *size,
+                                              wxIPCFormat format)
+{
+    if ( !m_impl || !m_impl->Send(MSG_REQUEST, item, format) )
+        return nullptr;
+
+    const MessagePtr reply = m_impl->WaitForReply();
+    if ( !reply || reply->code != MSG_REPLY )
+        return nullptr;
+
+    // Keep the data alive until the next call to this function.
+    m_impl->SetLastReply(reply);
+
+    if ( size )
+        *size = reply->data.size();
+
+    return reply->data.empty() ? "" : reply->data.data();
+}
+
+bool wxSharedMemoryConnection::DoPoke(const wxString& item,
+                                      const void *data,
+                                      size_t size,
+                                      wxIPCFormat format)
+{
+    return m_impl && m_impl->Send(MSG_POKE, item, format, data, size);
+}
+
+bool wxSharedMemoryConnection::StartAdvise(const wxString& item)
+{
+    if ( !m_impl || !m_impl->Send(MSG_ADVISE_START, item) )
+        return false;
+
+    const MessagePtr reply = m_impl->WaitForReply();
+
+    return reply && reply->code == MSG_REPLY;
+}
+
+bool wxSharedMemoryConnection::StopAdvise(const wxString& item)
+{
+    if ( !m_impl || !m_impl->Send(MSG_ADVISE_STOP, item) )
+        return false;
+
+    const MessagePtr reply = m_impl->WaitForReply();
+
+    return reply && reply->code == MSG_REPLY;
+}
+
+bool wxSharedMemoryConnection::DoAdvise(const wxString& item,
+                                        const void *data,
+                                        size_t size,
+                                        wxIPCFormat format)
+{
+    return m_impl && m_impl->Send(MSG_ADVISE, item, format, data, size);
+}
+
+// ============================================================================
+// wxSharedMemoryServer implementation
+// ============================================================================
+
+class wxSharedMemoryServerImpl
+{
+public:
+    wxSharedMemoryServerImpl() = default;
+    ~wxSharedMemoryServerImpl();
+
+    bool Create(wxSharedMemoryServer* server, const wxString& serverName);
+
+private:
+    // Data shared with the listening thread and the pending callbacks.
+    struct State
+    {
+        // Only used in the main thread, reset when the server is destroyed.
+        wxSharedMemoryServer* server = nullptr;
+
+        std::atomic<bool> stop{false};
+
+        SharedSegment control;
+
+        ControlBlock& GetControl() const
+        {
+            return *static_cast<ControlBlock*>(control.GetData());
+        }
+    };
+
+    class ListenerThread : public wxThread
+    {
+    public:
+        ListenerThread(const std::shared_ptr<State>& state, wxEvtHandler& handler)
+            : wxThread(wxTHREAD_JOINABLE),
+              m_state(state),
+              m_handler(handler)
+        {
+        }
+
+    protected:
+        virtual void* Entry() override;
+
+    private:
+        const std::shared_ptr<State> m_state;
+        wxEvtHandler& m_handler;
+    };
+
+    // Called in the main thread to handle the connection request.
+    static void Accept(State& state,
+                       wxUint32 request,
+                       const wxString& segmentName,
+                       const wxString& topic);
+
+    std::shared_ptr<State> m_state;
+    ListenerThread* m_thread = nullptr;
+    wxString m_name;
+
+    wxDECLARE_NO_COPY_CLASS(wxSharedMemoryServerImpl);
+};
+
+bool
+wxSharedMemoryServerImpl::Create(wxSharedMemoryServer* server,
+                                 const wxString& serverName)
+{
+    const wxString name = GetControlSegmentName(serverName);
+
+    std::shared_ptr<State> state = std::make_shared<State>();
+
+    // Check if there is an existing object with the same name: if its server
+    // is still running, we can't create another one, but if it isn't, this
+    // object must have been left over after a crash and can be reused.
+    {
+        SharedSegment existing;
+        if ( existing.Open(name, sizeof(ControlBlock)) )
+        {
+            const ControlBlock&
+                ctl = *static_cast<ControlBlock*>(existing.GetData());
+            if ( ctl.magic == SHM_IPC_MAGIC && IsProcessAlive(ctl.serverPid) )
+            {
+                wxLogError(_("IPC server \"%s\" is already running."),
+                           serverName);
+                return false;
+            }
+
+            SharedSegment::Unlink(name);
+        }
+    }
+
+    if ( !state->control.Create(name, sizeof(ControlBlock)) )
+        return false;
+
+    ControlBlock& ctl = state->GetControl();
+    if ( !ctl.sync.Init() )
+    {
+        wxLogError(_("Process-shared synchronization objects are not supported."));
+        SharedSegment::Unlink(name);
+        return false;
+    }
+
+    ctl.serverPid = getpid();
+    ctl.state = Connect_Idle;
+    ctl.request = 0;
+    ctl.magic = SHM_IPC_MAGIC;
+
+    state->server = server;
+
+    m_thread = new ListenerThread(state,
+                                  wxSharedMemoryIPCModule::GetHandler());
+    if ( m_thread->Run() != wxTHREAD_NO_ERROR )
+    {
+        wxLogError(_("Failed to start the IPC thread."));
+
+        wxDELETE(m_thread);
+        SharedSegment::Unlink(name);
+        return false;
+    }
+
+    m_state = state;
+    m_name = name;
+
+    return true;
+}
+
+wxSharedMemoryServerImpl::~wxSharedMemoryServerImpl()
+{
+    if ( !m_state )
+        return;
+
+    m_state->server = nullptr;
+    m_state->stop = true;
+
+    {
+        ControlBlock& ctl = m_state->GetControl();
+
+        SharedSyncLocker lock(ctl.sync);
+        ctl.sync.Broadcast();
+    }
+
+    m_thread->Wait();
+    delete m_thread;
+
+    SharedSegment::Unlink(m_name);
+}
+
+void* wxSharedMemoryServerImpl::ListenerThread::Entry()
+{
+    ControlBlock& ctl = m_state->GetControl();
+
+    SharedSyncLocker lock(ctl.sync);
+    while ( !m_state->stop )
+    {
+        if ( ctl.state == Connect_Pending )
+        {
+            ctl.state = Connect_Processing;
+
+            const wxUint32 request = ctl.request;
+
+            ctl.segment[MAX_SEGMENT_NAME_LEN - 1] = '\0';
+            const wxString segmentName = wxString::FromUTF8(ctl.segment);
+
+            ctl.topic[MAX_TOPIC_LEN - 1] = '\0';
+            const wxString topic = wxString::FromUTF8(ctl.topic);
+
+            const std::shared_ptr<State> state = m_state;
+            m_handler.CallAfter([state, request, segmentName, topic]()
+            {
+                Accept(*state, request, segmentName, topic);
+            });
+            continue;
+        }
+
+        ctl.sync.Wait(WAIT_INTERVAL_MS);
+    }
+
+    return nullptr;
+}
+
+/* static */
+void wxSharedMemoryServerImpl::Accept(State& state,
+                                      wxUint32 request,
+                                      const wxString& segmentName,
+                                      const wxString& topic)
+{
+    bool accepted = false;
+
+    std::unique_ptr<SharedSegment> segment(new SharedSegment);
+    if ( state.server &&
+            segment->Open(segmentName, sizeof(ConnectionBlock)) )
+    {
+        ConnectionBlock&
+            block = *static_cast<ConnectionBlock*>(segment->GetData());
+        if ( block.magic == SHM_IPC_MAGIC &&
+                segment->GetSize() >= sizeof(ConnectionBlock) +
+                                        2*static_cast<size_t>(block.ringSize) )
+        {
+            block.serverPid = getpid();
+
+            wxConnectionBase* const
+                conn = state.server->OnAcceptConnection(topic);
+            if ( conn )
+            {
+                wxSharedMemoryConnection* const
+                    shmConn = wxDynamicCast(conn, wxSharedMemoryConnection);
+                if ( shmConn &&
+                        wxSharedMemoryIPCImpl::Attach(shmConn,
+                                                      std::move(segment),
+                                                      true,
+                                                      topic) )
+                {
+                    accepted = true;
+                }
+                else
+                {
+                    delete conn;
+                }
+            }
+        }
+    }
+
+    ControlBlock& ctl = state.GetControl();
+
+    SharedSyncLocker lock(ctl.sync);
+
+    // Check that the client didn't give up waiting for us in the meanwhile:
+    // if it did, it will close the connection, so we don't need to do
+    // anything special here even if we've accepted it.
+    if ( ctl.request == request && ctl.state == Connect_Processing )
+    {
+        ctl.state = accepted ? Connect_Accepted : Connect_Rejected;
+        ctl.sync.Broadcast();
+    }
+}
+
+wxIMPLEMENT_DYNAMIC_CLASS(wxSharedMemoryServer, wxServerBase);
+
+wxSharedMemoryServer::~wxSharedMemoryServer()
+{
+    delete m_impl;
+}
+
+bool wxSharedMemoryServer::Create(const wxString& serverName)
+{
+    // Destroy previous server, if any
+    wxDELETE(m_impl);
+
+    std::unique_ptr<wxSharedMemoryServerImpl> impl(new wxSharedMemoryServerImpl);
+    if ( !impl->Create(this, serverName) )
+        return false;
+
+    m_impl = impl.release();
+
+    return true;
+}
+
+wxConnectionBase *
+wxSharedMemoryServer::OnAcceptConnection(const wxString& WXUNUSED(topic))
+{
+    return new wxSharedMemoryConnection();
+}
+
+// ============================================================================
+// wxSharedMemoryClient implementation
+// ============================================================================
+
+wxIMPLEMENT_DYNAMIC_CLASS(wxSharedMemoryClient, wxClientBase);
+
+bool wxSharedMemoryClient::ValidHost(const wxString& host)
+{
+    return host.empty() || host == "localhost";
+}
+
+wxConnectionBase *
+wxSharedMemoryClient::MakeConnection(const wxString& host,
+                                     const wxString& serverName,
+                                     const wxString& topic)
+{
+    if ( !ValidHost(host) )
+        return nullptr;
+
+    const wxScopedCharBuffer topicUTF8 = topic.utf8_str();
+    if ( topicUTF8.length() >= MAX_TOPIC_LEN )
+    {
+        wxLogError(_("IPC topic \"%s\" is too long."), topic);
+        return nullptr;
+    }
+
+    wxCHECK_MSG( m_bufferSize && m_bufferSize <= UINT32_MAX, nullptr,
+                 "invalid IPC buffer size" );
+
+    SharedSegment control;
+    if ( !control.Open(GetControlSegmentName(serverName),
+                       sizeof(ControlBlock)) )
+        return nullptr;
+
+    ControlBlock& ctl = *static_cast<ControlBlock*>(control.GetData());
+    if ( ctl.magic != SHM_IPC_MAGIC )
+        return nullptr;
+
+    // Create the segment for the new connection.
+    static std::atomic<unsigned> s_lastSegment{0};
+    const wxString segmentName = wxString::Format("/wxipc-%ld-%u",
+                                                  static_cast<long>(getpid()),
+                                                  ++s_lastSegment);
+
+    std::unique_ptr<SharedSegment> segment(new SharedSegment);
+    if ( !segment->Create(segmentName,
+                          sizeof(ConnectionBlock) + 2*m_bufferSize) )
+        return nullptr;
+
+    ConnectionBlock& block = *static_cast<ConnectionBlock*>(segment->GetData());
+    for ( RingHeader& ring : block.rings )
+    {
+        if ( !ring.sync.Init() )
+        {
+            wxLogError(_("Process-shared synchronization objects are not supported."));
+            SharedSegment::Unlink(segmentName);
+            return nullptr;
+        }
+
+        ring.written =
+        ring.read = 0;
+        ring.closed = false;
+    }
+
+    block.ringSize = static_cast<wxUint32>(m_bufferSize);
+    block.clientPid = getpid();
+    block.serverPid = ctl.serverPid;
+    block.magic = SHM_IPC_MAGIC;
+
+    // Post the connection request and wait for the server to handle it.
+    bool accepted = false;
+    {
+        SharedSyncLocker lock(ctl.sync);
+
+        const wxMilliClock_t deadline = wxGetLocalTimeMillis() +
+                                            CONNECT_TIMEOUT_MS;
+        const auto waitFor = [&ctl, deadline]()
+        {
+            if ( wxGetLocalTimeMillis() > deadline ||
+                    !IsProcessAlive(ctl.serverPid) )
+                return false;
+
+            ctl.sync.Wait(WAIT_INTERVAL_MS);
+            return true;
+        };
+
+        // Another client may be connecting right now, wait until it's done,
+        // unless it has died without finishing doing it.
+        bool ok = true;
+        while ( ctl.state != Connect_Idle )
+        {
+            if ( !IsProcessAlive(ctl.clientPid) )
+            {
+                ctl.state = Connect_Idle;
+                break;
+            }
+
+            if ( !waitFor() )
+            {
+                ok = false;
+                break;
+            }
+        }
+
+        if ( ok )
+        {
+            wxStrlcpy(ctl.segment, segmentName.utf8_str(), MAX_SEGMENT_NAME_LEN);
+            wxStrlcpy(ctl.topic, topicUTF8.data(), MAX_TOPIC_LEN);
+            ctl.clientPid = getpid();
+            const wxUint32 request = ++ctl.request;
+            ctl.state = Connect_Pending;
+            ctl.sync.Broadcast();
+
+            while ( ctl.state == Connect_Pending ||
+                        ctl.state == Connect_Processing )
+            {
+                if ( !waitFor() )
+                    break;
+            }
+
+            accepted = ctl.state == Connect_Accepted;
+
+            // Let the other clients connect.
+            if ( ctl.request == request )
+            {
+                ctl.state = Connect_Idle;
+                ctl.sync.Broadcast();
+            }
+        }
+    }
+
+    // Both sides have mapped the segment by now (or will never do it), so we
+    // don't need its name any longer.
+    SharedSegment::Unlink(segmentName);
+
+    if ( accepted )
+    {
+        wxConnectionBase* const conn = OnMakeConnection();
+        if ( conn )
+        {
+            wxSharedMemoryConnection* const
+                shmConn = wxDynamicCast(conn, wxSharedMemoryConnection);
+            if ( shmConn &&
+                    wxSharedMemoryIPCImpl::Attach(shmConn,
+                                                  std::move(segment),
+                                                  false,
+                                                  topic) )
+            {
+                return shmConn;
+            }
+
+            delete conn;
+        }
+    }
+
+    // Close the connection in case the server did accept it (or will still
+    // do it) to let it know that we won't use it.
+    if ( segment )
+    {
+        for ( RingHeader& ring : block.rings )
+        {
+            SharedSyncLocker lock(ring.sync);
+            ring.closed = true;
+            ring.sync.Broadcast();
+        }
+    }
+
+    return nullptr;
+}
+
+wxConnectionBase *wxSharedMemoryClient::OnMakeConnection()
+{
+    return new wxSharedMemoryConnection();
+}
+
+#endif // wxHAS_SHARED_MEMORY_IPC
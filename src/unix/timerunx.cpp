@@ -48,45 +48,115 @@ wxTimerScheduler *wxTimerScheduler::ms_instance = nullptr;
 
 void wxTimerScheduler::AddTimer(wxUnixTimerImpl *timer, wxUsecClock_t expiration)
 {
-    DoAddTimer(wxTimerSchedule(timer, expiration));
+    // if the timer doesn't need to be precise, round its expiration up to a
+    // multiple of the largest power of 2 number of milliseconds not greater
+    // than its tolerance: this makes different timers expire at the same
+    // time and so be notified together
+    const int tolerance = timer->GetTolerance();
+    if ( tolerance > 1 )
+    {
+        long granularity = 1;
+        while ( granularity*2 <= tolerance && granularity < 0x10000 )
+            granularity *= 2;
+
+        granularity *= 1000;
+
+        const wxUsecClock_t rem = expiration % granularity;
+        if ( rem != 0 )
+            expiration += granularity - rem;
+    }
+
+    DoAddTimer(wxTimerSchedule(timer, expiration, m_nextOrder++));
 }
 
-void wxTimerScheduler::DoAddTimer(const wxTimerSchedule& s)
+void wxTimerScheduler::PlaceAt(size_t n, const wxTimerSchedule& s)
 {
-    // do an insertion sort to keep the list sorted in expiration order
-    wxTimerList::iterator node;
-    for ( node = m_timers.begin(); node != m_timers.end(); ++node )
+    m_timers[n] = s;
+    s.m_timer->m_heapIndex = n;
+}
+
+void wxTimerScheduler::SiftUp(size_t n)
+{
+    const wxTimerSchedule s = m_timers[n];
+    while ( n > 0 )
     {
-        wxASSERT_MSG( node->m_timer != s.m_timer,
-                      wxT("adding the same timer twice?") );
+        const size_t parent = (n - 1) / 2;
+        if ( !s.IsBefore(m_timers[parent]) )
+            break;
+
+        PlaceAt(n, m_timers[parent]);
+        n = parent;
+    }
 
-        if ( node->m_expiration > s.m_expiration )
+    PlaceAt(n, s);
+}
+
+void wxTimerScheduler::SiftDown(size_t n)
+{
+    const size_t count = m_timers.size();
+    const wxTimerSchedule s = m_timers[n];
+    for ( ;; )
+    {
+        size_t child = 2*n + 1;
+        if ( child >= count )
+            break;
+
+        if ( child + 1 < count && m_timers[child + 1].IsBefore(m_timers[child]) )
+            child++;
+
+        if ( !m_timers[child].IsBefore(s) )
             break;
+
+        PlaceAt(n, m_timers[child]);
+        n = child;
     }
 
-    m_timers.insert(node, s);
+    PlaceAt(n, s);
+}
+
+void wxTimerScheduler::DoAddTimer(const wxTimerSchedule& s)
+{
+    wxASSERT_MSG( s.m_timer->m_heapIndex >= m_timers.size() ||
+                    m_timers[s.m_timer->m_heapIndex].m_timer != s.m_timer,
+                  wxT("adding the same timer twice?") );
+
+    m_timers.push_back(s);
+    SiftUp(m_timers.size() - 1);
 
     wxLogTrace(wxTrace_Timer, wxT("Inserted timer %d expiring at %s"),
                s.m_timer->GetId(),
                s.m_expiration.ToString());
 }
 
+void wxTimerScheduler::DoRemoveAt(size_t n)
+{
+    const size_t last = m_timers.size() - 1;
+    if ( n != last )
+    {
+        PlaceAt(n, m_timers[last]);
+        m_timers.pop_back();
+
+        // the element moved here may need to go either up or down
+        if ( n > 0 && m_timers[n].IsBefore(m_timers[(n - 1) / 2]) )
+            SiftUp(n);
+        else
+            SiftDown(n);
+    }
+    else
+    {
+        m_timers.pop_back();
+    }
+}
+
 void wxTimerScheduler::RemoveTimer(wxUnixTimerImpl *timer)
 {
     wxLogTrace(wxTrace_Timer, wxT("Removing timer %d"), timer->GetId());
 
-    for ( wxTimerList::iterator node = m_timers.begin();
-          node != m_timers.end();
-          ++node )
-    {
-        if ( node->m_timer == timer )
-        {
-            m_timers.erase(node);
-            return;
-        }
-    }
+    const size_t n = timer->m_heapIndex;
+    wxCHECK_RET( n < m_timers.size() && m_timers[n].m_timer == timer,
+                 wxT("removing inexistent timer?") );
 
-    wxFAIL_MSG( wxT("removing inexistent timer?") );
+    DoRemoveAt(n);
 }
 
 bool wxTimerScheduler::GetNext(wxUsecClock_t *remaining) const
@@ -96,10 +166,11 @@ bool wxTimerScheduler::GetNext(wxUsecClock_t *remaining) const
 
     wxCHECK_MSG( remaining, false, wxT("null pointer") );
 
-    *remaining = m_timers.begin()->m_expiration - wxGetUTCTimeUSec();
-    if ( *remaining < 0 )
+    *remaining = m_timers.front().m_expiration - wxGetUTCTimeUSec();
+    if ( *remaining < COALESCE_USEC )
     {
-        // timer already expired, don't wait at all before notifying it
+        // timer already expired or will be coalesced with the expired ones,
+        // don't wait at all before notifying it
         *remaining = 0;
     }
 
@@ -112,31 +183,39 @@ bool wxTimerScheduler::NotifyExpired()
       return false;
 
     const wxUsecClock_t now = wxGetUTCTimeUSec();
+    const wxUsecClock_t deadline = now + COALESCE_USEC;
 
     typedef wxVector<wxUnixTimerImpl *> TimerImpls;
     TimerImpls toNotify;
-    for ( wxTimerList::iterator next,
-            cur = m_timers.begin(); cur != m_timers.end(); cur = next )
+    while ( !m_timers.empty() && !(m_timers.front().m_expiration > deadline) )
     {
-        wxTimerSchedule s = *cur;
-        if ( s.m_expiration > now )
-        {
-            // as the list is sorted by expiration time, we can skip the rest
-            break;
-        }
+        // as the heap is ordered by expiration time, its first element is
+        // always the next one to expire
+        wxUnixTimerImpl * const timer = m_timers.front().m_timer;
+        DoRemoveAt(0);
 
-        // remember next as we will delete the node pointed to by cur
-        next = cur;
-        ++next;
+        // we can't notify the timer from this loop as the timer event handler
+        // could modify m_timers (for example, but not only, by stopping this
+        // timer), so do it after the loop end
+        toNotify.push_back(timer);
+    }
 
-        m_timers.erase(cur);
+    if ( toNotify.empty() )
+        return false;
 
-        // check whether we need to keep this timer
-        wxUnixTimerImpl * const timer = s.m_timer;
+    // check whether we need to keep these timers: this is done after
+    // removing all the expired timers from the heap to ensure that a timer
+    // with a very small interval is not notified again in the loop above
+    for ( TimerImpls::const_iterator i = toNotify.begin(),
+                                     end = toNotify.end();
+          i != end;
+          ++i )
+    {
+        wxUnixTimerImpl * const timer = *i;
         if ( timer->IsOneShot() )
         {
             // the timer needs to be stopped but don't call its Stop() from
-            // here as it would attempt to remove the timer from our list and
+            // here as it would attempt to remove the timer from our heap and
             // we had already done it, so we just need to reset its state
             timer->MarkStopped();
         }
@@ -146,20 +225,10 @@ bool wxTimerScheduler::NotifyExpired()
             // the current time instead of just offsetting it from the current
             // expiration time because it could happen that we're late and the
             // current expiration time is (far) in the past
-            s.m_expiration = now + timer->GetInterval()*1000;
-            DoAddTimer(s);
+            AddTimer(timer, now + timer->GetInterval()*1000);
         }
-
-        // we can't notify the timer from this loop as the timer event handler
-        // could modify m_timers (for example, but not only, by stopping this
-        // timer) which would render our iterators invalid, so do it after the
-        // loop end
-        toNotify.push_back(timer);
     }
 
-    if ( toNotify.empty() )
-        return false;
-
     for ( TimerImpls::const_iterator i = toNotify.begin(),
                                      end = toNotify.end();
           i != end;
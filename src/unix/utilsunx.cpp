@@ -150,6 +150,25 @@
     #include <sys/sysctl.h>
 #endif
 
+// posix_spawn() is much faster than fork() for processes using a lot of
+// memory, as it doesn't need to copy their page tables, but we can only use it
+// if it allows us to close all the inherited descriptors in the child, as we
+// do after fork(), which requires an extension available only in some systems.
+#if wxCHECK_GLIBC_VERSION(2, 34) || \
+    (defined(__DARWIN__) && !defined(__WXOSX_IPHONE__))
+    #define wxHAS_POSIX_SPAWN
+
+    #include <spawn.h>
+
+    #ifdef __DARWIN__
+        #include <crt_externs.h>    // for _NSGetEnviron()
+    #endif
+#endif
+
+#include <atomic>
+#include <chrono>
+#include <vector>
+
 // ----------------------------------------------------------------------------
 // conditional compilation
 // ----------------------------------------------------------------------------
@@ -587,8 +606,189 @@ int BlockUntilChildExit(wxExecuteData& execData)
 #endif // wxUSE_SELECT_DISPATCHER/!wxUSE_SELECT_DISPATCHER
 }
 
+// Counters returned by wxGetExecuteStats().
+std::atomic<wxUint64> gs_execNumLaunched{0};
+std::atomic<wxUint64> gs_execNumSpawned{0};
+std::atomic<wxUint64> gs_execLaunchTimeUs{0};
+
+#ifdef wxHAS_POSIX_SPAWN
+
+// Return true if posix_spawn() can be used to launch the child process with
+// the given parameters instead of fork().
+bool CanUsePosixSpawn(int flags, int prio, const wxExecuteEnv* env)
+{
+    // There is no way to change the priority of the child with it.
+    if ( prio )
+        return false;
+
+#ifndef POSIX_SPAWN_SETSID
+    if ( flags & wxEXEC_MAKE_GROUP_LEADER )
+        return false;
+#else
+    wxUnusedVar(flags);
+#endif
+
+    if ( env )
+    {
+#ifdef __DARWIN__
+        // posix_spawn_file_actions_addchdir_np() is not available in all the
+        // supported macOS versions.
+        if ( !env->cwd.empty() )
+            return false;
+#endif // __DARWIN__
+
+        if ( !env->env.empty() )
+        {
+            // posix_spawnp() looks for the program in our PATH and not in the
+            // one from the new environment, unlike execvp() called after
+            // changing the environment in the child, so only use it if PATH
+            // is the same in both.
+            wxString path;
+            const bool hasPath = wxGetEnv(wxS("PATH"), &path);
+
+            const wxEnvVariableHashMap::const_iterator
+                it = env->env.find(wxS("PATH"));
+            if ( it == env->env.end() ? hasPath
+                                      : !hasPath || it->second != path )
+                return false;
+        }
+    }
+
+    return true;
+}
+
+// Launch the child process using posix_spawnp(), doing the same things as we
+// do in the child after fork() in wxExecute() below.
+//
+// Return the PID of the child or -1 with errno set on failure.
+pid_t DoPosixSpawn(const char* const* argv,
+                   int flags,
+                   wxPipe& pipeIn,
+                   wxPipe& pipeOut,
+                   wxPipe& pipeErr,
+                   const wxExecuteEnv* env)
+{
+    posix_spawn_file_actions_t actions;
+    int rc = posix_spawn_file_actions_init(&actions);
+    if ( rc != 0 )
+    {
+        errno = rc;
+        return -1;
+    }
+
+    posix_spawnattr_t attr;
+    rc = posix_spawnattr_init(&attr);
+    if ( rc != 0 )
+    {
+        posix_spawn_file_actions_destroy(&actions);
+        errno = rc;
+        return -1;
+    }
+
+    short spawnFlags = 0;
+
+#ifdef POSIX_SPAWN_SETSID
+    if ( flags & wxEXEC_MAKE_GROUP_LEADER )
+        spawnFlags |= POSIX_SPAWN_SETSID;
+#else
+    wxUnusedVar(flags);
+#endif
+
+    // Redirect stdin, stdout and stderr if necessary.
+    if ( pipeIn.IsOk() )
+    {
+        if ( rc == 0 )
+            rc = posix_spawn_file_actions_adddup2(&actions,
+                    pipeIn[wxPipe::Read], STDIN_FILENO);
+        if ( rc == 0 )
+            rc = posix_spawn_file_actions_adddup2(&actions,
+                    pipeOut[wxPipe::Write], STDOUT_FILENO);
+        if ( rc == 0 )
+            rc = posix_spawn_file_actions_adddup2(&actions,
+                    pipeErr[wxPipe::Write], STDERR_FILENO);
+    }
+
+    // And close all the other descriptors.
+#ifdef __DARWIN__
+    spawnFlags |= POSIX_SPAWN_CLOEXEC_DEFAULT;
+
+    // The redirected descriptors are inherited anyhow, but the standard ones
+    // need to be explicitly marked as being inheritable otherwise.
+    if ( !pipeIn.IsOk() )
+    {
+        for ( int fd = STDIN_FILENO; fd <= STDERR_FILENO && rc == 0; ++fd )
+            rc = posix_spawn_file_actions_addinherit_np(&actions, fd);
+    }
+#else // glibc
+    if ( rc == 0 )
+        rc = posix_spawn_file_actions_addclosefrom_np(&actions,
+                                                      STDERR_FILENO + 1);
+#endif // __DARWIN__/glibc
+
+#ifndef __DARWIN__
+    if ( rc == 0 && env && !env->cwd.empty() )
+        rc = posix_spawn_file_actions_addchdir_np(&actions, env->cwd.fn_str());
+#endif // !__DARWIN__
+
+    if ( rc == 0 )
+        rc = posix_spawnattr_setflags(&attr, spawnFlags);
+
+    // Use either the current or the custom environment.
+    std::vector<wxCharBuffer> envStrings;
+    std::vector<char*> envPtrs;
+    char** envp;
+    if ( env && !env->env.empty() )
+    {
+        for ( const auto& kv : env->env )
+        {
+            envStrings.push_back(wxString(kv.first + '=' + kv.second).mb_str());
+            envPtrs.push_back(envStrings.back().data());
+        }
+        envPtrs.push_back(nullptr);
+
+        envp = &envPtrs[0];
+    }
+    else
+    {
+#ifdef __DARWIN__
+        envp = *_NSGetEnviron();
+#else
+        envp = environ;
+#endif
+    }
+
+    pid_t pid = -1;
+    if ( rc == 0 )
+    {
+        rc = posix_spawnp(&pid, *argv, &actions, &attr,
+                          const_cast<char**>(argv), envp);
+    }
+
+    posix_spawnattr_destroy(&attr);
+    posix_spawn_file_actions_destroy(&actions);
+
+    if ( rc != 0 )
+    {
+        errno = rc;
+        return -1;
+    }
+
+    return pid;
+}
+
+#endif // wxHAS_POSIX_SPAWN
+
 } // anonymous namespace
 
+wxExecuteStats wxGetExecuteStats()
+{
+    wxExecuteStats stats;
+    stats.launched = gs_execNumLaunched.load(std::memory_order_relaxed);
+    stats.spawned = gs_execNumSpawned.load(std::memory_order_relaxed);
+    stats.launchTimeUs = gs_execLaunchTimeUs.load(std::memory_order_relaxed);
+    return stats;
+}
+
 // wxExecute: the real worker function
 long wxExecute(const char* const* argv, int flags, wxProcess* process,
         const wxExecuteEnv *env)
@@ -660,6 +860,30 @@ long wxExecute(const char* const* argv, int flags, wxProcess* process,
     else
         prio = (2*prio)/5 - 21;
 
+    const auto launchStart = std::chrono::steady_clock::now();
+
+#ifdef wxHAS_POSIX_SPAWN
+    // Use posix_spawn(), which uses vfork() or equivalent internally, if
+    // possible, as it's much faster than fork() for big processes.
+    //
+    // Note that if it fails, we still fall back to fork() below, as it could
+    // be due to the program not being found and we need to preserve the
+    // behaviour of fork() in this case, i.e. have a child process exiting
+    // with an error code instead of failing to launch it.
+    bool spawned = false;
+    if ( CanUsePosixSpawn(flags, prio, env) )
+    {
+        pid = DoPosixSpawn(argv, flags, pipeIn, pipeOut, pipeErr, env);
+        spawned = pid != -1;
+    }
+
+    if ( spawned )
+    {
+        gs_execNumSpawned.fetch_add(1, std::memory_order_relaxed);
+    }
+    else
+#endif // wxHAS_POSIX_SPAWN
+    {
     // fork the process
     //
     // NB: do *not* use vfork() here, it completely breaks this code for some
@@ -671,6 +895,8 @@ long wxExecute(const char* const* argv, int flags, wxProcess* process,
 #else
    pid = fork();
 #endif
+    }
+
    if ( pid == -1 )     // error?
     {
         wxLogSysError( _("Fork failed") );
@@ -796,6 +1022,16 @@ long wxExecute(const char* const* argv, int flags, wxProcess* process,
     }
     else // we're in parent
     {
+        gs_execNumLaunched.fetch_add(1, std::memory_order_relaxed);
+        gs_execLaunchTimeUs.fetch_add
+        (
+            std::chrono::duration_cast<std::chrono::microseconds>
+            (
+                std::chrono::steady_clock::now() - launchStart
+            ).count(),
+            std::memory_order_relaxed
+        );
+
         // prepare for IO redirection
 
 #if HAS_PIPE_STREAMS
@@ -822,20 +1058,38 @@ long wxExecute(const char* const* argv, int flags, wxProcess* process,
                 new wxPipeOutputStream(pipeIn.Detach(wxPipe::Write));
 
             const int fdOut = pipeOut.Detach(wxPipe::Read);
-            wxPipeInputStream *outStream = new wxPipeInputStream(fdOut);
-
             const int fdErr = pipeErr.Detach(wxPipe::Read);
-            wxPipeInputStream *errStream = new wxPipeInputStream(fdErr);
 
-            process->SetPipeStreams(outStream, inStream, errStream);
+            if ( process->IsOutputEventsEnabled() && !(flags & wxEXEC_SYNC) )
+            {
+                // Don't create the input streams at all, the output is going
+                // to be read by this object and passed to wxProcess directly.
+                execData.m_outputReader =
+                    new wxExecuteOutputReader(*process, fdOut, fdErr);
+
+                if ( !execData.m_outputReader->IsOk() )
+                {
+                    wxLogWarning(_("Failed to monitor the output of the "
+                                   "child process, it might hang."));
+                }
 
-            if ( flags & wxEXEC_SYNC )
+                process->SetPipeStreams(nullptr, inStream, nullptr);
+            }
+            else
             {
-                execData.m_bufOut.Init(outStream);
-                execData.m_bufErr.Init(errStream);
+                wxPipeInputStream *outStream = new wxPipeInputStream(fdOut);
+                wxPipeInputStream *errStream = new wxPipeInputStream(fdErr);
+
+                process->SetPipeStreams(outStream, inStream, errStream);
 
-                execData.m_fdOut = fdOut;
-                execData.m_fdErr = fdErr;
+                if ( flags & wxEXEC_SYNC )
+                {
+                    execData.m_bufOut.Init(outStream);
+                    execData.m_bufErr.Init(errStream);
+
+                    execData.m_fdOut = fdOut;
+                    execData.m_fdErr = fdErr;
+                }
             }
         }
 #endif // HAS_PIPE_STREAMS
@@ -1784,6 +2038,18 @@ void wxExecuteData::OnExit(int exitcode)
         m_bufOut.ReadAll();
         m_bufErr.ReadAll();
     }
+
+#if HAS_PIPE_STREAMS
+    if ( m_outputReader )
+    {
+        // Similarly, pass all the remaining output to wxProcess before
+        // notifying it about the process termination.
+        m_outputReader->ReadAll();
+
+        delete m_outputReader;
+        m_outputReader = nullptr;
+    }
+#endif // HAS_PIPE_STREAMS
 #endif // wxUSE_STREAMS
 
     // Notify user about termination if required
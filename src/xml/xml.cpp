@@ -26,8 +26,13 @@
 #include "wx/zstream.h"
 #include "wx/strconv.h"
 #include "wx/versioninfo.h"
+#include "wx/buffer.h"
 
+#include <atomic>
 #include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "expat.h" // from Expat
 
@@ -42,6 +47,182 @@ wxIMPLEMENT_CLASS(wxXmlDocument, wxObject);
 static bool wxIsWhiteOnly(const wxString& buf);
 
 
+//-----------------------------------------------------------------------------
+//  wxXmlNode and wxXmlAttribute allocation
+//-----------------------------------------------------------------------------
+
+// Every node and attribute is preceded by a pointer to the arena block it
+// was allocated from or null if it was allocated from the heap: this allows
+// to delete the nodes in the usual way, independently of how they were
+// allocated, and even after the document they were loaded in is destroyed.
+
+namespace
+{
+
+// Size of the memory blocks used by wxXmlArena.
+constexpr size_t wxXML_ARENA_BLOCK_SIZE = 64*1024;
+
+// Offset of the objects allocated from the heap: this must preserve the
+// alignment of the pointer returned by the global operator new.
+constexpr size_t wxXML_HEAP_HEADER_SIZE = 2*sizeof(void*);
+
+// Header of the arena memory blocks, the objects are allocated after it.
+struct wxXmlArenaBlock
+{
+    // Number of objects allocated from this block, plus one if the arena is
+    // still using it. The block is freed when this drops to zero.
+    std::atomic<size_t> refCount{1};
+};
+
+void wxXmlArenaRelease(wxXmlArenaBlock* block)
+{
+    if ( --block->refCount == 0 )
+    {
+        block->~wxXmlArenaBlock();
+        ::operator delete(block);
+    }
+}
+
+void* wxXmlAllocate(size_t size)
+{
+    char* const p = static_cast<char*>(::operator new(size + wxXML_HEAP_HEADER_SIZE))
+                        + wxXML_HEAP_HEADER_SIZE;
+    reinterpret_cast<wxXmlArenaBlock**>(p)[-1] = nullptr;
+    return p;
+}
+
+void wxXmlFree(void* p)
+{
+    if ( !p )
+        return;
+
+    wxXmlArenaBlock* const block = static_cast<wxXmlArenaBlock**>(p)[-1];
+    if ( block )
+        wxXmlArenaRelease(block);
+    else
+        ::operator delete(static_cast<char*>(p) - wxXML_HEAP_HEADER_SIZE);
+}
+
+} // anonymous namespace
+
+// Monotonic allocator used for the nodes and the attributes of the documents
+// loaded using wxXMLDOC_USE_ARENA flag.
+class wxXmlArena
+{
+public:
+    wxXmlArena() = default;
+
+    ~wxXmlArena()
+    {
+        if ( m_block )
+            wxXmlArenaRelease(m_block);
+    }
+
+    void* Allocate(size_t size)
+    {
+        // The objects allocated from the arena only need pointer alignment.
+        const size_t needed = sizeof(wxXmlArenaBlock*) +
+            (size + sizeof(void*) - 1) / sizeof(void*) * sizeof(void*);
+
+        if ( needed > wxXML_ARENA_BLOCK_SIZE / 16 )
+            return wxXmlAllocate(size);
+
+        if ( !m_block || needed > static_cast<size_t>(m_end - m_next) )
+        {
+            if ( m_block )
+                wxXmlArenaRelease(m_block);
+
+            void* const mem = ::operator new(wxXML_ARENA_BLOCK_SIZE);
+            m_block = new(mem) wxXmlArenaBlock;
+            m_next = static_cast<char*>(mem) + sizeof(wxXmlArenaBlock);
+            m_end = static_cast<char*>(mem) + wxXML_ARENA_BLOCK_SIZE;
+        }
+
+        m_block->refCount++;
+
+        char* const p = m_next + sizeof(wxXmlArenaBlock*);
+        reinterpret_cast<wxXmlArenaBlock**>(p)[-1] = m_block;
+        m_next += needed;
+        return p;
+    }
+
+private:
+    wxXmlArenaBlock* m_block = nullptr;
+    char* m_next = nullptr;
+    char* m_end = nullptr;
+
+    wxDECLARE_NO_COPY_CLASS(wxXmlArena);
+};
+
+void* wxXmlAttribute::operator new(size_t size)
+{
+    return wxXmlAllocate(size);
+}
+
+void* wxXmlAttribute::operator new(size_t size, wxXmlArena& arena)
+{
+    return arena.Allocate(size);
+}
+
+void wxXmlAttribute::operator delete(void* p)
+{
+    wxXmlFree(p);
+}
+
+void wxXmlAttribute::operator delete(void* p, wxXmlArena& WXUNUSED(arena))
+{
+    wxXmlFree(p);
+}
+
+void* wxXmlNode::operator new(size_t size)
+{
+    return wxXmlAllocate(size);
+}
+
+void* wxXmlNode::operator new(size_t size, wxXmlArena& arena)
+{
+    return arena.Allocate(size);
+}
+
+void wxXmlNode::operator delete(void* p)
+{
+    wxXmlFree(p);
+}
+
+void wxXmlNode::operator delete(void* p, wxXmlArena& WXUNUSED(arena))
+{
+    wxXmlFree(p);
+}
+
+namespace
+{
+
+// Create a new node or attribute in the arena, if it's non-null, or on heap.
+wxXmlNode* wxXmlCreateNode(wxXmlArena* arena,
+                           wxXmlNodeType type,
+                           const wxString& name,
+                           const wxString& content,
+                           int lineNo)
+{
+    if ( arena )
+        return new(*arena) wxXmlNode(type, name, content, lineNo);
+
+    return new wxXmlNode(type, name, content, lineNo);
+}
+
+wxXmlAttribute* wxXmlCreateAttribute(wxXmlArena* arena,
+                                     const wxString& name,
+                                     const wxString& value)
+{
+    if ( arena )
+        return new(*arena) wxXmlAttribute(name, value);
+
+    return new wxXmlAttribute(name, value);
+}
+
+} // anonymous namespace
+
+
 //-----------------------------------------------------------------------------
 //  wxXmlNode
 //-----------------------------------------------------------------------------
@@ -591,10 +772,6 @@ void wxXmlDocument::AppendToProlog(wxXmlNode *node)
         m_docNode->AddChild( node );
 }
 
-//-----------------------------------------------------------------------------
-//  wxXmlDocument loading routines
-//-----------------------------------------------------------------------------
-
 // returns true if the given string contains only whitespaces
 bool wxIsWhiteOnly(const wxString& buf)
 {
@@ -607,184 +784,265 @@ bool wxIsWhiteOnly(const wxString& buf)
     return true;
 }
 
+//-----------------------------------------------------------------------------
+//  wxXmlReader
+//-----------------------------------------------------------------------------
 
-struct wxXmlParsingContext
+// same as wxIsWhiteOnly() but for the UTF-8 data used by wxXmlReader
+static bool wxIsWhiteOnlyUTF8(const std::string& buf)
 {
-    wxXmlParsingContext()
-        : node(nullptr),
-          lastChild(nullptr),
-          lastAsText(nullptr),
-          doctype(nullptr),
-          removeWhiteOnlyNodes(false)
-    {}
+    for ( const char c : buf )
+    {
+        if ( c != ' ' && c != '\t' && c != '\n' && c != '\r' )
+            return false;
+    }
+    return true;
+}
 
-    XML_Parser parser;
-    wxXmlNode *node;                    // the node being parsed
-    wxXmlNode *lastChild;               // the last child of "node"
-    wxXmlNode *lastAsText;              // the last _text_ child of "node"
-    wxString   encoding;
-    wxString   version;
-    wxXmlDoctype *doctype;
-    bool       removeWhiteOnlyNodes;
+// a single item queued by wxXmlReader: notice that these objects are reused
+// to avoid allocating memory for each of them
+struct wxXmlReaderItem
+{
+    wxXmlReaderEvent event = wxXML_READER_END_DOCUMENT;
+    std::string name;
+    std::string value;
+    std::string publicId;           // only used for wxXML_READER_DOCTYPE
+    std::vector<std::pair<std::string, std::string>> attributes;
+    size_t attributesCount = 0;     // number of used elements of attributes
+    int line = 0;
+    int depth = 0;
 };
 
-// checks that ctx->lastChild is in consistent state
-#define ASSERT_LAST_CHILD_OK(ctx)                                   \
-    wxASSERT( ctx->lastChild == nullptr ||                             \
-              ctx->lastChild->GetNext() == nullptr );                  \
-    wxASSERT( ctx->lastChild == nullptr ||                             \
-              ctx->lastChild->GetParent() == ctx->node )
+struct wxXmlReaderData
+{
+    explicit wxXmlReaderData(wxInputStream& stream_) : stream(stream_) { }
+
+    // Adds a new item to the queue, finishing the previous one.
+    wxXmlReaderItem& AddItem(wxXmlReaderEvent event);
+
+    // Finishes the last item if more text could still be added to it.
+    void CloseItem();
+
+    // Suspends parsing to let the caller process the queued items.
+    void Stop();
+
+    // Parses more data, returns false on error.
+    bool Parse();
+
+    wxInputStream& stream;
+    XML_Parser parser = nullptr;
+    bool keepWhitespace = false;
+
+    // Parsed items: those before "pos" were already returned, the one at "pos"
+    // is current if "hasCurrent" is true and the rest are yet to be returned.
+    std::vector<wxXmlReaderItem> items;
+    size_t count = 0;
+    size_t pos = 0;
+    bool hasCurrent = false;
+
+    bool open = false;          // last queued item may still get more text
+    bool stopped = false;       // XML_StopParser() was already called
+    bool lastBuffer = false;    // the entire input was passed to expat
+    bool finished = false;      // and expat has finished parsing it
+    bool done = false;          // wxXML_READER_END_DOCUMENT or ERROR returned
+    wxXmlReaderEvent event = wxXML_READER_END_DOCUMENT;
+    int depth = 0;
+
+    wxString version;
+    wxString encoding;
+    wxXmlParseError error;
+};
 
-extern "C" {
-static void StartElementHnd(void *userData, const char *name, const char **atts)
+wxXmlReaderItem& wxXmlReaderData::AddItem(wxXmlReaderEvent ev)
 {
-    wxXmlParsingContext *ctx = (wxXmlParsingContext*)userData;
-    wxXmlNode *node = new wxXmlNode(wxXML_ELEMENT_NODE,
-                                    wxString::FromUTF8Unchecked(name),
-                                    wxEmptyString,
-                                    XML_GetCurrentLineNumber(ctx->parser));
-    const char **a = atts;
+    CloseItem();
 
-    // add node attributes
-    while (*a)
-    {
-        node->AddAttribute(wxString::FromUTF8Unchecked(a[0]), wxString::FromUTF8Unchecked(a[1]));
-        a += 2;
-    }
+    if ( count == items.size() )
+        items.emplace_back();
 
-    ASSERT_LAST_CHILD_OK(ctx);
-    ctx->node->InsertChildAfter(node, ctx->lastChild);
-    ctx->lastAsText = nullptr;
-    ctx->lastChild = nullptr; // our new node "node" has no children yet
+    wxXmlReaderItem& item = items[count++];
+    item.event = ev;
+    item.name.clear();
+    item.value.clear();
+    item.publicId.clear();
+    item.attributesCount = 0;
+    item.line = (int)XML_GetCurrentLineNumber(parser);
+    item.depth = depth;
 
-    ctx->node = node;
+    return item;
 }
 
-static void EndElementHnd(void *userData, const char* WXUNUSED(name))
+void wxXmlReaderData::CloseItem()
 {
-    wxXmlParsingContext *ctx = (wxXmlParsingContext*)userData;
+    if ( !open )
+        return;
 
-    // we're exiting the last children of ctx->node->GetParent() and going
-    // back one level up, so current value of ctx->node points to the last
-    // child of ctx->node->GetParent()
-    ctx->lastChild = ctx->node;
+    open = false;
 
-    ctx->node = ctx->node->GetParent();
-    ctx->lastAsText = nullptr;
+    const wxXmlReaderItem& last = items[count - 1];
+    if ( last.event == wxXML_READER_TEXT &&
+            !keepWhitespace && wxIsWhiteOnlyUTF8(last.value) )
+    {
+        count--;
+    }
+}
+
+void wxXmlReaderData::Stop()
+{
+    if ( !stopped )
+    {
+        XML_StopParser(parser, XML_TRUE);
+        stopped = true;
+    }
 }
 
-static void TextHnd(void *userData, const char *s, int len)
+bool wxXmlReaderData::Parse()
 {
-    wxXmlParsingContext *ctx = (wxXmlParsingContext*)userData;
-    wxString str = wxString::FromUTF8Unchecked(s, len);
+    stopped = false;
+
+    XML_ParsingStatus status;
+    XML_GetParsingStatus(parser, &status);
 
-    if (ctx->lastAsText)
+    XML_Status rc;
+    if ( status.parsing == XML_SUSPENDED )
     {
-        ctx->lastAsText->SetContent(ctx->lastAsText->GetContent() + str);
+        rc = XML_ResumeParser(parser);
     }
     else
     {
-        bool whiteOnly = false;
-        if (ctx->removeWhiteOnlyNodes)
-            whiteOnly = wxIsWhiteOnly(str);
+        const size_t BUFSIZE = 16384;
+        void* const buf = XML_GetBuffer(parser, BUFSIZE);
+        if ( !buf )
+            return false;
 
-        if (!whiteOnly)
-        {
-            wxXmlNode *textnode =
-                new wxXmlNode(wxXML_TEXT_NODE, wxS("text"), str,
-                              XML_GetCurrentLineNumber(ctx->parser));
+        const size_t len = stream.Read(buf, BUFSIZE).LastRead();
+        lastBuffer = len < BUFSIZE;
+        rc = XML_ParseBuffer(parser, (int)len, lastBuffer);
+    }
 
-            ASSERT_LAST_CHILD_OK(ctx);
-            ctx->node->InsertChildAfter(textnode, ctx->lastChild);
-            ctx->lastChild= ctx->lastAsText = textnode;
-        }
+    if ( rc == XML_STATUS_ERROR )
+        return false;
+
+    if ( rc == XML_STATUS_OK && lastBuffer )
+    {
+        CloseItem();
+        finished = true;
     }
+
+    return true;
 }
 
-static void StartCdataHnd(void *userData)
+extern "C" {
+static void ReaderStartElementHnd(void *userData, const char *name, const char **atts)
 {
-    wxXmlParsingContext *ctx = (wxXmlParsingContext*)userData;
+    wxXmlReaderData *data = (wxXmlReaderData*)userData;
+    wxXmlReaderItem& item = data->AddItem(wxXML_READER_START_ELEMENT);
+    item.name = name;
 
-    wxXmlNode *textnode =
-        new wxXmlNode(wxXML_CDATA_SECTION_NODE, wxS("cdata"), wxS(""),
-                      XML_GetCurrentLineNumber(ctx->parser));
+    for ( const char **a = atts; *a; a += 2 )
+    {
+        if ( item.attributesCount == item.attributes.size() )
+            item.attributes.emplace_back();
 
-    ASSERT_LAST_CHILD_OK(ctx);
-    ctx->node->InsertChildAfter(textnode, ctx->lastChild);
-    ctx->lastChild= ctx->lastAsText = textnode;
+        auto& attr = item.attributes[item.attributesCount++];
+        attr.first = a[0];
+        attr.second = a[1];
+    }
+
+    data->depth++;
+    data->Stop();
 }
 
-static void EndCdataHnd(void *userData)
+static void ReaderEndElementHnd(void *userData, const char *name)
 {
-    wxXmlParsingContext *ctx = (wxXmlParsingContext*)userData;
+    wxXmlReaderData *data = (wxXmlReaderData*)userData;
+    data->depth--;
+
+    wxXmlReaderItem& item = data->AddItem(wxXML_READER_END_ELEMENT);
+    item.name = name;
 
-    // we need to reset this pointer so that subsequent text nodes don't append
-    // their contents to this one but create new wxXML_TEXT_NODE objects (or
-    // not create anything at all if only white space follows the CDATA section
-    // and wxXMLDOC_KEEP_WHITESPACE_NODES is not used as is commonly the case)
-    ctx->lastAsText = nullptr;
+    data->Stop();
 }
 
-static void CommentHnd(void *userData, const char *data)
+static void ReaderTextHnd(void *userData, const char *s, int len)
 {
-    wxXmlParsingContext *ctx = (wxXmlParsingContext*)userData;
+    wxXmlReaderData *data = (wxXmlReaderData*)userData;
 
-    wxXmlNode *commentnode =
-        new wxXmlNode(wxXML_COMMENT_NODE,
-                      wxS("comment"), wxString::FromUTF8Unchecked(data),
-                      XML_GetCurrentLineNumber(ctx->parser));
-
-    ASSERT_LAST_CHILD_OK(ctx);
-    ctx->node->InsertChildAfter(commentnode, ctx->lastChild);
-    ctx->lastChild = commentnode;
-    ctx->lastAsText = nullptr;
+    // expat may call us several times for the same text, so don't return it
+    // until it's finished
+    if ( data->open )
+    {
+        data->items[data->count - 1].value.append(s, len);
+    }
+    else
+    {
+        data->AddItem(wxXML_READER_TEXT).value.assign(s, len);
+        data->open = true;
+    }
 }
 
-static void PIHnd(void *userData, const char *target, const char *data)
+static void ReaderStartCdataHnd(void *userData)
 {
-    wxXmlParsingContext *ctx = (wxXmlParsingContext*)userData;
+    wxXmlReaderData *data = (wxXmlReaderData*)userData;
+
+    // the CDATA section contents will be added by ReaderTextHnd()
+    data->AddItem(wxXML_READER_CDATA);
+    data->open = true;
+}
 
-    wxXmlNode *pinode =
-        new wxXmlNode(wxXML_PI_NODE, wxString::FromUTF8Unchecked(target),
-                      wxString::FromUTF8Unchecked(data),
-                      XML_GetCurrentLineNumber(ctx->parser));
+static void ReaderEndCdataHnd(void *userData)
+{
+    wxXmlReaderData *data = (wxXmlReaderData*)userData;
 
-    ASSERT_LAST_CHILD_OK(ctx);
-    ctx->node->InsertChildAfter(pinode, ctx->lastChild);
-    ctx->lastChild = pinode;
-    ctx->lastAsText = nullptr;
+    data->CloseItem();
+    data->Stop();
 }
 
-static void StartDoctypeHnd(void *userData, const char *doctypeName,
-                            const char *sysid, const char *pubid,
-                            int WXUNUSED(has_internal_subset))
+static void ReaderCommentHnd(void *userData, const char *comment)
 {
-    wxXmlParsingContext *ctx = (wxXmlParsingContext*)userData;
+    wxXmlReaderData *data = (wxXmlReaderData*)userData;
+    data->AddItem(wxXML_READER_COMMENT).value = comment;
+    data->Stop();
+}
 
-    *ctx->doctype = wxXmlDoctype(wxString::FromUTF8Unchecked(doctypeName),
-                                 wxString::FromUTF8Unchecked(sysid),
-                                 wxString::FromUTF8Unchecked(pubid));
+static void ReaderPIHnd(void *userData, const char *target, const char *pi)
+{
+    wxXmlReaderData *data = (wxXmlReaderData*)userData;
+    wxXmlReaderItem& item = data->AddItem(wxXML_READER_PI);
+    item.name = target;
+    item.value = pi;
+    data->Stop();
 }
 
-static void EndDoctypeHnd(void *WXUNUSED(userData))
+static void ReaderStartDoctypeHnd(void *userData, const char *doctypeName,
+                                  const char *sysid, const char *pubid,
+                                  int WXUNUSED(has_internal_subset))
 {
+    wxXmlReaderData *data = (wxXmlReaderData*)userData;
+    wxXmlReaderItem& item = data->AddItem(wxXML_READER_DOCTYPE);
+    item.name = doctypeName;
+    if ( sysid )
+        item.value = sysid;
+    if ( pubid )
+        item.publicId = pubid;
+    data->Stop();
 }
 
-static void DefaultHnd(void *userData, const char *s, int len)
+static void ReaderDefaultHnd(void *userData, const char *s, int len)
 {
     // XML header:
     if (len > 6 && memcmp(s, "<?xml ", 6) == 0)
     {
-        wxXmlParsingContext *ctx = (wxXmlParsingContext*)userData;
+        wxXmlReaderData *data = (wxXmlReaderData*)userData;
 
         wxString buf = wxString::FromUTF8Unchecked(s, (size_t)len);
         int pos;
         pos = buf.Find(wxS("encoding="));
         if (pos != wxNOT_FOUND)
-            ctx->encoding = buf.Mid(pos + 10).BeforeFirst(buf[(size_t)pos+9]);
+            data->encoding = buf.Mid(pos + 10).BeforeFirst(buf[(size_t)pos+9]);
         pos = buf.Find(wxS("version="));
         if (pos != wxNOT_FOUND)
-            ctx->version = buf.Mid(pos + 9).BeforeFirst(buf[(size_t)pos+8]);
+            data->version = buf.Mid(pos + 9).BeforeFirst(buf[(size_t)pos+8]);
     }
 }
 
@@ -821,76 +1079,362 @@ static int UnknownEncodingHnd(void * WXUNUSED(encodingHandlerData),
 
 } // extern "C"
 
-bool wxXmlDocument::Load(wxInputStream& stream, int flags,
-                         wxXmlParseError* err)
+wxXmlReader::wxXmlReader(wxInputStream& stream, int flags)
+    : m_data(new wxXmlReaderData(stream))
 {
-    const size_t BUFSIZE = 16384;
-    char buf[BUFSIZE];
-    wxXmlParsingContext ctx;
-    bool done;
     XML_Parser parser = XML_ParserCreate(nullptr);
-    wxXmlNode *root = new wxXmlNode(wxXML_DOCUMENT_NODE, wxEmptyString);
-
-    ctx.encoding = wxS("UTF-8"); // default in absence of encoding=""
-    ctx.doctype = &m_doctype;
-    ctx.removeWhiteOnlyNodes = (flags & wxXMLDOC_KEEP_WHITESPACE_NODES) == 0;
-    ctx.parser = parser;
-    ctx.node = root;
-
-    XML_SetUserData(parser, (void*)&ctx);
-    XML_SetElementHandler(parser, StartElementHnd, EndElementHnd);
-    XML_SetCharacterDataHandler(parser, TextHnd);
-    XML_SetCdataSectionHandler(parser, StartCdataHnd, EndCdataHnd);
-    XML_SetCommentHandler(parser, CommentHnd);
-    XML_SetProcessingInstructionHandler(parser, PIHnd);
-    XML_SetDoctypeDeclHandler(parser, StartDoctypeHnd, EndDoctypeHnd);
-    XML_SetDefaultHandler(parser, DefaultHnd);
+
+    m_data->parser = parser;
+    m_data->keepWhitespace = (flags & wxXMLDOC_KEEP_WHITESPACE_NODES) != 0;
+    m_data->encoding = wxS("UTF-8"); // default in absence of encoding=""
+
+    XML_SetUserData(parser, m_data.get());
+    XML_SetElementHandler(parser, ReaderStartElementHnd, ReaderEndElementHnd);
+    XML_SetCharacterDataHandler(parser, ReaderTextHnd);
+    XML_SetCdataSectionHandler(parser, ReaderStartCdataHnd, ReaderEndCdataHnd);
+    XML_SetCommentHandler(parser, ReaderCommentHnd);
+    XML_SetProcessingInstructionHandler(parser, ReaderPIHnd);
+    XML_SetStartDoctypeDeclHandler(parser, ReaderStartDoctypeHnd);
+    XML_SetDefaultHandler(parser, ReaderDefaultHnd);
     XML_SetUnknownEncodingHandler(parser, UnknownEncodingHnd, nullptr);
+}
 
-    bool ok = true;
-    do
+wxXmlReader::~wxXmlReader()
+{
+    XML_ParserFree(m_data->parser);
+}
+
+wxXmlReaderEvent wxXmlReader::Next()
+{
+    wxXmlReaderData& data = *m_data;
+    if ( data.done )
+        return data.event;
+
+    // forget the item returned by the previous call
+    if ( data.hasCurrent )
+    {
+        data.pos++;
+        data.hasCurrent = false;
+    }
+
+    for ( ;; )
     {
-        size_t len = stream.Read(buf, BUFSIZE).LastRead();
-        done = (len < BUFSIZE);
-        if (!XML_Parse(parser, buf, len, done))
+        // the last item can't be returned yet if more text may be added to it
+        if ( data.pos < data.count &&
+                !(data.open && data.pos == data.count - 1) )
         {
-            if (err)
-            {
-                err->message = XML_ErrorString(XML_GetErrorCode(parser));
-                err->line = (int)XML_GetCurrentLineNumber(parser);
-                err->column = (int)XML_GetCurrentColumnNumber(parser);
-                err->offset = XML_GetCurrentByteIndex(parser);
-            }
-            else
-            {
-                wxString error(XML_ErrorString(XML_GetErrorCode(parser)),
-                               *wxConvCurrent);
-                wxLogError(_("XML parsing error: '%s' at line %d"),
-                           error.c_str(),
-                           (int)XML_GetCurrentLineNumber(parser));
-            }
-            ok = false;
-            break;
+            data.hasCurrent = true;
+            data.event = data.items[data.pos].event;
+            return data.event;
         }
-    } while (!done);
 
-    if (ok)
-    {
-        if (!ctx.version.empty())
-            SetVersion(ctx.version);
-        if (!ctx.encoding.empty())
-            SetFileEncoding(ctx.encoding);
-        SetDocumentNode(root);
+        if ( data.finished )
+        {
+            data.done = true;
+            data.event = wxXML_READER_END_DOCUMENT;
+            return data.event;
+        }
+
+        // discard the already returned items, keeping the unfinished one, if
+        // any, by moving it to the front
+        for ( size_t n = data.pos; n < data.count; n++ )
+            std::swap(data.items[n - data.pos], data.items[n]);
+        data.count -= data.pos;
+        data.pos = 0;
+
+        if ( !data.Parse() )
+        {
+            const XML_Parser parser = data.parser;
+            data.error.message = XML_ErrorString(XML_GetErrorCode(parser));
+            data.error.line = (int)XML_GetCurrentLineNumber(parser);
+            data.error.column = (int)XML_GetCurrentColumnNumber(parser);
+            data.error.offset = XML_GetCurrentByteIndex(parser);
+
+            data.count = 0;
+            data.done = true;
+            data.event = wxXML_READER_ERROR;
+            return data.event;
+        }
     }
-    else
+}
+
+wxXmlReaderEvent wxXmlReader::GetEvent() const
+{
+    return m_data->event;
+}
+
+namespace
+{
+
+// returns the current item or an empty one if there is none
+const wxXmlReaderItem& GetCurrentItem(const wxXmlReaderData& data)
+{
+    static const wxXmlReaderItem s_noItem;
+
+    return data.hasCurrent ? data.items[data.pos] : s_noItem;
+}
+
+wxXmlStringView MakeView(const std::string& s)
+{
+    return wxXmlStringView(s.data(), s.length());
+}
+
+} // anonymous namespace
+
+wxXmlStringView wxXmlReader::GetName() const
+{
+    return MakeView(GetCurrentItem(*m_data).name);
+}
+
+wxXmlStringView wxXmlReader::GetValue() const
+{
+    return MakeView(GetCurrentItem(*m_data).value);
+}
+
+size_t wxXmlReader::GetAttributeCount() const
+{
+    return GetCurrentItem(*m_data).attributesCount;
+}
+
+wxXmlStringView wxXmlReader::GetAttributeName(size_t n) const
+{
+    const wxXmlReaderItem& item = GetCurrentItem(*m_data);
+    wxCHECK_MSG( n < item.attributesCount, wxXmlStringView(),
+                 "invalid attribute index" );
+
+    return MakeView(item.attributes[n].first);
+}
+
+wxXmlStringView wxXmlReader::GetAttributeValue(size_t n) const
+{
+    const wxXmlReaderItem& item = GetCurrentItem(*m_data);
+    wxCHECK_MSG( n < item.attributesCount, wxXmlStringView(),
+                 "invalid attribute index" );
+
+    return MakeView(item.attributes[n].second);
+}
+
+bool wxXmlReader::GetAttribute(const char* name, wxXmlStringView* value) const
+{
+    const wxXmlReaderItem& item = GetCurrentItem(*m_data);
+    for ( size_t n = 0; n < item.attributesCount; n++ )
     {
-        delete root;
+        if ( item.attributes[n].first == name )
+        {
+            if ( value )
+                *value = MakeView(item.attributes[n].second);
+            return true;
+        }
     }
 
-    XML_ParserFree(parser);
+    return false;
+}
+
+wxXmlDoctype wxXmlReader::GetDoctype() const
+{
+    const wxXmlReaderItem& item = GetCurrentItem(*m_data);
+    if ( item.event != wxXML_READER_DOCTYPE )
+        return wxXmlDoctype();
+
+    return wxXmlDoctype(wxString::FromUTF8Unchecked(item.name),
+                        wxString::FromUTF8Unchecked(item.value),
+                        wxString::FromUTF8Unchecked(item.publicId));
+}
+
+int wxXmlReader::GetLineNumber() const
+{
+    return GetCurrentItem(*m_data).line;
+}
+
+int wxXmlReader::GetDepth() const
+{
+    return GetCurrentItem(*m_data).depth;
+}
+
+const wxString& wxXmlReader::GetVersion() const
+{
+    return m_data->version;
+}
+
+const wxString& wxXmlReader::GetFileEncoding() const
+{
+    return m_data->encoding;
+}
+
+const wxXmlParseError& wxXmlReader::GetError() const
+{
+    return m_data->error;
+}
+
+//-----------------------------------------------------------------------------
+//  wxXmlDocument loading routines
+//-----------------------------------------------------------------------------
+
+bool wxXmlDocument::Load(wxInputStream& stream, int flags,
+                         wxXmlParseError* err)
+{
+    return DoLoad(stream, nullptr, flags, err);
+}
+
+bool wxXmlDocument::Load(wxInputStream& stream, wxXmlParseHandler& handler,
+                         int flags, wxXmlParseError* err)
+{
+    return DoLoad(stream, &handler, flags, err);
+}
+
+bool wxXmlDocument::DoLoad(wxInputStream& stream, wxXmlParseHandler* handler,
+                           int flags, wxXmlParseError* err)
+{
+    wxXmlReader reader(stream, flags);
+    std::unique_ptr<wxXmlNode> root(new wxXmlNode(wxXML_DOCUMENT_NODE, wxEmptyString));
+
+    // the nodes are allocated from this arena if it's used
+    std::unique_ptr<wxXmlArena> arena;
+    if ( flags & wxXMLDOC_USE_ARENA )
+        arena.reset(new wxXmlArena);
+
+    wxXmlNode *node = root.get();       // the node being parsed
+    wxXmlNode *lastChild = nullptr;     // the last child of "node"
+
+    for ( ;; )
+    {
+        wxXmlNode *child = nullptr;
+
+        switch ( reader.Next() )
+        {
+            case wxXML_READER_END_DOCUMENT:
+                if (!reader.GetVersion().empty())
+                    SetVersion(reader.GetVersion());
+                if (!reader.GetFileEncoding().empty())
+                    SetFileEncoding(reader.GetFileEncoding());
+                SetDocumentNode(root.release());
+                return true;
+
+            case wxXML_READER_ERROR:
+                if (err)
+                {
+                    *err = reader.GetError();
+                }
+                else
+                {
+                    wxLogError(_("XML parsing error: '%s' at line %d"),
+                               reader.GetError().message,
+                               reader.GetError().line);
+                }
+                return false;
+
+            case wxXML_READER_START_ELEMENT:
+                child = wxXmlCreateNode(arena.get(), wxXML_ELEMENT_NODE,
+                                        reader.GetName().ToString(),
+                                        wxEmptyString,
+                                        reader.GetLineNumber());
+
+                {
+                    wxXmlAttribute* lastAttr = nullptr;
+                    for ( size_t n = 0; n < reader.GetAttributeCount(); n++ )
+                    {
+                        const wxString name = reader.GetAttributeName(n).ToString();
+                        const wxString value = reader.GetAttributeValue(n).ToString();
+
+                        wxXmlAttribute* const attr =
+                            wxXmlCreateAttribute(arena.get(), name, value);
+
+                        // append the attributes directly instead of using
+                        // AddAttribute() which would need to find the last one
+                        if ( lastAttr )
+                            lastAttr->SetNext(attr);
+                        else
+                            child->SetAttributes(attr);
+
+                        lastAttr = attr;
+                    }
+                }
+
+                node->InsertChildAfter(child, lastChild);
+                node = child;
+                lastChild = nullptr; // our new node has no children yet
+                continue;
+
+            case wxXML_READER_END_ELEMENT:
+                // we're exiting the last children of node->GetParent() and
+                // going back one level up, so current value of node points to
+                // the last child of node->GetParent()
+                lastChild = node;
+                node = node->GetParent();
+
+                if ( handler && handler->OnElementParsed(lastChild) )
+                {
+                    // The handler doesn't need this node any more, so get rid
+                    // of it to avoid accumulating the entire document in
+                    // memory. Notice that it is always the last child of its
+                    // parent, so we need to find the one preceding it, which
+                    // becomes the new last child.
+                    wxXmlNode* prev = nullptr;
+                    for ( wxXmlNode* n = node->GetChildren();
+                          n != lastChild;
+                          n = n->GetNext() )
+                    {
+                        prev = n;
+                    }
+
+                    node->RemoveChild(lastChild);
+                    delete lastChild;
+
+                    lastChild = prev;
+                }
+                continue;
+
+            case wxXML_READER_TEXT:
+                {
+                    wxString text = reader.GetValue().ToString();
+
+                    // Historically, the leading lines consisting of white
+                    // space only were not included into the text nodes when
+                    // not keeping the white space nodes, so continue doing it
+                    // for compatibility.
+                    if ( !(flags & wxXMLDOC_KEEP_WHITESPACE_NODES) )
+                    {
+                        const size_t firstNonWhite = text.find_first_not_of(wxS(" \t\r\n"));
+                        const size_t lastNewLine = text.find_last_of(wxS('\n'), firstNonWhite);
+                        if ( lastNewLine != wxString::npos )
+                            text.erase(0, lastNewLine + 1);
+                    }
+
+                    child = wxXmlCreateNode(arena.get(), wxXML_TEXT_NODE,
+                                            wxS("text"), text,
+                                            reader.GetLineNumber());
+                }
+                break;
 
-    return ok;
+            case wxXML_READER_CDATA:
+                child = wxXmlCreateNode(arena.get(), wxXML_CDATA_SECTION_NODE,
+                                        wxS("cdata"),
+                                        reader.GetValue().ToString(),
+                                        reader.GetLineNumber());
+                break;
+
+            case wxXML_READER_COMMENT:
+                child = wxXmlCreateNode(arena.get(), wxXML_COMMENT_NODE,
+                                        wxS("comment"),
+                                        reader.GetValue().ToString(),
+                                        reader.GetLineNumber());
+                break;
+
+            case wxXML_READER_PI:
+                child = wxXmlCreateNode(arena.get(), wxXML_PI_NODE,
+                                        reader.GetName().ToString(),
+                                        reader.GetValue().ToString(),
+                                        reader.GetLineNumber());
+                break;
+
+            case wxXML_READER_DOCTYPE:
+                m_doctype = reader.GetDoctype();
+                continue;
+        }
 
+        node->InsertChildAfter(child, lastChild);
+        lastChild = child;
+    }
 }
 
 
@@ -1161,6 +1705,398 @@ bool wxXmlDocument::Save(wxOutputStream& stream, int indentstep) const
     return rc;
 }
 
+//-----------------------------------------------------------------------------
+//  wxXmlDocument binary format
+//-----------------------------------------------------------------------------
+
+// The binary format starts with a signature and the format version, followed
+// by the table of all distinct strings used in the document, encoded in UTF-8,
+// and by the nodes in document order, which refer to the strings using their
+// indices in this table. All numbers are stored as 32 bit little endian
+// integers.
+
+namespace
+{
+
+const char wxXML_BINARY_SIGNATURE[] = { 'w', 'x', 'X', 'M', 'L', 'B', 'I', 'N' };
+
+const wxUint32 wxXML_BINARY_VERSION = 1;
+
+class wxXmlBinaryWriter
+{
+public:
+    wxXmlBinaryWriter() = default;
+
+    // Add the string to the string table, if it's not there yet.
+    void AddString(const wxString& str)
+    {
+        const auto
+            res = m_index.emplace(str, static_cast<wxUint32>(m_strings.size()));
+        if ( res.second )
+            m_strings.push_back(&res.first->first);
+    }
+
+    // Add all strings used by the node and its descendants.
+    void AddStrings(const wxXmlNode* node)
+    {
+        AddString(node->GetName());
+        AddString(node->GetContent());
+
+        for ( const wxXmlAttribute* attr = node->GetAttributes();
+              attr;
+              attr = attr->GetNext() )
+        {
+            AddString(attr->GetName());
+            AddString(attr->GetValue());
+        }
+
+        for ( const wxXmlNode* child = node->GetChildren();
+              child;
+              child = child->GetNext() )
+        {
+            AddStrings(child);
+        }
+    }
+
+    void Write(wxUint32 value)
+    {
+        const char bytes[] =
+        {
+            static_cast<char>(value & 0xff),
+            static_cast<char>((value >> 8) & 0xff),
+            static_cast<char>((value >> 16) & 0xff),
+            static_cast<char>((value >> 24) & 0xff)
+        };
+
+        m_data.append(bytes, sizeof(bytes));
+    }
+
+    void WriteStrings()
+    {
+        Write(static_cast<wxUint32>(m_strings.size()));
+
+        for ( const wxString* str : m_strings )
+        {
+            const wxScopedCharBuffer utf8(str->utf8_str());
+            Write(static_cast<wxUint32>(utf8.length()));
+            m_data.append(utf8.data(), utf8.length());
+        }
+    }
+
+    // Write the index of a string previously added with AddString().
+    void WriteString(const wxString& str)
+    {
+        Write(m_index[str]);
+    }
+
+    void WriteNode(const wxXmlNode* node)
+    {
+        Write(node->GetType());
+        WriteString(node->GetName());
+        WriteString(node->GetContent());
+        Write(static_cast<wxUint32>(node->GetLineNumber()));
+
+        wxUint32 count = 0;
+        const wxXmlAttribute* attr;
+        for ( attr = node->GetAttributes(); attr; attr = attr->GetNext() )
+            count++;
+
+        Write(count);
+        for ( attr = node->GetAttributes(); attr; attr = attr->GetNext() )
+        {
+            WriteString(attr->GetName());
+            WriteString(attr->GetValue());
+        }
+
+        count = 0;
+        const wxXmlNode* child;
+        for ( child = node->GetChildren(); child; child = child->GetNext() )
+            count++;
+
+        Write(count);
+        for ( child = node->GetChildren(); child; child = child->GetNext() )
+            WriteNode(child);
+    }
+
+    const std::string& GetData() const { return m_data; }
+
+private:
+    std::unordered_map<wxString, wxUint32> m_index;
+    std::vector<const wxString*> m_strings;
+    std::string m_data;
+
+    wxDECLARE_NO_COPY_CLASS(wxXmlBinaryWriter);
+};
+
+class wxXmlBinaryReader
+{
+public:
+    wxXmlBinaryReader(const void* data, size_t length, wxXmlArena* arena)
+        : m_ptr(static_cast<const unsigned char*>(data)),
+          m_end(m_ptr + length),
+          m_arena(arena)
+    {
+    }
+
+    bool Read(wxUint32& value)
+    {
+        if ( m_end - m_ptr < 4 )
+            return false;
+
+        value = static_cast<wxUint32>(m_ptr[0]) |
+                static_cast<wxUint32>(m_ptr[1]) << 8 |
+                static_cast<wxUint32>(m_ptr[2]) << 16 |
+                static_cast<wxUint32>(m_ptr[3]) << 24;
+        m_ptr += 4;
+        return true;
+    }
+
+    bool ReadStrings()
+    {
+        wxUint32 count;
+        if ( !Read(count) )
+            return false;
+
+        // Each string takes at least 4 bytes, check for this to avoid
+        // allocating a lot of memory if the data is corrupted.
+        if ( count > static_cast<size_t>(m_end - m_ptr) / 4 )
+            return false;
+
+        m_strings.reserve(count);
+        for ( wxUint32 n = 0; n < count; n++ )
+        {
+            wxUint32 length;
+            if ( !Read(length) || length > static_cast<size_t>(m_end - m_ptr) )
+                return false;
+
+            m_strings.push_back(
+                wxString::FromUTF8(reinterpret_cast<const char*>(m_ptr), length));
+            m_ptr += length;
+        }
+
+        return true;
+    }
+
+    // Read the index of the string and return the string itself.
+    bool ReadString(const wxString*& str)
+    {
+        wxUint32 index;
+        if ( !Read(index) || index >= m_strings.size() )
+            return false;
+
+        str = &m_strings[index];
+        return true;
+    }
+
+    // Read the node with all its descendants, return null on error.
+    wxXmlNode* ReadTree()
+    {
+        wxUint32 childCount;
+        std::unique_ptr<wxXmlNode> root(ReadNode(childCount));
+        if ( !root )
+            return nullptr;
+
+        // Don't use recursion here to avoid overflowing the stack when
+        // loading (possibly corrupted) data with very deep nesting.
+        struct Parent
+        {
+            wxXmlNode* node;
+            wxXmlNode* lastChild;
+            wxUint32 remaining;
+        };
+
+        std::vector<Parent> parents;
+        parents.push_back({root.get(), nullptr, childCount});
+        while ( !parents.empty() )
+        {
+            Parent& parent = parents.back();
+            if ( !parent.remaining )
+            {
+                parents.pop_back();
+                continue;
+            }
+
+            parent.remaining--;
+
+            wxXmlNode* const child = ReadNode(childCount);
+            if ( !child )
+                return nullptr;
+
+            parent.node->InsertChildAfter(child, parent.lastChild);
+            parent.lastChild = child;
+
+            parents.push_back({child, nullptr, childCount});
+        }
+
+        return root.release();
+    }
+
+    bool IsAtEnd() const { return m_ptr == m_end; }
+
+private:
+    wxXmlNode* ReadNode(wxUint32& childCount)
+    {
+        wxUint32 type, lineNo, attrCount;
+        const wxString *name, *content;
+        if ( !Read(type) ||
+                type < wxXML_ELEMENT_NODE || type > wxXML_HTML_DOCUMENT_NODE ||
+                !ReadString(name) ||
+                !ReadString(content) ||
+                !Read(lineNo) ||
+                !Read(attrCount) )
+            return nullptr;
+
+        std::unique_ptr<wxXmlNode>
+            node(wxXmlCreateNode(m_arena, static_cast<wxXmlNodeType>(type),
+                                 *name, *content, static_cast<int>(lineNo)));
+
+        wxXmlAttribute* lastAttr = nullptr;
+        for ( wxUint32 n = 0; n < attrCount; n++ )
+        {
+            const wxString *attrName, *attrValue;
+            if ( !ReadString(attrName) || !ReadString(attrValue) )
+                return nullptr;
+
+            wxXmlAttribute* const
+                attr = wxXmlCreateAttribute(m_arena, *attrName, *attrValue);
+
+            if ( lastAttr )
+                lastAttr->SetNext(attr);
+            else
+                node->SetAttributes(attr);
+            lastAttr = attr;
+        }
+
+        if ( !Read(childCount) )
+            return nullptr;
+
+        return node.release();
+    }
+
+    const unsigned char* m_ptr;
+    const unsigned char* const m_end;
+    wxXmlArena* const m_arena;
+
+    std::vector<wxString> m_strings;
+
+    wxDECLARE_NO_COPY_CLASS(wxXmlBinaryReader);
+};
+
+} // anonymous namespace
+
+bool wxXmlDocument::SaveBinary(wxOutputStream& stream) const
+{
+    if ( !IsOk() )
+        return false;
+
+    wxXmlBinaryWriter writer;
+
+    writer.AddString(m_version);
+    writer.AddString(m_fileEncoding);
+    writer.AddString(m_doctype.GetRootName());
+    writer.AddString(m_doctype.GetSystemId());
+    writer.AddString(m_doctype.GetPublicId());
+    writer.AddStrings(GetDocumentNode());
+
+    writer.Write(wxXML_BINARY_VERSION);
+    writer.WriteStrings();
+    writer.WriteString(m_version);
+    writer.WriteString(m_fileEncoding);
+    writer.WriteString(m_doctype.GetRootName());
+    writer.WriteString(m_doctype.GetSystemId());
+    writer.WriteString(m_doctype.GetPublicId());
+    writer.Write(m_fileType);
+    writer.WriteNode(GetDocumentNode());
+
+    const std::string& data = writer.GetData();
+    stream.Write(wxXML_BINARY_SIGNATURE, sizeof(wxXML_BINARY_SIGNATURE));
+    stream.Write(data.data(), data.length());
+
+    return stream.IsOk();
+}
+
+/* static */
+bool wxXmlDocument::IsBinary(const void* data, size_t length)
+{
+    return length >= sizeof(wxXML_BINARY_SIGNATURE) &&
+            memcmp(data, wxXML_BINARY_SIGNATURE,
+                   sizeof(wxXML_BINARY_SIGNATURE)) == 0;
+}
+
+/* static */
+bool wxXmlDocument::IsBinary(wxInputStream& stream)
+{
+    char signature[sizeof(wxXML_BINARY_SIGNATURE)];
+    const size_t length = stream.Read(signature, sizeof(signature)).LastRead();
+    stream.Ungetch(signature, length);
+
+    return IsBinary(signature, length);
+}
+
+bool wxXmlDocument::LoadBinary(const void* data, size_t length, int flags)
+{
+    std::unique_ptr<wxXmlArena> arena;
+    if ( flags & wxXMLDOC_USE_ARENA )
+        arena.reset(new wxXmlArena);
+
+    const size_t signatureLength = sizeof(wxXML_BINARY_SIGNATURE);
+    if ( IsBinary(data, length) )
+    {
+        wxXmlBinaryReader reader(static_cast<const char*>(data) + signatureLength,
+                                 length - signatureLength,
+                                 arena.get());
+
+        wxUint32 version, fileType;
+        const wxString *fileVersion, *encoding, *rootName, *systemId, *publicId;
+        if ( reader.Read(version) &&
+                version == wxXML_BINARY_VERSION &&
+                reader.ReadStrings() &&
+                reader.ReadString(fileVersion) &&
+                reader.ReadString(encoding) &&
+                reader.ReadString(rootName) &&
+                reader.ReadString(systemId) &&
+                reader.ReadString(publicId) &&
+                reader.Read(fileType) &&
+                fileType <= wxTextFileType_Os2 )
+        {
+            std::unique_ptr<wxXmlNode> docNode(reader.ReadTree());
+            if ( docNode &&
+                    docNode->GetType() == wxXML_DOCUMENT_NODE &&
+                    reader.IsAtEnd() )
+            {
+                SetVersion(*fileVersion);
+                SetFileEncoding(*encoding);
+                SetDoctype(wxXmlDoctype(*rootName, *systemId, *publicId));
+                SetFileType(static_cast<wxTextFileType>(fileType));
+                SetDocumentNode(docNode.release());
+                return true;
+            }
+        }
+    }
+
+    wxLogError(_("Invalid or unsupported binary XML data."));
+    return false;
+}
+
+bool wxXmlDocument::LoadBinary(wxInputStream& stream, int flags)
+{
+    wxMemoryBuffer buf;
+    do
+    {
+        const size_t blockSize = 16384;
+        void* const block = buf.GetAppendBuf(blockSize);
+        buf.UngetAppendBuf(stream.Read(block, blockSize).LastRead());
+    } while ( stream.LastRead() );
+
+    if ( stream.GetLastError() == wxSTREAM_READ_ERROR )
+    {
+        wxLogError(_("Failed to read binary XML data."));
+        return false;
+    }
+
+    return LoadBinary(buf.GetData(), buf.GetDataLen(), flags);
+}
+
 /*static*/ wxVersionInfo wxXmlDocument::GetLibraryVersionInfo()
 {
     return wxVersionInfo("expat",
@@ -20,6 +20,8 @@ wxIMPLEMENT_DYNAMIC_CLASS(wxActivityIndicatorXmlHandler, wxXmlResourceHandler);
 
 wxActivityIndicatorXmlHandler::wxActivityIndicatorXmlHandler()
 {
+    AddHandledClass(wxS("wxActivityIndicator"));
+
     AddWindowStyles();
 }
 
@@ -27,6 +27,11 @@ wxAuiXmlHandler::wxAuiXmlHandler()
                   m_mgrInside(false),
                   m_anbInside(false)
 {
+    AddHandledClass(wxS("wxAuiManager"));
+    AddHandledClass(wxS("wxAuiPaneInfo"));
+    AddHandledClass(wxS("wxAuiNotebook"));
+    AddHandledClass(wxS("notebookpage"));
+
     XRC_ADD_STYLE(wxAUI_MGR_ALLOW_ACTIVE_PANE);
     XRC_ADD_STYLE(wxAUI_MGR_ALLOW_FLOATING);
     XRC_ADD_STYLE(wxAUI_MGR_DEFAULT);
@@ -31,6 +31,12 @@ wxAuiToolBarXmlHandler::wxAuiToolBarXmlHandler()
     , m_isInside(false)
     , m_toolbar(nullptr)
 {
+    AddHandledClass(wxS("wxAuiToolBar"));
+    AddHandledClass(wxS("tool"));
+    AddHandledClass(wxS("label"));
+    AddHandledClass(wxS("space"));
+    AddHandledClass(wxS("separator"));
+
     XRC_ADD_STYLE(wxAUI_TB_DEFAULT_STYLE);
     XRC_ADD_STYLE(wxAUI_TB_TEXT);
     XRC_ADD_STYLE(wxAUI_TB_NO_TOOLTIPS);
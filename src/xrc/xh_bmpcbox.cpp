@@ -31,6 +31,9 @@ wxBitmapComboBoxXmlHandler::wxBitmapComboBoxXmlHandler()
                      ,m_combobox(nullptr)
                      ,m_isInside(false)
 {
+    AddHandledClass(wxT("wxBitmapComboBox"));
+    AddHandledClass(wxT("ownerdrawnitem"));
+
     XRC_ADD_STYLE(wxCB_SORT);
     XRC_ADD_STYLE(wxCB_READONLY);
     AddWindowStyles();
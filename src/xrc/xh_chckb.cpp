@@ -24,6 +24,8 @@ wxIMPLEMENT_DYNAMIC_CLASS(wxCheckBoxXmlHandler, wxXmlResourceHandler);
 wxCheckBoxXmlHandler::wxCheckBoxXmlHandler()
 : wxXmlResourceHandler()
 {
+    AddHandledClass(wxT("wxCheckBox"));
+
     XRC_ADD_STYLE(wxCHK_2STATE);
     XRC_ADD_STYLE(wxCHK_3STATE);
     XRC_ADD_STYLE(wxCHK_ALLOW_3RD_STATE_FOR_USER);
@@ -27,6 +27,8 @@ wxIMPLEMENT_DYNAMIC_CLASS(wxChoiceXmlHandler, wxXmlResourceHandler);
 wxChoiceXmlHandler::wxChoiceXmlHandler()
 : wxXmlResourceHandler() , m_insideBox(false)
 {
+    AddHandledClass(wxT("wxChoice"));
+
     XRC_ADD_STYLE(wxCB_SORT);
     AddWindowStyles();
 }
@@ -28,6 +28,9 @@ wxIMPLEMENT_DYNAMIC_CLASS(wxChoicebookXmlHandler, wxXmlResourceHandler);
 wxChoicebookXmlHandler::wxChoicebookXmlHandler()
                       : m_choicebook(nullptr)
 {
+    AddHandledClass(wxT("wxChoicebook"));
+    AddHandledClass(wxT("choicebookpage"));
+
     XRC_ADD_STYLE(wxBK_DEFAULT);
     XRC_ADD_STYLE(wxBK_LEFT);
     XRC_ADD_STYLE(wxBK_RIGHT);
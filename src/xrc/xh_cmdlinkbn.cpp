@@ -22,6 +22,8 @@ wxIMPLEMENT_DYNAMIC_CLASS(wxCommandLinkButtonXmlHandler, wxXmlResourceHandler);
 wxCommandLinkButtonXmlHandler::wxCommandLinkButtonXmlHandler()
     : wxXmlResourceHandler()
 {
+    AddHandledClass(wxS("wxCommandLinkButton"));
+
     AddWindowStyles();
 }
 
@@ -25,6 +25,9 @@ wxIMPLEMENT_DYNAMIC_CLASS(wxCollapsiblePaneXmlHandler, wxXmlResourceHandler);
 wxCollapsiblePaneXmlHandler::wxCollapsiblePaneXmlHandler()
 : wxXmlResourceHandler(), m_isInside(false)
 {
+    AddHandledClass(wxT("wxCollapsiblePane"));
+    AddHandledClass(wxT("panewindow"));
+
     XRC_ADD_STYLE(wxCP_NO_TLW_RESIZE);
     XRC_ADD_STYLE(wxCP_DEFAULT_STYLE);
     AddWindowStyles();
@@ -20,6 +20,8 @@ wxIMPLEMENT_DYNAMIC_CLASS(wxDateCtrlXmlHandler, wxXmlResourceHandler);
 
 wxDateCtrlXmlHandler::wxDateCtrlXmlHandler() : wxXmlResourceHandler()
 {
+    AddHandledClass(wxT("wxDatePickerCtrl"));
+
     XRC_ADD_STYLE(wxDP_DEFAULT);
     XRC_ADD_STYLE(wxDP_SPIN);
     XRC_ADD_STYLE(wxDP_DROPDOWN);
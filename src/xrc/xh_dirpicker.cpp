@@ -20,6 +20,8 @@ wxIMPLEMENT_DYNAMIC_CLASS(wxDirPickerCtrlXmlHandler, wxXmlResourceHandler);
 
 wxDirPickerCtrlXmlHandler::wxDirPickerCtrlXmlHandler() : wxXmlResourceHandler()
 {
+    AddHandledClass(wxT("wxDirPickerCtrl"));
+
     XRC_ADD_STYLE(wxDIRP_USE_TEXTCTRL);
     XRC_ADD_STYLE(wxDIRP_DIR_MUST_EXIST);
     XRC_ADD_STYLE(wxDIRP_CHANGE_DIR);
@@ -20,6 +20,8 @@ wxIMPLEMENT_DYNAMIC_CLASS(wxFontPickerCtrlXmlHandler, wxXmlResourceHandler);
 
 wxFontPickerCtrlXmlHandler::wxFontPickerCtrlXmlHandler() : wxXmlResourceHandler()
 {
+    AddHandledClass(wxT("wxFontPickerCtrl"));
+
     XRC_ADD_STYLE(wxFNTP_USE_TEXTCTRL);
     XRC_ADD_STYLE(wxFNTP_FONTDESC_AS_LABEL);
     XRC_ADD_STYLE(wxFNTP_USEFONT_FOR_LABEL);
@@ -21,6 +21,8 @@ wxIMPLEMENT_DYNAMIC_CLASS(wxGridXmlHandler, wxXmlResourceHandler);
 wxGridXmlHandler::wxGridXmlHandler()
                 : wxXmlResourceHandler()
 {
+    AddHandledClass(wxT("wxGrid"));
+
     AddWindowStyles();
 }
 
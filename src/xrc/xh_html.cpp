@@ -23,6 +23,8 @@ wxIMPLEMENT_DYNAMIC_CLASS(wxHtmlWindowXmlHandler, wxXmlResourceHandler);
 wxHtmlWindowXmlHandler::wxHtmlWindowXmlHandler()
 : wxXmlResourceHandler()
 {
+    AddHandledClass(wxT("wxHtmlWindow"));
+
     XRC_ADD_STYLE(wxHW_SCROLLBAR_NEVER);
     XRC_ADD_STYLE(wxHW_SCROLLBAR_AUTO);
     XRC_ADD_STYLE(wxHW_NO_SELECTION);
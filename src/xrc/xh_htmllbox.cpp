@@ -25,6 +25,8 @@ wxIMPLEMENT_DYNAMIC_CLASS(wxSimpleHtmlListBoxXmlHandler, wxXmlResourceHandler);
 wxSimpleHtmlListBoxXmlHandler::wxSimpleHtmlListBoxXmlHandler()
 : wxXmlResourceHandler(), m_insideBox(false)
 {
+    AddHandledClass(wxT("wxSimpleHtmlListBox"));
+
     XRC_ADD_STYLE(wxHLB_DEFAULT_STYLE);
     XRC_ADD_STYLE(wxHLB_MULTIPLE);
     AddWindowStyles();
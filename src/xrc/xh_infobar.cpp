@@ -25,6 +25,9 @@ wxIMPLEMENT_DYNAMIC_CLASS(wxInfoBarXmlHandler, wxXmlResourceHandler);
 wxInfoBarXmlHandler::wxInfoBarXmlHandler()
     : wxXmlResourceHandler(), m_insideBar(false)
 {
+    AddHandledClass("wxInfoBar");
+    AddHandledClass("button");
+
     XRC_ADD_SHOW_EFFECT(wxSHOW_EFFECT_NONE);
     XRC_ADD_SHOW_EFFECT(wxSHOW_EFFECT_ROLL_TO_LEFT);
     XRC_ADD_SHOW_EFFECT(wxSHOW_EFFECT_ROLL_TO_RIGHT);
@@ -28,6 +28,8 @@ wxListBoxXmlHandler::wxListBoxXmlHandler()
                    : wxXmlResourceHandler(),
                      m_insideBox(false)
 {
+    AddHandledClass(wxT("wxListBox"));
+
     XRC_ADD_STYLE(wxLB_SINGLE);
     XRC_ADD_STYLE(wxLB_MULTIPLE);
     XRC_ADD_STYLE(wxLB_EXTENDED);
@@ -28,6 +28,9 @@ wxIMPLEMENT_DYNAMIC_CLASS(wxListbookXmlHandler, wxXmlResourceHandler);
 wxListbookXmlHandler::wxListbookXmlHandler()
                     : m_listbook(nullptr)
 {
+    AddHandledClass(wxT("wxListbook"));
+    AddHandledClass(wxT("listbookpage"));
+
     XRC_ADD_STYLE(wxBK_DEFAULT);
     XRC_ADD_STYLE(wxBK_LEFT);
     XRC_ADD_STYLE(wxBK_RIGHT);
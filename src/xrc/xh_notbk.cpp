@@ -28,6 +28,9 @@ wxIMPLEMENT_DYNAMIC_CLASS(wxNotebookXmlHandler, wxXmlResourceHandler);
 wxNotebookXmlHandler::wxNotebookXmlHandler()
                     : m_notebook(nullptr)
 {
+    AddHandledClass(wxT("wxNotebook"));
+    AddHandledClass(wxT("notebookpage"));
+
     XRC_ADD_STYLE(wxBK_DEFAULT);
     XRC_ADD_STYLE(wxBK_LEFT);
     XRC_ADD_STYLE(wxBK_RIGHT);
@@ -30,6 +30,8 @@ wxOwnerDrawnComboBoxXmlHandler::wxOwnerDrawnComboBoxXmlHandler()
                      :wxXmlResourceHandler()
                      ,m_insideBox(false)
 {
+    AddHandledClass(wxT("wxOwnerDrawnComboBox"));
+
     XRC_ADD_STYLE(wxCB_SIMPLE);
     XRC_ADD_STYLE(wxCB_SORT);
     XRC_ADD_STYLE(wxCB_READONLY);
@@ -30,6 +30,9 @@ wxIMPLEMENT_DYNAMIC_CLASS(wxPropertySheetDialogXmlHandler, wxXmlResourceHandler)
 wxPropertySheetDialogXmlHandler::wxPropertySheetDialogXmlHandler()
                                : m_dialog(nullptr)
 {
+    AddHandledClass(wxT("wxPropertySheetDialog"));
+    AddHandledClass(wxT("propertysheetpage"));
+
     XRC_ADD_STYLE(wxSTAY_ON_TOP);
     XRC_ADD_STYLE(wxCAPTION);
     XRC_ADD_STYLE(wxDEFAULT_DIALOG_STYLE);
@@ -27,6 +27,8 @@ wxIMPLEMENT_DYNAMIC_CLASS(wxRadioBoxXmlHandler, wxXmlResourceHandler);
 wxRadioBoxXmlHandler::wxRadioBoxXmlHandler()
 : wxXmlResourceHandler(), m_insideBox(false)
 {
+    AddHandledClass(wxT("wxRadioBox"));
+
     XRC_ADD_STYLE(wxRA_SPECIFY_COLS);
     XRC_ADD_STYLE(wxRA_HORIZONTAL);
     XRC_ADD_STYLE(wxRA_SPECIFY_ROWS);
@@ -27,6 +27,9 @@ wxSimplebookXmlHandler::wxSimplebookXmlHandler()
                         m_isInside(false),
                         m_simplebook(nullptr)
 {
+    AddHandledClass(wxS("wxSimplebook"));
+    AddHandledClass(wxS("simplebookpage"));
+
     AddWindowStyles();
 }
 
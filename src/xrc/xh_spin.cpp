@@ -30,6 +30,8 @@ wxIMPLEMENT_DYNAMIC_CLASS(wxSpinButtonXmlHandler, wxXmlResourceHandler);
 wxSpinButtonXmlHandler::wxSpinButtonXmlHandler()
 : wxXmlResourceHandler()
 {
+    AddHandledClass(wxT("wxSpinButton"));
+
     XRC_ADD_STYLE(wxSP_HORIZONTAL);
     XRC_ADD_STYLE(wxSP_VERTICAL);
     XRC_ADD_STYLE(wxSP_ARROW_KEYS);
@@ -86,6 +88,8 @@ wxIMPLEMENT_DYNAMIC_CLASS(wxSpinCtrlXmlHandler, wxXmlResourceHandler);
 wxSpinCtrlXmlHandler::wxSpinCtrlXmlHandler()
     : wxXmlResourceHandler()
 {
+    AddHandledClass(wxT("wxSpinCtrl"));
+
     AddSpinCtrlStyles(*this);
 }
 
@@ -124,6 +128,8 @@ wxIMPLEMENT_DYNAMIC_CLASS(wxSpinCtrlDoubleXmlHandler, wxXmlResourceHandler);
 wxSpinCtrlDoubleXmlHandler::wxSpinCtrlDoubleXmlHandler()
     : wxXmlResourceHandler()
 {
+    AddHandledClass(wxS("wxSpinCtrlDouble"));
+
     AddSpinCtrlStyles(*this);
 }
 
@@ -24,6 +24,8 @@ wxIMPLEMENT_DYNAMIC_CLASS(wxStaticBitmapXmlHandler, wxXmlResourceHandler);
 wxStaticBitmapXmlHandler::wxStaticBitmapXmlHandler()
                          :wxXmlResourceHandler()
 {
+    AddHandledClass(wxT("wxStaticBitmap"));
+
     AddWindowStyles();
 }
 
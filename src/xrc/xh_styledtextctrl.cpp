@@ -20,6 +20,8 @@ wxIMPLEMENT_DYNAMIC_CLASS(wxStyledTextCtrlXmlHandler, wxXmlResourceHandler);
 
 wxStyledTextCtrlXmlHandler::wxStyledTextCtrlXmlHandler()
 {
+    AddHandledClass("wxStyledTextCtrl");
+
     XRC_ADD_STYLE(wxSTC_WRAP_NONE);
     XRC_ADD_STYLE(wxSTC_WRAP_WORD);
     XRC_ADD_STYLE(wxSTC_WRAP_CHAR);
@@ -29,6 +29,11 @@ wxIMPLEMENT_DYNAMIC_CLASS(wxToolBarXmlHandler, wxXmlResourceHandler);
 wxToolBarXmlHandler::wxToolBarXmlHandler()
 : wxXmlResourceHandler(), m_isInside(false), m_toolbar(nullptr)
 {
+    AddHandledClass(wxT("wxToolBar"));
+    AddHandledClass(wxT("tool"));
+    AddHandledClass(wxT("space"));
+    AddHandledClass(wxT("separator"));
+
     XRC_ADD_STYLE(wxTB_FLAT);
     XRC_ADD_STYLE(wxTB_DOCKABLE);
     XRC_ADD_STYLE(wxTB_VERTICAL);
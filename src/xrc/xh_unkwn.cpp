@@ -124,6 +124,8 @@ wxIMPLEMENT_DYNAMIC_CLASS(wxUnknownWidgetXmlHandler, wxXmlResourceHandler);
 wxUnknownWidgetXmlHandler::wxUnknownWidgetXmlHandler()
 : wxXmlResourceHandler()
 {
+    AddHandledClass(wxT("unknown"));
+
     XRC_ADD_STYLE(wxNO_FULL_REPAINT_ON_RESIZE);
 }
 
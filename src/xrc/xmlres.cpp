@@ -32,6 +32,7 @@
 #include "wx/wfstream.h"
 #include "wx/filesys.h"
 #include "wx/filename.h"
+#include "wx/mappedfile.h"
 #include "wx/tokenzr.h"
 #include "wx/fontenum.h"
 #include "wx/fontmap.h"
@@ -45,7 +46,9 @@
 #include <limits.h>
 #include <locale.h>
 
+#include <algorithm>
 #include <memory>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -141,9 +144,35 @@ class wxXmlResourceDataRecords : public std::vector<wxXmlResourceDataRecord>
 class wxXmlResourceInternal
 {
 public:
+    // Returns the handlers which may handle the object nodes of the given
+    // class, in the same order as they appear in m_handlers.
+    const std::vector<wxXmlResourceHandler*>&
+    GetHandlersForClass(const wxString& classname)
+    {
+        auto it = m_handlersByClass.find(classname);
+        if ( it == m_handlersByClass.end() )
+        {
+            std::vector<wxXmlResourceHandler*> handlers;
+            for ( const auto& handler : m_handlers )
+            {
+                const wxArrayString& classes = handler->GetHandledClasses();
+                if ( classes.empty() || classes.Index(classname) != wxNOT_FOUND )
+                    handlers.push_back(handler.get());
+            }
+
+            it = m_handlersByClass.emplace(classname, std::move(handlers)).first;
+        }
+
+        return it->second;
+    }
+
     std::vector<std::unique_ptr<wxXmlResourceHandler>> m_handlers;
     wxXmlResourceDataRecords m_data;
 
+    // Cache used by GetHandlersForClass(), must be reset whenever m_handlers
+    // changes.
+    std::unordered_map<wxString, std::vector<wxXmlResourceHandler*>> m_handlersByClass;
+
     // Enabled features.
     std::unordered_set<wxString> m_features;
 
@@ -498,6 +527,7 @@ void wxXmlResource::AddHandler(wxXmlResourceHandler *handler)
     wxXmlResourceHandlerImpl *impl = new wxXmlResourceHandlerImpl(handler);
     handler->SetImpl(impl);
     m_internal->m_handlers.push_back(std::unique_ptr<wxXmlResourceHandler>{handler});
+    m_internal->m_handlersByClass.clear();
     handler->SetParentResource(this);
 }
 
@@ -506,6 +536,7 @@ void wxXmlResource::InsertHandler(wxXmlResourceHandler *handler)
     wxXmlResourceHandlerImpl *impl = new wxXmlResourceHandlerImpl(handler);
     handler->SetImpl(impl);
     m_internal->m_handlers.insert(m_internal->m_handlers.begin(), std::unique_ptr<wxXmlResourceHandler>{handler});
+    m_internal->m_handlersByClass.clear();
     handler->SetParentResource(this);
 }
 
@@ -514,6 +545,7 @@ void wxXmlResource::InsertHandler(wxXmlResourceHandler *handler)
 void wxXmlResource::ClearHandlers()
 {
     m_internal->m_handlers.clear();
+    m_internal->m_handlersByClass.clear();
 }
 
 
@@ -778,6 +810,38 @@ wxXmlDocument *wxXmlResource::DoLoadFile(const wxString& filename)
 {
     wxLogTrace(wxT("xrc"), wxT("opening file '%s'"), filename);
 
+    std::unique_ptr<wxXmlDocument> doc(new wxXmlDocument);
+
+#if wxUSE_FILESYSTEM && wxUSE_FILE
+    // Compiled resources created by "wxrc --binary" are loaded directly from
+    // the memory they're mapped to when they're in a local file.
+    if ( filename.StartsWith(wxS("file:")) )
+    {
+        const wxString path = wxFileSystem::URLToFileName(filename).GetFullPath();
+        if ( wxFileName::FileExists(path) )
+        {
+            wxMappedFile mapped(path);
+            if ( mapped.IsOpened() &&
+                    wxXmlDocument::IsBinary(mapped.GetData(),
+                                            mapped.GetLength()) )
+            {
+                if ( !doc->LoadBinary(mapped.GetData(), mapped.GetLength(),
+                                      wxXMLDOC_USE_ARENA) )
+                {
+                    wxLogError(_("Cannot load resources from file '%s'."),
+                               filename);
+                    return nullptr;
+                }
+
+                if (!DoLoadDocument(*doc))
+                    return nullptr;
+
+                return doc.release();
+            }
+        }
+    }
+#endif // wxUSE_FILESYSTEM && wxUSE_FILE
+
     wxInputStream *stream = nullptr;
 
 #if wxUSE_FILESYSTEM
@@ -800,8 +864,10 @@ wxXmlDocument *wxXmlResource::DoLoadFile(const wxString& filename)
         return nullptr;
     }
 
-    std::unique_ptr<wxXmlDocument> doc(new wxXmlDocument);
-    if (!doc->Load(*stream))
+    const bool loaded = wxXmlDocument::IsBinary(*stream)
+                            ? doc->LoadBinary(*stream, wxXMLDOC_USE_ARENA)
+                            : doc->Load(*stream, wxXMLDOC_USE_ARENA);
+    if (!loaded)
     {
         wxLogError(_("Cannot load resources from file '%s'."), filename);
         return nullptr;
@@ -1117,6 +1183,16 @@ wxXmlResource::DoCreateResFromNode(wxXmlNode& node,
     }
     else if (node.GetName() == wxT("object"))
     {
+        const wxString classname = node.GetAttribute(wxT("class"), wxEmptyString);
+        for ( wxXmlResourceHandler* handler :
+                m_internal->GetHandlersForClass(classname) )
+        {
+            if (handler->CanHandle(&node))
+                return handler->CreateResource(&node, parent, instance);
+        }
+
+        // Handlers deriving from the standard ones may handle more classes
+        // than they declare, so still ask all of them before giving up.
         for ( const auto& handler : m_internal->m_handlers )
         {
             if (handler->CanHandle(&node))
@@ -1515,8 +1591,15 @@ wxObject *wxXmlResourceHandlerImpl::CreateResource(wxXmlNode *node, wxObject *pa
     m_handler->m_parent = parent;
     m_handler->m_parentAsWindow = wxDynamicCast(m_handler->m_parent, wxWindow);
 
+    // The parameters index is rebuilt for the new node and must not be used
+    // after returning from here, as the node may be deleted by then and
+    // another one could be allocated at the same address.
+    m_paramIndexNode = nullptr;
+
     wxObject *returned = GetHandler()->DoCreateResource();
 
+    m_paramIndexNode = nullptr;
+
     m_handler->m_node = myNode;
     m_handler->m_class = myClass;
     m_handler->m_parent = myParent; m_handler->m_parentAsWindow = myParentAW;
@@ -2227,23 +2310,47 @@ wxXmlNode *wxXmlResourceHandlerImpl::GetParamNode(const wxString& param)
 {
     wxCHECK_MSG(m_handler->m_node, nullptr, wxT("You can't access handler data before it was initialized!"));
 
-    wxXmlNode *n = m_handler->m_node->GetChildren();
+    typedef std::pair<const wxString*, wxXmlNode*> ParamEntry;
 
-    while (n)
+    // Handlers typically query many parameters of the same node, so index its
+    // children by name on first access instead of looking through all of
+    // them every time.
+    if ( m_paramIndexNode != m_handler->m_node )
     {
-        if (n->GetType() == wxXML_ELEMENT_NODE && n->GetName() == param)
+        m_paramIndex.clear();
+        for ( wxXmlNode *n = m_handler->m_node->GetChildren(); n; n = n->GetNext() )
         {
-            // TODO: check that there are no other properties/parameters with
-            //       the same name and log an error if there are (can't do this
-            //       right now as I'm not sure if it's not going to break code
-            //       using this function in unintentional way (i.e. for
-            //       accessing other things than properties), for example
-            //       wxBitmapComboBoxXmlHandler almost surely does
-            return n;
+            if ( n->GetType() == wxXML_ELEMENT_NODE )
+                m_paramIndex.push_back(ParamEntry(&n->GetName(), n));
         }
-        n = n->GetNext();
+
+        // Use stable sort to keep the first child with the given name first.
+        std::stable_sort(m_paramIndex.begin(), m_paramIndex.end(),
+                         [](const ParamEntry& e1, const ParamEntry& e2)
+                         {
+                             return *e1.first < *e2.first;
+                         });
+
+        m_paramIndexNode = m_handler->m_node;
     }
-    return nullptr;
+
+    const auto it = std::lower_bound(m_paramIndex.begin(), m_paramIndex.end(),
+                                     param,
+                                     [](const ParamEntry& e, const wxString& name)
+                                     {
+                                         return *e.first < name;
+                                     });
+
+    // TODO: check that there are no other properties/parameters with
+    //       the same name and log an error if there are (can't do this
+    //       right now as I'm not sure if it's not going to break code
+    //       using this function in unintentional way (i.e. for
+    //       accessing other things than properties), for example
+    //       wxBitmapComboBoxXmlHandler almost surely does
+    if ( it == m_paramIndex.end() || *it->first != param )
+        return nullptr;
+
+    return it->second;
 }
 
 bool wxXmlResourceHandlerImpl::IsOfClass(wxXmlNode *node, const wxString& classname) const
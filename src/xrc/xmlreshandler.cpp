@@ -36,6 +36,11 @@ void wxXmlResourceHandler::AddStyle(const wxString& name, int value)
     m_styleValues.Add(value);
 }
 
+void wxXmlResourceHandler::AddHandledClass(const wxString& classname)
+{
+    m_handledClasses.Add(classname);
+}
+
 void wxXmlResourceHandler::AddWindowStyles()
 {
     XRC_ADD_STYLE(wxCLIP_CHILDREN);
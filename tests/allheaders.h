@@ -33,6 +33,7 @@
 #include <wx/app.h>
 #include <wx/appprogress.h>
 #include <wx/apptrait.h>
+#include <wx/arcextract.h>
 #include <wx/archive.h>
 #include <wx/arrstr.h>
 #include <wx/artprov.h>
@@ -127,6 +128,7 @@
 #include <wx/eventfilter.h>
 #include <wx/event.h>
 #include <wx/evtloop.h>
+#include <wx/evtprofiler.h>
 #include <wx/evtloopsrc.h>
 #include <wx/except.h>
 #include <wx/fdrepdlg.h>
@@ -177,6 +179,7 @@
 #include <wx/helphtml.h>
 #include <wx/helpwin.h>
 #include <wx/htmllbox.h>
+#include <wx/httpcache.h>
 #include <wx/hyperlink.h>
 #include <wx/iconbndl.h>
 #include <wx/icon.h>
@@ -215,6 +218,7 @@
 #include <wx/list.h>
 #include <wx/log.h>
 #include <wx/longlong.h>
+#include <wx/lz4stream.h>
 #include <wx/lzmastream.h>
 #include <wx/math.h>
 #include <wx/matrix.h>
@@ -244,6 +248,7 @@
 #include <wx/object.h>
 #include <wx/odcombo.h>
 #include <wx/overlay.h>
+#include <wx/paintprofiler.h>
 #include <wx/ownerdrw.h>
 #include <wx/palette.h>
 #include <wx/panel.h>
@@ -283,6 +288,7 @@
 #include <wx/regex.h>
 #include <wx/region.h>
 #include <wx/renderer.h>
+#include <wx/resourcestats.h>
 #include <wx/richmsgdlg.h>
 #include <wx/richtooltip.h>
 #include <wx/rtti.h>
@@ -387,6 +393,7 @@
 #include <wx/webview.h>
 #include <wx/wfstream.h>
 #include <wx/window.h>
+#include <wx/windowless.h>
 #include <wx/windowid.h>
 #include <wx/windowptr.h>
 #include <wx/withimages.h>
@@ -412,6 +419,7 @@
 #include <wx/xtitypes.h>
 #include <wx/xtixml.h>
 #include <wx/zipstrm.h>
+#include <wx/zstdstream.h>
 #include <wx/zstream.h>
 #include <wx/propgrid/advprops.h>
 #include <wx/propgrid/editors.h>
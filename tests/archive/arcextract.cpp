@@ -0,0 +1,230 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        tests/archive/arcextract.cpp
+// Purpose:     wxArchiveExtractor unit tests
+// Author:      wxWidgets team
+// Created:     2026-10-14
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+// ----------------------------------------------------------------------------
+// headers
+// ----------------------------------------------------------------------------
+
+#include "testprec.h"
+
+
+#if wxUSE_STREAMS && wxUSE_ARCHIVE_STREAMS && wxUSE_FFILE
+
+#include "wx/arcextract.h"
+#include "wx/ffile.h"
+#include "wx/log.h"
+#include "wx/wfstream.h"
+
+#include "testfile.h"
+
+#include <memory>
+#include <string>
+
+namespace
+{
+
+const int NUM_FILES = 50;
+
+wxString GetFileContents(int n)
+{
+    wxString s;
+    for ( int i = 0; i <= n; i++ )
+        s << "Contents of the file #" << n << "\n";
+    return s;
+}
+
+// Create an archive of the given type containing NUM_FILES files in several
+// directories and, optionally, an entry with the given name.
+void
+CreateTestArchive(const wxString& filename,
+                  const wxArchiveClassFactory& factory,
+                  const wxString& extraName = wxString())
+{
+    wxFFileOutputStream fout(filename);
+    std::unique_ptr<wxArchiveOutputStream> arc(factory.NewStream(fout));
+
+    const wxDateTime dt(1, wxDateTime::Feb, 2020, 12, 34, 56);
+
+    REQUIRE( arc->PutNextDirEntry("top", dt) );
+    for ( int n = 0; n < NUM_FILES; n++ )
+    {
+        REQUIRE( arc->PutNextEntry(wxString::Format("top/sub%d/file%d.txt", n % 3, n), dt) );
+
+        const std::string data = GetFileContents(n).utf8_string();
+        REQUIRE( arc->WriteAll(data.data(), data.length()) );
+    }
+
+    if ( !extraName.empty() )
+    {
+        REQUIRE( arc->PutNextEntry(extraName, dt) );
+        arc->Write("extra", 5);
+    }
+
+    REQUIRE( arc->Close() );
+    REQUIRE( fout.Close() );
+}
+
+// Temporary directory deleted, with all its contents, on scope exit.
+class TempDir
+{
+public:
+    TempDir()
+    {
+        m_path = wxFileName::CreateTempFileName("wxtest");
+        wxRemoveFile(m_path);
+        m_path += "-dir";
+    }
+
+    ~TempDir()
+    {
+        if ( wxDirExists(m_path) )
+            wxFileName::Rmdir(m_path, wxPATH_RMDIR_RECURSIVE);
+    }
+
+    const wxString& GetPath() const { return m_path; }
+
+private:
+    wxString m_path;
+
+    wxDECLARE_NO_COPY_CLASS(TempDir);
+};
+
+} // anonymous namespace
+
+// ----------------------------------------------------------------------------
+// tests implementation
+// ----------------------------------------------------------------------------
+
+TEST_CASE("wxArchiveExtractor::Extract", "[archive][extract]")
+{
+    const wxString protocol = GENERATE("zip", "tar");
+    const int numThreads = GENERATE(1, 0, 4);
+
+    INFO("Format: " << protocol << ", threads: " << numThreads);
+
+    const wxArchiveClassFactory* const
+        factory = wxArchiveClassFactory::Find(protocol);
+    REQUIRE( factory );
+
+    // Use the correct extension to test that the factory is found from it.
+    TestFile tf;
+    TempFile archive(tf.GetName() + "." + protocol);
+    CreateTestArchive(archive.GetName(), *factory);
+
+    TempDir dir;
+
+    wxArchiveExtractor extractor(archive.GetName());
+    extractor.SetThreadCount(numThreads);
+
+    size_t numEvents = 0;
+    size_t lastCount = 0;
+    wxFileOffset lastSize = 0;
+    bool allOk = true;
+    extractor.Bind(wxEVT_ARCHIVE_EXTRACT, [&](wxArchiveExtractorEvent& event)
+        {
+            numEvents++;
+
+            if ( !event.IsOk() )
+                allOk = false;
+
+            // Progress must be monotonic.
+            CHECK( event.GetExtractedCount() == lastCount + 1 );
+            CHECK( event.GetExtractedSize() >= lastSize );
+            CHECK( event.GetExtractedSize() <= event.GetTotalSize() );
+            CHECK( event.GetTotalCount() == NUM_FILES + 1 );
+
+            lastCount = event.GetExtractedCount();
+            lastSize = event.GetExtractedSize();
+        });
+
+    REQUIRE( extractor.Extract(dir.GetPath()) );
+    CHECK( allOk );
+    CHECK( numEvents == NUM_FILES + 1 );
+
+    const wxDateTime dt(1, wxDateTime::Feb, 2020, 12, 34, 56);
+    for ( int n = 0; n < NUM_FILES; n++ )
+    {
+        const wxString path = wxString::Format("%s/top/sub%d/file%d.txt",
+                                               dir.GetPath(), n % 3, n);
+        INFO("File: " << path);
+
+        wxFFile file(path);
+        REQUIRE( file.IsOpened() );
+
+        wxString contents;
+        REQUIRE( file.ReadAll(&contents, wxConvUTF8) );
+        CHECK( contents == GetFileContents(n) );
+
+        CHECK( wxFileName(path).GetModificationTime() == dt );
+    }
+
+    CHECK( wxFileName::DirName(dir.GetPath() + "/top").GetModificationTime() == dt );
+}
+
+TEST_CASE("wxArchiveExtractor::Unsafe", "[archive][extract]")
+{
+    TestFile tf;
+    TempFile archive(tf.GetName() + ".zip");
+    CreateTestArchive(archive.GetName(),
+                      *wxArchiveClassFactory::Find("zip"),
+                      "../outside.txt");
+
+    TempDir dir;
+
+    wxArchiveExtractor extractor(archive.GetName());
+
+    // The other entries must still be extracted, but the result of the
+    // function must indicate that there was an error.
+    wxLogNull noLog;
+    CHECK( !extractor.Extract(dir.GetPath() + "/inside") );
+    CHECK( wxFileExists(dir.GetPath() + "/inside/top/sub0/file0.txt") );
+    CHECK( !wxFileExists(dir.GetPath() + "/outside.txt") );
+}
+
+TEST_CASE("wxArchiveExtractor::Cancel", "[archive][extract]")
+{
+    const int numThreads = GENERATE(1, 4);
+
+    TestFile tf;
+    TempFile archive(tf.GetName() + ".tar");
+    CreateTestArchive(archive.GetName(), *wxArchiveClassFactory::Find("tar"));
+
+    TempDir dir;
+
+    wxArchiveExtractor extractor(archive.GetName());
+    extractor.SetThreadCount(numThreads);
+
+    size_t numEvents = 0;
+    extractor.Bind(wxEVT_ARCHIVE_EXTRACT, [&](wxArchiveExtractorEvent&)
+        {
+            if ( ++numEvents == 10 )
+                extractor.Cancel();
+        });
+
+    CHECK( !extractor.Extract(dir.GetPath()) );
+    CHECK( extractor.IsCancelled() );
+    CHECK( numEvents == 10 );
+}
+
+TEST_CASE("wxArchiveExtractor::Errors", "[archive][extract]")
+{
+    TempDir dir;
+
+    wxLogNull noLog;
+
+    // Unknown archive format.
+    wxArchiveExtractor unknown("file.unknown");
+    CHECK( !unknown.Extract(dir.GetPath()) );
+
+    // Non-existent file.
+    wxArchiveExtractor missing(dir.GetPath() + "/missing.zip");
+    CHECK( !missing.Extract(dir.GetPath()) );
+}
+
+#endif // wxUSE_STREAMS && wxUSE_ARCHIVE_STREAMS && wxUSE_FFILE
@@ -16,6 +16,7 @@
 
 #include "archivetest.h"
 #include "wx/zipstrm.h"
+#include "wx/mstream.h"
 
 #include <memory>
 
@@ -250,4 +251,114 @@ CppUnit::Test *ziptest::makeTest(
 CPPUNIT_TEST_SUITE_REGISTRATION(ziptest);
 CPPUNIT_TEST_SUITE_NAMED_REGISTRATION(ziptest, "archive/zip");
 
+TEST_CASE("wxZipInputStream::FindEntry", "[archive][zip]")
+{
+    const int NUM_ENTRIES = 1000;
+
+    wxMemoryOutputStream mos;
+    {
+        wxZipOutputStream zip(mos);
+        REQUIRE( zip.PutNextDirEntry("dir") );
+        for ( int n = 0; n < NUM_ENTRIES; n++ )
+        {
+            REQUIRE( zip.PutNextEntry(wxString::Format("dir/file%d.txt", n)) );
+            const string data = wxString::Format("contents %d", n).utf8_string();
+            zip.Write(data.data(), data.size());
+        }
+
+        CHECK( zip.Close() );
+    }
+
+    wxMemoryInputStream mis(mos);
+    wxZipInputStream unzip(mis);
+
+    const wxZipEntry* entry = unzip.FindEntry("dir/file123.txt", wxPATH_UNIX);
+    REQUIRE( entry );
+    CHECK( entry->GetInternalName() == "dir/file123.txt" );
+    CHECK( entry->GetSize() == 12 );
+
+    entry = unzip.FindEntry("dir", wxPATH_UNIX);
+    REQUIRE( entry );
+    CHECK( entry->IsDir() );
+
+    CHECK( !unzip.FindEntry("dir/file1000.txt", wxPATH_UNIX) );
+
+    // Entries can be opened in any order.
+    for ( int n : { 999, 0, 500, 1 } )
+    {
+        const wxString name = wxString::Format("dir/file%d.txt", n);
+        INFO( name );
+        REQUIRE( unzip.OpenEntry(name, wxPATH_UNIX) );
+
+        char buf[32];
+        const size_t len = unzip.Read(buf, sizeof(buf)).LastRead();
+        CHECK( string(buf, len) == wxString::Format("contents %d", n).utf8_string() );
+    }
+
+    CHECK( !unzip.OpenEntry("nonexistent", wxPATH_UNIX) );
+
+    // Finding the entries doesn't affect the sequential iteration.
+    int count = 0;
+    for ( std::unique_ptr<wxZipEntry> e(unzip.GetNextEntry());
+          e;
+          e.reset(unzip.GetNextEntry()) )
+    {
+        count++;
+    }
+
+    CHECK( count == NUM_ENTRIES + 1 );
+}
+
+#if wxUSE_THREADS
+
+TEST_CASE("wxZipOutputStream::SetThreadCount", "[archive][zip][thread]")
+{
+    string data;
+    for ( int n = 0; data.size() < 500000; n++ )
+        data += wxString::Format("Entry line %d\n", n).utf8_string();
+
+    wxMemoryOutputStream mos;
+    {
+        wxZipOutputStream zip(mos);
+        zip.SetThreadCount(4);
+        CHECK( zip.GetThreadCount() == 4 );
+
+        for ( int n = 0; n < 3; n++ )
+        {
+            REQUIRE( zip.PutNextEntry(wxString::Format("entry%d.txt", n)) );
+            zip.Write(data.data(), data.size());
+        }
+
+        CHECK( zip.Close() );
+    }
+
+    wxMemoryInputStream mis(mos);
+    wxZipInputStream unzip(mis);
+
+    int count = 0;
+    for ( std::unique_ptr<wxZipEntry> entry(unzip.GetNextEntry());
+          entry;
+          entry.reset(unzip.GetNextEntry()) )
+    {
+        INFO( entry->GetName() );
+        CHECK( entry->GetMethod() == wxZIP_METHOD_DEFLATE );
+
+        string result(data.size() + 1, '\0');
+        unzip.Read(&result[0], result.size());
+        CHECK( unzip.LastRead() == data.size() );
+        result.resize(unzip.LastRead());
+        CHECK( result == data );
+
+        // Reading past the end verifies the entry CRC.
+        CHECK( unzip.Eof() );
+        CHECK( unzip.GetLastError() == wxSTREAM_EOF );
+
+        count++;
+    }
+
+    CHECK( count == 3 );
+}
+
+#endif // wxUSE_THREADS
+
 #endif // wxUSE_STREAMS && wxUSE_ZIPSTREAM
@@ -413,6 +413,49 @@ TEST_CASE("wxSortedArrayString", "[dynarray]")
     CHECK( ad.Index("z") == wxNOT_FOUND );
 }
 
+TEST_CASE("wxSortedArrayString::AddSorted", "[dynarray]")
+{
+    wxArrayString src;
+    src.Add("delta");
+    src.Add("alpha");
+    src.Add("echo");
+    src.Add("charlie");
+    src.Add("alpha");
+
+    wxSortedArrayString a(src);
+    REQUIRE( a.size() == 5 );
+    CHECK( wxJoin(a, ',') == "alpha,alpha,charlie,delta,echo" );
+
+    wxArrayString more;
+    more.Add("foxtrot");
+    more.Add("bravo");
+    more.Add("charlie");
+    a.AddSorted(more);
+    CHECK( wxJoin(a, ',') ==
+            "alpha,alpha,bravo,charlie,charlie,delta,echo,foxtrot" );
+    CHECK( a.Index("bravo") == 2 );
+
+    // Adding an empty range doesn't do anything.
+    a.AddSorted(wxArrayString());
+    CHECK( a.size() == 8 );
+
+    // Adding the strings from the array itself must work too.
+    a.AddSorted(a);
+    CHECK( a.size() == 16 );
+    CHECK( a[0] == "alpha" );
+    CHECK( a[15] == "foxtrot" );
+
+    wxSortedArrayString ar(wxStringSortDescending);
+    ar.Add("b");
+    ar.AddSorted(src);
+    CHECK( wxJoin(ar, ',') == "echo,delta,charlie,b,alpha,alpha" );
+
+    wxSortedArrayString an(wxCmpNaturalGeneric);
+    an.Add("file2");
+    an.AddSorted(wxSplit("file10,File1,file3", ','));
+    CHECK( wxJoin(an, ',') == "File1,file2,file3,file10" );
+}
+
 TEST_CASE("Arrays::Split", "[dynarray]")
 {
     // test wxSplit:
@@ -913,6 +956,33 @@ TEST_CASE("wxCmpNaturalGeneric", "[wxString][compare]")
     CHECK(wxCmpNaturalGeneric("a5th 5", "a 10th 10") > 0);
 }
 
+TEST_CASE("wxArrayString::SortNatural", "[dynarray][compare]")
+{
+    // Sorting with wxCmpNaturalGeneric() uses precomputed keys, check that
+    // the result is the same as when using it directly.
+    wxArrayString a = wxSplit("a10th,a5th,10,1 st,File1,file01,,x,5,a 10th,"
+                              "9999999999999999999,1,b,A1st1,a01st01", ',');
+    wxArrayString expected(a);
+
+    a.Sort(wxCmpNaturalGeneric);
+
+    std::stable_sort(expected.begin(), expected.end(),
+                     [](const wxString& s1, const wxString& s2)
+                     {
+                        return wxCmpNaturalGeneric(s1, s2) < 0;
+                     });
+
+    REQUIRE( a.size() == expected.size() );
+    for ( size_t n = 0; n < a.size(); ++n )
+    {
+        INFO("n=" << n);
+        CHECK( wxCmpNaturalGeneric(a[n], expected[n]) == 0 );
+    }
+
+    CHECK( a[0] == "" );
+    CHECK( a.Last() == "x" );
+}
+
 TEST_CASE("wxCmpNatural", "[wxString][compare]")
 {
     // We can't expect much from the native natural comparison function as it's
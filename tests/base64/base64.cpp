@@ -19,6 +19,7 @@
 #if wxUSE_BASE64
 
 #include "wx/base64.h"
+#include "wx/mstream.h"
 
 static const char encoded0to255[] =
     "AAECAwQFBgcICQoLDA0ODxAREhMUFRYXGBkaGxwdHh8gISIj"
@@ -303,4 +304,98 @@ void Base64TestCase::DecodeInvalid()
     CPPUNIT_ASSERT( !wxBase64Decode("wxGetApp()").GetDataLen() );
 }
 
+TEST_CASE("Base64::Long", "[base64]")
+{
+    // Use lengths around the block sizes used by the vectorized code.
+    for ( size_t len = 0; len < 200; len++ )
+    {
+        INFO("Length " << len);
+
+        wxMemoryBuffer buf;
+        for ( size_t n = 0; n < len; n++ )
+            buf.AppendByte(static_cast<char>(n * 37 + len));
+
+        const wxString str = wxBase64Encode(buf);
+        REQUIRE( str.length() == wxBase64EncodedSize(len) );
+
+        const wxMemoryBuffer dec = wxBase64Decode(str);
+        REQUIRE( dec.GetDataLen() == len );
+        CHECK( memcmp(dec.GetData(), buf.GetData(), len) == 0 );
+
+        // Check that invalid characters are still found in long strings.
+        if ( len > 50 )
+        {
+            wxString bad = str;
+            bad[40] = '!';
+
+            size_t posErr = 0;
+            CHECK( wxBase64Decode(nullptr, 0, bad, wxBase64DecodeMode_Strict,
+                                  &posErr) == wxCONV_FAILED );
+            CHECK( posErr == 40 );
+
+            CHECK( wxBase64Decode(bad, wxBase64DecodeMode_Relaxed)
+                    .GetDataLen() == len - 1 );
+        }
+    }
+}
+
+#if wxUSE_STREAMS
+
+TEST_CASE("Base64::Stream", "[base64][stream]")
+{
+    wxMemoryBuffer buf;
+    for ( size_t n = 0; n < 200001; n++ )
+        buf.AppendByte(static_cast<char>(n % 251));
+
+    wxMemoryInputStream in(buf.GetData(), buf.GetDataLen());
+    wxMemoryOutputStream out;
+    const size_t encLen = wxBase64Encode(out, in);
+    REQUIRE( encLen == wxBase64EncodedSize(buf.GetDataLen()) );
+
+    wxString str(wxString::FromAscii(
+        static_cast<const char*>(out.GetOutputStreamBuffer()->GetBufferStart()),
+        encLen));
+    CHECK( str == wxBase64Encode(buf) );
+
+    SECTION("Strict")
+    {
+        wxMemoryInputStream in2(out);
+        wxMemoryOutputStream out2;
+        REQUIRE( wxBase64Decode(out2, in2) == buf.GetDataLen() );
+        REQUIRE( out2.GetLength() == buf.GetDataLen() );
+        CHECK( memcmp(out2.GetOutputStreamBuffer()->GetBufferStart(),
+                      buf.GetData(), buf.GetDataLen()) == 0 );
+    }
+
+    SECTION("SkipWS")
+    {
+        for ( size_t n = 76; n < str.length(); n += 77 )
+            str.insert(n, "\n");
+
+        const wxScopedCharBuffer ascii = str.ToAscii();
+        wxMemoryInputStream in2(ascii.data(), ascii.length());
+        wxMemoryOutputStream out2;
+        CHECK( wxBase64Decode(out2, in2, wxBase64DecodeMode_SkipWS)
+                == buf.GetDataLen() );
+
+        wxMemoryInputStream in3(ascii.data(), ascii.length());
+        wxMemoryOutputStream out3;
+        CHECK( wxBase64Decode(out3, in3) == wxCONV_FAILED );
+    }
+
+    SECTION("Invalid")
+    {
+        wxMemoryInputStream in2("QQ==QQ==", 8);
+        wxMemoryOutputStream out2;
+        CHECK( wxBase64Decode(out2, in2) == wxCONV_FAILED );
+
+        wxMemoryInputStream in3("QUJD QQ", 7);
+        wxMemoryOutputStream out3;
+        CHECK( wxBase64Decode(out3, in3, wxBase64DecodeMode_SkipWS)
+                == wxCONV_FAILED );
+    }
+}
+
+#endif // wxUSE_STREAMS
+
 #endif // wxUSE_BASE64
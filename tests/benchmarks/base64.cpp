@@ -0,0 +1,91 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        tests/benchmarks/base64.cpp
+// Purpose:     Base64 encoding and decoding benchmarks
+// Author:      wxWidgets team
+// Created:     2026-10-15
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+#include "wx/base64.h"
+#include "wx/mstream.h"
+
+#include "bench.h"
+
+#if wxUSE_BASE64
+
+namespace
+{
+
+// The amount of data encoded by a single benchmark run.
+const size_t DATA_SIZE = 16*1024*1024;
+
+const wxMemoryBuffer& GetTestData()
+{
+    static wxMemoryBuffer s_data;
+    if ( !s_data.GetDataLen() )
+    {
+        unsigned char* const p =
+            static_cast<unsigned char*>(s_data.GetWriteBuf(DATA_SIZE));
+        for ( size_t n = 0; n < DATA_SIZE; n++ )
+            p[n] = static_cast<unsigned char>((n * 7919) >> 3);
+        s_data.UngetWriteBuf(DATA_SIZE);
+    }
+
+    return s_data;
+}
+
+const wxCharBuffer& GetEncodedData()
+{
+    static wxCharBuffer s_encoded;
+    if ( !s_encoded.length() )
+    {
+        const wxMemoryBuffer& data = GetTestData();
+        s_encoded.extend(wxBase64EncodedSize(data.GetDataLen()));
+        wxBase64Encode(s_encoded.data(), s_encoded.length(),
+                       data.GetData(), data.GetDataLen());
+    }
+
+    return s_encoded;
+}
+
+} // anonymous namespace
+
+BENCHMARK_FUNC(Base64Encode)
+{
+    const wxMemoryBuffer& data = GetTestData();
+    static wxCharBuffer s_buf(wxBase64EncodedSize(DATA_SIZE));
+
+    Bench::SetItemsPerRun(data.GetDataLen(), "B");
+
+    return wxBase64Encode(s_buf.data(), s_buf.length(),
+                          data.GetData(), data.GetDataLen()) == s_buf.length();
+}
+
+BENCHMARK_FUNC(Base64Decode)
+{
+    const wxCharBuffer& encoded = GetEncodedData();
+    static wxMemoryBuffer s_buf(DATA_SIZE);
+
+    Bench::SetItemsPerRun(DATA_SIZE, "B");
+
+    return wxBase64Decode(s_buf.GetWriteBuf(DATA_SIZE), DATA_SIZE,
+                          encoded.data(), encoded.length()) == DATA_SIZE;
+}
+
+#if wxUSE_STREAMS
+
+BENCHMARK_FUNC(Base64DecodeStream)
+{
+    const wxCharBuffer& encoded = GetEncodedData();
+
+    Bench::SetItemsPerRun(DATA_SIZE, "B");
+
+    wxMemoryInputStream in(encoded.data(), encoded.length());
+    wxMemoryOutputStream out;
+    return wxBase64Decode(out, in) == DATA_SIZE;
+}
+
+#endif // wxUSE_STREAMS
+
+#endif // wxUSE_BASE64
@@ -15,13 +15,28 @@
 // headers
 // ----------------------------------------------------------------------------
 
-#include <float.h>
+#include <math.h>
+#include <string.h>
 
 #include "wx/app.h"
 #include "wx/cmdline.h"
+#include "wx/ffile.h"
+#include "wx/filename.h"
 #include "wx/stopwatch.h"
+#include "wx/textfile.h"
 #include "wx/uilocale.h"
 
+#include <algorithm>
+#include <map>
+#include <vector>
+
+#ifdef __LINUX__
+    #include <linux/perf_event.h>
+    #include <sys/ioctl.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
+
 #if wxUSE_GUI
     #include "wx/frame.h"
 #endif
@@ -40,6 +55,166 @@ static const char OPTION_NUM_RUNS = 'n';
 static const char OPTION_NUMERIC_PARAM = 'p';
 static const char OPTION_STRING_PARAM = 's';
 
+static const char OPTION_WARMUP_RUNS = 'w';
+static const char OPTION_COUNTERS = 'c';
+static const char OPTION_OUTPUT = 'o';
+static const char OPTION_COMPARE = 'b';
+static const char OPTION_THRESHOLD = 'r';
+
+// ----------------------------------------------------------------------------
+// helper classes
+// ----------------------------------------------------------------------------
+
+namespace
+{
+
+// Statistics collected for a single benchmark.
+struct BenchResult
+{
+    wxString name;
+    long runs = 0;
+
+    // All times are in microseconds.
+    double mean = 0,
+           stddev = 0,
+           min = 0,
+           max = 0,
+           median = 0,
+           p90 = 0,
+           p99 = 0;
+
+    // Millions of items per second, if the benchmark defines items.
+    double throughput = 0;
+    wxString unit;
+
+    // Average number of CPU cycles and instructions per run, if available.
+    double cycles = 0,
+           instructions = 0;
+};
+
+// Return the value of the given percentile of the sorted, non-empty, vector.
+double GetPercentile(const std::vector<double>& sorted, double percent)
+{
+    const double pos = percent / 100 * (sorted.size() - 1);
+    const size_t lo = static_cast<size_t>(floor(pos));
+    const size_t hi = static_cast<size_t>(ceil(pos));
+
+    return sorted[lo] + (sorted[hi] - sorted[lo]) * (pos - lo);
+}
+
+// Hardware performance counters for the current thread, only available under
+// Linux (and only if perf events are allowed by the kernel) currently.
+class CPUCounters
+{
+public:
+    CPUCounters() = default;
+    ~CPUCounters() { Close(); }
+
+    // Return false if the counters are not available.
+    bool Open()
+    {
+#ifdef __LINUX__
+        m_fdCycles = OpenCounter(PERF_COUNT_HW_CPU_CYCLES, -1);
+        if ( m_fdCycles == -1 )
+            return false;
+
+        m_fdInstructions = OpenCounter(PERF_COUNT_HW_INSTRUCTIONS, m_fdCycles);
+        if ( m_fdInstructions == -1 )
+        {
+            Close();
+            return false;
+        }
+
+        return true;
+#else // !__LINUX__
+        return false;
+#endif // __LINUX__/!__LINUX__
+    }
+
+    bool IsOpened() const { return m_fdCycles != -1; }
+
+    void Start()
+    {
+#ifdef __LINUX__
+        if ( IsOpened() )
+        {
+            ioctl(m_fdCycles, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+            ioctl(m_fdCycles, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+        }
+#endif // __LINUX__
+    }
+
+    // Stop counting and add the values counted since Start() to the totals.
+    void Stop()
+    {
+#ifdef __LINUX__
+        if ( IsOpened() )
+        {
+            ioctl(m_fdCycles, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+            m_cycles += ReadCounter(m_fdCycles);
+            m_instructions += ReadCounter(m_fdInstructions);
+        }
+#endif // __LINUX__
+    }
+
+    void Reset() { m_cycles = m_instructions = 0; }
+
+    double GetCycles() const { return m_cycles; }
+    double GetInstructions() const { return m_instructions; }
+
+private:
+#ifdef __LINUX__
+    static int OpenCounter(unsigned long long config, int groupFd)
+    {
+        perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = config;
+        attr.disabled = groupFd == -1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+
+        return static_cast<int>(syscall(SYS_perf_event_open, &attr,
+                                        0 /* this thread */, -1 /* any CPU */,
+                                        groupFd, 0));
+    }
+
+    static double ReadCounter(int fd)
+    {
+        unsigned long long value = 0;
+        if ( read(fd, &value, sizeof(value)) != sizeof(value) )
+            return 0;
+
+        return static_cast<double>(value);
+    }
+#endif // __LINUX__
+
+    void Close()
+    {
+#ifdef __LINUX__
+        if ( m_fdInstructions != -1 )
+            close(m_fdInstructions);
+        if ( m_fdCycles != -1 )
+            close(m_fdCycles);
+#endif // __LINUX__
+
+        m_fdCycles =
+        m_fdInstructions = -1;
+    }
+
+    int m_fdCycles = -1,
+        m_fdInstructions = -1;
+
+    double m_cycles = 0,
+           m_instructions = 0;
+
+    wxDECLARE_NO_COPY_CLASS(CPUCounters);
+};
+
+} // anonymous namespace
+
 // ----------------------------------------------------------------------------
 // BenchApp declaration
 // ----------------------------------------------------------------------------
@@ -74,12 +249,27 @@ private:
     // list all registered benchmarks
     void ListBenchmarks();
 
+    // save the results to m_outputFile in JSON or CSV format
+    bool SaveResults() const;
+
+    // compare the results with those in m_baselineFile, return false if there
+    // are any regressions or if comparing failed
+    bool CompareWithBaseline() const;
+
     // command lines options/parameters
     wxSortedArrayString m_toRun;
     long m_numRuns, // number of times to run a single benchmark or 0
          m_runTime, // minimum time to run a single benchmark if m_numRuns == 0
-         m_numParam;
-    wxString m_strParam;
+         m_numParam,
+         m_numWarmupRuns, // number of untimed runs before the timed ones
+         m_threshold; // percentage of slowdown considered a regression
+    wxString m_strParam,
+             m_outputFile,
+             m_baselineFile;
+
+    CPUCounters m_counters;
+
+    std::vector<BenchResult> m_results;
 };
 
 wxIMPLEMENT_APP_CONSOLE(BenchApp);
@@ -102,6 +292,16 @@ wxString Bench::GetStringParameter(const wxString& defVal)
     return !val.empty() ? val : defVal;
 }
 
+// Values set by SetItemsPerRun() for the currently running benchmark.
+static double gs_itemsPerRun = 0;
+static const char* gs_itemsUnit = "";
+
+void Bench::SetItemsPerRun(double items, const char* unit)
+{
+    gs_itemsPerRun = items;
+    gs_itemsUnit = unit;
+}
+
 // ============================================================================
 // BenchApp implementation
 // ============================================================================
@@ -111,6 +311,8 @@ BenchApp::BenchApp()
     m_numRuns = 0; // this means to use m_runTime
     m_runTime = 500; // default minimum
     m_numParam = 0;
+    m_numWarmupRuns = 0;
+    m_threshold = 5;
 }
 
 bool BenchApp::OnInit()
@@ -177,6 +379,40 @@ void BenchApp::OnInitCmdLine(wxCmdLineParser& parser)
                      "(default: empty)",
                      wxCMD_LINE_VAL_STRING);
 
+    parser.AddOption(OPTION_WARMUP_RUNS,
+                     "warmup",
+                     wxString::Format
+                     (
+                         "number of times to run each benchmark before "
+                         "measuring it (default: %ld)",
+                         m_numWarmupRuns
+                     ),
+                     wxCMD_LINE_VAL_NUMBER);
+    parser.AddSwitch(OPTION_COUNTERS,
+                     "counters",
+                     "also show CPU cycles and instructions per run "
+                     "(only supported under Linux)");
+    parser.AddOption(OPTION_OUTPUT,
+                     "output",
+                     "save the results to the given file, in CSV format if "
+                     "its extension is .csv or JSON otherwise",
+                     wxCMD_LINE_VAL_STRING);
+    parser.AddOption(OPTION_COMPARE,
+                     "baseline",
+                     "compare the results with the baseline previously saved "
+                     "in JSON format using --output and exit with error code "
+                     "if any regressions are detected",
+                     wxCMD_LINE_VAL_STRING);
+    parser.AddOption(OPTION_THRESHOLD,
+                     "threshold",
+                     wxString::Format
+                     (
+                         "percentage of median time increase considered to be "
+                         "a regression when comparing (default: %ld)",
+                         m_threshold
+                     ),
+                     wxCMD_LINE_VAL_NUMBER);
+
     parser.AddParam("benchmark name",
                     wxCMD_LINE_VAL_STRING,
                     wxCMD_LINE_PARAM_OPTIONAL | wxCMD_LINE_PARAM_MULTIPLE);
@@ -205,6 +441,15 @@ bool BenchApp::OnCmdLineParsed(wxCmdLineParser& parser)
     const bool numRunsSpecified = parser.Found(OPTION_NUM_RUNS, &m_numRuns);
     parser.Found(OPTION_NUMERIC_PARAM, &m_numParam);
     parser.Found(OPTION_STRING_PARAM, &m_strParam);
+    parser.Found(OPTION_WARMUP_RUNS, &m_numWarmupRuns);
+    parser.Found(OPTION_OUTPUT, &m_outputFile);
+    parser.Found(OPTION_COMPARE, &m_baselineFile);
+    parser.Found(OPTION_THRESHOLD, &m_threshold);
+
+    if ( parser.Found(OPTION_COUNTERS) && !m_counters.Open() )
+    {
+        wxFprintf(stderr, "CPU counters are not available, ignoring.\n");
+    }
     if ( parser.Found(OPTION_SINGLE) )
     {
         if ( runTimeSpecified || numRunsSpecified )
@@ -277,96 +522,304 @@ int BenchApp::OnRun()
         }
     }
 
+    if ( !m_outputFile.empty() && !SaveResults() )
+        rc = EXIT_FAILURE;
+
+    if ( !m_baselineFile.empty() && !CompareWithBaseline() )
+        rc = EXIT_FAILURE;
+
     return rc;
 }
 
 bool BenchApp::RunSingleBenchmark(Bench::Function* func)
 {
+    gs_itemsPerRun = 0;
+
     if ( !func->Init() )
         return false;
 
     wxPrintf("Benchmarking %s: ", func->GetName());
     fflush(stdout);
 
-    // We use the algorithm for iteratively computing the mean and the
-    // standard deviation of the sequence of values described in Knuth's
-    // "The Art of Computer Programming, Volume 2: Seminumerical
-    // Algorithms", section 4.2.2.
-    //
-    // The algorithm defines the sequences M(k) and S(k) as follows:
-    //
-    //  M(1) = x(1), M(k) = M(k-1) + (x(k) - M(k-1)) / k
-    //  S(1) = 0,    S(k) = S(k-1) + (x(k) - M(k-1))*(x(k) - M(k))
-    //
-    // where x(k) is the k-th value. Then the mean is simply the last value
-    // of the first sequence M(N) and the standard deviation is
-    // sqrt(S(N)/(N-1)).
-
-    wxStopWatch swTotal;
-    if ( !func->Run() )
-        return false;
+    for ( long w = 0; w < m_numWarmupRuns; w++ )
+    {
+        if ( !func->Run() )
+            return false;
+    }
 
-    double timeMin = DBL_MAX,
-           timeMax = 0;
+    // Collect the times of all runs, in microseconds, to compute the median
+    // and percentiles later.
+    std::vector<double> times;
 
-    double m = swTotal.TimeInMicro().ToDouble();
-    double s = 0;
+    m_counters.Reset();
 
-    long n = 0;
+    wxStopWatch swTotal;
     for ( ;; )
     {
-        // One termination condition is reaching the maximum number of runs.
-        if ( ++n == m_numRuns )
-            break;
+        m_counters.Start();
 
-        double t;
-        {
-            wxStopWatch swThis;
-            if ( !func->Run() )
-                return false;
+        wxStopWatch swThis;
+        if ( !func->Run() )
+            return false;
 
-            t = swThis.TimeInMicro().ToDouble();
-        }
+        times.push_back(swThis.TimeInMicro().ToDouble());
 
-        if ( t < timeMin )
-            timeMin = t;
-        if ( t > timeMax )
-            timeMax = t;
+        m_counters.Stop();
 
-        const double lastM = m;
-        m += (t - lastM) / n;
-        s += (t - lastM)*(t - m);
+        // One termination condition is reaching the maximum number of runs.
+        if ( static_cast<long>(times.size()) == m_numRuns )
+            break;
 
         // The other termination condition is that we are running for at least
         // m_runTime milliseconds.
-        if ( m_runTime && swTotal.Time() >= m_runTime )
+        if ( m_runTime )
+        {
+            if ( swTotal.Time() >= m_runTime )
+                break;
+        }
+        else if ( !m_numRuns )
+        {
+            // Neither condition is specified, just run once then.
             break;
+        }
     }
 
     func->Done();
 
+    BenchResult res;
+    res.name = func->GetName();
+    res.runs = static_cast<long>(times.size());
+
+    const long n = res.runs;
+
+    double sum = 0;
+    for ( double t : times )
+        sum += t;
+    res.mean = sum / n;
+
+    if ( n > 1 )
+    {
+        double sumSq = 0;
+        for ( double t : times )
+            sumSq += (t - res.mean)*(t - res.mean);
+        res.stddev = sqrt(sumSq / (n - 1));
+    }
+
+    std::sort(times.begin(), times.end());
+    res.min = times.front();
+    res.max = times.back();
+    res.median = GetPercentile(times, 50);
+    res.p90 = GetPercentile(times, 90);
+    res.p99 = GetPercentile(times, 99);
+
+    // As the times are in microseconds, items per microsecond are the same as
+    // millions of items per second.
+    if ( gs_itemsPerRun && res.mean > 0 )
+    {
+        res.throughput = gs_itemsPerRun / res.mean;
+        res.unit = gs_itemsUnit;
+    }
+
+    if ( m_counters.IsOpened() )
+    {
+        res.cycles = m_counters.GetCycles() / n;
+        res.instructions = m_counters.GetInstructions() / n;
+    }
+
     // For a single run there is no standard deviation and min/max don't make
     // much sense.
     if ( n == 1 )
     {
-        wxPrintf("single run took %.0fus\n", m);
+        wxPrintf("single run took %.0fus", res.mean);
     }
     else
     {
-        s = sqrt(s / (n - 1));
-
         wxPrintf
         (
-            "%ld runs, %.0fus avg, %.0f std dev (%.0f/%.0f min/max)\n",
-            n, m, s, timeMin, timeMax
+            "%ld runs, %.0fus avg, %.0fus median, %.0f std dev "
+            "(%.0f/%.0f min/max, %.0f/%.0f p90/p99)",
+            n, res.mean, res.median, res.stddev,
+            res.min, res.max, res.p90, res.p99
         );
     }
 
+    if ( res.throughput )
+        wxPrintf(", %.1f M%s/s", res.throughput, res.unit);
+
+    if ( m_counters.IsOpened() )
+    {
+        wxPrintf(", %.0f cycles, %.0f instructions (%.2f IPC)",
+                 res.cycles, res.instructions,
+                 res.cycles ? res.instructions / res.cycles : 0.);
+    }
+
+    wxPrintf("\n");
+
     fflush(stdout);
 
+    m_results.push_back(res);
+
     return true;
 }
 
+bool BenchApp::SaveResults() const
+{
+    wxFFile file(m_outputFile, "w");
+    if ( !file.IsOpened() )
+        return false;
+
+    const bool csv = wxFileName(m_outputFile).GetExt().IsSameAs("csv", false);
+
+    wxString out;
+    if ( csv )
+    {
+        out = "name,runs,mean,median,stddev,min,max,p90,p99,"
+              "throughput,unit,cycles,instructions\n";
+    }
+    else
+    {
+        // Note that the baseline comparison code relies on each benchmark
+        // being output on its own line.
+        out.Printf("{\n\"build\": \"%s\",\n\"benchmarks\": [\n",
+                   WX_BUILD_OPTIONS_SIGNATURE);
+    }
+
+    for ( size_t n = 0; n < m_results.size(); n++ )
+    {
+        const BenchResult& r = m_results[n];
+
+        // Use the C locale for the numbers, whatever the current one is.
+        const auto num = [](double x) { return wxString::FromCDouble(x, 3); };
+
+        if ( csv )
+        {
+            out << r.name << ','
+                << r.runs << ','
+                << num(r.mean) << ','
+                << num(r.median) << ','
+                << num(r.stddev) << ','
+                << num(r.min) << ','
+                << num(r.max) << ','
+                << num(r.p90) << ','
+                << num(r.p99) << ','
+                << num(r.throughput) << ','
+                << r.unit << ','
+                << num(r.cycles) << ','
+                << num(r.instructions) << '\n';
+        }
+        else
+        {
+            out << "{\"name\": \"" << r.name << "\", "
+                << "\"runs\": " << r.runs << ", "
+                << "\"mean\": " << num(r.mean) << ", "
+                << "\"median\": " << num(r.median) << ", "
+                << "\"stddev\": " << num(r.stddev) << ", "
+                << "\"min\": " << num(r.min) << ", "
+                << "\"max\": " << num(r.max) << ", "
+                << "\"p90\": " << num(r.p90) << ", "
+                << "\"p99\": " << num(r.p99) << ", "
+                << "\"throughput\": " << num(r.throughput) << ", "
+                << "\"unit\": \"" << r.unit << "\", "
+                << "\"cycles\": " << num(r.cycles) << ", "
+                << "\"instructions\": " << num(r.instructions) << "}"
+                << (n + 1 < m_results.size() ? "," : "") << '\n';
+        }
+    }
+
+    if ( !csv )
+        out << "]\n}\n";
+
+    if ( !file.Write(out) || !file.Close() )
+        return false;
+
+    wxPrintf("Results saved to %s\n", m_outputFile);
+
+    return true;
+}
+
+bool BenchApp::CompareWithBaseline() const
+{
+    wxTextFile file;
+    if ( !file.Open(m_baselineFile) )
+        return false;
+
+    // Extract the value of the given field from the line containing the JSON
+    // object written by SaveResults().
+    const auto getField = [](const wxString& line,
+                             const wxString& field,
+                             wxString* value)
+    {
+        const wxString key = '"' + field + "\": ";
+        const size_t pos = line.find(key);
+        if ( pos == wxString::npos )
+            return false;
+
+        const size_t start = pos + key.length();
+        const size_t end = line.find_first_of(",}", start);
+        if ( end == wxString::npos )
+            return false;
+
+        *value = line.substr(start, end - start);
+        value->Replace("\"", "");
+        return true;
+    };
+
+    std::map<wxString, double> baseline;
+    for ( size_t n = 0; n < file.GetLineCount(); n++ )
+    {
+        const wxString& line = file[n];
+
+        wxString name,
+                 median;
+        double value;
+        if ( getField(line, "name", &name) &&
+                getField(line, "median", &median) &&
+                    median.ToCDouble(&value) )
+        {
+            baseline[name] = value;
+        }
+    }
+
+    if ( baseline.empty() )
+    {
+        wxFprintf(stderr, "No benchmark results found in \"%s\".\n",
+                  m_baselineFile);
+        return false;
+    }
+
+    wxPrintf("Comparison of median times with %s:\n", m_baselineFile);
+
+    bool ok = true;
+    for ( const BenchResult& r : m_results )
+    {
+        const auto it = baseline.find(r.name);
+        if ( it == baseline.end() )
+        {
+            wxPrintf("\t%s: not in baseline\n", r.name);
+            continue;
+        }
+
+        const double base = it->second;
+        const double change = base > 0 ? (r.median - base) / base * 100 : 0;
+
+        const char* verdict = "";
+        if ( change > m_threshold )
+        {
+            verdict = " REGRESSION";
+            ok = false;
+        }
+        else if ( change < -m_threshold )
+        {
+            verdict = " improvement";
+        }
+
+        wxPrintf("\t%s: %.0fus vs %.0fus (%+.1f%%)%s\n",
+                 r.name, r.median, base, change, verdict);
+    }
+
+    return ok;
+}
+
 int BenchApp::OnExit()
 {
 #if wxUSE_GUI
@@ -93,6 +93,16 @@ long GetNumericParameter(long defValue = 1);
  */
 wxString GetStringParameter(const wxString& defValue = wxString());
 
+/**
+    Set the number of items processed by a single run of the benchmark.
+
+    If a benchmark function calls this function, the throughput, i.e. the
+    number of millions of items processed per second, is shown in addition to
+    the run times. The @a unit is used in the output, e.g. "Pix" for pixels
+    results in the throughput shown in "MPix/s".
+ */
+void SetItemsPerRun(double items, const char* unit);
+
 } // namespace Bench
 
 /**
@@ -0,0 +1,134 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        tests/benchmarks/compress.cpp
+// Purpose:     Compressing output streams benchmarks
+// Author:      wxWidgets team
+// Created:     2026-10-14
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+#include "wx/lz4stream.h"
+#include "wx/lzmastream.h"
+#include "wx/mstream.h"
+#include "wx/string.h"
+#include "wx/zstdstream.h"
+#include "wx/zstream.h"
+
+#include "bench.h"
+
+namespace
+{
+
+// The amount of data compressed by a single benchmark run.
+const size_t DATA_SIZE = 16*1024*1024;
+
+const std::string& GetTestData()
+{
+    static std::string s_data;
+    if ( s_data.empty() )
+    {
+        s_data.reserve(DATA_SIZE);
+        for ( int n = 0; s_data.size() < DATA_SIZE; n++ )
+        {
+            s_data += wxString::Format("%08d: value=%d\n",
+                                       n, (n * 7919) % 100003).utf8_string();
+        }
+
+        s_data.resize(DATA_SIZE);
+    }
+
+    return s_data;
+}
+
+// Write the test data to the given compressing stream and check that it
+// actually got compressed.
+bool DoCompress(wxMemoryOutputStream& mos, wxOutputStream& os)
+{
+    const std::string& data = GetTestData();
+
+    os.Write(data.data(), data.size());
+    if ( !os.Close() )
+        return false;
+
+    Bench::SetItemsPerRun(data.size(), "B");
+
+    return mos.GetSize() < data.size();
+}
+
+} // anonymous namespace
+
+#if wxUSE_ZLIB
+
+namespace
+{
+
+bool ZlibCompress(int flags, int numThreads)
+{
+    wxMemoryOutputStream mos;
+    wxZlibOutputStream zos(mos, wxZ_DEFAULT_COMPRESSION, flags);
+#if wxUSE_THREADS
+    if ( !zos.SetThreadCount(numThreads) )
+        return false;
+#else
+    wxUnusedVar(numThreads);
+#endif
+
+    return DoCompress(mos, zos);
+}
+
+} // anonymous namespace
+
+// Use the numeric parameter to specify the number of threads to use, 0 means
+// to use all of them and 1, the default, to not use any extra threads.
+BENCHMARK_FUNC(ZlibCompress)
+{
+    return ZlibCompress(wxZLIB_ZLIB, Bench::GetNumericParameter(1));
+}
+
+BENCHMARK_FUNC(GzipCompress)
+{
+    return ZlibCompress(wxZLIB_GZIP, Bench::GetNumericParameter(1));
+}
+
+#endif // wxUSE_ZLIB
+
+#if wxUSE_LIBLZMA && wxUSE_STREAMS
+
+BENCHMARK_FUNC(LZMACompress)
+{
+    wxMemoryOutputStream mos;
+    wxLZMAOutputStream zos(mos);
+
+    return DoCompress(mos, zos);
+}
+
+#endif // wxUSE_LIBLZMA && wxUSE_STREAMS
+
+#if wxUSE_LIBZSTD && wxUSE_STREAMS
+
+// As for zlib, the numeric parameter specifies the number of threads.
+BENCHMARK_FUNC(ZstdCompress)
+{
+    wxMemoryOutputStream mos;
+    wxZstdOutputStream zos(mos);
+#if wxUSE_THREADS
+    if ( !zos.SetThreadCount(Bench::GetNumericParameter(1)) )
+        return false;
+#endif
+
+    return DoCompress(mos, zos);
+}
+
+#endif // wxUSE_LIBZSTD && wxUSE_STREAMS
+
+#if wxUSE_LIBLZ4 && wxUSE_STREAMS
+
+BENCHMARK_FUNC(LZ4Compress)
+{
+    wxMemoryOutputStream mos;
+    wxLZ4OutputStream zos(mos);
+
+    return DoCompress(mos, zos);
+}
+
+#endif // wxUSE_LIBLZ4 && wxUSE_STREAMS
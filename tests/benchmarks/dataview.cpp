@@ -0,0 +1,204 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        tests/benchmarks/dataview.cpp
+// Purpose:     wxDataViewCtrl benchmarks
+// Author:      wxWidgets team
+// Created:     2026-10-14
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+#include "wx/frame.h"
+#include "wx/dataview.h"
+
+#include "bench.h"
+#include "scrollpaint.h"
+
+#if wxUSE_DATAVIEWCTRL
+
+namespace
+{
+
+// Number of children of the single top level item of the test model.
+const unsigned NUM_CHILDREN = 100000;
+
+// Model with a single top level container item with many children. The items
+// are identified by their (1-based) indices and the container is item 1.
+class BigBranchModel : public wxDataViewModel
+{
+public:
+    virtual unsigned int GetColumnCount() const override { return 1; }
+
+    virtual wxString GetColumnType(unsigned int WXUNUSED(col)) const override
+    {
+        return "string";
+    }
+
+    virtual void GetValue(wxVariant& variant,
+                          const wxDataViewItem& item,
+                          unsigned int WXUNUSED(col)) const override
+    {
+        // Use values which are not already sorted.
+        const unsigned n = GetIndex(item);
+        variant = wxString::Format("Item %u", (n*7919) % NUM_CHILDREN);
+    }
+
+    virtual bool SetValue(const wxVariant& WXUNUSED(variant),
+                          const wxDataViewItem& WXUNUSED(item),
+                          unsigned int WXUNUSED(col)) override
+    {
+        return false;
+    }
+
+    virtual wxDataViewItem GetParent(const wxDataViewItem& item) const override
+    {
+        return GetIndex(item) > 1 ? MakeItem(1) : wxDataViewItem();
+    }
+
+    virtual bool IsContainer(const wxDataViewItem& item) const override
+    {
+        return !item.IsOk() || GetIndex(item) == 1;
+    }
+
+    virtual unsigned int GetChildren(const wxDataViewItem& item,
+                                     wxDataViewItemArray& children) const override
+    {
+        if ( !item.IsOk() )
+        {
+            children.push_back(MakeItem(1));
+            return 1;
+        }
+
+        if ( GetIndex(item) != 1 )
+            return 0;
+
+        children.reserve(NUM_CHILDREN);
+        for ( unsigned n = 0; n < NUM_CHILDREN; n++ )
+            children.push_back(MakeItem(n + 2));
+
+        return NUM_CHILDREN;
+    }
+
+    static wxDataViewItem MakeItem(unsigned n)
+    {
+        return wxDataViewItem(wxUIntToPtr(n));
+    }
+
+    static unsigned GetIndex(const wxDataViewItem& item)
+    {
+        return static_cast<unsigned>(wxPtrToUInt(item.GetID()));
+    }
+};
+
+wxFrame* gs_frame = nullptr;
+wxDataViewCtrl* gs_dvc = nullptr;
+
+bool DataViewInit()
+{
+    gs_frame = new wxFrame(nullptr, wxID_ANY, "wxDataViewCtrl benchmark");
+    gs_dvc = new wxDataViewCtrl(gs_frame, wxID_ANY);
+
+    wxObjectDataPtr<BigBranchModel> model(new BigBranchModel);
+    gs_dvc->AssociateModel(model.get());
+
+    wxDataViewColumn* const
+        col = gs_dvc->AppendTextColumn("Text", 0,
+                                       wxDATAVIEW_CELL_INERT, -1,
+                                       wxALIGN_LEFT,
+                                       wxDATAVIEW_COL_SORTABLE);
+
+    // Use the numeric parameter to disable sorting if it is 0.
+    if ( Bench::GetNumericParameter(1) )
+        col->SetSortOrder(true);
+
+    return true;
+}
+
+#ifdef wxHAS_GENERIC_DATAVIEWCTRL
+
+// Virtual list model with the given number of rows.
+class BigListModel : public wxDataViewVirtualListModel
+{
+public:
+    explicit BigListModel(unsigned numRows)
+        : wxDataViewVirtualListModel(numRows)
+    {
+    }
+
+    virtual unsigned int GetColumnCount() const override { return 3; }
+
+    virtual wxString GetColumnType(unsigned int WXUNUSED(col)) const override
+    {
+        return "string";
+    }
+
+    virtual void GetValueByRow(wxVariant& variant,
+                               unsigned int row,
+                               unsigned int col) const override
+    {
+        variant = wxString::Format("Row %u, column %u", row, col);
+    }
+
+    virtual bool SetValueByRow(const wxVariant& WXUNUSED(variant),
+                               unsigned int WXUNUSED(row),
+                               unsigned int WXUNUSED(col)) override
+    {
+        return false;
+    }
+};
+
+bool DataViewPaintInit()
+{
+    gs_frame = Bench::CreatePaintFrame("wxDataViewCtrl paint benchmark");
+    gs_dvc = new wxDataViewCtrl(gs_frame, wxID_ANY);
+
+    wxObjectDataPtr<BigListModel>
+        model(new BigListModel(Bench::GetNumRows(NUM_CHILDREN)));
+    gs_dvc->AssociateModel(model.get());
+
+    for ( unsigned col = 0; col < 3; col++ )
+        gs_dvc->AppendTextColumn(wxString::Format("Column %u", col), col);
+
+    Bench::ShowForPainting(gs_frame);
+
+    return true;
+}
+
+#endif // wxHAS_GENERIC_DATAVIEWCTRL
+
+void DataViewDone()
+{
+    delete gs_frame;
+    gs_frame = nullptr;
+    gs_dvc = nullptr;
+}
+
+} // anonymous namespace
+
+// Expand the item with many children for the first time, which creates the
+// nodes for all of them and sorts them, unless the numeric parameter is 0.
+BENCHMARK_FUNC_WITH_INIT(DataViewExpandBigBranch, DataViewInit, DataViewDone)
+{
+    const wxDataViewItem item = BigBranchModel::MakeItem(1);
+
+    // Recreate the tree to ensure that the children nodes of the item have to
+    // be created again.
+    gs_dvc->GetModel()->Cleared();
+    gs_dvc->Expand(item);
+
+    Bench::SetItemsPerRun(NUM_CHILDREN, "Items");
+
+    return gs_dvc->IsExpanded(item);
+}
+
+#ifdef wxHAS_GENERIC_DATAVIEWCTRL
+
+// Scroll the generic control showing a big virtual list by a page and repaint
+// it (the native implementations can't be scrolled in the same way).
+BENCHMARK_FUNC_WITH_INIT(DataViewScrollPaint, DataViewPaintInit, DataViewDone)
+{
+    return Bench::ScrollPageAndPaint(gs_dvc);
+}
+
+#endif // wxHAS_GENERIC_DATAVIEWCTRL
+
+#endif // wxUSE_DATAVIEWCTRL
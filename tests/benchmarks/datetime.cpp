@@ -17,3 +17,67 @@ BENCHMARK_FUNC(ParseDate)
     return dt.ParseDate("May 23, 2011") && dt.GetMonth() == wxDateTime::May;
 }
 
+
+// ----------------------------------------------------------------------------
+// Benchmark formatting and parsing many dates using the same format
+// ----------------------------------------------------------------------------
+
+static const char* const DATETIME_FORMAT = "%Y-%m-%d %H:%M:%S.%l";
+
+static const wxDateTime& GetTestDate()
+{
+    static const wxDateTime dt(23, wxDateTime::May, 2011, 12, 34, 56, 789);
+    return dt;
+}
+
+BENCHMARK_FUNC(FormatDateTime)
+{
+    return GetTestDate().Format(DATETIME_FORMAT).length() == 23;
+}
+
+BENCHMARK_FUNC(FormatDateTimeFormatter)
+{
+    static const wxDateTimeFormatter fmt(DATETIME_FORMAT);
+
+    return fmt.Format(GetTestDate()).length() == 23;
+}
+
+BENCHMARK_FUNC(ParseDateTimeFormat)
+{
+    wxDateTime dt;
+    wxString::const_iterator end;
+    return dt.ParseFormat("2011-05-23 12:34:56.789", DATETIME_FORMAT, &end) &&
+                dt.GetMillisecond() == 789;
+}
+
+BENCHMARK_FUNC(ParseDateTimeFormatter)
+{
+    static const wxDateTimeFormatter fmt(DATETIME_FORMAT);
+
+    wxDateTime dt;
+    return fmt.Parse("2011-05-23 12:34:56.789", &dt) &&
+                dt.GetMillisecond() == 789;
+}
+
+// ----------------------------------------------------------------------------
+// Benchmark conversions between UTC and local time
+// ----------------------------------------------------------------------------
+
+BENCHMARK_FUNC(DateTimeGetTmLocal)
+{
+    static time_t t = wxDateTime(1, wxDateTime::Jan, 2020).GetTicks();
+
+    // Use different times to prevent the RTL from caching the result.
+    t += 3607;
+    return wxDateTime(t).GetTm().year >= 2020;
+}
+
+BENCHMARK_FUNC(DateTimeSetLocal)
+{
+    static int n = 0;
+    n++;
+
+    const wxDateTime dt(1 + n % 28, wxDateTime::Month(n % 12), 2020 + n % 10,
+                        n % 24, n % 60, n % 60);
+    return dt.IsValid();
+}
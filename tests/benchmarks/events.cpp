@@ -0,0 +1,220 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        tests/benchmarks/events.cpp
+// Purpose:     Event-related benchmarks
+// Author:      wxWidgets team
+// Created:     2026-10-14
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+#include "bench.h"
+
+#include "wx/app.h"
+#include "wx/event.h"
+#include "wx/thread.h"
+
+#include <memory>
+#include <vector>
+
+// Number of events queued by QueueEvent benchmarks, total if there are
+// several threads.
+static const int NUM_EVENTS = 100000;
+
+// Process all the pending events until the expected number of them is
+// received by the handler.
+static bool ProcessEventsUntil(const int& received, int expected)
+{
+    while ( received < expected )
+    {
+        if ( wxTheApp->HasPendingEvents() )
+            wxTheApp->ProcessPendingEvents();
+        else
+            wxThread::Yield();
+    }
+
+    return received == expected;
+}
+
+// Queue the events in batches of the given size, so that the deleted events
+// memory can be reused for the subsequent ones if allocation cache is used.
+static bool QueueEventsInBatches(int batchSize)
+{
+    wxEvtHandler handler;
+
+    int received = 0;
+    handler.Bind(wxEVT_THREAD, [&received](wxThreadEvent&) { received++; });
+
+    for ( int n = 0; n < NUM_EVENTS; n += batchSize )
+    {
+        for ( int m = 0; m < batchSize; m++ )
+            wxQueueEvent(&handler, new wxThreadEvent());
+
+        if ( !ProcessEventsUntil(received, n + batchSize) )
+            return false;
+    }
+
+    Bench::SetItemsPerRun(NUM_EVENTS, "Events");
+
+    return true;
+}
+
+BENCHMARK_FUNC(QueueEvent)
+{
+    wxEvtHandler handler;
+
+    int received = 0;
+    handler.Bind(wxEVT_THREAD, [&received](wxThreadEvent&) { received++; });
+
+    for ( int n = 0; n < NUM_EVENTS; n++ )
+        wxQueueEvent(&handler, new wxThreadEvent());
+
+    Bench::SetItemsPerRun(NUM_EVENTS, "Events");
+
+    return ProcessEventsUntil(received, NUM_EVENTS);
+}
+
+BENCHMARK_FUNC(QueueEventBatches)
+{
+    return QueueEventsInBatches(10);
+}
+
+BENCHMARK_FUNC(QueueEventBatchesAllocCache)
+{
+    wxEvent::UseAllocCache();
+
+    const bool ok = QueueEventsInBatches(10);
+
+    wxEvent::UseAllocCache(false);
+
+    return ok;
+}
+
+// Process the events of one type by a handler with many dynamically bound
+// handlers for other event types, use the numeric parameter to specify the
+// number of the handlers.
+BENCHMARK_FUNC(ProcessEventManyBinds)
+{
+    static wxEvtHandler s_handler;
+    static wxEventTypeTag<wxThreadEvent> s_eventType(wxNewEventType());
+    static int s_received = 0;
+
+    static bool s_initialized = false;
+    if ( !s_initialized )
+    {
+        s_initialized = true;
+
+        // Bind the handler for our event first, as the handlers bound later
+        // are checked before it.
+        s_handler.Bind(s_eventType, [](wxThreadEvent&) { s_received++; });
+
+        const int numHandlers = wxMax(Bench::GetNumericParameter(100), 1);
+        for ( int n = 0; n < numHandlers; n++ )
+        {
+            s_handler.Bind(wxEventTypeTag<wxThreadEvent>(wxNewEventType()),
+                           [](wxThreadEvent&) { });
+        }
+    }
+
+    const int received = s_received;
+    wxThreadEvent event(s_eventType);
+    for ( int n = 0; n < 1000; n++ )
+        s_handler.ProcessEvent(event);
+
+    Bench::SetItemsPerRun(1000, "Events");
+
+    return s_received == received + 1000;
+}
+
+// Bind and then unbind many handlers for different event types, use the
+// numeric parameter to specify the number of the handlers.
+BENCHMARK_FUNC(BindUnbindMany)
+{
+    const int numHandlers = wxMax(Bench::GetNumericParameter(100), 1);
+
+    static std::vector<wxEventTypeTag<wxThreadEvent>> s_eventTypes;
+    while ( s_eventTypes.size() < static_cast<size_t>(numHandlers) )
+        s_eventTypes.emplace_back(wxNewEventType());
+
+    wxEvtHandler handler;
+
+    int received = 0;
+    const auto func = [&received](wxThreadEvent&) { received++; };
+
+    for ( int n = 0; n < numHandlers; n++ )
+        handler.Bind(s_eventTypes[n], func);
+
+    wxThreadEvent event(s_eventTypes[0]);
+    handler.ProcessEvent(event);
+
+    for ( int n = 0; n < numHandlers; n++ )
+        handler.Unbind(s_eventTypes[n], func);
+
+    Bench::SetItemsPerRun(numHandlers, "Handlers");
+
+    return received == 1;
+}
+
+#if wxUSE_THREADS
+
+namespace
+{
+
+// Thread queuing the given number of events for the given handler.
+class EventSenderThread : public wxThread
+{
+public:
+    EventSenderThread(wxEvtHandler& handler, int numEvents)
+        : wxThread(wxTHREAD_JOINABLE),
+          m_handler(handler),
+          m_numEvents(numEvents)
+    {
+    }
+
+protected:
+    virtual ExitCode Entry() override
+    {
+        for ( int n = 0; n < m_numEvents; n++ )
+            wxQueueEvent(&m_handler, new wxThreadEvent());
+
+        return nullptr;
+    }
+
+private:
+    wxEvtHandler& m_handler;
+    const int m_numEvents;
+};
+
+} // anonymous namespace
+
+// Measure the throughput of the events queued from the worker threads and
+// processed in the main one at the same time, use the numeric parameter to
+// specify the number of threads.
+BENCHMARK_FUNC(QueueEventFromThreads)
+{
+    const int numThreads = wxMax(Bench::GetNumericParameter(4), 1);
+    const int numEventsPerThread = NUM_EVENTS / numThreads;
+    const int numEvents = numEventsPerThread*numThreads;
+
+    wxEvtHandler handler;
+
+    int received = 0;
+    handler.Bind(wxEVT_THREAD, [&received](wxThreadEvent&) { received++; });
+
+    std::vector<std::unique_ptr<EventSenderThread>> threads;
+    for ( int n = 0; n < numThreads; n++ )
+    {
+        threads.emplace_back(new EventSenderThread(handler, numEventsPerThread));
+        threads.back()->Run();
+    }
+
+    const bool ok = ProcessEventsUntil(received, numEvents);
+
+    for ( auto& thread : threads )
+        thread->Wait();
+
+    Bench::SetItemsPerRun(numEvents, "Events");
+
+    return ok;
+}
+
+#endif // wxUSE_THREADS
@@ -0,0 +1,227 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        tests/benchmarks/fdiodispatcher.cpp
+// Purpose:     wxFDIODispatcher benchmarks
+// Author:      wxWidgets team
+// Created:     2026-10-14
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+#include "bench.h"
+
+#ifdef __UNIX__
+
+#include "wx/private/selectdispatcher.h"
+#include "wx/unix/private/epolldispatcher.h"
+#include "wx/unix/private/iouringdispatcher.h"
+
+#include <memory>
+#include <vector>
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace
+{
+
+// Read the data available on a socket and, optionally, toggle the output
+// notifications for it, as wxSocket does when it has data to write.
+class ReadHandler : public wxFDIOHandler
+{
+public:
+    ReadHandler(wxFDIODispatcher& dispatcher, int fd, int& count)
+        : m_dispatcher(dispatcher), m_fd(fd), m_count(count)
+    {
+    }
+
+    void SetModify(bool modify) { m_modify = modify; }
+    void SetDrain(bool drain) { m_drain = drain; }
+
+    virtual void OnReadWaiting() override
+    {
+        if ( m_drain )
+        {
+            wxFDIODispatcher::DrainFD(m_fd, [this](const char*, size_t)
+                {
+                    m_count++;
+                });
+        }
+        else
+        {
+            char buf[64];
+            if ( read(m_fd, buf, sizeof(buf)) > 0 )
+                m_count++;
+        }
+
+        if ( m_modify )
+        {
+            m_dispatcher.ModifyFD(m_fd, this, wxFDIO_INPUT | wxFDIO_OUTPUT);
+            m_dispatcher.ModifyFD(m_fd, this, wxFDIO_INPUT);
+        }
+    }
+
+    virtual void OnWriteWaiting() override { }
+    virtual void OnExceptionWaiting() override { }
+
+private:
+    wxFDIODispatcher& m_dispatcher;
+    const int m_fd;
+    int& m_count;
+    bool m_modify = false;
+    bool m_drain = false;
+};
+
+// All the state used by the benchmarks: the dispatcher and the socket pairs,
+// the first socket of each of them is registered with it.
+struct DispatcherState
+{
+    ~DispatcherState()
+    {
+        for ( size_t n = 0; n < sockets.size(); n++ )
+        {
+            dispatcher->UnregisterFD(sockets[n].first);
+            close(sockets[n].first);
+            close(sockets[n].second);
+        }
+    }
+
+    std::unique_ptr<wxFDIODispatcher> dispatcher;
+    std::vector< std::pair<int, int> > sockets;
+    std::vector< std::unique_ptr<ReadHandler> > handlers;
+    int count = 0;
+};
+
+std::unique_ptr<DispatcherState> gs_state;
+
+bool InitDispatcher(wxFDIODispatcher* dispatcher, int flags = wxFDIO_INPUT)
+{
+    if ( !dispatcher )
+        return false;
+
+    gs_state.reset(new DispatcherState);
+    gs_state->dispatcher.reset(dispatcher);
+
+    // The numeric parameter is the number of registered descriptors.
+    const long numSockets = Bench::GetNumericParameter(100);
+    for ( long n = 0; n < numSockets; n++ )
+    {
+        int fds[2];
+        if ( socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, fds) != 0 )
+            return false;
+
+        gs_state->sockets.push_back(std::make_pair(fds[0], fds[1]));
+
+        ReadHandler* const
+            handler = new ReadHandler(*dispatcher, fds[0], gs_state->count);
+        gs_state->handlers.emplace_back(handler);
+
+        // edge-triggered handlers must read all the available data
+        handler->SetDrain((flags & wxFDIO_EDGE_TRIGGERED) != 0);
+
+        if ( !dispatcher->RegisterFD(fds[0], handler, flags) )
+            return false;
+    }
+
+    Bench::SetItemsPerRun(numSockets, "Events");
+
+    return true;
+}
+
+void DoneDispatcher()
+{
+    gs_state.reset();
+}
+
+// Write a byte to all sockets and dispatch the events until all of them are
+// read.
+bool DispatchAll(bool modify)
+{
+    const size_t numSockets = gs_state->sockets.size();
+    for ( size_t n = 0; n < numSockets; n++ )
+    {
+        gs_state->handlers[n]->SetModify(modify);
+        if ( write(gs_state->sockets[n].second, "x", 1) != 1 )
+            return false;
+    }
+
+    gs_state->count = 0;
+    while ( gs_state->count < static_cast<int>(numSockets) )
+    {
+        if ( gs_state->dispatcher->Dispatch(1000) <= 0 )
+            return false;
+    }
+
+    return true;
+}
+
+} // anonymous namespace
+
+#if wxUSE_SELECT_DISPATCHER
+
+static bool InitSelect()
+{
+    return InitDispatcher(new wxSelectDispatcher());
+}
+
+BENCHMARK_FUNC_WITH_INIT(FDIODispatchSelect, InitSelect, DoneDispatcher)
+{
+    return DispatchAll(false);
+}
+
+#endif // wxUSE_SELECT_DISPATCHER
+
+#if wxUSE_EPOLL_DISPATCHER
+
+static bool InitEpoll()
+{
+    return InitDispatcher(wxEpollDispatcher::Create());
+}
+
+BENCHMARK_FUNC_WITH_INIT(FDIODispatchEpoll, InitEpoll, DoneDispatcher)
+{
+    return DispatchAll(false);
+}
+
+BENCHMARK_FUNC_WITH_INIT(FDIODispatchModifyEpoll, InitEpoll, DoneDispatcher)
+{
+    return DispatchAll(true);
+}
+
+static bool InitEdgeEpoll()
+{
+    wxEpollDispatcher* const dispatcher = wxEpollDispatcher::Create();
+    if ( !dispatcher )
+        return false;
+
+    dispatcher->SetMaxEvents(256);
+
+    return InitDispatcher(dispatcher, wxFDIO_INPUT | wxFDIO_EDGE_TRIGGERED);
+}
+
+BENCHMARK_FUNC_WITH_INIT(FDIODispatchEdgeEpoll, InitEdgeEpoll, DoneDispatcher)
+{
+    return DispatchAll(false);
+}
+
+#endif // wxUSE_EPOLL_DISPATCHER
+
+#if wxUSE_IOURING_DISPATCHER
+
+static bool InitIOUring()
+{
+    return InitDispatcher(wxIOUringDispatcher::Create());
+}
+
+BENCHMARK_FUNC_WITH_INIT(FDIODispatchIOUring, InitIOUring, DoneDispatcher)
+{
+    return DispatchAll(false);
+}
+
+BENCHMARK_FUNC_WITH_INIT(FDIODispatchModifyIOUring, InitIOUring, DoneDispatcher)
+{
+    return DispatchAll(true);
+}
+
+#endif // wxUSE_IOURING_DISPATCHER
+
+#endif // __UNIX__
@@ -18,6 +18,10 @@
 #include "wx/stopwatch.h"
 #include "wx/crt.h"
 
+#ifdef __WXGTK__
+    #include "wx/gtk/private/layoutcache.h"
+#endif // __WXGTK__
+
 #if wxUSE_GLCANVAS
     #include "wx/glcanvas.h"
     #ifdef _MSC_VER
@@ -66,6 +70,7 @@ struct GraphicsBenchmarkOptions
         testRectangles =
         testCircles =
         testEllipses =
+        testMarkers =
         testTextExtent =
         testMultiLineTextExtent =
         testPartialTextExtents = false;
@@ -97,6 +102,7 @@ struct GraphicsBenchmarkOptions
          testRectangles,
          testCircles,
          testEllipses,
+         testMarkers,
          testTextExtent,
          testMultiLineTextExtent,
          testPartialTextExtents;
@@ -404,6 +410,7 @@ private:
         BenchmarkRoundedRectangles(msg, dc);
         BenchmarkCircles(msg, dc);
         BenchmarkEllipses(msg, dc);
+        BenchmarkMarkers(msg, dc);
         BenchmarkTextExtent(msg, dc);
         BenchmarkPartialTextExtents(msg, dc);
     }
@@ -635,6 +642,121 @@ private:
                  opts.numIters, t, (1000. * t)/opts.numIters);
     }
 
+    // Compare drawing many small items one by one with the batch drawing
+    // functions of wxGraphicsContext, so this only does anything for wxGCDC.
+    void BenchmarkMarkers(const wxString& msg, wxDC& dc)
+    {
+        if ( !opts.testMarkers )
+            return;
+
+        wxGCDC* const gcdc = wxDynamicCast(&dc, wxGCDC);
+        if ( !gcdc )
+            return;
+
+        wxGraphicsContext* const gc = gcdc->GetGraphicsContext();
+
+        SetupDC(dc);
+
+        gc->SetPen(dc.GetPen());
+        gc->SetBrush(*wxBLUE_BRUSH);
+
+        const size_t num = opts.numIters;
+
+        wxVector<wxRect2DDouble> rects(num);
+        wxVector<wxPoint2DDouble> centres(num);
+        wxVector<wxPoint2DDouble> points(2*num);
+        wxVector<wxColour> colours(num);
+        for ( size_t n = 0; n < num; n++ )
+        {
+            const double x = rand() % opts.width,
+                         y = rand() % opts.height;
+
+            rects[n] = wxRect2DDouble(x, y, 8, 8);
+            centres[n] = wxPoint2DDouble(x + 4, y + 4);
+            points[2*n] = wxPoint2DDouble(x, y);
+            points[2*n + 1] = wxPoint2DDouble(x + 8, y + 8);
+
+            // use a few different colours to check the effect of grouping
+            // the consecutive markers of the same colour
+            static const wxColour palette[] = { *wxRED, *wxGREEN, *wxBLUE };
+            colours[n] = palette[(n / 16) % WXSIZEOF(palette)];
+        }
+
+        wxPrintf("Benchmarking %s: ", msg);
+        fflush(stdout);
+
+        wxStopWatch sw;
+        for ( size_t n = 0; n < num; n++ )
+        {
+            const wxRect2DDouble& r = rects[n];
+            gc->DrawRectangle(r.m_x, r.m_y, r.m_width, r.m_height);
+        }
+
+        const long t = sw.Time();
+
+        wxPrintf("%ld rectangles done in %ldms = %gus/rectangle\n",
+                 opts.numIters, t, (1000. * t)/opts.numIters);
+
+        wxPrintf("Benchmarking %s: ", msg);
+        fflush(stdout);
+
+        sw.Start();
+        gc->DrawRectangles(num, &rects[0]);
+
+        const long t2 = sw.Time();
+
+        wxPrintf("%ld batched rectangles done in %ldms = %gus/rectangle\n",
+                 opts.numIters, t2, (1000. * t2)/opts.numIters);
+
+        wxPrintf("Benchmarking %s: ", msg);
+        fflush(stdout);
+
+        sw.Start();
+        for ( size_t n = 0; n < num; n++ )
+        {
+            const wxRect2DDouble& r = rects[n];
+            gc->DrawEllipse(r.m_x, r.m_y, r.m_width, r.m_height);
+        }
+
+        const long t3 = sw.Time();
+
+        wxPrintf("%ld ellipses done in %ldms = %gus/ellipse\n",
+                 opts.numIters, t3, (1000. * t3)/opts.numIters);
+
+        wxPrintf("Benchmarking %s: ", msg);
+        fflush(stdout);
+
+        sw.Start();
+        gc->DrawEllipses(num, &rects[0]);
+
+        const long t4 = sw.Time();
+
+        wxPrintf("%ld batched ellipses done in %ldms = %gus/ellipse\n",
+                 opts.numIters, t4, (1000. * t4)/opts.numIters);
+
+        wxPrintf("Benchmarking %s: ", msg);
+        fflush(stdout);
+
+        sw.Start();
+        gc->DrawMarkers(num, &centres[0], 8, wxMARKER_CIRCLE, &colours[0]);
+
+        const long t5 = sw.Time();
+
+        wxPrintf("%ld coloured markers done in %ldms = %gus/marker\n",
+                 opts.numIters, t5, (1000. * t5)/opts.numIters);
+
+        wxPrintf("Benchmarking %s: ", msg);
+        fflush(stdout);
+
+        sw.Start();
+        gc->StrokeLineSegments(num, &points[0]);
+
+        const long t6 = sw.Time();
+
+        wxPrintf("%ld batched lines done in %ldms = %gus/line\n",
+                 opts.numIters, t6, (1000. * t6)/opts.numIters);
+    }
+
     void BenchmarkTextExtent(const wxString& msg, wxDC& dc)
     {
         if ( !opts.testTextExtent )
@@ -648,6 +770,12 @@ private:
         const wxString str("The quick brown fox jumps over the lazy dog");
         wxSize size;
 
+#ifdef __WXGTK__
+        wxPangoLayoutCache* const cache = wxPangoLayoutCache::Get();
+        if ( cache )
+            cache->ResetStats();
+#endif // __WXGTK__
+
         wxStopWatch sw;
         for ( long n = 0; n < opts.numIters; n++ )
         {
@@ -661,6 +789,37 @@ private:
 
         wxPrintf("%ld text extent measures done in %ldms = %gus/call\n",
                  opts.numIters, t, (1000. * t)/opts.numIters);
+
+#ifdef __WXGTK__
+        if ( !cache )
+            return;
+
+        wxPrintf("Layout cache: %zu hits, %zu misses\n",
+                 cache->GetHits(), cache->GetMisses());
+
+        // Compare with the time taken without the cache.
+        wxPrintf("Benchmarking %s: ", msg);
+        fflush(stdout);
+
+        const size_t maxCount = cache->GetMaxCount();
+        cache->SetMaxCount(0);
+
+        sw.Start();
+        for ( long n = 0; n < opts.numIters; n++ )
+        {
+            if ( opts.testMultiLineTextExtent )
+                size += dc.GetMultiLineTextExtent(str);
+            else
+                size += dc.GetTextExtent(str);
+        }
+
+        const long t2 = sw.Time();
+
+        cache->SetMaxCount(maxCount);
+
+        wxPrintf("%ld uncached text extent measures done in %ldms = %gus/call\n",
+                 opts.numIters, t2, (1000. * t2)/opts.numIters);
+#endif // __WXGTK__
     }
 
     void BenchmarkPartialTextExtents(const wxString& msg, wxDC& dc)
@@ -866,6 +1025,7 @@ public:
             { wxCMD_LINE_SWITCH, "",  "rectangles" },
             { wxCMD_LINE_SWITCH, "",  "circles" },
             { wxCMD_LINE_SWITCH, "",  "ellipses" },
+            { wxCMD_LINE_SWITCH, "",  "markers" },
             { wxCMD_LINE_SWITCH, "",  "textextent" },
             { wxCMD_LINE_SWITCH, "",  "multilinetextextent" },
             { wxCMD_LINE_SWITCH, "",  "partialtextextents" },
@@ -956,12 +1116,14 @@ public:
         opts.testRectangles = parser.Found("rectangles");
         opts.testCircles = parser.Found("circles");
         opts.testEllipses = parser.Found("ellipses");
+        opts.testMarkers = parser.Found("markers");
         opts.testTextExtent = parser.Found("textextent");
         opts.testMultiLineTextExtent = parser.Found("multilinetextextent");
         opts.testPartialTextExtents = parser.Found("partialtextextents");
         if ( !(opts.testBitmaps || opts.testImages || opts.testLines
                     || opts.testRawBitmaps || opts.testRectangles
                     || opts.testCircles || opts.testEllipses
+                    || opts.testMarkers
                     || opts.testTextExtent || opts.testPartialTextExtents) )
         {
             // Do everything by default.
@@ -972,6 +1134,7 @@ public:
             opts.testRectangles =
             opts.testCircles =
             opts.testEllipses =
+            opts.testMarkers =
             opts.testTextExtent =
             opts.testPartialTextExtents = true;
         }
@@ -0,0 +1,177 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        tests/benchmarks/grid.cpp
+// Purpose:     wxGrid benchmarks
+// Author:      wxWidgets team
+// Created:     2026-10-14
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+#include "wx/frame.h"
+#include "wx/grid.h"
+#include "wx/dcmemory.h"
+
+#include "bench.h"
+#include "scrollpaint.h"
+
+#if wxUSE_GRID
+
+namespace
+{
+
+// Number of rows and columns in the test grid, all rows have attributes.
+const int NUM_ROWS = 100000;
+const int NUM_COLS = 10;
+
+wxFrame* gs_frame = nullptr;
+wxGrid* gs_grid = nullptr;
+
+bool GridInit()
+{
+    gs_frame = new wxFrame(nullptr, wxID_ANY, "wxGrid benchmark");
+    gs_grid = new wxGrid(gs_frame, wxID_ANY);
+    gs_grid->CreateGrid(NUM_ROWS, NUM_COLS);
+
+    // Give every row its own attribute, as is often done to alternate the
+    // row colours, to check that the lookup of row attributes doesn't become
+    // a bottleneck when there are many of them.
+    for ( int row = 0; row < NUM_ROWS; row++ )
+    {
+        wxGridCellAttr* const attr = new wxGridCellAttr;
+        attr->SetBackgroundColour(row % 2 ? *wxWHITE : *wxLIGHT_GREY);
+        gs_grid->SetRowAttr(row, attr);
+    }
+
+    return true;
+}
+
+// Table computing its values on the fly, allowing to create huge grids.
+class VirtualTable : public wxGridTableBase
+{
+public:
+    explicit VirtualTable(int numRows) : m_numRows(numRows) { }
+
+    virtual int GetNumberRows() override { return m_numRows; }
+    virtual int GetNumberCols() override { return NUM_COLS; }
+
+    virtual wxString GetValue(int row, int col) override
+    {
+        return wxString::Format("Cell %d, %d", row, col);
+    }
+
+    virtual void SetValue(int WXUNUSED(row),
+                          int WXUNUSED(col),
+                          const wxString& WXUNUSED(value)) override
+    {
+    }
+
+private:
+    const int m_numRows;
+};
+
+bool GridPaintInit()
+{
+    gs_frame = Bench::CreatePaintFrame("wxGrid paint benchmark");
+    gs_grid = new wxGrid(gs_frame, wxID_ANY);
+    gs_grid->AssignTable(new VirtualTable(Bench::GetNumRows(100000)));
+
+    Bench::ShowForPainting(gs_frame);
+
+    return true;
+}
+
+void GridDone()
+{
+    delete gs_frame;
+    gs_frame = nullptr;
+    gs_grid = nullptr;
+}
+
+} // anonymous namespace
+
+// Retrieve the attributes of all the cells of the grid.
+BENCHMARK_FUNC_WITH_INIT(GridGetCellAttr, GridInit, GridDone)
+{
+    bool ok = true;
+    for ( int row = 0; row < NUM_ROWS; row++ )
+    {
+        for ( int col = 0; col < NUM_COLS; col++ )
+        {
+            wxGridCellAttrPtr attr = gs_grid->GetOrCreateCellAttrPtr(row, col);
+            if ( !attr )
+                ok = false;
+        }
+    }
+
+    Bench::SetItemsPerRun(NUM_ROWS*NUM_COLS, "Cells");
+
+    return ok;
+}
+
+// Change the heights of some rows and find the rows at their positions, as
+// happens when the rows are resized to fit their wrapped contents.
+BENCHMARK_FUNC_WITH_INIT(GridSetRowSize, GridInit, GridDone)
+{
+    const int numRowsChanged = 1000;
+    const int step = NUM_ROWS / numRowsChanged;
+    const int height = gs_grid->GetDefaultRowSize();
+
+    static bool s_tall = false;
+    s_tall = !s_tall;
+
+    bool ok = true;
+    for ( int row = 0; row < NUM_ROWS; row += step )
+    {
+        gs_grid->SetRowSize(row, s_tall ? 2*height : height);
+
+        if ( gs_grid->YToRow(gs_grid->CellToRect(row, 0).y) != row )
+            ok = false;
+    }
+
+    Bench::SetItemsPerRun(numRowsChanged, "Rows");
+
+    return ok;
+}
+
+// Auto size all the columns measuring the given number of rows, specified by
+// the numeric parameter, or all of them if it is 0 (default).
+BENCHMARK_FUNC_WITH_INIT(GridAutoSizeColumns, GridInit, GridDone)
+{
+    const int numRows = Bench::GetNumericParameter(0);
+
+    gs_grid->SetAutoSizeSampleRows(numRows);
+    gs_grid->AutoSizeColumns(false);
+
+    Bench::SetItemsPerRun(NUM_COLS, "Columns");
+
+    return gs_grid->GetColSize(0) > 0;
+}
+
+// Render the part of the grid at the given row, specified by the numeric
+// parameter (the middle of the grid by default), into a bitmap.
+BENCHMARK_FUNC_WITH_INIT(GridRender, GridInit, GridDone)
+{
+    const int numRowsShown = 50;
+
+    const int top = wxMin(Bench::GetNumericParameter(NUM_ROWS / 2),
+                          NUM_ROWS - numRowsShown);
+
+    wxBitmap bmp(800, 600);
+    wxMemoryDC dc(bmp);
+    gs_grid->Render(dc, wxPoint(0, 0), bmp.GetSize(),
+                    wxGridCellCoords(top, 0),
+                    wxGridCellCoords(top + numRowsShown - 1, NUM_COLS - 1));
+
+    Bench::SetItemsPerRun(numRowsShown*NUM_COLS, "Cells");
+
+    return bmp.IsOk();
+}
+
+// Scroll a grid with the number of rows given by the numeric parameter by a
+// page and repaint it.
+BENCHMARK_FUNC_WITH_INIT(GridScrollPaint, GridPaintInit, GridDone)
+{
+    return Bench::ScrollPageAndPaint(gs_grid);
+}
+
+#endif // wxUSE_GRID
@@ -0,0 +1,135 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        tests/benchmarks/hashmap.cpp
+// Purpose:     wxHashMap benchmarks
+// Author:      wxWidgets team
+// Created:     2026-10-14
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+#include "wx/hashmap.h"
+
+#include "bench.h"
+
+#include <unordered_map>
+#include <vector>
+
+// The maps declared using wx macros are the same as std::unordered_map ones
+// when wxUSE_STD_CONTAINERS==1, so these benchmarks are only interesting for
+// comparing wx own implementation, used otherwise, with the standard one.
+
+namespace
+{
+
+WX_DECLARE_STRING_HASH_MAP(int, wxStringToIntMap);
+typedef std::unordered_map<wxString, int> StdStringToIntMap;
+
+// Number of elements in the maps used by the benchmarks.
+const int NUM_ELEMENTS = 100000;
+
+const std::vector<wxString>& GetKeys()
+{
+    static std::vector<wxString> s_keys;
+    if ( s_keys.empty() )
+    {
+        s_keys.reserve(NUM_ELEMENTS);
+        for ( int n = 0; n < NUM_ELEMENTS; n++ )
+            s_keys.push_back(wxString::Format("Key number %d", n));
+    }
+
+    return s_keys;
+}
+
+template <typename Map>
+bool DoInsert()
+{
+    const std::vector<wxString>& keys = GetKeys();
+
+    Map map;
+    for ( int n = 0; n < NUM_ELEMENTS; n++ )
+        map[keys[n]] = n;
+
+    Bench::SetItemsPerRun(NUM_ELEMENTS, "Elements");
+
+    return map.size() == static_cast<size_t>(NUM_ELEMENTS);
+}
+
+template <typename Map>
+bool DoLookup()
+{
+    const std::vector<wxString>& keys = GetKeys();
+
+    static Map s_map;
+    if ( s_map.empty() )
+    {
+        for ( int n = 0; n < NUM_ELEMENTS; n++ )
+            s_map[keys[n]] = n;
+    }
+
+    long sum = 0;
+    for ( int n = 0; n < NUM_ELEMENTS; n++ )
+        sum += s_map.find(keys[n])->second;
+
+    // also iterate over all elements
+    for ( typename Map::const_iterator it = s_map.begin();
+          it != s_map.end();
+          ++it )
+    {
+        sum -= it->second;
+    }
+
+    Bench::SetItemsPerRun(NUM_ELEMENTS, "Elements");
+
+    return sum == 0;
+}
+
+template <typename Map>
+bool DoErase()
+{
+    const std::vector<wxString>& keys = GetKeys();
+
+    Map map;
+    for ( int n = 0; n < NUM_ELEMENTS; n++ )
+        map[keys[n]] = n;
+
+    for ( int n = 0; n < NUM_ELEMENTS; n++ )
+        map.erase(keys[n]);
+
+    Bench::SetItemsPerRun(NUM_ELEMENTS, "Elements");
+
+    return map.empty();
+}
+
+} // anonymous namespace
+
+BENCHMARK_FUNC(HashMapInsert)
+{
+    return DoInsert<wxStringToIntMap>();
+}
+
+BENCHMARK_FUNC(HashMapInsertStd)
+{
+    return DoInsert<StdStringToIntMap>();
+}
+
+BENCHMARK_FUNC(HashMapLookup)
+{
+    return DoLookup<wxStringToIntMap>();
+}
+
+BENCHMARK_FUNC(HashMapLookupStd)
+{
+    return DoLookup<StdStringToIntMap>();
+}
+
+// Notice that these benchmarks include the time needed for inserting the
+// elements before erasing them.
+BENCHMARK_FUNC(HashMapErase)
+{
+    return DoErase<wxStringToIntMap>();
+}
+
+BENCHMARK_FUNC(HashMapEraseStd)
+{
+    return DoErase<StdStringToIntMap>();
+}
@@ -0,0 +1,134 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        tests/benchmarks/html.cpp
+// Purpose:     wxHTML parsing and layout benchmarks
+// Author:      wxWidgets team
+// Created:     2026-10-14
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+#include "wx/bitmap.h"
+#include "wx/dcmemory.h"
+#include "wx/ffile.h"
+#include "wx/html/htmlwin.h"
+#include "wx/html/winpars.h"
+
+#include "bench.h"
+#include "scrollpaint.h"
+
+#include <memory>
+
+#if wxUSE_HTML
+
+namespace
+{
+
+wxBitmap* gs_bitmap = nullptr;
+wxMemoryDC* gs_dc = nullptr;
+wxHtmlWinParser* gs_parser = nullptr;
+wxHtmlContainerCell* gs_cell = nullptr;
+wxString gs_html;
+
+// Use the test document repeated the number of times given by the numeric
+// parameter (once by default).
+bool HtmlInit()
+{
+    wxString html;
+    if ( !wxFFile("htmltest.html").ReadAll(&html, wxConvUTF8) )
+        return false;
+
+    long num = Bench::GetNumericParameter(1);
+    if ( num < 1 )
+        num = 1;
+
+    for ( long n = 0; n < num; n++ )
+        gs_html += html;
+
+    gs_bitmap = new wxBitmap(800, 600);
+    gs_dc = new wxMemoryDC(*gs_bitmap);
+
+    gs_parser = new wxHtmlWinParser;
+    gs_parser->SetDC(gs_dc);
+
+    return true;
+}
+
+void HtmlDone()
+{
+    wxDELETE(gs_cell);
+    wxDELETE(gs_parser);
+    wxDELETE(gs_dc);
+    wxDELETE(gs_bitmap);
+    gs_html.clear();
+}
+
+wxFrame* gs_frame = nullptr;
+wxHtmlWindow* gs_htmlWin = nullptr;
+
+// Show a table with the number of rows given by the numeric parameter.
+bool HtmlPaintInit()
+{
+    const int numRows = Bench::GetNumRows(10000);
+
+    wxString html("<html><body><table border=\"1\">");
+    for ( int n = 0; n < numRows; n++ )
+    {
+        html += wxString::Format("<tr><td>%d</td><td>Some <b>bold</b> "
+                                 "and <i>italic</i> text</td></tr>", n);
+    }
+    html += "</table></body></html>";
+
+    gs_frame = Bench::CreatePaintFrame("wxHtmlWindow paint benchmark");
+    gs_htmlWin = new wxHtmlWindow(gs_frame);
+    gs_htmlWin->SetPage(html);
+
+    Bench::ShowForPainting(gs_frame);
+
+    return true;
+}
+
+void HtmlPaintDone()
+{
+    delete gs_frame;
+    gs_frame = nullptr;
+    gs_htmlWin = nullptr;
+}
+
+std::unique_ptr<wxHtmlContainerCell> ParseDocument()
+{
+    return std::unique_ptr<wxHtmlContainerCell>(
+        static_cast<wxHtmlContainerCell*>(gs_parser->Parse(gs_html)));
+}
+
+} // anonymous namespace
+
+// Parse the test document, which includes measuring all of its words.
+BENCHMARK_FUNC_WITH_INIT(HtmlParse, HtmlInit, HtmlDone)
+{
+    const std::unique_ptr<wxHtmlContainerCell> cell = ParseDocument();
+
+    return cell.get() != nullptr;
+}
+
+// Lay out the already parsed document at a different width every time, as
+// happens when the window showing it is resized.
+BENCHMARK_FUNC_WITH_INIT(HtmlLayout, HtmlInit, HtmlDone)
+{
+    if ( !gs_cell )
+        gs_cell = ParseDocument().release();
+
+    static int s_width = 600;
+    s_width = s_width == 600 ? 800 : 600;
+
+    gs_cell->Layout(s_width);
+
+    return gs_cell->GetWidth() >= s_width;
+}
+
+// Scroll a window showing a big table by a page and repaint it.
+BENCHMARK_FUNC_WITH_INIT(HtmlScrollPaint, HtmlPaintInit, HtmlPaintDone)
+{
+    return Bench::ScrollPageAndPaint(gs_htmlWin);
+}
+
+#endif // wxUSE_HTML
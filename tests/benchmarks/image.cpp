@@ -118,3 +118,85 @@ BENCHMARK_FUNC(ShrinkHighQuality)
     return image.Scale(factor*image.GetWidth(), factor*image.GetHeight(),
                        wxIMAGE_QUALITY_HIGH).IsOk();
 }
+
+// ----------------------------------------------------------------------------
+// Individual resampling kernels
+// ----------------------------------------------------------------------------
+
+// Return the test image with an alpha channel.
+static const wxImage& GetTestImageWithAlpha()
+{
+    static wxImage s_image;
+    if ( !s_image.IsOk() )
+    {
+        s_image = GetTestImage().Copy();
+        if ( s_image.IsOk() && !s_image.HasAlpha() )
+        {
+            s_image.InitAlpha();
+
+            // Use non-trivial alpha values to avoid any shortcuts.
+            unsigned char* alpha = s_image.GetAlpha();
+            const int numPixels = s_image.GetWidth()*s_image.GetHeight();
+            for ( int n = 0; n < numPixels; n++ )
+                alpha[n] = static_cast<unsigned char>(n);
+        }
+    }
+
+    return s_image;
+}
+
+// Scale the image by the factor given by the numeric parameter (in percents)
+// and report the throughput in destination pixels per second.
+static bool
+ScaleWithQuality(const wxImage& image,
+                 wxImageResizeQuality quality,
+                 long defFactor)
+{
+    const double factor = Bench::GetNumericParameter(defFactor) / 100.;
+    const int width = factor*image.GetWidth(),
+              height = factor*image.GetHeight();
+
+    Bench::SetItemsPerRun(double(width)*height, "Pix");
+
+    return image.Scale(width, height, quality).IsOk();
+}
+
+BENCHMARK_FUNC(ResampleBoxShrink)
+{
+    return ScaleWithQuality(GetTestImage(), wxIMAGE_QUALITY_BOX_AVERAGE, 50);
+}
+
+BENCHMARK_FUNC(ResampleBoxShrinkAlpha)
+{
+    return ScaleWithQuality(GetTestImageWithAlpha(), wxIMAGE_QUALITY_BOX_AVERAGE, 50);
+}
+
+BENCHMARK_FUNC(ResampleBilinearEnlarge)
+{
+    return ScaleWithQuality(GetTestImage(), wxIMAGE_QUALITY_BILINEAR, 150);
+}
+
+BENCHMARK_FUNC(ResampleBilinearEnlargeAlpha)
+{
+    return ScaleWithQuality(GetTestImageWithAlpha(), wxIMAGE_QUALITY_BILINEAR, 150);
+}
+
+BENCHMARK_FUNC(ResampleBilinearShrink)
+{
+    return ScaleWithQuality(GetTestImage(), wxIMAGE_QUALITY_BILINEAR, 50);
+}
+
+BENCHMARK_FUNC(ResampleBicubicEnlarge)
+{
+    return ScaleWithQuality(GetTestImage(), wxIMAGE_QUALITY_BICUBIC, 150);
+}
+
+BENCHMARK_FUNC(ResampleBicubicEnlargeAlpha)
+{
+    return ScaleWithQuality(GetTestImageWithAlpha(), wxIMAGE_QUALITY_BICUBIC, 150);
+}
+
+BENCHMARK_FUNC(ResampleBicubicShrink)
+{
+    return ScaleWithQuality(GetTestImage(), wxIMAGE_QUALITY_BICUBIC, 50);
+}
@@ -0,0 +1,75 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        tests/benchmarks/listctrl.cpp
+// Purpose:     wxGenericListCtrl benchmarks
+// Author:      wxWidgets team
+// Created:     2026-10-15
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+#include "wx/frame.h"
+#include "wx/listctrl.h"
+#include "wx/generic/listctrl.h"
+
+#include "bench.h"
+#include "scrollpaint.h"
+
+#if wxUSE_LISTCTRL
+
+namespace
+{
+
+const int NUM_COLS = 5;
+
+// Virtual list control computing its items text on the fly.
+class VirtualListCtrl : public wxGenericListCtrl
+{
+public:
+    VirtualListCtrl(wxWindow* parent, int numRows)
+        : wxGenericListCtrl(parent, wxID_ANY,
+                            wxDefaultPosition, wxDefaultSize,
+                            wxLC_REPORT | wxLC_VIRTUAL)
+    {
+        for ( int col = 0; col < NUM_COLS; col++ )
+            AppendColumn(wxString::Format("Column %d", col));
+
+        SetItemCount(numRows);
+    }
+
+protected:
+    virtual wxString OnGetItemText(long item, long column) const override
+    {
+        return wxString::Format("Item %ld, %ld", item, column);
+    }
+};
+
+wxFrame* gs_frame = nullptr;
+VirtualListCtrl* gs_list = nullptr;
+
+// Create the control with the number of items given by the numeric parameter.
+bool ListCtrlPaintInit()
+{
+    gs_frame = Bench::CreatePaintFrame("wxGenericListCtrl paint benchmark");
+    gs_list = new VirtualListCtrl(gs_frame, Bench::GetNumRows(100000));
+
+    Bench::ShowForPainting(gs_frame);
+
+    return true;
+}
+
+void ListCtrlPaintDone()
+{
+    delete gs_frame;
+    gs_frame = nullptr;
+    gs_list = nullptr;
+}
+
+} // anonymous namespace
+
+// Scroll a big virtual list control by a page and repaint it.
+BENCHMARK_FUNC_WITH_INIT(ListCtrlScrollPaint, ListCtrlPaintInit, ListCtrlPaintDone)
+{
+    return Bench::ScrollPageAndPaint(gs_list);
+}
+
+#endif // wxUSE_LISTCTRL
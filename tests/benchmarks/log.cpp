@@ -106,3 +106,57 @@ BENCHMARK_FUNC(LogTraceInactive)
 
     return true;
 }
+
+#if wxUSE_THREADS
+
+namespace
+{
+
+// Log target simply throwing away all messages.
+class DiscardLog : public wxLog
+{
+protected:
+    virtual void DoLogRecord(wxLogLevel,
+                             const wxString&,
+                             const wxLogRecordInfo&) override
+    {
+    }
+};
+
+wxLogAsync* gs_logAsync = nullptr;
+wxLog* gs_logOld = nullptr;
+
+bool LogAsyncInit()
+{
+    gs_logAsync = new wxLogAsync(new DiscardLog, 65536);
+    gs_logOld = wxLog::SetActiveTarget(gs_logAsync);
+
+    return true;
+}
+
+void LogAsyncDone()
+{
+    wxLog::SetActiveTarget(gs_logOld);
+
+    delete gs_logAsync;
+    gs_logAsync = nullptr;
+}
+
+} // anonymous namespace
+
+// Measure the cost of logging a message when formatting and outputting it is
+// done by the background thread of wxLogAsync.
+BENCHMARK_FUNC_WITH_INIT(LogAsyncActive, LogAsyncInit, LogAsyncDone)
+{
+    wxLogMessage("Async message %d", 17);
+
+    // Don't let the queue fill up, so that we measure the cost of queuing the
+    // messages and not of discarding them.
+    static int s_count = 0;
+    if ( ++s_count % 1024 == 0 )
+        gs_logAsync->Flush();
+
+    return true;
+}
+
+#endif // wxUSE_THREADS
@@ -7,8 +7,10 @@
 // Licence:     wxWindows licence
 /////////////////////////////////////////////////////////////////////////////
 
+#include "wx/mstream.h"
 #include "wx/strconv.h"
 #include "wx/string.h"
+#include "wx/txtstrm.h"
 
 #include "bench.h"
 
@@ -76,3 +78,184 @@ BENCHMARK_FUNC(UTF16Sys)
     return ConvertToMB(wxCSConv("UTF-16LE"));
 }
 
+
+// ----------------------------------------------------------------------------
+// UTF-8 conversions of long texts
+// ----------------------------------------------------------------------------
+
+namespace
+{
+
+// Kinds of the text used by the UTF-8 benchmarks below.
+enum TextKind
+{
+    Text_Ascii,     // only ASCII characters
+    Text_Mixed,     // mostly ASCII with some accented characters
+    Text_CJK        // only non-ASCII (3 bytes in UTF-8) characters
+};
+
+// Return a text of about 1MB of the given kind.
+const std::wstring& GetLongText(TextKind kind)
+{
+    static std::wstring s_texts[3];
+
+    std::wstring& text = s_texts[kind];
+    if ( text.empty() )
+    {
+        std::wstring chunk;
+        switch ( kind )
+        {
+            case Text_Ascii:
+                chunk = TEST_STRING;
+                break;
+
+            case Text_Mixed:
+                chunk = L"Voix ambigu\xeb d'un c\x153ur qui, au z\xe9phyr, "
+                        L"pr\xe9\x66\xe8re les jattes de kiwis. ";
+                break;
+
+            case Text_CJK:
+                chunk = L"\x65e5\x672c\x8a9e\x306e\x6587\x7ae0\x3002"
+                        L"\x4e2d\x6587\x5b57\x7b26\x3002";
+                break;
+        }
+
+        while ( text.length() < 1000000 )
+            text += chunk;
+    }
+
+    return text;
+}
+
+const std::string& GetLongUTF8Text(TextKind kind)
+{
+    static std::string s_texts[3];
+
+    std::string& text = s_texts[kind];
+    if ( text.empty() )
+        text = wxConvUTF8.cWC2MB(GetLongText(kind).c_str()).data();
+
+    return text;
+}
+
+bool ConvertFromUTF8(TextKind kind)
+{
+    const std::string& text = GetLongUTF8Text(kind);
+
+    static wxWCharBuffer s_buf;
+    const size_t len = GetLongText(kind).length();
+    if ( s_buf.length() < len )
+        s_buf.extend(len);
+
+    Bench::SetItemsPerRun(text.length(), "B");
+
+    return wxConvUTF8.ToWChar(s_buf.data(), len,
+                              text.c_str(), text.length()) == len;
+}
+
+bool ConvertToUTF8(TextKind kind)
+{
+    const std::wstring& text = GetLongText(kind);
+
+    static wxCharBuffer s_buf;
+    const size_t len = GetLongUTF8Text(kind).length();
+    if ( s_buf.length() < len )
+        s_buf.extend(len);
+
+    Bench::SetItemsPerRun(len, "B");
+
+    return wxConvUTF8.FromWChar(s_buf.data(), len,
+                                text.c_str(), text.length()) == len;
+}
+
+} // anonymous namespace
+
+BENCHMARK_FUNC(UTF8ToWCAscii)
+{
+    return ConvertFromUTF8(Text_Ascii);
+}
+
+BENCHMARK_FUNC(UTF8ToWCMixed)
+{
+    return ConvertFromUTF8(Text_Mixed);
+}
+
+BENCHMARK_FUNC(UTF8ToWCCJK)
+{
+    return ConvertFromUTF8(Text_CJK);
+}
+
+BENCHMARK_FUNC(UTF8FromWCAscii)
+{
+    return ConvertToUTF8(Text_Ascii);
+}
+
+BENCHMARK_FUNC(UTF8FromWCMixed)
+{
+    return ConvertToUTF8(Text_Mixed);
+}
+
+BENCHMARK_FUNC(UTF8FromWCCJK)
+{
+    return ConvertToUTF8(Text_CJK);
+}
+
+// ----------------------------------------------------------------------------
+// Reading text line by line
+// ----------------------------------------------------------------------------
+
+namespace
+{
+
+// Return about 1MB of mostly ASCII UTF-8 text split into ~80 char lines.
+const std::string& GetUTF8Lines()
+{
+    static std::string s_text;
+    if ( s_text.empty() )
+    {
+        const std::wstring& text = GetLongText(Text_Mixed);
+
+        std::wstring lines;
+        for ( size_t n = 0; n < text.length(); n += 80 )
+        {
+            lines.append(text, n, 80);
+            lines += L'\n';
+        }
+
+        s_text = wxConvUTF8.cWC2MB(lines.c_str()).data();
+    }
+
+    return s_text;
+}
+
+} // anonymous namespace
+
+BENCHMARK_FUNC(TextInputStreamReadLine)
+{
+    const std::string& text = GetUTF8Lines();
+    Bench::SetItemsPerRun(text.length(), "B");
+
+    wxMemoryInputStream mis(text.data(), text.length());
+    wxTextInputStream tis(mis, wxString(), wxConvUTF8);
+
+    size_t total = 0;
+    while ( mis.IsOk() )
+        total += tis.ReadLine().length();
+
+    return total != 0;
+}
+
+BENCHMARK_FUNC(TextLineReader)
+{
+    const std::string& text = GetUTF8Lines();
+    Bench::SetItemsPerRun(text.length(), "B");
+
+    wxMemoryInputStream mis(text.data(), text.length());
+    wxTextLineReader reader(mis, wxConvUTF8);
+
+    size_t total = 0;
+    while ( reader.NextLine() )
+        total += reader.GetLineLength();
+
+    return total != 0;
+}
@@ -132,3 +132,44 @@ BENCHMARK_FUNC(SystemSnprintf)
     return true;
 }
 
+
+// Number of lines formatted by the log-like benchmarks below.
+static const int NUM_LINES = 1000;
+
+BENCHMARK_FUNC(StringFormatLines)
+{
+    wxString log;
+    for ( int n = 0; n < NUM_LINES; n++ )
+        log += wxString::Format("%d: %s %s\n", n, "Line", "processed");
+
+    Bench::SetItemsPerRun(NUM_LINES, "Lines");
+
+    return !log.empty();
+}
+
+BENCHMARK_FUNC(StringAppendFormatLines)
+{
+    wxString log;
+    for ( int n = 0; n < NUM_LINES; n++ )
+        log.AppendFormat("%d: %s %s\n", n, "Line", "processed");
+
+    Bench::SetItemsPerRun(NUM_LINES, "Lines");
+
+    return !log.empty();
+}
+
+BENCHMARK_FUNC(StringPrintfReuse)
+{
+    static wxString s_line;
+
+    bool ok = true;
+    for ( int n = 0; n < NUM_LINES; n++ )
+    {
+        if ( s_line.Printf("%d: %s %s", n, "Line", "processed") <= 0 )
+            ok = false;
+    }
+
+    Bench::SetItemsPerRun(NUM_LINES, "Lines");
+
+    return ok;
+}
@@ -0,0 +1,86 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        tests/benchmarks/propgrid.cpp
+// Purpose:     wxPropertyGrid benchmarks
+// Author:      wxWidgets team
+// Created:     2026-10-15
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+#include "wx/frame.h"
+#include "wx/propgrid/propgrid.h"
+#include "wx/propgrid/props.h"
+
+#include "bench.h"
+
+#if wxUSE_PROPGRID
+
+namespace
+{
+
+// Number of properties whose values are updated.
+const int NUM_PROPERTIES = 10000;
+
+wxFrame* gs_frame = nullptr;
+wxPropertyGrid* gs_pg = nullptr;
+std::vector<wxPGProperty*> gs_props;
+long gs_value = 0;
+
+bool PropGridInit()
+{
+    gs_frame = new wxFrame(nullptr, wxID_ANY, "wxPropertyGrid benchmark");
+    gs_pg = new wxPropertyGrid(gs_frame, wxID_ANY);
+
+    gs_props.reserve(NUM_PROPERTIES);
+    for ( int n = 0; n < NUM_PROPERTIES; n++ )
+    {
+        gs_props.push_back(
+            gs_pg->Append(new wxIntProperty(wxString::Format("Value %d", n))));
+    }
+
+    gs_frame->Show();
+    gs_pg->Update();
+
+    return true;
+}
+
+void PropGridDone()
+{
+    delete gs_frame;
+    gs_frame = nullptr;
+    gs_pg = nullptr;
+    gs_props.clear();
+}
+
+void UpdateAllValues()
+{
+    gs_value++;
+    for ( wxPGProperty* p : gs_props )
+        gs_pg->SetPropertyValue(p, gs_value);
+}
+
+} // anonymous namespace
+
+// Update the values of many properties one by one.
+BENCHMARK_FUNC_WITH_INIT(PropGridSetValues, PropGridInit, PropGridDone)
+{
+    UpdateAllValues();
+
+    Bench::SetItemsPerRun(NUM_PROPERTIES, "Values");
+
+    return gs_props.back()->GetValue().GetLong() == gs_value;
+}
+
+// Update the values of many properties in a single batch.
+BENCHMARK_FUNC_WITH_INIT(PropGridSetValuesBatched, PropGridInit, PropGridDone)
+{
+    gs_pg->BeginUpdate();
+    UpdateAllValues();
+    gs_pg->EndUpdate();
+
+    Bench::SetItemsPerRun(NUM_PROPERTIES, "Values");
+
+    return gs_props.back()->GetValue().GetLong() == gs_value;
+}
+
+#endif // wxUSE_PROPGRID
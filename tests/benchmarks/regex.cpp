@@ -9,6 +9,7 @@
 
 #include "wx/ffile.h"
 #include "wx/regex.h"
+#include "wx/stream.h"
 
 #include "bench.h"
 
@@ -72,3 +73,72 @@ BENCHMARK_FUNC(REFindTD)
 
     return matches == 21; // result of "grep -c"
 }
+
+// Same as above, but using JIT and passing the length of the remaining text
+// explicitly, which avoids copying it into a temporary string on every call.
+BENCHMARK_FUNC(REFindTDJIT)
+{
+    static wxRegEx re("<td>[^<]*</td>", wxRE_ICASE | wxRE_NEWLINE | wxRE_JIT);
+
+    const wxString& text = GetTestText();
+    const wxChar* p = text.c_str();
+    const wxChar* const end = p + text.length();
+
+    int matches = 0;
+    for ( ; re.Matches(p, 0, end - p); ++matches )
+    {
+        size_t start, len;
+        if ( !re.GetMatch(&start, &len) )
+            return false;
+
+        p += start + len;
+    }
+
+    return matches == 21;
+}
+
+// Same as above, but without restarting the search for every match.
+BENCHMARK_FUNC(REFindTDForEach)
+{
+    static wxRegEx re("<td>[^<]*</td>", wxRE_ICASE | wxRE_NEWLINE | wxRE_JIT);
+
+    const size_t matches =
+        re.ForEachMatch(GetTestText(), [](size_t, size_t) { return true; });
+
+    return matches == 21;
+}
+
+// ----------------------------------------------------------------------------
+// Benchmark replacing all matches in a long text
+// ----------------------------------------------------------------------------
+
+static bool DoReplaceAllTags(const wxRegEx& re)
+{
+    wxString text = GetTestText();
+
+    return re.ReplaceAll(&text, wxString()) > 0;
+}
+
+BENCHMARK_FUNC(REReplaceAll)
+{
+    static wxRegEx re("</?[a-z]+>", wxRE_ICASE);
+    return DoReplaceAllTags(re);
+}
+
+BENCHMARK_FUNC(REReplaceAllJIT)
+{
+    static wxRegEx re("</?[a-z]+>", wxRE_ICASE | wxRE_JIT);
+    return DoReplaceAllTags(re);
+}
+
+#if wxUSE_STREAMS
+
+BENCHMARK_FUNC(REReplaceToStream)
+{
+    static wxRegEx re("</?[a-z]+>", wxRE_ICASE | wxRE_JIT);
+
+    wxCountingOutputStream out;
+    return re.ReplaceToStream(GetTestText(), wxString(), out) > 0;
+}
+
+#endif // wxUSE_STREAMS
@@ -0,0 +1,72 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        tests/benchmarks/region.cpp
+// Purpose:     wxRegion benchmarks
+// Author:      wxWidgets team
+// Created:     2026-10-14
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+#include "wx/region.h"
+
+#include "bench.h"
+
+namespace
+{
+
+// Return the region consisting of a grid of NxN cells separated by gaps, with
+// N given by the benchmark parameter, built by adding all cells one by one,
+// as it happens when many invalidated rectangles are accumulated.
+wxRegion CreateGridRegion()
+{
+    const int n = Bench::GetNumericParameter(100);
+
+    wxRegion region;
+    for ( int row = 0; row < n; row++ )
+    {
+        for ( int col = 0; col < n; col++ )
+            region.Union(col*11, row*11, 10, 10);
+    }
+
+    return region;
+}
+
+} // anonymous namespace
+
+BENCHMARK_FUNC(RegionUnionGrid)
+{
+    return !CreateGridRegion().IsEmpty();
+}
+
+BENCHMARK_FUNC(RegionUnionRandom)
+{
+    const int n = Bench::GetNumericParameter(100);
+
+    // Use a simple LCG to get the same rectangles every time.
+    unsigned seed = 1;
+    const auto next = [&seed](int max)
+    {
+        seed = seed*1103515245 + 12345;
+        return static_cast<int>((seed >> 16) % max);
+    };
+
+    wxRegion region;
+    for ( int i = 0; i < n*n; i++ )
+        region.Union(next(1000), next(1000), 1 + next(50), 1 + next(50));
+
+    return !region.IsEmpty();
+}
+
+BENCHMARK_FUNC(RegionContains)
+{
+    static const wxRegion s_region = CreateGridRegion();
+
+    int hits = 0;
+    for ( int i = 0; i < 1000; i++ )
+    {
+        if ( s_region.Contains((i*7) % 1100, (i*13) % 1100) == wxInRegion )
+            hits++;
+    }
+
+    return hits > 0;
+}
@@ -0,0 +1,58 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        tests/benchmarks/richtext.cpp
+// Purpose:     wxRichTextCtrl benchmarks
+// Author:      wxWidgets team
+// Created:     2026-10-15
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+#include "wx/frame.h"
+#include "wx/richtext/richtextctrl.h"
+
+#include "bench.h"
+#include "scrollpaint.h"
+
+#if wxUSE_RICHTEXT
+
+namespace
+{
+
+wxFrame* gs_frame = nullptr;
+wxRichTextCtrl* gs_text = nullptr;
+
+// Create the control with the number of paragraphs given by the numeric
+// parameter.
+bool RichTextPaintInit()
+{
+    const int numRows = Bench::GetNumRows(10000);
+
+    wxString text;
+    for ( int n = 0; n < numRows; n++ )
+        text += wxString::Format("Paragraph %d of the rich text control\n", n);
+
+    gs_frame = Bench::CreatePaintFrame("wxRichTextCtrl paint benchmark");
+    gs_text = new wxRichTextCtrl(gs_frame, wxID_ANY);
+    gs_text->SetValue(text);
+
+    Bench::ShowForPainting(gs_frame);
+
+    return true;
+}
+
+void RichTextPaintDone()
+{
+    delete gs_frame;
+    gs_frame = nullptr;
+    gs_text = nullptr;
+}
+
+} // anonymous namespace
+
+// Scroll a control with many paragraphs by a page and repaint it.
+BENCHMARK_FUNC_WITH_INIT(RichTextScrollPaint, RichTextPaintInit, RichTextPaintDone)
+{
+    return Bench::ScrollPageAndPaint(gs_text);
+}
+
+#endif // wxUSE_RICHTEXT
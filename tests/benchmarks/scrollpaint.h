@@ -0,0 +1,95 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        tests/benchmarks/scrollpaint.h
+// Purpose:     Helpers for the benchmarks of scrolling and painting controls
+// Author:      wxWidgets team
+// Created:     2026-10-15
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef _WX_TESTS_BENCHMARKS_SCROLLPAINT_H_
+#define _WX_TESTS_BENCHMARKS_SCROLLPAINT_H_
+
+#include "wx/frame.h"
+#include "wx/scrolwin.h"
+
+#include "bench.h"
+
+namespace Bench
+{
+
+/**
+    Get the number of rows to use for the scroll and paint benchmarks.
+
+    This is the numeric parameter, allowing to measure how the frame time
+    scales with the number of rows (typically from 10^3 to 10^6), or the
+    given default if it's not specified.
+ */
+inline int GetNumRows(int defValue)
+{
+    return static_cast<int>(GetNumericParameter(defValue));
+}
+
+/**
+    Create a frame of the fixed size used by all the paint benchmarks.
+
+    The frame is not shown yet, call ShowForPainting() after creating the
+    control to benchmark inside it.
+ */
+inline wxFrame* CreatePaintFrame(const char* title)
+{
+    return new wxFrame(nullptr, wxID_ANY, title,
+                       wxDefaultPosition, wxSize(800, 600));
+}
+
+/**
+    Show the frame and paint it for the first time.
+
+    This ensures that the one-time initialization, e.g. the initial layout,
+    is not included in the measured times.
+ */
+inline void ShowForPainting(wxFrame* frame)
+{
+    frame->Show();
+    frame->Raise();
+    frame->Update();
+}
+
+/**
+    Scroll the window down by one page and repaint it immediately.
+
+    If the window is already scrolled to the bottom, it is scrolled back to
+    the top instead, so that calling this function repeatedly scrolls through
+    the entire window contents.
+
+    The time taken by this function is the time needed to render a single
+    frame while scrolling the window.
+ */
+inline bool ScrollPageAndPaint(wxScrollHelper* scroll)
+{
+    wxWindow* const win = scroll->GetTargetWindow();
+
+    int ppuX, ppuY;
+    scroll->GetScrollPixelsPerUnit(&ppuX, &ppuY);
+    if ( !ppuY )
+        return false;
+
+    int x, y;
+    scroll->GetViewStart(&x, &y);
+
+    const int page = wxMax(win->GetClientSize().y / ppuY, 1);
+    scroll->Scroll(x, y + page);
+
+    int yNew;
+    scroll->GetViewStart(&x, &yNew);
+    if ( yNew == y )
+        scroll->Scroll(x, 0);
+
+    win->Update();
+
+    return true;
+}
+
+} // namespace Bench
+
+#endif // _WX_TESTS_BENCHMARKS_SCROLLPAINT_H_
@@ -0,0 +1,123 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        tests/benchmarks/sizers.cpp
+// Purpose:     wxGridBagSizer and wxWrapSizer layout benchmarks
+// Author:      wxWidgets team
+// Created:     2026-10-15
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+#include "wx/gbsizer.h"
+#include "wx/wrapsizer.h"
+
+#include "bench.h"
+
+namespace
+{
+
+// Number of rows and columns in the grid bag sizer.
+const int GRID_SIZE = 60;
+
+// Number of items in the wrap sizer.
+const int NUM_WRAP_ITEMS = 5000;
+
+wxGridBagSizer* gs_gbSizer = nullptr;
+wxWrapSizer* gs_wrapSizer = nullptr;
+
+bool GridBagSizerInit()
+{
+    gs_gbSizer = new wxGridBagSizer(2, 2);
+
+    // Use spacers of different sizes, with every third item spanning two
+    // rows or two columns to exercise the code dealing with spans too.
+    for ( int row = 0; row < GRID_SIZE; row += 2 )
+    {
+        for ( int col = 0; col < GRID_SIZE; col += 2 )
+        {
+            const int w = 10 + (row + col) % 17;
+            const int h = 10 + (row * col) % 13;
+
+            switch ( (row + col) / 2 % 3 )
+            {
+                case 0:
+                    gs_gbSizer->Add(w, h, wxGBPosition(row, col));
+                    gs_gbSizer->Add(w, h, wxGBPosition(row, col + 1));
+                    gs_gbSizer->Add(h, w, wxGBPosition(row + 1, col),
+                                    wxGBSpan(1, 2));
+                    break;
+
+                case 1:
+                    gs_gbSizer->Add(2*w, h, wxGBPosition(row, col),
+                                    wxGBSpan(2, 1));
+                    gs_gbSizer->Add(w, 2*h, wxGBPosition(row, col + 1),
+                                    wxGBSpan(2, 1));
+                    break;
+
+                case 2:
+                    gs_gbSizer->Add(2*w, 2*h, wxGBPosition(row, col),
+                                    wxGBSpan(2, 2));
+                    break;
+            }
+        }
+    }
+
+    return true;
+}
+
+void GridBagSizerDone()
+{
+    delete gs_gbSizer;
+    gs_gbSizer = nullptr;
+}
+
+bool WrapSizerInit()
+{
+    gs_wrapSizer = new wxWrapSizer(wxHORIZONTAL);
+
+    for ( int n = 0; n < NUM_WRAP_ITEMS; n++ )
+        gs_wrapSizer->Add(20 + n % 37, 10 + n % 11);
+
+    return true;
+}
+
+void WrapSizerDone()
+{
+    delete gs_wrapSizer;
+    gs_wrapSizer = nullptr;
+}
+
+} // anonymous namespace
+
+// Compute the minimal size of and lay out a big grid bag sizer.
+BENCHMARK_FUNC_WITH_INIT(GridBagSizerLayout, GridBagSizerInit, GridBagSizerDone)
+{
+    // Alternate between two sizes to ensure the layout is really redone.
+    static bool s_bigger = false;
+    s_bigger = !s_bigger;
+
+    const wxSize minSize = gs_gbSizer->CalcMin();
+    gs_gbSizer->SetDimension(wxPoint(0, 0),
+                             s_bigger ? minSize + wxSize(100, 100) : minSize);
+
+    Bench::SetItemsPerRun(gs_gbSizer->GetItemCount(), "Items");
+
+    return minSize.x > 0 && minSize.y > 0;
+}
+
+// Compute the minimal size of a wrap sizer with known height, as done when
+// it's used inside a vertical box, and lay it out.
+BENCHMARK_FUNC_WITH_INIT(WrapSizerLayout, WrapSizerInit, WrapSizerDone)
+{
+    static bool s_bigger = false;
+    s_bigger = !s_bigger;
+
+    const int height = s_bigger ? 2000 : 1000;
+    gs_wrapSizer->InformFirstDirection(wxVERTICAL, height, 0);
+
+    const wxSize minSize = gs_wrapSizer->CalcMin();
+    gs_wrapSizer->SetDimension(wxPoint(0, 0), wxSize(minSize.x, height));
+
+    Bench::SetItemsPerRun(NUM_WRAP_ITEMS, "Items");
+
+    return minSize.x > 0;
+}
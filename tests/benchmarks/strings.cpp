@@ -10,6 +10,7 @@
 #include "wx/string.h"
 #include "wx/ffile.h"
 #include "wx/arrstr.h"
+#include "wx/numformatter.h"
 
 #include "bench.h"
 #include "htmlparser/htmlpars.h"
@@ -329,6 +330,51 @@ BENCHMARK_FUNC(ArrStrSort)
     return !a.empty();
 }
 
+// Return the same array of unsorted file-like names on every call.
+static const wxArrayString& GetUnsortedNames()
+{
+    static wxArrayString s_names;
+    if ( s_names.empty() )
+    {
+        s_names.reserve(1000);
+        for ( int i = 0; i < 1000; ++i )
+            s_names.push_back(wxString::Format("File %d-%d.txt", (i * 7919) % 1000, i % 10));
+    }
+
+    return s_names;
+}
+
+BENCHMARK_FUNC(ArrStrSortNoCase)
+{
+    wxArrayString a(GetUnsortedNames());
+    a.Sort(wxDictionaryStringSortAscending);
+    return !a.empty();
+}
+
+BENCHMARK_FUNC(ArrStrSortNatural)
+{
+    wxArrayString a(GetUnsortedNames());
+    a.Sort(wxCmpNaturalGeneric);
+    return !a.empty();
+}
+
+BENCHMARK_FUNC(SortedArrStrAdd)
+{
+    const wxArrayString& names = GetUnsortedNames();
+
+    wxSortedArrayString a;
+    for ( size_t n = 0; n < names.size(); ++n )
+        a.Add(names[n]);
+    return !a.empty();
+}
+
+BENCHMARK_FUNC(SortedArrStrAddSorted)
+{
+    wxSortedArrayString a;
+    a.AddSorted(GetUnsortedNames());
+    return !a.empty();
+}
+
 BENCHMARK_FUNC(VectorStrPushBack)
 {
     std::vector<wxString> v;
@@ -663,6 +709,52 @@ BENCHMARK_FUNC(PrintfDouble)
     return true;
 }
 
+BENCHMARK_FUNC(NumberFormatterToString)
+{
+    long total = 0;
+    for ( long n = 0; n < 1000; n++ )
+    {
+        total += wxNumberFormatter::ToString(n*12345).length();
+        total += wxNumberFormatter::ToString(n*1.2345, 2).length();
+    }
+
+    return total > 0;
+}
+
+BENCHMARK_FUNC(CachedNumberFormatterToString)
+{
+    const wxCachedNumberFormatter fmt;
+
+    long total = 0;
+    for ( long n = 0; n < 1000; n++ )
+    {
+        total += fmt.ToString(n*12345).length();
+        total += fmt.ToString(n*1.2345, 2).length();
+    }
+
+    return total > 0;
+}
+
+BENCHMARK_FUNC(NumberFormatterFromString)
+{
+    double d = 0.;
+    long l = 0;
+    return wxNumberFormatter::FromString("1234567", &l) &&
+            wxNumberFormatter::FromString("-12345.678", &d) &&
+                l == 1234567 && d == -12345.678;
+}
+
+BENCHMARK_FUNC(CachedNumberFormatterFromString)
+{
+    static const wxCachedNumberFormatter fmt;
+
+    double d = 0.;
+    long l = 0;
+    return fmt.FromString("1234567", &l) &&
+            fmt.FromString("-12345.678", &d) &&
+                l == 1234567 && d == -12345.678;
+}
+
 #if wxHAS_CXX17_INCLUDE(<charconv>)
 
 #include <charconv>
@@ -0,0 +1,119 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        tests/benchmarks/timer.cpp
+// Purpose:     wxTimer benchmarks
+// Author:      wxWidgets team
+// Created:     2026-10-15
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+#include "bench.h"
+
+#include "wx/timer.h"
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+#if wxUSE_TIMER
+
+namespace
+{
+
+// Start the given number of timers, all of them with different and long
+// enough intervals to ensure they don't expire during the benchmark, and then
+// stop them in the given order.
+enum class StopOrder
+{
+    Same,
+    Reverse,
+    Random
+};
+
+bool StartAndStopTimers(StopOrder order)
+{
+    const int numTimers = Bench::GetNumericParameter(1000);
+
+    std::vector<std::unique_ptr<wxTimer>> timers;
+    timers.reserve(numTimers);
+    for ( int n = 0; n < numTimers; n++ )
+        timers.emplace_back(new wxTimer());
+
+    // Use intervals in random order, as the timers are not necessarily
+    // started in the order of their expiration.
+    std::vector<int> intervals(numTimers);
+    for ( int n = 0; n < numTimers; n++ )
+        intervals[n] = 100000 + n;
+
+    std::mt19937 rng(17);
+    std::shuffle(intervals.begin(), intervals.end(), rng);
+
+    for ( int n = 0; n < numTimers; n++ )
+        timers[n]->Start(intervals[n]);
+
+    switch ( order )
+    {
+        case StopOrder::Same:
+            break;
+
+        case StopOrder::Reverse:
+            std::reverse(timers.begin(), timers.end());
+            break;
+
+        case StopOrder::Random:
+            std::shuffle(timers.begin(), timers.end(), rng);
+            break;
+    }
+
+    for ( auto& timer : timers )
+        timer->Stop();
+
+    Bench::SetItemsPerRun(numTimers, "Timers");
+
+    return true;
+}
+
+} // anonymous namespace
+
+BENCHMARK_FUNC(TimerStartStop)
+{
+    return StartAndStopTimers(StopOrder::Same);
+}
+
+BENCHMARK_FUNC(TimerStartStopReverse)
+{
+    return StartAndStopTimers(StopOrder::Reverse);
+}
+
+BENCHMARK_FUNC(TimerStartStopRandom)
+{
+    return StartAndStopTimers(StopOrder::Random);
+}
+
+// Restart the same timers many times, as it happens with the timeouts which
+// are reset whenever some activity happens.
+BENCHMARK_FUNC(TimerRestart)
+{
+    const int numTimers = Bench::GetNumericParameter(1000);
+
+    std::vector<std::unique_ptr<wxTimer>> timers;
+    timers.reserve(numTimers);
+    for ( int n = 0; n < numTimers; n++ )
+    {
+        timers.emplace_back(new wxTimer());
+        timers.back()->Start(100000 + n);
+    }
+
+    for ( int n = 0; n < numTimers; n++ )
+        timers[n]->Start(200000 - n);
+
+    for ( auto& timer : timers )
+        timer->Stop();
+
+    Bench::SetItemsPerRun(numTimers, "Timers");
+
+    return true;
+}
+
+#endif // wxUSE_TIMER
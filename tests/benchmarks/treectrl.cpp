@@ -0,0 +1,134 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        tests/benchmarks/treectrl.cpp
+// Purpose:     wxGenericTreeCtrl benchmarks
+// Author:      wxWidgets team
+// Created:     2026-10-14
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+#include "wx/frame.h"
+#include "wx/treectrl.h"
+#include "wx/generic/treectlg.h"
+
+#include "bench.h"
+#include "scrollpaint.h"
+
+#if wxUSE_TREECTRL
+
+namespace
+{
+
+// Number of top level items and of the children of the first of them.
+const int NUM_ITEMS = 100000;
+const int NUM_CHILDREN = 100;
+
+wxFrame* gs_frame = nullptr;
+wxGenericTreeCtrl* gs_tree = nullptr;
+wxTreeItemId gs_branch,
+             gs_middle;
+
+bool TreeCtrlInit()
+{
+    gs_frame = new wxFrame(nullptr, wxID_ANY, "wxGenericTreeCtrl benchmark");
+    gs_tree = new wxGenericTreeCtrl(gs_frame, wxID_ANY,
+                                    wxDefaultPosition, wxDefaultSize,
+                                    wxTR_DEFAULT_STYLE | wxTR_HIDE_ROOT);
+
+    const wxTreeItemId root = gs_tree->AddRoot("Root");
+    for ( int n = 0; n < NUM_ITEMS; n++ )
+    {
+        const wxTreeItemId
+            item = gs_tree->AppendItem(root, wxString::Format("Item %d", n));
+
+        if ( n == 0 )
+            gs_branch = item;
+        else if ( n == NUM_ITEMS / 2 )
+            gs_middle = item;
+    }
+
+    for ( int n = 0; n < NUM_CHILDREN; n++ )
+        gs_tree->AppendItem(gs_branch, wxString::Format("Child %d", n));
+
+    gs_frame->Show();
+
+    // Lay out all the items once before measuring anything.
+    gs_tree->Expand(gs_branch);
+    gs_tree->Collapse(gs_branch);
+    gs_tree->Update();
+
+    return true;
+}
+
+// Create a flat tree with the number of items given by the numeric parameter.
+bool TreeCtrlPaintInit()
+{
+    gs_frame = Bench::CreatePaintFrame("wxGenericTreeCtrl paint benchmark");
+    gs_tree = new wxGenericTreeCtrl(gs_frame, wxID_ANY,
+                                    wxDefaultPosition, wxDefaultSize,
+                                    wxTR_DEFAULT_STYLE | wxTR_HIDE_ROOT);
+
+    const int numItems = Bench::GetNumRows(NUM_ITEMS);
+
+    const wxTreeItemId root = gs_tree->AddRoot("Root");
+    for ( int n = 0; n < numItems; n++ )
+        gs_tree->AppendItem(root, wxString::Format("Item %d", n));
+
+    Bench::ShowForPainting(gs_frame);
+
+    return true;
+}
+
+void TreeCtrlDone()
+{
+    delete gs_frame;
+    gs_frame = nullptr;
+    gs_tree = nullptr;
+    gs_branch =
+    gs_middle = wxTreeItemId();
+}
+
+} // anonymous namespace
+
+// Expand and collapse an item at the top of a big tree.
+BENCHMARK_FUNC_WITH_INIT(TreeCtrlExpandCollapse, TreeCtrlInit, TreeCtrlDone)
+{
+    gs_tree->Expand(gs_branch);
+    gs_tree->Collapse(gs_branch);
+
+    Bench::SetItemsPerRun(2, "Toggles");
+
+    return !gs_tree->IsExpanded(gs_branch);
+}
+
+// Find the items shown in the middle of a big tree by their position.
+BENCHMARK_FUNC_WITH_INIT(TreeCtrlHitTest, TreeCtrlInit, TreeCtrlDone)
+{
+    const int numHits = 1000;
+
+    gs_tree->ScrollTo(gs_middle);
+
+    wxRect rect;
+    if ( !gs_tree->GetBoundingRect(gs_middle, rect) )
+        return false;
+
+    bool ok = true;
+    for ( int n = 0; n < numHits; n++ )
+    {
+        int flags = 0;
+        if ( gs_tree->HitTest(rect.GetPosition() + wxSize(1, 1), flags) != gs_middle )
+            ok = false;
+    }
+
+    Bench::SetItemsPerRun(numHits, "Items");
+
+    return ok;
+}
+
+// Scroll a big tree by a page and repaint it.
+BENCHMARK_FUNC_WITH_INIT(TreeCtrlScrollPaint, TreeCtrlPaintInit, TreeCtrlDone)
+{
+    return Bench::ScrollPageAndPaint(gs_tree);
+}
+
+#endif // wxUSE_TREECTRL
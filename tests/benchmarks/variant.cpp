@@ -0,0 +1,94 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        tests/benchmarks/variant.cpp
+// Purpose:     wxVariant benchmarks
+// Author:      wxWidgets team
+// Created:     2026-10-14
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+#include "wx/variant.h"
+
+#include "bench.h"
+
+#if wxUSE_VARIANT
+
+// Number of values passed through wxVariant by each benchmark run.
+static const int NUM_VALUES = 10000;
+
+// All the benchmarks below emulate what happens when a control, such as
+// wxDataViewCtrl, retrieves the value of a cell from the model into a new
+// variant, copies it to the renderer and then extracts it from the variant.
+
+BENCHMARK_FUNC(VariantLong)
+{
+    long sum = 0;
+    for ( int n = 0; n < NUM_VALUES; n++ )
+    {
+        wxVariant value;
+        value = static_cast<long>(n);
+
+        const wxVariant copy(value);
+        sum += copy.GetLong();
+    }
+
+    Bench::SetItemsPerRun(NUM_VALUES, "Values");
+
+    return sum == static_cast<long>(NUM_VALUES)*(NUM_VALUES - 1)/2;
+}
+
+BENCHMARK_FUNC(VariantBool)
+{
+    int count = 0;
+    for ( int n = 0; n < NUM_VALUES; n++ )
+    {
+        wxVariant value;
+        value = n % 2 == 0;
+
+        const wxVariant copy(value);
+        if ( copy.GetBool() )
+            count++;
+    }
+
+    Bench::SetItemsPerRun(NUM_VALUES, "Values");
+
+    return count == NUM_VALUES / 2;
+}
+
+BENCHMARK_FUNC(VariantDouble)
+{
+    double sum = 0;
+    for ( int n = 0; n < NUM_VALUES; n++ )
+    {
+        wxVariant value;
+        value = n / 2.0;
+
+        const wxVariant copy(value);
+        sum += copy.GetDouble();
+    }
+
+    Bench::SetItemsPerRun(NUM_VALUES, "Values");
+
+    return sum > 0;
+}
+
+BENCHMARK_FUNC(VariantString)
+{
+    const wxString str("Short");
+
+    size_t len = 0;
+    for ( int n = 0; n < NUM_VALUES; n++ )
+    {
+        wxVariant value;
+        value = str;
+
+        const wxVariant copy(value);
+        len += copy.GetString().length();
+    }
+
+    Bench::SetItemsPerRun(NUM_VALUES, "Values");
+
+    return len == NUM_VALUES*str.length();
+}
+
+#endif // wxUSE_VARIANT
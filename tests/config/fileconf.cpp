@@ -22,6 +22,8 @@
 #include "wx/sstream.h"
 #include "wx/log.h"
 
+#include "testfile.h"
+
 static const char *testconfig =
 "[root]\n"
 "entry=value\n"
@@ -626,6 +628,147 @@ TEST_CASE("wxFileConfig::ReadFloat", "[fileconfig][config]")
     CHECK( f == -9876.5432f );
 }
 
+TEST_CASE("wxFileConfig::Unsorted", "[fileconfig][config]")
+{
+    static const char *confTest =
+        "zeta=1\n"
+        "Alpha=2\n"
+        "mu=3\n"
+        "[Zoo]\n"
+        "[bar]\n"
+        "[Foo]\n"
+    ;
+
+    wxStringInputStream sis(confTest);
+    wxFileConfig fc(sis);
+
+    // Entries and groups are enumerated in alphabetical order, independently
+    // of their order in the file and of their case.
+    CheckGroupEntries(fc, "", 3, "Alpha", "mu", "zeta");
+    CheckGroupSubgroups(fc, "", 3, "bar", "Foo", "Zoo");
+
+    // And they're found ignoring the case.
+    CHECK( fc.Read("ZETA", 0L) == 1 );
+    CHECK( fc.HasGroup("BAR") );
+
+    // Adding or renaming them must preserve the order too.
+    fc.Write("beta", 4);
+    fc.Write("/Baz/x", 5);
+    CHECK( fc.RenameGroup("Zoo", "Aardvark") );
+    CheckGroupEntries(fc, "", 4, "Alpha", "beta", "mu", "zeta");
+    CheckGroupSubgroups(fc, "", 4, "Aardvark", "bar", "Baz", "Foo");
+
+    // But their order in the file stays the same.
+    wxVERIFY_FILECONFIG( "zeta=1\n"
+                         "Alpha=2\n"
+                         "mu=3\n"
+                         "beta=4\n"
+                         "[Aardvark]\n"
+                         "[bar]\n"
+                         "[Foo]\n"
+                         "[Baz]\n"
+                         "x=5\n",
+                         fc );
+}
+
+TEST_CASE("wxFileConfig::FlushUnchanged", "[fileconfig][config]")
+{
+    TestFile tf;
+    REQUIRE( wxRemoveFile(tf.GetName()) );
+
+    {
+        wxFileConfig fc("", "", tf.GetName(), "", wxCONFIG_USE_LOCAL_FILE);
+        fc.Write("/group/entry", "value");
+    }
+
+    REQUIRE( wxFileExists(tf.GetName()) );
+
+    // Writing the same value again shouldn't result in rewriting the file.
+    wxFileConfig fc("", "", tf.GetName(), "", wxCONFIG_USE_LOCAL_FILE);
+    REQUIRE( wxRemoveFile(tf.GetName()) );
+
+    fc.Write("/group/entry", "value");
+    CHECK( fc.Flush() );
+    CHECK( !wxFileExists(tf.GetName()) );
+
+    // But writing a different one should.
+    fc.Write("/group/entry", "another value");
+    CHECK( fc.Flush() );
+    CHECK( wxFileExists(tf.GetName()) );
+}
+
+#if wxUSE_THREADS
+
+TEST_CASE("wxFileConfig::WriteBehind", "[fileconfig][config]")
+{
+    TestFile tf;
+    REQUIRE( wxRemoveFile(tf.GetName()) );
+
+    const auto readBack = [&tf]()
+    {
+        wxFileConfig fc("", "", tf.GetName(), "", wxCONFIG_USE_LOCAL_FILE);
+        return fc.Read("/group/entry", wxString());
+    };
+
+    {
+        wxFileConfig fc("", "", tf.GetName(), "", wxCONFIG_USE_LOCAL_FILE);
+        CHECK( !fc.IsWriteBehindEnabled() );
+
+        fc.EnableWriteBehind();
+        CHECK( fc.IsWriteBehindEnabled() );
+
+        // Nothing to wait for yet.
+        CHECK( fc.Sync() );
+
+        // Flush many times in a row, only the last value must be kept.
+        for ( int n = 0; n < 100; n++ )
+        {
+            fc.Write("/group/entry", n);
+            CHECK( fc.Flush() );
+        }
+
+        CHECK( fc.Sync() );
+        CHECK( readBack() == "99" );
+
+        // The destructor must write the pending changes too.
+        fc.Write("/group/entry", "last");
+    }
+
+    CHECK( readBack() == "last" );
+
+    SECTION("DeleteAll")
+    {
+        wxFileConfig fc("", "", tf.GetName(), "", wxCONFIG_USE_LOCAL_FILE);
+        fc.EnableWriteBehind();
+
+        fc.Write("/group/entry", "deleted");
+        CHECK( fc.Flush() );
+
+        // The pending write must not recreate the file after deleting it.
+        CHECK( fc.DeleteAll() );
+        CHECK( fc.Sync() );
+        CHECK( !wxFileExists(tf.GetName()) );
+
+        fc.DisableAutoSave();
+    }
+
+    SECTION("Disable")
+    {
+        wxFileConfig fc("", "", tf.GetName(), "", wxCONFIG_USE_LOCAL_FILE);
+        fc.EnableWriteBehind();
+
+        fc.Write("/group/entry", "async");
+        CHECK( fc.Flush() );
+
+        // Disabling write-behind mode must wait for the pending write.
+        fc.EnableWriteBehind(false);
+        CHECK( !fc.IsWriteBehindEnabled() );
+        CHECK( readBack() == "async" );
+    }
+}
+
+#endif // wxUSE_THREADS
+
 TEST_CASE("wxFileConfig::LongLong", "[fileconfig][config][longlong]")
 {
     wxFileConfig fc("", "", "", "", 0); // Don't use any files.
@@ -26,6 +26,8 @@
 #include "testableframe.h"
 #include "asserthelper.h"
 
+#include <algorithm>
+
 // ----------------------------------------------------------------------------
 // test class
 // ----------------------------------------------------------------------------
@@ -861,6 +863,121 @@ TEST_CASE_METHOD(MultiColumnsDataViewCtrlTestCase,
     CHECK( m_lastColumn->GetWidth() >= lastColumnMinWidth );
 }
 
+TEST_CASE_METHOD(MultiColumnsDataViewCtrlTestCase,
+                 "wxDVC::BackgroundSort",
+                 "[wxDataViewCtrl][sort]")
+{
+    if ( !m_dvc->EnableBackgroundSorting() )
+    {
+        WARN("Skipping test not supported in this port.");
+        return;
+    }
+
+    // Append the items in an order different from the sort one.
+    const int count = 1000;
+    for ( int n = 0; n < count; n++ )
+    {
+        wxVector<wxVariant> values;
+        values.push_back(wxString::Format("%04d", (n*7) % count));
+        values.push_back(wxString());
+        m_dvc->AppendItem(values);
+    }
+
+    // Return the values of the first column in the order they're shown in.
+    const auto getShownValues = [this, count]()
+    {
+        std::vector<std::pair<int, wxString>> rows;
+        for ( int n = 0; n < count; n++ )
+        {
+            rows.push_back(std::make_pair(m_dvc->GetItemRect(m_dvc->RowToItem(n)).y,
+                                          m_dvc->GetTextValue(n, 0)));
+        }
+
+        std::sort(rows.begin(), rows.end());
+
+        wxVector<wxString> values;
+        for ( const auto& row : rows )
+            values.push_back(row.second);
+
+        return values;
+    };
+
+    m_firstColumn->SetSortOrder(true);
+    m_dvc->GetModel()->Resort();
+
+    // The sort happens in the background, so wait until it's done.
+    wxStopWatch sw;
+    while ( getShownValues()[0] != "0000" )
+    {
+        if ( sw.Time() > 2000 )
+            break;
+
+        wxYield();
+    }
+
+    wxVector<wxString> values = getShownValues();
+    for ( int n = 0; n < count; n++ )
+    {
+        INFO("row = " << n);
+        CHECK( values[n] == wxString::Format("%04d", n) );
+    }
+
+    // Sort in the opposite order and change the model immediately, before
+    // the background sort can finish: the items must still be sorted.
+    m_firstColumn->SetSortOrder(false);
+    m_dvc->GetModel()->Resort();
+    m_dvc->SetTextValue("9999", 0, 0);
+
+    values = getShownValues();
+    CHECK( values[0] == "9999" );
+    CHECK( values[1] == "0999" );
+    CHECK( values[count - 1] == "0001" );
+
+    // Check that processing the results of the abandoned sort doesn't change
+    // anything.
+    wxYield();
+    CHECK( getShownValues() == values );
+}
+
+#ifndef __WXMAC__
+
+TEST_CASE("wxDVC::GetValuesForRange", "[wxDataViewCtrl][model]")
+{
+    class VirtualListModel : public wxDataViewVirtualListModel
+    {
+    public:
+        VirtualListModel() : wxDataViewVirtualListModel(100) { }
+
+        virtual void GetValueByRow(wxVariant& variant,
+                                   unsigned row, unsigned col) const override
+        {
+            variant = wxString::Format("%u/%u", row, col);
+        }
+
+        virtual bool SetValueByRow(const wxVariant& WXUNUSED(variant),
+                                   unsigned WXUNUSED(row),
+                                   unsigned WXUNUSED(col)) override
+        {
+            return false;
+        }
+    };
+
+    wxObjectDataPtr<VirtualListModel> model(new VirtualListModel);
+
+    wxVector<wxVariant> values(3, wxVariant("stale"));
+    REQUIRE( model->GetValuesForRange(1, 97, 3, values) );
+    REQUIRE( values.size() == 3 );
+    CHECK( values[0].GetString() == "97/1" );
+    CHECK( values[2].GetString() == "99/1" );
+
+    REQUIRE( model->GetValuesForRange(0, 0, 0, values) );
+    CHECK( values.empty() );
+
+    WX_ASSERT_FAILS_WITH_ASSERT( model->GetValuesForRange(0, 98, 3, values) );
+}
+
+#endif // !__WXMAC__
+
 #if wxUSE_UIACTIONSIMULATOR
 
 TEST_CASE_METHOD(SingleSelectDataViewCtrlTestCase,
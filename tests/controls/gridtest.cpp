@@ -16,8 +16,10 @@
     #include "wx/dcclient.h"
 #endif // WX_PRECOMP
 
+#include "wx/clipbrd.h"
 #include "wx/grid.h"
 #include "wx/headerctrl.h"
+#include "wx/textfile.h"
 #include "testableframe.h"
 #include "asserthelper.h"
 #include "wx/uiaction.h"
@@ -104,6 +106,9 @@ public:
     {
     }
 
+    using wxGrid::GetRowTop;
+    using wxGrid::GetRowBottom;
+
     wxGridCellAttr* CallGetCellAttr(int row, int col) const
     {
         return GetCellAttr(row, col);
@@ -758,6 +763,51 @@ TEST_CASE_METHOD(GridTestCase, "Grid::Size", "[grid]")
 #endif
 }
 
+TEST_CASE_METHOD(GridTestCase, "Grid::RowPositions", "[grid]")
+{
+    const int h = m_grid->GetDefaultRowSize();
+
+    m_grid->SetRowSize(2, 3*h);
+    CHECK( m_grid->GetRowTop(3) == 5*h );
+    CHECK( m_grid->GetRowBottom(9) == 12*h );
+    CHECK( m_grid->YToRow(2*h) == 2 );
+    CHECK( m_grid->YToRow(5*h - 1) == 2 );
+    CHECK( m_grid->YToRow(5*h) == 3 );
+    CHECK( m_grid->YToRow(12*h) == wxNOT_FOUND );
+    CHECK( m_grid->YToRow(12*h, true) == 9 );
+
+    SECTION("Hidden")
+    {
+        m_grid->HideRow(3);
+        CHECK( m_grid->GetRowTop(4) == 5*h );
+        CHECK( m_grid->YToRow(5*h) == 4 );
+    }
+
+    SECTION("Moved")
+    {
+        m_grid->SetRowPos(2, 0);
+        CHECK( m_grid->GetRowBottom(2) == 3*h );
+        CHECK( m_grid->GetRowTop(0) == 3*h );
+        CHECK( m_grid->YToRow(h) == 2 );
+        CHECK( m_grid->YToRow(3*h) == 0 );
+    }
+
+    SECTION("Inserted")
+    {
+        m_grid->InsertRows(0, 2);
+        CHECK( m_grid->GetRowTop(4) == 4*h );
+        CHECK( m_grid->YToRow(7*h - 1) == 4 );
+        CHECK( m_grid->GetRowBottom(11) == 14*h );
+    }
+
+    SECTION("Deleted")
+    {
+        m_grid->DeleteRows(1, 2);
+        CHECK( m_grid->GetRowBottom(7) == 8*h );
+        CHECK( m_grid->YToRow(h) == 1 );
+    }
+}
+
 TEST_CASE_METHOD(GridTestCase, "Grid::RangeSelect", "[grid]")
 {
 #if wxUSE_UIACTIONSIMULATOR
@@ -1835,6 +1885,56 @@ TEST_CASE_METHOD(GridTestCase, "Grid::AutoSizeColumn", "[grid]")
     }
 }
 
+TEST_CASE_METHOD(GridTestCase, "Grid::AutoSizeSampleRows", "[grid]")
+{
+    CHECK( m_grid->GetAutoSizeSampleRows() == 0 );
+
+    m_grid->AppendRows(1000);
+    const int lastRow = m_grid->GetNumberRows() - 1;
+
+    m_grid->SetCellValue(0, 0, "W");
+    m_grid->SetCellValue(lastRow, 0, "WWWWWWWWWWWWWWWW");
+
+    m_grid->AutoSizeColumn(0);
+    const int width = m_grid->GetColSize(0);
+
+    // The last row is always measured, so we must get the same result.
+    m_grid->SetAutoSizeSampleRows(10);
+    CHECK( m_grid->GetAutoSizeSampleRows() == 10 );
+
+    m_grid->SetColSize(0, 10);
+    m_grid->AutoSizeColumn(0);
+    CHECK( m_grid->GetColSize(0) == width );
+
+    m_grid->SetAutoSizeSampleRows(0);
+    m_grid->SetColSize(0, 10);
+    m_grid->AutoSizeColumn(0);
+    CHECK( m_grid->GetColSize(0) == width );
+}
+
+TEST_CASE_METHOD(GridTestCase, "Grid::RefreshCells", "[grid]")
+{
+    m_grid->GetTable()->SetValue(0, 0, "foo");
+    m_grid->GetTable()->SetValue(2, 1, "bar");
+
+    std::vector<wxGridCellCoords> cells;
+    cells.push_back(wxGridCellCoords(0, 0));
+    cells.push_back(wxGridCellCoords(2, 1));
+    cells.push_back(wxGridCellCoords(0, 0));
+    cells.push_back(wxGridCellCoords(9, 1));
+    m_grid->RefreshCells(cells);
+
+    // Refreshing the cells which don't exist any more when the refresh
+    // happens must not result in any problems.
+    m_grid->DeleteRows(5, 5);
+
+    wxYield();
+    m_grid->Update();
+
+    CHECK( m_grid->GetCellValue(0, 0) == "foo" );
+    CHECK( m_grid->GetCellValue(2, 1) == "bar" );
+}
+
 TEST_CASE_METHOD(GridTestCase, "Grid::DrawInvalidCell", "[grid][multicell]")
 {
     // Set up a multicell with inside an overflowing cell.
@@ -2618,6 +2718,282 @@ TEST_CASE("GridBlockCoords::SymDifference", "[grid]")
     }
 }
 
+namespace
+{
+
+// Table recording the requests to fetch its rows.
+class PagedTable : public wxGridPagedTableBase
+{
+public:
+    explicit PagedTable(int numRows) : wxGridPagedTableBase(10), m_numRows(numRows) { }
+
+    virtual int GetNumberRows() override { return m_numRows; }
+    virtual int GetNumberCols() override { return 2; }
+    virtual wxString GetValue(int row, int col) override
+        { return wxString::Format("%d:%d", row, col); }
+    virtual void SetValue(int, int, const wxString&) override { }
+
+    // Requested ranges as "first+count" strings.
+    std::vector<std::string> m_requests;
+
+protected:
+    virtual void FetchRows(int firstRow, int numRows) override
+    {
+        m_requests.push_back(wxString::Format("%d+%d", firstRow, numRows).ToStdString());
+    }
+
+private:
+    const int m_numRows;
+};
+
+} // anonymous namespace
+
+TEST_CASE("GridPagedTableBase", "[grid]")
+{
+    PagedTable table(95);
+    table.SetPrefetchRows(5);
+
+    CHECK( !table.IsRowAvailable(0) );
+
+    table.PrepareRows(12, 20);
+    REQUIRE( table.m_requests.size() == 1 );
+    CHECK( table.m_requests[0] == "0+30" );
+
+    // Pages already requested are not requested again.
+    table.PrepareRows(12, 24);
+    CHECK( table.m_requests.size() == 1 );
+
+    table.NotifyRowsFetched(0, 30);
+    CHECK( table.IsRowAvailable(0) );
+    CHECK( table.IsRowAvailable(29) );
+    CHECK( !table.IsRowAvailable(30) );
+
+    // The last page is incomplete.
+    table.PrepareRows(90, 94);
+    REQUIRE( table.m_requests.size() == 2 );
+    CHECK( table.m_requests[1] == "80+15" );
+
+    // Only the pages fully covered are marked as available.
+    table.NotifyRowsFetched(85, 10);
+    CHECK( !table.IsRowAvailable(85) );
+    CHECK( table.IsRowAvailable(90) );
+    CHECK( table.IsRowAvailable(94) );
+
+    table.InvalidateRows(25, 1);
+    CHECK( table.IsRowAvailable(19) );
+    CHECK( !table.IsRowAvailable(20) );
+    table.PrepareRows(20, 20);
+    REQUIRE( table.m_requests.size() == 3 );
+    CHECK( table.m_requests[2] == "20+10" );
+
+    table.InvalidateAllRows();
+    CHECK( !table.IsRowAvailable(0) );
+}
+
+TEST_CASE("GridRenderCache", "[grid]")
+{
+    wxGridRenderCache cache(3);
+
+    const wxFont font = *wxNORMAL_FONT;
+
+    wxArrayString lines;
+    CHECK( !cache.GetLines(0, 0, "foo bar", font, 10, lines) );
+
+    wxArrayString wrapped;
+    wrapped.push_back("foo");
+    wrapped.push_back("bar");
+    cache.SetLines(0, 0, "foo bar", font, 10, wrapped);
+    CHECK( cache.GetLines(0, 0, "foo bar", font, 10, lines) );
+    CHECK( lines == wrapped );
+
+    // Different width, value or font must not use the cached lines.
+    CHECK( !cache.GetLines(0, 0, "foo bar", font, 20, lines) );
+    CHECK( !cache.GetLines(0, 0, "foo baz", font, 10, lines) );
+    CHECK( !cache.GetLines(0, 0, "foo bar", font.Bold(), 10, lines) );
+    CHECK( !cache.GetLines(0, 1, "foo bar", font, 10, lines) );
+
+    int width = 0;
+    cache.SetBestWidth(0, 0, "foo bar", font, 15, 30);
+    CHECK( cache.GetBestWidth(0, 0, "foo bar", font, 15, width) );
+    CHECK( width == 30 );
+    CHECK( !cache.GetBestWidth(0, 0, "foo bar", font, 16, width) );
+
+    // Storing the value for another value replaces everything cached.
+    cache.SetBestHeight(0, 0, "baz", font, 15, 40);
+    CHECK( !cache.GetLines(0, 0, "foo bar", font, 10, lines) );
+    CHECK( !cache.GetBestWidth(0, 0, "foo bar", font, 15, width) );
+
+    int height = 0;
+    CHECK( cache.GetBestHeight(0, 0, "baz", font, 15, height) );
+    CHECK( height == 40 );
+
+    cache.InvalidateCell(0, 0);
+    CHECK( !cache.GetBestHeight(0, 0, "baz", font, 15, height) );
+
+    // The cache is cleared when it becomes too big.
+    cache.SetBestSize(1, 0, "1", font, wxSize(1, 1));
+    cache.SetBestSize(2, 0, "2", font, wxSize(2, 2));
+    cache.SetBestSize(3, 0, "3", font, wxSize(3, 3));
+    CHECK( cache.GetCount() == 3 );
+
+    wxSize size;
+    CHECK( cache.GetBestSize(3, 0, "3", font, size) );
+    CHECK( size == wxSize(3, 3) );
+
+    cache.SetBestSize(4, 0, "4", font, wxSize(4, 4));
+    CHECK( cache.GetCount() == 1 );
+    CHECK( !cache.GetBestSize(3, 0, "3", font, size) );
+}
+
+TEST_CASE_METHOD(GridTestCase, "Grid::RenderCache", "[grid]")
+{
+    m_grid->SetCellValue(0, 0, "Some rather long text to wrap");
+    m_grid->SetCellRenderer(0, 0, new wxGridCellAutoWrapStringRenderer);
+
+    m_grid->AutoSizeColumn(0);
+    const int width = m_grid->GetColSize(0);
+
+    m_grid->EnableRenderCache();
+    CHECK( m_grid->IsRenderCacheEnabled() );
+
+    m_grid->AutoSizeColumn(0);
+    CHECK( m_grid->GetColSize(0) == width );
+    CHECK( m_grid->GetRenderCache()->GetCount() > 0 );
+
+    // Using the cached value must give the same result.
+    m_grid->AutoSizeColumn(0);
+    CHECK( m_grid->GetColSize(0) == width );
+
+    // Changing the value must invalidate the cached value.
+    m_grid->SetCellValue(0, 0, "Short");
+    m_grid->AutoSizeColumn(0);
+    const int widthCached = m_grid->GetColSize(0);
+
+    m_grid->EnableRenderCache(false);
+    CHECK( !m_grid->GetRenderCache() );
+
+    m_grid->AutoSizeColumn(0);
+    CHECK( m_grid->GetColSize(0) == widthCached );
+}
+
+#if wxUSE_CLIPBOARD
+TEST_CASE_METHOD(GridTestCase, "Grid::CopySelection", "[grid][clipboard]")
+{
+    m_grid->SetCellValue(0, 0, "A<1>");
+    m_grid->SetCellValue(0, 1, "B&1");
+    m_grid->SetCellValue(1, 0, "A2");
+    m_grid->SetCellValue(1, 1, "B2");
+
+    m_grid->SelectBlock(0, 0, 1, 1);
+
+    const wxString eol = wxTextFile::GetEOL();
+    const wxString expected = "A<1>\tB&1" + eol + "A2\tB2";
+
+    SECTION("Immediate")
+    {
+        REQUIRE( m_grid->CopySelection() );
+    }
+
+    SECTION("Deferred")
+    {
+        REQUIRE( m_grid->CopySelection(wxGRID_COPY_DEFAULT |
+                                       wxGRID_COPY_DEFERRED) );
+    }
+
+    wxClipboardLocker lockClip;
+    wxTextDataObject text;
+    REQUIRE( wxTheClipboard->GetData(text) );
+    CHECK( text.GetText() == expected );
+
+    wxHTMLDataObject html;
+    if ( wxTheClipboard->IsSupported(wxDF_HTML) )
+    {
+        REQUIRE( wxTheClipboard->GetData(html) );
+        CHECK( html.GetHTML().Contains("<td>A&lt;1&gt;</td><td>B&amp;1</td>") );
+    }
+
+    // Copying several blocks is not supported.
+    m_grid->SelectBlock(3, 3, 4, 4, true /* add to selection */);
+    CHECK( !m_grid->CopySelection() );
+}
+#endif // wxUSE_CLIPBOARD
+
+TEST_CASE("GridCellAttrProvider::SetAttrRange", "[grid][attr]")
+{
+    wxGridCellAttrProvider provider;
+
+    wxGridCellAttr* const attr1 = new wxGridCellAttr;
+    wxGridCellAttr* const attr2 = new wxGridCellAttr;
+
+    // Return the attribute used for the given cell.
+    const auto attrAt = [&provider](int row, int col)
+    {
+        return provider.GetAttrPtr(row, col, wxGridCellAttr::Cell).get();
+    };
+
+    provider.SetAttrRange(attr1, wxGridBlockCoords(1, 1, 10, 5));
+    CHECK( attrAt(0, 0) == nullptr );
+    CHECK( attrAt(1, 1) == attr1 );
+    CHECK( attrAt(10, 5) == attr1 );
+    CHECK( attrAt(11, 5) == nullptr );
+    CHECK( attrAt(10, 6) == nullptr );
+
+    // Setting the attribute for an overlapping block replaces it there only.
+    provider.SetAttrRange(attr2, wxGridBlockCoords(5, 0, 6, 3));
+    CHECK( attrAt(5, 0) == attr2 );
+    CHECK( attrAt(6, 3) == attr2 );
+    CHECK( attrAt(5, 4) == attr1 );
+    CHECK( attrAt(4, 1) == attr1 );
+    CHECK( attrAt(7, 1) == attr1 );
+
+    // Attribute set for the cell itself takes precedence over the block one.
+    wxGridCellAttr* const attrCell = new wxGridCellAttr;
+    provider.SetAttr(attrCell, 2, 2);
+    CHECK( attrAt(2, 2) == attrCell );
+    provider.SetAttr(nullptr, 2, 2);
+    CHECK( attrAt(2, 2) == attr1 );
+
+    SECTION("Insert")
+    {
+        provider.UpdateAttrRows(3, 2);
+        CHECK( attrAt(1, 1) == attr1 );
+        CHECK( attrAt(3, 1) == attr1 );
+        CHECK( attrAt(7, 0) == attr2 );
+        CHECK( attrAt(12, 5) == attr1 );
+        CHECK( attrAt(13, 5) == nullptr );
+
+        provider.UpdateAttrCols(0, 1);
+        CHECK( attrAt(1, 1) == nullptr );
+        CHECK( attrAt(1, 6) == attr1 );
+        CHECK( attrAt(7, 1) == attr2 );
+    }
+
+    SECTION("Delete")
+    {
+        provider.UpdateAttrRows(0, -5);
+        CHECK( attrAt(0, 0) == attr2 );
+        CHECK( attrAt(1, 0) == attr2 );
+        CHECK( attrAt(0, 4) == attr1 );
+        CHECK( attrAt(5, 5) == attr1 );
+        CHECK( attrAt(6, 5) == nullptr );
+
+        provider.UpdateAttrCols(0, -4);
+        CHECK( attrAt(0, 0) == attr1 );
+        CHECK( attrAt(1, 0) == attr1 );
+        CHECK( attrAt(0, 1) == attr1 );
+        CHECK( attrAt(0, 2) == nullptr );
+    }
+
+    SECTION("Reset")
+    {
+        provider.SetAttrRange(nullptr, wxGridBlockCoords(0, 0, 5, 5));
+        CHECK( attrAt(5, 0) == nullptr );
+        CHECK( attrAt(5, 5) == nullptr );
+        CHECK( attrAt(6, 0) == attr2 );
+        CHECK( attrAt(6, 5) == attr1 );
+    }
+}
+
 //
 // TestableGrid
 //
@@ -33,8 +33,11 @@ private:
 
     CPPUNIT_TEST_SUITE( HtmlListBoxTestCase );
         wxITEM_CONTAINER_TESTS();
+        CPPUNIT_TEST( CacheSize );
     CPPUNIT_TEST_SUITE_END();
 
+    void CacheSize();
+
     wxSimpleHtmlListBox* m_htmllbox;
 
     wxDECLARE_NO_COPY_CLASS(HtmlListBoxTestCase);
@@ -53,4 +56,25 @@ void HtmlListBoxTestCase::tearDown()
     wxDELETE(m_htmllbox);
 }
 
+void HtmlListBoxTestCase::CacheSize()
+{
+    for ( int n = 0; n < 100; n++ )
+        m_htmllbox->Append(wxString::Format("<b>Item</b> %d", n));
+
+    CPPUNIT_ASSERT_EQUAL( 50u, m_htmllbox->GetCacheSize() );
+
+    m_htmllbox->SetCacheSize(200);
+    CPPUNIT_ASSERT_EQUAL( 200u, m_htmllbox->GetCacheSize() );
+
+    // Items must still be created correctly after being precached.
+    m_htmllbox->PrecacheItems(0, 99);
+    wxYield();
+
+    CPPUNIT_ASSERT_EQUAL( "<b>Item</b> 42", m_htmllbox->GetString(42) );
+
+    m_htmllbox->SetCacheSize(1);
+    CPPUNIT_ASSERT_EQUAL( 1u, m_htmllbox->GetCacheSize() );
+    m_htmllbox->Update();
+}
+
 #endif //wxUSE_HTML
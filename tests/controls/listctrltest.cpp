@@ -49,11 +49,13 @@ private:
         WXUISIM_TEST( ColumnDrag );
         CPPUNIT_TEST( SubitemRect );
         CPPUNIT_TEST( ColumnCount );
+        CPPUNIT_TEST( InsertColumnWithItems );
     CPPUNIT_TEST_SUITE_END();
 
     void EditLabel();
     void SubitemRect();
     void ColumnCount();
+    void InsertColumnWithItems();
 #if wxUSE_UIACTIONSIMULATOR
     // Column events are only supported in wxListCtrl currently so we test them
     // here rather than in ListBaseTest
@@ -178,6 +180,46 @@ void ListCtrlTestCase::ColumnCount()
     CHECK(m_list->GetColumnCount() == 0);
 }
 
+void ListCtrlTestCase::InsertColumnWithItems()
+{
+    m_list->InsertColumn(0, "Column 0");
+    m_list->InsertColumn(1, "Column 2");
+    for ( int i = 0; i < 3; i++ )
+    {
+        m_list->InsertItem(i, wxString::Format("Item %d", i));
+        m_list->SetItem(i, 1, wxString::Format("Subitem %d", i));
+        m_list->SetItemData(i, 100 + i);
+    }
+
+    m_list->SetItemTextColour(1, *wxRED);
+
+    // Inserting and deleting a column in the middle must preserve the
+    // contents of the other ones.
+    m_list->InsertColumn(1, "Column 1");
+    CHECK( m_list->GetColumnCount() == 3 );
+    CHECK( m_list->GetItemText(2, 0) == "Item 2" );
+    CHECK( m_list->GetItemText(2, 1) == "" );
+    CHECK( m_list->GetItemText(2, 2) == "Subitem 2" );
+    CHECK( m_list->GetItemData(2) == 102 );
+    CHECK( m_list->GetItemTextColour(1) == *wxRED );
+
+    m_list->DeleteColumn(1);
+    CHECK( m_list->GetColumnCount() == 2 );
+    CHECK( m_list->GetItemText(1, 0) == "Item 1" );
+    CHECK( m_list->GetItemText(1, 1) == "Subitem 1" );
+    CHECK( m_list->GetItemData(1) == 101 );
+    CHECK( m_list->GetItemTextColour(1) == *wxRED );
+
+    // Also check that the items can still be inserted and deleted.
+    m_list->InsertItem(0, "First");
+    CHECK( m_list->GetItemText(0) == "First" );
+    CHECK( m_list->GetItemText(3, 1) == "Subitem 2" );
+
+    m_list->DeleteItem(1);
+    CHECK( m_list->GetItemText(1) == "Item 1" );
+    CHECK( m_list->GetItemData(1) == 101 );
+}
+
 #if wxUSE_UIACTIONSIMULATOR
 void ListCtrlTestCase::ColumnDrag()
 {
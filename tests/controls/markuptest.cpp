@@ -141,18 +141,23 @@ void MarkupTestCase::RoundTrip()
     RoundTripOutput output;
     wxMarkupParser parser(output);
 
-    #define CHECK_PARSES_OK(text) \
-        output.Reset(); \
-        CPPUNIT_ASSERT( parser.Parse(text) ); \
-        CPPUNIT_ASSERT_EQUAL( text, output.GetText() )
+    // Also check that the stored parsing results produce the same output.
+    wxMarkupParsedText parsed;
 
     #define CHECK_PARSES_AS(text, result) \
         output.Reset(); \
         CPPUNIT_ASSERT( parser.Parse(text) ); \
+        CPPUNIT_ASSERT_EQUAL( result, output.GetText() ); \
+        output.Reset(); \
+        CPPUNIT_ASSERT( parsed.Parse(text) ); \
+        parsed.Output(output); \
         CPPUNIT_ASSERT_EQUAL( result, output.GetText() )
 
+    #define CHECK_PARSES_OK(text) CHECK_PARSES_AS(text, text)
+
     #define CHECK_DOESNT_PARSE(text) \
-        CPPUNIT_ASSERT( !parser.Parse(text) )
+        CPPUNIT_ASSERT( !parser.Parse(text) ); \
+        CPPUNIT_ASSERT( !parsed.Parse(text) )
 
     CHECK_PARSES_OK( "" );
     CHECK_PARSES_OK( "foo" );
@@ -183,6 +188,7 @@ void MarkupTestCase::RoundTrip()
     CHECK_DOESNT_PARSE( "<foo></foo>" );
 
     #undef CHECK_PARSES_OK
+    #undef CHECK_PARSES_AS
     #undef CHECK_DOESNT_PARSE
 }
 
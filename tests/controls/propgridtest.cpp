@@ -722,6 +722,81 @@ TEST_CASE("PropertyGridTestCase", "[propgrid]")
         YieldForAWhile(100);
     }
 
+    SECTION("LazyChildren")
+    {
+        wxPropertyGridPage* page = pgManager->GetPage(0);
+
+        int created = 0;
+        wxPropertyCategory* cat = new wxPropertyCategory("Lazy");
+        cat->SetLazyChildren([&created](wxPGProperty* category)
+            {
+                created++;
+                category->AppendChild(new wxIntProperty("LazyInt1"));
+                category->AppendChild(new wxIntProperty("LazyInt2"));
+            });
+        page->Append(cat);
+
+        CHECK( cat->HasLazyChildren() );
+        CHECK( cat->HasVisibleChildren() );
+        CHECK( !cat->IsExpanded() );
+        CHECK( cat->GetChildCount() == 0 );
+        CHECK( created == 0 );
+
+        pgManager->Expand(cat);
+        CHECK( created == 1 );
+        CHECK( !cat->HasLazyChildren() );
+        CHECK( cat->IsExpanded() );
+        CHECK( cat->GetChildCount() == 2 );
+
+        wxPropertyCategory* cat2 = new wxPropertyCategory("Lazy2");
+        cat2->SetLazyChildren([&created](wxPGProperty* category)
+            {
+                created++;
+                category->AppendChild(new wxIntProperty("LazyInt3"));
+            });
+        page->Append(cat2);
+
+        // Looking up an existing property doesn't create anything.
+        CHECK( pgManager->GetPropertyByName("LazyInt1") );
+        CHECK( created == 1 );
+
+        // But looking up a missing one does.
+        wxPGProperty* p = pgManager->GetPropertyByName("LazyInt3");
+        REQUIRE( p );
+        CHECK( p->GetParent() == cat2 );
+        CHECK( created == 2 );
+
+        CHECK( !pgManager->GetPropertyByName("NoSuchLazyInt") );
+        CHECK( created == 2 );
+    }
+
+    SECTION("BeginUpdate")
+    {
+        wxPropertyGrid* pg = pgManager->GetGrid();
+        wxPGProperty* p = pgManager->GetPropertyByName("IntProperty");
+        REQUIRE( p );
+        pgManager->SelectProperty(p);
+
+        CHECK( !pg->IsUpdating() );
+        pg->BeginUpdate();
+        pg->BeginUpdate();
+        CHECK( pg->IsUpdating() );
+
+        for ( int n = 0; n < 100; n++ )
+            pgManager->SetPropertyValue(p, n);
+
+        pg->EndUpdate();
+        CHECK( pg->IsUpdating() );
+        CHECK( p->GetValue().GetLong() == 99 );
+
+        pg->EndUpdate();
+        CHECK( !pg->IsUpdating() );
+        CHECK( pgManager->GetPropertyValueAsInt("IntProperty") == 99 );
+
+        pgManager->Refresh();
+        pgManager->Update();
+    }
+
     SECTION("Default_Values")
     {
         // Test property default values
@@ -17,6 +17,8 @@
 
 #include "wx/richtext/richtextctrl.h"
 #include "wx/richtext/richtextstyles.h"
+#include "wx/richtext/richtextxml.h"
+#include "wx/filename.h"
 #include "testableframe.h"
 #include "asserthelper.h"
 #include "wx/uiaction.h"
@@ -60,6 +62,10 @@ private:
         CPPUNIT_TEST( Delete );
         CPPUNIT_TEST( Url );
         CPPUNIT_TEST( Table );
+        CPPUNIT_TEST( IncrementalLayout );
+        CPPUNIT_TEST( LoadFileAsync );
+        CPPUNIT_TEST( SharedAttributes );
+        CPPUNIT_TEST( TextPieces );
     CPPUNIT_TEST_SUITE_END();
 
     void IsModified();
@@ -91,6 +97,10 @@ private:
     void Delete();
     void Url();
     void Table();
+    void IncrementalLayout();
+    void LoadFileAsync();
+    void SharedAttributes();
+    void TextPieces();
 
     wxRichTextCtrl* m_rich;
 
@@ -878,4 +888,163 @@ void RichTextCtrlTestCase::Table()
     m_rich->SetFocusObject(nullptr);
 }
 
+void RichTextCtrlTestCase::IncrementalLayout()
+{
+    m_rich->SetDelayedLayoutThreshold(100);
+
+    m_rich->Freeze();
+    for ( int n = 0; n < 200; n++ )
+        m_rich->AddParagraph(wxString::Format("paragraph %d", n));
+    m_rich->Thaw();
+    m_rich->LayoutContent();
+
+    wxRichTextBuffer& buffer = m_rich->GetBuffer();
+    CPPUNIT_ASSERT( !buffer.HasDeferredLayout() );
+
+    // Inserting a new paragraph at the top only lays out the visible part
+    // and defers moving the paragraphs below it.
+    m_rich->SetInsertionPoint(0);
+    m_rich->Newline();
+    CPPUNIT_ASSERT( buffer.HasDeferredLayout() );
+    CPPUNIT_ASSERT( buffer.GetDeferredLayoutStart() > 0 );
+
+    // But completing the layout must give the same result as laying out
+    // everything again.
+    m_rich->ForceDelayedLayout();
+    CPPUNIT_ASSERT( !buffer.HasDeferredLayout() );
+
+    wxRichTextObject* const last = buffer.GetChildren().GetLast()->GetData();
+    const int y = last->GetPosition().y;
+
+    buffer.Invalidate(wxRICHTEXT_ALL);
+    m_rich->LayoutContent();
+    CPPUNIT_ASSERT_EQUAL( y, last->GetPosition().y );
+}
+
+void RichTextCtrlTestCase::LoadFileAsync()
+{
+    if ( !wxRichTextBuffer::FindHandler(wxRICHTEXT_TYPE_XML) )
+        wxRichTextBuffer::AddHandler(new wxRichTextXMLHandler);
+
+    m_rich->BeginBold();
+    m_rich->WriteText("bold");
+    m_rich->EndBold();
+    for ( int n = 0; n < 100; n++ )
+        m_rich->AddParagraph(wxString::Format("paragraph %d", n));
+
+    const wxString value = m_rich->GetValue();
+
+    const wxString filename = wxFileName::CreateTempFileName("rtc");
+    CPPUNIT_ASSERT( m_rich->SaveFile(filename, wxRICHTEXT_TYPE_XML) );
+
+    m_rich->Clear();
+
+    EventCounter loaded(m_rich, wxEVT_RICHTEXT_FILE_LOADED);
+    CPPUNIT_ASSERT( m_rich->LoadFileAsync(filename, wxRICHTEXT_TYPE_XML) );
+    CPPUNIT_ASSERT( loaded.WaitEvent() );
+    CPPUNIT_ASSERT( !m_rich->IsLoadingFile() );
+
+    CPPUNIT_ASSERT_EQUAL( value, m_rich->GetValue() );
+
+    m_rich->SetSelection(0, 4);
+    CPPUNIT_ASSERT( m_rich->IsSelectionBold() );
+
+    // Loading the file again and cancelling it by loading it synchronously
+    // must not generate any events.
+    loaded.Clear();
+    CPPUNIT_ASSERT( m_rich->LoadFileAsync(filename, wxRICHTEXT_TYPE_XML) );
+    CPPUNIT_ASSERT( m_rich->LoadFile(filename, wxRICHTEXT_TYPE_XML) );
+    CPPUNIT_ASSERT( !m_rich->IsLoadingFile() );
+    CPPUNIT_ASSERT( !loaded.WaitEvent(100) );
+    CPPUNIT_ASSERT_EQUAL( value, m_rich->GetValue() );
+
+    wxRemoveFile(filename);
+}
+
+void RichTextCtrlTestCase::SharedAttributes()
+{
+    m_rich->AddParagraph("first");
+    m_rich->AddParagraph("second");
+    m_rich->AddParagraph("third");
+
+    // Returns the attributes of the text of the given paragraph: note that
+    // the objects may be replaced by the commands, so don't cache them.
+    const wxRichTextBuffer& buffer = m_rich->GetBuffer();
+    const auto textAttr = [&buffer](long line) -> const wxRichTextAttr*
+    {
+        const wxRichTextParagraph* const para = buffer.GetParagraphAtLine(line);
+        if ( !para || para->GetChildCount() == 0 )
+            return nullptr;
+
+        return &para->GetChild(0)->GetSharedAttributes();
+    };
+
+    CPPUNIT_ASSERT( textAttr(1) );
+    CPPUNIT_ASSERT_EQUAL( textAttr(1), textAttr(2) );
+    CPPUNIT_ASSERT_EQUAL( textAttr(2), textAttr(3) );
+
+    // Make the first and the third paragraphs bold using separate commands,
+    // their attributes should be shared once again after doing it.
+    wxRichTextAttr bold;
+    bold.SetFontWeight(wxFONTWEIGHT_BOLD);
+    m_rich->SetStyle(buffer.GetParagraphAtLine(1)->GetRange(), bold);
+    m_rich->SetStyle(buffer.GetParagraphAtLine(3)->GetRange(), bold);
+
+    CPPUNIT_ASSERT( textAttr(1)->HasFontWeight() );
+    CPPUNIT_ASSERT( !textAttr(2)->HasFontWeight() );
+    CPPUNIT_ASSERT_EQUAL( textAttr(1), textAttr(3) );
+    CPPUNIT_ASSERT( textAttr(1) != textAttr(2) );
+
+    // Undoing the last command should share the attributes with those of the
+    // unmodified paragraph again.
+    m_rich->Undo();
+    CPPUNIT_ASSERT_EQUAL( textAttr(2), textAttr(3) );
+}
+
+void RichTextCtrlTestCase::TextPieces()
+{
+    wxRichTextPlainText text("Hello, wonderful world");
+    long end;
+    text.CalculateRange(0, end);
+    CPPUNIT_ASSERT_EQUAL( 21, end );
+
+    // Split the text in three parts and merge them back.
+    std::unique_ptr<wxRichTextObject> tail(text.DoSplit(7));
+    CPPUNIT_ASSERT( tail );
+    tail->CalculateRange(7, end);
+    std::unique_ptr<wxRichTextObject> last(tail->DoSplit(17));
+    CPPUNIT_ASSERT( last );
+
+    CPPUNIT_ASSERT_EQUAL( "Hello, ", text.GetText() );
+    CPPUNIT_ASSERT_EQUAL( "wonderful ", static_cast<wxRichTextPlainText*>(tail.get())->GetText() );
+    CPPUNIT_ASSERT_EQUAL( "world", static_cast<wxRichTextPlainText*>(last.get())->GetText() );
+
+    wxRichTextDrawingContext context(&m_rich->GetBuffer());
+    CPPUNIT_ASSERT( text.Merge(last.get(), context) );
+    CPPUNIT_ASSERT_EQUAL( 12, (int) text.GetTextLength() );
+    text.CalculateRange(0, end);
+    CPPUNIT_ASSERT_EQUAL( "lo, wo", text.GetTextForRange(wxRichTextRange(3, 8)) );
+    CPPUNIT_ASSERT_EQUAL( "Hello, world", text.GetText() );
+
+    // Copies share the text but must not be affected by changing it.
+    wxRichTextPlainText copy(text);
+    CPPUNIT_ASSERT( text.DeleteRange(wxRichTextRange(5, 6)) );
+    CPPUNIT_ASSERT_EQUAL( "Helloworld", text.GetText() );
+    CPPUNIT_ASSERT_EQUAL( "Hello, world", copy.GetText() );
+
+    // Check that inserting text in the middle of a run and undoing it works.
+    m_rich->WriteText("Hello world");
+    m_rich->SetInsertionPoint(5);
+    m_rich->WriteText(", wonderful");
+    CPPUNIT_ASSERT_EQUAL( "Hello, wonderful world", m_rich->GetValue() );
+
+    m_rich->Remove(0, 7);
+    CPPUNIT_ASSERT_EQUAL( "wonderful world", m_rich->GetValue() );
+
+    m_rich->Undo();
+    CPPUNIT_ASSERT_EQUAL( "Hello, wonderful world", m_rich->GetValue() );
+    m_rich->Undo();
+    CPPUNIT_ASSERT_EQUAL( "Hello world", m_rich->GetValue() );
+}
+
 #endif //wxUSE_RICHTEXT
@@ -19,6 +19,8 @@
 #include "wx/simplebook.h"
 #include "bookctrlbasetest.h"
 
+#include <memory>
+
 class SimplebookTestCase : public BookCtrlBaseTestCase, public CppUnit::TestCase
 {
 public:
@@ -62,5 +64,61 @@ void SimplebookTestCase::tearDown()
     wxDELETE(m_simplebook);
 }
 
+TEST_CASE("wxSimplebook::AddPageLazy", "[wxSimplebook][AddPage]")
+{
+    wxSimplebook* const
+        book = new wxSimplebook(wxTheApp->GetTopWindow(), wxID_ANY,
+                                wxDefaultPosition, wxSize(400, 200));
+    std::unique_ptr<wxSimplebook> cleanup(book);
+
+    int created = 0;
+    const auto factory = [&created](wxWindow* parent) -> wxWindow*
+    {
+        created++;
+        return new wxPanel(parent);
+    };
+
+    REQUIRE( book->AddPageLazy(factory, "First") );
+    REQUIRE( book->AddPageLazy(factory, "Second") );
+    REQUIRE( book->AddPageLazy(factory, "Third") );
+    book->AddPage(new wxPanel(book), "Normal");
+
+    // Only the initially selected page should have been created.
+    CHECK( created == 1 );
+    CHECK( book->IsPageCreated(0) );
+    CHECK( !book->IsPageCreated(1) );
+    CHECK( !book->IsPageCreated(2) );
+    CHECK( book->IsPageCreated(3) );
+
+    book->SetSelection(2);
+    CHECK( created == 2 );
+    CHECK( book->IsPageCreated(2) );
+    CHECK( !book->IsPageCreated(1) );
+
+    // The created window must be inside the page.
+    wxWindow* const page = book->CreatePageIfNeeded(1);
+    REQUIRE( page );
+    CHECK( page->GetParent() == book->GetPage(1) );
+    CHECK( created == 3 );
+
+    // Calling it again shouldn't create anything.
+    CHECK( book->CreatePageIfNeeded(1) == page );
+    CHECK( created == 3 );
+
+    // Destroy all pages except for the current one.
+    CHECK( book->DestroyInactiveLazyPages() == 2 );
+    CHECK( !book->IsPageCreated(0) );
+    CHECK( !book->IsPageCreated(1) );
+    CHECK( book->IsPageCreated(2) );
+    CHECK( book->IsPageCreated(3) );
+
+    CHECK( book->DestroyInactiveLazyPages() == 0 );
+
+    // Selecting a destroyed page must create it again.
+    book->SetSelection(0);
+    CHECK( book->IsPageCreated(0) );
+    CHECK( created == 4 );
+}
+
 #endif // wxUSE_BOOKCTRL
 
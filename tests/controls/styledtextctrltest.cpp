@@ -18,8 +18,80 @@
 #include "wx/stc/stc.h"
 #include "wx/uiaction.h"
 
+#include "testfile.h"
 #include "testwindow.h"
 
+#include "wx/ffile.h"
+
+#include <memory>
+
+namespace
+{
+
+// Create a temporary file with the given contents and load it into the STC.
+bool LoadFileContents(wxStyledTextCtrl& stc, const char* data, size_t len)
+{
+    TempFile tmp(wxFileName::CreateTempFileName("stc"));
+
+    {
+        wxFFile f(tmp.GetName(), "wb");
+        if ( !f.IsOpened() || f.Write(data, len) != len )
+            return false;
+    }
+
+    return stc.LoadFile(tmp.GetName());
+}
+
+} // anonymous namespace
+
+TEST_CASE("wxStyledTextCtrl::LoadFile", "[wxStyledTextCtrl][file]")
+{
+    std::unique_ptr<wxStyledTextCtrl>
+        stc(new wxStyledTextCtrl(wxTheApp->GetTopWindow(), wxID_ANY));
+
+    SECTION("UTF-8")
+    {
+        const char data[] = "\xEF\xBB\xBF" "caf\xC3\xA9\r\n\xE2\x82\xAC";
+        REQUIRE( LoadFileContents(*stc, data, sizeof(data) - 1) );
+        CHECK( stc->GetText() == wxString::FromUTF8("caf\xC3\xA9\r\n\xE2\x82\xAC") );
+        CHECK( stc->GetEOLMode() == wxSTC_EOL_CRLF );
+        CHECK( !stc->IsModified() );
+        CHECK( !stc->CanUndo() );
+    }
+
+    SECTION("Large")
+    {
+        // Use a multibyte character crossing the chunk boundary.
+        std::string data(3*1024*1024, 'x');
+        for ( size_t n = 1024*1024 - 1; n < data.size(); n += 1024*1024 )
+        {
+            data[n] = '\xC3';
+            data[n + 1] = '\xA9';
+        }
+        data[100] = '\n';
+
+        REQUIRE( LoadFileContents(*stc, data.data(), data.size()) );
+        CHECK( stc->GetTextLength() == static_cast<int>(data.size()) );
+        CHECK( std::string(stc->GetTextRaw().data()) == data );
+        CHECK( stc->GetEOLMode() == wxSTC_EOL_LF );
+    }
+
+    SECTION("Latin-1")
+    {
+        // This is not valid UTF-8, so wxConvAuto fallback should be used.
+        const char data[] = "caf\xE9\n";
+        REQUIRE( LoadFileContents(*stc, data, sizeof(data) - 1) );
+        CHECK( stc->GetText() == wxString::FromUTF8("caf\xC3\xA9\n") );
+    }
+
+    SECTION("UTF-16")
+    {
+        const char data[] = "\xFF\xFE" "a\0b\0";
+        REQUIRE( LoadFileContents(*stc, data, sizeof(data) - 1) );
+        CHECK( stc->GetText() == "ab" );
+    }
+}
+
 #if defined(__WXOSX_COCOA__) || defined(__WXMSW__) || defined(__WXGTK__)
 
 class StcPopupWindowsTestCase
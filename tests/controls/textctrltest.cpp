@@ -1499,6 +1499,58 @@ TEST_CASE("wxTextCtrl::InitialCanUndo", "[wxTextCtrl][undo]")
     CHECK( !text->CanUndo() );
 }
 
+TEST_CASE("wxTextCtrl::AppendTextBuffered", "[wxTextCtrl][append]")
+{
+    std::unique_ptr<wxTextCtrl> text(new wxTextCtrl(wxTheApp->GetTopWindow(),
+                                                wxID_ANY, "",
+                                                wxDefaultPosition,
+                                                wxDefaultSize,
+                                                wxTE_MULTILINE));
+
+    text->AppendTextBuffered("foo\n");
+    text->AppendTextBuffered("bar\n");
+    text->FlushBufferedText();
+    CHECK( text->GetValue() == "foo\nbar\n" );
+
+    // Flushing again doesn't do anything.
+    text->FlushBufferedText();
+    CHECK( text->GetValue() == "foo\nbar\n" );
+
+    SECTION("Max lines")
+    {
+        CHECK( text->GetMaxLines() == 0 );
+
+        text->SetMaxLines(3);
+        CHECK( text->GetMaxLines() == 3 );
+
+        for ( int n = 0; n < 5; n++ )
+            text->AppendTextBuffered(wxString::Format("line %d\n", n));
+        text->FlushBufferedText();
+
+        CHECK( text->GetValue() == "line 2\nline 3\nline 4\n" );
+
+        text->SetMaxLines(1);
+        CHECK( text->GetValue() == "line 4\n" );
+    }
+
+    SECTION("Timer")
+    {
+        text->AppendTextBuffered("baz");
+
+        // The text should be appended soon even without flushing.
+        wxStopWatch sw;
+        while ( text->GetValue() != "foo\nbar\nbaz" )
+        {
+            if ( sw.Time() > 1000 )
+                break;
+
+            wxYield();
+        }
+
+        CHECK( text->GetValue() == "foo\nbar\nbaz" );
+    }
+}
+
 // This test would always fail with MinGW-32 for the same reason as described
 // above.
 #ifndef __MINGW32_TOOLCHAIN__
@@ -23,9 +23,12 @@
 #include "wx/artprov.h"
 #include "wx/imaglist.h"
 #include "wx/treectrl.h"
+#include "wx/generic/treectlg.h"
 #include "wx/uiaction.h"
 #include "testableframe.h"
 
+#include <memory>
+
 // ----------------------------------------------------------------------------
 // test class
 // ----------------------------------------------------------------------------
@@ -53,6 +56,7 @@ private:
         CPPUNIT_TEST( Iteration );
         CPPUNIT_TEST( Parent );
         CPPUNIT_TEST( CollapseExpand );
+        CPPUNIT_TEST( CollapseExpandLayout );
         CPPUNIT_TEST( AssignImageList );
         CPPUNIT_TEST( Focus );
         CPPUNIT_TEST( Bold );
@@ -82,6 +86,7 @@ private:
     void Iteration();
     void Parent();
     void CollapseExpand();
+    void CollapseExpandLayout();
     void AssignImageList();
     void Focus();
     void Bold();
@@ -541,6 +546,36 @@ void TreeCtrlTestCase::CollapseExpand()
     CPPUNIT_ASSERT(!m_tree->IsExpanded(m_root));
 }
 
+void TreeCtrlTestCase::CollapseExpandLayout()
+{
+    // Let the control lay out its items completely first.
+    wxYield();
+
+    // Check that the items below the collapsed or expanded one are moved.
+    const auto checkBelow = [this](const wxTreeItemId& above,
+                                   const wxTreeItemId& below)
+    {
+        wxRect rectAbove, rectBelow;
+        CPPUNIT_ASSERT( m_tree->GetBoundingRect(above, rectAbove) );
+        CPPUNIT_ASSERT( m_tree->GetBoundingRect(below, rectBelow) );
+        CPPUNIT_ASSERT_EQUAL( rectAbove.GetBottom() + 1, rectBelow.y );
+
+        int flags = 0;
+        const wxPoint pos(rectBelow.x + rectBelow.width / 2,
+                          rectBelow.y + rectBelow.height / 2);
+        CPPUNIT_ASSERT_EQUAL( below, m_tree->HitTest(pos, flags) );
+    };
+
+    checkBelow(m_grandchild, m_child2);
+
+    m_tree->Collapse(m_child1);
+    checkBelow(m_child1, m_child2);
+
+    m_tree->Expand(m_child1);
+    checkBelow(m_child1, m_grandchild);
+    checkBelow(m_grandchild, m_child2);
+}
+
 void TreeCtrlTestCase::AssignImageList()
 {
     wxSize size(16, 16);
@@ -667,4 +702,64 @@ void TreeCtrlTestCase::KeyNavigation()
 #endif
 }
 
+namespace
+{
+
+// Tree in which every item has as many children as the length of its label,
+// with the labels of the children being formed by removing the last
+// character of the parent label.
+class VirtualTreeCtrl : public wxGenericTreeCtrl
+{
+public:
+    explicit VirtualTreeCtrl(wxWindow* parent)
+        : wxGenericTreeCtrl(parent)
+    {
+    }
+
+protected:
+    int OnGetItemChildrenCount(const wxTreeItemId& item) const override
+    {
+        return GetItemText(item).length();
+    }
+
+    wxString OnGetItemText(const wxTreeItemId& parent,
+                           size_t WXUNUSED(index)) const override
+    {
+        return GetItemText(parent).substr(1);
+    }
+};
+
+} // anonymous namespace
+
+TEST_CASE("wxGenericTreeCtrl::VirtualChildren", "[treectrl]")
+{
+    std::unique_ptr<VirtualTreeCtrl>
+        tree(new VirtualTreeCtrl(wxTheApp->GetTopWindow()));
+
+    const wxTreeItemId root = tree->AddRoot("abc");
+    CHECK( tree->ItemHasChildren(root) );
+    CHECK( tree->GetChildrenCount(root) == 0 );
+
+    tree->Expand(root);
+    REQUIRE( tree->GetChildrenCount(root, false) == 3 );
+    CHECK( tree->GetChildrenCount(root) == 3 );
+
+    wxTreeItemIdValue cookie;
+    const wxTreeItemId child = tree->GetFirstChild(root, cookie);
+    CHECK( tree->GetItemText(child) == "bc" );
+    CHECK( tree->ItemHasChildren(child) );
+
+    tree->Expand(child);
+    CHECK( tree->GetChildrenCount(root) == 5 );
+
+    // The children should be deleted when their parent is collapsed.
+    tree->Collapse(root);
+    CHECK( tree->GetChildrenCount(root) == 0 );
+    CHECK( tree->ItemHasChildren(root) );
+
+    // And created again when it is expanded.
+    tree->Expand(root);
+    CHECK( tree->GetChildrenCount(root) == 3 );
+}
+
 #endif //wxUSE_TREECTRL
@@ -36,6 +36,7 @@ private:
         CPPUNIT_TEST( Traversal );
         CPPUNIT_TEST( ItemText );
         CPPUNIT_TEST( ItemCheck );
+        CPPUNIT_TEST( BulkInsert );
     CPPUNIT_TEST_SUITE_END();
 
     // Create the control with the given style.
@@ -52,6 +53,7 @@ private:
     void Traversal();
     void ItemText();
     void ItemCheck();
+    void BulkInsert();
 
 
     // The control itself.
@@ -228,4 +230,46 @@ void TreeListCtrlTestCase::ItemCheck()
                           m_treelist->GetCheckedState(m_code) );
 }
 
+// Test adding many items at once.
+void TreeListCtrlTestCase::BulkInsert()
+{
+    m_treelist->BeginBulkInsert();
+
+    wxTreeListItem last;
+    for ( int n = 0; n < 100; n++ )
+        last = AddItem("Bulk", m_code_osx_cocoa);
+
+    // Check that appending after deleting the last item works too.
+    m_treelist->DeleteItem(last);
+    m_numItems--;
+    last = AddItem("Last", m_code_osx_cocoa);
+
+    wxTreeListItem child = AddItem("Child", last);
+
+    // Nested calls shouldn't update the control yet.
+    m_treelist->BeginBulkInsert();
+    AddItem("Samples");
+    m_treelist->EndBulkInsert();
+
+    m_treelist->EndBulkInsert();
+
+    unsigned numItems = 0;
+    for ( wxTreeListItem item = m_treelist->GetFirstItem();
+          item.IsOk();
+          item = m_treelist->GetNextItem(item) )
+    {
+        numItems++;
+    }
+
+    CPPUNIT_ASSERT_EQUAL( m_numItems, numItems );
+    CPPUNIT_ASSERT_EQUAL( last, m_treelist->GetItemParent(child) );
+    CPPUNIT_ASSERT( !m_treelist->GetNextSibling(last) );
+    CPPUNIT_ASSERT_EQUAL( "Last", m_treelist->GetItemText(last) );
+
+    // The new items can be used normally after the end of bulk insertion.
+    m_treelist->Expand(last);
+    m_treelist->Select(child);
+    CPPUNIT_ASSERT( m_treelist->IsSelected(child) );
+}
+
 #endif // wxUSE_TREELISTCTRL
@@ -23,6 +23,8 @@
 #include "testableframe.h"
 #include "wx/uiaction.h"
 
+#include <memory>
+
 // ----------------------------------------------------------------------------
 // test class
 // ----------------------------------------------------------------------------
@@ -39,10 +41,12 @@ private:
     CPPUNIT_TEST_SUITE( VirtListCtrlTestCase );
         CPPUNIT_TEST( UpdateSelection );
         WXUISIM_TEST( DeselectedEvent );
+        WXUISIM_TEST( FindByPrefix );
     CPPUNIT_TEST_SUITE_END();
 
     void UpdateSelection();
     void DeselectedEvent();
+    void FindByPrefix();
 
     wxListCtrl *m_list;
 
@@ -149,4 +153,57 @@ void VirtListCtrlTestCase::DeselectedEvent()
 #endif
 }
 
+void VirtListCtrlTestCase::FindByPrefix()
+{
+#if wxUSE_UIACTIONSIMULATOR
+    // Control finding the items itself, without using their text.
+    class FindListCtrl : public wxListCtrl
+    {
+    public:
+        FindListCtrl()
+            : wxListCtrl(wxTheApp->GetTopWindow(), wxID_ANY,
+                         wxPoint(0, 0), wxSize(400, 200),
+                         wxLC_REPORT | wxLC_VIRTUAL)
+        {
+        }
+
+        mutable wxString m_prefix;
+
+    protected:
+        virtual wxString OnGetItemText(long item, long column) const override
+        {
+            return wxString::Format("Row %ld, col %ld", item, column);
+        }
+
+        virtual bool OnFindItemByPrefix(long WXUNUSED(start),
+                                        const wxString& prefix,
+                                        long& item) const override
+        {
+            m_prefix = prefix;
+            item = prefix.IsSameAs('x', false) ? 7 : -1;
+            return true;
+        }
+    };
+
+    // Hide the default control to avoid interfering with this one.
+    m_list->Hide();
+
+    std::unique_ptr<FindListCtrl> list(new FindListCtrl);
+    list->AppendColumn("Col0");
+    list->SetItemCount(10);
+    list->SetItemState(0, wxLIST_STATE_FOCUSED | wxLIST_STATE_SELECTED,
+                       wxLIST_STATE_FOCUSED | wxLIST_STATE_SELECTED);
+    list->SetFocus();
+    wxYield();
+
+    wxUIActionSimulator sim;
+    sim.Char('x');
+    wxYield();
+
+    CPPUNIT_ASSERT( list->m_prefix.IsSameAs('x', false) );
+    CPPUNIT_ASSERT_EQUAL( 7, list->GetNextItem(-1, wxLIST_NEXT_ALL,
+                                               wxLIST_STATE_SELECTED) );
+#endif
+}
+
 #endif // wxUSE_LISTCTRL
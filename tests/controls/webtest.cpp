@@ -17,6 +17,7 @@
 
 #include "testableframe.h"
 #include "wx/webview.h"
+#include "wx/mstream.h"
 #include "asserthelper.h"
 #if wxUSE_WEBVIEW_IE
     #include "wx/msw/webview_ie.h"
@@ -444,4 +445,39 @@ TEST_CASE_METHOD(WebViewTestCase, "WebView", "[wxWebView]")
     }
 }
 
+TEST_CASE("WebView::ResponseDataStream", "[wxWebView]")
+{
+    static const char data[] = "Hello, streaming world!";
+
+    SECTION("Known length")
+    {
+        wxWebViewHandlerResponseDataStream
+            response(new wxMemoryInputStream(data, sizeof(data) - 1));
+        CHECK( response.GetContentLength() == wxFileOffset(sizeof(data) - 1) );
+    }
+
+    SECTION("Explicit length")
+    {
+        wxWebViewHandlerResponseDataStream
+            response(new wxMemoryInputStream(data, sizeof(data) - 1), 5);
+        CHECK( response.GetContentLength() == 5 );
+    }
+
+    SECTION("Read in chunks")
+    {
+        wxWebViewHandlerResponseDataStream
+            response(new wxMemoryInputStream(data, sizeof(data) - 1));
+
+        wxInputStream* const stream = response.GetStream();
+        REQUIRE( stream );
+
+        wxString result;
+        char buf[4];
+        while ( stream->Read(buf, sizeof(buf)).LastRead() )
+            result += wxString::FromUTF8(buf, stream->LastRead());
+
+        CHECK( result == data );
+    }
+}
+
 #endif //wxUSE_WEBVIEW && (wxUSE_WEBVIEW_WEBKIT || wxUSE_WEBVIEW_WEBKIT2 || wxUSE_WEBVIEW_IE)
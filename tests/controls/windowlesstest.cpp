@@ -0,0 +1,177 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        tests/controls/windowlesstest.cpp
+// Purpose:     wxWindowlessPanel and windowless controls unit tests
+// Author:      wxWidgets team
+// Created:     2026-10-15
+// Copyright:   (c) 2026 wxWidgets team
+///////////////////////////////////////////////////////////////////////////////
+
+#include "testprec.h"
+
+
+#ifndef WX_PRECOMP
+    #include "wx/app.h"
+    #include "wx/sizer.h"
+#endif // WX_PRECOMP
+
+#include "wx/windowless.h"
+
+#include "asserthelper.h"
+
+#include <memory>
+
+namespace
+{
+
+// Send a mouse event of the given type to the panel at the given position.
+void SendMouse(wxWindowlessPanel* panel, wxEventType type, const wxPoint& pos)
+{
+    wxMouseEvent event(type);
+    event.SetEventObject(panel);
+    event.SetPosition(pos);
+    panel->HandleWindowEvent(event);
+}
+
+} // anonymous namespace
+
+class WindowlessTestCase
+{
+public:
+    WindowlessTestCase()
+        : m_panel(new wxWindowlessPanel(wxTheApp->GetTopWindow()))
+    {
+    }
+
+    ~WindowlessTestCase()
+    {
+        delete m_panel;
+    }
+
+protected:
+    wxWindowlessPanel* const m_panel;
+
+    wxDECLARE_NO_COPY_CLASS(WindowlessTestCase);
+};
+
+TEST_CASE_METHOD(WindowlessTestCase, "Windowless::Controls", "[windowless]")
+{
+    wxWindowlessStaticText* const
+        text = new wxWindowlessStaticText(m_panel, wxID_ANY, "&Hello",
+                                          wxPoint(10, 10));
+    wxWindowlessStaticBitmap* const
+        bitmap = new wxWindowlessStaticBitmap(m_panel, wxID_ANY,
+                                              wxBitmap(16, 16),
+                                              wxPoint(100, 10));
+
+    CHECK( m_panel->GetControlsCount() == 2 );
+    CHECK( m_panel->GetControl(0) == text );
+    CHECK( text->GetId() != bitmap->GetId() );
+
+    // Mnemonic is not shown, so it shouldn't affect the size.
+    CHECK( text->GetLabel() == "&Hello" );
+    CHECK( text->GetSize() == m_panel->GetTextExtent("Hello") );
+    CHECK( text->GetPosition() == wxPoint(10, 10) );
+
+    CHECK( bitmap->GetSize() == wxSize(16, 16) );
+
+    const wxSize sizeOld = text->GetSize();
+    text->SetLabel("Hello, windowless world");
+    CHECK( text->GetSize().x > sizeOld.x );
+
+    CHECK( m_panel->HitTestControl(wxPoint(12, 12)) == text );
+    CHECK( m_panel->HitTestControl(wxPoint(105, 15)) == bitmap );
+    CHECK( m_panel->HitTestControl(wxPoint(105, 30)) == nullptr );
+
+    bitmap->Hide();
+    CHECK( m_panel->HitTestControl(wxPoint(105, 15)) == nullptr );
+
+    delete text;
+    CHECK( m_panel->GetControlsCount() == 1 );
+    CHECK( m_panel->HitTestControl(wxPoint(12, 12)) == nullptr );
+
+    m_panel->DestroyControls();
+    CHECK( m_panel->GetControlsCount() == 0 );
+}
+
+TEST_CASE_METHOD(WindowlessTestCase, "Windowless::Sizer", "[windowless]")
+{
+    wxBoxSizer* const sizer = new wxBoxSizer(wxVERTICAL);
+
+    wxWindowlessStaticBitmap* const
+        bitmap1 = new wxWindowlessStaticBitmap(m_panel, wxID_ANY,
+                                               wxBitmap(16, 16));
+    wxWindowlessStaticBitmap* const
+        bitmap2 = new wxWindowlessStaticBitmap(m_panel, wxID_ANY,
+                                               wxBitmap(32, 32));
+
+    bitmap1->AddToSizer(sizer, wxSizerFlags().Border(wxALL, 5));
+    bitmap2->AddToSizer(sizer, wxSizerFlags().Expand());
+
+    m_panel->SetSizer(sizer);
+    m_panel->SetSize(200, 200);
+    m_panel->Layout();
+
+    CHECK( sizer->GetMinSize() == wxSize(32, 58) );
+    CHECK( bitmap1->GetRect() == wxRect(5, 5, 16, 16) );
+    CHECK( bitmap2->GetRect() == wxRect(0, 26, 200, 32) );
+
+    // Hidden controls don't take space in the sizer.
+    bitmap1->Hide();
+    m_panel->Layout();
+    CHECK( bitmap2->GetPosition() == wxPoint(0, 0) );
+
+    // And the sizer item of the deleted control is just empty.
+    delete bitmap1;
+    m_panel->Layout();
+    CHECK( sizer->GetMinSize() == wxSize(32, 32) );
+}
+
+TEST_CASE_METHOD(WindowlessTestCase, "Windowless::Mouse", "[windowless]")
+{
+    wxWindowlessStaticText* const
+        text = new wxWindowlessStaticText(m_panel, wxID_ANY, "Click me",
+                                          wxPoint(20, 20), wxSize(50, 20));
+
+    int enter = 0,
+        leave = 0,
+        clicks = 0;
+    wxPoint posClick;
+    text->Bind(wxEVT_ENTER_WINDOW, [&](wxMouseEvent&) { enter++; });
+    text->Bind(wxEVT_LEAVE_WINDOW, [&](wxMouseEvent&) { leave++; });
+    text->Bind(wxEVT_LEFT_DOWN, [&](wxMouseEvent& event)
+        {
+            clicks++;
+            posClick = event.GetPosition();
+            CHECK( event.GetEventObject() == text );
+            CHECK( event.GetId() == text->GetId() );
+        });
+
+    int clicksPanel = 0;
+    m_panel->Bind(wxEVT_LEFT_DOWN, [&](wxMouseEvent&) { clicksPanel++; });
+
+    SendMouse(m_panel, wxEVT_MOTION, wxPoint(25, 25));
+    CHECK( enter == 1 );
+
+    SendMouse(m_panel, wxEVT_LEFT_DOWN, wxPoint(30, 25));
+    SendMouse(m_panel, wxEVT_LEFT_UP, wxPoint(30, 25));
+    CHECK( clicks == 1 );
+    CHECK( posClick == wxPoint(10, 5) );
+
+    // The event was processed by the control, so the panel didn't get it.
+    CHECK( clicksPanel == 0 );
+
+    SendMouse(m_panel, wxEVT_MOTION, wxPoint(5, 5));
+    CHECK( leave == 1 );
+
+    SendMouse(m_panel, wxEVT_LEFT_DOWN, wxPoint(5, 5));
+    SendMouse(m_panel, wxEVT_LEFT_UP, wxPoint(5, 5));
+    CHECK( clicks == 1 );
+    CHECK( clicksPanel == 1 );
+
+    // Disabled controls don't get mouse events.
+    text->Disable();
+    SendMouse(m_panel, wxEVT_LEFT_DOWN, wxPoint(30, 25));
+    SendMouse(m_panel, wxEVT_LEFT_UP, wxPoint(30, 25));
+    CHECK( clicks == 1 );
+    CHECK( clicksPanel == 2 );
+}
@@ -25,6 +25,7 @@
 #include "wx/caret.h"
 #include "wx/cshelp.h"
 #include "wx/dcclient.h"
+#include "wx/paintprofiler.h"
 #include "wx/tooltip.h"
 #include "wx/wupdlock.h"
 
@@ -518,3 +519,184 @@ TEST_CASE_METHOD(WindowTestCase, "Window::Refresh", "[window]")
     CHECK(isChild2Painted == true);
     CHECK(isChild3Painted == true);
 }
+
+TEST_CASE_METHOD(WindowTestCase, "Window::RequestFrame", "[window]")
+{
+    std::vector<int> calls;
+    wxLongLong frameTime1,
+               frameTime2;
+
+    m_window->RequestFrame([&](wxLongLong frameTime)
+        {
+            calls.push_back(1);
+            frameTime1 = frameTime;
+
+            // Requesting another frame from the callback must not result in
+            // it being called during the same frame.
+            m_window->RequestFrame([&](wxLongLong frameTime)
+                {
+                    calls.push_back(3);
+                    frameTime2 = frameTime;
+                });
+        });
+    m_window->RequestFrame([&](wxLongLong) { calls.push_back(2); });
+
+    CHECK( m_window->HasPendingFrameCallbacks() );
+    CHECK( calls.empty() );
+
+    if ( !WaitFor("frame", [&]() { return calls.size() == 3; }, 1000) )
+    {
+        WARN("Frame callbacks were not called, skipping test.");
+        return;
+    }
+
+    CHECK( calls == std::vector<int>{1, 2, 3} );
+    CHECK( frameTime2 > frameTime1 );
+    CHECK( !m_window->HasPendingFrameCallbacks() );
+
+    // Callbacks must not be called for a destroyed window.
+    bool called = false;
+    wxWindow* const win = new wxWindow(wxTheApp->GetTopWindow(), wxID_ANY);
+    win->RequestFrame([&](wxLongLong) { called = true; });
+    delete win;
+
+    WaitFor("frame", [&]() { return called; }, 100);
+    CHECK( !called );
+}
+
+TEST_CASE_METHOD(WindowTestCase, "Window::IdleRegistered", "[window][idle]")
+{
+    wxWindow* const child1 = new wxWindow(m_window, wxID_ANY);
+    wxWindow* const child2 = new wxWindow(m_window, wxID_ANY);
+    wxWindow* const grandchild = new wxWindow(child1, wxID_ANY);
+
+    int idle = 0;
+    child1->Bind(wxEVT_IDLE, [&](wxIdleEvent&) { idle++; });
+
+    CHECK( child1->WXIsRegisteredForIdle() );
+    CHECK( !child2->WXIsRegisteredForIdle() );
+    CHECK( !grandchild->WXIsRegisteredForIdle() );
+
+    child2->SetExtraStyle(wxWS_EX_PROCESS_IDLE);
+    CHECK( child2->WXIsRegisteredForIdle() );
+
+    wxIdleEvent::SetMode(wxIDLE_PROCESS_REGISTERED);
+    wxTheApp->ProcessIdle();
+    wxIdleEvent::SetMode(wxIDLE_PROCESS_ALL);
+
+    CHECK( idle == 1 );
+
+    // The top level window could have been registered for UI updates by the
+    // other tests, so only check that the children are not registered if it
+    // isn't.
+    if ( !m_window->WXIsRegisteredForUpdateUI() )
+    {
+        CHECK( !child1->WXIsRegisteredForUpdateUI() );
+        CHECK( !grandchild->WXIsRegisteredForUpdateUI() );
+    }
+
+    child1->Bind(wxEVT_UPDATE_UI, [](wxUpdateUIEvent&) { });
+    CHECK( child1->WXIsRegisteredForUpdateUI() );
+
+    // UI update events propagate to the parent, so the children of the
+    // window handling them must be registered too.
+    CHECK( grandchild->WXIsRegisteredForUpdateUI() );
+
+    child2->SetExtraStyle(wxWS_EX_PROCESS_UI_UPDATES);
+    CHECK( child2->WXIsRegisteredForUpdateUI() );
+}
+
+TEST_CASE_METHOD(WindowTestCase, "Window::UpdateUIDependency", "[window][updateui]")
+{
+    wxUpdateUIDependency dep;
+    bool enable = true;
+    int calls = 0;
+
+    m_window->Bind(wxEVT_UPDATE_UI, [&](wxUpdateUIEvent& event)
+        {
+            calls++;
+            event.DependsOn(dep);
+            event.Enable(enable);
+        });
+
+    m_window->UpdateWindowUI();
+    CHECK( calls == 1 );
+    CHECK( m_window->IsEnabled() );
+
+    // Nothing changed, so the handler shouldn't be called again.
+    m_window->UpdateWindowUI();
+    CHECK( calls == 1 );
+
+    enable = false;
+    dep.MarkChanged();
+    m_window->UpdateWindowUI();
+    CHECK( calls == 2 );
+    CHECK( !m_window->IsEnabled() );
+
+    m_window->UpdateWindowUI();
+    CHECK( calls == 2 );
+}
+
+TEST_CASE_METHOD(WindowTestCase, "Window::PaintProfiler", "[window][paint]")
+{
+    bool painted = false;
+    m_window->Bind(wxEVT_PAINT, [&](wxPaintEvent&)
+        {
+            wxPaintDC dc(m_window);
+            dc.DrawLine(0, 0, 10, 10);
+            dc.DrawRectangle(0, 0, 10, 10);
+            dc.DrawText("Hello", 0, 0);
+
+            painted = true;
+        });
+
+    m_window->SetSize(100, 100);
+
+    // Ensure the window is mapped before starting the profiler.
+    YieldForAWhile();
+
+    wxPaintProfiler::Start();
+
+    painted = false;
+    m_window->Refresh();
+    m_window->Update();
+    WaitFor("window repaint", [&]() { return painted; });
+
+    wxPaintProfiler::Stop();
+
+    if ( !painted )
+    {
+        WARN("Skipping test as the window wasn't repainted.");
+        return;
+    }
+
+    wxPaintProfiler::WindowStats stats;
+    REQUIRE( wxPaintProfiler::GetWindowStats(m_window, &stats) );
+    CHECK( stats.window == m_window );
+    CHECK( stats.className == "wxWindow" );
+    CHECK( stats.paintCount >= 1 );
+    CHECK( stats.primitiveCount == 3*stats.paintCount );
+    CHECK( stats.updateArea > 0 );
+    CHECK( stats.windowArea > 0 );
+
+    // The statistics of the destroyed windows are still available.
+    delete m_window;
+
+    const std::vector<wxPaintProfiler::WindowStats> all =
+        wxPaintProfiler::GetWindowStats();
+    REQUIRE( !all.empty() );
+
+    bool found = false;
+    for ( const auto& s : all )
+    {
+        if ( s.className == "wxWindow" && s.paintCount == stats.paintCount )
+        {
+            CHECK( s.window == nullptr );
+            found = true;
+        }
+    }
+    CHECK( found );
+
+    wxPaintProfiler::Reset();
+    CHECK( wxPaintProfiler::GetWindowStats().empty() );
+}
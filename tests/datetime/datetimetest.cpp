@@ -882,6 +882,74 @@ TEST_CASE("wxDateTime::ParseFormat", "[datetime]")
     }
 }
 
+TEST_CASE("wxDateTimeFormatter", "[datetime]")
+{
+    const wxDateTime dt(5, wxDateTime::Mar, 2024, 7, 8, 9, 42);
+
+    SECTION("Format")
+    {
+        // The results must be exactly the same as those of Format().
+        const char* const formats[] =
+        {
+            "%Y-%m-%d %H:%M:%S.%l",
+            "%F %I %j %w %y %%",
+            "%d %B %Y, %A",
+            "%x %X %p",
+            "no fields at all",
+        };
+
+        for ( const char* format : formats )
+        {
+            INFO("Format: " << format);
+
+            const wxDateTimeFormatter fmt(format);
+            CHECK( fmt.Format(dt) == dt.Format(format) );
+            CHECK( fmt.Format(dt, wxDateTime::UTC) ==
+                    dt.Format(format, wxDateTime::UTC) );
+        }
+
+        const wxDateTimeFormatter fmt("%H:%M");
+        wxString s("at ");
+        fmt.FormatTo(s, dt);
+        CHECK( s == "at 07:08" );
+    }
+
+    SECTION("Parse")
+    {
+        const wxDateTimeFormatter fmt("%Y-%m-%dT%H:%M:%S.%l");
+
+        wxDateTime dtParsed;
+        REQUIRE( fmt.Parse("2024-03-05T07:08:09.042", &dtParsed) );
+        CHECK( dtParsed == dt );
+
+        CHECK_FALSE( fmt.Parse("2024-03-05", &dtParsed) );
+        CHECK_FALSE( fmt.Parse("2024-02-30T07:08:09.042", &dtParsed) );
+
+        wxString::const_iterator end;
+        const wxString s("2024-03-05T07:08:09.042 rest");
+        REQUIRE( fmt.Parse(s, &dtParsed, &end) );
+        CHECK( wxString(end, s.end()) == " rest" );
+
+        // Partially specified dates use the default date.
+        const wxDateTimeFormatter fmtTime("%T");
+        REQUIRE( fmtTime.Parse("12:34:56", &dtParsed, dt) );
+        CHECK( dtParsed == wxDateTime(5, wxDateTime::Mar, 2024, 12, 34, 56) );
+
+        // Time zone and 12 hour format must be handled as by ParseFormat().
+        const wxDateTimeFormatter fmtTZ("%Y%m%d %I %z");
+        REQUIRE( fmtTZ.Parse("20240305 12 +0100", &dtParsed) );
+
+        wxDateTime dtRef;
+        REQUIRE( dtRef.ParseFormat("20240305 12 +0100", "%Y%m%d %I %z", &end) );
+        CHECK( dtParsed == dtRef );
+
+        // Locale-dependent formats are supported too.
+        const wxDateTimeFormatter fmtNames("%d %B %Y");
+        REQUIRE( fmtNames.Parse(dt.Format("%d %B %Y"), &dtParsed) );
+        CHECK( dtParsed.IsSameDate(dt) );
+    }
+}
+
 // Test parsing time in free format.
 TEST_CASE("wxDateTime::TimeParse", "[datetime]")
 {
@@ -1812,6 +1880,48 @@ TEST_CASE("wxDateTime::DSTBug", "[datetime]")
         CHECK( dtDST.GetHour() == 3 );
 }
 
+// Check that the cached local time offsets give the same results as the
+// standard library functions.
+TEST_CASE("wxDateTime::LocalTimeCache", "[datetime]")
+{
+    // Check every 7 hours and 13 minutes during several years, which must
+    // include all the DST transitions if the local time zone uses DST.
+    const time_t start = wxDateTime(1, wxDateTime::Jan, 2019).GetTicks();
+    const time_t step = 7*3600 + 13*60;
+    for ( time_t t = start; t < start + 4*366*24*3600; t += step )
+    {
+        struct tm tmstruct;
+        const struct tm* const tm = wxLocaltime_r(&t, &tmstruct);
+        REQUIRE( tm );
+
+        INFO("Time: " << static_cast<wxLongLong_t>(t));
+
+        const wxDateTime dt(t);
+        const wxDateTime::Tm tm2 = dt.GetTm();
+        CHECK( tm2.year == tm->tm_year + 1900 );
+        CHECK( tm2.mon == tm->tm_mon );
+        CHECK( tm2.mday == tm->tm_mday );
+        CHECK( tm2.hour == tm->tm_hour );
+        CHECK( tm2.min == tm->tm_min );
+        CHECK( tm2.sec == tm->tm_sec );
+        CHECK( dt.GetWeekDay() == tm->tm_wday );
+        CHECK( dt.IsDST() == tm->tm_isdst );
+
+        // Converting back must give the same time unless it's ambiguous, i.e.
+        // happens twice because of the DST end, in which case it's enough to
+        // check that we get the same local time.
+        const wxDateTime dt2(tm2.mday, tm2.mon, tm2.year,
+                             tm2.hour, tm2.min, tm2.sec);
+        if ( dt2 != dt )
+            CHECK( dt2.Format("%F %T") == dt.Format("%F %T") );
+
+        // Also check the conversions to a fixed offset.
+        const wxDateTime::TimeZone tz(wxDateTime::GMT5);
+        const wxDateTime::Tm tmTZ = dt.GetTm(tz);
+        CHECK( tmTZ.hour == (dt.GetTm(wxDateTime::UTC).hour + 5) % 24 );
+    }
+}
+
 TEST_CASE("wxDateTime::DateOnly", "[datetime]")
 {
     wxDateTime dt(19, wxDateTime::Jan, 2007, 15, 01, 00);
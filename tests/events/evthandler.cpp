@@ -13,7 +13,11 @@
 #include "testprec.h"
 
 
+#include "wx/app.h"
 #include "wx/event.h"
+#include "wx/evtprofiler.h"
+
+#include <algorithm>
 
 // ----------------------------------------------------------------------------
 // test events and their handlers
@@ -510,6 +514,291 @@ TEST_CASE("Event::UnbindFromHandler", "[event][bind][unbind]")
     handler.ProcessEvent(e);
 }
 
+TEST_CASE("Event::QueueEventCoalesced", "[event][queue]")
+{
+    wxEvtHandler handler;
+
+    wxString log;
+    handler.Bind(wxEVT_THREAD, [&log](wxThreadEvent& event)
+        {
+            log << event.GetInt() << ' ';
+        });
+
+    const auto queue = [&handler](int value, int key = -1)
+    {
+        wxThreadEvent* const event = new wxThreadEvent();
+        event->SetInt(value);
+        if ( key == -1 )
+            handler.QueueEvent(event);
+        else
+            handler.QueueEventCoalesced(event, key);
+    };
+
+    queue(1);
+    queue(10, 1);
+    queue(2);
+    queue(20, 2);
+    queue(11, 1);
+    queue(21, 2);
+    queue(3);
+    queue(12, 1);
+
+    int called = 0;
+    for ( int n = 1; n <= 3; n++ )
+        handler.CallAfterCoalesced(100, [&called, n]() { called = n; });
+
+    wxTheApp->ProcessPendingEvents();
+
+    // The coalesced events replace the earlier ones with the same key in the
+    // queue, while the other events are all processed in order.
+    CHECK( log == "1 12 2 21 3 " );
+    CHECK( called == 3 );
+
+    // Once the event was processed, a new one with the same key is queued.
+    log.clear();
+    queue(13, 1);
+    wxTheApp->ProcessPendingEvents();
+    CHECK( log == "13 " );
+}
+
+TEST_CASE("Event::BindMany", "[event][bind]")
+{
+    // Bind enough handlers to ensure that they get indexed by event type.
+    wxEvtHandler handler;
+
+    typedef wxEventTypeTag<wxThreadEvent> EventTag;
+    const EventTag types[] =
+    {
+        EventTag(wxNewEventType()),
+        EventTag(wxNewEventType()),
+        EventTag(wxNewEventType()),
+        EventTag(wxNewEventType())
+    };
+
+    wxString log;
+    const auto bind = [&](const EventTag& type, int n, int id = wxID_ANY)
+    {
+        const auto func = [&log, n](wxThreadEvent& event)
+            {
+                log << n << ' ';
+                event.Skip();
+            };
+        handler.Bind(type, func, id);
+    };
+
+    for ( int n = 0; n < 20; n++ )
+        bind(types[n % 3], n);
+
+    const auto send = [&](const EventTag& type, int id = 0)
+    {
+        log.clear();
+        wxThreadEvent event(type, id);
+        handler.ProcessEvent(event);
+        return log;
+    };
+
+    // Handlers bound later are called first.
+    CHECK( send(types[0]) == "18 15 12 9 6 3 0 " );
+    CHECK( send(types[1]) == "19 16 13 10 7 4 1 " );
+    CHECK( send(types[3]) == "" );
+
+    bind(types[3], 100, 17);
+    CHECK( send(types[3]) == "" );
+    CHECK( send(types[3], 17) == "100 " );
+
+    int called = 0;
+    const auto counter = [&called](wxThreadEvent& event)
+        {
+            called++;
+            event.Skip();
+        };
+    handler.Bind(types[2], counter);
+    CHECK( send(types[2]) == "17 14 11 8 5 2 " );
+    CHECK( called == 1 );
+
+    CHECK( handler.Unbind(types[2], counter) );
+    CHECK( send(types[2]) == "17 14 11 8 5 2 " );
+    CHECK( called == 1 );
+
+    CHECK( !handler.Unbind(types[2], counter) );
+}
+
+TEST_CASE("Event::UnbindDuringDispatch", "[event][bind][unbind]")
+{
+    // Check both with a few handlers and enough of them for indexing them.
+    const int numOtherHandlers = GENERATE(0, 20);
+    INFO("Other handlers: " << numOtherHandlers);
+
+    wxEvtHandler handler;
+    for ( int n = 0; n < numOtherHandlers; n++ )
+        handler.Bind(wxEVT_IDLE, [](wxIdleEvent&) { });
+
+    wxString log;
+    const auto h0 = [&log](wxThreadEvent& event) { log << "0 "; event.Skip(); };
+    const auto h1 = [&log](wxThreadEvent& event) { log << "1 "; event.Skip(); };
+    const auto h3 = [&log](wxThreadEvent& event) { log << "3 "; event.Skip(); };
+
+    bool nested = false;
+    const auto h2 = [&](wxThreadEvent& event)
+        {
+            log << "2 ";
+            event.Skip();
+
+            if ( nested )
+                return;
+
+            // Unbind a handler which wasn't called yet and process another
+            // event which is not handled, this must not result in calling any
+            // handler twice in the outer event dispatch.
+            nested = true;
+            handler.Unbind(wxEVT_THREAD, h0);
+
+            wxThreadEvent eventNested;
+            handler.ProcessEvent(eventNested);
+        };
+
+    handler.Bind(wxEVT_THREAD, h0);
+    handler.Bind(wxEVT_THREAD, h1);
+    handler.Bind(wxEVT_THREAD, h2);
+    handler.Bind(wxEVT_THREAD, h3);
+
+    wxThreadEvent event;
+    handler.ProcessEvent(event);
+    CHECK( log == "3 2 3 2 1 1 " );
+
+    log.clear();
+    handler.ProcessEvent(event);
+    CHECK( log == "3 2 1 " );
+}
+
+TEST_CASE("Event::AllocCache", "[event][alloc]")
+{
+    wxEvent::UseAllocCache();
+
+    const wxEventAllocStats before = wxEvent::GetAllocStats();
+
+    wxEvtHandler handler;
+
+    wxString log;
+    handler.Bind(wxEVT_THREAD, [&log](wxThreadEvent& event)
+        {
+            log << event.GetString() << ' ';
+        });
+
+    // Queue the events in several rounds: the events of all rounds after the
+    // first one should use the memory of the events deleted before.
+    for ( int round = 0; round < 3; round++ )
+    {
+        for ( int n = 0; n < 5; n++ )
+        {
+            wxThreadEvent* const event = new wxThreadEvent();
+            event->SetString(wxString::Format("%d.%d", round, n));
+            handler.QueueEvent(event);
+        }
+
+        wxTheApp->ProcessPendingEvents();
+    }
+
+    CHECK( log == "0.0 0.1 0.2 0.3 0.4 "
+                  "1.0 1.1 1.2 1.3 1.4 "
+                  "2.0 2.1 2.2 2.3 2.4 " );
+
+    const wxEventAllocStats after = wxEvent::GetAllocStats();
+
+    // The events are also cloned when queuing them, hence "at least".
+    CHECK( after.allocated - before.allocated >= 15 );
+    CHECK( after.reused - before.reused >= 10 );
+
+    wxEvent::UseAllocCache(false);
+
+    // Events using the memory cached before must still work normally.
+    wxEvent* const event = new wxThreadEvent(wxEVT_THREAD, 17);
+    CHECK( event->GetId() == 17 );
+    delete event;
+}
+
+namespace
+{
+
+const wxEventProfiler::Stats*
+FindStats(const std::vector<wxEventProfiler::Stats>& stats, wxEventType type)
+{
+    const auto it = std::find_if(stats.begin(), stats.end(),
+                                 [type](const wxEventProfiler::Stats& s)
+                                 {
+                                     return s.eventType == type;
+                                 });
+
+    return it == stats.end() ? nullptr : &*it;
+}
+
+} // anonymous namespace
+
+TEST_CASE("Event::Profiler", "[event][profiler]")
+{
+    wxEvtHandler handler;
+    handler.Bind(wxEVT_THREAD, [](wxThreadEvent& event)
+        {
+            if ( event.GetInt() )
+                wxMilliSleep(event.GetInt());
+        });
+
+    wxEventProfiler::SetStallThreshold(20);
+    wxEventProfiler::Start();
+
+    wxThreadEvent event;
+    handler.ProcessEvent(event);
+
+    handler.QueueEvent(new wxThreadEvent());
+    wxMilliSleep(10);
+
+    wxThreadEvent* const eventSlow = new wxThreadEvent();
+    eventSlow->SetInt(50);
+    handler.QueueEvent(eventSlow);
+
+    wxTheApp->ProcessPendingEvents();
+    wxTheApp->ProcessIdle();
+
+    wxEventProfiler::Stop();
+
+    // Events are not profiled any more after stopping.
+    handler.ProcessEvent(event);
+
+    const auto dispatchAll = wxEventProfiler::GetDispatchStats();
+    const auto dispatch = FindStats(dispatchAll, wxEVT_THREAD);
+    REQUIRE( dispatch );
+    CHECK( dispatch->count == 3 );
+    CHECK( dispatch->eventClass == "wxThreadEvent" );
+    CHECK( dispatch->maxTime >= 50000 );
+
+    const auto handlersAll = wxEventProfiler::GetHandlerStats();
+    const auto handlers = FindStats(handlersAll, wxEVT_THREAD);
+    REQUIRE( handlers );
+    CHECK( handlers->handlerClass == "wxEvtHandler" );
+    CHECK( handlers->count == 3 );
+
+    const auto queueWaitAll = wxEventProfiler::GetQueueWaitStats();
+    const auto queueWait = FindStats(queueWaitAll, wxEVT_THREAD);
+    REQUIRE( queueWait );
+    CHECK( queueWait->count == 2 );
+    CHECK( queueWait->maxTime >= 10000 );
+
+    CHECK( wxEventProfiler::GetIdleStats().count == 1 );
+
+    const auto stalls = wxEventProfiler::GetStalls();
+    REQUIRE( stalls.size() >= 1 );
+    CHECK( stalls[0].eventType == wxEVT_THREAD );
+    CHECK( stalls[0].duration >= 50000 );
+
+    const wxString trace = wxEventProfiler::GetChromeTrace();
+    CHECK( trace.StartsWith("{\"traceEvents\":[") );
+    CHECK( trace.Contains("\"cat\":\"stall\"") );
+
+    wxEventProfiler::SetStallThreshold(100);
+    wxEventProfiler::Reset();
+    CHECK( wxEventProfiler::GetDispatchStats().empty() );
+}
+
 // This is a compilation-time-only test: just check that a class inheriting
 // from wxEvtHandler non-publicly can use Bind() with its method, this used to
 // result in compilation errors.
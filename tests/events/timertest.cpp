@@ -137,3 +137,50 @@ void TimerEventTestCase::Multiple()
     // more than one
     CPPUNIT_ASSERT( numTicks > 1 );
 }
+
+TEST_CASE("wxTimer::Tolerance", "[timer]")
+{
+    class ExitAfterTimersHandler : public TimerCounterHandler
+    {
+    public:
+        ExitAfterTimersHandler(wxEventLoopBase& loop, int numTimers)
+            : TimerCounterHandler(),
+              m_loop(loop),
+              m_numTimers(numTimers)
+        {
+        }
+
+    private:
+        virtual void Tick() override
+        {
+            if ( GetNumEvents() == m_numTimers )
+                m_loop.Exit();
+        }
+
+        wxEventLoopBase& m_loop;
+        const int m_numTimers;
+    };
+
+    wxEventLoop loop;
+
+    ExitAfterTimersHandler handler(loop, 2);
+
+    wxTimer timer1(&handler);
+    CHECK( timer1.GetTolerance() == 0 );
+
+    timer1.SetTolerance(100);
+    CHECK( timer1.GetTolerance() == 100 );
+
+    wxTimer timer2(&handler);
+    timer2.SetTolerance(100);
+
+    // Both timers must still expire, even if possibly later than requested.
+    timer1.StartOnce(50);
+    timer2.StartOnce(70);
+
+    loop.Run();
+
+    CHECK( handler.GetNumEvents() == 2 );
+    CHECK( !timer1.IsRunning() );
+    CHECK( !timer2.IsRunning() );
+}
@@ -543,4 +543,71 @@ TEST_CASE("wxExecute::RedirectUTF8", "[exec][unicode][.]")
     FAIL("Expected output fragment not found.");
 }
 
+class OutputEventsProcess : public wxProcess
+{
+public:
+    OutputEventsProcess()
+    {
+        EnableOutputEvents(4096);
+
+        m_chunks = 0;
+        m_terminated = false;
+    }
+
+    virtual void OnOutput(const wxMemoryBuffer& data, bool isError) override
+    {
+        CHECK( data.GetDataLen() <= 4096 );
+
+        wxMemoryBuffer& buf = isError ? m_err : m_out;
+        buf.AppendData(data.GetData(), data.GetDataLen());
+
+        m_chunks++;
+    }
+
+    virtual void OnTerminate(int WXUNUSED(pid), int WXUNUSED(status)) override
+    {
+        m_terminated = true;
+
+        if ( wxEventLoopBase::GetActive() )
+            wxEventLoopBase::GetActive()->ScheduleExit();
+    }
+
+    wxMemoryBuffer m_out,
+                   m_err;
+    int m_chunks;
+    bool m_terminated;
+};
+
+TEST_CASE("wxProcess::OutputEvents", "[exec]")
+{
+    OutputEventsProcess proc;
+    wxEventLoop loop;
+
+    REQUIRE( wxExecute("seq 1 100000", wxEXEC_ASYNC, &proc) != 0 );
+
+    CHECK( !proc.GetInputStream() );
+    CHECK( !proc.GetErrorStream() );
+
+    if ( !proc.m_terminated )
+        loop.Run();
+
+    // This is the total length of all numbers from 1 to 100000 and the new
+    // line characters following each of them.
+    CHECK( proc.m_out.GetDataLen() == 588895 );
+    CHECK( proc.m_err.GetDataLen() == 0 );
+    CHECK( proc.m_chunks > 1 );
+}
+
+TEST_CASE("wxExecute::Stats", "[exec]")
+{
+    const wxExecuteStats before = wxGetExecuteStats();
+
+    REQUIRE( wxExecute("true", wxEXEC_SYNC) == 0 );
+
+    const wxExecuteStats after = wxGetExecuteStats();
+    CHECK( after.launched == before.launched + 1 );
+    CHECK( after.spawned >= before.spawned );
+    CHECK( after.spawned <= after.launched );
+}
+
 #endif // __UNIX__
@@ -180,6 +180,94 @@ TEST_CASE_METHOD(DirTestCase, "Dir::Traverse", "[dir]")
     CHECK( traverser.dirs.size() == 6 );
 }
 
+TEST_CASE_METHOD(DirTestCase, "Dir::EnumWithStat", "[dir]")
+{
+    wxDir dir(DIRTEST_FOLDER);
+    REQUIRE( dir.IsOpened() );
+
+    size_t numDirs = 0,
+           numFiles = 0;
+
+    wxString name;
+    wxFileStat stat;
+    for ( bool cont = dir.GetFirst(&name, &stat); cont; cont = dir.GetNext(&name, &stat) )
+    {
+        INFO("name=" << name);
+        REQUIRE( stat.IsOk() );
+
+        const wxString path = dir.GetNameWithSep() + name;
+        if ( stat.IsDir() )
+        {
+            CHECK( wxDir::Exists(path) );
+            numDirs++;
+        }
+        else
+        {
+            CHECK( stat.IsFile() );
+            CHECK( stat.GetSize() == wxFileName::GetSize(path) );
+            numFiles++;
+        }
+    }
+
+    CHECK( numDirs == 3 );
+    CHECK( numFiles == 1 );
+
+    // Check that passing null stat pointer works too.
+    CHECK( dir.GetFirst(&name, nullptr, "dummy", wxDIR_FILES) );
+    CHECK( name == "dummy" );
+    CHECK( !dir.GetNext(&name, nullptr) );
+}
+
+TEST_CASE_METHOD(DirTestCase, "Dir::TraverseParallel", "[dir]")
+{
+    wxArrayString expected;
+    wxDir::GetAllFiles(DIRTEST_FOLDER, &expected);
+    expected.Sort();
+
+    // Use small batches to check that they're combined correctly.
+    wxArrayString files;
+    size_t batches = 0;
+    CHECK( wxDir::TraverseParallel(DIRTEST_FOLDER,
+                                   [&](const wxArrayString& batch)
+                                   {
+                                       batches++;
+                                       for ( const auto& file : batch )
+                                           files.push_back(file);
+                                       return true;
+                                   },
+                                   wxEmptyString, wxDIR_DEFAULT, 1) == 4 );
+    CHECK( batches > 1 );
+
+    files.Sort();
+    CHECK( files == expected );
+
+    // Check that filespec and flags are taken into account.
+    files.clear();
+    const auto addFiles = [&files](const wxArrayString& batch)
+    {
+        for ( const auto& file : batch )
+            files.push_back(file);
+        return true;
+    };
+
+    CHECK( wxDir::TraverseParallel(DIRTEST_FOLDER, addFiles, "*.foo") == 1 );
+    CHECK( files.size() == 1 );
+
+    CHECK( wxDir::TraverseParallel(DIRTEST_FOLDER, addFiles, wxEmptyString,
+                                   wxDIR_FILES) == 1 );
+
+    // Check that stopping the traversal works: only the files of the first
+    // directory with any files in it should be found.
+    const size_t numFound =
+        wxDir::TraverseParallel(DIRTEST_FOLDER,
+                                [](const wxArrayString&) { return false; },
+                                wxEmptyString, wxDIR_DEFAULT, 1);
+    CHECK( numFound > 0 );
+    CHECK( numFound < 4 );
+
+    CHECK( wxDir::TraverseParallel("nonexistent_dir", addFiles) == 0 );
+}
+
 TEST_CASE_METHOD(DirTestCase, "Dir::Exists", "[dir]")
 {
     struct
@@ -0,0 +1,135 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        tests/file/mappedfile.cpp
+// Purpose:     wxMappedFile and wxMappedInputStream unit tests
+// Author:      wxWidgets team
+// Created:     2026-10-14
+// Copyright:   (c) 2026 wxWidgets team
+///////////////////////////////////////////////////////////////////////////////
+
+// ----------------------------------------------------------------------------
+// headers
+// ----------------------------------------------------------------------------
+
+#include "testprec.h"
+
+
+#if wxUSE_FILE
+
+#include "wx/file.h"
+#include "wx/mappedfile.h"
+
+#include "testfile.h"
+
+#include <string.h>
+
+namespace
+{
+
+// Create a file with the given contents, overwriting the existing one.
+void WriteTestFile(const wxString& name, const char* data, size_t len)
+{
+    wxFile fout(name, wxFile::write);
+    REQUIRE( fout.IsOpened() );
+    REQUIRE( fout.Write(data, len) == len );
+    REQUIRE( fout.Close() );
+}
+
+} // anonymous namespace
+
+// ----------------------------------------------------------------------------
+// tests implementation
+// ----------------------------------------------------------------------------
+
+TEST_CASE("wxMappedFile::Open", "[file][mapped]")
+{
+    TestFile tf;
+
+    const char data[] = "Mapped\0file contents";
+    WriteTestFile(tf.GetName(), data, sizeof(data));
+
+    wxMappedFile file(tf.GetName());
+    REQUIRE( file.IsOpened() );
+    CHECK( file.GetLength() == sizeof(data) );
+    CHECK( memcmp(file.GetData(), data, sizeof(data)) == 0 );
+
+    file.Close();
+    CHECK( !file.IsOpened() );
+    CHECK( file.GetData() == nullptr );
+    CHECK( file.GetLength() == 0 );
+
+    // Reopening the same object must work too.
+    REQUIRE( file.Open(tf.GetName()) );
+    CHECK( file.GetLength() == sizeof(data) );
+
+    SECTION("Empty")
+    {
+        TestFile tfEmpty;
+        WriteTestFile(tfEmpty.GetName(), "", 0);
+
+        REQUIRE( file.Open(tfEmpty.GetName()) );
+        CHECK( file.GetData() == nullptr );
+        CHECK( file.GetLength() == 0 );
+    }
+
+    SECTION("NonExistent")
+    {
+        wxFileName fn(tf.GetName());
+        fn.SetName(fn.GetName() + "-nonexistent");
+
+        wxLogNull noLog;
+        CHECK( !file.Open(fn.GetFullPath()) );
+        CHECK( !file.IsOpened() );
+        CHECK( file.GetData() == nullptr );
+    }
+}
+
+#if wxUSE_STREAMS
+
+TEST_CASE("wxMappedInputStream", "[file][mapped][stream]")
+{
+    TestFile tf;
+
+    const char data[] = "0123456789";
+    const size_t len = strlen(data);
+    WriteTestFile(tf.GetName(), data, len);
+
+    wxMappedInputStream stream(tf.GetName());
+    REQUIRE( stream.IsOk() );
+    CHECK( stream.IsSeekable() );
+    CHECK( stream.GetLength() == static_cast<wxFileOffset>(len) );
+    CHECK( stream.GetFile().GetData() != nullptr );
+
+    char buf[16];
+    CHECK( stream.Read(buf, 4).LastRead() == 4 );
+    CHECK( memcmp(buf, "0123", 4) == 0 );
+    CHECK( stream.TellI() == 4 );
+
+    CHECK( stream.SeekI(-2, wxFromEnd) == static_cast<wxFileOffset>(len - 2) );
+    CHECK( stream.Read(buf, sizeof(buf)).LastRead() == 2 );
+    CHECK( memcmp(buf, "89", 2) == 0 );
+    CHECK( stream.Eof() );
+
+    CHECK( stream.SeekI(1) == 1 );
+    CHECK( stream.SeekI(2, wxFromCurrent) == 3 );
+    CHECK( stream.GetC() == '3' );
+
+    CHECK( stream.SeekI(len + 1) == wxInvalidOffset );
+
+    // The data can also be accessed without copying it.
+    const void* p;
+    REQUIRE( stream.PeekBuffer(&p) == len - 4 );
+    CHECK( p == stream.GetFile().GetData() + 4 );
+    stream.ConsumeBuffer(len - 4);
+    CHECK( stream.TellI() == static_cast<wxFileOffset>(len) );
+
+    SECTION("NonExistent")
+    {
+        wxLogNull noLog;
+        wxMappedInputStream bad(tf.GetName() + "-nonexistent");
+        CHECK( !bad.IsOk() );
+    }
+}
+
+#endif // wxUSE_STREAMS
+
+#endif // wxUSE_FILE
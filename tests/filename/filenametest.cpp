@@ -825,6 +825,54 @@ TEST_CASE("wxFileName::SameAs", "[filename]")
 #endif // __UNIX__
 }
 
+TEST_CASE("wxFileStat", "[filename]")
+{
+    TestFile tf;
+    const wxString path = tf.GetName();
+
+    wxFileStat st(path);
+    REQUIRE( st.IsOk() );
+    CHECK( st.IsFile() );
+    CHECK( !st.IsDir() );
+    CHECK( !st.IsSymLink() );
+    CHECK( st.GetSize() == 6 );
+    CHECK( st.GetSize() == wxFileName::GetSize(path) );
+    CHECK( st.GetModificationTime() == wxFileName(path).GetModificationTime() );
+    CHECK( (st.GetPermissions() & wxS_IRUSR) );
+
+    const wxFileStat stDir(wxFileName(path).GetPath());
+    REQUIRE( stDir.IsOk() );
+    CHECK( stDir.IsDir() );
+    CHECK( !stDir.IsFile() );
+
+    CHECK( !wxFileStat().IsOk() );
+    CHECK( !st.Update(path + "_nonexistent") );
+    CHECK( !st.IsOk() );
+
+#if defined(__UNIX__)
+    const wxString link = path + "_link";
+    REQUIRE( symlink(path.fn_str(), link.fn_str()) == 0 );
+    wxON_BLOCK_EXIT1( wxRemoveFile, link );
+
+    CHECK( st.Update(link) );
+    CHECK( st.IsSymLink() );
+    CHECK( st.IsFile() );
+    CHECK( st.GetSize() == 6 );
+
+    CHECK( st.Update(link, wxFILE_EXISTS_NO_FOLLOW) );
+    CHECK( st.IsSymLink() );
+    CHECK( !st.IsFile() );
+
+    const wxString dangling = path + "_dangling";
+    REQUIRE( symlink((path + "_nonexistent").fn_str(), dangling.fn_str()) == 0 );
+    wxON_BLOCK_EXIT1( wxRemoveFile, dangling );
+
+    CHECK( !st.Update(dangling) );
+    CHECK( st.Update(dangling, wxFILE_EXISTS_NO_FOLLOW) );
+    CHECK( st.IsSymLink() );
+#endif // __UNIX__
+}
+
 #if defined(__UNIX__)
 
 // Tests for functions that are changed by ShouldFollowLink()
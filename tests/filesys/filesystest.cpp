@@ -42,6 +42,17 @@ public:
     wxString RightLocation(const wxString& p) { return GetRightLocation(p); }
     wxString Anchor(const wxString& p) { return GetAnchor(p); }
 
+    bool IsProtocol(const wxString& p, const wxString& proto)
+        { return HasProtocol(p, proto); }
+    wxString RightLocationFromRange(const wxString& p)
+    {
+        size_t start, end;
+        if ( !GetRightLocationRange(p, &start, &end) )
+            return wxString();
+
+        return p.substr(start, end - start);
+    }
+
     bool CanOpen(const wxString& WXUNUSED(url)) override { return false; }
     wxFSFile *OpenFile(wxFileSystem& WXUNUSED(fs),
                        const wxString& WXUNUSED(url)) override { return nullptr; }
@@ -134,6 +145,10 @@ TEST_CASE("wxFileSystem::URLParsing", "[filesys][url][parse]")
         CHECK( tst.LeftLocation(d.url) == d.left );
         CHECK( tst.RightLocation(d.url) == d.right );
         CHECK( tst.Anchor(d.url) == d.anchor );
+
+        CHECK( tst.IsProtocol(d.url, d.protocol) );
+        CHECK( !tst.IsProtocol(d.url, "nosuchprotocol") );
+        CHECK( tst.RightLocationFromRange(d.url) == d.right );
     }
 }
 
@@ -270,6 +285,68 @@ TEST_CASE("wxFileSystem::MemoryFSHandler", "[filesys][memoryfshandler][find]")
 
     CHECK( fs.FindFirst(url) == url );
     CHECK( fs.FindNext() == "" );
+
+    // Check that opening files with an anchor works too.
+    std::unique_ptr<wxFSFile> file(fs.OpenFile(url + "#anchor"));
+    REQUIRE( file );
+    CHECK( file->GetAnchor() == "anchor" );
+
+    file.reset(fs.OpenFile("memory:nonexistent.txt"));
+    CHECK( !file );
+}
+
+TEST_CASE("wxFileSystem::SupportedProtocols", "[filesys][handler]")
+{
+    // Handler which supports a single protocol and counts CanOpen() calls.
+    class CountingHandler : public wxFileSystemHandler
+    {
+    public:
+        wxArrayString GetSupportedProtocols() const override
+        {
+            wxArrayString protocols;
+            protocols.Add("counting");
+            return protocols;
+        }
+
+        bool CanOpen(const wxString& location) override
+        {
+            m_numCalls++;
+            return GetProtocol(location) == "counting";
+        }
+
+        wxFSFile* OpenFile(wxFileSystem& WXUNUSED(fs),
+                           const wxString& location) override
+        {
+            return new wxFSFile(new wxStringInputStream("counted"),
+                                location, "text/plain", wxString()
+#if wxUSE_DATETIME
+                                , wxDateTime::Now()
+#endif // wxUSE_DATETIME
+                               );
+        }
+
+        int m_numCalls = 0;
+    };
+
+    CountingHandler handler;
+    wxFileSystem::AddHandler(&handler);
+
+    wxFileSystem fs;
+    std::unique_ptr<wxFSFile> file(fs.OpenFile("other:foo.txt"));
+    CHECK( !file );
+    CHECK( handler.m_numCalls == 0 );
+
+    file.reset(fs.OpenFile("counting:foo.txt"));
+    CHECK( file );
+    CHECK( handler.m_numCalls == 1 );
+
+    CHECK( wxFileSystem::HasHandlerForPath("counting:bar.txt") );
+    CHECK( !wxFileSystem::HasHandlerForPath("other:bar.txt") );
+
+    wxFileSystem::RemoveHandler(&handler);
+
+    file.reset(fs.OpenFile("counting:foo.txt"));
+    CHECK( !file );
 }
 
 #endif // wxUSE_FILESYSTEM
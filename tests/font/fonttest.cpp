@@ -19,8 +19,10 @@
 #endif // WX_PRECOMP
 
 #include "wx/font.h"
+#include "wx/fontenum.h"
 
 #include "asserthelper.h"
+#include "waitfor.h"
 
 // ----------------------------------------------------------------------------
 // local helpers
@@ -499,4 +501,55 @@ TEST_CASE("wxFontList::FindOrCreate", "[font][fontinfo][fontlist]")
     // font 2 should be font1 from the font list "cache"
     wxFont* const font2 = wxTheFontList->FindOrCreateFont(info);
     CHECK(font2 == font1);
+
+    // But if the font is modified, it shouldn't be returned any more.
+    wxFontInfo infoUnderlined(info);
+    infoUnderlined.Underlined();
+
+    wxFont* const font3 = wxTheFontList->FindOrCreateFont(infoUnderlined);
+    REQUIRE(font3);
+    CHECK(font3 != font1);
+
+    font3->SetUnderlined(false);
+    wxFont* const font4 = wxTheFontList->FindOrCreateFont(infoUnderlined);
+    CHECK(font4 != font3);
+    CHECK(font4->GetUnderlined());
 }
+
+#if wxUSE_FONTENUM
+
+TEST_CASE("wxFontEnumerator::GetFacenames", "[font][fontenum]")
+{
+    const wxArrayString facenames = wxFontEnumerator::GetFacenames();
+    if ( facenames.empty() )
+    {
+        WARN("Skipping test: no fonts found.");
+        return;
+    }
+
+    // Cached result must be the same.
+    CHECK( wxFontEnumerator::GetFacenames() == facenames );
+
+    CHECK( wxFontEnumerator::IsValidFacename(facenames[0]) );
+    CHECK( wxFontEnumerator::IsValidFacename(facenames[0].Upper()) );
+    CHECK( !wxFontEnumerator::IsValidFacename("No such font, hopefully") );
+
+    wxFontEnumerator::InvalidateCache();
+    CHECK( wxFontEnumerator::GetFacenames() == facenames );
+
+    wxArrayString facenamesAsync;
+    bool done = false;
+    wxFontEnumerator::GetFacenamesAsync([&](const wxArrayString& names)
+        {
+            facenamesAsync = names;
+            done = true;
+        });
+
+    // The callback must be called asynchronously.
+    CHECK( !done );
+
+    REQUIRE( WaitFor("font enumeration", [&done]() { return done; }, 5000) );
+    CHECK( facenamesAsync == facenames );
+}
+
+#endif // wxUSE_FONTENUM
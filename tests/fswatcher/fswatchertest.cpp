@@ -14,7 +14,9 @@
 
 
 #ifndef WX_PRECOMP
+    #include "wx/app.h"
     #include "wx/timer.h"
+    #include "wx/utils.h"
 #endif
 
 #if wxUSE_FSWATCHER
@@ -25,6 +27,7 @@
 #include "wx/fswatcher.h"
 #include "wx/log.h"
 #include "wx/stdpaths.h"
+#include "wx/stopwatch.h"
 #include "wx/vector.h"
 
 #include "testfile.h"
@@ -808,6 +811,46 @@ TEST_CASE_METHOD(FileSystemWatcherTestCase,
             CHECK( m_watcher->GetWatchedPathsCount() == initial );
         }
 
+#if wxUSE_THREADS && !defined(__WINDOWS__) && \
+        !defined(wxHAVE_FSEVENTS_FILE_NOTIFICATIONS)
+        void WatchTreeAsync(const wxFileName& dir)
+        {
+            REQUIRE(m_watcher);
+            REQUIRE(dir.DirExists()); // Was built in WatchTree()
+
+            const int initial = m_watcher->GetWatchedPathsCount();
+
+            m_watcher->EnableAsyncTreeAdd();
+
+            // The root is watched immediately.
+            CHECK( m_watcher->AddTree(dir) );
+            CHECK( m_watcher->GetWatchedPathsCount() >= initial + 1 );
+
+            // Removing the tree before it's fully added must work too.
+            m_watcher->RemoveTree(dir);
+            CHECK( !m_watcher->HasPendingTreeAdd() );
+            CHECK( m_watcher->GetWatchedPathsCount() == initial );
+
+            CHECK( m_watcher->AddTree(dir) );
+
+            wxStopWatch sw;
+            while ( m_watcher->HasPendingTreeAdd() && sw.Time() < 10000 )
+            {
+                wxTheApp->ProcessPendingEvents();
+                wxMilliSleep(10);
+            }
+
+            CHECK( !m_watcher->HasPendingTreeAdd() );
+            CHECK( m_watcher->GetWatchedPathsCount() ==
+                        initial + static_cast<int>(subdirs) + 2 );
+
+            m_watcher->RemoveTree(dir);
+            CHECK( m_watcher->GetWatchedPathsCount() == initial );
+
+            m_watcher->EnableAsyncTreeAdd(false);
+        }
+#endif // wxUSE_THREADS && !__WINDOWS__ && !wxHAVE_FSEVENTS_FILE_NOTIFICATIONS
+
         void RemoveAllWatches()
         {
             REQUIRE(m_watcher);
@@ -839,6 +882,10 @@ TEST_CASE_METHOD(FileSystemWatcherTestCase,
 #ifndef __WINDOWS__
             WatchTreeWithFilespec(treedir);
 #endif // __WINDOWS__
+#if wxUSE_THREADS && !defined(__WINDOWS__) && \
+        !defined(wxHAVE_FSEVENTS_FILE_NOTIFICATIONS)
+            WatchTreeAsync(treedir);
+#endif
 
             RemoveSingleWatch(singledir);
             // Add it back again, ready to test RemoveAll()
@@ -873,6 +920,92 @@ TEST_CASE_METHOD(FileSystemWatcherTestCase,
 }
 
 
+// ----------------------------------------------------------------------------
+// TestEventBatch
+// ----------------------------------------------------------------------------
+
+#if wxUSE_TIMER && !defined(wxHAVE_FSEVENTS_FILE_NOTIFICATIONS)
+
+TEST_CASE_METHOD(FileSystemWatcherTestCase,
+                 "wxFileSystemWatcher::EventBatch", "[fsw]")
+{
+    class BatchTester : public FSWTesterBase
+    {
+    public:
+        BatchTester() : m_waitForBatch(false)
+        {
+            Bind(wxEVT_FSWATCHER_BATCH, &BatchTester::OnBatch, this);
+        }
+
+        virtual void GenerateEvent() override
+        {
+            m_watcher->SetBatchDelay(100);
+            CHECK( m_watcher->GetBatchDelay() == 100 );
+
+            // Check that duplicates are collapsed and that disabling batching
+            // sends the pending events immediately.
+            const wxFileName path(eg.m_base.GetFullPath(), "fake");
+            wxFileSystemWatcherEvent modify(wxFSW_EVENT_MODIFY, path, path);
+            wxFileSystemWatcherEvent attrib(wxFSW_EVENT_ATTRIB, path, path);
+            m_watcher->DeliverEvent(modify);
+            m_watcher->DeliverEvent(modify);
+            m_watcher->DeliverEvent(attrib);
+            CHECK( m_batches.empty() );
+
+            m_watcher->SetBatchDelay(0);
+            CHECK( m_watcher->GetBatchDelay() == 0 );
+            REQUIRE( m_batches.size() == 1 );
+            REQUIRE( m_batches[0].size() == 2 );
+            CHECK( m_batches[0][0].GetChangeType() == wxFSW_EVENT_MODIFY );
+            CHECK( m_batches[0][1].GetChangeType() == wxFSW_EVENT_ATTRIB );
+            m_batches.clear();
+
+            // Now check that the real events are batched too.
+            m_watcher->SetBatchDelay(100);
+            m_waitForBatch = true;
+            CHECK(eg.CreateFile());
+        }
+
+        virtual void CheckResult() override
+        {
+            CHECK( m_events.empty() );
+
+            REQUIRE( m_batches.size() == 1 );
+            REQUIRE( !m_batches[0].empty() );
+
+            const wxFileSystemWatcherEvent& e = m_batches[0][0];
+            CHECK( e.GetChangeType() == wxFSW_EVENT_CREATE );
+            CHECK( e.GetPath() == eg.m_file );
+        }
+
+        virtual wxFileSystemWatcherEvent ExpectedEvent() override
+        {
+            FAIL( "Shouldn't be called" );
+
+            return wxFileSystemWatcherEvent(wxFSW_EVENT_ERROR);
+        }
+
+    private:
+        void OnBatch(wxFileSystemWatcherBatchEvent& event)
+        {
+            m_batches.push_back(event.GetEvents());
+
+            if ( m_waitForBatch )
+                SendIdle();
+        }
+
+        std::vector<wxFileSystemWatcherBatchEvent::Events> m_batches;
+        bool m_waitForBatch;
+    };
+
+    BatchTester tester;
+
+    tester.Run();
+}
+
+#endif // wxUSE_TIMER && !wxHAVE_FSEVENTS_FILE_NOTIFICATIONS
+
+
 namespace
 {
 
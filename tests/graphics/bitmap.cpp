@@ -21,6 +21,7 @@
 #include "wx/dcsvg.h"
 #if wxUSE_GRAPHICS_CONTEXT
 #include "wx/graphics.h"
+#include "wx/resourcestats.h"
 #endif // wxUSE_GRAPHICS_CONTEXT
 
 #include "testfile.h"
@@ -1950,3 +1951,53 @@ TEST_CASE("wxBitmap::GetSubBitmap", "[bitmap]")
 }
 
 #endif // ports with scaled bitmaps support
+
+TEST_CASE("Bitmap::ResourceStats", "[bitmap][resourcestats]")
+{
+    wxResourceStats::Enable();
+
+    wxResourceStats::Stats statsBefore;
+    wxResourceStats::GetStats("wxBitmap", &statsBefore);
+
+    {
+        wxBitmap bmp1(16, 16, 24);
+        wxBitmap bmp2(8, 8, 32);
+
+        // Copies share the same native resource.
+        const wxBitmap bmpCopy(bmp1);
+
+        // Invalid bitmaps don't use any resources.
+        wxBitmap bmpInvalid;
+
+        wxResourceStats::Stats stats;
+        REQUIRE( wxResourceStats::GetStats("wxBitmap", &stats) );
+        CHECK( stats.className == "wxBitmap" );
+        CHECK( stats.objects == statsBefore.objects + 4 );
+        CHECK( stats.resources == statsBefore.resources + 2 );
+        CHECK( stats.bytes >= statsBefore.bytes + 16*16*3 + 8*8*4 );
+    }
+
+    wxResourceStats::Stats statsAfter;
+    wxResourceStats::GetStats("wxBitmap", &statsAfter);
+    CHECK( statsAfter.objects == statsBefore.objects );
+    CHECK( statsAfter.resources == statsBefore.resources );
+
+    const wxRegion region(wxRect(0, 0, 10, 10));
+
+    wxResourceStats::Stats stats;
+    REQUIRE( wxResourceStats::GetStats("wxRegion", &stats) );
+    CHECK( stats.objects >= 1 );
+    CHECK( stats.bytes >= sizeof(wxRect) );
+
+    bool foundRegion = false;
+    for ( const auto& s : wxResourceStats::GetGDIStats() )
+    {
+        if ( s.className == "wxRegion" )
+            foundRegion = true;
+    }
+    CHECK( foundRegion );
+
+    // Disabling tracking forgets about all the existing objects.
+    wxResourceStats::Enable(false);
+    CHECK( !wxResourceStats::GetStats("wxRegion", &stats) );
+}
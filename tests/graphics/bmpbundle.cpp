@@ -68,6 +68,40 @@ TEST_CASE("BitmapBundle::GetBitmap", "[bmpbundle]")
     CHECK( b.GetBitmap(scaledSize).GetSize() == scaledSize );
 }
 
+TEST_CASE("BitmapBundle::PrepareBitmaps", "[bmpbundle]")
+{
+    wxBitmap bmpRed(16, 16);
+    {
+        wxMemoryDC dc(bmpRed);
+        dc.SetBackground(*wxRED_BRUSH);
+        dc.Clear();
+    }
+
+    wxVector<wxBitmapBundle> bundles;
+    bundles.push_back(wxBitmapBundle::FromBitmap(bmpRed));
+    bundles.push_back(wxBitmapBundle::FromBitmap(wxBitmap(24, 24)));
+    bundles.push_back(wxBitmapBundle());
+
+    wxBitmapBundle::PrepareBitmaps(bundles, 2.0);
+
+    // Let the bitmaps be prepared, but don't rely on it happening in any
+    // given time, this test only checks that the results are correct.
+    for ( int n = 0; n < 10; ++n )
+    {
+        wxMilliSleep(10);
+        wxYield();
+    }
+
+    const wxBitmap bmp = bundles[0].GetBitmap(wxSize(32, 32));
+    REQUIRE( bmp.GetSize() == wxSize(32, 32) );
+
+    const wxImage img = bmp.ConvertToImage();
+    CHECK( img.GetRed(31, 31) == 0xff );
+    CHECK( img.GetGreen(31, 31) == 0 );
+
+    CHECK( bundles[1].GetBitmap(wxSize(48, 48)).GetSize() == wxSize(48, 48) );
+}
+
 // Helper functions for the test below.
 namespace
 {
@@ -417,6 +451,39 @@ TEST_CASE("BitmapBundle::FromSVG-alpha", "[bmpbundle][svg][alpha]")
     CHECK( (int)img.GetBlue(0, 1) == 0xff );
 }
 
+TEST_CASE("BitmapBundle::FromSVG-cache", "[bmpbundle][svg]")
+{
+    static const char svg_data[] =
+        "<svg viewBox=\"0 0 100 100\">"
+        "<rect x=\"10\" y=\"10\" width=\"80\" height=\"80\" fill=\"red\"/>"
+        "</svg>"
+        ;
+
+    wxBitmapBundle b1 = wxBitmapBundle::FromSVG(svg_data, wxSize(16, 16));
+    wxBitmapBundle b2 = wxBitmapBundle::FromSVG(svg_data, wxSize(24, 24));
+    REQUIRE( b1.IsOk() );
+    REQUIRE( b2.IsOk() );
+    CHECK( b2.GetDefaultSize() == wxSize(24, 24) );
+
+    // Bitmaps of the same size should be shared by all bundles using the
+    // same SVG data.
+    const wxBitmap bmp32 = b1.GetBitmap(wxSize(32, 32));
+    CHECK( b1.GetBitmap(wxSize(48, 48)).GetSize() == wxSize(48, 48) );
+    CHECK( b2.GetBitmap(wxSize(32, 32)).IsSameAs(bmp32) );
+    CHECK( b1.GetBitmap(wxSize(32, 32)).IsSameAs(bmp32) );
+
+    // But not if the cache is disabled.
+    const size_t maxSize = wxBitmapBundle::GetSVGCacheMaxSize();
+    wxBitmapBundle::SetSVGCacheMaxSize(0);
+
+    const wxBitmap bmp64 = b1.GetBitmap(wxSize(64, 64));
+    CHECK( bmp64.GetSize() == wxSize(64, 64) );
+    CHECK_FALSE( b2.GetBitmap(wxSize(64, 64)).IsSameAs(bmp64) );
+    CHECK_FALSE( b2.GetBitmap(wxSize(32, 32)).IsSameAs(bmp32) );
+
+    wxBitmapBundle::SetSVGCacheMaxSize(maxSize);
+}
+
 TEST_CASE("BitmapBundle::FromSVGFile", "[bmpbundle][svg][file]")
 {
     const wxSize size(20, 20); // completely arbitrary
@@ -583,3 +650,42 @@ TEST_CASE("wxArtProvider::Delete", "[artprov]")
     wxArtProvider::Push(artprov);
     delete artprov;
 }
+
+TEST_CASE("wxArtProvider::Cache", "[artprov]")
+{
+    class CountingArtProvider : public wxArtProvider
+    {
+    public:
+        int m_count = 0;
+
+    protected:
+        wxBitmapBundle CreateBitmapBundle(const wxArtID& id,
+                                          const wxArtClient& WXUNUSED(client),
+                                          const wxSize& WXUNUSED(size)) override
+        {
+            if ( id != "wxtest-art" )
+                return wxBitmapBundle();
+
+            ++m_count;
+            return wxBitmap(16, 16);
+        }
+    };
+
+    auto* artprov = new CountingArtProvider{};
+    wxArtProvider::Push(artprov);
+
+    // Requesting the same bundle repeatedly must only create it once.
+    CHECK( wxArtProvider::GetBitmapBundle("wxtest-art", wxART_TOOLBAR).IsOk() );
+    CHECK( wxArtProvider::GetBitmapBundle("wxtest-art", wxART_TOOLBAR).IsOk() );
+    CHECK( artprov->m_count == 1 );
+
+    // But different sizes and clients are cached separately.
+    CHECK( wxArtProvider::GetBitmapBundle("wxtest-art", wxART_MENU).IsOk() );
+    CHECK( wxArtProvider::GetBitmapBundle("wxtest-art", wxART_MENU,
+                                          wxSize(32, 32)).IsOk() );
+    CHECK( artprov->m_count == 3 );
+
+    // And the cache must be invalidated when the provider is removed.
+    wxArtProvider::Delete(artprov);
+    CHECK( !wxArtProvider::GetBitmapBundle("wxtest-art", wxART_TOOLBAR).IsOk() );
+}
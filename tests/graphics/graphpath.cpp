@@ -841,11 +841,44 @@ static void TestBox(wxGraphicsContext* gc)
     }
 }
 
+static void TestCompile(wxGraphicsContext* gc)
+{
+    wxGraphicsPath path = gc->CreatePath();
+    path.AddRectangle(10, 20, 30, 40);
+    path.Compile();
+
+    // Drawing the compiled path with different transformations must work.
+    gc->SetPen(*wxBLACK_PEN);
+    gc->SetBrush(*wxRED_BRUSH);
+    gc->DrawPath(path);
+    gc->PushState();
+    gc->Translate(100, 100);
+    gc->Scale(2, 2);
+    gc->DrawPath(path);
+    gc->FillPath(path, wxWINDING_RULE);
+    gc->PopState();
+    WX_CHECK_BOX(path.GetBox(), wxRect2DDouble(10, 20, 30, 40), 0);
+
+    // Modifying a copy of the path doesn't affect the original one.
+    wxGraphicsPath copy = path;
+    copy.AddRectangle(50, 60, 10, 10);
+    gc->StrokePath(copy);
+    WX_CHECK_BOX(path.GetBox(), wxRect2DDouble(10, 20, 30, 40), 0);
+    WX_CHECK_BOX(copy.GetBox(), wxRect2DDouble(10, 20, 50, 50), 0);
+
+    // And modifying the compiled path itself discards the compiled data.
+    path.AddPath(copy);
+    path.Compile();
+    gc->StrokePath(path);
+    WX_CHECK_BOX(path.GetBox(), wxRect2DDouble(10, 20, 50, 50), 0);
+}
+
 static void DoAllTests(wxGraphicsContext* gc)
 {
     gc->DisableOffset();
     TestCurrentPoint(gc);
     TestBox(gc);
+    TestCompile(gc);
 }
 
 #endif //  wxUSE_GRAPHICS_CONTEXT
@@ -733,6 +733,51 @@ TEST_CASE("ImageList:NegativeTests", "[imagelist][negative]")
     }
 }
 
+#ifndef wxHAS_NATIVE_IMAGELIST
+
+TEST_CASE("ImageList:Atlas", "[imagelist]")
+{
+    wxImageList il(8, 8, false);
+    for ( const wxColour& col : { *wxRED, *wxGREEN, *wxBLUE } )
+    {
+        wxImage img(8, 8);
+        img.SetRGB(wxRect(0, 0, 8, 8), col.Red(), col.Green(), col.Blue());
+        REQUIRE( il.Add(wxBitmap(img)) != -1 );
+    }
+
+    il.EnableAtlas();
+    CHECK( il.IsAtlasEnabled() );
+
+    // Return the colour of the image drawn by the image list.
+    const auto drawnColour = [&il](int n)
+    {
+        wxBitmap bmp(8, 8, 24);
+        {
+            wxMemoryDC dc(bmp);
+            dc.SetBackground(*wxWHITE_BRUSH);
+            dc.Clear();
+            CHECK( il.Draw(n, dc, 0, 0, wxIMAGELIST_DRAW_TRANSPARENT) );
+        }
+
+        const wxImage img = bmp.ConvertToImage();
+        return wxColour(img.GetRed(4, 4), img.GetGreen(4, 4), img.GetBlue(4, 4));
+    };
+
+    CHECK( drawnColour(0) == *wxRED );
+    CHECK( drawnColour(1) == *wxGREEN );
+    CHECK( drawnColour(2) == *wxBLUE );
+
+    // Check that the atlas is updated when the images change.
+    il.Remove(0);
+    CHECK( drawnColour(0) == *wxGREEN );
+    CHECK( drawnColour(1) == *wxBLUE );
+
+    il.Replace(0, il.GetBitmap(1));
+    CHECK( drawnColour(0) == *wxBLUE );
+}
+
+#endif // !wxHAS_NATIVE_IMAGELIST
+
 // This test relies on logical pixels being different from physical ones.
 #ifdef wxHAS_DPI_INDEPENDENT_PIXELS
 
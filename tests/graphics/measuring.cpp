@@ -167,6 +167,34 @@ TEST_CASE("wxDC::GetPartialTextExtent", "[dc][text-extent][partial]")
     CHECK( widths[4] == dc.GetTextExtent("Hello").x );
 }
 
+TEST_CASE("wxDC::GetTextExtents", "[dc][text-extent]")
+{
+    wxClientDC dc(wxTheApp->GetTopWindow());
+
+    wxArrayString strings;
+    strings.push_back("Hello");
+    strings.push_back(wxString());
+    strings.push_back("Good\nbye");
+
+    wxArrayInt widths, heights;
+    dc.GetTextExtents(strings, widths, &heights);
+    REQUIRE( widths.size() == 3 );
+    REQUIRE( heights.size() == 3 );
+
+    for ( size_t n = 0; n < strings.size(); n++ )
+    {
+        INFO("String #" << n);
+
+        const wxSize sz = dc.GetMultiLineTextExtent(strings[n]);
+        CHECK( widths[n] == sz.x );
+        CHECK( heights[n] == sz.y );
+    }
+
+    // Check that heights are optional and that the arrays are reset.
+    dc.GetTextExtents(wxArrayString(), widths);
+    CHECK( widths.empty() );
+}
+
 #ifdef TEST_GC
 
 TEST_CASE("wxGC::GetTextExtent", "[dc][text-extent]")
@@ -0,0 +1,141 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        tests/graphics/svgdc.cpp
+// Purpose:     wxSVGFileDC unit tests
+// Author:      wxWidgets team
+// Created:     2026-10-14
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+// ----------------------------------------------------------------------------
+// headers
+// ----------------------------------------------------------------------------
+
+#include "testprec.h"
+
+#if wxUSE_SVG
+
+#include "wx/dcsvg.h"
+#include "wx/mstream.h"
+
+#include <string>
+
+namespace
+{
+
+// Return the SVG produced by the given function drawing on wxSVGFileDC.
+template <typename F>
+std::string GetSVG(F draw)
+{
+    wxMemoryOutputStream stream;
+    {
+        wxSVGFileDC dc(stream, 100, 100);
+        REQUIRE( dc.IsOk() );
+
+        draw(dc);
+    }
+
+    std::string svg(stream.GetLength(), '\0');
+    stream.CopyTo(&svg[0], svg.length());
+    return svg;
+}
+
+size_t CountOf(const std::string& s, const char* what)
+{
+    size_t count = 0;
+    for ( size_t pos = s.find(what); pos != std::string::npos;
+          pos = s.find(what, pos + 1) )
+    {
+        count++;
+    }
+
+    return count;
+}
+
+} // anonymous namespace
+
+TEST_CASE("wxSVGFileDC::Stream", "[dc][svgdc]")
+{
+    const std::string svg = GetSVG([](wxDC& dc)
+        {
+            dc.DrawRectangle(10, 10, 20, 20);
+        });
+
+    CHECK( svg.compare(0, 5, "<?xml") == 0 );
+    CHECK( CountOf(svg, "<rect") == 1 );
+    CHECK( svg.compare(svg.length() - 7, 7, "</svg>\n") == 0 );
+}
+
+TEST_CASE("wxSVGFileDC::Lines", "[dc][svgdc]")
+{
+    SECTION("Merged")
+    {
+        const std::string svg = GetSVG([](wxDC& dc)
+            {
+                dc.DrawLine(0, 0, 10, 10);
+                dc.DrawLine(10, 10, -20, 30);
+                dc.DrawLine(5, 5, 6, 6);
+            });
+
+        CHECK( CountOf(svg, "<path") == 1 );
+        CHECK( svg.find("d=\"M0 0 L10 10 M10 10 L-20 30 M5 5 L6 6\"")
+                != std::string::npos );
+    }
+
+    SECTION("PenChange")
+    {
+        const std::string svg = GetSVG([](wxDC& dc)
+            {
+                dc.DrawLine(0, 0, 10, 10);
+                dc.SetPen(*wxRED_PEN);
+                dc.DrawLine(10, 10, 20, 20);
+                dc.DrawLine(20, 20, 30, 30);
+            });
+
+        CHECK( CountOf(svg, "<path") == 2 );
+    }
+
+    SECTION("OtherShape")
+    {
+        const std::string svg = GetSVG([](wxDC& dc)
+            {
+                dc.DrawLine(0, 0, 10, 10);
+                dc.DrawRectangle(10, 10, 20, 20);
+                dc.DrawLine(10, 10, 20, 20);
+            });
+
+        CHECK( CountOf(svg, "<path") == 2 );
+        CHECK( svg.find("<path d=\"M0 0 L10 10\"") < svg.find("<rect") );
+    }
+
+    SECTION("Transparent")
+    {
+        const std::string svg = GetSVG([](wxDC& dc)
+            {
+                dc.SetPen(wxPen(wxColour(0, 0, 0, 128)));
+                dc.DrawLine(0, 0, 10, 10);
+                dc.DrawLine(0, 10, 10, 0);
+            });
+
+        CHECK( CountOf(svg, "<path") == 2 );
+    }
+}
+
+TEST_CASE("wxSVGFileDC::StyleClasses", "[dc][svgdc]")
+{
+    const std::string svg = GetSVG([](wxDC& dc)
+        {
+            dc.SetPen(*wxRED_PEN);
+            dc.DrawRectangle(0, 0, 10, 10);
+            dc.SetPen(*wxBLUE_PEN);
+            dc.DrawRectangle(0, 0, 10, 10);
+            dc.SetPen(*wxRED_PEN);
+            dc.DrawRectangle(0, 0, 10, 10);
+        });
+
+    // The styles of the groups for red and blue pens are defined once each.
+    CHECK( CountOf(svg, "<style") == 2 );
+    CHECK( CountOf(svg, "<g class=") == 3 );
+}
+
+#endif // wxUSE_SVG
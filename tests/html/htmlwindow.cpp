@@ -17,6 +17,7 @@
 
 #ifndef WX_PRECOMP
     #include "wx/app.h"
+    #include "wx/dcmemory.h"
 #endif // WX_PRECOMP
 
 #include "wx/html/htmlwin.h"
@@ -44,6 +45,8 @@ private:
         WXUISIM_TEST( LinkClick );
 #endif // wxUSE_UIACTIONSIMULATOR
         CPPUNIT_TEST( AppendToPage );
+        CPPUNIT_TEST( AppendFragmentToPage );
+        CPPUNIT_TEST( DrawPartially );
     CPPUNIT_TEST_SUITE_END();
 
     void SelectionToText();
@@ -51,6 +54,8 @@ private:
     void CellClick();
     void LinkClick();
     void AppendToPage();
+    void AppendFragmentToPage();
+    void DrawPartially();
 
     wxHtmlWindow *m_win;
 
@@ -166,4 +171,74 @@ void HtmlWindowTestCase::AppendToPage()
 #endif // wxUSE_CLIPBOARD
 }
 
+void HtmlWindowTestCase::AppendFragmentToPage()
+{
+#if wxUSE_CLIPBOARD
+    m_win->SetPage(TEST_MARKUP_LINK);
+
+    const int heightBefore = m_win->GetInternalRepresentation()->GetHeight();
+
+    m_win->AppendFragmentToPage("<p>First paragraph</p>");
+    m_win->AppendFragmentToPage("<p>Second paragraph</p>");
+
+    CPPUNIT_ASSERT( m_win->GetInternalRepresentation()->GetHeight() > heightBefore );
+
+    // Re-laying out the page after changing the fonts must preserve the
+    // appended fragments.
+    m_win->SetStandardFonts();
+
+    const wxString text = m_win->ToText();
+    CPPUNIT_ASSERT( text.StartsWith("link") );
+    CPPUNIT_ASSERT( text.Contains("First paragraph") );
+    CPPUNIT_ASSERT( text.Contains("Second paragraph") );
+#endif // wxUSE_CLIPBOARD
+}
+
+void HtmlWindowTestCase::DrawPartially()
+{
+    // Use a page long enough for drawing it to skip most of its cells and
+    // leaving the DC in a different state from the initial one at the end.
+    wxString page;
+    for ( int n = 0; n < 200; n++ )
+    {
+        page += wxString::Format("<p><font color=\"#%02x0000\">Line %d</font>, "
+                                 "<b>bold</b> and <i>italic</i> text</p>",
+                                 n, n);
+    }
+    page += "<font color=\"#0000ff\"><b>End";
+
+    m_win->SetPage(page);
+
+    wxHtmlContainerCell* const cell = m_win->GetInternalRepresentation();
+    const int height = cell->GetHeight();
+
+    wxBitmap bmp(400, 100);
+    wxMemoryDC dc(bmp);
+
+    wxDefaultHtmlRenderingStyle style;
+    wxHtmlRenderingInfo info;
+    info.SetStyle(&style);
+
+    dc.SetFont(*wxNORMAL_FONT);
+    dc.SetTextForeground(*wxBLACK);
+    cell->Draw(dc, 0, 0, 0, height, info);
+
+    const wxFont font = dc.GetFont();
+    const wxColour colour = dc.GetTextForeground();
+    CPPUNIT_ASSERT( font.GetWeight() == wxFONTWEIGHT_BOLD );
+    CPPUNIT_ASSERT( colour == *wxBLUE );
+
+    // Drawing just a part of the page must leave the DC in the same state.
+    const int positions[] = { 0, height / 3, height / 2, height - 100 };
+    for ( size_t n = 0; n < WXSIZEOF(positions); n++ )
+    {
+        dc.SetFont(*wxNORMAL_FONT);
+        dc.SetTextForeground(*wxBLACK);
+        cell->Draw(dc, 0, -positions[n], 0, 100, info);
+
+        CPPUNIT_ASSERT( dc.GetFont() == font );
+        CPPUNIT_ASSERT( dc.GetTextForeground() == colour );
+    }
+}
+
 #endif //wxUSE_HTML
@@ -20,10 +20,12 @@
 #endif // WX_PRECOMP
 
 #include "wx/anidecod.h" // wxImageArray
+#include "wx/gifdecod.h"
 #include "wx/bitmap.h"
 #include "wx/cursor.h"
 #include "wx/icon.h"
 #include "wx/palette.h"
+#include "wx/quantize.h"
 #include "wx/url.h"
 #include "wx/log.h"
 #include "wx/mstream.h"
@@ -31,6 +33,11 @@
 #include "wx/wfstream.h"
 #include "wx/clipbrd.h"
 #include "wx/dataobj.h"
+#include "wx/scopeguard.h"
+
+#if wxUSE_MEDIACTRL
+    #include "wx/mediactrl.h"
+#endif
 
 // Check if we can use wxDIB::ConvertToBitmap(), which only exists for MSW and
 // which assumes the target is little-endian (matching the file format)
@@ -43,6 +50,8 @@
 #include "testimage.h"
 
 #include <memory>
+#include <set>
+#include <vector>
 
 #define CHECK_EQUAL_COLOUR_RGB(c1, c2) \
     CHECK( (int)c1.Red()   == (int)c2.Red() ); \
@@ -128,6 +137,47 @@ TEST_CASE_METHOD(ImageHandlersInit, "wxImage::LoadFromFile", "[image]")
     CHECK(img.LoadFile("image/bitfields.bmp", wxBITMAP_TYPE_BMP));
 }
 
+TEST_CASE_METHOD(ImageHandlersInit, "wxImage::DetectType", "[image]")
+{
+    // Check that the correct handler is used when loading images of all
+    // types, whether their type can be detected from their signature or not.
+    wxImage img;
+    for (unsigned int i=0; i<WXSIZEOF(g_testfiles); i++)
+    {
+        const wxString file(g_testfiles[i].file);
+        INFO("Loading " << file);
+
+        wxFileInputStream stream(file);
+        REQUIRE( stream.IsOk() );
+
+        CHECK( img.LoadFile(stream, wxBITMAP_TYPE_ANY) );
+        CHECK( img.GetType() == g_testfiles[i].type );
+    }
+}
+
+static bool gs_handlerFactoryCalled = false;
+
+static wxImageHandler* CreateTestPCXHandler()
+{
+    gs_handlerFactoryCalled = true;
+    return new wxPCXHandler;
+}
+
+TEST_CASE_METHOD(ImageHandlersInit, "wxImage::AddHandlerFactory", "[image]")
+{
+    REQUIRE( wxImage::RemoveHandler("PCX file") );
+
+    wxImage::AddHandlerFactory(wxBITMAP_TYPE_PCX, CreateTestPCXHandler);
+    CHECK( !gs_handlerFactoryCalled );
+
+    // The handler is created when it's needed.
+    CHECK( wxImage::FindHandler(wxBITMAP_TYPE_PCX) );
+    CHECK( gs_handlerFactoryCalled );
+
+    wxImage img;
+    CHECK( img.LoadFile("horse.pcx") );
+}
+
 TEST_CASE_METHOD(ImageHandlersInit, "wxImage::LoadFromSocketStream", "[image]")
 {
     // This test doesn't work any more even using the IP address below as the
@@ -1052,6 +1102,20 @@ TEST_CASE_METHOD(ImageHandlersInit, "wxImage::SavePNG", "[image]")
 
 }
 
+TEST_CASE_METHOD(ImageHandlersInit, "wxImage::SavePNGFast", "[image]")
+{
+    wxImage image("horse.png");
+    REQUIRE( image.IsOk() );
+
+    const wxImageHandler& handler = *wxImage::FindHandler(wxBITMAP_TYPE_PNG);
+
+    image.SetOption(wxIMAGE_OPTION_PNG_FAST, 1);
+    CompareImage(handler, image);
+
+    SetAlpha(&image);
+    CompareImage(handler, image, wxIMAGE_HAVE_ALPHA);
+}
+
 #if wxUSE_LIBTIFF
 static void TestTIFFImage(const wxString& option, int value,
     const wxImage *compareImage = nullptr)
@@ -1106,6 +1170,35 @@ TEST_CASE_METHOD(ImageHandlersInit, "wxImage::SaveTIFF", "[image]")
     alphaImage.SetOption(wxIMAGE_OPTION_TIFF_BITSPERSAMPLE, 1);
     TestTIFFImage(wxIMAGE_OPTION_TIFF_SAMPLESPERPIXEL, 2, &alphaImage);
 }
+
+TEST_CASE_METHOD(ImageHandlersInit, "wxTIFFReader", "[image][tiff]")
+{
+    wxImage expected;
+    REQUIRE( expected.LoadFile("horse.tif", wxBITMAP_TYPE_TIFF) );
+
+    wxFileInputStream stream("horse.tif");
+    REQUIRE( stream.IsOk() );
+
+    wxTIFFReader reader(stream);
+    REQUIRE( reader.IsOk() );
+    CHECK( reader.GetPageCount() == 1 );
+    CHECK( reader.GetPageSize(0) == expected.GetSize() );
+
+    wxImage image;
+    REQUIRE( reader.LoadPage(0, &image) );
+    CHECK_THAT( image, RGBASameAs(expected) );
+
+    // Loading the same page again must work too.
+    const wxRect rect(10, 20, 50, 40);
+    REQUIRE( reader.LoadPageRegion(0, rect, &image) );
+    CHECK( image.GetSize() == rect.GetSize() );
+    CHECK_THAT( image, RGBASameAs(expected.GetSubImage(rect)) );
+
+    wxLogNull noLog;
+    CHECK( !reader.LoadPageRegion(0, wxRect(expected.GetSize()).Inflate(1),
+                                  &image) );
+    CHECK( !image.IsOk() );
+}
 #endif // wxUSE_LIBTIFF
 
 TEST_CASE_METHOD(ImageHandlersInit, "wxImage::ReadCorruptedTGA", "[image]")
@@ -1265,6 +1358,62 @@ TEST_CASE_METHOD(ImageHandlersInit, "wxImage::BadGIF", "[image][gif][error]")
     CHECK( image.GetSize() == wxSize(1200, 800) );
 }
 
+#if wxUSE_PALETTE
+TEST_CASE_METHOD(ImageHandlersInit, "wxGIFDecoder::Frames", "[image][gif]")
+{
+    wxImage image("horse.gif");
+    REQUIRE( image.IsOk() );
+
+    wxImageArray images;
+    images.push_back(image);
+    images.push_back(image.Rotate90());
+    images.push_back(image.Mirror());
+    images[1].SetPalette(image.GetPalette());
+    images[2].SetPalette(image.GetPalette());
+
+    wxMemoryOutputStream memOut;
+    REQUIRE( wxGIFHandler().SaveAnimation(images, &memOut) );
+
+    wxMemoryInputStream memIn(memOut);
+    wxGIFDecoder decoder;
+    REQUIRE( decoder.LoadGIF(memIn) == wxGIF_OK );
+    REQUIRE( decoder.GetFrameCount() == 3 );
+
+    // Frames can be converted in any order and more than once.
+    for ( unsigned n : { 2, 0, 1, 2, 0 } )
+    {
+        INFO("Frame #" << n);
+
+        wxImage frame;
+        REQUIRE( decoder.ConvertToImage(n, &frame) );
+        CHECK_THAT( frame, RGBSameAs(images[n]) );
+    }
+
+    // Accessing the raw frame data must give the same result.
+    const wxSize size = decoder.GetFrameSize(1);
+    const unsigned char* const data = decoder.GetData(1);
+    REQUIRE( data );
+    CHECK( decoder.GetData(1) == data );
+
+    const unsigned char* const pal = decoder.GetPalette(1);
+    for ( int y = 0; y < size.y; y++ )
+    {
+        for ( int x = 0; x < size.x; x++ )
+        {
+            const unsigned char* const rgb = pal + 3*data[y*size.x + x];
+            if ( wxColour(rgb[0], rgb[1], rgb[2]) !=
+                    wxColour(images[1].GetRed(x, y),
+                             images[1].GetGreen(x, y),
+                             images[1].GetBlue(x, y)) )
+            {
+                FAIL_CHECK("Mismatch at (" << x << ", " << y << ")");
+                return;
+            }
+        }
+    }
+}
+#endif // wxUSE_PALETTE
+
 #endif // wxUSE_GIF
 
 TEST_CASE_METHOD(ImageHandlersInit, "wxImage::DibPadding", "[image]")
@@ -1529,6 +1678,150 @@ TEST_CASE_METHOD(ImageHandlersInit, "wxImage::ScaleCompare", "[image]")
                                "image/cross_nearest_neighb_256x256.png");
 }
 
+#if wxUSE_THREADS
+
+TEST_CASE_METHOD(ImageHandlersInit, "wxImage::Threads", "[image]")
+{
+    wxImage original;
+    REQUIRE(original.LoadFile("horse.png"));
+
+    // Make the image big enough for multiple threads to be really used.
+    original.Rescale(400, 400, wxIMAGE_QUALITY_NEAREST);
+    original.InitAlpha();
+    unsigned char* const alpha = original.GetAlpha();
+    for ( int n = 0; n < 400*400; n++ )
+        alpha[n] = static_cast<unsigned char>(n % 255);
+
+    const wxImageResizeQuality qualities[] =
+    {
+        wxIMAGE_QUALITY_BOX_AVERAGE,
+        wxIMAGE_QUALITY_BILINEAR,
+        wxIMAGE_QUALITY_BICUBIC,
+    };
+
+    const wxSize sizes[] = { wxSize(123, 77), wxSize(640, 480) };
+
+    // Compute all the images using a single thread first.
+    REQUIRE( wxImage::GetDefaultThreadCount() == 1 );
+
+    std::vector<wxImage> expected;
+    for ( const auto quality : qualities )
+    {
+        for ( const auto& size : sizes )
+            expected.push_back(original.Scale(size.x, size.y, quality));
+    }
+
+    const wxImage expectedBlur = original.Blur(7);
+
+    // Now check that using multiple threads gives exactly the same results.
+    wxImage::SetDefaultThreadCount(4);
+    wxON_BLOCK_EXIT1(wxImage::SetDefaultThreadCount, 1);
+
+    size_t n = 0;
+    for ( const auto quality : qualities )
+    {
+        for ( const auto& size : sizes )
+        {
+            INFO("Quality " << quality << ", size " << size.x << "x" << size.y);
+            CHECK_THAT( original.Scale(size.x, size.y, quality),
+                        RGBASameAs(expected[n++]) );
+        }
+    }
+
+    CHECK_THAT( original.Blur(7), RGBASameAs(expectedBlur) );
+}
+
+#endif // wxUSE_THREADS
+
+TEST_CASE_METHOD(ImageHandlersInit, "wxQuantize", "[image][quantize]")
+{
+    wxImage original;
+    REQUIRE(original.LoadFile("horse.png"));
+    original.Rescale(400, 400, wxIMAGE_QUALITY_NEAREST);
+
+    const int flagsToTest[] =
+    {
+        0,
+        wxQUANTIZE_NO_DITHER,
+        wxQUANTIZE_MULTITHREADED,
+        wxQUANTIZE_NO_DITHER | wxQUANTIZE_MULTITHREADED,
+    };
+
+    for ( const auto flags : flagsToTest )
+    {
+        INFO("Flags " << flags);
+
+        wxImage image;
+        REQUIRE( wxQuantize::Quantize(original, image, nullptr, 16, nullptr,
+                                      flags | wxQUANTIZE_FILL_DESTINATION_IMAGE) );
+        REQUIRE( image.GetSize() == original.GetSize() );
+
+        std::set<unsigned long> colours;
+        const unsigned char* p = image.GetData();
+        for ( int n = 0; n < 400*400; n++, p += 3 )
+            colours.insert((p[0] << 16) | (p[1] << 8) | p[2]);
+
+        CHECK( colours.size() <= 16 );
+
+        // The result must not depend on the number of threads used.
+        if ( flags & wxQUANTIZE_MULTITHREADED )
+        {
+            wxImage::SetDefaultThreadCount(4);
+            wxON_BLOCK_EXIT1(wxImage::SetDefaultThreadCount, 1);
+
+            wxImage image4;
+            REQUIRE( wxQuantize::Quantize(original, image4, nullptr, 16, nullptr,
+                                          flags | wxQUANTIZE_FILL_DESTINATION_IMAGE) );
+            CHECK_THAT( image4, RGBSameAs(image) );
+        }
+    }
+}
+
+TEST_CASE_METHOD(ImageHandlersInit, "wxImageResampler", "[image]")
+{
+    wxImage original;
+    REQUIRE(original.LoadFile("horse.png"));
+
+    wxImage withAlpha = original.Copy();
+    withAlpha.InitAlpha();
+    unsigned char* const alpha = withAlpha.GetAlpha();
+    for ( int n = 0; n < withAlpha.GetWidth()*withAlpha.GetHeight(); n++ )
+        alpha[n] = static_cast<unsigned char>(n % 255);
+
+    const wxImageResizeQuality qualities[] =
+    {
+        wxIMAGE_QUALITY_NEAREST,
+        wxIMAGE_QUALITY_BILINEAR,
+        wxIMAGE_QUALITY_BICUBIC,
+        wxIMAGE_QUALITY_BOX_AVERAGE,
+        wxIMAGE_QUALITY_HIGH,
+    };
+
+    const wxSize sizes[] = { wxSize(1, 1), wxSize(41, 29), wxSize(300, 200) };
+
+    for ( const auto quality : qualities )
+    {
+        for ( const auto& size : sizes )
+        {
+            INFO("Quality " << quality << ", size " << size.x << "x" << size.y);
+
+            const wxImageResampler resampler(original.GetSize(), size, quality);
+            CHECK( resampler.GetSourceSize() == original.GetSize() );
+            CHECK( resampler.GetDestSize() == size );
+
+            // The same resampler can be reused for several images.
+            CHECK_THAT( resampler.Scale(original),
+                        RGBSameAs(original.Scale(size.x, size.y, quality)) );
+            CHECK_THAT( resampler.Scale(withAlpha),
+                        RGBASameAs(withAlpha.Scale(size.x, size.y, quality)) );
+        }
+    }
+
+    // Images of wrong size can't be scaled.
+    const wxImageResampler resampler(wxSize(10, 10), wxSize(20, 20));
+    WX_ASSERT_FAILS_WITH_ASSERT( resampler.Scale(original) );
+}
+
 TEST_CASE_METHOD(ImageHandlersInit, "wxImage::CreateBitmapFromCursor", "[image]")
 {
 #if !defined __WXOSX_IPHONE__ && !defined __WXDFB__ && !defined __WXX11__
@@ -2389,6 +2682,47 @@ TEST_CASE_METHOD(ImageHandlersInit, "wxImage::ChangeColours", "[image]")
     CHECK_THAT(test, RGBSimilarToFile("image/toucan_mono_255_255_255.png"));
 }
 
+TEST_CASE_METHOD(ImageHandlersInit, "wxImage::ColourTransform", "[image]")
+{
+    wxImage original;
+    REQUIRE(original.LoadFile("image/toucan.png", wxBITMAP_TYPE_PNG));
+
+    // Applying the transformation must give exactly the same result as
+    // performing all its operations one by one.
+    wxImage expected = original.ConvertToDisabled(240).ChangeLightness(46);
+    expected.ChangeHSV(0.538, -0.41, 0);
+    expected.Replace(0, 0, 0, 1, 2, 3);
+    expected = expected.ConvertToGreyscale(0.2, 0.3, 0.5);
+
+    wxImage test = original;
+    test.ApplyColourTransform(wxImageColourTransform()
+                                .ConvertToDisabled(240)
+                                .ChangeLightness(46)
+                                .RotateHue(0.538)
+                                .ChangeSaturation(-0.41)
+                                .ChangeBrightness(0)
+                                .Replace(0, 0, 0, 1, 2, 3)
+                                .ConvertToGreyscale(0.2, 0.3, 0.5));
+    CHECK_THAT(test, RGBSameAs(expected));
+
+    // An empty transformation doesn't change anything.
+    CHECK( wxImageColourTransform().ChangeBrightness(0).IsEmpty() );
+    test = original;
+    test.ApplyColourTransform(wxImageColourTransform());
+    CHECK_THAT(test, RGBSameAs(original));
+
+    // And the pixels of the mask colour are preserved.
+    wxImage masked(2, 1);
+    masked.SetRGB(0, 0, 10, 20, 30);
+    masked.SetRGB(1, 0, 40, 50, 60);
+    masked.SetMaskColour(10, 20, 30);
+    masked.ApplyColourTransform(wxImageColourTransform().ConvertToDisabled());
+    CHECK( masked.GetRed(0, 0) == 10 );
+    CHECK( masked.GetGreen(0, 0) == 20 );
+    CHECK( masked.GetBlue(0, 0) == 30 );
+    CHECK( masked.GetRed(1, 0) != 40 );
+}
+
 TEST_CASE("wxImage::Clear", "[image]")
 {
     wxImage image(2, 2);
@@ -2417,6 +2751,51 @@ TEST_CASE("wxImage::Clear", "[image]")
     CHECK( image.GetRed(1, 1) == 0xff );
 }
 
+TEST_CASE("wxImage::PremultipliedARGB", "[image]")
+{
+    // Use more pixels than fit into a single SIMD register to test both the
+    // vectorized and the scalar code.
+    wxImage image(11, 2);
+    image.SetAlpha();
+    for ( int x = 0; x < 11; x++ )
+    {
+        image.SetRGB(x, 0, 0xff, 0x80, 0x20);
+        image.SetAlpha(x, 0, wxALPHA_OPAQUE);
+        image.SetRGB(x, 1, 0xff, 0x80, 0x20);
+        image.SetAlpha(x, 1, 0x80);
+    }
+    image.SetAlpha(10, 1, wxALPHA_TRANSPARENT);
+
+    // Use a stride bigger than needed to check that it's taken into account.
+    const int stride = 12*4;
+    wxUint32 data[12*2];
+    image.CopyToPremultipliedARGB(data, stride);
+
+    CHECK( data[0] == 0xffff8020 );
+    CHECK( data[10] == 0xffff8020 );
+    CHECK( data[12] == 0x80804010 );
+    CHECK( data[21] == 0x80804010 );
+    CHECK( data[22] == 0 );
+
+    wxImage image2;
+    REQUIRE( image2.CreateFromPremultipliedARGB(11, 2, data, stride) );
+    REQUIRE( image2.HasAlpha() );
+    CHECK( image2.GetRed(0, 0) == 0xff );
+    CHECK( image2.GetGreen(0, 0) == 0x80 );
+    CHECK( image2.GetBlue(0, 0) == 0x20 );
+    CHECK( image2.GetAlpha(0, 0) == wxALPHA_OPAQUE );
+    CHECK( image2.GetRed(9, 1) == 0xff );
+    CHECK( image2.GetGreen(9, 1) == 0x80 );
+    CHECK( image2.GetBlue(9, 1) == 0x20 );
+    CHECK( image2.GetAlpha(9, 1) == 0x80 );
+    CHECK( image2.GetAlpha(10, 1) == wxALPHA_TRANSPARENT );
+
+    // Images without alpha are opaque.
+    image.ClearAlpha();
+    image.CopyToPremultipliedARGB(data);
+    CHECK( data[21] == 0xffff8020 );
+}
+
 TEST_CASE("wxImage::SizeLimits", "[image]")
 {
 #if SIZEOF_VOID_P == 8
@@ -2429,6 +2808,86 @@ TEST_CASE("wxImage::SizeLimits", "[image]")
 #endif // SIZEOF_VOID_P == 8
 }
 
+TEST_CASE_METHOD(ImageHandlersInit, "wxImage::LoadScaled", "[image][jpeg]")
+{
+    // horse.jpg is 200*200 and libjpeg only supports scaling by powers of 2.
+    wxImage image;
+    image.SetOption(wxIMAGE_OPTION_MAX_WIDTH, 100);
+    REQUIRE( image.LoadFile("horse.jpg", wxBITMAP_TYPE_JPEG) );
+    CHECK( image.GetSize() == wxSize(100, 100) );
+    CHECK( image.GetOptionInt(wxIMAGE_OPTION_ORIGINAL_WIDTH) == 200 );
+    CHECK( image.GetOptionInt(wxIMAGE_OPTION_ORIGINAL_HEIGHT) == 200 );
+
+    wxImage full;
+    REQUIRE( full.LoadFile("horse.jpg", wxBITMAP_TYPE_JPEG) );
+    full.Rescale(100, 100, wxIMAGE_QUALITY_BOX_AVERAGE);
+
+    // The results of scaling during decoding and after it must be close.
+    long diff = 0;
+    const unsigned char* p1 = image.GetData();
+    const unsigned char* p2 = full.GetData();
+    for ( int n = 0; n < 100*100*3; n++ )
+        diff += abs(p1[n] - p2[n]);
+    CHECK( diff / (100*100*3) < 8 );
+
+    image = wxImage();
+    image.SetOption(wxIMAGE_OPTION_MAX_HEIGHT, 60);
+    REQUIRE( image.LoadFile("horse.jpg", wxBITMAP_TYPE_JPEG) );
+    CHECK( image.GetSize() == wxSize(50, 50) );
+}
+
+TEST_CASE_METHOD(ImageHandlersInit, "wxImage::LoadProgress", "[image]")
+{
+    static const struct
+    {
+        const char* file;
+        wxBitmapType type;
+    } files[] =
+    {
+        { "horse.png", wxBITMAP_TYPE_PNG },
+        { "horse.jpg", wxBITMAP_TYPE_JPEG },
+        { "horse.tif", wxBITMAP_TYPE_TIFF },
+        { "horse.bmp", wxBITMAP_TYPE_BMP },
+    };
+
+    for ( const auto& f : files )
+    {
+        INFO("File: " << f.file);
+
+        wxImage expected;
+        if ( !expected.LoadFile(f.file, f.type) )
+        {
+            WARN("Skipping test for " << f.file << " which couldn't be loaded");
+            continue;
+        }
+
+        const int height = expected.GetHeight();
+
+        // Check that all rows are reported exactly once and in order.
+        int next = 0;
+        wxImage image;
+        image.SetLoadProgressFunction([&](const wxImage& img, int y, int h)
+            {
+                CHECK( img.GetHeight() == height );
+                CHECK( y == next );
+                CHECK( h > 0 );
+                next = y + h;
+                return true;
+            });
+        REQUIRE( image.LoadFile(f.file, f.type) );
+        CHECK( next == height );
+        CHECK_THAT( image, RGBASameAs(expected) );
+
+        // And that loading can be cancelled.
+        image.SetLoadProgressFunction([](const wxImage&, int, int)
+            {
+                return false;
+            });
+        CHECK_FALSE( image.LoadFile(f.file, f.type) );
+        CHECK_FALSE( image.IsOk() );
+    }
+}
+
 // This can be used to test loading an arbitrary image file by setting the
 // environment variable WX_TEST_IMAGE_PATH to point to it.
 TEST_CASE_METHOD(ImageHandlersInit, "wxImage::LoadPath", "[.]")
@@ -2498,6 +2957,67 @@ TEST_CASE_METHOD(ImageHandlersInit, "wxImage::Cursor", "[image][cursor]")
 #endif
 }
 
+#if wxUSE_MEDIACTRL
+
+TEST_CASE("wxImage::MediaFrame", "[image][media]")
+{
+    SECTION("RGB")
+    {
+        const unsigned char data[] = { 1, 2, 3,  4, 5, 6 };
+        wxMediaFrame frame(2, 1, "RGB", 0);
+        frame.AddPlane(data, 6);
+
+        // Tightly packed RGB data is used directly.
+        const wxImage image = frame.ToImage();
+        REQUIRE( image.IsOk() );
+        CHECK( image.GetData() == data );
+        CHECK( image.GetBlue(1, 0) == 6 );
+    }
+
+    SECTION("BGRA")
+    {
+        const unsigned char data[] = { 1, 2, 3, 4,  0, 0, 0, 0,  5, 6, 7, 8 };
+        wxMediaFrame frame(1, 2, "BGRA", 0);
+        frame.AddPlane(data, 8);
+
+        const wxImage image = frame.ToImage();
+        REQUIRE( image.IsOk() );
+        CHECK( image.GetRed(0, 0) == 3 );
+        CHECK( image.GetBlue(0, 0) == 1 );
+        CHECK( image.GetRed(0, 1) == 7 );
+        REQUIRE( image.HasAlpha() );
+        CHECK( image.GetAlpha(0, 1) == 8 );
+    }
+
+    SECTION("I420")
+    {
+        // Top row is white and bottom one black, without any colour.
+        const unsigned char y[] = { 235, 235,  16, 16 };
+        const unsigned char u[] = { 128 };
+        const unsigned char v[] = { 128 };
+        wxMediaFrame frame(2, 2, "I420", 0);
+        frame.AddPlane(y, 2);
+        frame.AddPlane(u, 1);
+        frame.AddPlane(v, 1);
+
+        const wxImage image = frame.ToImage();
+        REQUIRE( image.IsOk() );
+        CHECK( image.GetGreen(1, 0) == 255 );
+        CHECK( image.GetGreen(1, 1) == 0 );
+    }
+
+    SECTION("Unsupported")
+    {
+        const unsigned char data[] = { 0, 0, 0, 0 };
+        wxMediaFrame frame(1, 1, "UYVP", 0);
+        frame.AddPlane(data, 4);
+
+        CHECK_FALSE( frame.ToImage().IsOk() );
+    }
+}
+
+#endif // wxUSE_MEDIACTRL
+
 /*
     TODO: add lots of more tests to wxImage functions
 */
@@ -290,6 +290,83 @@ TEST_CASE("wxTranslations::AddCatalog", "[translations]")
     }
 }
 
+TEST_CASE("wxTranslations::LazyLoad", "[translations]")
+{
+    wxFileTranslationsLoader::AddCatalogLookupPathPrefix("./intl");
+
+    const int flagsOrig = wxMsgCatalog::GetDefaultLoadFlags();
+    wxMsgCatalog::SetDefaultLoadFlags(wxMsgCatalog::Load_Lazy);
+
+    wxTranslations trans;
+    trans.SetLanguage(wxLANGUAGE_FRENCH);
+    const bool loaded = trans.AddAvailableCatalog("internat");
+
+    wxMsgCatalog::SetDefaultLoadFlags(flagsOrig);
+
+    REQUIRE( loaded );
+
+    const wxString* s = trans.GetTranslatedString("&Open bogus file", "internat");
+    REQUIRE( s );
+    CHECK( *s == "&Ouvrir un fichier" );
+
+    // Check that looking up the same string again works too.
+    s = trans.GetTranslatedString("&Open bogus file", "internat");
+    REQUIRE( s );
+    CHECK( *s == "&Ouvrir un fichier" );
+
+    // Non-ASCII translations must be converted correctly.
+    s = trans.GetTranslatedString("Enter your number:", "internat");
+    REQUIRE( s );
+    CHECK( *s == wxString::FromUTF8("Entrez votre numéro:") );
+
+    CHECK( !trans.GetTranslatedString("Not translated", "internat") );
+    CHECK( !trans.GetTranslatedString("Not translated", "internat") );
+
+    // The header must be available too.
+    CHECK( trans.GetHeaderValue("Content-Transfer-Encoding", "internat") == "8bit" );
+}
+
+namespace
+{
+
+const wxString& GetCachedTranslation()
+{
+    return wxGETTEXT_CACHED("&Open bogus file");
+}
+
+} // anonymous namespace
+
+TEST_CASE("wxTranslations::Cached", "[translations]")
+{
+    wxFileTranslationsLoader::AddCatalogLookupPathPrefix("./intl");
+
+    // This test changes the global translations object, so don't run it if
+    // it's already used for something else.
+    if ( wxTranslations::Get() )
+    {
+        WARN("Skipping test as global translations object already exists.");
+        return;
+    }
+
+    CHECK( GetCachedTranslation() == "&Open bogus file" );
+
+    wxTranslations* const trans = new wxTranslations;
+    wxTranslations::Set(trans);
+
+    CHECK( GetCachedTranslation() == "&Open bogus file" );
+
+    // Changing the translations must invalidate the cached value.
+    trans->SetLanguage(wxLANGUAGE_FRENCH);
+    REQUIRE( trans->AddAvailableCatalog("internat") );
+    CHECK( GetCachedTranslation() == "&Ouvrir un fichier" );
+
+    // And the cached value must be reused.
+    CHECK( &GetCachedTranslation() == &GetCachedTranslation() );
+
+    wxTranslations::Set(nullptr);
+    CHECK( GetCachedTranslation() == "&Open bogus file" );
+}
+
 TEST_CASE("wxTranslations::GetBestTranslation", "[translations]")
 {
     wxFileTranslationsLoader::AddCatalogLookupPathPrefix("./intl");
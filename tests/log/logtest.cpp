@@ -20,6 +20,8 @@
 
 #include "wx/scopeguard.h"
 
+#include <memory>
+
 #if wxUSE_LOG
 
 #ifdef __WINDOWS__
@@ -360,6 +362,142 @@ void macroCompilabilityTest()
         wxLogDebug("hello debug %d", 42);
 }
 
+#if wxUSE_LOG_TRACE
+
+TEST_CASE("wxLog::TraceMasks", "[log]")
+{
+    std::unique_ptr<TestLog> log(new TestLog);
+    wxLog* const logOld = wxLog::SetActiveTarget(log.get());
+    wxON_BLOCK_EXIT1( wxLog::SetActiveTarget, logOld );
+
+    const wxArrayString masksOld = wxLog::GetTraceMasks();
+    wxLog::ClearTraceMasks();
+    CHECK( !wxLog::HasTraceMasks() );
+
+    // The arguments must not be evaluated when no trace masks are enabled.
+    int evaluated = 0;
+    wxLogTrace("logtest", "%d", ++evaluated);
+    CHECK( evaluated == 0 );
+
+    wxLog::AddTraceMask("logtest");
+    CHECK( wxLog::HasTraceMasks() );
+
+    wxLogTrace("logtest", "%d", ++evaluated);
+    CHECK( evaluated == 1 );
+    CHECK( log->GetLog(wxLOG_Trace) == "(logtest) 1" );
+
+    wxLogTrace("other", "%d", ++evaluated);
+    CHECK( log->GetLog(wxLOG_Trace) == "(logtest) 1" );
+
+    wxLog::RemoveTraceMask("logtest");
+    CHECK( !wxLog::HasTraceMasks() );
+
+    for ( const auto& mask : masksOld )
+        wxLog::AddTraceMask(mask);
+}
+
+#endif // wxUSE_LOG_TRACE
+
+#if wxUSE_THREADS
+
+// Logger storing all the messages and checking that they're logged from the
+// background thread.
+class AsyncTargetLog : public wxLog
+{
+public:
+    AsyncTargetLog() { }
+
+    wxVector<wxString> m_messages;
+    wxVector<wxLogLevel> m_levels;
+    bool m_loggedFromMain = false;
+
+protected:
+    virtual void DoLogRecord(wxLogLevel level,
+                             const wxString& msg,
+                             const wxLogRecordInfo& WXUNUSED(info)) override
+    {
+        if ( wxThread::IsMain() )
+            m_loggedFromMain = true;
+
+        m_messages.push_back(msg);
+        m_levels.push_back(level);
+    }
+
+private:
+    wxDECLARE_NO_COPY_CLASS(AsyncTargetLog);
+};
+
+TEST_CASE("wxLogAsync", "[log]")
+{
+    AsyncTargetLog* const target = new AsyncTargetLog;
+    std::unique_ptr<wxLogAsync> logAsync(new wxLogAsync(target, 16));
+
+    wxLog* const logOld = wxLog::SetActiveTarget(logAsync.get());
+    wxON_BLOCK_EXIT1( wxLog::SetActiveTarget, logOld );
+
+    const bool repetCountingOld = wxLog::GetRepetitionCounting();
+    wxLog::SetRepetitionCounting(false);
+    wxON_BLOCK_EXIT1( wxLog::SetRepetitionCounting, repetCountingOld );
+
+    SECTION("Order")
+    {
+        // Log fewer messages than the queue capacity to ensure that none of
+        // them is discarded.
+        for ( int n = 0; n < 10; n++ )
+            wxLogMessage("Message %d", n);
+
+        wxLog::FlushActive();
+
+        REQUIRE( target->m_messages.size() == 10 );
+        CHECK( target->m_messages[0] == "Message 0" );
+        CHECK( target->m_messages[9] == "Message 9" );
+        CHECK( !target->m_loggedFromMain );
+        CHECK( logAsync->GetDroppedCount() == 0 );
+    }
+
+    SECTION("RateLimit")
+    {
+        logAsync->SetRateLimit(3);
+        CHECK( logAsync->GetRateLimit() == 3 );
+
+        // Use fixed time stamps to avoid depending on the test speed.
+        wxLogRecordInfo info;
+        info.timestampMS = 10000;
+        for ( int n = 0; n < 5; n++ )
+            logAsync->LogRecord(wxLOG_Info, "Info", info);
+
+        // Warnings are never discarded due to the rate limit.
+        logAsync->LogRecord(wxLOG_Warning, "Warning", info);
+
+        // And the limit applies per second.
+        info.timestampMS = 11500;
+        logAsync->LogRecord(wxLOG_Info, "Next second", info);
+
+        logAsync->Flush();
+
+        CHECK( logAsync->GetDroppedCount() == 2 );
+
+        // The number of discarded messages is logged as a warning too, but
+        // we don't know when exactly the background thread does it.
+        REQUIRE( target->m_messages.size() == 6 );
+
+        int infos = 0,
+            warnings = 0;
+        for ( size_t n = 0; n < target->m_messages.size(); n++ )
+        {
+            if ( target->m_levels[n] == wxLOG_Info )
+                infos++;
+            else if ( target->m_levels[n] == wxLOG_Warning )
+                warnings++;
+        }
+
+        CHECK( infos == 4 );
+        CHECK( warnings == 2 );
+    }
+}
+
+#endif // wxUSE_THREADS
+
 // This allows to check wxLogTrace() interactively by running this test with
 // WXTRACE=logtest.
 TEST_CASE("wxLog::Trace", "[log][.]")
@@ -1508,3 +1508,42 @@ TEST_CASE("wxMBConv::cMB2WC", "[mbconv][mb2wc]")
     CHECK( wxConvUTF7.cMB2WC(wxCharBuffer()).length() == 0 );
     CHECK( wxConvUTF7.cMB2WC("+AKM-").length() == 1 );
 }
+
+TEST_CASE("wxMBConv::UTF8Long", "[mbconv][utf8]")
+{
+    // Use strings long enough for the ASCII characters in them to be
+    // converted in blocks, with the non-ASCII characters at all positions.
+    for ( size_t pos = 0; pos < 40; pos++ )
+    {
+        INFO("Non-ASCII character at " << pos);
+
+        std::string utf8(40, 'x');
+        utf8.replace(pos, 1, "\xc3\xa9");
+
+        std::wstring wide(40, L'x');
+        wide[pos] = L'\xe9';
+
+        CHECK( wxConvUTF8.cMB2WC(utf8.c_str()).data() == wide );
+        CHECK( wxConvUTF8.cWC2MB(wide.c_str()).data() == utf8 );
+
+        size_t len = wxConvUTF8.ToWChar(nullptr, 0, utf8.c_str(), utf8.length());
+        CHECK( len == wide.length() );
+
+        // A buffer which is too small must result in an error.
+        wxWCharBuffer wbuf(wide.length());
+        CHECK( wxConvUTF8.ToWChar(wbuf.data(), wide.length() - 1,
+                                  utf8.c_str(), utf8.length()) == wxCONV_FAILED );
+
+        len = wxConvUTF8.FromWChar(nullptr, 0, wide.c_str(), wide.length());
+        CHECK( len == utf8.length() );
+
+        wxCharBuffer buf(utf8.length());
+        CHECK( wxConvUTF8.FromWChar(buf.data(), utf8.length() - 1,
+                                    wide.c_str(), wide.length()) == wxCONV_FAILED );
+
+        // Invalid sequences must still be detected.
+        std::string invalid(utf8);
+        invalid[pos] = '\x80';
+        CHECK( wxConvUTF8.ToWChar(nullptr, 0, invalid.c_str()) == wxCONV_FAILED );
+    }
+}
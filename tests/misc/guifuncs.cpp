@@ -23,8 +23,10 @@
 #include "wx/app.h"
 #include "wx/button.h"
 #include "wx/clipbrd.h"
+#include "wx/cmdproc.h"
 #include "wx/dataobj.h"
 #include "wx/panel.h"
+#include "wx/stream.h"
 
 #include "asserthelper.h"
 
@@ -75,6 +77,61 @@ TEST_CASE("GUI::TextDataObject", "[guifuncs][clipboard]")
     CHECK( dobj2.GetText() == text );
 }
 
+TEST_CASE("GUI::DataProvider", "[guifuncs][clipboard]")
+{
+    int calls = 0;
+
+    SECTION("Text")
+    {
+        const wxString text("Lazily created text");
+
+        wxTextDataObject dobj;
+        dobj.SetTextProvider([&]() { ++calls; return text; });
+        CHECK( calls == 0 );
+
+        const wxDataFormat format = dobj.GetPreferredFormat();
+        const size_t size = dobj.GetDataSize(format);
+        CHECK( calls == 1 );
+
+        wxCharBuffer buf(size);
+        CHECK( dobj.GetDataHere(format, buf.data()) );
+        CHECK( dobj.GetText() == text );
+        CHECK( calls == 1 );
+
+        dobj.SetTextProvider([&]() { ++calls; return wxString("Unused"); });
+        dobj.SetText(text);
+        CHECK( dobj.GetText() == text );
+        CHECK( calls == 1 );
+    }
+
+    SECTION("Custom")
+    {
+        wxCustomDataObject dobj(wxDataFormat("wxtest/data-provider"));
+        dobj.SetDataProvider([&]()
+        {
+            ++calls;
+
+            wxMemoryBuffer buf;
+            buf.AppendData("0123456789", 10);
+            return buf;
+        });
+        CHECK( calls == 0 );
+
+        REQUIRE( dobj.GetDataSize() == 10 );
+        CHECK( calls == 1 );
+
+        char buf[10];
+        CHECK( dobj.GetDataHere(buf) );
+        CHECK( memcmp(buf, "0123456789", 10) == 0 );
+        CHECK( calls == 1 );
+
+        dobj.SetDataProvider([&]() { ++calls; return wxMemoryBuffer(); });
+        dobj.SetData(3, "abc");
+        CHECK( dobj.GetDataSize() == 3 );
+        CHECK( calls == 1 );
+    }
+}
+
 TEST_CASE("GUI::URLDataObject", "[guifuncs][clipboard]")
 {
     // this tests for buffer overflow, see #11102
@@ -270,3 +327,137 @@ TEST_CASE("wxWindow::Dump", "[window]")
     CHECK_THAT( s, Catch::Contains("wxButton") );
     CHECK_THAT( s, Catch::Contains("bloordyblop") );
 }
+
+namespace
+{
+
+// Command appending the given text to the document.
+class AppendCommand : public wxCommand
+{
+public:
+    AppendCommand(wxString& doc, const wxString& text)
+        : wxCommand(true, "Append"),
+          m_doc(doc),
+          m_text(text)
+    {
+    }
+
+    bool Do() override { m_doc += m_text; return true; }
+
+    bool Undo() override
+    {
+        m_doc.erase(m_doc.length() - m_text.length());
+        return true;
+    }
+
+    size_t GetMemoryUsage() const override { return m_text.length(); }
+
+    bool MergeWith(const wxCommand& command) override
+    {
+        const AppendCommand&
+            other = static_cast<const AppendCommand&>(command);
+
+        // Merge single characters only.
+        if ( other.m_text.length() != 1 )
+            return false;
+
+        m_text += other.m_text;
+        return true;
+    }
+
+    bool CanSpill() const override { return true; }
+
+    bool SpillToStream(wxOutputStream& stream) override
+    {
+        const wxScopedCharBuffer buf = m_text.utf8_str();
+        if ( !stream.WriteAll(buf.data(), buf.length()) )
+            return false;
+
+        m_text.clear();
+        return true;
+    }
+
+    bool RestoreFromStream(wxInputStream& stream) override
+    {
+        char buf[256];
+        stream.Read(buf, sizeof(buf));
+        m_text = wxString::FromUTF8(buf, stream.LastRead());
+        return true;
+    }
+
+private:
+    wxString& m_doc;
+    wxString m_text;
+};
+
+} // anonymous namespace
+
+TEST_CASE("GUI::CommandProcessor", "[guifuncs][cmdproc]")
+{
+    wxString doc;
+    wxCommandProcessor proc;
+
+    proc.Submit(new AppendCommand(doc, "Hello"));
+    proc.Submit(new AppendCommand(doc, ","));
+    proc.Submit(new AppendCommand(doc, " "));
+    CHECK( doc == "Hello, " );
+
+    SECTION("Merge")
+    {
+        // Single characters were merged into the first command.
+        CHECK( proc.GetCommands().GetCount() == 1 );
+        CHECK( proc.GetMemoryUsage() == 7 );
+
+        proc.MarkAsSaved();
+        proc.Submit(new AppendCommand(doc, "!"));
+
+        // But not after saving.
+        CHECK( proc.GetCommands().GetCount() == 2 );
+
+        CHECK( proc.Undo() );
+        CHECK( doc == "Hello, " );
+        CHECK( !proc.IsDirty() );
+
+        CHECK( proc.Undo() );
+        CHECK( doc.empty() );
+    }
+
+    SECTION("Limit")
+    {
+        proc.Submit(new AppendCommand(doc, "world"));
+        proc.Submit(new AppendCommand(doc, "again"));
+        CHECK( proc.GetCommands().GetCount() == 3 );
+        CHECK( proc.GetMemoryUsage() == 17 );
+
+        proc.SetMaxMemoryUsage(12);
+        CHECK( proc.GetCommands().GetCount() == 2 );
+        CHECK( proc.GetMemoryUsage() == 10 );
+
+        // The current command is always kept.
+        proc.SetMaxMemoryUsage(1);
+        CHECK( proc.GetCommands().GetCount() == 1 );
+        CHECK( proc.CanUndo() );
+
+        proc.ClearCommands();
+        CHECK( proc.GetMemoryUsage() == 0 );
+    }
+
+    SECTION("Spill")
+    {
+        proc.EnableSpilling();
+        proc.SetMaxMemoryUsage(6);
+        proc.Submit(new AppendCommand(doc, "world"));
+        CHECK( doc == "Hello, world" );
+
+        // The first command was spilled to disk instead of being deleted.
+        CHECK( proc.GetCommands().GetCount() == 2 );
+        CHECK( proc.GetMemoryUsage() == 5 );
+
+        CHECK( proc.Undo() );
+        CHECK( proc.Undo() );
+        CHECK( doc.empty() );
+
+        CHECK( proc.Redo() );
+        CHECK( doc == "Hello, " );
+    }
+}
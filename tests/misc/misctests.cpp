@@ -18,8 +18,12 @@
 
 #include "wx/math.h"
 #include "wx/mimetype.h"
+#include "wx/threadpool.h"
 #include "wx/versioninfo.h"
 
+#include <future>
+#include <vector>
+
 // just some classes using wxRTTI for wxStaticCast() test
 #include "wx/tarstrm.h"
 #include "wx/zipstrm.h"
@@ -165,9 +169,141 @@ TEST_CASE("RTTI::ClassInfo", "[rtti]")
 #if wxUSE_ZIPSTREAM
     wxZipEntry zipEntry;
     CHECK( zipEntry.GetClassInfo()->IsKindOf(wxCLASSINFO(wxArchiveEntry)) );
+    CHECK( !wxCLASSINFO(wxArchiveEntry)->IsKindOf(wxCLASSINFO(wxZipEntry)) );
 #endif // wxUSE_ZIPSTREAM
 }
 
+TEST_CASE("RTTI::FindClass", "[rtti]")
+{
+    CHECK( wxClassInfo::FindClass("wxObject") == wxCLASSINFO(wxObject) );
+    CHECK( wxClassInfo::FindClass("wxArchiveEntry") == wxCLASSINFO(wxArchiveEntry) );
+    CHECK( wxClassInfo::FindClass("wxNoSuchClass") == nullptr );
+
+    // Check that iterating over all classes returns them in sorted order and
+    // that IsKindOf() is consistent with walking the base classes.
+    const wxClassInfo* prev = nullptr;
+    size_t count = 0;
+    for ( wxClassInfo::const_iterator it = wxClassInfo::begin_classinfo(),
+                                      end = wxClassInfo::end_classinfo();
+          it != end;
+          ++it )
+    {
+        const wxClassInfo* const info = *it;
+        if ( prev )
+            CHECK( wxStrcmp(prev->GetClassName(), info->GetClassName()) < 0 );
+        prev = info;
+        ++count;
+
+        CHECK( info->IsKindOf(info) );
+        CHECK( info->IsKindOf(wxCLASSINFO(wxObject)) ==
+                (info == wxCLASSINFO(wxObject) ||
+                    (info->GetBaseClass1() &&
+                        info->GetBaseClass1()->IsKindOf(wxCLASSINFO(wxObject))) ||
+                    (info->GetBaseClass2() &&
+                        info->GetBaseClass2()->IsKindOf(wxCLASSINFO(wxObject)))) );
+    }
+
+    CHECK( count > 1 );
+}
+
+namespace
+{
+
+// Minimal copy-on-write class used to test wxObject ref counting.
+class CowData : public wxObjectRefData
+{
+public:
+    explicit CowData(int value) : m_value(value) { }
+
+    int m_value;
+};
+
+class CowObject : public wxObject
+{
+public:
+    explicit CowObject(int value) { m_refData = new CowData(value); }
+
+    int GetValue() const { return static_cast<CowData*>(m_refData)->m_value; }
+
+    void SetValue(int value)
+    {
+        AllocExclusive();
+        static_cast<CowData*>(m_refData)->m_value = value;
+    }
+
+protected:
+    virtual wxObjectRefData* CreateRefData() const override
+    {
+        return new CowData(0);
+    }
+
+    virtual wxObjectRefData*
+    CloneRefData(const wxObjectRefData* data) const override
+    {
+        return new CowData(static_cast<const CowData*>(data)->m_value);
+    }
+};
+
+} // anonymous namespace
+
+TEST_CASE("wxObject::RefData", "[rtti][refcount]")
+{
+    CowObject obj(17);
+    CHECK( !obj.GetRefData()->IsMTSafe() );
+    CHECK( obj.GetRefData()->GetRefCount() == 1 );
+
+    CowObject copy(obj);
+    CHECK( copy.IsSameAs(obj) );
+    CHECK( obj.GetRefData()->GetRefCount() == 2 );
+
+    copy.SetValue(42);
+    CHECK( !copy.IsSameAs(obj) );
+    CHECK( obj.GetRefData()->GetRefCount() == 1 );
+    CHECK( copy.GetRefData()->GetRefCount() == 1 );
+    CHECK( obj.GetValue() == 17 );
+    CHECK( copy.GetValue() == 42 );
+
+    SECTION("MT-safe")
+    {
+        obj.SetRefDataMTSafe();
+        CHECK( obj.GetRefData()->IsMTSafe() );
+
+        // The data copied on write must remain MT-safe.
+        copy = obj;
+        copy.SetValue(99);
+        CHECK( copy.GetRefData()->IsMTSafe() );
+        CHECK( obj.GetValue() == 17 );
+
+#if wxUSE_THREADS
+        // Copy and destroy the shared object concurrently in several threads
+        // and check that the ref count is correct at the end.
+        std::vector<std::future<bool>> results;
+        for ( int n = 0; n < 8; n++ )
+        {
+            results.push_back(wxThreadPool::Get().Submit([&obj]()
+            {
+                for ( int i = 0; i < 10000; i++ )
+                {
+                    CowObject tmp(obj);
+                    if ( tmp.GetValue() != 17 )
+                        return false;
+                }
+
+                // Modifying our copy must not affect the other threads.
+                CowObject mine(obj);
+                mine.SetValue(0);
+                return mine.GetValue() == 0 && obj.GetValue() == 17;
+            }));
+        }
+
+        for ( auto& result : results )
+            CHECK( result.get() );
+
+        CHECK( obj.GetRefData()->GetRefCount() == 1 );
+#endif // wxUSE_THREADS
+    }
+}
+
 TEST_CASE("wxCTZ", "[math]")
 {
     CHECK( wxCTZ(1) == 0 );
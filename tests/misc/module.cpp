@@ -87,6 +87,42 @@ ModuleD::ModuleD()
 {
 }
 
+// Lazy modules use a separate string to avoid interfering with the test above.
+wxString g_strLazyLoadOrder;
+
+class LazyModule : public wxModule
+{
+protected:
+    LazyModule() { SetLazy(); }
+
+    virtual bool OnInit() override { g_strLazyLoadOrder += GetClassInfo()->GetClassName(); return true; }
+    virtual void OnExit() override { }
+};
+
+class LazyModuleA : public LazyModule
+{
+public:
+    LazyModuleA();
+private:
+    wxDECLARE_DYNAMIC_CLASS(LazyModuleA);
+};
+
+class LazyModuleB : public LazyModule
+{
+public:
+    LazyModuleB() { }
+private:
+    wxDECLARE_DYNAMIC_CLASS(LazyModuleB);
+};
+
+wxIMPLEMENT_DYNAMIC_CLASS(LazyModuleA, wxModule);
+LazyModuleA::LazyModuleA()
+{
+    AddDependency(CLASSINFO(LazyModuleB));
+}
+
+wxIMPLEMENT_DYNAMIC_CLASS(LazyModuleB, wxModule);
+
 // ----------------------------------------------------------------------------
 // tests themselves
 // ----------------------------------------------------------------------------
@@ -102,3 +138,17 @@ TEST_CASE("wxModule::LoadOrder", "[module]")
     // module D is the only one with no dependencies and so should load as first (and so on):
     CHECK( g_strLoadOrder == "ModuleDModuleCModuleBModuleA" );
 }
+
+TEST_CASE("wxModule::Lazy", "[module]")
+{
+    // Lazy modules are not initialized on startup.
+    CHECK( g_strLazyLoadOrder == "" );
+
+    // But are initialized, together with their dependencies, on demand.
+    CHECK( wxModule::InitializeLazyModules(CLASSINFO(LazyModuleA)) );
+    CHECK( g_strLazyLoadOrder == "LazyModuleBLazyModuleA" );
+
+    // And only once.
+    CHECK( wxModule::InitializeLazyModules(CLASSINFO(LazyModuleB)) );
+    CHECK( g_strLazyLoadOrder == "LazyModuleBLazyModuleA" );
+}
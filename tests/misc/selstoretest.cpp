@@ -166,3 +166,62 @@ TEST_CASE_METHOD(SelStoreTest, "wxSelectionStore::InsertInSelected", "[selstore]
     CHECK( !m_store.IsSelected(3) );
     CHECK( m_store.GetSelectedCount() == NUM_ITEMS );
 }
+
+TEST_CASE_METHOD(SelStoreTest, "wxSelectionStore::IterateRanges", "[selstore]")
+{
+    wxSelectionStore::IterationState cookie;
+    unsigned from, to;
+    CHECK( !m_store.GetFirstSelectedRange(cookie, from, to) );
+
+    // Select every other item: there should be no merging of the ranges.
+    for ( unsigned n = 0; n < NUM_ITEMS; n += 2 )
+        m_store.SelectItem(n);
+
+    CHECK( m_store.GetSelectedCount() == NUM_ITEMS/2 );
+
+    unsigned numRanges = 0;
+    for ( bool cont = m_store.GetFirstSelectedRange(cookie, from, to);
+          cont;
+          cont = m_store.GetNextSelectedRange(cookie, from, to) )
+    {
+        CHECK( from == 2*numRanges );
+        CHECK( to == from );
+        numRanges++;
+    }
+
+    CHECK( numRanges == NUM_ITEMS/2 );
+
+    // Filling the holes should result in a single range.
+    m_store.SelectRange(1, NUM_ITEMS - 3);
+    REQUIRE( m_store.GetFirstSelectedRange(cookie, from, to) );
+    CHECK( from == 0 );
+    CHECK( to == NUM_ITEMS - 2 );
+    CHECK( !m_store.GetNextSelectedRange(cookie, from, to) );
+
+    // And this must work when most of items are selected too.
+    m_store.SelectRange(0, NUM_ITEMS - 1);
+    m_store.SelectItem(NUM_ITEMS/2, false);
+    REQUIRE( m_store.GetFirstSelectedRange(cookie, from, to) );
+    CHECK( from == 0 );
+    CHECK( to == NUM_ITEMS/2 - 1 );
+    REQUIRE( m_store.GetNextSelectedRange(cookie, from, to) );
+    CHECK( from == NUM_ITEMS/2 + 1 );
+    CHECK( to == NUM_ITEMS - 1 );
+    CHECK( !m_store.GetNextSelectedRange(cookie, from, to) );
+}
+
+TEST_CASE_METHOD(SelStoreTest, "wxSelectionStore::FindSelectedItem", "[selstore]")
+{
+    CHECK( m_store.FindSelectedItem(0) == wxSelectionStore::NO_SELECTION );
+
+    m_store.SelectRange(2, 4);
+    CHECK( m_store.FindSelectedItem(0) == 2 );
+    CHECK( m_store.FindSelectedItem(3) == 3 );
+    CHECK( m_store.FindSelectedItem(5) == wxSelectionStore::NO_SELECTION );
+
+    m_store.SelectRange(0, NUM_ITEMS - 1);
+    m_store.SelectRange(0, 2, false);
+    CHECK( m_store.FindSelectedItem(0) == 3 );
+    CHECK( m_store.FindSelectedItem(NUM_ITEMS - 1) == NUM_ITEMS - 1 );
+    CHECK( m_store.FindSelectedItem(NUM_ITEMS) == wxSelectionStore::NO_SELECTION );
+}
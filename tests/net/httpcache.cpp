@@ -0,0 +1,259 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        tests/net/httpcache.cpp
+// Purpose:     wxHTTPCache unit tests
+// Author:      wxWidgets team
+// Created:     2026-10-14
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+// ----------------------------------------------------------------------------
+// headers
+// ----------------------------------------------------------------------------
+
+#include "testprec.h"
+
+
+#if wxUSE_FILE
+
+#include "wx/httpcache.h"
+#include "wx/filename.h"
+
+#include <map>
+
+namespace
+{
+
+// Headers of a fake response.
+class Headers
+{
+public:
+    Headers& Add(const wxString& name, const wxString& value)
+    {
+        m_headers[name] = value;
+        return *this;
+    }
+
+    wxHTTPCache::HeaderGetter Getter() const
+    {
+        return [this](const wxString& name)
+        {
+            const auto it = m_headers.find(name);
+            return it == m_headers.end() ? wxString() : it->second;
+        };
+    }
+
+private:
+    std::map<wxString, wxString> m_headers;
+};
+
+bool Store(wxHTTPCache& cache, const wxString& url,
+           const Headers& headers, const char* data)
+{
+    return cache.Store(url, headers.Getter(), data, strlen(data));
+}
+
+wxString GetData(const wxHTTPCacheEntry& entry)
+{
+    return wxString::FromUTF8(static_cast<const char*>(entry.data.GetData()),
+                              entry.data.GetDataLen());
+}
+
+// Temporary directory deleted, with all its contents, on scope exit.
+class TempDir
+{
+public:
+    TempDir()
+    {
+        m_path = wxFileName::CreateTempFileName("wxtest");
+        wxRemoveFile(m_path);
+        m_path += "-dir";
+    }
+
+    ~TempDir()
+    {
+        if ( wxDirExists(m_path) )
+            wxFileName::Rmdir(m_path, wxPATH_RMDIR_RECURSIVE);
+    }
+
+    const wxString& GetPath() const { return m_path; }
+
+private:
+    wxString m_path;
+
+    wxDECLARE_NO_COPY_CLASS(TempDir);
+};
+
+const char* const URL = "http://www.example.com/";
+
+} // anonymous namespace
+
+TEST_CASE("wxHTTPCache::Freshness", "[net][httpcache]")
+{
+    wxHTTPCache cache;
+    wxHTTPCacheEntry entry;
+
+    CHECK( cache.Find(URL) == wxHTTPCache::Status_Miss );
+
+    SECTION("max-age")
+    {
+        REQUIRE( Store(cache, URL,
+                       Headers().Add("Cache-Control", "public, max-age=3600")
+                                .Add("Content-Type", "text/plain"),
+                       "Hello") );
+
+        CHECK( cache.Find(URL, &entry) == wxHTTPCache::Status_Fresh );
+        CHECK( GetData(entry) == "Hello" );
+        CHECK( entry.contentType == "text/plain" );
+        CHECK( cache.GetSize() == 5 );
+    }
+
+    SECTION("no-store")
+    {
+        CHECK_FALSE( Store(cache, URL,
+                           Headers().Add("Cache-Control", "no-store")
+                                    .Add("ETag", "\"1\""),
+                           "Hello") );
+        CHECK( cache.Find(URL) == wxHTTPCache::Status_Miss );
+    }
+
+    SECTION("no-cache")
+    {
+        REQUIRE( Store(cache, URL,
+                       Headers().Add("Cache-Control", "no-cache, max-age=3600")
+                                .Add("ETag", "\"1\""),
+                       "Hello") );
+
+        CHECK( cache.Find(URL, &entry) == wxHTTPCache::Status_Stale );
+        CHECK( entry.eTag == "\"1\"" );
+        CHECK( GetData(entry) == "Hello" );
+    }
+
+    SECTION("Expired")
+    {
+        // Stale responses without validators are useless.
+        CHECK_FALSE( Store(cache, URL,
+                           Headers().Add("Expires", "0"),
+                           "Hello") );
+
+        REQUIRE( Store(cache, URL,
+                       Headers().Add("Cache-Control", "max-age=0")
+                                .Add("Last-Modified",
+                                     "Sun, 06 Nov 1994 08:49:37 GMT"),
+                       "Hello") );
+
+        CHECK( cache.Find(URL, &entry) == wxHTTPCache::Status_Stale );
+        CHECK( entry.lastModified == "Sun, 06 Nov 1994 08:49:37 GMT" );
+    }
+
+    SECTION("Vary")
+    {
+        CHECK_FALSE( Store(cache, URL,
+                           Headers().Add("Cache-Control", "max-age=3600")
+                                    .Add("Vary", "*"),
+                           "Hello") );
+    }
+}
+
+TEST_CASE("wxHTTPCache::Revalidate", "[net][httpcache]")
+{
+    wxHTTPCache cache;
+    wxHTTPCacheEntry entry;
+
+    CHECK_FALSE( cache.Revalidate(URL, Headers().Getter()) );
+
+    REQUIRE( Store(cache, URL,
+                   Headers().Add("Cache-Control", "max-age=0")
+                            .Add("ETag", "\"1\""),
+                   "Hello") );
+    CHECK( cache.Find(URL) == wxHTTPCache::Status_Stale );
+
+    REQUIRE( cache.Revalidate(URL,
+                              Headers().Add("Cache-Control", "max-age=3600")
+                                       .Add("ETag", "\"2\"").Getter(),
+                              &entry) );
+    CHECK( GetData(entry) == "Hello" );
+    CHECK( entry.eTag == "\"2\"" );
+
+    CHECK( cache.Find(URL) == wxHTTPCache::Status_Fresh );
+
+    // Revalidation forbidding storing the response removes it.
+    REQUIRE( cache.Revalidate(URL,
+                              Headers().Add("Cache-Control", "no-store").Getter(),
+                              &entry) );
+    CHECK( GetData(entry) == "Hello" );
+    CHECK( cache.Find(URL) == wxHTTPCache::Status_Miss );
+}
+
+TEST_CASE("wxHTTPCache::Evict", "[net][httpcache]")
+{
+    wxHTTPCache cache(wxString(), 10);
+
+    Headers headers;
+    headers.Add("Cache-Control", "max-age=3600");
+
+    CHECK_FALSE( Store(cache, "http://example.com/big", headers, "Too big data") );
+
+    REQUIRE( Store(cache, "http://example.com/1", headers, "1111") );
+    REQUIRE( Store(cache, "http://example.com/2", headers, "2222") );
+
+    // Make the first one the most recently used.
+    CHECK( cache.Find("http://example.com/1") == wxHTTPCache::Status_Fresh );
+
+    REQUIRE( Store(cache, "http://example.com/3", headers, "3333") );
+    CHECK( cache.GetCount() == 2 );
+    CHECK( cache.GetSize() == 8 );
+    CHECK( cache.Find("http://example.com/1") == wxHTTPCache::Status_Fresh );
+    CHECK( cache.Find("http://example.com/2") == wxHTTPCache::Status_Miss );
+    CHECK( cache.Find("http://example.com/3") == wxHTTPCache::Status_Fresh );
+
+    cache.SetMaxSize(4);
+    CHECK( cache.GetCount() == 1 );
+    CHECK( cache.Find("http://example.com/1") == wxHTTPCache::Status_Miss );
+
+    cache.Clear();
+    CHECK( cache.GetCount() == 0 );
+    CHECK( cache.GetSize() == 0 );
+}
+
+TEST_CASE("wxHTTPCache::Disk", "[net][httpcache]")
+{
+    TempDir dir;
+
+    Headers headers;
+    headers.Add("Cache-Control", "max-age=3600")
+           .Add("Content-Type", "text/html; charset=utf-8")
+           .Add("ETag", "\"abc\"");
+
+    {
+        wxHTTPCache cache(dir.GetPath());
+
+        // Don't keep anything in memory to check that reading the data from
+        // disk works.
+        cache.SetMaxMemorySize(0);
+
+        REQUIRE( Store(cache, URL, headers, "Hello") );
+        REQUIRE( Store(cache, "http://example.com/other", headers, "Bye") );
+
+        wxHTTPCacheEntry entry;
+        REQUIRE( cache.Find(URL, &entry) == wxHTTPCache::Status_Fresh );
+        CHECK( GetData(entry) == "Hello" );
+
+        cache.Remove("http://example.com/other");
+    }
+
+    wxHTTPCache cache(dir.GetPath());
+    CHECK( cache.GetCount() == 1 );
+    CHECK( cache.GetSize() == 5 );
+
+    wxHTTPCacheEntry entry;
+    REQUIRE( cache.Find(URL, &entry) == wxHTTPCache::Status_Fresh );
+    CHECK( GetData(entry) == "Hello" );
+    CHECK( entry.contentType == "text/html; charset=utf-8" );
+    CHECK( entry.eTag == "\"abc\"" );
+
+    cache.Clear();
+    CHECK( wxHTTPCache(dir.GetPath()).GetCount() == 0 );
+}
+
+#endif // wxUSE_FILE
@@ -15,6 +15,7 @@
 #if wxUSE_REGEX
 
 #include "wx/regex.h"
+#include "wx/sstream.h"
 #include "wx/tokenzr.h"
 #include <string>
 
@@ -131,6 +132,24 @@ TEST_CASE("wxRegEx::Match", "[regex][match]")
         "Fri Jul 13 18:37:52 CEST 2001\tFri\tJul\t13\t2001");
 }
 
+TEST_CASE("wxRegEx::MatchLength", "[regex][match]")
+{
+    wxRegEx re("bar$");
+    REQUIRE( re.IsValid() );
+
+    // Only the given part of the text must be taken into account.
+    const wxString text("foobarbaz");
+    CHECK( re.Matches(text.wc_str(), 0, 6) );
+    CHECK_FALSE( re.Matches(text.wc_str(), 0, 7) );
+    CHECK_FALSE( re.Matches(text.wc_str(), 0, 5) );
+
+    size_t start, len;
+    REQUIRE( re.Matches(text.wc_str(), 0, 6) );
+    REQUIRE( re.GetMatch(&start, &len) );
+    CHECK( start == 3 );
+    CHECK( len == 3 );
+}
+
 static void
 CheckReplace(const char* pattern,
              const char* original,
@@ -196,6 +215,94 @@ TEST_CASE("wxRegEx::Unicode", "[regex][unicode]")
     CHECK( re.GetMatch(cyrillicSmallA) == cyrillicSmallA );
 }
 
+TEST_CASE("wxRegEx::JIT", "[regex][jit]")
+{
+    // JIT compilation is optional, so this test just checks that using it
+    // doesn't change the results.
+    wxRegEx re("([[:alpha:]]+)=([0-9]+)", wxRE_JIT);
+    REQUIRE( re.IsValid() );
+
+    const wxString text(L"x=1 \u0444\u0443=22 y=333");
+    REQUIRE( re.Matches(text) );
+    CHECK( re.GetMatch(text, 1) == "x" );
+    CHECK( re.GetMatch(text, 2) == "1" );
+
+    // Replacing all matches in a non-ASCII string exercises the code skipping
+    // the UTF validity checks after the first match.
+    wxString replaced(text);
+    CHECK( re.ReplaceAll(&replaced, "\\2:\\1") == 3 );
+    CHECK( replaced == wxString(L"1:x 22:\u0444\u0443 333:y") );
+}
+
+TEST_CASE("wxRegEx::ForEachMatch", "[regex][match]")
+{
+    wxRegEx re("([a-z]+)([0-9]*)");
+    REQUIRE( re.IsValid() );
+
+    const wxString text("foo1 bar22 \\baz");
+
+    wxString found;
+    size_t count = re.ForEachMatch(text, [&](size_t start, size_t len)
+        {
+            found << start << ":" << len << " ";
+            return true;
+        });
+    CHECK( count == 3 );
+    CHECK( found == "0:4 5:5 12:3 " );
+
+    count = re.ForEachMatch(text, [](size_t, size_t) { return true; }, 0, 2);
+    CHECK( count == 2 );
+
+    // Returning false from the function stops the iteration.
+    count = re.ForEachMatch(text, [](size_t, size_t) { return false; });
+    CHECK( count == 1 );
+
+    // Assertions take the preceding text into account.
+    wxRegEx reWord("\\<[a-z]");
+    REQUIRE( reWord.IsValid() );
+    CHECK( reWord.ForEachMatch("ab cd", [](size_t, size_t) { return true; }) == 2 );
+
+    // Empty matches must not result in an infinite loop.
+    wxRegEx reEmpty("x*");
+    REQUIRE( reEmpty.IsValid() );
+
+    found.clear();
+    count = reEmpty.ForEachMatch("axxb", [&](size_t start, size_t len)
+        {
+            found << start << ":" << len << " ";
+            return true;
+        });
+    CHECK( count == 4 );
+    CHECK( found == "0:0 1:2 3:0 4:0 " );
+}
+
+#if wxUSE_STREAMS
+
+TEST_CASE("wxRegEx::ReplaceToStream", "[regex][replace]")
+{
+    wxRegEx re("([a-z]+)[^0-9]*([0-9]+)");
+    REQUIRE( re.IsValid() );
+
+    const wxString text(L"foo123_\u0444\u0443456_bar789");
+    const wxString replacement("<\\2&\\1>");
+
+    wxString expected(text);
+    REQUIRE( re.ReplaceAll(&expected, replacement) == 2 );
+
+    wxStringOutputStream out;
+    CHECK( re.ReplaceToStream(text, replacement, out) == 2 );
+    CHECK( out.GetString() == expected );
+
+    wxStringOutputStream outFirst;
+    CHECK( re.ReplaceToStream(text, replacement, outFirst, 1) == 1 );
+
+    expected = text;
+    REQUIRE( re.ReplaceFirst(&expected, replacement) == 1 );
+    CHECK( outFirst.GetString() == expected );
+}
+
+#endif // wxUSE_STREAMS
+
 // This pseudo test can be used just to see the version of PCRE being used.
 TEST_CASE("wxRegEx::GetLibraryVersionInfo", "[.]")
 {
@@ -270,3 +270,73 @@ TEST_CASE("RowHeightCacheTestCase::TestHeightCache", "[dataview][heightcache]")
     CHECK(hc.GetLineAt(22180, row) == false);
     CHECK(row == 666);
 }
+
+// ----------------------------------------------------------------------------
+// TestHeightCacheScale
+// ----------------------------------------------------------------------------
+TEST_CASE("RowHeightCacheTestCase::TestHeightCacheScale", "[dataview][heightcache]")
+{
+    // Use enough rows for the test to take a very long time if any of the
+    // operations were linear in the number of rows.
+    const unsigned int count = 1000000;
+
+    HeightCache hc;
+
+    // Use heights of 20, 21, ..., 29 pixels for the rows, so that the sum of
+    // the heights of any 10 consecutive rows is 245.
+    for (unsigned int i = 0; i < count; i++)
+    {
+        hc.Put(i, 20 + i % 10);
+    }
+
+    CHECK(hc.GetValidCount() == count);
+
+    int start = 0;
+    int height = 0;
+    unsigned int row = 0;
+
+    for (unsigned int i = 0; i < count; i += 997)
+    {
+        INFO("row = " << i);
+
+        const int expected = 245*(i / 10) + (i % 10)*(39 + i % 10)/2;
+
+        REQUIRE(hc.GetLineInfo(i, start, height));
+        CHECK(start == expected);
+        CHECK(height == static_cast<int>(20 + i % 10));
+
+        REQUIRE(hc.GetLineAt(start + height - 1, row));
+        CHECK(row == i);
+    }
+
+    // Invalidate the rows repeatedly, as it happens when expanding or
+    // collapsing the items, and cache them again.
+    for (unsigned int i = count - 1; i > 0; i /= 2)
+    {
+        hc.Remove(i);
+        CHECK(hc.GetValidCount() == i);
+        CHECK(!hc.GetLineHeight(i, height));
+
+        hc.Put(i, 100);
+        REQUIRE(hc.GetLineStart(i, start));
+        CHECK(hc.GetLineAt(start + 99, row));
+        CHECK(row == i);
+        CHECK(!hc.GetLineAt(start + 100, row));
+    }
+
+    // Changing the height of a row in the middle must update the positions
+    // of all rows after it.
+    hc.Put(2000, 32);
+    for (unsigned int i = 1; i < 2000; i++)
+    {
+        hc.Put(i, 20 + i % 10);
+    }
+
+    REQUIRE(hc.GetValidCount() == 2001);
+    REQUIRE(hc.GetLineStart(2000, start));
+    CHECK(start == 49000);
+
+    hc.Put(1000, 21);
+    REQUIRE(hc.GetLineStart(2000, start));
+    CHECK(start == 49001);
+}
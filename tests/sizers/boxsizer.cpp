@@ -19,6 +19,8 @@
     #include "wx/listbox.h"
 #endif // WX_PRECOMP
 
+#include "wx/scopeguard.h"
+
 #include "asserthelper.h"
 
 #include <memory>
@@ -448,6 +450,78 @@ TEST_CASE_METHOD(BoxSizerTestCase, "BoxSizer::Replace", "[sizer]")
     m_sizer->Replace(0, new wxSizerItem(new wxWindow(m_win, wxID_ANY)));
 }
 
+namespace
+{
+
+// Sizer counting the calls to its CalcMin().
+class CountingBoxSizer : public wxBoxSizer
+{
+public:
+    CountingBoxSizer() : wxBoxSizer(wxVERTICAL), m_count(0) { }
+
+    virtual wxSize CalcMin() override
+    {
+        m_count++;
+        return wxBoxSizer::CalcMin();
+    }
+
+    int m_count;
+};
+
+} // anonymous namespace
+
+TEST_CASE_METHOD(BoxSizerTestCase, "BoxSizer::MinSizeCache", "[sizer]")
+{
+    wxSizer::EnableMinSizeCache();
+    wxON_BLOCK_EXIT1(wxSizer::EnableMinSizeCache, false);
+
+    CountingBoxSizer* const unchanged = new CountingBoxSizer();
+    wxWindow* const child1 = new wxWindow(m_win, wxID_ANY);
+    child1->SetMinSize(wxSize(10, 10));
+    unchanged->Add(child1);
+
+    CountingBoxSizer* const changed = new CountingBoxSizer();
+    wxWindow* const child2 = new wxWindow(m_win, wxID_ANY);
+    child2->SetMinSize(wxSize(10, 10));
+    changed->Add(child2);
+
+    m_sizer->Add(unchanged);
+    m_sizer->Add(changed);
+    m_win->Layout();
+
+    CHECK( changed->GetContainingSizer() == m_sizer );
+    CHECK( m_sizer->GetMinSize() == wxSize(20, 10) );
+    CHECK( child2->GetRect() == wxRect(10, 0, 10, 10) );
+
+    // Nothing changed, so neither sizer should be recalculated.
+    unchanged->m_count =
+    changed->m_count = 0;
+    m_win->Layout();
+    CHECK( unchanged->m_count == 0 );
+    CHECK( changed->m_count == 0 );
+
+    // Changing one window must relayout only the sizer containing it.
+    child2->SetMinSize(wxSize(30, 20));
+    m_win->Layout();
+    CHECK( unchanged->m_count == 0 );
+    CHECK( changed->m_count > 0 );
+    CHECK( m_sizer->GetMinSize() == wxSize(40, 20) );
+    CHECK( child2->GetRect() == wxRect(10, 0, 30, 20) );
+
+    // Hiding a window must be taken into account too.
+    child2->Hide();
+    m_win->Layout();
+    CHECK( m_sizer->GetMinSize() == wxSize(10, 10) );
+
+    // As well as changing the item flags.
+    child2->Show();
+    changed->GetItem(child2)->SetBorder(5);
+    changed->GetItem(child2)->SetFlag(wxALL);
+    m_win->Layout();
+    CHECK( m_sizer->GetMinSize() == wxSize(50, 30) );
+    CHECK( child2->GetRect() == wxRect(15, 5, 30, 20) );
+}
+
 TEST_CASE("Sizer::CombineFlags", "[sizer]")
 {
     // This is a compile-time test which simply verifies that we can combine
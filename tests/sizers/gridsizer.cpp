@@ -19,6 +19,8 @@
     #include "wx/vector.h"
 #endif // WX_PRECOMP
 
+#include "wx/gbsizer.h"
+
 #include "asserthelper.h"
 
 // ----------------------------------------------------------------------------
@@ -252,3 +254,27 @@ TEST_CASE_METHOD(FlexGridSizerTestCase,
     CHECK( children[2]->GetSize() == wxSize(20, 50) );
     CHECK( children[3]->GetSize() == wxSize(80, 50) );
 }
+
+TEST_CASE("wxGridBagSizer::Spans", "[grid-sizer][sizer]")
+{
+    wxGridBagSizer sizer(5, 5);
+
+    sizer.Add(30, 20, wxGBPosition(0, 0), wxDefaultSpan, wxEXPAND);
+    sizer.Add(10, 10, wxGBPosition(0, 1), wxDefaultSpan, wxEXPAND);
+    wxSizerItem* const
+        itemRow = sizer.Add(100, 10, wxGBPosition(1, 0), wxGBSpan(1, 2), wxEXPAND);
+    wxSizerItem* const
+        itemCol = sizer.Add(20, 50, wxGBPosition(0, 2), wxGBSpan(2, 1), wxEXPAND);
+
+    // The rows and columns spanned by the items must be just big enough for
+    // them: the first row doesn't need to be as big as a half of the item
+    // spanning 2 rows and the second column must accommodate the part of the
+    // item spanning 2 columns which doesn't fit into the first one.
+    const wxSize minSize = sizer.CalcMin();
+    CHECK( minSize == wxSize(30 + 5 + 65 + 5 + 20, 20 + 5 + 25) );
+
+    sizer.SetDimension(wxPoint(0, 0), minSize);
+    CHECK( sizer.GetCellSize(0, 1) == wxSize(65, 20) );
+    CHECK( itemRow->GetRect() == wxRect(0, 25, 100, 25) );
+    CHECK( itemCol->GetRect() == wxRect(105, 0, 20, 50) );
+}
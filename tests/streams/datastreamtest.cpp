@@ -20,6 +20,7 @@
 #include <vector>
 
 #include "wx/datstrm.h"
+#include "wx/mstream.h"
 #include "wx/wfstream.h"
 #include "wx/math.h"
 
@@ -310,3 +311,176 @@ void DataStreamTestCase::NaNRW()
 }
 
 
+
+namespace
+{
+
+// Check that writing array of values produces exactly the same output as
+// writing them one by one and that it can be read back correctly.
+template <typename T>
+void
+CheckArrayRW(const std::vector<T>& values,
+             bool bigEndian,
+             bool basicPrecision,
+             void (wxDataOutputStream::*writeOne)(T),
+             T (wxDataInputStream::*readOne)(),
+             void (wxDataOutputStream::*writeArray)(const T*, size_t),
+             void (wxDataInputStream::*readArray)(T*, size_t))
+{
+    INFO("Big endian: " << bigEndian << ", basic: " << basicPrecision);
+
+    wxMemoryOutputStream mosOne,
+                         mosArray;
+    {
+        wxDataOutputStream dosOne(mosOne),
+                           dosArray(mosArray);
+        dosOne.BigEndianOrdered(bigEndian);
+        dosArray.BigEndianOrdered(bigEndian);
+        if ( basicPrecision )
+        {
+            dosOne.UseBasicPrecisions();
+            dosArray.UseBasicPrecisions();
+        }
+
+        for ( size_t n = 0; n < values.size(); n++ )
+            (dosOne.*writeOne)(values[n]);
+
+        (dosArray.*writeArray)(values.data(), values.size());
+    }
+
+    const size_t len = mosOne.GetLength();
+    REQUIRE( mosArray.GetLength() == len );
+
+    std::vector<char> bufOne(len),
+                      bufArray(len);
+    mosOne.CopyTo(bufOne.data(), len);
+    mosArray.CopyTo(bufArray.data(), len);
+    CHECK( bufOne == bufArray );
+
+    wxMemoryInputStream mis(bufArray.data(), len);
+    wxDataInputStream dis(mis);
+    dis.BigEndianOrdered(bigEndian);
+    if ( basicPrecision )
+        dis.UseBasicPrecisions();
+
+    // Read the first value individually to check that reading an array
+    // works correctly when not starting at the stream beginning.
+    REQUIRE( !values.empty() );
+    CHECK( (dis.*readOne)() == values[0] );
+
+    std::vector<T> valuesIn(values.size() - 1);
+    (dis.*readArray)(valuesIn.data(), valuesIn.size());
+    CHECK( std::equal(valuesIn.begin(), valuesIn.end(), values.begin() + 1) );
+    CHECK( mis.Eof() == false );
+    CHECK( mis.TellI() == static_cast<wxFileOffset>(len) );
+}
+
+} // anonymous namespace
+
+TEST_CASE("wxDataStream::Arrays", "[stream][data]")
+{
+    const bool bigEndian = GENERATE(false, true);
+
+    // Use a number of elements which is not a multiple of any SIMD vector size
+    // to check that the remaining elements are handled correctly too.
+    const size_t count = 1027;
+
+    SECTION("16 bit")
+    {
+        std::vector<wxUint16> values(count);
+        for ( size_t n = 0; n < count; n++ )
+            values[n] = static_cast<wxUint16>(n * 0x0102 + 1);
+
+        CheckArrayRW(values, bigEndian, false,
+                     &wxDataOutputStream::Write16, &wxDataInputStream::Read16,
+                     &wxDataOutputStream::Write16, &wxDataInputStream::Read16);
+    }
+
+    SECTION("32 bit")
+    {
+        std::vector<wxUint32> values(count);
+        for ( size_t n = 0; n < count; n++ )
+            values[n] = static_cast<wxUint32>(n * 0x01020304 + 1);
+
+        CheckArrayRW(values, bigEndian, false,
+                     &wxDataOutputStream::Write32, &wxDataInputStream::Read32,
+                     &wxDataOutputStream::Write32, &wxDataInputStream::Read32);
+    }
+
+#if wxHAS_INT64
+    SECTION("64 bit")
+    {
+        std::vector<wxUint64> values(count);
+        for ( size_t n = 0; n < count; n++ )
+            values[n] = n * wxULL(0x0102030405060708) + 1;
+
+        CheckArrayRW(values, bigEndian, false,
+                     &wxDataOutputStream::Write64, &wxDataInputStream::Read64,
+                     &wxDataOutputStream::Write64, &wxDataInputStream::Read64);
+    }
+#endif // wxHAS_INT64
+
+    SECTION("float")
+    {
+        const bool basic = GENERATE(false, true);
+
+        std::vector<float> values(count);
+        for ( size_t n = 0; n < count; n++ )
+            values[n] = static_cast<float>(n) / 8 - 17;
+
+        CheckArrayRW(values, bigEndian, basic,
+                     &wxDataOutputStream::WriteFloat, &wxDataInputStream::ReadFloat,
+                     &wxDataOutputStream::WriteFloat, &wxDataInputStream::ReadFloat);
+    }
+
+    SECTION("double")
+    {
+        const bool basic = GENERATE(false, true);
+
+        std::vector<double> values(count);
+        for ( size_t n = 0; n < count; n++ )
+            values[n] = static_cast<double>(n) / 1024 - 1e10;
+
+        CheckArrayRW(values, bigEndian, basic,
+                     &wxDataOutputStream::WriteDouble, &wxDataInputStream::ReadDouble,
+                     &wxDataOutputStream::WriteDouble, &wxDataInputStream::ReadDouble);
+    }
+}
+
+TEST_CASE("wxDataStream::Vector", "[stream][data]")
+{
+    std::vector<wxInt32> values;
+    for ( int n = -500; n < 500; n++ )
+        values.push_back(n * 12345);
+
+    std::vector<float> floats;
+    floats.push_back(1.5f);
+    floats.push_back(-2.25f);
+
+    wxMemoryOutputStream mos;
+    {
+        wxDataOutputStream dos(mos);
+        dos.UseBasicPrecisions();
+        dos.WriteVector(values);
+        dos.WriteVector(floats);
+        dos.WriteVector(std::vector<double>());
+    }
+
+    CHECK( mos.GetLength() == static_cast<wxFileOffset>(4 * values.size() + 4 * floats.size()) );
+
+    wxMemoryInputStream mis(mos);
+    wxDataInputStream dis(mis);
+    dis.UseBasicPrecisions();
+
+    std::vector<wxInt32> valuesIn(3, 17);
+    dis.ReadVector(valuesIn, values.size());
+    CHECK( valuesIn == values );
+
+    std::vector<float> floatsIn;
+    dis.ReadVector(floatsIn, floats.size());
+    CHECK( floatsIn == floats );
+
+    std::vector<double> empty(1);
+    dis.ReadVector(empty, 0);
+    CHECK( empty.empty() );
+}
@@ -0,0 +1,160 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        tests/streams/lz4stream.cpp
+// Purpose:     Unit tests for LZ4 stream classes
+// Author:      wxWidgets team
+// Created:     2026-10-14
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+#include "testprec.h"
+
+
+#if wxUSE_LIBLZ4 && wxUSE_STREAMS
+
+#include "wx/log.h"
+#include "wx/mstream.h"
+#include "wx/lz4stream.h"
+
+#include "bstream.h"
+
+#include <memory>
+
+class LZ4Stream : public BaseStreamTestCase<wxLZ4InputStream, wxLZ4OutputStream>
+{
+public:
+    LZ4Stream();
+
+    CPPUNIT_TEST_SUITE(LZ4Stream);
+        // Base class stream tests.
+        CPPUNIT_TEST(Input_GetSizeFail);
+        CPPUNIT_TEST(Input_GetC);
+        CPPUNIT_TEST(Input_Read);
+        CPPUNIT_TEST(Input_Eof);
+        CPPUNIT_TEST(Input_LastRead);
+        CPPUNIT_TEST(Input_CanRead);
+        CPPUNIT_TEST(Input_SeekIFail);
+        CPPUNIT_TEST(Input_TellI);
+        CPPUNIT_TEST(Input_Peek);
+        CPPUNIT_TEST(Input_Ungetch);
+
+        CPPUNIT_TEST(Output_PutC);
+        CPPUNIT_TEST(Output_Write);
+        CPPUNIT_TEST(Output_LastWrite);
+        CPPUNIT_TEST(Output_SeekOFail);
+        CPPUNIT_TEST(Output_TellO);
+    CPPUNIT_TEST_SUITE_END();
+
+protected:
+    wxLZ4InputStream *DoCreateInStream() override;
+    wxLZ4OutputStream *DoCreateOutStream() override;
+
+private:
+    wxDECLARE_NO_COPY_CLASS(LZ4Stream);
+};
+
+STREAM_TEST_SUBSUITE_NAMED_REGISTRATION(LZ4Stream)
+
+LZ4Stream::LZ4Stream()
+{
+    // Disable TellI() and TellO() tests in the base class which don't work
+    // with the compressed streams.
+    m_bSimpleTellITest =
+    m_bSimpleTellOTest = true;
+}
+
+wxLZ4InputStream *LZ4Stream::DoCreateInStream()
+{
+    // Compress some data.
+    const char data[] = "This is just some test data for LZ4 streams unit test";
+    const size_t len = sizeof(data);
+
+    wxMemoryOutputStream outmem;
+    wxLZ4OutputStream outz(outmem);
+    outz.Write(data, len);
+    REQUIRE( outz.LastWrite() == len );
+    REQUIRE( outz.Close() );
+
+    wxMemoryInputStream* const inmem = new wxMemoryInputStream(outmem);
+    REQUIRE( inmem->IsOk() );
+
+    // Give ownership of the memory input stream to the LZ4 stream.
+    return new wxLZ4InputStream(inmem);
+}
+
+wxLZ4OutputStream *LZ4Stream::DoCreateOutStream()
+{
+    return new wxLZ4OutputStream(new wxMemoryOutputStream());
+}
+
+TEST_CASE("wxLZ4Stream::RoundTrip", "[stream][lz4]")
+{
+    wxString data;
+    for ( int n = 0; n < 100000; n++ )
+        data << n % 1000 << ' ';
+    const wxScopedCharBuffer buf = data.utf8_str();
+
+    // Write the data in 2 parts, flushing the stream in between, to check
+    // that this works too.
+    wxMemoryOutputStream outmem;
+    {
+        wxLZ4OutputStream outz(outmem, 9);
+        const size_t half = buf.length() / 2;
+        CHECK( outz.Write(buf.data(), half).LastWrite() == half );
+        outz.Sync();
+        CHECK( outz.Write(buf.data() + half, buf.length() - half).IsOk() );
+        REQUIRE( outz.Close() );
+    }
+
+    const size_t compressedLen = outmem.GetSize();
+    CHECK( compressedLen < buf.length() / 2 );
+
+    wxCharBuffer compressed(compressedLen);
+    outmem.CopyTo(compressed.data(), compressedLen);
+
+    SECTION("Concatenated")
+    {
+        // Several frames following each other must be decompressed as one.
+        wxMemoryOutputStream inmem;
+        inmem.Write(compressed.data(), compressedLen);
+        inmem.Write(compressed.data(), compressedLen);
+
+        wxLZ4InputStream inz(new wxMemoryInputStream(inmem));
+        wxMemoryOutputStream outdata;
+        inz.Read(outdata);
+        CHECK( inz.GetLastError() == wxSTREAM_EOF );
+        REQUIRE( outdata.GetSize() == 2*buf.length() );
+
+        wxCharBuffer result(outdata.GetSize());
+        outdata.CopyTo(result.data(), result.length());
+        CHECK( memcmp(result.data(), buf.data(), buf.length()) == 0 );
+        CHECK( memcmp(result.data() + buf.length(), buf.data(), buf.length()) == 0 );
+    }
+
+    SECTION("Truncated")
+    {
+        wxMemoryInputStream intrunc(compressed.data(), compressedLen - 1);
+        wxLZ4InputStream inz(intrunc);
+
+        wxLogNull noLog;
+        wxMemoryOutputStream outdata;
+        inz.Read(outdata);
+        CHECK( inz.GetLastError() == wxSTREAM_READ_ERROR );
+    }
+
+    SECTION("Factory")
+    {
+        const wxFilterClassFactory* const
+            fcf = wxFilterClassFactory::Find("data.lz4", wxSTREAM_FILEEXT);
+        REQUIRE( fcf );
+
+        std::unique_ptr<wxFilterInputStream>
+            inz(fcf->NewStream(new wxMemoryInputStream(compressed.data(),
+                                                       compressedLen)));
+        wxMemoryOutputStream outdata;
+        inz->Read(outdata);
+        CHECK( outdata.GetSize() == buf.length() );
+    }
+}
+
+#endif // wxUSE_LIBLZ4 && wxUSE_STREAMS
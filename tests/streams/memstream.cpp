@@ -156,3 +156,68 @@ void memStream::Ctor_InFromOut()
 // Register the stream sub suite, by using some stream helper macro.
 // Note: Don't forget to connect it to the base suite (See: bstream.cpp => StreamCase::suite())
 STREAM_TEST_SUBSUITE_NAMED_REGISTRATION(memStream)
+
+TEST_CASE("wxInputStream::PeekBuffer", "[stream][memory][buffer]")
+{
+    const char data[] = "0123456789";
+    const size_t len = strlen(data);
+
+    SECTION("Memory")
+    {
+        wxMemoryInputStream mis(data, len);
+
+        const void* p;
+        REQUIRE( mis.PeekBuffer(&p) == len );
+        CHECK( p == data );
+
+        mis.ConsumeBuffer(3);
+        CHECK( mis.TellI() == 3 );
+        CHECK( mis.GetC() == '3' );
+
+        // Data put back must be returned first.
+        mis.Ungetch("ab", 2);
+        REQUIRE( mis.PeekBuffer(&p) == 2 );
+        CHECK( memcmp(p, "ab", 2) == 0 );
+        mis.ConsumeBuffer(2);
+
+        REQUIRE( mis.PeekBuffer(&p) == len - 4 );
+        CHECK( p == data + 4 );
+        mis.ConsumeBuffer(len - 4);
+
+        CHECK( mis.PeekBuffer(&p) == 0 );
+        CHECK( mis.GetC() == wxEOF );
+        CHECK( mis.Eof() );
+    }
+
+    SECTION("Buffered")
+    {
+        wxMemoryInputStream mis(data, len);
+        wxBufferedInputStream bis(mis, 4);
+
+        wxString all;
+        const void* p;
+        while ( size_t n = bis.PeekBuffer(&p) )
+        {
+            CHECK( n <= 4 );
+            all += wxString(static_cast<const char*>(p), n);
+            bis.ConsumeBuffer(n);
+        }
+
+        CHECK( all == data );
+    }
+
+    SECTION("Copy")
+    {
+        wxMemoryInputStream mis(data, len);
+        mis.GetC();
+
+        wxMemoryOutputStream mos;
+        mis.Read(mos);
+        CHECK( mis.LastRead() == len - 1 );
+
+        REQUIRE( mos.GetLength() == wxFileOffset(len - 1) );
+        char buf[16];
+        mos.CopyTo(buf, len - 1);
+        CHECK( memcmp(buf, data + 1, len - 1) == 0 );
+    }
+}
@@ -353,3 +353,92 @@ TEST_CASE("wxTextInputStream::GetChar", "[text][input][stream][char]")
         CHECK( tis.GetInputStream().Eof() );
     }
 }
+
+namespace
+{
+
+// Read all lines using wxTextLineReader with the given block size and return
+// them as a single string with the line types indicated by "|N", "|U", "|D"
+// or "|M" after each line.
+wxString
+ReadAllLines(const void* buf, size_t len, const wxMBConv& conv, size_t blockSize)
+{
+    wxMemoryInputStream mis(buf, len);
+    wxTextLineReader reader(mis, conv, blockSize);
+
+    wxString all;
+    wxString line;
+    wxTextFileType type;
+    while ( reader.ReadLine(line, &type) )
+    {
+        const char* const types = "NUDMO";
+        all << line << '|' << types[type];
+
+        REQUIRE( reader.GetLine() == line );
+    }
+
+    CHECK( reader.IsOk() );
+
+    return all;
+}
+
+} // anonymous namespace
+
+TEST_CASE("wxTextLineReader", "[text][input][stream][lines]")
+{
+    const size_t blockSize = GENERATE(1, 2, 3, 5, 7, 64);
+    INFO("Block size " << blockSize);
+
+    SECTION("Empty")
+    {
+        CHECK( ReadAllLines("", 0, wxConvAuto(), blockSize) == "" );
+        CHECK( ReadAllLines("\xef\xbb\xbf", 3, wxConvAuto(), blockSize) == "" );
+    }
+
+    SECTION("EOL")
+    {
+        const char text[] = "Unix\nDOS\r\nMac\r\r\n\nLast";
+        CHECK( ReadAllLines(text, strlen(text), wxConvAuto(), blockSize) ==
+               "Unix|UDOS|DMac|M|D|ULast|N" );
+
+        CHECK( ReadAllLines("\r", 1, wxConvAuto(), blockSize) == "|M" );
+        CHECK( ReadAllLines("x\n", 2, wxConvAuto(), blockSize) == "x|U" );
+    }
+
+    SECTION("UTF-8")
+    {
+        // Multibyte characters, possibly split between the blocks.
+        const char text[] = "\xef\xbb\xbf\xd0\xbf\xd1\x80\xd0\xb8\n\xe2\x82\xac\r\n";
+        CHECK( ReadAllLines(text, strlen(text), wxConvAuto(), blockSize) ==
+               wxString::FromUTF8("\xd0\xbf\xd1\x80\xd0\xb8|U\xe2\x82\xac|D") );
+        CHECK( ReadAllLines(text + 3, strlen(text) - 3, wxConvUTF8, blockSize) ==
+               wxString::FromUTF8("\xd0\xbf\xd1\x80\xd0\xb8|U\xe2\x82\xac|D") );
+    }
+
+    SECTION("UTF-16")
+    {
+        const wxUint8 textLE[] = { 0xff, 0xfe, 'a', 0, '\r', 0, '\n', 0,
+                                   0x0a, 0x04, '\n', 0, 'b', 0 };
+        CHECK( ReadAllLines(textLE, sizeof(textLE), wxConvAuto(), blockSize) ==
+               wxString::FromUTF8("a|D\xd0\x8a|Ub|N") );
+
+        const wxUint8 textBE[] = { 0xfe, 0xff, 0, 'a', 0, '\n', 0, '\n',
+                                   0xd8, 0x3d, 0xde, 0x00 };
+        CHECK( ReadAllLines(textBE, sizeof(textBE), wxConvAuto(), blockSize) ==
+               wxString::FromUTF8("a|U|U\xf0\x9f\x98\x80|N") );
+    }
+
+    SECTION("Invalid")
+    {
+        wxMemoryInputStream mis("ok\n\xff\xfe\xfd\n", 7);
+        wxTextLineReader reader(mis, wxConvUTF8, blockSize);
+        // Depending on the block size, the first line may or not be returned
+        // before the error is detected, but it must be detected in any case.
+        wxString line;
+        while ( reader.ReadLine(line) )
+            CHECK( line == "ok" );
+
+        CHECK( reader.GetLineNumber() <= 1 );
+        CHECK( !reader.IsOk() );
+    }
+}
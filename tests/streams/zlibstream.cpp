@@ -548,3 +548,98 @@ void zlibStream::genExtTestData(wxTextOutputStream &out, const char *buf, int fl
 // Note: Don't forget to connect it to the base suite (See: bstream.cpp => StreamCase::suite())
 STREAM_TEST_SUBSUITE_NAMED_REGISTRATION(zlibStream)
 
+
+#if wxUSE_THREADS
+
+namespace
+{
+
+// Return data big enough to be split into several blocks and compressible,
+// but not too trivially.
+std::string MakeParallelTestData()
+{
+    std::string data;
+    for ( int n = 0; data.size() < 1000000; n++ )
+        data += wxString::Format("Line %d: %d\n", n, (n * 7919) % 1009).utf8_string();
+    return data;
+}
+
+} // anonymous namespace
+
+TEST_CASE("wxZlibOutputStream::SetThreadCount", "[stream][zlib][thread]")
+{
+    const std::string data = MakeParallelTestData();
+
+    const bool sync = GENERATE(false, true);
+
+    int flags = wxZLIB_ZLIB;
+    SECTION("zlib") { }
+    SECTION("gzip") { flags = wxZLIB_GZIP; }
+    SECTION("raw")  { flags = wxZLIB_NO_HEADER; }
+
+    wxMemoryOutputStream mos;
+    {
+        wxZlibOutputStream zos(mos, wxZ_DEFAULT_COMPRESSION, flags);
+        REQUIRE( zos.SetThreadCount(4) );
+
+        // Write the data in chunks not corresponding to the block size.
+        const size_t chunk = 100000;
+        for ( size_t pos = 0; pos < data.size(); pos += chunk )
+        {
+            const size_t len = wxMin(chunk, data.size() - pos);
+            REQUIRE( zos.Write(&data[pos], len).LastWrite() == len );
+
+            if ( sync && pos == 5*chunk )
+                zos.Sync();
+        }
+
+        CHECK( zos.TellO() == static_cast<wxFileOffset>(data.size()) );
+
+        // It's too late to change the number of threads now.
+        CHECK( !zos.SetThreadCount(1) );
+
+        CHECK( zos.Close() );
+    }
+
+    // Compressing in parallel loses only a little compression ratio.
+    CHECK( mos.GetSize() < data.size() / 2 );
+
+    wxMemoryInputStream mis(mos);
+    wxZlibInputStream zis(mis, flags == wxZLIB_NO_HEADER ? wxZLIB_NO_HEADER
+                                                         : wxZLIB_AUTO);
+
+    std::string result(data.size() + 1, '\0');
+    zis.Read(&result[0], result.size());
+    REQUIRE( zis.LastRead() == data.size() );
+    result.resize(zis.LastRead());
+    CHECK( result == data );
+
+    // Also check that the checksum in the trailer is correct, which is only
+    // verified by zlib when trying to read beyond the end of the data.
+    if ( flags != wxZLIB_NO_HEADER )
+    {
+        char c;
+        zis.Read(&c, 1);
+        CHECK( zis.GetLastError() == wxSTREAM_EOF );
+    }
+}
+
+TEST_CASE("wxZlibOutputStream::SetThreadCount::Empty", "[stream][zlib][thread]")
+{
+    wxMemoryOutputStream mos;
+    {
+        wxZlibOutputStream zos(mos, wxZ_DEFAULT_COMPRESSION, wxZLIB_GZIP);
+        REQUIRE( zos.SetThreadCount(0) );
+        CHECK( zos.Close() );
+    }
+
+    wxMemoryInputStream mis(mos);
+    wxZlibInputStream zis(mis);
+
+    char c;
+    zis.Read(&c, 1);
+    CHECK( zis.LastRead() == 0 );
+    CHECK( zis.GetLastError() == wxSTREAM_EOF );
+}
+
+#endif // wxUSE_THREADS
@@ -0,0 +1,199 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        tests/streams/zstdstream.cpp
+// Purpose:     Unit tests for Zstandard stream classes
+// Author:      wxWidgets team
+// Created:     2026-10-14
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+#include "testprec.h"
+
+
+#if wxUSE_LIBZSTD && wxUSE_STREAMS
+
+#include "wx/log.h"
+#include "wx/mstream.h"
+#include "wx/zstdstream.h"
+
+#include "bstream.h"
+
+#include <memory>
+
+class ZstdStream : public BaseStreamTestCase<wxZstdInputStream, wxZstdOutputStream>
+{
+public:
+    ZstdStream();
+
+    CPPUNIT_TEST_SUITE(ZstdStream);
+        // Base class stream tests.
+        CPPUNIT_TEST(Input_GetSizeFail);
+        CPPUNIT_TEST(Input_GetC);
+        CPPUNIT_TEST(Input_Read);
+        CPPUNIT_TEST(Input_Eof);
+        CPPUNIT_TEST(Input_LastRead);
+        CPPUNIT_TEST(Input_CanRead);
+        CPPUNIT_TEST(Input_SeekIFail);
+        CPPUNIT_TEST(Input_TellI);
+        CPPUNIT_TEST(Input_Peek);
+        CPPUNIT_TEST(Input_Ungetch);
+
+        CPPUNIT_TEST(Output_PutC);
+        CPPUNIT_TEST(Output_Write);
+        CPPUNIT_TEST(Output_LastWrite);
+        CPPUNIT_TEST(Output_SeekOFail);
+        CPPUNIT_TEST(Output_TellO);
+    CPPUNIT_TEST_SUITE_END();
+
+protected:
+    wxZstdInputStream *DoCreateInStream() override;
+    wxZstdOutputStream *DoCreateOutStream() override;
+
+private:
+    wxDECLARE_NO_COPY_CLASS(ZstdStream);
+};
+
+STREAM_TEST_SUBSUITE_NAMED_REGISTRATION(ZstdStream)
+
+ZstdStream::ZstdStream()
+{
+    // Disable TellI() and TellO() tests in the base class which don't work
+    // with the compressed streams.
+    m_bSimpleTellITest =
+    m_bSimpleTellOTest = true;
+}
+
+wxZstdInputStream *ZstdStream::DoCreateInStream()
+{
+    // Compress some data.
+    const char data[] = "This is just some test data for Zstandard streams unit test";
+    const size_t len = sizeof(data);
+
+    wxMemoryOutputStream outmem;
+    wxZstdOutputStream outz(outmem);
+    outz.Write(data, len);
+    REQUIRE( outz.LastWrite() == len );
+    REQUIRE( outz.Close() );
+
+    wxMemoryInputStream* const inmem = new wxMemoryInputStream(outmem);
+    REQUIRE( inmem->IsOk() );
+
+    // Give ownership of the memory input stream to the Zstandard stream.
+    return new wxZstdInputStream(inmem);
+}
+
+wxZstdOutputStream *ZstdStream::DoCreateOutStream()
+{
+    return new wxZstdOutputStream(new wxMemoryOutputStream());
+}
+
+TEST_CASE("wxZstdStream::RoundTrip", "[stream][zstd]")
+{
+    wxString data;
+    for ( int n = 0; n < 100000; n++ )
+        data << n % 1000 << ' ';
+    const wxScopedCharBuffer buf = data.utf8_str();
+
+    // Write the data in 2 parts, flushing the stream in between, to check
+    // that this works too.
+    wxMemoryOutputStream outmem;
+    {
+        wxZstdOutputStream outz(outmem, 9);
+        const size_t half = buf.length() / 2;
+        CHECK( outz.Write(buf.data(), half).LastWrite() == half );
+        outz.Sync();
+        CHECK( outz.Write(buf.data() + half, buf.length() - half).IsOk() );
+        REQUIRE( outz.Close() );
+    }
+
+    const size_t compressedLen = outmem.GetSize();
+    CHECK( compressedLen < buf.length() / 2 );
+
+    wxCharBuffer compressed(compressedLen);
+    outmem.CopyTo(compressed.data(), compressedLen);
+
+    SECTION("Concatenated")
+    {
+        // Several frames following each other must be decompressed as one.
+        wxMemoryOutputStream inmem;
+        inmem.Write(compressed.data(), compressedLen);
+        inmem.Write(compressed.data(), compressedLen);
+
+        wxZstdInputStream inz(new wxMemoryInputStream(inmem));
+        wxMemoryOutputStream outdata;
+        inz.Read(outdata);
+        CHECK( inz.GetLastError() == wxSTREAM_EOF );
+        REQUIRE( outdata.GetSize() == 2*buf.length() );
+
+        wxCharBuffer result(outdata.GetSize());
+        outdata.CopyTo(result.data(), result.length());
+        CHECK( memcmp(result.data(), buf.data(), buf.length()) == 0 );
+        CHECK( memcmp(result.data() + buf.length(), buf.data(), buf.length()) == 0 );
+    }
+
+    SECTION("Truncated")
+    {
+        wxMemoryInputStream intrunc(compressed.data(), compressedLen - 1);
+        wxZstdInputStream inz(intrunc);
+
+        wxLogNull noLog;
+        wxMemoryOutputStream outdata;
+        inz.Read(outdata);
+        CHECK( inz.GetLastError() == wxSTREAM_READ_ERROR );
+    }
+
+    SECTION("Factory")
+    {
+        const wxFilterClassFactory* const
+            fcf = wxFilterClassFactory::Find("data.zst", wxSTREAM_FILEEXT);
+        REQUIRE( fcf );
+
+        std::unique_ptr<wxFilterInputStream>
+            inz(fcf->NewStream(new wxMemoryInputStream(compressed.data(),
+                                                       compressedLen)));
+        wxMemoryOutputStream outdata;
+        inz->Read(outdata);
+        CHECK( outdata.GetSize() == buf.length() );
+    }
+}
+
+#if wxUSE_THREADS
+
+TEST_CASE("wxZstdOutputStream::SetThreadCount", "[stream][zstd]")
+{
+    wxString data;
+    for ( int n = 0; n < 300000; n++ )
+        data << n % 1000 << ' ';
+    const wxScopedCharBuffer buf = data.utf8_str();
+
+    wxMemoryOutputStream outmem;
+    {
+        wxZstdOutputStream outz(outmem);
+
+        // This may fail if libzstd was built without threads support, just
+        // check that everything still works in this case.
+        if ( !outz.SetThreadCount(2) )
+            WARN("Multithreaded compression not supported by libzstd.");
+
+        REQUIRE( outz.Write(buf.data(), buf.length()).IsOk() );
+
+        // It's too late to change the number of threads now.
+        CHECK( !outz.SetThreadCount(1) );
+
+        REQUIRE( outz.Close() );
+    }
+
+    wxZstdInputStream inz(new wxMemoryInputStream(outmem));
+    wxMemoryOutputStream outdata;
+    inz.Read(outdata);
+    CHECK( inz.GetLastError() == wxSTREAM_EOF );
+    REQUIRE( outdata.GetSize() == buf.length() );
+
+    wxCharBuffer result(outdata.GetSize());
+    outdata.CopyTo(result.data(), result.length());
+    CHECK( memcmp(result.data(), buf.data(), buf.length()) == 0 );
+}
+
+#endif // wxUSE_THREADS
+
+#endif // wxUSE_LIBZSTD && wxUSE_STREAMS
@@ -341,3 +341,82 @@ TEST_CASE_METHOD(NumFormatterTestCase, "NumFormatter::DoubleFromString", "[numfo
     CHECK( wxNumberFormatter::FromString("123456789.012", &d) );
     CHECK( d == 123456789.012 );
 }
+
+TEST_CASE_METHOD(NumFormatterTestCase, "NumFormatter::Cached", "[numformatter]")
+{
+    if ( !CanRunTest() )
+        return;
+
+    const wxCachedNumberFormatter fmt;
+
+    CHECK( fmt.GetDecimalSeparator() == wxNumberFormatter::GetDecimalSeparator() );
+
+    // Check that the results are the same as with wxNumberFormatter.
+    const long longs[] = { 0, 1, -1, 12, 123, -1234, 12345, 123456, -1234567,
+                           LONG_MAX, LONG_MIN };
+    for ( size_t n = 0; n < WXSIZEOF(longs); ++n )
+    {
+        const long l = longs[n];
+        INFO("l=" << l);
+
+        CHECK( fmt.ToString(l) == wxNumberFormatter::ToString(l) );
+        CHECK( fmt.ToString(l, wxNumberFormatter::Style_None) ==
+                wxNumberFormatter::ToString(l, wxNumberFormatter::Style_None) );
+
+        long l2 = 0;
+        CHECK( fmt.FromString(fmt.ToString(l), &l2) );
+        CHECK( l2 == l );
+    }
+
+    CHECK( fmt.ToString(wxUINT64_MAX) == "18,446,744,073,709,551,615" );
+
+    const double doubles[] = { 0., 1., -1., 0.02, -0.02, 123.456, -1234.5,
+                               123456789.012, -0.000123, 1e-120, 1e20 };
+    const int precisions[] = { -1, 0, 1, 3, 9 };
+    for ( size_t n = 0; n < WXSIZEOF(doubles); ++n )
+    {
+        for ( size_t m = 0; m < WXSIZEOF(precisions); ++m )
+        {
+            const double d = doubles[n];
+            const int p = precisions[m];
+            INFO("d=" << d << ", precision=" << p);
+
+            CHECK( fmt.ToString(d, p) == wxNumberFormatter::ToString(d, p) );
+            CHECK( fmt.ToString(d, p, wxNumberFormatter::Style_NoTrailingZeroes) ==
+                    ToStringWithoutTrailingZeroes(d, p) );
+            CHECK( fmt.ToString(d, p, wxNumberFormatter::Style_None) ==
+                    ToStringWithTrailingZeroes(d, p) );
+        }
+    }
+
+    long l;
+    CHECK_FALSE( fmt.FromString("", &l) );
+    CHECK_FALSE( fmt.FromString("foo", &l) );
+    CHECK_FALSE( fmt.FromString("1.234", &l) );
+    CHECK_FALSE( fmt.FromString("-", &l) );
+    CHECK_FALSE( fmt.FromString("1234 ", &l) );
+    CHECK_FALSE( fmt.FromString("9223372036854775808", &l) );
+
+    CHECK( fmt.FromString(" +1,234,567", &l) );
+    CHECK( l == 1234567 );
+
+    wxULongLong_t u;
+    CHECK_FALSE( fmt.FromString("-2", &u) );
+    CHECK_FALSE( fmt.FromString("18446744073709551616", &u) );
+    CHECK( fmt.FromString("18446744073709551615", &u) );
+    CHECK( u == wxUINT64_MAX );
+
+    double d;
+    CHECK_FALSE( fmt.FromString("", &d) );
+    CHECK_FALSE( fmt.FromString("bar", &d) );
+    CHECK_FALSE( fmt.FromString("1.2.3", &d) );
+
+    CHECK( fmt.FromString("1,234,567.89012", &d) );
+    CHECK( d == 1234567.89012 );
+
+    CHECK( fmt.FromString("-0.5", &d) );
+    CHECK( d == -0.5 );
+
+    CHECK( fmt.FromString("1e-3", &d) );
+    CHECK( d == 1e-3 );
+}
@@ -94,6 +94,43 @@ TEST_CASE("StringFormat", "[wxString]")
     CHECK( wxString::Format("%1$o %1$d %1$x", 20) == "24 20 14" );
 }
 
+TEST_CASE("StringAppendFormat", "[wxString]")
+{
+    wxString s("Number: ");
+    CHECK( s.AppendFormat("%d", 17) == 2 );
+    CHECK( s == "Number: 17" );
+
+    CHECK( s.AppendFormat(", %s", "done") == 6 );
+    CHECK( s == "Number: 17, done" );
+
+    // The arguments may refer to the string itself.
+    s = "abc";
+    CHECK( s.AppendFormat("%s", s) == 3 );
+    CHECK( s == "abcabc" );
+
+    s.Printf("[%s]", s);
+    CHECK( s == "[abcabc]" );
+
+    // Check that long results are handled correctly too.
+    const wxString longStr('x', 2000);
+    s = "Long:";
+    CHECK( s.AppendFormat("%s!", longStr) == 2001 );
+    CHECK( s == "Long:" + longStr + "!" );
+
+    s.Printf("%s", longStr);
+    CHECK( s == longStr );
+
+    s = wxString::FromUTF8("\xc3\xa9t\xc3\xa9");
+    CHECK( s.AppendFormat(" %s", wxString::FromUTF8("\xc3\xa9")) == 2 );
+    CHECK( s == wxString::FromUTF8("\xc3\xa9t\xc3\xa9 \xc3\xa9") );
+    CHECK( s.length() == 5 );
+
+    // AppendFormat() shouldn't modify errno either.
+    errno = 1234;
+    s.AppendFormat("%d", 1);
+    CHECK( errno == 1234 );
+}
+
 TEST_CASE("StringFormatUnicode", "[wxString]")
 {
     // At least under FreeBSD vsnprintf(), used by wxString::Format(), doesn't
@@ -421,6 +458,14 @@ TEST_CASE("StringCompare", "[wxString]")
     CHECK( s1 != neq3 );
     CHECK( s1 != neq4 );
 
+    // Comparison with C strings must take the embedded NULs into account too.
+    CHECK( s1 != "A" );
+    CHECK( s1 > "A" );
+    CHECK( wxString("A") < "AB" );
+    CHECK( wxString("AB") > "A" );
+    CHECK( wxString() == "" );
+    CHECK( wxString() < "A" );
+
     CHECK( wxString("\n").Cmp(" ") < 0 );
     CHECK( wxString("'").Cmp("!") > 0 );
     CHECK( wxString("!").Cmp("z") < 0 );
@@ -1119,6 +1164,33 @@ TEST_CASE("StringIndexedAccess", "[wxString]")
     // the 3rd character of wxString should remain the same
     s[0] = L'\xe9';
     CHECK( (char)s[2] == 'r' );
+
+    // check that indexing long strings works, whether they contain only
+    // ASCII characters, which is optimized in UTF-8 build, or not
+    wxString ascii;
+    for ( int n = 0; n < 1000; n++ )
+        ascii += wxString::Format("%03d", n);
+
+    CHECK( ascii.length() == 3000 );
+    CHECK( (char)ascii[2999] == '9' );
+    CHECK( (char)ascii[1500] == '5' );
+    CHECK( ascii.substr(2997, 10) == "999" );
+
+    wxString nonAscii(ascii);
+    nonAscii[1000] = L'\xe9';
+    CHECK( nonAscii.length() == 3000 );
+    CHECK( (char)nonAscii[2999] == '9' );
+    CHECK( (char)nonAscii[1500] == '5' );
+    CHECK( nonAscii[1000] == L'\xe9' );
+    CHECK( nonAscii.substr(999, 3) == wxString(L"3\xe9" L"3") );
+
+    // and that modifying the string doesn't break it
+    ascii[0] = L'\xe9';
+    CHECK( ascii.length() == 3000 );
+    CHECK( (char)ascii[2999] == '9' );
+    ascii.erase(0, 1);
+    CHECK( (char)ascii[2998] == '9' );
+    CHECK( ascii.substr(2996, 10) == "999" );
 }
 
 TEST_CASE("StringBeforeAndAfter", "[wxString]")
@@ -0,0 +1,142 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        tests/thread/threadpool.cpp
+// Purpose:     Unit tests for wxThreadPool and wxParallelFor()
+// Author:      wxWidgets team
+// Created:     2026-10-14
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+// ----------------------------------------------------------------------------
+// headers
+// ----------------------------------------------------------------------------
+
+#include "testprec.h"
+
+#if wxUSE_THREADS
+
+#include "wx/threadpool.h"
+#include "wx/utils.h"
+
+#include "wx/private/parallel.h"
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+// ----------------------------------------------------------------------------
+// tests
+// ----------------------------------------------------------------------------
+
+TEST_CASE("wxThreadPool::Submit", "[thread][threadpool]")
+{
+    wxThreadPool pool(4);
+    CHECK( pool.GetMaxThreads() == 4 );
+
+    std::vector<std::future<int>> results;
+    for ( int n = 0; n < 1000; n++ )
+        results.push_back(pool.Submit([n]() { return n*n; }));
+
+    long long sum = 0;
+    for ( auto& result : results )
+        sum += result.get();
+
+    CHECK( sum == 332833500 );
+    CHECK( pool.GetThreadCount() >= 1 );
+    CHECK( pool.GetThreadCount() <= 4 );
+    CHECK( !pool.IsWorkerThread() );
+
+    SECTION("Exception")
+    {
+        auto future = pool.Submit([]() -> int { throw std::runtime_error("fail"); });
+        CHECK_THROWS_AS( future.get(), std::runtime_error );
+    }
+
+    SECTION("Nested")
+    {
+        std::atomic<int> count(0);
+        auto future = pool.Submit([&]()
+            {
+                std::vector<std::future<void>> nested;
+                for ( int n = 0; n < 100; n++ )
+                    nested.push_back(pool.Submit([&]() { count++; }));
+
+                for ( auto& f : nested )
+                    f.get();
+
+                return pool.IsWorkerThread();
+            });
+
+        CHECK( future.get() );
+        CHECK( count == 100 );
+    }
+}
+
+TEST_CASE("wxThreadPool::Dtor", "[thread][threadpool]")
+{
+    std::atomic<int> count(0);
+    {
+        wxThreadPool pool(2);
+        for ( int n = 0; n < 10; n++ )
+            pool.Submit([&]() { wxMilliSleep(10); count++; });
+    }
+
+    // All the tasks must have been done before the pool was destroyed.
+    CHECK( count == 10 );
+}
+
+TEST_CASE("wxThreadPool::SubmitAndCallAfter", "[thread][threadpool]")
+{
+    wxEvtHandler handler;
+
+    int result = 0;
+    bool done = false;
+    wxThreadPool::Get().SubmitAndCallAfter
+    (
+        &handler,
+        []() { return 17; },
+        [&](std::future<int>& future)
+        {
+            result = future.get();
+            done = true;
+        }
+    );
+
+    for ( int n = 0; n < 500 && !done; n++ )
+    {
+        wxMilliSleep(10);
+        handler.ProcessPendingEvents();
+    }
+
+    CHECK( done );
+    CHECK( result == 17 );
+}
+
+TEST_CASE("wxParallelFor", "[thread][threadpool]")
+{
+    const int count = 1000;
+    std::vector<int> values(count);
+    wxParallelFor(count, 4, [&](int start, int end)
+        {
+            for ( int n = start; n < end; n++ )
+                values[n]++;
+        });
+
+    for ( int n = 0; n < count; n++ )
+    {
+        INFO("n = " << n);
+        CHECK( values[n] == 1 );
+    }
+
+    // Check that it can also be used from a pool thread.
+    auto future = wxThreadPool::Get().Submit([]()
+        {
+            std::atomic<int> count(0);
+            wxParallelFor(100, 4, [&](int start, int end) { count += end - start; });
+            return count.load();
+        });
+
+    CHECK( future.get() == 100 );
+}
+
+#endif // wxUSE_THREADS
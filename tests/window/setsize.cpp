@@ -44,6 +44,25 @@ protected:
     virtual wxSize DoGetBestSize() const override { return wxSize(50, 250); }
 };
 
+// Helper class counting the number of times Layout() is called.
+class LayoutCountingWindow : public wxWindow
+{
+public:
+    explicit LayoutCountingWindow(wxWindow* parent)
+        : wxWindow(parent, wxID_ANY)
+    {
+    }
+
+    virtual bool Layout() override
+    {
+        m_layoutCount++;
+
+        return wxWindow::Layout();
+    }
+
+    int m_layoutCount = 0;
+};
+
 } // anonymous namespace
 
 // ----------------------------------------------------------------------------
@@ -106,3 +125,55 @@ TEST_CASE("wxWindow::MovePreservesSize", "[window][size][move]")
     w->Move(rectOrig.GetPosition() + wxPoint(100, 100));
     CHECK( w->GetSize() == rectOrig.GetSize() );
 }
+
+TEST_CASE("wxWindow::ScheduleLayout", "[window][layout]")
+{
+    std::unique_ptr<LayoutCountingWindow>
+        parent(new LayoutCountingWindow(wxTheApp->GetTopWindow()));
+    LayoutCountingWindow* const child = new LayoutCountingWindow(parent.get());
+
+    // Nothing is scheduled initially.
+    wxWindow::ProcessScheduledLayouts();
+    parent->m_layoutCount =
+    child->m_layoutCount = 0;
+
+    SECTION("Coalesce")
+    {
+        parent->ScheduleLayout();
+        parent->ScheduleLayout();
+        child->ScheduleLayout();
+        CHECK( parent->IsLayoutScheduled() );
+        CHECK( child->IsLayoutScheduled() );
+        CHECK( parent->m_layoutCount == 0 );
+
+        wxWindow::ProcessScheduledLayouts();
+        CHECK( !parent->IsLayoutScheduled() );
+        CHECK( !child->IsLayoutScheduled() );
+        CHECK( parent->m_layoutCount == 1 );
+        CHECK( child->m_layoutCount == 1 );
+
+        // Nothing remains to be done.
+        wxWindow::ProcessScheduledLayouts();
+        CHECK( parent->m_layoutCount == 1 );
+    }
+
+    SECTION("Cancel")
+    {
+        parent->ScheduleLayout();
+        parent->Layout();
+        CHECK( !parent->IsLayoutScheduled() );
+        CHECK( parent->m_layoutCount == 1 );
+
+        wxWindow::ProcessScheduledLayouts();
+        CHECK( parent->m_layoutCount == 1 );
+    }
+
+    SECTION("Destroy")
+    {
+        child->ScheduleLayout();
+        delete child;
+
+        // This must not crash.
+        wxWindow::ProcessScheduledLayouts();
+    }
+}
@@ -0,0 +1,96 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        tests/window/vscroll.cpp
+// Purpose:     Tests for wxVScrolledWindow units sizes caching
+// Author:      wxWidgets team
+// Created:     2026-10-14
+// Copyright:   (c) 2026 wxWidgets team
+///////////////////////////////////////////////////////////////////////////////
+
+// ----------------------------------------------------------------------------
+// headers
+// ----------------------------------------------------------------------------
+
+#include "testprec.h"
+
+
+#ifndef WX_PRECOMP
+    #include "wx/app.h"
+    #include "wx/window.h"
+#endif // WX_PRECOMP
+
+#include "wx/vscroll.h"
+
+#include <memory>
+
+// ----------------------------------------------------------------------------
+// tests helpers
+// ----------------------------------------------------------------------------
+
+namespace
+{
+
+// Window with many rows of slightly different heights counting the calls to
+// OnGetRowHeight().
+class CountingVScrolledWindow : public wxVScrolledWindow
+{
+public:
+    explicit CountingVScrolledWindow(wxWindow* parent)
+        : wxVScrolledWindow(parent, wxID_ANY)
+    {
+        m_extra = 0;
+        m_numCalls = 0;
+
+        SetRowCount(NUM_ROWS);
+    }
+
+    using wxVScrolledWindow::GetRowsHeight;
+
+    static const size_t NUM_ROWS = 100000;
+
+    // Extra height added to all rows and the number of OnGetRowHeight() calls.
+    wxCoord m_extra;
+    mutable size_t m_numCalls;
+
+protected:
+    virtual wxCoord OnGetRowHeight(size_t n) const override
+    {
+        m_numCalls++;
+
+        return 10 + n % 3 + m_extra;
+    }
+};
+
+} // anonymous namespace
+
+// ----------------------------------------------------------------------------
+// tests themselves
+// ----------------------------------------------------------------------------
+
+TEST_CASE("wxVScrolledWindow::RowsHeightsCache", "[window][vscroll]")
+{
+    std::unique_ptr<CountingVScrolledWindow>
+        w(new CountingVScrolledWindow(wxTheApp->GetTopWindow()));
+
+    const size_t numRows = CountingVScrolledWindow::NUM_ROWS;
+
+    // The sum of 10 + n % 3 for all rows, as the number of rows is 1 mod 3.
+    const wxCoord totalHeight = 11*(numRows - 1) + 10;
+    CHECK( w->GetRowsHeight(0, numRows) == totalHeight );
+
+    // The heights must be reused when the same rows are needed again.
+    w->m_numCalls = 0;
+    const wxCoord halfHeight = 11*(numRows / 2) - 1;
+    CHECK( w->GetRowsHeight(numRows / 2, numRows) == totalHeight - halfHeight );
+    CHECK( w->ScrollToRow(numRows / 2) );
+    CHECK( w->GetVisibleRowsBegin() == numRows / 2 );
+    CHECK( w->CalcUnscrolledPosition(0) == halfHeight );
+    CHECK( w->m_numCalls < 100 );
+
+    // But forgotten when the heights change.
+    w->m_extra = 1;
+    w->RefreshRowsHeights(numRows - 1, numRows - 1);
+    CHECK( w->GetRowsHeight(0, numRows) == totalHeight + 1 );
+
+    w->RefreshRowsHeights(0, numRows - 1);
+    CHECK( w->GetRowsHeight(0, numRows) == totalHeight + wxCoord(numRows) );
+}
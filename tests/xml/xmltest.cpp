@@ -19,6 +19,7 @@
 
 #include "wx/xml/xml.h"
 #include "wx/sstream.h"
+#include "wx/mstream.h"
 
 #include <stdarg.h>
 
@@ -610,6 +611,246 @@ void XmlTestCase::Doctype()
     CPPUNIT_ASSERT( !dt.IsValid() );
 }
 
+TEST_CASE("XML::ParseHandler", "[xml]")
+{
+    const char *xmlText =
+        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<root>\n"
+        "  <item n=\"1\"><sub/></item>\n"
+        "  <keep/>\n"
+        "  <item n=\"2\"/>\n"
+        "  <keep>text</keep>\n"
+        "</root>\n"
+    ;
+
+    // Consumes all "item" elements and remembers the order of all elements.
+    class Handler : public wxXmlParseHandler
+    {
+    public:
+        virtual bool OnElementParsed(wxXmlNode* node) override
+        {
+            m_parsed += node->GetName() + node->GetAttribute("n") + " ";
+
+            if ( node->GetName() != "item" )
+                return false;
+
+            m_items++;
+            return true;
+        }
+
+        wxString m_parsed;
+        int m_items = 0;
+    };
+
+    Handler handler;
+    wxStringInputStream sis(xmlText);
+    wxXmlDocument doc;
+    REQUIRE( doc.Load(sis, handler) );
+
+    CHECK( handler.m_items == 2 );
+    CHECK( handler.m_parsed == "sub item1 keep item2 keep root " );
+
+    // Only the elements not consumed by the handler must remain.
+    REQUIRE( doc.IsOk() );
+    CheckXml(doc.GetRoot(), "keep", "keep", nullptr);
+    CHECK( doc.GetRoot()->GetChildren()->GetNext()->GetNodeContent() == "text" );
+}
+
+TEST_CASE("XML::Reader", "[xml]")
+{
+    const char *xmlText =
+        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<!-- comment -->\n"
+        "<root a=\"1\" b=\"&lt;2&gt;\">\n"
+        "  <empty/>\n"
+        "  <text>one &amp; two\nthree</text>\n"
+        "  <![CDATA[<data>]]>\n"
+        "  <?pi target?>\n"
+        "</root>\n"
+    ;
+
+    wxStringInputStream sis(xmlText);
+    wxXmlReader reader(sis);
+
+    REQUIRE( reader.Next() == wxXML_READER_COMMENT );
+    CHECK( reader.GetValue() == " comment " );
+    CHECK( reader.GetVersion() == "1.0" );
+
+    REQUIRE( reader.Next() == wxXML_READER_START_ELEMENT );
+    CHECK( reader.GetName() == "root" );
+    CHECK( reader.GetDepth() == 0 );
+    CHECK( reader.GetLineNumber() == 3 );
+    REQUIRE( reader.GetAttributeCount() == 2 );
+    CHECK( reader.GetAttributeName(0) == "a" );
+    CHECK( reader.GetAttributeValue(0) == "1" );
+    wxXmlStringView value;
+    CHECK( reader.GetAttribute("b", &value) );
+    CHECK( value.ToString() == "<2>" );
+    CHECK_FALSE( reader.GetAttribute("c", &value) );
+
+    // White space only text is skipped by default.
+    REQUIRE( reader.Next() == wxXML_READER_START_ELEMENT );
+    CHECK( reader.GetName() == "empty" );
+    CHECK( reader.GetDepth() == 1 );
+    REQUIRE( reader.Next() == wxXML_READER_END_ELEMENT );
+    CHECK( reader.GetName() == "empty" );
+
+    REQUIRE( reader.Next() == wxXML_READER_START_ELEMENT );
+    REQUIRE( reader.Next() == wxXML_READER_TEXT );
+    CHECK( reader.GetValue() == "one & two\nthree" );
+    CHECK( reader.GetDepth() == 2 );
+    REQUIRE( reader.Next() == wxXML_READER_END_ELEMENT );
+
+    REQUIRE( reader.Next() == wxXML_READER_CDATA );
+    CHECK( reader.GetValue() == "<data>" );
+
+    REQUIRE( reader.Next() == wxXML_READER_PI );
+    CHECK( reader.GetName() == "pi" );
+    CHECK( reader.GetValue() == "target" );
+
+    REQUIRE( reader.Next() == wxXML_READER_END_ELEMENT );
+    CHECK( reader.GetName() == "root" );
+    CHECK( reader.GetDepth() == 0 );
+
+    CHECK( reader.Next() == wxXML_READER_END_DOCUMENT );
+    CHECK( reader.Next() == wxXML_READER_END_DOCUMENT );
+
+    SECTION("Error")
+    {
+        wxStringInputStream sisBad("<root>\n<a></b>\n</root>");
+        wxXmlReader readerBad(sisBad);
+        CHECK( readerBad.Next() == wxXML_READER_START_ELEMENT );
+        CHECK( readerBad.Next() == wxXML_READER_START_ELEMENT );
+        CHECK( readerBad.Next() == wxXML_READER_ERROR );
+        CHECK( readerBad.GetError().line == 2 );
+        CHECK( readerBad.Next() == wxXML_READER_ERROR );
+    }
+
+    SECTION("Whitespace")
+    {
+        wxStringInputStream sisWS("<root>\n  <a>\n  text</a>\n</root>");
+        wxXmlReader readerWS(sisWS, wxXMLDOC_KEEP_WHITESPACE_NODES);
+        CHECK( readerWS.Next() == wxXML_READER_START_ELEMENT );
+        REQUIRE( readerWS.Next() == wxXML_READER_TEXT );
+        CHECK( readerWS.GetValue() == "\n  " );
+
+        // Check that wxXmlDocument still skips the leading blank lines too.
+        wxStringInputStream sisDoc("<root>\n  <a>\n  text</a>\n</root>");
+        wxXmlDocument doc;
+        REQUIRE( doc.Load(sisDoc) );
+        CHECK( doc.GetRoot()->GetChildren()->GetNodeContent() == "  text" );
+    }
+}
+
+TEST_CASE("XML::Arena", "[xml]")
+{
+    wxString xmlText =
+        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<root>\n";
+    for ( int n = 0; n < 10000; n++ )
+        xmlText += wxString::Format("  <item n=\"%d\" a=\"x\">text %d</item>\n", n, n);
+    xmlText += "</root>\n";
+
+    wxStringInputStream sisHeap(xmlText);
+    wxXmlDocument docHeap;
+    REQUIRE( docHeap.Load(sisHeap) );
+
+    wxStringInputStream sisArena(xmlText);
+    std::unique_ptr<wxXmlDocument> docArena(new wxXmlDocument);
+    REQUIRE( docArena->Load(sisArena, wxXMLDOC_USE_ARENA) );
+
+    wxStringOutputStream sosHeap, sosArena;
+    REQUIRE( docHeap.Save(sosHeap) );
+    REQUIRE( docArena->Save(sosArena) );
+    CHECK( sosHeap.GetString() == sosArena.GetString() );
+
+    // The nodes allocated from the arena can be modified and deleted
+    // individually and must remain valid after the document is destroyed.
+    std::unique_ptr<wxXmlNode> root(docArena->DetachRoot());
+    docArena.reset();
+
+    wxXmlNode* const first = root->GetChildren();
+    REQUIRE( first );
+    CHECK( first->GetAttribute("n") == "0" );
+    CHECK( first->DeleteAttribute("a") );
+    REQUIRE( root->RemoveChild(first) );
+    delete first;
+
+    root->AddChild(new wxXmlNode(wxXML_ELEMENT_NODE, "last"));
+    CHECK( root->GetChildren()->GetNodeContent() == "text 1" );
+}
+
+TEST_CASE("XML::Binary", "[xml]")
+{
+    const char *xmlText =
+        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<!DOCTYPE resource SYSTEM \"resource.dtd\">\n"
+        "<resource version=\"2.5.3.0\">\n"
+        "  <!-- comment -->\n"
+        "  <object class=\"wxDialog\" name=\"dialog\">\n"
+        "    <title>Dialog \xc3\xa9</title>\n"
+        "    <object class=\"wxButton\" name=\"button\">\n"
+        "      <label><![CDATA[<OK>]]></label>\n"
+        "    </object>\n"
+        "  </object>\n"
+        "</resource>\n"
+    ;
+
+    wxStringInputStream sis(wxString::FromUTF8(xmlText));
+    wxXmlDocument doc;
+    REQUIRE( doc.Load(sis) );
+
+    wxMemoryOutputStream mos;
+    REQUIRE( doc.SaveBinary(mos) );
+
+    const wxStreamBuffer& buf = *mos.GetOutputStreamBuffer();
+    const void* const data = buf.GetBufferStart();
+    const size_t length = buf.GetIntPosition();
+    REQUIRE( wxXmlDocument::IsBinary(data, length) );
+    CHECK( !wxXmlDocument::IsBinary(xmlText, strlen(xmlText)) );
+
+    wxStringOutputStream sosXml;
+    REQUIRE( doc.Save(sosXml) );
+
+    SECTION("Memory")
+    {
+        wxXmlDocument docBin;
+        REQUIRE( docBin.LoadBinary(data, length) );
+        CHECK( docBin.GetDoctype().GetRootName() == "resource" );
+        CHECK( docBin.GetRoot()->GetChildren()->GetNext()->GetLineNumber() == 5 );
+
+        wxStringOutputStream sosBin;
+        REQUIRE( docBin.Save(sosBin) );
+        CHECK( sosBin.GetString() == sosXml.GetString() );
+    }
+
+    SECTION("Stream")
+    {
+        wxMemoryInputStream mis(data, length);
+        REQUIRE( wxXmlDocument::IsBinary(mis) );
+
+        wxXmlDocument docBin;
+        REQUIRE( docBin.LoadBinary(mis, wxXMLDOC_USE_ARENA) );
+
+        wxStringOutputStream sosBin;
+        REQUIRE( docBin.Save(sosBin) );
+        CHECK( sosBin.GetString() == sosXml.GetString() );
+    }
+
+    SECTION("Corrupted")
+    {
+        wxLogNull noLog;
+
+        wxXmlDocument docBin;
+        CHECK( !docBin.LoadBinary(data, length - 1) );
+
+        std::string corrupted(static_cast<const char*>(data), length);
+        corrupted[8] = '\x7f'; // unsupported format version
+        CHECK( !docBin.LoadBinary(corrupted.data(), corrupted.length()) );
+        CHECK( !docBin.IsOk() );
+    }
+}
+
 // This test is disabled by default as it requires the environment variable
 // below to be defined to point to a XML file to load.
 TEST_CASE("XML::Load", "[xml][.]")
@@ -328,6 +328,71 @@ TEST_CASE("XRC::EnvVarInPath", "[xrc]")
     CHECK( impl->GetBitmapBundle().IsOk() );
 }
 
+TEST_CASE("XRC::HandlerLookup", "[xrc]")
+{
+    class wxTestXmlHandler : public wxXmlResourceHandler
+    {
+    public:
+        explicit wxTestXmlHandler(const wxString& classname,
+                                  bool declareClass = true)
+            : m_classname(classname)
+        {
+            if ( declareClass )
+                AddHandledClass(classname);
+        }
+
+        virtual wxObject* DoCreateResource() override
+        {
+            label = GetText("label");
+            hasMissing = HasParam("missing");
+            return new wxObject;
+        }
+
+        virtual bool CanHandle(wxXmlNode* node) override
+        {
+            return IsOfClass(node, m_classname);
+        }
+
+        wxString label;
+        bool hasMissing = true;
+
+    private:
+        const wxString m_classname;
+    };
+
+    wxStringInputStream sis(R"(<?xml version="1.0" ?>
+<resource>
+  <object class="Declared" name="declared">
+    <style>0</style>
+    <label>first</label>
+    <enabled>1</enabled>
+    <label>second</label>
+  </object>
+  <object class="Undeclared" name="undeclared">
+    <label>only</label>
+  </object>
+</resource>
+    )");
+
+    wxXmlResource res;
+    REQUIRE( res.LoadDocument(new wxXmlDocument(sis), TEST_XRC_FILE) );
+
+    wxTestXmlHandler* const declared = new wxTestXmlHandler("Declared");
+    wxTestXmlHandler* const undeclared = new wxTestXmlHandler("Undeclared", false);
+    res.AddHandler(declared);
+    res.InsertHandler(undeclared);
+
+    std::unique_ptr<wxObject> obj(res.LoadObject(nullptr, "declared", "Declared"));
+    CHECK( obj );
+    CHECK( declared->label == "first" );
+    CHECK( !declared->hasMissing );
+
+    obj.reset(res.LoadObject(nullptr, "undeclared", "Undeclared"));
+    CHECK( obj );
+    CHECK( undeclared->label == "only" );
+    CHECK( !undeclared->hasMissing );
+}
+
 // This test is disabled by default as it requires the environment variable
 // below to be defined to point to a HTTP URL with the file to load.
 //
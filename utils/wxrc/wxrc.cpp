@@ -190,6 +190,7 @@ private:
     void MakePackageZIP(const wxArrayString& flist);
     void MakePackageCPP(const wxArrayString& flist);
     void MakePackagePython(const wxArrayString& flist);
+    void MakeBinaryFile(const wxArrayString& flist);
 
     void OutputGettext();
     ExtractedStrings FindStrings();
@@ -198,6 +199,7 @@ private:
     bool Validate();
 
     bool flagVerbose, flagCPP, flagPython, flagGettext, flagValidate, flagValidateOnly;
+    bool flagBinary;
     wxString parOutput, parFuncname, parOutputPath, parSchemaFile;
     wxArrayString parFiles;
     int retCode;
@@ -220,9 +222,10 @@ int XmlResApp::OnRun()
         { wxCMD_LINE_SWITCH, "e", "extra-cpp-code",  "output C++ header file with XRC derived classes" },
         { wxCMD_LINE_SWITCH, "c", "cpp-code",  "output C++ source rather than .rsc file" },
         { wxCMD_LINE_SWITCH, "p", "python-code",  "output wxPython source rather than .rsc file" },
+        { wxCMD_LINE_SWITCH, "b", "binary",  "store compiled binary XRC files which are faster to load" },
         { wxCMD_LINE_SWITCH, "g", "gettext",  "output list of translatable strings (to stdout or file if -o used)" },
         { wxCMD_LINE_OPTION, "n", "function",  "C++/Python function name (with -c or -p) [InitXmlResource]" },
-        { wxCMD_LINE_OPTION, "o", "output",  "output file [resource.xrs/cpp]" },
+        { wxCMD_LINE_OPTION, "o", "output",  "output file [resource.xrs/cpp], use .xrb extension for a single binary file" },
         { wxCMD_LINE_SWITCH, "",  "validate", "check XRC correctness (in addition to other processing)" },
         { wxCMD_LINE_SWITCH, "",  "validate-only", "check XRC correctness and do nothing else" },
         { wxCMD_LINE_OPTION, "",  "xrc-schema", "RELAX NG schema file to validate against (optional)" },
@@ -275,6 +278,7 @@ void XmlResApp::ParseParams(const wxCmdLineParser& cmdline)
     flagVerbose = cmdline.Found("v");
     flagCPP = cmdline.Found("c");
     flagPython = cmdline.Found("p");
+    flagBinary = cmdline.Found("b");
     flagH = flagCPP && cmdline.Found("e");
     flagValidateOnly = cmdline.Found("validate-only");
     flagValidate = flagValidateOnly || cmdline.Found("validate");
@@ -339,6 +343,8 @@ void XmlResApp::CompileRes()
         }
         else if (flagPython)
             MakePackagePython(files);
+        else if (flagBinary && wxFileName(parOutput).GetExt() == wxT("xrb"))
+            MakeBinaryFile(files);
         else
             MakePackageZIP(files);
     }
@@ -411,7 +417,20 @@ wxArrayString XmlResApp::PrepareTempFiles()
         }
         wxString internalName = GetInternalFileName(parFiles[i], flist);
 
-        doc.Save(parOutputPath + wxFILE_SEP_PATH + internalName);
+        const wxString outName = parOutputPath + wxFILE_SEP_PATH + internalName;
+        if (flagBinary)
+        {
+            wxFileOutputStream out(outName);
+            if (!out.IsOk() || !doc.SaveBinary(out))
+            {
+                wxLogError(wxT("Error writing file ") + outName);
+                retCode = 1;
+            }
+        }
+        else
+        {
+            doc.Save(outName);
+        }
         flist.Add(internalName);
     }
 
@@ -583,6 +602,27 @@ void XmlResApp::MakePackageZIP(const wxArrayString& flist)
 }
 
 
+void XmlResApp::MakeBinaryFile(const wxArrayString& flist)
+{
+    // The files referenced from the resources, such as bitmaps, can only be
+    // stored in the archive or in the generated code.
+    if (flist.GetCount() != 1)
+    {
+        wxLogError(wxT("Binary XRB file can only be created from a single ")
+                   wxT("XRC file not referencing any other files, ")
+                   wxT("use XRS output instead."));
+        retCode = 1;
+        return;
+    }
+
+    if (flagVerbose)
+        wxPrintf(wxT("writing %s...\n"), parOutput);
+
+    if (!wxCopyFile(parOutputPath + wxFILE_SEP_PATH + flist[0], parOutput))
+        retCode = 1;
+}
+
+
 // This function returns empty string on any file IO error.
 static wxString FileToCppArray(wxString filename, int num)
 {